@@ -89,6 +89,42 @@ TEST_F(KukaTest, ReachableTest) {
                     solvers::SolutionResult::kInfeasible_Or_Unbounded);
   }
 }
+
+TEST_F(KukaTest, MipNodeHeuristicTest) {
+  // The heuristic injects the postures reconstructed at the nodes of the
+  // branch-and-bound, which does not change the feasibility of the problem.
+  const Eigen::Vector3d ee_pos_lb_W(0.4, -0.1, 0.4);
+  const Eigen::Vector3d ee_pos_ub_W(0.6, 0.1, 0.6);
+  global_ik_.AddWorldPositionConstraint(ee_idx_, Vector3d::Zero(), ee_pos_lb_W,
+                                        ee_pos_ub_W);
+  const Eigen::Quaterniond ee_desired_orient(
+      Eigen::AngleAxisd(-M_PI / 2, Vector3d(0, 1, 0)));
+  const double angle_tol = 0.2 * M_PI;
+  global_ik_.AddWorldOrientationConstraint(ee_idx_, ee_desired_orient,
+                                           angle_tol);
+
+  solvers::GurobiSolver gurobi_solver;
+  if (gurobi_solver.available()) {
+    solvers::MathematicalProgramResult result;
+    int num_local_solves = 0;
+    gurobi_solver.AddMipNodeCallback(global_ik_.MakeMipNodeHeuristic(
+        &result, [&num_local_solves](const Eigen::VectorXd& q) {
+          ++num_local_solves;
+          return optional<Eigen::VectorXd>(q);
+        }));
+    gurobi_solver.Solve(global_ik_, {}, {}, &result);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_GT(num_local_solves, 0);
+    CheckGlobalIKSolution(result, 0.061, 0.24);
+
+    // A local solve that always fails injects nothing.
+    gurobi_solver.AddMipNodeCallback(global_ik_.MakeMipNodeHeuristic(
+        &result,
+        [](const Eigen::VectorXd&) { return optional<Eigen::VectorXd>(); }));
+    gurobi_solver.Solve(global_ik_, {}, {}, &result);
+    EXPECT_TRUE(result.is_success());
+  }
+}
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -286,6 +286,45 @@ Eigen::VectorXd GlobalInverseKinematics::ReconstructGeneralizedPositionSolution(
   return q;
 }
 
+solvers::GurobiSolver::MipNodeCallbackFunction
+GlobalInverseKinematics::MakeMipNodeHeuristic(
+    const solvers::MathematicalProgramResult* node_result,
+    std::function<optional<Eigen::VectorXd>(const Eigen::VectorXd&)>
+        local_solve) const {
+  DRAKE_DEMAND(node_result != nullptr);
+  return [this, node_result, local_solve](
+             const solvers::MathematicalProgram&,
+             const solvers::GurobiSolver::SolveStatusInfo&,
+             Eigen::VectorXd* vals, solvers::VectorXDecisionVariable* vars) {
+    Eigen::VectorXd q = ReconstructGeneralizedPositionSolution(*node_result);
+    if (!q.allFinite()) {
+      return;
+    }
+    if (local_solve) {
+      const optional<Eigen::VectorXd> q_local = local_solve(q);
+      if (!q_local) {
+        return;
+      }
+      q = *q_local;
+    }
+    const KinematicsCache<double> cache = robot_->doKinematics(q);
+    const int num_bodies = robot_->get_num_bodies();
+    vals->resize(12 * (num_bodies - 1));
+    vars->resize(12 * (num_bodies - 1));
+    for (int body_idx = 1; body_idx < num_bodies; ++body_idx) {
+      const Isometry3d X_WB = robot_->CalcBodyPoseInWorldFrame(
+          cache, robot_->get_body(body_idx));
+      const int start = 12 * (body_idx - 1);
+      for (int j = 0; j < 3; ++j) {
+        vals->segment<3>(start + 3 * j) = X_WB.linear().col(j);
+        vars->segment<3>(start + 3 * j) = R_WB_[body_idx].col(j);
+      }
+      vals->segment<3>(start + 9) = X_WB.translation();
+      vars->segment<3>(start + 9) = p_WBo_[body_idx];
+    }
+  };
+}
+
 solvers::Binding<solvers::LinearConstraint>
 GlobalInverseKinematics::AddWorldPositionConstraint(
     int body_idx, const Eigen::Vector3d& p_BQ, const Eigen::Vector3d& box_lb_F,
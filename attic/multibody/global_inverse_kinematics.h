@@ -1,8 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 
+#include "drake/common/drake_optional.h"
 #include "drake/multibody/rigid_body_tree.h"
+#include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 #include "drake/solvers/mixed_integer_rotation_constraint.h"
@@ -99,6 +102,43 @@ class GlobalInverseKinematics : public solvers::MathematicalProgram {
   Eigen::VectorXd ReconstructGeneralizedPositionSolution(
       const solvers::MathematicalProgramResult& result) const;
 
+  /**
+   * Returns a heuristic to register with GurobiSolver::AddMipNodeCallback(),
+   * which turns the solution of the relaxation at a node of the
+   * branch-and-bound into a candidate incumbent, so that good feasible
+   * solutions (and thus the pruning of the tree) are found much earlier than
+   * by the branching alone.
+   *
+   * At each node, the posture q is reconstructed from the solution of the
+   * relaxation (see ReconstructGeneralizedPositionSolution()), and optionally
+   * refined by @p local_solve, typically a nonlinear inverse kinematics
+   * problem with the same constraints, solved from the initial guess q. The
+   * body poses of the resulting posture, computed by the forward kinematics,
+   * are exactly on SO(3), and are passed to Gurobi as a partial solution,
+   * which Gurobi completes with the binary variables, and accepts as the
+   * incumbent if it satisfies the constraints and improves the cost.
+   *
+   * For example,
+   * @code
+   * solvers::GurobiSolver gurobi;
+   * solvers::MathematicalProgramResult result;
+   * gurobi.AddMipNodeCallback(global_ik.MakeMipNodeHeuristic(&result,
+   *     [&](const Eigen::VectorXd& q) { return LocalIk(q); }));
+   * gurobi.Solve(global_ik, {}, {}, &result);
+   * @endcode
+   *
+   * @param node_result The result passed to GurobiSolver::Solve(), in which
+   * the solver stores the solution at each node. It must outlive the
+   * callback.
+   * @param local_solve Returns the refined posture, or nullopt if it fails
+   * (in which case no solution is passed to Gurobi). If empty, the
+   * reconstructed posture itself is used.
+   */
+  solvers::GurobiSolver::MipNodeCallbackFunction MakeMipNodeHeuristic(
+      const solvers::MathematicalProgramResult* node_result,
+      std::function<optional<Eigen::VectorXd>(const Eigen::VectorXd&)>
+          local_solve = nullptr) const;
+
   /**
    * Adds the constraint that the position of a point `Q` on a body `B`
    * (whose index is `body_idx`), is within a box in a specified frame `F`.
@@ -243,7 +243,8 @@ top-level documentation for :py:mod:`pydrake.math`.
             self.Solve(prog, initial_guess, solver_options, result);
           },
           py::arg("prog"), py::arg("initial_guess"), py::arg("solver_options"),
-          py::arg("result"), doc.SolverInterface.Solve.doc)
+          py::arg("result"), py::call_guard<py::gil_scoped_release>(),
+          doc.SolverInterface.Solve.doc)
       .def("Solve",
           // This method really lives on SolverBase, but we manually write it
           // out here to avoid all of the overloading / inheritance hassles.
@@ -255,7 +256,7 @@ top-level documentation for :py:mod:`pydrake.math`.
             return result;
           },
           py::arg("prog"), py::arg("initial_guess"), py::arg("solver_options"),
-          doc.SolverBase.Solve.doc)
+          py::call_guard<py::gil_scoped_release>(), doc.SolverBase.Solve.doc)
       // TODO(m-chaturvedi) Add Pybind11 documentation.
       .def("solver_type",
           [](const SolverInterface& self) {
@@ -1080,7 +1081,11 @@ top-level documentation for :py:mod:`pydrake.math`.
               const optional<Eigen::VectorXd>&, const optional<SolverOptions>&>(
               &solvers::Solve),
           py::arg("prog"), py::arg("initial_guess") = py::none(),
-          py::arg("solver_options") = py::none(), doc.Solve.doc_3args)
+          py::arg("solver_options") = py::none(),
+          // The GIL is released while solving, so that other Python threads
+          // may run (e.g. other solves); costs and constraints implemented in
+          // Python reacquire it when they are evaluated.
+          py::call_guard<py::gil_scoped_release>(), doc.Solve.doc_3args)
       .def("GetInfeasibleConstraints", &solvers::GetInfeasibleConstraints,
           py::arg("prog"), py::arg("result"), py::arg("tol") = nullopt,
           doc.GetInfeasibleConstraints.doc);
@@ -12,6 +12,7 @@ from pydrake.solvers.mathematicalprogram import (
     )
 
 from functools import partial
+import threading
 import unittest
 import warnings
 
@@ -484,6 +485,30 @@ class TestMathematicalProgram(unittest.TestCase):
         self.assertAlmostEqual(cost_binding.evaluator().Eval(xstar), 0.)
         self.assertAlmostEqual(constraint_binding.evaluator().Eval(xstar), 1.)
 
+    def test_solves_in_threads(self):
+        # Solve releases the GIL, so several programs with Python costs can be
+        # solved in Python threads at once.
+        targets = [1., 2., 3., 4.]
+        solutions = [None] * len(targets)
+
+        def solve(i):
+            prog = mp.MathematicalProgram()
+            x = prog.NewContinuousVariables(1, 'x')
+            prog.AddCost(lambda x: (x[0] - targets[i])**2, vars=x)
+            prog.AddConstraint(lambda x: x, lb=[0.], ub=[10.], vars=x)
+            result = mp.Solve(prog)
+            solutions[i] = result.GetSolution(x)[0]
+
+        threads = [
+            threading.Thread(target=solve, args=(i,))
+            for i in range(len(targets))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for target, solution in zip(targets, solutions):
+            self.assertAlmostEqual(solution, target)
+
     def test_addcost_symbolic(self):
         prog = mp.MathematicalProgram()
         x = prog.NewContinuousVariables(1, 'x')
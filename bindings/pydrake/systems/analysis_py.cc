@@ -84,9 +84,14 @@ PYBIND11_MODULE(analysis, m) {
             py::keep_alive<1, 2>(),
             // Keep alive, ownership: `context` keeps `self` alive.
             py::keep_alive<3, 1>(), doc.Simulator.ctor.doc)
+        // The GIL is released while simulating, so that other Python threads
+        // may run (e.g. other simulations); Python systems and callbacks
+        // reacquire it when they are called.
         .def("Initialize", &Simulator<T>::Initialize,
+            py::call_guard<py::gil_scoped_release>(),
             doc.Simulator.Initialize.doc)
         .def("AdvanceTo", &Simulator<T>::AdvanceTo, py::arg("boundary_time"),
+            py::call_guard<py::gil_scoped_release>(),
             doc.Simulator.AdvanceTo.doc)
         .def("StepTo",
             WrapDeprecated(
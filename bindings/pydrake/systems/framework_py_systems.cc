@@ -3,6 +3,7 @@
 #include "pybind11/eigen.h"
 #include "pybind11/eval.h"
 #include "pybind11/functional.h"
+#include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
@@ -15,6 +16,7 @@
 #include "drake/bindings/pydrake/common/wrap_pybind.h"
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
+#include "drake/common/unused.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/framework/system.h"
@@ -76,11 +78,17 @@ void AddDeprecatedProtectedAliases(
 // macro), then it tries the `_{NAME}` overload.
 // N.B. No control flow will ever make `__VA_ARGS__` be evaluated more than
 // once.
-#define PYDRAKE_TRY_PROTECTED_OVERLOAD(RETURN, CLASS, NAME, ...)       \
-  PYBIND11_OVERLOAD_INT(RETURN, CLASS, NAME, __VA_ARGS__);             \
-  if (py::get_overload<CLASS>(this, "_" NAME)) {                       \
-    WarnDeprecated(DeprecatedProtectedAliasMessage(NAME, "override")); \
-    PYBIND11_OVERLOAD_INT(RETURN, CLASS, "_" NAME, __VA_ARGS__);       \
+// N.B. The overloads may be called with the GIL released (e.g. from
+// Simulator.AdvanceTo), so the fallback lookup reacquires it, as
+// `PYBIND11_OVERLOAD_INT` does.
+#define PYDRAKE_TRY_PROTECTED_OVERLOAD(RETURN, CLASS, NAME, ...)         \
+  PYBIND11_OVERLOAD_INT(RETURN, CLASS, NAME, __VA_ARGS__);               \
+  {                                                                      \
+    py::gil_scoped_acquire deprecated_overload_gil;                      \
+    if (py::get_overload<CLASS>(this, "_" NAME)) {                       \
+      WarnDeprecated(DeprecatedProtectedAliasMessage(NAME, "override")); \
+      PYBIND11_OVERLOAD_INT(RETURN, CLASS, "_" NAME, __VA_ARGS__);       \
+    }                                                                    \
   }
 
 using symbolic::Expression;
@@ -256,6 +264,14 @@ struct Impl {
     using Base = py::wrapper<VectorSystemPublic>;
     using Base::Base;
 
+    // When set (only supported for T = double), the `DoCalcVector*`
+    // overrides are called with NumPy arrays that are allocated once and
+    // reused by every call, rather than with new views of the input, state
+    // and result; the values are copied into and out of these arrays.
+    void set_use_preallocated_arrays(bool value) {
+      use_preallocated_arrays_ = value;
+    }
+
     // Trampoline virtual methods.
     void DoPublish(const Context<T>& context,
         const vector<const PublishEvent<T>*>& events) const override {
@@ -277,6 +293,10 @@ struct Impl {
       // https://github.com/pybind/pybind11/pull/1152#issuecomment-340091423
       // TODO(eric.cousineau): This will be resolved once dtype=custom is
       // resolved.
+      if (CallWithPreallocatedArrays("DoCalcVectorOutput", context, input,
+              state, output, &output_array_)) {
+        return;
+      }
       PYDRAKE_TRY_PROTECTED_OVERLOAD(void, VectorSystem<T>,
           "DoCalcVectorOutput",
           // N.B. Passing `Eigen::Map<>` derived classes by reference rather
@@ -293,6 +313,10 @@ struct Impl {
         Eigen::VectorBlock<VectorX<T>>* derivatives) const override {
       // WARNING: Mutating `derivatives` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
+      if (CallWithPreallocatedArrays("DoCalcVectorTimeDerivatives", context,
+              input, state, derivatives, &state_result_array_)) {
+        return;
+      }
       PYDRAKE_TRY_PROTECTED_OVERLOAD(void, VectorSystem<T>,
           "DoCalcVectorTimeDerivatives", &context, input, state,
           ToEigenRef(derivatives));
@@ -306,6 +330,10 @@ struct Impl {
         Eigen::VectorBlock<VectorX<T>>* next_state) const override {
       // WARNING: Mutating `next_state` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
+      if (CallWithPreallocatedArrays("DoCalcVectorDiscreteVariableUpdates",
+              context, input, state, next_state, &state_result_array_)) {
+        return;
+      }
       PYDRAKE_TRY_PROTECTED_OVERLOAD(void, VectorSystem<T>,
           "DoCalcVectorDiscreteVariableUpdates", &context, input, state,
           ToEigenRef(next_state));
@@ -313,6 +341,58 @@ struct Impl {
       Base::DoCalcVectorDiscreteVariableUpdates(
           context, input, state, next_state);
     }
+
+   private:
+    // Copies `values` into `*array`, first (re)allocating it if it is not an
+    // array of the same size.
+    static void CopyToArray(
+        const Eigen::Ref<const Eigen::VectorXd>& values, py::object* array) {
+      if (!*array || py::len(*array) != static_cast<size_t>(values.size())) {
+        *array = py::array_t<double>(values.size());
+      }
+      auto typed = py::reinterpret_borrow<py::array_t<double>>(*array);
+      Eigen::Map<Eigen::VectorXd>(typed.mutable_data(), values.size()) =
+          values;
+    }
+
+    // If preallocated arrays are in use and `name` is overridden in Python,
+    // calls the override with `context` and the preallocated input, state
+    // and result arrays, copies the result array into `result`, and returns
+    // true. Otherwise returns false.
+    bool CallWithPreallocatedArrays(const char* name, const Context<T>& context,
+        const Eigen::VectorBlock<const VectorX<T>>& input,
+        const Eigen::VectorBlock<const VectorX<T>>& state,
+        Eigen::VectorBlock<VectorX<T>>* result,
+        py::object* result_array) const {
+      if constexpr (std::is_same<T, double>::value) {
+        if (!use_preallocated_arrays_) return false;
+        // The arrays are only touched while holding the GIL, which also
+        // serializes the calls from several threads.
+        py::gil_scoped_acquire gil;
+        py::function overload =
+            py::get_overload(static_cast<const VectorSystem<T>*>(this), name);
+        if (!overload) return false;
+        CopyToArray(input, &input_array_);
+        CopyToArray(state, &state_array_);
+        CopyToArray(*result, result_array);
+        overload(&context, input_array_, state_array_, *result_array);
+        auto typed = py::reinterpret_borrow<py::array_t<double>>(*result_array);
+        *result = Eigen::Map<const Eigen::VectorXd>(
+            typed.data(), result->size());
+        return true;
+      } else {
+        unused(name, context, input, state, result, result_array);
+        return false;
+      }
+    }
+
+    bool use_preallocated_arrays_{false};
+    mutable py::object input_array_;
+    mutable py::object state_array_;
+    mutable py::object output_array_;
+    // Shared by the time derivatives and the discrete updates, which are both
+    // the size of the state.
+    mutable py::object state_result_array_;
   };
 
   static void DoScalarDependentDefinitions(py::module m) {
@@ -763,12 +843,25 @@ Note: The above is for the C++ documentation. For Python, use
     DefineTemplateClassWithDefault<VectorSystem<T>, PyVectorSystem,
         LeafSystem<T>>(m, "VectorSystem", GetPyParam<T>(), doc.VectorSystem.doc)
         .def(py::init([](int input_size, int output_size,
-                          optional<bool> direct_feedthrough) {
-          return new PyVectorSystem(
+                          optional<bool> direct_feedthrough,
+                          bool use_preallocated_arrays) {
+          if (use_preallocated_arrays && !std::is_same<T, double>::value) {
+            throw std::logic_error(
+                "use_preallocated_arrays is only supported for float");
+          }
+          auto system = new PyVectorSystem(
               input_size, output_size, direct_feedthrough);
+          system->set_use_preallocated_arrays(use_preallocated_arrays);
+          return system;
         }),
             py::arg("input_size"), py::arg("output_size"),
             py::arg("direct_feedthrough") = nullopt,
+            // Python only: whether the `DoCalcVector*` overrides are called
+            // with NumPy arrays that are allocated once and reused, which
+            // removes most of the per-call overhead (notably for small
+            // systems evaluated at high rates). The overrides must then not
+            // keep references to the arrays.
+            py::arg("use_preallocated_arrays") = false,
             doc.VectorSystem.ctor.doc_3args);
     // TODO(eric.cousineau): Bind virtual methods once we provide a function
     // wrapper to convert `Map<Derived>*` arguments.
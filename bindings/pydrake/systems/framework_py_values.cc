@@ -106,6 +106,17 @@ void DefineFrameworkPyValues(py::module m) {
               return self->get_mutable_value();
             },
             py_reference_internal, doc.BasicVector.get_mutable_value.doc)
+        // Lets `np.asarray(vector)` be a writable view of the vector rather
+        // than a copy; the view keeps the vector alive.
+        .def("__array__",
+            [](BasicVector<T>* self, py::object dtype) {
+              py::object array = py::cast(
+                  Eigen::Ref<VectorX<T>>(self->get_mutable_value()),
+                  py_reference);
+              if (dtype.is_none()) return array;
+              return array.attr("astype")(dtype, py::arg("copy") = false);
+            },
+            py::arg("dtype") = py::none(), py::keep_alive<0, 1>())
         .def("GetAtIndex",
             [](BasicVector<T>* self, int index) -> T& {
               return self->GetAtIndex(index);
@@ -182,12 +193,23 @@ void DefineFrameworkPyValues(py::module m) {
    public:
     using Base = Value<py::object>;
     using Base::Base;
+    // The object's reference count must only change while holding the GIL,
+    // which is released during e.g. Simulator.AdvanceTo.
+    ~PyObjectValue() override {
+      py::gil_scoped_acquire guard;
+      get_mutable_value().release().dec_ref();
+    }
     // Override `Value<py::object>::Clone()` to perform a deep copy on the
     // object.
     std::unique_ptr<AbstractValue> Clone() const override {
+      py::gil_scoped_acquire guard;
       py::object py_copy = py::module::import("copy").attr("deepcopy");
       return std::make_unique<PyObjectValue>(py_copy(get_value()));
     }
+    void SetFrom(const AbstractValue& other) override {
+      py::gil_scoped_acquire guard;
+      Base::SetFrom(other);
+    }
   };
   AddValueInstantiation<py::object, PyObjectValue>(m);
 
@@ -130,7 +130,23 @@ PYBIND11_MODULE(sensors, m) {
         return ToArray(self->at(0, 0), self->size(), get_shape(self));
       };
 
-      py::class_<ImageT> image(m, TemporaryClassName<ImageT>().c_str());
+      // Exposes the pixels to the buffer protocol, so that
+      // `np.asarray(image)` (or `memoryview(image)`) is a writable view of the
+      // image rather than a copy; the view keeps the image alive.
+      auto get_buffer = [](ImageT& self) {
+        const py::ssize_t item_size = sizeof(T);
+        const py::ssize_t num_channels = int{ImageTraitsT::kNumChannels};
+        T* const pixels = self.size() > 0 ? self.at(0, 0) : nullptr;
+        return py::buffer_info(pixels, item_size,
+            py::format_descriptor<T>::format(), 3,
+            {py::ssize_t{self.height()}, py::ssize_t{self.width()},
+                num_channels},
+            {item_size * num_channels * self.width(),
+                item_size * num_channels, item_size});
+      };
+
+      py::class_<ImageT> image(
+          m, TemporaryClassName<ImageT>().c_str(), py::buffer_protocol());
       AddTemplateClass(m, "Image", image, py_param);
       image  // BR
           .def(py::init<int, int>(), py::arg("width"), py::arg("height"),
@@ -147,7 +163,8 @@ PYBIND11_MODULE(sensors, m) {
           .def_property_readonly("shape", get_shape)
           .def_property_readonly("data", get_data, py_reference_internal)
           .def_property_readonly(
-              "mutable_data", get_mutable_data, py_reference_internal);
+              "mutable_data", get_mutable_data, py_reference_internal)
+          .def_buffer(get_buffer);
       // Constants.
       image.attr("Traits") = traits;
       // - Do not duplicate aliases (e.g. `kNumChannels`) for now.
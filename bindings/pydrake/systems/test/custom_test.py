@@ -3,6 +3,8 @@
 from __future__ import print_function
 
 import copy
+import itertools
+import threading
 import unittest
 import warnings
 import numpy as np
@@ -31,7 +33,7 @@ from pydrake.systems.framework import (
     State,
     TriggerType,
     UnrestrictedUpdateEvent,
-    VectorSystem,
+    VectorSystem, VectorSystem_,
     WitnessFunctionDirection,
     kUseDefaultName,
     )
@@ -80,11 +82,12 @@ class CustomAdder(LeafSystem):
 
 
 class CustomVectorSystem(VectorSystem):
-    def __init__(self, is_discrete):
+    def __init__(self, is_discrete, use_preallocated_arrays=False):
         # VectorSystem only supports pure Continuous or pure Discrete.
         # Dimensions:
         #   1 Input, 2 States, 3 Outputs.
-        VectorSystem.__init__(self, 1, 3)
+        VectorSystem.__init__(
+            self, 1, 3, use_preallocated_arrays=use_preallocated_arrays)
         self._is_discrete = is_discrete
         if self._is_discrete:
             self.DeclareDiscreteState(2)
@@ -96,6 +99,7 @@ class CustomVectorSystem(VectorSystem):
     def DoCalcVectorOutput(self, context, u, x, y):
         y[:] = np.hstack([u, x])
         self.has_called.append("output")
+        self.output_arrays = (u, x, y)
 
     def DoCalcVectorTimeDerivatives(self, context, u, x, x_dot):
         x_dot[:] = x + u
@@ -430,8 +434,9 @@ class TestCustom(unittest.TestCase):
 
     def test_vector_system_overrides(self):
         dt = 0.5
-        for is_discrete in [False, True]:
-            system = CustomVectorSystem(is_discrete)
+        for is_discrete, use_preallocated_arrays in itertools.product(
+                [False, True], [False, True]):
+            system = CustomVectorSystem(is_discrete, use_preallocated_arrays)
             context = system.CreateDefaultContext()
 
             u = np.array([1.])
@@ -463,6 +468,17 @@ class TestCustom(unittest.TestCase):
             y = output.get_vector_data(0).get_value()
             self.assertTrue(np.allclose(y, y_expected))
 
+            # With preallocated arrays, the same arrays are passed again.
+            arrays = system.output_arrays
+            system.CalcOutput(context, output)
+            for a, b in zip(arrays, system.output_arrays):
+                self.assertEqual(a is b, use_preallocated_arrays)
+            self.assertTrue(np.allclose(
+                output.get_vector_data(0).get_value(), y_expected))
+
+        with self.assertRaises(RuntimeError):
+            VectorSystem_[AutoDiffXd](1, 1, use_preallocated_arrays=True)
+
     def test_context_api(self):
         # Capture miscellaneous functions not yet tested.
         model_value = AbstractValue.Make("Hello")
@@ -579,6 +595,40 @@ class TestCustom(unittest.TestCase):
                 self.assertEqual(system.AllocateTimeDerivatives().size(), 6)
                 self.assertEqual(system.EvalTimeDerivatives(context).size(), 6)
 
+    def test_simulations_in_threads(self):
+        # Simulator.AdvanceTo releases the GIL, so several simulations of
+        # Python systems can run in Python threads at once.
+        class Decay(LeafSystem):
+            def __init__(self, rate):
+                LeafSystem.__init__(self)
+                self.rate = rate
+                self.DeclareContinuousState(1)
+
+            def DoCalcTimeDerivatives(self, context, derivatives):
+                x = context.get_continuous_state_vector().GetAtIndex(0)
+                derivatives.get_mutable_vector().SetAtIndex(
+                    0, -self.rate * x)
+
+        rates = [0.5, 1., 2., 4.]
+        results = [None] * len(rates)
+
+        def simulate(i):
+            simulator = Simulator(Decay(rates[i]))
+            simulator.get_mutable_context().SetContinuousState([1.])
+            simulator.AdvanceTo(1.)
+            results[i] = simulator.get_context().get_continuous_state_vector(
+                ).GetAtIndex(0)
+
+        threads = [
+            threading.Thread(target=simulate, args=(i,))
+            for i in range(len(rates))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for rate, result in zip(rates, results):
+            self.assertAlmostEqual(result, np.exp(-rate), places=3)
+
     def test_discrete_state_api(self):
         # N.B. Since this has trivial operations, we can test all scalar types.
         for T in [float, AutoDiffXd, Expression]:
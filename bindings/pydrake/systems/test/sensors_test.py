@@ -144,6 +144,17 @@ class TestSensors(unittest.TestCase):
             self.assertTrue(np.allclose(image.data, 3))
             self.assertTrue(np.allclose(image.mutable_data, 3))
 
+            # The buffer protocol gives a writable view, without a copy, which
+            # keeps the image alive.
+            view = np.asarray(image)
+            self.assertEqual(view.shape, image.shape)
+            self.assertEqual(view.dtype, ImageT.Traits.ChannelType)
+            view[0, 0, 0] = 4
+            self.assertEqual(image.at(0, 0)[0], 4)
+            view_only = np.asarray(ImageT(w, h, channel_default))
+            self.assertTrue(np.allclose(view_only, channel_default))
+            image.mutable_data[:] = 3
+
             # Ensure that each dimension of the image array is unique.
             self.assertEqual(len(set(image.shape)), 3)
             # Ensure indices match as expected. Fill each channel at each pixel
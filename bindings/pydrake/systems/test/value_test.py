@@ -77,6 +77,19 @@ class TestValue(unittest.TestCase):
                     self.assertTrue(value_copy is not value_data)
                     self.assertEqual(value_data.size(), n)
 
+    def test_basic_vector_array_view(self):
+        value_data = BasicVector(np.arange(3.))
+        # `np.asarray` gives a writable view, without a copy.
+        view = np.asarray(value_data)
+        view[1] = 10.
+        self.assertEqual(value_data.GetAtIndex(1), 10.)
+        # A conversion to another dtype is a copy.
+        self.assertEqual(np.asarray(value_data, dtype=int).tolist(),
+                         [0, 10, 2])
+        # The view keeps the vector alive.
+        view = np.asarray(BasicVector([1., 2.]))
+        self.assertTrue(np.allclose(view, [1., 2.]))
+
     def test_basic_vector_set_get(self):
         value = BasicVector(np.arange(3., 5.))
         self.assertEqual(value.GetAtIndex(1), 4.)
@@ -0,0 +1,74 @@
+"""Compares the per-step cost of simulating a discrete-time linear system
+implemented in C++ (LinearSystem) with the same system implemented as a
+Python VectorSystem, with and without preallocated arrays.
+"""
+
+import argparse
+import time
+
+import numpy as np
+
+from pydrake.systems.analysis import Simulator
+from pydrake.systems.framework import VectorSystem
+from pydrake.systems.primitives import LinearSystem
+
+_A = np.array([[1., 0.01], [-0.01, 1.]])
+_C = np.eye(2)
+_PERIOD = 1e-3
+
+
+class PythonLinearSystem(VectorSystem):
+    """x[n+1] = A x[n], y = x."""
+
+    def __init__(self, use_preallocated_arrays):
+        VectorSystem.__init__(
+            self, 0, 2, use_preallocated_arrays=use_preallocated_arrays)
+        self.DeclareDiscreteState(2)
+        self.DeclarePeriodicDiscreteUpdate(_PERIOD)
+
+    def DoCalcVectorOutput(self, context, u, x, y):
+        y[:] = x
+
+    def DoCalcVectorDiscreteVariableUpdates(self, context, u, x, x_next):
+        x_next[:] = _A.dot(x)
+
+
+def _time_per_step(system, num_steps):
+    simulator = Simulator(system)
+    context = simulator.get_mutable_context()
+    context.get_mutable_discrete_state_vector().SetFromVector([1., 0.])
+    simulator.Initialize()
+    start = time.time()
+    simulator.AdvanceTo(num_steps * _PERIOD)
+    elapsed = time.time() - start
+    x = context.get_discrete_state_vector().CopyToVector()
+    return elapsed / num_steps, x
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--num_steps", type=int, default=20000,
+        help="Number of discrete steps to simulate.")
+    args = parser.parse_args()
+
+    systems = [
+        ("C++ LinearSystem", LinearSystem(
+            A=_A, B=np.zeros((2, 0)), C=_C, D=np.zeros((2, 0)),
+            time_period=_PERIOD)),
+        ("Python VectorSystem", PythonLinearSystem(False)),
+        ("Python VectorSystem, preallocated arrays",
+         PythonLinearSystem(True)),
+    ]
+    results = []
+    for name, system in systems:
+        seconds, x = _time_per_step(system, args.num_steps)
+        results.append(x)
+        print("{:45s} {:8.2f} us/step".format(name, 1e6 * seconds))
+    # All of the implementations compute the same trajectory.
+    for x in results[1:]:
+        assert np.allclose(x, results[0]), (x, results[0])
+
+
+if __name__ == "__main__":
+    main()
@@ -27,6 +27,15 @@ using AutoDiffXd = Eigen::AutoDiffScalar<Eigen::VectorXd>;
 template <int num_vars>
 using AutoDiffd = Eigen::AutoDiffScalar<Eigen::Matrix<double, num_vars, 1> >;
 
+/// An autodiff variable with a dynamic number of partials, up to
+/// `max_num_vars`. Unlike that of AutoDiffXd, the storage of the partials is
+/// inline (rather than on the heap), so that arithmetic with this type never
+/// allocates. This is the scalar to use for gradients with respect to a number
+/// of variables that is small but only known at runtime.
+template <int max_num_vars>
+using AutoDiffUpTod = Eigen::AutoDiffScalar<
+    Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_num_vars, 1>>;
+
 /// A vector of `rows` autodiff variables, each with `num_vars` partials.
 template <int num_vars, int rows>
 using AutoDiffVecd = Eigen::Matrix<AutoDiffd<num_vars>, rows, 1>;
@@ -0,0 +1,24 @@
+#include "drake/common/file_cache.h"
+
+#include <sys/stat.h>
+
+namespace drake {
+namespace internal {
+
+optional<FileStamp> GetFileStamp(const std::string& path) {
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) {
+    return nullopt;
+  }
+#ifdef __APPLE__
+  const struct timespec& mtime = info.st_mtimespec;
+#else
+  const struct timespec& mtime = info.st_mtim;
+#endif
+  return FileStamp{static_cast<std::int64_t>(info.st_size),
+                   static_cast<std::int64_t>(mtime.tv_sec) * 1000000000 +
+                       mtime.tv_nsec};
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "drake/common/drake_optional.h"
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace internal {
+
+/// Identifies the contents of a file on disk, by its size and modification
+/// time.
+struct FileStamp {
+  std::int64_t size{};
+  std::int64_t modification_time_ns{};
+
+  bool operator==(const FileStamp& other) const {
+    return size == other.size &&
+        modification_time_ns == other.modification_time_ns;
+  }
+};
+
+/// Returns the stamp of the file at `path`, or nullopt if the file can't be
+/// accessed.
+optional<FileStamp> GetFileStamp(const std::string& path);
+
+/// A process-wide, thread-safe cache of values loaded from files (e.g., parsed
+/// models or meshes), with one cache per `Value` type. The values are keyed on
+/// a string which starts with the path of the file they are loaded from, and
+/// are shared by reference among the users of the cache. An entry is reused as
+/// long as the size and the modification time of its file are unchanged;
+/// otherwise the file is loaded again.
+///
+/// Only the file itself is checked, so a value loaded from several files (e.g.,
+/// a model which includes other models) is not reloaded when only the other
+/// files change. Call Clear() to force reloading.
+///
+/// @tparam Value The type of the cached values. Since they are shared, they
+///   should be const or otherwise guarded against concurrent modification.
+template <typename Value>
+class FileCache {
+ public:
+  /// Returns the value for `key`, loaded from the file at `path` by `load`.
+  /// The cached value is returned if the file hasn't changed since it was
+  /// loaded. Otherwise, `load` is called (without holding the lock of the
+  /// cache, so that different files can be loaded concurrently) and its result
+  /// is cached, unless it is null or the file can't be accessed. Exceptions
+  /// thrown by `load` are propagated, and nothing is cached.
+  static std::shared_ptr<Value> GetOrLoad(
+      const std::string& path, const std::string& key,
+      const std::function<std::shared_ptr<Value>()>& load) {
+    const optional<FileStamp> stamp = GetFileStamp(path);
+    if (!stamp) {
+      return load();
+    }
+    Storage& storage = GetStorage();
+    {
+      std::lock_guard<std::mutex> lock(storage.mutex);
+      const auto iter = storage.entries.find(key);
+      if (iter != storage.entries.end() && iter->second.stamp == *stamp) {
+        return iter->second.value;
+      }
+    }
+    std::shared_ptr<Value> value = load();
+    if (value != nullptr) {
+      std::lock_guard<std::mutex> lock(storage.mutex);
+      storage.entries[key] = Entry{*stamp, value};
+    }
+    return value;
+  }
+
+  /// Same as GetOrLoad(path, path, load).
+  static std::shared_ptr<Value> GetOrLoad(
+      const std::string& path,
+      const std::function<std::shared_ptr<Value>()>& load) {
+    return GetOrLoad(path, path, load);
+  }
+
+  /// Removes all the entries. The values still in use are not affected.
+  static void Clear() {
+    Storage& storage = GetStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    storage.entries.clear();
+  }
+
+ private:
+  struct Entry {
+    FileStamp stamp;
+    std::shared_ptr<Value> value;
+  };
+
+  struct Storage {
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+  };
+
+  static Storage& GetStorage() {
+    static never_destroyed<Storage> storage;
+    return storage.access();
+  }
+};
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,61 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+
+void StaticParallelForIndexLoop(
+    int num_threads, int loop_begin, int loop_end,
+    const std::function<void(int thread_num, int index)>& loop_body) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const int num_indices = std::max(loop_end - loop_begin, 0);
+  const int num_blocks = std::min(num_threads, num_indices);
+  if (num_blocks <= 1) {
+    for (int i = loop_begin; i < loop_end; ++i) {
+      loop_body(0, i);
+    }
+    return;
+  }
+
+  // Block b covers [block_begin(b), block_begin(b + 1)). The first
+  // `num_indices % num_blocks` blocks get one extra index.
+  const int base_size = num_indices / num_blocks;
+  const int remainder = num_indices % num_blocks;
+  auto block_begin = [&](int b) {
+    return loop_begin + b * base_size + std::min(b, remainder);
+  };
+
+  std::vector<std::exception_ptr> errors(num_blocks);
+  auto run_block = [&](int b) {
+    try {
+      for (int i = block_begin(b); i < block_begin(b + 1); ++i) {
+        loop_body(b, i);
+      }
+    } catch (...) {
+      errors[b] = std::current_exception();
+    }
+  };
+
+  // The calling thread processes the first block itself.
+  std::vector<std::thread> threads;
+  threads.reserve(num_blocks - 1);
+  for (int b = 1; b < num_blocks; ++b) {
+    threads.emplace_back(run_block, b);
+  }
+  run_block(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace drake
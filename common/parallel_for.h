@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+
+namespace drake {
+
+/// Evaluates `loop_body(thread_num, index)` for every `index` in the range
+/// [`loop_begin`, `loop_end`), using at most `num_threads` threads.
+///
+/// The range is statically partitioned into (at most) `num_threads`
+/// contiguous blocks of nearly equal size, and block `thread_num` is processed
+/// in increasing index order by a single thread. This makes it easy to produce
+/// results that do not depend on the number of threads used: if each thread
+/// appends its results to its own buffer (indexed by `thread_num`), then
+/// concatenating the buffers in order of `thread_num` yields exactly the same
+/// sequence as the serial loop.
+///
+/// When `num_threads` is one (or the range has at most one element) the loop
+/// is evaluated on the calling thread, without spawning any threads.
+///
+/// @param num_threads The maximum number of threads to use. `thread_num` is
+///   always in [0, `num_threads`).
+/// @param loop_begin The first index of the loop.
+/// @param loop_end One past the last index of the loop.
+/// @param loop_body The function evaluated for each index. It must be safe to
+///   call concurrently from multiple threads for different indices.
+///
+/// @throws std::exception if `num_threads` is less than one. If `loop_body`
+///   throws, the remaining indices of that block are skipped and, once all
+///   threads are joined, the exception thrown by the lowest numbered block is
+///   rethrown on the calling thread.
+void StaticParallelForIndexLoop(
+    int num_threads, int loop_begin, int loop_end,
+    const std::function<void(int thread_num, int index)>& loop_body);
+
+}  // namespace drake
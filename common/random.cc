@@ -1,9 +1,102 @@
 #include "drake/common/random.h"
 
+#include <cmath>
+
 namespace drake {
 
 #if  __cplusplus < 201703L
 constexpr RandomGenerator::result_type RandomGenerator::default_seed;
 #endif
 
+namespace {
+
+// The constants of Philox4x32: the multipliers of the rounds, and the
+// increments of the key (the golden ratio and √3 - 1).
+constexpr std::uint32_t kPhiloxM0 = 0xD2511F53;
+constexpr std::uint32_t kPhiloxM1 = 0xCD9E8D57;
+constexpr std::uint32_t kPhiloxW0 = 0x9E3779B9;
+constexpr std::uint32_t kPhiloxW1 = 0xBB67AE85;
+constexpr int kPhiloxRounds = 10;
+
+// Returns a uniformly distributed value ∈ [0.0, 1.0) from the 53 high bits of
+// `hi` and `lo`.
+double ToUniform(std::uint32_t hi, std::uint32_t lo) {
+  const std::uint64_t bits = (static_cast<std::uint64_t>(hi) << 32) | lo;
+  return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+}  // namespace
+
+CounterBasedRandomGenerator::Block CounterBasedRandomGenerator::GenerateBlock(
+    std::uint64_t block_counter) const {
+  Block x{static_cast<result_type>(block_counter),
+          static_cast<result_type>(block_counter >> 32),
+          static_cast<result_type>(stream_),
+          static_cast<result_type>(stream_ >> 32)};
+  std::array<result_type, 2> key = key_;
+  for (int round = 0; round < kPhiloxRounds; ++round) {
+    const std::uint64_t product0 = static_cast<std::uint64_t>(kPhiloxM0) * x[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(kPhiloxM1) * x[2];
+    x = {static_cast<result_type>(product1 >> 32) ^ x[1] ^ key[0],
+         static_cast<result_type>(product1),
+         static_cast<result_type>(product0 >> 32) ^ x[3] ^ key[1],
+         static_cast<result_type>(product0)};
+    key[0] += kPhiloxW0;
+    key[1] += kPhiloxW1;
+  }
+  return x;
+}
+
+void CounterBasedRandomGenerator::discard(std::uint64_t n) {
+  const std::uint64_t remaining = kBlockSize - index_;
+  if (n <= remaining) {
+    index_ += static_cast<int>(n);
+    return;
+  }
+  // Skips the rest of the current block, then whole blocks.
+  n -= remaining;
+  block_counter_ += (n - 1) / kBlockSize;
+  block_ = GenerateBlock(block_counter_++);
+  index_ = static_cast<int>((n - 1) % kBlockSize) + 1;
+}
+
+std::array<double, 2> CounterBasedRandomGenerator::NextUniformPair() {
+  index_ = kBlockSize;
+  const Block block = GenerateBlock(block_counter_++);
+  return {ToUniform(block[0], block[1]), ToUniform(block[2], block[3])};
+}
+
+void CounterBasedRandomGenerator::FillUniform(
+    Eigen::Ref<Eigen::VectorXd> samples) {
+  const int size = samples.size();
+  for (int i = 0; i < size; i += 2) {
+    const std::array<double, 2> u = NextUniformPair();
+    samples[i] = u[0];
+    if (i + 1 < size) samples[i + 1] = u[1];
+  }
+}
+
+void CounterBasedRandomGenerator::FillGaussian(
+    Eigen::Ref<Eigen::VectorXd> samples) {
+  const int size = samples.size();
+  for (int i = 0; i < size; i += 2) {
+    const std::array<double, 2> u = NextUniformPair();
+    // 1 - u[0] ∈ (0.0, 1.0], so that its logarithm is finite.
+    const double radius = std::sqrt(-2.0 * std::log(1.0 - u[0]));
+    const double angle = 2.0 * M_PI * u[1];
+    samples[i] = radius * std::cos(angle);
+    if (i + 1 < size) samples[i + 1] = radius * std::sin(angle);
+  }
+}
+
+void CounterBasedRandomGenerator::FillExponential(
+    Eigen::Ref<Eigen::VectorXd> samples) {
+  const int size = samples.size();
+  for (int i = 0; i < size; i += 2) {
+    const std::array<double, 2> u = NextUniformPair();
+    samples[i] = -std::log(1.0 - u[0]);
+    if (i + 1 < size) samples[i + 1] = -std::log(1.0 - u[1]);
+  }
+}
+
 }  // namespace drake
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <random>
 
+#include <Eigen/Core>
+
 #include "drake/common/drake_copyable.h"
 
 namespace drake {
@@ -29,6 +33,82 @@ class RandomGenerator {
   std::mt19937 generator_{};
 };
 
+/// A counter-based implementation of the UniformRandomBitGenerator C++
+/// concept, Philox4x32-10 by Salmon, Moraes, Dror and Shaw, 2011 ("Parallel
+/// random numbers: as easy as 1, 2, 3"), with vectorized sampling of a few
+/// distributions into preallocated vectors.
+///
+/// The n-th block of four 32-bit outputs is a bijective function of the
+/// counter (n, stream) keyed by the seed, so that the generator has no state
+/// beyond its counter: discard() jumps ahead in constant time, and the
+/// generators of the same seed and different streams are independent, which
+/// makes it cheap to derive reproducible streams for parallel computations
+/// (e.g., one per thread or per Monte Carlo sample).
+///
+/// The Fill methods consume whole blocks, starting with the next one (any
+/// unused outputs of the current block are discarded), and write each sample
+/// from 53 random bits.
+class CounterBasedRandomGenerator {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CounterBasedRandomGenerator)
+
+  using result_type = std::uint32_t;
+
+  CounterBasedRandomGenerator() = default;
+  explicit CounterBasedRandomGenerator(std::uint64_t seed,
+                                       std::uint64_t stream = 0)
+      : key_{static_cast<result_type>(seed),
+             static_cast<result_type>(seed >> 32)},
+        stream_(stream) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 0xffffffff; }
+
+  result_type operator()() {
+    if (index_ == kBlockSize) {
+      block_ = GenerateBlock(block_counter_++);
+      index_ = 0;
+    }
+    return block_[index_++];
+  }
+
+  /// Advances the generator by @p n outputs, in constant time.
+  void discard(std::uint64_t n);
+
+  /// Returns the number of the stream given at construction.
+  std::uint64_t stream() const { return stream_; }
+
+  /// Fills @p samples with values uniformly distributed ∈ [0.0, 1.0).
+  void FillUniform(Eigen::Ref<Eigen::VectorXd> samples);
+
+  /// Fills @p samples with values drawn from a mean-zero, unit-variance normal
+  /// distribution (with the Box-Muller transform).
+  void FillGaussian(Eigen::Ref<Eigen::VectorXd> samples);
+
+  /// Fills @p samples with values drawn from an exponential distribution with
+  /// λ=1.0.
+  void FillExponential(Eigen::Ref<Eigen::VectorXd> samples);
+
+ private:
+  static constexpr int kBlockSize = 4;
+  using Block = std::array<result_type, kBlockSize>;
+
+  // Returns the outputs of the given block.
+  Block GenerateBlock(std::uint64_t block_counter) const;
+
+  // Returns two values uniformly distributed ∈ [0.0, 1.0), from the next
+  // block.
+  std::array<double, 2> NextUniformPair();
+
+  std::array<result_type, 2> key_{};
+  std::uint64_t stream_{};
+  // The number of the next block to generate.
+  std::uint64_t block_counter_{};
+  // The current block, and the index of its next output.
+  Block block_{};
+  int index_{kBlockSize};
+};
+
 /// Drake supports explicit reasoning about a few carefully chosen random
 /// distributions.
 enum class RandomDistribution {
@@ -32,6 +32,7 @@
 #include "drake/common/symbolic_variable.h"
 #include "drake/common/symbolic_variables.h"
 #include "drake/common/symbolic_environment.h"
+#include "drake/common/symbolic_arena.h"
 #include "drake/common/symbolic_expression.h"
 #include "drake/common/symbolic_expression_visitor.h"
 #include "drake/common/symbolic_ldlt.h"
@@ -43,5 +44,6 @@
 #include "drake/common/symbolic_formula_visitor.h"
 #include "drake/common/symbolic_simplification.h"
 #include "drake/common/symbolic_codegen.h"
+#include "drake/common/symbolic_evaluator.h"
 // clang-format on
 #undef DRAKE_COMMON_SYMBOLIC_HEADER
@@ -0,0 +1,283 @@
+// NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/symbolic.h"
+#define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+#include "drake/common/symbolic_expression_cell.h"
+#undef DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+
+namespace drake {
+namespace symbolic {
+namespace internal {
+namespace {
+
+// The size of the blocks of memory of an arena. Larger cells are allocated
+// in their own block.
+constexpr std::size_t kBlockSize = 64 * 1024;
+
+// The innermost arena of this thread.
+thread_local std::shared_ptr<CellArena>* active_cell_arena{nullptr};
+
+void HashCombine(std::size_t* seed, std::size_t value) {
+  *seed ^= value + 0x9e3779b97f4a7c15 + (*seed << 6) + (*seed >> 2);
+}
+
+std::size_t HashDouble(double value) {
+  uint64_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+  return std::hash<uint64_t>{}(bits);
+}
+
+bool IdenticalDoubles(double a, double b) {
+  // Unlike ==, this distinguishes -0.0 from 0.0.
+  return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+bool IsUnary(ExpressionKind kind) {
+  switch (kind) {
+    case ExpressionKind::Log:
+    case ExpressionKind::Abs:
+    case ExpressionKind::Exp:
+    case ExpressionKind::Sqrt:
+    case ExpressionKind::Sin:
+    case ExpressionKind::Cos:
+    case ExpressionKind::Tan:
+    case ExpressionKind::Asin:
+    case ExpressionKind::Acos:
+    case ExpressionKind::Atan:
+    case ExpressionKind::Sinh:
+    case ExpressionKind::Cosh:
+    case ExpressionKind::Tanh:
+    case ExpressionKind::Ceil:
+    case ExpressionKind::Floor:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsBinary(ExpressionKind kind) {
+  switch (kind) {
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns true if the cells of the given kind can be shared. (The cells of
+// if-then-else expressions and uninterpreted functions are not, since their
+// formulas and names would have to be compared in full.)
+bool IsShareable(ExpressionKind kind) {
+  return kind == ExpressionKind::Constant || kind == ExpressionKind::Var ||
+         kind == ExpressionKind::NaN || kind == ExpressionKind::Add ||
+         kind == ExpressionKind::Mul || IsUnary(kind) || IsBinary(kind);
+}
+
+}  // namespace
+
+std::shared_ptr<CellArena>* GetActiveCellArena() { return active_cell_arena; }
+
+ScopedCellArenaSuspension::ScopedCellArenaSuspension()
+    : suspended_(active_cell_arena) {
+  active_cell_arena = nullptr;
+}
+
+ScopedCellArenaSuspension::~ScopedCellArenaSuspension() {
+  active_cell_arena = suspended_;
+}
+
+void* AllocateFromCellArena(CellArena* arena, std::size_t size,
+                            std::size_t alignment) {
+  DRAKE_DEMAND(arena != nullptr);
+  return arena->Allocate(size, alignment);
+}
+
+CellArena::CellArena(bool share_subexpressions)
+    : share_subexpressions_(share_subexpressions) {}
+
+void* CellArena::Allocate(std::size_t size, std::size_t alignment) {
+  DRAKE_DEMAND(alignment <= alignof(std::max_align_t));
+  num_allocated_bytes_ += size;
+  if (size > kBlockSize / 4) {
+    blocks_.emplace_back(new char[size]);
+    return blocks_.back().get();
+  }
+  std::size_t padding =
+      (alignment - reinterpret_cast<uintptr_t>(next_) % alignment) % alignment;
+  if (next_ == nullptr || padding + size > remaining_) {
+    // The new block is maximally aligned.
+    blocks_.emplace_back(new char[kBlockSize]);
+    next_ = blocks_.back().get();
+    remaining_ = kBlockSize;
+    padding = 0;
+  }
+  char* const result = next_ + padding;
+  next_ = result + size;
+  remaining_ -= padding + size;
+  return result;
+}
+
+std::size_t CellArena::ShallowHash(const ExpressionCell& c) {
+  const ExpressionKind kind = c.get_kind();
+  std::size_t seed = std::hash<int>{}(static_cast<int>(kind));
+  auto combine_cell = [&seed](const Expression& e) {
+    HashCombine(&seed, std::hash<const ExpressionCell*>{}(cell(e)));
+  };
+  if (kind == ExpressionKind::Constant) {
+    HashCombine(&seed, HashDouble(
+        static_cast<const ExpressionConstant&>(c).get_value()));
+  } else if (kind == ExpressionKind::Var) {
+    HashCombine(&seed, std::hash<Variable::Id>{}(
+        static_cast<const ExpressionVar&>(c).get_variable().get_id()));
+  } else if (kind == ExpressionKind::Add) {
+    const auto& add = static_cast<const ExpressionAdd&>(c);
+    HashCombine(&seed, HashDouble(add.get_constant()));
+    for (const auto& term : add.get_expr_to_coeff_map()) {
+      combine_cell(term.first);
+      HashCombine(&seed, HashDouble(term.second));
+    }
+  } else if (kind == ExpressionKind::Mul) {
+    const auto& mul = static_cast<const ExpressionMul&>(c);
+    HashCombine(&seed, HashDouble(mul.get_constant()));
+    for (const auto& term : mul.get_base_to_exponent_map()) {
+      combine_cell(term.first);
+      combine_cell(term.second);
+    }
+  } else if (IsUnary(kind)) {
+    combine_cell(static_cast<const UnaryExpressionCell&>(c).get_argument());
+  } else if (IsBinary(kind)) {
+    const auto& binary = static_cast<const BinaryExpressionCell&>(c);
+    combine_cell(binary.get_first_argument());
+    combine_cell(binary.get_second_argument());
+  }
+  return seed;
+}
+
+bool CellArena::ShallowEqual(const ExpressionCell& a,
+                             const ExpressionCell& b) {
+  const ExpressionKind kind = a.get_kind();
+  if (kind != b.get_kind()) {
+    return false;
+  }
+  if (kind == ExpressionKind::Constant) {
+    return IdenticalDoubles(
+        static_cast<const ExpressionConstant&>(a).get_value(),
+        static_cast<const ExpressionConstant&>(b).get_value());
+  } else if (kind == ExpressionKind::Var) {
+    return static_cast<const ExpressionVar&>(a).get_variable().get_id() ==
+           static_cast<const ExpressionVar&>(b).get_variable().get_id();
+  } else if (kind == ExpressionKind::Add) {
+    const auto& add_a = static_cast<const ExpressionAdd&>(a);
+    const auto& add_b = static_cast<const ExpressionAdd&>(b);
+    const auto& terms_a = add_a.get_expr_to_coeff_map();
+    const auto& terms_b = add_b.get_expr_to_coeff_map();
+    return IdenticalDoubles(add_a.get_constant(), add_b.get_constant()) &&
+           terms_a.size() == terms_b.size() &&
+           std::equal(terms_a.begin(), terms_a.end(), terms_b.begin(),
+                      [](const auto& x, const auto& y) {
+                        return cell(x.first) == cell(y.first) &&
+                               IdenticalDoubles(x.second, y.second);
+                      });
+  } else if (kind == ExpressionKind::Mul) {
+    const auto& mul_a = static_cast<const ExpressionMul&>(a);
+    const auto& mul_b = static_cast<const ExpressionMul&>(b);
+    const auto& terms_a = mul_a.get_base_to_exponent_map();
+    const auto& terms_b = mul_b.get_base_to_exponent_map();
+    return IdenticalDoubles(mul_a.get_constant(), mul_b.get_constant()) &&
+           terms_a.size() == terms_b.size() &&
+           std::equal(terms_a.begin(), terms_a.end(), terms_b.begin(),
+                      [](const auto& x, const auto& y) {
+                        return cell(x.first) == cell(y.first) &&
+                               cell(x.second) == cell(y.second);
+                      });
+  } else if (IsUnary(kind)) {
+    return cell(static_cast<const UnaryExpressionCell&>(a).get_argument()) ==
+           cell(static_cast<const UnaryExpressionCell&>(b).get_argument());
+  } else if (IsBinary(kind)) {
+    const auto& binary_a = static_cast<const BinaryExpressionCell&>(a);
+    const auto& binary_b = static_cast<const BinaryExpressionCell&>(b);
+    return cell(binary_a.get_first_argument()) ==
+               cell(binary_b.get_first_argument()) &&
+           cell(binary_a.get_second_argument()) ==
+               cell(binary_b.get_second_argument());
+  }
+  // NaN.
+  return true;
+}
+
+std::shared_ptr<ExpressionCell> CellArena::Intern(
+    std::shared_ptr<ExpressionCell> c) {
+  if (!share_subexpressions_ || !IsShareable(c->get_kind())) {
+    return c;
+  }
+  const std::size_t hash = ShallowHash(*c);
+  const auto range = cells_.equal_range(hash);
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    if (ShallowEqual(*iter->second, *c)) {
+      ++num_shared_subexpressions_;
+      // Once expanded, always expanded.
+      if (c->is_expanded()) {
+        iter->second->set_expanded();
+      }
+      return iter->second;
+    }
+  }
+  cells_.emplace(hash, c);
+  return c;
+}
+
+const Expression* CellArena::FindExpansion(const Expression& e) {
+  const auto iter = expansions_.find(cell(e));
+  if (iter == expansions_.end()) {
+    return nullptr;
+  }
+  ++num_shared_subexpressions_;
+  return &iter->second.second;
+}
+
+void CellArena::AddExpansion(const Expression& e, const Expression& expansion) {
+  if (share_subexpressions_) {
+    expansions_.emplace(cell(e), std::make_pair(e, expansion));
+  }
+}
+
+void CellArena::Clear() {
+  cells_.clear();
+  expansions_.clear();
+}
+
+}  // namespace internal
+
+ScopedExpressionArena::ScopedExpressionArena(bool share_subexpressions)
+    : arena_(std::make_shared<internal::CellArena>(share_subexpressions)),
+      previous_(internal::active_cell_arena) {
+  internal::active_cell_arena = &arena_;
+}
+
+ScopedExpressionArena::~ScopedExpressionArena() {
+  DRAKE_DEMAND(internal::active_cell_arena == &arena_);
+  internal::active_cell_arena = previous_;
+  arena_->Clear();
+}
+
+int64_t ScopedExpressionArena::num_allocated_bytes() const {
+  return arena_->num_allocated_bytes();
+}
+
+int64_t ScopedExpressionArena::num_shared_subexpressions() const {
+  return arena_->num_shared_subexpressions();
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,152 @@
+#pragma once
+
+#ifndef DRAKE_COMMON_SYMBOLIC_HEADER
+// TODO(soonho-tri): Change to #error, when #6613 merged.
+#warning Do not directly include this file. Include "drake/common/symbolic.h".
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace symbolic {
+
+namespace internal {
+class CellArena;  // In symbolic_expression_cell.h
+}  // namespace internal
+
+/** Changes how the symbolic expressions and formulas that are created on this
+ * thread are stored, for the lifetime of this object. It is meant to be put
+ * around the code that builds a large program (e.g., a sums-of-squares program
+ * with polynomials of many terms):
+ *
+ * \code{.cpp}
+ *   {
+ *     ScopedExpressionArena arena;
+ *     // Build the constraints of the program.
+ *   }
+ *   // Solve the program.
+ * \endcode
+ *
+ * While it is alive:
+ *
+ * - The cells (i.e., the nodes) of the new expressions and formulas are
+ *   allocated from an arena, by bumping a pointer, instead of one by one from
+ *   the heap. The memory of the arena is released all at once, when the
+ *   last of its cells is destroyed; in particular, the memory of the
+ *   intermediate expressions is not reused until then. The expressions and
+ *   formulas remain valid after the arena scope ends, and can be used and
+ *   destroyed on any thread.
+ * - If @p share_subexpressions is true, new expressions that are structurally
+ *   identical to an expression that was created in the scope share its cell
+ *   (hash-consing), which saves memory and makes comparing them cheap, and
+ *   the results of Expression::Expand() are reused for such shared
+ *   subexpressions. Note that the cells and expansions recorded for sharing
+ *   are kept alive until the arena scope ends.
+ *
+ * Arena scopes can be nested, in which case the innermost one is used.
+ */
+class ScopedExpressionArena {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedExpressionArena)
+
+  explicit ScopedExpressionArena(bool share_subexpressions = true);
+
+  ~ScopedExpressionArena();
+
+  /** Returns the number of bytes allocated by the cells of the arena. */
+  int64_t num_allocated_bytes() const;
+
+  /** Returns the number of times that a new expression shared the cell of an
+   * existing one, or that an expansion was reused. It is always zero when
+   * sharing is disabled. */
+  int64_t num_shared_subexpressions() const;
+
+ private:
+  std::shared_ptr<internal::CellArena> arena_;
+  std::shared_ptr<internal::CellArena>* previous_{};
+};
+
+namespace internal {
+
+/* Returns the arena of the innermost ScopedExpressionArena of this thread, or
+ nullptr if there is none. */
+std::shared_ptr<CellArena>* GetActiveCellArena();
+
+/* Suspends the active arena of this thread (if any) during its lifetime, for
+ the expressions that are meant to outlive every arena. */
+class ScopedCellArenaSuspension {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedCellArenaSuspension)
+  ScopedCellArenaSuspension();
+  ~ScopedCellArenaSuspension();
+
+ private:
+  std::shared_ptr<CellArena>* suspended_{};
+};
+
+/* Allocates @p size bytes with the given @p alignment in @p arena. */
+void* AllocateFromCellArena(CellArena* arena, std::size_t size,
+                            std::size_t alignment);
+
+/* An allocator for std::allocate_shared(), which keeps the arena alive until
+ the deallocation of the storage (which is a no-op). */
+template <typename T>
+class CellArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit CellArenaAllocator(std::shared_ptr<CellArena> arena)
+      : arena_(std::move(arena)) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(runtime/explicit): Allocators require this conversion.
+  CellArenaAllocator(const CellArenaAllocator<U>& other)
+      : arena_(other.arena()) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(
+        AllocateFromCellArena(arena_.get(), n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, std::size_t) {}
+
+  const std::shared_ptr<CellArena>& arena() const { return arena_; }
+
+ private:
+  std::shared_ptr<CellArena> arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const CellArenaAllocator<T>& a,
+                const CellArenaAllocator<U>& b) {
+  return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const CellArenaAllocator<T>& a,
+                const CellArenaAllocator<U>& b) {
+  return !(a == b);
+}
+
+/* Makes a new expression or formula cell, in the active arena if there is
+ one (see ScopedExpressionArena). */
+template <typename Cell, typename... Args>
+std::shared_ptr<Cell> MakeCell(Args&&... args) {
+  using Allocated = std::remove_const_t<Cell>;
+  const std::shared_ptr<CellArena>* const arena = GetActiveCellArena();
+  if (arena == nullptr) {
+    return std::make_shared<Allocated>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<Allocated>(CellArenaAllocator<Allocated>(*arena),
+                                         std::forward<Args>(args)...);
+}
+
+}  // namespace internal
+}  // namespace symbolic
+}  // namespace drake
@@ -2,6 +2,9 @@
 
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace drake {
 namespace symbolic {
@@ -15,29 +18,66 @@ void ThrowError(const string& type, const string& expression) {
                       type + " expression: " + expression + ".");
 }
 
+// Maps the ID of each variable in `vars` to its (first) index in `vars`. The
+// indices of the repeated variables are appended to `duplicates` as pairs
+// (index, first index).
+std::unordered_map<Variable::Id, int> MapVariablesToIndices(
+    const Eigen::Ref<const VectorX<Variable>>& vars,
+    std::vector<std::pair<int, int>>* duplicates) {
+  std::unordered_map<Variable::Id, int> map;
+  map.reserve(vars.size());
+  for (int j = 0; j < vars.size(); ++j) {
+    const auto it = map.emplace(vars(j).get_id(), j);
+    if (!it.second) {
+      duplicates->emplace_back(j, it.first->second);
+    }
+  }
+  return map;
+}
+
 // A helper function to implement DecomposeLinearExpressions and
-// DecomposeAffineExpressions functions. It finds the coefficient of the
-// monomial `m` in the `map` and fills `M(i)` with the value.  If the monomial
-// `m` does not appear in `map`, it uses `0.0` instead. If the coefficient is
-// not a constant, it throws a runtime_error.
+// DecomposeAffineExpressions functions. It fills the row `M_row` with the
+// coefficients of the linear monomials of `e` in `vars`, in a single pass over
+// the terms of `e`, finding the column of each term with `var_to_index`. It
+// returns the constant term of `e`. If `e` is not affine in `vars`, it throws
+// a runtime_error.
 template <typename Derived>
-void FindCoefficientAndFill(const Polynomial::MapType& map, const Monomial& m,
-                            const int i, const Eigen::MatrixBase<Derived>& M) {
-  const auto it = map.find(m);
+double FillLinearCoefficients(
+    const Expression& e, const Variables& vars,
+    const std::unordered_map<Variable::Id, int>& var_to_index,
+    const std::vector<std::pair<int, int>>& duplicates,
+    const Eigen::MatrixBase<Derived>& M_row) {
+  if (!e.is_polynomial()) {
+    ThrowError("non-polynomial", e.to_string());  // e should be a polynomial.
+  }
+  const Polynomial p{e, vars};
+  if (p.TotalDegree() > 1) {
+    ThrowError("non-linear", e.to_string());  // e should be linear.
+  }
   // Here, we use const_cast hack. See
   // https://eigen.tuxfamily.org/dox/TopicFunctionTakingEigenTypes.html for
   // details.
   Eigen::MatrixBase<Derived>& M_dummy =
-      const_cast<Eigen::MatrixBase<Derived>&>(M);
-  if (it != map.end()) {
-    // m should have a constant coefficient.
-    if (!is_constant(it->second)) {
-      ThrowError("non-constant", it->second.to_string());
+      const_cast<Eigen::MatrixBase<Derived>&>(M_row);
+  M_dummy.setZero();
+  double constant_term{0.0};
+  for (const auto& term : p.monomial_to_coefficient_map()) {
+    // Each monomial should have a constant coefficient.
+    if (!is_constant(term.second)) {
+      ThrowError("non-constant", term.second.to_string());
     }
-    M_dummy(i) = get_constant_value(it->second);
-  } else {
-    M_dummy(i) = 0.0;
+    const double coefficient = get_constant_value(term.second);
+    if (term.first.total_degree() == 0) {
+      constant_term = coefficient;
+    } else {
+      const Variable& var = term.first.get_powers().begin()->first;
+      M_dummy(var_to_index.at(var.get_id())) = coefficient;
+    }
+  }
+  for (const auto& duplicate : duplicates) {
+    M_dummy(duplicate.first) = M_dummy(duplicate.second);
   }
+  return constant_term;
 }
 }  // namespace
 
@@ -48,24 +88,18 @@ void DecomposeLinearExpressions(
     const Eigen::Ref<const VectorX<symbolic::Variable>>& vars,
     EigenPtr<Eigen::MatrixXd> M) {
   DRAKE_DEMAND(M->rows() == expressions.rows() && M->cols() == vars.rows());
+  const Variables vars_set{vars};
+  std::vector<std::pair<int, int>> duplicates;
+  const std::unordered_map<Variable::Id, int> var_to_index =
+      MapVariablesToIndices(vars, &duplicates);
   for (int i = 0; i < expressions.size(); ++i) {
     const Expression& e{expressions(i)};
-    if (!e.is_polynomial()) {
-      ThrowError("non-polynomial", e.to_string());  // e should be a polynomial.
-    }
-    const Polynomial p{e, Variables{vars}};
-    if (p.TotalDegree() > 1) {
-      ThrowError("non-linear", e.to_string());  // e should be linear.
-    }
-    const Polynomial::MapType& map{p.monomial_to_coefficient_map()};
-    if (map.count(Monomial{}) > 0) {
+    const double constant_term = FillLinearCoefficients(
+        e, vars_set, var_to_index, duplicates, M->row(i));
+    if (constant_term != 0.0) {
       // e should not have a constant term.
       ThrowError("non-linear", e.to_string());
     }
-    // Fill M(i, j).
-    for (int j = 0; j < vars.size(); ++j) {
-      FindCoefficientAndFill(map, Monomial{vars.coeff(j)}, j, M->row(i));
-    }
   }
 }
 
@@ -75,22 +109,13 @@ void DecomposeAffineExpressions(
     EigenPtr<Eigen::MatrixXd> M, EigenPtr<Eigen::VectorXd> v) {
   DRAKE_DEMAND(M->rows() == expressions.rows() && M->cols() == vars.rows());
   DRAKE_DEMAND(v->rows() == expressions.rows());
+  const Variables vars_set{vars};
+  std::vector<std::pair<int, int>> duplicates;
+  const std::unordered_map<Variable::Id, int> var_to_index =
+      MapVariablesToIndices(vars, &duplicates);
   for (int i = 0; i < expressions.size(); ++i) {
-    const Expression& e{expressions(i)};
-    if (!e.is_polynomial()) {
-      ThrowError("non-polynomial", e.to_string());  // e should be a polynomial.
-    }
-    const Polynomial p{e, Variables{vars}};
-    if (p.TotalDegree() > 1) {
-      ThrowError("non-linear", e.to_string());  // e should be linear.
-    }
-    const Polynomial::MapType& map{p.monomial_to_coefficient_map()};
-    // Fill M(i, j).
-    for (int j = 0; j < vars.size(); ++j) {
-      FindCoefficientAndFill(map, Monomial{vars.coeff(j)}, j, M->row(i));
-    }
-    // Fill v(i).
-    FindCoefficientAndFill(map, Monomial{}, i, *v);
+    (*v)(i) = FillLinearCoefficients(expressions(i), vars_set, var_to_index,
+                                     duplicates, M->row(i));
   }
 }
 }  // namespace symbolic
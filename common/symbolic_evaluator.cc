@@ -0,0 +1,484 @@
+#include "drake/common/symbolic_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_optional.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace symbolic {
+
+using internal::EvaluatorInstruction;
+using internal::EvaluatorOp;
+using std::runtime_error;
+using std::vector;
+
+namespace {
+
+struct ExpressionEqualTo {
+  bool operator()(const Expression& e1, const Expression& e2) const {
+    return e1.EqualTo(e2);
+  }
+};
+
+struct FormulaEqualTo {
+  bool operator()(const Formula& f1, const Formula& f2) const {
+    return f1.EqualTo(f2);
+  }
+};
+
+// Compiles expressions into the instructions and registers of an
+// ExpressionEvaluator, sharing the registers of the structurally identical
+// subexpressions and of the equal constants.
+class Compiler {
+ public:
+  Compiler(const vector<Variable>& variables,
+           vector<EvaluatorInstruction>* instructions,
+           vector<double>* registers, vector<Expression>* opaque_expressions,
+           vector<Formula>* opaque_formulas)
+      : instructions_(*instructions),
+        registers_(*registers),
+        opaque_expressions_(*opaque_expressions),
+        opaque_formulas_(*opaque_formulas) {
+    registers_.assign(variables.size(), 0.0);
+    for (size_t i = 0; i < variables.size(); ++i) {
+      if (!variable_registers_.emplace(variables[i].get_id(), i).second) {
+        throw runtime_error("ExpressionEvaluator: the variable " +
+                            variables[i].get_name() + " is repeated.");
+      }
+    }
+  }
+
+  // Returns the register of the value of `e`.
+  int Compile(const Expression& e) {
+    const auto it = expression_registers_.find(e);
+    if (it != expression_registers_.end()) {
+      return it->second;
+    }
+    const int result = DoCompile(e);
+    expression_registers_.emplace(e, result);
+    return result;
+  }
+
+  // Returns the register of the value of `f`, as 1.0 or 0.0.
+  int Compile(const Formula& f) {
+    const auto it = formula_registers_.find(f);
+    if (it != formula_registers_.end()) {
+      return it->second;
+    }
+    const int result = DoCompile(f);
+    formula_registers_.emplace(f, result);
+    return result;
+  }
+
+ private:
+  int DoCompile(const Expression& e) {
+    switch (e.get_kind()) {
+      case ExpressionKind::Constant:
+        return Constant(get_constant_value(e));
+      case ExpressionKind::Var: {
+        const Variable& var = get_variable(e);
+        const auto it = variable_registers_.find(var.get_id());
+        if (it == variable_registers_.end()) {
+          throw runtime_error("ExpressionEvaluator: the variable " +
+                              var.get_name() + " is not in the variables.");
+        }
+        return it->second;
+      }
+      case ExpressionKind::Add:
+        return CompileAddition(e);
+      case ExpressionKind::Mul:
+        return CompileMultiplication(e);
+      case ExpressionKind::Div:
+        return Binary(EvaluatorOp::kDiv, e);
+      case ExpressionKind::Log:
+        return Unary(EvaluatorOp::kLog, e);
+      case ExpressionKind::Abs:
+        return Unary(EvaluatorOp::kAbs, e);
+      case ExpressionKind::Exp:
+        return Unary(EvaluatorOp::kExp, e);
+      case ExpressionKind::Sqrt:
+        return Unary(EvaluatorOp::kSqrt, e);
+      case ExpressionKind::Pow:
+        return Binary(EvaluatorOp::kPow, e);
+      case ExpressionKind::Sin:
+        return Unary(EvaluatorOp::kSin, e);
+      case ExpressionKind::Cos:
+        return Unary(EvaluatorOp::kCos, e);
+      case ExpressionKind::Tan:
+        return Unary(EvaluatorOp::kTan, e);
+      case ExpressionKind::Asin:
+        return Unary(EvaluatorOp::kAsin, e);
+      case ExpressionKind::Acos:
+        return Unary(EvaluatorOp::kAcos, e);
+      case ExpressionKind::Atan:
+        return Unary(EvaluatorOp::kAtan, e);
+      case ExpressionKind::Atan2:
+        return Binary(EvaluatorOp::kAtan2, e);
+      case ExpressionKind::Sinh:
+        return Unary(EvaluatorOp::kSinh, e);
+      case ExpressionKind::Cosh:
+        return Unary(EvaluatorOp::kCosh, e);
+      case ExpressionKind::Tanh:
+        return Unary(EvaluatorOp::kTanh, e);
+      case ExpressionKind::Min:
+        return Binary(EvaluatorOp::kMin, e);
+      case ExpressionKind::Max:
+        return Binary(EvaluatorOp::kMax, e);
+      case ExpressionKind::Ceil:
+        return Unary(EvaluatorOp::kCeil, e);
+      case ExpressionKind::Floor:
+        return Unary(EvaluatorOp::kFloor, e);
+      case ExpressionKind::IfThenElse:
+        return Emit(EvaluatorOp::kIfThenElse,
+                    Compile(get_conditional_formula(e)),
+                    Compile(get_then_expression(e)),
+                    Compile(get_else_expression(e)));
+      case ExpressionKind::NaN:
+      case ExpressionKind::UninterpretedFunction:
+        opaque_expressions_.push_back(e);
+        return Emit(EvaluatorOp::kOpaqueExpression,
+                    static_cast<int>(opaque_expressions_.size()) - 1);
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+  int DoCompile(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::False:
+        return Constant(0.0);
+      case FormulaKind::True:
+        return Constant(1.0);
+      case FormulaKind::Eq:
+        return Relational(EvaluatorOp::kEq, f);
+      case FormulaKind::Neq:
+        return Relational(EvaluatorOp::kNeq, f);
+      case FormulaKind::Gt:
+        return Relational(EvaluatorOp::kGt, f);
+      case FormulaKind::Geq:
+        return Relational(EvaluatorOp::kGeq, f);
+      case FormulaKind::Lt:
+        return Relational(EvaluatorOp::kLt, f);
+      case FormulaKind::Leq:
+        return Relational(EvaluatorOp::kLeq, f);
+      case FormulaKind::And:
+      case FormulaKind::Or: {
+        const EvaluatorOp op = f.get_kind() == FormulaKind::And
+                                   ? EvaluatorOp::kAnd
+                                   : EvaluatorOp::kOr;
+        int result = -1;
+        for (const Formula& operand : get_operands(f)) {
+          const int value = Compile(operand);
+          result = result < 0 ? value : Emit(op, result, value);
+        }
+        return result;
+      }
+      case FormulaKind::Not:
+        return Emit(EvaluatorOp::kNot, Compile(get_operand(f)));
+      case FormulaKind::Var:
+      case FormulaKind::Forall:
+      case FormulaKind::Isnan:
+      case FormulaKind::PositiveSemidefinite:
+        opaque_formulas_.push_back(f);
+        return Emit(EvaluatorOp::kOpaqueFormula,
+                    static_cast<int>(opaque_formulas_.size()) - 1);
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+  // c₀ + ∑ᵢ cᵢ eᵢ, accumulated in the order of Expression::Evaluate().
+  int CompileAddition(const Expression& e) {
+    const double constant = get_constant_in_addition(e);
+    int result = -1;
+    for (const auto& term : get_expr_to_coeff_map_in_addition(e)) {
+      const int value = Compile(term.first);
+      const double coeff = term.second;
+      if (result < 0 && constant == 0.0 && coeff == 1.0) {
+        result = value;
+      } else {
+        if (result < 0) result = Constant(constant);
+        result = coeff == 1.0
+                     ? Emit(EvaluatorOp::kAdd, result, value)
+                     : Emit(EvaluatorOp::kMulAdd, result, value,
+                            Constant(coeff));
+      }
+    }
+    return result < 0 ? Constant(constant) : result;
+  }
+
+  // c₀ ∏ᵢ pow(bᵢ, eᵢ), accumulated in the order of Expression::Evaluate().
+  int CompileMultiplication(const Expression& e) {
+    const double constant = get_constant_in_multiplication(e);
+    int result = -1;
+    for (const auto& factor :
+         get_base_to_exponent_map_in_multiplication(e)) {
+      const Expression& exponent = factor.second;
+      int value = Compile(factor.first);
+      if (!is_constant(exponent) || get_constant_value(exponent) != 1.0) {
+        value = Emit(EvaluatorOp::kFactorPow, value, Compile(exponent));
+      }
+      if (result < 0 && constant == 1.0) {
+        result = value;
+      } else {
+        if (result < 0) result = Constant(constant);
+        result = Emit(EvaluatorOp::kMul, result, value);
+      }
+    }
+    return result < 0 ? Constant(constant) : result;
+  }
+
+  int Unary(EvaluatorOp op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)));
+  }
+
+  int Binary(EvaluatorOp op, const Expression& e) {
+    return Emit(op, Compile(get_first_argument(e)),
+                Compile(get_second_argument(e)));
+  }
+
+  int Relational(EvaluatorOp op, const Formula& f) {
+    return Emit(op, Compile(get_lhs_expression(f)),
+                Compile(get_rhs_expression(f)));
+  }
+
+  int Constant(double value) {
+    const auto it = constant_registers_.find(value);
+    if (it != constant_registers_.end()) {
+      return it->second;
+    }
+    registers_.push_back(value);
+    const int result = static_cast<int>(registers_.size()) - 1;
+    constant_registers_.emplace(value, result);
+    return result;
+  }
+
+  int Emit(EvaluatorOp op, int a, int b = 0, int c = 0) {
+    registers_.push_back(0.0);
+    const int out = static_cast<int>(registers_.size()) - 1;
+    instructions_.push_back(EvaluatorInstruction{op, out, a, b, c});
+    return out;
+  }
+
+  vector<EvaluatorInstruction>& instructions_;
+  vector<double>& registers_;
+  vector<Expression>& opaque_expressions_;
+  vector<Formula>& opaque_formulas_;
+  std::unordered_map<Variable::Id, int> variable_registers_;
+  // The constants are compared by their bits, so that 0.0 and -0.0 differ.
+  std::map<double, int, bool (*)(double, double)> constant_registers_{
+      [](double x, double y) {
+        return std::signbit(x) != std::signbit(y) ? std::signbit(x) : x < y;
+      }};
+  std::unordered_map<Expression, int, std::hash<Expression>,
+                     ExpressionEqualTo>
+      expression_registers_;
+  std::unordered_map<Formula, int, std::hash<Formula>, FormulaEqualTo>
+      formula_registers_;
+};
+
+// Returns true iff Expression::Evaluate() throws for pow(x, y).
+bool IsPowOutOfDomain(double x, double y) {
+  return std::isfinite(x) && x < 0.0 && std::isfinite(y) &&
+         std::trunc(y) != y;
+}
+
+}  // namespace
+
+ExpressionEvaluator::ExpressionEvaluator(
+    const vector<Variable>& variables,
+    const Eigen::Ref<const VectorX<Expression>>& expressions)
+    : variables_(variables), expressions_(expressions) {
+  Compiler compiler(variables_, &instructions_, &initial_registers_,
+                    &opaque_expressions_, &opaque_formulas_);
+  result_registers_.reserve(expressions_.size());
+  for (int i = 0; i < expressions_.size(); ++i) {
+    result_registers_.push_back(compiler.Compile(expressions_(i)));
+  }
+}
+
+void ExpressionEvaluator::Evaluate(
+    const Eigen::Ref<const Eigen::VectorXd>& values,
+    EigenPtr<Eigen::VectorXd> results) const {
+  DRAKE_THROW_UNLESS(values.size() == num_variables());
+  DRAKE_THROW_UNLESS(results != nullptr);
+  DRAKE_THROW_UNLESS(results->size() == num_expressions());
+
+  vector<double> r(initial_registers_);
+  for (int i = 0; i < num_variables(); ++i) {
+    r[i] = values(i);
+  }
+  // Whether an instruction met an argument for which Expression::Evaluate()
+  // throws.
+  bool out_of_domain = false;
+  // The environment of the opaque subexpressions, if any.
+  optional<Environment> env;
+  for (const EvaluatorInstruction& instruction : instructions_) {
+    if (instruction.op == EvaluatorOp::kOpaqueExpression ||
+        instruction.op == EvaluatorOp::kOpaqueFormula) {
+      if (!env) env = MakeEnvironment(values);
+      // The operand is the index of the subexpression, rather than a
+      // register. Since it might be in a branch that is not taken, its
+      // exceptions are deferred to EvaluateTrees().
+      try {
+        r[instruction.out] =
+            instruction.op == EvaluatorOp::kOpaqueExpression
+                ? opaque_expressions_[instruction.a].Evaluate(*env)
+                : opaque_formulas_[instruction.a].Evaluate(*env);
+      } catch (const std::exception&) {
+        out_of_domain = true;
+        r[instruction.out] = std::numeric_limits<double>::quiet_NaN();
+      }
+      continue;
+    }
+    const double a = r[instruction.a];
+    const double b = r[instruction.b];
+    double& out = r[instruction.out];
+    switch (instruction.op) {
+      case EvaluatorOp::kAdd:
+        out = a + b;
+        break;
+      case EvaluatorOp::kMulAdd:
+        out = a + b * r[instruction.c];
+        break;
+      case EvaluatorOp::kMul:
+        out = a * b;
+        break;
+      case EvaluatorOp::kDiv:
+        out_of_domain |= (b == 0.0);
+        out = a / b;
+        break;
+      case EvaluatorOp::kPow:
+        out_of_domain |= IsPowOutOfDomain(a, b);
+        out = std::pow(a, b);
+        break;
+      case EvaluatorOp::kFactorPow:
+        out = std::pow(a, b);
+        break;
+      case EvaluatorOp::kLog:
+        out_of_domain |= !(a >= 0.0);
+        out = std::log(a);
+        break;
+      case EvaluatorOp::kAbs:
+        out = std::fabs(a);
+        break;
+      case EvaluatorOp::kExp:
+        out = std::exp(a);
+        break;
+      case EvaluatorOp::kSqrt:
+        out_of_domain |= !(a >= 0.0);
+        out = std::sqrt(a);
+        break;
+      case EvaluatorOp::kSin:
+        out = std::sin(a);
+        break;
+      case EvaluatorOp::kCos:
+        out = std::cos(a);
+        break;
+      case EvaluatorOp::kTan:
+        out = std::tan(a);
+        break;
+      case EvaluatorOp::kAsin:
+        out_of_domain |= !(a >= -1.0 && a <= 1.0);
+        out = std::asin(a);
+        break;
+      case EvaluatorOp::kAcos:
+        out_of_domain |= !(a >= -1.0 && a <= 1.0);
+        out = std::acos(a);
+        break;
+      case EvaluatorOp::kAtan:
+        out = std::atan(a);
+        break;
+      case EvaluatorOp::kAtan2:
+        out = std::atan2(a, b);
+        break;
+      case EvaluatorOp::kSinh:
+        out = std::sinh(a);
+        break;
+      case EvaluatorOp::kCosh:
+        out = std::cosh(a);
+        break;
+      case EvaluatorOp::kTanh:
+        out = std::tanh(a);
+        break;
+      case EvaluatorOp::kMin:
+        out = std::min(a, b);
+        break;
+      case EvaluatorOp::kMax:
+        out = std::max(a, b);
+        break;
+      case EvaluatorOp::kCeil:
+        out = std::ceil(a);
+        break;
+      case EvaluatorOp::kFloor:
+        out = std::floor(a);
+        break;
+      case EvaluatorOp::kIfThenElse:
+        out = (a != 0.0) ? b : r[instruction.c];
+        break;
+      case EvaluatorOp::kEq:
+        out = (a == b);
+        break;
+      case EvaluatorOp::kNeq:
+        out = (a != b);
+        break;
+      case EvaluatorOp::kGt:
+        out = (a > b);
+        break;
+      case EvaluatorOp::kGeq:
+        out = (a >= b);
+        break;
+      case EvaluatorOp::kLt:
+        out = (a < b);
+        break;
+      case EvaluatorOp::kLeq:
+        out = (a <= b);
+        break;
+      case EvaluatorOp::kAnd:
+        out = (a != 0.0 && b != 0.0);
+        break;
+      case EvaluatorOp::kOr:
+        out = (a != 0.0 || b != 0.0);
+        break;
+      case EvaluatorOp::kNot:
+        out = (a == 0.0);
+        break;
+      case EvaluatorOp::kOpaqueExpression:
+      case EvaluatorOp::kOpaqueFormula:
+        DRAKE_UNREACHABLE();
+    }
+  }
+  if (out_of_domain) {
+    EvaluateTrees(values, results);
+    return;
+  }
+  for (int i = 0; i < num_expressions(); ++i) {
+    (*results)(i) = r[result_registers_[i]];
+  }
+}
+
+void ExpressionEvaluator::EvaluateTrees(
+    const Eigen::Ref<const Eigen::VectorXd>& values,
+    EigenPtr<Eigen::VectorXd> results) const {
+  const Environment env = MakeEnvironment(values);
+  for (int i = 0; i < num_expressions(); ++i) {
+    (*results)(i) = expressions_(i).Evaluate(env);
+  }
+}
+
+Environment ExpressionEvaluator::MakeEnvironment(
+    const Eigen::Ref<const Eigen::VectorXd>& values) const {
+  Environment env;
+  for (int i = 0; i < num_variables(); ++i) {
+    env.insert(variables_[i], values(i));
+  }
+  return env;
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+namespace internal {
+// The operations of the instructions of ExpressionEvaluator.
+enum class EvaluatorOp : uint8_t {
+  kAdd,            // a + b
+  kMulAdd,         // a + b * c
+  kMul,            // a * b
+  kDiv,            // a / b
+  kPow,            // pow(a, b), as a Pow expression
+  kFactorPow,      // pow(a, b), as a factor of a Mul expression
+  kLog,
+  kAbs,
+  kExp,
+  kSqrt,
+  kSin,
+  kCos,
+  kTan,
+  kAsin,
+  kAcos,
+  kAtan,
+  kAtan2,
+  kSinh,
+  kCosh,
+  kTanh,
+  kMin,
+  kMax,
+  kCeil,
+  kFloor,
+  kIfThenElse,     // a ? b : c
+  kEq,             // a == b, as 1.0 or 0.0 (and likewise below)
+  kNeq,
+  kGt,
+  kGeq,
+  kLt,
+  kLeq,
+  kAnd,
+  kOr,
+  kNot,
+  kOpaqueExpression,  // The expression of index a, with Evaluate()
+  kOpaqueFormula,     // The formula of index a, with Evaluate()
+};
+
+// An instruction of ExpressionEvaluator, which stores into the register `out`
+// the result of `op` on the registers `a`, `b` and `c` (as many as `op` has
+// operands).
+struct EvaluatorInstruction {
+  EvaluatorOp op;
+  int out;
+  int a;
+  int b;
+  int c;
+};
+}  // namespace internal
+
+/// Evaluates a fixed vector of symbolic expressions at many values of their
+/// variables, much faster than Expression::Evaluate() does.
+///
+/// The constructor compiles the expressions, once, into a flat sequence of
+/// instructions on an array of registers, in which the structurally identical
+/// subexpressions (within an expression or across the expressions) are
+/// computed only once. Evaluate() then runs these instructions on a dense
+/// array of the values of the variables, without walking the expression trees
+/// or looking the variables up in an Environment.
+///
+/// The results are those of Expression::Evaluate(), up to round-off errors,
+/// and so are the exceptions: when an instruction meets an argument for which
+/// Expression::Evaluate() throws (e.g., a division by zero, or the logarithm
+/// of a negative number), all of the expressions are evaluated again with
+/// Expression::Evaluate(). Note that both branches of an if-then-else
+/// expression are computed, so that such an argument in the branch that is
+/// not taken also leads to this (slower) evaluation. The subexpressions that
+/// have no instructions (uninterpreted functions, and the conditions of
+/// if-then-else expressions other than relational formulas and their
+/// conjunctions, disjunctions and negations) are evaluated with
+/// Expression::Evaluate() and Formula::Evaluate().
+///
+/// For example,
+///
+/// @code
+/// const ExpressionEvaluator evaluator({x, y}, Vector2<Expression>(
+///     sin(x) * y, sin(x) + 1));
+/// Eigen::VectorXd results(2);
+/// evaluator.Evaluate(Eigen::Vector2d(0.5, 2.0), &results);
+/// @endcode
+///
+/// computes sin(0.5) once, for both of the results.
+class ExpressionEvaluator {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionEvaluator)
+
+  /// Constructs an evaluator of no expressions.
+  ExpressionEvaluator() = default;
+
+  /// Compiles @p expressions, of which Evaluate() takes the values of the
+  /// variables in the order of @p variables.
+  ///
+  /// @throws std::runtime_error if @p variables has duplicates, or if an
+  /// expression has a variable that is not in @p variables.
+  ExpressionEvaluator(const std::vector<Variable>& variables,
+                      const Eigen::Ref<const VectorX<Expression>>& expressions);
+
+  /// Returns the number of variables.
+  int num_variables() const { return static_cast<int>(variables_.size()); }
+
+  /// Returns the number of expressions.
+  int num_expressions() const { return expressions_.size(); }
+
+  /// Returns the number of instructions that Evaluate() runs.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Evaluates the expressions, with the variables set to @p values, into
+  /// @p results.
+  ///
+  /// @throws std::exception if @p values does not have num_variables()
+  /// elements, if @p results does not have num_expressions() elements, or if
+  /// Expression::Evaluate() would throw.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& values,
+                EigenPtr<Eigen::VectorXd> results) const;
+
+ private:
+  // Evaluates the expressions with Expression::Evaluate().
+  void EvaluateTrees(const Eigen::Ref<const Eigen::VectorXd>& values,
+                     EigenPtr<Eigen::VectorXd> results) const;
+
+  // Returns an environment which maps the variables to `values`.
+  Environment MakeEnvironment(
+      const Eigen::Ref<const Eigen::VectorXd>& values) const;
+
+  std::vector<Variable> variables_;
+  VectorX<Expression> expressions_;
+  std::vector<internal::EvaluatorInstruction> instructions_;
+  // The registers before the evaluation: the values of the variables (zeros,
+  // to be replaced), then the constants and the results of the instructions.
+  std::vector<double> initial_registers_;
+  // The registers of the results of the expressions.
+  std::vector<int> result_registers_;
+  // The subexpressions that have no instructions.
+  std::vector<Expression> opaque_expressions_;
+  std::vector<Formula> opaque_formulas_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
@@ -2,12 +2,15 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <ios>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -15,7 +18,9 @@
 #include <fmt/ostream.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic.h"
 #define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
 #include "drake/common/symbolic_expression_cell.h"
@@ -24,8 +29,8 @@
 namespace drake {
 namespace symbolic {
 
+using internal::MakeCell;
 using std::logic_error;
-using std::make_shared;
 using std::map;
 using std::numeric_limits;
 using std::ostream;
@@ -50,9 +55,76 @@ namespace {
 // http://stackoverflow.com/questions/29842095/incompatible-operand-types-when-using-ternary-conditional-operator.
 shared_ptr<ExpressionCell> make_cell(const double d) {
   if (std::isnan(d)) {
-    return make_shared<ExpressionNaN>();
+    return MakeCell<ExpressionNaN>();
+  }
+  return MakeCell<ExpressionConstant>(d);
+}
+
+// Returns the cell to use for a new expression whose cell is @p ptr: with
+// a ScopedExpressionArena, it may be an existing structurally identical cell.
+shared_ptr<ExpressionCell> Intern(shared_ptr<ExpressionCell> ptr) {
+  std::shared_ptr<internal::CellArena>* const arena =
+      internal::GetActiveCellArena();
+  if (arena == nullptr) {
+    return ptr;
+  }
+  return (*arena)->Intern(std::move(ptr));
+}
+
+// The results of Expression::Expand(), Substitute() and Differentiate() on the
+// cells that a matrix-wide transformation (e.g., Expand(m)) has visited on
+// this thread, so that the subexpressions that are shared by the elements of
+// the matrix, or within an element, are transformed only once. The input
+// expressions are kept alive, so that their cells are not reused by the new
+// expressions during the transformation.
+struct TransformationMemo {
+  using Map = std::unordered_map<const ExpressionCell*,
+                                 std::pair<Expression, Expression>>;
+
+  // Returns the recorded result for `e`, or nullptr if there is none.
+  static const Expression* Find(const Map& map, const Expression& e,
+                                const ExpressionCell* cell) {
+    const auto iter = map.find(cell);
+    if (iter == map.end()) {
+      return nullptr;
+    }
+    DRAKE_ASSERT(iter->second.first.EqualTo(e));
+    return &iter->second.second;
   }
-  return make_shared<ExpressionConstant>(d);
+
+  Map expansions;
+  // The results of Substitute(*substitution) only.
+  const Substitution* substitution{};
+  Map substitutions;
+  // The derivatives with respect to *variable only.
+  const Variable* variable{};
+  Map derivatives;
+};
+
+// The memo of the transformation in progress on this thread, if any.
+thread_local TransformationMemo* active_transformation_memo{nullptr};
+
+// Makes `memo` the memo of this thread during its lifetime.
+class ScopedTransformationMemo {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedTransformationMemo)
+
+  explicit ScopedTransformationMemo(TransformationMemo* memo)
+      : previous_(active_transformation_memo) {
+    active_transformation_memo = memo;
+  }
+
+  ~ScopedTransformationMemo() { active_transformation_memo = previous_; }
+
+ private:
+  TransformationMemo* const previous_;
+};
+
+// Makes a constant that outlives every ScopedExpressionArena, so that the
+// static constants below do not keep an arena alive.
+Expression MakeStaticConstant(double d) {
+  internal::ScopedCellArenaSuspension no_arena;
+  return Expression{d};
 }
 
 // Negates an addition expression.
@@ -71,10 +143,10 @@ Expression NegateMultiplication(const Expression& e) {
 }  // namespace
 
 Expression::Expression(const Variable& var)
-    : ptr_{make_shared<ExpressionVar>(var)} {}
-Expression::Expression(const double d) : ptr_{make_cell(d)} {}
+    : ptr_{Intern(MakeCell<ExpressionVar>(var))} {}
+Expression::Expression(const double d) : ptr_{Intern(make_cell(d))} {}
 Expression::Expression(std::shared_ptr<ExpressionCell> ptr)
-    : ptr_{std::move(ptr)} {}
+    : ptr_{Intern(std::move(ptr))} {}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -88,28 +160,28 @@ void Expression::HashAppend(DelegatingHasher* hasher) const {
 }
 
 Expression Expression::Zero() {
-  static const never_destroyed<Expression> zero{0.0};
+  static const never_destroyed<Expression> zero{MakeStaticConstant(0.0)};
   return zero.access();
 }
 
 Expression Expression::One() {
-  static const never_destroyed<Expression> one{1.0};
+  static const never_destroyed<Expression> one{MakeStaticConstant(1.0)};
   return one.access();
 }
 
 Expression Expression::Pi() {
-  static const never_destroyed<Expression> pi{M_PI};
+  static const never_destroyed<Expression> pi{MakeStaticConstant(M_PI)};
   return pi.access();
 }
 
 Expression Expression::E() {
-  static const never_destroyed<Expression> e{M_E};
+  static const never_destroyed<Expression> e{MakeStaticConstant(M_E)};
   return e.access();
 }
 
 Expression Expression::NaN() {
   static const never_destroyed<Expression> nan{
-      Expression{make_shared<ExpressionNaN>()}};
+      MakeStaticConstant(numeric_limits<double>::quiet_NaN())};
   return nan.access();
 }
 
@@ -204,9 +276,31 @@ Expression Expression::Expand() const {
     // If it is already expanded, return the current expression without calling
     // Expand() on the cell.
     return *this;
+  }
+  TransformationMemo* const memo = active_transformation_memo;
+  if (memo != nullptr) {
+    if (const Expression* const expansion =
+            TransformationMemo::Find(memo->expansions, *this, ptr_.get())) {
+      return *expansion;
+    }
+  }
+  std::shared_ptr<internal::CellArena>* const arena =
+      internal::GetActiveCellArena();
+  Expression result;
+  if (arena == nullptr) {
+    result = ptr_->Expand();
+  } else if (const Expression* const expansion =
+                 (*arena)->FindExpansion(*this)) {
+    // Reuse the expansion of a shared subexpression.
+    result = *expansion;
   } else {
-    return ptr_->Expand();
+    result = ptr_->Expand();
+    (*arena)->AddExpansion(*this, result);
+  }
+  if (memo != nullptr) {
+    memo->expansions.emplace(ptr_.get(), std::make_pair(*this, result));
   }
+  return result;
 }
 
 Expression Expression::Substitute(const Variable& var,
@@ -217,15 +311,36 @@ Expression Expression::Substitute(const Variable& var,
 
 Expression Expression::Substitute(const Substitution& s) const {
   DRAKE_ASSERT(ptr_ != nullptr);
-  if (!s.empty()) {
+  if (s.empty()) {
+    return *this;
+  }
+  TransformationMemo* const memo = active_transformation_memo;
+  if (memo == nullptr || memo->substitution != &s) {
     return ptr_->Substitute(s);
   }
-  return *this;
+  if (const Expression* const result =
+          TransformationMemo::Find(memo->substitutions, *this, ptr_.get())) {
+    return *result;
+  }
+  Expression result{ptr_->Substitute(s)};
+  memo->substitutions.emplace(ptr_.get(), std::make_pair(*this, result));
+  return result;
 }
 
 Expression Expression::Differentiate(const Variable& x) const {
   DRAKE_ASSERT(ptr_ != nullptr);
-  return ptr_->Differentiate(x);
+  TransformationMemo* const memo = active_transformation_memo;
+  if (memo == nullptr || memo->variable == nullptr ||
+      !memo->variable->equal_to(x)) {
+    return ptr_->Differentiate(x);
+  }
+  if (const Expression* const result =
+          TransformationMemo::Find(memo->derivatives, *this, ptr_.get())) {
+    return *result;
+  }
+  Expression result{ptr_->Differentiate(x)};
+  memo->derivatives.emplace(ptr_.get(), std::make_pair(*this, result));
+  return result;
 }
 
 RowVectorX<Expression> Expression::Jacobian(
@@ -537,7 +652,7 @@ Expression& operator/=(Expression& lhs, const Expression& rhs) {
     lhs = Expression::One();
     return lhs;
   }
-  lhs.ptr_ = make_shared<ExpressionDiv>(lhs, rhs);
+  lhs.ptr_ = MakeCell<ExpressionDiv>(lhs, rhs);
   return lhs;
 }
 
@@ -573,7 +688,7 @@ Expression log(const Expression& e) {
     ExpressionLog::check_domain(v);
     return Expression{std::log(v)};
   }
-  return Expression{make_shared<ExpressionLog>(e)};
+  return Expression{MakeCell<ExpressionLog>(e)};
 }
 
 Expression abs(const Expression& e) {
@@ -581,7 +696,7 @@ Expression abs(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::fabs(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionAbs>(e)};
+  return Expression{MakeCell<ExpressionAbs>(e)};
 }
 
 Expression exp(const Expression& e) {
@@ -589,7 +704,7 @@ Expression exp(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::exp(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionExp>(e)};
+  return Expression{MakeCell<ExpressionExp>(e)};
 }
 
 Expression sqrt(const Expression& e) {
@@ -605,7 +720,7 @@ Expression sqrt(const Expression& e) {
       return abs(get_first_argument(e));
     }
   }
-  return Expression{make_shared<ExpressionSqrt>(e)};
+  return Expression{MakeCell<ExpressionSqrt>(e)};
 }
 
 Expression pow(const Expression& e1, const Expression& e2) {
@@ -633,9 +748,9 @@ Expression pow(const Expression& e1, const Expression& e2) {
     // pow(base, exponent) ^ e2 => pow(base, exponent * e2)
     const Expression& base{get_first_argument(e1)};
     const Expression& exponent{get_second_argument(e1)};
-    return Expression{make_shared<ExpressionPow>(base, exponent * e2)};
+    return Expression{MakeCell<ExpressionPow>(base, exponent * e2)};
   }
-  return Expression{make_shared<ExpressionPow>(e1, e2)};
+  return Expression{MakeCell<ExpressionPow>(e1, e2)};
 }
 
 Expression sin(const Expression& e) {
@@ -643,7 +758,7 @@ Expression sin(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::sin(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionSin>(e)};
+  return Expression{MakeCell<ExpressionSin>(e)};
 }
 
 Expression cos(const Expression& e) {
@@ -652,7 +767,7 @@ Expression cos(const Expression& e) {
     return Expression{std::cos(get_constant_value(e))};
   }
 
-  return Expression{make_shared<ExpressionCos>(e)};
+  return Expression{MakeCell<ExpressionCos>(e)};
 }
 
 Expression tan(const Expression& e) {
@@ -660,7 +775,7 @@ Expression tan(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::tan(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionTan>(e)};
+  return Expression{MakeCell<ExpressionTan>(e)};
 }
 
 Expression asin(const Expression& e) {
@@ -670,7 +785,7 @@ Expression asin(const Expression& e) {
     ExpressionAsin::check_domain(v);
     return Expression{std::asin(v)};
   }
-  return Expression{make_shared<ExpressionAsin>(e)};
+  return Expression{MakeCell<ExpressionAsin>(e)};
 }
 
 Expression acos(const Expression& e) {
@@ -680,7 +795,7 @@ Expression acos(const Expression& e) {
     ExpressionAcos::check_domain(v);
     return Expression{std::acos(v)};
   }
-  return Expression{make_shared<ExpressionAcos>(e)};
+  return Expression{MakeCell<ExpressionAcos>(e)};
 }
 
 Expression atan(const Expression& e) {
@@ -688,7 +803,7 @@ Expression atan(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::atan(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionAtan>(e)};
+  return Expression{MakeCell<ExpressionAtan>(e)};
 }
 
 Expression atan2(const Expression& e1, const Expression& e2) {
@@ -697,7 +812,7 @@ Expression atan2(const Expression& e1, const Expression& e2) {
     return Expression{
         std::atan2(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<ExpressionAtan2>(e1, e2)};
+  return Expression{MakeCell<ExpressionAtan2>(e1, e2)};
 }
 
 Expression sinh(const Expression& e) {
@@ -705,7 +820,7 @@ Expression sinh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::sinh(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionSinh>(e)};
+  return Expression{MakeCell<ExpressionSinh>(e)};
 }
 
 Expression cosh(const Expression& e) {
@@ -713,7 +828,7 @@ Expression cosh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::cosh(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionCosh>(e)};
+  return Expression{MakeCell<ExpressionCosh>(e)};
 }
 
 Expression tanh(const Expression& e) {
@@ -721,7 +836,7 @@ Expression tanh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::tanh(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionTanh>(e)};
+  return Expression{MakeCell<ExpressionTanh>(e)};
 }
 
 Expression min(const Expression& e1, const Expression& e2) {
@@ -733,7 +848,7 @@ Expression min(const Expression& e1, const Expression& e2) {
   if (is_constant(e1) && is_constant(e2)) {
     return Expression{std::min(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<ExpressionMin>(e1, e2)};
+  return Expression{MakeCell<ExpressionMin>(e1, e2)};
 }
 
 Expression max(const Expression& e1, const Expression& e2) {
@@ -745,7 +860,7 @@ Expression max(const Expression& e1, const Expression& e2) {
   if (is_constant(e1) && is_constant(e2)) {
     return Expression{std::max(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<ExpressionMax>(e1, e2)};
+  return Expression{MakeCell<ExpressionMax>(e1, e2)};
 }
 
 Expression ceil(const Expression& e) {
@@ -753,7 +868,7 @@ Expression ceil(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::ceil(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionCeiling>(e)};
+  return Expression{MakeCell<ExpressionCeiling>(e)};
 }
 
 Expression floor(const Expression& e) {
@@ -761,7 +876,7 @@ Expression floor(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::floor(get_constant_value(e))};
   }
-  return Expression{make_shared<ExpressionFloor>(e)};
+  return Expression{MakeCell<ExpressionFloor>(e)};
 }
 
 Expression if_then_else(const Formula& f_cond, const Expression& e_then,
@@ -774,11 +889,11 @@ Expression if_then_else(const Formula& f_cond, const Expression& e_then,
   if (f_cond.EqualTo(Formula::False())) {
     return e_else;
   }
-  return Expression{make_shared<ExpressionIfThenElse>(f_cond, e_then, e_else)};
+  return Expression{MakeCell<ExpressionIfThenElse>(f_cond, e_then, e_else)};
 }
 
 Expression uninterpreted_function(string name, vector<Expression> arguments) {
-  return Expression{make_shared<ExpressionUninterpretedFunction>(
+  return Expression{MakeCell<ExpressionUninterpretedFunction>(
       std::move(name), std::move(arguments))};
 }
 
@@ -889,23 +1004,70 @@ VectorX<Variable> GetVariableVector(
   return vec;
 }
 
+namespace {
+// Returns the `num_rows` x `num_cols` matrix whose element (i, j) is
+// `transform(i, j, memo)`, computed on up to `num_threads` threads, where
+// `memo` is the (active) TransformationMemo of the thread. Each thread
+// computes a contiguous block of elements, in column-major order.
+MatrixX<Expression> TransformMatrix(
+    int num_rows, int num_cols, int num_threads,
+    const std::function<Expression(int i, int j, TransformationMemo* memo)>&
+        transform) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  MatrixX<Expression> result(num_rows, num_cols);
+  vector<TransformationMemo> memos(num_threads);
+  StaticParallelForIndexLoop(
+      num_threads, 0, num_rows * num_cols, [&](int thread_num, int index) {
+        TransformationMemo* const memo = &memos[thread_num];
+        const ScopedTransformationMemo scope(memo);
+        const int i = index % num_rows;
+        const int j = index / num_rows;
+        result(i, j) = transform(i, j, memo);
+      });
+  return result;
+}
+}  // namespace
+
+MatrixX<Expression> Expand(const Eigen::Ref<const MatrixX<Expression>>& m,
+                           const int num_threads) {
+  return TransformMatrix(m.rows(), m.cols(), num_threads,
+                         [&m](int i, int j, TransformationMemo*) {
+                           return m(i, j).Expand();
+                         });
+}
+
+MatrixX<Expression> Substitute(const Eigen::Ref<const MatrixX<Expression>>& m,
+                               const Substitution& subst,
+                               const int num_threads) {
+  return TransformMatrix(m.rows(), m.cols(), num_threads,
+                         [&m, &subst](int i, int j, TransformationMemo* memo) {
+                           memo->substitution = &subst;
+                           return m(i, j).Substitute(subst);
+                         });
+}
+
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
-                             const vector<Variable>& vars) {
+                             const vector<Variable>& vars,
+                             const int num_threads) {
   DRAKE_DEMAND(!vars.empty());
-  const Eigen::Ref<const VectorX<Expression>>::Index n{f.size()};
-  const size_t m{vars.size()};
-  MatrixX<Expression> J(n, m);
-  for (int i = 0; i < n; ++i) {
-    for (size_t j = 0; j < m; ++j) {
-      J(i, j) = f[i].Differentiate(vars[j]);
-    }
-  }
-  return J;
+  return TransformMatrix(
+      f.size(), vars.size(), num_threads,
+      [&f, &vars](int i, int j, TransformationMemo* memo) {
+        // The derivatives are only memoized for one variable at a time, which
+        // changes once per column.
+        if (memo->variable != &vars[j]) {
+          memo->variable = &vars[j];
+          memo->derivatives.clear();
+        }
+        return f(i).Differentiate(vars[j]);
+      });
 }
 
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
-                             const Eigen::Ref<const VectorX<Variable>>& vars) {
-  return Jacobian(f, vector<Variable>(vars.data(), vars.data() + vars.size()));
+                             const Eigen::Ref<const VectorX<Variable>>& vars,
+                             const int num_threads) {
+  return Jacobian(f, vector<Variable>(vars.data(), vars.data() + vars.size()),
+                  num_threads);
 }
 
 namespace {
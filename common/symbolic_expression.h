@@ -536,6 +536,7 @@ class Expression {
 
   friend class ExpressionAddFactory;
   friend class ExpressionMulFactory;
+  friend class internal::CellArena;
 
   // The following classes call the private method `set_expand()` and need to be
   // friends of this class.
@@ -1378,6 +1379,28 @@ namespace symbolic {
 VectorX<Variable> GetVariableVector(
     const Eigen::Ref<const VectorX<Expression>>& evec);
 
+/// Expands the elements of a symbolic matrix @p m (see Expression::Expand()),
+/// on up to @p num_threads threads. Unlike `m.unaryExpr(...)`, a
+/// subexpression that is shared by several elements of @p m (or that occurs
+/// several times in an element) is expanded only once per thread.
+///
+/// When @p num_threads is greater than one, the results are made on new
+/// threads, and so without the ScopedExpressionArena of the calling thread
+/// (if any).
+///
+/// @throws std::exception if @p num_threads is less than one.
+MatrixX<Expression> Expand(const Eigen::Ref<const MatrixX<Expression>>& m,
+                           int num_threads = 1);
+
+/// Substitutes a symbolic matrix @p m using a given substitution @p subst, on
+/// up to @p num_threads threads. A subexpression that is shared by several
+/// elements of @p m is substituted only once per thread, as in Expand(m).
+///
+/// @throws std::exception if @p num_threads is less than one.
+/// @throws std::runtime_error if NaN is detected during substitution.
+MatrixX<Expression> Substitute(const Eigen::Ref<const MatrixX<Expression>>& m,
+                               const Substitution& subst, int num_threads);
+
 /// Computes the Jacobian matrix J of the vector function @p f with respect to
 /// @p vars. J(i,j) contains ∂f(i)/∂vars(j).
 ///
@@ -1389,16 +1412,24 @@ VectorX<Variable> GetVariableVector(
 ///    | 2 * x             0|
 ///  </pre>
 ///
+/// The derivatives are computed on up to @p num_threads threads (see
+/// Expand(m)), and the derivative of a subexpression that is shared by
+/// several elements of @p f is computed only once per thread and variable.
+///
 /// @pre {@p vars is non-empty}.
+/// @throws std::exception if @p num_threads is less than one.
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
-                             const std::vector<Variable>& vars);
+                             const std::vector<Variable>& vars,
+                             int num_threads = 1);
 
 /// Computes the Jacobian matrix J of the vector function @p f with respect to
 /// @p vars. J(i,j) contains ∂f(i)/∂vars(j).
 ///
 /// @pre {@p vars is non-empty}.
+/// @throws std::exception if @p num_threads is less than one.
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
-                             const Eigen::Ref<const VectorX<Variable>>& vars);
+                             const Eigen::Ref<const VectorX<Variable>>& vars,
+                             int num_threads = 1);
 
 /// Returns the Taylor series expansion of `f` around `a` of order `order`.
 ///
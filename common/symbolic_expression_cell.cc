@@ -23,13 +23,13 @@
 namespace drake {
 namespace symbolic {
 
+using internal::MakeCell;
 using std::accumulate;
 using std::all_of;
 using std::domain_error;
 using std::endl;
 using std::equal;
 using std::lexicographical_compare;
-using std::make_shared;
 using std::map;
 using std::numeric_limits;
 using std::ostream;
@@ -658,7 +658,7 @@ Expression ExpressionAddFactory::GetExpression() const {
     const auto it(expr_to_coeff_map_.cbegin());
     return it->first * it->second;
   }
-  return Expression{make_shared<ExpressionAdd>(constant_, expr_to_coeff_map_)};
+  return Expression{MakeCell<ExpressionAdd>(constant_, expr_to_coeff_map_)};
 }
 
 void ExpressionAddFactory::AddConstant(const double constant) {
@@ -969,7 +969,7 @@ Expression ExpressionMulFactory::GetExpression() const {
     return pow(it->first, it->second);
   }
   return Expression{
-      make_shared<ExpressionMul>(constant_, base_to_exponent_map_)};
+      MakeCell<ExpressionMul>(constant_, base_to_exponent_map_)};
 }
 
 void ExpressionMulFactory::AddConstant(const double constant) {
@@ -12,11 +12,14 @@
 #endif
 
 #include <algorithm>  // for cpplint only
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -68,10 +71,12 @@ class ExpressionCell {
   bool is_polynomial() const { return is_polynomial_; }
 
   /** Checks if this symbolic expression is already expanded. */
-  bool is_expanded() const { return is_expanded_; }
+  bool is_expanded() const {
+    return is_expanded_.load(std::memory_order_relaxed);
+  }
 
   /** Sets this symbolic expression as already expanded. */
-  void set_expanded() { is_expanded_ = true; }
+  void set_expanded() { is_expanded_.store(true, std::memory_order_relaxed); }
 
   /** Returns a Polynomial representing this expression.
    *  Note that the ID of a variable is preserved in this translation.
@@ -109,9 +114,10 @@ class ExpressionCell {
   /** Default constructor. */
   ExpressionCell() = default;
   /** Move-constructs an ExpressionCell from an rvalue. */
-  ExpressionCell(ExpressionCell&& e) = default;
+  ExpressionCell(ExpressionCell&& e) : ExpressionCell(e) {}
   /** Copy-constructs an ExpressionCell from an lvalue. */
-  ExpressionCell(const ExpressionCell& e) = default;
+  ExpressionCell(const ExpressionCell& e)
+      : ExpressionCell(e.kind_, e.is_polynomial_, e.is_expanded()) {}
   /** Move-assigns (DELETED). */
   ExpressionCell& operator=(ExpressionCell&& e) = delete;
   /** Copy-assigns (DELETED). */
@@ -125,7 +131,9 @@ class ExpressionCell {
  private:
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
-  bool is_expanded_{false};
+  // Atomic, since a cell that is shared by expressions on several threads
+  // can be marked as expanded from any of them.
+  std::atomic<bool> is_expanded_{false};
 };
 
 /** Represents the base class for unary expressions.  */
@@ -1353,5 +1361,60 @@ to_uninterpreted_function(const Expression& e);
 std::shared_ptr<ExpressionUninterpretedFunction> to_uninterpreted_function(
     Expression* e);
 
+namespace internal {
+
+/* The storage of a ScopedExpressionArena. It is shared by the scope and by the
+ cells allocated in it, so that it outlives both. */
+class CellArena {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CellArena)
+
+  explicit CellArena(bool share_subexpressions);
+
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /* Returns a recorded cell that is structurally identical to @p cell if there
+   is one, or else records @p cell and returns it. Cells are identical if they
+   are of the same kind and their values (for constants and variables), or
+   subexpression cells and coefficients, are identical. Returns @p cell if
+   sharing is disabled. */
+  std::shared_ptr<ExpressionCell> Intern(std::shared_ptr<ExpressionCell> cell);
+
+  /* Returns the recorded expansion of @p e, or nullptr. */
+  const Expression* FindExpansion(const Expression& e);
+
+  /* Records @p expansion as the expansion of @p e, if sharing is enabled. */
+  void AddExpansion(const Expression& e, const Expression& expansion);
+
+  /* Forgets the recorded cells and expansions. This breaks the cycles between
+   the recorded cells and the arena, which they keep alive. */
+  void Clear();
+
+  int64_t num_allocated_bytes() const { return num_allocated_bytes_; }
+  int64_t num_shared_subexpressions() const {
+    return num_shared_subexpressions_;
+  }
+
+ private:
+  static const ExpressionCell* cell(const Expression& e) {
+    return e.ptr_.get();
+  }
+  static std::size_t ShallowHash(const ExpressionCell& c);
+  static bool ShallowEqual(const ExpressionCell& a, const ExpressionCell& b);
+
+  const bool share_subexpressions_{};
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* next_{nullptr};
+  std::size_t remaining_{0};
+  int64_t num_allocated_bytes_{0};
+  int64_t num_shared_subexpressions_{0};
+  std::unordered_multimap<std::size_t, std::shared_ptr<ExpressionCell>> cells_;
+  // Maps the cell of an expression to the expression (which keeps the cell
+  // alive, so that its address is not reused) and its expansion.
+  std::unordered_map<const ExpressionCell*, std::pair<Expression, Expression>>
+      expansions_;
+};
+
+}  // namespace internal
 }  // namespace symbolic
 }  // namespace drake
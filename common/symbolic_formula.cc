@@ -15,7 +15,7 @@
 namespace drake {
 namespace symbolic {
 
-using std::make_shared;
+using internal::MakeCell;
 using std::numeric_limits;
 using std::ostream;
 using std::ostringstream;
@@ -31,7 +31,7 @@ Formula::Formula(std::shared_ptr<const FormulaCell> ptr)
     : ptr_{std::move(ptr)} {}
 
 Formula::Formula(const Variable& var)
-    : ptr_{make_shared<const FormulaVar>(var)} {}
+    : ptr_{MakeCell<const FormulaVar>(var)} {}
 
 FormulaKind Formula::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -112,16 +112,16 @@ string Formula::to_string() const {
 }
 
 Formula Formula::True() {
-  static Formula tt{make_shared<const FormulaTrue>()};
+  static Formula tt{std::make_shared<const FormulaTrue>()};
   return tt;
 }
 Formula Formula::False() {
-  static Formula ff{make_shared<const FormulaFalse>()};
+  static Formula ff{std::make_shared<const FormulaFalse>()};
   return ff;
 }
 
 Formula forall(const Variables& vars, const Formula& f) {
-  return Formula{make_shared<const FormulaForall>(vars, f)};
+  return Formula{MakeCell<const FormulaForall>(vars, f)};
 }
 
 Formula make_conjunction(const set<Formula>& formulas) {
@@ -155,7 +155,7 @@ Formula make_conjunction(const set<Formula>& formulas) {
     return *(operands.begin());
   }
   // TODO(soonho-tri): Returns False if both f and ¬f appear in operands.
-  return Formula{make_shared<const FormulaAnd>(operands)};
+  return Formula{MakeCell<const FormulaAnd>(operands)};
 }
 
 Formula operator&&(const Formula& f1, const Formula& f2) {
@@ -203,7 +203,7 @@ Formula make_disjunction(const set<Formula>& formulas) {
     return *(operands.begin());
   }
   // TODO(soonho-tri): Returns True if both f and ¬f appear in operands.
-  return Formula{make_shared<const FormulaOr>(operands)};
+  return Formula{MakeCell<const FormulaOr>(operands)};
 }
 
 Formula operator||(const Formula& f1, const Formula& f2) {
@@ -230,7 +230,7 @@ Formula operator!(const Formula& f) {
   if (is_negation(f)) {
     return get_operand(f);
   }
-  return Formula{make_shared<const FormulaNot>(f)};
+  return Formula{MakeCell<const FormulaNot>(f)};
 }
 
 Formula operator!(const Variable& v) { return !Formula(v); }
@@ -246,7 +246,7 @@ Formula operator==(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() == 0.0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaEq>(e1, e2)};
+  return Formula{MakeCell<const FormulaEq>(e1, e2)};
 }
 
 Formula operator!=(const Expression& e1, const Expression& e2) {
@@ -255,7 +255,7 @@ Formula operator!=(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() != 0.0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaNeq>(e1, e2)};
+  return Formula{MakeCell<const FormulaNeq>(e1, e2)};
 }
 
 Formula operator<(const Expression& e1, const Expression& e2) {
@@ -264,7 +264,7 @@ Formula operator<(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() < 0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaLt>(e1, e2)};
+  return Formula{MakeCell<const FormulaLt>(e1, e2)};
 }
 
 Formula operator<=(const Expression& e1, const Expression& e2) {
@@ -273,7 +273,7 @@ Formula operator<=(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() <= 0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaLeq>(e1, e2)};
+  return Formula{MakeCell<const FormulaLeq>(e1, e2)};
 }
 
 Formula operator>(const Expression& e1, const Expression& e2) {
@@ -282,7 +282,7 @@ Formula operator>(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() > 0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaGt>(e1, e2)};
+  return Formula{MakeCell<const FormulaGt>(e1, e2)};
 }
 
 Formula operator>=(const Expression& e1, const Expression& e2) {
@@ -291,11 +291,11 @@ Formula operator>=(const Expression& e1, const Expression& e2) {
   if (diff.get_kind() == ExpressionKind::Constant) {
     return diff.Evaluate() >= 0 ? Formula::True() : Formula::False();
   }
-  return Formula{make_shared<const FormulaGeq>(e1, e2)};
+  return Formula{MakeCell<const FormulaGeq>(e1, e2)};
 }
 
 Formula isnan(const Expression& e) {
-  return Formula{make_shared<const FormulaIsnan>(e)};
+  return Formula{MakeCell<const FormulaIsnan>(e)};
 }
 
 Formula isinf(const Expression& e) {
@@ -309,17 +309,17 @@ Formula isfinite(const Expression& e) {
 }
 
 Formula positive_semidefinite(const Eigen::Ref<const MatrixX<Expression>>& m) {
-  return Formula{make_shared<const FormulaPositiveSemidefinite>(m)};
+  return Formula{MakeCell<const FormulaPositiveSemidefinite>(m)};
 }
 
 Formula positive_semidefinite(const MatrixX<Expression>& m,
                               const Eigen::UpLoType mode) {
   switch (mode) {
     case Eigen::Lower:
-      return Formula{make_shared<const FormulaPositiveSemidefinite>(
+      return Formula{MakeCell<const FormulaPositiveSemidefinite>(
           m.triangularView<Eigen::Lower>())};
     case Eigen::Upper:
-      return Formula{make_shared<const FormulaPositiveSemidefinite>(
+      return Formula{MakeCell<const FormulaPositiveSemidefinite>(
           m.triangularView<Eigen::Upper>())};
     default:
       throw std::runtime_error(
@@ -1,4 +1,5 @@
 // NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
+#include <iterator>
 #include <map>
 #include <numeric>
 #include <stdexcept>
@@ -225,14 +226,18 @@ Expression Monomial::ToExpression() const {
 }
 
 Monomial& Monomial::operator*=(const Monomial& m) {
+  // Both maps are sorted, so that they can be merged in linear time.
+  auto it = powers_.begin();
   for (const auto& p : m.get_powers()) {
     const Variable& var{p.first};
     const int exponent{p.second};
-    auto it = powers_.find(var);
-    if (it == powers_.end()) {
-      powers_.insert(p);
-    } else {
+    while (it != powers_.end() && it->first.less(var)) {
+      ++it;
+    }
+    if (it != powers_.end() && it->first.equal_to(var)) {
       it->second += exponent;
+    } else {
+      it = std::next(powers_.emplace_hint(it, p));
     }
     total_degree_ += exponent;
   }
@@ -4,7 +4,9 @@
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/symbolic.h"
 #define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
@@ -52,6 +54,78 @@ void DoAddProduct(const Expression& coeff, const Monomial& m,
     map->emplace_hint(it, m, coeff);
   }
 }
+
+// A monomial packed as the ids of its variables, in increasing order, and
+// their exponents. Unlike Monomial, its product does not allocate (once the
+// storage is large enough), and it is cheap to hash and to compare.
+using PackedMonomial = std::vector<std::pair<Variable::Id, int>>;
+
+struct PackedMonomialHash {
+  size_t operator()(const PackedMonomial& m) const noexcept {
+    DefaultHasher hasher;
+    for (const auto& power : m) {
+      hash_append(hasher, power.first);
+      hash_append(hasher, power.second);
+    }
+    return static_cast<size_t>(hasher);
+  }
+};
+
+// Sets *product to m1 * m2.
+void MultiplyPackedMonomials(const PackedMonomial& m1, const PackedMonomial& m2,
+                             PackedMonomial* product) {
+  product->clear();
+  auto it1 = m1.begin();
+  auto it2 = m2.begin();
+  while (it1 != m1.end() && it2 != m2.end()) {
+    if (it1->first < it2->first) {
+      product->push_back(*it1++);
+    } else if (it2->first < it1->first) {
+      product->push_back(*it2++);
+    } else {
+      product->emplace_back(it1->first, it1->second + it2->second);
+      ++it1;
+      ++it2;
+    }
+  }
+  product->insert(product->end(), it1, m1.end());
+  product->insert(product->end(), it2, m2.end());
+}
+
+// A term of a polynomial, with a packed monomial.
+struct PackedTerm {
+  PackedMonomial monomial;
+  const Expression* coeff{};
+  // Whether coeff is a constant, and if so its value.
+  bool is_constant{};
+  double constant{};
+};
+
+std::vector<PackedTerm> PackTerms(const Polynomial::MapType& map) {
+  std::vector<PackedTerm> terms(map.size());
+  auto term = terms.begin();
+  for (const auto& item : map) {
+    // The powers of a Monomial are sorted by variable, i.e., by id.
+    for (const auto& power : item.first.get_powers()) {
+      term->monomial.emplace_back(power.first.get_id(), power.second);
+    }
+    term->coeff = &item.second;
+    term->is_constant = is_constant(item.second);
+    if (term->is_constant) {
+      term->constant = get_constant_value(item.second);
+    }
+    ++term;
+  }
+  return terms;
+}
+
+// The sum of the coefficients of a monomial in a product of polynomials,
+// split into its constant and its symbolic parts.
+struct CoefficientSum {
+  double constant{0.0};
+  ExpressionAddFactory symbolic;
+};
+
 // Visitor class to implement `Polynomial(const Expression& e, const
 // Variables& indeterminates)` constructor which decomposes an expression e
 // w.r.t. indeterminates.
@@ -550,13 +624,54 @@ Polynomial& Polynomial::operator*=(const Polynomial& p) {
   // (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * (c₂₁ * m₂₁ + ... + c₂ₘ * m₂ₘ)
   // = (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂₁ * m₂₁ + ... +
   //   (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂ₘ * m₂ₘ
+  //
+  // The n * m products of the terms are accumulated with packed monomials
+  // (see PackedMonomial) and with double coefficients whenever possible, so
+  // that the cost of creating a Monomial and summing symbolic coefficients is
+  // only paid once per distinct monomial of the result.
+  const std::vector<PackedTerm> terms1{
+      PackTerms(monomial_to_coefficient_map_)};
+  const std::vector<PackedTerm> terms2{
+      PackTerms(p.monomial_to_coefficient_map_)};
+  std::unordered_map<PackedMonomial, CoefficientSum, PackedMonomialHash> sums;
+  PackedMonomial product;
+  for (const PackedTerm& term1 : terms1) {
+    for (const PackedTerm& term2 : terms2) {
+      MultiplyPackedMonomials(term1.monomial, term2.monomial, &product);
+      CoefficientSum& sum = sums[product];
+      if (term1.is_constant && term2.is_constant) {
+        sum.constant += term1.constant * term2.constant;
+      } else {
+        sum.symbolic.AddExpression(*term1.coeff * *term2.coeff);
+      }
+    }
+  }
+
+  // Unpack the monomials, using the variables of the factors.
+  std::unordered_map<Variable::Id, Variable> variables;
+  auto add_variables = [&variables](const MapType& map) {
+    for (const auto& item : map) {
+      for (const auto& power : item.first.get_powers()) {
+        variables.emplace(power.first.get_id(), power.first);
+      }
+    }
+  };
+  add_variables(monomial_to_coefficient_map_);
+  add_variables(p.monomial_to_coefficient_map_);
   MapType new_map{};
-  for (const auto& p1 : monomial_to_coefficient_map_) {
-    for (const auto& p2 : p.monomial_to_coefficient_map()) {
-      const Monomial new_monomial{p1.first * p2.first};
-      const Expression new_coeff{p1.second * p2.second};
-      DoAddProduct(new_coeff, new_monomial, &new_map);
+  for (const auto& item : sums) {
+    const Expression coeff{item.second.symbolic.GetExpression() +
+                           item.second.constant};
+    // See DoAddProduct() for why the expansion is needed.
+    if (is_zero(coeff) || is_zero(coeff.Expand())) {
+      continue;
+    }
+    std::map<Variable, int> powers;
+    for (const auto& power : item.first) {
+      powers.emplace_hint(powers.end(), variables.at(power.first),
+                          power.second);
     }
+    new_map.emplace(Monomial{powers}, coeff);
   }
   monomial_to_coefficient_map_ = std::move(new_map);
   DRAKE_ASSERT_VOID(CheckInvariant());
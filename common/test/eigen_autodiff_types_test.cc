@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 
 namespace drake {
 namespace {
@@ -15,5 +16,29 @@ GTEST_TEST(EigenAutodiffTypesTest, CheckingInheritance) {
   bool res = std::is_base_of<ScalarLimits, ADLimits>::value;
   EXPECT_TRUE(res);
 }
+
+GTEST_TEST(EigenAutodiffTypesTest, AutoDiffUpTod) {
+  using AD = AutoDiffUpTod<4>;
+  static_assert(sizeof(AD) > 4 * sizeof(double),
+                "The partials should be stored inline.");
+
+  // The number of partials is chosen at runtime.
+  const AD x(2.0, 3, 0);
+  const AD y(5.0, 3, 1);
+  const double c = 4.0;
+  AD result;
+  {
+    test::LimitMalloc guard;
+    // Combine the variables with each other and with constants, whose
+    // partials are empty.
+    result = x * y + sin(x) / c - AD(c) * sqrt(y);
+  }
+  EXPECT_DOUBLE_EQ(result.value(), 10 + std::sin(2.0) / 4 - 4 * std::sqrt(5));
+  ASSERT_EQ(result.derivatives().size(), 3);
+  EXPECT_DOUBLE_EQ(result.derivatives()(0), 5 + std::cos(2.0) / 4);
+  EXPECT_DOUBLE_EQ(result.derivatives()(1), 2 - 2 / std::sqrt(5));
+  EXPECT_EQ(result.derivatives()(2), 0);
+}
+
 }  // namespace
 }  // namespace drake
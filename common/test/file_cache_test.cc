@@ -0,0 +1,93 @@
+#include "drake/common/file_cache.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+void WriteFile(const std::string& path, const std::string& contents) {
+  std::ofstream file(path);
+  ASSERT_TRUE(file.is_open());
+  file << contents;
+}
+
+GTEST_TEST(FileCacheTest, ReloadsChangedFiles) {
+  using Cache = FileCache<const std::string>;
+  const std::string path = temp_directory() + "/file_cache_test.txt";
+  WriteFile(path, "one");
+
+  int num_loads = 0;
+  auto load = [&num_loads, &path]() {
+    ++num_loads;
+    std::ifstream file(path);
+    return std::make_shared<const std::string>(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+  };
+
+  // The value is loaded once, and then shared.
+  const std::shared_ptr<const std::string> first = Cache::GetOrLoad(path, load);
+  EXPECT_EQ(*first, "one");
+  EXPECT_EQ(Cache::GetOrLoad(path, load), first);
+  EXPECT_EQ(num_loads, 1);
+
+  // Different keys for the same file have their own entries.
+  EXPECT_EQ(*Cache::GetOrLoad(path, path + "#other", load), "one");
+  EXPECT_EQ(num_loads, 2);
+
+  // A changed file is loaded again. (Its size changes, so that the test
+  // doesn't depend on the resolution of the modification time.)
+  WriteFile(path, "three");
+  const std::shared_ptr<const std::string> second =
+      Cache::GetOrLoad(path, load);
+  EXPECT_EQ(*second, "three");
+  EXPECT_EQ(num_loads, 3);
+  EXPECT_EQ(*first, "one");
+
+  // Clearing the cache forces the file to be loaded again.
+  Cache::Clear();
+  EXPECT_EQ(*Cache::GetOrLoad(path, load), "three");
+  EXPECT_EQ(num_loads, 4);
+}
+
+GTEST_TEST(FileCacheTest, NotCached) {
+  using Cache = FileCache<int>;
+  int num_loads = 0;
+
+  // Missing files aren't cached.
+  const std::string missing = temp_directory() + "/no_such_file.txt";
+  auto load = [&num_loads]() {
+    ++num_loads;
+    return std::make_shared<int>(num_loads);
+  };
+  EXPECT_EQ(*Cache::GetOrLoad(missing, load), 1);
+  EXPECT_EQ(*Cache::GetOrLoad(missing, load), 2);
+
+  // Neither are null values, nor exceptions.
+  const std::string path = temp_directory() + "/file_cache_test_null.txt";
+  WriteFile(path, "");
+  auto load_null = [&num_loads]() {
+    ++num_loads;
+    return std::shared_ptr<int>();
+  };
+  EXPECT_EQ(Cache::GetOrLoad(path, load_null), nullptr);
+  EXPECT_EQ(Cache::GetOrLoad(path, load_null), nullptr);
+  EXPECT_EQ(num_loads, 4);
+  EXPECT_THROW(Cache::GetOrLoad(path,
+                                []() -> std::shared_ptr<int> {
+                                  throw std::runtime_error("error");
+                                }),
+               std::runtime_error);
+  EXPECT_EQ(*Cache::GetOrLoad(path, load), 5);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
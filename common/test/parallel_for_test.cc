@@ -0,0 +1,70 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace {
+
+// Every index is visited exactly once, for any number of threads.
+GTEST_TEST(StaticParallelForIndexLoopTest, VisitsEveryIndexOnce) {
+  for (int num_threads : {1, 2, 3, 8, 100}) {
+    std::vector<std::atomic<int>> visits(37);
+    for (auto& visit : visits) visit = 0;
+    StaticParallelForIndexLoop(num_threads, 0, 37, [&](int, int i) {
+      ++visits[i];
+    });
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit, 1);
+    }
+  }
+}
+
+// Concatenating per-thread buffers in thread order reproduces the serial
+// ordering, and thread_num stays within bounds.
+GTEST_TEST(StaticParallelForIndexLoopTest, DeterministicOrder) {
+  const int begin = 5;
+  const int end = 48;
+  std::vector<int> expected(end - begin);
+  std::iota(expected.begin(), expected.end(), begin);
+  for (int num_threads : {1, 2, 4, 7}) {
+    std::vector<std::vector<int>> buffers(num_threads);
+    StaticParallelForIndexLoop(num_threads, begin, end,
+                               [&](int thread_num, int i) {
+      ASSERT_GE(thread_num, 0);
+      ASSERT_LT(thread_num, num_threads);
+      buffers[thread_num].push_back(i);
+    });
+    std::vector<int> merged;
+    for (const auto& buffer : buffers) {
+      merged.insert(merged.end(), buffer.begin(), buffer.end());
+    }
+    EXPECT_EQ(merged, expected);
+  }
+}
+
+GTEST_TEST(StaticParallelForIndexLoopTest, EmptyRange) {
+  int count = 0;
+  StaticParallelForIndexLoop(4, 3, 3, [&](int, int) { ++count; });
+  StaticParallelForIndexLoop(4, 3, 1, [&](int, int) { ++count; });
+  EXPECT_EQ(count, 0);
+}
+
+GTEST_TEST(StaticParallelForIndexLoopTest, Errors) {
+  EXPECT_THROW(StaticParallelForIndexLoop(0, 0, 10, [](int, int) {}),
+               std::exception);
+  EXPECT_THROW(StaticParallelForIndexLoop(3, 0, 10,
+                                          [](int, int i) {
+                                            if (i == 7) {
+                                              throw std::runtime_error("7");
+                                            }
+                                          }),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace drake
@@ -29,5 +29,73 @@ GTEST_TEST(RandomTest, Seed) {
   }
 }
 
+// Compares with the known answer of the reference implementation (Random123),
+// for a zero key and counter.
+GTEST_TEST(CounterBasedRandomTest, KnownAnswer) {
+  CounterBasedRandomGenerator dut(0);
+  EXPECT_EQ(dut(), 0x6627e8d5u);
+  EXPECT_EQ(dut(), 0xe169c58du);
+  EXPECT_EQ(dut(), 0xbc57ac4cu);
+  EXPECT_EQ(dut(), 0x9b00dbd8u);
+}
+
+GTEST_TEST(CounterBasedRandomTest, Discard) {
+  for (int skip : {0, 1, 3, 4, 5, 17, 1000}) {
+    CounterBasedRandomGenerator oracle(42, 7);
+    CounterBasedRandomGenerator dut(42, 7);
+    // Starts from the middle of a block.
+    oracle();
+    dut();
+    for (int i = 0; i < skip; ++i) oracle();
+    dut.discard(skip);
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(dut(), oracle());
+    }
+  }
+}
+
+GTEST_TEST(CounterBasedRandomTest, Streams) {
+  CounterBasedRandomGenerator dut1(42, 0);
+  CounterBasedRandomGenerator dut2(42, 1);
+  CounterBasedRandomGenerator dut3(43, 0);
+  EXPECT_EQ(dut2.stream(), 1u);
+  int num_equal = 0;
+  for (int i = 0; i < 100; ++i) {
+    const auto value = dut1();
+    num_equal += (value == dut2()) + (value == dut3());
+  }
+  EXPECT_EQ(num_equal, 0);
+}
+
+// Checks the sample moments of the distributions, and that the samples are
+// reproducible.
+GTEST_TEST(CounterBasedRandomTest, Fill) {
+  const int kNumSamples = 100001;
+  Eigen::VectorXd samples(kNumSamples);
+
+  CounterBasedRandomGenerator dut(1);
+  dut.FillUniform(samples);
+  EXPECT_GE(samples.minCoeff(), 0.0);
+  EXPECT_LT(samples.maxCoeff(), 1.0);
+  EXPECT_NEAR(samples.mean(), 0.5, 0.01);
+  EXPECT_NEAR((samples.array() - 0.5).square().mean(), 1.0 / 12, 0.01);
+
+  dut.FillGaussian(samples);
+  EXPECT_NEAR(samples.mean(), 0.0, 0.02);
+  EXPECT_NEAR(samples.squaredNorm() / kNumSamples, 1.0, 0.02);
+
+  dut.FillExponential(samples);
+  EXPECT_GE(samples.minCoeff(), 0.0);
+  EXPECT_NEAR(samples.mean(), 1.0, 0.02);
+
+  // The same generator gives the same samples, into a segment too.
+  Eigen::VectorXd more_samples = Eigen::VectorXd::Zero(kNumSamples + 2);
+  CounterBasedRandomGenerator same(1);
+  same.FillUniform(more_samples.segment(1, kNumSamples));
+  same.FillGaussian(more_samples.segment(1, kNumSamples));
+  same.FillExponential(more_samples.segment(1, kNumSamples));
+  EXPECT_EQ(more_samples.segment(1, kNumSamples), samples);
+}
+
 }  // namespace
 }  // namespace drake
@@ -0,0 +1,123 @@
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using test::ExprEqual;
+
+class SymbolicArenaTest : public ::testing::Test {
+ protected:
+  // Returns a polynomial expression of x and y with shared subexpressions.
+  Expression Build() const {
+    const Expression sum = x_ + 2 * y_;
+    return pow(sum, 3) * (sum - 1) + sin(x_) * y_;
+  }
+
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Expression x_{var_x_};
+  const Expression y_{var_y_};
+};
+
+TEST_F(SymbolicArenaTest, ExpressionsOutliveTheArena) {
+  const Expression expected = Build();
+  const Expression expected_expansion = expected.Expand();
+  Expression e;
+  Expression expansion;
+  Formula f;
+  {
+    ScopedExpressionArena arena;
+    e = Build();
+    expansion = e.Expand();
+    f = e >= 0 && expansion < 1;
+    EXPECT_GT(arena.num_allocated_bytes(), 0);
+  }
+  EXPECT_PRED2(ExprEqual, e, expected);
+  EXPECT_PRED2(ExprEqual, expansion, expected_expansion);
+  EXPECT_TRUE(f.EqualTo(expected >= 0 && expected_expansion < 1));
+  const Environment env{{var_x_, 0.3}, {var_y_, -0.7}};
+  EXPECT_DOUBLE_EQ(e.Evaluate(env), expected.Evaluate(env));
+  EXPECT_DOUBLE_EQ(expansion.Evaluate(env), expected.Evaluate(env));
+}
+
+TEST_F(SymbolicArenaTest, SharedSubexpressions) {
+  ScopedExpressionArena arena;
+  const Expression e1 = Build();
+  const int64_t num_shared = arena.num_shared_subexpressions();
+  // Building the same expression again shares every cell of the first one.
+  const Expression e2 = Build();
+  EXPECT_GT(arena.num_shared_subexpressions(), num_shared);
+  EXPECT_PRED2(ExprEqual, e1, e2);
+
+  // Expanding the second expression reuses the expansion of the first one.
+  const Expression expansion1 = e1.Expand();
+  const int64_t num_shared_after_expansion = arena.num_shared_subexpressions();
+  const Expression expansion2 = e2.Expand();
+  EXPECT_GT(arena.num_shared_subexpressions(), num_shared_after_expansion);
+  EXPECT_PRED2(ExprEqual, expansion1, expansion2);
+  EXPECT_PRED2(ExprEqual, expansion1, Build().Expand());
+
+  // Substitution works on shared cells.
+  EXPECT_PRED2(ExprEqual, e1.Substitute(var_y_, x_),
+               pow(3 * x_, 3) * (3 * x_ - 1) + sin(x_) * x_);
+}
+
+TEST_F(SymbolicArenaTest, NoSharing) {
+  ScopedExpressionArena arena(false /* share_subexpressions */);
+  const Expression e1 = Build();
+  const Expression e2 = Build();
+  EXPECT_PRED2(ExprEqual, e1.Expand(), e2.Expand());
+  EXPECT_EQ(arena.num_shared_subexpressions(), 0);
+  EXPECT_GT(arena.num_allocated_bytes(), 0);
+}
+
+TEST_F(SymbolicArenaTest, NestedArenas) {
+  ScopedExpressionArena outer;
+  const Expression e1 = Build();
+  const int64_t outer_bytes = outer.num_allocated_bytes();
+  {
+    ScopedExpressionArena inner;
+    const Expression e2 = Build();
+    EXPECT_GT(inner.num_allocated_bytes(), 0);
+    EXPECT_PRED2(ExprEqual, e1, e2);
+  }
+  // The inner arena was used instead of the outer one.
+  EXPECT_EQ(outer.num_allocated_bytes(), outer_bytes);
+  const Expression e3 = x_ * y_ * 7;
+  EXPECT_GT(outer.num_allocated_bytes(), outer_bytes);
+}
+
+// The constants that are shared by all expressions do not come from an arena.
+TEST_F(SymbolicArenaTest, StaticConstants) {
+  Expression zero;
+  {
+    ScopedExpressionArena arena;
+    zero = Expression::Zero();
+    EXPECT_PRED2(ExprEqual, Expression::One() + Expression::E(),
+                 1 + std::exp(1.0));
+  }
+  EXPECT_PRED2(ExprEqual, zero, 0.0);
+  EXPECT_PRED2(ExprEqual, Expression::Pi(), M_PI);
+}
+
+// The expressions built in an arena can be destroyed on another thread.
+TEST_F(SymbolicArenaTest, OtherThread) {
+  auto e = std::make_unique<Expression>();
+  {
+    ScopedExpressionArena arena;
+    *e = Build();
+  }
+  std::thread destroyer([e = std::move(e)]() mutable { e.reset(); });
+  destroyer.join();
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
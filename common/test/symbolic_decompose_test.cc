@@ -133,6 +133,20 @@ TEST_F(SymbolicDecomposeTest, DecomposeAffineExpressionsBlock) {
   EXPECT_EQ(v_expected_static_, v_);
 }
 
+// Checks that the variables which are repeated in `vars`, or don't appear in
+// the expressions, get their coefficients.
+TEST_F(SymbolicDecomposeTest, DecomposeAffineExpressionsRepeatedVariables) {
+  VectorX<Variable> vars(5);
+  vars << x0_, x1_, x2_, x1_, a_;
+  Eigen::MatrixXd M(3, 5);
+  Eigen::Vector3d v;
+  DecomposeAffineExpressions(M_ * x_ + v_, vars, &M, &v);
+  EXPECT_EQ(M.leftCols<3>(), M_);
+  EXPECT_EQ(M.col(3), M_.col(1));
+  EXPECT_EQ(M.col(4), Eigen::Vector3d::Zero());
+  EXPECT_EQ(v, v_);
+}
+
 // Adds quadratic terms to check if we have an exception.
 TEST_F(SymbolicDecomposeTest, DecomposeAffineExpressionsExceptionNonlinear) {
   // clang-format off
@@ -0,0 +1,116 @@
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using std::vector;
+
+class SymbolicEvaluatorTest : public ::testing::Test {
+ protected:
+  // Checks the evaluator of `expressions` against Expression::Evaluate().
+  void CheckEvaluate(const vector<Expression>& expressions,
+                     const Vector3d& values) {
+    const VectorX<Expression> e =
+        Eigen::Map<const VectorX<Expression>>(expressions.data(),
+                                              expressions.size());
+    const ExpressionEvaluator evaluator({var_x_, var_y_, var_z_}, e);
+    EXPECT_EQ(evaluator.num_variables(), 3);
+    EXPECT_EQ(evaluator.num_expressions(), e.size());
+    VectorXd results(e.size());
+    evaluator.Evaluate(values, &results);
+    const Environment env{
+        {var_x_, values(0)}, {var_y_, values(1)}, {var_z_, values(2)}};
+    for (int i = 0; i < e.size(); ++i) {
+      EXPECT_NEAR(results(i), e(i).Evaluate(env), 1e-14) << e(i);
+    }
+  }
+
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Variable var_z_{"z"};
+  const Expression x_{var_x_};
+  const Expression y_{var_y_};
+  const Expression z_{var_z_};
+};
+
+TEST_F(SymbolicEvaluatorTest, MatchesEvaluate) {
+  const vector<Expression> expressions{
+      1.5,
+      x_,
+      3 + 2 * x_ - y_ + x_ * z_,
+      -2 * x_ * pow(y_, 3) * pow(1 + z_ * z_, x_) / (1 + y_ * y_),
+      log(x_) + abs(y_) + exp(z_) + sqrt(x_) + pow(x_, y_),
+      sin(x_) + cos(y_) + tan(z_) + asin(x_ - 0.5) + acos(y_ / 4) +
+          atan(z_),
+      atan2(x_, y_) + sinh(x_) + cosh(y_) + tanh(z_),
+      min(x_, y_) + max(y_, z_) + ceil(z_) + floor(z_),
+      if_then_else(x_ > y_ && !(z_ <= 0), x_, y_),
+      if_then_else(x_ == y_ || x_ != z_ || x_ >= z_ || x_ < z_, 1.0, 2.0),
+  };
+  CheckEvaluate(expressions, Vector3d(0.7, 2.0, -1.3));
+  CheckEvaluate(expressions, Vector3d(1.2, -1.0, 0.4));
+}
+
+TEST_F(SymbolicEvaluatorTest, SharesSubexpressions) {
+  const Expression s = sin(x_ + y_);
+  const ExpressionEvaluator evaluator(
+      {var_x_, var_y_}, Vector3<Expression>(s * s, s + 1, cos(x_ + y_)));
+  // x + y, sin, s * s (a power of a factor), s + 1 and cos.
+  EXPECT_EQ(evaluator.num_instructions(), 5);
+  VectorXd results(3);
+  evaluator.Evaluate(Eigen::Vector2d(0.2, 0.3), &results);
+  EXPECT_NEAR(results(0), std::pow(std::sin(0.5), 2), 1e-15);
+  EXPECT_NEAR(results(1), std::sin(0.5) + 1, 1e-15);
+  EXPECT_NEAR(results(2), std::cos(0.5), 1e-15);
+}
+
+TEST_F(SymbolicEvaluatorTest, Exceptions) {
+  const ExpressionEvaluator evaluator(
+      {var_x_, var_y_}, Vector2<Expression>(log(x_), 1 / y_));
+  VectorXd results(2);
+  evaluator.Evaluate(Eigen::Vector2d(1.0, 2.0), &results);
+  EXPECT_EQ(results(1), 0.5);
+  EXPECT_THROW(evaluator.Evaluate(Eigen::Vector2d(-1.0, 2.0), &results),
+               std::domain_error);
+  EXPECT_THROW(evaluator.Evaluate(Eigen::Vector2d(1.0, 0.0), &results),
+               std::runtime_error);
+
+  // Wrong sizes.
+  EXPECT_THROW(evaluator.Evaluate(Vector3d::Zero(), &results),
+               std::exception);
+  VectorXd wrong_results(3);
+  EXPECT_THROW(evaluator.Evaluate(Eigen::Vector2d(1.0, 2.0), &wrong_results),
+               std::exception);
+
+  // Missing and repeated variables.
+  EXPECT_THROW(ExpressionEvaluator({var_x_}, Vector1<Expression>(x_ + y_)),
+               std::runtime_error);
+  EXPECT_THROW(ExpressionEvaluator({var_x_, var_x_}, Vector1<Expression>(x_)),
+               std::runtime_error);
+}
+
+// The branch that is not taken is ignored, as by Expression::Evaluate().
+TEST_F(SymbolicEvaluatorTest, BranchNotTaken) {
+  const Expression f = uninterpreted_function("f", {x_});
+  const ExpressionEvaluator evaluator(
+      {var_x_}, Vector2<Expression>(if_then_else(x_ > 0, log(x_), -x_),
+                                    if_then_else(x_ > 0, f, x_)));
+  VectorXd results(2);
+  evaluator.Evaluate(Vector1d(-2.0), &results);
+  EXPECT_EQ(results(0), 2.0);
+  EXPECT_EQ(results(1), -2.0);
+  EXPECT_THROW(evaluator.Evaluate(Vector1d(2.0), &results),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
@@ -110,6 +112,27 @@ TEST_F(SymbolicExpressionJacobianTest, Test5) {
   EXPECT_EQ(Jacobian(f, Vector2<Variable>{x_, z_}), expected);
 }
 
+// The Jacobian is the same for any number of threads, including when the
+// elements of f share subexpressions.
+TEST_F(SymbolicExpressionJacobianTest, MultipleThreads) {
+  const Expression s = sin(x_ * y_) * pow(z_, 3);
+  VectorX<Expression> f(5);
+  f << s, s * s, x_ + s, exp(s) * y_, 3.0;
+  const std::vector<Variable> vars{x_, y_, z_};
+  MatrixX<Expression> expected(5, 3);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      expected(i, j) = f(i).Differentiate(vars[j]);
+    }
+  }
+  for (const int num_threads : {1, 2, 4, 32}) {
+    EXPECT_EQ(Jacobian(f, vars, num_threads), expected);
+    EXPECT_EQ(Jacobian(f, Vector3<Variable>{x_, y_, z_}, num_threads),
+              expected);
+  }
+  EXPECT_THROW(Jacobian(f, vars, 0), std::exception);
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -537,6 +537,36 @@ TEST_F(SymbolicExpressionMatrixTest, Inverse) {
                               Substitute(M, subst).inverse(), 1e-10));
 }
 
+// Tests the matrix-wide Expand and Substitute, which give the results of the
+// element-wise ones for any number of threads.
+TEST_F(SymbolicExpressionMatrixTest, ExpandAndSubstituteMatrix) {
+  // The elements share the subexpression `s`.
+  const Expression s = pow(x_ + y_, 3) * (z_ - w_);
+  MatrixX<Expression> M(3, 4);
+  for (int i = 0; i < M.rows(); ++i) {
+    for (int j = 0; j < M.cols(); ++j) {
+      M(i, j) = (i + 1) * s * (x_ - j) + s * s;
+    }
+  }
+  const Substitution subst{{var_x_, y_ + 1.0}, {var_w_, 2.0}};
+  for (const int num_threads : {1, 2, 5, 20}) {
+    const MatrixX<Expression> expanded = Expand(M, num_threads);
+    const MatrixX<Expression> substituted = Substitute(M, subst, num_threads);
+    for (int i = 0; i < M.rows(); ++i) {
+      for (int j = 0; j < M.cols(); ++j) {
+        EXPECT_PRED2(ExprEqual, expanded(i, j), M(i, j).Expand());
+        EXPECT_TRUE(expanded(i, j).is_expanded());
+        EXPECT_PRED2(ExprEqual, substituted(i, j), M(i, j).Substitute(subst));
+      }
+    }
+  }
+  EXPECT_THROW(Expand(M, 0), std::exception);
+  EXPECT_THROW(Substitute(M, subst, 0), std::exception);
+
+  // Empty matrices.
+  EXPECT_EQ(Expand(MatrixX<Expression>(0, 3), 4).cols(), 3);
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -472,6 +472,24 @@ TEST_F(SymbolicPolynomialTest, MultiplicationPolynomialPolynomial2) {
   EXPECT_EQ(product_map_expected, (p1 * p2).monomial_to_coefficient_map());
 }
 
+TEST_F(SymbolicPolynomialTest, MultiplicationPolynomialPolynomial3) {
+  // Products with both constant and symbolic coefficients (in a, b), whose
+  // cross terms in x cancel out: (a + b * x + 2 * y) * (a - b * x + 3 * y).
+  const Polynomial p1(a_ + b_ * x_ + 2 * y_, var_xy_);
+  const Polynomial p2(a_ - b_ * x_ + 3 * y_, var_xy_);
+  const Polynomial product{p1 * p2};
+  EXPECT_PRED2(ExprEqual, product.ToExpression(),
+               ((a_ + b_ * x_ + 2 * y_) * (a_ - b_ * x_ + 3 * y_)).Expand());
+  // The coefficient of x, a * b - a * b, is erased.
+  EXPECT_EQ(product.monomial_to_coefficient_map().count(Monomial(var_x_)), 0);
+  EXPECT_EQ(product.monomial_to_coefficient_map().size(), 5);
+  EXPECT_PRED2(ExprEqual,
+               product.monomial_to_coefficient_map().at(Monomial(var_y_, 2)),
+               6);
+  EXPECT_EQ(product.indeterminates(), var_xy_);
+  EXPECT_EQ(product.decision_variables(), Variables({var_a_, var_b_}));
+}
+
 TEST_F(SymbolicPolynomialTest, Pow) {
   for (int n = 2; n <= 5; ++n) {
     for (const Expression& e : exprs_) {
@@ -0,0 +1,97 @@
+#include "drake/common/trace_span.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+#ifndef DRAKE_ENABLE_TRACING
+#error This test must be compiled with DRAKE_ENABLE_TRACING.
+#endif
+
+namespace drake {
+namespace tracing {
+namespace {
+
+class TraceSpanTest : public ::testing::Test {
+ protected:
+  void SetUp() override { Reset(); }
+  void TearDown() override {
+    SetEnabled(false);
+    Reset();
+  }
+};
+
+void Traced() {
+  DRAKE_TRACE_SPAN("Traced");
+  DRAKE_TRACE_SPAN("Traced \"inner\"");
+}
+
+TEST_F(TraceSpanTest, DisabledByDefault) {
+  EXPECT_FALSE(IsEnabled());
+  Traced();
+  EXPECT_EQ(GetNumRecordedSpans(), 0);
+  EXPECT_EQ(GetChromeTrace(),
+            "{\"traceEvents\": [],\n\"displayTimeUnit\": \"ns\"}\n");
+}
+
+TEST_F(TraceSpanTest, NestedSpans) {
+  SetEnabled(true);
+  EXPECT_TRUE(IsEnabled());
+  Traced();
+  EXPECT_EQ(GetNumRecordedSpans(), 2);
+  EXPECT_EQ(GetNumDroppedSpans(), 0);
+
+  // The inner span ends, and so is recorded, first.
+  const std::string trace = GetChromeTrace();
+  const size_t inner = trace.find("\"name\": \"Traced \\\"inner\\\"\"");
+  const size_t outer = trace.find("\"name\": \"Traced\"");
+  EXPECT_NE(inner, std::string::npos);
+  EXPECT_NE(outer, std::string::npos);
+  EXPECT_LT(inner, outer);
+  EXPECT_NE(trace.find("\"ph\": \"X\""), std::string::npos);
+
+  Reset();
+  EXPECT_EQ(GetNumRecordedSpans(), 0);
+}
+
+TEST_F(TraceSpanTest, Threads) {
+  SetEnabled(true);
+  const int kNumThreads = 4;
+  const int kNumCalls = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < kNumCalls; ++j) Traced();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(GetNumRecordedSpans(), 2 * kNumThreads * kNumCalls);
+
+  // The buffers of the threads that exited are reused, with their spans.
+  std::thread([]() { Traced(); }).join();
+  EXPECT_EQ(GetNumRecordedSpans(), 2 * kNumThreads * kNumCalls + 2);
+}
+
+TEST_F(TraceSpanTest, Dropped) {
+  SetEnabled(true);
+  const int kCapacity = 1 << 18;
+  std::thread([]() {
+    for (int j = 0; j < kCapacity / 2 + 5; ++j) Traced();
+  }).join();
+  EXPECT_EQ(GetNumRecordedSpans(), kCapacity);
+  EXPECT_EQ(GetNumDroppedSpans(), 10);
+}
+
+TEST_F(TraceSpanTest, WriteChromeTrace) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      WriteChromeTrace("/no/such/directory/trace.json"), std::exception,
+      "Cannot open the trace file '/no/such/directory/trace.json'");
+}
+
+}  // namespace
+}  // namespace tracing
+}  // namespace drake
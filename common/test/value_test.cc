@@ -1,5 +1,6 @@
 #include "drake/common/value.h"
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <sstream>
@@ -10,6 +11,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/systems/framework/test_utilities/my_vector.h"
 
 namespace drake {
@@ -349,6 +351,36 @@ GTEST_TEST(ValueTest, SubclassOfValueSurvivesClone) {
   EXPECT_EQ("5,6", printable_erased->print());
 }
 
+// The blocks of freed values are reused by the values allocated next, so that
+// cloning a small value doesn't go to the heap once the pool is warm.
+GTEST_TEST(ValueTest, PooledAllocation) {
+  const Value<int> value(22);
+  const AbstractValue* const first = value.Clone().get();
+  {
+    test::LimitMalloc guard;
+    for (int i = 0; i < 3; ++i) {
+      std::unique_ptr<AbstractValue> cloned = value.Clone();
+      EXPECT_EQ(cloned.get(), first);
+      EXPECT_EQ(cloned->get_value<int>(), 22);
+    }
+  }
+
+  // A subclass of another size has its own blocks.
+  Point point(1, 2);
+  const PrintableValue<Point> printable_value(point);
+  auto printable_clone = printable_value.Clone();
+  auto int_clone = value.Clone();
+  EXPECT_EQ(int_clone.get(), first);
+  EXPECT_EQ(printable_clone->get_value<Point>().x(), 1);
+
+  // Large values are allocated from the heap.
+  using Large = std::array<double, 64>;
+  Large large{};
+  large[63] = 1.5;
+  const Value<Large> large_value(large);
+  EXPECT_EQ(large_value.Clone()->get_value<Large>()[63], 1.5);
+}
+
 // Check that TypeHash is extracting exactly the right strings from
 // __PRETTY_FUNCTION__.
 template <typename T>
@@ -0,0 +1,252 @@
+#include "drake/common/trace_span.h"
+
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace tracing {
+namespace internal {
+
+std::atomic<bool> g_enabled{false};
+
+int64_t NowNanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+namespace {
+
+struct Span {
+  const char* name;
+  int64_t start_ns;
+  int64_t end_ns;
+};
+
+// The spans of one thread, in chunks that are allocated as needed, so that
+// the threads that record few spans use little memory and that the spans are
+// never moved. Only the owning thread writes; the exporting thread reads the
+// first `size` spans, which the writer publishes with a release store.
+class ThreadBuffer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadBuffer)
+
+  static constexpr int kChunkSize = 1 << 12;
+  static constexpr int kNumChunks = 1 << 6;
+
+  explicit ThreadBuffer(int index) : index_(index) {
+    for (auto& chunk : chunks_) chunk.store(nullptr);
+  }
+
+  ~ThreadBuffer() {
+    for (auto& chunk : chunks_) delete[] chunk.load();
+  }
+
+  int index() const { return index_; }
+
+  void Push(const Span& span) {
+    const int64_t i = size_.load(std::memory_order_relaxed);
+    if (i == int64_t{kChunkSize} * kNumChunks) {
+      num_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    std::atomic<Span*>& chunk = chunks_[i / kChunkSize];
+    Span* spans = chunk.load(std::memory_order_relaxed);
+    if (spans == nullptr) {
+      spans = new Span[kChunkSize];
+      chunk.store(spans, std::memory_order_release);
+    }
+    spans[i % kChunkSize] = span;
+    size_.store(i + 1, std::memory_order_release);
+  }
+
+  template <typename Visitor>
+  void ForEach(Visitor visitor) const {
+    const int64_t size = size_.load(std::memory_order_acquire);
+    for (int64_t i = 0; i < size; ++i) {
+      visitor(chunks_[i / kChunkSize].load(
+          std::memory_order_acquire)[i % kChunkSize]);
+    }
+  }
+
+  int64_t size() const { return size_.load(std::memory_order_acquire); }
+  int64_t num_dropped() const {
+    return num_dropped_.load(std::memory_order_relaxed);
+  }
+
+  void Clear() {
+    size_.store(0);
+    num_dropped_.store(0);
+  }
+
+ private:
+  const int index_;
+  std::array<std::atomic<Span*>, kNumChunks> chunks_;
+  std::atomic<int64_t> size_{0};
+  std::atomic<int64_t> num_dropped_{0};
+};
+
+// All of the buffers that were ever created. The buffer of a thread that
+// exits is kept (with its spans) for the next thread that starts recording,
+// so that the programs that start many short-lived threads use a bounded
+// number of buffers.
+class Registry {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Registry)
+
+  Registry() = default;
+
+  ThreadBuffer* Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!released_.empty()) {
+      ThreadBuffer* buffer = released_.back();
+      released_.pop_back();
+      return buffer;
+    }
+    const int index = static_cast<int>(buffers_.size());
+    buffers_.push_back(std::make_unique<ThreadBuffer>(index));
+    return buffers_.back().get();
+  }
+
+  void Release(ThreadBuffer* buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_.push_back(buffer);
+  }
+
+  template <typename Visitor>
+  void ForEach(Visitor visitor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) visitor(buffer.get());
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  std::vector<ThreadBuffer*> released_;
+};
+
+Registry& registry() {
+  static never_destroyed<Registry> global;
+  return global.access();
+}
+
+// Owns the buffer of the calling thread until the thread exits.
+class ThreadBufferHandle {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadBufferHandle)
+
+  ThreadBufferHandle() : buffer_(registry().Acquire()) {}
+  ~ThreadBufferHandle() { registry().Release(buffer_); }
+
+  ThreadBuffer* get() const { return buffer_; }
+
+ private:
+  ThreadBuffer* const buffer_;
+};
+
+std::string JsonString(const char* text) {
+  std::string quoted = "\"";
+  for (const char* c = text; *c != '\0'; ++c) {
+    switch (*c) {
+      case '"': quoted += "\\\""; break;
+      case '\\': quoted += "\\\\"; break;
+      case '\n': quoted += "\\n"; break;
+      case '\t': quoted += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(*c) < 0x20) {
+          quoted += fmt::format("\\u{:04x}", static_cast<int>(*c));
+        } else {
+          quoted += *c;
+        }
+    }
+  }
+  return quoted + "\"";
+}
+
+}  // namespace
+
+void RecordSpan(const char* name, int64_t start_ns, int64_t end_ns) {
+  thread_local ThreadBufferHandle handle;
+  handle.get()->Push(Span{name, start_ns, end_ns});
+}
+
+}  // namespace internal
+
+void SetEnabled(bool enabled) {
+  internal::g_enabled.store(enabled);
+}
+
+bool IsEnabled() {
+  return internal::g_enabled.load();
+}
+
+void Reset() {
+  internal::registry().ForEach(
+      [](internal::ThreadBuffer* buffer) { buffer->Clear(); });
+}
+
+int64_t GetNumRecordedSpans() {
+  int64_t result = 0;
+  internal::registry().ForEach([&result](internal::ThreadBuffer* buffer) {
+    result += buffer->size();
+  });
+  return result;
+}
+
+int64_t GetNumDroppedSpans() {
+  int64_t result = 0;
+  internal::registry().ForEach([&result](internal::ThreadBuffer* buffer) {
+    result += buffer->num_dropped();
+  });
+  return result;
+}
+
+std::string GetChromeTrace() {
+  std::string result = "{\"traceEvents\": [";
+  bool first = true;
+  internal::registry().ForEach([&](internal::ThreadBuffer* buffer) {
+    buffer->ForEach([&](const internal::Span& span) {
+      result += fmt::format(
+          "{}\n  {{\"name\": {}, \"cat\": \"drake\", \"ph\": \"X\", "
+          "\"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 0, \"tid\": {}}}",
+          first ? "" : ",", internal::JsonString(span.name),
+          span.start_ns * 1e-3, (span.end_ns - span.start_ns) * 1e-3,
+          buffer->index());
+      first = false;
+    });
+  });
+  result += "],\n\"displayTimeUnit\": \"ns\"}\n";
+  return result;
+}
+
+void WriteChromeTrace(const std::string& filename) {
+  std::ofstream file(filename);
+  if (!file) {
+    throw std::runtime_error(
+        fmt::format("Cannot open the trace file '{}'", filename));
+  }
+  file << GetChromeTrace();
+  if (!file) {
+    throw std::runtime_error(
+        fmt::format("Cannot write the trace file '{}'", filename));
+  }
+  const int64_t num_dropped = GetNumDroppedSpans();
+  if (num_dropped > 0) {
+    drake::log()->warn("The trace {} is missing {} dropped spans", filename,
+                       num_dropped);
+  }
+  drake::log()->info("Wrote the trace {}", filename);
+}
+
+}  // namespace tracing
+}  // namespace drake
@@ -0,0 +1,121 @@
+#pragma once
+
+/** @file
+Declares DRAKE_TRACE_SPAN, which records the wall-clock time spent in a scope
+into a process-wide trace, and the functions that control and export the
+trace in the Chrome trace format (as loaded by `chrome://tracing` and
+Perfetto).
+
+For example,
+<pre>
+  void Foo::Step() {
+    DRAKE_TRACE_SPAN("Foo::Step");
+    ...
+  }
+
+  drake::tracing::SetEnabled(true);
+  foo.Step();
+  drake::tracing::WriteChromeTrace("/tmp/trace.json");
+</pre>
+
+The spans are only compiled in the builds that define DRAKE_ENABLE_TRACING
+(e.g., with `bazel build --define=WITH_TRACING=ON`); otherwise the macro
+compiles to nothing, so that it costs nothing in the hot paths that it
+instruments. Even when compiled in, the spans are only recorded after
+SetEnabled(true); a span costs a relaxed atomic load while disabled, and two
+reads of the clock and a store into a buffer owned by the calling thread
+(without locks) while enabled.
+
+Each thread records up to 2^18 spans (and drops the next ones, see
+GetNumDroppedSpans()) until Reset() is called.
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace tracing {
+
+/** Sets whether the spans are recorded; they are not by default. This has no
+effect in the builds without DRAKE_ENABLE_TRACING. */
+void SetEnabled(bool enabled);
+
+/** Returns true iff the spans are recorded. */
+bool IsEnabled();
+
+/** Forgets all of the spans recorded so far.
+@pre No span is being recorded concurrently. */
+void Reset();
+
+/** Returns the number of spans recorded since the last Reset(). */
+int64_t GetNumRecordedSpans();
+
+/** Returns the number of spans that were not recorded since the last Reset()
+because the buffer of their thread was full. */
+int64_t GetNumDroppedSpans();
+
+/** Returns the spans recorded so far as Trace Event JSON, with one row per
+thread and times in microseconds. The spans that are still being recorded
+concurrently may be missing. */
+std::string GetChromeTrace();
+
+/** Writes GetChromeTrace() into the file @p filename, and logs its name.
+@throws std::exception if the file cannot be written. */
+void WriteChromeTrace(const std::string& filename);
+
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+
+extern std::atomic<bool> g_enabled;
+
+// Returns the time in nanoseconds of the clock of the spans.
+int64_t NowNanoseconds();
+
+// Records a span of the calling thread.
+void RecordSpan(const char* name, int64_t start_ns, int64_t end_ns);
+
+// Records the span from its construction to its destruction, if tracing was
+// enabled at its construction.
+class ScopedSpan {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedSpan)
+
+  explicit ScopedSpan(const char* name)
+      : name_(g_enabled.load(std::memory_order_relaxed) ? name : nullptr),
+        start_ns_(name_ != nullptr ? NowNanoseconds() : 0) {}
+
+  ~ScopedSpan() {
+    if (name_ != nullptr) {
+      RecordSpan(name_, start_ns_, NowNanoseconds());
+    }
+  }
+
+ private:
+  const char* const name_;
+  const int64_t start_ns_;
+};
+
+}  // namespace internal
+#endif
+
+}  // namespace tracing
+}  // namespace drake
+
+#define DRAKE_TRACE_SPAN_CONCAT_IMPL(a, b) a##b
+#define DRAKE_TRACE_SPAN_CONCAT(a, b) DRAKE_TRACE_SPAN_CONCAT_IMPL(a, b)
+
+/** Records the wall-clock time from this point to the end of the enclosing
+scope as a span named @p name, which must be a string literal, if tracing is
+compiled in and enabled. See trace_span.h. */
+#ifdef DRAKE_ENABLE_TRACING
+#define DRAKE_TRACE_SPAN(name)                                 \
+  const ::drake::tracing::internal::ScopedSpan                 \
+      DRAKE_TRACE_SPAN_CONCAT(drake_trace_span_, __LINE__)(name)
+#else
+#define DRAKE_TRACE_SPAN(name) \
+  do {                         \
+  } while (0)
+#endif
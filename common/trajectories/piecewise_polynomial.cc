@@ -28,6 +28,7 @@ PiecewisePolynomial<T>::PiecewisePolynomial(
           "The polynomial matrix for each segment must have the same number of "
           "columns.");
   }
+  UpdatePackedCoefficients();
 }
 
 template <typename T>
@@ -42,6 +43,7 @@ PiecewisePolynomial<T>::PiecewisePolynomial(
     matrix(0, 0) = polynomials[i];
     polynomials_.push_back(matrix);
   }
+  UpdatePackedCoefficients();
 }
 
 template <typename T>
@@ -65,6 +67,7 @@ PiecewisePolynomial<T>::derivative(int derivative_order) const {
       }
     }
   }
+  ret.UpdatePackedCoefficients();
   return ret;
 }
 
@@ -99,6 +102,7 @@ PiecewisePolynomial<T>::integral(
       }
     }
   }
+  ret.UpdatePackedCoefficients();
   return ret;
 }
 
@@ -113,17 +117,42 @@ double PiecewisePolynomial<T>::scalarValue(double t,
 template <typename T>
 MatrixX<T>
 PiecewisePolynomial<T>::value(double t) const {
-  int segment_index = this->get_segment_index(t);
+  MatrixX<T> ret(rows(), cols());
+  value(t, &ret);
+  return ret;
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::value(double t, EigenPtr<MatrixX<T>> value,
+                                   int* segment_hint) const {
+  DRAKE_THROW_UNLESS(value != nullptr);
+  DRAKE_THROW_UNLESS(value->rows() == rows() && value->cols() == cols());
+  int segment_index{};
+  if (segment_hint == nullptr) {
+    segment_index = this->get_segment_index(t);
+  } else {
+    segment_index = this->get_segment_index(t, *segment_hint);
+    *segment_hint = segment_index;
+  }
   t = std::min(std::max(t, this->start_time()), this->end_time());
-  Eigen::Matrix<double, PolynomialMatrix::RowsAtCompileTime,
-                PolynomialMatrix::ColsAtCompileTime>
-      ret(rows(), cols());
-  for (Eigen::Index row = 0; row < rows(); row++) {
-    for (Eigen::Index col = 0; col < cols(); col++) {
-      ret(row, col) = segmentValueAtGlobalAbscissa(segment_index, t, row, col);
-    }
+  EvaluateSegment(segment_index, t, *value);
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::value(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    EigenPtr<MatrixX<T>> values) const {
+  DRAKE_THROW_UNLESS(values != nullptr);
+  DRAKE_THROW_UNLESS(values->rows() == rows() * cols() &&
+                     values->cols() == times.size());
+  int segment_index = 0;
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    segment_index = this->get_segment_index(times(i), segment_index);
+    const double t =
+        std::min(std::max(times(i), this->start_time()), this->end_time());
+    Eigen::Map<MatrixX<T>> value(values->col(i).data(), rows(), cols());
+    EvaluateSegment(segment_index, t, value);
   }
-  return ret;
 }
 
 template <typename T>
@@ -155,6 +184,7 @@ operator+=(const PiecewisePolynomial<T>& other) {
         "Addition not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += other.polynomials_[i];
+  UpdatePackedCoefficients();
   return *this;
 }
 
@@ -166,6 +196,7 @@ operator-=(const PiecewisePolynomial<T>& other) {
         "Subtraction not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= other.polynomials_[i];
+  UpdatePackedCoefficients();
   return *this;
 }
 
@@ -178,6 +209,7 @@ operator*=(const PiecewisePolynomial<T>& other) {
   for (size_t i = 0; i < polynomials_.size(); i++) {
     polynomials_[i].array() *= other.polynomials_[i].array();
   }
+  UpdatePackedCoefficients();
   return *this;
 }
 
@@ -187,6 +219,7 @@ operator+=(const typename PiecewisePolynomial<
            T>::CoefficientMatrix& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += offset.template cast<PolynomialType>();
+  UpdatePackedCoefficients();
   return *this;
 }
 
@@ -196,6 +229,7 @@ operator-=(const typename PiecewisePolynomial<
            T>::CoefficientMatrix& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= offset.template cast<PolynomialType>();
+  UpdatePackedCoefficients();
   return *this;
 }
 
@@ -297,6 +331,7 @@ void PiecewisePolynomial<T>::ConcatenateInTime(
     breaks = other.breaks();
     polynomials_ = other.polynomials_;
   }
+  UpdatePackedCoefficients();
 }
 
 template <typename T>
@@ -315,6 +350,7 @@ void PiecewisePolynomial<T>::setPolynomialMatrixBlock(
   this->segment_number_range_check(segment_number);
   polynomials_[segment_number].block(row_start, col_start, replacement.rows(),
                                      replacement.cols()) = replacement;
+  UpdatePackedCoefficients();
 }
 
 template <typename T>
@@ -344,6 +380,69 @@ double PiecewisePolynomial<T>::segmentValueAtGlobalAbscissa(
       t - this->start_time(segment_index));
 }
 
+template <typename T>
+void PiecewisePolynomial<T>::EvaluateSegment(
+    int segment_index, double t, Eigen::Ref<MatrixX<T>> value) const {
+  if (packed_segment_offsets_.empty()) {
+    for (Eigen::Index row = 0; row < rows(); row++) {
+      for (Eigen::Index col = 0; col < cols(); col++) {
+        value(row, col) =
+            segmentValueAtGlobalAbscissa(segment_index, t, row, col);
+      }
+    }
+    return;
+  }
+  // Horner's method, on all the elements of the matrix at once.
+  const Eigen::Index num_elements = rows() * cols();
+  const T* const coefficients =
+      packed_coefficients_.data() + packed_segment_offsets_[segment_index];
+  const int degree = (packed_segment_offsets_[segment_index + 1] -
+                      packed_segment_offsets_[segment_index]) /
+                         num_elements - 1;
+  auto coefficient = [&](int power) {
+    return Eigen::Map<const MatrixX<T>>(coefficients + power * num_elements,
+                                        rows(), cols());
+  };
+  const T dt = t - this->breaks()[segment_index];
+  value = coefficient(degree);
+  for (int power = degree - 1; power >= 0; --power) {
+    value = (value.array() * dt + coefficient(power).array()).matrix();
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::UpdatePackedCoefficients() {
+  packed_coefficients_.clear();
+  packed_segment_offsets_.clear();
+  for (const PolynomialMatrix& matrix : polynomials_) {
+    for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+      if (matrix(i).GetVariables().size() > 1) {
+        // Not univariate, the evaluation of the polynomials will throw.
+        return;
+      }
+    }
+  }
+  packed_segment_offsets_.reserve(polynomials_.size() + 1);
+  packed_segment_offsets_.push_back(0);
+  for (const PolynomialMatrix& matrix : polynomials_) {
+    int degree = 0;
+    for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+      degree = std::max(degree, matrix(i).GetDegree());
+    }
+    const int offset = packed_segment_offsets_.back();
+    packed_coefficients_.resize(offset + (degree + 1) * matrix.size(), 0);
+    for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+      const VectorX<T> element_coefficients = matrix(i).GetCoefficients();
+      for (int power = 0; power < element_coefficients.size(); ++power) {
+        packed_coefficients_[offset + power * matrix.size() + i] =
+            element_coefficients(power);
+      }
+    }
+    packed_segment_offsets_.push_back(
+        static_cast<int>(packed_coefficients_.size()));
+  }
+}
+
 template <typename T>
 Eigen::Index PiecewisePolynomial<T>::rows() const {
   if (polynomials_.size() > 0) {
@@ -625,70 +724,141 @@ PiecewisePolynomial<T>::Cubic(
   return PiecewisePolynomial<T>(polynomials, times);
 }
 
-// Sets up the linear system for solving for the cubic piecewise polynomial
-// coefficients.
-// See the header file for more information.
-template <typename T>
-int PiecewisePolynomial<T>::
-    SetupCubicSplineInteriorCoeffsLinearSystem(
-        const std::vector<double>& breaks,
-        const std::vector<CoefficientMatrix>& knots,
-        int row, int col,
-        MatrixX<T>* A,
-        VectorX<T>* b) {
-  const std::vector<double>& times = breaks;
-  const std::vector<CoefficientMatrix>& Y = knots;
-  int N = static_cast<int>(times.size());
+namespace {
 
-  DRAKE_DEMAND(A != nullptr);
-  DRAKE_DEMAND(b != nullptr);
-  DRAKE_DEMAND(A->rows() == 4 * (N - 1));
-  DRAKE_DEMAND(A->cols() == 4 * (N - 1));
-  DRAKE_DEMAND(b->rows() == 4 * (N - 1));
+// Solves the tridiagonal linear system with the sub-diagonal `sub`, diagonal
+// `diag`, and super-diagonal `super` for each row of `x`, which holds the
+// right-hand side on input and the solution on output; column i of `x` is the
+// i-th unknown. `sub[0]` and `super[n - 1]` are ignored. This is the Thomas
+// algorithm, which doesn't pivot: the systems of the cubic splines don't need
+// it.
+template <typename T>
+void SolveTridiagonalLinearSystem(const VectorX<T>& sub, const VectorX<T>& diag,
+                                  const VectorX<T>& super, MatrixX<T>* x) {
+  const int n = diag.size();
+  VectorX<T> super_prime(n);
+  super_prime(0) = super(0) / diag(0);
+  x->col(0) /= diag(0);
+  for (int i = 1; i < n; ++i) {
+    const T denominator = diag(i) - sub(i) * super_prime(i - 1);
+    super_prime(i) = super(i) / denominator;
+    x->col(i) = (x->col(i) - sub(i) * x->col(i - 1)) / denominator;
+  }
+  for (int i = n - 2; i >= 0; --i) {
+    x->col(i) -= super_prime(i) * x->col(i + 1);
+  }
+}
 
-  int row_idx = 0;
-  MatrixX<T>& Aref = *A;
-  VectorX<T>& bref = *b;
+// Same as SolveTridiagonalLinearSystem(), for the cyclic system whose corners
+// are `sub[0]` (row 0, column n - 1) and `super[n - 1]` (row n - 1, column 0),
+// using the Sherman-Morrison formula.
+template <typename T>
+void SolveCyclicTridiagonalLinearSystem(const VectorX<T>& sub,
+                                        const VectorX<T>& diag,
+                                        const VectorX<T>& super,
+                                        MatrixX<T>* x) {
+  const int n = diag.size();
+  DRAKE_DEMAND(n >= 2);
+  if (n == 2) {
+    // The corners overlap the off-diagonals.
+    const T a = diag(0);
+    const T b = super(0) + sub(0);
+    const T c = sub(1) + super(1);
+    const T d = diag(1);
+    const T determinant = a * d - b * c;
+    const VectorX<T> x0 = x->col(0);
+    x->col(0) = (d * x0 - b * x->col(1)) / determinant;
+    x->col(1) = (a * x->col(1) - c * x0) / determinant;
+    return;
+  }
+  // A = B + u v', where B is tridiagonal, u = [gamma, 0, ..., 0, alpha]' and
+  // v = [1, 0, ..., 0, beta / gamma]'.
+  const T alpha = super(n - 1);
+  const T beta = sub(0);
+  const T gamma = -diag(0);
+  VectorX<T> diag_b = diag;
+  diag_b(0) -= gamma;
+  diag_b(n - 1) -= alpha * beta / gamma;
+  SolveTridiagonalLinearSystem(sub, diag_b, super, x);
+  MatrixX<T> z = MatrixX<T>::Zero(1, n);
+  z(0, 0) = gamma;
+  z(0, n - 1) = alpha;
+  SolveTridiagonalLinearSystem(sub, diag_b, super, &z);
+  const T denominator = 1 + z(0, 0) + beta * z(0, n - 1) / gamma;
+  const VectorX<T> factor =
+      (x->col(0) + beta * x->col(n - 1) / gamma) / denominator;
+  for (int i = 0; i < n; ++i) {
+    x->col(i) -= z(0, i) * factor;
+  }
+}
 
+// Makes the cubic spline through `knots` whose second derivatives at the knots
+// are the columns of `knots_ddot` (see
+// SetupCubicSplineInteriorKnotDdotsLinearSystem()).
+template <typename T>
+PiecewisePolynomial<T> MakeCubicFromKnotDdots(
+    const std::vector<double>& breaks, const std::vector<MatrixX<T>>& knots,
+    const MatrixX<T>& knots_ddot) {
+  const int N = static_cast<int>(breaks.size());
+  const int rows = knots.front().rows();
+  const int cols = knots.front().cols();
+  std::vector<MatrixX<Polynomial<T>>> polynomials(N - 1);
   for (int i = 0; i < N - 1; ++i) {
-    double dt = times[i + 1] - times[i];
-
-    // y_i(x_i) = a0i = Y[i]
-    Aref(row_idx, 4 * i) = 1;
-    bref(row_idx++) = Y[i](row, col);
-
-    // y_i(x_{i+1}) = y_{i+1}(x_{i}) =>
-    // a0i + a1i*(x_{i+1} - x_i) + a2i(x_{i+1} - x_i)^2 + a3i(x_{i+1} -
-    // x_i)^3 = a0{i+1}
-    Aref(row_idx, 4 * i + 0) = 1;
-    Aref(row_idx, 4 * i + 1) = dt;
-    Aref(row_idx, 4 * i + 2) = dt * dt;
-    Aref(row_idx, 4 * i + 3) = dt * dt * dt;
-    if (i != N - 2) {
-      Aref(row_idx++, 4 * (i + 1)) = -1;
-    } else {
-      bref(row_idx++) = Y[N - 1](row, col);
+    const double dt = breaks[i + 1] - breaks[i];
+    polynomials[i].resize(rows, cols);
+    for (int k = 0; k < rows * cols; ++k) {
+      const T& ddot0 = knots_ddot(k, i);
+      const T& ddot1 = knots_ddot(k, i + 1);
+      Eigen::Matrix<T, 4, 1> coeffs;
+      coeffs(0) = knots[i](k);
+      coeffs(1) = (knots[i + 1](k) - knots[i](k)) / dt -
+                  dt * (2 * ddot0 + ddot1) / 6;
+      coeffs(2) = ddot0 / 2;
+      coeffs(3) = (ddot1 - ddot0) / (6 * dt);
+      polynomials[i](k) = Polynomial<T>(coeffs);
     }
+  }
+  return PiecewisePolynomial<T>(polynomials, breaks);
+}
 
-    // y_i'(x_{i+1}) = y_{i+1}'(x_{i}) =>
-    // a1i + 2*a2i(x_{i+1} - x_i) + 3*a3i(x_{i+1} - x_i)^2 = a1{i+1}
-    if (i != N - 2) {
-      Aref(row_idx, 4 * i + 1) = 1;
-      Aref(row_idx, 4 * i + 2) = 2 * dt;
-      Aref(row_idx, 4 * i + 3) = 3 * dt * dt;
-      Aref(row_idx++, 4 * (i + 1) + 1) = -1;
-    }
+}  // namespace
 
-    if (i != N - 2) {
-      // y_i''(x_{i+1}) = y_{i+1}''(x_{i}) =>
-      // 2*a2i + 6*a3i(x_{i+1} - x_i) = 2*a2{i+1}
-      Aref(row_idx, 4 * i + 2) = 2;
-      Aref(row_idx, 4 * i + 3) = 6 * dt;
-      Aref(row_idx++, 4 * (i + 1) + 2) = -2;
+// Sets up the tridiagonal linear system for solving for the second
+// derivatives of a cubic spline at the knots.
+// See the header file for more information.
+template <typename T>
+void PiecewisePolynomial<T>::
+    SetupCubicSplineInteriorKnotDdotsLinearSystem(
+        const std::vector<double>& breaks,
+        const std::vector<CoefficientMatrix>& knots,
+        VectorX<T>* sub, VectorX<T>* diag, VectorX<T>* super,
+        MatrixX<T>* rhs) {
+  const std::vector<double>& times = breaks;
+  const std::vector<CoefficientMatrix>& Y = knots;
+  const int N = static_cast<int>(times.size());
+  const int size = Y.front().size();
+
+  DRAKE_DEMAND(sub != nullptr);
+  DRAKE_DEMAND(diag != nullptr);
+  DRAKE_DEMAND(super != nullptr);
+  DRAKE_DEMAND(rhs != nullptr);
+
+  sub->setZero(N);
+  diag->setZero(N);
+  super->setZero(N);
+  rhs->setZero(size, N);
+
+  for (int i = 1; i < N - 1; ++i) {
+    const double dt0 = times[i] - times[i - 1];
+    const double dt1 = times[i + 1] - times[i];
+    (*sub)(i) = dt0;
+    (*diag)(i) = 2 * (dt0 + dt1);
+    (*super)(i) = dt1;
+    for (int k = 0; k < size; ++k) {
+      (*rhs)(k, i) = 6 * ((Y[i + 1](k) - Y[i](k)) / dt1 -
+                          (Y[i](k) - Y[i - 1](k)) / dt0);
     }
   }
-  DRAKE_DEMAND(row_idx == 4 * (N - 1) - 2);
-  return row_idx;
 }
 
 // Makes a cubic piecewise polynomial.
@@ -721,45 +891,30 @@ PiecewisePolynomial<T>::Cubic(
     throw std::runtime_error("Ydot_end and Y dimension mismatch");
   }
 
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
+  // Solves for the second derivatives of every entry of the knots at once.
+  VectorX<T> sub, diag, super;
+  MatrixX<T> x;
+  SetupCubicSplineInteriorKnotDdotsLinearSystem(times, Y, &sub, &diag, &super,
+                                                &x);
+
+  // Endpoints' velocity matches the given ones.
+  const double start_dt = times[1] - times[0];
+  diag(0) = 2 * start_dt;
+  super(0) = start_dt;
+  for (int k = 0; k < rows * cols; ++k) {
+    x(k, 0) = 6 * ((Y[1](k) - Y[0](k)) / start_dt - Ydot_start(k));
   }
 
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
-
-  // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
-
-      // Endpoints' velocity matches the given ones.
-      A(row_idx, 1) = 1;
-      b(row_idx++) = Ydot_start(j, k);
-
-      A(row_idx, 4 * (N - 2) + 1) = 1;
-      A(row_idx, 4 * (N - 2) + 2) = 2 * (times[N - 1] - times[N - 2]);
-      A(row_idx, 4 * (N - 2) + 3) =
-          3 * (times[N - 1] - times[N - 2]) * (times[N - 1] - times[N - 2]);
-      b(row_idx++) = Ydot_end(j, k);
-
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
-
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
-    }
+  const double end_dt = times[N - 1] - times[N - 2];
+  sub(N - 1) = end_dt;
+  diag(N - 1) = 2 * end_dt;
+  for (int k = 0; k < rows * cols; ++k) {
+    x(k, N - 1) = 6 * (Ydot_end(k) - (Y[N - 1](k) - Y[N - 2](k)) / end_dt);
   }
 
-  return PiecewisePolynomial<T>(polynomials, times);
+  SolveTridiagonalLinearSystem(sub, diag, super, &x);
+
+  return MakeCubicFromKnotDdots(times, Y, x);
 }
 
 // Makes a cubic piecewise polynomial.
@@ -783,76 +938,71 @@ PiecewisePolynomial<T>::Cubic(
   int rows = Y.front().rows();
   int cols = Y.front().cols();
 
-  std::vector<PolynomialMatrix> polynomials(N - 1);
-  for (int i = 0; i < N - 1; ++i) {
-    polynomials[i].resize(rows, cols);
-  }
-
-  MatrixX<T> A(4 * (N - 1), 4 * (N - 1));
-  VectorX<T> b(4 * (N - 1));
-  VectorX<T> solution;
-
-  A.setZero();
-  b.setZero();
-
-  // Sets up a linear equation to solve for the coefficients.
-  for (int j = 0; j < rows; ++j) {
-    for (int k = 0; k < cols; ++k) {
-      int row_idx =
-          SetupCubicSplineInteriorCoeffsLinearSystem(times, Y, j, k, &A, &b);
-
-      if (periodic_end_condition) {
-        // Time during the last segment.
-        const double end_dt = times[times.size() - 1] - times[times.size() - 2];
-        // Enforce velocity between end-of-last and beginning-of-first segments
-        // is continuous.
-        A(row_idx, 1) = -1;  // Linear term of 1st segment.
-        A(row_idx, 4 * (N - 2) + 1) = 1;  // Linear term of last segment.
-        A(row_idx, 4 * (N - 2) + 2) = 2 * end_dt;  // Squared term of last
-                                                   // segment.
-        A(row_idx, 4 * (N - 2) + 3) = 3 * end_dt * end_dt;  // Cubic term of
-                                                            // last segment.
-        b(row_idx++) = 0;
-
-        // Enforce that acceleration between end-of-last and beginning-of-first
-        // segments is continuous.
-        A(row_idx, 2) = -2;  // Quadratic term of 1st segment.
-        A(row_idx, 4 * (N - 2) + 2) = 2;  // Quadratic term of last segment.
-        A(row_idx, 4 * (N - 2) + 3) = 6 * end_dt;  // Cubic term of last
-                                                   // segment.
-        b(row_idx++) = 0;
-      } else {
-        if (N > 3) {
-          // Ydddot(times[1]) is continuous.
-          A(row_idx, 3) = 1;  // Cubic term of 1st segment.
-          A(row_idx, 4 + 3) = -1;  // Cubic term of 2nd segment.
-          b(row_idx++) = 0;
-
-          // Ydddot(times[N-2]) is continuous.
-          A(row_idx, 4 * (N - 3) + 3) = 1;
-          A(row_idx, 4 * (N - 2) + 3) = -1;
-          b(row_idx++) = 0;
-        } else {
-          // Set Jerk to zero if only have 3 points, becomes a quadratic.
-          A(row_idx, 3) = 1;
-          b(row_idx++) = 0;
-
-          A(row_idx, 4 + 3) = 1;
-          b(row_idx++) = 0;
-        }
-      }
-
-      // TODO(siyuan.feng): Should switch to a sparse solver.
-      solution = A.colPivHouseholderQr().solve(b);
-
-      for (int i = 0; i < N - 1; ++i) {
-        polynomials[i](j, k) =
-            Polynomial<T>(solution.template segment<4>(4 * i));
-      }
+  // Solves for the second derivatives of every entry of the knots at once.
+  VectorX<T> sub, diag, super;
+  MatrixX<T> x;
+  SetupCubicSplineInteriorKnotDdotsLinearSystem(times, Y, &sub, &diag, &super,
+                                                &x);
+
+  // Durations of the first two and of the last two segments.
+  const double dt0 = times[1] - times[0];
+  const double dt1 = times[2] - times[1];
+  const double end_dt0 = times[N - 2] - times[N - 3];
+  const double end_dt1 = times[N - 1] - times[N - 2];
+
+  if (periodic_end_condition) {
+    // The velocity and acceleration are continuous between the end of the
+    // last segment and the beginning of the first, so that the second
+    // derivative at knot N - 1 is the one at knot 0, and knot 0 gets the
+    // equation of an interior knot whose previous segment is the last one.
+    // This makes the system cyclic, over the knots [0, N - 2].
+    sub(0) = end_dt1;
+    diag(0) = 2 * (end_dt1 + dt0);
+    super(0) = dt0;
+    for (int k = 0; k < rows * cols; ++k) {
+      x(k, 0) = 6 * ((Y[1](k) - Y[0](k)) / dt0 -
+                     (Y[N - 1](k) - Y[N - 2](k)) / end_dt1);
     }
+    const VectorX<T> sub_cyclic = sub.head(N - 1);
+    const VectorX<T> diag_cyclic = diag.head(N - 1);
+    const VectorX<T> super_cyclic = super.head(N - 1);
+    MatrixX<T> x_cyclic = x.leftCols(N - 1);
+    SolveCyclicTridiagonalLinearSystem(sub_cyclic, diag_cyclic, super_cyclic,
+                                       &x_cyclic);
+    x.leftCols(N - 1) = x_cyclic;
+    x.col(N - 1) = x.col(0);
+  } else if (N > 3) {
+    // Ydddot(times[1]) and Ydddot(times[N-2]) are continuous, i.e., the second
+    // derivatives at knots 0 and N - 1 are extrapolated linearly from the
+    // next two. Substituting them in the equations of knots 1 and N - 2 leaves
+    // a tridiagonal system over the knots [1, N - 2].
+    diag(1) = dt0 + 2 * dt1;
+    super(1) = dt1 - dt0;
+    x.col(1) *= dt1 / (dt0 + dt1);
+    sub(N - 2) = end_dt0 - end_dt1;
+    diag(N - 2) = end_dt1 + 2 * end_dt0;
+    x.col(N - 2) *= end_dt0 / (end_dt0 + end_dt1);
+
+    const VectorX<T> sub_interior = sub.segment(1, N - 2);
+    const VectorX<T> diag_interior = diag.segment(1, N - 2);
+    const VectorX<T> super_interior = super.segment(1, N - 2);
+    MatrixX<T> x_interior = x.middleCols(1, N - 2);
+    SolveTridiagonalLinearSystem(sub_interior, diag_interior, super_interior,
+                                 &x_interior);
+    x.middleCols(1, N - 2) = x_interior;
+    x.col(0) = ((dt0 + dt1) * x.col(1) - dt0 * x.col(2)) / dt1;
+    x.col(N - 1) =
+        ((end_dt0 + end_dt1) * x.col(N - 2) - end_dt1 * x.col(N - 3)) /
+        end_dt0;
+  } else {
+    // Set Jerk to zero if only have 3 points, becomes a quadratic, whose
+    // second derivative is the same at all of the knots.
+    x.col(1) /= 3 * (dt0 + dt1);
+    x.col(0) = x.col(1);
+    x.col(2) = x.col(1);
   }
 
-  return PiecewisePolynomial<T>(polynomials, times);
+  return MakeCubicFromKnotDdots(times, Y, x);
 }
 
 namespace {
@@ -89,6 +89,7 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
       : PiecewiseTrajectory<T>(std::vector<double>(
             {0.0, std::numeric_limits<double>::infinity()})) {
     polynomials_.push_back(constant_value.template cast<PolynomialType>());
+    UpdatePackedCoefficients();
   }
 
   /**
@@ -482,6 +483,40 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
    */
   MatrixX<T> value(double t) const override;
 
+  /**
+   * Evaluates the %PiecewisePolynomial at the given time t into `value`,
+   * without allocating memory. Equivalent to `*value = this->value(t)`.
+   *
+   * @param t The time at which to evaluate the %PiecewisePolynomial.
+   * @param value The matrix of evaluated values, which must have the size
+   *        rows() x cols().
+   * @param segment_hint If not null, on input a guess of the index of the
+   *        segment that contains t (e.g., the one of the previous call), and
+   *        on output the index of that segment. When the evaluation times are
+   *        increasing, this finds the segment in constant time rather than by
+   *        a binary search; see PiecewiseTrajectory::get_segment_index().
+   * @throws std::runtime_error if `value` is null or has the wrong size.
+   * @warning See warnings in value().
+   */
+  void value(double t, EigenPtr<MatrixX<T>> value,
+             int* segment_hint = nullptr) const;
+
+  /**
+   * Evaluates the %PiecewisePolynomial at each of the given `times`, into the
+   * columns of `values`: column i is `value(times(i))`, flattened in
+   * column-major order. It is faster than evaluating each time separately,
+   * in particular for sorted times, for which the segments are found in
+   * linear time overall.
+   *
+   * @param times The times at which to evaluate the %PiecewisePolynomial.
+   * @param values The evaluated values, which must have the size
+   *        (rows() * cols()) x times.size().
+   * @throws std::runtime_error if `values` is null or has the wrong size.
+   * @warning See warnings in value().
+   */
+  void value(const Eigen::Ref<const Eigen::VectorXd>& times,
+             EigenPtr<MatrixX<T>> values) const;
+
   /**
    * Gets the matrix of Polynomials corresponding to the given segment index.
    * @warning `segment_index` is not checked for validity.
@@ -652,11 +687,29 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   double segmentValueAtGlobalAbscissa(int segment_index, double t,
                                       Eigen::Index row, Eigen::Index col) const;
 
+  // Evaluates the matrix of polynomials of the given segment at the time t,
+  // using packed_coefficients_.
+  void EvaluateSegment(int segment_index, double t,
+                       Eigen::Ref<MatrixX<T>> value) const;
+
+  // Updates packed_coefficients_ from polynomials_. It must be called after
+  // every change of polynomials_.
+  void UpdatePackedCoefficients();
+
   static constexpr T kSlopeEpsilon = 1e-10;
 
   // a PolynomialMatrix for each piece (segment).
   std::vector<PolynomialMatrix> polynomials_;
 
+  // The coefficients of polynomials_, stored contiguously for a fast
+  // evaluation. The coefficients of the segment i start at
+  // packed_segment_offsets_[i], and consist of the matrices of the
+  // coefficients of each power (up to the maximum degree of the segment) in
+  // increasing order, each one in column-major order. They are empty if a
+  // polynomial is not univariate.
+  std::vector<T> packed_coefficients_;
+  std::vector<int> packed_segment_offsets_;
+
   // Computes coeffecients for a cubic spline given the value and first
   // derivatives at the end points.
   // Throws std::runtime_error
@@ -678,22 +731,25 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   // ' means time derivative, and duration_i = breaks[i+1] - breaks[i] is the
   // duration for the ith segment.
   //
-  // At this point, we have 2 * (N - 1) position constraints:
-  // Pi(0) = knots[i], for i in [0, N - 2]
-  // Pi(duration_i) = knots[i+1], for i in [0, N - 2]
-  // N - 2 velocity constraints for the interior points:
-  // Pi'(duration_i) = Pi+1'(0), for i in [0, N - 3]
-  // N - 2 acceleration constraints for the interior points:
-  // Pi''(duration_i) = Pi+1''(0), for i in [0, N - 3]
-  //
-  // These sum up to 4 * (N - 1) - 2. This function sets up the above
-  // constraints. There are still 2 constraints missing, which can be resolved
-  // by various end point conditions (velocity at the end points /
-  // "not-a-knot" / etc). These will be specified by the callers.
-  static int SetupCubicSplineInteriorCoeffsLinearSystem(
+  // We solve for the unknown second derivatives M_i at the knots instead of
+  // the coefficients: with Pi = knots[i] + (d_i - h_i (2 M_i + M_{i+1}) / 6) t
+  // + M_i / 2 t^2 + (M_{i+1} - M_i) / (6 h_i) t^3, where h_i = duration_i and
+  // d_i = (knots[i+1] - knots[i]) / h_i, the segments interpolate the knots
+  // and have continuous second derivatives, and the continuity of the first
+  // derivative at the interior knot i is the tridiagonal equation
+  //   h_{i-1} M_{i-1} + 2 (h_{i-1} + h_i) M_i + h_i M_{i+1}
+  //     = 6 (d_i - d_{i-1}).
+  // This function sets up these N - 2 equations as rows [1, N - 2] of a
+  // tridiagonal system with the sub-diagonal `sub`, diagonal `diag`, and
+  // super-diagonal `super` (of size N each), and the right-hand side `rhs`,
+  // whose column i holds the equation of every entry of the knots (in
+  // column-major order). Rows 0 and N - 1 are left to the callers, which set
+  // them from various end point conditions (velocity at the end points /
+  // "not-a-knot" / etc).
+  static void SetupCubicSplineInteriorKnotDdotsLinearSystem(
       const std::vector<double>& breaks,
-      const std::vector<CoefficientMatrix>& knots, int row, int col,
-      MatrixX<T>* A, VectorX<T>* b);
+      const std::vector<CoefficientMatrix>& knots, VectorX<T>* sub,
+      VectorX<T>* diag, VectorX<T>* super, MatrixX<T>* rhs);
 
   // Computes the first derivative at the end point using a non-centered,
   // shape-preserving three-point formulae.
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "drake/common/drake_throw.h"
 #include "drake/math/quaternion.h"
 
 namespace drake {
@@ -122,18 +123,38 @@ double PiecewiseQuaternionSlerp<T>::ComputeInterpTime(int segment_index,
 }
 
 template <typename T>
-Quaternion<T> PiecewiseQuaternionSlerp<T>::orientation(double t) const {
-  int segment_index = this->get_segment_index(t);
-  t = ComputeInterpTime(segment_index, t);
+Quaternion<T> PiecewiseQuaternionSlerp<T>::InterpolateSegment(
+    int segment_index, double time) const {
+  const double s = ComputeInterpTime(segment_index, time);
 
-  Quaternion<T> q1 = quaternions_.at(segment_index)
-                              .slerp(t, quaternions_.at(segment_index + 1));
+  Quaternion<T> q1 = quaternions_[segment_index].slerp(
+      s, quaternions_[segment_index + 1]);
 
   q1.normalize();
 
   return q1;
 }
 
+template <typename T>
+Quaternion<T> PiecewiseQuaternionSlerp<T>::orientation(double t) const {
+  return InterpolateSegment(this->get_segment_index(t), t);
+}
+
+template <typename T>
+void PiecewiseQuaternionSlerp<T>::orientation(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    EigenPtr<MatrixX<T>> quaternions) const {
+  DRAKE_THROW_UNLESS(quaternions != nullptr);
+  DRAKE_THROW_UNLESS(quaternions->rows() == 4 &&
+                     quaternions->cols() == times.size());
+  int segment_index = 0;
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    segment_index = this->get_segment_index(times(i), segment_index);
+    const Quaternion<T> q = InterpolateSegment(segment_index, times(i));
+    quaternions->col(i) << q.w(), q.vec();
+  }
+}
+
 template <typename T>
 Vector3<T> PiecewiseQuaternionSlerp<T>::angular_velocity(double t) const {
   int segment_index = this->get_segment_index(t);
@@ -141,6 +162,20 @@ Vector3<T> PiecewiseQuaternionSlerp<T>::angular_velocity(double t) const {
   return angular_velocities_.at(segment_index);
 }
 
+template <typename T>
+void PiecewiseQuaternionSlerp<T>::angular_velocity(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    EigenPtr<MatrixX<T>> angular_velocities) const {
+  DRAKE_THROW_UNLESS(angular_velocities != nullptr);
+  DRAKE_THROW_UNLESS(angular_velocities->rows() == 3 &&
+                     angular_velocities->cols() == times.size());
+  int segment_index = 0;
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    segment_index = this->get_segment_index(times(i), segment_index);
+    angular_velocities->col(i) = angular_velocities_[segment_index];
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> PiecewiseQuaternionSlerp<T>::MakeDerivative(
     int) const {
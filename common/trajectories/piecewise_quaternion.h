@@ -81,6 +81,18 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
    */
   Quaternion<T> orientation(double t) const;
 
+  /**
+   * Interpolates orientation at each of the given `times`, into the columns
+   * of `quaternions`: column i is `orientation(times(i))`, as (w, x, y, z).
+   * This is faster than repeated calls to orientation(double), in particular
+   * for sorted times, for which the segments are found in constant time.
+   * @param times The times for interpolation.
+   * @param quaternions The preallocated output, of size 4 x times.size().
+   * @throws std::exception if `quaternions` is null or has the wrong size.
+   */
+  void orientation(const Eigen::Ref<const Eigen::VectorXd>& times,
+                   EigenPtr<MatrixX<T>> quaternions) const;
+
   MatrixX<T> value(double t) const override { return orientation(t).matrix(); }
 
   /**
@@ -91,6 +103,19 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
    */
   Vector3<T> angular_velocity(double t) const;
 
+  /**
+   * Interpolates angular velocity at each of the given `times`, into the
+   * columns of `angular_velocities`, as orientation(times, quaternions) does
+   * for the orientation.
+   * @param times The times for interpolation.
+   * @param angular_velocities The preallocated output, of size
+   * 3 x times.size().
+   * @throws std::exception if `angular_velocities` is null or has the wrong
+   * size.
+   */
+  void angular_velocity(const Eigen::Ref<const Eigen::VectorXd>& times,
+                        EigenPtr<MatrixX<T>> angular_velocities) const;
+
   /**
    * @throws std::runtime_error (always) because it is not implemented yet.
    */
@@ -139,6 +164,9 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
   // Computes the interpolation time within each segment. Result is in [0, 1].
   double ComputeInterpTime(int segment_index, double time) const;
 
+  // Interpolates the orientation within the segment `segment_index`.
+  Quaternion<T> InterpolateSegment(int segment_index, double time) const;
+
   std::vector<Quaternion<T>> quaternions_;
   std::vector<Vector3<T>> angular_velocities_;
 };
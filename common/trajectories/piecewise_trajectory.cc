@@ -83,6 +83,48 @@ int PiecewiseTrajectory<T>::get_segment_index(double t) const {
   if (breaks_.empty()) return 0;
   // clip to min/max times
   t = std::min(std::max(t, start_time()), end_time());
+  // Guesses the segment as if the breaks were uniformly spaced, which finds
+  // the segment in constant time (up to round-off, which the search from the
+  // guess corrects) for uniform breaks.
+  const int num_segments = get_number_of_segments();
+  const double fraction = (t - start_time()) / (end_time() - start_time());
+  const int guess = std::min(static_cast<int>(fraction * num_segments),
+                             num_segments - 1);
+  return GetSegmentIndexFromHint(t, guess);
+}
+
+template <typename T>
+int PiecewiseTrajectory<T>::get_segment_index(double t,
+                                              int segment_hint) const {
+  if (breaks_.empty() || segment_hint < 0 ||
+      segment_hint >= get_number_of_segments()) {
+    return get_segment_index(t);
+  }
+  // clip to min/max times
+  t = std::min(std::max(t, start_time()), end_time());
+  return GetSegmentIndexFromHint(t, segment_hint);
+}
+
+template <typename T>
+int PiecewiseTrajectory<T>::GetSegmentIndexFromHint(double t,
+                                                    int segment_hint) const {
+  const int last_segment = get_number_of_segments() - 1;
+  int segment = segment_hint;
+  // The segment i contains [breaks_[i], breaks_[i + 1]), and the last segment
+  // also contains its end time, as in GetSegmentIndexRecursive().
+  for (int num_steps = 0; num_steps < 2; ++num_steps) {
+    if (t < breaks_[segment]) {
+      --segment;
+    } else if (t >= breaks_[segment + 1] && segment < last_segment) {
+      ++segment;
+    } else {
+      return segment;
+    }
+  }
+  if (breaks_[segment] <= t &&
+      (t < breaks_[segment + 1] || segment == last_segment)) {
+    return segment;
+  }
   return GetSegmentIndexRecursive(t, 0, static_cast<int>(breaks_.size() - 1));
 }
 
@@ -45,8 +45,23 @@ class PiecewiseTrajectory : public Trajectory<T> {
    */
   bool is_time_in_range(double t) const;
 
+  /**
+   * Returns the index of the segment that contains `t`, clipped to
+   * [start_time(), end_time()]. The search starts from the segment `t` would
+   * be in if the breaks were uniformly spaced, so that it takes constant time
+   * for uniform breaks, and falls back to a binary search otherwise.
+   */
   int get_segment_index(double t) const;
 
+  /**
+   * Same as get_segment_index(t), but starts the search from the segment
+   * `segment_hint` (e.g., the segment of a previous query), and only falls
+   * back to a binary search if t is not in that segment or one of its
+   * neighbors. A sequence of increasing times thus takes constant time per
+   * query. An out-of-range `segment_hint` is ignored.
+   */
+  int get_segment_index(double t, int segment_hint) const;
+
   const std::vector<double>& get_segment_times() const;
 
   void segment_number_range_check(int segment_number) const;
@@ -71,6 +86,9 @@ class PiecewiseTrajectory : public Trajectory<T> {
 
  private:
   int GetSegmentIndexRecursive(double time, int start, int end) const;
+  // Searches the segment of the (clipped) time `t` from the valid
+  // `segment_hint` and its neighbors, and then by bisection.
+  int GetSegmentIndexFromHint(double t, int segment_hint) const;
 
   std::vector<double> breaks_;
 };
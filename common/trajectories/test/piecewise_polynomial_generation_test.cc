@@ -503,6 +503,66 @@ GTEST_TEST(SplineTests, CubicSplineSize2) {
   EXPECT_THROW(PiecewisePolynomial<double>::Cubic(T, Y), std::runtime_error);
 }
 
+// Checks the end conditions of Cubic(T, Y, periodic_end_condition), down to
+// the smallest number of breaks.
+GTEST_TEST(SplineTests, CubicSplineEndConditions) {
+  default_random_engine generator(123);
+  const int rows = 2;
+  const int cols = 3;
+  for (int N : {3, 4, 5, 30}) {
+    std::vector<double> T =
+        PiecewiseTrajectory<double>::RandomSegmentTimes(N - 1, generator);
+    std::vector<MatrixX<double>> Y(N);
+    for (int i = 0; i < N; ++i) Y[i] = MatrixX<double>::Random(rows, cols);
+
+    const PiecewisePolynomial<double> not_a_knot =
+        PiecewisePolynomial<double>::Cubic(T, Y, false);
+    EXPECT_TRUE(CheckContinuity(not_a_knot, 1e-8, 2));
+    EXPECT_TRUE(CheckValues(not_a_knot, {Y}, 1e-8));
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        auto jerk = [&](int segment) {
+          return not_a_knot.getPolynomial(segment, i, j).GetCoefficients()(3);
+        };
+        if (N > 3) {
+          EXPECT_NEAR(jerk(0), jerk(1), 1e-8);
+          EXPECT_NEAR(jerk(N - 3), jerk(N - 2), 1e-8);
+        } else {
+          EXPECT_NEAR(jerk(0), 0, 1e-8);
+          EXPECT_NEAR(jerk(1), 0, 1e-8);
+        }
+      }
+    }
+
+    const PiecewisePolynomial<double> periodic =
+        PiecewisePolynomial<double>::Cubic(T, Y, true);
+    EXPECT_TRUE(CheckContinuity(periodic, 1e-8, 2));
+    EXPECT_TRUE(CheckValues(periodic, {Y}, 1e-8));
+    for (int d : {1, 2}) {
+      const PiecewisePolynomial<double> derivative = periodic.derivative(d);
+      EXPECT_TRUE(CompareMatrices(derivative.value(T.front()),
+                                  derivative.value(T.back()), 1e-8,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
+// Checks a cubic spline with many breaks, which is only practical with a
+// solver that is linear in the number of breaks.
+GTEST_TEST(SplineTests, CubicSplineManyBreaks) {
+  default_random_engine generator(123);
+  const int N = 5000;
+  std::vector<double> T =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(N - 1, generator);
+  std::vector<MatrixX<double>> Y(N);
+  for (int i = 0; i < N; ++i) Y[i] = MatrixX<double>::Random(3, 1);
+
+  const PiecewisePolynomial<double> spline =
+      PiecewisePolynomial<double>::Cubic(T, Y);
+  EXPECT_TRUE(CheckContinuity(spline, 1e-8, 2));
+  EXPECT_TRUE(CheckValues(spline, {Y}, 1e-8));
+}
+
 // Test that the Eigen API methods return the same results as the std::vector
 // versions.
 GTEST_TEST(SplineTests, EigenTest) {
@@ -203,6 +203,82 @@ void testValueOutsideOfRange() {
                               1e-10, MatrixCompareType::absolute));
 }
 
+// Checks the values of `piecewise` obtained with every evaluation method,
+// against the evaluation of each polynomial.
+void CheckValues(const PiecewisePolynomial<double>& piecewise,
+                 const Eigen::VectorXd& times) {
+  const int rows = piecewise.rows();
+  const int cols = piecewise.cols();
+  Eigen::MatrixXd values(rows * cols, times.size());
+  piecewise.value(times, &values);
+  Eigen::MatrixXd value(rows, cols);
+  int segment_hint = 0;
+  for (int i = 0; i < times.size(); ++i) {
+    const double t = std::min(std::max(times(i), piecewise.start_time()),
+                              piecewise.end_time());
+    const int segment = piecewise.get_segment_index(t);
+    Eigen::MatrixXd expected(rows, cols);
+    for (int row = 0; row < rows; ++row) {
+      for (int col = 0; col < cols; ++col) {
+        expected(row, col) =
+            piecewise.getPolynomial(segment, row, col)
+                .EvaluateUnivariate(t - piecewise.start_time(segment));
+      }
+    }
+    const double tol = 1e-10;
+    EXPECT_TRUE(CompareMatrices(piecewise.value(times(i)), expected, tol));
+    piecewise.value(times(i), &value);
+    EXPECT_TRUE(CompareMatrices(value, expected, tol));
+    piecewise.value(times(i), &value, &segment_hint);
+    EXPECT_EQ(segment_hint, segment);
+    EXPECT_TRUE(CompareMatrices(value, expected, tol));
+    EXPECT_TRUE(CompareMatrices(
+        Eigen::Map<const Eigen::MatrixXd>(values.col(i).data(), rows, cols),
+        expected, tol));
+  }
+}
+
+GTEST_TEST(testPiecewisePolynomial, ValueIntoStorage) {
+  default_random_engine generator;
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(6, generator);
+  PiecewisePolynomial<double> piecewise =
+      test::MakeRandomPiecewisePolynomial<double>(3, 4, 5, segment_times);
+
+  // Increasing times, including times out of range.
+  const Eigen::VectorXd sorted_times = Eigen::VectorXd::LinSpaced(
+      100, piecewise.start_time() - 0.5, piecewise.end_time() + 0.5);
+  CheckValues(piecewise, sorted_times);
+  // Times in any order, including the breaks.
+  Eigen::VectorXd times(segment_times.size() + 2);
+  for (int i = 0; i < static_cast<int>(segment_times.size()); ++i) {
+    times(i) = segment_times[segment_times.size() - 1 - i];
+  }
+  times.tail(2) << segment_times[3], piecewise.start_time() + 1e-3;
+  CheckValues(piecewise, times);
+
+  // The coefficients are kept up to date by the mutators.
+  CheckValues(piecewise.derivative(2), sorted_times);
+  CheckValues(piecewise.integral(), sorted_times);
+  piecewise += piecewise.derivative();
+  CheckValues(piecewise, sorted_times);
+  piecewise.setPolynomialMatrixBlock(
+      PiecewisePolynomial<double>::PolynomialMatrix::Constant(
+          2, 2, Polynomial<double>(Eigen::Vector3d(1, 2, 3))),
+      1);
+  CheckValues(piecewise, sorted_times);
+  PiecewisePolynomial<double> shifted = piecewise;
+  shifted.shiftRight(piecewise.end_time() - piecewise.start_time());
+  piecewise.ConcatenateInTime(shifted);
+  CheckValues(piecewise, sorted_times);
+
+  // The storage must have the right size.
+  Eigen::MatrixXd bad_value(4, 3);
+  EXPECT_THROW(piecewise.value(0.0, &bad_value), std::runtime_error);
+  Eigen::MatrixXd bad_values(12, sorted_times.size() + 1);
+  EXPECT_THROW(piecewise.value(sorted_times, &bad_values), std::runtime_error);
+}
+
 // Test the generation of cubic splines with first and second derivatives
 // continuous between the end of the last segment and the beginning of the
 // first.
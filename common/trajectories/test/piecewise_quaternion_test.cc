@@ -169,6 +169,43 @@ GTEST_TEST(TestPiecewiseQuaternionSlerp,
       MatrixCompareType::absolute));
 }
 
+// Tests the evaluation at many times at once against the evaluation at each
+// time, for sorted and unsorted times.
+GTEST_TEST(TestPiecewiseQuaternionSlerp, TestBatchedEvaluation) {
+  std::default_random_engine generator(123);
+  const int N = 100;
+  std::vector<double> time =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(N - 1, generator);
+  std::vector<Quaternion<double>> quat =
+      GenerateRandomQuaternions<double>(N, &generator);
+  PiecewiseQuaternionSlerp<double> rot_spline(time, quat);
+
+  const int num_times = 500;
+  Eigen::VectorXd sorted_times = Eigen::VectorXd::LinSpaced(
+      num_times, time.front() - 0.1, time.back() + 0.1);
+  Eigen::VectorXd unsorted_times = sorted_times.reverse();
+  std::swap(unsorted_times(3), unsorted_times(400));
+  for (const Eigen::VectorXd& times : {sorted_times, unsorted_times}) {
+    Eigen::MatrixXd quaternions(4, num_times);
+    Eigen::MatrixXd angular_velocities(3, num_times);
+    rot_spline.orientation(times, &quaternions);
+    rot_spline.angular_velocity(times, &angular_velocities);
+    for (int i = 0; i < num_times; ++i) {
+      const Quaternion<double> q = rot_spline.orientation(times(i));
+      EXPECT_TRUE(CompareMatrices(quaternions.col(i),
+                                  Eigen::Vector4d(q.w(), q.x(), q.y(), q.z())));
+      EXPECT_TRUE(CompareMatrices(angular_velocities.col(i),
+                                  rot_spline.angular_velocity(times(i))));
+    }
+  }
+
+  Eigen::MatrixXd wrong_size(3, num_times);
+  EXPECT_THROW(rot_spline.orientation(sorted_times, &wrong_size),
+               std::exception);
+  EXPECT_THROW(rot_spline.angular_velocity(sorted_times.head(3), &wrong_size),
+               std::exception);
+}
+
 GTEST_TEST(TestPiecewiseQuaternionSlerp, TestIsApprox) {
   std::vector<double> time = {0, 1.6};
   std::vector<double> ang = {-1.3, 1};
@@ -66,16 +66,26 @@ void TestPiecewiseTrajectoryTimeRelatedGetters(
       const double t_minus_eps = time[i] - 1e-10;
       idx = traj.get_segment_index(t_minus_eps);
       EXPECT_EQ(idx, i - 1);
+      EXPECT_EQ(traj.get_segment_index(t_minus_eps, i - 1), i - 1);
+      EXPECT_EQ(traj.get_segment_index(t_minus_eps, i), i - 1);
       EXPECT_TRUE(traj.start_time(idx) < t_minus_eps);
     }
   }
 
   // Dense sample the time, and make sure the returned index is valid.
+  int previous_idx = -1;
   for (double t = time.front() - 0.1; t < time.back() + 0.1; t += 0.01) {
     const int idx = traj.get_segment_index(t);
     EXPECT_GE(idx, 0);
     EXPECT_LT(idx, traj.get_number_of_segments());
 
+    // Starting the search from any segment gives the same index.
+    EXPECT_EQ(traj.get_segment_index(t, previous_idx), idx);
+    EXPECT_EQ(traj.get_segment_index(t, 0), idx);
+    EXPECT_EQ(
+        traj.get_segment_index(t, traj.get_number_of_segments() - 1), idx);
+    previous_idx = idx;
+
     if (t >= traj.start_time() && t <= traj.end_time()) {
       EXPECT_TRUE(t >= traj.start_time(idx));
       EXPECT_TRUE(t <= traj.end_time(idx));
@@ -102,6 +112,19 @@ GTEST_TEST(PiecewiseTrajectoryTest, GetIndexTest) {
   TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
 }
 
+// Uniform breaks, for which the segments are found without a search (with
+// round-off errors in the breaks, as is typical).
+GTEST_TEST(PiecewiseTrajectoryTest, UniformGetIndexTest) {
+  std::vector<double> time;
+  for (int i = 0; i <= 1000; ++i) {
+    time.push_back(0.3 + 0.01 * i);
+  }
+
+  PiecewiseTrajectoryTester traj(time);
+
+  TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
+}
+
 }  // namespace
 }  // namespace trajectories
 }  // namespace drake
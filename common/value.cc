@@ -1,6 +1,9 @@
 #include "drake/common/value.h"
 
 #include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
 
 #include <fmt/format.h>
 
@@ -33,6 +36,98 @@ int ReportZeroHash(const std::type_info& detail) {
 }
 }  // namespace internal
 
+namespace {
+
+// The blocks of up to kMaxPooledSize bytes are pooled in size classes that are
+// multiples of kPoolGranularity bytes, which keeps the alignment of the heap.
+constexpr std::size_t kPoolGranularity = alignof(std::max_align_t);
+constexpr std::size_t kMaxPooledSize = 256;
+constexpr int kNumSizeClasses = kMaxPooledSize / kPoolGranularity;
+
+// The most free blocks of each size class that a pool keeps, beyond which the
+// freed blocks are returned to the heap.
+constexpr int kMaxFreeBlocks = 256;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+// The free lists of each size class of a thread. It is trivially destructible
+// so that it remains usable while the objects of the thread (and, for the
+// main thread, the static objects) are destroyed.
+struct ValuePool {
+  FreeBlock* heads[kNumSizeClasses];
+  int counts[kNumSizeClasses];
+  // Whether the thread is exiting, after which blocks are no longer pooled.
+  bool closed;
+};
+
+static_assert(std::is_trivially_destructible<ValuePool>::value,
+              "The pool must outlive the values of its thread.");
+
+thread_local ValuePool g_pool{};
+
+// Returns the free blocks of the thread's pool to the heap when the thread
+// exits.
+class ValuePoolReaper {
+ public:
+  ~ValuePoolReaper() {
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      while (g_pool.heads[i] != nullptr) {
+        FreeBlock* const block = g_pool.heads[i];
+        g_pool.heads[i] = block->next;
+        ::operator delete(block);
+      }
+      g_pool.counts[i] = 0;
+    }
+    g_pool.closed = true;
+  }
+  void Arm() { armed_ = true; }
+
+ private:
+  bool armed_{false};
+};
+
+// Returns the index of the size class of blocks of `size` bytes, whose blocks
+// are (SizeClass(size) + 1) * kPoolGranularity bytes.
+int SizeClass(std::size_t size) {
+  return static_cast<int>((size - 1) / kPoolGranularity);
+}
+
+}  // namespace
+
+void* AbstractValue::operator new(std::size_t size) {
+  if (size == 0 || size > kMaxPooledSize) { return ::operator new(size); }
+  const int size_class = SizeClass(size);
+  FreeBlock* const block = g_pool.heads[size_class];
+  if (block == nullptr) {
+    return ::operator new((size_class + 1) * kPoolGranularity);
+  }
+  g_pool.heads[size_class] = block->next;
+  --g_pool.counts[size_class];
+  return block;
+}
+
+void AbstractValue::operator delete(void* ptr, std::size_t size) {
+  if (ptr == nullptr) { return; }
+  if (size == 0 || size > kMaxPooledSize) {
+    ::operator delete(ptr);
+    return;
+  }
+  const int size_class = SizeClass(size);
+  if (g_pool.closed || g_pool.counts[size_class] >= kMaxFreeBlocks) {
+    ::operator delete(ptr);
+    return;
+  }
+  // The first block pooled by a thread schedules the release of its pool.
+  thread_local ValuePoolReaper reaper;
+  reaper.Arm();
+  FreeBlock* const block = static_cast<FreeBlock*>(ptr);
+  block->next = g_pool.heads[size_class];
+  g_pool.heads[size_class] = block;
+  ++g_pool.counts[size_class];
+}
+
 AbstractValue::~AbstractValue() = default;
 
 std::string AbstractValue::GetNiceTypeName() const {
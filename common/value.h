@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -124,6 +125,14 @@ class AbstractValue {
   /// the typeid of the most-derived type of the contained object.
   std::string GetNiceTypeName() const;
 
+#if !defined(DRAKE_DOXYGEN_CXX)
+  // Values are allocated and freed at high rates (e.g., by every
+  // Context::Clone()), so the blocks of small values are recycled by a pool
+  // per thread instead of being returned to the heap; see value.cc.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+#endif
+
  protected:
 #if !defined(DRAKE_DOXYGEN_CXX)
   // Use a struct argument (instead of a bare size_t) so that no code
@@ -0,0 +1,163 @@
+/// @file
+///
+/// Times the forward dynamics of continuous MultibodyPlant models, comparing
+/// the O(n) articulated body algorithm used by
+/// MultibodyPlant::EvalTimeDerivatives() with the O(n³) solution of the
+/// equations of motion from the mass matrix. The models are serial chains of
+/// increasing length, which expose the scaling of both methods, as well as the
+/// Atlas and Valkyrie humanoids.
+///
+/// Each evaluation sets the generalized positions, so that no cached
+/// configuration-dependent quantity is reused across evaluations.
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+
+DEFINE_string(chain_lengths, "4,8,16,32,64,128",
+              "Comma-separated numbers of links of the serial chains.");
+DEFINE_int32(num_evaluations, 200,
+             "Number of timed evaluations per model and method.");
+
+namespace drake {
+namespace examples {
+namespace multibody {
+namespace forward_dynamics_benchmark {
+namespace {
+
+using drake::multibody::MultibodyForces;
+using drake::multibody::MultibodyPlant;
+using drake::multibody::Parser;
+using drake::multibody::RevoluteJoint;
+using drake::multibody::RigidBody;
+using drake::multibody::RotationalInertia;
+using drake::multibody::SpatialInertia;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+// Makes a chain of `num_links` rods hanging from the world, connected by
+// revolute joints whose axes alternate between x and y.
+std::unique_ptr<MultibodyPlant<double>> MakeChain(int num_links) {
+  auto plant = std::make_unique<MultibodyPlant<double>>();
+  const double kLength = 0.5;
+  const SpatialInertia<double> M_Bo =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          1.0, Vector3d(0, 0, -kLength / 2),
+          RotationalInertia<double>(0.02, 0.02, 0.001));
+  const math::RigidTransformd X_PF(Vector3d(0, 0, -kLength));
+  const drake::multibody::Body<double>* parent = &plant->world_body();
+  for (int i = 0; i < num_links; ++i) {
+    const RigidBody<double>& link =
+        plant->AddRigidBody(fmt::format("link{}", i), M_Bo);
+    plant->AddJoint<RevoluteJoint>(
+        fmt::format("joint{}", i), *parent,
+        i == 0 ? math::RigidTransformd::Identity() : X_PF, link, {},
+        i % 2 == 0 ? Vector3d::UnitX() : Vector3d::UnitY());
+    parent = &link;
+  }
+  plant->Finalize();
+  return plant;
+}
+
+std::unique_ptr<MultibodyPlant<double>> MakeFromFile(
+    const std::string& resource) {
+  auto plant = std::make_unique<MultibodyPlant<double>>();
+  Parser(plant.get()).AddModelFromFile(FindResourceOrThrow(resource));
+  plant->Finalize();
+  return plant;
+}
+
+// Prints the average times of the two methods, and the largest difference
+// between their results.
+void TimeForwardDynamics(const std::string& name,
+                         const MultibodyPlant<double>& plant) {
+  auto context = plant.CreateDefaultContext();
+  if (plant.num_actuators() > 0) {
+    context->FixInputPort(plant.get_actuation_input_port().get_index(),
+                          VectorXd::Zero(plant.num_actuators()));
+  }
+  const int nv = plant.num_velocities();
+  const VectorXd q = plant.GetPositions(*context);
+  plant.SetVelocities(context.get(), VectorXd::LinSpaced(nv, -1.0, 1.0));
+
+  // Returns the average time of `calc` in microseconds.
+  auto time = [&](auto&& calc) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+      plant.SetPositions(context.get(), q);
+      calc();
+    }
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / FLAGS_num_evaluations;
+  };
+
+  VectorXd vdot_articulated_body(nv);
+  const double articulated_body_time = time([&]() {
+    vdot_articulated_body = plant.EvalTimeDerivatives(*context)
+                                .get_generalized_velocity()
+                                .CopyToVector();
+  });
+
+  MatrixXd M(nv, nv);
+  MultibodyForces<double> forces(plant);
+  VectorXd vdot_mass_matrix(nv);
+  const double mass_matrix_time = time([&]() {
+    plant.CalcMassMatrixViaInverseDynamics(*context, &M);
+    plant.CalcForceElementsContribution(*context, &forces);
+    const VectorXd tau_id =
+        plant.CalcInverseDynamics(*context, VectorXd::Zero(nv), forces);
+    vdot_mass_matrix = M.ldlt().solve(-tau_id);
+  });
+
+  std::cout << fmt::format(
+      "{:>12} {:>5} {:>16.2f} {:>16.2f} {:>12.3g}\n", name, nv,
+      articulated_body_time, mass_matrix_time,
+      (vdot_articulated_body - vdot_mass_matrix).lpNorm<Eigen::Infinity>());
+}
+
+int do_main() {
+  std::cout << fmt::format("{:>12} {:>5} {:>16} {:>16} {:>12}\n", "model",
+                           "nv", "ABA [us]", "mass matrix [us]",
+                           "max |dv|");
+  std::stringstream chain_lengths(FLAGS_chain_lengths);
+  std::string length;
+  while (std::getline(chain_lengths, length, ',')) {
+    const int num_links = std::stoi(length);
+    TimeForwardDynamics(fmt::format("chain{}", num_links),
+                        *MakeChain(num_links));
+  }
+  TimeForwardDynamics(
+      "atlas",
+      *MakeFromFile("drake/examples/atlas/urdf/atlas_convex_hull.urdf"));
+  TimeForwardDynamics(
+      "valkyrie",
+      *MakeFromFile("drake/examples/valkyrie/urdf/urdf/"
+                    "valkyrie_A_sim_drake_one_neck_dof_wide_ankle_rom.urdf"));
+  return 0;
+}
+
+}  // namespace
+}  // namespace forward_dynamics_benchmark
+}  // namespace multibody
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the forward dynamics of continuous MultibodyPlant models.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::multibody::forward_dynamics_benchmark::do_main();
+}
@@ -10,6 +10,7 @@
 #include "drake/multibody/tree/revolute_joint.h"
 #include "drake/systems/analysis/implicit_euler_integrator.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/runge_kutta5_integrator.h"
 #include "drake/systems/analysis/semi_explicit_euler_integrator.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -26,6 +27,7 @@ using multibody::MultibodyPlant;
 using multibody::RevoluteJoint;
 using systems::ImplicitEulerIntegrator;
 using systems::RungeKutta3Integrator;
+using systems::RungeKutta5Integrator;
 using systems::SemiExplicitEulerIntegrator;
 
 namespace examples {
@@ -39,7 +41,8 @@ DEFINE_double(target_realtime_rate, 1.0,
 
 DEFINE_string(integration_scheme, "runge_kutta3",
               "Integration scheme to be used. Available options are:"
-              "'runge_kutta3','implicit_euler','semi_explicit_euler'");
+              "'runge_kutta3','runge_kutta5','implicit_euler',"
+              "'semi_explicit_euler'");
 
 int do_main() {
   systems::DiagramBuilder<double> builder;
@@ -106,6 +109,10 @@ int do_main() {
     integrator =
         simulator.reset_integrator<RungeKutta3Integrator<double>>(
             *diagram, &simulator.get_mutable_context());
+  } else if (FLAGS_integration_scheme == "runge_kutta5") {
+    integrator =
+        simulator.reset_integrator<RungeKutta5Integrator<double>>(
+            *diagram, &simulator.get_mutable_context());
   } else if (FLAGS_integration_scheme == "semi_explicit_euler") {
     integrator =
         simulator.reset_integrator<SemiExplicitEulerIntegrator<double>>(
@@ -0,0 +1,224 @@
+/// @file
+///
+/// Times the queries of ProximityEngine on procedurally generated scenes of
+/// increasing numbers of geometries. Each scene is a cubic grid of spheres,
+/// boxes, cylinders and convex meshes, in turn, with random offsets and
+/// orientations, so that some neighbors overlap. The hydroelastic contact
+/// surfaces are timed on a scene of soft spheres and rigid boxes instead (the
+/// only shapes that have a hydroelastic representation), without box-box
+/// pairs.
+///
+/// Before each query, the poses of the geometries are switched between two
+/// sets, as they would change during a simulation, so that no result of the
+/// broadphase is reused. UpdateWorldPoses() is timed on its own.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/proximity_engine.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+DEFINE_string(geometry_counts, "10,100,1000,10000",
+              "Comma-separated numbers of geometries of the scenes.");
+DEFINE_int32(num_evaluations, 20, "Number of timed evaluations per query.");
+DEFINE_double(max_distance, 0.1,
+              "The maximum distance of the pairwise signed distance query.");
+
+namespace drake {
+namespace geometry {
+namespace benchmarking {
+namespace {
+
+using Eigen::Vector3d;
+using internal::ProximityEngine;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+using Poses = std::unordered_map<GeometryId, RigidTransformd>;
+
+// The distance between the centers of neighbouring geometries in the grid; the
+// geometries are about 0.6 wide and are offset by up to 0.2 in each direction.
+constexpr double kSpacing = 1.0;
+
+std::vector<int> ParseCounts(const std::string& list) {
+  std::vector<int> counts;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) counts.push_back(std::stoi(item));
+  return counts;
+}
+
+// A scene: the engine, with its geometries at the first set of poses, and
+// two sets of poses of the geometries.
+struct Scene {
+  ProximityEngine<double> engine;
+  Poses X_WGs[2];
+};
+
+// Makes `count` poses on a cubic grid, each with a random offset and
+// orientation.
+std::vector<RigidTransformd> MakeGridPoses(int count,
+                                           std::mt19937* generator) {
+  std::uniform_real_distribution<double> offset(-0.2, 0.2);
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+  const int size =
+      static_cast<int>(std::ceil(std::cbrt(static_cast<double>(count))));
+  std::vector<RigidTransformd> poses;
+  for (int i = 0; i < count; ++i) {
+    const Vector3d p_WG =
+        kSpacing * Vector3d(i % size, (i / size) % size, i / (size * size)) +
+        Vector3d(offset(*generator), offset(*generator), offset(*generator));
+    poses.emplace_back(RollPitchYawd(angle(*generator), angle(*generator),
+                                     angle(*generator)),
+                       p_WG);
+  }
+  return poses;
+}
+
+// Adds `count` dynamic geometries to the scene, of the shapes made by
+// `make_shape(i)` for the i-th geometry, and returns their ids.
+template <typename MakeShape>
+std::vector<GeometryId> Populate(int count, MakeShape make_shape,
+                                 Scene* scene) {
+  std::mt19937 generator(count);
+  const std::vector<RigidTransformd> poses[2] = {
+      MakeGridPoses(count, &generator), MakeGridPoses(count, &generator)};
+  std::vector<GeometryId> ids;
+  for (int i = 0; i < count; ++i) {
+    const GeometryId id = GeometryId::get_new_id();
+    scene->engine.AddDynamicGeometry(*make_shape(i), id);
+    scene->X_WGs[0][id] = poses[0][i];
+    scene->X_WGs[1][id] = poses[1][i];
+    ids.push_back(id);
+  }
+  scene->engine.UpdateWorldPoses(scene->X_WGs[0]);
+  return ids;
+}
+
+std::unique_ptr<Scene> MakeMixedScene(int count) {
+  const std::string convex_file =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  auto scene = std::make_unique<Scene>();
+  Populate(count, [&convex_file](int i) -> std::unique_ptr<Shape> {
+    switch (i % 4) {
+      case 0: return std::make_unique<Sphere>(0.3);
+      case 1: return std::make_unique<Box>(0.5, 0.4, 0.3);
+      case 2: return std::make_unique<Cylinder>(0.25, 0.6);
+      default: return std::make_unique<Convex>(convex_file, 0.25);
+    }
+  }, scene.get());
+  return scene;
+}
+
+std::unique_ptr<Scene> MakeHydroelasticScene(int count) {
+  auto scene = std::make_unique<Scene>();
+  const std::vector<GeometryId> ids =
+      Populate(count, [](int i) -> std::unique_ptr<Shape> {
+        if (i % 2 == 0) return std::make_unique<Sphere>(0.3);
+        return std::make_unique<Box>(0.5, 0.4, 0.3);
+      }, scene.get());
+  // Rigid boxes can't be in contact with each other.
+  std::unordered_set<GeometryId> boxes;
+  for (size_t i = 1; i < ids.size(); i += 2) boxes.insert(ids[i]);
+  scene->engine.ExcludeCollisionsWithin(boxes, {});
+  return scene;
+}
+
+// Returns the average time of `query` in microseconds, with the poses of the
+// scene switched before each evaluation (untimed), and the average number of
+// its results.
+template <typename Query>
+std::pair<double, double> Time(Scene* scene, Query query) {
+  std::chrono::duration<double, std::micro> elapsed{};
+  size_t num_results = 0;
+  for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+    const Poses& X_WGs = scene->X_WGs[(i + 1) % 2];
+    scene->engine.UpdateWorldPoses(X_WGs);
+    const auto start = std::chrono::steady_clock::now();
+    num_results += query(X_WGs);
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  return {elapsed.count() / FLAGS_num_evaluations,
+          static_cast<double>(num_results) / FLAGS_num_evaluations};
+}
+
+void Print(int count, const std::string& query,
+           const std::pair<double, double>& time_and_results) {
+  std::cout << fmt::format("{:>8} {:>44} {:>14.1f} {:>10.1f}\n", count, query,
+                           time_and_results.first, time_and_results.second);
+}
+
+void TimeQueries(int count) {
+  const std::unique_ptr<Scene> scene = MakeMixedScene(count);
+
+  // The update itself is timed here, so the poses are switched in the query.
+  int evaluation = 0;
+  Print(count, "UpdateWorldPoses", Time(scene.get(), [&](const Poses&) {
+          scene->engine.UpdateWorldPoses(scene->X_WGs[evaluation++ % 2]);
+          return 0;
+        }));
+  Print(count, "ComputePointPairPenetration",
+        Time(scene.get(), [&](const Poses&) {
+          return scene->engine.ComputePointPairPenetration().size();
+        }));
+  Print(count, "ComputeSignedDistancePairwiseClosestPoints",
+        Time(scene.get(), [&](const Poses& X_WGs) {
+          return scene->engine
+              .ComputeSignedDistancePairwiseClosestPoints(X_WGs,
+                                                          FLAGS_max_distance)
+              .size();
+        }));
+  // A point in the middle of the grid, with the distances of the geometries
+  // within two cells.
+  const double size = std::ceil(std::cbrt(static_cast<double>(count)));
+  const Vector3d p_WQ = Vector3d::Constant(kSpacing * (size - 1) / 2);
+  Print(count, "ComputeSignedDistanceToPoint",
+        Time(scene.get(), [&](const Poses& X_WGs) {
+          return scene->engine
+              .ComputeSignedDistanceToPoint(p_WQ, X_WGs, 2 * kSpacing)
+              .size();
+        }));
+
+  const std::unique_ptr<Scene> hydroelastic_scene =
+      MakeHydroelasticScene(count);
+  Print(count, "ComputeContactSurfaces",
+        Time(hydroelastic_scene.get(), [&](const Poses& X_WGs) {
+          return hydroelastic_scene->engine.ComputeContactSurfaces(X_WGs)
+              .size();
+        }));
+}
+
+int do_main() {
+  std::cout << fmt::format("{:>8} {:>44} {:>14} {:>10}\n", "geometry", "query",
+                           "time [us]", "results");
+  for (int count : ParseCounts(FLAGS_geometry_counts)) {
+    TimeQueries(count);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace geometry
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the queries of ProximityEngine on scenes of increasing sizes.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::geometry::benchmarking::do_main();
+}
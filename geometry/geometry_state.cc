@@ -4,12 +4,15 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
@@ -32,6 +35,7 @@ using std::make_unique;
 using std::move;
 using std::swap;
 using std::to_string;
+using systems::sensors::ImageDepth16U;
 using systems::sensors::ImageDepth32F;
 using systems::sensors::ImageLabel16I;
 using systems::sensors::ImageRgba8U;
@@ -105,32 +109,46 @@ std::string get_missing_id_message<GeometryId>(const GeometryId& key) {
   return ss.str();
 }
 
+// Reports whether the two poses are known to be exactly equal. Only double
+// poses are compared; the poses of other scalar types (whose derivatives may
+// differ) are never reported as equal.
+template <typename T>
+bool IsExactlyEqual(const RigidTransform<T>& X_1,
+                    const RigidTransform<T>& X_2) {
+  if constexpr (std::is_same<T, double>::value) {
+    return X_1.IsExactlyEqualTo(X_2);
+  } else {
+    return false;
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 template <typename T>
 GeometryState<T>::GeometryState()
     : self_source_(SourceId::get_new_id()),
       geometry_engine_(make_unique<internal::ProximityEngine<T>>()) {
-  source_names_[self_source_] = "SceneGraphInternal";
+  source_names_.mutate()[self_source_] = "SceneGraphInternal";
 
   const FrameId world = InternalFrame::world_frame_id();
   // As an arbitrary design choice, we'll say the world frame is its own parent.
-  frames_[world] = InternalFrame(self_source_, world, "world",
+  frames_.mutate()[world] = InternalFrame(self_source_, world, "world",
                                  InternalFrame::world_frame_group(),
                                  FrameIndex(0), world,
                                  InternalFrame::world_frame_clique());
-  frame_index_to_id_map_.push_back(world);
+  frame_index_to_id_map_.mutate().push_back(world);
+  frame_geometries_.mutate().emplace_back();
   X_WF_.push_back(RigidTransform<T>::Identity());
   X_PF_.push_back(RigidTransform<T>::Identity());
 
-  source_frame_id_map_[self_source_] = {world};
-  source_root_frame_map_[self_source_] = {world};
+  source_frame_id_map_.mutate()[self_source_] = {world};
+  source_root_frame_map_.mutate()[self_source_] = {world};
 }
 
 template <typename T>
 int GeometryState<T>::GetNumGeometriesWithRole(Role role) const {
   int count = 0;
-  for (const auto& pair : geometries_) {
+  for (const auto& pair : *geometries_) {
     if (pair.second.has_role(role)) ++count;
   }
   return count;
@@ -139,7 +157,7 @@ int GeometryState<T>::GetNumGeometriesWithRole(Role role) const {
 template <typename T>
 int GeometryState<T>::GetNumDynamicGeometries() const {
   int count = 0;
-  for (const auto& pair : frames_) {
+  for (const auto& pair : *frames_) {
     const InternalFrame& frame = pair.second;
     if (frame.id() == InternalFrame::world_frame_id()) continue;
     count += frame.num_child_geometries();
@@ -149,7 +167,7 @@ int GeometryState<T>::GetNumDynamicGeometries() const {
 
 template <typename T>
 int GeometryState<T>::GetNumAnchoredGeometries() const {
-  const InternalFrame& frame = frames_.at(InternalFrame::world_frame_id());
+  const InternalFrame& frame = frames_->at(InternalFrame::world_frame_id());
   return frame.num_child_geometries();
 }
 
@@ -157,11 +175,11 @@ template <typename T>
 std::set<std::pair<GeometryId, GeometryId>>
 GeometryState<T>::GetCollisionCandidates() const {
   std::set<std::pair<GeometryId, GeometryId>> pairs;
-  for (const auto& pairA : geometries_) {
+  for (const auto& pairA : *geometries_) {
     const GeometryId idA = pairA.first;
     const InternalGeometry& geometryA = pairA.second;
     if (!geometryA.has_proximity_role()) continue;
-    for (const auto& pairB : geometries_) {
+    for (const auto& pairB : *geometries_) {
       const GeometryId idB = pairB.first;
       if (idB < idA) continue;  // Only consider the pair (A, B) and not (B, A).
       const InternalGeometry& geometryB = pairB.second;
@@ -178,27 +196,27 @@ GeometryState<T>::GetCollisionCandidates() const {
 
 template <typename T>
 bool GeometryState<T>::source_is_registered(SourceId source_id) const {
-  return source_frame_id_map_.find(source_id) != source_frame_id_map_.end();
+  return source_frame_id_map_->find(source_id) != source_frame_id_map_->end();
 }
 
 template <typename T>
 const std::string& GeometryState<T>::get_source_name(SourceId id) const {
-  auto itr = source_names_.find(id);
-  if (itr != source_names_.end()) return itr->second;
+  auto itr = source_names_->find(id);
+  if (itr != source_names_->end()) return itr->second;
   throw std::logic_error(
       "Querying source name for an invalid source id: " + to_string(id) + ".");
 }
 
 template <typename T>
 int GeometryState<T>::NumFramesForSource(SourceId source_id) const {
-  const auto& frame_set = GetValueOrThrow(source_id, source_frame_id_map_);
+  const auto& frame_set = GetValueOrThrow(source_id, *source_frame_id_map_);
   return static_cast<int>(frame_set.size());
 }
 
 template <typename T>
 const FrameIdSet& GeometryState<T>::GetFramesForSource(
     SourceId source_id) const {
-  return GetValueOrThrow(source_id, source_frame_id_map_);
+  return GetValueOrThrow(source_id, *source_frame_id_map_);
 }
 
 template <typename T>
@@ -206,7 +224,7 @@ bool GeometryState<T>::BelongsToSource(FrameId frame_id,
                                        SourceId source_id) const {
   // Confirm that the source_id is valid; use the utility function to confirm
   // source_id is valid and throw an exception with a known message.
-  GetValueOrThrow(source_id, source_frame_id_map_);
+  GetValueOrThrow(source_id, *source_frame_id_map_);
   // If valid, test the frame.
   return get_source_id(frame_id) == source_id;
 }
@@ -214,40 +232,40 @@ bool GeometryState<T>::BelongsToSource(FrameId frame_id,
 template <typename T>
 const std::string& GeometryState<T>::GetOwningSourceName(FrameId id) const {
   SourceId source_id = get_source_id(id);
-  return source_names_.at(source_id);
+  return source_names_->at(source_id);
 }
 
 template <typename T>
 const std::string& GeometryState<T>::get_frame_name(FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, *frames_, [frame_id]() {
     return "No frame name available for invalid frame id: " +
         to_string(frame_id);
   });
-  return frames_.at(frame_id).name();
+  return frames_->at(frame_id).name();
 }
 
 template <typename T>
 int GeometryState<T>::get_frame_group(FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, *frames_, [frame_id]() {
     return "No frame group available for invalid frame id: " +
         to_string(frame_id);
   });
-  return frames_.at(frame_id).frame_group();
+  return frames_->at(frame_id).frame_group();
 }
 
 template <typename T>
 int GeometryState<T>::GetNumFrameGeometries(FrameId frame_id) const {
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, *frames_);
   return static_cast<int>(frame.child_geometries().size());
 }
 
 template <typename T>
 int GeometryState<T>::GetNumFrameGeometriesWithRole(FrameId frame_id,
                                                     Role role) const {
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, *frames_);
   int count = 0;
   for (GeometryId geometry_id : frame.child_geometries()) {
-    if (geometries_.at(geometry_id).has_role(role)) ++count;
+    if (geometries_->at(geometry_id).has_role(role)) ++count;
   }
   return count;
 }
@@ -255,13 +273,13 @@ int GeometryState<T>::GetNumFrameGeometriesWithRole(FrameId frame_id,
 template <typename T>
 int GeometryState<T>::NumGeometriesWithRole(FrameId frame_id, Role role) const {
   int count = 0;
-  FindOrThrow(frame_id, frames_, [frame_id, role]() {
+  FindOrThrow(frame_id, *frames_, [frame_id, role]() {
     return "Cannot report number of geometries with the " + to_string(role) +
         " role for invalid frame id: " + to_string(frame_id);
   });
-  const InternalFrame& frame = frames_.at(frame_id);
+  const InternalFrame& frame = frames_->at(frame_id);
   for (GeometryId id : frame.child_geometries()) {
-    if (geometries_.at(id).has_role(role)) ++count;
+    if (geometries_->at(id).has_role(role)) ++count;
   }
   return count;
 }
@@ -275,10 +293,10 @@ GeometryId GeometryState<T>::GetGeometryFromName(
   int count = 0;
   std::string frame_name;
 
-  const InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(frame_id, *frames_);
   frame_name = frame.name();
   for (GeometryId geometry_id : frame.child_geometries()) {
-    const InternalGeometry& geometry = geometries_.at(geometry_id);
+    const InternalGeometry& geometry = geometries_->at(geometry_id);
     if (geometry.has_role(role) && geometry.name() == canonical_name) {
       ++count;
       result = geometry_id;
@@ -304,23 +322,23 @@ template <typename T>
 bool GeometryState<T>::BelongsToSource(GeometryId geometry_id,
                                        SourceId source_id) const {
   // Confirm valid source id.
-  FindOrThrow(source_id, source_names_, [source_id](){
+  FindOrThrow(source_id, *source_names_, [source_id](){
     return get_missing_id_message(source_id);
   });
   // If this fails, the geometry_id is not valid and an exception is thrown.
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, *geometries_);
   return geometry.belongs_to_source(source_id);
 }
 
 template <typename T>
 const std::string& GeometryState<T>::GetOwningSourceName(GeometryId id) const {
   SourceId source_id = get_source_id(id);
-  return source_names_.at(source_id);
+  return source_names_->at(source_id);
 }
 
 template <typename T>
 FrameId GeometryState<T>::GetFrameId(GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, *geometries_);
   return geometry.frame_id();
 }
 
@@ -345,14 +363,14 @@ const Shape& GeometryState<T>::GetShape(GeometryId id) const {
 template <typename T>
 const math::RigidTransform<double>& GeometryState<T>::GetPoseInFrame(
     GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, *geometries_);
   return geometry.X_FG();
 }
 
 template <typename T>
 const math::RigidTransform<double>& GeometryState<T>::GetPoseInParent(
     GeometryId geometry_id) const {
-  const auto& geometry = GetValueOrThrow(geometry_id, geometries_);
+  const auto& geometry = GetValueOrThrow(geometry_id, *geometries_);
   return geometry.X_PG();
 }
 
@@ -420,17 +438,17 @@ bool GeometryState<T>::CollisionFiltered(GeometryId id1, GeometryId id2) const {
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
     FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, *frames_, [frame_id]() {
     return "No world pose available for invalid frame id: " +
            to_string(frame_id);
   });
-  return X_WF_[frames_.at(frame_id).index()];
+  return X_WF_[frames_->at(frame_id).index()];
 }
 
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
     GeometryId geometry_id) const {
-  FindOrThrow(geometry_id, geometries_, [geometry_id]() {
+  FindOrThrow(geometry_id, *geometries_, [geometry_id]() {
     return "No world pose available for invalid geometry id: " +
            to_string(geometry_id);
   });
@@ -440,10 +458,10 @@ const math::RigidTransform<T>& GeometryState<T>::get_pose_in_world(
 template <typename T>
 const math::RigidTransform<T>& GeometryState<T>::get_pose_in_parent(
     FrameId frame_id) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, *frames_, [frame_id]() {
     return "No pose available for invalid frame id: " + to_string(frame_id);
   });
-  return X_PF_[frames_.at(frame_id).index()];
+  return X_PF_[frames_->at(frame_id).index()];
 }
 
 template <typename T>
@@ -453,17 +471,17 @@ SourceId GeometryState<T>::RegisterNewSource(const std::string& name) {
       name != "" ? name : "Source_" + to_string(source_id);
 
   // The user can provide bad names, _always_ test.
-  for (const auto& pair : source_names_) {
+  for (const auto& pair : *source_names_) {
     if (pair.second == final_name) {
       throw std::logic_error(
           "Registering new source with duplicate name: " + final_name + ".");
     }
   }
 
-  source_frame_id_map_[source_id];
-  source_root_frame_map_[source_id];
-  source_anchored_geometry_map_[source_id];
-  source_names_[source_id] = final_name;
+  source_frame_id_map_.mutate()[source_id];
+  source_root_frame_map_.mutate()[source_id];
+  source_anchored_geometry_map_.mutate()[source_id];
+  source_names_.mutate()[source_id] = final_name;
   return source_id;
 }
 
@@ -478,35 +496,40 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
                                         const GeometryFrame& frame) {
   FrameId frame_id = frame.id();
 
-  if (frames_.count(frame_id) > 0) {
+  if (frames_->count(frame_id) > 0) {
     throw std::logic_error(
         "Registering frame with an id that has already been registered: " +
             to_string(frame_id));
   }
 
-  FrameIdSet& f_set = GetMutableValueOrThrow(source_id, &source_frame_id_map_);
+  FrameIdSet& f_set =
+      GetMutableValueOrThrow(source_id, &source_frame_id_map_.mutate());
   if (parent_id != InternalFrame::world_frame_id()) {
     FindOrThrow(parent_id, f_set, [parent_id, source_id]() {
       return "Indicated parent id " + to_string(parent_id) + " does not belong "
           "to the indicated source id " + to_string(source_id) + ".";
     });
-    frames_[parent_id].add_child(frame_id);
+    frames_.mutate()[parent_id].add_child(frame_id);
   } else {
     // The parent is the world frame; register it as a root frame.
-    source_root_frame_map_[source_id].insert(frame_id);
+    source_root_frame_map_.mutate()[source_id].insert(frame_id);
   }
 
-  DRAKE_ASSERT(X_PF_.size() == frame_index_to_id_map_.size());
+  DRAKE_ASSERT(X_PF_.size() == frame_index_to_id_map_->size());
   FrameIndex index(X_PF_.size());
+  // The frame starts at the pose of its parent, as if it had been propagated
+  // with the initial X_PF = I; see UpdatePosesRecursively().
+  const RigidTransform<T> X_WP = X_WF_[frames_->at(parent_id).index()];
   X_PF_.emplace_back(RigidTransform<T>::Identity());
-  X_WF_.emplace_back(RigidTransform<T>::Identity());
-  frame_index_to_id_map_.push_back(frame_id);
+  X_WF_.push_back(X_WP);
+  frame_index_to_id_map_.mutate().push_back(frame_id);
+  frame_geometries_.mutate().emplace_back();
   f_set.insert(frame_id);
   int clique = GeometryStateCollisionFilterAttorney::get_next_clique(
       geometry_engine_.get_mutable());
-  frames_.emplace(frame_id, InternalFrame(source_id, frame_id, frame.name(),
-                                          frame.frame_group(), index,
-                                          parent_id, clique));
+  frames_.mutate().emplace(
+      frame_id, InternalFrame(source_id, frame_id, frame.name(),
+                              frame.frame_group(), index, parent_id, clique));
   return frame_id;
 }
 
@@ -521,7 +544,7 @@ GeometryId GeometryState<T>::RegisterGeometry(
   }
 
   GeometryId geometry_id = geometry->id();
-  if (geometries_.count(geometry_id) > 0) {
+  if (geometries_->count(geometry_id) > 0) {
     throw std::logic_error(
         "Registering geometry with an id that has already been registered: " +
             to_string(geometry_id));
@@ -531,13 +554,13 @@ GeometryId GeometryState<T>::RegisterGeometry(
   if (frame_id == InternalFrame::world_frame_id()) {
     // Explicitly validate the source id because it won't happen in acquiring
     // the world frame.
-    FindOrThrow(source_id, source_frame_id_map_, [source_id]() {
+    FindOrThrow(source_id, *source_frame_id_map_, [source_id]() {
       return get_missing_id_message(source_id);
     });
     frame_source_id = self_source_;
   }
   FrameIdSet& set = GetMutableValueOrThrow(frame_source_id,
-                                           &source_frame_id_map_);
+                                           &source_frame_id_map_.mutate());
 
   FindOrThrow(frame_id, set, [frame_id, frame_source_id]() {
     return "Referenced frame " + to_string(frame_id) + " for source " +
@@ -549,14 +572,18 @@ GeometryId GeometryState<T>::RegisterGeometry(
   // NOTE: Names are not validated here -- there are no roles. The names are
   // validated when roles are assigned.
 
-  InternalFrame& frame = frames_[frame_id];
+  InternalFrame& frame = frames_.mutate()[frame_id];
   frame.add_child(geometry_id);
 
   // pose() is always RigidTransform<double>. To account for
-  // GeometryState<AutoDiff>, we need to cast it to the common type T.
-  X_WGs_[geometry_id] = geometry->pose().cast<T>();
-
-  geometries_.emplace(
+  // GeometryState<AutoDiff>, we need to cast it to the common type T. The
+  // geometry is posed with its frame's current pose, so that it is up to date
+  // even if the frame doesn't move anymore; see UpdatePosesRecursively().
+  X_WGs_[geometry_id] = X_WF_[frame.index()] * geometry->pose().cast<T>();
+  frame_geometries_.mutate()[frame.index()].push_back(
+      {geometry_id, geometry->pose()});
+
+  geometries_.mutate().emplace(
       geometry_id,
       InternalGeometry(source_id, geometry->release_shape(), frame_id,
                        geometry_id, geometry->name(), geometry->pose()));
@@ -600,7 +627,7 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
 
   // This confirms that parent_id exists at all.
   InternalGeometry& parent_geometry =
-      GetMutableValueOrThrow(parent_id, &geometries_);
+      GetMutableValueOrThrow(parent_id, &geometries_.mutate());
   FrameId frame_id = parent_geometry.frame_id();
 
   // This implicitly confirms that source_id is registered (condition #2) and
@@ -613,7 +640,7 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
   // semantically correct value X_FG by concatenating X_FP with X_PG.
 
   // Transform pose relative to geometry, to pose relative to frame.
-  InternalGeometry& new_geometry = geometries_[new_id];
+  InternalGeometry& new_geometry = geometries_.mutate()[new_id];
   // The call to `RegisterGeometry()` above stashed the pose X_PG into the
   // X_FG_ vector assuming the parent was the frame. Replace it by concatenating
   // its pose in parent, with its parent's pose in frame. NOTE: the pose is no
@@ -622,6 +649,14 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
   const RigidTransform<double>& X_FP = parent_geometry.X_FG();
   new_geometry.set_geometry_parent(parent_id, X_FP * X_PG);
   parent_geometry.add_child(new_id);
+  const FrameIndex frame_index = frames_->at(frame_id).index();
+  // RegisterGeometry() appended the new geometry to its frame's geometries.
+  internal::FrameGeometry& frame_geometry =
+      frame_geometries_.mutate()[frame_index].back();
+  DRAKE_DEMAND(frame_geometry.id == new_id);
+  frame_geometry.X_FG = new_geometry.X_FG();
+  X_WGs_[new_id] =
+      X_WF_[frame_index] * new_geometry.X_FG().template cast<T>();
   return new_id;
 }
 
@@ -648,7 +683,7 @@ void GeometryState<T>::RemoveGeometry(SourceId source_id,
 template <typename T>
 bool GeometryState<T>::IsValidGeometryName(
     FrameId frame_id, Role role, const std::string& candidate_name) const {
-  FindOrThrow(frame_id, frames_, [frame_id]() {
+  FindOrThrow(frame_id, *frames_, [frame_id]() {
     return "Given frame id is not valid: " + to_string(frame_id);
   });
   const std::string name = internal::CanonicalizeStringName(candidate_name);
@@ -708,7 +743,7 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
       // Pass the geometry to the engine.
       geometry_engine_->AddDynamicGeometry(geometry.shape(), geometry_id);
 
-      InternalFrame& frame = frames_[geometry.frame_id()];
+      const InternalFrame& frame = frames_->at(geometry.frame_id());
 
       int child_count = static_cast<int>(frame.child_geometries().size());
       if (child_count > 1) {
@@ -719,7 +754,7 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
         std::vector<GeometryId> proximity_geometries;
         proximity_geometries.reserve(child_count);
         for (GeometryId child_id : frame.child_geometries()) {
-          if (geometries_[child_id].has_proximity_role()) {
+          if (geometries_->at(child_id).has_proximity_role()) {
             proximity_geometries.push_back(child_id);
           }
         }
@@ -908,8 +943,8 @@ void GeometryState<T>::AddRenderer(
   }
   render::RenderEngine* render_engine = renderer.get();
   render_engines_[name] = move(renderer);
-  for (auto& id_geo_pair : geometries_) {
-    InternalGeometry& geometry = id_geo_pair.second;
+  for (const auto& id_geo_pair : *geometries_) {
+    const InternalGeometry& geometry = id_geo_pair.second;
     if (geometry.has_perception_role()) {
       const GeometryId id = id_geo_pair.first;
       const PerceptionProperties* properties = geometry.perception_properties();
@@ -959,6 +994,19 @@ void GeometryState<T>::RenderDepthImage(
   engine.RenderDepthImage(camera, depth_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderDepthImage(
+    const render::DepthCameraProperties& camera,
+    FrameId parent_frame, const RigidTransformd& X_PC,
+    ImageDepth16U* depth_image_out) const {
+  const RigidTransformd X_WC = GetDoubleWorldPose(parent_frame) * X_PC;
+  const render::RenderEngine& engine =
+      GetRenderEngineOrThrow(camera.renderer_name);
+  // See note in RenderColorImage() about this const cast.
+  const_cast<render::RenderEngine&>(engine).UpdateViewpoint(X_WC);
+  engine.RenderDepthImage(camera, depth_image_out);
+}
+
 template <typename T>
 void GeometryState<T>::RenderLabelImage(const render::CameraProperties& camera,
                                         FrameId parent_frame,
@@ -988,10 +1036,10 @@ void GeometryState<T>::CollectIds(
   // that collecting ids for *other* role-related tasks prove necessary.
   std::unordered_set<GeometryId>* target;
   for (auto frame_id : geometry_set.frames()) {
-    const auto& frame = GetValueOrThrow(frame_id, frames_);
+    const auto& frame = GetValueOrThrow(frame_id, *frames_);
     target = frame.is_world() ? anchored : dynamic;
     for (auto geometry_id : frame.child_geometries()) {
-      InternalGeometry& geometry = geometries_[geometry_id];
+      const InternalGeometry& geometry = geometries_->at(geometry_id);
       if (geometry.has_proximity_role()) {
         target->insert(geometry_id);
       }
@@ -1023,8 +1071,25 @@ void GeometryState<T>::SetFramePoses(
   // ASSERT_ARMED.
   ValidateFrameIds(source_id, poses);
   const RigidTransform<T> world_pose = RigidTransform<T>::Identity();
-  for (auto frame_id : source_root_frame_map_[source_id]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, poses);
+  const FrameIdSet& root_frames = source_root_frame_map_->at(source_id);
+  // The trees of the root frames are disjoint, so large scenes update them in
+  // parallel. Each tree only writes the poses of its own frames and
+  // geometries, which are already allocated.
+  constexpr int kMinRootFramesPerThread = 16;
+  const int num_roots = static_cast<int>(root_frames.size());
+  const int num_threads =
+      std::min(max_num_threads(), num_roots / kMinRootFramesPerThread);
+  if (num_threads > 1) {
+    const std::vector<FrameId> roots(root_frames.begin(), root_frames.end());
+    StaticParallelForIndexLoop(num_threads, 0, num_roots, [&](int, int i) {
+      UpdatePosesRecursively(frames_->at(roots[i]), world_pose,
+                             false /* parent_moved */, poses);
+    });
+    return;
+  }
+  for (auto frame_id : root_frames) {
+    UpdatePosesRecursively(frames_->at(frame_id), world_pose,
+                           false /* parent_moved */, poses);
   }
 }
 
@@ -1055,7 +1120,17 @@ void GeometryState<T>::ValidateFrameIds(
 
 template <typename T>
 void GeometryState<T>::FinalizePoseUpdate() {
+  FinalizeProximityPoseUpdate();
+  FinalizePerceptionPoseUpdate();
+}
+
+template <typename T>
+void GeometryState<T>::FinalizeProximityPoseUpdate() {
   geometry_engine_->UpdateWorldPoses(X_WGs_);
+}
+
+template <typename T>
+void GeometryState<T>::FinalizePerceptionPoseUpdate() {
   for (auto& pair : render_engines_) {
     pair.second->UpdatePoses(X_WGs_);
   }
@@ -1063,7 +1138,7 @@ void GeometryState<T>::FinalizePoseUpdate() {
 
 template <typename T>
 SourceId GeometryState<T>::get_source_id(FrameId frame_id) const {
-  const auto& frame = GetValueOrThrow(frame_id, frames_);
+  const auto& frame = GetValueOrThrow(frame_id, *frames_);
   return frame.source_id();
 }
 
@@ -1080,7 +1155,10 @@ SourceId GeometryState<T>::get_source_id(GeometryId id) const {
 template <typename T>
 void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
                                                RemoveGeometryOrigin caller) {
-  const InternalGeometry& geometry = GetValueOrThrow(geometry_id, geometries_);
+  // The geometries are unshared up front, so that `geometry` refers to the
+  // copy that is modified below.
+  const InternalGeometry& geometry =
+      GetValueOrThrow(geometry_id, geometries_.mutate());
 
   // TODO(SeanCurtis-TRI): When this gets invoked by RemoveFrame(), this
   // recursive action will not be necessary, as all child geometries will
@@ -1092,8 +1170,19 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
       RemoveGeometryUnchecked(child_id, RemoveGeometryOrigin::kRecurse);
     }
     // Remove the geometry from its frame's list of geometries.
-    auto& frame = GetMutableValueOrThrow(geometry.frame_id(), &frames_);
+    auto& frame =
+        GetMutableValueOrThrow(geometry.frame_id(), &frames_.mutate());
     frame.remove_child(geometry_id);
+    std::vector<internal::FrameGeometry>& frame_geometries =
+        frame_geometries_.mutate()[frame.index()];
+    auto iter = std::find_if(frame_geometries.begin(), frame_geometries.end(),
+                             [geometry_id](const internal::FrameGeometry& g) {
+                               return g.id == geometry_id;
+                             });
+    DRAKE_DEMAND(iter != frame_geometries.end());
+    // The order is irrelevant, so the last entry takes the removed one's place.
+    *iter = std::move(frame_geometries.back());
+    frame_geometries.pop_back();
   }
 
   RemoveProximityRole(geometry_id);
@@ -1107,7 +1196,7 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
     // is implicit in the deletion of that parent geometry.
     if (optional<GeometryId> parent_id = geometry.parent_id()) {
       auto& parent_geometry =
-          GetMutableValueOrThrow(*parent_id, &geometries_);
+          GetMutableValueOrThrow(*parent_id, &geometries_.mutate());
       parent_geometry.remove_child(geometry_id);
     }
   }
@@ -1116,39 +1205,44 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
   X_WGs_.erase(geometry_id);
 
   // Remove from the geometries.
-  geometries_.erase(geometry_id);
+  geometries_.mutate().erase(geometry_id);
 }
 
 template <typename T>
 void GeometryState<T>::UpdatePosesRecursively(
     const internal::InternalFrame& frame, const RigidTransform<T>& X_WP,
-    const FramePoseVector<T>& poses) {
+    bool parent_moved, const FramePoseVector<T>& poses) {
   const auto frame_id = frame.id();
   const auto& X_PF = poses.value(frame_id);
-  // Cache this transform for later use.
-  X_PF_[frame.index()] = X_PF;
-  RigidTransform<T> X_WF = X_WP * X_PF;
-  X_WF_[frame.index()] = X_WF;
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    // X_FG() is always RigidTransform<double>, to account for
-    // GeometryState<AutoDiff>, we need to cast it to the common type T.
-    RigidTransform<double> X_FG(child_geometry.X_FG());
-    X_WGs_[child_id] = X_WF * X_FG.cast<T>();
+  // NOTE: This may run concurrently on disjoint trees. Hence, the maps are
+  // only accessed with at(), which doesn't modify them.
+  const bool moved =
+      parent_moved || !IsExactlyEqual(X_PF, X_PF_[frame.index()]);
+  if (moved) {
+    // Cache this transform for later use.
+    X_PF_[frame.index()] = X_PF;
+    X_WF_[frame.index()] = X_WP * X_PF;
+    const RigidTransform<T>& X_WF = X_WF_[frame.index()];
+    // Update the geometry which belong to *this* frame.
+    for (const internal::FrameGeometry& child :
+         (*frame_geometries_)[frame.index()]) {
+      // X_FG is always RigidTransform<double>, to account for
+      // GeometryState<AutoDiff>, we need to cast it to the common type T.
+      X_WGs_.at(child.id) = X_WF * child.X_FG.cast<T>();
+    }
   }
 
   // Update each child frame.
   for (auto child_id : frame.child_frames()) {
-    auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, poses);
+    const auto& child_frame = frames_->at(child_id);
+    UpdatePosesRecursively(child_frame, X_WF_[frame.index()], moved, poses);
   }
 }
 
 template <typename T>
 const InternalGeometry* GeometryState<T>::GetGeometry(GeometryId id) const {
-  const auto& iterator = geometries_.find(id);
-  if (iterator != geometries_.end()) {
+  const auto& iterator = geometries_->find(id);
+  if (iterator != geometries_->end()) {
     return &iterator->second;
   }
   return nullptr;
@@ -1156,17 +1250,18 @@ const InternalGeometry* GeometryState<T>::GetGeometry(GeometryId id) const {
 
 template <typename T>
 InternalGeometry* GeometryState<T>::GetMutableGeometry(GeometryId id) {
-  const InternalGeometry* geometry = GetGeometry(id);
-  return const_cast<InternalGeometry*>(geometry);
+  // Only copies the (possibly shared) geometries if one will change.
+  if (GetGeometry(id) == nullptr) return nullptr;
+  return &geometries_.mutate().at(id);
 }
 
 template <typename T>
 bool GeometryState<T>::NameIsUnique(FrameId id, Role role,
                                     const std::string& name) const {
   bool unique = true;
-  const InternalFrame& frame = GetValueOrThrow(id, frames_);
+  const InternalFrame& frame = GetValueOrThrow(id, *frames_);
   for (GeometryId geometry_id : frame.child_geometries()) {
-    const InternalGeometry& geometry = geometries_.at(geometry_id);
+    const InternalGeometry& geometry = geometries_->at(geometry_id);
     if (geometry.has_role(role) && geometry.name() == name) {
       unique = false;
       break;
@@ -1312,21 +1407,21 @@ const InternalFrame& GeometryState<T>::ValidateAndGetFrame(
     SourceId source_id, FrameId frame_id) const {
   // Handle the special case of the world frame; source_id will *not* own it.
   if (frame_id == InternalFrame::world_frame_id()) {
-    FindOrThrow(source_id, source_frame_id_map_, [source_id]() {
+    FindOrThrow(source_id, *source_frame_id_map_, [source_id]() {
       return get_missing_id_message(source_id);
     });
-    return frames_.at(frame_id);
+    return frames_->at(frame_id);
   } else {
     // The generic test that the frame_id is owned by the source_id.
     const FrameIdSet& set =
-        GetValueOrThrow(source_id, source_frame_id_map_);
+        GetValueOrThrow(source_id, *source_frame_id_map_);
     FindOrThrow(frame_id, set, [frame_id, source_id]() {
       return "Referenced frame " + to_string(frame_id) + " for source " +
           to_string(source_id) +
           ", but the frame doesn't belong to the source.";
     });
   }
-  return frames_.at(frame_id);
+  return frames_->at(frame_id);
 }
 
 template <typename T>
@@ -1346,7 +1441,7 @@ RigidTransformd GeometryState<T>::GetDoubleWorldPose(FrameId frame_id) const {
   if (frame_id == InternalFrame::world_frame_id()) {
     return RigidTransformd::Identity();
   }
-  const internal::InternalFrame& frame = GetValueOrThrow(frame_id, frames_);
+  const internal::InternalFrame& frame = GetValueOrThrow(frame_id, *frames_);
   return internal::convert_to_double(X_WF_[frame.index()]);
 }
 
@@ -30,6 +30,12 @@ namespace internal {
 
 class GeometryVisualizationImpl;
 
+// A geometry rigidly affixed to a frame, with its pose in that frame.
+struct FrameGeometry {
+  GeometryId id;
+  math::RigidTransform<double> X_FG;
+};
+
 }  // namespace internal
 #endif
 
@@ -100,25 +106,25 @@ class GeometryState {
 
   /** Implementation of SceneGraphInspector::num_sources().  */
   int get_num_sources() const {
-    return static_cast<int>(source_frame_id_map_.size());
+    return static_cast<int>(source_frame_id_map_->size());
   }
 
   /** Implementation of SceneGraphInspector::num_frames().  */
-  int get_num_frames() const { return static_cast<int>(frames_.size()); }
+  int get_num_frames() const { return static_cast<int>(frames_->size()); }
 
   /** Implementation of SceneGraphInspector::all_frame_ids().  */
-  FrameIdRange get_frame_ids() const { return FrameIdRange(&frames_); }
+  FrameIdRange get_frame_ids() const { return FrameIdRange(&*frames_); }
 
   /** Implementation of SceneGraphInspector::num_geometries().  */
   int get_num_geometries() const {
-    return static_cast<int>(geometries_.size());
+    return static_cast<int>(geometries_->size());
   }
 
   /** Implementation of SceneGraphInspector::GetAllGeometryIds().  */
   std::vector<GeometryId> GetAllGeometryIds() const {
     std::vector<GeometryId> ids;
-    ids.reserve(geometries_.size());
-    for (const auto& id_geometry_pair : geometries_) {
+    ids.reserve(geometries_->size());
+    for (const auto& id_geometry_pair : *geometries_) {
       ids.push_back(id_geometry_pair.first);
     }
     return ids;
@@ -421,8 +427,10 @@ class GeometryState {
   }
 
   /** See QueryObject::ComputeContactSurfaces() for documentation.  */
-  std::vector<ContactSurface<T>> ComputeContactSurfaces() const {
-    return geometry_engine_->ComputeContactSurfaces(X_WGs_);
+  std::vector<ContactSurface<T>> ComputeContactSurfaces(
+      HydroelasticContactRepresentation representation =
+          HydroelasticContactRepresentation::kTriangle) const {
+    return geometry_engine_->ComputeContactSurfaces(X_WGs_, representation);
   }
 
   /** See QueryObject::FindCollisionCandidates() for documentation.  */
@@ -454,6 +462,20 @@ class GeometryState {
 
   //@}
 
+  //---------------------------------------------------------------------------
+  /** @name                Threading  */
+  //@{
+
+  /** Implementation support for SceneGraph::set_max_num_threads().  */
+  void set_max_num_threads(int max_num_threads) {
+    geometry_engine_->set_max_num_threads(max_num_threads);
+  }
+
+  /** Implementation support for SceneGraph::max_num_threads().  */
+  int max_num_threads() const { return geometry_engine_->max_num_threads(); }
+
+  //@}
+
   //---------------------------------------------------------------------------
   /** @name                Signed Distance Queries
 
@@ -470,6 +492,25 @@ class GeometryState {
         X_WGs_, max_distance);
   }
 
+  /** Supporting function for
+   QueryObject::ComputeSignedDistancePairClosestPoints().  */
+  SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
+      GeometryId id_A, GeometryId id_B) const {
+    return geometry_engine_->ComputeSignedDistancePairClosestPoints(
+        id_A, id_B, X_WGs_);
+  }
+
+  /** Supporting function for QueryObject::ComputeTimeOfImpact().  */
+  optional<double> ComputeTimeOfImpact(GeometryId id_A, GeometryId id_B,
+                                       const math::RigidTransformd& X_WA_end,
+                                       const math::RigidTransformd& X_WB_end,
+                                       double distance_tolerance) const {
+    return geometry_engine_->ComputeTimeOfImpact(
+        id_A, id_B, internal::convert_to_double(get_pose_in_world(id_A)),
+        X_WA_end, internal::convert_to_double(get_pose_in_world(id_B)),
+        X_WB_end, distance_tolerance);
+  }
+
   /** Supporting function for QueryObject::ComputeSignedDistanceToPoint().  */
   std::vector<SignedDistanceToPoint<T>> ComputeSignedDistanceToPoint(
       const Vector3<T>& p_WQ, double threshold) const {
@@ -477,6 +518,22 @@ class GeometryState {
                                                           threshold);
   }
 
+  /** Supporting function for QueryObject::ComputeSignedDistanceToPoints().  */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(const Matrix3X<T>& p_WQs,
+                                double threshold) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(p_WQs, X_WGs_,
+                                                           threshold);
+  }
+
+  /** Supporting function for QueryObject::ComputeRayCastDistances().  */
+  Eigen::VectorXd ComputeRayCastDistances(const Matrix3X<double>& p_WRs,
+                                          const Matrix3X<double>& dir_Ws,
+                                          double max_range) const {
+    return geometry_engine_->ComputeRayCastDistances(p_WRs, dir_Ws,
+                                                     max_range);
+  }
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -498,6 +555,13 @@ class GeometryState {
   /** Implementation support for SceneGraph::RegisteredRendererNames().  */
   std::vector<std::string> RegisteredRendererNames() const;
 
+  /** Implementation support for QueryObject::CloneRenderEngine().
+   @pre All poses have already been updated.  */
+  std::unique_ptr<render::RenderEngine> CloneRenderEngine(
+      const std::string& renderer_name) const {
+    return GetRenderEngineOrThrow(renderer_name).Clone();
+  }
+
   /** Implementation support for QueryObject::RenderColorImage().
    @pre All poses have already been updated.  */
   void RenderColorImage(const render::CameraProperties& camera,
@@ -511,6 +575,12 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageDepth32F* depth_image_out) const;
 
+  /** Implementation support for QueryObject::RenderDepthImage().
+   @pre All poses have already been updated.  */
+  void RenderDepthImage(const render::DepthCameraProperties& camera,
+                        FrameId parent_frame, const math::RigidTransformd& X_PC,
+                        systems::sensors::ImageDepth16U* depth_image_out) const;
+
   /** Implementation support for QueryObject::RenderLabelImage().
    @pre All poses have already been updated.  */
   void RenderLabelImage(const render::CameraProperties& camera,
@@ -551,6 +621,7 @@ class GeometryState {
         frames_(source.frames_),
         geometries_(source.geometries_),
         frame_index_to_id_map_(source.frame_index_to_id_map_),
+        frame_geometries_(source.frame_geometries_),
         geometry_engine_(std::move(source.geometry_engine_->ToAutoDiffXd())),
         render_engines_(source.render_engines_) {
     auto convert_pose_vector = [](const std::vector<math::RigidTransform<U>>& s,
@@ -630,9 +701,17 @@ class GeometryState {
                         const FrameKinematicsVector<ValueType>& values) const;
 
   // Method that performs any final book-keeping/updating on the state after
-  // _all_ of the state's frames have had their poses updated.
+  // _all_ of the state's frames have had their poses updated. It is the
+  // combination of FinalizeProximityPoseUpdate() and
+  // FinalizePerceptionPoseUpdate().
   void FinalizePoseUpdate();
 
+  // Pushes the current geometry poses to the proximity engine.
+  void FinalizeProximityPoseUpdate();
+
+  // Pushes the current geometry poses to the render engines.
+  void FinalizePerceptionPoseUpdate();
+
   // Gets the source id for the given frame id. Throws std::logic_error if the
   // frame belongs to no registered source.
   SourceId get_source_id(FrameId frame_id) const;
@@ -666,15 +745,18 @@ class GeometryState {
 
   // Recursively updates the frame and geometry _pose_ information for the tree
   // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
+  // as `X_WP`. If neither the parent (`parent_moved` is false) nor a frame of
+  // the tree moved relative to its parent since the last update, the poses
+  // are already up to date and are left as they are.
   void UpdatePosesRecursively(const internal::InternalFrame& frame,
                               const math::RigidTransform<T>& X_WP,
+                              bool parent_moved,
                               const FramePoseVector<T>& poses);
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
   bool is_dynamic(GeometryId id) const {
-    return geometries_.at(id).is_dynamic();
+    return geometries_->at(id).is_dynamic();
   }
 
   // Convenience function for accessing geometry whether dynamic or anchored.
@@ -752,32 +834,41 @@ class GeometryState {
   // runtime topology changes. This data should only change at _discrete_
   // events where frames/geometries are introduced and removed. They do _not_
   // depend on time-dependent input values (e.g., System::Context).
+  // Because they change so rarely, copies of the state (e.g., in cloned
+  // Contexts) share them until one of the copies changes its topology.
 
   // The registered geometry sources and the frame ids that have been registered
   // on them.
-  std::unordered_map<SourceId, FrameIdSet> source_frame_id_map_;
+  internal::CopyOnWrite<std::unordered_map<SourceId, FrameIdSet>>
+      source_frame_id_map_;
 
   // The registered geometry sources and the frame ids that have the world frame
   // as the parent frame. For a completely flat hierarchy, this contains the
   // same values as the corresponding entry in source_frame_id_map_.
-  std::unordered_map<SourceId, FrameIdSet> source_root_frame_map_;
+  internal::CopyOnWrite<std::unordered_map<SourceId, FrameIdSet>>
+      source_root_frame_map_;
 
   // The registered geometry source names. Each name is unique and the keys in
   // this map should be identical to those in source_frame_id_map_ and
   // source_root_frame_map_.
-  std::unordered_map<SourceId, std::string> source_names_;
+  internal::CopyOnWrite<std::unordered_map<SourceId, std::string>>
+      source_names_;
 
   // The registered geometry sources and the _anchored_ geometries that have
   // been registered on them. These don't fit in the frame hierarchy because
   // they do not belong to dynamic frames.
-  std::unordered_map<SourceId, std::unordered_set<GeometryId>>
+  internal::CopyOnWrite<
+      std::unordered_map<SourceId, std::unordered_set<GeometryId>>>
       source_anchored_geometry_map_;
 
   // The frame data, keyed on unique frame identifier.
-  std::unordered_map<FrameId, internal::InternalFrame> frames_;
+  internal::CopyOnWrite<std::unordered_map<FrameId, internal::InternalFrame>>
+      frames_;
 
   // The geometry data, keyed on unique geometry identifiers.
-  std::unordered_map<GeometryId, internal::InternalGeometry> geometries_;
+  internal::CopyOnWrite<
+      std::unordered_map<GeometryId, internal::InternalGeometry>>
+      geometries_;
 
   // This provides the look up from the internal index of a frame to its frame
   // id. It is constructed so that the index value of any position in the vector
@@ -787,7 +878,16 @@ class GeometryState {
   //   2. frame_index_to_id_map_.size() == biggest_index(frames_) + 1
   //      i.e. the largest pose index associated with frames_ is the last valid
   //      index of this vector.
-  std::vector<FrameId> frame_index_to_id_map_;
+  internal::CopyOnWrite<std::vector<FrameId>> frame_index_to_id_map_;
+
+  // The geometries rigidly affixed to each frame, with their poses in the
+  // frame, indexed by the frame's index. These are the geometries of the
+  // frame's child_geometries(), in no particular order, stored contiguously so
+  // that UpdatePosesRecursively() neither iterates over a hash set nor looks
+  // up geometries_ for each geometry. It is invariant that
+  // frame_geometries_.size() == frame_index_to_id_map_.size().
+  internal::CopyOnWrite<std::vector<std::vector<internal::FrameGeometry>>>
+      frame_geometries_;
 
   // ---------------------------------------------------------------------
   // These values depend on time-dependent input values (e.g., current frame
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/geometry/geometry_state.h"
 #include "drake/geometry/internal_geometry.h"
@@ -155,7 +156,7 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
   // role. These (plus possibly the world frame) are the frames that will be
   // broadcast in the message.
   std::vector<std::pair<FrameId, int>> dynamic_frames;
-  for (const auto& pair : state.frames_) {
+  for (const auto& pair : *state.frames_) {
     const FrameId frame_id = pair.first;
     // We'll handle the world frame special.
     if (frame_id == InternalFrame::world_frame_id()) continue;
@@ -203,9 +204,9 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
     message.link[0].geom.resize(anchored_count);
     int geom_index = 0;
     const InternalFrame& world_frame =
-        state.frames_.at(InternalFrame::world_frame_id());
+        state.frames_->at(InternalFrame::world_frame_id());
     for (const GeometryId id : world_frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(id);
+      const InternalGeometry& geometry = state.geometries_->at(id);
       const GeometryProperties* props = get_properties(geometry, role);
       if (props != nullptr) {
         const Shape& shape = geometry.shape();
@@ -223,7 +224,7 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
   for (const auto& pair : dynamic_frames) {
     const FrameId frame_id = pair.first;
     const int geometry_count = pair.second;
-    const internal::InternalFrame& frame = state.frames_.at(frame_id);
+    const internal::InternalFrame& frame = state.frames_->at(frame_id);
     SourceId s_id = state.get_source_id(frame.id());
     const std::string& src_name = state.get_source_name(s_id);
     // TODO(SeanCurtis-TRI): The name in the load message *must* match the name
@@ -235,7 +236,7 @@ lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
     message.link[link_index].geom.resize(geometry_count);
     int geom_index = 0;
     for (GeometryId geom_id : frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(geom_id);
+      const InternalGeometry& geometry = state.geometries_->at(geom_id);
       const GeometryProperties* props = get_properties(geometry, role);
       if (props != nullptr) {
         const Shape& shape = geometry.shape();
@@ -267,25 +268,34 @@ void DispatchLoadMessage(const SceneGraph<double>& scene_graph,
   Publish(lcm, "DRAKE_VIEWER_LOAD_ROBOT", message);
 }
 
-systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
+namespace {
+
+constexpr double kPublishPeriod = 1 / 60.0;
+
+systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizerImpl(
     systems::DiagramBuilder<double>* builder,
     const SceneGraph<double>& scene_graph,
     const systems::OutputPort<double>& pose_bundle_output_port,
+    const optional<systems::rendering::PoseDeltaParams>& delta_params,
     lcm::DrakeLcmInterface* lcm_optional, Role role) {
+  using systems::lcm::EncodedBytesSerializer;
   using systems::lcm::LcmPublisherSystem;
-  using systems::lcm::Serializer;
   using systems::rendering::PoseBundleToDrawMessage;
 
   DRAKE_DEMAND(builder != nullptr);
 
+  // In delta mode, the converter tracks what is sent at the publishing period.
   PoseBundleToDrawMessage* converter =
-      builder->template AddSystem<PoseBundleToDrawMessage>();
+      delta_params ? builder->template AddSystem<PoseBundleToDrawMessage>(
+                         kPublishPeriod, *delta_params)
+                   : builder->template AddSystem<PoseBundleToDrawMessage>();
 
+  // The publisher receives the bytes of lcmt_viewer_draw, which the
+  // converter encodes without building the message.
   LcmPublisherSystem* publisher =
       builder->template AddSystem<LcmPublisherSystem>(
-          "DRAKE_VIEWER_DRAW",
-          std::make_unique<Serializer<drake::lcmt_viewer_draw>>(),
-          lcm_optional, 1 / 60.0 /* publish period */);
+          "DRAKE_VIEWER_DRAW", std::make_unique<EncodedBytesSerializer>(),
+          lcm_optional, kPublishPeriod);
 
   // The functor we create in publisher here holds a reference to scene_graph,
   // which must therefore live as long as publisher does. We can count on that
@@ -301,11 +311,35 @@ systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
 
   // Note that this will fail if scene_graph is not actually in builder.
   builder->Connect(pose_bundle_output_port, converter->get_input_port(0));
-  builder->Connect(*converter, *publisher);
+  builder->Connect(converter->get_lcm_message_bytes_output_port(),
+                   publisher->get_input_port());
 
   return publisher;
 }
 
+}  // namespace
+
+systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
+    systems::DiagramBuilder<double>* builder,
+    const SceneGraph<double>& scene_graph,
+    const systems::OutputPort<double>& pose_bundle_output_port,
+    lcm::DrakeLcmInterface* lcm_optional, Role role) {
+  return ConnectDrakeVisualizerImpl(builder, scene_graph,
+                                    pose_bundle_output_port, nullopt,
+                                    lcm_optional, role);
+}
+
+systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
+    systems::DiagramBuilder<double>* builder,
+    const SceneGraph<double>& scene_graph,
+    const systems::OutputPort<double>& pose_bundle_output_port,
+    const systems::rendering::PoseDeltaParams& delta_params,
+    lcm::DrakeLcmInterface* lcm_optional, Role role) {
+  return ConnectDrakeVisualizerImpl(builder, scene_graph,
+                                    pose_bundle_output_port, delta_params,
+                                    lcm_optional, role);
+}
+
 systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
     systems::DiagramBuilder<double>* builder,
     const SceneGraph<double>& scene_graph, lcm::DrakeLcmInterface* lcm,
@@ -11,6 +11,7 @@
 #include "drake/lcmt_viewer_load_robot.hpp"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/lcm/lcm_publisher_system.h"
+#include "drake/systems/rendering/pose_bundle_to_draw_message.h"
 
 namespace drake {
 namespace geometry {
@@ -111,6 +112,25 @@ systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
     const systems::OutputPort<double>& pose_bundle_output_port,
     lcm::DrakeLcmInterface* lcm = nullptr, Role role = Role::kIllustration);
 
+/** Implements ConnectDrakeVisualizer, but with draw messages that only
+ contain the geometry frames whose poses have changed since they were last
+ sent, plus periodic keyframes of all frames (see
+ systems::rendering::PoseBundleToDrawMessage). For scenes with many visual
+ geometries of which few move at a time, this greatly reduces the size of the
+ draw messages.
+
+ @pre pose_bundle_output_port must be connected directly to the
+ pose_bundle_output_port of @p scene_graph.
+
+ @see ConnectDrakeVisualizer().
+ */
+systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
+    systems::DiagramBuilder<double>* builder,
+    const SceneGraph<double>& scene_graph,
+    const systems::OutputPort<double>& pose_bundle_output_port,
+    const systems::rendering::PoseDeltaParams& delta_params,
+    lcm::DrakeLcmInterface* lcm = nullptr, Role role = Role::kIllustration);
+
 /** (Advanced) Explicitly dispatches an LCM load message based on the registered
  geometry. Normally this is done automatically at Simulator initialization. But
  if you have to do it yourself (likely because you are not using a Simulator),
@@ -0,0 +1,59 @@
+#include "drake/geometry/proximity/bounding_volume_hierarchy.h"
+
+#include <cmath>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+bool Aabb::HasOverlap(const Aabb& a, const Aabb& b,
+                      const math::RigidTransform<double>& X_AB) {
+  // The separating axis test of two oriented boxes, as described in Section
+  // 4.4.1 of "Real-Time Collision Detection" by Christer Ericson. The 15
+  // candidate axes are the three axes of A, the three axes of B and the nine
+  // cross products of an axis of A with an axis of B. Everything is expressed
+  // in frame A.
+  const Vector3<double>& ha = a.half_width();
+  const Vector3<double>& hb = b.half_width();
+  const Matrix3<double>& R_AB = X_AB.rotation().matrix();
+  // The position of b's center relative to a's center.
+  const Vector3<double> p_AaBb = X_AB * b.center() - a.center();
+  // The epsilon guards the cross product axes against the case where two
+  // axes are (nearly) parallel and their cross product (nearly) vanishes.
+  const double kEpsilon = 1e-12;
+  const Matrix3<double> abs_R_AB =
+      R_AB.cwiseAbs() + Matrix3<double>::Constant(kEpsilon);
+
+  // The axes of A.
+  for (int i = 0; i < 3; ++i) {
+    if (std::abs(p_AaBb(i)) > ha(i) + abs_R_AB.row(i).dot(hb)) return false;
+  }
+
+  // The axes of B.
+  for (int j = 0; j < 3; ++j) {
+    if (std::abs(R_AB.col(j).dot(p_AaBb)) > abs_R_AB.col(j).dot(ha) + hb(j)) {
+      return false;
+    }
+  }
+
+  // The cross products Ai × Bj.
+  for (int i = 0; i < 3; ++i) {
+    const int i1 = (i + 1) % 3;
+    const int i2 = (i + 2) % 3;
+    for (int j = 0; j < 3; ++j) {
+      const int j1 = (j + 1) % 3;
+      const int j2 = (j + 2) % 3;
+      const double ra = ha(i1) * abs_R_AB(i2, j) + ha(i2) * abs_R_AB(i1, j);
+      const double rb = hb(j1) * abs_R_AB(i, j2) + hb(j2) * abs_R_AB(i, j1);
+      if (std::abs(p_AaBb(i2) * R_AB(i1, j) - p_AaBb(i1) * R_AB(i2, j)) >
+          ra + rb) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/extract_double.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/** Axis-aligned bounding box. The box is defined in the frame of the mesh it
+ bounds (frame M), by its center and its half widths along the axes of M.  */
+class Aabb {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Aabb)
+
+  /** Constructs the box with the given `center` and `half_width` (whose
+   entries must be non-negative), both measured and expressed in frame M.  */
+  Aabb(const Vector3<double>& center, const Vector3<double>& half_width)
+      : center_(center), half_width_(half_width) {
+    DRAKE_ASSERT((half_width.array() >= 0).all());
+  }
+
+  const Vector3<double>& center() const { return center_; }
+
+  const Vector3<double>& half_width() const { return half_width_; }
+
+  /** Reports whether the box `a`, defined in frame A, and the box `b`, defined
+   in frame B, overlap, when frame B has the pose `X_AB` in frame A. Since `b`
+   is, in general, not aligned with the axes of A, this uses the separating
+   axis test for oriented boxes. The test is conservative: touching boxes are
+   reported as overlapping.  */
+  static bool HasOverlap(const Aabb& a, const Aabb& b,
+                         const math::RigidTransform<double>& X_AB);
+
+ private:
+  Vector3<double> center_;
+  Vector3<double> half_width_;
+};
+
+/** A bounding volume hierarchy (a binary tree of Aabb) over the elements of a
+ mesh, which can be a SurfaceMesh (whose elements are triangles) or a
+ VolumeMesh (whose elements are tetrahedra). It is used to cull the pairs of
+ elements of two meshes that cannot intersect, in time proportional to the
+ number of overlapping pairs instead of the product of the number of
+ elements.
+
+ The boxes are defined in the frame M of the mesh. Because the vertex positions
+ of a mesh are fixed in M, the hierarchy remains valid when the pose of the
+ mesh changes and only needs to be built once per mesh; the relative pose of
+ the two meshes is accounted for at query time (see CollideCandidates()).
+
+ For a mesh whose scalar is AutoDiffXd, the boxes bound the values of the
+ vertex positions.
+
+ @tparam MeshType SurfaceMesh<T> or VolumeMesh<T>.  */
+template <class MeshType>
+class BoundingVolumeHierarchy {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BoundingVolumeHierarchy)
+
+  using ElementIndex = typename MeshType::ElementIndex;
+
+  /** A node of the tree. A leaf node bounds the elements in the range
+   [begin, end) of element_order(); an internal node bounds the union of its
+   two children.  */
+  struct Node {
+    Aabb aabb;
+    // Child nodes (indices into nodes()) of an internal node, -1 for a leaf.
+    int left{-1};
+    int right{-1};
+    // Elements of a leaf node.
+    int begin{0};
+    int end{0};
+
+    bool is_leaf() const { return left < 0; }
+  };
+
+  /** Builds the hierarchy of the elements of `mesh` (which must have at least
+   one element), with at most `max_elements_per_leaf` elements per leaf. The
+   mesh is only used during construction.  */
+  explicit BoundingVolumeHierarchy(const MeshType& mesh,
+                                   int max_elements_per_leaf = 1);
+
+  /** Returns the nodes of the tree; the first one is the root.  */
+  const std::vector<Node>& nodes() const { return nodes_; }
+
+  /** Returns the permutation of the element indices referenced by the leaves.
+   */
+  const std::vector<ElementIndex>& element_order() const {
+    return element_order_;
+  }
+
+  /** Returns the pairs (e_A, e_B) of the elements of this hierarchy's mesh A
+   and of `bvh_B`'s mesh B whose bounding boxes overlap, when frame B has the
+   pose `X_AB` in frame A. All the pairs of elements that intersect are
+   reported (possibly along with some that do not). The pairs are sorted in
+   increasing order of e_A, then of e_B.  */
+  template <class OtherMeshType>
+  std::vector<
+      std::pair<ElementIndex, typename OtherMeshType::ElementIndex>>
+  CollideCandidates(const BoundingVolumeHierarchy<OtherMeshType>& bvh_B,
+                    const math::RigidTransform<double>& X_AB) const {
+    std::vector<std::pair<ElementIndex, typename OtherMeshType::ElementIndex>>
+        pairs;
+    // Stack of the pairs of nodes (of this and of bvh_B) to test.
+    std::vector<std::pair<int, int>> stack{{0, 0}};
+    while (!stack.empty()) {
+      const int index_a = stack.back().first;
+      const int index_b = stack.back().second;
+      stack.pop_back();
+      const Node& node_a = nodes_[index_a];
+      const auto& node_b = bvh_B.nodes()[index_b];
+      if (!Aabb::HasOverlap(node_a.aabb, node_b.aabb, X_AB)) continue;
+      if (node_a.is_leaf() && node_b.is_leaf()) {
+        for (int i = node_a.begin; i < node_a.end; ++i) {
+          for (int j = node_b.begin; j < node_b.end; ++j) {
+            pairs.emplace_back(element_order_[i], bvh_B.element_order()[j]);
+          }
+        }
+      } else if (node_b.is_leaf() ||
+                 (!node_a.is_leaf() && node_a.end - node_a.begin >=
+                                           node_b.end - node_b.begin)) {
+        // Descend into the node with more elements.
+        stack.emplace_back(node_a.left, index_b);
+        stack.emplace_back(node_a.right, index_b);
+      } else {
+        stack.emplace_back(index_a, node_b.left);
+        stack.emplace_back(index_a, node_b.right);
+      }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  }
+
+ private:
+  // Appends the node that bounds the elements [begin, end) of element_order_
+  // (and, recursively, its descendants) and returns its index.
+  int BuildNode(int begin, int end, int max_elements_per_leaf);
+
+  // The bounding box and the centroid of each element, indexed by element.
+  std::vector<Vector3<double>> element_lower_;
+  std::vector<Vector3<double>> element_upper_;
+  std::vector<Vector3<double>> element_centroid_;
+
+  std::vector<Node> nodes_;
+  std::vector<ElementIndex> element_order_;
+};
+
+template <class MeshType>
+BoundingVolumeHierarchy<MeshType>::BoundingVolumeHierarchy(
+    const MeshType& mesh, int max_elements_per_leaf) {
+  DRAKE_DEMAND(mesh.num_elements() > 0);
+  DRAKE_DEMAND(max_elements_per_leaf >= 1);
+  const int num_elements = mesh.num_elements();
+  element_lower_.resize(num_elements);
+  element_upper_.resize(num_elements);
+  element_centroid_.resize(num_elements);
+  element_order_.reserve(num_elements);
+  for (ElementIndex e(0); e < num_elements; ++e) {
+    Vector3<double> lower =
+        Vector3<double>::Constant(std::numeric_limits<double>::infinity());
+    Vector3<double> upper = -lower;
+    Vector3<double> centroid = Vector3<double>::Zero();
+    for (int v = 0; v < MeshType::kDim + 1; ++v) {
+      const auto& r_MV = mesh.vertex(mesh.element(e).vertex(v)).r_MV();
+      Vector3<double> p_MV;
+      for (int i = 0; i < 3; ++i) p_MV(i) = ExtractDoubleOrThrow(r_MV(i));
+      lower = lower.cwiseMin(p_MV);
+      upper = upper.cwiseMax(p_MV);
+      centroid += p_MV;
+    }
+    element_lower_[e] = lower;
+    element_upper_[e] = upper;
+    element_centroid_[e] = centroid / (MeshType::kDim + 1);
+    element_order_.push_back(e);
+  }
+  nodes_.reserve(2 * num_elements);
+  BuildNode(0, num_elements, max_elements_per_leaf);
+
+  // The per-element data is only needed while building the tree.
+  element_lower_.clear();
+  element_upper_.clear();
+  element_centroid_.clear();
+}
+
+template <class MeshType>
+int BoundingVolumeHierarchy<MeshType>::BuildNode(int begin, int end,
+                                                 int max_elements_per_leaf) {
+  Vector3<double> lower =
+      Vector3<double>::Constant(std::numeric_limits<double>::infinity());
+  Vector3<double> upper = -lower;
+  Vector3<double> centroid_lower = lower;
+  Vector3<double> centroid_upper = upper;
+  for (int i = begin; i < end; ++i) {
+    const ElementIndex e = element_order_[i];
+    lower = lower.cwiseMin(element_lower_[e]);
+    upper = upper.cwiseMax(element_upper_[e]);
+    centroid_lower = centroid_lower.cwiseMin(element_centroid_[e]);
+    centroid_upper = centroid_upper.cwiseMax(element_centroid_[e]);
+  }
+  const int index = static_cast<int>(nodes_.size());
+  nodes_.push_back(Node{Aabb((lower + upper) / 2, (upper - lower) / 2)});
+  if (end - begin <= max_elements_per_leaf) {
+    nodes_[index].begin = begin;
+    nodes_[index].end = end;
+    return index;
+  }
+
+  // Split at the median of the centroids along the axis along which they are
+  // the most spread out.
+  int axis{};
+  (centroid_upper - centroid_lower).maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(element_order_.begin() + begin,
+                   element_order_.begin() + middle,
+                   element_order_.begin() + end,
+                   [this, axis](ElementIndex e1, ElementIndex e2) {
+                     return element_centroid_[e1](axis) <
+                            element_centroid_[e2](axis);
+                   });
+  const int left = BuildNode(begin, middle, max_elements_per_leaf);
+  const int right = BuildNode(middle, end, max_elements_per_leaf);
+  // Note: nodes_ may have been reallocated by the recursive calls.
+  nodes_[index].left = left;
+  nodes_[index].right = right;
+  nodes_[index].begin = begin;
+  nodes_[index].end = end;
+  return index;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -26,7 +28,15 @@ namespace internal {
 
  Geometries are identified by their encoded ids (see EncodedData). Before a
  geometry can be added to a clique (AddToCollisionClique()) it must be added
- to this filter system (AddGeometry()).  */
+ to this filter system (AddGeometry()).
+
+ Since CanCollideWith() is called for every candidate pair of the broadphase,
+ each geometry also has a 64-bit mask of its cliques, in which clique c sets
+ bit c % 64. Two geometries whose masks don't intersect share no clique, which
+ is decided with a single AND. While no more than 64 cliques have been
+ allocated, the bits are in one-to-one correspondence with the cliques, and
+ the masks decide every pair; beyond that, the pairs whose masks intersect
+ fall back to intersecting the sorted clique lists.  */
 class CollisionFilterLegacy {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CollisionFilterLegacy)
@@ -36,7 +46,7 @@ class CollisionFilterLegacy {
   /** Adds a geometry to the filter system as represented by its encoded `id`
    (see EncodedData). When added, it will not be part of any filtered pairs.  */
   void AddGeometry(uintptr_t id) {
-    collision_cliques_.insert({id, std::vector<int>()});
+    collision_cliques_.insert({id, GeometryCliques()});
   }
 
   /** Removes the geometry represented by its encoded `id` from the data. If
@@ -52,11 +62,13 @@ class CollisionFilterLegacy {
     DRAKE_ASSERT(collision_cliques_.count(id_A) == 1);
     DRAKE_ASSERT(collision_cliques_.count(id_B) == 1);
 
-    bool excluded = id_A == id_B ||
-                    SortedVectorsHaveIntersection(collision_cliques_.at(id_A),
-                                                  collision_cliques_.at(id_B));
-
-    return !excluded;
+    if (id_A == id_B) return false;
+    const GeometryCliques& cliques_A = collision_cliques_.at(id_A);
+    const GeometryCliques& cliques_B = collision_cliques_.at(id_B);
+    if ((cliques_A.mask & cliques_B.mask) == 0) return true;
+    if (next_available_clique_ <= kMaskBits) return false;
+    return !SortedVectorsHaveIntersection(cliques_A.cliques,
+                                          cliques_B.cliques);
   }
 
   /** Adds the previously registered geometry indicated by its encoded id
@@ -64,7 +76,9 @@ class CollisionFilterLegacy {
   void AddToCollisionClique(uintptr_t geometry_id, int clique_id) {
     DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
 
-    std::vector<int>& cliques = collision_cliques_[geometry_id];
+    GeometryCliques& geometry_cliques = collision_cliques_[geometry_id];
+    geometry_cliques.mask |= uint64_t{1} << (clique_id % kMaskBits);
+    std::vector<int>& cliques = geometry_cliques.cliques;
     // Order(N) insertion.
     // `cliques` is a sorted vector so that checking if two collision elements
     // belong to a common group can be performed efficiently in order N.
@@ -78,7 +92,7 @@ class CollisionFilterLegacy {
 
   int num_cliques(uintptr_t geometry_id) const {
     DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
-    return static_cast<int>(collision_cliques_.at(geometry_id).size());
+    return static_cast<int>(collision_cliques_.at(geometry_id).cliques.size());
   }
 
   /** Allocates a new clique and returns its id (to use with
@@ -100,9 +114,20 @@ class CollisionFilterLegacy {
   int peek_next_clique() const { return next_available_clique_; }
 
  private:
+  // The number of bits of GeometryCliques::mask.
+  static constexpr int kMaskBits = 64;
+
+  // The cliques of a geometry.
+  struct GeometryCliques {
+    // The sorted clique ids.
+    std::vector<int> cliques;
+    // Bit c % kMaskBits is set for each clique c in `cliques`.
+    uint64_t mask{0};
+  };
+
   // A map between the EncodedData::encoding() value for a geometry and
   // its set of cliques.
-  std::unordered_map<uintptr_t, std::vector<int>> collision_cliques_;
+  std::unordered_map<uintptr_t, GeometryCliques> collision_cliques_;
 
   int next_available_clique_{0};
 };
@@ -0,0 +1,130 @@
+#include "drake/geometry/proximity/convex_disk_cache.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "drake/common/hash.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// Changing the format requires changing the magic string, which is part of
+// the names of the cache files.
+constexpr char kMagic[8] = {'D', 'C', 'V', 'X', '0', '0', '1', '\0'};
+
+struct Header {
+  char magic[8];
+  int64_t num_faces;
+  int64_t num_vertices;
+  int64_t faces_size;
+};
+static_assert(sizeof(Header) == 32, "The header must keep its size");
+
+}  // namespace
+
+std::string GetConvexCacheFilename(const std::string& obj_filename) {
+  const char* const directory =
+      std::getenv(kGeometryCacheDirEnvironmentVariableName);
+  if (directory == nullptr || directory[0] == '\0') return {};
+
+  std::ifstream file(obj_filename, std::ios::binary);
+  if (!file) return {};
+  drake::internal::FNV1aHasher hasher;
+  char buffer[1 << 16];
+  while (file) {
+    file.read(buffer, sizeof(buffer));
+    hasher(buffer, static_cast<size_t>(file.gcount()));
+  }
+  if (file.bad()) return {};
+
+  if (::mkdir(directory, 0777) != 0 && errno != EEXIST) {
+    drake::log()->debug("Cannot create the geometry cache directory '{}': {}",
+                        directory, std::strerror(errno));
+    return {};
+  }
+  return fmt::format("{}/{}-{:016x}.bin", directory, kMagic,
+                     static_cast<size_t>(hasher));
+}
+
+optional<ConvexMeshData> ReadConvexCache(const std::string& cache_filename) {
+  std::ifstream file(cache_filename, std::ios::binary);
+  if (!file) return nullopt;
+  Header header;
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.num_faces < 0 || header.num_vertices < 0 ||
+      header.faces_size < header.num_faces) {
+    return nullopt;
+  }
+  // The sizes must match the size of the file, so that a corrupted header
+  // can't make us allocate arbitrarily large arrays.
+  file.seekg(0, std::ios::end);
+  const int64_t expected_size = sizeof(Header) +
+      header.num_vertices * sizeof(Eigen::Vector3d) +
+      header.faces_size * sizeof(int32_t);
+  if (static_cast<int64_t>(file.tellg()) != expected_size) return nullopt;
+  file.seekg(sizeof(Header));
+
+  ConvexMeshData data;
+  data.num_faces = static_cast<int>(header.num_faces);
+  data.vertices.resize(header.num_vertices);
+  std::vector<int32_t> faces(header.faces_size);
+  file.read(reinterpret_cast<char*>(data.vertices.data()),
+            header.num_vertices * sizeof(Eigen::Vector3d));
+  file.read(reinterpret_cast<char*>(faces.data()),
+            header.faces_size * sizeof(int32_t));
+  if (!file) return nullopt;
+  data.faces.assign(faces.begin(), faces.end());
+  return data;
+}
+
+bool WriteConvexCache(const std::string& cache_filename,
+                      const ConvexMeshData& data) {
+  // The temporary file is unique to this thread, since several threads may
+  // write the same cache file (for copies of an .obj file).
+  const std::string temp_filename = fmt::format(
+      "{}.{}.{}.tmp", cache_filename, ::getpid(),
+      std::hash<std::thread::id>()(std::this_thread::get_id()));
+  {
+    std::ofstream file(temp_filename, std::ios::binary);
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.num_faces = data.num_faces;
+    header.num_vertices = static_cast<int64_t>(data.vertices.size());
+    header.faces_size = static_cast<int64_t>(data.faces.size());
+    const std::vector<int32_t> faces(data.faces.begin(), data.faces.end());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(data.vertices.data()),
+               data.vertices.size() * sizeof(Eigen::Vector3d));
+    file.write(reinterpret_cast<const char*>(faces.data()),
+               faces.size() * sizeof(int32_t));
+    file.close();
+    if (!file) {
+      std::remove(temp_filename.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temp_filename.c_str(), cache_filename.c_str()) != 0) {
+    std::remove(temp_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_optional.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/** The environment variable that enables the on-disk cache of the Convex
+ geometries parsed from .obj files, by naming the directory of the cache. The
+ directory is created if needed (but not its parents). When the variable is
+ unset or empty, nothing is cached on disk.  */
+constexpr char kGeometryCacheDirEnvironmentVariableName[] =
+    "DRAKE_GEOMETRY_CACHE_DIR";
+
+/** The vertices and the faces of a Convex, in the format of fcl::Convex: for
+ each face, the number of its vertices followed by their indices.  */
+struct ConvexMeshData {
+  std::vector<Eigen::Vector3d> vertices;
+  int num_faces{};
+  std::vector<int> faces;
+};
+
+/** Returns the name of the cache file of the .obj file `obj_filename` in the
+ cache directory (see kGeometryCacheDirEnvironmentVariableName). The name is
+ made of a hash of the contents of the .obj file, so that a cache file is
+ shared by all of the copies of an .obj file, and is never stale. Returns an
+ empty string if the cache is disabled, or if the .obj file can't be read.  */
+std::string GetConvexCacheFilename(const std::string& obj_filename);
+
+/** Reads the cache file `cache_filename` written by WriteConvexCache(), or
+ returns nullopt if it doesn't exist or isn't valid.
+
+ The file is a 32-byte header (a magic string, the number of faces, and the
+ sizes of the two arrays), followed by the coordinates of the vertices as
+ doubles and by the faces as 32-bit integers, in the native byte order; the
+ arrays are aligned so that the file could be mapped in place.  */
+optional<ConvexMeshData> ReadConvexCache(const std::string& cache_filename);
+
+/** Writes `data` into the cache file `cache_filename`, through a temporary
+ file which is renamed when complete, so that concurrent readers and writers
+ never see a partial file. Returns false if the file couldn't be written,
+ which the callers may ignore: the cache is only an optimization.  */
+bool WriteConvexCache(const std::string& cache_filename,
+                      const ConvexMeshData& data);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,670 @@
+#include "drake/geometry/proximity/convex_penetration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace convex_penetration {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+ConvexHull::ConvexHull(std::vector<Vector3d> vertices_G,
+                       const std::vector<int>& faces, int num_faces)
+    : vertices_G_(std::move(vertices_G)) {
+  const int num_vertices = this->num_vertices();
+  DRAKE_DEMAND(num_vertices > 0);
+
+  // Collects the edges of the faces, in both directions.
+  std::vector<std::pair<int, int>> edges;
+  int index = 0;
+  for (int f = 0; f < num_faces; ++f) {
+    const int size = faces[index];
+    for (int i = 0; i < size; ++i) {
+      const int u = faces[index + 1 + i];
+      const int v = faces[index + 1 + (i + 1) % size];
+      DRAKE_DEMAND(0 <= u && u < num_vertices && 0 <= v && v < num_vertices);
+      if (u == v) continue;
+      edges.emplace_back(u, v);
+      edges.emplace_back(v, u);
+    }
+    index += size + 1;
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  neighbor_offsets_.assign(num_vertices + 1, 0);
+  for (const auto& edge : edges) ++neighbor_offsets_[edge.first + 1];
+  for (int v = 0; v < num_vertices; ++v) {
+    neighbor_offsets_[v + 1] += neighbor_offsets_[v];
+  }
+  neighbors_.reserve(edges.size());
+  for (const auto& edge : edges) neighbors_.push_back(edge.second);
+
+  // Hill climbing can only reach the vertices connected to the start one.
+  std::vector<bool> reached(num_vertices, false);
+  std::vector<int> stack{0};
+  reached[0] = true;
+  int num_reached = 1;
+  while (!stack.empty()) {
+    const int v = stack.back();
+    stack.pop_back();
+    for (int i = neighbor_offsets_[v]; i < neighbor_offsets_[v + 1]; ++i) {
+      if (!reached[neighbors_[i]]) {
+        reached[neighbors_[i]] = true;
+        ++num_reached;
+        stack.push_back(neighbors_[i]);
+      }
+    }
+  }
+  use_hill_climbing_ = num_reached == num_vertices;
+}
+
+int ConvexHull::FindSupportVertex(const Vector3d& dir_G, int start) const {
+  if (!use_hill_climbing_) {
+    int best = 0;
+    double best_value = dir_G.dot(vertices_G_[0]);
+    for (int v = 1; v < num_vertices(); ++v) {
+      const double value = dir_G.dot(vertices_G_[v]);
+      if (value > best_value) {
+        best = v;
+        best_value = value;
+      }
+    }
+    return best;
+  }
+
+  int best = (0 <= start && start < num_vertices()) ? start : 0;
+  double best_value = dir_G.dot(vertices_G_[best]);
+  // Move to the best neighbor until no neighbor is farther along dir_G; this
+  // terminates since the value strictly increases.
+  while (true) {
+    int next = best;
+    for (int i = neighbor_offsets_[best]; i < neighbor_offsets_[best + 1];
+         ++i) {
+      const double value = dir_G.dot(vertices_G_[neighbors_[i]]);
+      if (value > best_value) {
+        next = neighbors_[i];
+        best_value = value;
+      }
+    }
+    if (next == best) return best;
+    best = next;
+  }
+}
+
+namespace {
+
+// A point w = a - b of the Minkowski difference A ⊖ B, with the points a of A
+// and b of B it comes from, all in the world frame.
+struct SupportPoint {
+  Vector3d w;
+  Vector3d a;
+  Vector3d b;
+};
+
+// The support mapping of the Minkowski difference A ⊖ B of two posed hulls.
+// The support vertices of the hulls are kept in the pair cache, to start the
+// next searches from.
+class MinkowskiDifference {
+ public:
+  MinkowskiDifference(const ConvexHull& hull_A, const RigidTransformd& X_WA,
+                      const ConvexHull& hull_B, const RigidTransformd& X_WB,
+                      PairCache* cache)
+      : hull_A_(hull_A),
+        X_WA_(X_WA),
+        R_AW_(X_WA.rotation().matrix().transpose()),
+        hull_B_(hull_B),
+        X_WB_(X_WB),
+        R_BW_(X_WB.rotation().matrix().transpose()),
+        cache_(*cache) {}
+
+  // Returns the point w of A ⊖ B maximizing dir_W⋅w.
+  SupportPoint Support(const Vector3d& dir_W) const {
+    cache_.support_A =
+        hull_A_.FindSupportVertex(R_AW_ * dir_W, cache_.support_A);
+    cache_.support_B =
+        hull_B_.FindSupportVertex(-(R_BW_ * dir_W), cache_.support_B);
+    SupportPoint point;
+    point.a = X_WA_ * hull_A_.vertex(cache_.support_A);
+    point.b = X_WB_ * hull_B_.vertex(cache_.support_B);
+    point.w = point.a - point.b;
+    return point;
+  }
+
+ private:
+  const ConvexHull& hull_A_;
+  const RigidTransformd& X_WA_;
+  const Matrix3d R_AW_;
+  const ConvexHull& hull_B_;
+  const RigidTransformd& X_WB_;
+  const Matrix3d R_BW_;
+  PairCache& cache_;
+};
+
+// A simplex of up to four points of the Minkowski difference.
+struct Simplex {
+  SupportPoint points[4];
+  int size{0};
+};
+
+// The relative tolerance of the convergence tests.
+constexpr double kTolerance = 1e-10;
+
+// Returns the point of the segment ab closest to the origin, and sets
+// `result` to the smallest sub-simplex containing it.
+Vector3d ClosestOnSegment(const SupportPoint& a, const SupportPoint& b,
+                          Simplex* result) {
+  const Vector3d ab = b.w - a.w;
+  const double t = -a.w.dot(ab);
+  const double length_squared = ab.squaredNorm();
+  if (t <= 0 || length_squared == 0) {
+    result->points[0] = a;
+    result->size = 1;
+    return a.w;
+  }
+  if (t >= length_squared) {
+    result->points[0] = b;
+    result->size = 1;
+    return b.w;
+  }
+  result->points[0] = a;
+  result->points[1] = b;
+  result->size = 2;
+  return a.w + (t / length_squared) * ab;
+}
+
+// Returns the point of the triangle abc closest to the origin, and sets
+// `result` to the smallest sub-simplex containing it. See Ericson, Real-Time
+// Collision Detection, section 5.1.5.
+Vector3d ClosestOnTriangle(const SupportPoint& a, const SupportPoint& b,
+                           const SupportPoint& c, Simplex* result) {
+  const Vector3d ab = b.w - a.w;
+  const Vector3d ac = c.w - a.w;
+  const double d1 = -ab.dot(a.w);
+  const double d2 = -ac.dot(a.w);
+  if (d1 <= 0 && d2 <= 0) {
+    result->points[0] = a;
+    result->size = 1;
+    return a.w;
+  }
+  const double d3 = -ab.dot(b.w);
+  const double d4 = -ac.dot(b.w);
+  if (d3 >= 0 && d4 <= d3) {
+    result->points[0] = b;
+    result->size = 1;
+    return b.w;
+  }
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    return ClosestOnSegment(a, b, result);
+  }
+  const double d5 = -ab.dot(c.w);
+  const double d6 = -ac.dot(c.w);
+  if (d6 >= 0 && d5 <= d6) {
+    result->points[0] = c;
+    result->size = 1;
+    return c.w;
+  }
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    return ClosestOnSegment(a, c, result);
+  }
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+    return ClosestOnSegment(b, c, result);
+  }
+  const double sum = va + vb + vc;
+  if (sum == 0) {
+    // A degenerate triangle; it is covered by its edges.
+    Simplex ab_result, ac_result;
+    const Vector3d p = ClosestOnSegment(a, b, &ab_result);
+    const Vector3d q = ClosestOnSegment(a, c, &ac_result);
+    *result = p.squaredNorm() <= q.squaredNorm() ? ab_result : ac_result;
+    return p.squaredNorm() <= q.squaredNorm() ? p : q;
+  }
+  result->points[0] = a;
+  result->points[1] = b;
+  result->points[2] = c;
+  result->size = 3;
+  return a.w + (vb / sum) * ab + (vc / sum) * ac;
+}
+
+// Returns the point of the tetrahedron in `simplex` closest to the origin, and
+// sets `result` to the smallest sub-simplex containing it (the tetrahedron
+// itself if it contains the origin).
+Vector3d ClosestOnTetrahedron(const Simplex& simplex, Simplex* result) {
+  const SupportPoint* p = simplex.points;
+  const Vector3d ab = p[1].w - p[0].w;
+  const Vector3d ac = p[2].w - p[0].w;
+  const Vector3d ad = p[3].w - p[0].w;
+  const double volume = ab.dot(ac.cross(ad));
+  const bool degenerate = std::abs(volume) <=
+      kTolerance * ab.norm() * ac.norm() * ad.norm();
+  // Each face, followed by the opposite vertex.
+  const int faces[4][4] = {{0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 3, 1},
+                           {1, 2, 3, 0}};
+  bool inside = !degenerate;
+  double best_distance_squared = std::numeric_limits<double>::infinity();
+  Vector3d best = Vector3d::Zero();
+  for (const auto& face : faces) {
+    const Vector3d& v0 = p[face[0]].w;
+    const Vector3d n = (p[face[1]].w - v0).cross(p[face[2]].w - v0);
+    const double origin_side = -v0.dot(n);
+    const double opposite_side = (p[face[3]].w - v0).dot(n);
+    // Only the faces that separate the origin from the opposite vertex can
+    // hold the closest point.
+    if (!degenerate && origin_side * opposite_side >= 0) continue;
+    inside = false;
+    Simplex face_result;
+    const Vector3d q = ClosestOnTriangle(p[face[0]], p[face[1]], p[face[2]],
+                                         &face_result);
+    if (q.squaredNorm() < best_distance_squared) {
+      best_distance_squared = q.squaredNorm();
+      best = q;
+      *result = face_result;
+    }
+  }
+  if (inside) {
+    *result = simplex;
+    return Vector3d::Zero();
+  }
+  return best;
+}
+
+// Returns the point of `simplex` closest to the origin, reducing `simplex` to
+// the smallest sub-simplex containing it.
+Vector3d ReduceSimplex(Simplex* simplex) {
+  Simplex result;
+  Vector3d v;
+  switch (simplex->size) {
+    case 1:
+      return simplex->points[0].w;
+    case 2:
+      v = ClosestOnSegment(simplex->points[0], simplex->points[1], &result);
+      break;
+    case 3:
+      v = ClosestOnTriangle(simplex->points[0], simplex->points[1],
+                            simplex->points[2], &result);
+      break;
+    default:
+      DRAKE_DEMAND(simplex->size == 4);
+      v = ClosestOnTetrahedron(*simplex, &result);
+  }
+  *simplex = result;
+  return v;
+}
+
+enum class GjkStatus { kSeparated, kPenetrating };
+
+// Runs GJK from the direction `v` (which need not be a point of the Minkowski
+// difference), until either a direction separating the Minkowski difference
+// from the origin is found (with v set to it), or the simplex encloses the
+// origin. Touching hulls count as separated.
+GjkStatus RunGjk(const MinkowskiDifference& difference, Vector3d* v,
+                 Simplex* simplex) {
+  constexpr int kMaxIterations = 128;
+  if (v->squaredNorm() == 0) *v = Vector3d::UnitX();
+  simplex->size = 0;
+  // Whether v is the closest point of the simplex, rather than the initial
+  // direction.
+  bool v_in_simplex = false;
+  double scale_squared = 0;
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    const SupportPoint w = difference.Support(-*v);
+    const double v_dot_w = v->dot(w.w);
+    // The plane normal to v through w separates the origin from the
+    // Minkowski difference.
+    if (v_dot_w > 0) return GjkStatus::kSeparated;
+    const double v_squared = v->squaredNorm();
+    // No progress toward the origin: it is (within tolerance) on the boundary.
+    if (v_in_simplex && v_squared - v_dot_w <= kTolerance * v_squared) {
+      return GjkStatus::kSeparated;
+    }
+    scale_squared = std::max(scale_squared, w.w.squaredNorm());
+    simplex->points[simplex->size++] = w;
+    *v = ReduceSimplex(simplex);
+    v_in_simplex = true;
+    if (simplex->size == 4 ||
+        v->squaredNorm() <= kTolerance * kTolerance * scale_squared) {
+      return GjkStatus::kPenetrating;
+    }
+  }
+  return GjkStatus::kSeparated;
+}
+
+enum class GjkDistanceStatus { kSeparated, kBeyondMaxDistance, kPenetrating };
+
+// Like RunGjk(), but runs until v is the point of the Minkowski difference
+// closest to the origin (with the simplex reduced to the smallest one holding
+// it), unless a support plane proves the hulls farther apart than
+// `max_distance` first: for the support point w in the direction -v, v⋅w/|v|
+// is a lower bound on the signed distance.
+GjkDistanceStatus RunGjkDistance(const MinkowskiDifference& difference,
+                                 double max_distance, Vector3d* v,
+                                 Simplex* simplex) {
+  constexpr int kMaxIterations = 128;
+  if (v->squaredNorm() == 0) *v = Vector3d::UnitX();
+  simplex->size = 0;
+  bool v_in_simplex = false;
+  double scale_squared = 0;
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    const SupportPoint w = difference.Support(-*v);
+    const double v_dot_w = v->dot(w.w);
+    const double v_squared = v->squaredNorm();
+    if (v_dot_w > max_distance * std::sqrt(v_squared)) {
+      return GjkDistanceStatus::kBeyondMaxDistance;
+    }
+    // No progress toward the origin: v is the closest point.
+    if (v_in_simplex && v_squared - v_dot_w <= kTolerance * v_squared) {
+      return GjkDistanceStatus::kSeparated;
+    }
+    scale_squared = std::max(scale_squared, w.w.squaredNorm());
+    simplex->points[simplex->size++] = w;
+    *v = ReduceSimplex(simplex);
+    v_in_simplex = true;
+    if (simplex->size == 4 ||
+        v->squaredNorm() <= kTolerance * kTolerance * scale_squared) {
+      return GjkDistanceStatus::kPenetrating;
+    }
+  }
+  return GjkDistanceStatus::kSeparated;
+}
+
+// Sets p_WCa and p_WCb to the points of A and B whose difference is the point
+// p of the triangle abc, from the barycentric coordinates of p. Returns false
+// if the triangle is degenerate.
+bool CalcTriangleWitnessPoints(const SupportPoint& a, const SupportPoint& b,
+                               const SupportPoint& c, const Vector3d& p,
+                               Vector3d* p_WCa, Vector3d* p_WCb) {
+  const Vector3d v0 = b.w - a.w;
+  const Vector3d v1 = c.w - a.w;
+  const Vector3d v2 = p - a.w;
+  const double d00 = v0.dot(v0);
+  const double d01 = v0.dot(v1);
+  const double d11 = v1.dot(v1);
+  const double d20 = v2.dot(v0);
+  const double d21 = v2.dot(v1);
+  const double denominator = d00 * d11 - d01 * d01;
+  if (denominator == 0) return false;
+  const double beta = (d11 * d20 - d01 * d21) / denominator;
+  const double gamma = (d00 * d21 - d01 * d20) / denominator;
+  const double alpha = 1 - beta - gamma;
+  *p_WCa = alpha * a.a + beta * b.a + gamma * c.a;
+  *p_WCb = alpha * a.b + beta * b.b + gamma * c.b;
+  return true;
+}
+
+// Sets p_WCa and p_WCb to the points of A and B whose difference is v, the
+// point of `simplex` closest to the origin, as reduced by ReduceSimplex().
+void CalcWitnessPoints(const Simplex& simplex, const Vector3d& v,
+                       Vector3d* p_WCa, Vector3d* p_WCb) {
+  const SupportPoint* p = simplex.points;
+  if (simplex.size == 2) {
+    const Vector3d ab = p[1].w - p[0].w;
+    const double t = (v - p[0].w).dot(ab) / ab.squaredNorm();
+    *p_WCa = p[0].a + t * (p[1].a - p[0].a);
+    *p_WCb = p[0].b + t * (p[1].b - p[0].b);
+    return;
+  }
+  if (simplex.size == 3 &&
+      CalcTriangleWitnessPoints(p[0], p[1], p[2], v, p_WCa, p_WCb)) {
+    return;
+  }
+  *p_WCa = p[0].a;
+  *p_WCb = p[0].b;
+}
+
+// Grows the simplex enclosing the origin (possibly on its boundary) into a
+// non-degenerate tetrahedron, for EPA. Returns false if the Minkowski
+// difference is too thin to hold one.
+bool CompleteTetrahedron(const MinkowskiDifference& difference,
+                         Simplex* simplex) {
+  auto tolerance = [simplex]() {
+    double scale = 1;
+    for (int i = 0; i < simplex->size; ++i) {
+      scale = std::max(scale, simplex->points[i].w.norm());
+    }
+    return kTolerance * scale;
+  };
+  if (simplex->size == 1) {
+    for (int i = 0; i < 6 && simplex->size == 1; ++i) {
+      Vector3d dir = Vector3d::Zero();
+      dir(i / 2) = i % 2 == 0 ? 1 : -1;
+      const SupportPoint w = difference.Support(dir);
+      if ((w.w - simplex->points[0].w).norm() > tolerance()) {
+        simplex->points[simplex->size++] = w;
+      }
+    }
+    if (simplex->size == 1) return false;
+  }
+  if (simplex->size == 2) {
+    const Vector3d d =
+        (simplex->points[1].w - simplex->points[0].w).normalized();
+    int axis = 0;
+    d.cwiseAbs().minCoeff(&axis);
+    const Vector3d n1 = d.cross(Vector3d::Unit(axis)).normalized();
+    const Vector3d n2 = d.cross(n1);
+    for (int i = 0; i < 6 && simplex->size == 2; ++i) {
+      const double angle = i * M_PI / 3;
+      const SupportPoint w =
+          difference.Support(std::cos(angle) * n1 + std::sin(angle) * n2);
+      const Vector3d r = w.w - simplex->points[0].w;
+      if ((r - r.dot(d) * d).norm() > tolerance()) {
+        simplex->points[simplex->size++] = w;
+      }
+    }
+    if (simplex->size == 2) return false;
+  }
+  if (simplex->size == 3) {
+    const Vector3d& w0 = simplex->points[0].w;
+    const Vector3d n = (simplex->points[1].w - w0)
+                           .cross(simplex->points[2].w - w0)
+                           .normalized();
+    for (const double sign : {1.0, -1.0}) {
+      const SupportPoint w = difference.Support(sign * n);
+      if (std::abs(n.dot(w.w - w0)) > tolerance()) {
+        simplex->points[simplex->size++] = w;
+        break;
+      }
+    }
+    if (simplex->size == 3) return false;
+  }
+  return true;
+}
+
+// A triangular face of the EPA polytope, with its outward unit normal and its
+// distance to the origin.
+struct Face {
+  int v[3];
+  Vector3d normal;
+  double distance{};
+  bool removed{false};
+};
+
+// Runs EPA from the tetrahedron `simplex`, which encloses the origin, to find
+// the point of the boundary of the Minkowski difference closest to the origin.
+// Returns false if no penetration can be determined (e.g., the hulls only
+// touch).
+bool RunEpa(const MinkowskiDifference& difference, const Simplex& simplex,
+            Penetration* penetration) {
+  constexpr int kMaxIterations = 128;
+  std::vector<SupportPoint> vertices(simplex.points, simplex.points + 4);
+  // Orient the tetrahedron so that the faces below have outward normals.
+  if ((vertices[3].w - vertices[0].w)
+          .dot((vertices[1].w - vertices[0].w)
+                   .cross(vertices[2].w - vertices[0].w)) > 0) {
+    std::swap(vertices[1], vertices[2]);
+  }
+  std::vector<Face> faces;
+  auto add_face = [&vertices, &faces](int i, int j, int k) {
+    Face face{{i, j, k}, Vector3d::Zero(), 0, false};
+    const Vector3d n = (vertices[j].w - vertices[i].w)
+                           .cross(vertices[k].w - vertices[i].w);
+    const double norm = n.norm();
+    if (norm == 0) return false;
+    face.normal = n / norm;
+    face.distance = face.normal.dot(vertices[i].w);
+    faces.push_back(face);
+    return true;
+  };
+  if (!add_face(0, 1, 2) || !add_face(0, 3, 1) || !add_face(0, 2, 3) ||
+      !add_face(1, 3, 2)) {
+    return false;
+  }
+
+  int closest = -1;
+  std::vector<std::pair<int, int>> horizon;
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    closest = -1;
+    for (int f = 0; f < static_cast<int>(faces.size()); ++f) {
+      if (faces[f].removed) continue;
+      if (closest < 0 || faces[f].distance < faces[closest].distance) {
+        closest = f;
+      }
+    }
+    if (closest < 0) return false;
+    const Vector3d normal = faces[closest].normal;
+    const double distance = faces[closest].distance;
+    const SupportPoint w = difference.Support(normal);
+    const double w_distance = normal.dot(w.w);
+    if (w_distance - distance <=
+        kTolerance * std::max(1.0, std::abs(w_distance))) {
+      break;
+    }
+
+    // Remove the faces that w sees, and replace them with the faces joining
+    // w to the boundary of the removed region (the horizon).
+    const int new_vertex = static_cast<int>(vertices.size());
+    vertices.push_back(w);
+    horizon.clear();
+    for (Face& face : faces) {
+      if (face.removed ||
+          face.normal.dot(w.w - vertices[face.v[0]].w) <= 0) {
+        continue;
+      }
+      face.removed = true;
+      for (int i = 0; i < 3; ++i) {
+        const std::pair<int, int> edge(face.v[i], face.v[(i + 1) % 3]);
+        auto reverse = std::find(horizon.begin(), horizon.end(),
+                                 std::make_pair(edge.second, edge.first));
+        if (reverse != horizon.end()) {
+          horizon.erase(reverse);
+        } else {
+          horizon.push_back(edge);
+        }
+      }
+    }
+    bool valid = true;
+    for (const auto& edge : horizon) {
+      valid = add_face(edge.first, edge.second, new_vertex) && valid;
+    }
+    if (!valid) break;
+  }
+
+  const Face& face = faces[closest];
+  // The closest point is the projection of the origin on the face; its
+  // barycentric coordinates give the witness points.
+  const Vector3d p = face.distance * face.normal;
+  if (!CalcTriangleWitnessPoints(vertices[face.v[0]], vertices[face.v[1]],
+                                 vertices[face.v[2]], p, &penetration->p_WCa,
+                                 &penetration->p_WCb)) {
+    return false;
+  }
+  penetration->depth = face.distance;
+  // The outward normal of A ⊖ B points out of A and into B.
+  penetration->nhat_BA_W = -face.normal;
+  return true;
+}
+
+}  // namespace
+
+bool ComputePenetration(const ConvexHull& hull_A, const RigidTransformd& X_WA,
+                        const ConvexHull& hull_B, const RigidTransformd& X_WB,
+                        PairCache* cache, Penetration* penetration) {
+  DRAKE_DEMAND(cache != nullptr);
+  DRAKE_DEMAND(penetration != nullptr);
+  const MinkowskiDifference difference(hull_A, X_WA, hull_B, X_WB, cache);
+
+  Vector3d v = cache->direction_W;
+  Simplex simplex;
+  if (RunGjk(difference, &v, &simplex) == GjkStatus::kSeparated) {
+    cache->direction_W = v;
+    return false;
+  }
+  Penetration result;
+  if (!CompleteTetrahedron(difference, &simplex) ||
+      !RunEpa(difference, simplex, &result)) {
+    return false;
+  }
+  cache->direction_W = result.nhat_BA_W;
+  // Like the other penetration queries, osculation is not reported.
+  if (result.depth <= std::numeric_limits<double>::epsilon()) return false;
+  *penetration = result;
+  return true;
+}
+
+bool ComputeSignedDistance(const ConvexHull& hull_A,
+                           const RigidTransformd& X_WA,
+                           const ConvexHull& hull_B,
+                           const RigidTransformd& X_WB, double max_distance,
+                           PairCache* cache, SignedDistance* result) {
+  DRAKE_DEMAND(cache != nullptr);
+  DRAKE_DEMAND(result != nullptr);
+  const MinkowskiDifference difference(hull_A, X_WA, hull_B, X_WB, cache);
+
+  Vector3d v = cache->direction_W;
+  Simplex simplex;
+  const GjkDistanceStatus status =
+      RunGjkDistance(difference, max_distance, &v, &simplex);
+  if (status != GjkDistanceStatus::kPenetrating) {
+    cache->direction_W = v;
+    const double distance = v.norm();
+    if (status == GjkDistanceStatus::kBeyondMaxDistance ||
+        distance > max_distance) {
+      return false;
+    }
+    result->distance = distance;
+    CalcWitnessPoints(simplex, v, &result->p_WCa, &result->p_WCb);
+    result->nhat_BA_W = v / distance;
+    return true;
+  }
+
+  Penetration penetration;
+  if (!CompleteTetrahedron(difference, &simplex) ||
+      !RunEpa(difference, simplex, &penetration)) {
+    // The hulls only touch (or the Minkowski difference is too thin to
+    // resolve their penetration); the witness points are taken from the
+    // support points around the origin.
+    if (max_distance < 0) return false;
+    result->distance = 0;
+    result->p_WCa.setZero();
+    result->p_WCb.setZero();
+    for (int i = 0; i < simplex.size; ++i) {
+      result->p_WCa += simplex.points[i].a / simplex.size;
+      result->p_WCb += simplex.points[i].b / simplex.size;
+    }
+    result->nhat_BA_W =
+        Vector3d::Constant(std::numeric_limits<double>::quiet_NaN());
+    return true;
+  }
+  cache->direction_W = penetration.nhat_BA_W;
+  if (-penetration.depth > max_distance) return false;
+  result->distance = -penetration.depth;
+  result->p_WCa = penetration.p_WCa;
+  result->p_WCb = penetration.p_WCb;
+  result->nhat_BA_W = penetration.nhat_BA_W;
+  return true;
+}
+
+}  // namespace convex_penetration
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
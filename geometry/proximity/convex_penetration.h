@@ -0,0 +1,145 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace convex_penetration {
+
+/** The vertices of a convex polytope G, measured and expressed in its frame,
+ along with the graph of its edges. The graph supports finding the vertex
+ farthest along a direction (the "support" vertex) by hill climbing: starting
+ from any vertex, moving to a neighbor farther along the direction until there
+ is none. On a convex polytope, this ends at a support vertex, and only visits
+ a few vertices when started from the support vertex of a nearby direction
+ (e.g., that of the previous time step).  */
+class ConvexHull {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ConvexHull)
+
+  /** Constructs the hull from its vertices and faces.
+   @param vertices_G  The vertex positions, in frame G.
+   @param faces       The faces, in the format of fcl::Convex: for each face,
+                      its number of vertices followed by their indices.
+   @param num_faces   The number of faces in `faces`.
+   @pre There is at least one vertex, and all indices are valid.  */
+  ConvexHull(std::vector<Vector3<double>> vertices_G,
+             const std::vector<int>& faces, int num_faces);
+
+  int num_vertices() const { return static_cast<int>(vertices_G_.size()); }
+
+  /** Returns the position of the vertex `v`, in frame G.  */
+  const Vector3<double>& vertex(int v) const { return vertices_G_[v]; }
+
+  /** Returns the index of a vertex V maximizing `dir_G`⋅p_GV, searching from
+   the vertex `start`.  */
+  int FindSupportVertex(const Vector3<double>& dir_G, int start) const;
+
+ private:
+  std::vector<Vector3<double>> vertices_G_;
+  // The neighbors of vertex v are neighbors_[neighbor_offsets_[v]] through
+  // neighbors_[neighbor_offsets_[v + 1] - 1].
+  std::vector<int> neighbor_offsets_;
+  std::vector<int> neighbors_;
+  // False if some vertices can't be reached from the others through the
+  // edges, in which case all of the vertices are searched.
+  bool use_hill_climbing_{true};
+};
+
+/** The state of the query between a pair of hulls that persists from one
+ query to the next. The queries between geometries that move little between
+ time steps start from the results of the previous ones: the direction that
+ separated them (which often still does, proving them separated at the cost
+ of a single support vertex per hull) and their support vertices.  */
+struct PairCache {
+  /** The separating direction found by the previous query (or the contact
+   normal, if the hulls penetrated), or zero if there was none.  */
+  Vector3<double> direction_W{Vector3<double>::Zero()};
+  int support_A{0};
+  int support_B{0};
+};
+
+/** The penetration between two hulls A and B.  */
+struct Penetration {
+  /** The penetration depth, i.e., the length of the shortest translation that
+   separates the hulls.  */
+  double depth{};
+  /** The point of A deepest in B, in the world frame.  */
+  Vector3<double> p_WCa;
+  /** The point of B deepest in A, in the world frame.  */
+  Vector3<double> p_WCb;
+  /** The unit normal pointing out of B and into A (the direction in which A
+   must be translated by `depth` to separate them), in the world frame.  */
+  Vector3<double> nhat_BA_W;
+};
+
+/** Determines whether the hulls A and B, with the given poses in the world
+ frame, penetrate, and if so, computes their penetration. Separation is
+ determined with GJK (warm started from `cache`), and the penetration with EPA
+ only if they do penetrate.
+ @param[in]     hull_A      The hull A.
+ @param[in]     X_WA        The pose of A in the world frame.
+ @param[in]     hull_B      The hull B.
+ @param[in]     X_WB        The pose of B in the world frame.
+ @param[in,out] cache       The state of the previous query between A and B,
+                            updated for the next one.
+ @param[out]    penetration The penetration, set only if the hulls penetrate.
+ @returns true if the hulls penetrate by more than machine epsilon.
+ @pre `cache` and `penetration` are not null.  */
+bool ComputePenetration(const ConvexHull& hull_A,
+                        const math::RigidTransform<double>& X_WA,
+                        const ConvexHull& hull_B,
+                        const math::RigidTransform<double>& X_WB,
+                        PairCache* cache, Penetration* penetration);
+
+/** The signed distance between two hulls A and B.  */
+struct SignedDistance {
+  /** The distance between the hulls if they are separated, or the negative of
+   their penetration depth if they penetrate.  */
+  double distance{};
+  /** The witness point of A, in the world frame: the point of A closest to B,
+   or deepest in B.  */
+  Vector3<double> p_WCa;
+  /** The witness point of B, in the world frame.  */
+  Vector3<double> p_WCb;
+  /** The unit direction in which translating A increases the distance the
+   fastest, in the world frame, i.e., (p_WCa - p_WCb) / distance. It is NaN if
+   the hulls only touch.  */
+  Vector3<double> nhat_BA_W;
+};
+
+/** Computes the signed distance between the hulls A and B, with the given
+ poses in the world frame, if it is at most `max_distance`. The distance is
+ computed with GJK (warm started from `cache`, which it shares with
+ ComputePenetration()), and the penetration with EPA only if the hulls
+ penetrate. GJK stops as soon as one of its support planes proves the hulls
+ farther apart than `max_distance`, which usually takes a single iteration for
+ distant pairs from a warm start.
+ @param[in]     hull_A        The hull A.
+ @param[in]     X_WA          The pose of A in the world frame.
+ @param[in]     hull_B        The hull B.
+ @param[in]     X_WB          The pose of B in the world frame.
+ @param[in]     max_distance  The distance beyond which the hulls are not
+                              reported.
+ @param[in,out] cache         The state of the previous query between A and
+                              B, updated for the next one.
+ @param[out]    result        The signed distance, set only if it is at most
+                              `max_distance`.
+ @returns true if the signed distance is at most `max_distance`.
+ @pre `cache` and `result` are not null.  */
+bool ComputeSignedDistance(const ConvexHull& hull_A,
+                           const math::RigidTransform<double>& X_WA,
+                           const ConvexHull& hull_B,
+                           const math::RigidTransform<double>& X_WB,
+                           double max_distance, PairCache* cache,
+                           SignedDistance* result);
+
+}  // namespace convex_penetration
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -9,7 +9,9 @@
 #include <fmt/format.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/bounding_volume_hierarchy.h"
 #include "drake/geometry/proximity/collision_filter_legacy.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -24,6 +26,50 @@ namespace geometry {
 namespace internal {
 namespace hydroelastic {
 
+struct SoftGeometry {
+  std::unique_ptr<VolumeMesh<double>> mesh;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> p0;
+};
+
+/** The representations of geometries that persist from one contact surface
+ query to the next, so that they are not rebuilt at every time step. The
+ meshes (and their bounding volume hierarchies) of a geometry only depend on
+ its shape, so they remain valid as long as the geometry exists; the owner of
+ the cache must Clear() it when geometries are removed.  */
+struct GeometryCache {
+  /** The soft volume mesh and pressure field of a geometry, with the bounding
+   volume hierarchy of the mesh.  */
+  struct Soft {
+    SoftGeometry geometry;
+    std::unique_ptr<const BoundingVolumeHierarchy<VolumeMesh<double>>> bvh;
+  };
+
+  /** The rigid surface mesh of a geometry, with its bounding volume
+   hierarchy.  */
+  struct Rigid {
+    std::unique_ptr<const SurfaceMesh<double>> mesh;
+    std::unique_ptr<const BoundingVolumeHierarchy<SurfaceMesh<double>>> bvh;
+  };
+
+  /** The size of the contact surface last computed for a pair of geometries.
+   In resting contact, it changes little from one step to the next, so the
+   storage of the next contact surface is sized after it.  */
+  struct SurfaceSize {
+    int num_faces{0};
+    int num_vertices{0};
+  };
+
+  std::unordered_map<GeometryId, Soft> soft;
+  std::unordered_map<GeometryId, Rigid> rigid;
+  std::unordered_map<SortedPair<GeometryId>, SurfaceSize> surface_sizes;
+
+  void Clear() {
+    soft.clear();
+    rigid.clear();
+    surface_sizes.clear();
+  }
+};
+
 /** Supporting data for the shape-to-shape hydroelastic contact callback (see
  Callback below). It includes:
 
@@ -32,6 +78,9 @@ namespace hydroelastic {
       each indexed by its corresponding geometry's GeometryId.
     - A vector of contact surfaces -- one instance of ContactSurface for
       every supported, unfiltered penetrating pair.
+    - Optionally, a cache of the geometry representations from previous
+      queries.
+    - The representation of the meshes of the contact surfaces.
 
  @tparam T The computation scalar.  */
 template <typename T>
@@ -42,14 +91,24 @@ struct CallbackData {
 
    @param collision_filter_in     The collision filter system. Aliased.
    @param X_WGs_in                The T-valued poses. Aliased.
-   @param surfaces_in             The output results. Aliased.  */
+   @param surfaces_in             The output results. Aliased.
+   @param cache_in                The geometry cache, or nullptr to build the
+                                  geometry representations for this query
+                                  only. Aliased.
+   @param representation_in       The representation of the meshes of the
+                                  contact surfaces.  */
   CallbackData(
       const CollisionFilterLegacy* collision_filter_in,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs_in,
-      std::vector<ContactSurface<T>>* surfaces_in)
+      std::vector<ContactSurface<T>>* surfaces_in,
+      GeometryCache* cache_in = nullptr,
+      HydroelasticContactRepresentation representation_in =
+          HydroelasticContactRepresentation::kTriangle)
       : collision_filter(*collision_filter_in),
         X_WGs(*X_WGs_in),
-        surfaces(*surfaces_in) {
+        surfaces(*surfaces_in),
+        cache(cache_in),
+        representation(representation_in) {
     DRAKE_DEMAND(collision_filter_in);
     DRAKE_DEMAND(X_WGs_in);
     DRAKE_DEMAND(surfaces_in);
@@ -63,6 +122,12 @@ struct CallbackData {
 
   /** The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces{};
+
+  /** The geometry cache, if any.  */
+  GeometryCache* const cache{};
+
+  /** The representation of the meshes of the contact surfaces.  */
+  const HydroelasticContactRepresentation representation{};
 };
 
 // TODO(SeanCurtis-TRI): Remove these two functions (MakeBoxMeshFromFcl and
@@ -80,11 +145,6 @@ SurfaceMesh<double> MakeBoxMeshFromFcl(fcl::CollisionObjectd* object_ptr) {
   return MakeBoxSurfaceMesh<double>(box, edge_length);
 }
 
-struct SoftGeometry {
-  std::unique_ptr<VolumeMesh<double>> mesh;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> p0;
-};
-
 /** Given an object_ptr whose geometry is a sphere, creates a coarse volume mesh
  field for that sphere.  */
 SoftGeometry MakeSphereFromFcl(
@@ -114,8 +174,32 @@ SoftGeometry MakeSphereFromFcl(
   return geometry;
 }
 
+/** Given an object_ptr whose geometry is a sphere, creates its soft
+ representation (see MakeSphereFromFcl()) along with the bounding volume
+ hierarchy of its mesh.  */
+GeometryCache::Soft MakeSoftSphereFromFcl(fcl::CollisionObjectd* object_ptr) {
+  GeometryCache::Soft soft;
+  soft.geometry = MakeSphereFromFcl(object_ptr);
+  soft.bvh =
+      std::make_unique<const BoundingVolumeHierarchy<VolumeMesh<double>>>(
+          *soft.geometry.mesh);
+  return soft;
+}
+
+/** Returns the soft representation of the sphere geometry with the given id
+ and object_ptr from the cache, adding it first if needed.  */
+const GeometryCache::Soft& FindOrMakeSoftSphere(
+    GeometryId id, fcl::CollisionObjectd* object_ptr, GeometryCache* cache) {
+  auto iter = cache->soft.find(id);
+  if (iter == cache->soft.end()) {
+    iter = cache->soft.emplace(id, MakeSoftSphereFromFcl(object_ptr)).first;
+  }
+  return iter->second;
+}
+
 /** The callback function for computing a hydroelastic contact surface between
- two arbitrary shapes.
+ two arbitrary shapes. Currently, boxes are rigid and spheres are soft; the
+ supported pairs are a box and a sphere, and two spheres.
 
  @param object_A_ptr    Pointer to the first object in the pair (the order has
                         no significance).
@@ -145,7 +229,8 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
     fcl::NODE_TYPE b_type = object_B_ptr->getNodeType();
 
     const bool valid =(a_type == fcl::GEOM_BOX && b_type == fcl::GEOM_SPHERE) ||
-        (a_type == fcl::GEOM_SPHERE && b_type == fcl::GEOM_BOX);
+        (a_type == fcl::GEOM_SPHERE && b_type == fcl::GEOM_BOX) ||
+        (a_type == fcl::GEOM_SPHERE && b_type == fcl::GEOM_SPHERE);
     if (!valid) {
       throw std::logic_error(fmt::format(
           "Can't compute a contact surface between geometries {} ({}) and "
@@ -154,6 +239,33 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
           to_string(encoding_b.id()), GetGeometryName(*object_B_ptr)));
     }
 
+    if (a_type == fcl::GEOM_SPHERE && b_type == fcl::GEOM_SPHERE) {
+      // Both spheres are soft.
+      const GeometryId id_a = encoding_a.id();
+      const GeometryId id_b = encoding_b.id();
+      GeometryCache::Soft local_a;
+      GeometryCache::Soft local_b;
+      if (data.cache == nullptr) {
+        local_a = MakeSoftSphereFromFcl(object_A_ptr);
+        local_b = MakeSoftSphereFromFcl(object_B_ptr);
+      }
+      const GeometryCache::Soft& soft_a =
+          data.cache == nullptr
+              ? local_a
+              : FindOrMakeSoftSphere(id_a, object_A_ptr, data.cache);
+      const GeometryCache::Soft& soft_b =
+          data.cache == nullptr
+              ? local_b
+              : FindOrMakeSoftSphere(id_b, object_B_ptr, data.cache);
+      std::unique_ptr<ContactSurface<T>> surface =
+          mesh_intersection::ComputeContactSurfaceFromSoftVolumeSoftVolume(
+              id_a, *soft_a.geometry.p0, *soft_a.bvh, data.X_WGs.at(id_a),
+              id_b, *soft_b.geometry.p0, *soft_b.bvh, data.X_WGs.at(id_b),
+              data.representation);
+      data.surfaces.emplace_back(std::move(*surface));
+      return false;
+    }
+
     fcl::CollisionObjectd* object_box_ptr{};
     fcl::CollisionObjectd* object_sphere_ptr{};
     GeometryId box_id;
@@ -170,13 +282,53 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
       sphere_id = encoding_a.id();
     }
 
-    SurfaceMesh<double> box_mesh = MakeBoxMeshFromFcl(object_box_ptr);
-    // Build the sphere.
-    SoftGeometry soft_sphere = MakeSphereFromFcl(object_sphere_ptr);
+    if (data.cache == nullptr) {
+      SurfaceMesh<double> box_mesh = MakeBoxMeshFromFcl(object_box_ptr);
+      // Build the sphere.
+      SoftGeometry soft_sphere = MakeSphereFromFcl(object_sphere_ptr);
+      if (data.representation == HydroelasticContactRepresentation::kPolygon) {
+        const BoundingVolumeHierarchy<VolumeMesh<double>> sphere_bvh(
+            *soft_sphere.mesh);
+        const BoundingVolumeHierarchy<SurfaceMesh<double>> box_bvh(box_mesh);
+        std::unique_ptr<ContactSurface<T>> surface =
+            mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+                sphere_id, *soft_sphere.p0, sphere_bvh,
+                data.X_WGs.at(sphere_id), box_id, box_mesh, box_bvh,
+                data.X_WGs.at(box_id), 0, 0, data.representation);
+        data.surfaces.emplace_back(std::move(*surface));
+        return false;
+      }
+      std::unique_ptr<ContactSurface<T>> surface =
+          mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+              sphere_id, *soft_sphere.p0, data.X_WGs.at(sphere_id), box_id,
+              box_mesh, data.X_WGs.at(box_id));
+      data.surfaces.emplace_back(std::move(*surface));
+      return false;
+    }
+
+    GeometryCache& cache = *data.cache;
+    auto rigid_iter = cache.rigid.find(box_id);
+    if (rigid_iter == cache.rigid.end()) {
+      GeometryCache::Rigid rigid;
+      auto mesh = std::make_unique<const SurfaceMesh<double>>(
+          MakeBoxMeshFromFcl(object_box_ptr));
+      rigid.bvh = std::make_unique<
+          const BoundingVolumeHierarchy<SurfaceMesh<double>>>(*mesh);
+      rigid.mesh = std::move(mesh);
+      rigid_iter = cache.rigid.emplace(box_id, std::move(rigid)).first;
+    }
+    const GeometryCache::Rigid& rigid = rigid_iter->second;
+    const GeometryCache::Soft& soft =
+        FindOrMakeSoftSphere(sphere_id, object_sphere_ptr, &cache);
+    GeometryCache::SurfaceSize& size =
+        cache.surface_sizes[SortedPair<GeometryId>(sphere_id, box_id)];
     std::unique_ptr<ContactSurface<T>> surface =
         mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
-            sphere_id, *soft_sphere.p0, data.X_WGs.at(sphere_id), box_id,
-            box_mesh, data.X_WGs.at(box_id));
+            sphere_id, *soft.geometry.p0, *soft.bvh, data.X_WGs.at(sphere_id),
+            box_id, *rigid.mesh, *rigid.bvh, data.X_WGs.at(box_id),
+            size.num_faces, size.num_vertices, data.representation);
+    size.num_faces = surface->num_faces();
+    size.num_vertices = surface->num_vertices();
 
     data.surfaces.emplace_back(std::move(*surface));
   }
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -99,6 +100,14 @@ namespace geometry {
 
  Linear tetrahedral elements are similar.
 
+ <h3>Scalar fields on volume meshes</h3>
+
+ A scalar field on a tetrahedral mesh is the affine function
+ u(p) = ∇u⋅p + u(Mo) in each tetrahedron, where Mo is the origin of the mesh's
+ frame. Its gradient and its value at Mo are computed for every tetrahedron at
+ construction, so that EvaluateCartesian() is a single dot product, without
+ computing barycentric coordinates, and EvaluateGradient() is a lookup.
+
  @tparam FieldValue  a valid Eigen scalar or vector of valid Eigen scalars for
                      the field value.
  @tparam MeshType    the type of the meshes: surface mesh or volume mesh.
@@ -122,6 +131,7 @@ class MeshFieldLinear final : public MeshField<FieldValue, MeshType> {
         name_(std::move(name)), values_(std::move(values)) {
     DRAKE_DEMAND(static_cast<int>(values_.size()) ==
                  this->mesh().num_vertices());
+    if constexpr (kCachesGradients) CalcGradients();
   }
 
   FieldValue EvaluateAtVertex(typename MeshType::VertexIndex v) const final {
@@ -141,12 +151,34 @@ class MeshFieldLinear final : public MeshField<FieldValue, MeshType> {
   FieldValue EvaluateCartesian(
                  typename MeshType::ElementIndex e,
                  const typename MeshType::Cartesian& p_MQ) const final {
-    return Evaluate(e, this->mesh().CalcBarycentric(p_MQ, e));
+    if constexpr (kCachesGradients) {
+      return gradients_[e].dot(p_MQ) + values_at_Mo_[e];
+    } else {
+      return Evaluate(e, this->mesh().CalcBarycentric(p_MQ, e));
+    }
+  }
+
+  /** Returns the gradient of the field in the element `e`, expressed in the
+   mesh's frame M. It is only available for scalar fields on volume meshes
+   (see the class documentation).  */
+  const typename MeshType::Cartesian& EvaluateGradient(
+      typename MeshType::ElementIndex e) const {
+    static_assert(kCachesGradients,
+                  "Only scalar fields on volume meshes have their gradients");
+    return gradients_[e];
   }
 
   const std::string& name() const { return name_; }
   const std::vector<FieldValue>& values() const { return values_; }
-  std::vector<FieldValue>& mutable_values() { return values_; }
+
+  /** Returns the mutable field values. It is not available for scalar fields
+   on volume meshes, whose gradients are computed from their values at
+   construction.  */
+  std::vector<FieldValue>& mutable_values() {
+    static_assert(!kCachesGradients,
+                  "The values of a field with gradients can't be changed");
+    return values_;
+  }
 
  private:
   // Clones MeshFieldLinear data under the assumption that the mesh
@@ -155,10 +187,45 @@ class MeshFieldLinear final : public MeshField<FieldValue, MeshType> {
   DoCloneWithNullMesh() const final {
     return std::make_unique<MeshFieldLinear>(*this);
   }
+
+  // Scalar fields on tetrahedral meshes cache their gradients.
+  static constexpr bool kCachesGradients =
+      MeshType::kDim == 3 &&
+      std::is_same<FieldValue,
+                   typename MeshType::Cartesian::Scalar>::value;
+
+  // Calculates gradients_ and values_at_Mo_ for all the elements.
+  void CalcGradients() {
+    const MeshType& mesh = this->mesh();
+    gradients_.resize(mesh.num_elements());
+    values_at_Mo_.resize(mesh.num_elements());
+    for (typename MeshType::ElementIndex e(0); e < mesh.num_elements(); ++e) {
+      const auto& element = mesh.element(e);
+      const typename MeshType::Cartesian& p_MV0 =
+          mesh.vertex(element.vertex(0)).r_MV();
+      const FieldValue& value0 = values_[element.vertex(0)];
+      // The gradient g satisfies g⋅(p_MVᵢ - p_MV₀) = uᵢ - u₀, i = 1, 2, 3.
+      Eigen::Matrix<FieldValue, 3, 3> A;
+      typename MeshType::Cartesian b;
+      for (int i = 1; i < 4; ++i) {
+        A.row(i - 1) =
+            (mesh.vertex(element.vertex(i)).r_MV() - p_MV0).transpose();
+        b(i - 1) = values_[element.vertex(i)] - value0;
+      }
+      gradients_[e] = A.partialPivLu().solve(b);
+      values_at_Mo_[e] = value0 - gradients_[e].dot(p_MV0);
+    }
+  }
+
   std::string name_;
   // The field values are indexed in the same way as vertices, i.e.,
   // values_[i] is the field value for the mesh vertices_[i].
   std::vector<FieldValue> values_;
+  // For scalar fields on volume meshes, the gradient of the field in each
+  // element, expressed in the mesh's frame M, and the value at Mo of the
+  // affine function of the element.
+  std::vector<typename MeshType::Cartesian> gradients_;
+  std::vector<FieldValue> values_at_Mo_;
 };
 
 /**
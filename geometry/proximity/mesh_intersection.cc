@@ -1,9 +1,122 @@
 #include "drake/geometry/proximity/mesh_intersection.h"
 
+#include <algorithm>
+
 namespace drake {
 namespace geometry {
 namespace mesh_intersection {
 
+namespace {
+
+// The maximum number of vertices of the polygons produced while clipping a
+// triangle by the four half spaces of a tetrahedron: each half space adds at
+// most one vertex to a convex polygon.
+constexpr int kMaxPolygonSize = 7;
+
+// A polygon with a fixed capacity, kept on the stack.
+struct FixedPolygon {
+  int size{0};
+  Vector3<double> vertices[kMaxPolygonSize];
+};
+
+// Clips the `input` polygon by the half space n̂⋅x⃗ - d <= 0 into `output`.
+// This is ClipPolygonByHalfSpace() (and CalcIntersection()) with the same
+// arithmetic, but with the signed distances of all the vertices computed up
+// front.
+void ClipFixedPolygonByHalfSpace(const FixedPolygon& input,
+                                 const Vector3<double>& n, double d,
+                                 FixedPolygon* output) {
+  double distance[kMaxPolygonSize];
+  int num_outside = 0;
+  for (int i = 0; i < input.size; ++i) {
+    distance[i] = n.dot(input.vertices[i]) - d;
+    num_outside += distance[i] > 0;
+  }
+  if (num_outside == 0) {
+    *output = input;
+    return;
+  }
+  output->size = 0;
+  if (num_outside == input.size) return;
+
+  for (int i = 0, previous = input.size - 1; i < input.size; previous = i++) {
+    const bool current_contained = distance[i] <= 0;
+    const bool previous_contained = distance[previous] <= 0;
+    if (current_contained != previous_contained) {
+      // The edge crosses the boundary of the half space.
+      const double a = distance[i];
+      const double b = distance[previous];
+      const double wa = b / (b - a);
+      const double wb = 1.0 - wa;
+      DRAKE_DEMAND(output->size < kMaxPolygonSize);
+      output->vertices[output->size++] =
+          wa * input.vertices[i] + wb * input.vertices[previous];
+    }
+    if (current_contained) {
+      DRAKE_DEMAND(output->size < kMaxPolygonSize);
+      output->vertices[output->size++] = input.vertices[i];
+    }
+  }
+}
+
+// This is RemoveDuplicateVertices() on a FixedPolygon.
+void RemoveFixedPolygonDuplicateVertices(FixedPolygon* polygon) {
+  if (polygon->size <= 1) return;
+  auto near = [](const Vector3<double>& p, const Vector3<double>& q) -> bool {
+    const double kEpsSquared(1e-14 * 1e-14);
+    return (p - q).squaredNorm() < kEpsSquared;
+  };
+  Vector3<double>* const begin = polygon->vertices;
+  polygon->size = std::unique(begin, begin + polygon->size, near) - begin;
+  if (polygon->size >= 3 && near(begin[0], begin[polygon->size - 1])) {
+    --polygon->size;
+  }
+}
+
+}  // namespace
+
+void ClipTriangleByTetrahedron(
+    VolumeElementIndex element, const VolumeMesh<double>& volume_M,
+    SurfaceFaceIndex face, const SurfaceMesh<double>& surface_N,
+    const math::RigidTransform<double>& X_MN,
+    std::vector<Vector3<double>>* polygon_M) {
+  DRAKE_DEMAND(polygon_M != nullptr);
+  // The polygon is clipped back and forth between these two.
+  FixedPolygon polygons[2];
+  int current = 0;
+  polygons[current].size = 3;
+  for (int i = 0; i < 3; ++i) {
+    const SurfaceVertexIndex v = surface_N.element(face).vertex(i);
+    polygons[current].vertices[i] = X_MN * surface_N.vertex(v).r_MV();
+  }
+  Vector3<double> p_MVs[4];
+  for (int i = 0; i < 4; ++i) {
+    const VolumeVertexIndex v = volume_M.element(element).vertex(i);
+    p_MVs[i] = volume_M.vertex(v).r_MV();
+  }
+  // The faces of the tetrahedron, with outward right-handed normals; see the
+  // reference implementation.
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+  for (const auto& face_vertex : faces) {
+    const Vector3<double>& p_MA = p_MVs[face_vertex[0]];
+    const Vector3<double>& p_MB = p_MVs[face_vertex[1]];
+    const Vector3<double>& p_MC = p_MVs[face_vertex[2]];
+    const Vector3<double> normal_M =
+        (p_MB - p_MA).cross(p_MC - p_MA).normalized();
+    const double height = normal_M.dot(p_MA);
+    ClipFixedPolygonByHalfSpace(polygons[current], normal_M, height,
+                                &polygons[1 - current]);
+    current = 1 - current;
+    if (polygons[current].size == 0) break;
+  }
+
+  FixedPolygon& polygon = polygons[current];
+  RemoveFixedPolygonDuplicateVertices(&polygon);
+  polygon_M->clear();
+  if (polygon.size < 3) return;
+  polygon_M->assign(polygon.vertices, polygon.vertices + polygon.size);
+}
+
 std::unique_ptr<ContactSurface<AutoDiffXd>>
 ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const GeometryId, const VolumeMeshField<double, double>&,
@@ -14,6 +127,34 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
       "currently supported");
 }
 
+std::unique_ptr<ContactSurface<AutoDiffXd>>
+ComputeContactSurfaceFromSoftVolumeRigidSurface(
+    const GeometryId, const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, const GeometryId,
+    const SurfaceMesh<double>&,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, int, int,
+    HydroelasticContactRepresentation) {
+  throw std::logic_error(
+      "AutoDiff-valued ContactSurface calculation between meshes is not"
+      "currently supported");
+}
+
+std::unique_ptr<ContactSurface<AutoDiffXd>>
+ComputeContactSurfaceFromSoftVolumeSoftVolume(
+    const GeometryId, const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, const GeometryId,
+    const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&,
+    HydroelasticContactRepresentation) {
+  throw std::logic_error(
+      "AutoDiff-valued ContactSurface calculation between meshes is not"
+      "currently supported");
+}
+
 }  // namespace mesh_intersection
 }  // namespace geometry
 }  // namespace drake
@@ -9,7 +9,9 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/bounding_volume_hierarchy.h"
 #include "drake/geometry/proximity/mesh_field_linear.h"
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
 #include "drake/geometry/proximity/volume_mesh_field.h"
@@ -401,6 +403,35 @@ std::vector<Vector3<T>> ClipTriangleByTetrahedron(
   return polygon_M;
 }
 
+/** Overload of ClipTriangleByTetrahedron() that writes the output polygon into
+ `polygon_M`, so that its memory can be reused from one call to the next. This
+ templated version is the reference implementation; calls with T = double
+ resolve to the faster overload below.
+ @pre `polygon_M` is not `nullptr`.  */
+template <typename T>
+void ClipTriangleByTetrahedron(
+    VolumeElementIndex element, const VolumeMesh<T>& volume_M,
+    SurfaceFaceIndex face, const SurfaceMesh<T>& surface_N,
+    const math::RigidTransform<T>& X_MN, std::vector<Vector3<T>>* polygon_M) {
+  DRAKE_DEMAND(polygon_M != nullptr);
+  *polygon_M =
+      ClipTriangleByTetrahedron(element, volume_M, face, surface_N, X_MN);
+}
+
+/** Double-only overload of ClipTriangleByTetrahedron() that writes the output
+ polygon into `polygon_M`. It performs the same computation as the reference
+ implementation, but keeps the intermediate polygons in fixed-capacity arrays
+ on the stack instead of allocating them. Each clipping plane is tested
+ against all the vertices of a polygon in one branch-free pass, and clipping
+ stops as soon as the polygon is empty. When the capacity of `polygon_M` is
+ reused across calls, clipping a triangle allocates no memory.
+ @pre `polygon_M` is not `nullptr`.  */
+void ClipTriangleByTetrahedron(
+    VolumeElementIndex element, const VolumeMesh<double>& volume_M,
+    SurfaceFaceIndex face, const SurfaceMesh<double>& surface_N,
+    const math::RigidTransform<double>& X_MN,
+    std::vector<Vector3<double>>* polygon_M);
+
 // TODO(DamrongGuoy): Maintain book keeping to avoid duplicate vertices and
 //  remove the note below about duplicate vertices.
 /** Adds a convex `polygon` to the given set of `faces` and `vertices` as a set
@@ -466,6 +497,115 @@ void AddPolygonToMeshData(
   }
 }
 
+/** Adds a convex `polygon` to the given encoded polygons `face_data` (see
+ PolygonSurfaceMesh) and `vertices_F` as a single polygon, without
+ triangulating it.
+ @param[in] polygon_vertices_F
+     The input polygon is represented by positions of its vertices measured and
+     expressed in frame F.
+ @param[in, out] face_data
+     The new polygon is added into `face_data`, with the same orientation as
+     the input polygon.
+ @param[in ,out] vertices_F
+     The set of vertex positions to be extended, each vertex is measured and
+     expressed in frame F.
+ @note
+     This can add vertex positions that already exist in `vertices_F`.
+ @pre `face_data` and `vertices_F` are not `nullptr`.
+ */
+template <typename T>
+void AddPolygonToPolygonMeshData(
+    const std::vector<Vector3<T>>& polygon_vertices_F,
+    std::vector<int>* face_data, std::vector<Vector3<T>>* vertices_F) {
+  DRAKE_DEMAND(face_data != nullptr);
+  DRAKE_DEMAND(vertices_F != nullptr);
+
+  const int polygon_size = static_cast<int>(polygon_vertices_F.size());
+  if (polygon_size < 3) return;
+
+  const int num_original_vertices = static_cast<int>(vertices_F->size());
+  face_data->push_back(polygon_size);
+  for (int i = 0; i < polygon_size; ++i) {
+    vertices_F->push_back(polygon_vertices_F[i]);
+    face_data->push_back(num_original_vertices + i);
+  }
+}
+
+/** Accumulates the polygons of a contact surface into a SurfaceMesh of
+ triangles (see AddPolygonToMeshData()), for the sampling of fields on it. It
+ is one of the two mesh builders of the intersection algorithms, one per
+ HydroelasticContactRepresentation.  */
+template <typename T>
+class TriMeshBuilder {
+ public:
+  using MeshType = SurfaceMesh<T>;
+  using ScalarFieldType = SurfaceMeshFieldLinear<T, T>;
+  using VectorFieldType = SurfaceMeshFieldLinear<Vector3<T>, T>;
+
+  /** Reserves the storage of a mesh of the given size.  */
+  void Reserve(int num_faces, int num_vertices) {
+    faces_.reserve(num_faces);
+    vertices_.reserve(num_vertices);
+  }
+
+  /** Adds the `polygon_M`, with the vertex positions measured and expressed
+   in frame M. The new vertices are the last ones, from the number of vertices
+   before the call.  */
+  void AddPolygon(const std::vector<Vector3<T>>& polygon_M) {
+    AddPolygonToMeshData(polygon_M, &faces_, &vertices_);
+  }
+
+  int num_vertices() const { return vertices_.size(); }
+
+  const Vector3<T>& vertex(int v) const { return vertices_[v].r_MV(); }
+
+  /** Moves the accumulated polygons into a mesh, leaving this empty.  */
+  std::unique_ptr<MeshType> MakeMesh() {
+    return std::make_unique<MeshType>(std::move(faces_), std::move(vertices_));
+  }
+
+ private:
+  std::vector<SurfaceFace> faces_;
+  std::vector<SurfaceVertex<T>> vertices_;
+};
+
+/** Accumulates the polygons of a contact surface into a PolygonSurfaceMesh
+ (see AddPolygonToPolygonMeshData()). It has the interface of
+ TriMeshBuilder.  */
+template <typename T>
+class PolyMeshBuilder {
+ public:
+  using MeshType = PolygonSurfaceMesh<T>;
+  using ScalarFieldType = PolygonSurfaceMeshFieldLinear<T, T>;
+  using VectorFieldType = PolygonSurfaceMeshFieldLinear<Vector3<T>, T>;
+
+  /** Reserves the storage of a mesh of the given size.  */
+  void Reserve(int num_faces, int num_vertices) {
+    // Each polygon is encoded by its size followed by its vertices.
+    face_data_.reserve(num_faces + num_vertices);
+    vertices_.reserve(num_vertices);
+  }
+
+  /** See TriMeshBuilder::AddPolygon().  */
+  void AddPolygon(const std::vector<Vector3<T>>& polygon_M) {
+    AddPolygonToPolygonMeshData(polygon_M, &face_data_, &vertices_);
+  }
+
+  int num_vertices() const { return vertices_.size(); }
+
+  const Vector3<T>& vertex(int v) const { return vertices_[v]; }
+
+  /** Moves the accumulated polygons into a mesh, leaving this empty.  */
+  std::unique_ptr<MeshType> MakeMesh() {
+    return std::make_unique<MeshType>(std::move(face_data_),
+                                      std::move(vertices_));
+  }
+
+ private:
+  std::vector<int> face_data_;
+  std::vector<Vector3<T>> vertices_;
+};
+
 // TODO(SeanCurtis-TRI): Make this a property of the surface mesh.
 /** Computes the field of unit normal vectors for the input `surface` mesh. This
  field defines the outward normal value over the domain of the mesh. In order
@@ -484,10 +624,7 @@ std::unique_ptr<SurfaceMeshField<Vector3<T>, T>> ComputeNormalField(
   for (SurfaceFaceIndex face_index(0); face_index < surface.num_faces();
        ++face_index) {
     const SurfaceFace& face = surface.element(face_index);
-    const Vector3<T>& A = surface.vertex(face.vertex(0)).r_MV();
-    const Vector3<T>& B = surface.vertex(face.vertex(1)).r_MV();
-    const Vector3<T>& C = surface.vertex(face.vertex(2)).r_MV();
-    Vector3<T> unit_normal = (B - A).cross(C - A).normalized();
+    const Vector3<T>& unit_normal = surface.face_normal(face_index);
     for (int v = 0; v < 3; ++v) {
       DRAKE_ASSERT(surface.area(face_index) > T(0.0));
       normal_values[face.vertex(v)] += surface.area(face_index) * unit_normal;
@@ -501,6 +638,95 @@ std::unique_ptr<SurfaceMeshField<Vector3<T>, T>> ComputeNormalField(
       "normal", std::move(normal_values), &surface);
 }
 
+/** Implementation of SampleVolumeFieldOnSurface() (see below) in the
+ representation of the given MeshBuilder, TriMeshBuilder or
+ PolyMeshBuilder.  */
+template <class MeshBuilder, typename T>
+void SampleVolumeFieldOnSurfaceWithBuilder(
+    const VolumeMeshField<T, T>& volume_field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
+    const SurfaceMesh<T>& surface_N,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<T>>& bvh_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<typename MeshBuilder::MeshType>* surface_MN_M,
+    std::unique_ptr<typename MeshBuilder::ScalarFieldType>* e_MN,
+    std::unique_ptr<typename MeshBuilder::VectorFieldType>* grad_h_MN_M,
+    int num_faces_hint, int num_vertices_hint) {
+  auto normal_field_N = ComputeNormalField(surface_N);
+  // TODO(DamrongGuoy): Store normal_field_N in SurfaceMesh to avoid
+  //  recomputing every time. Right now it is not straightforward to store
+  //  SurfaceMeshField inside SurfaceMesh due to imperfect library packaging.
+  //  SurfaceMeshField already depended on SurfaceMesh, and storing
+  //  SurfaceMeshField inside SurfaceMesh will make SurfaceMesh depend on
+  //  SurfaceMeshField. This circular dependency might need both SurfaceMesh
+  //  and SurfaceMeshField to be in the same header file, or we might need to
+  //  break the .h into .h and -inl.h like in multibody_tree{-inl}.h.
+  MeshBuilder builder_M;
+  std::vector<T> surface_e;
+  std::vector<Vector3<T>> surface_normals_M;
+  builder_M.Reserve(num_faces_hint, num_vertices_hint);
+  surface_e.reserve(num_vertices_hint);
+  surface_normals_M.reserve(num_vertices_hint);
+  const auto& mesh_M = volume_field_M.mesh();
+
+  // Only the tetrahedron-triangle pairs whose bounding boxes overlap can
+  // intersect. They are visited in the same order as an exhaustive loop
+  // over all tetrahedra, then all triangles, would.
+  const math::RigidTransform<T> X_NM = X_MN.inverse();
+  const Eigen::Matrix<T, 3, 4> X_MN_matrix = X_MN.GetAsMatrix34();
+  Eigen::Matrix<double, 3, 4> X_MN_value;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      X_MN_value(i, j) = ExtractDoubleOrThrow(X_MN_matrix(i, j));
+    }
+  }
+  const math::RigidTransform<double> X_MN_d(
+      math::RotationMatrix<double>(X_MN_value.template leftCols<3>()),
+      X_MN_value.col(3));
+  // The clipped polygon of each candidate pair; its memory is reused.
+  std::vector<Vector3<T>> polygon_vertices_M;
+  polygon_vertices_M.reserve(7);
+  for (const auto& candidate : bvh_M.CollideCandidates(bvh_N, X_MN_d)) {
+    const VolumeElementIndex tet_index = candidate.first;
+    const SurfaceFaceIndex tri_index = candidate.second;
+    // TODO(SeanCurtis-TRI): This redundantly transforms surface mesh vertex
+    //  positions. Specifically, each vertex will be transformed M times (once
+    //  per tetrahedron. Even with broadphase culling, this vertex will get
+    //  transformed once for each tet-tri pair where the tri is incidental
+    //  to the vertex and the tet-tri pair can't be conservatively culled.
+    //  This is O(mn), where m is the number of faces incident to the vertex
+    //  and n is the number of tet BVs that overlap this triangle BV. However,
+    //  if the broadphase culling determines the surface and volume are
+    //  disjoint regions, *no* vertices will be transformed. Unclear what the
+    //  best balance for best average performance.
+    ClipTriangleByTetrahedron(tet_index, mesh_M, tri_index, surface_N, X_MN,
+                              &polygon_vertices_M);
+    const int num_previous_vertices = builder_M.num_vertices();
+    builder_M.AddPolygon(polygon_vertices_M);
+    const int num_current_vertices = builder_M.num_vertices();
+    // Calculate values of the pressure field and the normal field at the
+    // new vertices.
+    for (int v = num_previous_vertices; v < num_current_vertices; ++v) {
+      const Vector3<T>& r_MV = builder_M.vertex(v);
+      const T pressure = volume_field_M.EvaluateCartesian(tet_index, r_MV);
+      surface_e.push_back(pressure);
+      const Vector3<T> r_NV = X_NM * r_MV;
+      const Vector3<T> normal_N =
+          normal_field_N->EvaluateCartesian(tri_index, r_NV);
+      Vector3<T> normal_M = X_MN.rotation() * normal_N;
+      surface_normals_M.push_back(normal_M);
+    }
+  }
+  DRAKE_DEMAND(builder_M.num_vertices() == static_cast<int>(surface_e.size()));
+  DRAKE_DEMAND(builder_M.num_vertices() ==
+               static_cast<int>(surface_normals_M.size()));
+  *surface_MN_M = builder_M.MakeMesh();
+  *e_MN = std::make_unique<typename MeshBuilder::ScalarFieldType>(
+      "e", std::move(surface_e), surface_MN_M->get());
+  *grad_h_MN_M = std::make_unique<typename MeshBuilder::VectorFieldType>(
+      "grad_h_MN_M", std::move(surface_normals_M), surface_MN_M->get());
+}
+
 // TODO(DamrongGuoy): Maintain book keeping to avoid duplicate vertices and
 //  remove the note in the function documentation.
 
@@ -531,77 +757,80 @@ std::unique_ptr<SurfaceMeshField<Vector3<T>, T>> ComputeNormalField(
      The unit vector field on the intersecting surface (surface normals). Each
      vector is expressed in M's frame but is parallel with the surface normals
      at the same point.
+ @param[in] bvh_M
+     The bounding volume hierarchy of the volume mesh M.
+ @param[in] bvh_N
+     The bounding volume hierarchy of the surface mesh N.
+ @param[in] num_faces_hint
+     The expected number of faces of the intersecting surface (e.g., that of
+     the previous query on the same meshes), used to size its storage up front.
+ @param[in] num_vertices_hint
+     The expected number of vertices of the intersecting surface.
  @note
      The output surface mesh may have duplicate vertices.
  */
 template <typename T>
 void SampleVolumeFieldOnSurface(
     const VolumeMeshField<T, T>& volume_field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
     const SurfaceMesh<T>& surface_N,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<T>>& bvh_N,
     const math::RigidTransform<T>& X_MN,
     std::unique_ptr<SurfaceMesh<T>>* surface_MN_M,
     std::unique_ptr<SurfaceMeshFieldLinear<T, T>>* e_MN,
-    std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>>* grad_h_MN_M) {
-  auto normal_field_N = ComputeNormalField(surface_N);
-  // TODO(DamrongGuoy): Store normal_field_N in SurfaceMesh to avoid
-  //  recomputing every time. Right now it is not straightforward to store
-  //  SurfaceMeshField inside SurfaceMesh due to imperfect library packaging.
-  //  SurfaceMeshField already depended on SurfaceMesh, and storing
-  //  SurfaceMeshField inside SurfaceMesh will make SurfaceMesh depend on
-  //  SurfaceMeshField. This circular dependency might need both SurfaceMesh
-  //  and SurfaceMeshField to be in the same header file, or we might need to
-  //  break the .h into .h and -inl.h like in multibody_tree{-inl}.h.
-  std::vector<SurfaceFace> surface_faces;
-  std::vector<SurfaceVertex<T>> surface_vertices_M;
-  std::vector<T> surface_e;
-  std::vector<Vector3<T>> surface_normals_M;
-  const auto& mesh_M = volume_field_M.mesh();
+    std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>>* grad_h_MN_M,
+    int num_faces_hint = 0, int num_vertices_hint = 0) {
+  SampleVolumeFieldOnSurfaceWithBuilder<TriMeshBuilder<T>>(
+      volume_field_M, bvh_M, surface_N, bvh_N, X_MN, surface_MN_M, e_MN,
+      grad_h_MN_M, num_faces_hint, num_vertices_hint);
+}
 
-  // TODO(DamrongGuoy): Use the broadphase to avoid O(n^2) check of all
-  //  tetrahedrons against all triangles.
-  const math::RigidTransform<T> X_NM = X_MN.inverse();
-  for (VolumeElementIndex tet_index(0); tet_index < mesh_M.num_elements();
-       ++tet_index) {
-    for (SurfaceFaceIndex tri_index(0); tri_index < surface_N.num_faces();
-         ++tri_index) {
-      // TODO(SeanCurtis-TRI): This redundantly transforms surface mesh vertex
-      //  positions. Specifically, each vertex will be transformed M times (once
-      //  per tetrahedron. Even with broadphase culling, this vertex will get
-      //  transformed once for each tet-tri pair where the tri is incidental
-      //  to the vertex and the tet-tri pair can't be conservatively culled.
-      //  This is O(mn), where m is the number of faces incident to the vertex
-      //  and n is the number of tet BVs that overlap this triangle BV. However,
-      //  if the broadphase culling determines the surface and volume are
-      //  disjoint regions, *no* vertices will be transformed. Unclear what the
-      //  best balance for best average performance.
-      std::vector<Vector3<T>> polygon_vertices_M = ClipTriangleByTetrahedron(
-          tet_index, mesh_M, tri_index, surface_N, X_MN);
-      const int num_previous_vertices = surface_vertices_M.size();
-      AddPolygonToMeshData(polygon_vertices_M, &surface_faces,
-                           &surface_vertices_M);
-      const int num_current_vertices = surface_vertices_M.size();
-      // Calculate values of the pressure field and the normal field at the
-      // new vertices.
-      for (int v = num_previous_vertices; v < num_current_vertices; ++v) {
-        const Vector3<T>& r_MV = surface_vertices_M[v].r_MV();
-        const T pressure = volume_field_M.EvaluateCartesian(tet_index, r_MV);
-        surface_e.push_back(pressure);
-        const Vector3<T> r_NV = X_NM * r_MV;
-        const Vector3<T> normal_N =
-            normal_field_N->EvaluateCartesian(tri_index, r_NV);
-        Vector3<T> normal_M = X_MN.rotation() * normal_N;
-        surface_normals_M.push_back(normal_M);
-      }
-    }
+/** Overload of SampleVolumeFieldOnSurface() that computes the intersecting
+ surface as a PolygonSurfaceMesh, whose polygons are not triangulated.  */
+template <typename T>
+void SampleVolumeFieldOnSurface(
+    const VolumeMeshField<T, T>& volume_field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
+    const SurfaceMesh<T>& surface_N,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<T>>& bvh_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<PolygonSurfaceMesh<T>>* surface_MN_M,
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>* e_MN,
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>>*
+        grad_h_MN_M,
+    int num_faces_hint = 0, int num_vertices_hint = 0) {
+  SampleVolumeFieldOnSurfaceWithBuilder<PolyMeshBuilder<T>>(
+      volume_field_M, bvh_M, surface_N, bvh_N, X_MN, surface_MN_M, e_MN,
+      grad_h_MN_M, num_faces_hint, num_vertices_hint);
+}
+
+/** Overload of SampleVolumeFieldOnSurface() that builds the bounding volume
+ hierarchies of the two meshes. Prefer the overload above when the same
+ meshes are intersected repeatedly (e.g., at different poses), so that the
+ hierarchies are only built once.  */
+template <typename T>
+void SampleVolumeFieldOnSurface(
+    const VolumeMeshField<T, T>& volume_field_M,
+    const SurfaceMesh<T>& surface_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<SurfaceMesh<T>>* surface_MN_M,
+    std::unique_ptr<SurfaceMeshFieldLinear<T, T>>* e_MN,
+    std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>>* grad_h_MN_M) {
+  if (volume_field_M.mesh().num_elements() == 0 ||
+      surface_N.num_elements() == 0) {
+    *surface_MN_M = std::make_unique<SurfaceMesh<T>>(
+        std::vector<SurfaceFace>(), std::vector<SurfaceVertex<T>>());
+    *e_MN = std::make_unique<SurfaceMeshFieldLinear<T, T>>(
+        "e", std::vector<T>(), surface_MN_M->get());
+    *grad_h_MN_M = std::make_unique<SurfaceMeshFieldLinear<Vector3<T>, T>>(
+        "grad_h_MN_M", std::vector<Vector3<T>>(), surface_MN_M->get());
+    return;
   }
-  DRAKE_DEMAND(surface_vertices_M.size() == surface_e.size());
-  DRAKE_DEMAND(surface_vertices_M.size() == surface_normals_M.size());
-  *surface_MN_M = std::make_unique<SurfaceMesh<T>>(
-      std::move(surface_faces), std::move(surface_vertices_M));
-  *e_MN = std::make_unique<SurfaceMeshFieldLinear<T, T>>(
-      "e", std::move(surface_e), surface_MN_M->get());
-  *grad_h_MN_M = std::make_unique<SurfaceMeshFieldLinear<Vector3<T>, T>>(
-      "grad_h_MN_M", std::move(surface_normals_M), surface_MN_M->get());
+  const internal::BoundingVolumeHierarchy<VolumeMesh<T>> bvh_M(
+      volume_field_M.mesh());
+  const internal::BoundingVolumeHierarchy<SurfaceMesh<T>> bvh_N(surface_N);
+  SampleVolumeFieldOnSurface(volume_field_M, bvh_M, surface_N, bvh_N, X_MN,
+                             surface_MN_M, e_MN, grad_h_MN_M);
 }
 
 /** Computes the contact surface between a soft geometry S and a rigid
@@ -686,6 +915,406 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
       std::move(grad_h_SR));
 }
 
+/** Makes the contact surface between the geometries with ids `id_A` and
+ `id_B` from its mesh and fields computed in A's frame, by transforming the
+ mesh's vertices to the world frame and re-expressing the gradient field in
+ the world frame.  */
+template <typename T, class MeshType, class ScalarFieldType,
+          class VectorFieldType>
+std::unique_ptr<ContactSurface<T>> MakeContactSurfaceInWorld(
+    GeometryId id_A, GeometryId id_B, const math::RigidTransform<T>& X_WA,
+    std::unique_ptr<MeshType> surface_A, std::unique_ptr<ScalarFieldType> e,
+    std::unique_ptr<VectorFieldType> grad_h_A) {
+  surface_A->TransformVertices(X_WA);
+  for (Vector3<T>& gradient_value : grad_h_A->mutable_values())
+    gradient_value = X_WA.rotation() * gradient_value;
+  return std::make_unique<ContactSurface<T>>(
+      id_A, id_B, std::move(surface_A), std::move(e), std::move(grad_h_A));
+}
+
+/** Overload of ComputeContactSurfaceFromSoftVolumeRigidSurface() that uses
+ the given bounding volume hierarchies of the soft volume mesh and the rigid
+ surface mesh, instead of building them, and sizes the contact surface storage
+ with the given hints (see SampleVolumeFieldOnSurface()). It is meant for
+ meshes that are intersected repeatedly, e.g., at every time step of a
+ simulation. The mesh of the contact surface has the given `representation`.
+ */
+template <typename T>
+std::unique_ptr<ContactSurface<T>>
+ComputeContactSurfaceFromSoftVolumeRigidSurface(
+    const GeometryId id_S, const VolumeMeshField<T, T>& field_S,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_S,
+    const math::RigidTransform<T>& X_WS,
+    const GeometryId id_R, const SurfaceMesh<T>& mesh_R,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<T>>& bvh_R,
+    const math::RigidTransform<T>& X_WR,
+    int num_faces_hint = 0, int num_vertices_hint = 0,
+    HydroelasticContactRepresentation representation =
+        HydroelasticContactRepresentation::kTriangle) {
+  const math::RigidTransform<T> X_SR = X_WS.inverse() * X_WR;
+
+  if (representation == HydroelasticContactRepresentation::kPolygon) {
+    std::unique_ptr<PolygonSurfaceMesh<T>> surface_SR;
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>> e_SR;
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>> grad_h_SR;
+    SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR,
+                               &surface_SR, &e_SR, &grad_h_SR, num_faces_hint,
+                               num_vertices_hint);
+    return MakeContactSurfaceInWorld(id_S, id_R, X_WS, std::move(surface_SR),
+                                     std::move(e_SR), std::move(grad_h_SR));
+  }
+
+  std::unique_ptr<SurfaceMesh<T>> surface_SR;
+  std::unique_ptr<SurfaceMeshFieldLinear<T, T>> e_SR;
+  std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>> grad_h_SR;
+  SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR, &surface_SR,
+                             &e_SR, &grad_h_SR, num_faces_hint,
+                             num_vertices_hint);
+  return MakeContactSurfaceInWorld(id_S, id_R, X_WS, std::move(surface_SR),
+                                   std::move(e_SR), std::move(grad_h_SR));
+}
+
+/** Computes the gradient of the linear field `field_M` on the tetrahedral
+ element `e` of its mesh, expressed in the mesh's frame M. The field is linear
+ inside each element, so the gradient is constant over it.  */
+template <typename T>
+Vector3<T> CalcFieldGradient(const VolumeMeshField<T, T>& field_M,
+                             VolumeElementIndex e) {
+  // Linear fields have their gradients precomputed.
+  const auto* const linear_field_M =
+      dynamic_cast<const VolumeMeshFieldLinear<T, T>*>(&field_M);
+  if (linear_field_M != nullptr) return linear_field_M->EvaluateGradient(e);
+
+  const VolumeMesh<T>& mesh_M = field_M.mesh();
+  const VolumeVertexIndex v0 = mesh_M.element(e).vertex(0);
+  const Vector3<T>& p_MV0 = mesh_M.vertex(v0).r_MV();
+  const T value0 = field_M.EvaluateAtVertex(v0);
+  // The gradient g satisfies g⋅(p_MVᵢ - p_MV₀) = fᵢ - f₀ for i = 1, 2, 3.
+  Matrix3<T> A;
+  Vector3<T> b;
+  for (int i = 1; i < 4; ++i) {
+    const VolumeVertexIndex v = mesh_M.element(e).vertex(i);
+    A.row(i - 1) = (mesh_M.vertex(v).r_MV() - p_MV0).transpose();
+    b(i - 1) = field_M.EvaluateAtVertex(v) - value0;
+  }
+  return A.partialPivLu().solve(b);
+}
+
+/** Intersects a tetrahedron with the boundary plane of a half space, returning
+ the polygon of their intersection.
+ @param element
+     Index of the tetrahedron in a volume mesh.
+ @param volume_M
+     The volume mesh whose vertex positions are expressed in M's frame.
+ @param H_M
+     The half space whose boundary plane slices the tetrahedron, expressed in
+     M's frame.
+ @return
+     The vertices of the (triangular or quadrilateral) intersection polygon,
+     expressed in M's frame, ordered counter-clockwise around the half space's
+     normal. It is empty if the plane misses the tetrahedron or only touches it
+     at a vertex or along an edge.  */
+template <typename T>
+std::vector<Vector3<T>> SliceTetrahedronWithPlane(
+    VolumeElementIndex element, const VolumeMesh<T>& volume_M,
+    const HalfSpace<T>& H_M) {
+  Vector3<T> p_MVs[4];
+  bool outside[4];
+  for (int i = 0; i < 4; ++i) {
+    p_MVs[i] = volume_M.vertex(volume_M.element(element).vertex(i)).r_MV();
+    outside[i] = H_M.PointIsOutside(p_MVs[i]);
+  }
+  // The plane crosses the edges whose vertices are on either side of it.
+  const int edges[6][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}};
+  std::vector<Vector3<T>> polygon_M;
+  polygon_M.reserve(4);
+  for (const auto& edge : edges) {
+    if (outside[edge[0]] != outside[edge[1]]) {
+      polygon_M.push_back(
+          CalcIntersection(p_MVs[edge[0]], p_MVs[edge[1]], H_M));
+    }
+  }
+  if (polygon_M.size() < 3) return {};
+
+  // Order the vertices counter-clockwise around the normal, by their angles
+  // around the centroid in the plane.
+  Vector3<T> centroid_M = Vector3<T>::Zero();
+  for (const Vector3<T>& p_MV : polygon_M) centroid_M += p_MV;
+  centroid_M /= static_cast<double>(polygon_M.size());
+  const Vector3<T> r0_M = polygon_M[0] - centroid_M;
+  // All the vertices coincide when the plane touches a single vertex.
+  if (r0_M.norm() == 0) return {};
+  const Vector3<T> nhat_M = H_M.nhat_F();
+  const Vector3<T> u_M = r0_M.normalized();
+  const Vector3<T> v_M = nhat_M.cross(u_M);
+  std::vector<std::pair<T, Vector3<T>>> sorted;
+  for (const Vector3<T>& p_MV : polygon_M) {
+    using std::atan2;
+    const Vector3<T> r_M = p_MV - centroid_M;
+    sorted.emplace_back(atan2(v_M.dot(r_M), u_M.dot(r_M)), p_MV);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+  for (size_t i = 0; i < sorted.size(); ++i) polygon_M[i] = sorted[i].second;
+
+  polygon_M = RemoveDuplicateVertices(polygon_M);
+  if (polygon_M.size() < 3) polygon_M.clear();
+  return polygon_M;
+}
+
+/** Intersects a polygon with a tetrahedron, returning the portion of the
+ polygon contained in the tetrahedron.
+ @param polygon_M
+     The input convex polygon, with vertex positions expressed in M's frame.
+ @param element
+     Index of the tetrahedron in a volume mesh.
+ @param volume_N
+     The volume mesh whose vertex positions are expressed in N's frame.
+ @param X_MN
+     The pose of the volume frame N in frame M.
+ @return
+     The clipped polygon, expressed in M's frame, with the orientation of the
+     input polygon. It is empty if it would have fewer than three vertices.  */
+template <typename T>
+std::vector<Vector3<T>> ClipPolygonByTetrahedron(
+    std::vector<Vector3<T>> polygon_M, VolumeElementIndex element,
+    const VolumeMesh<T>& volume_N, const math::RigidTransform<T>& X_MN) {
+  Vector3<T> p_MVs[4];
+  for (int i = 0; i < 4; ++i) {
+    VolumeVertexIndex v = volume_N.element(element).vertex(i);
+    p_MVs[i] = X_MN * volume_N.vertex(v).r_MV();
+  }
+  // The faces of the tetrahedron with outward right-handed normals; see
+  // ClipTriangleByTetrahedron().
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+  for (auto& face_vertex : faces) {
+    const Vector3<T>& p_MA = p_MVs[face_vertex[0]];
+    const Vector3<T>& p_MB = p_MVs[face_vertex[1]];
+    const Vector3<T>& p_MC = p_MVs[face_vertex[2]];
+    const Vector3<T> normal_M = (p_MB - p_MA).cross(p_MC - p_MA).normalized();
+    HalfSpace<T> half_space_M(normal_M, normal_M.dot(p_MA));
+    polygon_M = ClipPolygonByHalfSpace(polygon_M, half_space_M);
+    if (polygon_M.empty()) return polygon_M;
+  }
+  polygon_M = RemoveDuplicateVertices(polygon_M);
+  if (polygon_M.size() < 3) polygon_M.clear();
+  return polygon_M;
+}
+
+/** Implementation of IntersectSoftVolumes() (see below) in the
+ representation of the given MeshBuilder, TriMeshBuilder or
+ PolyMeshBuilder.  */
+template <class MeshBuilder, typename T>
+void IntersectSoftVolumesWithBuilder(
+    const VolumeMeshField<T, T>& field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
+    const VolumeMeshField<T, T>& field_N,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<typename MeshBuilder::MeshType>* surface_MN_M,
+    std::unique_ptr<typename MeshBuilder::ScalarFieldType>* e_MN,
+    std::unique_ptr<typename MeshBuilder::VectorFieldType>* grad_h_MN_M) {
+  MeshBuilder builder;
+  std::vector<T> surface_e;
+  std::vector<Vector3<T>> surface_grad_h_M;
+  const VolumeMesh<T>& mesh_M = field_M.mesh();
+  const VolumeMesh<T>& mesh_N = field_N.mesh();
+
+  const Eigen::Matrix<T, 3, 4> X_MN_matrix = X_MN.GetAsMatrix34();
+  Eigen::Matrix<double, 3, 4> X_MN_value;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      X_MN_value(i, j) = ExtractDoubleOrThrow(X_MN_matrix(i, j));
+    }
+  }
+  const math::RigidTransform<double> X_MN_d(
+      math::RotationMatrix<double>(X_MN_value.template leftCols<3>()),
+      X_MN_value.col(3));
+  for (const auto& candidate : bvh_M.CollideCandidates(bvh_N, X_MN_d)) {
+    const VolumeElementIndex tet_M = candidate.first;
+    const VolumeElementIndex tet_N = candidate.second;
+    // Within the two tetrahedra, the fields are the affine functions
+    // eᵢ(p) = eᵢ(Vᵢ) + ∇eᵢ⋅(p - Vᵢ), for a vertex Vᵢ of each tetrahedron.
+    const VolumeVertexIndex v_M = mesh_M.element(tet_M).vertex(0);
+    const VolumeVertexIndex v_N = mesh_N.element(tet_N).vertex(0);
+    const Vector3<T>& p_MV = mesh_M.vertex(v_M).r_MV();
+    const Vector3<T> p_MW = X_MN * mesh_N.vertex(v_N).r_MV();
+    const T e_M_at_V = field_M.EvaluateAtVertex(v_M);
+    const T e_N_at_W = field_N.EvaluateAtVertex(v_N);
+    const Vector3<T> grad_e_M_M = CalcFieldGradient(field_M, tet_M);
+    const Vector3<T> grad_e_N_M =
+        X_MN.rotation() * CalcFieldGradient(field_N, tet_N);
+    // The surface lies on the plane h(p) = e_M(p) - e_N(p) = 0.
+    const Vector3<T> grad_h_M = grad_e_M_M - grad_e_N_M;
+    const T grad_h_norm = grad_h_M.norm();
+    if (grad_h_norm <= std::numeric_limits<double>::epsilon() *
+                           (grad_e_M_M.norm() + grad_e_N_M.norm())) {
+      continue;
+    }
+    const T h_at_origin = e_M_at_V - grad_e_M_M.dot(p_MV) - e_N_at_W +
+                          grad_e_N_M.dot(p_MW);
+    const HalfSpace<T> plane_M(grad_h_M / grad_h_norm,
+                               -h_at_origin / grad_h_norm);
+
+    std::vector<Vector3<T>> polygon_M =
+        SliceTetrahedronWithPlane(tet_M, mesh_M, plane_M);
+    if (polygon_M.empty()) continue;
+    polygon_M = ClipPolygonByTetrahedron(std::move(polygon_M), tet_N, mesh_N,
+                                         X_MN);
+    if (polygon_M.empty()) continue;
+
+    const int num_previous_vertices = builder.num_vertices();
+    builder.AddPolygon(polygon_M);
+    const int num_current_vertices = builder.num_vertices();
+    for (int v = num_previous_vertices; v < num_current_vertices; ++v) {
+      const Vector3<T>& r_MV = builder.vertex(v);
+      surface_e.push_back(e_M_at_V + grad_e_M_M.dot(r_MV - p_MV));
+      surface_grad_h_M.push_back(grad_h_M);
+    }
+  }
+  DRAKE_DEMAND(builder.num_vertices() == static_cast<int>(surface_e.size()));
+  DRAKE_DEMAND(builder.num_vertices() ==
+               static_cast<int>(surface_grad_h_M.size()));
+  *surface_MN_M = builder.MakeMesh();
+  *e_MN = std::make_unique<typename MeshBuilder::ScalarFieldType>(
+      "e", std::move(surface_e), surface_MN_M->get());
+  *grad_h_MN_M = std::make_unique<typename MeshBuilder::VectorFieldType>(
+      "grad_h_MN_M", std::move(surface_grad_h_M), surface_MN_M->get());
+}
+
+/** Computes the surface of equal values of two scalar fields defined on two
+ volume meshes M and N, i.e., the contact surface between two soft geometries.
+ Only the pairs of tetrahedra whose bounding boxes overlap are intersected, so
+ the cost grows with the size of the overlapping region rather than with the
+ size of the meshes. In each pair of tetrahedra, both fields are linear and
+ the surface is the plane where they are equal, clipped by both tetrahedra.
+ @param[in] field_M
+     The scalar field on the volume mesh M, whose vertex positions are in M's
+     frame.
+ @param[in] bvh_M
+     The bounding volume hierarchy of the volume mesh M.
+ @param[in] field_N
+     The scalar field on the volume mesh N, whose vertex positions are in N's
+     frame.
+ @param[in] bvh_N
+     The bounding volume hierarchy of the volume mesh N.
+ @param[in] X_MN
+     The pose of frame N in frame M.
+ @param[out] surface_MN_M
+     The surface of equal values, with vertex positions expressed in M's frame.
+ @param[out] e_MN
+     The (common) value of the fields on the surface.
+ @param[out] grad_h_MN_M
+     The gradient of the difference of the fields (that of M minus that of
+     N), expressed in M's frame. It is normal to the surface, whose faces are
+     oriented counter-clockwise around it. Pairs of tetrahedra in which the
+     two fields have the same gradient do not contribute to the surface.
+ @note
+     The output surface mesh may have duplicate vertices.  */
+template <typename T>
+void IntersectSoftVolumes(
+    const VolumeMeshField<T, T>& field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
+    const VolumeMeshField<T, T>& field_N,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<SurfaceMesh<T>>* surface_MN_M,
+    std::unique_ptr<SurfaceMeshFieldLinear<T, T>>* e_MN,
+    std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>>* grad_h_MN_M) {
+  IntersectSoftVolumesWithBuilder<TriMeshBuilder<T>>(
+      field_M, bvh_M, field_N, bvh_N, X_MN, surface_MN_M, e_MN, grad_h_MN_M);
+}
+
+/** Overload of IntersectSoftVolumes() that makes a surface of polygons
+ instead of triangles.  */
+template <typename T>
+void IntersectSoftVolumes(
+    const VolumeMeshField<T, T>& field_M,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_M,
+    const VolumeMeshField<T, T>& field_N,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_N,
+    const math::RigidTransform<T>& X_MN,
+    std::unique_ptr<PolygonSurfaceMesh<T>>* surface_MN_M,
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>* e_MN,
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>>*
+        grad_h_MN_M) {
+  IntersectSoftVolumesWithBuilder<PolyMeshBuilder<T>>(
+      field_M, bvh_M, field_N, bvh_N, X_MN, surface_MN_M, e_MN, grad_h_MN_M);
+}
+
+/** Computes the contact surface between two soft geometries A and B, i.e.,
+ the surface where their pressure fields are equal (see ContactSurface).
+ @param[in] id_A
+     Id of the soft geometry A.
+ @param[in] field_A
+     The pressure field on the volume mesh of A, defined in A's frame.
+ @param[in] bvh_A
+     The bounding volume hierarchy of the volume mesh of A.
+ @param[in] X_WA
+     The pose of A in the world frame W.
+ @param[in] id_B
+     Id of the soft geometry B.
+ @param[in] field_B
+     The pressure field on the volume mesh of B, defined in B's frame.
+ @param[in] bvh_B
+     The bounding volume hierarchy of the volume mesh of B.
+ @param[in] X_WB
+     The pose of B in the world frame W.
+ @param[in] representation
+     The representation of the mesh of the contact surface.
+ @return
+     The contact surface between M and N (A and B in the order of their ids),
+     with vertex positions and the gradient field expressed in the world frame.
+ */
+template <typename T>
+std::unique_ptr<ContactSurface<T>>
+ComputeContactSurfaceFromSoftVolumeSoftVolume(
+    const GeometryId id_A, const VolumeMeshField<T, T>& field_A,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_A,
+    const math::RigidTransform<T>& X_WA,
+    const GeometryId id_B, const VolumeMeshField<T, T>& field_B,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<T>>& bvh_B,
+    const math::RigidTransform<T>& X_WB,
+    HydroelasticContactRepresentation representation =
+        HydroelasticContactRepresentation::kTriangle) {
+  const math::RigidTransform<T> X_AB = X_WA.inverse() * X_WB;
+
+  if (representation == HydroelasticContactRepresentation::kPolygon) {
+    std::unique_ptr<PolygonSurfaceMesh<T>> surface_AB;
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>> e_AB;
+    std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>> grad_h_AB;
+    IntersectSoftVolumes(field_A, bvh_A, field_B, bvh_B, X_AB, &surface_AB,
+                         &e_AB, &grad_h_AB);
+    return MakeContactSurfaceInWorld(id_A, id_B, X_WA, std::move(surface_AB),
+                                     std::move(e_AB), std::move(grad_h_AB));
+  }
+
+  std::unique_ptr<SurfaceMesh<T>> surface_AB;
+  std::unique_ptr<SurfaceMeshFieldLinear<T, T>> e_AB;
+  std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>> grad_h_AB;
+  IntersectSoftVolumes(field_A, bvh_A, field_B, bvh_B, X_AB, &surface_AB,
+                       &e_AB, &grad_h_AB);
+  return MakeContactSurfaceInWorld(id_A, id_B, X_WA, std::move(surface_AB),
+                                   std::move(e_AB), std::move(grad_h_AB));
+}
+
+/** Overload of ComputeContactSurfaceFromSoftVolumeSoftVolume() that builds the
+ bounding volume hierarchies of the two meshes.  */
+template <typename T>
+std::unique_ptr<ContactSurface<T>>
+ComputeContactSurfaceFromSoftVolumeSoftVolume(
+    const GeometryId id_A, const VolumeMeshField<T, T>& field_A,
+    const math::RigidTransform<T>& X_WA,
+    const GeometryId id_B, const VolumeMeshField<T, T>& field_B,
+    const math::RigidTransform<T>& X_WB) {
+  const internal::BoundingVolumeHierarchy<VolumeMesh<T>> bvh_A(
+      field_A.mesh());
+  const internal::BoundingVolumeHierarchy<VolumeMesh<T>> bvh_B(
+      field_B.mesh());
+  return ComputeContactSurfaceFromSoftVolumeSoftVolume(
+      id_A, field_A, bvh_A, X_WA, id_B, field_B, bvh_B, X_WB);
+}
+
 // NOTE: This is a short-term hack to allow ProximityEngine to compile when
 // invoking this method. There are currently a host of issues preventing us from
 // doing contact surface computation with AutoDiffXd. This curtails those
@@ -697,6 +1326,32 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const math::RigidTransform<AutoDiffXd>&, const GeometryId,
     const SurfaceMesh<double>&, const math::RigidTransform<AutoDiffXd>&);
 
+// NOTE: The same short-term hack as above, for the overload with bounding
+// volume hierarchies.
+std::unique_ptr<ContactSurface<AutoDiffXd>>
+ComputeContactSurfaceFromSoftVolumeRigidSurface(
+    const GeometryId, const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, const GeometryId,
+    const SurfaceMesh<double>&,
+    const internal::BoundingVolumeHierarchy<SurfaceMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, int = 0, int = 0,
+    HydroelasticContactRepresentation =
+        HydroelasticContactRepresentation::kTriangle);
+
+// NOTE: The same short-term hack as above, for the contact surface between two
+// soft geometries.
+std::unique_ptr<ContactSurface<AutoDiffXd>>
+ComputeContactSurfaceFromSoftVolumeSoftVolume(
+    const GeometryId, const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&, const GeometryId,
+    const VolumeMeshField<double, double>&,
+    const internal::BoundingVolumeHierarchy<VolumeMesh<double>>&,
+    const math::RigidTransform<AutoDiffXd>&,
+    HydroelasticContactRepresentation =
+        HydroelasticContactRepresentation::kTriangle);
+
 #endif  // #ifndef DRAKE_DOXYGEN_CXX
 
 }  // namespace mesh_intersection
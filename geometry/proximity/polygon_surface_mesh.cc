@@ -0,0 +1,7 @@
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+
+}  // namespace geometry
+}  // namespace drake
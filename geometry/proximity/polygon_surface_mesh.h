@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/surface_mesh.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+
+/** %PolygonSurfaceMesh represents a surface comprised of planar, convex
+ polygons, e.g., the contact surface made of the polygons clipped from the
+ triangles or the tetrahedra of two intersecting meshes. Compared with
+ SurfaceMesh, a polygon is not triangulated: it has as many vertices as it has
+ corners, and it is a single face with its own area, normal, and centroid.
+
+ The polygons are encoded in a single sequence of integers: for each polygon,
+ the number of its vertices followed by their indices, counter-clockwise
+ around the polygon's normal. E.g., a triangle followed by a quadrilateral is
+ {3, i₀, i₁, i₂, 4, j₀, j₁, j₂, j₃}.
+
+ @tparam T The underlying scalar type for coordinates, e.g., double or
+           AutoDiffXd. Must be a valid Eigen scalar.  */
+template <class T>
+class PolygonSurfaceMesh {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PolygonSurfaceMesh)
+
+  /** Constructs an empty mesh.  */
+  PolygonSurfaceMesh() = default;
+
+  /** Constructs a mesh from the encoded polygons (see the class documentation)
+   and the positions of the vertices, measured and expressed in the mesh's
+   frame M.
+   @pre Each polygon has at least three vertices, whose indices are valid.  */
+  PolygonSurfaceMesh(std::vector<int> face_data,
+                     std::vector<Vector3<T>> vertices)
+      : face_data_(std::move(face_data)), vertices_(std::move(vertices)) {
+    for (int i = 0; i < static_cast<int>(face_data_.size());
+         i += face_data_[i] + 1) {
+      DRAKE_DEMAND(face_data_[i] >= 3);
+      face_offsets_.push_back(i);
+    }
+    CalcAreasNormalsAndCentroids();
+  }
+
+  /** Returns the number of polygons in the mesh.  */
+  int num_faces() const { return face_offsets_.size(); }
+
+  /** Returns the number of elements in the mesh, which are the polygons.  */
+  int num_elements() const { return num_faces(); }
+
+  /** Returns the number of vertices in the mesh.  */
+  int num_vertices() const { return vertices_.size(); }
+
+  /** Returns the position of the vertex `v`, measured and expressed in the
+   mesh's frame M.  */
+  const Vector3<T>& vertex(SurfaceVertexIndex v) const {
+    DRAKE_ASSERT(0 <= v && v < num_vertices());
+    return vertices_[v];
+  }
+
+  /** Returns the number of vertices of the polygon `f`.  */
+  int face_size(SurfaceFaceIndex f) const {
+    return face_data_[face_offsets_[f]];
+  }
+
+  /** Returns the index of the `i`-th vertex (counter-clockwise) of the
+   polygon `f`.
+   @pre 0 ≤ i < face_size(f).  */
+  SurfaceVertexIndex face_vertex(SurfaceFaceIndex f, int i) const {
+    DRAKE_ASSERT(0 <= i && i < face_size(f));
+    return SurfaceVertexIndex(face_data_[face_offsets_[f] + 1 + i]);
+  }
+
+  /** Returns the encoded polygons (see the class documentation).  */
+  const std::vector<int>& face_data() const { return face_data_; }
+
+  /** Returns the area of the polygon `f`.  */
+  const T& area(SurfaceFaceIndex f) const { return area_[f]; }
+
+  /** Returns the unit normal of the polygon `f`, expressed in M's frame. It
+   follows the counter-clockwise winding of the polygon's vertices. A
+   zero-area polygon has a zero normal.  */
+  const Vector3<T>& face_normal(SurfaceFaceIndex f) const {
+    return face_normal_[f];
+  }
+
+  /** Returns the area centroid of the polygon `f`, measured and expressed in
+   M's frame. It is the vertex at the center of the triangle fan that
+   SurfaceMesh would need, without adding it to the mesh.  */
+  const Vector3<T>& element_centroid(SurfaceFaceIndex f) const {
+    return element_centroid_[f];
+  }
+
+  /** Returns the total area of the polygons.  */
+  const T& total_area() const { return total_area_; }
+
+  /** Returns the area-weighted centroid of the mesh, measured and expressed
+   in M's frame; it is (0, 0, 0) if the total area is zero. See
+   SurfaceMesh::centroid().  */
+  const Vector3<T>& centroid() const { return p_MSc_; }
+
+  /** Returns the value at the centroid of the polygon `f` of the linear
+   function with the given values at the vertices of the mesh. The linear
+   function on a planar polygon is integrated exactly by its value at the
+   centroid, times the area.  */
+  template <typename FieldValue>
+  FieldValue CalcCentroidValue(
+      SurfaceFaceIndex f, const std::vector<FieldValue>& vertex_values) const {
+    const int offset = face_offsets_[f];
+    const int size = face_data_[offset];
+    FieldValue value =
+        centroid_weights_[offset] * vertex_values[face_data_[offset + 1]];
+    for (int i = 1; i < size; ++i) {
+      value += centroid_weights_[offset + i] *
+               vertex_values[face_data_[offset + 1 + i]];
+    }
+    return value;
+  }
+
+  /** Transforms the vertices of this mesh from its initial frame M to the new
+   frame N.  */
+  void TransformVertices(const math::RigidTransform<T>& X_NM) {
+    for (auto& v : vertices_) v = X_NM * v;
+    for (auto& c : element_centroid_) c = X_NM * c;
+    const math::RotationMatrix<T>& R_NM = X_NM.rotation();
+    for (auto& n : face_normal_) n = R_NM * n;
+    if (total_area_ != T(0.)) p_MSc_ = X_NM * p_MSc_;
+  }
+
+  /** Reverses the ordering of the vertices of all the polygons, which
+   reverses their normals.  */
+  void ReverseFaceWinding() {
+    for (int offset : face_offsets_) {
+      const int size = face_data_[offset];
+      std::reverse(face_data_.begin() + offset + 1,
+                   face_data_.begin() + offset + 1 + size);
+      std::reverse(centroid_weights_.begin() + offset,
+                   centroid_weights_.begin() + offset + size);
+    }
+    for (auto& n : face_normal_) n = -n;
+  }
+
+ private:
+  // Calculates the area, the unit normal, and the centroid of each polygon
+  // (and the weights of its vertices in the centroid), the total area, and the
+  // centroid of the surface.
+  void CalcAreasNormalsAndCentroids();
+
+  // The encoded polygons.
+  std::vector<int> face_data_;
+  // The positions of the vertices, measured and expressed in Frame M.
+  std::vector<Vector3<T>> vertices_;
+
+  // Computed in initialization.
+
+  // The index in face_data_ of the size of each polygon.
+  std::vector<int> face_offsets_;
+  // For the polygon at `offset` in face_data_, the weights of its vertices in
+  // its centroid are centroid_weights_[offset, offset + size).
+  std::vector<T> centroid_weights_;
+  std::vector<T> area_;
+  std::vector<Vector3<T>> face_normal_;
+  std::vector<Vector3<T>> element_centroid_;
+  T total_area_{};
+  Vector3<T> p_MSc_{Vector3<T>::Zero()};
+};
+
+template <class T>
+void PolygonSurfaceMesh<T>::CalcAreasNormalsAndCentroids() {
+  const int num_polygons = num_faces();
+  centroid_weights_.assign(face_data_.size(), T(0.));
+  area_.resize(num_polygons);
+  face_normal_.resize(num_polygons);
+  element_centroid_.resize(num_polygons);
+  total_area_ = 0;
+  p_MSc_.setZero();
+
+  for (int f = 0; f < num_polygons; ++f) {
+    const int offset = face_offsets_[f];
+    const int size = face_data_[offset];
+    const int* const v = &face_data_[offset + 1];
+    T* const weights = &centroid_weights_[offset];
+
+    // The polygon is convex, so that the triangles of the fan around its
+    // first vertex A have the same orientation as the polygon. The area of the
+    // polygon is the sum of their areas, and its centroid is the
+    // area-weighted mean of their centroids, i.e., a weighted sum of the
+    // vertices.
+    const Vector3<T>& r_MA = vertices_[v[0]];
+    Vector3<T> area_vector = Vector3<T>::Zero();
+    for (int i = 1; i + 1 < size; ++i) {
+      area_vector +=
+          (vertices_[v[i]] - r_MA).cross(vertices_[v[i + 1]] - r_MA);
+    }
+    const T area_vector_norm = area_vector.norm();
+    const T polygon_area = T(0.5) * area_vector_norm;
+    area_[f] = polygon_area;
+    if (area_vector_norm > T(0.)) {
+      const Vector3<T> normal = area_vector / area_vector_norm;
+      face_normal_[f] = normal;
+      // The (signed) areas of the triangles sum to the area of the polygon.
+      for (int i = 1; i + 1 < size; ++i) {
+        const T triangle_area =
+            T(0.5) * (vertices_[v[i]] - r_MA)
+                         .cross(vertices_[v[i + 1]] - r_MA)
+                         .dot(normal);
+        weights[0] += triangle_area;
+        weights[i] += triangle_area;
+        weights[i + 1] += triangle_area;
+      }
+      for (int i = 0; i < size; ++i) weights[i] /= 3. * polygon_area;
+    } else {
+      // A degenerate polygon is represented by the mean of its vertices.
+      face_normal_[f].setZero();
+      for (int i = 0; i < size; ++i) weights[i] = T(1.) / size;
+    }
+    Vector3<T> centroid = Vector3<T>::Zero();
+    for (int i = 0; i < size; ++i) centroid += weights[i] * vertices_[v[i]];
+    element_centroid_[f] = centroid;
+
+    total_area_ += polygon_area;
+    p_MSc_ += polygon_area * centroid;
+  }
+
+  if (total_area_ != T(0.)) p_MSc_ /= total_area_;
+}
+
+/** A linear field on a PolygonSurfaceMesh, defined by its values at the
+ vertices of the mesh; within each polygon, it is the linear function with
+ these values at the polygon's vertices. For the fields of a contact surface,
+ which are linear over the region of each polygon, it is exact.
+
+ @tparam FieldValue  a valid Eigen scalar or vector of valid Eigen scalars
+                     for the field value.
+ @tparam T           a valid Eigen scalar for the coordinates of the mesh.  */
+template <typename FieldValue, typename T>
+class PolygonSurfaceMeshFieldLinear {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PolygonSurfaceMeshFieldLinear)
+
+  /** Constructs the field with the given `name` and `values` at the
+   vertices of `mesh`, which is aliased and must outlive the field.
+   @pre values.size() == mesh->num_vertices().  */
+  PolygonSurfaceMeshFieldLinear(std::string name,
+                                std::vector<FieldValue>&& values,
+                                const PolygonSurfaceMesh<T>* mesh)
+      : name_(std::move(name)), values_(std::move(values)), mesh_(mesh) {
+    DRAKE_DEMAND(mesh_ != nullptr);
+    DRAKE_DEMAND(static_cast<int>(values_.size()) == mesh_->num_vertices());
+  }
+
+  /** Evaluates the field at the vertex `v`.  */
+  const FieldValue& EvaluateAtVertex(SurfaceVertexIndex v) const {
+    return values_[v];
+  }
+
+  /** Evaluates the field at the centroid of the polygon `f`.  */
+  FieldValue EvaluateAtCentroid(SurfaceFaceIndex f) const {
+    return mesh_->CalcCentroidValue(f, values_);
+  }
+
+  /** Returns a copy of this field which refers to the given `new_mesh`,
+   e.g., the copy of the field's mesh.  */
+  PolygonSurfaceMeshFieldLinear CloneAndSetMesh(
+      const PolygonSurfaceMesh<T>* new_mesh) const {
+    DRAKE_DEMAND(new_mesh != nullptr);
+    DRAKE_DEMAND(new_mesh->num_vertices() == mesh_->num_vertices());
+    PolygonSurfaceMeshFieldLinear clone(*this);
+    clone.mesh_ = new_mesh;
+    return clone;
+  }
+
+  const std::string& name() const { return name_; }
+  const PolygonSurfaceMesh<T>& mesh() const { return *mesh_; }
+  const std::vector<FieldValue>& values() const { return values_; }
+  std::vector<FieldValue>& mutable_values() { return values_; }
+
+ private:
+  std::string name_;
+  std::vector<FieldValue> values_;
+  const PolygonSurfaceMesh<T>* mesh_{};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,143 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// The interval of ray parameters [t_in, t_out] for which the points
+// p + t * d lie inside a shape. Shapes are intersections of simpler regions,
+// so the interval is narrowed down one region at a time.
+struct Interval {
+  // Narrows the interval to the parameters inside the half space n⋅x ≤ c.
+  void IntersectHalfSpace(const Vector3d& p, const Vector3d& d,
+                          const Vector3d& n, double c) {
+    const double signed_distance = n.dot(p) - c;
+    const double rate = n.dot(d);
+    if (rate == 0) {
+      if (signed_distance > 0) MarkEmpty();
+    } else if (rate > 0) {
+      t_out = std::min(t_out, -signed_distance / rate);
+    } else {
+      t_in = std::max(t_in, -signed_distance / rate);
+    }
+  }
+
+  // Narrows the interval to the parameters for which |x(axis)| ≤ half_width.
+  void IntersectSlab(const Vector3d& p, const Vector3d& d, int axis,
+                     double half_width) {
+    const Vector3d n = Vector3d::Unit(axis);
+    IntersectHalfSpace(p, d, n, half_width);
+    IntersectHalfSpace(p, d, -n, half_width);
+  }
+
+  // Narrows the interval to the roots of the quadratic a⋅t² + 2b⋅t + c ≤ 0,
+  // with a ≥ 0.
+  void IntersectQuadratic(double a, double b, double c) {
+    if (a == 0) {
+      if (c > 0) MarkEmpty();
+      return;
+    }
+    const double discriminant = b * b - a * c;
+    if (discriminant < 0) {
+      MarkEmpty();
+      return;
+    }
+    const double root = std::sqrt(discriminant);
+    t_in = std::max(t_in, (-b - root) / a);
+    t_out = std::min(t_out, (-b + root) / a);
+  }
+
+  void MarkEmpty() {
+    t_in = kInf;
+    t_out = -kInf;
+  }
+
+  // The distance to the first point along the ray (t ≥ 0) in the shape.
+  double distance() const {
+    if (t_in > t_out || t_out < 0) return kInf;
+    return std::max(t_in, 0.0);
+  }
+
+  double t_in{-kInf};
+  double t_out{kInf};
+};
+
+}  // namespace
+
+double CastRay(const fcl::CollisionGeometryd& shape, const RigidTransformd& X_WG,
+               const Vector3d& p_WR, const Vector3d& dir_W) {
+  // The ray, in the shape's frame.
+  const RigidTransformd X_GW = X_WG.inverse();
+  const Vector3d p = X_GW * p_WR;
+  const Vector3d d = X_GW.rotation() * dir_W;
+  Interval interval;
+  switch (shape.getNodeType()) {
+    case fcl::GEOM_SPHERE: {
+      const auto& sphere = static_cast<const fcl::Sphered&>(shape);
+      interval.IntersectQuadratic(d.dot(d), p.dot(d),
+                                  p.dot(p) - sphere.radius * sphere.radius);
+      break;
+    }
+    case fcl::GEOM_BOX: {
+      const auto& box = static_cast<const fcl::Boxd&>(shape);
+      for (int axis = 0; axis < 3; ++axis) {
+        interval.IntersectSlab(p, d, axis, box.side(axis) / 2);
+      }
+      break;
+    }
+    case fcl::GEOM_CYLINDER: {
+      const auto& cylinder = static_cast<const fcl::Cylinderd&>(shape);
+      interval.IntersectSlab(p, d, 2, cylinder.lz / 2);
+      interval.IntersectQuadratic(
+          d.head<2>().squaredNorm(), p.head<2>().dot(d.head<2>()),
+          p.head<2>().squaredNorm() - cylinder.radius * cylinder.radius);
+      break;
+    }
+    case fcl::GEOM_HALFSPACE: {
+      const auto& half_space = static_cast<const fcl::Halfspaced&>(shape);
+      interval.IntersectHalfSpace(p, d, half_space.n, half_space.d);
+      break;
+    }
+    case fcl::GEOM_CONVEX: {
+      const auto& convex = static_cast<const fcl::Convexd&>(shape);
+      const std::vector<Vector3d>& vertices = convex.getVertices();
+      const std::vector<int>& faces = convex.getFaces();
+      // The face normals are oriented away from the centroid of the vertices,
+      // which lies inside the polytope.
+      Vector3d centroid = Vector3d::Zero();
+      for (const Vector3d& vertex : vertices) centroid += vertex;
+      centroid /= static_cast<double>(vertices.size());
+      int index = 0;
+      for (int f = 0; f < convex.getFaceCount(); ++f) {
+        const int size = faces[index];
+        const Vector3d& a = vertices[faces[index + 1]];
+        const Vector3d& b = vertices[faces[index + 2]];
+        const Vector3d& c = vertices[faces[index + 3]];
+        Vector3d n = (b - a).cross(c - a);
+        if (n.dot(a - centroid) < 0) n = -n;
+        interval.IntersectHalfSpace(p, d, n, n.dot(a));
+        index += size + 1;
+      }
+      break;
+    }
+    default:
+      return kInf;
+  }
+  return interval.distance();
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <fcl/fcl.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/** Computes the distance from the origin R of a ray to the first point of a
+ shape G along the ray. If R lies inside G, the distance is zero. The shape is
+ treated as a solid, hence a ray leaving G from the inside reports zero as
+ well.
+
+ Supported shapes are fcl spheres, boxes, cylinders, half spaces and convex
+ polytopes. All other shapes (and rays that miss G) report infinity.
+
+ @param shape   The fcl shape of G, defined in G's frame.
+ @param X_WG    The pose of G in world.
+ @param p_WR    The position of the ray origin R, in world.
+ @param dir_W   The direction of the ray, in world.
+ @pre `dir_W` has unit length.  */
+double CastRay(const fcl::CollisionGeometryd& shape,
+               const math::RigidTransformd& X_WG, const Vector3<double>& p_WR,
+               const Vector3<double>& dir_W);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -208,9 +208,10 @@ class SurfaceMesh {
   SurfaceMesh(std::vector<SurfaceFace>&& faces,
               std::vector<SurfaceVertex<T>>&& vertices)
       : faces_(std::move(faces)), vertices_(std::move(vertices)),
-        area_(faces_.size()) {  // Pre-allocate here, not yet calculated.
+        area_(faces_.size()),  // Pre-allocate here, not yet calculated.
+        face_normal_(faces_.size()) {
     SetReferringTriangles();
-    CalcAreasAndCentroid();
+    CalcAreasNormalsAndCentroid();
   }
 
   /** Transforms the vertices of this mesh from its initial frame M to the new
@@ -220,6 +221,11 @@ class SurfaceMesh {
     for (auto& v : vertices_) {
       v.TransformInPlace(X_NM);
     }
+    const math::RotationMatrix<T>& R_NM = X_NM.rotation();
+    for (auto& n : face_normal_) {
+      n = R_NM * n;
+    }
+    if (total_area_ != T(0.)) p_MSc_ = X_NM * p_MSc_;
   }
 
   /** Reverses the ordering of all the faces' indices -- see
@@ -229,16 +235,34 @@ class SurfaceMesh {
     for (auto& f : faces_) {
       f.ReverseWinding();
     }
+    for (auto& n : face_normal_) {
+      n = -n;
+    }
   }
 
   /** Returns the number of triangular elements in the mesh.
    */
   int num_faces() const { return faces_.size(); }
 
+  /** Returns the number of elements in the mesh. For %SurfaceMesh, an
+   element is a triangle. Returns the same number as num_faces() and enables
+   mesh consumers to be templated on mesh type.
+   */
+  int num_elements() const { return num_faces(); }
+
   /** Returns area of a triangular element.
    */
   const T& area(SurfaceFaceIndex f) const { return area_[f]; }
 
+  /** Returns the unit normal of a triangular element, expressed in M's
+   frame. The normal follows the right-handed winding of the element's
+   vertices. It is computed once, along with the area, rather than at every
+   query. A zero-area element has a zero normal.
+   */
+  const Vector3<T>& face_normal(SurfaceFaceIndex f) const {
+    return face_normal_[f];
+  }
+
   /** Returns the total area of all the faces of this surface mesh.
    */
   const T& total_area() const { return total_area_; }
@@ -345,9 +369,9 @@ class SurfaceMesh {
   //
 
  private:
-  // Calculates the areas of each triangle, the total area, and the centorid of
-  // the surface.
-  void CalcAreasAndCentroid();
+  // Calculates the areas and unit normals of each triangle, the total area,
+  // and the centorid of the surface.
+  void CalcAreasNormalsAndCentroid();
 
   // Determines the triangular faces that refer to each vertex.
   void SetReferringTriangles() {
@@ -374,13 +398,16 @@ class SurfaceMesh {
   std::vector<T> area_;
   T total_area_{};
 
+  // Right-handed unit normals of the triangles, expressed in Frame M.
+  std::vector<Vector3<T>> face_normal_;
+
   // Area-weighted geometric centroid Sc of the surface mesh as an offset vector
   // from the origin of Frame M to point Sc, expressed in Frame M.
   Vector3<T> p_MSc_;
 };
 
 template <class T>
-void SurfaceMesh<T>::CalcAreasAndCentroid() {
+void SurfaceMesh<T>::CalcAreasNormalsAndCentroid() {
   total_area_ = 0;
   p_MSc_.setZero();
 
@@ -392,9 +419,15 @@ void SurfaceMesh<T>::CalcAreasAndCentroid() {
     const auto r_UV_M = r_MB - r_MA;
     const auto r_UW_M = r_MC - r_MA;
 
-    const auto cross = r_UV_M.cross(r_UW_M);
-    const T face_area = T(0.5) * cross.norm();
+    const Vector3<T> cross = r_UV_M.cross(r_UW_M);
+    const T cross_norm = cross.norm();
+    const T face_area = T(0.5) * cross_norm;
     area_[f] = face_area;
+    if (cross_norm > T(0.)) {
+      face_normal_[f] = cross / cross_norm;
+    } else {
+      face_normal_[f].setZero();
+    }
     total_area_ += face_area;
 
     // Accumulate area-weighted surface centroid; must be divided by 3X the
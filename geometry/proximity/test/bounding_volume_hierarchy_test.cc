@@ -0,0 +1,134 @@
+#include "drake/geometry/proximity/bounding_volume_hierarchy.h"
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+GTEST_TEST(AabbTest, HasOverlap) {
+  const Aabb a(Vector3d::Zero(), Vector3d(1, 1, 1));
+  const Aabb b(Vector3d::Zero(), Vector3d(1, 1, 1));
+
+  // Coincident boxes.
+  EXPECT_TRUE(Aabb::HasOverlap(a, b, RigidTransformd()));
+
+  // Translated along x: the boxes overlap until they are more than two units
+  // apart.
+  EXPECT_TRUE(
+      Aabb::HasOverlap(a, b, RigidTransformd(Vector3d(1.99, 0, 0))));
+  EXPECT_FALSE(
+      Aabb::HasOverlap(a, b, RigidTransformd(Vector3d(2.01, 0, 0))));
+
+  // The center of b is measured in frame B.
+  const Aabb offset_b(Vector3d(3, 0, 0), Vector3d(1, 1, 1));
+  EXPECT_FALSE(Aabb::HasOverlap(a, offset_b, RigidTransformd()));
+  EXPECT_TRUE(
+      Aabb::HasOverlap(a, offset_b, RigidTransformd(Vector3d(-2, 0, 0))));
+
+  // Box B rotated 45 degrees about z and moved along the diagonal of the xy
+  // plane. The axis-aligned bounding box of B in A would overlap A, but B
+  // does not: the separating axis is the x axis of B.
+  const RigidTransformd X_AB(RollPitchYawd(0, 0, M_PI / 4),
+                             Vector3d(1.75, 1.75, 0));
+  EXPECT_FALSE(Aabb::HasOverlap(a, b, X_AB));
+  const RigidTransformd X_AB_closer(RollPitchYawd(0, 0, M_PI / 4),
+                                    Vector3d(1.2, 1.2, 0));
+  EXPECT_TRUE(Aabb::HasOverlap(a, b, X_AB_closer));
+}
+
+// Returns the axis-aligned bounding box of element e of `mesh`.
+template <class MeshType>
+Aabb ElementAabb(const MeshType& mesh, typename MeshType::ElementIndex e) {
+  Vector3d lower = mesh.vertex(mesh.element(e).vertex(0)).r_MV();
+  Vector3d upper = lower;
+  for (int v = 1; v < MeshType::kDim + 1; ++v) {
+    const Vector3d& p_MV = mesh.vertex(mesh.element(e).vertex(v)).r_MV();
+    lower = lower.cwiseMin(p_MV);
+    upper = upper.cwiseMax(p_MV);
+  }
+  return Aabb((lower + upper) / 2, (upper - lower) / 2);
+}
+
+GTEST_TEST(BoundingVolumeHierarchyTest, Construction) {
+  const VolumeMesh<double> mesh =
+      MakeBoxVolumeMesh<double>(Box(1, 2, 3), 0.5);
+  const BoundingVolumeHierarchy<VolumeMesh<double>> bvh(mesh);
+  const auto& nodes = bvh.nodes();
+  ASSERT_FALSE(nodes.empty());
+
+  // The root bounds the whole box.
+  EXPECT_TRUE(CompareMatrices(nodes[0].aabb.center(), Vector3d::Zero(),
+                              1e-14));
+  EXPECT_TRUE(CompareMatrices(nodes[0].aabb.half_width(),
+                              Vector3d(0.5, 1, 1.5), 1e-14));
+
+  // Each element is referenced by exactly one leaf, and each leaf has one
+  // element.
+  std::set<int> elements;
+  for (const auto& node : nodes) {
+    if (node.is_leaf()) {
+      EXPECT_EQ(node.end - node.begin, 1);
+      elements.insert(bvh.element_order()[node.begin]);
+    } else {
+      // The children cover the elements of the parent.
+      EXPECT_EQ(nodes[node.left].begin, node.begin);
+      EXPECT_EQ(nodes[node.left].end, nodes[node.right].begin);
+      EXPECT_EQ(nodes[node.right].end, node.end);
+    }
+  }
+  EXPECT_EQ(static_cast<int>(elements.size()), mesh.num_elements());
+  EXPECT_EQ(static_cast<int>(nodes.size()), 2 * mesh.num_elements() - 1);
+}
+
+// With one element per leaf, the candidate pairs are exactly the pairs of
+// elements whose bounding boxes overlap.
+GTEST_TEST(BoundingVolumeHierarchyTest, CollideCandidates) {
+  const VolumeMesh<double> mesh_A =
+      MakeBoxVolumeMesh<double>(Box(1, 1, 1), 0.25);
+  const SurfaceMesh<double> mesh_B =
+      MakeBoxSurfaceMesh<double>(Box(1, 1, 1), 0.25);
+  const BoundingVolumeHierarchy<VolumeMesh<double>> bvh_A(mesh_A);
+  const BoundingVolumeHierarchy<SurfaceMesh<double>> bvh_B(mesh_B);
+
+  const RigidTransformd X_AB(RollPitchYawd(0.1, 0.4, M_PI / 5),
+                             Vector3d(0.7, 0.2, -0.3));
+  const auto candidates = bvh_A.CollideCandidates(bvh_B, X_AB);
+
+  std::vector<std::pair<VolumeElementIndex, SurfaceFaceIndex>> expected;
+  for (VolumeElementIndex a(0); a < mesh_A.num_elements(); ++a) {
+    for (SurfaceFaceIndex b(0); b < mesh_B.num_elements(); ++b) {
+      if (Aabb::HasOverlap(ElementAabb(mesh_A, a), ElementAabb(mesh_B, b),
+                           X_AB)) {
+        expected.emplace_back(a, b);
+      }
+    }
+  }
+  EXPECT_FALSE(expected.empty());
+  EXPECT_LT(static_cast<int>(expected.size()),
+            mesh_A.num_elements() * mesh_B.num_elements());
+  EXPECT_EQ(candidates, expected);
+
+  // Disjoint meshes have no candidates.
+  EXPECT_TRUE(
+      bvh_A.CollideCandidates(bvh_B, RigidTransformd(Vector3d(2, 0, 0)))
+          .empty());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,68 @@
+#include "drake/geometry/proximity/collision_filter_legacy.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// Geometries in a common clique are filtered, whether or not their clique
+// masks decide the pair by themselves.
+GTEST_TEST(CollisionFilterLegacyTest, CommonCliques) {
+  CollisionFilterLegacy filter;
+  const uintptr_t a = 2;
+  const uintptr_t b = 4;
+  const uintptr_t c = 6;
+  filter.AddGeometry(a);
+  filter.AddGeometry(b);
+  filter.AddGeometry(c);
+  EXPECT_FALSE(filter.CanCollideWith(a, a));
+  EXPECT_TRUE(filter.CanCollideWith(a, b));
+
+  const int clique = filter.next_clique_id();
+  filter.AddToCollisionClique(a, clique);
+  filter.AddToCollisionClique(b, clique);
+  // Duplicates are ignored.
+  filter.AddToCollisionClique(b, clique);
+  EXPECT_EQ(filter.num_cliques(b), 1);
+  EXPECT_FALSE(filter.CanCollideWith(a, b));
+  EXPECT_FALSE(filter.CanCollideWith(b, a));
+  EXPECT_TRUE(filter.CanCollideWith(a, c));
+
+  filter.RemoveGeometry(b);
+  filter.AddGeometry(b);
+  EXPECT_TRUE(filter.CanCollideWith(a, b));
+}
+
+// Beyond 64 cliques, two cliques share a bit of the masks; the geometries of
+// such distinct cliques can still collide.
+GTEST_TEST(CollisionFilterLegacyTest, ManyCliques) {
+  CollisionFilterLegacy filter;
+  std::vector<int> cliques;
+  for (int i = 0; i < 130; ++i) {
+    cliques.push_back(filter.next_clique_id());
+  }
+  const uintptr_t a = 2;
+  const uintptr_t b = 4;
+  const uintptr_t c = 6;
+  filter.AddGeometry(a);
+  filter.AddGeometry(b);
+  filter.AddGeometry(c);
+  // Cliques 1, 65 and 129 share a bit.
+  filter.AddToCollisionClique(a, cliques[1]);
+  filter.AddToCollisionClique(b, cliques[65]);
+  filter.AddToCollisionClique(c, cliques[129]);
+  EXPECT_TRUE(filter.CanCollideWith(a, b));
+  EXPECT_TRUE(filter.CanCollideWith(b, c));
+  filter.AddToCollisionClique(c, cliques[65]);
+  EXPECT_FALSE(filter.CanCollideWith(b, c));
+  EXPECT_TRUE(filter.CanCollideWith(a, c));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,103 @@
+#include "drake/geometry/proximity/convex_disk_cache.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+class ConvexDiskCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::string temp = temp_directory();
+    cache_dir_ = temp + "/geometry_cache";
+    obj_filename_ = temp + "/tetrahedron.obj";
+    WriteObj(obj_filename_, "v 0 0 0\n");
+  }
+
+  void TearDown() override {
+    ::unsetenv(kGeometryCacheDirEnvironmentVariableName);
+  }
+
+  static void WriteObj(const std::string& filename,
+                       const std::string& contents) {
+    std::ofstream file(filename);
+    file << contents;
+  }
+
+  std::string cache_dir_;
+  std::string obj_filename_;
+};
+
+TEST_F(ConvexDiskCacheTest, Disabled) {
+  ::unsetenv(kGeometryCacheDirEnvironmentVariableName);
+  EXPECT_EQ(GetConvexCacheFilename(obj_filename_), "");
+  ::setenv(kGeometryCacheDirEnvironmentVariableName, "", 1);
+  EXPECT_EQ(GetConvexCacheFilename(obj_filename_), "");
+}
+
+TEST_F(ConvexDiskCacheTest, RoundTrip) {
+  ::setenv(kGeometryCacheDirEnvironmentVariableName, cache_dir_.c_str(), 1);
+  EXPECT_EQ(GetConvexCacheFilename("/no/such/file.obj"), "");
+
+  // The name depends on the contents of the file, not on its name.
+  const std::string cache_filename = GetConvexCacheFilename(obj_filename_);
+  EXPECT_EQ(cache_filename.find(cache_dir_ + "/"), 0);
+  WriteObj(obj_filename_ + ".copy.obj", "v 0 0 0\n");
+  EXPECT_EQ(GetConvexCacheFilename(obj_filename_ + ".copy.obj"),
+            cache_filename);
+  WriteObj(obj_filename_ + ".other.obj", "v 1 0 0\n");
+  EXPECT_NE(GetConvexCacheFilename(obj_filename_ + ".other.obj"),
+            cache_filename);
+
+  EXPECT_FALSE(ReadConvexCache(cache_filename));
+
+  ConvexMeshData data;
+  data.vertices = {Vector3d(0, 0, 0), Vector3d(1, 0, 0), Vector3d(0, 1, 0),
+                   Vector3d(0, 0, 1)};
+  data.num_faces = 4;
+  data.faces = {3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3};
+  ASSERT_TRUE(WriteConvexCache(cache_filename, data));
+
+  const optional<ConvexMeshData> read = ReadConvexCache(cache_filename);
+  ASSERT_TRUE(read);
+  EXPECT_EQ(read->vertices, data.vertices);
+  EXPECT_EQ(read->num_faces, data.num_faces);
+  EXPECT_EQ(read->faces, data.faces);
+}
+
+TEST_F(ConvexDiskCacheTest, InvalidFile) {
+  const std::string filename = temp_directory() + "/invalid.bin";
+  WriteObj(filename, "not a cache file, but long enough for its header");
+  EXPECT_FALSE(ReadConvexCache(filename));
+
+  // A truncated file is rejected.
+  ConvexMeshData data;
+  data.vertices = {Vector3d(1, 2, 3)};
+  data.num_faces = 1;
+  data.faces = {1, 0};
+  ASSERT_TRUE(WriteConvexCache(filename, data));
+  ASSERT_TRUE(ReadConvexCache(filename));
+  std::string contents;
+  {
+    std::ifstream file(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  WriteObj(filename, contents.substr(0, contents.size() - 1));
+  EXPECT_FALSE(ReadConvexCache(filename));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,250 @@
+#include "drake/geometry/proximity/convex_penetration.h"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace convex_penetration {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Makes the hull of the box [-x, x] × [-y, y] × [-z, z], with the faces in
+// the format of fcl::Convex. If `split` is true, the faces lose their edges, so
+// that the support vertices are found by brute force.
+ConvexHull MakeBox(double x, double y, double z, bool split = false) {
+  std::vector<Vector3d> vertices;
+  for (int i = 0; i < 8; ++i) {
+    vertices.emplace_back(i & 1 ? x : -x, i & 2 ? y : -y, i & 4 ? z : -z);
+  }
+  const std::vector<int> faces{4, 0, 2, 3, 1,  4, 4, 5, 7, 6,
+                               4, 0, 1, 5, 4,  4, 2, 6, 7, 3,
+                               4, 0, 4, 6, 2,  4, 1, 3, 7, 5};
+  if (split) return ConvexHull(std::move(vertices), {1, 0}, 1);
+  return ConvexHull(std::move(vertices), faces, 6);
+}
+
+GTEST_TEST(ConvexHullTest, FindSupportVertex) {
+  const ConvexHull box = MakeBox(1, 2, 3);
+  const ConvexHull split_box = MakeBox(1, 2, 3, true);
+  const std::vector<Vector3d> directions{
+      Vector3d(1, 1, 1), Vector3d(-1, 2, 0.5), Vector3d(0.3, -1, -2),
+      Vector3d(-1, -1, 1)};
+  for (const Vector3d& dir : directions) {
+    const Vector3d expected(dir.x() > 0 ? 1 : -1, dir.y() > 0 ? 2 : -2,
+                            dir.z() > 0 ? 3 : -3);
+    // Hill climbing reaches the support vertex from any start.
+    for (int start = 0; start < 8; ++start) {
+      EXPECT_EQ(box.vertex(box.FindSupportVertex(dir, start)), expected);
+    }
+    EXPECT_EQ(split_box.vertex(split_box.FindSupportVertex(dir, 0)),
+              expected);
+  }
+}
+
+// Two unit cubes, B at the origin and A above it, overlapping by 0.1 along z.
+GTEST_TEST(ConvexPenetrationTest, StackedBoxes) {
+  const ConvexHull cube = MakeBox(0.5, 0.5, 0.5);
+  const RigidTransformd X_WA(Vector3d(0.2, 0.1, 0.9));
+  const RigidTransformd X_WB;
+  PairCache cache;
+  Penetration penetration;
+  ASSERT_TRUE(
+      ComputePenetration(cube, X_WA, cube, X_WB, &cache, &penetration));
+  EXPECT_NEAR(penetration.depth, 0.1, 1e-12);
+  EXPECT_TRUE(CompareMatrices(penetration.nhat_BA_W, Vector3d::UnitZ(),
+                              1e-12));
+  EXPECT_NEAR(penetration.p_WCa.z(), 0.4, 1e-12);
+  EXPECT_NEAR(penetration.p_WCb.z(), 0.5, 1e-12);
+  EXPECT_TRUE(CompareMatrices(penetration.p_WCa - penetration.p_WCb,
+                              -penetration.depth * penetration.nhat_BA_W,
+                              1e-12));
+  // The contact normal is cached for the next query.
+  EXPECT_TRUE(CompareMatrices(cache.direction_W, Vector3d::UnitZ(), 1e-12));
+
+  // Swapping the hulls flips the normal.
+  PairCache swapped_cache;
+  ASSERT_TRUE(ComputePenetration(cube, X_WB, cube, X_WA, &swapped_cache,
+                                 &penetration));
+  EXPECT_NEAR(penetration.depth, 0.1, 1e-12);
+  EXPECT_TRUE(CompareMatrices(penetration.nhat_BA_W, -Vector3d::UnitZ(),
+                              1e-12));
+}
+
+// A deep penetration of rotated hulls, computed with and without hill
+// climbing.
+GTEST_TEST(ConvexPenetrationTest, RotatedBoxes) {
+  const RigidTransformd X_WA(RollPitchYawd(0.1, 0.2, 0.3),
+                             Vector3d(0.1, -0.2, 0.3));
+  const RigidTransformd X_WB(RollPitchYawd(-0.3, 0.1, 0.4),
+                             Vector3d(-0.2, 0.1, 0));
+  PairCache cache;
+  Penetration penetration;
+  ASSERT_TRUE(ComputePenetration(MakeBox(1, 0.5, 0.25), X_WA,
+                                 MakeBox(0.5, 0.5, 0.5), X_WB, &cache,
+                                 &penetration));
+  PairCache split_cache;
+  Penetration split_penetration;
+  ASSERT_TRUE(ComputePenetration(MakeBox(1, 0.5, 0.25, true), X_WA,
+                                 MakeBox(0.5, 0.5, 0.5, true), X_WB,
+                                 &split_cache, &split_penetration));
+  EXPECT_GT(penetration.depth, 0.25);
+  EXPECT_NEAR(penetration.depth, split_penetration.depth, 1e-10);
+  EXPECT_TRUE(CompareMatrices(penetration.nhat_BA_W,
+                              split_penetration.nhat_BA_W, 1e-10));
+  EXPECT_NEAR(penetration.nhat_BA_W.norm(), 1, 1e-12);
+  // Translating A by the penetration makes the hulls touch, not overlap.
+  const RigidTransformd X_WA_separated(
+      X_WA.rotation(),
+      X_WA.translation() + (penetration.depth + 1e-6) * penetration.nhat_BA_W);
+  PairCache fresh_cache;
+  EXPECT_FALSE(ComputePenetration(MakeBox(1, 0.5, 0.25), X_WA_separated,
+                                  MakeBox(0.5, 0.5, 0.5), X_WB, &fresh_cache,
+                                  &penetration));
+}
+
+GTEST_TEST(ConvexPenetrationTest, Separated) {
+  const ConvexHull cube = MakeBox(0.5, 0.5, 0.5);
+  const RigidTransformd X_WB;
+  PairCache cache;
+  Penetration penetration;
+  penetration.depth = -1;
+  EXPECT_FALSE(ComputePenetration(cube, RigidTransformd(Vector3d(0, 0, 1.5)),
+                                  cube, X_WB, &cache, &penetration));
+  // The penetration is left untouched.
+  EXPECT_EQ(penetration.depth, -1);
+  // Touching hulls don't penetrate.
+  EXPECT_FALSE(ComputePenetration(cube, RigidTransformd(Vector3d(0, 0, 1)),
+                                  cube, X_WB, &cache, &penetration));
+}
+
+// A hull moving in small steps reuses the separating direction of the previous
+// step, and gets the same answers as without the cache.
+GTEST_TEST(ConvexPenetrationTest, WarmStart) {
+  const ConvexHull cube = MakeBox(0.5, 0.5, 0.5);
+  const RigidTransformd X_WB(RollPitchYawd(0, 0, 0.2), Vector3d::Zero());
+  PairCache cache;
+  for (double z = 1.3; z > 0.7; z -= 0.01) {
+    const RigidTransformd X_WA(RollPitchYawd(0.05, 0, 0), Vector3d(0, 0, z));
+    Penetration warm, cold;
+    PairCache cold_cache;
+    const bool warm_result =
+        ComputePenetration(cube, X_WA, cube, X_WB, &cache, &warm);
+    const bool cold_result =
+        ComputePenetration(cube, X_WA, cube, X_WB, &cold_cache, &cold);
+    ASSERT_EQ(warm_result, cold_result) << z;
+    if (warm_result) {
+      EXPECT_NEAR(warm.depth, cold.depth, 1e-10);
+      EXPECT_TRUE(CompareMatrices(warm.nhat_BA_W, cold.nhat_BA_W, 1e-10));
+      EXPECT_TRUE(CompareMatrices(warm.p_WCa - warm.p_WCb,
+                                  -warm.depth * warm.nhat_BA_W, 1e-10));
+    }
+    // Whether or not they penetrate, the direction points from B to A.
+    EXPECT_GT(cache.direction_W.z(), 0);
+  }
+}
+
+// Two unit cubes, A offset from B by (0.2, 0.1, 1.5), are 0.5 apart along z.
+GTEST_TEST(ConvexSignedDistanceTest, Separated) {
+  const ConvexHull cube = MakeBox(0.5, 0.5, 0.5);
+  const RigidTransformd X_WA(Vector3d(0.2, 0.1, 1.5));
+  const RigidTransformd X_WB;
+  const double kInf = std::numeric_limits<double>::infinity();
+  PairCache cache;
+  SignedDistance result;
+  ASSERT_TRUE(
+      ComputeSignedDistance(cube, X_WA, cube, X_WB, kInf, &cache, &result));
+  EXPECT_NEAR(result.distance, 0.5, 1e-12);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, Vector3d::UnitZ(), 1e-12));
+  EXPECT_NEAR(result.p_WCa.z(), 1, 1e-12);
+  EXPECT_NEAR(result.p_WCb.z(), 0.5, 1e-12);
+  EXPECT_TRUE(CompareMatrices(result.p_WCa - result.p_WCb,
+                              result.distance * result.nhat_BA_W, 1e-12));
+
+  // Beyond the maximum distance, the result is left untouched.
+  SignedDistance untouched;
+  untouched.distance = -1;
+  EXPECT_FALSE(ComputeSignedDistance(cube, X_WA, cube, X_WB, 0.4, &cache,
+                                     &untouched));
+  EXPECT_EQ(untouched.distance, -1);
+  EXPECT_TRUE(
+      ComputeSignedDistance(cube, X_WA, cube, X_WB, 0.5, &cache, &result));
+
+  // Touching hulls are at zero distance, without a unique direction.
+  ASSERT_TRUE(ComputeSignedDistance(cube, RigidTransformd(Vector3d(0, 0, 1)),
+                                    cube, X_WB, 0, &cache, &result));
+  EXPECT_NEAR(result.distance, 0, 1e-12);
+  EXPECT_NEAR(result.p_WCa.z(), 0.5, 1e-12);
+  EXPECT_NEAR(result.p_WCb.z(), 0.5, 1e-12);
+}
+
+// The signed distance of penetrating hulls is the negative of their
+// penetration depth.
+GTEST_TEST(ConvexSignedDistanceTest, Penetrating) {
+  const RigidTransformd X_WA(RollPitchYawd(0.1, 0.2, 0.3),
+                             Vector3d(0.1, -0.2, 0.3));
+  const RigidTransformd X_WB(RollPitchYawd(-0.3, 0.1, 0.4),
+                             Vector3d(-0.2, 0.1, 0));
+  const ConvexHull hull_A = MakeBox(1, 0.5, 0.25);
+  const ConvexHull hull_B = MakeBox(0.5, 0.5, 0.5);
+  PairCache penetration_cache;
+  Penetration penetration;
+  ASSERT_TRUE(ComputePenetration(hull_A, X_WA, hull_B, X_WB,
+                                 &penetration_cache, &penetration));
+  PairCache cache;
+  SignedDistance result;
+  ASSERT_TRUE(
+      ComputeSignedDistance(hull_A, X_WA, hull_B, X_WB, 0, &cache, &result));
+  EXPECT_NEAR(result.distance, -penetration.depth, 1e-10);
+  EXPECT_TRUE(CompareMatrices(result.nhat_BA_W, penetration.nhat_BA_W, 1e-10));
+  EXPECT_TRUE(CompareMatrices(result.p_WCa - result.p_WCb,
+                              result.distance * result.nhat_BA_W, 1e-10));
+  // A negative maximum distance only reports deeper penetrations.
+  EXPECT_FALSE(ComputeSignedDistance(hull_A, X_WA, hull_B, X_WB,
+                                     -penetration.depth - 0.01, &cache,
+                                     &result));
+}
+
+// Rotated hulls at varying distances, computed with and without hill climbing
+// and with and without the cache from the previous step.
+GTEST_TEST(ConvexSignedDistanceTest, WarmStart) {
+  const ConvexHull hull_A = MakeBox(1, 0.5, 0.25);
+  const ConvexHull hull_B = MakeBox(0.5, 0.5, 0.5);
+  const ConvexHull split_A = MakeBox(1, 0.5, 0.25, true);
+  const ConvexHull split_B = MakeBox(0.5, 0.5, 0.5, true);
+  const RigidTransformd X_WB(RollPitchYawd(-0.3, 0.1, 0.4), Vector3d::Zero());
+  const double kInf = std::numeric_limits<double>::infinity();
+  PairCache cache;
+  for (double z = 2; z > 0; z -= 0.05) {
+    const RigidTransformd X_WA(RollPitchYawd(0.1, 0.2, 0.3 + z),
+                               Vector3d(0.3, -0.1, z));
+    SignedDistance warm, cold;
+    PairCache cold_cache;
+    ASSERT_TRUE(ComputeSignedDistance(hull_A, X_WA, hull_B, X_WB, kInf,
+                                      &cache, &warm));
+    ASSERT_TRUE(ComputeSignedDistance(split_A, X_WA, split_B, X_WB, kInf,
+                                      &cold_cache, &cold));
+    EXPECT_NEAR(warm.distance, cold.distance, 1e-10) << z;
+    EXPECT_TRUE(CompareMatrices(warm.nhat_BA_W, cold.nhat_BA_W, 1e-8)) << z;
+    EXPECT_TRUE(CompareMatrices(warm.p_WCa - warm.p_WCb,
+                                warm.distance * warm.nhat_BA_W, 1e-10))
+        << z;
+  }
+}
+
+}  // namespace
+}  // namespace convex_penetration
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -124,6 +124,77 @@ TYPED_TEST(HydroelasticCallbackTyped, ValidPairProducesResult) {
   EXPECT_EQ(surfaces.size(), 1u);
 }
 
+// Confirms that two overlapping (soft) spheres produce a contact surface, with
+// and without the geometry cache.
+TYPED_TEST(HydroelasticCallbackTyped, SoftSpheresProduceResult) {
+  using T = TypeParam;
+
+  const GeometryId id_other = GeometryId::get_new_id();
+  EncodedData data_other(id_other, true);
+  this->collision_filter_.AddGeometry(data_other.encoding());
+  this->X_WGs_.insert(
+      {id_other, RigidTransform<T>(Vector3<T>{0, 0, 1.5 * this->radius_})});
+  CollisionObjectd other(make_shared<Sphered>(this->radius_));
+  data_other.write_to(&other);
+
+  vector<ContactSurface<T>> surfaces;
+  CallbackData<T> data(&this->collision_filter_, &this->X_WGs_, &surfaces);
+  Callback<T>(this->sphere_.get(), &other, &data);
+  ASSERT_EQ(surfaces.size(), 1u);
+  EXPECT_GT(surfaces[0].mesh_W().num_faces(), 0);
+
+  GeometryCache cache;
+  CallbackData<T> cached_data(&this->collision_filter_, &this->X_WGs_,
+                              &surfaces, &cache);
+  Callback<T>(&other, this->sphere_.get(), &cached_data);
+  ASSERT_EQ(surfaces.size(), 2u);
+  EXPECT_EQ(cache.soft.size(), 2u);
+  EXPECT_EQ(surfaces[1].mesh_W().num_faces(),
+            surfaces[0].mesh_W().num_faces());
+}
+
+// Confirms that the geometry cache is populated by the first query and reused
+// by the next ones, which produce the same contact surface.
+TYPED_TEST(HydroelasticCallbackTyped, CachedGeometries) {
+  using T = TypeParam;
+
+  vector<ContactSurface<T>> surfaces;
+  GeometryCache cache;
+  CallbackData<T> data(&this->collision_filter_, &this->X_WGs_, &surfaces,
+                       &cache);
+  Callback<T>(this->sphere_.get(), this->box_.get(), &data);
+  ASSERT_EQ(surfaces.size(), 1u);
+  ASSERT_EQ(cache.soft.size(), 1u);
+  ASSERT_EQ(cache.rigid.size(), 1u);
+  const VolumeMesh<double>* const soft_mesh =
+      cache.soft.at(this->id_sphere_).geometry.mesh.get();
+  const SurfaceMesh<double>* const rigid_mesh =
+      cache.rigid.at(this->id_box_).mesh.get();
+  const GeometryCache::SurfaceSize& size = cache.surface_sizes.at(
+      SortedPair<GeometryId>(this->id_sphere_, this->id_box_));
+  EXPECT_EQ(size.num_faces, surfaces[0].mesh_W().num_faces());
+  EXPECT_EQ(size.num_vertices, surfaces[0].mesh_W().num_vertices());
+
+  // The order of the objects has no significance.
+  Callback<T>(this->box_.get(), this->sphere_.get(), &data);
+  ASSERT_EQ(surfaces.size(), 2u);
+  EXPECT_EQ(cache.soft.at(this->id_sphere_).geometry.mesh.get(), soft_mesh);
+  EXPECT_EQ(cache.rigid.at(this->id_box_).mesh.get(), rigid_mesh);
+  EXPECT_EQ(cache.surface_sizes.size(), 1u);
+  EXPECT_EQ(surfaces[1].mesh_W().num_faces(),
+            surfaces[0].mesh_W().num_faces());
+  EXPECT_EQ(surfaces[1].mesh_W().num_vertices(),
+            surfaces[0].mesh_W().num_vertices());
+
+  // Without a cache, the same contact surface is computed.
+  CallbackData<T> uncached_data(&this->collision_filter_, &this->X_WGs_,
+                                &surfaces);
+  Callback<T>(this->sphere_.get(), this->box_.get(), &uncached_data);
+  ASSERT_EQ(surfaces.size(), 3u);
+  EXPECT_EQ(surfaces[2].mesh_W().num_faces(),
+            surfaces[0].mesh_W().num_faces());
+}
+
 }  // namespace
 }  // namespace hydroelastic
 }  // namespace internal
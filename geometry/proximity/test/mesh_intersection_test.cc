@@ -666,6 +666,36 @@ GTEST_TEST(MeshIntersectionTest, ClipTriangleByTetrahedronIntoHeptagon) {
   EXPECT_TRUE(CompareConvexPolygon(expect_heptagon_M, polygon_M));
 }
 
+// The double overload of ClipTriangleByTetrahedron() that writes into an output
+// vector gives the same polygons as the templated reference implementation.
+GTEST_TEST(MeshIntersectionTest, ClipTriangleByTetrahedronDoubleOverload) {
+  auto volume_M = TrivialVolumeMesh<double>();
+  auto surface_N = TrivialSurfaceMesh<double>();
+  const SurfaceFaceIndex face(0);
+  std::vector<Vector3d> polygon_M;
+  int num_non_empty = 0;
+  for (int i = 0; i < 50; ++i) {
+    const RigidTransformd X_MN(
+        RollPitchYawd(0.3 * i, 0.2 * i, 0.1 * i),
+        Vector3d(0.02 * i - 0.5, 0.25 - 0.01 * i, 0.03 * i - 0.5));
+    for (VolumeElementIndex element(0); element < volume_M->num_elements();
+         ++element) {
+      const std::vector<Vector3d> expected_M =
+          mesh_intersection::ClipTriangleByTetrahedron<double>(
+              element, *volume_M, face, *surface_N, X_MN);
+      mesh_intersection::ClipTriangleByTetrahedron(
+          element, *volume_M, face, *surface_N, X_MN, &polygon_M);
+      ASSERT_EQ(polygon_M.size(), expected_M.size());
+      for (size_t v = 0; v < polygon_M.size(); ++v) {
+        EXPECT_TRUE(CompareMatrices(polygon_M[v], expected_M[v], 1e-15));
+      }
+      if (!polygon_M.empty()) ++num_non_empty;
+    }
+  }
+  // Make sure the poses exercise the clipping.
+  EXPECT_GT(num_non_empty, 0);
+}
+
 // TODO(DamrongGuoy): Add unit tests for AddPolygonToMeshData().
 
 // TODO(DamrongGuoy): Add unit tests for ComputeNormalField().
@@ -1016,6 +1046,282 @@ GTEST_TEST(MeshIntersectionTest, ComputeContactSurfaceSoftRigidMoving) {
   }
 }
 
+// Tests that the overload of ComputeContactSurfaceFromSoftVolumeRigidSurface
+// with prebuilt bounding volume hierarchies produces the same contact surface
+// as the one building them, whatever the size hints.
+GTEST_TEST(MeshIntersectionTest, ComputeContactSurfaceSoftRigidWithBvh) {
+  auto id_S = GeometryId::get_new_id();
+  auto id_R = GeometryId::get_new_id();
+  auto soft_mesh = OctahedronVolume<double>();
+  auto soft_field = OctahedronPressureField<double>(soft_mesh.get());
+  auto rigid_mesh = PyramidSurface<double>();
+  const internal::BoundingVolumeHierarchy<VolumeMesh<double>> bvh_S(
+      *soft_mesh);
+  const internal::BoundingVolumeHierarchy<SurfaceMesh<double>> bvh_R(
+      *rigid_mesh);
+
+  const auto X_WS = RigidTransformd(Vector3d(0.1, 0.2, 0.3));
+  const auto X_WR = X_WS * RigidTransformd(RollPitchYawd(0.1, 0.2, 0.3),
+                                           Vector3d(0, 0, -0.5));
+  auto expected =
+      mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+          id_S, *soft_field, X_WS, id_R, *rigid_mesh, X_WR);
+  ASSERT_GT(expected->mesh_W().num_faces(), 0);
+  for (int hint : {0, 1, 100}) {
+    auto contact =
+        mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+            id_S, *soft_field, bvh_S, X_WS, id_R, *rigid_mesh, bvh_R, X_WR,
+            hint, hint);
+    ASSERT_EQ(contact->mesh_W().num_faces(), expected->mesh_W().num_faces());
+    ASSERT_EQ(contact->mesh_W().num_vertices(),
+              expected->mesh_W().num_vertices());
+    const SurfaceMesh<double>::Barycentric centroid(1. / 3., 1. / 3.,
+                                                    1. / 3.);
+    for (SurfaceFaceIndex f(0); f < contact->mesh_W().num_faces(); ++f) {
+      for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(contact->mesh_W().element(f).vertex(i),
+                  expected->mesh_W().element(f).vertex(i));
+      }
+      EXPECT_EQ(contact->EvaluateE_MN(f, centroid),
+                expected->EvaluateE_MN(f, centroid));
+      EXPECT_TRUE(CompareMatrices(contact->EvaluateGrad_h_MN_W(f, centroid),
+                                  expected->EvaluateGrad_h_MN_W(f, centroid)));
+    }
+    for (SurfaceVertexIndex v(0); v < contact->mesh_W().num_vertices(); ++v) {
+      EXPECT_TRUE(CompareMatrices(contact->mesh_W().vertex(v).r_MV(),
+                                  expected->mesh_W().vertex(v).r_MV()));
+    }
+  }
+}
+
+// Integrates the pressure e over the contact surface, face by face, with the
+// value at the centroid of each face (exact for a linear field), and returns
+// the integral and the first moment of the area.
+std::pair<double, Vector3d> IntegrateContactSurface(
+    const ContactSurface<double>& contact) {
+  double integral_e = 0;
+  Vector3d first_moment = Vector3d::Zero();
+  for (SurfaceFaceIndex f(0); f < contact.num_faces(); ++f) {
+    integral_e += contact.area(f) * contact.EvaluateE_MNAtCentroid(f);
+    first_moment += contact.area(f) * contact.centroid(f);
+  }
+  return {integral_e, first_moment};
+}
+
+// Tests that the polygonal representation of the contact surface between a
+// soft volume and a rigid surface covers the same surface, with the same
+// fields, as the triangle one, with fewer faces and vertices.
+GTEST_TEST(MeshIntersectionTest, ComputeContactSurfaceSoftRigidPolygon) {
+  auto id_S = GeometryId::get_new_id();
+  auto id_R = GeometryId::get_new_id();
+  auto soft_mesh = OctahedronVolume<double>();
+  auto soft_field = OctahedronPressureField<double>(soft_mesh.get());
+  auto rigid_mesh = PyramidSurface<double>();
+  const internal::BoundingVolumeHierarchy<VolumeMesh<double>> bvh_S(
+      *soft_mesh);
+  const internal::BoundingVolumeHierarchy<SurfaceMesh<double>> bvh_R(
+      *rigid_mesh);
+
+  const auto X_WS = RigidTransformd(Vector3d(0.1, 0.2, 0.3));
+  const auto X_WR = X_WS * RigidTransformd(RollPitchYawd(0.1, 0.2, 0.3),
+                                           Vector3d(0, 0, -0.5));
+  auto triangles =
+      mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+          id_S, *soft_field, bvh_S, X_WS, id_R, *rigid_mesh, bvh_R, X_WR);
+  auto polygons =
+      mesh_intersection::ComputeContactSurfaceFromSoftVolumeRigidSurface(
+          id_S, *soft_field, bvh_S, X_WS, id_R, *rigid_mesh, bvh_R, X_WR, 0,
+          0, HydroelasticContactRepresentation::kPolygon);
+  ASSERT_TRUE(triangles->is_triangle());
+  ASSERT_FALSE(polygons->is_triangle());
+  EXPECT_EQ(polygons->representation(),
+            HydroelasticContactRepresentation::kPolygon);
+  ASSERT_GT(polygons->num_faces(), 0);
+  // Each polygon with more than three vertices is triangulated into as many
+  // triangles as it has vertices, around an additional vertex.
+  int num_triangles = 0;
+  int num_fan_vertices = 0;
+  for (SurfaceFaceIndex f(0); f < polygons->num_faces(); ++f) {
+    const int size = polygons->poly_mesh_W().face_size(f);
+    num_triangles += size == 3 ? 1 : size;
+    num_fan_vertices += size == 3 ? 0 : 1;
+  }
+  EXPECT_LT(polygons->num_faces(), triangles->num_faces());
+  EXPECT_EQ(triangles->num_faces(), num_triangles);
+  EXPECT_EQ(triangles->num_vertices(),
+            polygons->num_vertices() + num_fan_vertices);
+
+  const double kEps = 1e-12;
+  EXPECT_NEAR(polygons->poly_mesh_W().total_area(),
+              triangles->mesh_W().total_area(), kEps);
+  EXPECT_TRUE(
+      CompareMatrices(polygons->centroid(), triangles->centroid(), kEps));
+  const std::pair<double, Vector3d> integral_polygons =
+      IntegrateContactSurface(*polygons);
+  const std::pair<double, Vector3d> integral_triangles =
+      IntegrateContactSurface(*triangles);
+  EXPECT_GT(integral_polygons.first, 0);
+  EXPECT_NEAR(integral_polygons.first, integral_triangles.first, kEps);
+  EXPECT_TRUE(CompareMatrices(integral_polygons.second,
+                              integral_triangles.second, kEps));
+
+  // The polygons keep the orientation of the rigid surface's triangles.
+  for (SurfaceFaceIndex f(0); f < polygons->num_faces(); ++f) {
+    EXPECT_GT(polygons->poly_mesh_W().face_normal(f).dot(
+                  polygons->EvaluateGrad_h_MN_WAtCentroid(f)),
+              0);
+  }
+
+  // Copies keep the representation.
+  const ContactSurface<double> copy(*polygons);
+  EXPECT_FALSE(copy.is_triangle());
+  EXPECT_EQ(copy.num_faces(), polygons->num_faces());
+  EXPECT_NE(&copy.poly_mesh_W(), &polygons->poly_mesh_W());
+  EXPECT_EQ(IntegrateContactSurface(copy).first, integral_polygons.first);
+}
+
+GTEST_TEST(MeshIntersectionTest, CalcFieldGradient) {
+  auto mesh = OctahedronVolume<double>();
+  // A linear field f(p) = g⋅p + 3 has the gradient g in every element.
+  const Vector3d g(1, -2, 0.5);
+  std::vector<double> values;
+  for (const auto& vertex : mesh->vertices()) {
+    values.push_back(g.dot(vertex.r_MV()) + 3);
+  }
+  const VolumeMeshFieldLinear<double, double> field("f", std::move(values),
+                                                     mesh.get());
+  for (VolumeElementIndex e(0); e < mesh->num_elements(); ++e) {
+    EXPECT_TRUE(CompareMatrices(CalcFieldGradient(field, e), g, 1e-14));
+  }
+}
+
+GTEST_TEST(MeshIntersectionTest, SliceTetrahedronWithPlane) {
+  // The octahedron's first element has vertices (0, 0, 0), (1, 0, 0),
+  // (0, 1, 0), and (0, 0, 1).
+  auto mesh = OctahedronVolume<double>();
+  const VolumeElementIndex e(0);
+
+  // A plane that cuts off one vertex gives a triangle.
+  const std::vector<Vector3d> triangle =
+      SliceTetrahedronWithPlane(e, *mesh, HalfSpace<double>(Vector3d::UnitZ(),
+                                                            0.5));
+  ASSERT_EQ(triangle.size(), 3u);
+  for (const Vector3d& p : triangle) EXPECT_NEAR(p.z(), 0.5, 1e-15);
+  // Counter-clockwise around the plane normal.
+  EXPECT_GT((triangle[1] - triangle[0]).cross(triangle[2] - triangle[0]).z(),
+            0);
+  const std::vector<Vector3d> flipped = SliceTetrahedronWithPlane(
+      e, *mesh, HalfSpace<double>(-Vector3d::UnitZ(), -0.5));
+  ASSERT_EQ(flipped.size(), 3u);
+  EXPECT_LT((flipped[1] - flipped[0]).cross(flipped[2] - flipped[0]).z(), 0);
+
+  // A plane that separates two pairs of vertices gives a quadrilateral.
+  const std::vector<Vector3d> quad = SliceTetrahedronWithPlane(
+      e, *mesh, HalfSpace<double>(Vector3d(1, 1, 0).normalized(),
+                                  0.5 / std::sqrt(2.)));
+  ASSERT_EQ(quad.size(), 4u);
+  const Vector3d n = Vector3d(1, 1, 0).normalized();
+  for (int i = 0; i < 4; ++i) {
+    const Vector3d& p0 = quad[i];
+    const Vector3d& p1 = quad[(i + 1) % 4];
+    const Vector3d& p2 = quad[(i + 2) % 4];
+    EXPECT_GT((p1 - p0).cross(p2 - p1).dot(n), 0);
+  }
+
+  // Planes that miss the tetrahedron or only touch a vertex give nothing.
+  EXPECT_TRUE(SliceTetrahedronWithPlane(
+                  e, *mesh, HalfSpace<double>(Vector3d::UnitZ(), 2))
+                  .empty());
+  EXPECT_TRUE(SliceTetrahedronWithPlane(
+                  e, *mesh, HalfSpace<double>(Vector3d::UnitZ(), 1))
+                  .empty());
+}
+
+// Two soft octahedra A and B, with B one unit above A, have equal pressures
+// on the plane z = 1/2 (in A's frame). Their contact surface is the square
+// of that plane with |x| + |y| <= 1/2, where the pressure is
+// 1/2 - |x| - |y|, and ∇e_A - ∇e_B = (0, 0, -2).
+GTEST_TEST(MeshIntersectionTest, ComputeContactSurfaceSoftSoft) {
+  auto id_A = GeometryId::get_new_id();
+  auto id_B = GeometryId::get_new_id();
+  auto mesh_A = OctahedronVolume<double>();
+  auto field_A = OctahedronPressureField<double>(mesh_A.get());
+  auto mesh_B = OctahedronVolume<double>();
+  auto field_B = OctahedronPressureField<double>(mesh_B.get());
+  const internal::BoundingVolumeHierarchy<VolumeMesh<double>> bvh_A(*mesh_A);
+  const internal::BoundingVolumeHierarchy<VolumeMesh<double>> bvh_B(*mesh_B);
+
+  const RigidTransformd X_WA(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1, 2, 3));
+  const RigidTransformd X_WB = X_WA * RigidTransformd(Vector3d(0, 0, 1));
+  const double kEps = 1e-12;
+
+  auto contact_AB = ComputeContactSurfaceFromSoftVolumeSoftVolume(
+      id_A, *field_A, bvh_A, X_WA, id_B, *field_B, bvh_B, X_WB);
+  EXPECT_EQ(contact_AB->id_M(), id_A);
+  EXPECT_EQ(contact_AB->id_N(), id_B);
+  const SurfaceMesh<double>& mesh_W = contact_AB->mesh_W();
+  EXPECT_NEAR(mesh_W.total_area(), 0.5, kEps);
+  const RigidTransformd X_AW = X_WA.inverse();
+  for (SurfaceVertexIndex v(0); v < mesh_W.num_vertices(); ++v) {
+    const Vector3d p_AV = X_AW * mesh_W.vertex(v).r_MV();
+    EXPECT_NEAR(p_AV.z(), 0.5, kEps);
+    EXPECT_NEAR(contact_AB->EvaluateE_MN(v),
+                0.5 - std::abs(p_AV.x()) - std::abs(p_AV.y()), kEps);
+  }
+  const Vector3d expected_grad_h_W =
+      X_WA.rotation() * Vector3d(0, 0, -2);
+  const SurfaceMesh<double>::Barycentric centroid(1. / 3., 1. / 3.,
+                                                  1. / 3.);
+  for (SurfaceFaceIndex f(0); f < mesh_W.num_faces(); ++f) {
+    // Faces of zero area can come from tetrahedra that only share a face.
+    if (mesh_W.area(f) < kEps) continue;
+    EXPECT_TRUE(CompareMatrices(contact_AB->EvaluateGrad_h_MN_W(f, centroid),
+                                expected_grad_h_W, kEps));
+    // The faces are oriented along the gradient.
+    EXPECT_GT(mesh_W.face_normal(f).dot(expected_grad_h_W), 0);
+  }
+
+  // With the ids swapped, the surface is the same but the gradient is
+  // reversed (since ContactSurface orders M and N by id).
+  auto contact_BA = ComputeContactSurfaceFromSoftVolumeSoftVolume(
+      id_B, *field_A, X_WA, id_A, *field_B, X_WB);
+  EXPECT_EQ(contact_BA->id_M(), id_A);
+  EXPECT_EQ(contact_BA->id_N(), id_B);
+  EXPECT_NEAR(contact_BA->mesh_W().total_area(), 0.5, kEps);
+  for (SurfaceFaceIndex f(0); f < contact_BA->mesh_W().num_faces(); ++f) {
+    if (contact_BA->mesh_W().area(f) < kEps) continue;
+    EXPECT_TRUE(CompareMatrices(contact_BA->EvaluateGrad_h_MN_W(f, centroid),
+                                -expected_grad_h_W, kEps));
+  }
+
+  // The polygonal representation covers the same square.
+  auto polygons_AB = ComputeContactSurfaceFromSoftVolumeSoftVolume(
+      id_A, *field_A, bvh_A, X_WA, id_B, *field_B, bvh_B, X_WB,
+      HydroelasticContactRepresentation::kPolygon);
+  ASSERT_FALSE(polygons_AB->is_triangle());
+  EXPECT_LT(polygons_AB->num_faces(), contact_AB->num_faces());
+  EXPECT_NEAR(polygons_AB->poly_mesh_W().total_area(), 0.5, kEps);
+  EXPECT_TRUE(CompareMatrices(polygons_AB->centroid(), contact_AB->centroid(),
+                              kEps));
+  EXPECT_NEAR(IntegrateContactSurface(*polygons_AB).first,
+              IntegrateContactSurface(*contact_AB).first, kEps);
+  for (SurfaceFaceIndex f(0); f < polygons_AB->num_faces(); ++f) {
+    if (polygons_AB->area(f) < kEps) continue;
+    EXPECT_TRUE(
+        CompareMatrices(polygons_AB->EvaluateGrad_h_MN_WAtCentroid(f),
+                        expected_grad_h_W, kEps));
+    EXPECT_GT(
+        polygons_AB->poly_mesh_W().face_normal(f).dot(expected_grad_h_W), 0);
+  }
+
+  // Octahedra that don't overlap have no contact surface.
+  auto separated = ComputeContactSurfaceFromSoftVolumeSoftVolume(
+      id_A, *field_A, bvh_A, X_WA, id_B, *field_B, bvh_B,
+      X_WA * RigidTransformd(Vector3d(0, 0, 2.5)));
+  EXPECT_EQ(separated->mesh_W().num_faces(), 0);
+}
+
 // The ultimate proper spelling of mesh intersection allows for mixed scalar
 // types (double-valued meshes with autodiff-valued poses). The calling code
 // needs to assume this is possible, so we've added a specific overload with
@@ -1034,6 +1340,27 @@ GTEST_TEST(MeshIntersectionTest, DoubleAutoDiffMixed) {
       std::logic_error,
       "AutoDiff-valued ContactSurface calculation between meshes is not"
       "currently supported");
+
+  const internal::BoundingVolumeHierarchy<VolumeMesh<double>> soft_bvh(
+      *soft_mesh);
+  const internal::BoundingVolumeHierarchy<SurfaceMesh<double>> rigid_bvh(
+      *rigid_mesh);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ComputeContactSurfaceFromSoftVolumeRigidSurface(
+          GeometryId::get_new_id(), *soft_field, soft_bvh,
+          RigidTransform<AutoDiffXd>(), GeometryId::get_new_id(), *rigid_mesh,
+          rigid_bvh, RigidTransform<AutoDiffXd>()),
+      std::logic_error,
+      "AutoDiff-valued ContactSurface calculation between meshes is not"
+      "currently supported");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ComputeContactSurfaceFromSoftVolumeSoftVolume(
+          GeometryId::get_new_id(), *soft_field, soft_bvh,
+          RigidTransform<AutoDiffXd>(), GeometryId::get_new_id(), *soft_field,
+          soft_bvh, RigidTransform<AutoDiffXd>()),
+      std::logic_error,
+      "AutoDiff-valued ContactSurface calculation between meshes is not"
+      "currently supported");
 }
 
 }  // namespace
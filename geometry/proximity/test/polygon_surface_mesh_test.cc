@@ -0,0 +1,136 @@
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+// A triangle and a quadrilateral in the plane z = 1, sharing no vertices: the
+// triangle (0, 0), (1, 0), (0, 1) and the trapezoid (2, 0), (4, 0), (3, 1),
+// (2, 1).
+PolygonSurfaceMesh<double> MakeTriangleAndQuadMesh() {
+  std::vector<Vector3d> vertices{
+      Vector3d(0, 0, 1), Vector3d(1, 0, 1), Vector3d(0, 1, 1),
+      Vector3d(2, 0, 1), Vector3d(4, 0, 1), Vector3d(3, 1, 1),
+      Vector3d(2, 1, 1)};
+  std::vector<int> face_data{3, 0, 1, 2, 4, 3, 4, 5, 6};
+  return PolygonSurfaceMesh<double>(std::move(face_data), std::move(vertices));
+}
+
+GTEST_TEST(PolygonSurfaceMeshTest, Faces) {
+  const PolygonSurfaceMesh<double> mesh = MakeTriangleAndQuadMesh();
+  EXPECT_EQ(mesh.num_faces(), 2);
+  EXPECT_EQ(mesh.num_elements(), 2);
+  EXPECT_EQ(mesh.num_vertices(), 7);
+  EXPECT_EQ(mesh.face_size(SurfaceFaceIndex(0)), 3);
+  EXPECT_EQ(mesh.face_size(SurfaceFaceIndex(1)), 4);
+  EXPECT_EQ(mesh.face_vertex(SurfaceFaceIndex(1), 2), 5);
+}
+
+GTEST_TEST(PolygonSurfaceMeshTest, AreasNormalsAndCentroids) {
+  const PolygonSurfaceMesh<double> mesh = MakeTriangleAndQuadMesh();
+  const double kEps = 1e-14;
+  const SurfaceFaceIndex triangle(0);
+  const SurfaceFaceIndex quad(1);
+
+  EXPECT_NEAR(mesh.area(triangle), 0.5, kEps);
+  EXPECT_NEAR(mesh.area(quad), 1.5, kEps);
+  EXPECT_NEAR(mesh.total_area(), 2.0, kEps);
+  EXPECT_TRUE(CompareMatrices(mesh.face_normal(triangle), Vector3d::UnitZ(),
+                              kEps));
+  EXPECT_TRUE(CompareMatrices(mesh.face_normal(quad), Vector3d::UnitZ(),
+                              kEps));
+
+  // The trapezoid is a unit square [2, 3]² and the triangle (3, 0), (4, 0),
+  // (3, 1), with centroids (2.5, 0.5) and (10/3, 1/3).
+  const Vector3d p_MTc(1. / 3., 1. / 3., 1);
+  const Vector3d p_MQc((2.5 + 0.5 * 10. / 3.) / 1.5,
+                       (0.5 + 0.5 / 3.) / 1.5, 1);
+  EXPECT_TRUE(CompareMatrices(mesh.element_centroid(triangle), p_MTc, kEps));
+  EXPECT_TRUE(CompareMatrices(mesh.element_centroid(quad), p_MQc, kEps));
+  EXPECT_TRUE(CompareMatrices(mesh.centroid(),
+                              (0.5 * p_MTc + 1.5 * p_MQc) / 2.0, kEps));
+}
+
+// A linear function of the vertices is integrated exactly by its value at the
+// centroid.
+GTEST_TEST(PolygonSurfaceMeshTest, CentroidValue) {
+  const PolygonSurfaceMesh<double> mesh = MakeTriangleAndQuadMesh();
+  std::vector<double> values;
+  std::vector<Vector3d> positions;
+  for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+    const Vector3d& p_MV = mesh.vertex(v);
+    values.push_back(1.0 + 2.0 * p_MV.x() - 3.0 * p_MV.y());
+    positions.push_back(p_MV);
+  }
+  PolygonSurfaceMeshFieldLinear<double, double> field("f", std::move(values),
+                                                      &mesh);
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    const Vector3d& p_MC = mesh.element_centroid(f);
+    EXPECT_NEAR(field.EvaluateAtCentroid(f),
+                1.0 + 2.0 * p_MC.x() - 3.0 * p_MC.y(), 1e-14);
+    EXPECT_TRUE(
+        CompareMatrices(mesh.CalcCentroidValue(f, positions), p_MC, 1e-14));
+  }
+  EXPECT_EQ(field.EvaluateAtVertex(SurfaceVertexIndex(4)), 9.0);
+
+  const PolygonSurfaceMesh<double> mesh_copy(mesh);
+  const auto field_copy = field.CloneAndSetMesh(&mesh_copy);
+  EXPECT_EQ(&field_copy.mesh(), &mesh_copy);
+  EXPECT_EQ(field_copy.values(), field.values());
+}
+
+GTEST_TEST(PolygonSurfaceMeshTest, TransformAndReverse) {
+  PolygonSurfaceMesh<double> mesh = MakeTriangleAndQuadMesh();
+  const PolygonSurfaceMesh<double> original(mesh);
+  const RigidTransformd X_NM(
+      AngleAxisd(M_PI / 3, Vector3d(1, 2, 3).normalized()),
+      Vector3d(-1, 0.5, 2));
+  mesh.TransformVertices(X_NM);
+  const double kEps = 1e-13;
+  for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+    EXPECT_TRUE(
+        CompareMatrices(mesh.vertex(v), X_NM * original.vertex(v), kEps));
+  }
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    EXPECT_NEAR(mesh.area(f), original.area(f), kEps);
+    EXPECT_TRUE(CompareMatrices(mesh.face_normal(f),
+                                X_NM.rotation() * original.face_normal(f),
+                                kEps));
+    EXPECT_TRUE(CompareMatrices(mesh.element_centroid(f),
+                                X_NM * original.element_centroid(f), kEps));
+  }
+  EXPECT_TRUE(
+      CompareMatrices(mesh.centroid(), X_NM * original.centroid(), kEps));
+
+  mesh = original;
+  mesh.ReverseFaceWinding();
+  EXPECT_EQ(mesh.face_vertex(SurfaceFaceIndex(1), 0), 6);
+  EXPECT_EQ(mesh.face_vertex(SurfaceFaceIndex(1), 3), 3);
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    EXPECT_TRUE(CompareMatrices(mesh.face_normal(f), -original.face_normal(f),
+                                kEps));
+    // The weights of the vertices in the centroids follow the vertices.
+    std::vector<Vector3d> positions;
+    for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+      positions.push_back(mesh.vertex(v));
+    }
+    EXPECT_TRUE(CompareMatrices(mesh.CalcCentroidValue(f, positions),
+                                original.element_centroid(f), kEps));
+  }
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,119 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kTolerance = 1e-14;
+
+GTEST_TEST(CastRayTest, Sphere) {
+  const fcl::Sphered sphere(0.5);
+  const RigidTransformd X_WG(Vector3d(1, 2, 3));
+  // A ray along +x towards the center hits at distance 2 - 0.5.
+  EXPECT_NEAR(CastRay(sphere, X_WG, Vector3d(-1, 2, 3), Vector3d::UnitX()),
+              1.5, kTolerance);
+  // Pointing away from the sphere.
+  EXPECT_EQ(CastRay(sphere, X_WG, Vector3d(-1, 2, 3), -Vector3d::UnitX()),
+            kInf);
+  // Passing beside the sphere.
+  EXPECT_EQ(CastRay(sphere, X_WG, Vector3d(-1, 2.6, 3), Vector3d::UnitX()),
+            kInf);
+  // Starting inside.
+  EXPECT_EQ(CastRay(sphere, X_WG, Vector3d(1.1, 2, 3), Vector3d::UnitY()), 0);
+}
+
+GTEST_TEST(CastRayTest, Box) {
+  const fcl::Boxd box(2, 4, 6);
+  // The box is rotated by 90° about z, so its x extent becomes 4 in world.
+  const RigidTransformd X_WG(RollPitchYawd(0, 0, M_PI / 2), Vector3d::Zero());
+  EXPECT_NEAR(CastRay(box, X_WG, Vector3d(-5, 0, 0), Vector3d::UnitX()), 3,
+              kTolerance);
+  EXPECT_NEAR(CastRay(box, X_WG, Vector3d(0, 5, 0), -Vector3d::UnitY()), 4,
+              kTolerance);
+  EXPECT_NEAR(CastRay(box, X_WG, Vector3d(0, 0, 10), -Vector3d::UnitZ()), 7,
+              kTolerance);
+  // A diagonal ray entering through the corner region.
+  const Vector3d dir = Vector3d(1, 1, 0).normalized();
+  EXPECT_NEAR(CastRay(box, X_WG, Vector3d(-3, -3, 0), dir), 2 * std::sqrt(2),
+              kTolerance);
+  EXPECT_EQ(CastRay(box, X_WG, Vector3d(-5, 1.5, 0), Vector3d::UnitX()), kInf);
+  EXPECT_EQ(CastRay(box, X_WG, Vector3d(0.5, 0.5, 0.5), Vector3d::UnitZ()), 0);
+}
+
+GTEST_TEST(CastRayTest, Cylinder) {
+  const fcl::Cylinderd cylinder(1, 2);
+  const RigidTransformd X_WG;
+  // Through the side.
+  EXPECT_NEAR(CastRay(cylinder, X_WG, Vector3d(-3, 0, 0.5), Vector3d::UnitX()),
+              2, kTolerance);
+  // Through the cap.
+  EXPECT_NEAR(CastRay(cylinder, X_WG, Vector3d(0.5, 0, 4), -Vector3d::UnitZ()),
+              3, kTolerance);
+  // Parallel to the axis, outside the radius.
+  EXPECT_EQ(CastRay(cylinder, X_WG, Vector3d(1.5, 0, 4), -Vector3d::UnitZ()),
+            kInf);
+  // Above the cap.
+  EXPECT_EQ(CastRay(cylinder, X_WG, Vector3d(-3, 0, 1.5), Vector3d::UnitX()),
+            kInf);
+}
+
+GTEST_TEST(CastRayTest, HalfSpace) {
+  const fcl::Halfspaced half_space(Vector3d::UnitZ(), 0);
+  const RigidTransformd X_WG(Vector3d(0, 0, -1));
+  const Vector3d dir = Vector3d(1, 0, -1).normalized();
+  EXPECT_NEAR(CastRay(half_space, X_WG, Vector3d(0, 0, 1), dir),
+              2 * std::sqrt(2), kTolerance);
+  EXPECT_EQ(CastRay(half_space, X_WG, Vector3d(0, 0, 1), Vector3d::UnitX()),
+            kInf);
+  EXPECT_EQ(CastRay(half_space, X_WG, Vector3d(0, 0, -2), Vector3d::UnitZ()),
+            0);
+}
+
+GTEST_TEST(CastRayTest, Convex) {
+  // The cube [-1, 1]³, with faces in the format of fcl::Convex.
+  auto vertices = std::make_shared<std::vector<Vector3d>>();
+  for (int i = 0; i < 8; ++i) {
+    vertices->emplace_back(i & 1 ? 1 : -1, i & 2 ? 1 : -1, i & 4 ? 1 : -1);
+  }
+  auto faces = std::make_shared<std::vector<int>>(std::vector<int>{
+      4, 0, 2, 3, 1,  4, 4, 5, 7, 6,  4, 0, 1, 5, 4,
+      4, 2, 6, 7, 3,  4, 0, 4, 6, 2,  4, 1, 3, 7, 5});
+  const fcl::Convexd convex(vertices, 6, faces);
+  const RigidTransformd X_WG(Vector3d(0, 0, 3));
+  EXPECT_NEAR(CastRay(convex, X_WG, Vector3d(0.5, 0.5, 0), Vector3d::UnitZ()),
+              2, kTolerance);
+  EXPECT_NEAR(CastRay(convex, X_WG, Vector3d(-4, 0, 3), Vector3d::UnitX()), 3,
+              kTolerance);
+  EXPECT_EQ(CastRay(convex, X_WG, Vector3d(1.5, 0, 0), Vector3d::UnitZ()),
+            kInf);
+  EXPECT_EQ(CastRay(convex, X_WG, Vector3d(0, 0, 3), Vector3d::UnitZ()), 0);
+}
+
+// Shapes without ray-casting support report a miss.
+GTEST_TEST(CastRayTest, UnsupportedShape) {
+  const fcl::Ellipsoidd ellipsoid(1, 2, 3);
+  EXPECT_EQ(CastRay(ellipsoid, RigidTransformd(), Vector3d(-5, 0, 0),
+                    Vector3d::UnitX()),
+            kInf);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
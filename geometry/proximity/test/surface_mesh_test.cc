@@ -342,6 +342,35 @@ GTEST_TEST(SurfaceMeshTest, TransformVertices) {
     const Vector3d p_FV_ref = X_FM * p_MV_ref;
     EXPECT_TRUE(CompareMatrices(p_FV_test, p_FV_ref));
   }
+  EXPECT_TRUE(CompareMatrices(test_mesh->centroid(),
+                              X_FM * ref_mesh->centroid(), 1e-15));
+}
+
+// Checks the face normals, and that they follow changes of the winding and of
+// the frame of the vertices.
+GTEST_TEST(SurfaceMeshTest, FaceNormals) {
+  auto mesh = TestSurfaceMesh<double>();
+  for (SurfaceFaceIndex f(0); f < mesh->num_faces(); ++f) {
+    EXPECT_TRUE(CompareMatrices(mesh->face_normal(f), Vector3d::UnitZ()));
+  }
+
+  mesh->ReverseFaceWinding();
+  for (SurfaceFaceIndex f(0); f < mesh->num_faces(); ++f) {
+    EXPECT_TRUE(CompareMatrices(mesh->face_normal(f), -Vector3d::UnitZ()));
+  }
+
+  const RigidTransformd X_FM{
+      AngleAxisd{M_PI / 4, Vector3d(1, 2, 3).normalized()}, Vector3d{1, 2, 3}};
+  mesh->TransformVertices(X_FM);
+  const Vector3d n_F = X_FM.rotation() * -Vector3d::UnitZ();
+  for (SurfaceFaceIndex f(0); f < mesh->num_faces(); ++f) {
+    EXPECT_TRUE(CompareMatrices(mesh->face_normal(f), n_F, 1e-15));
+  }
+
+  // Zero-area faces have zero normals.
+  auto zero_area_mesh = GenerateZeroAreaMesh();
+  EXPECT_TRUE(CompareMatrices(zero_area_mesh->face_normal(SurfaceFaceIndex(0)),
+                              Vector3d::Zero()));
 }
 
 }  // namespace
@@ -8,6 +8,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/mesh_field_linear.h"
 #include "drake/geometry/proximity/volume_mesh_field.h"
 #include "drake/math/rigid_transform.h"
@@ -198,5 +199,39 @@ std::unique_ptr<VolumeMeshFieldLinear<T, T>> TestVolumeMeshField() {
   return volume_mesh_field;
 }
 
+using Eigen::Vector3d;
+
+// Tests that the precomputed gradients of a scalar field give the same values
+// as the barycentric coordinates, with the mesh posed away from its frame's
+// origin.
+GTEST_TEST(VolumeMeshFieldTest, EvaluateCartesianAndGradient) {
+  const math::RigidTransformd X_WM(
+      Eigen::AngleAxisd(M_PI / 5, Vector3d(1, -2, 3).normalized()),
+      Vector3d(0.5, -1, 2));
+  auto volume_mesh = TestVolumeMesh<double>(X_WM);
+  // In M's frame, the field is 1 + x + 2y + 3z on e0 and 1 + x + 2y - 4z on
+  // e1 (where z <= 0), i.e., it has a kink across their common face z = 0.
+  std::vector<double> values = {1, 2, 3, 4, 5};
+  const VolumeMeshFieldLinear<double, double> field(
+      "pressure", std::move(values), volume_mesh.get());
+
+  const double kEps = 1e-14;
+  const Vector3d expected_gradients_M[2] = {Vector3d(1, 2, 3),
+                                            Vector3d(1, 2, -4)};
+  for (VolumeElementIndex e(0); e < 2; ++e) {
+    EXPECT_TRUE(CompareMatrices(field.EvaluateGradient(e),
+                                X_WM.rotation() * expected_gradients_M[e],
+                                kEps));
+    for (const Vector3d& p_MQ :
+         {Vector3d(0.1, 0.2, 0.3), Vector3d(0.3, 0.3, -0.2),
+          Vector3d(2, -1, 0.5)}) {
+      const Vector3d p_WQ = X_WM * p_MQ;
+      EXPECT_NEAR(field.EvaluateCartesian(e, p_WQ),
+                  field.Evaluate(e, volume_mesh->CalcBarycentric(p_WQ, e)),
+                  kEps);
+    }
+  }
+}
+
 }  // namespace geometry
 }  // namespace drake
@@ -1,22 +1,38 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fcl/fcl.h>
+#include <fmt/format.h>
 #include <tiny_obj_loader.h>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/file_cache.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
 #include "drake/geometry/proximity/collision_filter_legacy.h"
+#include "drake/geometry/proximity/convex_disk_cache.h"
+#include "drake/geometry/proximity/convex_penetration.h"
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 #include "drake/geometry/proximity/distance_to_point_with_gradient.h"
 #include "drake/geometry/proximity/distance_to_shape_callback.h"
 #include "drake/geometry/proximity/find_collision_candidates_callback.h"
 #include "drake/geometry/proximity/hydroelastic_callback.h"
+#include "drake/geometry/proximity/ray_cast.h"
 #include "drake/geometry/utilities.h"
 
 static_assert(std::is_same<tinyobj::real_t, double>::value,
@@ -26,6 +42,7 @@ namespace drake {
 namespace geometry {
 namespace internal {
 
+using Eigen::Isometry3d;
 using Eigen::Vector3d;
 using fcl::CollisionObjectd;
 using math::RigidTransform;
@@ -143,72 +160,211 @@ bool SingleCollisionCallback(CollisionObjectd* fcl_object_A_ptr,
   return false;
 }
 
-// Returns a copy of the given fcl collision geometry; throws an exception for
-// unsupported collision geometry types. This supplements the *missing* cloning
-// functionality in FCL. Issue has been submitted to FCL:
-// https://github.com/flexible-collision-library/fcl/issues/246
-shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
-    const fcl::CollisionGeometryd& geometry) {
-  // NOTE: Returns a shared pointer because of the FCL API in assigning
-  // collision geometry to collision objects.
-  switch (geometry.getNodeType()) {
-    case fcl::GEOM_SPHERE: {
-      const auto& sphere = dynamic_cast<const fcl::Sphered&>(geometry);
-      return make_shared<fcl::Sphered>(sphere.radius);
-    }
-    case fcl::GEOM_CYLINDER: {
-      const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
-      return make_shared<fcl::Cylinderd>(cylinder.radius, cylinder.lz);
-    }
-    case fcl::GEOM_HALFSPACE:
-      // All half spaces are defined exactly the same.
-      return make_shared<fcl::Halfspaced>(0, 0, 1, 0);
-    case fcl::GEOM_BOX: {
-      const auto& box = dynamic_cast<const fcl::Boxd&>(geometry);
-      return make_shared<fcl::Boxd>(box.side);
-    }
-    case fcl::GEOM_CONVEX: {
-      const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
-      // TODO(DamrongGuoy): Change to the copy constructor Convex(other) when
-      //  we figure out why "Convex(const Convex& other) = default" created
-      //  link errors for Xenial Debug build.  For now we do deep copy of the
-      //  vertices and faces instead of simply copying the shared pointer.
-      return make_shared<fcl::Convexd>(
-          make_shared<const std::vector<Vector3d>>(convex.getVertices()),
-          convex.getFaceCount(),
-          make_shared<const std::vector<int>>(convex.getFaces()));
-    }
-    case fcl::GEOM_ELLIPSOID:
-    case fcl::GEOM_CAPSULE:
-    case fcl::GEOM_CONE:
-    case fcl::GEOM_PLANE:
-    case fcl::GEOM_TRIANGLE:
-      throw std::logic_error(
-          "Trying to copy fcl::CollisionGeometry of unsupported GEOM_* type");
-    default:
-      throw std::logic_error(
-          "Trying to copy fcl::CollisionGeometry of non GEOM_* type");
+// Like SingleCollisionCallback(), for a pair of Convex geometries: the
+// penetration is computed on their support hulls by GJK/EPA, warm started
+// from the result of the previous query between them. The geometry A must
+// have the smaller id.
+void ConvexConvexCollision(const CollisionObjectd& fcl_object_A,
+                           const convex_penetration::ConvexHull& hull_A,
+                           const CollisionObjectd& fcl_object_B,
+                           const convex_penetration::ConvexHull& hull_B,
+                           convex_penetration::PairCache* pair_cache,
+                           CollisionData* collision_data) {
+  const EncodedData encoding_A(fcl_object_A);
+  const EncodedData encoding_B(fcl_object_B);
+  DRAKE_ASSERT(encoding_A.id() < encoding_B.id());
+  if (!collision_data->collision_filter.CanCollideWith(
+          encoding_A.encoding(), encoding_B.encoding())) {
+    return;
+  }
+
+  convex_penetration::Penetration result;
+  if (!convex_penetration::ComputePenetration(
+          hull_A, RigidTransformd(fcl_object_A.getTransform()), hull_B,
+          RigidTransformd(fcl_object_B.getTransform()), pair_cache,
+          &result)) {
+    return;
+  }
+
+  PenetrationAsPointPair<double> penetration;
+  penetration.depth = result.depth;
+  penetration.id_A = encoding_A.id();
+  penetration.id_B = encoding_B.id();
+  penetration.p_WCa = result.p_WCa;
+  penetration.p_WCb = result.p_WCb;
+  penetration.nhat_BA_W = result.nhat_BA_W;
+  collision_data->contacts->emplace_back(std::move(penetration));
+}
+
+// Like shape_distance::Callback(), for a pair of Convex geometries: the signed
+// distance is computed on their support hulls by GJK (and EPA, if they
+// penetrate), warm started from the result of the previous query between them,
+// and cut short once they are proven farther apart than the maximum distance.
+// The geometry A must have the smaller id.
+template <typename T>
+void ConvexConvexDistance(const CollisionObjectd& fcl_object_A,
+                          const convex_penetration::ConvexHull& hull_A,
+                          const CollisionObjectd& fcl_object_B,
+                          const convex_penetration::ConvexHull& hull_B,
+                          convex_penetration::PairCache* pair_cache,
+                          shape_distance::CallbackData<T>* data) {
+  const EncodedData encoding_A(fcl_object_A);
+  const EncodedData encoding_B(fcl_object_B);
+  DRAKE_ASSERT(encoding_A.id() < encoding_B.id());
+  if (!data->collision_filter.CanCollideWith(encoding_A.encoding(),
+                                             encoding_B.encoding())) {
+    return;
+  }
+
+  const RigidTransformd X_WA(fcl_object_A.getTransform());
+  const RigidTransformd X_WB(fcl_object_B.getTransform());
+  convex_penetration::SignedDistance result;
+  if (!convex_penetration::ComputeSignedDistance(hull_A, X_WA, hull_B, X_WB,
+                                                 data->max_distance,
+                                                 pair_cache, &result)) {
+    return;
+  }
+  // Like the fcl fallback, touching hulls have no unique normal (NaN).
+  data->nearest_pairs.emplace_back(
+      encoding_A.id(), encoding_B.id(),
+      (X_WA.inverse() * result.p_WCa).template cast<T>(),
+      (X_WB.inverse() * result.p_WCb).template cast<T>(), T(result.distance),
+      result.nhat_BA_W.template cast<T>(), !std::isnan(result.nhat_BA_W.x()));
+}
+
+// A pair of fcl objects reported by the broadphase as a collision (or
+// distance) candidate. The objects are stored non-const only to satisfy the
+// fcl callback API; they are never modified.
+using FclObjectPair = std::pair<CollisionObjectd*, CollisionObjectd*>;
+
+// Struct for use in CollectCandidatesCallback() and
+// CollectDistanceCandidatesCallback(). Accumulates the unfiltered broadphase
+// candidates in the order in which the broadphase reports them.
+struct CandidateData {
+  CandidateData(const CollisionFilterLegacy* collision_filter_in,
+                std::vector<FclObjectPair>* candidates_in)
+      : collision_filter(*collision_filter_in), candidates(*candidates_in) {}
+
+  // Collision filter used to exclude filtered pairs.
+  const CollisionFilterLegacy& collision_filter;
+
+  // For distance queries only, the distance beyond which the broadphase may
+  // cull pairs.
+  double max_distance{0};
+
+  // The collected candidate pairs.
+  std::vector<FclObjectPair>& candidates;
+};
+
+// Broadphase collide() callback that records every unfiltered candidate pair
+// so that the narrowphase can subsequently be evaluated on multiple threads.
+bool CollectCandidatesCallback(CollisionObjectd* fcl_object_A_ptr,
+                               CollisionObjectd* fcl_object_B_ptr,
+                               void* callback_data) {
+  auto& data = *static_cast<CandidateData*>(callback_data);
+  const EncodedData encoding_A(*fcl_object_A_ptr);
+  const EncodedData encoding_B(*fcl_object_B_ptr);
+  if (data.collision_filter.CanCollideWith(encoding_A.encoding(),
+                                           encoding_B.encoding())) {
+    data.candidates.emplace_back(fcl_object_A_ptr, fcl_object_B_ptr);
   }
+  // Returning false tells the broadphase to report all candidates.
+  return false;
+}
+
+// Broadphase distance() callback that records every unfiltered candidate
+// pair. The filtering and the culling distance match those applied by
+// shape_distance::Callback() so that the broadphase reports the same pairs in
+// the same order.
+bool CollectDistanceCandidatesCallback(CollisionObjectd* fcl_object_A_ptr,
+                                       CollisionObjectd* fcl_object_B_ptr,
+                                       // NOLINTNEXTLINE
+                                       void* callback_data, double& max_dist) {
+  auto& data = *static_cast<CandidateData*>(callback_data);
+  const double kEps = std::numeric_limits<double>::epsilon() / 10;
+  max_dist = std::max(data.max_distance, kEps);
+  CollectCandidatesCallback(fcl_object_A_ptr, fcl_object_B_ptr, callback_data);
+  return false;
+}
+
+// Struct for use in CollectPointCandidatesCallback(). Accumulates
+// (point index, geometry object) candidates for a batch of point queries.
+struct PointCandidateData {
+  // The shape shared by all of the query points' fcl objects, which
+  // distinguishes them from the geometries.
+  const fcl::CollisionGeometryd* query_shape{};
+
+  // The distance beyond which the broadphase may cull pairs.
+  double threshold{};
+
+  // The collected candidates; each point's index is stored as its object's
+  // user data.
+  std::vector<std::pair<int, CollisionObjectd*>> candidates;
+};
+
+// Broadphase distance() callback between a tree of query points and a tree of
+// geometries; the culling distance matches that of point_distance::Callback().
+bool CollectPointCandidatesCallback(CollisionObjectd* fcl_object_A_ptr,
+                                    CollisionObjectd* fcl_object_B_ptr,
+                                    // NOLINTNEXTLINE
+                                    void* callback_data, double& threshold) {
+  auto& data = *static_cast<PointCandidateData*>(callback_data);
+  const double kEps = std::numeric_limits<double>::epsilon() / 10;
+  threshold = std::max(data.threshold, kEps);
+  const bool A_is_query =
+      fcl_object_A_ptr->collisionGeometry().get() == data.query_shape;
+  CollisionObjectd* query = A_is_query ? fcl_object_A_ptr : fcl_object_B_ptr;
+  CollisionObjectd* geometry = A_is_query ? fcl_object_B_ptr : fcl_object_A_ptr;
+  data.candidates.emplace_back(
+      static_cast<int>(reinterpret_cast<intptr_t>(query->getUserData())),
+      geometry);
+  return false;
+}
+
+// Struct for use in CollectRayCandidatesCallback(). Accumulates
+// (ray index, geometry object) candidates for a batch of ray casts.
+struct RayCandidateData {
+  // The shape shared by all of the rays' fcl objects, which distinguishes them
+  // from the geometries.
+  const fcl::CollisionGeometryd* ray_shape{};
+
+  // The collected candidates; each ray's index is stored as its object's user
+  // data.
+  std::vector<std::pair<int, CollisionObjectd*>> candidates;
+};
+
+// Broadphase collide() callback between a tree of rays and a tree of
+// geometries; it is only invoked for pairs whose bounding boxes overlap.
+bool CollectRayCandidatesCallback(CollisionObjectd* fcl_object_A_ptr,
+                                  CollisionObjectd* fcl_object_B_ptr,
+                                  void* callback_data) {
+  auto& data = *static_cast<RayCandidateData*>(callback_data);
+  const bool A_is_ray =
+      fcl_object_A_ptr->collisionGeometry().get() == data.ray_shape;
+  CollisionObjectd* ray = A_is_ray ? fcl_object_A_ptr : fcl_object_B_ptr;
+  CollisionObjectd* geometry = A_is_ray ? fcl_object_B_ptr : fcl_object_A_ptr;
+  data.candidates.emplace_back(
+      static_cast<int>(reinterpret_cast<intptr_t>(ray->getUserData())),
+      geometry);
+  return false;
 }
 
-// Helper function that creates a *deep* copy of the given collision object.
-unique_ptr<CollisionObjectd> CopyFclObjectOrThrow(
-    const CollisionObjectd& object) {
-  shared_ptr<fcl::ShapeBased> geometry_copy =
-      CopyShapeOrThrow(*object.collisionGeometry());
-  auto copy = make_unique<CollisionObjectd>(geometry_copy);
-  copy->setUserData(object.getUserData());
-  copy->setTransform(object.getTransform());
-  copy->computeAABB();
-  return copy;
+// Helper function that copies the given collision object. The copy shares the
+// object's collision geometry: shapes never change once they are registered,
+// so only the object's pose and bounding box need to be copied. (Convex
+// shapes, in particular, can be large.) This uses the copy
+// constructor rather than constructing from the geometry, which would
+// recompute the geometry's local bounding box, i.e., write to shared data.
+unique_ptr<CollisionObjectd> CopyFclObject(const CollisionObjectd& object) {
+  return make_unique<CollisionObjectd>(object);
 }
 
-// Helper function that creates a deep copy of a vector of collision objects.
+// Helper function that copies a vector of collision objects.
 // Assumes the input vector has already been cleared. The `copy_map` parameter
 // serves as a mapping from each source object to its corresponding copy. Used
 // to facilitate copying broadphase culling data structures (see
 // ProximityEngine::operator=()).
-void CopyFclObjectsOrThrow(
+void CopyFclObjects(
     const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>&
         source_objects,
     unordered_map<GeometryId, unique_ptr<CollisionObjectd>>* target_objects,
@@ -217,14 +373,14 @@ void CopyFclObjectsOrThrow(
   for (const auto& source_id_object_pair : source_objects) {
     const GeometryId source_id = source_id_object_pair.first;
     const CollisionObjectd& source_object = *source_id_object_pair.second;
-    (*target_objects)[source_id] = CopyFclObjectOrThrow(source_object);
+    (*target_objects)[source_id] = CopyFclObject(source_object);
     copy_map->insert({&source_object, (*target_objects)[source_id].get()});
   }
 }
 
 // Builds into the target AABB tree manager based on the reference "other"
 // manager and the lookup table from other's collision objects to the target's
-// collision objects (the map populated by CopyFclObjectsOrThrow()).
+// collision objects (the map populated by CopyFclObjects()).
 void BuildTreeFromReference(
     const fcl::DynamicAABBTreeCollisionManager<double>& other,
     const std::unordered_map<const CollisionObjectd*,
@@ -238,6 +394,14 @@ void BuildTreeFromReference(
   target->update();
 }
 
+// The vertices and faces of a Convex, in the format of fcl::Convex, as read
+// from its .obj file.
+struct ConvexData {
+  std::shared_ptr<const std::vector<Vector3d>> vertices;
+  int num_faces{};
+  std::shared_ptr<const std::vector<int>> faces;
+};
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -257,15 +421,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Copy all of the geometry.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*>
         object_map;
-    CopyFclObjectsOrThrow(other.anchored_objects_, &anchored_objects_,
+    CopyFclObjects(other.anchored_objects_, &anchored_objects_,
                           &object_map);
-    CopyFclObjectsOrThrow(other.dynamic_objects_, &dynamic_objects_,
+    CopyFclObjects(other.dynamic_objects_, &dynamic_objects_,
                           &object_map);
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
     collision_filter_ = other.collision_filter_;
+    max_num_threads_ = other.max_num_threads_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -283,11 +448,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Copy all of the geometry.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*>
         object_map;
-    CopyFclObjectsOrThrow(anchored_objects_, &engine->anchored_objects_,
+    CopyFclObjects(anchored_objects_, &engine->anchored_objects_,
                           &object_map);
-    CopyFclObjectsOrThrow(dynamic_objects_, &engine->dynamic_objects_,
+    CopyFclObjects(dynamic_objects_, &engine->dynamic_objects_,
                           &object_map);
     engine->collision_filter_ = this->collision_filter_;
+    engine->max_num_threads_ = this->max_num_threads_;
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
@@ -297,6 +463,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void AddDynamicGeometry(const Shape& shape, GeometryId id) {
+    InvalidateCandidates();
     // The collision object gets instantiated in the reification process and
     // placed in this unique pointer.
     std::unique_ptr<CollisionObjectd> fcl_object;
@@ -311,6 +478,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   void AddAnchoredGeometry(const Shape& shape, const RigidTransformd& X_WG,
                            GeometryId id) {
+    InvalidateCandidates();
     // The collision object gets instantiated in the reification process and
     // placed in this unique pointer.
     std::unique_ptr<CollisionObjectd> fcl_object;
@@ -327,6 +495,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void RemoveGeometry(GeometryId id, bool is_dynamic) {
+    InvalidateCandidates();
+    hydroelastic_cache_.Clear();
+    convex_cache_.hulls.erase(id);
+    convex_cache_.pairs.clear();
     if (is_dynamic) {
       RemoveGeometry(id, &dynamic_tree_, &dynamic_objects_);
     } else {
@@ -348,22 +520,48 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_max_num_threads(int max_num_threads) {
+    DRAKE_THROW_UNLESS(max_num_threads >= 1);
+    max_num_threads_ = max_num_threads;
+  }
+
+  int max_num_threads() const { return max_num_threads_; }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
+    // Only the objects whose poses changed since the last update are refit
+    // in the broadphase (e.g., the links of an arm on a parked mobile base).
+    moved_objects_.clear();
     for (const auto& id_object_pair : dynamic_objects_) {
       const GeometryId id = id_object_pair.first;
+      CollisionObjectd* fcl_object = id_object_pair.second.get();
       const RigidTransform<T>& X_WG = X_WGs.at(id);
       // The FCL broadphase requires double-valued poses; so we use ADL to
       // efficiently get double-valued poses out of arbitrary T-valued poses.
-      dynamic_objects_[id]->setTransform(
-          convert_to_double(X_WG).GetAsIsometry3());
-      dynamic_objects_[id]->computeAABB();
+      const Isometry3d X_WG_double = convert_to_double(X_WG).GetAsIsometry3();
+      if (X_WG_double.matrix() == fcl_object->getTransform().matrix()) {
+        continue;
+      }
+      fcl_object->setTransform(X_WG_double);
+      fcl_object->computeAABB();
+      moved_objects_.push_back(fcl_object);
+    }
+    if (!moved_objects_.empty()) {
+      InvalidateCandidates();
+    }
+    // Refitting the whole tree is linear in the number of objects, whereas
+    // each moved object is reinserted in logarithmic time; past a fraction of
+    // moved objects, the former is cheaper. (Either also rebalances the tree
+    // if objects were added since the last update.)
+    if (2 * moved_objects_.size() > dynamic_objects_.size()) {
+      dynamic_tree_.update();
+    } else {
+      dynamic_tree_.update(moved_objects_);
     }
-    dynamic_tree_.update();
   }
 
   // Implementation of ShapeReifier interface
@@ -469,6 +667,95 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void ImplementGeometry(const Convex& convex, void* user_data) override {
+    // The unscaled vertices and the faces are read once per file (and
+    // reloaded only when the file changes), and shared by all the Convex
+    // objects created from it, in every engine of the process. So are the
+    // scaled vertices, for each scale.
+    const std::shared_ptr<const ConvexData> data =
+        GetConvexData(convex.filename());
+
+    std::shared_ptr<const std::vector<Vector3d>> vertices = data->vertices;
+    if (convex.scale() != 1.0) {
+      vertices =
+          drake::internal::FileCache<const std::vector<Vector3d>>::GetOrLoad(
+              convex.filename(),
+              fmt::format("{}?scale={}", convex.filename(), convex.scale()),
+              [&data, &convex]() {
+                auto scaled =
+                    std::make_shared<std::vector<Vector3d>>(*data->vertices);
+                for (Vector3d& vertex : *scaled) {
+                  vertex *= convex.scale();
+                }
+                return scaled;
+              });
+    }
+
+    // Create fcl::Convex.
+    auto fcl_convex = make_shared<fcl::Convexd>(
+        vertices, data->num_faces, data->faces);
+    TakeShapeOwnership(fcl_convex, user_data);
+  }
+
+  // Returns the vertices (unscaled) and the faces of a Convex, from the cache
+  // or else from its .obj file.
+  std::shared_ptr<const ConvexData> GetConvexData(
+      const std::string& filename) const {
+    return drake::internal::FileCache<const ConvexData>::GetOrLoad(
+        filename, [this, &filename]() {
+          return ReadConvexData(filename);
+        });
+  }
+
+  static void PreloadConvexFiles(const std::vector<std::string>& filenames,
+                                 int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    Impl reader;
+    StaticParallelForIndexLoop(
+        num_threads, 0, static_cast<int>(filenames.size()),
+        [&reader, &filenames](int, int i) {
+          try {
+            reader.GetConvexData(filenames[i]);
+          } catch (const std::exception&) {
+            // The error is reported when the Convex is registered, with the
+            // context of its geometry.
+          }
+        });
+  }
+
+  // Reads the vertices (unscaled) and the faces of a Convex from the on-disk
+  // cache, or else from its .obj file.
+  std::shared_ptr<const ConvexData> ReadConvexData(
+      const std::string& filename) const {
+    // The on-disk cache, when enabled, saves parsing the file again in the
+    // next processes.
+    const std::string cache_filename = GetConvexCacheFilename(filename);
+    if (!cache_filename.empty()) {
+      optional<ConvexMeshData> cached = ReadConvexCache(cache_filename);
+      if (cached) return MakeConvexData(std::move(*cached));
+    }
+    ConvexMeshData parsed = ParseConvexObj(filename);
+    if (!cache_filename.empty() &&
+        !WriteConvexCache(cache_filename, parsed)) {
+      drake::log()->debug("Cannot write the geometry cache file '{}'",
+                          cache_filename);
+    }
+    return MakeConvexData(std::move(parsed));
+  }
+
+  static std::shared_ptr<const ConvexData> MakeConvexData(
+      ConvexMeshData&& mesh) {
+    auto data = std::make_shared<ConvexData>();
+    data->vertices = std::make_shared<const std::vector<Vector3d>>(
+        std::move(mesh.vertices));
+    data->num_faces = mesh.num_faces;
+    data->faces =
+        std::make_shared<const std::vector<int>>(std::move(mesh.faces));
+    return data;
+  }
+
+  // Parses the vertices (unscaled) and the faces of a Convex from its .obj
+  // file.
+  ConvexMeshData ParseConvexObj(const std::string& filename) const {
     // We use tiny_obj_loader to read the .obj file of the convex shape.
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
@@ -481,14 +768,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Tinyobj doesn't infer the search directory from the directory containing
     // the obj file. We have to provide that directory; of course, this assumes
     // that the material library reference is relative to the obj directory.
-    const size_t pos = convex.filename().find_last_of('/');
-    const std::string obj_folder = convex.filename().substr(0, pos + 1);
+    const size_t pos = filename.find_last_of('/');
+    const std::string obj_folder = filename.substr(0, pos + 1);
     const char* mtl_basedir = obj_folder.c_str();
 
     bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
-        convex.filename().c_str(), mtl_basedir, do_tinyobj_triangulation);
+        filename.c_str(), mtl_basedir, do_tinyobj_triangulation);
     if (!ret || !err.empty()) {
-      throw std::runtime_error("Error parsing file '" + convex.filename() +
+      throw std::runtime_error("Error parsing file '" + filename +
           "' : " + err);
     }
 
@@ -506,8 +793,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                                "one and only one object defined in it.");
     }
 
-    auto vertices = std::make_shared<std::vector<Vector3d>>(
-        TinyObjToFclVertices(attrib, convex.scale()));
+    ConvexMeshData data;
+    data.vertices = TinyObjToFclVertices(attrib, 1.0);
 
     const tinyobj::mesh_t& mesh = shapes[0].mesh;
 
@@ -520,18 +807,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     //               ...}
     // where n_i is the number of vertices of face_i.
     //
-    auto faces = std::make_shared<std::vector<int>>();
-    int num_faces = TinyObjToFclFaces(mesh, faces.get());
+    data.num_faces = TinyObjToFclFaces(mesh, &data.faces);
 
-    // Create fcl::Convex.
-    auto fcl_convex = make_shared<fcl::Convexd>(
-        vertices, num_faces, faces);
-    TakeShapeOwnership(fcl_convex, user_data);
-
-    // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
-    // to own vertices and face by a map from filename.  This way we won't have
-    // to read the same file again and again when we create multiple Convex
-    // objects from the same file.
+    return data;
   }
 
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
@@ -546,20 +824,158 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
     data.request.distance_tolerance = distance_tolerance_;
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.distance(&data, shape_distance::Callback<T>);
+    const std::vector<FclObjectPair>& candidates =
+        GetDistanceCandidates(max_distance);
+    // The Convex pairs are only computed on their hulls for double; fcl
+    // doesn't support them for other scalars either, which the callback
+    // reports.
+    std::vector<ConvexQuery> convex_queries;
+    if (std::is_same<T, double>::value) {
+      convex_queries = GetConvexQueries(candidates);
+    }
+    auto compute_distance = [&](int i, shape_distance::CallbackData<T>* d) {
+      if (!convex_queries.empty() && convex_queries[i].pair_cache != nullptr) {
+        const ConvexQuery& query = convex_queries[i];
+        ConvexConvexDistance(*query.fcl_object_A, *query.hull_A,
+                             *query.fcl_object_B, *query.hull_B,
+                             query.pair_cache, d);
+      } else {
+        double unused_max_distance{};
+        shape_distance::Callback<T>(candidates[i].first, candidates[i].second,
+                                    d, unused_max_distance);
+      }
+    };
+    if (max_num_threads_ > 1) {
+      // Each thread writes into its own results vector (with its own copy of
+      // the callback data); concatenating them in thread order reproduces the
+      // serial ordering.
+      std::vector<std::vector<SignedDistancePair<T>>> thread_pairs(
+          max_num_threads_);
+      std::vector<shape_distance::CallbackData<T>> thread_data;
+      thread_data.reserve(max_num_threads_);
+      for (auto& pairs : thread_pairs) {
+        thread_data.emplace_back(&collision_filter_, &X_WGs, max_distance,
+                                 &pairs);
+        thread_data.back().request = data.request;
+      }
+      StaticParallelForIndexLoop(
+          max_num_threads_, 0, static_cast<int>(candidates.size()),
+          [&](int thread_num, int i) {
+            compute_distance(i, &thread_data[thread_num]);
+          });
+      for (auto& pairs : thread_pairs) {
+        witness_pairs.insert(witness_pairs.end(),
+                             std::make_move_iterator(pairs.begin()),
+                             std::make_move_iterator(pairs.end()));
+      }
+      return witness_pairs;
+    }
 
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    // The FCL API requires the const cast even though it *appears* that no
-    // mutation takes place.
-    dynamic_tree_.distance(
-        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
-            &anchored_tree_),
-        &data, shape_distance::Callback<T>);
+    for (int i = 0; i < static_cast<int>(candidates.size()); ++i) {
+      compute_distance(i, &data);
+    }
     return witness_pairs;
   }
 
+  SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
+      GeometryId id_A, GeometryId id_B,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+    CollisionObjectd* object_A = FindObjectOrThrow(id_A);
+    CollisionObjectd* object_B = FindObjectOrThrow(id_B);
+    std::vector<SignedDistancePair<T>> witness_pairs;
+    shape_distance::CallbackData<T> data{
+        &collision_filter_, &X_WGs, std::numeric_limits<double>::infinity(),
+        &witness_pairs};
+    data.request.enable_nearest_points = true;
+    data.request.enable_signed_distance = true;
+    data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    data.request.distance_tolerance = distance_tolerance_;
+
+    std::vector<ConvexQuery> convex_queries;
+    if (std::is_same<T, double>::value) {
+      convex_queries = GetConvexQueries({FclObjectPair(object_A, object_B)});
+    }
+    if (!convex_queries.empty() && convex_queries[0].pair_cache != nullptr) {
+      const ConvexQuery& query = convex_queries[0];
+      ConvexConvexDistance(*query.fcl_object_A, *query.hull_A,
+                           *query.fcl_object_B, *query.hull_B,
+                           query.pair_cache, &data);
+    } else {
+      double unused_max_distance{};
+      shape_distance::Callback<T>(object_A, object_B, &data,
+                                  unused_max_distance);
+    }
+    if (witness_pairs.empty()) {
+      throw std::logic_error(fmt::format(
+          "The signed distance between geometries {} and {} can't be computed "
+          "because the pair is filtered",
+          id_A, id_B));
+    }
+    return witness_pairs[0];
+  }
+
+  optional<double> ComputeTimeOfImpact(
+      GeometryId id_A, GeometryId id_B, const RigidTransformd& X_WA_start,
+      const RigidTransformd& X_WA_end, const RigidTransformd& X_WB_start,
+      const RigidTransformd& X_WB_end, double distance_tolerance) const {
+    DRAKE_THROW_UNLESS(distance_tolerance > 0);
+    // The radius of the bounding sphere of a geometry about its origin.
+    auto bounding_radius = [this](GeometryId id) {
+      const fcl::CollisionGeometryd& geometry =
+          *FindObjectOrThrow(id)->collisionGeometry();
+      return geometry.aabb_center.norm() + geometry.aabb_radius;
+    };
+    const double radius_A = bounding_radius(id_A);
+    const double radius_B = bounding_radius(id_B);
+    // The geometry M moves relative to the geometry S; the speed of its points
+    // is bounded more tightly if it is the smaller one.
+    const bool A_moves = radius_A < radius_B;
+    const GeometryId id_S = A_moves ? id_B : id_A;
+    const GeometryId id_M = A_moves ? id_A : id_B;
+    const double radius_M = A_moves ? radius_A : radius_B;
+    const RigidTransformd X_SM_start =
+        (A_moves ? X_WB_start : X_WA_start).inverse() *
+        (A_moves ? X_WA_start : X_WB_start);
+    const RigidTransformd X_SM_end = (A_moves ? X_WB_end : X_WA_end).inverse() *
+                                     (A_moves ? X_WA_end : X_WB_end);
+    const Vector3d p_delta =
+        X_SM_end.translation() - X_SM_start.translation();
+    const Eigen::AngleAxisd R_delta(
+        (X_SM_start.rotation().inverse() * X_SM_end.rotation()).matrix());
+    // An upper bound on the speed of the points of M relative to S, per unit
+    // of interpolation time. A point at position r from M's origin moves at
+    // the speed of the origin plus at most |ω| |r|.
+    const double max_speed =
+        p_delta.norm() + std::abs(R_delta.angle()) * radius_M;
+    if (!std::isfinite(max_speed)) {
+      throw std::logic_error(fmt::format(
+          "The time of impact of geometries {} and {} can't be computed "
+          "because an unbounded geometry rotates relative to the other one",
+          id_A, id_B));
+    }
+
+    // The signed distances are computed in the frame of S.
+    std::unordered_map<GeometryId, RigidTransform<T>> X_SGs;
+    X_SGs[id_S] = RigidTransform<T>::Identity();
+    constexpr int kMaxIterations = 100;
+    double t = 0;
+    for (int i = 0; i < kMaxIterations; ++i) {
+      const RigidTransformd X_SM(
+          X_SM_start.rotation() *
+              math::RotationMatrixd(
+                  Eigen::AngleAxisd(t * R_delta.angle(), R_delta.axis())),
+          X_SM_start.translation() + t * p_delta);
+      X_SGs[id_M] = X_SM.template cast<T>();
+      const double distance = ExtractDoubleOrThrow(
+          ComputeSignedDistancePairClosestPoints(id_S, id_M, X_SGs).distance);
+      if (distance <= distance_tolerance) return t;
+      if (max_speed == 0) return nullopt;
+      t += distance / max_speed;
+      if (t > 1) return nullopt;
+    }
+    return t;
+  }
+
   std::vector<SignedDistanceToPoint<T>> ComputeSignedDistanceToPoint(
       const Vector3<T>& p_WQ,
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
@@ -587,6 +1003,158 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return distances;
   }
 
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const double threshold) const {
+    const int num_points = static_cast<int>(p_WQs.cols());
+    std::vector<std::vector<SignedDistanceToPoint<T>>> distances(num_points);
+    if (num_points == 0) return distances;
+
+    // Each query point becomes a sphere of zero radius; all of the points
+    // share one fcl shape so that the broadphase callback can tell them apart
+    // from the scene's geometries.
+    auto fcl_sphere = make_shared<fcl::Sphered>(0.0);
+    std::vector<unique_ptr<CollisionObjectd>> query_points;
+    std::vector<CollisionObjectd*> query_point_ptrs;
+    query_points.reserve(num_points);
+    query_point_ptrs.reserve(num_points);
+    for (int i = 0; i < num_points; ++i) {
+      const Vector3<T> p_WQ = p_WQs.col(i);
+      query_points.push_back(make_unique<CollisionObjectd>(fcl_sphere));
+      CollisionObjectd* query_point = query_points.back().get();
+      query_point->setTranslation(convert_to_double(p_WQ));
+      query_point->computeAABB();
+      query_point->setUserData(
+          reinterpret_cast<void*>(static_cast<intptr_t>(i)));
+      query_point_ptrs.push_back(query_point);
+    }
+
+    // A single traversal of a tree of the query points against each of the
+    // scene's trees replaces one traversal of the scene per point.
+    fcl::DynamicAABBTreeCollisionManager<double> query_tree;
+    query_tree.registerObjects(query_point_ptrs);
+    query_tree.setup();
+    PointCandidateData candidate_data{fcl_sphere.get(), threshold};
+    query_tree.distance(
+        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+            &dynamic_tree_),
+        &candidate_data, CollectPointCandidatesCallback);
+    query_tree.distance(
+        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+            &anchored_tree_),
+        &candidate_data, CollectPointCandidatesCallback);
+
+    // Group the candidates by point (a stable counting sort), so that each
+    // point's results are computed by a single thread and reported with the
+    // dynamic geometries first, as in ComputeSignedDistanceToPoint().
+    const std::vector<std::pair<int, CollisionObjectd*>>& candidates =
+        candidate_data.candidates;
+    std::vector<int> offsets(num_points + 1, 0);
+    for (const auto& candidate : candidates) ++offsets[candidate.first + 1];
+    for (int i = 0; i < num_points; ++i) offsets[i + 1] += offsets[i];
+    std::vector<CollisionObjectd*> sorted_geometries(candidates.size());
+    {
+      std::vector<int> next(offsets.begin(), offsets.end() - 1);
+      for (const auto& candidate : candidates) {
+        sorted_geometries[next[candidate.first]++] = candidate.second;
+      }
+    }
+
+    StaticParallelForIndexLoop(
+        max_num_threads_, 0, num_points, [&](int, int i) {
+          const Vector3<T> p_WQ = p_WQs.col(i);
+          point_distance::CallbackData<T> data{query_points[i].get(), threshold,
+                                               p_WQ, &X_WGs, &distances[i]};
+          for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+            double unused_threshold{};
+            point_distance::Callback<T>(query_points[i].get(),
+                                        sorted_geometries[j], &data,
+                                        unused_threshold);
+          }
+        });
+    return distances;
+  }
+
+  Eigen::VectorXd ComputeRayCastDistances(const Matrix3X<double>& p_WRs,
+                                          const Matrix3X<double>& dir_Ws,
+                                          double max_range) const {
+    DRAKE_THROW_UNLESS(p_WRs.cols() == dir_Ws.cols());
+    DRAKE_THROW_UNLESS(max_range > 0);
+    const int num_rays = static_cast<int>(p_WRs.cols());
+    Eigen::VectorXd distances = Eigen::VectorXd::Constant(
+        num_rays, std::numeric_limits<double>::infinity());
+    if (num_rays == 0) return distances;
+
+    // Each ray becomes a box of zero width along the segment it sweeps within
+    // max_range, so that its bounding box is that of the segment. All of the
+    // rays share one fcl shape so that the broadphase callback can tell them
+    // apart from the scene's geometries.
+    auto fcl_segment = make_shared<fcl::Boxd>(0.0, 0.0, max_range);
+    std::vector<unique_ptr<CollisionObjectd>> rays;
+    std::vector<CollisionObjectd*> ray_ptrs;
+    rays.reserve(num_rays);
+    ray_ptrs.reserve(num_rays);
+    for (int i = 0; i < num_rays; ++i) {
+      const Vector3d dir_W = dir_Ws.col(i);
+      DRAKE_ASSERT(std::abs(dir_W.norm() - 1) < 1e-10);
+      rays.push_back(make_unique<CollisionObjectd>(fcl_segment));
+      CollisionObjectd* ray = rays.back().get();
+      ray->setRotation(
+          Eigen::Quaterniond::FromTwoVectors(Vector3d::UnitZ(), dir_W)
+              .toRotationMatrix());
+      ray->setTranslation(p_WRs.col(i) + dir_W * (max_range / 2));
+      ray->computeAABB();
+      ray->setUserData(reinterpret_cast<void*>(static_cast<intptr_t>(i)));
+      ray_ptrs.push_back(ray);
+    }
+
+    // A single traversal of a tree of the rays against each of the scene's
+    // trees replaces one traversal of the scene per ray.
+    fcl::DynamicAABBTreeCollisionManager<double> ray_tree;
+    ray_tree.registerObjects(ray_ptrs);
+    ray_tree.setup();
+    RayCandidateData candidate_data{fcl_segment.get(), {}};
+    ray_tree.collide(const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+                         &dynamic_tree_),
+                     &candidate_data, CollectRayCandidatesCallback);
+    ray_tree.collide(const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+                         &anchored_tree_),
+                     &candidate_data, CollectRayCandidatesCallback);
+
+    // Group the candidates by ray (a counting sort), so that each ray's
+    // candidates are tested by a single thread.
+    const std::vector<std::pair<int, CollisionObjectd*>>& candidates =
+        candidate_data.candidates;
+    std::vector<int> offsets(num_rays + 1, 0);
+    for (const auto& candidate : candidates) ++offsets[candidate.first + 1];
+    for (int i = 0; i < num_rays; ++i) offsets[i + 1] += offsets[i];
+    std::vector<const CollisionObjectd*> sorted_geometries(candidates.size());
+    {
+      std::vector<int> next(offsets.begin(), offsets.end() - 1);
+      for (const auto& candidate : candidates) {
+        sorted_geometries[next[candidate.first]++] = candidate.second;
+      }
+    }
+
+    StaticParallelForIndexLoop(
+        max_num_threads_, 0, num_rays, [&](int, int i) {
+          const Vector3d p_WR = p_WRs.col(i);
+          const Vector3d dir_W = dir_Ws.col(i);
+          double distance = std::numeric_limits<double>::infinity();
+          for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+            const CollisionObjectd& geometry = *sorted_geometries[j];
+            distance = std::min(
+                distance,
+                CastRay(*geometry.collisionGeometry(),
+                        RigidTransformd(geometry.getTransform()), p_WR, dir_W));
+          }
+          if (distance <= max_range) distances(i) = distance;
+        });
+    return distances;
+  }
+
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration()
       const {
     std::vector<PenetrationAsPointPair<double>> contacts;
@@ -603,17 +1171,46 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     collision_data.request.gjk_tolerance = 2e-12;
     collision_data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&collision_data, SingleCollisionCallback);
+    const std::vector<FclObjectPair>& candidates = GetCollisionCandidates();
+    const std::vector<ConvexQuery> convex_queries =
+        GetConvexQueries(candidates);
+    auto collide = [&](int i, CollisionData* data) {
+      const ConvexQuery& query = convex_queries[i];
+      if (query.pair_cache != nullptr) {
+        ConvexConvexCollision(*query.fcl_object_A, *query.hull_A,
+                              *query.fcl_object_B, *query.hull_B,
+                              query.pair_cache, data);
+      } else {
+        SingleCollisionCallback(candidates[i].first, candidates[i].second,
+                                data);
+      }
+    };
+    if (max_num_threads_ > 1) {
+      // Each thread writes into its own contacts vector (with its own copy of
+      // the callback data); concatenating them in thread order reproduces the
+      // serial ordering.
+      std::vector<std::vector<PenetrationAsPointPair<double>>> thread_contacts(
+          max_num_threads_);
+      std::vector<CollisionData> thread_data(max_num_threads_, collision_data);
+      for (int t = 0; t < max_num_threads_; ++t) {
+        thread_data[t].contacts = &thread_contacts[t];
+      }
+      StaticParallelForIndexLoop(
+          max_num_threads_, 0, static_cast<int>(candidates.size()),
+          [&](int thread_num, int i) {
+            collide(i, &thread_data[thread_num]);
+          });
+      for (auto& thread_contact : thread_contacts) {
+        contacts.insert(contacts.end(),
+                        std::make_move_iterator(thread_contact.begin()),
+                        std::make_move_iterator(thread_contact.end()));
+      }
+      return contacts;
+    }
 
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    // The FCL API requires the const cast even though it *appears* that no
-    // mutation takes place.
-    dynamic_tree_.collide(
-        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
-            &anchored_tree_),
-        &collision_data, SingleCollisionCallback);
+    for (int i = 0; i < static_cast<int>(candidates.size()); ++i) {
+      collide(i, &collision_data);
+    }
     return contacts;
   }
 
@@ -621,38 +1218,23 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     std::vector<SortedPair<GeometryId>> pairs;
     // All these quantities are aliased in the callback data.
     find_collision_candidates::CallbackData data{&collision_filter_, &pairs};
-
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, find_collision_candidates::Callback);
-
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    // The FCL API requires the const cast even though it *appears* that no
-    // mutation takes place.
-    dynamic_tree_.collide(
-        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
-            &anchored_tree_),
-        &data, find_collision_candidates::Callback);
+    for (const FclObjectPair& candidate : GetCollisionCandidates()) {
+      find_collision_candidates::Callback(candidate.first, candidate.second,
+                                          &data);
+    }
     return pairs;
   }
 
   std::vector<ContactSurface<T>> ComputeContactSurfaces(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      HydroelasticContactRepresentation representation) const {
     std::vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the callback data.
-    hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs, &surfaces};
-
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
-
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    // The FCL API requires the const cast even though it *appears* that no
-    // mutation takes place.
-    dynamic_tree_.collide(
-        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
-            &anchored_tree_),
-        &data, hydroelastic::Callback<T>);
+    hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs, &surfaces,
+                                       &hydroelastic_cache_, representation};
+    for (const FclObjectPair& candidate : GetCollisionCandidates()) {
+      hydroelastic::Callback<T>(candidate.first, candidate.second, &data);
+    }
     return surfaces;
   }
 
@@ -660,6 +1242,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   void ExcludeCollisionsWithin(
       const std::unordered_set<GeometryId>& dynamic,
       const std::unordered_set<GeometryId>& anchored) {
+    InvalidateCandidates();
     // Preventing collision between members in a single set is simple: assign
     // every geometry to the same clique.
 
@@ -692,6 +1275,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       const std::unordered_set<GeometryId>& anchored1,
       const std::unordered_set<GeometryId>& dynamic2,
       const std::unordered_set<GeometryId>& anchored2) {
+    InvalidateCandidates();
     // TODO(SeanCurtis-TRI): Update this with the new collision filter method.
 
     // NOTE: This is a brute-force implementation. It does not claim to be
@@ -755,10 +1339,122 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   int get_next_clique() { return collision_filter_.next_clique_id(); }
 
   void set_clique(GeometryId id, int clique) {
+    InvalidateCandidates();
     EncodedData encoding(id, true /* is dynamic */);
     collision_filter_.AddToCollisionClique(encoding.encoding(), clique);
   }
 
+  // Returns the unfiltered pairs of geometries whose bounding boxes overlap,
+  // in the order in which the broadphase reports them. They are computed by
+  // the first collision query after a change of the poses, the geometries or
+  // the collision filters, and shared by all of the collision queries until
+  // then.
+  const std::vector<FclObjectPair>& GetCollisionCandidates() const {
+    if (!candidate_cache_.collision_valid) {
+      std::vector<FclObjectPair>& candidates = candidate_cache_.collision;
+      candidates.clear();
+      CandidateData candidate_data{&collision_filter_, &candidates};
+      // Query the dynamic objects against themselves and against the
+      // anchored ones; anchored pairs are implicitly filtered. The FCL API
+      // requires the const cast even though no mutation takes place.
+      dynamic_tree_.collide(&candidate_data, CollectCandidatesCallback);
+      dynamic_tree_.collide(
+          const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+              &anchored_tree_),
+          &candidate_data, CollectCandidatesCallback);
+      candidate_cache_.collision_valid = true;
+    }
+    return candidate_cache_.collision;
+  }
+
+  // Like GetCollisionCandidates(), for the signed distance queries: the pairs
+  // whose bounding boxes are within `max_distance`. They are shared by the
+  // queries with the same `max_distance`.
+  const std::vector<FclObjectPair>& GetDistanceCandidates(
+      double max_distance) const {
+    if (!candidate_cache_.distance_valid ||
+        candidate_cache_.distance_max_distance != max_distance) {
+      std::vector<FclObjectPair>& candidates = candidate_cache_.distance;
+      candidates.clear();
+      CandidateData candidate_data{&collision_filter_, &candidates};
+      candidate_data.max_distance = max_distance;
+      dynamic_tree_.distance(&candidate_data,
+                             CollectDistanceCandidatesCallback);
+      dynamic_tree_.distance(
+          const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+              &anchored_tree_),
+          &candidate_data, CollectDistanceCandidatesCallback);
+      candidate_cache_.distance_valid = true;
+      candidate_cache_.distance_max_distance = max_distance;
+    }
+    return candidate_cache_.distance;
+  }
+
+  // The inputs of the convex-convex fast path of ComputePointPairPenetration()
+  // and of the signed distance queries for one candidate pair, ordered by id;
+  // the pair cache is null if the pair doesn't take it.
+  struct ConvexQuery {
+    const CollisionObjectd* fcl_object_A{};
+    const convex_penetration::ConvexHull* hull_A{};
+    const CollisionObjectd* fcl_object_B{};
+    const convex_penetration::ConvexHull* hull_B{};
+    convex_penetration::PairCache* pair_cache{};
+  };
+
+  // Returns the convex queries of the given candidates, making the hulls and
+  // pair caches they need. This is done ahead of the (possibly parallel)
+  // narrowphase, so that the latter only touches the pair cache of its own
+  // candidate.
+  std::vector<ConvexQuery> GetConvexQueries(
+      const std::vector<FclObjectPair>& candidates) const {
+    std::vector<ConvexQuery> queries(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      const CollisionObjectd* fcl_object_A = candidates[i].first;
+      const CollisionObjectd* fcl_object_B = candidates[i].second;
+      if (fcl_object_A->getNodeType() != fcl::GEOM_CONVEX ||
+          fcl_object_B->getNodeType() != fcl::GEOM_CONVEX) {
+        continue;
+      }
+      GeometryId id_A = EncodedData(*fcl_object_A).id();
+      GeometryId id_B = EncodedData(*fcl_object_B).id();
+      if (id_B < id_A) {
+        std::swap(fcl_object_A, fcl_object_B);
+        std::swap(id_A, id_B);
+      }
+      ConvexQuery& query = queries[i];
+      query.fcl_object_A = fcl_object_A;
+      query.hull_A = &GetConvexHull(id_A, *fcl_object_A);
+      query.fcl_object_B = fcl_object_B;
+      query.hull_B = &GetConvexHull(id_B, *fcl_object_B);
+      query.pair_cache =
+          &convex_cache_.pairs[SortedPair<GeometryId>(id_A, id_B)];
+    }
+    return queries;
+  }
+
+  // Returns the support hull of the Convex geometry with the given id, making
+  // it the first time.
+  const convex_penetration::ConvexHull& GetConvexHull(
+      GeometryId id, const CollisionObjectd& fcl_object) const {
+    auto iter = convex_cache_.hulls.find(id);
+    if (iter == convex_cache_.hulls.end()) {
+      const auto& convex =
+          dynamic_cast<const fcl::Convexd&>(*fcl_object.collisionGeometry());
+      iter = convex_cache_.hulls
+                 .emplace(id, convex_penetration::ConvexHull(
+                                  convex.getVertices(), convex.getFaces(),
+                                  convex.getFaceCount()))
+                 .first;
+    }
+    return iter->second;
+  }
+
+  // Discards the broadphase candidates; see GetCollisionCandidates().
+  void InvalidateCandidates() {
+    candidate_cache_.collision_valid = false;
+    candidate_cache_.distance_valid = false;
+  }
+
   // Testing utilities
 
   bool IsDeepCopy(const Impl& other) const {
@@ -816,6 +1512,18 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
  private:
+  // Returns the fcl object of the given geometry (dynamic or anchored).
+  // @throws std::logic_error if the geometry is not registered with the engine.
+  CollisionObjectd* FindObjectOrThrow(GeometryId id) const {
+    auto iter = dynamic_objects_.find(id);
+    if (iter != dynamic_objects_.end()) return iter->second.get();
+    iter = anchored_objects_.find(id);
+    if (iter != anchored_objects_.end()) return iter->second.get();
+    throw std::logic_error(fmt::format(
+        "The geometry {} has not been registered with the proximity engine",
+        id));
+  }
+
   // Engine on one scalar can see the members of other engines.
   friend class ProximityEngineTester;
   template <typename>
@@ -861,6 +1569,36 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // All of the *dynamic* collision elements (spanning all sources).
   unordered_map<GeometryId, unique_ptr<CollisionObjectd>> dynamic_objects_;
 
+  // Scratch space for UpdateWorldPoses(): the dynamic objects that moved.
+  std::vector<CollisionObjectd*> moved_objects_;
+
+  // The broadphase candidates of the queries; see GetCollisionCandidates().
+  // (They refer to the objects of this engine, so they are never copied.)
+  struct CandidateCache {
+    bool collision_valid{false};
+    std::vector<FclObjectPair> collision;
+    bool distance_valid{false};
+    double distance_max_distance{};
+    std::vector<FclObjectPair> distance;
+  };
+  mutable CandidateCache candidate_cache_;
+
+  // The meshes of the geometries, and the sizes of the contact surfaces, of
+  // the previous ComputeContactSurfaces() queries. (Like the candidates, they
+  // are never copied.)
+  mutable hydroelastic::GeometryCache hydroelastic_cache_;
+
+  // The support hulls of the Convex geometries, and the warm-start state of
+  // the penetration and signed distance queries between pairs of them (see
+  // GetConvexQueries()).
+  // Like the candidates, they are never copied.
+  struct ConvexCache {
+    std::unordered_map<GeometryId, convex_penetration::ConvexHull> hulls;
+    std::unordered_map<SortedPair<GeometryId>, convex_penetration::PairCache>
+        pairs;
+  };
+  mutable ConvexCache convex_cache_;
+
   // The tree containing all of the anchored geometry.
   fcl::DynamicAABBTreeCollisionManager<double> anchored_tree_;
 
@@ -873,6 +1611,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // The tolerance that determines when the iterative process would terminate.
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
+
+  // The maximum number of threads used to evaluate narrowphase queries.
+  // @see ProximityEngine::set_max_num_threads() for more details.
+  int max_num_threads_{1};
 };
 
 template <typename T>
@@ -916,6 +1658,12 @@ ProximityEngine<T>& ProximityEngine<T>::operator=(
   return *this;
 }
 
+template <typename T>
+void ProximityEngine<T>::PreloadConvexFiles(
+    const std::vector<std::string>& filenames, int num_threads) {
+  Impl::PreloadConvexFiles(filenames, num_threads);
+}
+
 template <typename T>
 void ProximityEngine<T>::AddDynamicGeometry(
     const Shape& shape, GeometryId id) {
@@ -958,6 +1706,16 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_max_num_threads(int max_num_threads) {
+  impl_->set_max_num_threads(max_num_threads);
+}
+
+template <typename T>
+int ProximityEngine<T>::max_num_threads() const {
+  return impl_->max_num_threads();
+}
+
 template <typename T>
 std::unique_ptr<ProximityEngine<AutoDiffXd>> ProximityEngine<T>::ToAutoDiffXd()
     const {
@@ -979,6 +1737,22 @@ ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
   return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
 }
 
+template <typename T>
+SignedDistancePair<T> ProximityEngine<T>::ComputeSignedDistancePairClosestPoints(
+    GeometryId id_A, GeometryId id_B,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+  return impl_->ComputeSignedDistancePairClosestPoints(id_A, id_B, X_WGs);
+}
+
+template <typename T>
+optional<double> ProximityEngine<T>::ComputeTimeOfImpact(
+    GeometryId id_A, GeometryId id_B, const RigidTransformd& X_WA_start,
+    const RigidTransformd& X_WA_end, const RigidTransformd& X_WB_start,
+    const RigidTransformd& X_WB_end, double distance_tolerance) const {
+  return impl_->ComputeTimeOfImpact(id_A, id_B, X_WA_start, X_WA_end,
+                                    X_WB_start, X_WB_end, distance_tolerance);
+}
+
 template <typename T>
 std::vector<SignedDistanceToPoint<T>>
 ProximityEngine<T>::ComputeSignedDistanceToPoint(
@@ -988,6 +1762,22 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
   return impl_->ComputeSignedDistanceToPoint(query, X_WGs, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<T>>>
+ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double threshold) const {
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+}
+
+template <typename T>
+Eigen::VectorXd ProximityEngine<T>::ComputeRayCastDistances(
+    const Matrix3X<double>& p_WRs, const Matrix3X<double>& dir_Ws,
+    double max_range) const {
+  return impl_->ComputeRayCastDistances(p_WRs, dir_Ws, max_range);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 ProximityEngine<T>::ComputePointPairPenetration() const {
@@ -996,8 +1786,9 @@ ProximityEngine<T>::ComputePointPairPenetration() const {
 
 template <typename T>
 std::vector<ContactSurface<T>> ProximityEngine<T>::ComputeContactSurfaces(
-    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(X_WGs);
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    HydroelasticContactRepresentation representation) const {
+  return impl_->ComputeContactSurfaces(X_WGs, representation);
 }
 
 template <typename T>
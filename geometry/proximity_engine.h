@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -40,6 +41,14 @@ class GeometryStateCollisionFilterAttorney;
    - distance
    - ray-intersection
 
+ The broadphase candidates (the pairs of geometries whose bounding volumes
+ overlap, or are within the requested distance) are computed by the first
+ query after the poses, the geometries or the collision filters change, and
+ reused by the later queries until then. So, for example, a penetration query
+ followed by a collision-candidates query for the same poses runs the
+ broadphase only once. Because of this, even the const queries must not be
+ called concurrently on the same engine.
+
  @tparam T The scalar type. Must be a valid Eigen scalar.
 
  Instantiated templates for the following kinds of T's are provided:
@@ -93,6 +102,15 @@ class ProximityEngine {
   void AddAnchoredGeometry(const Shape& shape,
                            const math::RigidTransformd& X_WG, GeometryId id);
 
+  /** Reads the .obj files of Convex shapes into the process-wide cache that
+   AddDynamicGeometry() and AddAnchoredGeometry() read them from, using up to
+   `num_threads` threads, so that adding the shapes afterwards, in any engine,
+   doesn't parse the files. The files that can't be read are skipped; the
+   errors are reported when their shapes are added.
+   @throws std::exception if `num_threads` is less than one.  */
+  static void PreloadConvexFiles(const std::vector<std::string>& filenames,
+                                 int num_threads);
+
   // TODO(SeanCurtis-TRI): Decide if knowing whether something is dynamic or not
   //  is *actually* sufficiently helpful to justify this act.
   /** Removes the given geometry indicated by `id` from the engine.
@@ -121,6 +139,18 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /** Sets the maximum number of threads used to evaluate the narrowphase of
+   ComputePointPairPenetration() and
+   ComputeSignedDistancePairwiseClosestPoints(). With more than one thread,
+   the broadphase candidate pairs are collected first and then partitioned
+   into contiguous blocks, one per thread. The results are identical to (and
+   reported in the same order as) the single-threaded results. The default
+   value is one (no threads are spawned).
+   @throws std::exception if `max_num_threads` is less than one.  */
+  void set_max_num_threads(int max_num_threads);
+
+  int max_num_threads() const;
+
   //@}
 
   /** Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -128,6 +158,9 @@ class ProximityEngine {
                     world frame `W` (including geometries which may *not* be
                     registered with the proximity engine or may not be
                     dynamic).
+   Only the geometries whose poses differ from those of the previous update
+   are refit in the broadphase, so that the cost of an update mostly depends
+   on the number of geometries that moved.
   */
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
@@ -156,6 +189,11 @@ class ProximityEngine {
    ordering is arbitrary (and therefore undocumented), but guaranteed to be
    fixed and repeatable.
 
+   For double, the distance between two Convex geometries is computed on their
+   vertices with GJK (and EPA, if they penetrate), warm started from the
+   previous query between them and stopped as soon as they are proven farther
+   apart than `max_distance`.
+
    @param[in] X_WGs           The pose of all geometries in World, keyed on
                               each geometry's GeometryId.
    @param[in] max_distance    The maximum distance between objects such that
@@ -168,6 +206,58 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double max_distance) const;
 
+  /** Performs work in support of
+   GeometryState::ComputeSignedDistancePairClosestPoints(). Computes the
+   signed distance and nearest points of the single geometry pair (A, B),
+   without traversing the broadphase. The pair is reported in the same order as
+   by ComputeSignedDistancePairwiseClosestPoints(), which may be (B, A).
+   @param[in] id_A            The id of the geometry A.
+   @param[in] id_B            The id of the geometry B.
+   @param[in] X_WGs           The pose of all geometries in World, keyed on
+                              each geometry's GeometryId.
+   @throws std::logic_error if either geometry is not registered with the
+           engine, or if the pair (A, B) is filtered.  */
+  SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
+      GeometryId id_A, GeometryId id_B,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
+      const;
+
+  /** Performs work in support of GeometryState::ComputeTimeOfImpact().
+   Computes, by conservative advancement, the earliest time at which the
+   geometries A and B come within `distance_tolerance` of each other as they
+   move between two poses over a unit interval of time. The relative pose of
+   the two geometries is interpolated with a constant twist: the origin of the
+   geometry with the smaller bounding sphere (about its origin) moves at
+   constant velocity along a line in the frame of the other geometry, as it
+   rotates at constant angular velocity about a fixed axis. Each step advances
+   the time by the current distance divided by an upper bound on the speed of
+   the points of the moving geometry, so the geometries can't pass through
+   each other within a step.
+   @param[in] id_A                The id of the geometry A.
+   @param[in] id_B                The id of the geometry B.
+   @param[in] X_WA_start          The pose of A at the start of the interval.
+   @param[in] X_WA_end            The pose of A at the end of the interval.
+   @param[in] X_WB_start          The pose of B at the start of the interval.
+   @param[in] X_WB_end            The pose of B at the end of the interval.
+   @param[in] distance_tolerance  The distance at which the geometries are
+                                  considered to be in contact.
+   @returns The time of impact, as a fraction of the interval in [0, 1], or
+            nullopt if the geometries don't come within the tolerance during
+            the interval. If they do but the advancement hasn't converged
+            after many steps, the time reached so far (which is no later than
+            the time of impact) is returned.
+   @throws std::logic_error if either geometry is not registered with the
+           engine, if the pair (A, B) is filtered, or if an unbounded geometry
+           (e.g., a half space) rotates relative to the other one.
+   @throws std::exception if `distance_tolerance` is not positive.  */
+  optional<double> ComputeTimeOfImpact(
+      GeometryId id_A, GeometryId id_B,
+      const math::RigidTransformd& X_WA_start,
+      const math::RigidTransformd& X_WA_end,
+      const math::RigidTransformd& X_WB_start,
+      const math::RigidTransformd& X_WB_end,
+      double distance_tolerance) const;
+
   /** Performs work in support of GeometryState::ComputeSignedDistanceToPoint().
    @param[in] p_WQ            Position of a query point Q in world frame W.
    @param[in] X_WGs           The pose of all geometries in world, keyed by
@@ -182,8 +272,47 @@ class ProximityEngine {
       const Vector3<T>& p_WQ,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /** Performs work in support of
+   GeometryState::ComputeSignedDistanceToPoints(). The results are those of
+   ComputeSignedDistanceToPoint() for each point, but the broadphase is
+   traversed once for all of the points, and the distances are evaluated on up
+   to max_num_threads() threads.
+   @param[in] p_WQs           The positions of the query points in world frame
+                              W, one per column.
+   @param[in] X_WGs           The pose of all geometries in world, keyed by
+                              each geometry's GeometryId.
+   @param[in] threshold       Ignore any object beyond this distance.
+   @retval signed_distances   For each query point (in the order of p_WQs),
+                              the signed distances from the geometries; those
+                              from dynamic geometries precede those from
+                              anchored geometries.
+   */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
+  /** Performs work in support of GeometryState::ComputeRayCastDistances(). The
+   broadphase is traversed once for all of the rays, and the rays are cast
+   against their candidate geometries on up to max_num_threads() threads.
+   The geometries are taken at the poses of the last UpdateWorldPoses().
+   @param[in] p_WRs           The origins of the rays in world frame W, one per
+                              column.
+   @param[in] dir_Ws          The unit directions of the rays, expressed in W,
+                              one per column.
+   @param[in] max_range       The maximum distance along each ray.
+   @retval distances          For each ray, the distance to the first geometry
+                              hit, or infinity if none is hit within
+                              `max_range`.
+   @throws std::exception if the numbers of origins and directions differ, or
+                          `max_range` is not positive.  */
+  Eigen::VectorXd ComputeRayCastDistances(const Matrix3X<double>& p_WRs,
+                                          const Matrix3X<double>& dir_Ws,
+                                          double max_range) const;
+
 
   //----------------------------------------------------------------------------
   /** @name                Collision Queries
@@ -238,11 +367,14 @@ class ProximityEngine {
 
    @param[in] X_WGs           The pose of all geometries in world, keyed by
                               each geometry's GeometryId.
+   @param[in] representation  The representation of the meshes of the contact
+                              surfaces.
    @returns A vector populated with all detected intersections characterized as
             contact surfaces.  */
   std::vector<ContactSurface<T>> ComputeContactSurfaces(
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      HydroelasticContactRepresentation representation =
+          HydroelasticContactRepresentation::kTriangle) const;
 
   //@}
 
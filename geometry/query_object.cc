@@ -2,6 +2,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/trace_span.h"
 #include "drake/geometry/scene_graph.h"
 
 namespace drake {
@@ -11,6 +12,7 @@ using math::RigidTransform;
 using math::RigidTransformd;
 using render::CameraProperties;
 using render::DepthCameraProperties;
+using systems::sensors::ImageDepth16U;
 using systems::sensors::ImageDepth32F;
 using systems::sensors::ImageLabel16I;
 using systems::sensors::ImageRgba8U;
@@ -48,7 +50,7 @@ template <typename T>
 const RigidTransform<T>& QueryObject<T>::X_WF(FrameId id) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  KinematicsPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.get_pose_in_world(id);
 }
@@ -57,7 +59,7 @@ template <typename T>
 const RigidTransform<T>& QueryObject<T>::X_PF(FrameId id) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  KinematicsPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.get_pose_in_parent(id);
 }
@@ -66,7 +68,7 @@ template <typename T>
 const RigidTransform<T>& QueryObject<T>::X_WG(GeometryId id) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  KinematicsPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.get_pose_in_world(id);
 }
@@ -74,9 +76,10 @@ const RigidTransform<T>& QueryObject<T>::X_WG(GeometryId id) const {
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 QueryObject<T>::ComputePointPairPenetration() const {
+  DRAKE_TRACE_SPAN("QueryObject::ComputePointPairPenetration");
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  ProximityPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.ComputePointPairPenetration();
 }
@@ -86,32 +89,57 @@ std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
     const {
   ThrowIfNotCallable();
   // TODO(amcastro-tri): Modify this when the cache system is in place.
-  FullPoseUpdate();
+  ProximityPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.FindCollisionCandidates();
 }
 
 template <typename T>
 std::vector<ContactSurface<T>>
-QueryObject<T>::ComputeContactSurfaces() const {
+QueryObject<T>::ComputeContactSurfaces(
+    HydroelasticContactRepresentation representation) const {
+  DRAKE_TRACE_SPAN("QueryObject::ComputeContactSurfaces");
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  ProximityPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputeContactSurfaces();
+  return state.ComputeContactSurfaces(representation);
 }
 
 template <typename T>
 std::vector<SignedDistancePair<T>>
 QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
     const double max_distance) const {
+  DRAKE_TRACE_SPAN("QueryObject::ComputeSignedDistancePairwiseClosestPoints");
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  ProximityPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
+template <typename T>
+SignedDistancePair<T> QueryObject<T>::ComputeSignedDistancePairClosestPoints(
+    GeometryId id_A, GeometryId id_B) const {
+  ThrowIfNotCallable();
+
+  ProximityPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistancePairClosestPoints(id_A, id_B);
+}
+
+template <typename T>
+optional<double> QueryObject<T>::ComputeTimeOfImpact(
+    GeometryId id_A, GeometryId id_B, const math::RigidTransformd& X_WA_end,
+    const math::RigidTransformd& X_WB_end, double distance_tolerance) const {
+  ThrowIfNotCallable();
+
+  ProximityPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeTimeOfImpact(id_A, id_B, X_WA_end, X_WB_end,
+                                   distance_tolerance);
+}
+
 template <typename T>
 std::vector<SignedDistanceToPoint<T>>
 QueryObject<T>::ComputeSignedDistanceToPoint(
@@ -119,11 +147,34 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
     const double threshold) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  ProximityPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<T>>>
+QueryObject<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const double threshold) const {
+  ThrowIfNotCallable();
+
+  ProximityPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold);
+}
+
+template <typename T>
+Eigen::VectorXd QueryObject<T>::ComputeRayCastDistances(
+    const Matrix3X<double>& p_WRs, const Matrix3X<double>& dir_Ws,
+    double max_range) const {
+  ThrowIfNotCallable();
+
+  ProximityPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeRayCastDistances(p_WRs, dir_Ws, max_range);
+}
+
 template <typename T>
 void QueryObject<T>::RenderColorImage(const CameraProperties& camera,
                                       FrameId parent_frame,
@@ -132,7 +183,7 @@ void QueryObject<T>::RenderColorImage(const CameraProperties& camera,
                                       ImageRgba8U* color_image_out) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  PerceptionPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.RenderColorImage(camera, parent_frame, X_PC, show_window,
                                 color_image_out);
@@ -145,7 +196,19 @@ void QueryObject<T>::RenderDepthImage(const DepthCameraProperties& camera,
                                       ImageDepth32F* depth_image_out) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  PerceptionPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.RenderDepthImage(camera, parent_frame, X_PC, depth_image_out);
+}
+
+template <typename T>
+void QueryObject<T>::RenderDepthImage(const DepthCameraProperties& camera,
+                                      FrameId parent_frame,
+                                      const RigidTransformd& X_PC,
+                                      ImageDepth16U* depth_image_out) const {
+  ThrowIfNotCallable();
+
+  PerceptionPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.RenderDepthImage(camera, parent_frame, X_PC, depth_image_out);
 }
@@ -158,12 +221,21 @@ void QueryObject<T>::RenderLabelImage(const CameraProperties& camera,
                                       ImageLabel16I* label_image_out) const {
   ThrowIfNotCallable();
 
-  FullPoseUpdate();
+  PerceptionPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.RenderLabelImage(camera, parent_frame, X_PC, show_window,
                                 label_image_out);
 }
 
+template <typename T>
+std::unique_ptr<render::RenderEngine> QueryObject<T>::CloneRenderEngine(
+    const std::string& renderer_name) const {
+  ThrowIfNotCallable();
+
+  PerceptionPoseUpdate();
+  return geometry_state().CloneRenderEngine(renderer_name);
+}
+
 template <typename T>
 const GeometryState<T>& QueryObject<T>::geometry_state() const {
   // Some extra insurance in case some query *hadn't* called this.
@@ -5,10 +5,12 @@
 #include <string>
 #include <vector>
 
+#include "drake/common/drake_optional.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
+#include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/scene_graph_inspector.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/context.h"
@@ -197,9 +199,15 @@ class QueryObject {
    In the near future, this behavior will extend to be configurable and more
    general.
 
+   @param representation  The representation of the meshes of the contact
+                          surfaces: triangles (the default), or the polygons
+                          of the intersection of the meshes, which has fewer
+                          faces and vertices (see ContactSurface).
    @returns The contact surfaces of all detected intersecting pairs of
             geometries. */
-  std::vector<ContactSurface<T>> ComputeContactSurfaces() const;
+  std::vector<ContactSurface<T>> ComputeContactSurfaces(
+      HydroelasticContactRepresentation representation =
+          HydroelasticContactRepresentation::kTriangle) const;
 
   //@}
 
@@ -290,6 +298,54 @@ class QueryObject {
       const double max_distance =
           std::numeric_limits<double>::infinity()) const;
 
+  /**
+   Computes the signed distance together with the nearest points of a single
+   pair of geometries A and B, as reported by
+   ComputeSignedDistancePairwiseClosestPoints() (without a maximum distance).
+   The broadphase is not traversed, which makes this much cheaper than the
+   query over all pairs when only a few known pairs are of interest. As with
+   ComputeSignedDistancePairwiseClosestPoints(), the pair may be reported as
+   (B, A).
+
+   @param id_A  The id of the first geometry.
+   @param id_B  The id of the second geometry.
+   @returns The signed distance of the pair.
+   @throws std::logic_error if either geometry doesn't have the proximity role,
+           or if the pair is filtered.  */
+  SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
+      GeometryId id_A, GeometryId id_B) const;
+
+  /**
+   Computes the time of impact of a pair of geometries A and B that move from
+   their current poses to the given poses over a unit interval of time, e.g.,
+   over a time step whose end-of-step configuration has been predicted. Unlike
+   the penetration queries on the end-of-step poses, this detects the contacts
+   of fast, small objects that would pass through each other within the step.
+
+   The relative motion of the geometries is interpolated with a constant
+   twist, and the time of impact is found by conservative advancement: each
+   step advances the time by the current distance divided by an upper bound on
+   the speed of the points of one geometry relative to the other, so that the
+   geometries can't pass through each other within a step.
+
+   @param id_A                The id of the first geometry.
+   @param id_B                The id of the second geometry.
+   @param X_WA_end            The pose of A at the end of the interval.
+   @param X_WB_end            The pose of B at the end of the interval.
+   @param distance_tolerance  The distance at which the geometries are
+                              considered to be in contact.
+   @returns The time of impact, as a fraction of the interval in [0, 1] (zero
+            if the geometries are already within the tolerance), or nullopt if
+            they don't come within the tolerance during the interval.
+   @throws std::logic_error if either geometry doesn't have the proximity role,
+           if the pair is filtered, or if an unbounded geometry (e.g., a half
+           space) rotates relative to the other one.
+   @throws std::exception if `distance_tolerance` is not positive.  */
+  optional<double> ComputeTimeOfImpact(GeometryId id_A, GeometryId id_B,
+                                       const math::RigidTransformd& X_WA_end,
+                                       const math::RigidTransformd& X_WB_end,
+                                       double distance_tolerance = 1e-6) const;
+
   // TODO(DamrongGuoy): Improve and refactor documentation of
   // ComputeSignedDistanceToPoint(). Move the common sections into Signed
   // Distance Queries. Update documentation as we add more functionality.
@@ -370,6 +426,64 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<T> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   Computes the signed distances and gradients to each of a batch of query
+   points from each geometry in the scene. For every point, the result is that
+   of ComputeSignedDistanceToPoint() (with the same support for shapes and
+   scalars), except that the order of the distances for a point may differ.
+
+   This is faster than querying the points one at a time: the broadphase is
+   traversed once for the whole batch, and the per-point distances may be
+   evaluated on multiple threads.
+
+   @param[in] p_WQs           The positions of the query points Q in world
+                              frame W, one per column.
+   @param[in] threshold       We ignore any object beyond this distance.
+                              By default, it is infinity, so we report
+                              distances from the query points to every object.
+   @retval signed_distances   For each query point (in the order of the
+                              columns of p_WQs), a vector of per-object signed
+                              distance values. See SignedDistanceToPoint.
+   */
+  std::vector<std::vector<SignedDistanceToPoint<T>>>
+  ComputeSignedDistanceToPoints(const Matrix3X<T>& p_WQs,
+                                const double threshold
+                                = std::numeric_limits<double>::infinity())
+      const;
+  //@}
+
+  //---------------------------------------------------------------------------
+  /** @name                Ray Casting Queries
+
+   These queries simulate range sensors (e.g., lidar): they report how far
+   rays travel before they hit a geometry with the proximity role.  */
+  //@{
+
+  /** Casts a batch of rays (e.g., all of the beams of one lidar scan) against
+   the geometries with the proximity role, and reports the distance along each
+   ray to the first geometry it hits. The broadphase is traversed once for the
+   whole batch, and the rays are cast on up to
+   SceneGraph::max_num_threads() threads.
+
+   Rays hit spheres, boxes, cylinders, half spaces and convex shapes; they pass
+   through all other shapes. A ray whose origin lies inside a geometry reports
+   a distance of zero. Collision filters do not apply. The results are always
+   computed in double, and are not differentiable.
+
+   @param[in] p_WRs           The origins R of the rays in world frame W, one
+                              per column.
+   @param[in] dir_Ws          The unit directions of the rays, expressed in W,
+                              one per column.
+   @param[in] max_range       The maximum distance along each ray.
+   @retval distances          For each ray (in the order of the columns), the
+                              distance to the first geometry hit, or infinity
+                              if no geometry is hit within `max_range`.
+   @throws std::exception if the numbers of origins and directions differ, or
+                          `max_range` is not positive.  */
+  Eigen::VectorXd ComputeRayCastDistances(const Matrix3X<double>& p_WRs,
+                                          const Matrix3X<double>& dir_Ws,
+                                          double max_range) const;
   //@}
 
 
@@ -418,6 +532,21 @@ class QueryObject {
                         const math::RigidTransformd& X_PC,
                         systems::sensors::ImageDepth32F* depth_image_out) const;
 
+  /** Renders a 16-bit depth image, with depths in millimeters, for the given
+   `camera` posed with respect to the indicated parent frame P. The depths are
+   produced directly by the render engine (see
+   render::RenderEngine::RenderDepthImage()), rather than by converting a
+   rendered ImageDepth32F.
+
+   @param camera                The intrinsic properties of the camera.
+   @param parent_frame          The id for the camera's parent frame.
+   @param X_PC                  The pose of the camera body in the world frame.
+   @param[out] depth_image_out  The rendered depth image. */
+  void RenderDepthImage(const render::DepthCameraProperties& camera,
+                        FrameId parent_frame,
+                        const math::RigidTransformd& X_PC,
+                        systems::sensors::ImageDepth16U* depth_image_out) const;
+
   /** Renders a label image for the given `camera` posed with respect to the
    indicated parent frame P.
 
@@ -432,6 +561,17 @@ class QueryObject {
                         bool show_window,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Returns a copy of the render engine with the given name, in which the
+   geometries have their poses in this query object's context. The copy is
+   independent of the context: it can be rendered into while the simulation
+   advances (e.g., on another thread, as systems::sensors::RgbdSensorAsync
+   does).
+
+   @param renderer_name  The name of the render engine.
+   @throws std::logic_error if no render engine has the given name.  */
+  std::unique_ptr<render::RenderEngine> CloneRenderEngine(
+      const std::string& renderer_name) const;
+
   //@}
 
  private:
@@ -459,10 +599,28 @@ class QueryObject {
   // Update all poses. This method does no work if this is a "baked" query
   // object (see class docs for discussion).
   void FullPoseUpdate() const {
-    // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
     if (scene_graph_) scene_graph_->FullPoseUpdate(*context_);
   }
 
+  // The pose updates needed by the queries of each kind; like
+  // FullPoseUpdate(), they do no work on a "baked" query object. The poses of
+  // the engines of the other roles are left stale until they are queried.
+
+  // Updates the poses of the frames and geometries.
+  void KinematicsPoseUpdate() const {
+    if (scene_graph_) scene_graph_->KinematicsPoseUpdate(*context_);
+  }
+
+  // Updates the poses of the frames and geometries and the proximity engine.
+  void ProximityPoseUpdate() const {
+    if (scene_graph_) scene_graph_->ProximityPoseUpdate(*context_);
+  }
+
+  // Updates the poses of the frames and geometries and the render engines.
+  void PerceptionPoseUpdate() const {
+    if (scene_graph_) scene_graph_->PerceptionPoseUpdate(*context_);
+  }
+
   // Reports true if this object is configured so that it can support a query.
   bool is_callable() const {
     const bool live_condition = context_ != nullptr && scene_graph_ != nullptr;
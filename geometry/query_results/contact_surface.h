@@ -9,12 +9,18 @@
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/mesh_field_linear.h"
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/math/rigid_transform.h"
 
 namespace drake {
 namespace geometry {
 
+/** The representations of the mesh of a contact surface: a SurfaceMesh of
+ triangles, in which each polygon of the intersection of two meshes is
+ triangulated around a vertex at its centroid, or a PolygonSurfaceMesh of the
+ polygons themselves, which has about a third of the faces and vertices.  */
+enum class HydroelasticContactRepresentation { kTriangle, kPolygon };
 
 // TODO(DamrongGuoy): Update the reference to the "pressure field model"
 //  paper when it is accepted to the conference.
@@ -111,6 +117,15 @@ namespace geometry {
 
   We use the barycentric coordinates to evaluate the field values.
 
+  <h2> Representations </h2>
+
+  The mesh of a contact surface is either a SurfaceMesh of triangles, or a
+  PolygonSurfaceMesh of convex polygons (see
+  HydroelasticContactRepresentation). The fields of a polygonal contact
+  surface are evaluated at its vertices and at the centroids of its polygons,
+  instead of at barycentric coordinates; mesh_W() is only available for the
+  triangle representation, and poly_mesh_W() for the polygonal one.
+
   @tparam T the underlying scalar type. Must be a valid Eigen scalar.
  */
 template <typename T>
@@ -126,14 +141,30 @@ class ContactSurface {
 
     id_M_ = surface.id_M_;
     id_N_ = surface.id_N_;
-    mesh_W_ = std::make_unique<SurfaceMesh<T>>(*surface.mesh_W_);
-
-    // We can't simply copy the mesh fields; the copies must contain pointers
-    // to the new mesh. So, we use CloneAndSetMesh() instead.
-    e_MN_.reset(static_cast<SurfaceMeshFieldLinear<T, T>*>(
-        surface.e_MN_->CloneAndSetMesh(mesh_W_.get()).release()));
-    grad_h_MN_W_.reset(static_cast<SurfaceMeshFieldLinear<Vector3<T>, T>*>(
-        surface.grad_h_MN_W_->CloneAndSetMesh(mesh_W_.get()).release()));
+    if (surface.is_triangle()) {
+      mesh_W_ = std::make_unique<SurfaceMesh<T>>(*surface.mesh_W_);
+
+      // We can't simply copy the mesh fields; the copies must contain pointers
+      // to the new mesh. So, we use CloneAndSetMesh() instead.
+      e_MN_.reset(static_cast<SurfaceMeshFieldLinear<T, T>*>(
+          surface.e_MN_->CloneAndSetMesh(mesh_W_.get()).release()));
+      grad_h_MN_W_.reset(static_cast<SurfaceMeshFieldLinear<Vector3<T>, T>*>(
+          surface.grad_h_MN_W_->CloneAndSetMesh(mesh_W_.get()).release()));
+      poly_mesh_W_.reset();
+      poly_e_MN_.reset();
+      poly_grad_h_MN_W_.reset();
+    } else {
+      poly_mesh_W_ =
+          std::make_unique<PolygonSurfaceMesh<T>>(*surface.poly_mesh_W_);
+      poly_e_MN_ = std::make_unique<PolygonSurfaceMeshFieldLinear<T, T>>(
+          surface.poly_e_MN_->CloneAndSetMesh(poly_mesh_W_.get()));
+      poly_grad_h_MN_W_ =
+          std::make_unique<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>>(
+              surface.poly_grad_h_MN_W_->CloneAndSetMesh(poly_mesh_W_.get()));
+      mesh_W_.reset();
+      e_MN_.reset();
+      grad_h_MN_W_.reset();
+    }
 
     return *this;
   }
@@ -168,12 +199,72 @@ class ContactSurface {
     if (id_N_ < id_M_) SwapMAndN();
   }
 
+  /** Constructs a ContactSurface with the polygonal representation (see
+   HydroelasticContactRepresentation). The parameters are as in the
+   constructor above, with the polygonal mesh and its fields.  */
+  ContactSurface(
+      GeometryId id_M, GeometryId id_N,
+      std::unique_ptr<PolygonSurfaceMesh<T>> mesh_W,
+      std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>> e_MN,
+      std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>>
+          grad_h_MN_W)
+      : id_M_(id_M),
+        id_N_(id_N),
+        poly_mesh_W_(std::move(mesh_W)),
+        poly_e_MN_(std::move(e_MN)),
+        poly_grad_h_MN_W_(std::move(grad_h_MN_W)) {
+    DRAKE_DEMAND(poly_mesh_W_ != nullptr);
+    if (id_N_ < id_M_) SwapMAndN();
+  }
+
   /** Returns the geometry id of Geometry M. */
   GeometryId id_M() const { return id_M_; }
 
   /** Returns the geometry id of Geometry N. */
   GeometryId id_N() const { return id_N_; }
 
+  /** Returns the representation of the mesh of this contact surface.  */
+  HydroelasticContactRepresentation representation() const {
+    return is_triangle() ? HydroelasticContactRepresentation::kTriangle
+                         : HydroelasticContactRepresentation::kPolygon;
+  }
+
+  /** Returns true if the mesh of this contact surface is a SurfaceMesh of
+   triangles (see mesh_W()), false if it is a PolygonSurfaceMesh (see
+   poly_mesh_W()).  */
+  bool is_triangle() const { return poly_mesh_W_ == nullptr; }
+
+  /** Returns the number of faces (triangles or polygons) of the mesh.  */
+  int num_faces() const {
+    return is_triangle() ? mesh_W_->num_faces() : poly_mesh_W_->num_faces();
+  }
+
+  /** Returns the number of vertices of the mesh.  */
+  int num_vertices() const {
+    return is_triangle() ? mesh_W_->num_vertices()
+                         : poly_mesh_W_->num_vertices();
+  }
+
+  /** Returns the area of the face (triangle or polygon) `face`.  */
+  const T& area(SurfaceFaceIndex face) const {
+    return is_triangle() ? mesh_W_->area(face) : poly_mesh_W_->area(face);
+  }
+
+  /** Returns the position of the centroid of the face (triangle or polygon)
+   `face`, measured and expressed in the world frame.  */
+  Vector3<T> centroid(SurfaceFaceIndex face) const {
+    if (is_triangle()) {
+      return mesh_W_->CalcCartesianFromBarycentric(face, kTriangleCentroid());
+    }
+    return poly_mesh_W_->element_centroid(face);
+  }
+
+  /** Returns the area-weighted centroid of the mesh, measured and expressed
+   in the world frame.  */
+  const Vector3<T>& centroid() const {
+    return is_triangle() ? mesh_W_->centroid() : poly_mesh_W_->centroid();
+  }
+
   // TODO(damrongguoy) Consider removing these evaluation methods and instead
   // make the fields accessible, and then evaluate the fields directly.
 
@@ -193,7 +284,16 @@ class ContactSurface {
     @param vertex       The index of the vertex in the mesh.
    */
   T EvaluateE_MN(SurfaceVertexIndex vertex) const {
-    return e_MN_->EvaluateAtVertex(vertex);
+    return is_triangle() ? e_MN_->EvaluateAtVertex(vertex)
+                         : poly_e_MN_->EvaluateAtVertex(vertex);
+  }
+
+  /** Evaluates the scalar field eₘₙ at the centroid of the face (triangle or
+    polygon) `face`, see centroid(SurfaceFaceIndex).
+   */
+  T EvaluateE_MNAtCentroid(SurfaceFaceIndex face) const {
+    return is_triangle() ? e_MN_->Evaluate(face, kTriangleCentroid())
+                         : poly_e_MN_->EvaluateAtCentroid(face);
   }
 
   /** Evaluates the vector field ∇hₘₙ at Point Q on a triangle.
@@ -214,7 +314,17 @@ class ContactSurface {
     @retval  grad_h_MN_W is the vector expressed in the world frame.
    */
   Vector3<T> EvaluateGrad_h_MN_W(SurfaceVertexIndex vertex) const {
-    return grad_h_MN_W_->EvaluateAtVertex(vertex);
+    return is_triangle() ? grad_h_MN_W_->EvaluateAtVertex(vertex)
+                         : poly_grad_h_MN_W_->EvaluateAtVertex(vertex);
+  }
+
+  /** Evaluates the vector field ∇hₘₙ at the centroid of the face (triangle or
+    polygon) `face`, see centroid(SurfaceFaceIndex).
+    @retval  grad_h_MN_W is the vector expressed in the world frame.
+   */
+  Vector3<T> EvaluateGrad_h_MN_WAtCentroid(SurfaceFaceIndex face) const {
+    return is_triangle() ? grad_h_MN_W_->Evaluate(face, kTriangleCentroid())
+                         : poly_grad_h_MN_W_->EvaluateAtCentroid(face);
   }
 
   DRAKE_DEPRECATED("2019-12-01", "Use mesh_W() instead.")
@@ -222,25 +332,46 @@ class ContactSurface {
 
   /** Returns a reference to the surface mesh whose vertex
    positions are measured and expressed in the world frame.
+   @pre The representation is HydroelasticContactRepresentation::kTriangle.
    */
   const SurfaceMesh<T>& mesh_W() const {
     DRAKE_DEMAND(mesh_W_ != nullptr);
     return *mesh_W_;
   }
 
+  /** Returns a reference to the polygonal surface mesh whose vertex
+   positions are measured and expressed in the world frame.
+   @pre The representation is HydroelasticContactRepresentation::kPolygon.
+   */
+  const PolygonSurfaceMesh<T>& poly_mesh_W() const {
+    DRAKE_DEMAND(poly_mesh_W_ != nullptr);
+    return *poly_mesh_W_;
+  }
+
  private:
+  // The barycentric coordinates of the centroid of a triangle.
+  static typename SurfaceMesh<T>::Barycentric kTriangleCentroid() {
+    return typename SurfaceMesh<T>::Barycentric(1. / 3., 1. / 3., 1. / 3.);
+  }
+
   // Swaps M and N (modifying the data in place to reflect the change).
   void SwapMAndN() {
     std::swap(id_M_, id_N_);
     // TODO(SeanCurtis-TRI): Determine if this work is necessary. It is neither
     // documented nor tested that the face winding is guaranteed to be one way
     // or the other. Alternatively, this should be documented and tested.
-    mesh_W_->ReverseFaceWinding();
+    std::vector<Vector3<T>>* values{};
+    if (is_triangle()) {
+      mesh_W_->ReverseFaceWinding();
+      values = &grad_h_MN_W_->mutable_values();
+    } else {
+      poly_mesh_W_->ReverseFaceWinding();
+      values = &poly_grad_h_MN_W_->mutable_values();
+    }
 
     // Simply reverse the direction of the vector field.
-    std::vector<Vector3<T>>& values = grad_h_MN_W_->mutable_values();
-    for (SurfaceVertexIndex v(0); v < mesh_W_->num_vertices(); ++v) {
-      values[v] = -values[v];
+    for (Vector3<T>& value : *values) {
+      value = -value;
     }
 
     // Note: the scalar field does not depend on the order of M and N.
@@ -260,6 +391,12 @@ class ContactSurface {
   // Represents the vector field ∇hₘₙ on the surface mesh, expressed in M's
   // frame.
   std::unique_ptr<SurfaceMeshFieldLinear<Vector3<T>, T>> grad_h_MN_W_;
+  // With the polygonal representation, the mesh and the fields above are
+  // null, and these are their counterparts.
+  std::unique_ptr<PolygonSurfaceMesh<T>> poly_mesh_W_;
+  std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>> poly_e_MN_;
+  std::unique_ptr<PolygonSurfaceMeshFieldLinear<Vector3<T>, T>>
+      poly_grad_h_MN_W_;
   // TODO(DamrongGuoy): Remove this when we allow direct access to e_MN and
   //  grad_h_MN.
   template <typename U> friend class ContactSurfaceTester;
@@ -0,0 +1,194 @@
+/// @file
+///
+/// Times the rendering of color, depth and label images by RenderEngineVtk and
+/// RenderEngineGl, in images per second, for scenes of increasing numbers of
+/// objects. Each scene is a terrain with a grid of spheres and boxes under a
+/// camera looking straight down; the poses of the objects are updated before
+/// each image, as they would be in a simulation.
+///
+/// RenderEngineGl can also render with several clones of the engine at once,
+/// each on its own thread; the reported rate is then that of all of the
+/// threads together.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/geometry/render/gl/render_engine_gl_factory.h"
+#include "drake/geometry/render/render_engine_vtk_factory.h"
+
+DEFINE_string(engines, "vtk,gl", "Comma-separated render engines to time.");
+DEFINE_string(object_counts, "1,10,100,1000",
+              "Comma-separated numbers of objects of the scenes.");
+DEFINE_int32(width, 640, "Width of the images.");
+DEFINE_int32(height, 480, "Height of the images.");
+DEFINE_int32(num_images, 50, "Number of timed images per image type.");
+DEFINE_int32(gl_threads, 1,
+             "Number of clones of RenderEngineGl rendering at once, each on "
+             "its own thread.");
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace benchmarking {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+
+std::vector<std::string> Split(const std::string& list) {
+  std::vector<std::string> items;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) items.push_back(item);
+  return items;
+}
+
+std::unique_ptr<RenderEngine> MakeEngine(const std::string& name) {
+  if (name == "vtk") return MakeRenderEngineVtk(RenderEngineVtkParams());
+  if (name == "gl") return MakeRenderEngineGl(RenderEngineGlParams());
+  throw std::runtime_error("Unknown render engine: " + name);
+}
+
+// Populates the engine with a terrain and a grid of `num_objects` objects, and
+// returns their poses.
+std::unordered_map<GeometryId, RigidTransformd> PopulateScene(
+    int num_objects, RenderEngine* engine) {
+  PerceptionProperties terrain;
+  terrain.AddProperty("label", "id", RenderLabel::kDontCare);
+  terrain.AddProperty("phong", "diffuse", Vector4d(0.3, 0.3, 0.3, 1));
+  engine->RegisterVisual(GeometryId::get_new_id(), HalfSpace(), terrain,
+                         RigidTransformd::Identity(), false);
+
+  std::unordered_map<GeometryId, RigidTransformd> X_WGs;
+  const int grid_size =
+      static_cast<int>(std::ceil(std::sqrt(static_cast<double>(num_objects))));
+  const double spacing = 4.0 / grid_size;
+  for (int i = 0; i < num_objects; ++i) {
+    PerceptionProperties material;
+    material.AddProperty("label", "id", RenderLabel(i % 1000));
+    material.AddProperty("phong", "diffuse",
+                         Vector4d(0.2 + 0.6 * (i % 3) / 2, 0.5, 0.8, 1));
+    const GeometryId id = GeometryId::get_new_id();
+    const double size = 0.4 * spacing;
+    if (i % 2 == 0) {
+      engine->RegisterVisual(id, Sphere(size / 2), material,
+                             RigidTransformd::Identity(), true);
+    } else {
+      engine->RegisterVisual(id, Box(size, size, size), material,
+                             RigidTransformd::Identity(), true);
+    }
+    const int row = i / grid_size;
+    const int col = i % grid_size;
+    X_WGs[id] = RigidTransformd(Vector3d((row + 0.5) * spacing - 2,
+                                         (col + 0.5) * spacing - 2,
+                                         0.2 * spacing));
+  }
+  // Looking straight down from 5 meters above the terrain.
+  engine->UpdateViewpoint(RigidTransformd(
+      RotationMatrixd(AngleAxisd(M_PI, Vector3d::UnitY())),
+      Vector3d(0, 0, 5)));
+  return X_WGs;
+}
+
+// Renders FLAGS_num_images images of each type with each of the given engines
+// (each on its own thread, if there are several), and prints the numbers of
+// images per second.
+void TimeRendering(
+    const std::string& name, int num_objects,
+    const std::vector<RenderEngine*>& engines,
+    const std::unordered_map<GeometryId, RigidTransformd>& X_WGs) {
+  const DepthCameraProperties camera(FLAGS_width, FLAGS_height, M_PI_4,
+                                     "unused", 0.1, 10);
+  auto time = [&](auto&& render) {
+    auto render_all = [&](RenderEngine* engine) {
+      for (int i = 0; i < FLAGS_num_images; ++i) {
+        engine->UpdatePoses(X_WGs);
+        render(*engine);
+      }
+    };
+    // Warm up, so that the one-time setup (e.g., render targets, uploads of
+    // the meshes) isn't timed.
+    for (RenderEngine* engine : engines) render(*engine);
+    const auto start = std::chrono::steady_clock::now();
+    if (engines.size() == 1) {
+      render_all(engines[0]);
+    } else {
+      std::vector<std::thread> threads;
+      for (RenderEngine* engine : engines) {
+        threads.emplace_back(render_all, engine);
+      }
+      for (auto& thread : threads) thread.join();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return FLAGS_num_images * engines.size() / elapsed.count();
+  };
+
+  const double color_rate = time([&](const RenderEngine& engine) {
+    ImageRgba8U image(camera.width, camera.height);
+    engine.RenderColorImage(camera, false, &image);
+  });
+  const double depth_rate = time([&](const RenderEngine& engine) {
+    ImageDepth32F image(camera.width, camera.height);
+    engine.RenderDepthImage(camera, &image);
+  });
+  const double label_rate = time([&](const RenderEngine& engine) {
+    ImageLabel16I image(camera.width, camera.height);
+    engine.RenderLabelImage(camera, false, &image);
+  });
+  std::cout << fmt::format("{:>8} {:>8} {:>8} {:>12.1f} {:>12.1f} {:>12.1f}\n",
+                           name, engines.size(), num_objects, color_rate,
+                           depth_rate, label_rate);
+}
+
+int do_main() {
+  std::cout << fmt::format("{:>8} {:>8} {:>8} {:>12} {:>12} {:>12}\n",
+                           "engine", "threads", "objects", "color [1/s]",
+                           "depth [1/s]", "label [1/s]");
+  for (const std::string& name : Split(FLAGS_engines)) {
+    for (const std::string& count : Split(FLAGS_object_counts)) {
+      const int num_objects = std::stoi(count);
+      std::unique_ptr<RenderEngine> engine = MakeEngine(name);
+      const auto X_WGs = PopulateScene(num_objects, engine.get());
+      std::vector<std::unique_ptr<RenderEngine>> clones;
+      std::vector<RenderEngine*> engines{engine.get()};
+      if (name == "gl") {
+        for (int i = 1; i < FLAGS_gl_threads; ++i) {
+          clones.push_back(engine->Clone());
+          engines.push_back(clones.back().get());
+        }
+      }
+      TimeRendering(name, num_objects, engines, X_WGs);
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the rendering of images by the VTK and OpenGL render engines.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::geometry::render::benchmarking::do_main();
+}
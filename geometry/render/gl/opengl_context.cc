@@ -0,0 +1,214 @@
+#include "drake/geometry/render/gl/opengl_context.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <fmt/format.h>
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+namespace {
+
+// Reports whether the space-separated list of EGL `extensions` includes
+// `name`.
+bool HasExtension(const char* extensions, const char* name) {
+  if (extensions == nullptr) return false;
+  const size_t length = std::strlen(name);
+  for (const char* found = std::strstr(extensions, name); found != nullptr;
+       found = std::strstr(found + length, name)) {
+    const bool starts = found == extensions || found[-1] == ' ';
+    const bool ends = found[length] == ' ' || found[length] == '\0';
+    if (starts && ends) return true;
+  }
+  return false;
+}
+
+std::string EglErrorMessage(const char* call) {
+  return fmt::format("OpenGlContext: {} failed with EGL error 0x{:x}", call,
+                     eglGetError());
+}
+
+// The EGL display shared by all of the contexts of the process. It is
+// initialized on first use, and never terminated (terminating it would destroy
+// the contexts of other threads).
+class Display {
+ public:
+  static const Display& get() {
+    static const Display display;
+    return display;
+  }
+
+  EGLDisplay display() const { return display_; }
+  EGLConfig config() const { return config_; }
+  bool surfaceless() const { return surfaceless_; }
+
+ private:
+  Display() {
+    const char* client_extensions =
+        eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    auto get_platform_display =
+        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+    // Prefer a GPU, which doesn't require a display server.
+    if (get_platform_display != nullptr &&
+        HasExtension(client_extensions, "EGL_EXT_platform_device")) {
+      auto query_devices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(
+          eglGetProcAddress("eglQueryDevicesEXT"));
+      const EGLint kMaxDevices = 16;
+      EGLDeviceEXT devices[kMaxDevices];
+      EGLint num_devices = 0;
+      if (query_devices != nullptr &&
+          query_devices(kMaxDevices, devices, &num_devices)) {
+        for (int i = 0; i < num_devices && display_ == EGL_NO_DISPLAY; ++i) {
+          TryInitialize(get_platform_display(EGL_PLATFORM_DEVICE_EXT,
+                                             devices[i], nullptr));
+        }
+      }
+    }
+    if (display_ == EGL_NO_DISPLAY && get_platform_display != nullptr &&
+        HasExtension(client_extensions, "EGL_MESA_platform_surfaceless")) {
+      TryInitialize(get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+                                         EGL_DEFAULT_DISPLAY, nullptr));
+    }
+    if (display_ == EGL_NO_DISPLAY) {
+      TryInitialize(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+    }
+    if (display_ == EGL_NO_DISPLAY) {
+      throw std::runtime_error(
+          "OpenGlContext: no EGL display could be initialized");
+    }
+
+    const EGLint config_attributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE};
+    EGLint num_configs = 0;
+    if (!eglChooseConfig(display_, config_attributes, &config_, 1,
+                         &num_configs) ||
+        num_configs == 0) {
+      throw std::runtime_error(
+          "OpenGlContext: the EGL display has no configuration for OpenGL");
+    }
+    surfaceless_ = HasExtension(eglQueryString(display_, EGL_EXTENSIONS),
+                                "EGL_KHR_surfaceless_context");
+  }
+
+  void TryInitialize(EGLDisplay display) {
+    if (display == EGL_NO_DISPLAY) return;
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (eglInitialize(display, &major, &minor)) display_ = display;
+  }
+
+  EGLDisplay display_{EGL_NO_DISPLAY};
+  EGLConfig config_{};
+  bool surfaceless_{false};
+};
+
+}  // namespace
+
+class OpenGlContext::Impl {
+ public:
+  explicit Impl(const Impl* shared) : display_(Display::get()) {
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+      throw std::runtime_error(EglErrorMessage("eglBindAPI()"));
+    }
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE};
+    context_ = eglCreateContext(
+        display_.display(), display_.config(),
+        shared != nullptr ? shared->context_ : EGL_NO_CONTEXT,
+        context_attributes);
+    if (context_ == EGL_NO_CONTEXT) {
+      throw std::runtime_error(EglErrorMessage("eglCreateContext()"));
+    }
+    // Without EGL_KHR_surfaceless_context, a context can only be made current
+    // with a surface; a tiny one is enough since the rendering is done into
+    // framebuffer objects.
+    if (!display_.surfaceless()) {
+      const EGLint surface_attributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1,
+                                           EGL_NONE};
+      surface_ = eglCreatePbufferSurface(display_.display(), display_.config(),
+                                         surface_attributes);
+      if (surface_ == EGL_NO_SURFACE) {
+        eglDestroyContext(display_.display(), context_);
+        throw std::runtime_error(EglErrorMessage("eglCreatePbufferSurface()"));
+      }
+    }
+  }
+
+  ~Impl() {
+    if (IsCurrent()) {
+      eglMakeCurrent(display_.display(), EGL_NO_SURFACE, EGL_NO_SURFACE,
+                     EGL_NO_CONTEXT);
+    }
+    if (surface_ != EGL_NO_SURFACE) {
+      eglDestroySurface(display_.display(), surface_);
+    }
+    eglDestroyContext(display_.display(), context_);
+  }
+
+  void MakeCurrent() const {
+    if (IsCurrent()) return;
+    if (!eglMakeCurrent(display_.display(), surface_, surface_, context_)) {
+      throw std::runtime_error(EglErrorMessage("eglMakeCurrent()"));
+    }
+  }
+
+  bool IsCurrent() const {
+    // The current context is tracked per client API.
+    eglBindAPI(EGL_OPENGL_API);
+    return eglGetCurrentContext() == context_;
+  }
+
+ private:
+  const Display& display_;
+  EGLContext context_{EGL_NO_CONTEXT};
+  EGLSurface surface_{EGL_NO_SURFACE};
+};
+
+OpenGlContext::OpenGlContext(const OpenGlContext* shared)
+    : impl_(new Impl(shared != nullptr ? shared->impl_.get() : nullptr)) {}
+
+OpenGlContext::~OpenGlContext() = default;
+
+void OpenGlContext::MakeCurrent() const { impl_->MakeCurrent(); }
+
+bool OpenGlContext::IsCurrent() const { return impl_->IsCurrent(); }
+
+OpenGlContext::ScopedCurrent::ScopedCurrent(const OpenGlContext& context) {
+  // The current context is tracked per client API.
+  eglBindAPI(EGL_OPENGL_API);
+  previous_display_ = eglGetCurrentDisplay();
+  previous_draw_surface_ = eglGetCurrentSurface(EGL_DRAW);
+  previous_read_surface_ = eglGetCurrentSurface(EGL_READ);
+  previous_context_ = eglGetCurrentContext();
+  context.MakeCurrent();
+}
+
+OpenGlContext::ScopedCurrent::~ScopedCurrent() {
+  eglBindAPI(EGL_OPENGL_API);
+  if (previous_context_ == eglGetCurrentContext()) return;
+  if (previous_context_ != EGL_NO_CONTEXT) {
+    eglMakeCurrent(previous_display_, previous_draw_surface_,
+                   previous_read_surface_, previous_context_);
+  } else {
+    eglMakeCurrent(Display::get().display(), EGL_NO_SURFACE, EGL_NO_SURFACE,
+                   EGL_NO_CONTEXT);
+  }
+}
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
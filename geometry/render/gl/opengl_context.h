@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+/** An OpenGL 3.3 (core profile) context created with EGL, without any window
+ or display server; rendering is done into framebuffer objects.
+
+ A process can have any number of contexts. Each one is current on at most one
+ thread at a time, so that several render engines, each with its own context,
+ can render in parallel on their own threads. A context can be created to
+ share the objects of another one (buffers, textures, shaders, but not
+ container objects such as vertex array and framebuffer objects), so that the
+ clones of a render engine don't duplicate its meshes on the GPU.
+
+ The EGL display is the first GPU enumerated by EGL_EXT_platform_device, if
+ any. Otherwise, it is Mesa's surfaceless platform, or the default display.  */
+class OpenGlContext {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OpenGlContext)
+
+  /** Creates a context which shares the objects of `shared`, if it isn't
+   null.
+   @throws std::runtime_error if EGL can't create the context.  */
+  explicit OpenGlContext(const OpenGlContext* shared = nullptr);
+
+  /** Destroys the context. If it is current on the calling thread, it is
+   released first.  */
+  ~OpenGlContext();
+
+  /** Makes this context current on the calling thread. This is cheap if it
+   already is.
+   @throws std::runtime_error if the context is current on another thread.  */
+  void MakeCurrent() const;
+
+  /** Reports whether this context is current on the calling thread.  */
+  bool IsCurrent() const;
+
+  /** Makes a context current on the calling thread for the lifetime of this
+   object, after which the context that was current before (if any) is made
+   current again. Scoping the use of a context this way leaves it free to be
+   used by another thread afterwards (e.g., by a thread pool).  */
+  class ScopedCurrent {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedCurrent)
+
+    /** @throws std::runtime_error if `context` is current on another
+     thread.  */
+    explicit ScopedCurrent(const OpenGlContext& context);
+
+    ~ScopedCurrent();
+
+   private:
+    // The EGL display, surfaces and context that were current before.
+    void* previous_display_{};
+    void* previous_draw_surface_{};
+    void* previous_read_surface_{};
+    void* previous_context_{};
+  };
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,13 @@
+#pragma once
+
+/** @file
+ Includes the OpenGL API used by RenderEngineGl. The functions beyond OpenGL
+ 1.1 are linked directly from libGL (rather than loaded at runtime); its
+ dispatch serves the EGL contexts of OpenGlContext as well.  */
+
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+
+#include <GL/gl.h>
+#include <GL/glext.h>
@@ -0,0 +1,621 @@
+#include "drake/geometry/render/gl/render_engine_gl.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+using Eigen::Matrix4f;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using internal::MeshData;
+using internal::OpenGlContext;
+using math::RigidTransformd;
+using systems::sensors::ColorD;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+
+namespace {
+
+// See the note on clipping planes in render_engine_vtk.cc; the same planes
+// are used here, so that both engines render the same images.
+const double kClippingPlaneNear = 0.01;
+// The far clipping plane of the color and label images.
+const double kDefaultClippingPlaneFar = 100.;
+const double kTerrainSize = 100.;
+// The tessellation of the spheres and cylinders.
+const int kResolution = 50;
+
+// A package of data required to register a visual geometry.
+struct RegistrationData {
+  const PerceptionProperties& properties;
+  const RigidTransformd& X_WG;
+  const GeometryId id;
+};
+
+// Transforms each vertex V of a mesh into the camera frame C, where p_CV and
+// n_CV are its position and normal. The projection maps the camera frame
+// (x right, y down, z forward) so that the rows read back by glReadPixels()
+// (bottom row first) are the rows of the image, top row first.
+const char kVertexShader[] = R"""(
+#version 330 core
+layout(location = 0) in vec3 p_GV;
+layout(location = 1) in vec3 n_GV;
+layout(location = 2) in mat4 X_WG;
+layout(location = 6) in vec3 scale;
+layout(location = 7) in vec4 diffuse;
+layout(location = 8) in int label;
+uniform mat4 X_CW;
+uniform mat4 projection;
+out vec3 p_CV;
+out vec3 n_CV;
+out vec4 diffuse_color;
+flat out int render_label;
+void main() {
+  mat4 X_CG = X_CW * X_WG;
+  vec4 p_CV4 = X_CG * vec4(scale * p_GV, 1.0);
+  p_CV = p_CV4.xyz;
+  n_CV = mat3(X_CG) * (n_GV / scale);
+  diffuse_color = diffuse;
+  render_label = label;
+  gl_Position = projection * p_CV4;
+}
+)""";
+
+// The surfaces are lit by a headlight, on both sides.
+const char kColorFragmentShader[] = R"""(
+#version 330 core
+in vec3 p_CV;
+in vec3 n_CV;
+in vec4 diffuse_color;
+out vec4 color;
+void main() {
+  float intensity = abs(dot(normalize(n_CV), normalize(p_CV)));
+  color = vec4(diffuse_color.rgb * intensity, diffuse_color.a);
+}
+)""";
+
+// The geometry beyond z_far is clipped, and the depth buffer is cleared to
+// ImageDepth32F's kTooFar value (infinity).
+const char kDepth32FFragmentShader[] = R"""(
+#version 330 core
+in vec3 p_CV;
+uniform float z_near;
+out float depth;
+void main() {
+  depth = p_CV.z < z_near ? 0.0 : p_CV.z;
+}
+)""";
+
+// The depth in millimeters; see internal::ConvertDepth32FTo16U().
+const char kDepth16UFragmentShader[] = R"""(
+#version 330 core
+in vec3 p_CV;
+uniform float z_near;
+out uint depth;
+void main() {
+  float depth_mm = p_CV.z * 1000.0;
+  if (p_CV.z < z_near) {
+    depth = 0u;
+  } else {
+    depth = depth_mm < 65535.0 ? uint(depth_mm) : 65535u;
+  }
+}
+)""";
+
+const char kLabelFragmentShader[] = R"""(
+#version 330 core
+flat in int render_label;
+uniform int do_not_render;
+out int label;
+void main() {
+  if (render_label == do_not_render) discard;
+  label = render_label;
+}
+)""";
+
+// The pixel format of each image type's render target, and of its image.
+struct PixelFormat {
+  GLenum internal_format;
+  GLenum format;
+  GLenum type;
+};
+
+const PixelFormat kPixelFormats[] = {
+    {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE},
+    {GL_R32F, GL_RED, GL_FLOAT},
+    {GL_R16UI, GL_RED_INTEGER, GL_UNSIGNED_SHORT},
+    {GL_R16I, GL_RED_INTEGER, GL_SHORT},
+};
+
+GLuint CompileShader(GLenum type, const char* source) {
+  const GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, nullptr);
+  glCompileShader(shader);
+  GLint compiled = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+  if (compiled != GL_TRUE) {
+    char log[1024] = {};
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    glDeleteShader(shader);
+    throw std::runtime_error(
+        fmt::format("RenderEngineGl: failed to compile a shader: {}", log));
+  }
+  return shader;
+}
+
+GLuint LinkProgram(const char* fragment_shader_source) {
+  const GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+  const GLuint fragment_shader =
+      CompileShader(GL_FRAGMENT_SHADER, fragment_shader_source);
+  const GLuint program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glLinkProgram(program);
+  glDeleteShader(vertex_shader);
+  glDeleteShader(fragment_shader);
+  GLint linked = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  if (linked != GL_TRUE) {
+    char log[1024] = {};
+    glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+    glDeleteProgram(program);
+    throw std::runtime_error(
+        fmt::format("RenderEngineGl: failed to link a program: {}", log));
+  }
+  return program;
+}
+
+// Returns the matrix which projects the points of the camera frame C into
+// OpenGL's clip space, for the given field of view and clipping planes.
+Matrix4f ProjectionMatrix(const CameraProperties& camera, double z_near,
+                          double z_far) {
+  const double f = 1 / std::tan(camera.fov_y / 2);
+  const double aspect = static_cast<double>(camera.width) / camera.height;
+  Matrix4f projection = Matrix4f::Zero();
+  projection(0, 0) = f / aspect;
+  projection(1, 1) = f;
+  projection(2, 2) = (z_far + z_near) / (z_far - z_near);
+  projection(2, 3) = -2 * z_far * z_near / (z_far - z_near);
+  projection(3, 2) = 1;
+  return projection;
+}
+
+void SetPose(const RigidTransformd& X_WG, float* X_WG_out) {
+  const Matrix4f X = X_WG.GetAsMatrix4().cast<float>();
+  std::copy(X.data(), X.data() + 16, X_WG_out);
+}
+
+}  // namespace
+
+struct RenderEngineGl::GpuMesh {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GpuMesh)
+
+  // Uploads the given mesh; its vertex buffer holds all of the positions,
+  // followed by all of the normals.
+  explicit GpuMesh(const MeshData& data)
+      : num_vertices(static_cast<int>(data.positions.rows())),
+        num_indices(static_cast<GLsizei>(data.indices.size())) {
+    const GLsizeiptr block_size = num_vertices * 3 * sizeof(float);
+    glGenBuffers(1, &vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, 2 * block_size, nullptr, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, block_size, data.positions.data());
+    glBufferSubData(GL_ARRAY_BUFFER, block_size, block_size,
+                    data.normals.data());
+    // The element buffer is bound as such by each engine's vertex array.
+    glGenBuffers(1, &index_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, index_buffer);
+    glBufferData(GL_ARRAY_BUFFER, num_indices * sizeof(GLuint),
+                 data.indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  // A context sharing the buffers must be current.
+  ~GpuMesh() {
+    glDeleteBuffers(1, &vertex_buffer);
+    glDeleteBuffers(1, &index_buffer);
+  }
+
+  GLuint vertex_buffer{0};
+  GLuint index_buffer{0};
+  int num_vertices{};
+  GLsizei num_indices{};
+};
+
+struct RenderEngineGl::Programs {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Programs)
+
+  Programs()
+      : programs{{LinkProgram(kColorFragmentShader),
+                  LinkProgram(kDepth32FFragmentShader),
+                  LinkProgram(kDepth16UFragmentShader),
+                  LinkProgram(kLabelFragmentShader)}} {}
+
+  // A context sharing the programs must be current.
+  ~Programs() {
+    for (GLuint program : programs) glDeleteProgram(program);
+  }
+
+  std::array<GLuint, kNumImageTypes> programs;
+};
+
+RenderEngineGl::RenderEngineGl(const RenderEngineGlParams& parameters)
+    : RenderEngine(parameters.default_label ? *parameters.default_label
+                                            : RenderLabel::kUnspecified),
+      context_(std::make_unique<OpenGlContext>()) {
+  if (parameters.default_diffuse) {
+    default_diffuse_ = *parameters.default_diffuse;
+  }
+
+  const auto& c = parameters.default_clear_color;
+  default_clear_color_ = ColorD{c(0), c(1), c(2)};
+
+  const OpenGlContext::ScopedCurrent current(*context_);
+  programs_ = std::make_shared<const Programs>();
+}
+
+RenderEngineGl::RenderEngineGl(const RenderEngineGl& other)
+    : RenderEngine(other),
+      context_(std::make_unique<OpenGlContext>(other.context_.get())),
+      programs_(other.programs_),
+      X_CW_(other.X_CW_),
+      default_diffuse_(other.default_diffuse_),
+      default_clear_color_(other.default_clear_color_) {
+  // The meshes are shared; the vertex arrays and instance buffers are not.
+  for (const auto& [key, other_batch] : other.batches_) {
+    Batch& batch = batches_[key];
+    batch.mesh = other_batch.mesh;
+    batch.instances = other_batch.instances;
+    batch.ids = other_batch.ids;
+    for (int i = 0; i < static_cast<int>(batch.ids.size()); ++i) {
+      instances_[batch.ids[i]] = InstanceLocation{&batch, i};
+    }
+  }
+}
+
+RenderEngineGl::~RenderEngineGl() {
+  // The objects of this engine, and the shared objects of which it holds the
+  // last reference, can only be released while its context is current.
+  const OpenGlContext::ScopedCurrent current(*context_);
+  for (const auto& key_batch : batches_) {
+    const Batch& batch = key_batch.second;
+    glDeleteVertexArrays(1, &batch.vertex_array);
+    glDeleteBuffers(1, &batch.instance_buffer);
+  }
+  for (const auto& key_target : render_targets_) {
+    const RenderTarget& target = key_target.second;
+    glDeleteFramebuffers(1, &target.frame_buffer);
+    glDeleteRenderbuffers(1, &target.color_buffer);
+    glDeleteRenderbuffers(1, &target.depth_buffer);
+  }
+  batches_.clear();
+  programs_.reset();
+}
+
+void RenderEngineGl::UpdateViewpoint(const RigidTransformd& X_WR) {
+  X_CW_ = X_WR.inverse();
+}
+
+void RenderEngineGl::RenderColorImage(const CameraProperties& camera, bool,
+                                      ImageRgba8U* color_image_out) const {
+  Render(ImageType::kColor, camera, kClippingPlaneNear,
+         kDefaultClippingPlaneFar, color_image_out->at(0, 0));
+}
+
+void RenderEngineGl::RenderDepthImage(const DepthCameraProperties& camera,
+                                      ImageDepth32F* depth_image_out) const {
+  Render(ImageType::kDepth32F, camera, camera.z_near, camera.z_far,
+         depth_image_out->at(0, 0));
+}
+
+void RenderEngineGl::RenderDepthImage(const DepthCameraProperties& camera,
+                                      ImageDepth16U* depth_image_out) const {
+  Render(ImageType::kDepth16U, camera, camera.z_near, camera.z_far,
+         depth_image_out->at(0, 0));
+}
+
+void RenderEngineGl::RenderLabelImage(const CameraProperties& camera, bool,
+                                      ImageLabel16I* label_image_out) const {
+  Render(ImageType::kLabel, camera, kClippingPlaneNear,
+         kDefaultClippingPlaneFar, label_image_out->at(0, 0));
+}
+
+void RenderEngineGl::ImplementGeometry(const Sphere& sphere, void* user_data) {
+  AddInstance("sphere",
+              [] {
+                return internal::MakeLongLatUnitSphere(kResolution,
+                                                       kResolution);
+              },
+              Vector3d::Constant(sphere.get_radius()), user_data);
+}
+
+void RenderEngineGl::ImplementGeometry(const Cylinder& cylinder,
+                                       void* user_data) {
+  AddInstance("cylinder",
+              [] { return internal::MakeUnitCylinder(kResolution); },
+              Vector3d(cylinder.get_radius(), cylinder.get_radius(),
+                       cylinder.get_length()),
+              user_data);
+}
+
+void RenderEngineGl::ImplementGeometry(const HalfSpace&, void* user_data) {
+  AddInstance("half_space",
+              [] { return internal::MakeSquarePatch(kTerrainSize); },
+              Vector3d::Ones(), user_data);
+}
+
+void RenderEngineGl::ImplementGeometry(const Box& box, void* user_data) {
+  AddInstance("box", [] { return internal::MakeUnitBox(); },
+              Vector3d(box.width(), box.depth(), box.height()), user_data);
+}
+
+void RenderEngineGl::ImplementGeometry(const Mesh& mesh, void* user_data) {
+  const std::string filename = mesh.filename();
+  AddInstance("obj:" + filename,
+              [&filename] { return internal::LoadMeshFromObj(filename); },
+              Vector3d::Constant(mesh.scale()), user_data);
+}
+
+void RenderEngineGl::ImplementGeometry(const Convex& convex, void* user_data) {
+  const std::string filename = convex.filename();
+  AddInstance("obj:" + filename,
+              [&filename] { return internal::LoadMeshFromObj(filename); },
+              Vector3d::Constant(convex.scale()), user_data);
+}
+
+bool RenderEngineGl::DoRegisterVisual(GeometryId id, const Shape& shape,
+                                      const PerceptionProperties& properties,
+                                      const RigidTransformd& X_WG) {
+  // Any new mesh is created in this engine's context.
+  const OpenGlContext::ScopedCurrent current(*context_);
+  // Note: the user_data interface on reification requires a non-const pointer.
+  RegistrationData data{properties, X_WG, id};
+  shape.Reify(this, &data);
+  return true;
+}
+
+void RenderEngineGl::DoUpdateVisualPose(GeometryId id,
+                                        const RigidTransformd& X_WG) {
+  const InstanceLocation& location = instances_.at(id);
+  SetPose(X_WG, location.batch->instances[location.index].X_WG);
+  location.batch->dirty = true;
+}
+
+bool RenderEngineGl::DoRemoveGeometry(GeometryId id) {
+  auto iter = instances_.find(id);
+  if (iter == instances_.end()) return false;
+  // The last instance of the batch takes the place of the removed one.
+  Batch& batch = *iter->second.batch;
+  const int index = iter->second.index;
+  batch.instances[index] = batch.instances.back();
+  batch.ids[index] = batch.ids.back();
+  instances_[batch.ids[index]].index = index;
+  batch.instances.pop_back();
+  batch.ids.pop_back();
+  batch.dirty = true;
+  instances_.erase(id);
+  return true;
+}
+
+std::unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
+  return std::unique_ptr<RenderEngineGl>(new RenderEngineGl(*this));
+}
+
+void RenderEngineGl::AddInstance(const std::string& key,
+                                 const std::function<MeshData()>& make_mesh,
+                                 const Vector3d& scale, void* user_data) {
+  DRAKE_DEMAND(user_data != nullptr);
+  const RegistrationData& data =
+      *reinterpret_cast<RegistrationData*>(user_data);
+
+  Instance instance{};
+  SetPose(data.X_WG, instance.X_WG);
+  for (int i = 0; i < 3; ++i) instance.scale[i] = static_cast<float>(scale(i));
+  const Vector4d& diffuse = data.properties.GetPropertyOrDefault(
+      "phong", "diffuse", default_diffuse_);
+  for (int i = 0; i < 4; ++i) {
+    instance.diffuse[i] = static_cast<float>(diffuse(i));
+  }
+  instance.label = GetRenderLabelOrThrow(data.properties);
+
+  auto iter = batches_.find(key);
+  if (iter == batches_.end()) {
+    // Make the mesh first, so that no batch is left without one if it throws.
+    auto mesh = std::make_shared<const GpuMesh>(make_mesh());
+    iter = batches_.emplace(key, Batch{}).first;
+    iter->second.mesh = std::move(mesh);
+  }
+  Batch& batch = iter->second;
+  instances_[data.id] =
+      InstanceLocation{&batch, static_cast<int>(batch.instances.size())};
+  batch.instances.push_back(instance);
+  batch.ids.push_back(data.id);
+  batch.dirty = true;
+}
+
+void RenderEngineGl::Render(ImageType image_type,
+                            const CameraProperties& camera, double z_near,
+                            double z_far, void* pixels) const {
+  const OpenGlContext::ScopedCurrent current(*context_);
+  const RenderTarget& target =
+      GetRenderTarget(image_type, camera.width, camera.height);
+  glBindFramebuffer(GL_FRAMEBUFFER, target.frame_buffer);
+  glViewport(0, 0, camera.width, camera.height);
+
+  // Clears the image to its "nothing rendered" value.
+  switch (image_type) {
+    case ImageType::kColor: {
+      const GLfloat color[] = {static_cast<float>(default_clear_color_.r),
+                               static_cast<float>(default_clear_color_.g),
+                               static_cast<float>(default_clear_color_.b),
+                               0.f};
+      glClearBufferfv(GL_COLOR, 0, color);
+      break;
+    }
+    case ImageType::kDepth32F: {
+      const GLfloat depth[] = {ImageDepth32F::Traits::kTooFar, 0.f, 0.f, 0.f};
+      glClearBufferfv(GL_COLOR, 0, depth);
+      break;
+    }
+    case ImageType::kDepth16U: {
+      const GLuint depth[] = {ImageDepth16U::Traits::kTooFar, 0, 0, 0};
+      glClearBufferuiv(GL_COLOR, 0, depth);
+      break;
+    }
+    case ImageType::kLabel: {
+      const GLint label[] = {RenderLabel::kEmpty, 0, 0, 0};
+      glClearBufferiv(GL_COLOR, 0, label);
+      break;
+    }
+  }
+  const GLfloat far_depth = 1.f;
+  glClearBufferfv(GL_DEPTH, 0, &far_depth);
+  glEnable(GL_DEPTH_TEST);
+  // The winding of the triangles isn't relied upon (the projection mirrors
+  // it, and meshes from files may not respect it).
+  glDisable(GL_CULL_FACE);
+  if (image_type == ImageType::kColor) {
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE,
+                        GL_ONE_MINUS_SRC_ALPHA);
+  } else {
+    glDisable(GL_BLEND);
+  }
+
+  const GLuint program = programs_->programs[image_type];
+  glUseProgram(program);
+  const Matrix4f X_CW = X_CW_.GetAsMatrix4().cast<float>();
+  glUniformMatrix4fv(glGetUniformLocation(program, "X_CW"), 1, GL_FALSE,
+                     X_CW.data());
+  const Matrix4f projection = ProjectionMatrix(
+      camera, kClippingPlaneNear, z_far);
+  glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE,
+                     projection.data());
+  if (image_type == ImageType::kDepth32F ||
+      image_type == ImageType::kDepth16U) {
+    glUniform1f(glGetUniformLocation(program, "z_near"),
+                static_cast<float>(z_near));
+  }
+  if (image_type == ImageType::kLabel) {
+    glUniform1i(glGetUniformLocation(program, "do_not_render"),
+                RenderLabel::kDoNotRender);
+  }
+
+  for (const auto& key_batch : batches_) {
+    const Batch& batch = key_batch.second;
+    if (batch.instances.empty()) continue;
+    PrepareBatch(batch);
+    glBindVertexArray(batch.vertex_array);
+    glDrawElementsInstanced(GL_TRIANGLES, batch.mesh->num_indices,
+                            GL_UNSIGNED_INT, nullptr,
+                            static_cast<GLsizei>(batch.instances.size()));
+  }
+  glBindVertexArray(0);
+
+  // The pixels are read straight into the caller's image, whose rows are
+  // tightly packed.
+  const PixelFormat& format = kPixelFormats[image_type];
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(0, 0, camera.width, camera.height, format.format, format.type,
+               pixels);
+}
+
+const RenderEngineGl::RenderTarget& RenderEngineGl::GetRenderTarget(
+    ImageType image_type, int width, int height) const {
+  const auto key = std::make_tuple(static_cast<int>(image_type), width, height);
+  auto iter = render_targets_.find(key);
+  if (iter != render_targets_.end()) return iter->second;
+
+  RenderTarget target;
+  glGenFramebuffers(1, &target.frame_buffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, target.frame_buffer);
+  glGenRenderbuffers(1, &target.color_buffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, target.color_buffer);
+  glRenderbufferStorage(GL_RENDERBUFFER,
+                        kPixelFormats[image_type].internal_format, width,
+                        height);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            GL_RENDERBUFFER, target.color_buffer);
+  glGenRenderbuffers(1, &target.depth_buffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, target.depth_buffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT32F, width, height);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                            GL_RENDERBUFFER, target.depth_buffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+  const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    glDeleteFramebuffers(1, &target.frame_buffer);
+    glDeleteRenderbuffers(1, &target.color_buffer);
+    glDeleteRenderbuffers(1, &target.depth_buffer);
+    throw std::runtime_error(fmt::format(
+        "RenderEngineGl: the {}x{} render target is incomplete (0x{:x})",
+        width, height, status));
+  }
+  return render_targets_.emplace(key, target).first->second;
+}
+
+void RenderEngineGl::PrepareBatch(const Batch& batch) const {
+  if (batch.vertex_array == 0) {
+    glGenVertexArrays(1, &batch.vertex_array);
+    glGenBuffers(1, &batch.instance_buffer);
+    glBindVertexArray(batch.vertex_array);
+
+    // The vertices of the mesh.
+    const GpuMesh& mesh = *batch.mesh;
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vertex_buffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(
+        1, 3, GL_FLOAT, GL_FALSE, 0,
+        reinterpret_cast<void*>(mesh.num_vertices * 3 * sizeof(float)));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.index_buffer);
+
+    // The instances; the pose matrix takes one location per column.
+    glBindBuffer(GL_ARRAY_BUFFER, batch.instance_buffer);
+    auto instance_attribute = [](GLuint location, GLint size, size_t offset) {
+      glEnableVertexAttribArray(location);
+      glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE,
+                            sizeof(Instance), reinterpret_cast<void*>(offset));
+      glVertexAttribDivisor(location, 1);
+    };
+    for (int j = 0; j < 4; ++j) {
+      instance_attribute(2 + j, 4,
+                         offsetof(Instance, X_WG) + 4 * j * sizeof(float));
+    }
+    instance_attribute(6, 3, offsetof(Instance, scale));
+    instance_attribute(7, 4, offsetof(Instance, diffuse));
+    glEnableVertexAttribArray(8);
+    glVertexAttribIPointer(
+        8, 1, GL_INT, sizeof(Instance),
+        reinterpret_cast<void*>(offsetof(Instance, label)));
+    glVertexAttribDivisor(8, 1);
+    glBindVertexArray(0);
+    batch.dirty = true;
+  }
+  if (batch.dirty) {
+    glBindBuffer(GL_ARRAY_BUFFER, batch.instance_buffer);
+    glBufferData(GL_ARRAY_BUFFER, batch.instances.size() * sizeof(Instance),
+                 batch.instances.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    batch.dirty = false;
+  }
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
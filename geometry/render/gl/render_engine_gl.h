@@ -0,0 +1,222 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/gl/opengl_context.h"
+#include "drake/geometry/render/gl/opengl_includes.h"
+#include "drake/geometry/render/gl/render_engine_gl_factory.h"
+#include "drake/geometry/render/gl/shape_meshes.h"
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_label.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** See documentation of MakeRenderEngineGl().  */
+class RenderEngineGl final : public RenderEngine {
+ public:
+  /** \name Does not allow copy, move, or assignment  */
+  //@{
+#ifdef DRAKE_DOXYGEN_CXX
+  // Note: the copy constructor is actually private to serve as the basis for
+  // implementing the DoClone() method.
+  RenderEngineGl(const RenderEngineGl&) = delete;
+#endif
+  RenderEngineGl& operator=(const RenderEngineGl&) = delete;
+  RenderEngineGl(RenderEngineGl&&) = delete;
+  RenderEngineGl& operator=(RenderEngineGl&&) = delete;
+  //@}}
+
+  /** Constructs the render engine from the given `parameters`.
+
+   When one of the optional parameters is omitted, the constructed value will be
+   as documented elsewhere in @ref render_engine_gl_properties "this class".
+   @throws std::runtime_error if the OpenGL context can't be created.  */
+  RenderEngineGl(
+      const RenderEngineGlParams& parameters = RenderEngineGlParams());
+
+  ~RenderEngineGl() final;
+
+  /** @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
+
+  /** @see RenderEngine::RenderColorImage().  */
+  void RenderColorImage(
+      const CameraProperties& camera, bool show_window,
+      systems::sensors::ImageRgba8U* color_image_out) const final;
+
+  /** @see RenderEngine::RenderDepthImage().  */
+  void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+  /** @see RenderEngine::RenderDepthImage().  */
+  void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth16U* depth_image_out) const final;
+
+  /** @see RenderEngine::RenderLabelImage().  */
+  void RenderLabelImage(
+      const CameraProperties& camera, bool show_window,
+      systems::sensors::ImageLabel16I* label_image_out) const final;
+
+  /** @name    Shape reification  */
+  //@{
+  void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+  void ImplementGeometry(const Box& box, void* user_data) final;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+  void ImplementGeometry(const Convex& convex, void* user_data) final;
+  //@}
+
+  /** @name    Access the default properties
+
+   Provides access to the default values this instance of the render engine is
+   using. These values must be set at construction.  */
+  //@{
+
+  const Eigen::Vector4d& default_diffuse() const { return default_diffuse_; }
+
+  using RenderEngine::default_render_label;
+
+  //@}
+
+ private:
+  // @see RenderEngine::DoRegisterVisual().
+  bool DoRegisterVisual(
+      GeometryId id, const Shape& shape, const PerceptionProperties& properties,
+      const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoUpdateVisualPose().
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoRemoveGeometry().
+  bool DoRemoveGeometry(GeometryId id) final;
+
+  // @see RenderEngine::DoClone().
+  std::unique_ptr<RenderEngine> DoClone() const final;
+
+  // Copy constructor for the purpose of cloning. The clone has its own
+  // context, which shares the meshes and programs of `other`.
+  RenderEngineGl(const RenderEngineGl& other);
+
+  // The image types, each of which is rendered by its own program into a
+  // render target of its own pixel format.
+  enum ImageType {
+    kColor = 0,
+    kDepth32F = 1,
+    kDepth16U = 2,
+    kLabel = 3,
+  };
+  static constexpr int kNumImageTypes = 4;
+
+  // The vertex and element buffers of a mesh. They are shared by all of the
+  // instances of the mesh, in this engine and its clones, and deleted with
+  // the last of them.
+  struct GpuMesh;
+
+  // The shader programs of the image types, shared by this engine and its
+  // clones.
+  struct Programs;
+
+  // The per-instance vertex attributes of a geometry.
+  struct Instance {
+    // The pose X_WG, as a column-major 4x4 matrix.
+    float X_WG[16];
+    // The scale of the mesh along each axis of G.
+    float scale[3];
+    float diffuse[4];
+    int32_t label;
+  };
+
+  // All of the instances of a mesh, which are drawn with a single instanced
+  // draw call. The vertex array and instance buffer belong to this engine
+  // (vertex arrays can't be shared between contexts); they are created, and
+  // the instances uploaded, on demand by the render methods.
+  struct Batch {
+    std::shared_ptr<const GpuMesh> mesh;
+    std::vector<Instance> instances;
+    // The id of the geometry of each instance.
+    std::vector<GeometryId> ids;
+    mutable GLuint vertex_array{0};
+    mutable GLuint instance_buffer{0};
+    // True if the instances have changed since they were last uploaded.
+    mutable bool dirty{true};
+  };
+
+  // The location of a geometry's instance.
+  struct InstanceLocation {
+    Batch* batch{};
+    int index{};
+  };
+
+  // A framebuffer object, with a color buffer of the pixel format of an image
+  // type, and a depth buffer.
+  struct RenderTarget {
+    GLuint frame_buffer{0};
+    GLuint color_buffer{0};
+    GLuint depth_buffer{0};
+  };
+
+  // Adds an instance of the mesh identified by `key` (created by `make_mesh`
+  // if this engine has none yet), scaled by `scale`, for the geometry
+  // described by the RegistrationData `user_data`.
+  void AddInstance(const std::string& key,
+                   const std::function<internal::MeshData()>& make_mesh,
+                   const Eigen::Vector3d& scale, void* user_data);
+
+  // Renders the image of the given type, seen by a camera with the given
+  // intrinsics, into `pixels` (which are in the layout of an Image of that
+  // type). Geometry farther than `z_far` is clipped; for depth images,
+  // geometry closer than `z_near` is reported as too close.
+  void Render(ImageType image_type, const CameraProperties& camera,
+              double z_near, double z_far, void* pixels) const;
+
+  // Returns the render target of the given image type and size, creating it
+  // if needed.
+  const RenderTarget& GetRenderTarget(ImageType image_type, int width,
+                                      int height) const;
+
+  // Creates the vertex array of the given batch if needed, and uploads its
+  // instances if they have changed.
+  void PrepareBatch(const Batch& batch) const;
+
+  // The context is declared first so that it outlives the objects released
+  // by the destructor.
+  std::unique_ptr<internal::OpenGlContext> context_;
+
+  std::shared_ptr<const Programs> programs_;
+
+  // The pose of the world in the camera frame.
+  math::RigidTransformd X_CW_;
+
+  // Obnoxious bright orange.
+  Eigen::Vector4d default_diffuse_{0.9, 0.45, 0.1, 1.0};
+
+  // The color to clear the color buffer to.
+  systems::sensors::ColorD default_clear_color_;
+
+  // The batches, keyed by the name of their mesh: the shape type for the
+  // primitives, and the file name for meshes.
+  std::unordered_map<std::string, Batch> batches_;
+
+  // The location of the instance of each registered geometry.
+  std::unordered_map<GeometryId, InstanceLocation> instances_;
+
+  // The render targets, keyed by (image type, width, height).
+  mutable std::map<std::tuple<int, int, int>, RenderTarget> render_targets_;
+};
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,16 @@
+#include "drake/geometry/render/gl/render_engine_gl_factory.h"
+
+#include "drake/geometry/render/gl/render_engine_gl.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+std::unique_ptr<RenderEngine> MakeRenderEngineGl(
+    const RenderEngineGlParams& params) {
+  return std::make_unique<RenderEngineGl>(params);
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/geometry/render/render_engine.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Construction parameters for the RenderEngineGl.  */
+struct RenderEngineGlParams {
+  /** The (optional) label to apply when none is otherwise specified.  */
+  optional<RenderLabel> default_label{};
+
+  /** The (optional) rgba color to apply to the (phong, diffuse) property when
+    none is otherwise specified.  */
+  optional<Eigen::Vector4d> default_diffuse{};
+
+  /** The rgb color to which the color buffer is cleared (each
+   channel in the range [0, 1]). The default value (in byte values) would be
+   [204, 229, 255].  */
+  Eigen::Vector3d default_clear_color{204 / 255., 229 / 255., 255 / 255.};
+};
+
+/** Constructs a RenderEngine implementation which renders directly with
+ OpenGL 3.3, in a context created with EGL. It requires neither a display
+ server nor VTK, so it suits batch rendering on headless (e.g., GPU server)
+ machines. It is only available on Linux.
+
+ All of the geometries with the same shape (e.g., all of the spheres, or all of
+ the instances of a mesh file) share a single mesh on the GPU, and are drawn
+ with a single instanced draw call. The clones of an engine share those meshes
+ too, but each clone has its own OpenGL context, so that the clones can render
+ in parallel on different threads.
+
+ @anchor render_engine_gl_properties
+ <h2>Geometry perception properties</h2>
+
+ This RenderEngine implementation looks for the following properties when
+ registering visual geometry, categorized by rendered image type.
+
+ <h3>RGB images</h3>
+
+ | Group name | Property Name | Required |  Property Type  | Property Description |
+ | :--------: | :-----------: | :------: | :-------------: | :------------------- |
+ |    phong   | diffuse       | no¹      | Eigen::Vector4d | The rgba value of the object surface. |
+
+ ¹ If no diffuse value is given, a default rgba value will be applied. The
+   default color is a bright orange. This default value can be changed to a
+   different value at construction. <br>
+
+ %RenderEngineGl does not support textures; the `(phong, diffuse_map)`
+ property is ignored. The surfaces are lit by a single light located at the
+ camera. Transparent surfaces are blended in the order they are drawn.
+
+ <h3>Depth images</h3>
+
+ No specific properties required.
+
+ <h3>Label images</h3>
+
+ | Group name | Property Name |   Required    |  Property Type  | Property Description |
+ | :--------: | :-----------: | :-----------: | :-------------: | :------------------- |
+ |   label    | id            | configurable² |  RenderLabel    | The label to render into the image. |
+
+ ² %RenderEngineGl has a default render label value that is applied to any
+ geometry that doesn't have a (label, id) property at registration. If a value
+ is not explicitly specified, %RenderEngineGl uses RenderLabel::kUnspecified
+ as this default value. It can be explicitly set upon construction. The possible
+ values for this default label and the ramifications of that choice are
+ documented @ref render_engine_default_label "here".
+
+ <h3>Geometries accepted by %RenderEngineGl</h3>
+
+ %RenderEngineGl accepts _all_ geometries (assuming the properties pass
+ validation, e.g., render label validation). Mesh and Convex shapes are read
+ from Wavefront .obj files.
+
+ <h3>Windows</h3>
+
+ %RenderEngineGl never opens a window; the `show_window` argument of the
+ render methods is ignored.
+
+ @throws std::runtime_error if no OpenGL 3.3 context can be created with EGL.
+ */
+std::unique_ptr<RenderEngine> MakeRenderEngineGl(
+    const RenderEngineGlParams& params = RenderEngineGlParams());
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,181 @@
+#include "drake/geometry/render/gl/shape_meshes.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+namespace {
+
+using Eigen::Vector3d;
+
+// Accumulates the vertices and triangles of a MeshData.
+class MeshBuilder {
+ public:
+  // Adds a vertex, and returns its index.
+  int AddVertex(const Vector3d& p, const Vector3d& n) {
+    positions_.push_back(p);
+    normals_.push_back(n);
+    return static_cast<int>(positions_.size()) - 1;
+  }
+
+  void AddTriangle(int a, int b, int c) { triangles_.push_back({a, b, c}); }
+
+  // Adds the quad whose corners are the vertices a, b, c and d, in
+  // counterclockwise order.
+  void AddQuad(int a, int b, int c, int d) {
+    AddTriangle(a, b, c);
+    AddTriangle(a, c, d);
+  }
+
+  MeshData Build() const {
+    MeshData mesh;
+    const int num_vertices = static_cast<int>(positions_.size());
+    mesh.positions.resize(num_vertices, 3);
+    mesh.normals.resize(num_vertices, 3);
+    for (int v = 0; v < num_vertices; ++v) {
+      mesh.positions.row(v) = positions_[v].cast<float>().transpose();
+      mesh.normals.row(v) = normals_[v].cast<float>().transpose();
+    }
+    mesh.indices.resize(triangles_.size(), 3);
+    for (int t = 0; t < static_cast<int>(triangles_.size()); ++t) {
+      for (int i = 0; i < 3; ++i) mesh.indices(t, i) = triangles_[t][i];
+    }
+    return mesh;
+  }
+
+ private:
+  std::vector<Vector3d> positions_;
+  std::vector<Vector3d> normals_;
+  std::vector<std::array<int, 3>> triangles_;
+};
+
+// Adds the rectangle centered on `center`, with the normal `n`, whose edges
+// are the vectors `u` and `v` (with u × v in the direction of n).
+void AddRectangle(const Vector3d& center, const Vector3d& n, const Vector3d& u,
+                  const Vector3d& v, MeshBuilder* builder) {
+  const int v0 = builder->AddVertex(center - u / 2 - v / 2, n);
+  const int v1 = builder->AddVertex(center + u / 2 - v / 2, n);
+  const int v2 = builder->AddVertex(center + u / 2 + v / 2, n);
+  const int v3 = builder->AddVertex(center - u / 2 + v / 2, n);
+  builder->AddQuad(v0, v1, v2, v3);
+}
+
+}  // namespace
+
+MeshData MakeLongLatUnitSphere(int num_longitude, int num_latitude) {
+  DRAKE_DEMAND(num_longitude >= 3 && num_latitude >= 2);
+  MeshBuilder builder;
+  // The vertices of the i'th parallel, from the north pole (i = 0) to the south
+  // pole, and of the j'th meridian; the first meridian is repeated at the end,
+  // since it is the seam of the longitude.
+  auto vertex = [num_longitude](int i, int j) {
+    return i * (num_longitude + 1) + j;
+  };
+  for (int i = 0; i <= num_latitude; ++i) {
+    const double theta = M_PI * i / num_latitude;
+    for (int j = 0; j <= num_longitude; ++j) {
+      const double phi = 2 * M_PI * j / num_longitude;
+      const Vector3d p(std::sin(theta) * std::cos(phi),
+                       std::sin(theta) * std::sin(phi), std::cos(theta));
+      builder.AddVertex(p, p);
+    }
+  }
+  // Seen from outside, the parallels go down and the meridians go right; the
+  // triangles touching the poles are those that don't degenerate there.
+  for (int i = 0; i < num_latitude; ++i) {
+    for (int j = 0; j < num_longitude; ++j) {
+      const int a = vertex(i, j);
+      const int b = vertex(i + 1, j);
+      const int c = vertex(i + 1, j + 1);
+      const int d = vertex(i, j + 1);
+      if (i + 1 < num_latitude) builder.AddTriangle(a, b, c);
+      if (i > 0) builder.AddTriangle(a, c, d);
+    }
+  }
+  return builder.Build();
+}
+
+MeshData MakeUnitCylinder(int num_sides) {
+  DRAKE_DEMAND(num_sides >= 3);
+  MeshBuilder builder;
+  // The side, whose first edge is repeated at the end.
+  for (int j = 0; j <= num_sides; ++j) {
+    const double phi = 2 * M_PI * j / num_sides;
+    const Vector3d n(std::cos(phi), std::sin(phi), 0);
+    builder.AddVertex(n + Vector3d(0, 0, 0.5), n);
+    builder.AddVertex(n - Vector3d(0, 0, 0.5), n);
+  }
+  for (int j = 0; j < num_sides; ++j) {
+    builder.AddQuad(2 * j, 2 * j + 1, 2 * j + 3, 2 * j + 2);
+  }
+  // The caps.
+  for (const double z : {0.5, -0.5}) {
+    const Vector3d n(0, 0, z > 0 ? 1 : -1);
+    const int center = builder.AddVertex(Vector3d(0, 0, z), n);
+    for (int j = 0; j < num_sides; ++j) {
+      const double phi = 2 * M_PI * j / num_sides;
+      builder.AddVertex(Vector3d(std::cos(phi), std::sin(phi), z), n);
+    }
+    for (int j = 0; j < num_sides; ++j) {
+      const int v = center + 1 + j;
+      const int next = center + 1 + (j + 1) % num_sides;
+      if (z > 0) {
+        builder.AddTriangle(center, v, next);
+      } else {
+        builder.AddTriangle(center, next, v);
+      }
+    }
+  }
+  return builder.Build();
+}
+
+MeshData MakeUnitBox() {
+  MeshBuilder builder;
+  const Vector3d x = Vector3d::UnitX();
+  const Vector3d y = Vector3d::UnitY();
+  const Vector3d z = Vector3d::UnitZ();
+  AddRectangle(x / 2, x, y, z, &builder);
+  AddRectangle(-x / 2, -x, z, y, &builder);
+  AddRectangle(y / 2, y, z, x, &builder);
+  AddRectangle(-y / 2, -y, x, z, &builder);
+  AddRectangle(z / 2, z, x, y, &builder);
+  AddRectangle(-z / 2, -z, y, x, &builder);
+  return builder.Build();
+}
+
+MeshData MakeSquarePatch(double size) {
+  MeshBuilder builder;
+  AddRectangle(Vector3d::Zero(), Vector3d::UnitZ(), size * Vector3d::UnitX(),
+               size * Vector3d::UnitY(), &builder);
+  return builder.Build();
+}
+
+MeshData LoadMeshFromObj(const std::string& filename) {
+  const SurfaceMesh<double> surface =
+      geometry::internal::ReadObjToSurfaceMesh(filename);
+  MeshBuilder builder;
+  for (SurfaceFaceIndex f(0); f < surface.num_faces(); ++f) {
+    const SurfaceFace& face = surface.element(f);
+    const Vector3d& n = surface.face_normal(f);
+    int v[3];
+    for (int i = 0; i < 3; ++i) {
+      v[i] = builder.AddVertex(surface.vertex(face.vertex(i)).r_MV(), n);
+    }
+    builder.AddTriangle(v[0], v[1], v[2]);
+  }
+  return builder.Build();
+}
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+
+#include <Eigen/Dense>
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+/** The triangle mesh of a shape, in the layout of OpenGL's vertex and element
+ buffers. The triangles are wound counterclockwise when seen from outside
+ (i.e., from the side their normals point to).  */
+struct MeshData {
+  /** The position of each vertex, in the shape's frame, one per row.  */
+  Eigen::Matrix<float, Eigen::Dynamic, 3, Eigen::RowMajor> positions;
+  /** The unit normal at each vertex, in the shape's frame, one per row.  */
+  Eigen::Matrix<float, Eigen::Dynamic, 3, Eigen::RowMajor> normals;
+  /** The indices of the vertices of each triangle, one per row.  */
+  Eigen::Matrix<unsigned int, Eigen::Dynamic, 3, Eigen::RowMajor> indices;
+};
+
+/** Makes a sphere of unit radius, centered on the origin, tessellated into
+ `num_longitude` slices and `num_latitude` stacks.
+ @pre num_longitude >= 3 and num_latitude >= 2.  */
+MeshData MakeLongLatUnitSphere(int num_longitude, int num_latitude);
+
+/** Makes a cylinder of unit radius and unit length, centered on the origin,
+ whose axis is the z axis, with `num_sides` sides. The caps have their own
+ vertices, so that the edges are sharp.
+ @pre num_sides >= 3.  */
+MeshData MakeUnitCylinder(int num_sides);
+
+/** Makes a cube with unit edges, centered on the origin, whose faces are
+ perpendicular to the axes. Each face has its own vertices, so that the edges
+ are sharp.  */
+MeshData MakeUnitBox();
+
+/** Makes a square with edges of the given `size`, centered on the origin, in
+ the z = 0 plane, whose normal is the z axis.  */
+MeshData MakeSquarePatch(double size);
+
+/** Loads the mesh of the given Wavefront .obj file. Each triangle has its own
+ vertices, whose normal is the triangle's normal, so that the mesh is flat
+ shaded (as a VTK renderer shows an .obj file without normals).
+ @throws std::runtime_error if the file can't be read or has no faces.  */
+MeshData LoadMeshFromObj(const std::string& filename);
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
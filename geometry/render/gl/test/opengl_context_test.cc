@@ -0,0 +1,75 @@
+#include "drake/geometry/render/gl/opengl_context.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/render/gl/opengl_includes.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+namespace {
+
+GTEST_TEST(OpenGlContextTest, MakeCurrent) {
+  OpenGlContext context;
+  EXPECT_FALSE(context.IsCurrent());
+  context.MakeCurrent();
+  EXPECT_TRUE(context.IsCurrent());
+  // The context provides (at least) OpenGL 3.3.
+  GLint major = 0;
+  GLint minor = 0;
+  glGetIntegerv(GL_MAJOR_VERSION, &major);
+  glGetIntegerv(GL_MINOR_VERSION, &minor);
+  EXPECT_GE(major * 10 + minor, 33);
+}
+
+// The scoped context is current only within its scope, after which the
+// previous one is current again.
+GTEST_TEST(OpenGlContextTest, ScopedCurrent) {
+  OpenGlContext outer;
+  OpenGlContext inner;
+  {
+    const OpenGlContext::ScopedCurrent outer_current(outer);
+    EXPECT_TRUE(outer.IsCurrent());
+    {
+      const OpenGlContext::ScopedCurrent inner_current(inner);
+      EXPECT_TRUE(inner.IsCurrent());
+      EXPECT_FALSE(outer.IsCurrent());
+    }
+    EXPECT_TRUE(outer.IsCurrent());
+  }
+  EXPECT_FALSE(outer.IsCurrent());
+  EXPECT_FALSE(inner.IsCurrent());
+}
+
+// Objects created in a context are visible in the contexts which share it,
+// including on other threads.
+GTEST_TEST(OpenGlContextTest, SharedObjects) {
+  OpenGlContext context;
+  OpenGlContext shared(&context);
+  GLuint buffer = 0;
+  {
+    const OpenGlContext::ScopedCurrent current(context);
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    const float data[] = {1.f, 2.f, 3.f};
+    glBufferData(GL_ARRAY_BUFFER, sizeof(data), data, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glFinish();
+  }
+  bool is_buffer = false;
+  std::thread thread([&]() {
+    const OpenGlContext::ScopedCurrent current(shared);
+    is_buffer = glIsBuffer(buffer) == GL_TRUE;
+  });
+  thread.join();
+  EXPECT_TRUE(is_buffer);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,401 @@
+#include "drake/geometry/render/gl/render_engine_gl.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/render/camera_properties.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using std::make_unique;
+using std::unique_ptr;
+using std::unordered_map;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+
+// Default camera properties.
+const int kWidth = 640;
+const int kHeight = 480;
+const double kZNear = 0.5;
+const double kZFar = 5.;
+const double kFovY = M_PI_4;
+const bool kShowWindow = false;
+
+// See the explanation of the tolerance in render_engine_vtk_test.cc.
+const double kDepthTolerance = 2e-4;
+const int kColorTolerance = 1;
+
+// Background (sky) color, and the terrain and visual colors.
+const Vector3d kBgColor{254 / 255., 127 / 255., 0.};
+const Vector4d kTerrainColor{0., 0., 0., 1.};
+const Vector4d kVisualColor{229 / 255., 229 / 255., 229 / 255., 1.};
+const double kDefaultDistance{3.};
+
+// The amount inset from the edge of the images to *still* expect ground plane
+// values.
+const int kInset{10};
+
+// The scene of these tests is that of render_engine_vtk_test.cc: a camera
+// looking straight down, from kDefaultDistance meters above the terrain, at an
+// object centered under it.
+class RenderEngineGlTest : public ::testing::Test {
+ public:
+  RenderEngineGlTest()
+      : color_(kWidth, kHeight),
+        depth_(kWidth, kHeight),
+        label_(kWidth, kHeight),
+        X_WC_(RotationMatrixd{AngleAxisd(M_PI, Vector3d::UnitY()) *
+                              AngleAxisd(-M_PI_2, Vector3d::UnitZ())},
+              {0, 0, kDefaultDistance}),
+        geometry_id_(GeometryId::get_new_id()) {}
+
+ protected:
+  void SetUp() override {
+    renderer_ = make_unique<RenderEngineGl>(
+        RenderEngineGlParams{{}, {}, kBgColor});
+    renderer_->UpdateViewpoint(X_WC_);
+  }
+
+  void AddTerrain(RenderEngine* engine) {
+    PerceptionProperties material;
+    material.AddProperty("label", "id", RenderLabel::kDontCare);
+    material.AddProperty("phong", "diffuse", kTerrainColor);
+    engine->RegisterVisual(GeometryId::get_new_id(), HalfSpace(), material,
+                           RigidTransformd::Identity(),
+                           false /* needs update */);
+  }
+
+  PerceptionProperties simple_material(RenderLabel label) const {
+    PerceptionProperties material;
+    material.AddProperty("phong", "diffuse", kVisualColor);
+    material.AddProperty("label", "id", label);
+    return material;
+  }
+
+  // Registers a sphere of radius 0.5 resting on the terrain, under the camera.
+  void AddSphere(RenderEngine* engine) {
+    engine->RegisterVisual(geometry_id_, Sphere(0.5),
+                           simple_material(kSphereLabel),
+                           RigidTransformd::Identity(),
+                           true /* needs update */);
+    engine->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+        {geometry_id_, RigidTransformd{Vector3d{0, 0, 0.5}}}});
+  }
+
+  void Render(const RenderEngine& engine) {
+    engine.RenderColorImage(camera_, kShowWindow, &color_);
+    engine.RenderDepthImage(camera_, &depth_);
+    engine.RenderLabelImage(camera_, kShowWindow, &label_);
+  }
+
+  // Tests the color, depth and label of the given pixel.
+  void ExpectPixel(int x, int y, const Vector4d& color, float depth,
+                   RenderLabel label, const char* name) {
+    for (int c = 0; c < 3; ++c) {
+      EXPECT_NEAR(color_.at(x, y)[c], color(c) * 255, kColorTolerance)
+          << "Color channel " << c << " at (" << x << ", " << y << ") for "
+          << name;
+    }
+    if (std::isinf(depth)) {
+      EXPECT_EQ(depth_.at(x, y)[0], depth) << name;
+    } else {
+      EXPECT_NEAR(depth_.at(x, y)[0], depth, kDepthTolerance) << name;
+    }
+    EXPECT_EQ(label_.at(x, y)[0], label) << name;
+  }
+
+  // Tests that the images show an object of the given depth and label (with
+  // kVisualColor) at their center, and the terrain in their corners.
+  void ExpectCenterShape(float object_depth, RenderLabel label,
+                         const char* name) {
+    ExpectPixel(kWidth / 2, kHeight / 2, kVisualColor, object_depth, label,
+                name);
+    for (const auto& [x, y] :
+         {std::make_pair(kInset, kInset),
+          std::make_pair(kWidth - kInset - 1, kInset),
+          std::make_pair(kInset, kHeight - kInset - 1),
+          std::make_pair(kWidth - kInset - 1, kHeight - kInset - 1)}) {
+      ExpectPixel(x, y, kTerrainColor, kDefaultDistance,
+                  RenderLabel::kDontCare, name);
+    }
+  }
+
+  const RenderLabel kSphereLabel{12345};
+  const DepthCameraProperties camera_ = {kWidth, kHeight, kFovY, "unused",
+                                         kZNear, kZFar};
+  ImageRgba8U color_;
+  ImageDepth32F depth_;
+  ImageLabel16I label_;
+  RigidTransformd X_WC_;
+  GeometryId geometry_id_;
+  unique_ptr<RenderEngineGl> renderer_;
+};
+
+// Tests an empty image -- confirms that it clears to the "empty" values.
+TEST_F(RenderEngineGlTest, NoBodyTest) {
+  Render(*renderer_);
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      ASSERT_EQ(color_.at(x, y)[0], 254);
+      ASSERT_EQ(color_.at(x, y)[1], 127);
+      ASSERT_EQ(color_.at(x, y)[2], 0);
+      ASSERT_EQ(color_.at(x, y)[3], 0);
+      ASSERT_EQ(depth_.at(x, y)[0], std::numeric_limits<float>::infinity());
+      ASSERT_EQ(label_.at(x, y)[0], RenderLabel::kEmpty);
+    }
+  }
+}
+
+TEST_F(RenderEngineGlTest, TerrainTest) {
+  AddTerrain(renderer_.get());
+  Render(*renderer_);
+  ExpectPixel(kWidth / 2, kHeight / 2, kTerrainColor, kDefaultDistance,
+              RenderLabel::kDontCare, "Terrain");
+  EXPECT_EQ(color_.at(0, 0)[3], 255);
+
+  // Beyond z_far, the terrain is too far; closer than z_near, too close.
+  for (const double z : {kZFar + 0.1, kZNear - 0.1}) {
+    renderer_->UpdateViewpoint(RigidTransformd(X_WC_.rotation(), {0, 0, z}));
+    Render(*renderer_);
+    const float expected = z > kZFar ? ImageDepth32F::Traits::kTooFar
+                                     : ImageDepth32F::Traits::kTooClose;
+    EXPECT_EQ(depth_.at(kWidth / 2, kHeight / 2)[0], expected);
+  }
+}
+
+TEST_F(RenderEngineGlTest, SphereTest) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  Render(*renderer_);
+  ExpectCenterShape(2.f, kSphereLabel, "Sphere");
+}
+
+TEST_F(RenderEngineGlTest, BoxTest) {
+  AddTerrain(renderer_.get());
+  // A box 1.5 tall, centered under the camera.
+  const RenderLabel label(2);
+  renderer_->RegisterVisual(GeometryId::get_new_id(), Box(1, 1, 1.5),
+                            simple_material(label),
+                            RigidTransformd{Vector3d{0, 0, 0.75}},
+                            false /* needs update */);
+  Render(*renderer_);
+  ExpectCenterShape(1.5f, label, "Box");
+}
+
+TEST_F(RenderEngineGlTest, CylinderTest) {
+  AddTerrain(renderer_.get());
+  const RenderLabel label(3);
+  renderer_->RegisterVisual(GeometryId::get_new_id(), Cylinder(0.2, 1.2),
+                            simple_material(label),
+                            RigidTransformd{Vector3d{0, 0, 0.6}},
+                            false /* needs update */);
+  Render(*renderer_);
+  ExpectCenterShape(1.8f, label, "Cylinder");
+}
+
+TEST_F(RenderEngineGlTest, MeshTest) {
+  AddTerrain(renderer_.get());
+  // The box of box.obj has edges of length 2; scaling it by 0.5 places its top
+  // face 1 above the terrain.
+  const std::string filename =
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.obj");
+  const RenderLabel label(4);
+  renderer_->RegisterVisual(GeometryId::get_new_id(), Mesh(filename, 0.5),
+                            simple_material(label),
+                            RigidTransformd{Vector3d{0, 0, 0.5}},
+                            false /* needs update */);
+  Render(*renderer_);
+  ExpectCenterShape(2.f, label, "Mesh");
+}
+
+// Confirms that the rows of the image are not flipped: the camera's y axis
+// (down in the image) is the world's -x axis.
+TEST_F(RenderEngineGlTest, ImageOrientation) {
+  AddTerrain(renderer_.get());
+  const RenderLabel label(5);
+  renderer_->RegisterVisual(GeometryId::get_new_id(), Box(0.2, 0.2, 0.2),
+                            simple_material(label),
+                            RigidTransformd{Vector3d{0.5, 0, 0.1}},
+                            false /* needs update */);
+  Render(*renderer_);
+  // The box projects 0.5 / 2.8 of the focal length above the image center.
+  const double focal = kHeight / 2 / std::tan(kFovY / 2);
+  const int y = static_cast<int>(kHeight / 2 - 0.5 / 2.8 * focal);
+  EXPECT_EQ(label_.at(kWidth / 2, y)[0], label);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight - 1 - y)[0], RenderLabel::kDontCare);
+}
+
+TEST_F(RenderEngineGlTest, Depth16UTest) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  ImageDepth16U depth16(kWidth, kHeight);
+  renderer_->RenderDepthImage(camera_, &depth16);
+  EXPECT_NEAR(depth16.at(kWidth / 2, kHeight / 2)[0], 2000, 1);
+  EXPECT_NEAR(depth16.at(kInset, kInset)[0], 3000, 1);
+
+  renderer_->UpdateViewpoint(RigidTransformd(X_WC_.rotation(), {0, 0, 100}));
+  renderer_->RenderDepthImage(camera_, &depth16);
+  EXPECT_EQ(depth16.at(kWidth / 2, kHeight / 2)[0],
+            ImageDepth16U::Traits::kTooFar);
+}
+
+// Geometries with the "do not render" label are drawn in the color and depth
+// images, but not in the label image.
+TEST_F(RenderEngineGlTest, DoNotRenderLabel) {
+  AddTerrain(renderer_.get());
+  renderer_->RegisterVisual(geometry_id_, Sphere(0.5),
+                            simple_material(RenderLabel::kDoNotRender),
+                            RigidTransformd{Vector3d{0, 0, 0.5}},
+                            false /* needs update */);
+  Render(*renderer_);
+  ExpectPixel(kWidth / 2, kHeight / 2, kVisualColor, 2.f,
+              RenderLabel::kDontCare, "Do not render");
+}
+
+// Many instances of the same shape, with their own poses, colors and labels.
+TEST_F(RenderEngineGlTest, ManyInstances) {
+  AddTerrain(renderer_.get());
+  // A 5x5 grid of boxes, each with its own label.
+  const double kSpacing = 0.3;
+  unordered_map<GeometryId, RigidTransformd> poses;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      const GeometryId id = GeometryId::get_new_id();
+      renderer_->RegisterVisual(id, Box(0.1, 0.1, 0.1),
+                                simple_material(RenderLabel(10 * i + j)),
+                                RigidTransformd::Identity(),
+                                true /* needs update */);
+      poses[id] = RigidTransformd{
+          Vector3d{(i - 2) * kSpacing, (j - 2) * kSpacing, 0.05}};
+    }
+  }
+  renderer_->UpdatePoses(poses);
+  Render(*renderer_);
+  // The camera's x axis is the world's -y axis and its y axis the world's -x
+  // axis.
+  const double focal = kHeight / 2 / std::tan(kFovY / 2);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      const int x = static_cast<int>(
+          std::round(kWidth / 2 - (j - 2) * kSpacing / 2.9 * focal));
+      const int y = static_cast<int>(
+          std::round(kHeight / 2 - (i - 2) * kSpacing / 2.9 * focal));
+      EXPECT_EQ(label_.at(x, y)[0], 10 * i + j);
+      EXPECT_NEAR(depth_.at(x, y)[0], 2.9, kDepthTolerance);
+    }
+  }
+}
+
+TEST_F(RenderEngineGlTest, RemoveVisual) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  // A second sphere, whose instance takes the place of the first one when the
+  // first is removed.
+  const GeometryId id2 = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id2, Sphere(0.5), simple_material(RenderLabel(7)),
+                            RigidTransformd{Vector3d{10, 10, 0.5}},
+                            true /* needs update */);
+  EXPECT_TRUE(renderer_->RemoveGeometry(geometry_id_));
+  EXPECT_FALSE(renderer_->RemoveGeometry(geometry_id_));
+  Render(*renderer_);
+  ExpectPixel(kWidth / 2, kHeight / 2, kTerrainColor, kDefaultDistance,
+              RenderLabel::kDontCare, "Removed");
+
+  // The remaining sphere can still be moved.
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {id2, RigidTransformd{Vector3d{0, 0, 0.5}}}});
+  Render(*renderer_);
+  ExpectCenterShape(2.f, RenderLabel(7), "Remaining");
+}
+
+TEST_F(RenderEngineGlTest, SimpleClone) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  Render(*renderer_);
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  EXPECT_NE(dynamic_cast<RenderEngineGl*>(clone.get()), nullptr);
+  Render(*clone);
+  ExpectCenterShape(2.f, kSphereLabel, "Simple clone");
+}
+
+// Tests that the cloned renderer still works, even when the original is
+// deleted, and that it is independent of the original.
+TEST_F(RenderEngineGlTest, ClonePersistenceAndIndependence) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {geometry_id_, RigidTransformd{Vector3d{0, 0, 10}}}});
+  Render(*clone);
+  ExpectCenterShape(2.f, kSphereLabel, "Clone independence");
+
+  renderer_.reset();
+  // The clone's new geometries use the meshes it shares.
+  clone->RegisterVisual(GeometryId::get_new_id(), Sphere(0.1),
+                        simple_material(RenderLabel(8)),
+                        RigidTransformd{Vector3d{0, 0, 1.5}},
+                        false /* needs update */);
+  Render(*clone);
+  ExpectCenterShape(1.4f, RenderLabel(8), "Clone persistence");
+}
+
+// Clones render in parallel, each on its own thread with its own context.
+TEST_F(RenderEngineGlTest, ParallelClones) {
+  AddTerrain(renderer_.get());
+  AddSphere(renderer_.get());
+  const int kNumThreads = 4;
+  std::vector<unique_ptr<RenderEngine>> clones;
+  for (int i = 0; i < kNumThreads; ++i) clones.push_back(renderer_->Clone());
+  std::vector<ImageDepth32F> depths(kNumThreads, ImageDepth32F(kWidth,
+                                                               kHeight));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this, &clones, &depths, i]() {
+      for (int k = 0; k < 10; ++k) {
+        clones[i]->RenderDepthImage(camera_, &depths[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (const auto& depth : depths) {
+    EXPECT_NEAR(depth.at(kWidth / 2, kHeight / 2)[0], 2.f, kDepthTolerance);
+  }
+}
+
+TEST_F(RenderEngineGlTest, BadMesh) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer_->RegisterVisual(GeometryId::get_new_id(),
+                                Mesh("no_such_file.obj"),
+                                simple_material(RenderLabel(1)),
+                                RigidTransformd::Identity(), false),
+      std::runtime_error, ".*no_such_file.obj.*");
+  // The failed registration leaves the engine usable.
+  Render(*renderer_);
+}
+
+}  // namespace
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
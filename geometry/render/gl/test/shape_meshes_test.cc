@@ -0,0 +1,90 @@
+#include "drake/geometry/render/gl/shape_meshes.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+namespace {
+
+using Eigen::Vector3f;
+
+// Tests that every vertex index is valid, that the normals are unit vectors,
+// and that each triangle is wound counterclockwise when seen from the side its
+// vertices' normals point to.
+void ExpectWellFormed(const MeshData& mesh) {
+  const int num_vertices = mesh.positions.rows();
+  ASSERT_EQ(mesh.normals.rows(), num_vertices);
+  ASSERT_GT(mesh.indices.rows(), 0);
+  for (int v = 0; v < num_vertices; ++v) {
+    EXPECT_NEAR(mesh.normals.row(v).norm(), 1, 1e-6);
+  }
+  for (int t = 0; t < mesh.indices.rows(); ++t) {
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_LT(mesh.indices(t, i), static_cast<unsigned>(num_vertices));
+    }
+    const Vector3f p0 = mesh.positions.row(mesh.indices(t, 0));
+    const Vector3f p1 = mesh.positions.row(mesh.indices(t, 1));
+    const Vector3f p2 = mesh.positions.row(mesh.indices(t, 2));
+    const Vector3f face_normal = (p1 - p0).cross(p2 - p0);
+    const Vector3f vertex_normal = mesh.normals.row(mesh.indices(t, 0));
+    EXPECT_GT(face_normal.dot(vertex_normal), 0) << "Triangle " << t;
+  }
+}
+
+GTEST_TEST(ShapeMeshesTest, Sphere) {
+  const MeshData mesh = MakeLongLatUnitSphere(10, 5);
+  ExpectWellFormed(mesh);
+  for (int v = 0; v < mesh.positions.rows(); ++v) {
+    EXPECT_NEAR(mesh.positions.row(v).norm(), 1, 1e-6);
+  }
+  // Two triangles per quad, except at the poles.
+  EXPECT_EQ(mesh.indices.rows(), 2 * 10 * 5 - 2 * 10);
+}
+
+GTEST_TEST(ShapeMeshesTest, Cylinder) {
+  const MeshData mesh = MakeUnitCylinder(8);
+  ExpectWellFormed(mesh);
+  EXPECT_NEAR(mesh.positions.col(2).maxCoeff(), 0.5, 1e-6);
+  EXPECT_NEAR(mesh.positions.col(2).minCoeff(), -0.5, 1e-6);
+  // The side, and the fan of each cap.
+  EXPECT_EQ(mesh.indices.rows(), 2 * 8 + 2 * 8);
+}
+
+GTEST_TEST(ShapeMeshesTest, Box) {
+  const MeshData mesh = MakeUnitBox();
+  ExpectWellFormed(mesh);
+  EXPECT_EQ(mesh.positions.rows(), 24);
+  EXPECT_EQ(mesh.indices.rows(), 12);
+  EXPECT_NEAR(mesh.positions.cwiseAbs().maxCoeff(), 0.5, 1e-6);
+}
+
+GTEST_TEST(ShapeMeshesTest, SquarePatch) {
+  const MeshData mesh = MakeSquarePatch(4);
+  ExpectWellFormed(mesh);
+  EXPECT_EQ(mesh.indices.rows(), 2);
+  EXPECT_NEAR(mesh.positions.col(0).maxCoeff(), 2, 1e-6);
+  EXPECT_EQ(mesh.positions.col(2).cwiseAbs().maxCoeff(), 0);
+}
+
+GTEST_TEST(ShapeMeshesTest, Obj) {
+  const MeshData mesh = LoadMeshFromObj(
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.obj"));
+  ExpectWellFormed(mesh);
+  // Each triangle has its own vertices.
+  EXPECT_EQ(mesh.indices.rows(), 12);
+  EXPECT_EQ(mesh.positions.rows(), 36);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(LoadMeshFromObj("no_such_file.obj"),
+                              std::runtime_error, ".*no_such_file.obj.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
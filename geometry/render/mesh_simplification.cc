@@ -0,0 +1,433 @@
+#include "drake/geometry/render/mesh_simplification.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <Eigen/Dense>
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_optional.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::Matrix4d;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+
+// The weight of the planes that constrain the boundary edges, relative to
+// those of the triangles.
+const double kBoundaryWeight = 1000.;
+
+// Returns the quadric whose error at x is the squared distance from x to the
+// plane n·x + d = 0 (with n a unit vector), scaled by `weight`.
+Matrix4d PlaneQuadric(const Vector3d& n, double d, double weight) {
+  Vector4d p;
+  p << n, d;
+  return weight * p * p.transpose();
+}
+
+double QuadricError(const Matrix4d& Q, const Vector3d& x) {
+  const Vector4d v(x.x(), x.y(), x.z(), 1.);
+  return v.dot(Q * v);
+}
+
+// The (unnormalized) normal of the triangle abc.
+Vector3d TriangleNormal(const Vector3d& a, const Vector3d& b,
+                        const Vector3d& c) {
+  return (b - a).cross(c - a);
+}
+
+// Simplifies a mesh by collapsing its edges in the order of their quadric
+// error. The vertices and triangles are never erased, only marked as dead, so
+// that their indices stay valid; each vertex has a stamp that changes with
+// it, which invalidates the queued collapses of its edges.
+class Simplifier {
+ public:
+  explicit Simplifier(const SurfaceMesh<double>& mesh)
+      : positions_(mesh.num_vertices()),
+        quadrics_(mesh.num_vertices(), Matrix4d::Zero()),
+        stamps_(mesh.num_vertices(), 0),
+        vertex_alive_(mesh.num_vertices(), true),
+        faces_(mesh.num_faces()),
+        face_alive_(mesh.num_faces(), true),
+        vertex_faces_(mesh.num_vertices()),
+        num_faces_(mesh.num_faces()) {
+    for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+      positions_[v] = mesh.vertex(v).r_MV();
+    }
+    // The number of triangles of each edge (a, b), with a < b.
+    std::map<std::pair<int, int>, int> edge_face_counts;
+    for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+      for (int i = 0; i < 3; ++i) {
+        faces_[f][i] = mesh.element(f).vertex(i);
+        vertex_faces_[faces_[f][i]].push_back(f);
+      }
+      const Vector3d& n = mesh.face_normal(f);
+      const double d = -n.dot(positions_[faces_[f][0]]);
+      const Matrix4d K = PlaneQuadric(n, d, mesh.area(f));
+      for (int i = 0; i < 3; ++i) {
+        quadrics_[faces_[f][i]] += K;
+        const int a = faces_[f][i];
+        const int b = faces_[f][(i + 1) % 3];
+        ++edge_face_counts[std::minmax(a, b)];
+      }
+    }
+    // Each boundary edge is kept in place by the plane through it that is
+    // perpendicular to its triangle.
+    for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+      for (int i = 0; i < 3; ++i) {
+        const int a = faces_[f][i];
+        const int b = faces_[f][(i + 1) % 3];
+        if (edge_face_counts.at(std::minmax(a, b)) != 1) continue;
+        const Vector3d edge = positions_[b] - positions_[a];
+        const Vector3d n = edge.cross(mesh.face_normal(f));
+        if (n.norm() == 0) continue;
+        const Vector3d n_hat = n.normalized();
+        const Matrix4d K =
+            PlaneQuadric(n_hat, -n_hat.dot(positions_[a]),
+                         kBoundaryWeight * edge.squaredNorm());
+        quadrics_[a] += K;
+        quadrics_[b] += K;
+      }
+    }
+    for (const auto& edge_count : edge_face_counts) {
+      PushCollapse(edge_count.first.first, edge_count.first.second);
+    }
+  }
+
+  void Simplify(int target_num_faces) {
+    while (num_faces_ > target_num_faces && !queue_.empty()) {
+      const Collapse c = queue_.top();
+      queue_.pop();
+      if (!vertex_alive_[c.u] || !vertex_alive_[c.v] ||
+          stamps_[c.u] != c.stamp_u || stamps_[c.v] != c.stamp_v) {
+        continue;
+      }
+      if (!IsCollapsible(c.u, c.v, c.p)) continue;
+      DoCollapse(c.u, c.v, c.p);
+    }
+  }
+
+  // Returns the mesh of the live triangles and of their vertices.
+  SurfaceMesh<double> Build() const {
+    std::vector<int> new_index(positions_.size(), -1);
+    std::vector<SurfaceVertex<double>> vertices;
+    std::vector<SurfaceFace> faces;
+    for (int f = 0; f < static_cast<int>(faces_.size()); ++f) {
+      if (!face_alive_[f]) continue;
+      int v[3];
+      for (int i = 0; i < 3; ++i) {
+        int& index = new_index[faces_[f][i]];
+        if (index < 0) {
+          index = static_cast<int>(vertices.size());
+          vertices.emplace_back(positions_[faces_[f][i]]);
+        }
+        v[i] = index;
+      }
+      faces.emplace_back(v);
+    }
+    return SurfaceMesh<double>(std::move(faces), std::move(vertices));
+  }
+
+ private:
+  // The collapse of the edge (u, v) into the point p.
+  struct Collapse {
+    double cost{};
+    int u{};
+    int v{};
+    int stamp_u{};
+    int stamp_v{};
+    Vector3d p;
+  };
+
+  // Orders the queue so that the cheapest collapse is on top.
+  struct CostlierThan {
+    bool operator()(const Collapse& a, const Collapse& b) const {
+      return a.cost > b.cost;
+    }
+  };
+
+  // Queues the collapse of the edge (u, v) into the point that minimizes the
+  // sum of their quadrics. If that point isn't well defined (e.g., on a flat
+  // patch), or is far from the edge, the best of the edge's end points and
+  // midpoint is used instead.
+  void PushCollapse(int u, int v) {
+    const Matrix4d Q = quadrics_[u] + quadrics_[v];
+    const Vector3d& p_u = positions_[u];
+    const Vector3d& p_v = positions_[v];
+    const Vector3d midpoint = (p_u + p_v) / 2;
+    Collapse c{0., u, v, stamps_[u], stamps_[v], midpoint};
+
+    Eigen::FullPivLU<Matrix3d> lu(Q.topLeftCorner<3, 3>());
+    lu.setThreshold(1e-8);
+    bool solved = false;
+    if (lu.isInvertible()) {
+      const Vector3d p = lu.solve(-Q.topRightCorner<3, 1>());
+      if ((p - midpoint).norm() <= (p_u - p_v).norm()) {
+        c.p = p;
+        solved = true;
+      }
+    }
+    if (!solved) {
+      for (const Vector3d& p : {p_u, p_v}) {
+        if (QuadricError(Q, p) < QuadricError(Q, c.p)) c.p = p;
+      }
+    }
+    c.cost = QuadricError(Q, c.p);
+    queue_.push(c);
+  }
+
+  // Returns the (sorted) vertices that share a live triangle with `u`.
+  std::vector<int> Neighbors(int u) const {
+    std::vector<int> neighbors;
+    for (int f : vertex_faces_[u]) {
+      for (int w : faces_[f]) {
+        if (w != u) neighbors.push_back(w);
+      }
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+    return neighbors;
+  }
+
+  bool FaceHasVertex(int f, int w) const {
+    return faces_[f][0] == w || faces_[f][1] == w || faces_[f][2] == w;
+  }
+
+  // Returns true if collapsing the edge (u, v) into p keeps the surface a
+  // manifold of the same topology, without flipping or duplicating any
+  // triangle.
+  bool IsCollapsible(int u, int v, const Vector3d& p) const {
+    // The link condition: the vertices adjacent to both u and v must be those
+    // of the triangles of the edge.
+    int num_edge_faces = 0;
+    for (int f : vertex_faces_[u]) {
+      if (FaceHasVertex(f, v)) ++num_edge_faces;
+    }
+    if (num_edge_faces == 0) return false;
+    const std::vector<int> neighbors_u = Neighbors(u);
+    const std::vector<int> neighbors_v = Neighbors(v);
+    std::vector<int> common;
+    std::set_intersection(neighbors_u.begin(), neighbors_u.end(),
+                          neighbors_v.begin(), neighbors_v.end(),
+                          std::back_inserter(common));
+    if (static_cast<int>(common.size()) != num_edge_faces) return false;
+
+    // The triangles that survive the collapse must keep their orientation.
+    for (int moved : {u, v}) {
+      const int other = moved == u ? v : u;
+      for (int f : vertex_faces_[moved]) {
+        if (FaceHasVertex(f, other)) continue;
+        std::array<Vector3d, 3> corners;
+        for (int i = 0; i < 3; ++i) corners[i] = positions_[faces_[f][i]];
+        const Vector3d n_old = TriangleNormal(corners[0], corners[1],
+                                              corners[2]);
+        for (int i = 0; i < 3; ++i) {
+          if (faces_[f][i] == moved) corners[i] = p;
+        }
+        const Vector3d n_new = TriangleNormal(corners[0], corners[1],
+                                              corners[2]);
+        if (n_new.dot(n_old) <= 0) return false;
+      }
+    }
+
+    // No triangle of v may become a copy of a triangle of u (as happens when
+    // collapsing an edge of a tetrahedron).
+    for (int f : vertex_faces_[v]) {
+      if (FaceHasVertex(f, u)) continue;
+      for (int g : vertex_faces_[u]) {
+        if (FaceHasVertex(g, v)) continue;
+        int num_shared = 0;
+        for (int w : faces_[f]) {
+          if (w != v && FaceHasVertex(g, w)) ++num_shared;
+        }
+        if (num_shared == 2) return false;
+      }
+    }
+    return true;
+  }
+
+  // Merges v into u, at the point p.
+  void DoCollapse(int u, int v, const Vector3d& p) {
+    auto remove_face = [this](int w, int f) {
+      auto& faces = vertex_faces_[w];
+      faces.erase(std::find(faces.begin(), faces.end(), f));
+    };
+    for (int f : vertex_faces_[v]) {
+      if (FaceHasVertex(f, u)) {
+        face_alive_[f] = false;
+        --num_faces_;
+        for (int w : faces_[f]) {
+          if (w != v) remove_face(w, f);
+        }
+      } else {
+        for (int& w : faces_[f]) {
+          if (w == v) w = u;
+        }
+        vertex_faces_[u].push_back(f);
+      }
+    }
+    vertex_faces_[v].clear();
+    vertex_alive_[v] = false;
+
+    positions_[u] = p;
+    quadrics_[u] += quadrics_[v];
+    ++stamps_[u];
+    for (int w : Neighbors(u)) {
+      PushCollapse(u, w);
+    }
+  }
+
+  std::vector<Vector3d> positions_;
+  std::vector<Matrix4d> quadrics_;
+  std::vector<int> stamps_;
+  std::vector<bool> vertex_alive_;
+  std::vector<std::array<int, 3>> faces_;
+  std::vector<bool> face_alive_;
+  // The live triangles of each vertex.
+  std::vector<std::vector<int>> vertex_faces_;
+  int num_faces_{};
+  std::priority_queue<Collapse, std::vector<Collapse>, CostlierThan> queue_;
+};
+
+// Returns the modification time of the file, or nullopt if it doesn't exist.
+optional<int64_t> ModificationTime(const std::string& filename) {
+  struct stat attributes;
+  if (stat(filename.c_str(), &attributes) != 0) return nullopt;
+  return static_cast<int64_t>(attributes.st_mtime);
+}
+
+// Returns the name of the file of the k'th level of detail of `filename`.
+std::string LevelFileName(const std::string& filename, int k) {
+  const size_t last_dot = filename.find_last_of('.');
+  const size_t last_slash = filename.find_last_of('/');
+  const bool has_extension =
+      last_dot != std::string::npos &&
+      (last_slash == std::string::npos || last_dot > last_slash);
+  const std::string stem =
+      has_extension ? filename.substr(0, last_dot) : filename;
+  return fmt::format("{}.lod{}.obj", stem, k);
+}
+
+// Returns the k'th level of detail of `filename` saved by an earlier process,
+// if it is still valid.
+optional<SurfaceMesh<double>> ReadLevel(const std::string& filename,
+                                        int64_t source_time, int k,
+                                        const std::string& comment) {
+  const std::string level_name = LevelFileName(filename, k);
+  const optional<int64_t> level_time = ModificationTime(level_name);
+  if (!level_time || *level_time < source_time) return nullopt;
+  std::ifstream file(level_name);
+  std::string first_line;
+  if (!std::getline(file, first_line) || first_line != "# " + comment) {
+    return nullopt;
+  }
+  try {
+    return geometry::internal::ReadObjToSurfaceMesh(level_name);
+  } catch (const std::exception&) {
+    return nullopt;
+  }
+}
+
+}  // namespace
+
+SurfaceMesh<double> SimplifyMesh(const SurfaceMesh<double>& mesh,
+                                 int target_num_faces) {
+  DRAKE_DEMAND(target_num_faces >= 0);
+  Simplifier simplifier(mesh);
+  simplifier.Simplify(target_num_faces);
+  return simplifier.Build();
+}
+
+bool WriteObj(const SurfaceMesh<double>& mesh, const std::string& comment,
+              const std::string& filename) {
+  std::ofstream file(filename);
+  if (!file) return false;
+  file << "# " << comment << "\n";
+  for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+    const Vector3d& p = mesh.vertex(v).r_MV();
+    file << fmt::format("v {} {} {}\n", p.x(), p.y(), p.z());
+  }
+  // OBJ indices start at 1.
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    const SurfaceFace& face = mesh.element(f);
+    file << fmt::format("f {} {} {}\n", face.vertex(0) + 1,
+                        face.vertex(1) + 1, face.vertex(2) + 1);
+  }
+  file.close();
+  return static_cast<bool>(file);
+}
+
+std::shared_ptr<const std::vector<SurfaceMesh<double>>> LoadMeshLevelsOfDetail(
+    const std::string& filename, int num_levels, double reduction) {
+  DRAKE_DEMAND(num_levels >= 0);
+  DRAKE_DEMAND(reduction > 0 && reduction < 1);
+  const optional<int64_t> source_time = ModificationTime(filename);
+  if (!source_time) {
+    throw std::runtime_error(
+        fmt::format("Cannot simplify the mesh '{}'; it doesn't exist",
+                    filename));
+  }
+
+  using Key = std::tuple<std::string, int, double, int64_t>;
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<
+      std::map<Key, std::shared_ptr<const std::vector<SurfaceMesh<double>>>>>
+      cache;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  const Key key{filename, num_levels, reduction, *source_time};
+  auto iter = cache.access().find(key);
+  if (iter != cache.access().end()) return iter->second;
+
+  auto levels = std::make_shared<std::vector<SurfaceMesh<double>>>();
+  // The finest mesh is only read if a level has to be computed.
+  optional<SurfaceMesh<double>> finest;
+  for (int k = 1; k <= num_levels; ++k) {
+    const std::string comment = fmt::format(
+        "Drake level of detail {} of {} with reduction {}", k, filename,
+        reduction);
+    optional<SurfaceMesh<double>> level =
+        ReadLevel(filename, *source_time, k, comment);
+    if (!level) {
+      if (!finest) {
+        finest = geometry::internal::ReadObjToSurfaceMesh(filename);
+      }
+      const SurfaceMesh<double>& previous =
+          levels->empty() ? *finest : levels->back();
+      const int target = static_cast<int>(
+          std::ceil(previous.num_faces() * reduction));
+      level = SimplifyMesh(previous, target);
+      if (level->num_faces() >= previous.num_faces()) break;
+      WriteObj(*level, comment, LevelFileName(filename, k));
+    }
+    levels->push_back(std::move(*level));
+  }
+  cache.access()[key] = levels;
+  return levels;
+}
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
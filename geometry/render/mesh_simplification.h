@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drake/geometry/proximity/surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+/** Simplifies the triangle `mesh` down to at most `target_num_faces`
+ triangles, by repeatedly collapsing the edge whose collapse changes the
+ surface the least, as measured by the quadric error metric of Garland and
+ Heckbert ("Surface Simplification Using Quadric Error Metrics", SIGGRAPH
+ 1997). The two vertices of a collapsed edge are merged into the point that
+ minimizes the metric. Collapses that would flip a triangle or change the
+ topology of the surface are skipped, so the result may have more than
+ `target_num_faces` triangles if no other edge can be collapsed. The edges of
+ the boundary of an open mesh are constrained to keep its outline.
+ @pre target_num_faces >= 0.  */
+SurfaceMesh<double> SimplifyMesh(const SurfaceMesh<double>& mesh,
+                                 int target_num_faces);
+
+/** Writes the vertices and triangles of `mesh` to the OBJ file `filename`,
+ preceded by the comment line `# <comment>`.
+ @returns false if the file could not be written.  */
+bool WriteObj(const SurfaceMesh<double>& mesh, const std::string& comment,
+              const std::string& filename);
+
+/** Returns the levels of detail of the mesh in the OBJ file `filename`, from
+ the finest to the coarsest: each of the `num_levels` levels is simplified
+ by SimplifyMesh() from the previous one (the first, from the file's mesh)
+ down to `reduction` times as many triangles. There are fewer levels if the
+ mesh can't be simplified that far.
+
+ Since simplification is expensive, the levels of each file are computed once
+ per process, and saved next to the file as `<file stem>.lod<k>.obj` to be
+ loaded by later processes. A saved level is only loaded if it is newer than
+ `filename` and was made with the same `reduction`. Failing to save the
+ levels (e.g., in a read-only directory) is not an error.
+ @throws std::runtime_error if `filename` can't be read.
+ @pre num_levels >= 0 and 0 < reduction < 1.  */
+std::shared_ptr<const std::vector<SurfaceMesh<double>>> LoadMeshLevelsOfDetail(
+    const std::string& filename, int num_levels, double reduction);
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
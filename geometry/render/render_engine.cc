@@ -1,10 +1,57 @@
 #include "drake/geometry/render/render_engine.h"
 
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
 namespace drake {
 namespace geometry {
 namespace render {
 
 using math::RigidTransformd;
+using std::vector;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+
+namespace internal {
+
+uint16_t ConvertDepth32FTo16U(float depth) {
+  const float kOverflowDistance =
+      std::numeric_limits<uint16_t>::max() / 1000.;
+  // N.B. This comparison also maps NaN to kTooFar.
+  if (!(depth < kOverflowDistance)) return ImageDepth16U::Traits::kTooFar;
+  return static_cast<uint16_t>(static_cast<double>(depth) * 1000);
+}
+
+}  // namespace internal
+
+namespace {
+
+// Confirms that the inputs of one of the batched render methods are
+// consistent.
+template <typename Camera, typename Image>
+void ValidateBatch(const char* method, const vector<Camera>& cameras,
+                   const vector<RigidTransformd>& X_WCs,
+                   const vector<Image*>& images_out) {
+  if (cameras.size() != X_WCs.size() || cameras.size() != images_out.size()) {
+    throw std::logic_error(fmt::format(
+        "RenderEngine::{}(): the number of cameras ({}), poses ({}) and "
+        "output images ({}) must be the same",
+        method, cameras.size(), X_WCs.size(), images_out.size()));
+  }
+  for (size_t i = 0; i < images_out.size(); ++i) {
+    if (images_out[i] == nullptr) {
+      throw std::logic_error(fmt::format(
+          "RenderEngine::{}(): the output image {} is null", method, i));
+    }
+  }
+}
+
+}  // namespace
 
 std::unique_ptr<RenderEngine> RenderEngine::Clone() const {
   return std::unique_ptr<RenderEngine>(DoClone());
@@ -42,6 +89,112 @@ bool RenderEngine::has_geometry(GeometryId id) const {
   return update_ids_.count(id) > 0 || anchored_ids_.count(id) > 0;
 }
 
+void RenderEngine::RenderDepthImage(const DepthCameraProperties& camera,
+                                    ImageDepth16U* depth_image_out) const {
+  ImageDepth32F depth32(camera.width, camera.height);
+  RenderDepthImage(camera, &depth32);
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      depth_image_out->at(u, v)[0] =
+          internal::ConvertDepth32FTo16U(depth32.at(u, v)[0]);
+    }
+  }
+}
+
+void RenderEngine::RenderColorImages(
+    const vector<CameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageRgba8U*>& color_images_out) {
+  ValidateBatch("RenderColorImages", cameras, X_WCs, color_images_out);
+  if (cameras.empty()) return;
+  DoRenderColorImages(cameras, X_WCs, color_images_out);
+}
+
+void RenderEngine::RenderDepthImages(
+    const vector<DepthCameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageDepth32F*>& depth_images_out) {
+  ValidateBatch("RenderDepthImages", cameras, X_WCs, depth_images_out);
+  if (cameras.empty()) return;
+  DoRenderDepthImages(cameras, X_WCs, depth_images_out);
+}
+
+void RenderEngine::RenderLabelImages(
+    const vector<CameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageLabel16I*>& label_images_out) {
+  ValidateBatch("RenderLabelImages", cameras, X_WCs, label_images_out);
+  if (cameras.empty()) return;
+  DoRenderLabelImages(cameras, X_WCs, label_images_out);
+}
+
+void RenderEngine::RenderImages(const CameraProperties& color_camera,
+                                const RigidTransformd& X_WC,
+                                const DepthCameraProperties& depth_camera,
+                                const RigidTransformd& X_WD,
+                                ImageRgba8U* color_image_out,
+                                ImageDepth32F* depth_image_out,
+                                ImageLabel16I* label_image_out) {
+  if (color_image_out == nullptr && depth_image_out == nullptr &&
+      label_image_out == nullptr) {
+    return;
+  }
+  DoRenderImages(color_camera, X_WC, depth_camera, X_WD, color_image_out,
+                 depth_image_out, label_image_out);
+}
+
+void RenderEngine::DoRenderColorImages(
+    const vector<CameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageRgba8U*>& color_images_out) {
+  for (size_t i = 0; i < cameras.size(); ++i) {
+    UpdateViewpoint(X_WCs[i]);
+    RenderColorImage(cameras[i], false /* show_window */, color_images_out[i]);
+  }
+}
+
+void RenderEngine::DoRenderDepthImages(
+    const vector<DepthCameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageDepth32F*>& depth_images_out) {
+  for (size_t i = 0; i < cameras.size(); ++i) {
+    UpdateViewpoint(X_WCs[i]);
+    RenderDepthImage(cameras[i], depth_images_out[i]);
+  }
+}
+
+void RenderEngine::DoRenderLabelImages(
+    const vector<CameraProperties>& cameras,
+    const vector<RigidTransformd>& X_WCs,
+    const vector<ImageLabel16I*>& label_images_out) {
+  for (size_t i = 0; i < cameras.size(); ++i) {
+    UpdateViewpoint(X_WCs[i]);
+    RenderLabelImage(cameras[i], false /* show_window */, label_images_out[i]);
+  }
+}
+
+void RenderEngine::DoRenderImages(const CameraProperties& color_camera,
+                                  const RigidTransformd& X_WC,
+                                  const DepthCameraProperties& depth_camera,
+                                  const RigidTransformd& X_WD,
+                                  ImageRgba8U* color_image_out,
+                                  ImageDepth32F* depth_image_out,
+                                  ImageLabel16I* label_image_out) {
+  if (color_image_out != nullptr || label_image_out != nullptr) {
+    UpdateViewpoint(X_WC);
+    if (color_image_out != nullptr) {
+      RenderColorImage(color_camera, false /* show_window */, color_image_out);
+    }
+    if (label_image_out != nullptr) {
+      RenderLabelImage(color_camera, false /* show_window */, label_image_out);
+    }
+  }
+  if (depth_image_out != nullptr) {
+    UpdateViewpoint(X_WD);
+    RenderDepthImage(depth_camera, depth_image_out);
+  }
+}
+
 RenderLabel RenderEngine::GetRenderLabelOrThrow(
     const PerceptionProperties& properties) const {
   RenderLabel label =
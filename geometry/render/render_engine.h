@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -24,6 +25,15 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+namespace internal {
+
+/* Converts the depth `depth` of an ImageDepth32F, in meters, to that of an
+ ImageDepth16U, in millimeters. Depths too large to be represented (including
+ ImageDepth32F's kTooFar value) saturate to ImageDepth16U's kTooFar value.  */
+uint16_t ConvertDepth32FTo16U(float depth);
+
+}  // namespace internal
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -41,7 +51,8 @@ namespace render {
      Note that this is different from the range data used by laser
      range finders (like that provided by DepthSensor) in which the depth
      value represents the distance from the sensor origin to the object's
-     surface.
+     surface. Depth images can also be rendered as ImageDepth16U, with the
+     same depths in millimeters, represented by a uint16_t.
 
    - Label (ImageLabel16I) : the label image has single channel represented
      by an int16_t. The value stored in the channel holds a RenderLabel value
@@ -187,6 +198,21 @@ class RenderEngine : public ShapeReifier {
       const DepthCameraProperties& camera,
       systems::sensors::ImageDepth32F* depth_image_out) const = 0;
 
+  /** Renders the registered geometry into the given 16-bit depth image, with
+   depths in millimeters. Depths that can't be represented, and those beyond
+   the camera's range, are reported as ImageDepth16U's `kTooFar` value; those
+   closer than its range as its `kTooClose` value.
+
+   The default implementation renders an ImageDepth32F and converts it.
+   Derived classes should override it to produce the 16-bit depths directly
+   from the rendered pixels, without the intermediate image.
+
+   @param camera                The intrinsic properties of the camera.
+   @param[out] depth_image_out  The rendered depth image.  */
+  virtual void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth16U* depth_image_out) const;
+
   /** Renders the registered geometry into the given label image.
 
    @param camera                The intrinsic properties of the camera.
@@ -197,6 +223,66 @@ class RenderEngine : public ShapeReifier {
       bool show_window,
       systems::sensors::ImageLabel16I* label_image_out) const = 0;
 
+  /** @name   Batched rendering
+
+   The following methods render the registered geometry, with its current
+   poses, from several viewpoints at once: the i'th image is rendered by the
+   camera with the intrinsic properties `cameras[i]` and the pose `X_WCs[i]`
+   (the pose of the camera's viewpoint in the world frame, as for
+   UpdateViewpoint()). A scene with many cameras should be rendered this way,
+   with one call per image type, rather than by one call to UpdateViewpoint()
+   and one render per camera, because derived classes can render all of the
+   views in a single pass (see, e.g., RenderEngineVtk).
+
+   The images are always rendered offscreen. The viewpoint last set with
+   UpdateViewpoint() is not preserved; callers of the single-image render
+   methods must set it anew afterwards.
+
+   @throws std::logic_error if the three vectors don't have the same size, or
+                            if any of the output images is null.  */
+  //@{
+
+  /** Renders the registered geometry into the given color (rgb) images.  */
+  void RenderColorImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageRgba8U*>& color_images_out);
+
+  /** Renders the registered geometry into the given depth images.  */
+  void RenderDepthImages(
+      const std::vector<DepthCameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageDepth32F*>& depth_images_out);
+
+  /** Renders the registered geometry into the given label images.  */
+  void RenderLabelImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageLabel16I*>& label_images_out);
+
+  //@}
+
+  /** Renders the registered geometry, with its current poses, into a color, a
+   depth, and a label image at once, as the sensors of an RGB-D camera see it:
+   the color and label images are rendered by the camera with the intrinsic
+   properties `color_camera` and the pose `X_WC`, and the depth image by the
+   camera with the properties `depth_camera` and the pose `X_WD` (both poses
+   being of the cameras' viewpoints in the world frame, as for
+   UpdateViewpoint()). Rendering the three images with a single call, rather
+   than with one call per image type, allows derived classes to share the work
+   of the three renders (see, e.g., RenderEngineVtk).
+
+   Each output image may be null, in which case it is not rendered. As for the
+   batched render methods, the images are rendered offscreen and the viewpoint
+   last set with UpdateViewpoint() is not preserved.  */
+  void RenderImages(const CameraProperties& color_camera,
+                    const math::RigidTransformd& X_WC,
+                    const DepthCameraProperties& depth_camera,
+                    const math::RigidTransformd& X_WD,
+                    systems::sensors::ImageRgba8U* color_image_out,
+                    systems::sensors::ImageDepth32F* depth_image_out,
+                    systems::sensors::ImageLabel16I* label_image_out);
+
   /** Reports the render label value this render engine has been configured to
    use.  */
   RenderLabel default_render_label() const { return default_render_label_; }
@@ -242,6 +328,42 @@ class RenderEngine : public ShapeReifier {
   /** The NVI-function for cloning this render engine.  */
   virtual std::unique_ptr<RenderEngine> DoClone() const = 0;
 
+  /** The NVI-function for rendering several color images at once. The inputs
+   have been validated (see RenderColorImages()). The default implementation
+   calls UpdateViewpoint() and RenderColorImage() for each camera in turn.  */
+  virtual void DoRenderColorImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageRgba8U*>& color_images_out);
+
+  /** The NVI-function for rendering several depth images at once. The inputs
+   have been validated (see RenderDepthImages()). The default implementation
+   calls UpdateViewpoint() and RenderDepthImage() for each camera in turn.  */
+  virtual void DoRenderDepthImages(
+      const std::vector<DepthCameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageDepth32F*>& depth_images_out);
+
+  /** The NVI-function for rendering several label images at once. The inputs
+   have been validated (see RenderLabelImages()). The default implementation
+   calls UpdateViewpoint() and RenderLabelImage() for each camera in turn.  */
+  virtual void DoRenderLabelImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageLabel16I*>& label_images_out);
+
+  /** The NVI-function for rendering a color, a depth, and a label image at
+   once (see RenderImages()); at least one of the output images is not null.
+   The default implementation calls UpdateViewpoint() and the single-image
+   render method of each requested image in turn.  */
+  virtual void DoRenderImages(
+      const CameraProperties& color_camera, const math::RigidTransformd& X_WC,
+      const DepthCameraProperties& depth_camera,
+      const math::RigidTransformd& X_WD,
+      systems::sensors::ImageRgba8U* color_image_out,
+      systems::sensors::ImageDepth32F* depth_image_out,
+      systems::sensors::ImageLabel16I* label_image_out);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -1,5 +1,6 @@
 #include "drake/geometry/render/render_engine_ospray.h"
 
+#include <chrono>
 #include <limits>
 #include <stdexcept>
 #include <utility>
@@ -20,6 +21,7 @@
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
 
+#include "drake/common/drake_throw.h"
 #include "drake/systems/sensors/color_palette.h"
 #include "drake/systems/sensors/vtk_util.h"
 
@@ -86,7 +88,12 @@ std::string RemoveFileExtension(const std::string& filepath) {
 RenderEngineOspray::RenderEngineOspray(const RenderEngineOsprayParams& params)
     : RenderEngine(RenderLabel::kUnspecified),
       pipelines_{{make_unique<RenderingPipeline>()}},
-      render_mode_(params.mode) {
+      render_mode_(params.mode),
+      max_accumulated_frames_(params.max_accumulated_frames),
+      time_budget_(params.time_budget) {
+  DRAKE_THROW_UNLESS(max_accumulated_frames_ > 0);
+  DRAKE_THROW_UNLESS(!time_budget_ || *time_budget_ >= 0);
+
   if (params.default_diffuse) {
     default_diffuse_ = *params.default_diffuse;
   }
@@ -100,6 +107,10 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOsprayParams& params)
 }
 
 void RenderEngineOspray::UpdateViewpoint(const RigidTransformd& X_WC) {
+  if (X_WC.IsExactlyEqualTo(X_WC_)) return;
+  X_WC_ = X_WC;
+  MarkSceneDirty();
+
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
   for (const auto& pipeline : pipelines_) {
@@ -111,13 +122,45 @@ void RenderEngineOspray::UpdateViewpoint(const RigidTransformd& X_WC) {
 void RenderEngineOspray::RenderColorImage(const CameraProperties& camera,
                                           bool show_window,
                                           ImageRgba8U* color_image_out) const {
-  UpdateWindow(camera, show_window, pipelines_[ImageType::kColor].get(),
-               "Color Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kColor]);
+  const RenderingPipeline& pipeline = *pipelines_[ImageType::kColor];
+
+  // OSPRay accumulates the passes rendered while nothing is modified (up to
+  // the max frames configured in InitializePipelines()); we mirror its count
+  // so that the complete image can be returned without rendering.
+  const bool unchanged = accumulated_.scene_version == scene_version_ &&
+                         accumulated_.width == camera.width &&
+                         accumulated_.height == camera.height &&
+                         accumulated_.fov_y == camera.fov_y &&
+                         accumulated_.show_window == show_window;
+  // The ray tracer's image is complete after a single pass.
+  const int max_frames = render_mode_ == OsprayMode::kPathTracer
+                             ? max_accumulated_frames_
+                             : 1;
+  if (!unchanged) accumulated_frames_ = 0;
+  if (accumulated_frames_ >= max_frames) {
+    *color_image_out = accumulated_.image;
+    return;
+  }
+
+  UpdateWindow(camera, show_window, &pipeline, "Color Image");
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+  auto budget_spent = [this, &start]() {
+    return time_budget_ &&
+           std::chrono::duration<double>(Clock::now() - start).count() >=
+               *time_budget_;
+  };
+  // All but the last pass only render; the last one also updates the image.
+  while (true) {
+    ++accumulated_frames_;
+    if (accumulated_frames_ >= max_frames || budget_spent()) break;
+    pipeline.window->Render();
+  }
+  PerformVtkUpdate(pipeline);
 
   // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
   // around copying).
-  auto& exporter = *pipelines_[ImageType::kColor]->exporter;
+  auto& exporter = *pipeline.exporter;
   DRAKE_DEMAND(exporter.GetDataNumberOfScalarComponents() == 4);
   exporter.Export(color_image_out->at(0, 0));
 
@@ -154,6 +197,13 @@ void RenderEngineOspray::RenderColorImage(const CameraProperties& camera,
       }
     }
   }
+
+  accumulated_.scene_version = scene_version_;
+  accumulated_.width = camera.width;
+  accumulated_.height = camera.height;
+  accumulated_.fov_y = camera.fov_y;
+  accumulated_.show_window = show_window;
+  accumulated_.image = *color_image_out;
 }
 
 void RenderEngineOspray::RenderDepthImage(const DepthCameraProperties&,
@@ -231,6 +281,8 @@ bool RenderEngineOspray::DoRegisterVisual(
   // Note: the user_data interface on reification requires a non-const pointer.
   RegistrationData data{properties, X_FG, id};
   shape.Reify(this, &data);
+  X_WGs_.insert({id, X_FG});
+  MarkSceneDirty();
   return true;
 }
 
@@ -240,11 +292,16 @@ RenderEngineOsprayParams RenderEngineOspray::get_params() const {
   return {
       render_mode_, default_diffuse_,
       Vector3d{background_color_.r, background_color_.g, background_color_.b},
-      samples_per_pixel};
+      samples_per_pixel, max_accumulated_frames_, time_budget_};
 }
 
 void RenderEngineOspray::DoUpdateVisualPose(GeometryId id,
                                             const RigidTransformd& X_WG) {
+  RigidTransformd& X_WG_prior = X_WGs_.at(id);
+  if (X_WG.IsExactlyEqualTo(X_WG_prior)) return;
+  X_WG_prior = X_WG;
+  MarkSceneDirty();
+
   vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(X_WG);
   // TODO(SeanCurtis-TRI): Perhaps provide the ability to specify actors for
   //  specific pipelines; i.e. only update the color actor or only the label
@@ -266,6 +323,8 @@ bool RenderEngineOspray::DoRemoveGeometry(GeometryId id) {
     pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
   }
   actors_.erase(iter);
+  X_WGs_.erase(id);
+  MarkSceneDirty();
   return true;
 }
 
@@ -282,7 +341,12 @@ RenderEngineOspray::RenderEngineOspray(const RenderEngineOspray& other)
       pipelines_{{make_unique<RenderingPipeline>()}},
       default_diffuse_{other.default_diffuse_},
       background_color_{other.background_color_},
-      render_mode_(other.render_mode_) {
+      render_mode_(other.render_mode_),
+      max_accumulated_frames_(other.max_accumulated_frames_),
+      time_budget_(other.time_budget_),
+      X_WGs_(other.X_WGs_),
+      X_WC_(other.X_WC_),
+      scene_version_(other.scene_version_) {
   InitializePipelines(other.get_params().samples_per_pixel);
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -380,6 +444,10 @@ void RenderEngineOspray::InitializePipelines(int samples_per_pixel) {
       vtkOSPRayRendererNode::SetRendererType("pathtracer", pipeline->renderer);
       vtkOSPRayRendererNode::SetSamplesPerPixel(samples_per_pixel,
                                                 pipeline->renderer);
+      // Successive renders of an unmodified scene accumulate into the image,
+      // up to this many frames.
+      vtkOSPRayRendererNode::SetMaxFrames(max_accumulated_frames_,
+                                          pipeline->renderer);
       // TODO(SeanCurtis-TRI): When our VTK library has been updated to include
       //  the denoiser introduced in
       //  https://gitlab.kitware.com/vtk/vtk/merge_requests/5297
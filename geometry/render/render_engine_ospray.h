@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -115,6 +116,12 @@ class RenderEngineOspray final
 
   //@}
 
+  /** Reports the number of rendering passes accumulated into the most recently
+   rendered color image. It is reset when the camera or any geometry moves, or
+   when geometry is added or removed. See
+   RenderEngineOsprayParams::max_accumulated_frames.  */
+  int num_accumulated_frames() const { return accumulated_frames_; }
+
  private:
   // @see RenderEngine::DoRegisterVisual().
   bool DoRegisterVisual(GeometryId id, const Shape& shape,
@@ -141,6 +148,10 @@ class RenderEngineOspray final
   // Initializes the VTK pipelines.
   void InitializePipelines(int samples_per_pixel);
 
+  // Records that the scene has changed, so that the next color image starts
+  // accumulating anew.
+  void MarkSceneDirty() { ++scene_version_; }
+
   // Common interface for loading an obj file -- used for both mesh and convex
   // shapes.
   void ImplementObj(const std::string& file_name, double scale,
@@ -191,6 +202,34 @@ class RenderEngineOspray final
 
   // Configuration to use path tracer or ray tracer.
   const OsprayMode render_mode_{OsprayMode::kPathTracer};
+
+  // The progressive rendering budgets; see RenderEngineOsprayParams.
+  const int max_accumulated_frames_{1};
+  const optional<double> time_budget_{};
+
+  // The last poses given to the actors and the camera. Setting an unchanged
+  // pose is skipped: modifying a VTK actor or camera discards the frames OSPRay
+  // has accumulated.
+  std::unordered_map<GeometryId, math::RigidTransformd> X_WGs_;
+  math::RigidTransformd X_WC_;
+
+  // Incremented whenever a geometry or the camera moves, or the set of
+  // geometries changes.
+  int64_t scene_version_{0};
+
+  // The state of the accumulated color image: the scene version and camera
+  // it was rendered for, the number of passes it holds, and the image itself
+  // (returned as is when it is complete and nothing has changed).
+  struct AccumulatedImage {
+    int64_t scene_version{-1};
+    int width{-1};
+    int height{-1};
+    double fov_y{-1};
+    bool show_window{false};
+    systems::sensors::ImageRgba8U image;
+  };
+  mutable AccumulatedImage accumulated_;
+  mutable int accumulated_frames_{0};
 };
 
 }  // namespace render
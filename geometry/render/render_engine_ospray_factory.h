@@ -46,6 +46,23 @@ struct RenderEngineOsprayParams {
    higher quality at increased cost. Only has an effect if mode is
    OsprayMode::kPathTracer.  */
   int samples_per_pixel{1};
+
+  /** The maximum number of rendering passes to accumulate into a color image
+   while neither the camera nor any geometry moves. Each pass adds
+   `samples_per_pixel` samples to every pixel, so the image converges as passes
+   accumulate; once the maximum is reached, rendering an unchanged scene returns
+   the accumulated image without rendering again. Must be positive. Only has an
+   effect if mode is OsprayMode::kPathTracer (the ray tracer's image is
+   complete after a single pass).  */
+  int max_accumulated_frames{1};
+
+  /** The (optional) time budget, in seconds, for each call to
+   RenderEngine::RenderColorImage(). When given, the renderer stops adding
+   passes once the budget is spent (but always renders at least one pass
+   if the accumulated image isn't complete) and resumes accumulating on the
+   next call if nothing has moved. When not given, each call renders all of the
+   remaining passes up to `max_accumulated_frames`. Must be non-negative.  */
+  optional<double> time_budget{};
 };
 
 /** Constructs a RenderEngine implementation which uses an OSPRay-based
@@ -1,10 +1,20 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
 #include <limits>
+#include <map>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
+#include <fmt/format.h>
+#include <vtkActorCollection.h>
 #include <vtkCamera.h>
+#include <vtkCellArray.h>
 #include <vtkCubeSource.h>
 #include <vtkCylinderSource.h>
 #include <vtkOBJReader.h>
@@ -12,11 +22,16 @@
 #include <vtkOpenGLTexture.h>
 #include <vtkPNGReader.h>
 #include <vtkPlaneSource.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
 #include <vtkProperty.h>
 #include <vtkSphereSource.h>
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
+#include <vtkTrivialProducer.h>
 
+#include "drake/common/file_cache.h"
+#include "drake/geometry/render/mesh_simplification.h"
 #include "drake/geometry/render/shaders/depth_shaders.h"
 #include "drake/systems/sensors/color_palette.h"
 #include "drake/systems/sensors/vtk_util.h"
@@ -25,11 +40,13 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+using Eigen::Vector3d;
 using Eigen::Vector4d;
 using std::make_unique;
 using math::RigidTransformd;
 using systems::sensors::ColorD;
 using systems::sensors::ColorI;
+using systems::sensors::ImageDepth16U;
 using systems::sensors::ImageDepth32F;
 using systems::sensors::ImageLabel16I;
 using systems::sensors::ImageRgba8U;
@@ -52,7 +69,12 @@ namespace {
 // range and mark them as too close. Clipping all geometry beyond z_far is not
 // a problem because they can unambiguously be marked as too far.
 const double kClippingPlaneNear = 0.01;
+// The far clipping plane of the color and label images.
+const double kDefaultClippingPlaneFar = 100.;
 const double kTerrainSize = 100.;
+// The defaults of the ("lod", *) properties.
+const double kDefaultLodReduction = 0.25;
+const double kDefaultLodPixelsPerTriangle = 10.;
 
 void SetModelTransformMatrixToVtkCamera(
     vtkCamera* camera, const vtkSmartPointer<vtkTransform>& X_WC) {
@@ -88,6 +110,101 @@ float CheckRangeAndConvertToMeters(float z_buffer_value, double z_near,
   return z;
 }
 
+// The RGBA image rendered by a pipeline, read in place from the buffer of the
+// pipeline's vtkImageExport rather than exported into another image. VTK stores
+// the rows from bottom to top; at(u, v) flips them so that (0, 0) is the
+// top-left pixel, as in an ImageRgba8U. The view is valid until the pipeline
+// renders again.
+class RgbaBufferView {
+ public:
+  RgbaBufferView(vtkImageExport* exporter, int width, int height)
+      : data_(static_cast<const uint8_t*>(exporter->GetPointerToData())),
+        width_(width),
+        height_(height) {}
+
+  const uint8_t* at(int u, int v) const {
+    return data_ + ((height_ - 1 - v) * width_ + u) * ImageRgba8U::kPixelSize;
+  }
+
+ private:
+  const uint8_t* data_{};
+  int width_{};
+  int height_{};
+};
+
+// Writes the depth `z`, in meters, to the channel of a depth image, converting
+// it to the image's units.
+void SetDepth(float z, float* channel) { *channel = z; }
+void SetDepth(float z, uint16_t* channel) {
+  *channel = internal::ConvertDepth32FTo16U(z);
+}
+
+// Decodes the depth image of the given `camera` from the color values written
+// by the depth shaders in the camera-sized block of `image` whose top-left
+// pixel is (u0, v0). The depths are converted to the units of `DepthImage` as
+// they are decoded.
+template <typename DepthImage>
+void DecodeDepthImage(const RgbaBufferView& image, int u0, int v0,
+                      const DepthCameraProperties& camera,
+                      DepthImage* depth_image_out) {
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const uint8_t* pixel = image.at(u0 + u, v0 + v);
+      if (pixel[0] == 255u && pixel[1] == 255u && pixel[2] == 255u) {
+        SetDepth(InvalidDepth::kTooFar, depth_image_out->at(u, v));
+      } else {
+        // Decoding three channel color values to a float value. For the detail,
+        // see depth_shaders.h.
+        float shader_value =
+            pixel[0] + pixel[1] / 255. + pixel[2] / (255. * 255.);
+
+        // Dividing by 255 so that the range gets to be [0, 1].
+        shader_value /= 255.f;
+        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
+        SetDepth(CheckRangeAndConvertToMeters(shader_value, camera.z_near,
+                                              camera.z_far),
+                 depth_image_out->at(u, v));
+      }
+    }
+  }
+}
+
+// Copies the block of `image` whose top-left pixel is (u0, v0) into
+// `color_image_out`.
+void CopyColorImage(const RgbaBufferView& image, int u0, int v0,
+                    ImageRgba8U* color_image_out) {
+  const int row_size = color_image_out->width() * ImageRgba8U::kPixelSize;
+  for (int v = 0; v < color_image_out->height(); ++v) {
+    std::memcpy(color_image_out->at(0, v), image.at(u0, v0 + v), row_size);
+  }
+}
+
+// The number of columns of the grid of tiles of RenderTiles(), which is as
+// square as possible.
+int NumTileColumns(int num_views) {
+  return static_cast<int>(std::ceil(std::sqrt(num_views)));
+}
+
+// The number of rows of the grid of tiles of RenderTiles().
+int NumTileRows(int num_views) {
+  const int cols = NumTileColumns(num_views);
+  return (num_views + cols - 1) / cols;
+}
+
+// Returns the image of RenderTiles() for `num_views` views of the given size,
+// read in place from the tiled pipeline's `exporter`.
+RgbaBufferView ViewTiles(vtkImageExport* exporter, int num_views, int width,
+                         int height) {
+  return RgbaBufferView(exporter, NumTileColumns(num_views) * width,
+                        NumTileRows(num_views) * height);
+}
+
+// Returns the top-left pixel of the k'th tile of the image of RenderTiles().
+std::pair<int, int> TileOrigin(int num_views, int k, int width, int height) {
+  const int cols = NumTileColumns(num_views);
+  return {(k % cols) * width, (k / cols) * height};
+}
+
 enum ImageType {
   kColor = 0,
   kLabel = 1,
@@ -112,6 +229,94 @@ std::string RemoveFileExtension(const std::string& filepath) {
   return filepath.substr(0, last_dot);
 }
 
+// Returns the name of the texture of the geometry being registered, or the
+// empty string if it has none.
+std::string FindTextureName(const RegistrationData& data) {
+  const std::string& diffuse_map_name =
+      data.properties.GetPropertyOrDefault<std::string>("phong", "diffuse_map",
+                                                        "");
+  // Legacy support for *implied* texture maps. If we have mesh.obj, we look for
+  // mesh.png (unless one has been specifically called out in the properties).
+  // TODO(SeanCurtis-TRI): Remove this legacy texture when objects and materials
+  // are coherently specified by SDF/URDF/obj/mtl, etc.
+  std::string texture_name;
+  std::ifstream file_exist(diffuse_map_name);
+  if (file_exist) {
+    texture_name = diffuse_map_name;
+  } else if (diffuse_map_name.empty() && data.mesh_filename) {
+    // This is the hack to search for mesh.png as a possible texture.
+    const std::string
+        alt_texture_name(RemoveFileExtension(*data.mesh_filename) +
+        ".png");
+    std::ifstream alt_file_exist(alt_texture_name);
+    if (alt_file_exist) texture_name = alt_texture_name;
+  }
+  return texture_name;
+}
+
+// Converts the mesh to VTK polygonal data. It has no normals, so that VTK
+// shades each triangle flat, which keeps the edges of coarse levels of detail
+// sharp.
+vtkSmartPointer<vtkPolyData> ConvertToVtkPolyData(
+    const SurfaceMesh<double>& mesh) {
+  vtkNew<vtkPoints> points;
+  for (SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+    const Vector3d& p = mesh.vertex(v).r_MV();
+    points->InsertNextPoint(p.x(), p.y(), p.z());
+  }
+  vtkNew<vtkCellArray> triangles;
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    const vtkIdType ids[3] = {mesh.element(f).vertex(0),
+                              mesh.element(f).vertex(1),
+                              mesh.element(f).vertex(2)};
+    triangles->InsertNextCell(3, ids);
+  }
+  auto poly_data = vtkSmartPointer<vtkPolyData>::New();
+  poly_data->SetPoints(points.Get());
+  poly_data->SetPolys(triangles.Get());
+  return poly_data;
+}
+
+// Returns the focal length, in pixels, of the given camera.
+double FocalLength(const CameraProperties& camera) {
+  return camera.height / (2 * std::tan(camera.fov_y / 2));
+}
+
+// Groups the views of a batch by image size (and, for depth images, by far
+// clipping plane, since it is a shader uniform shared by all of the views).
+template <typename Group, typename Camera>
+std::vector<Group> GroupViews(const std::vector<Camera>& cameras) {
+  std::map<std::tuple<int, int, double>, Group> groups;
+  for (int i = 0; i < static_cast<int>(cameras.size()); ++i) {
+    const Camera& camera = cameras[i];
+    double z_far = kDefaultClippingPlaneFar;
+    if constexpr (std::is_same<Camera, DepthCameraProperties>::value) {
+      z_far = camera.z_far;
+    }
+    Group& group = groups[std::make_tuple(camera.width, camera.height, z_far)];
+    group.width = camera.width;
+    group.height = camera.height;
+    group.z_far = z_far;
+    group.views.push_back(i);
+    group.fov_ys.push_back(camera.fov_y);
+  }
+  std::vector<Group> result;
+  for (auto& key_group : groups) {
+    result.push_back(std::move(key_group.second));
+  }
+  return result;
+}
+
+// The polygonal data of a scaled .obj file, shared by the engines which
+// render it. It is never modified once loaded.
+struct ObjPolyData {
+  vtkSmartPointer<vtkPolyData> poly_data;
+  int num_faces{};
+  // The corners of the mesh's bounding box, in the geometry's frame G.
+  Vector3d p_GMin;
+  Vector3d p_GMax;
+};
+
 }  // namespace
 
 namespace internal {
@@ -119,7 +324,7 @@ namespace internal {
 ShaderCallback::ShaderCallback() :
     z_near_(kClippingPlaneNear),
     // This value will be overwritten by the camera's z_far value.
-    z_far_(100.0) {}
+    z_far_(kDefaultClippingPlaneFar) {}
 
 }  // namespace internal
 
@@ -130,7 +335,11 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
                                             : RenderLabel::kUnspecified),
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
-                  make_unique<RenderingPipeline>()}} {
+                  make_unique<RenderingPipeline>()}},
+      tiled_pipelines_{{make_unique<TiledPipeline>(),
+                        make_unique<TiledPipeline>(),
+                        make_unique<TiledPipeline>()}},
+      combined_pipeline_{make_unique<TiledPipeline>()} {
   if (parameters.default_diffuse) {
     default_diffuse_ = *parameters.default_diffuse;
   }
@@ -142,6 +351,7 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
 }
 
 void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
+  X_WC_ = X_WC;
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
   for (const auto& pipeline : pipelines_) {
@@ -155,46 +365,33 @@ void RenderEngineVtk::RenderColorImage(const CameraProperties& camera,
                                        ImageRgba8U* color_image_out) const {
   UpdateWindow(camera, show_window, pipelines_[ImageType::kColor].get(),
                "Color Image");
+  SelectLevelsOfDetail({{X_WC_, FocalLength(camera)}});
   PerformVtkUpdate(*pipelines_[ImageType::kColor]);
 
-  // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
-  // around copying).
+  // The exporter flips the rendered rows straight into the caller's image.
   pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
 }
 
 void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
                                        ImageDepth32F* depth_image_out) const {
   UpdateWindow(camera, pipelines_[ImageType::kDepth].get());
+  SelectLevelsOfDetail({{X_WC_, FocalLength(camera)}});
   PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
 
-  // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
-  // would be much better to process the pixels directly. The solution is to
-  // simply call exporter->GetPointerToData() and process the pixels myself.
-  // See the implementation in vtkImageExport::Export() for details.
-  ImageRgba8U image(camera.width, camera.height);
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
+  const RgbaBufferView image(pipelines_[ImageType::kDepth]->exporter.Get(),
+                             camera.width, camera.height);
+  DecodeDepthImage(image, 0, 0, camera, depth_image_out);
+}
 
-  for (int v = 0; v < camera.height; ++v) {
-    for (int u = 0; u < camera.width; ++u) {
-      if (image.at(u, v)[0] == 255u &&
-          image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] = InvalidDepth::kTooFar;
-      } else {
-        // Decoding three channel color values to a float value. For the detail,
-        // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
+void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
+                                       ImageDepth16U* depth_image_out) const {
+  UpdateWindow(camera, pipelines_[ImageType::kDepth].get());
+  SelectLevelsOfDetail({{X_WC_, FocalLength(camera)}});
+  PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
 
-        // Dividing by 255 so that the range gets to be [0, 1].
-        shader_value /= 255.f;
-        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] =
-            CheckRangeAndConvertToMeters(shader_value, camera.z_near,
-                                         camera.z_far);
-      }
-    }
-  }
+  const RgbaBufferView image(pipelines_[ImageType::kDepth]->exporter.Get(),
+                             camera.width, camera.height);
+  DecodeDepthImage(image, 0, 0, camera, depth_image_out);
 }
 
 void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
@@ -202,24 +399,12 @@ void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
                                        ImageLabel16I* label_image_out) const {
   UpdateWindow(camera, show_window, pipelines_[ImageType::kLabel].get(),
                "Label Image");
+  SelectLevelsOfDetail({{X_WC_, FocalLength(camera)}});
   PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
 
-  // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
-  // would be much better to process the pixels directly. The solution is to
-  // simply call exporter->GetPointerToData() and process the pixels myself.
-  // See the implementation in vtkImageExport::Export() for details.
-  ImageRgba8U image(camera.width, camera.height);
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
-
-  ColorI color;
-  for (int v = 0; v < camera.height; ++v) {
-    for (int u = 0; u < camera.width; ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
-    }
-  }
+  const RgbaBufferView image(pipelines_[ImageType::kLabel]->exporter.Get(),
+                             camera.width, camera.height);
+  DecodeLabelImage(image, 0, 0, camera, label_image_out);
 }
 
 void RenderEngineVtk::ImplementGeometry(const Sphere& sphere, void* user_data) {
@@ -292,18 +477,42 @@ void RenderEngineVtk::DoUpdateVisualPose(GeometryId id,
   for (const auto& actor : actors_.at(id)) {
     actor->SetUserTransform(vtk_X_WG);
   }
+  auto lod_iter = levels_of_detail_.find(id);
+  if (lod_iter != levels_of_detail_.end()) {
+    LevelsOfDetail& lod = lod_iter->second;
+    lod.X_WG = X_WG;
+    for (const auto& level_actors : lod.actors) {
+      for (const auto& actor : level_actors) {
+        actor->SetUserTransform(vtk_X_WG);
+      }
+    }
+  }
 }
 
 bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
   auto iter = actors_.find(id);
 
   if (iter != actors_.end()) {
-    std::array<vtkSmartPointer<vtkActor>, 3>& pipe_actors = iter->second;
-    for (int i = 0; i < kNumPipelines; ++i) {
-      // If the label actor hasn't been added to its renderer, this is a no-op.
-      pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
-    }
+    auto remove_actors =
+        [this](const std::array<vtkSmartPointer<vtkActor>, 3>& pipe_actors) {
+          for (int i = 0; i < kNumPipelines; ++i) {
+            // If the label actor hasn't been added to its renderer, this is a
+            // no-op.
+            pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
+            for (const auto& renderer : tiled_pipelines_[i]->renderers) {
+              renderer->RemoveActor(pipe_actors[i]);
+            }
+          }
+        };
+    remove_actors(iter->second);
     actors_.erase(iter);
+    auto lod_iter = levels_of_detail_.find(id);
+    if (lod_iter != levels_of_detail_.end()) {
+      for (const auto& level_actors : lod_iter->second.actors) {
+        remove_actors(level_actors);
+      }
+      levels_of_detail_.erase(lod_iter);
+    }
     return true;
   }
 
@@ -319,8 +528,13 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>()}},
+      tiled_pipelines_{{make_unique<TiledPipeline>(),
+                        make_unique<TiledPipeline>(),
+                        make_unique<TiledPipeline>()}},
+      combined_pipeline_{make_unique<TiledPipeline>()},
       default_diffuse_{other.default_diffuse_},
-      default_clear_color_{other.default_clear_color_} {
+      default_clear_color_{other.default_clear_color_},
+      X_WC_{other.X_WC_} {
   InitializePipelines();
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -353,6 +567,7 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       // in the copy that still references it.
       clone.SetMapper(source.GetMapper());
       clone.SetUserTransform(source.GetUserTransform());
+      clone.SetVisibility(source.GetVisibility());
       // This is necessary because *terrain* has its lighting turned off. To
       // blindly handle arbitrary actors being flagged as terrain, we need
       // to treat all actors this way.
@@ -371,6 +586,17 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
     actors_.insert({id, move(actors)});
   }
 
+  for (const auto& [id, other_lod] : other.levels_of_detail_) {
+    LevelsOfDetail lod = other_lod;
+    for (int k = 0; k < static_cast<int>(lod.actors.size()); ++k) {
+      lod.actors[k] = {vtkSmartPointer<vtkActor>::New(),
+                       vtkSmartPointer<vtkActor>::New(),
+                       vtkSmartPointer<vtkActor>::New()};
+      clone_actor_array(other_lod.actors[k], &lod.actors[k]);
+    }
+    levels_of_detail_.insert({id, std::move(lod)});
+  }
+
   // Copy camera properties
   auto copy_cameras = [](auto src_renderer, auto dst_renderer) {
     dst_renderer->GetActiveCamera()->DeepCopy(src_renderer->GetActiveCamera());
@@ -405,7 +631,7 @@ void RenderEngineVtk::InitializePipelines() {
     // TODO(SeanCurtis-TRI): Provide mechanism where user can set this value.
     //  It's important to expose this as it will affect the efficacy of the
     //  z-buffer.
-    camera->SetClippingRange(kClippingPlaneNear, 100.0);
+    camera->SetClippingRange(kClippingPlaneNear, kDefaultClippingPlaneFar);
     SetModelTransformMatrixToVtkCamera(camera, vtk_identity);
 
     pipeline->window->AddRenderer(pipeline->renderer.GetPointer());
@@ -417,6 +643,24 @@ void RenderEngineVtk::InitializePipelines() {
     pipeline->exporter->ImageLowerLeftOff();
   }
 
+  // The tiled pipelines are always rendered offscreen; their renderers are
+  // configured like those of the pipelines above when they are created (see
+  // RenderTiles() and below).
+  std::vector<TiledPipeline*> tiled_pipelines{combined_pipeline_.get()};
+  for (auto& pipeline : tiled_pipelines_) {
+    tiled_pipelines.push_back(pipeline.get());
+  }
+  for (TiledPipeline* pipeline : tiled_pipelines) {
+    pipeline->window->SetMultiSamples(0);
+    pipeline->window->SetOffScreenRendering(1);
+    pipeline->filter->SetInput(pipeline->window.GetPointer());
+    pipeline->filter->SetScale(1);
+    pipeline->filter->ReadFrontBufferOff();
+    pipeline->filter->SetInputBufferTypeToRGBA();
+    pipeline->exporter->SetInputData(pipeline->filter->GetOutput());
+    pipeline->exporter->ImageLowerLeftOff();
+  }
+
   // Pipeline-specific tweaks.
 
   // Depth image background color is white -- the representation of the maximum
@@ -432,31 +676,111 @@ void RenderEngineVtk::InitializePipelines() {
   pipelines_[ImageType::kColor]->renderer->UseFXAAOn();
   pipelines_[ImageType::kColor]->renderer->SetBackground(
       default_clear_color_.r, default_clear_color_.g, default_clear_color_.b);
+
+  // The combined pipeline's renderers, in the order of the image types.
+  for (const auto& pipeline : pipelines_) {
+    auto renderer = vtkSmartPointer<vtkRenderer>::New();
+    renderer->SetBackground(pipeline->renderer->GetBackground());
+    renderer->SetUseDepthPeeling(pipeline->renderer->GetUseDepthPeeling());
+    renderer->SetUseFXAA(pipeline->renderer->GetUseFXAA());
+    combined_pipeline_->window->AddRenderer(renderer);
+    combined_pipeline_->renderers.push_back(renderer);
+  }
 }
 
 void RenderEngineVtk::ImplementObj(const std::string& file_name, double scale,
                                    void* user_data) {
   static_cast<RegistrationData*>(user_data)->mesh_filename = file_name;
-  vtkNew<vtkOBJReader> mesh_reader;
-  mesh_reader->SetFileName(file_name.c_str());
-  mesh_reader->Update();
-
   vtkNew<vtkTransform> transform;
   // TODO(SeanCurtis-TRI): Should I be allowing only isotropic scale.
-  // TODO(SeanCurtis-TRI): Only add the transform filter if scale is not all 1.
   transform->Scale(scale, scale, scale);
-  vtkNew<vtkTransformPolyDataFilter> transform_filter;
-  transform_filter->SetInputConnection(mesh_reader->GetOutputPort());
-  transform_filter->SetTransform(transform.GetPointer());
-  transform_filter->Update();
 
-  ImplementGeometry(transform_filter.GetPointer(), user_data);
+  // The scaled mesh is read once per file and scale (and reloaded only when
+  // the file changes), and shared by the engines of the process.
+  const std::shared_ptr<const ObjPolyData> obj =
+      drake::internal::FileCache<const ObjPolyData>::GetOrLoad(
+          file_name, fmt::format("{}?scale={}", file_name, scale),
+          [&file_name, &transform]() {
+            vtkNew<vtkOBJReader> mesh_reader;
+            mesh_reader->SetFileName(file_name.c_str());
+            vtkNew<vtkTransformPolyDataFilter> transform_filter;
+            transform_filter->SetInputConnection(mesh_reader->GetOutputPort());
+            transform_filter->SetTransform(transform.GetPointer());
+            transform_filter->Update();
+            auto result = std::make_shared<ObjPolyData>();
+            result->poly_data = vtkSmartPointer<vtkPolyData>::New();
+            result->poly_data->DeepCopy(transform_filter->GetOutput());
+            result->num_faces =
+                static_cast<int>(result->poly_data->GetNumberOfPolys());
+            double bounds[6];
+            result->poly_data->GetBounds(bounds);
+            result->p_GMin = Vector3d(bounds[0], bounds[2], bounds[4]);
+            result->p_GMax = Vector3d(bounds[1], bounds[3], bounds[5]);
+            return result;
+          });
+  // The shared polygonal data is connected to this engine's mappers through a
+  // producer of its own.
+  vtkNew<vtkTrivialProducer> producer;
+  producer->SetOutput(obj->poly_data);
+
+  const RegistrationData& data =
+      *reinterpret_cast<RegistrationData*>(user_data);
+  const int num_levels =
+      data.properties.GetPropertyOrDefault("lod", "num_levels", 0);
+  const double reduction = data.properties.GetPropertyOrDefault(
+      "lod", "reduction", kDefaultLodReduction);
+  const double pixels_per_triangle = data.properties.GetPropertyOrDefault(
+      "lod", "pixels_per_triangle", kDefaultLodPixelsPerTriangle);
+  if (num_levels > 0 &&
+      (!(reduction > 0 && reduction < 1) || !(pixels_per_triangle > 0))) {
+    throw std::logic_error(fmt::format(
+        "The levels of detail of the mesh '{}' must have a reduction in the "
+        "range (0, 1) and a positive number of pixels per triangle; they "
+        "were {} and {}",
+        file_name, reduction, pixels_per_triangle));
+  }
+
+  ImplementGeometry(producer.GetPointer(), user_data);
+
+  // The texture coordinates of the mesh's vertices don't survive its
+  // simplification, so textured meshes are always rendered in full.
+  if (num_levels <= 0 || !FindTextureName(data).empty()) return;
+  const auto levels =
+      internal::LoadMeshLevelsOfDetail(file_name, num_levels, reduction);
+  if (levels->empty()) return;
+
+  LevelsOfDetail lod;
+  lod.num_faces.push_back(obj->num_faces);
+  const Vector3d& p_GMin = obj->p_GMin;
+  const Vector3d& p_GMax = obj->p_GMax;
+  lod.p_GS = (p_GMin + p_GMax) / 2;
+  lod.radius = (p_GMax - p_GMin).norm() / 2;
+  lod.pixels_per_triangle = pixels_per_triangle;
+  lod.X_WG = data.X_FG;
+  for (const SurfaceMesh<double>& level : *levels) {
+    vtkNew<vtkTransformPolyDataFilter> level_filter;
+    level_filter->SetInputData(ConvertToVtkPolyData(level));
+    level_filter->SetTransform(transform.GetPointer());
+    level_filter->Update();
+    lod.actors.push_back(MakeActors(level_filter.GetPointer(), user_data));
+    lod.num_faces.push_back(level.num_faces());
+    // Until the levels are selected for a camera, the full mesh is shown.
+    for (const auto& actor : lod.actors.back()) actor->VisibilityOff();
+  }
+  levels_of_detail_.insert({data.id, std::move(lod)});
 }
 
-void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
+void RenderEngineVtk::ImplementGeometry(vtkAlgorithm* source,
                                         void* user_data) {
   DRAKE_DEMAND(user_data != nullptr);
+  const GeometryId id = reinterpret_cast<RegistrationData*>(user_data)->id;
+
+  // Take ownership of the actors.
+  actors_.insert({id, MakeActors(source, user_data)});
+}
 
+std::array<vtkSmartPointer<vtkActor>, RenderEngineVtk::kNumPipelines>
+RenderEngineVtk::MakeActors(vtkAlgorithm* source, void* user_data) {
   std::array<vtkSmartPointer<vtkActor>, kNumPipelines> actors{
       vtkSmartPointer<vtkActor>::New(), vtkSmartPointer<vtkActor>::New(),
       vtkSmartPointer<vtkActor>::New()};
@@ -507,25 +831,7 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
 
   // Color actor.
   auto& color_actor = actors[ImageType::kColor];
-  const std::string& diffuse_map_name =
-      data.properties.GetPropertyOrDefault<std::string>("phong", "diffuse_map",
-                                                        "");
-  // Legacy support for *implied* texture maps. If we have mesh.obj, we look for
-  // mesh.png (unless one has been specifically called out in the properties).
-  // TODO(SeanCurtis-TRI): Remove this legacy texture when objects and materials
-  // are coherently specified by SDF/URDF/obj/mtl, etc.
-  std::string texture_name;
-  std::ifstream file_exist(diffuse_map_name);
-  if (file_exist) {
-    texture_name = diffuse_map_name;
-  } else if (diffuse_map_name.empty() && data.mesh_filename) {
-    // This is the hack to search for mesh.png as a possible texture.
-    const std::string
-        alt_texture_name(RemoveFileExtension(*data.mesh_filename) +
-        ".png");
-    std::ifstream alt_file_exist(alt_texture_name);
-    if (alt_file_exist) texture_name = alt_texture_name;
-  }
+  const std::string texture_name = FindTextureName(data);
   if (!texture_name.empty()) {
     vtkNew<vtkPNGReader> texture_reader;
     texture_reader->SetFileName(texture_name.c_str());
@@ -551,8 +857,231 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
   // Depth actor; always gets wired in with no additional work.
   connect_actor(ImageType::kDepth);
 
-  // Take ownership of the actors.
-  actors_.insert({data.id, std::move(actors)});
+  return actors;
+}
+
+void RenderEngineVtk::DoRenderColorImages(
+    const std::vector<CameraProperties>& cameras,
+    const std::vector<RigidTransformd>& X_WCs,
+    const std::vector<ImageRgba8U*>& color_images_out) {
+  for (const TileGroup& group : GroupViews<TileGroup>(cameras)) {
+    RenderTiles(ImageType::kColor, group, X_WCs);
+    const int num_views = static_cast<int>(group.views.size());
+    const RgbaBufferView tiles = ViewTiles(
+        tiled_pipelines_[ImageType::kColor]->exporter.Get(), num_views,
+        group.width, group.height);
+    for (int k = 0; k < num_views; ++k) {
+      const auto [u0, v0] = TileOrigin(num_views, k, group.width, group.height);
+      CopyColorImage(tiles, u0, v0, color_images_out[group.views[k]]);
+    }
+  }
+}
+
+void RenderEngineVtk::DoRenderDepthImages(
+    const std::vector<DepthCameraProperties>& cameras,
+    const std::vector<RigidTransformd>& X_WCs,
+    const std::vector<ImageDepth32F*>& depth_images_out) {
+  for (const TileGroup& group : GroupViews<TileGroup>(cameras)) {
+    RenderTiles(ImageType::kDepth, group, X_WCs);
+    const int num_views = static_cast<int>(group.views.size());
+    const RgbaBufferView tiles = ViewTiles(
+        tiled_pipelines_[ImageType::kDepth]->exporter.Get(), num_views,
+        group.width, group.height);
+    for (int k = 0; k < num_views; ++k) {
+      const int i = group.views[k];
+      const auto [u0, v0] = TileOrigin(num_views, k, group.width, group.height);
+      DecodeDepthImage(tiles, u0, v0, cameras[i], depth_images_out[i]);
+    }
+  }
+}
+
+void RenderEngineVtk::DoRenderLabelImages(
+    const std::vector<CameraProperties>& cameras,
+    const std::vector<RigidTransformd>& X_WCs,
+    const std::vector<ImageLabel16I*>& label_images_out) {
+  for (const TileGroup& group : GroupViews<TileGroup>(cameras)) {
+    RenderTiles(ImageType::kLabel, group, X_WCs);
+    const int num_views = static_cast<int>(group.views.size());
+    const RgbaBufferView tiles = ViewTiles(
+        tiled_pipelines_[ImageType::kLabel]->exporter.Get(), num_views,
+        group.width, group.height);
+    for (int k = 0; k < num_views; ++k) {
+      const int i = group.views[k];
+      const auto [u0, v0] = TileOrigin(num_views, k, group.width, group.height);
+      DecodeLabelImage(tiles, u0, v0, cameras[i], label_images_out[i]);
+    }
+  }
+}
+
+void RenderEngineVtk::DoRenderImages(const CameraProperties& color_camera,
+                                     const RigidTransformd& X_WC,
+                                     const DepthCameraProperties& depth_camera,
+                                     const RigidTransformd& X_WD,
+                                     ImageRgba8U* color_image_out,
+                                     ImageDepth32F* depth_image_out,
+                                     ImageLabel16I* label_image_out) {
+  // The tile of each image type, from left to right; the tiles of the images
+  // that aren't requested are not drawn, and take no room.
+  struct Tile {
+    const CameraProperties* camera{};
+    const RigidTransformd* X_WC{};
+    double z_far{};
+    bool drawn{};
+    int u0{};
+  };
+  std::array<Tile, kNumPipelines> tiles;
+  tiles[ImageType::kColor] = {&color_camera, &X_WC, kDefaultClippingPlaneFar,
+                              color_image_out != nullptr};
+  tiles[ImageType::kLabel] = {&color_camera, &X_WC, kDefaultClippingPlaneFar,
+                              label_image_out != nullptr};
+  tiles[ImageType::kDepth] = {&depth_camera, &X_WD, depth_camera.z_far,
+                              depth_image_out != nullptr};
+
+  int width = 0;
+  int height = 0;
+  std::vector<std::pair<RigidTransformd, double>> views;
+  for (Tile& tile : tiles) {
+    if (!tile.drawn) continue;
+    tile.u0 = width;
+    width += tile.camera->width;
+    height = std::max(height, tile.camera->height);
+    views.emplace_back(*tile.X_WC, FocalLength(*tile.camera));
+  }
+  SelectLevelsOfDetail(views);
+
+  TiledPipeline& p = *combined_pipeline_;
+  for (int i = 0; i < kNumPipelines; ++i) {
+    const Tile& tile = tiles[i];
+    vtkRenderer* renderer = p.renderers[i].Get();
+    renderer->RemoveAllViewProps();
+    if (!tile.drawn) {
+      renderer->DrawOff();
+      continue;
+    }
+    renderer->DrawOn();
+    vtkActorCollection* actors = pipelines_[i]->renderer->GetActors();
+    vtkCollectionSimpleIterator iter;
+    actors->InitTraversal(iter);
+    while (vtkActor* actor = actors->GetNextActor(iter)) {
+      renderer->AddActor(actor);
+    }
+
+    // The tiles are aligned with the top of the window, whereas the
+    // viewport's origin is its bottom-left corner.
+    renderer->SetViewport(
+        static_cast<double>(tile.u0) / width,
+        1. - static_cast<double>(tile.camera->height) / height,
+        static_cast<double>(tile.u0 + tile.camera->width) / width, 1.);
+    vtkCamera* camera = renderer->GetActiveCamera();
+    camera->SetViewAngle(tile.camera->fov_y * 180 / M_PI);
+    camera->SetClippingRange(kClippingPlaneNear, tile.z_far);
+    SetModelTransformMatrixToVtkCamera(camera,
+                                       ConvertToVtkTransform(*tile.X_WC));
+  }
+
+  if (depth_image_out != nullptr) {
+    uniform_setting_callback_->set_z_near(kClippingPlaneNear);
+    uniform_setting_callback_->set_z_far(
+        static_cast<float>(depth_camera.z_far));
+  }
+
+  p.window->SetSize(width, height);
+  p.window->Render();
+  p.filter->Modified();
+  p.filter->Update();
+
+  const RgbaBufferView image(p.exporter.Get(), width, height);
+  if (color_image_out != nullptr) {
+    CopyColorImage(image, tiles[ImageType::kColor].u0, 0, color_image_out);
+  }
+  if (label_image_out != nullptr) {
+    DecodeLabelImage(image, tiles[ImageType::kLabel].u0, 0, color_camera,
+                     label_image_out);
+  }
+  if (depth_image_out != nullptr) {
+    DecodeDepthImage(image, tiles[ImageType::kDepth].u0, 0, depth_camera,
+                     depth_image_out);
+  }
+}
+
+void RenderEngineVtk::RenderTiles(
+    int image_type, const TileGroup& group,
+    const std::vector<RigidTransformd>& X_WCs) {
+  vtkRenderer* source = pipelines_[image_type]->renderer.Get();
+  TiledPipeline& p = *tiled_pipelines_[image_type];
+  const int num_views = static_cast<int>(group.views.size());
+  const int cols = NumTileColumns(num_views);
+  const int rows = NumTileRows(num_views);
+
+  while (static_cast<int>(p.renderers.size()) < num_views) {
+    auto renderer = vtkSmartPointer<vtkRenderer>::New();
+    renderer->SetBackground(source->GetBackground());
+    renderer->SetUseDepthPeeling(source->GetUseDepthPeeling());
+    renderer->SetUseFXAA(source->GetUseFXAA());
+    p.window->AddRenderer(renderer);
+    p.renderers.push_back(renderer);
+  }
+
+  std::vector<std::pair<RigidTransformd, double>> views;
+  for (int k = 0; k < num_views; ++k) {
+    views.emplace_back(X_WCs[group.views[k]],
+                       group.height / (2 * std::tan(group.fov_ys[k] / 2)));
+  }
+  SelectLevelsOfDetail(views);
+
+  vtkActorCollection* actors = source->GetActors();
+  for (int k = 0; k < static_cast<int>(p.renderers.size()); ++k) {
+    vtkRenderer* renderer = p.renderers[k].Get();
+    renderer->RemoveAllViewProps();
+    if (k >= num_views) {
+      renderer->DrawOff();
+      continue;
+    }
+    renderer->DrawOn();
+    vtkCollectionSimpleIterator iter;
+    actors->InitTraversal(iter);
+    while (vtkActor* actor = actors->GetNextActor(iter)) {
+      renderer->AddActor(actor);
+    }
+
+    // The viewport's origin is its bottom-left corner, whereas the tiles are
+    // numbered from the top-left corner of the image.
+    const double col = k % cols;
+    const double row = k / cols;
+    renderer->SetViewport(col / cols, 1. - (row + 1) / rows, (col + 1) / cols,
+                          1. - row / rows);
+    vtkCamera* camera = renderer->GetActiveCamera();
+    camera->SetViewAngle(group.fov_ys[k] * 180 / M_PI);
+    camera->SetClippingRange(kClippingPlaneNear, group.z_far);
+    SetModelTransformMatrixToVtkCamera(
+        camera, ConvertToVtkTransform(X_WCs[group.views[k]]));
+  }
+
+  if (image_type == ImageType::kDepth) {
+    uniform_setting_callback_->set_z_near(kClippingPlaneNear);
+    uniform_setting_callback_->set_z_far(static_cast<float>(group.z_far));
+  }
+
+  p.window->SetSize(cols * group.width, rows * group.height);
+  p.window->Render();
+  p.filter->Modified();
+  p.filter->Update();
+}
+
+template <typename RgbaImage>
+void RenderEngineVtk::DecodeLabelImage(const RgbaImage& image, int u0, int v0,
+                                       const CameraProperties& camera,
+                                       ImageLabel16I* label_image_out) {
+  ColorI color;
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const uint8_t* pixel = image.at(u0 + u, v0 + v);
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
+      label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
+    }
+  }
 }
 
 void RenderEngineVtk::PerformVtkUpdate(const RenderingPipeline& p) {
@@ -573,6 +1102,44 @@ void RenderEngineVtk::UpdateWindow(const CameraProperties& camera,
   p->renderer->GetActiveCamera()->SetViewAngle(camera.fov_y * 180 / M_PI);
 }
 
+void RenderEngineVtk::SelectLevelsOfDetail(
+    const std::vector<std::pair<RigidTransformd, double>>& views) const {
+  for (const auto& [id, lod] : levels_of_detail_) {
+    // The largest area, in pixels, of the image of the bounding sphere. (The
+    // sphere covers the whole image of a camera inside it.)
+    const Vector3d p_WS = lod.X_WG * lod.p_GS;
+    double max_area = 0;
+    for (const auto& [X_WC, focal_length] : views) {
+      const double distance = (p_WS - X_WC.translation()).norm();
+      if (distance <= lod.radius) {
+        max_area = std::numeric_limits<double>::infinity();
+        break;
+      }
+      const double image_radius = focal_length * lod.radius / distance;
+      max_area = std::max(max_area, M_PI * image_radius * image_radius);
+    }
+
+    // The coarsest level with a triangle per pixels_per_triangle pixels of
+    // that area, or the full mesh if no level has enough triangles.
+    const double num_faces_needed = max_area / lod.pixels_per_triangle;
+    int selected = 0;
+    for (int k = static_cast<int>(lod.num_faces.size()) - 1; k > 0; --k) {
+      if (lod.num_faces[k] >= num_faces_needed) {
+        selected = k;
+        break;
+      }
+    }
+    for (const auto& actor : actors_.at(id)) {
+      actor->SetVisibility(selected == 0);
+    }
+    for (int k = 1; k < static_cast<int>(lod.num_faces.size()); ++k) {
+      for (const auto& actor : lod.actors[k - 1]) {
+        actor->SetVisibility(selected == k);
+      }
+    }
+  }
+}
+
 void RenderEngineVtk::UpdateWindow(const DepthCameraProperties& camera,
                                    const RenderingPipeline* p) const {
   p->renderer->GetActiveCamera()->SetClippingRange(kClippingPlaneNear,
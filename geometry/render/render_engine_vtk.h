@@ -4,14 +4,15 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <vtkActor.h>
+#include <vtkAlgorithm.h>
 #include <vtkAutoInit.h>
 #include <vtkCommand.h>
 #include <vtkImageExport.h>
 #include <vtkNew.h>
-#include <vtkPolyDataAlgorithm.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
 #include <vtkShaderProgram.h>
@@ -116,6 +117,11 @@ class RenderEngineVtk final : public RenderEngine,
       const DepthCameraProperties& camera,
       systems::sensors::ImageDepth32F* depth_image_out) const final;
 
+  /** @see RenderEngine::RenderDepthImage().  */
+  void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth16U* depth_image_out) const final;
+
   /** @see RenderEngine::RenderLabelImage().  */
   void RenderLabelImage(
       const CameraProperties& camera, bool show_window,
@@ -159,6 +165,40 @@ class RenderEngineVtk final : public RenderEngine,
   // @see RenderEngine::DoClone().
   std::unique_ptr<RenderEngine> DoClone() const final;
 
+  // Renders all of the views of the same image size into a single window; see
+  // RenderTiles().
+  // @see RenderEngine::DoRenderColorImages().
+  void DoRenderColorImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageRgba8U*>& color_images_out)
+      final;
+
+  // @see RenderEngine::DoRenderDepthImages().
+  void DoRenderDepthImages(
+      const std::vector<DepthCameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageDepth32F*>& depth_images_out)
+      final;
+
+  // @see RenderEngine::DoRenderLabelImages().
+  void DoRenderLabelImages(
+      const std::vector<CameraProperties>& cameras,
+      const std::vector<math::RigidTransformd>& X_WCs,
+      const std::vector<systems::sensors::ImageLabel16I*>& label_images_out)
+      final;
+
+  // Renders the requested images with a single render of the window of the
+  // combined pipeline.
+  // @see RenderEngine::DoRenderImages().
+  void DoRenderImages(
+      const CameraProperties& color_camera, const math::RigidTransformd& X_WC,
+      const DepthCameraProperties& depth_camera,
+      const math::RigidTransformd& X_WD,
+      systems::sensors::ImageRgba8U* color_image_out,
+      systems::sensors::ImageDepth32F* depth_image_out,
+      systems::sensors::ImageLabel16I* label_image_out) final;
+
   // Copy constructor for the purpose of cloning.
   RenderEngineVtk(const RenderEngineVtk& other);
 
@@ -166,12 +206,12 @@ class RenderEngineVtk final : public RenderEngine,
   void InitializePipelines();
 
   // Common interface for loading an obj file -- used for both mesh and convex
-  // shapes.
+  // shapes. The mesh's levels of detail, if it has any, are loaded too.
   void ImplementObj(const std::string& file_name, double scale,
                     void* user_data);
 
   // Performs the common setup for all shape types.
-  void ImplementGeometry(vtkPolyDataAlgorithm* source, void* user_data);
+  void ImplementGeometry(vtkAlgorithm* source, void* user_data);
 
   // The rendering pipeline for a single image type (color, depth, or label).
   struct RenderingPipeline {
@@ -181,6 +221,49 @@ class RenderEngineVtk final : public RenderEngine,
     vtkNew<vtkImageExport> exporter;
   };
 
+  // The pipeline for rendering several views of a single image type at once.
+  // Each view is rendered by its own renderer, into its own tile (i.e.,
+  // viewport) of the window, and the whole window is read back at once. The
+  // renderers share the actors of the corresponding RenderingPipeline; they
+  // are created as needed, and those that are not needed are not drawn.
+  struct TiledPipeline {
+    vtkNew<vtkRenderWindow> window;
+    std::vector<vtkSmartPointer<vtkRenderer>> renderers;
+    vtkNew<vtkWindowToImageFilter> filter;
+    vtkNew<vtkImageExport> exporter;
+  };
+
+  // The views of a batch that are rendered together, by RenderTiles().
+  struct TileGroup {
+    int width{};
+    int height{};
+    // The far clipping plane of every view.
+    double z_far{};
+    // The indices of the views in the batch, and their fields of view.
+    std::vector<int> views;
+    std::vector<double> fov_ys;
+  };
+
+  // Renders the views of the given `group` into the tiles of the window of the
+  // tiled pipeline of the given image type; the image of the whole window is
+  // left in the buffer of the pipeline's exporter. The k'th view of the group
+  // is rendered by a camera with the pose X_WCs[group.views[k]] into the k'th
+  // tile, in row-major order, of a grid with ceil(sqrt(group.views.size()))
+  // columns.
+  void RenderTiles(
+      int image_type, const TileGroup& group,
+      const std::vector<math::RigidTransformd>& X_WCs);
+
+  // Decodes the label image of the given `camera` from the label colors in
+  // the camera-sized block of `image` whose top-left pixel is (u0, v0).
+  // `image` is any image of RGBA pixels of uint8_t channels, accessed through
+  // at(u, v).
+  template <typename RgbaImage>
+  static void DecodeLabelImage(
+      const RgbaImage& image, int u0, int v0,
+      const CameraProperties& camera,
+      systems::sensors::ImageLabel16I* label_image_out);
+
   // Updates VTK rendering related objects including vtkRenderWindow,
   // vtkWindowToImageFilter and vtkImageExporter, so that VTK reflects
   // vtkActors' pose update for rendering.
@@ -195,11 +278,50 @@ class RenderEngineVtk final : public RenderEngine,
   void UpdateWindow(const DepthCameraProperties& camera,
                     const RenderingPipeline* p) const;
 
+  // Shows, for each geometry with levels of detail, the coarsest level that
+  // has enough triangles for the largest of its images in the given views,
+  // and hides the others. Each view is seen by a camera with the given pose
+  // X_WC and focal length (in pixels).
+  void SelectLevelsOfDetail(
+      const std::vector<std::pair<math::RigidTransformd, double>>& views)
+      const;
+
   // Three pipelines: rgb, depth, and label.
   static constexpr int kNumPipelines = 3;
 
+  // Creates the actors of the geometry described by the RegistrationData
+  // `user_data`, whose polygonal data comes from `source`, and adds them to the
+  // pipelines.
+  std::array<vtkSmartPointer<vtkActor>, kNumPipelines> MakeActors(
+      vtkAlgorithm* source, void* user_data);
+
+  // The simplified levels of detail of a mesh; see
+  // @ref render_engine_vtk_properties "the properties". Level 0 is the full
+  // mesh, whose actors are those of actors_.
+  struct LevelsOfDetail {
+    // The actors of the levels 1, 2, ..., from the finest to the coarsest.
+    std::vector<std::array<vtkSmartPointer<vtkActor>, kNumPipelines>> actors;
+    // The number of triangles of each level, starting with level 0.
+    std::vector<int> num_faces;
+    // The center S and the radius of a sphere that bounds the mesh, in the
+    // geometry's frame G.
+    Eigen::Vector3d p_GS;
+    double radius{};
+    double pixels_per_triangle{};
+    math::RigidTransformd X_WG;
+  };
+
   std::array<std::unique_ptr<RenderingPipeline>, kNumPipelines> pipelines_;
 
+  // The pipelines of the batched render methods, one per image type.
+  std::array<std::unique_ptr<TiledPipeline>, kNumPipelines> tiled_pipelines_;
+
+  // The pipeline of DoRenderImages(). Its window has one tile per image type,
+  // side by side, whose renderers (indexed by image type) share the actors of
+  // the corresponding RenderingPipeline, so that the three images are drawn
+  // by a single render of the window and read back at once.
+  std::unique_ptr<TiledPipeline> combined_pipeline_;
+
   // By design, all of the geometry is shared across clones of the render
   // engine. This is predicated upon the idea that the geometry is *not*
   // deformable and does *not* depend on the system's pose information.
@@ -226,6 +348,12 @@ class RenderEngineVtk final : public RenderEngine,
   // depth, and label) keyed by the geometry's GeometryId.
   std::unordered_map<GeometryId, std::array<vtkSmartPointer<vtkActor>, 3>>
       actors_;
+
+  // The levels of detail of the meshes that have them.
+  std::unordered_map<GeometryId, LevelsOfDetail> levels_of_detail_;
+
+  // The pose of the camera of the render methods in the world frame.
+  math::RigidTransformd X_WC_;
 };
 
 }  // namespace render
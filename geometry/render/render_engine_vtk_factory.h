@@ -69,6 +69,25 @@ struct RenderEngineVtkParams  {
  values for this default label and the ramifications of that choice are
  documented @ref render_engine_default_label "here".
 
+ <h3>Levels of detail</h3>
+
+ | Group name | Property Name       | Required | Property Type | Property Description |
+ | :--------: | :-----------------: | :------: | :-----------: | :------------------- |
+ |    lod     | num_levels          | no⁶      | int           | The number of simplified levels of detail of a mesh. |
+ |    lod     | reduction           | no       | double        | The fraction of the triangles of each level that the next one keeps, in the range (0, 1). Defaults to 0.25. |
+ |    lod     | pixels_per_triangle | no       | double        | The largest image area, in pixels, per triangle of the rendered level. Defaults to 10. |
+
+ ⁶ A Mesh or Convex with a positive number of levels is simplified, when it is
+ registered, into that many coarser meshes by quadric edge collapse. Since
+ simplification is expensive, the levels are saved next to the mesh file, as
+ `/path/to/mesh.lod<k>.obj`, and reused by later registrations (in this
+ process or others) until the mesh file changes. Each render draws the
+ coarsest level that has at least one triangle per `pixels_per_triangle`
+ pixels of the projected area of the mesh's bounding sphere, or the full mesh
+ if no level has that many; the batched render methods use the finest level
+ required by any of their views. Textured meshes are always drawn in full,
+ since the simplified levels have no texture coordinates.
+
  <h3>Geometries accepted by %RenderEngineVtk</h3>
 
  As documented in RenderEngine::RegisterVisual(), a RenderEngine implementation
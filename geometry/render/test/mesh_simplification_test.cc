@@ -0,0 +1,232 @@
+#include "drake/geometry/render/mesh_simplification.h"
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+// Makes a closed unit sphere of `num_longitude` slices and `num_latitude`
+// stacks, whose poles are single vertices.
+SurfaceMesh<double> MakeSphere(int num_longitude, int num_latitude) {
+  std::vector<SurfaceVertex<double>> vertices;
+  vertices.emplace_back(Vector3d(0, 0, 1));
+  for (int i = 1; i < num_latitude; ++i) {
+    const double theta = M_PI * i / num_latitude;
+    for (int j = 0; j < num_longitude; ++j) {
+      const double phi = 2 * M_PI * j / num_longitude;
+      vertices.emplace_back(Vector3d(std::sin(theta) * std::cos(phi),
+                                     std::sin(theta) * std::sin(phi),
+                                     std::cos(theta)));
+    }
+  }
+  vertices.emplace_back(Vector3d(0, 0, -1));
+  const int south = static_cast<int>(vertices.size()) - 1;
+  auto ring = [num_longitude](int i, int j) {
+    return 1 + (i - 1) * num_longitude + j % num_longitude;
+  };
+
+  std::vector<SurfaceFace> faces;
+  auto add_face = [&faces](int a, int b, int c) {
+    const int v[3] = {a, b, c};
+    faces.emplace_back(v);
+  };
+  for (int j = 0; j < num_longitude; ++j) {
+    add_face(0, ring(1, j), ring(1, j + 1));
+    add_face(south, ring(num_latitude - 1, j + 1), ring(num_latitude - 1, j));
+    for (int i = 1; i + 1 < num_latitude; ++i) {
+      add_face(ring(i, j), ring(i + 1, j), ring(i + 1, j + 1));
+      add_face(ring(i, j), ring(i + 1, j + 1), ring(i, j + 1));
+    }
+  }
+  return SurfaceMesh<double>(std::move(faces), std::move(vertices));
+}
+
+// Makes a flat unit square in the z = 0 plane, centered on the origin, as an
+// n x n grid of pairs of triangles.
+SurfaceMesh<double> MakeSquareGrid(int n) {
+  std::vector<SurfaceVertex<double>> vertices;
+  for (int i = 0; i <= n; ++i) {
+    for (int j = 0; j <= n; ++j) {
+      vertices.emplace_back(Vector3d(double(j) / n - 0.5, double(i) / n - 0.5,
+                                     0));
+    }
+  }
+  std::vector<SurfaceFace> faces;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const int a = i * (n + 1) + j;
+      const int b = a + 1;
+      const int c = a + n + 2;
+      const int d = a + n + 1;
+      const int first[3] = {a, b, c};
+      const int second[3] = {a, c, d};
+      faces.emplace_back(first);
+      faces.emplace_back(second);
+    }
+  }
+  return SurfaceMesh<double>(std::move(faces), std::move(vertices));
+}
+
+double TotalArea(const SurfaceMesh<double>& mesh) {
+  double area = 0;
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    area += mesh.area(f);
+  }
+  return area;
+}
+
+// Returns true if every edge of the mesh is shared by exactly two triangles,
+// in opposite directions.
+bool IsClosedManifold(const SurfaceMesh<double>& mesh) {
+  std::map<std::pair<int, int>, int> directed_edge_counts;
+  for (SurfaceFaceIndex f(0); f < mesh.num_faces(); ++f) {
+    for (int i = 0; i < 3; ++i) {
+      const int a = mesh.element(f).vertex(i);
+      const int b = mesh.element(f).vertex((i + 1) % 3);
+      ++directed_edge_counts[{a, b}];
+    }
+  }
+  for (const auto& edge_count : directed_edge_counts) {
+    const auto& edge = edge_count.first;
+    if (edge_count.second != 1) return false;
+    if (directed_edge_counts.count({edge.second, edge.first}) != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A sphere keeps its shape and topology as it is simplified by a factor of
+// ten.
+GTEST_TEST(SimplifyMeshTest, Sphere) {
+  const SurfaceMesh<double> sphere = MakeSphere(40, 20);
+  ASSERT_EQ(sphere.num_faces(), 2 * 40 * 19);
+  ASSERT_TRUE(IsClosedManifold(sphere));
+
+  const int target = sphere.num_faces() / 10;
+  const SurfaceMesh<double> simplified = SimplifyMesh(sphere, target);
+  EXPECT_LE(simplified.num_faces(), target);
+  EXPECT_GT(simplified.num_faces(), target / 2);
+  EXPECT_TRUE(IsClosedManifold(simplified));
+  for (SurfaceVertexIndex v(0); v < simplified.num_vertices(); ++v) {
+    EXPECT_NEAR(simplified.vertex(v).r_MV().norm(), 1.0, 0.05);
+  }
+  // The triangles still face outward.
+  for (SurfaceFaceIndex f(0); f < simplified.num_faces(); ++f) {
+    const Vector3d p =
+        simplified.vertex(simplified.element(f).vertex(0)).r_MV();
+    EXPECT_GT(simplified.face_normal(f).dot(p), 0);
+  }
+  EXPECT_NEAR(TotalArea(simplified), TotalArea(sphere), 0.1 * 4 * M_PI);
+}
+
+// The outline of an open mesh is kept, so that a flat grid is simplified to a
+// handful of triangles that cover the same square.
+GTEST_TEST(SimplifyMeshTest, FlatGrid) {
+  const SurfaceMesh<double> grid = MakeSquareGrid(10);
+  const SurfaceMesh<double> simplified = SimplifyMesh(grid, 2);
+  EXPECT_LE(simplified.num_faces(), 8);
+  EXPECT_NEAR(TotalArea(simplified), 1.0, 1e-10);
+  for (SurfaceVertexIndex v(0); v < simplified.num_vertices(); ++v) {
+    const Vector3d& p = simplified.vertex(v).r_MV();
+    EXPECT_NEAR(p.z(), 0, 1e-10);
+    EXPECT_LE(p.cwiseAbs().maxCoeff(), 0.5 + 1e-10);
+  }
+}
+
+// A tetrahedron can't lose any of its triangles without degenerating.
+GTEST_TEST(SimplifyMeshTest, Tetrahedron) {
+  std::vector<SurfaceVertex<double>> vertices{
+      SurfaceVertex<double>(Vector3d(0, 0, 0)),
+      SurfaceVertex<double>(Vector3d(1, 0, 0)),
+      SurfaceVertex<double>(Vector3d(0, 1, 0)),
+      SurfaceVertex<double>(Vector3d(0, 0, 1))};
+  std::vector<SurfaceFace> faces;
+  for (const auto& face : {std::array<int, 3>{0, 2, 1},
+                           std::array<int, 3>{0, 1, 3},
+                           std::array<int, 3>{0, 3, 2},
+                           std::array<int, 3>{1, 2, 3}}) {
+    faces.emplace_back(face.data());
+  }
+  const SurfaceMesh<double> tetrahedron(std::move(faces), std::move(vertices));
+  const SurfaceMesh<double> simplified = SimplifyMesh(tetrahedron, 0);
+  EXPECT_EQ(simplified.num_faces(), 4);
+  EXPECT_TRUE(IsClosedManifold(simplified));
+}
+
+GTEST_TEST(LoadMeshLevelsOfDetailTest, LevelsAreComputedAndSaved) {
+  const std::string filename = temp_directory() + "/sphere.obj";
+  ASSERT_TRUE(WriteObj(MakeSphere(40, 20), "sphere", filename));
+
+  const auto levels = LoadMeshLevelsOfDetail(filename, 2, 0.25);
+  ASSERT_EQ(levels->size(), 2);
+  EXPECT_LE(levels->at(0).num_faces(), 2 * 40 * 19 / 4);
+  EXPECT_LE(levels->at(1).num_faces(), 2 * 40 * 19 / 16 + 1);
+  EXPECT_TRUE(IsClosedManifold(levels->at(1)));
+
+  // The levels are cached in the process.
+  EXPECT_EQ(LoadMeshLevelsOfDetail(filename, 2, 0.25), levels);
+
+  // The levels are saved next to the mesh.
+  const std::string level_name = temp_directory() + "/sphere.lod1.obj";
+  EXPECT_EQ(
+      geometry::internal::ReadObjToSurfaceMesh(level_name).num_faces(),
+      levels->at(0).num_faces());
+
+  // A saved level is loaded as is (rather than recomputed) when its header
+  // matches. To prove it, replace the saved level with a single triangle.
+  std::string header;
+  {
+    std::ifstream file(level_name);
+    std::getline(file, header);
+  }
+  {
+    std::ofstream file(level_name);
+    file << header << "\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+  }
+  EXPECT_EQ(LoadMeshLevelsOfDetail(filename, 1, 0.25)->at(0).num_faces(), 1);
+
+  // It is recomputed for a different reduction.
+  EXPECT_GT(LoadMeshLevelsOfDetail(filename, 1, 0.5)->at(0).num_faces(), 1);
+}
+
+// The levels stop when the mesh can't be simplified any further.
+GTEST_TEST(LoadMeshLevelsOfDetailTest, TooFewTriangles) {
+  const std::string filename = temp_directory() + "/octahedron.obj";
+  {
+    std::ofstream file(filename);
+    file << "v 1 0 0\nv -1 0 0\nv 0 1 0\nv 0 -1 0\nv 0 0 1\nv 0 0 -1\n"
+         << "f 1 3 5\nf 3 2 5\nf 2 4 5\nf 4 1 5\n"
+         << "f 3 1 6\nf 2 3 6\nf 4 2 6\nf 1 4 6\n";
+  }
+  const auto levels = LoadMeshLevelsOfDetail(filename, 5, 0.5);
+  ASSERT_EQ(levels->size(), 1);
+  EXPECT_EQ(levels->at(0).num_faces(), 4);
+}
+
+GTEST_TEST(LoadMeshLevelsOfDetailTest, MissingFile) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMeshLevelsOfDetail("/no/such/mesh.obj", 1, 0.5),
+      std::runtime_error, "Cannot simplify the mesh '/no/such/mesh.obj'.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
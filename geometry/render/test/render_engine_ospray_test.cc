@@ -1,5 +1,6 @@
 #include "drake/geometry/render/render_engine_ospray.h"
 
+#include <algorithm>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -743,6 +744,78 @@ TEST_F(RenderEngineOsprayTest, UnsupportedLabelAndDepth) {
 // TODO(SeanCurtis-TRI): When we have a denoiser available, test this against
 //  the pathtracer configuraiton and samples value.
 
+// Confirms that, when path tracing, rendering passes accumulate while nothing
+// moves, that the complete image is then returned without rendering, and that
+// moving the camera or a geometry starts a new accumulation.
+TEST_F(RenderEngineOsprayTest, ProgressiveAccumulation) {
+  RenderEngineOsprayParams params;
+  params.mode = OsprayMode::kPathTracer;
+  params.max_accumulated_frames = 3;
+  // A zero time budget renders a single pass per image.
+  params.time_budget = 0.0;
+  RenderEngineOspray renderer(params);
+  InitializeRenderer(X_WC_, true, &renderer);
+  PopulateSphereTest(&renderer);
+  EXPECT_EQ(renderer.num_accumulated_frames(), 0);
+
+  ImageRgba8U color(camera_.width, camera_.height);
+  for (int i = 1; i <= params.max_accumulated_frames; ++i) {
+    Render(&renderer, &camera_, &color);
+    EXPECT_EQ(renderer.num_accumulated_frames(), i);
+  }
+
+  // The image is complete; it is returned as is, even when the (unchanged)
+  // poses are set again.
+  renderer.UpdateViewpoint(X_WC_);
+  renderer.UpdatePoses(X_WV_);
+  ImageRgba8U reused(camera_.width, camera_.height);
+  Render(&renderer, &camera_, &reused);
+  EXPECT_EQ(renderer.num_accumulated_frames(), 3);
+  EXPECT_TRUE(std::equal(color.at(0, 0), color.at(0, 0) + color.size(),
+                         reused.at(0, 0)));
+
+  // Moving the sphere starts over.
+  X_WV_[geometry_id_] = RigidTransformd{Vector3d{0, 0, 0.25}};
+  renderer.UpdatePoses(X_WV_);
+  Render(&renderer, &camera_, &color);
+  EXPECT_EQ(renderer.num_accumulated_frames(), 1);
+
+  // So does moving the camera.
+  Render(&renderer, &camera_, &color);
+  EXPECT_EQ(renderer.num_accumulated_frames(), 2);
+  renderer.UpdateViewpoint(
+      RigidTransformd{X_WC_.rotation(), Vector3d{0, 0, kDefaultDistance + 1}});
+  Render(&renderer, &camera_, &color);
+  EXPECT_EQ(renderer.num_accumulated_frames(), 1);
+
+  // Without a time budget, the image is complete after a single render.
+  params.time_budget = nullopt;
+  RenderEngineOspray unbudgeted(params);
+  InitializeRenderer(X_WC_, true, &unbudgeted);
+  PopulateSphereTest(&unbudgeted);
+  Render(&unbudgeted, &camera_, &color);
+  EXPECT_EQ(unbudgeted.num_accumulated_frames(), 3);
+
+  // The ray tracer's image is complete after a single pass.
+  params.mode = OsprayMode::kRayTracer;
+  RenderEngineOspray ray_tracer(params);
+  InitializeRenderer(X_WC_, true, &ray_tracer);
+  Render(&ray_tracer, &camera_, &color);
+  EXPECT_EQ(ray_tracer.num_accumulated_frames(), 1);
+  Render(&ray_tracer, &camera_, &color);
+  EXPECT_EQ(ray_tracer.num_accumulated_frames(), 1);
+}
+
+// Confirms that invalid progressive rendering budgets are rejected.
+TEST_F(RenderEngineOsprayTest, InvalidBudgets) {
+  RenderEngineOsprayParams params;
+  params.max_accumulated_frames = 0;
+  EXPECT_THROW(RenderEngineOspray{params}, std::exception);
+  params.max_accumulated_frames = 1;
+  params.time_budget = -1.0;
+  EXPECT_THROW(RenderEngineOspray{params}, std::exception);
+}
+
 }  // namespace
 }  // namespace render
 }  // namespace geometry
@@ -1,7 +1,9 @@
 #include "drake/geometry/render/render_engine.h"
 
+#include <limits>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -34,12 +36,17 @@ class RenderEngineTester {
 
 namespace {
 
+using Eigen::Vector3d;
 using geometry::internal::DummyRenderEngine;
 using math::RigidTransformd;
 using std::set;
 using std::unordered_map;
+using std::vector;
 using systems::sensors::ColorI;
 using systems::sensors::ColorD;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
 
 // Tests the RenderEngine-specific functionality for managing registration of
 // geometry and its corresponding update behavior. The former should configure
@@ -172,6 +179,90 @@ GTEST_TEST(RenderEngine, RemoveGeometry) {
   }
 }
 
+// Tests the validation of the inputs of the batched render methods, and that
+// their default implementation renders from every viewpoint.
+GTEST_TEST(RenderEngine, BatchedRendering) {
+  DummyRenderEngine engine;
+  const CameraProperties camera{2, 2, M_PI_2, "unused"};
+  const DepthCameraProperties depth_camera{2, 2, M_PI_2, "unused", 0.1, 2.0};
+  const vector<RigidTransformd> X_WCs{
+      RigidTransformd{Vector3d{1, 2, 3}}, RigidTransformd{Vector3d{4, 5, 6}}};
+  ImageRgba8U color(2, 2);
+  ImageDepth32F depth(2, 2);
+  ImageLabel16I label(2, 2);
+
+  engine.RenderColorImages({camera, camera}, X_WCs, {&color, &color});
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WCs[1].GetAsMatrix34()));
+  engine.RenderDepthImages({depth_camera}, {X_WCs[0]}, {&depth});
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WCs[0].GetAsMatrix34()));
+  engine.RenderLabelImages({camera, camera}, X_WCs, {&label, &label});
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WCs[1].GetAsMatrix34()));
+  // An empty batch is a no-op.
+  engine.RenderColorImages({}, {}, {});
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderColorImages({camera}, X_WCs, {&color}), std::logic_error,
+      "RenderEngine::RenderColorImages\\(\\): the number of cameras \\(1\\), "
+      "poses \\(2\\) and output images \\(1\\) must be the same");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderDepthImages({depth_camera, depth_camera}, X_WCs, {&depth}),
+      std::logic_error, ".*output images \\(1\\) must be the same");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderLabelImages({camera, camera}, X_WCs, {&label, nullptr}),
+      std::logic_error,
+      "RenderEngine::RenderLabelImages\\(\\): the output image 1 is null");
+}
+
+// Tests that the default implementation of RenderImages() renders each
+// requested image from the viewpoint of its camera.
+GTEST_TEST(RenderEngine, CombinedRendering) {
+  DummyRenderEngine engine;
+  const CameraProperties camera{2, 2, M_PI_2, "unused"};
+  const DepthCameraProperties depth_camera{2, 2, M_PI_2, "unused", 0.1, 2.0};
+  const RigidTransformd X_WC{Vector3d{1, 2, 3}};
+  const RigidTransformd X_WD{Vector3d{4, 5, 6}};
+  ImageRgba8U color(2, 2);
+  ImageDepth32F depth(2, 2);
+  ImageLabel16I label(2, 2);
+
+  // The depth image is rendered last, from its own viewpoint.
+  engine.RenderImages(camera, X_WC, depth_camera, X_WD, &color, &depth,
+                      &label);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WD.GetAsMatrix34()));
+  engine.RenderImages(camera, X_WC, depth_camera, X_WD, nullptr, nullptr,
+                      &label);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WC.GetAsMatrix34()));
+
+  // Requesting no image is a no-op.
+  engine.UpdateViewpoint(RigidTransformd::Identity());
+  engine.RenderImages(camera, X_WC, depth_camera, X_WD, nullptr, nullptr,
+                      nullptr);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              RigidTransformd::Identity().GetAsMatrix34()));
+}
+
+// Tests the conversion of depths from meters to the millimeters of the 16-bit
+// depth images.
+GTEST_TEST(RenderEngine, Depth16UConversion) {
+  const uint16_t kTooFar16 = systems::sensors::ImageDepth16U::Traits::kTooFar;
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(0.f), 0);
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(1.25f), 1250);
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(65.f), 65000);
+  // Depths that can't be represented saturate.
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(65.6f), kTooFar16);
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(
+                std::numeric_limits<float>::infinity()),
+            kTooFar16);
+  EXPECT_EQ(internal::ConvertDepth32FTo16U(
+                std::numeric_limits<float>::quiet_NaN()),
+            kTooFar16);
+}
+
 GTEST_TEST(RenderEngine, ColorLabelConversion) {
   // Explicitly testing labels at *both* ends of the reserved space -- this
   // assumes that the reserved labels are at the top end; if that changes, we'll
@@ -1,16 +1,23 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <map>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/render/camera_properties.h"
@@ -38,6 +45,7 @@ using std::vector;
 using systems::sensors::Color;
 using systems::sensors::ColorI;
 using systems::sensors::ColorD;
+using systems::sensors::ImageDepth16U;
 using systems::sensors::ImageDepth32F;
 using systems::sensors::ImageLabel16I;
 using systems::sensors::ImageRgba8U;
@@ -554,6 +562,28 @@ TEST_F(RenderEngineVtkTest, SphereTest) {
   PerformCenterShapeTest(renderer_.get(), "Sphere test");
 }
 
+// Tests that the 16-bit depth image, decoded directly from the rendered pixels,
+// holds the depths of the 32-bit one in millimeters.
+TEST_F(RenderEngineVtkTest, Depth16UTest) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  ImageDepth32F depth32(kWidth, kHeight);
+  ImageDepth16U depth16(kWidth, kHeight);
+  renderer_->RenderDepthImage(camera_, &depth32);
+  renderer_->RenderDepthImage(camera_, &depth16);
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      ASSERT_EQ(depth16.at(x, y)[0],
+                internal::ConvertDepth32FTo16U(depth32.at(x, y)[0]))
+          << "Depth at: (" << x << ", " << y << ")";
+    }
+  }
+  const ScreenCoord inlier = GetInlier(camera_);
+  EXPECT_NEAR(depth16.at(inlier.x, inlier.y)[0],
+              expected_object_depth_ * 1000, kDepthTolerance * 1000 + 1);
+}
+
 // Performs the shape-centered-in-the-image test with a sphere.
 TEST_F(RenderEngineVtkTest, TransparentSphereTest) {
   RenderEngineVtk renderer;
@@ -688,6 +718,100 @@ TEST_F(RenderEngineVtkTest, ImpliedTextureMeshTest) {
   PerformCenterShapeTest(renderer_.get(), "Implied textured mesh test");
 }
 
+// Writes the OBJ file of the cube [-1, 1]³ whose faces are each tessellated
+// into n x n squares. Its levels of detail have the same shape: the
+// tessellation is simplified without error.
+void WriteTessellatedCube(const std::string& filename, int n) {
+  std::map<std::array<int, 3>, int> indices;
+  std::string vertex_lines;
+  std::string face_lines;
+  // Returns the (1-based) index of the vertex of the given grid coordinates.
+  auto vertex = [&](const std::array<int, 3>& g) {
+    auto iter = indices.find(g);
+    if (iter != indices.end()) return iter->second;
+    vertex_lines += fmt::format("v {} {} {}\n", -1 + 2. * g[0] / n,
+                                -1 + 2. * g[1] / n, -1 + 2. * g[2] / n);
+    const int index = static_cast<int>(indices.size()) + 1;
+    indices[g] = index;
+    return index;
+  };
+  for (int a = 0; a < 3; ++a) {
+    const int u = (a + 1) % 3;
+    const int v = (a + 2) % 3;
+    for (int side : {0, n}) {
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+          std::array<int, 4> corners;
+          const int offsets[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+          for (int k = 0; k < 4; ++k) {
+            std::array<int, 3> g;
+            g[a] = side;
+            g[u] = i + offsets[k][0];
+            g[v] = j + offsets[k][1];
+            corners[k] = vertex(g);
+          }
+          // The corners are counterclockwise about +a; the face at side 0
+          // faces -a.
+          if (side == 0) std::swap(corners[1], corners[3]);
+          face_lines += fmt::format("f {} {} {}\nf {} {} {}\n", corners[0],
+                                    corners[1], corners[2], corners[0],
+                                    corners[2], corners[3]);
+        }
+      }
+    }
+  }
+  std::ofstream file(filename);
+  file << vertex_lines << face_lines;
+}
+
+// Confirms that a mesh with levels of detail renders like the full mesh. The
+// cube can be simplified without changing its shape, so the rendering doesn't
+// depend on the selected level; the large number of pixels per triangle
+// selects the coarsest one.
+TEST_F(RenderEngineVtkTest, MeshLevelsOfDetailTest) {
+  Init(X_WC_, true);
+
+  const std::string filename = temp_directory() + "/cube.obj";
+  WriteTessellatedCube(filename, 8);
+  Mesh mesh(filename);
+  expected_label_ = RenderLabel(5);
+  PerceptionProperties material = simple_material();
+  material.AddProperty("lod", "num_levels", 2);
+  material.AddProperty("lod", "pixels_per_triangle", 1e6);
+  const GeometryId id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(id, mesh, material, RigidTransformd::Identity(),
+                            true /* needs update */);
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {id, RigidTransformd::Identity()}});
+  PerformCenterShapeTest(renderer_.get(), "Mesh levels of detail test");
+
+  // The levels have been saved next to the mesh.
+  EXPECT_TRUE(std::ifstream(temp_directory() + "/cube.lod1.obj").good());
+  EXPECT_TRUE(std::ifstream(temp_directory() + "/cube.lod2.obj").good());
+
+  // The levels survive cloning.
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  PerformCenterShapeTest(dynamic_cast<RenderEngineVtk*>(clone.get()),
+                         "Cloned mesh levels of detail test");
+
+  // Removing the mesh removes its levels.
+  renderer_->RemoveGeometry(id);
+  ImageLabel16I label(camera_.width, camera_.height);
+  renderer_->RenderLabelImage(camera_, false, &label);
+  const ScreenCoord inlier = GetInlier(camera_);
+  EXPECT_EQ(label.at(inlier.x, inlier.y)[0],
+            static_cast<int>(RenderLabel::kDontCare));
+
+  // Bad parameters are reported.
+  material.AddProperty("lod", "reduction", 1.5);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer_->RegisterVisual(GeometryId::get_new_id(), mesh, material,
+                                RigidTransformd::Identity(), true),
+      std::logic_error,
+      "The levels of detail of the mesh .* must have a reduction in the range "
+      "\\(0, 1\\).*");
+}
+
 // This confirms that geometries are correctly removed from the render engine.
 // We add two new geometries (testing the rendering after each addition).
 // By removing the first of the added geometries, we can confirm that the
@@ -902,6 +1026,145 @@ TEST_F(RenderEngineVtkTest, DifferentCameras) {
   }
 }
 
+// Confirms that the batched render methods produce the same images as
+// rendering each camera in turn, for cameras with various sizes, fields of
+// view, poses and depth ranges (i.e., for views that share a window and views
+// that don't).
+TEST_F(RenderEngineVtkTest, BatchedRendering) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  DepthCameraProperties small_camera{camera_};
+  small_camera.width /= 2;
+  small_camera.height /= 2;
+  DepthCameraProperties narrow_fov{camera_};
+  narrow_fov.fov_y /= 2;
+  DepthCameraProperties clipping_far_plane{camera_};
+  clipping_far_plane.z_far = expected_outlier_depth_ - 0.1;
+  const RigidTransformd X_WC_shifted(X_WC_.rotation(),
+                                     X_WC_.translation() + Vector3d(0.2, 0, 0));
+
+  const vector<DepthCameraProperties> depth_cameras{
+      camera_, small_camera, narrow_fov, camera_, clipping_far_plane};
+  const vector<CameraProperties> cameras(depth_cameras.begin(),
+                                         depth_cameras.end());
+  const vector<RigidTransformd> X_WCs{X_WC_, X_WC_, X_WC_, X_WC_shifted,
+                                      X_WC_};
+  const int num_views = static_cast<int>(cameras.size());
+
+  vector<ImageRgba8U> colors;
+  vector<ImageDepth32F> depths;
+  vector<ImageLabel16I> labels;
+  for (const auto& camera : cameras) {
+    colors.emplace_back(camera.width, camera.height);
+    depths.emplace_back(camera.width, camera.height);
+    labels.emplace_back(camera.width, camera.height);
+  }
+  auto pointers = [](auto* images) {
+    vector<decltype(images->data())> result;
+    for (auto& image : *images) result.push_back(&image);
+    return result;
+  };
+  renderer_->RenderColorImages(cameras, X_WCs, pointers(&colors));
+  renderer_->RenderDepthImages(depth_cameras, X_WCs, pointers(&depths));
+  renderer_->RenderLabelImages(cameras, X_WCs, pointers(&labels));
+
+  for (int i = 0; i < num_views; ++i) {
+    const DepthCameraProperties& camera = depth_cameras[i];
+    ImageRgba8U color(camera.width, camera.height);
+    ImageDepth32F depth(camera.width, camera.height);
+    ImageLabel16I label(camera.width, camera.height);
+    renderer_->UpdateViewpoint(X_WCs[i]);
+    Render(renderer_.get(), &camera, &color, &depth, &label);
+
+    vector<ScreenCoord> coords = GetOutliers(camera);
+    coords.push_back(GetInlier(camera));
+    for (const ScreenCoord& coord : coords) {
+      EXPECT_TRUE(CompareColor(RgbaColor(color.at(coord.x, coord.y)),
+                               colors[i], coord))
+          << "Color of view " << i;
+    }
+    for (int y = 0; y < camera.height; ++y) {
+      for (int x = 0; x < camera.width; ++x) {
+        const float expected_depth = depth.at(x, y)[0];
+        if (std::isnan(expected_depth)) {
+          ASSERT_TRUE(std::isnan(depths[i].at(x, y)[0]));
+        } else {
+          ASSERT_TRUE(IsExpectedDepth(depths[i], {x, y}, expected_depth,
+                                      kDepthTolerance))
+              << "Depth of view " << i;
+        }
+        ASSERT_EQ(labels[i].at(x, y)[0], label.at(x, y)[0])
+            << "Label of view " << i << " at " << ScreenCoord{x, y};
+      }
+    }
+  }
+}
+
+// Confirms that RenderImages() produces the same images as the single-image
+// render methods, including when the depth camera differs from the color
+// camera in size, pose and depth range, and when only some images are
+// requested.
+TEST_F(RenderEngineVtkTest, CombinedRendering) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const CameraProperties color_camera{camera_};
+  DepthCameraProperties depth_camera{camera_};
+  depth_camera.width /= 2;
+  depth_camera.height /= 2;
+  depth_camera.z_far = expected_outlier_depth_ - 0.1;
+  const RigidTransformd X_WD(X_WC_.rotation(),
+                             X_WC_.translation() + Vector3d(0.2, 0, 0));
+
+  ImageRgba8U expected_color(color_camera.width, color_camera.height);
+  ImageLabel16I expected_label(color_camera.width, color_camera.height);
+  ImageDepth32F expected_depth(depth_camera.width, depth_camera.height);
+  renderer_->UpdateViewpoint(X_WC_);
+  renderer_->RenderColorImage(color_camera, kShowWindow, &expected_color);
+  renderer_->RenderLabelImage(color_camera, kShowWindow, &expected_label);
+  renderer_->UpdateViewpoint(X_WD);
+  renderer_->RenderDepthImage(depth_camera, &expected_depth);
+
+  ImageRgba8U color(color_camera.width, color_camera.height);
+  ImageLabel16I label(color_camera.width, color_camera.height);
+  ImageDepth32F depth(depth_camera.width, depth_camera.height);
+  auto check_images = [&](bool has_color, bool has_depth, bool has_label) {
+    renderer_->RenderImages(color_camera, X_WC_, depth_camera, X_WD,
+                            has_color ? &color : nullptr,
+                            has_depth ? &depth : nullptr,
+                            has_label ? &label : nullptr);
+    for (int y = 0; y < color_camera.height; ++y) {
+      for (int x = 0; x < color_camera.width; ++x) {
+        if (has_color) {
+          ASSERT_TRUE(CompareColor(RgbaColor(expected_color.at(x, y)), color,
+                                   {x, y}));
+        }
+        if (has_label) {
+          ASSERT_EQ(label.at(x, y)[0], expected_label.at(x, y)[0])
+              << "Label at " << ScreenCoord{x, y};
+        }
+      }
+    }
+    if (!has_depth) return;
+    for (int y = 0; y < depth_camera.height; ++y) {
+      for (int x = 0; x < depth_camera.width; ++x) {
+        const float expected = expected_depth.at(x, y)[0];
+        if (std::isnan(expected)) {
+          ASSERT_TRUE(std::isnan(depth.at(x, y)[0]));
+        } else {
+          ASSERT_TRUE(IsExpectedDepth(depth, {x, y}, expected,
+                                      kDepthTolerance));
+        }
+      }
+    }
+  };
+  check_images(true, true, true);
+  check_images(false, true, false);
+  check_images(true, false, true);
+  check_images(false, false, true);
+}
+
 // Tests the ability to configure the RenderEngineVtk's default render label.
 TEST_F(RenderEngineVtkTest, DefaultProperties_RenderLabel) {
   // A variation of PopulateSphereTest(), but uses an empty set of properties.
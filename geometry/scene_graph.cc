@@ -81,6 +81,19 @@ SceneGraph<T>::SceneGraph()
       "Cache guard for pose updates", &SceneGraph::CalcPoseUpdate,
       {this->all_input_ports_ticket()});
   pose_update_index_ = pose_update_cache_entry.cache_index();
+
+  // The engines of each role are only updated when a query of that role needs
+  // them.
+  proximity_pose_update_index_ =
+      this->DeclareCacheEntry("Cache guard for proximity pose updates",
+                              &SceneGraph::CalcProximityPoseUpdate,
+                              {pose_update_cache_entry.ticket()})
+          .cache_index();
+  perception_pose_update_index_ =
+      this->DeclareCacheEntry("Cache guard for perception pose updates",
+                              &SceneGraph::CalcPerceptionPoseUpdate,
+                              {pose_update_cache_entry.ticket()})
+          .cache_index();
 }
 
 template <typename T>
@@ -331,6 +344,16 @@ void SceneGraph<T>::ExcludeCollisionsBetween(Context<T>* context,
   g_state.ExcludeCollisionsBetween(setA, setB);
 }
 
+template <typename T>
+void SceneGraph<T>::set_max_num_threads(int max_num_threads) {
+  initial_state_->set_max_num_threads(max_num_threads);
+}
+
+template <typename T>
+int SceneGraph<T>::max_num_threads() const {
+  return initial_state_->max_num_threads();
+}
+
 template <typename T>
 void SceneGraph<T>::MakeSourcePorts(SourceId source_id) {
   // This will fail only if the source generator starts recycling source ids.
@@ -376,7 +399,7 @@ void SceneGraph<T>::CalcPoseBundle(const Context<T>& context,
   // That means, when computing the output, *any* frame with illustration
   // geometry will have a pose reported, even if those frames had not been
   // present during the corresponding visualization "initialization" call.
-  FullPoseUpdate(context);
+  KinematicsPoseUpdate(context);
   const auto& g_state = geometry_state(context);
 
   vector<FrameId> dynamic_frames =
@@ -404,7 +427,7 @@ template <typename T>
 std::vector<FrameId> SceneGraph<T>::GetDynamicFrames(
     const GeometryState<T>& g_state, Role role) const {
   vector<FrameId> dynamic_frames;
-  for (const auto& pair : g_state.frames_) {
+  for (const auto& pair : *g_state.frames_) {
     const FrameId frame_id = pair.first;
     if (frame_id == world_frame_id()) continue;
     if (g_state.NumGeometriesWithRole(frame_id, role) > 0) {
@@ -439,7 +462,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
   //   - sources with no frames.
   // The internal source will be included in source_frame_id_map_ but *not* in
   // input_source_ids_.
-  for (const auto& pair : state.source_frame_id_map_) {
+  for (const auto& pair : *state.source_frame_id_map_) {
     if (pair.second.size() > 0) {
       SourceId source_id = pair.first;
       const auto itr = input_source_ids_.find(source_id);
@@ -455,10 +478,27 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
     }
   }
 
-  mutable_state.FinalizePoseUpdate();
   // TODO(SeanCurtis-TRI): Add velocity as appropriate.
 }
 
+template <typename T>
+void SceneGraph<T>::CalcProximityPoseUpdate(const Context<T>& context,
+                                            int*) const {
+  KinematicsPoseUpdate(context);
+  // See CalcPoseUpdate() for the const cast.
+  const GeometryState<T>& state = geometry_state(context);
+  const_cast<GeometryState<T>&>(state).FinalizeProximityPoseUpdate();
+}
+
+template <typename T>
+void SceneGraph<T>::CalcPerceptionPoseUpdate(const Context<T>& context,
+                                             int*) const {
+  KinematicsPoseUpdate(context);
+  // See CalcPoseUpdate() for the const cast.
+  const GeometryState<T>& state = geometry_state(context);
+  const_cast<GeometryState<T>&>(state).FinalizePerceptionPoseUpdate();
+}
+
 template <typename T>
 void SceneGraph<T>::ThrowUnlessRegistered(SourceId source_id,
                                           const char* message) const {
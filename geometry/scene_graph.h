@@ -749,6 +749,27 @@ class SceneGraph final : public systems::LeafSystem<T> {
                                 const GeometrySet& setB) const;
   //@}
 
+  /** @name         Threading
+   These methods configure the number of threads used by the contexts
+   allocated after they are called.  */
+  //@{
+
+  /** Sets the maximum number of threads used to propagate the frame poses
+   provided on the input ports (the trees of frames rooted at the world frame
+   are updated concurrently in large scenes) and to evaluate the narrowphase
+   of the proximity queries. The results don't depend on the number of
+   threads. The default value is one (no threads are spawned).
+
+   This method modifies the underlying model and requires a new Context to be
+   allocated.
+
+   @throws std::exception if `max_num_threads` is less than one.  */
+  void set_max_num_threads(int max_num_threads);
+
+  /** Returns the value set by set_max_num_threads().  */
+  int max_num_threads() const;
+  //@}
+
  private:
   // Friend class to facilitate testing.
   friend class SceneGraphTester;
@@ -788,17 +809,47 @@ class SceneGraph final : public systems::LeafSystem<T> {
   std::vector<FrameId> GetDynamicFrames(const GeometryState<T>& g_state,
                                         Role role) const;
 
-  // Refreshes the pose of the various engines which exploits the caching
-  // infrastructure.
+  // Refreshes the poses of the frames and geometries, and of all of the
+  // engines, which exploits the caching infrastructure.
   void FullPoseUpdate(const systems::Context<T>& context) const {
+    ProximityPoseUpdate(context);
+    PerceptionPoseUpdate(context);
+  }
+
+  // Refreshes the poses of the frames and geometries (all that the
+  // illustration role needs), but not those of the engines.
+  void KinematicsPoseUpdate(const systems::Context<T>& context) const {
     this->get_cache_entry(pose_update_index_).template Eval<int>(context);
   }
 
+  // Refreshes the poses of the frames and geometries, and of the proximity
+  // engine.
+  void ProximityPoseUpdate(const systems::Context<T>& context) const {
+    this->get_cache_entry(proximity_pose_update_index_)
+        .template Eval<int>(context);
+  }
+
+  // Refreshes the poses of the frames and geometries, and of the render
+  // engines.
+  void PerceptionPoseUpdate(const systems::Context<T>& context) const {
+    this->get_cache_entry(perception_pose_update_index_)
+        .template Eval<int>(context);
+  }
+
   // Updates the state of geometry world from *all* the inputs. This is the calc
   // method for the corresponding cache entry. The entry *value* (the int) is
   // strictly a dummy -- the value is unimportant; only the side effect matters.
   void CalcPoseUpdate(const systems::Context<T>& context, int*) const;
 
+  // Pushes the updated poses to the proximity engine; the calc method of the
+  // (dummy) cache entry that depends on the pose update.
+  void CalcProximityPoseUpdate(const systems::Context<T>& context, int*) const;
+
+  // Pushes the updated poses to the render engines; the calc method of the
+  // (dummy) cache entry that depends on the pose update.
+  void CalcPerceptionPoseUpdate(const systems::Context<T>& context,
+                                int*) const;
+
   // Asserts the given source_id is registered, throwing an exception whose
   // message is the given message with the source_id appended if not.
   void ThrowUnlessRegistered(SourceId source_id, const char* message) const;
@@ -838,8 +889,12 @@ class SceneGraph final : public systems::LeafSystem<T> {
   // The index of the geometry state in the context's abstract state.
   int geometry_state_index_{-1};
 
-  // The cache index for the pose update cache entry.
+  // The cache indices for the pose update cache entries: that of the frames
+  // and geometries, and those of the engines of each role, which are only
+  // updated when a query of that role is made.
   systems::CacheIndex pose_update_index_{};
+  systems::CacheIndex proximity_pose_update_index_{};
+  systems::CacheIndex perception_pose_update_index_{};
 };
 
 }  // namespace geometry
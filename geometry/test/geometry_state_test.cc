@@ -64,32 +64,36 @@ class GeometryStateTester {
   }
 
   const unordered_map<SourceId, string>& get_source_name_map() const {
-    return state_->source_names_;
+    return *state_->source_names_;
   }
 
   const unordered_map<SourceId, FrameIdSet>& get_source_frame_id_map() const {
-    return state_->source_frame_id_map_;
+    return *state_->source_frame_id_map_;
   }
 
   const unordered_map<SourceId, FrameIdSet>& get_source_root_frame_map() const {
-    return state_->source_root_frame_map_;
+    return *state_->source_root_frame_map_;
   }
 
   const unordered_map<SourceId, unordered_set<GeometryId>>&
   get_source_anchored_geometry_map() const {
-    return state_->source_anchored_geometry_map_;
+    return *state_->source_anchored_geometry_map_;
   }
 
   const unordered_map<FrameId, InternalFrame>& get_frames() const {
-    return state_->frames_;
+    return *state_->frames_;
   }
 
   const unordered_map<GeometryId, InternalGeometry>& get_geometries() const {
-    return state_->geometries_;
+    return *state_->geometries_;
   }
 
   const vector<FrameId>& get_frame_index_id_map() const {
-    return state_->frame_index_to_id_map_;
+    return *state_->frame_index_to_id_map_;
+  }
+
+  const vector<vector<internal::FrameGeometry>>& get_frame_geometries() const {
+    return *state_->frame_geometries_;
   }
 
   const IdPoseMap<T>& get_geometry_world_poses() const {
@@ -815,6 +819,42 @@ TEST_F(GeometryStateTest, Transmogrify) {
   ExpectSuccessfulTransmogrification(ad_tester, gs_tester_);
 }
 
+// Copies of the state share their topology until one of them changes it.
+TEST_F(GeometryStateTest, CopySharesTopology) {
+  const SourceId s_id = SetUpSingleSourceTree(Assign::kProximity);
+  GeometryState<double> copy(geometry_state_);
+  GeometryStateTester<double> copy_tester;
+  copy_tester.set_state(&copy);
+  EXPECT_EQ(&copy_tester.get_frames(), &gs_tester_.get_frames());
+  EXPECT_EQ(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+
+  // Updating poses doesn't change the topology.
+  FramePoseVector<double> poses;
+  for (int i = 0; i < kFrameCount; ++i) poses.set_value(frames_[i], X_PFs_[i]);
+  copy_tester.SetFramePoses(s_id, poses);
+  copy_tester.FinalizePoseUpdate();
+  EXPECT_EQ(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+
+  // Adding geometry to the copy leaves the original alone.
+  const GeometryId added = copy.RegisterGeometry(
+      s_id, frames_[0],
+      make_unique<GeometryInstance>(RigidTransformd(), make_unique<Sphere>(1),
+                                    "added"));
+  EXPECT_NE(&copy_tester.get_geometries(), &gs_tester_.get_geometries());
+  EXPECT_EQ(copy.get_num_geometries(),
+            single_tree_total_geometry_count() + 1);
+  EXPECT_EQ(geometry_state_.get_num_geometries(),
+            single_tree_total_geometry_count());
+  EXPECT_EQ(copy.GetNumFrameGeometries(frames_[0]), kGeometryCount + 1);
+  EXPECT_EQ(geometry_state_.GetNumFrameGeometries(frames_[0]), kGeometryCount);
+  EXPECT_EQ(copy.GetFrameId(added), frames_[0]);
+
+  // Removing a role from the original leaves the copy alone.
+  geometry_state_.RemoveRole(s_id, geometries_[0], Role::kProximity);
+  EXPECT_EQ(geometry_state_.GetProximityProperties(geometries_[0]), nullptr);
+  EXPECT_NE(copy.GetProximityProperties(geometries_[0]), nullptr);
+}
+
 // Confirms that the actions of initializing the single-source tree leave the
 // geometry state in the expected configuration.
 TEST_F(GeometryStateTest, ValidateSingleSourceTree) {
@@ -1717,6 +1757,134 @@ TEST_F(GeometryStateTest, SetFramePoses) {
   }
 }
 
+// Frames whose poses are unchanged are skipped by SetFramePoses(); this
+// confirms that frames and geometries registered after the frames moved are
+// nevertheless posed correctly, and that a moving frame still moves its
+// children.
+TEST_F(GeometryStateTest, SetFramePosesSkipsUnchangedFrames) {
+  const SourceId s_id = SetUpSingleSourceTree();
+  const RigidTransformd offset{Translation3d{0, 1, 0}};
+  FramePoseVector<double> poses;
+  for (int i = 0; i < kFrameCount; ++i) poses.set_value(frames_[i], offset);
+  gs_tester_.SetFramePoses(s_id, poses);
+
+  // Frame f2 is the child of f1, so it is at 2 * offset.
+  const FrameId new_frame = geometry_state_.RegisterFrame(
+      s_id, frames_[2], GeometryFrame("new_frame"));
+  const RigidTransformd X_FG{Translation3d{1, 0, 0}};
+  const GeometryId new_geometry = geometry_state_.RegisterGeometry(
+      s_id, new_frame,
+      make_unique<GeometryInstance>(X_FG, make_unique<Sphere>(1), "new"));
+  const GeometryId f0_geometry = geometry_state_.RegisterGeometry(
+      s_id, frames_[0],
+      make_unique<GeometryInstance>(X_FG, make_unique<Sphere>(1), "f0_new"));
+  poses.set_value(new_frame, RigidTransformd::Identity());
+  gs_tester_.SetFramePoses(s_id, poses);
+  const auto& world_poses = gs_tester_.get_geometry_world_poses();
+  EXPECT_TRUE(CompareMatrices(
+      world_poses.at(new_geometry).GetAsMatrix34(),
+      (offset * offset * X_FG).GetAsMatrix34()));
+  EXPECT_TRUE(CompareMatrices(world_poses.at(f0_geometry).GetAsMatrix34(),
+                              (offset * X_FG).GetAsMatrix34()));
+
+  // Moving only f1 moves its descendants, and leaves f0 in place.
+  poses.clear();
+  poses.set_value(frames_[0], offset);
+  poses.set_value(frames_[1], RigidTransformd::Identity());
+  poses.set_value(frames_[2], offset);
+  poses.set_value(new_frame, RigidTransformd::Identity());
+  gs_tester_.SetFramePoses(s_id, poses);
+  EXPECT_TRUE(CompareMatrices(world_poses.at(new_geometry).GetAsMatrix34(),
+                              (offset * X_FG).GetAsMatrix34()));
+  EXPECT_TRUE(CompareMatrices(world_poses.at(f0_geometry).GetAsMatrix34(),
+                              (offset * X_FG).GetAsMatrix34()));
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(frames_[2]).GetAsMatrix34(),
+      offset.GetAsMatrix34()));
+}
+
+// With many root frames and more than one thread, the frame trees are posed
+// in parallel, with the same results.
+TEST_F(GeometryStateTest, SetFramePosesInParallel) {
+  const SourceId s_id = NewSource("parallel");
+  geometry_state_.set_max_num_threads(4);
+  EXPECT_EQ(geometry_state_.max_num_threads(), 4);
+  const int kRootCount = 100;
+  vector<FrameId> roots;
+  vector<FrameId> children;
+  vector<GeometryId> geometries;
+  const RigidTransformd X_FG{Translation3d{0, 0, 1}};
+  for (int i = 0; i < kRootCount; ++i) {
+    roots.push_back(geometry_state_.RegisterFrame(
+        s_id, GeometryFrame("root" + std::to_string(i))));
+    children.push_back(geometry_state_.RegisterFrame(
+        s_id, roots.back(), GeometryFrame("child" + std::to_string(i))));
+    geometries.push_back(geometry_state_.RegisterGeometry(
+        s_id, children.back(),
+        make_unique<GeometryInstance>(X_FG, make_unique<Sphere>(1),
+                                      "g" + std::to_string(i))));
+  }
+  FramePoseVector<double> poses;
+  for (int i = 0; i < kRootCount; ++i) {
+    poses.set_value(roots[i], RigidTransformd(Translation3d(i, 0, 0)));
+    poses.set_value(children[i], RigidTransformd(Translation3d(0, i, 0)));
+  }
+  gs_tester_.SetFramePoses(s_id, poses);
+  const auto& world_poses = gs_tester_.get_geometry_world_poses();
+  for (int i = 0; i < kRootCount; ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        world_poses.at(geometries[i]).translation(), Vector3d(i, i, 1)));
+  }
+}
+
+// The dense per-frame geometry lists used to pose the geometries mirror the
+// frames' child geometries (and the geometries' poses in their frames) through
+// registration on geometries and removal.
+TEST_F(GeometryStateTest, FrameGeometriesMirrorTopology) {
+  const SourceId s_id = SetUpSingleSourceTree(Assign::kProximity);
+  auto expect_mirrored = [this]() {
+    const auto& frame_geometries = gs_tester_.get_frame_geometries();
+    const auto& index_to_id = gs_tester_.get_frame_index_id_map();
+    ASSERT_EQ(frame_geometries.size(), index_to_id.size());
+    for (size_t i = 0; i < index_to_id.size(); ++i) {
+      const InternalFrame& frame = gs_tester_.get_frames().at(index_to_id[i]);
+      unordered_set<GeometryId> ids;
+      for (const auto& frame_geometry : frame_geometries[i]) {
+        ids.insert(frame_geometry.id);
+        EXPECT_TRUE(CompareMatrices(
+            frame_geometry.X_FG.GetAsMatrix34(),
+            gs_tester_.get_geometries().at(frame_geometry.id)
+                .X_FG().GetAsMatrix34()));
+      }
+      EXPECT_EQ(ids, frame.child_geometries());
+    }
+  };
+  expect_mirrored();
+
+  // A geometry hung from another geometry is posed in their common frame.
+  const GeometryId root_id = geometries_[0];
+  const FrameId f_id = frames_[0];
+  const RigidTransformd X_PG{Translation3d{0, 0, 2}};
+  const GeometryId g_id = geometry_state_.RegisterGeometryWithParent(
+      s_id, root_id,
+      make_unique<GeometryInstance>(X_PG, make_unique<Sphere>(1), "leaf"));
+  expect_mirrored();
+
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  gs_tester_.SetFramePoses(s_id, poses);
+  const RigidTransformd& X_WF = geometry_state_.get_pose_in_world(f_id);
+  EXPECT_TRUE(CompareMatrices(
+      gs_tester_.get_geometry_world_poses().at(g_id).GetAsMatrix34(),
+      (X_WF * X_FGs_[0] * X_PG).GetAsMatrix34(), 1e-14));
+
+  // Removing a geometry (and its child) removes them from the lists.
+  geometry_state_.RemoveGeometry(s_id, root_id);
+  expect_mirrored();
+}
+
 // Test various frame property queries.
 TEST_F(GeometryStateTest, QueryFrameProperties) {
   const SourceId s_id = SetUpSingleSourceTree();
@@ -3158,6 +3326,31 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
   expect_poses(render_engine_->updated_ids(), expected_ids);
 }
 
+// Confirms that a cloned render engine has the registered geometries and the
+// poses of the engine it was cloned from.
+TEST_F(GeometryStateTest, CloneRenderEngine) {
+  SetUpSingleSourceTree(Assign::kPerception);
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+
+  unique_ptr<render::RenderEngine> clone =
+      geometry_state_.CloneRenderEngine(kDummyRenderName);
+  const auto* dummy_clone = dynamic_cast<DummyRenderEngine*>(clone.get());
+  ASSERT_NE(dummy_clone, nullptr);
+  EXPECT_NE(dummy_clone, render_engine_);
+  EXPECT_EQ(dummy_clone->num_registered(), render_engine_->num_registered());
+  EXPECT_EQ(dummy_clone->updated_ids().size(),
+            render_engine_->updated_ids().size());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(geometry_state_.CloneRenderEngine("invalid"),
+                              std::logic_error,
+                              "No renderer exists with name: 'invalid'");
+}
+
 // The framework for testing the removal of roles, generally, parameterized on
 // the role type.
 class RemoveRoleTests : public GeometryStateTestBase,
@@ -1,6 +1,8 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cmath>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -178,6 +180,27 @@ GTEST_TEST(ProximityEngineTests, ExceptionTwoObjectsInObjFileForConvex) {
       std::runtime_error, ".*one and only one object.*");
 }
 
+// Tests that preloading skips the files that can't be read, whose errors are
+// reported when their shapes are added instead.
+GTEST_TEST(ProximityEngineTests, PreloadConvexFiles) {
+  const std::string good =
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const std::string bad =
+      drake::FindResourceOrThrow("drake/geometry/test/forbidden_two_cubes.obj");
+  ProximityEngine<double>::PreloadConvexFiles(
+      {good, bad, "invalid/path/thing.obj", good}, 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ProximityEngine<double>::PreloadConvexFiles({good}, 0),
+      std::exception, ".*num_threads >= 1.*");
+
+  ProximityEngine<double> engine;
+  engine.AddDynamicGeometry(Convex{good, 1.0}, GeometryId::get_new_id());
+  EXPECT_EQ(engine.num_dynamic(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.AddDynamicGeometry(Convex{bad, 1.0}, GeometryId::get_new_id()),
+      std::runtime_error, ".*one and only one object.*");
+}
+
 // Tests for copy/move semantics.  ---------------------------------------------
 
 // Tests the copy semantics of the ProximityEngine -- the copy is a complete,
@@ -331,6 +354,116 @@ GTEST_TEST(ProximityEngineTests, SignedDistanceClosestPointsMaxDistance) {
   }
 }
 
+// Confirms that the signed distance of a single pair matches the one reported
+// by the query over all pairs, and that unregistered geometries are rejected.
+GTEST_TEST(ProximityEngineTests, SignedDistancePairClosestPoints) {
+  ProximityEngine<double> engine;
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const GeometryId id_C = GeometryId::get_new_id();
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {id_A, RigidTransformd{Translation3d{0, 0, 0}}},
+      {id_B, RigidTransformd{Translation3d{2, 1, 0}}},
+      {id_C, RigidTransformd{Translation3d{0, 0, -1}}}};
+  engine.AddDynamicGeometry(Sphere{0.5}, id_A);
+  engine.AddDynamicGeometry(Box{0.5, 1, 1.5}, id_B);
+  engine.AddAnchoredGeometry(Sphere{0.25}, X_WGs.at(id_C), id_C);
+  engine.UpdateWorldPoses(X_WGs);
+
+  const std::vector<SignedDistancePair<double>> results_all =
+      engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, kInf);
+  ASSERT_EQ(results_all.size(), 3u);
+  for (const auto& expected : results_all) {
+    // The order of the ids doesn't matter.
+    const std::vector<SignedDistancePair<double>> results{
+        engine.ComputeSignedDistancePairClosestPoints(expected.id_A,
+                                                      expected.id_B, X_WGs),
+        engine.ComputeSignedDistancePairClosestPoints(expected.id_B,
+                                                      expected.id_A, X_WGs)};
+    for (const auto& result : results) {
+      EXPECT_EQ(result.id_A, expected.id_A);
+      EXPECT_EQ(result.id_B, expected.id_B);
+      EXPECT_EQ(result.distance, expected.distance);
+      EXPECT_TRUE(CompareMatrices(result.p_ACa, expected.p_ACa));
+      EXPECT_TRUE(CompareMatrices(result.p_BCb, expected.p_BCb));
+    }
+  }
+
+  EXPECT_THROW(engine.ComputeSignedDistancePairClosestPoints(
+                   id_A, GeometryId::get_new_id(), X_WGs),
+               std::logic_error);
+}
+
+// Confirms that the time of impact catches a small sphere that passes through
+// a larger one within the interval, even though the spheres are separated at
+// both ends of the interval.
+GTEST_TEST(ProximityEngineTests, TimeOfImpact) {
+  ProximityEngine<double> engine;
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const double radius_A = 0.5;
+  const double radius_B = 0.1;
+  engine.AddDynamicGeometry(Sphere{radius_A}, id_A);
+  engine.AddDynamicGeometry(Sphere{radius_B}, id_B);
+  const RigidTransformd X_WA{Translation3d{1, 2, 3}};
+  const double kTolerance = 1e-6;
+
+  // B moves from x = 5 to x = -5 relative to A, through A. The spheres touch
+  // when B's center is at x = radius_A + radius_B, i.e., at t = 0.44.
+  const RigidTransformd X_WB_start =
+      X_WA * RigidTransformd{Translation3d{5, 0, 0}};
+  const RigidTransformd X_WB_end =
+      X_WA * RigidTransformd{Translation3d{-5, 0, 0}};
+  const double expected_t = (5 - radius_A - radius_B) / 10;
+  const optional<double> t_AB = engine.ComputeTimeOfImpact(
+      id_A, id_B, X_WA, X_WA, X_WB_start, X_WB_end, kTolerance);
+  ASSERT_TRUE(t_AB.has_value());
+  EXPECT_LE(*t_AB, expected_t);
+  EXPECT_NEAR(*t_AB, expected_t, kTolerance);
+  // The order of the geometries doesn't matter.
+  const optional<double> t_BA = engine.ComputeTimeOfImpact(
+      id_B, id_A, X_WB_start, X_WB_end, X_WA, X_WA, kTolerance);
+  ASSERT_TRUE(t_BA.has_value());
+  EXPECT_NEAR(*t_BA, *t_AB, kTolerance);
+  // Moving both geometries by the same motion changes nothing.
+  const RigidTransformd X_WW1{RotationMatrixd::MakeZRotation(0.3),
+                              Vector3d{0, -4, 1}};
+  const optional<double> t_moved = engine.ComputeTimeOfImpact(
+      id_A, id_B, X_WA, X_WW1 * X_WA, X_WB_start, X_WW1 * X_WB_end,
+      kTolerance);
+  ASSERT_TRUE(t_moved.has_value());
+  EXPECT_NEAR(*t_moved, *t_AB, kTolerance);
+
+  // B passes by A, at a distance of 0.4 at the closest.
+  const RigidTransformd X_AB_offset{Translation3d{0, 1, 0}};
+  EXPECT_FALSE(engine
+                   .ComputeTimeOfImpact(id_A, id_B, X_WA, X_WA,
+                                        X_WB_start * X_AB_offset,
+                                        X_WB_end * X_AB_offset, kTolerance)
+                   .has_value());
+
+  // B stops short of A.
+  EXPECT_FALSE(engine
+                   .ComputeTimeOfImpact(
+                       id_A, id_B, X_WA, X_WA, X_WB_start,
+                       X_WA * RigidTransformd{Translation3d{1, 0, 0}},
+                       kTolerance)
+                   .has_value());
+
+  // The spheres already touch at the start.
+  const optional<double> t_start = engine.ComputeTimeOfImpact(
+      id_A, id_B, X_WA, X_WA, X_WA, X_WB_end, kTolerance);
+  ASSERT_TRUE(t_start.has_value());
+  EXPECT_EQ(*t_start, 0);
+
+  EXPECT_THROW(engine.ComputeTimeOfImpact(id_A, GeometryId::get_new_id(), X_WA,
+                                          X_WA, X_WA, X_WA, kTolerance),
+               std::logic_error);
+  EXPECT_THROW(engine.ComputeTimeOfImpact(id_A, id_B, X_WA, X_WA, X_WB_start,
+                                          X_WB_end, 0.0),
+               std::exception);
+}
+
 // ComputeSignedDistanceToPoint tests
 
 // Test the broad-phase part of ComputeSignedDistanceToPoint.
@@ -451,6 +584,111 @@ GTEST_TEST(SignedDistanceToPointBroadphaseTest, MultipleThreshold) {
   EXPECT_EQ(2, results.size());
 }
 
+// Confirms that the batched query reports, for each point, the same distances
+// as the single-point query, on one or more threads.
+GTEST_TEST(SignedDistanceToPointBroadphaseTest, BatchMatchesSinglePoint) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  X_WGs[sphere_id] = RigidTransformd(Translation3d{0.5, 0, 0});
+  engine.AddDynamicGeometry(Sphere(0.25), sphere_id);
+  const GeometryId box_id = GeometryId::get_new_id();
+  X_WGs[box_id] = RigidTransformd(RollPitchYawd(0.1, 0.2, 0.3),
+                                  Vector3d(-0.5, 0.2, 0.1));
+  engine.AddDynamicGeometry(Box(0.2, 0.3, 0.4), box_id);
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  X_WGs[anchored_id] = RigidTransformd(Translation3d{0, 0, -1});
+  engine.AddAnchoredGeometry(Box(2, 2, 0.5), X_WGs[anchored_id], anchored_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  // A grid of points, some of which are inside the geometries.
+  const int kNumPerSide = 6;
+  Eigen::Matrix3Xd p_WQs(3, kNumPerSide * kNumPerSide * kNumPerSide);
+  int n = 0;
+  for (int i = 0; i < kNumPerSide; ++i) {
+    for (int j = 0; j < kNumPerSide; ++j) {
+      for (int k = 0; k < kNumPerSide; ++k) {
+        p_WQs.col(n++) = Vector3d(i, j, k) * 0.3 - Vector3d(0.8, 0.8, 1.2);
+      }
+    }
+  }
+
+  auto sorted_by_id = [](std::vector<SignedDistanceToPoint<double>> results) {
+    std::sort(results.begin(), results.end(),
+              [](const auto& a, const auto& b) { return a.id_G < b.id_G; });
+    return results;
+  };
+
+  for (int num_threads : {1, 3}) {
+    engine.set_max_num_threads(num_threads);
+    for (double threshold : {kInf, 0.3}) {
+      const auto batch =
+          engine.ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+      ASSERT_EQ(batch.size(), p_WQs.cols());
+      for (int i = 0; i < p_WQs.cols(); ++i) {
+        const auto expected = sorted_by_id(engine.ComputeSignedDistanceToPoint(
+            p_WQs.col(i), X_WGs, threshold));
+        const auto actual = sorted_by_id(batch[i]);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t j = 0; j < actual.size(); ++j) {
+          EXPECT_EQ(actual[j].id_G, expected[j].id_G);
+          EXPECT_EQ(actual[j].distance, expected[j].distance);
+          EXPECT_TRUE(CompareMatrices(actual[j].p_GN, expected[j].p_GN));
+          EXPECT_TRUE(
+              CompareMatrices(actual[j].grad_W, expected[j].grad_W));
+        }
+      }
+    }
+  }
+
+  EXPECT_EQ(engine.ComputeSignedDistanceToPoints(Eigen::Matrix3Xd(3, 0),
+                                                 X_WGs, kInf).size(), 0);
+}
+
+// Casts a fan of rays at a dynamic sphere in front of an anchored wall, and
+// confirms that each ray reports the nearest of the two (or a miss).
+GTEST_TEST(RayCastTest, NearestHitPerRay) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  X_WGs[sphere_id] = RigidTransformd(Translation3d{2, 0, 0});
+  engine.AddDynamicGeometry(Sphere(0.5), sphere_id);
+  const GeometryId wall_id = GeometryId::get_new_id();
+  X_WGs[wall_id] = RigidTransformd(Translation3d{4.5, 0, 0});
+  engine.AddAnchoredGeometry(Box(1, 2, 2), X_WGs[wall_id], wall_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  // Rays from the origin, along +x, offset in y: through the sphere, beside
+  // the sphere onto the wall, and beside both.
+  Eigen::Matrix3Xd p_WRs(3, 3);
+  p_WRs.col(0) = Vector3d(0, 0, 0);
+  p_WRs.col(1) = Vector3d(0, 0.75, 0);
+  p_WRs.col(2) = Vector3d(0, 1.5, 0);
+  const Eigen::Matrix3Xd dir_Ws = Vector3d::UnitX().replicate(1, 3);
+
+  for (int num_threads : {1, 2}) {
+    engine.set_max_num_threads(num_threads);
+    const Eigen::VectorXd distances =
+        engine.ComputeRayCastDistances(p_WRs, dir_Ws, 10);
+    ASSERT_EQ(distances.size(), 3);
+    EXPECT_NEAR(distances(0), 1.5, 1e-14);
+    EXPECT_NEAR(distances(1), 4, 1e-14);
+    EXPECT_EQ(distances(2), kInf);
+
+    // The wall is out of a shorter range.
+    const Eigen::VectorXd short_distances =
+        engine.ComputeRayCastDistances(p_WRs, dir_Ws, 3);
+    EXPECT_NEAR(short_distances(0), 1.5, 1e-14);
+    EXPECT_EQ(short_distances(1), kInf);
+    EXPECT_EQ(short_distances(2), kInf);
+  }
+
+  EXPECT_THROW(engine.ComputeRayCastDistances(p_WRs, dir_Ws.leftCols(2), 10),
+               std::exception);
+  EXPECT_THROW(engine.ComputeRayCastDistances(p_WRs, dir_Ws, 0),
+               std::exception);
+}
+
 // Test the narrow-phase part of ComputeSignedDistanceToPoint.
 
 // Parameter for the value-parameterized test fixture SignedDistanceToPointTest.
@@ -1257,6 +1495,86 @@ GTEST_TEST(ProximityEngineTests, PenetrationMultipleAnchored) {
   EXPECT_EQ(results.size(), 0);
 }
 
+// Pairs of Convex geometries take the GJK/EPA fast path; the results are those
+// of the analytic penetration of two cubes, repeated as the cubes move (to
+// exercise the warm start).
+GTEST_TEST(ProximityEngineTests, PenetrationConvexConvex) {
+  ProximityEngine<double> engine;
+  // The file "quad_cube.obj" contains the cube of size 2.0.
+  const Convex cube{
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0};
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(cube, id_A);
+  engine.AddAnchoredGeometry(cube, RigidTransformd::Identity(), id_B);
+
+  for (const double z : {2.5, 1.9, 1.8, 2.1, 1.7}) {
+    const unordered_map<GeometryId, RigidTransformd> poses{
+        {id_A, RigidTransformd(Vector3d(0.1, -0.2, z))}};
+    engine.UpdateWorldPoses(poses);
+    const auto results = engine.ComputePointPairPenetration();
+    if (z >= 2) {
+      EXPECT_EQ(results.size(), 0);
+      continue;
+    }
+    ASSERT_EQ(results.size(), 1);
+    const PenetrationAsPointPair<double>& penetration = results[0];
+    EXPECT_EQ(penetration.id_A, id_A);
+    EXPECT_EQ(penetration.id_B, id_B);
+    // One vertex of the cube is off by 1e-6 in the file.
+    const double kTolerance = 1e-5;
+    EXPECT_NEAR(penetration.depth, 2 - z, kTolerance);
+    EXPECT_TRUE(CompareMatrices(penetration.nhat_BA_W, Vector3d::UnitZ(),
+                                kTolerance));
+    EXPECT_NEAR(penetration.p_WCa.z(), z - 1, kTolerance);
+    EXPECT_NEAR(penetration.p_WCb.z(), 1, kTolerance);
+  }
+}
+
+// Pairs of Convex geometries take the GJK fast path in the signed distance
+// queries too; the pairs beyond the maximum distance are not reported.
+GTEST_TEST(ProximityEngineTests, SignedDistanceConvexConvex) {
+  ProximityEngine<double> engine;
+  const Convex cube{
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0};
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(cube, id_A);
+  engine.AddAnchoredGeometry(cube, RigidTransformd::Identity(), id_B);
+
+  const double kMaxDistance = 1;
+  for (const double z : {3.5, 2.5, 1.8, 2.9, 3.1}) {
+    const unordered_map<GeometryId, RigidTransformd> poses{
+        {id_A, RigidTransformd(Vector3d(0.1, -0.2, z))},
+        {id_B, RigidTransformd::Identity()}};
+    engine.UpdateWorldPoses(poses);
+    const auto results =
+        engine.ComputeSignedDistancePairwiseClosestPoints(poses, kMaxDistance);
+    if (z - 2 > kMaxDistance) {
+      EXPECT_EQ(results.size(), 0);
+      continue;
+    }
+    ASSERT_EQ(results.size(), 1);
+    const SignedDistancePair<double>& pair = results[0];
+    EXPECT_EQ(pair.id_A, id_A);
+    EXPECT_EQ(pair.id_B, id_B);
+    // One vertex of the cube is off by 1e-6 in the file.
+    const double kTolerance = 1e-5;
+    EXPECT_NEAR(pair.distance, z - 2, kTolerance);
+    EXPECT_TRUE(
+        CompareMatrices(pair.nhat_BA_W, Vector3d::UnitZ(), kTolerance));
+    EXPECT_TRUE(pair.is_nhat_BA_W_unique);
+    // The witness points are in the frames of the geometries.
+    EXPECT_NEAR(pair.p_ACa.z(), -1, kTolerance);
+    EXPECT_NEAR(pair.p_BCb.z(), 1, kTolerance);
+
+    const SignedDistancePair<double> single =
+        engine.ComputeSignedDistancePairClosestPoints(id_B, id_A, poses);
+    EXPECT_EQ(single.id_A, id_A);
+    EXPECT_NEAR(single.distance, pair.distance, 1e-12);
+  }
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
@@ -3438,6 +3756,174 @@ GTEST_TEST(ProximityEngineTests,
       "supported for scalar type drake::AutoDiffXd");
 }
 
+// Tests that the multi-threaded narrowphase reports exactly the same results,
+// in the same order, as the single-threaded one for a cluttered scene.
+GTEST_TEST(ProximityEngineTests, MultiThreadedQueriesMatchSingleThreaded) {
+  ProximityEngine<double> engine;
+  EXPECT_EQ(engine.max_num_threads(), 1);
+  EXPECT_THROW(engine.set_max_num_threads(0), std::exception);
+
+  // A 5 x 5 x 4 grid of overlapping dynamic spheres and boxes resting on an
+  // anchored box.
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  const double spacing = 0.18;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 4; ++k) {
+        const GeometryId id = GeometryId::get_new_id();
+        if ((i + j + k) % 2 == 0) {
+          engine.AddDynamicGeometry(Sphere(0.1), id);
+        } else {
+          engine.AddDynamicGeometry(Box(0.15, 0.12, 0.2), id);
+        }
+        X_WGs[id] = RigidTransformd(
+            RollPitchYawd(0.1 * i, 0.2 * j, 0.3 * k),
+            Vector3d(spacing * i, spacing * j, 0.05 + spacing * k));
+      }
+    }
+  }
+  const GeometryId ground_id = GeometryId::get_new_id();
+  X_WGs[ground_id] = RigidTransformd(Vector3d(0, 0, -0.5));
+  engine.AddAnchoredGeometry(Box(10, 10, 1), X_WGs[ground_id], ground_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  const auto expected_contacts = engine.ComputePointPairPenetration();
+  const auto expected_distances =
+      engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, 0.1);
+  ASSERT_GT(expected_contacts.size(), 0);
+  ASSERT_GT(expected_distances.size(), expected_contacts.size());
+
+  for (int num_threads : {2, 3, 16}) {
+    engine.set_max_num_threads(num_threads);
+    // Copies preserve the setting.
+    EXPECT_EQ(ProximityEngine<double>(engine).max_num_threads(), num_threads);
+
+    const auto contacts = engine.ComputePointPairPenetration();
+    ASSERT_EQ(contacts.size(), expected_contacts.size());
+    for (size_t i = 0; i < contacts.size(); ++i) {
+      EXPECT_EQ(contacts[i].id_A, expected_contacts[i].id_A);
+      EXPECT_EQ(contacts[i].id_B, expected_contacts[i].id_B);
+      EXPECT_EQ(contacts[i].depth, expected_contacts[i].depth);
+      EXPECT_TRUE(CompareMatrices(contacts[i].p_WCa,
+                                  expected_contacts[i].p_WCa));
+      EXPECT_TRUE(CompareMatrices(contacts[i].p_WCb,
+                                  expected_contacts[i].p_WCb));
+      EXPECT_TRUE(CompareMatrices(contacts[i].nhat_BA_W,
+                                  expected_contacts[i].nhat_BA_W));
+    }
+
+    const auto distances =
+        engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, 0.1);
+    ASSERT_EQ(distances.size(), expected_distances.size());
+    for (size_t i = 0; i < distances.size(); ++i) {
+      EXPECT_EQ(distances[i].id_A, expected_distances[i].id_A);
+      EXPECT_EQ(distances[i].id_B, expected_distances[i].id_B);
+      EXPECT_EQ(distances[i].distance, expected_distances[i].distance);
+      EXPECT_TRUE(CompareMatrices(distances[i].p_ACa,
+                                  expected_distances[i].p_ACa));
+      EXPECT_TRUE(CompareMatrices(distances[i].p_BCb,
+                                  expected_distances[i].p_BCb));
+    }
+  }
+}
+
+// Moving a few of many dynamic geometries (which only refits those in the
+// broadphase) gives the same results as an engine that is built with the
+// final poses.
+GTEST_TEST(ProximityEngineTests, UpdateWorldPosesOfFewGeometries) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  std::vector<GeometryId> ids;
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      const GeometryId id = GeometryId::get_new_id();
+      engine.AddDynamicGeometry(Sphere(0.1), id);
+      X_WGs[id] = RigidTransformd(Vector3d(0.3 * i, 0.3 * j, 0));
+      ids.push_back(id);
+    }
+  }
+  const unordered_map<GeometryId, RigidTransformd> X_WGs_initial = X_WGs;
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 0);
+
+  // Move three spheres towards their neighbors in +x, over a few updates.
+  for (int step = 1; step <= 3; ++step) {
+    for (const int index : {0, 45, 87}) {
+      X_WGs[ids[index]] =
+          RigidTransformd(X_WGs_initial.at(ids[index]).translation() +
+                          Vector3d(0.04 * step, 0, 0));
+    }
+    engine.UpdateWorldPoses(X_WGs);
+
+    ProximityEngine<double> expected_engine;
+    for (const GeometryId id : ids) {
+      expected_engine.AddDynamicGeometry(Sphere(0.1), id);
+    }
+    expected_engine.UpdateWorldPoses(X_WGs);
+    const auto expected = expected_engine.ComputePointPairPenetration();
+    const auto contacts = engine.ComputePointPairPenetration();
+    ASSERT_EQ(contacts.size(), expected.size());
+    for (size_t i = 0; i < contacts.size(); ++i) {
+      EXPECT_EQ(contacts[i].id_A, expected[i].id_A);
+      EXPECT_EQ(contacts[i].id_B, expected[i].id_B);
+      EXPECT_EQ(contacts[i].depth, expected[i].depth);
+    }
+    // Once moved by 0.12, each sphere penetrates its neighbor in +x.
+    EXPECT_EQ(contacts.size(), step == 3 ? 3 : 0);
+  }
+}
+
+// The broadphase candidates are shared by the queries, so the results must
+// follow every change that invalidates them.
+GTEST_TEST(ProximityEngineTests, BroadphaseCandidatesFollowChanges) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(Sphere(0.5), id_A);
+  engine.AddDynamicGeometry(Sphere(0.5), id_B);
+  X_WGs[id_A] = RigidTransformd(Vector3d(0, 0, 0));
+  X_WGs[id_B] = RigidTransformd(Vector3d(0.9, 0, 0));
+  engine.UpdateWorldPoses(X_WGs);
+
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 1);
+  EXPECT_EQ(engine.FindCollisionCandidates().size(), 1);
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, 0.5)
+                .size(), 1);
+
+  // New poses.
+  X_WGs[id_B] = RigidTransformd(Vector3d(1.2, 0, 0));
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 0);
+  EXPECT_EQ(engine.FindCollisionCandidates().size(), 0);
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, 0.5)
+                .size(), 1);
+  // A different distance.
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs, 0.1)
+                .size(), 0);
+
+  // New geometry.
+  const GeometryId id_C = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(Sphere(0.5), RigidTransformd(Vector3d(0, 0.9, 0)),
+                             id_C);
+  X_WGs[id_C] = RigidTransformd(Vector3d(0, 0.9, 0));
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 1);
+  EXPECT_EQ(engine.FindCollisionCandidates().size(), 1);
+
+  // New collision filters.
+  engine.ExcludeCollisionsWithin({id_A}, {id_C});
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 0);
+  EXPECT_EQ(engine.FindCollisionCandidates().size(), 0);
+
+  // Removed geometry.
+  X_WGs[id_B] = RigidTransformd(Vector3d(0.9, 0, 0));
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 1);
+  engine.RemoveGeometry(id_B, true /* is_dynamic */);
+  EXPECT_EQ(engine.ComputePointPairPenetration().size(), 0);
+  EXPECT_EQ(engine.FindCollisionCandidates().size(), 0);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
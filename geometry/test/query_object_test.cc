@@ -186,6 +186,8 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
       default_object->ComputeSignedDistancePairwiseClosestPoints());
   EXPECT_DEFAULT_ERROR(
       default_object->ComputeSignedDistanceToPoint(Vector3<double>::Zero()));
+  EXPECT_DEFAULT_ERROR(
+      default_object->ComputeSignedDistanceToPoints(Matrix3X<double>(3, 1)));
 
   EXPECT_DEFAULT_ERROR(default_object->ComputeContactSurfaces());
   EXPECT_DEFAULT_ERROR(default_object->FindCollisionCandidates());
@@ -207,6 +209,8 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   ImageLabel16I label;
   EXPECT_DEFAULT_ERROR(default_object->RenderLabelImage(
       properties, FrameId::get_new_id(), X_WC, false, &label));
+
+  EXPECT_DEFAULT_ERROR(default_object->CloneRenderEngine("dummy_renderer"));
 #undef EXPECT_DEFAULT_ERROR
 }
 
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
@@ -28,6 +29,7 @@
 namespace drake {
 namespace geometry {
 
+using Eigen::Translation3d;
 using internal::DummyRenderEngine;
 using math::RigidTransformd;
 using systems::Context;
@@ -65,6 +67,12 @@ class SceneGraphTester {
     scene_graph.FullPoseUpdate(context);
   }
 
+  template <typename T>
+  static const GeometryState<T>& GetGeometryState(
+      const SceneGraph<T>& scene_graph, const Context<T>& context) {
+    return scene_graph.geometry_state(context);
+  }
+
   template <typename T>
   static void GetQueryObjectPortValue(const SceneGraph<T>& scene_graph,
                                       const systems::Context<T>& context,
@@ -418,6 +426,45 @@ TEST_F(SceneGraphTest, RendererSmokeTest) {
   EXPECT_TRUE(scene_graph_.HasRenderer(kRendererName));
 }
 
+// The poses are only pushed to the engines of a role by the queries of that
+// role.
+TEST_F(SceneGraphTest, PoseUpdatesPerRole) {
+  const std::string kRendererName = "renderer";
+  scene_graph_.AddRenderer(kRendererName, make_unique<DummyRenderEngine>());
+  const SourceId s_id = scene_graph_.RegisterSource();
+  const FrameId f_id = scene_graph_.RegisterFrame(s_id, GeometryFrame("f"));
+  const GeometryId g_id =
+      scene_graph_.RegisterGeometry(s_id, f_id, make_sphere_instance());
+  PerceptionProperties properties =
+      DummyRenderEngine().accepting_properties();
+  properties.AddProperty("label", "id", render::RenderLabel::kDontCare);
+  scene_graph_.AssignRole(s_id, g_id, properties);
+  scene_graph_.set_max_num_threads(2);
+  EXPECT_EQ(scene_graph_.max_num_threads(), 2);
+  AllocateContext();
+  const RigidTransformd X_WF(Translation3d(1, 2, 3));
+  FramePoseVector<double> poses;
+  poses.set_value(f_id, X_WF);
+  scene_graph_.get_source_pose_port(s_id).FixValue(context_.get(), poses);
+
+  const GeometryState<double>& state =
+      SceneGraphTester::GetGeometryState(scene_graph_, *context_);
+  auto updated_ids = [&state, &kRendererName]() {
+    const auto engine = state.CloneRenderEngine(kRendererName);
+    return dynamic_cast<const DummyRenderEngine&>(*engine).updated_ids();
+  };
+  EXPECT_TRUE(CompareMatrices(query_object().X_WG(g_id).GetAsMatrix34(),
+                              X_WF.GetAsMatrix34()));
+  query_object().ComputePointPairPenetration();
+  EXPECT_EQ(updated_ids().size(), 0);
+
+  query_object().CloneRenderEngine(kRendererName);
+  ASSERT_EQ(updated_ids().count(g_id), 1);
+  EXPECT_TRUE(CompareMatrices(updated_ids().at(g_id).GetAsMatrix34(),
+                              X_WF.GetAsMatrix34()));
+  EXPECT_EQ(state.max_num_threads(), 2);
+}
+
 // SceneGraph provides a thin wrapper on the GeometryState role manipulation
 // code. These tests are just smoke tests that the functions work. It relies on
 // GeometryState to properly unit test the full behavior.
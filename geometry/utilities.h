@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -56,6 +57,34 @@ class MapKeyRange {
   const std::unordered_map<K, V>* map_;
 };
 
+/// A value that is shared, read-only, between copies until one of them is
+/// modified (copy on write). Copying is O(1); the first call to mutate() on a
+/// shared value copies it. References obtained from a shared value remain
+/// valid (but refer to the old value) after mutate() makes a private copy.
+///
+/// Copies may be read concurrently; mutating a copy while another copy of
+/// the same value is being copied or mutated is not thread safe.
+template <typename U>
+class CopyOnWrite {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CopyOnWrite)
+
+  CopyOnWrite() : value_(std::make_shared<U>()) {}
+
+  const U& operator*() const { return *value_; }
+  const U* operator->() const { return value_.get(); }
+
+  /// Returns a mutable reference to the value, first copying it if it is
+  /// shared with another copy.
+  U& mutate() {
+    if (value_.use_count() > 1) value_ = std::make_shared<U>(*value_);
+    return *value_;
+  }
+
+ private:
+  std::shared_ptr<U> value_;
+};
+
 /** @name Isometry scalar conversion
 
  Some of SceneGraph's inner-workings are _not_ templated on scalar type and
@@ -1,17 +1,163 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <unistd.h>
+
+#include <cerrno>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
 #include <iostream>
 #include <limits>
+#include <thread>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace lcm {
 
+namespace {
+
+// Writes @p event to @p log.
+void WriteEvent(::lcm::LogFile* log, ::lcm::LogEvent* event) {
+  if (log->writeEvent(event) != 0) {
+    throw std::runtime_error("Publish failed to write to log file.");
+  }
+}
+
+}  // namespace
+
+// Writes the messages published to a DrakeLcmLog on a thread of its own, in
+// batches of all the messages published while the previous batch was being
+// written. The file is flushed to disk after each batch.
+class DrakeLcmLog::BackgroundWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BackgroundWriter)
+
+  explicit BackgroundWriter(::lcm::LogFile* log)
+      : log_(log), thread_([this]() { Run(); }) {}
+
+  // Writes all pending messages, then joins the thread.
+  ~BackgroundWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    has_work_.notify_all();
+    thread_.join();
+  }
+
+  // Copies and queues a message, waiting for room if the pending messages
+  // exceed the memory budget.
+  void Push(int64_t timestamp, const std::string& channel, const void* data,
+            int data_size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    has_room_.wait(lock, [this]() {
+      return pending_bytes_ < kMaxPendingBytes || error_ != nullptr;
+    });
+    RethrowIfFailed();
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    pending_.push_back(
+        Message{timestamp, channel,
+                std::vector<uint8_t>(bytes, bytes + data_size)});
+    pending_bytes_ += data_size;
+    lock.unlock();
+    has_work_.notify_one();
+  }
+
+  // Blocks until all messages are written and flushed to disk.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return pending_.empty() && !busy_; });
+    RethrowIfFailed();
+  }
+
+ private:
+  struct Message {
+    int64_t timestamp{};
+    std::string channel;
+    std::vector<uint8_t> data;
+  };
+
+  // Publish() blocks while the pending messages exceed this many bytes.
+  static constexpr size_t kMaxPendingBytes = 64 << 20;
+
+  // Rethrows and forgets the kept exception, if any. The mutex must be held.
+  void RethrowIfFailed() {
+    if (error_ == nullptr) return;
+    std::exception_ptr error = std::move(error_);
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+
+  void Run() {
+    std::vector<Message> batch;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      has_work_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+      if (pending_.empty()) return;  // Stopping, and nothing left to write.
+      batch.clear();
+      batch.swap(pending_);
+      pending_bytes_ = 0;
+      busy_ = true;
+      lock.unlock();
+      has_room_.notify_all();
+      std::exception_ptr error;
+      try {
+        WriteBatch(&batch);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      busy_ = false;
+      if (error != nullptr && error_ == nullptr) {
+        error_ = std::move(error);
+        pending_.clear();
+        pending_bytes_ = 0;
+        has_room_.notify_all();
+      }
+      if (pending_.empty()) idle_.notify_all();
+    }
+  }
+
+  void WriteBatch(std::vector<Message>* batch) {
+    for (Message& message : *batch) {
+      ::lcm::LogEvent log_event{};
+      log_event.timestamp = message.timestamp;
+      log_event.channel = message.channel;
+      log_event.datalen = message.data.size();
+      log_event.data = message.data.data();
+      WriteEvent(log_, &log_event);
+    }
+    // A file that does not support synchronization (e.g., a pipe) is only
+    // flushed.
+    FILE* const file = log_->getFilePtr();
+    if (std::fflush(file) != 0 ||
+        (::fsync(::fileno(file)) != 0 && errno != EINVAL)) {
+      throw std::runtime_error("Publish failed to flush the log file.");
+    }
+  }
+
+  ::lcm::LogFile* const log_;
+  std::mutex mutex_;
+  std::condition_variable has_work_;
+  std::condition_variable has_room_;
+  std::condition_variable idle_;
+  std::vector<Message> pending_;
+  size_t pending_bytes_{0};
+  bool busy_{false};
+  bool stopping_{false};
+  std::exception_ptr error_;
+  // Declared last so that the thread starts once the members above exist.
+  std::thread thread_;
+};
+
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
-                         bool overwrite_publish_time_with_system_clock)
+                         bool overwrite_publish_time_with_system_clock,
+                         bool write_in_background)
     : is_write_(is_write),
       overwrite_publish_time_with_system_clock_(
           overwrite_publish_time_with_system_clock) {
@@ -24,6 +170,27 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
   if (!log_->good()) {
     throw std::runtime_error("Failed to open log file: " + file_name);
   }
+  if (is_write_ && write_in_background) {
+    background_writer_ = std::make_unique<BackgroundWriter>(log_.get());
+  }
+}
+
+DrakeLcmLog::DrakeLcmLog(std::unique_ptr<const MemoryMappedLcmLog> log)
+    : is_write_(false),
+      overwrite_publish_time_with_system_clock_(false),
+      mapped_log_(std::move(log)) {
+  if (mapped_log_ == nullptr) {
+    throw std::logic_error("DrakeLcmLog requires a non-null log.");
+  }
+}
+
+DrakeLcmLog::~DrakeLcmLog() {
+  if (background_writer_ == nullptr) return;
+  try {
+    background_writer_->Flush();
+  } catch (const std::exception& e) {
+    drake::log()->error("DrakeLcmLog: {}", e.what());
+  }
 }
 
 void DrakeLcmLog::Publish(const std::string& channel, const void* data,
@@ -34,6 +201,8 @@ void DrakeLcmLog::Publish(const std::string& channel, const void* data,
 
   std::lock_guard<std::mutex> lock(mutex_);
 
+  // The timestamp is taken now even when the message is written later, so
+  // that the log does not depend on when it is written.
   ::lcm::LogEvent log_event{};
   if (!overwrite_publish_time_with_system_clock_) {
     log_event.timestamp = second_to_timestamp(time_sec.value_or(0.0));
@@ -41,14 +210,25 @@ void DrakeLcmLog::Publish(const std::string& channel, const void* data,
     log_event.timestamp = std::chrono::steady_clock::now().time_since_epoch() /
                           std::chrono::microseconds(1);
   }
+
+  if (background_writer_ != nullptr) {
+    background_writer_->Push(log_event.timestamp, channel, data, data_size);
+    return;
+  }
+
   log_event.channel = channel;
   log_event.datalen = data_size;
   log_event.data = const_cast<void*>(data);
+  WriteEvent(log_.get(), &log_event);
+}
 
-  // TODO(siyuan): should make cache this or thread write this.
-  if (log_->writeEvent(&log_event) != 0) {
-    throw std::runtime_error("Publish failed to write to log file.");
+void DrakeLcmLog::Flush() {
+  if (!is_write_) {
+    throw std::logic_error("Flush is only available for log saving.");
   }
+  // The writer is thread safe on its own; Publish() holds the mutex while it
+  // waits for room.
+  if (background_writer_ != nullptr) background_writer_->Flush();
 }
 
 std::shared_ptr<DrakeSubscriptionInterface> DrakeLcmLog::Subscribe(
@@ -76,6 +256,13 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  if (mapped_log_ != nullptr) {
+    if (next_event_index_ == mapped_log_->num_events()) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return timestamp_to_second(
+        mapped_log_->get_event(next_event_index_).timestamp);
+  }
   if (next_event_ == nullptr) {
     return std::numeric_limits<double>::infinity();
   }
@@ -89,6 +276,29 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  if (mapped_log_ != nullptr) {
+    // End of log, do nothing.
+    if (next_event_index_ == mapped_log_->num_events()) return;
+
+    // Do nothing if the call time does not match the event's time.
+    const MemoryMappedLcmLog::Event event =
+        mapped_log_->get_event(next_event_index_);
+    if (current_time != timestamp_to_second(event.timestamp)) {
+      return;
+    }
+
+    // Dispatch the mapped message bytes, without copying them.
+    const auto& range = subscriptions_.equal_range(*event.channel);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      const HandlerFunction& handler = iter->second;
+      handler(event.data, event.data_size);
+    }
+
+    // Advance log.
+    ++next_event_index_;
+    return;
+  }
+
   // End of log, do nothing.
   if (next_event_ == nullptr) return;
 
@@ -108,5 +318,14 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   next_event_ = log_->readNextEvent();
 }
 
+void DrakeLcmLog::SeekToTime(double time_sec) {
+  if (mapped_log_ == nullptr) {
+    throw std::logic_error(
+        "SeekToTime is only available for memory-mapped log playback.");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  next_event_index_ = mapped_log_->FindEvent(time_sec);
+}
+
 }  // namespace lcm
 }  // namespace drake
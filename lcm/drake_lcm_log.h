@@ -11,6 +11,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/lcm/drake_lcm_interface.h"
+#include "drake/lcm/memory_mapped_lcm_log.h"
 
 namespace drake {
 namespace lcm {
@@ -39,15 +40,41 @@ class DrakeLcmLog : public DrakeLcmInterface {
    * to generate the timestamp for the logged message. This is used to mimic
    * lcm-logger's behavior. It also implicitly records how fast the messages
    * are generated in real time.
+   * @param write_in_background This parameter only affects write-only mode.
+   * If true, Publish() copies the message and returns, and a background
+   * thread writes the messages to the file in batches, flushing the file to
+   * disk once per batch. The messages are logged in the order of the Publish()
+   * calls, and their timestamps are set when Publish() is called, so the log
+   * is the same as when written synchronously. See Flush().
    *
    * @throws std::runtime_error if unable to open file.
    */
   DrakeLcmLog(const std::string& file_name, bool is_write,
-              bool overwrite_publish_time_with_system_clock = false);
+              bool overwrite_publish_time_with_system_clock = false,
+              bool write_in_background = false);
+
+  /**
+   * Constructs a read-only DrakeLcmLog that plays back the memory-mapped
+   * @p log. Unlike a log opened by file name, which is read sequentially, the
+   * playback can then jump to any time of the log (see SeekToTime()), and
+   * dispatching a message does not copy it.
+   * @throws std::exception if @p log is null.
+   */
+  explicit DrakeLcmLog(std::unique_ptr<const MemoryMappedLcmLog> log);
+
+  /**
+   * In write-only mode, writes the messages that are still pending (see
+   * Flush()). A failure to write them is logged, not thrown.
+   */
+  ~DrakeLcmLog() override;
 
   /**
    * Writes an entry occurred at @p timestamp with content @p data to the log
-   * file. The current implementation blocks until writing is done.
+   * file. Unless `write_in_background` is true at construction time, this
+   * blocks until writing is done. Otherwise, this blocks only while the
+   * messages that are pending exceed a fixed memory budget, and a failure to
+   * write a previous message is thrown by a later call to Publish() or
+   * Flush().
    * @param channel Channel name.
    * @param data Pointer to raw bytes.
    * @param data_size Number of bytes in @p data.
@@ -63,6 +90,17 @@ class DrakeLcmLog : public DrakeLcmInterface {
   void Publish(const std::string& channel, const void* data, int data_size,
                optional<double> time_sec) override;
 
+  /**
+   * Blocks until all the published messages are written to the log file and
+   * the file is flushed to disk. This is a no-op unless `write_in_background`
+   * is true at construction time.
+   *
+   * @throws std::logic_error if this instance is not constructed in write-only
+   * mode.
+   * @throws std::runtime_error if writing a message failed.
+   */
+  void Flush();
+
   /**
    * Subscribes @p handler to @p channel. Multiple handlers can subscribe to the
    * same channel.
@@ -102,6 +140,17 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the playback to the first message whose time is at least
+   * @p time_sec, in logarithmic time. Use this before the playback resumes at
+   * @p time_sec, e.g., before simulating from that time with an
+   * LcmLogPlaybackSystem.
+   *
+   * @throws std::logic_error if this instance is not constructed from a
+   * MemoryMappedLcmLog.
+   */
+  void SeekToTime(double time_sec);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -124,6 +173,8 @@ class DrakeLcmLog : public DrakeLcmInterface {
   }
 
  private:
+  class BackgroundWriter;
+
   const bool is_write_;
   const bool overwrite_publish_time_with_system_clock_;
 
@@ -136,6 +187,16 @@ class DrakeLcmLog : public DrakeLcmInterface {
   std::multimap<std::string, DrakeLcmInterface::HandlerFunction> subscriptions_;
   std::unique_ptr<::lcm::LogFile> log_;
   const ::lcm::LogEvent* next_event_{nullptr};
+
+  // When played back from a memory-mapped log (in which case log_ is null),
+  // the log and the index of the next event.
+  std::unique_ptr<const MemoryMappedLcmLog> mapped_log_;
+  int next_event_index_{0};
+
+  // When writing in background, the writer that owns the access to log_.
+  // Declared last so that it is destroyed (flushing the pending messages)
+  // before log_ is closed.
+  std::unique_ptr<BackgroundWriter> background_writer_;
 };
 
 }  // namespace lcm
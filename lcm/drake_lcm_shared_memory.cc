@@ -0,0 +1,612 @@
+#include "drake/lcm/drake_lcm_shared_memory.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// How long to wait for another process to finish creating a segment.
+constexpr std::chrono::seconds kOpenTimeout{1};
+
+// Marks the header of an initialized ring buffer.
+constexpr uint64_t kRingMagic = 0x3152484D534B5244;  // "DRKSMHR1"
+
+// Each record of a ring buffer is a header of 8 bytes, of which the first 4
+// are the size of the message, followed by the message padded to a multiple
+// of 8 bytes.  A record whose size is kWrapMarker fills the end of the ring
+// buffer where the next record did not fit.
+constexpr uint64_t kRecordHeaderSize = 8;
+constexpr uint32_t kWrapMarker = 0xFFFFFFFF;
+
+uint64_t RecordSize(uint32_t message_size) {
+  return kRecordHeaderSize + ((uint64_t{message_size} + 7) & ~uint64_t{7});
+}
+
+// The start of the segment of a channel, followed by the ring buffer (at
+// kRingOffset).  The positions in the ring buffer are counted in bytes ever
+// written, so that the position p is at the offset p % capacity.
+struct RingHeader {
+  std::atomic<uint64_t> magic;
+  uint64_t capacity;
+  // Serializes the publishers, across processes.
+  pthread_mutex_t mutex;
+  // The end of the record being written; the bytes before reserved_end -
+  // capacity may have been overwritten.
+  std::atomic<uint64_t> reserved_end;
+  // The end of the last complete record.
+  std::atomic<uint64_t> committed_end;
+  // The start of the oldest record that has not been overwritten, where the
+  // subscribers that fell behind start again.
+  std::atomic<uint64_t> oldest_start;
+};
+
+constexpr size_t kRingOffset = (sizeof(RingHeader) + 63) & ~size_t{63};
+
+// The segment shared by all of the channels, which every message rings, so
+// that HandleSubscriptions() can wait for any of them.
+struct Doorbell {
+  std::atomic<uint32_t> count;
+  // The number of subscribers that are blocked on `count`.
+  std::atomic<uint32_t> num_waiters;
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+              std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<uint64_t>::is_always_lock_free,
+              "The shared memory requires lock-free atomics.");
+
+[[noreturn]] void ThrowError(const char* action, const std::string& name) {
+  throw std::runtime_error(fmt::format(
+      "Failed to {} shared memory {}: {}", action, name,
+      std::strerror(errno)));
+}
+
+// A mapped POSIX shared memory segment, which remains mapped for the lifetime
+// of this object.
+class SharedMemorySegment {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemorySegment)
+
+  // Opens the segment `name`, or else creates it with `size` bytes and calls
+  // `initialize` on it.  When another process creates the segment, waits for
+  // `is_initialized` to hold.
+  SharedMemorySegment(std::string name, size_t size,
+                      const std::function<void(void*)>& initialize,
+                      const std::function<bool(const void*)>& is_initialized)
+      : name_(std::move(name)) {
+    bool created = true;
+    int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 && errno == EEXIST) {
+      created = false;
+      fd = ::shm_open(name_.c_str(), O_RDWR, 0600);
+    }
+    if (fd < 0) {
+      ThrowError("open", name_);
+    }
+    const Clock::time_point deadline = Clock::now() + kOpenTimeout;
+    if (created) {
+      if (::ftruncate(fd, size) != 0) {
+        const int error = errno;
+        ::close(fd);
+        ::shm_unlink(name_.c_str());
+        errno = error;
+        ThrowError("size", name_);
+      }
+      size_ = size;
+    } else {
+      // The creator may not have sized the segment yet.
+      while (size_ == 0) {
+        struct stat segment_stat{};
+        if (::fstat(fd, &segment_stat) != 0) {
+          ::close(fd);
+          ThrowError("stat", name_);
+        }
+        size_ = static_cast<size_t>(segment_stat.st_size);
+        if (size_ == 0) {
+          if (Clock::now() > deadline) {
+            ::close(fd);
+            throw std::runtime_error(fmt::format(
+                "Shared memory {} was never initialized", name_));
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+      }
+    }
+    void* const mapped =
+        ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping remains valid after the segment is closed.
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+      ThrowError("map", name_);
+    }
+    data_ = mapped;
+    if (created) {
+      initialize(data_);
+      return;
+    }
+    while (!is_initialized(data_)) {
+      if (Clock::now() > deadline) {
+        ::munmap(data_, size_);
+        throw std::runtime_error(fmt::format(
+            "Shared memory {} was never initialized", name_));
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  ~SharedMemorySegment() { ::munmap(data_, size_); }
+
+  const std::string& name() const { return name_; }
+  size_t size() const { return size_; }
+  void* data() const { return data_; }
+
+ private:
+  const std::string name_;
+  size_t size_{};
+  void* data_{};
+};
+
+// The ring buffer of a channel.
+class Ring {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Ring)
+
+  Ring(std::string name, uint64_t capacity)
+      : segment_(std::move(name), kRingOffset + capacity,
+                 [capacity](void* data) { Initialize(data, capacity); },
+                 [](const void* data) {
+                   return static_cast<const RingHeader*>(data)->magic.load(
+                       std::memory_order_acquire) == kRingMagic;
+                 }) {
+    header_ = static_cast<RingHeader*>(segment_.data());
+    buffer_ = static_cast<uint8_t*>(segment_.data()) + kRingOffset;
+    // The segment may have been created by another process, with another
+    // capacity.
+    DRAKE_THROW_UNLESS(kRingOffset + capacity_bytes() <= segment_.size());
+  }
+
+  const std::string& name() const { return segment_.name(); }
+  uint64_t capacity_bytes() const { return header_->capacity; }
+
+  // Returns the position after the last complete record.
+  uint64_t committed_end() const {
+    return header_->committed_end.load(std::memory_order_acquire);
+  }
+
+  // Returns the position of the oldest record that was not overwritten (as
+  // of the last complete record).
+  uint64_t oldest_start() const {
+    return header_->oldest_start.load(std::memory_order_acquire);
+  }
+
+  // Appends a record of the message `data`, overwriting the oldest records
+  // as needed.
+  void Write(const void* data, uint32_t size) {
+    Lock();
+    const uint64_t capacity = header_->capacity;
+    const uint64_t start =
+        header_->committed_end.load(std::memory_order_relaxed);
+    const uint64_t offset = start % capacity;
+    const uint64_t record_size = RecordSize(size);
+    const uint64_t padding =
+        (capacity - offset < record_size) ? capacity - offset : 0;
+    const uint64_t end = start + padding + record_size;
+    // Skips the records that are about to be overwritten (all of which are
+    // complete, being before `start`).
+    uint64_t oldest = header_->oldest_start.load(std::memory_order_relaxed);
+    while (oldest + capacity < end) {
+      const uint64_t oldest_offset = oldest % capacity;
+      uint32_t oldest_size{};
+      std::memcpy(&oldest_size, buffer_ + oldest_offset, sizeof(oldest_size));
+      oldest += (oldest_size == kWrapMarker) ? capacity - oldest_offset
+                                             : RecordSize(oldest_size);
+    }
+    header_->oldest_start.store(oldest, std::memory_order_relaxed);
+    // As for a seqlock, the readers must see the reservation before any of
+    // the bytes that it covers change.
+    header_->reserved_end.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    if (padding > 0) {
+      std::memcpy(buffer_ + offset, &kWrapMarker, sizeof(kWrapMarker));
+    }
+    uint8_t* const record = buffer_ + (start + padding) % capacity;
+    std::memcpy(record, &size, sizeof(size));
+    std::memcpy(record + kRecordHeaderSize, data, size);
+    header_->committed_end.store(end, std::memory_order_release);
+    ::pthread_mutex_unlock(&header_->mutex);
+  }
+
+  // Reads the record at `position`, which is before committed_end(), into
+  // `*message` (only if `copy_message` is true) and returns the position of
+  // the next record, or returns nullopt if the record has been overwritten.
+  // Sets `*is_message` to false for the records that only mark the end of the
+  // ring buffer.
+  optional<uint64_t> Read(uint64_t position, bool copy_message,
+                          std::vector<uint8_t>* message,
+                          bool* is_message) const {
+    const uint64_t capacity = header_->capacity;
+    const uint64_t offset = position % capacity;
+    uint32_t size{};
+    std::memcpy(&size, buffer_ + offset, sizeof(size));
+    uint64_t record_size = capacity - offset;
+    *is_message = (size != kWrapMarker);
+    if (*is_message) {
+      record_size = RecordSize(size);
+      // The size is only trusted after the validation below, so it must not
+      // lead outside of the ring buffer in the meantime.
+      if (copy_message && offset + record_size <= capacity) {
+        message->resize(size);
+        std::memcpy(message->data(), buffer_ + offset + kRecordHeaderSize,
+                    size);
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header_->reserved_end.load(std::memory_order_relaxed) - position >
+        capacity) {
+      return nullopt;
+    }
+    DRAKE_DEMAND(offset + record_size <= capacity);
+    return position + record_size;
+  }
+
+ private:
+  static void Initialize(void* data, uint64_t capacity) {
+    RingHeader* const header = static_cast<RingHeader*>(data);
+    header->capacity = capacity;
+    pthread_mutexattr_t attributes;
+    ::pthread_mutexattr_init(&attributes);
+    ::pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+#ifdef __linux__
+    ::pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+#endif
+    ::pthread_mutex_init(&header->mutex, &attributes);
+    ::pthread_mutexattr_destroy(&attributes);
+    header->reserved_end.store(0, std::memory_order_relaxed);
+    header->committed_end.store(0, std::memory_order_relaxed);
+    header->oldest_start.store(0, std::memory_order_relaxed);
+    header->magic.store(kRingMagic, std::memory_order_release);
+  }
+
+  void Lock() {
+    const int error = ::pthread_mutex_lock(&header_->mutex);
+#ifdef __linux__
+    if (error == EOWNERDEAD) {
+      // A publisher died while writing; its record was never committed, and
+      // is overwritten by the next one.
+      ::pthread_mutex_consistent(&header_->mutex);
+      return;
+    }
+#endif
+    DRAKE_THROW_UNLESS(error == 0);
+  }
+
+  SharedMemorySegment segment_;
+  RingHeader* header_{};
+  uint8_t* buffer_{};
+};
+
+void RingDoorbell(Doorbell* doorbell) {
+  doorbell->count.fetch_add(1);
+#ifdef __linux__
+  if (doorbell->num_waiters.load() > 0) {
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&doorbell->count),
+              FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+  }
+#endif
+}
+
+// Blocks until the doorbell count differs from `count`, or `timeout` passes
+// (or, without futexes, for at most a millisecond).
+void WaitForDoorbell(Doorbell* doorbell, uint32_t count,
+                     Clock::duration timeout) {
+#ifdef __linux__
+  const auto nanoseconds =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+  struct timespec relative_timeout{};
+  relative_timeout.tv_sec = nanoseconds / 1000000000;
+  relative_timeout.tv_nsec = nanoseconds % 1000000000;
+  // The waiter count is raised before the wait checks the doorbell count, so
+  // a publisher either sees the waiter or changes the count first.
+  doorbell->num_waiters.fetch_add(1);
+  ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&doorbell->count),
+            FUTEX_WAIT, count, &relative_timeout, nullptr, 0);
+  doorbell->num_waiters.fetch_sub(1);
+#else
+  unused(doorbell, count);
+  std::this_thread::sleep_for(
+      std::min<Clock::duration>(timeout, std::chrono::milliseconds(1)));
+#endif
+}
+
+// Returns the channel with the characters that are not allowed in the name
+// of a segment (or that could be ambiguous) escaped as %XX.
+std::string EscapeChannel(const std::string& channel) {
+  std::string result;
+  for (const char c : channel) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-') {
+      result += c;
+    } else {
+      result += fmt::format("%{:02X}", static_cast<unsigned char>(c));
+    }
+  }
+  return result;
+}
+
+// The concrete implementation of DrakeSubscriptionInterface used by
+// DrakeLcmSharedMemory.
+class ShmSubscription final : public DrakeSubscriptionInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ShmSubscription)
+
+  using HandlerFunction = DrakeLcmInterface::HandlerFunction;
+
+  static std::shared_ptr<ShmSubscription> Create(
+      std::shared_ptr<const Ring> ring, HandlerFunction handler) {
+    DRAKE_DEMAND(ring != nullptr);
+    auto result = std::make_shared<ShmSubscription>();
+    // Only the messages published from now on are received.
+    result->next_position_ = ring->committed_end();
+    result->ring_ = std::move(ring);
+    result->user_callback_ = std::move(handler);
+    result->weak_self_reference_ = result;
+    result->strong_self_reference_ = result;
+    return result;
+  }
+
+  void set_unsubscribe_on_delete(bool enabled) final {
+    DRAKE_DEMAND(!weak_self_reference_.expired());
+    if (enabled) {
+      // The caller needs to keep this Subscription active.
+      strong_self_reference_.reset();
+    } else {
+      // This ShmSubscription will keep itself active.
+      strong_self_reference_ = weak_self_reference_.lock();
+    }
+  }
+
+  void set_queue_capacity(int capacity) final {
+    DRAKE_THROW_UNLESS(capacity > 0);
+    queue_capacity_ = capacity;
+  }
+
+  // This is ONLY called from the DrakeLcmSharedMemory dtor.
+  void Detach() {
+    ring_ = {};
+    user_callback_ = {};
+    weak_self_reference_ = {};
+    strong_self_reference_ = {};
+  }
+
+  // Handles the messages published since the last call, up to the queue
+  // capacity (the others are discarded), and returns the number handled.
+  int HandleMessages() {
+    if (ring_ == nullptr) {
+      return 0;
+    }
+    const uint64_t end = ring_->committed_end();
+    int num_handled = 0;
+    while (next_position_ < end) {
+      const bool wanted = (num_handled < queue_capacity_);
+      bool is_message{};
+      const optional<uint64_t> next =
+          ring_->Read(next_position_, wanted, &message_, &is_message);
+      if (!next) {
+        // This subscriber fell behind the publishers; the messages that were
+        // overwritten are lost.
+        next_position_ = ring_->oldest_start();
+        continue;
+      }
+      next_position_ = *next;
+      if (is_message && wanted) {
+        ++num_handled;
+        // The handler sees a copy, which the publishers cannot overwrite.
+        user_callback_(message_.data(), static_cast<int>(message_.size()));
+      }
+    }
+    return num_handled;
+  }
+
+ private:
+  struct AsIfPrivateConstructor {};
+
+ public:
+  // Only use Create; don't call this directly.  (We use a private struct to
+  // prevent anyone but this class from calling the ctor.)
+  explicit ShmSubscription(AsIfPrivateConstructor = {}) {}
+
+ private:
+  std::shared_ptr<const Ring> ring_;
+  uint64_t next_position_{};
+  int queue_capacity_{1};
+  // The storage of the message being handled, reused across messages.
+  std::vector<uint8_t> message_;
+
+  // The user's function that handles raw message data.
+  HandlerFunction user_callback_;
+
+  // We can use "strong" to pretend a subscriber is still active.
+  std::weak_ptr<DrakeSubscriptionInterface> weak_self_reference_;
+  std::shared_ptr<DrakeSubscriptionInterface> strong_self_reference_;
+};
+
+}  // namespace
+
+class DrakeLcmSharedMemory::Impl {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
+
+  Impl(std::string name_prefix, DrakeLcmInterface* remote, uint64_t capacity)
+      : name_prefix_(std::move(name_prefix)),
+        remote_(remote),
+        capacity_(capacity),
+        doorbell_segment_(
+            fmt::format("/{}.doorbell", name_prefix_), sizeof(Doorbell),
+            // The zeros of a new segment are a valid doorbell.
+            [](void*) {}, [](const void*) { return true; }) {
+    doorbell_ = static_cast<Doorbell*>(doorbell_segment_.data());
+  }
+
+  // Returns the ring buffer of `channel`, opening it as needed.
+  const std::shared_ptr<Ring>& GetRing(const std::string& channel) {
+    std::shared_ptr<Ring>& ring = rings_[channel];
+    if (ring == nullptr) {
+      const std::string name =
+          fmt::format("/{}.c.{}", name_prefix_, EscapeChannel(channel));
+      if (name.size() > NAME_MAX) {
+        throw std::runtime_error(fmt::format(
+            "The channel {} is too long for shared memory", channel));
+      }
+      ring = std::make_shared<Ring>(name, capacity_);
+    }
+    return ring;
+  }
+
+  const std::string name_prefix_;
+  DrakeLcmInterface* const remote_;
+  const uint64_t capacity_;
+  SharedMemorySegment doorbell_segment_;
+  Doorbell* doorbell_{};
+  std::map<std::string, std::shared_ptr<Ring>> rings_;
+  std::vector<std::weak_ptr<ShmSubscription>> subscriptions_;
+};
+
+DrakeLcmSharedMemory::DrakeLcmSharedMemory(std::string name_prefix,
+                                           DrakeLcmInterface* remote,
+                                           int capacity) {
+  DRAKE_THROW_UNLESS(!name_prefix.empty());
+  DRAKE_THROW_UNLESS(name_prefix.find('/') == std::string::npos);
+  DRAKE_THROW_UNLESS(capacity >= 64);
+  // The records are aligned to 8 bytes.
+  const uint64_t aligned_capacity = static_cast<uint64_t>(capacity) & ~7;
+  impl_ = std::make_unique<Impl>(std::move(name_prefix), remote,
+                                 aligned_capacity);
+}
+
+DrakeLcmSharedMemory::~DrakeLcmSharedMemory() {
+  // Invalidate our ShmSubscription objects.
+  for (const auto& weak_subscription : impl_->subscriptions_) {
+    auto subscription = weak_subscription.lock();
+    if (subscription) {
+      subscription->Detach();
+    }
+  }
+}
+
+const std::string& DrakeLcmSharedMemory::get_name_prefix() const {
+  return impl_->name_prefix_;
+}
+
+void DrakeLcmSharedMemory::RemoveSharedMemory() {
+  for (const auto& item : impl_->rings_) {
+    ::shm_unlink(item.second->name().c_str());
+  }
+  ::shm_unlink(impl_->doorbell_segment_.name().c_str());
+}
+
+void DrakeLcmSharedMemory::Publish(const std::string& channel,
+                                   const void* data, int data_size,
+                                   optional<double> time_sec) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  DRAKE_THROW_UNLESS(data_size >= 0);
+  Ring* const ring = impl_->GetRing(channel).get();
+  // A record may take up to twice its size, with the padding of the end of
+  // the ring buffer before it.
+  if (RecordSize(data_size) > ring->capacity_bytes() / 2) {
+    throw std::runtime_error(fmt::format(
+        "The message of {} bytes on channel {} is too large for its shared "
+        "memory ring buffer of {} bytes",
+        data_size, channel, ring->capacity_bytes()));
+  }
+  ring->Write(data, static_cast<uint32_t>(data_size));
+  RingDoorbell(impl_->doorbell_);
+  if (impl_->remote_ != nullptr) {
+    impl_->remote_->Publish(channel, data, data_size, time_sec);
+  }
+}
+
+std::shared_ptr<DrakeSubscriptionInterface> DrakeLcmSharedMemory::Subscribe(
+    const std::string& channel, HandlerFunction handler) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  DRAKE_THROW_UNLESS(handler != nullptr);
+
+  // Some housekeeping: scrub any deallocated subscribers.
+  auto& subs = impl_->subscriptions_;
+  subs.erase(std::remove_if(
+      subs.begin(), subs.end(),
+      [](const auto& weak_subscription) {
+        return weak_subscription.expired();
+      }), subs.end());
+
+  // Add the new subscriber.
+  auto result =
+      ShmSubscription::Create(impl_->GetRing(channel), std::move(handler));
+  subs.push_back(result);
+  return result;
+}
+
+int DrakeLcmSharedMemory::HandleSubscriptions(int timeout_millis) {
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::milliseconds(std::max(timeout_millis, 0));
+  while (true) {
+    // The doorbell is read before the ring buffers, so that a message
+    // published after they are read wakes up the wait below.
+    const uint32_t count = impl_->doorbell_->count.load();
+
+    // The handlers may subscribe, so we iterate over a snapshot.
+    std::vector<std::shared_ptr<ShmSubscription>> active;
+    for (const auto& weak_subscription : impl_->subscriptions_) {
+      auto subscription = weak_subscription.lock();
+      if (subscription) {
+        active.push_back(std::move(subscription));
+      }
+    }
+    int total_messages = 0;
+    for (const auto& subscription : active) {
+      total_messages += subscription->HandleMessages();
+    }
+
+    if (total_messages > 0) {
+      return total_messages;
+    }
+    const Clock::duration remaining = deadline - Clock::now();
+    if (remaining <= Clock::duration::zero()) {
+      return 0;
+    }
+    WaitForDoorbell(impl_->doorbell_, count, remaining);
+  }
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/lcm/drake_lcm_interface.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * An LCM instance that exchanges messages with the other processes of the
+ * same host through shared memory, instead of through the network stack.
+ *
+ * Each channel is a ring buffer in a POSIX shared memory segment, named after
+ * the @p name_prefix given to the constructor and the channel, so that all of
+ * the instances with the same prefix (in any process of the host) communicate.
+ * Publish() copies the message into the ring buffer of its channel, and wakes
+ * up the subscribers that are blocked in HandleSubscriptions() (with a futex
+ * on Linux, or by polling elsewhere). HandleSubscriptions() reads the new
+ * messages in place, from the mapped ring buffer, and only copies each message
+ * once, into a per-subscription buffer, to guard it against being overwritten
+ * by a publisher while the handler runs. Nothing ever goes through a socket.
+ *
+ * As with LCM itself, the delivery is lossy: a subscriber that falls behind
+ * by more than the capacity of the ring buffer loses the messages that were
+ * overwritten, and the messages in excess of its queue capacity (see
+ * DrakeSubscriptionInterface::set_queue_capacity()) are discarded.
+ *
+ * When a @p remote instance (e.g., a DrakeLcm) is given, every message is also
+ * published to it, for the subscribers on other hosts. The messages from the
+ * other hosts are received by subscribing to the @p remote instance directly.
+ *
+ * This class is not thread-safe; each instance must be used by one thread at a
+ * time.
+ */
+class DrakeLcmSharedMemory : public DrakeLcmInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DrakeLcmSharedMemory);
+
+  /// The default capacity of the ring buffer of each channel, in bytes.
+  static constexpr int kDefaultCapacity = 16 << 20;
+
+  /**
+   * Constructs an instance that communicates with all of the instances with
+   * the same @p name_prefix.
+   *
+   * @param name_prefix The prefix of the names of the shared memory segments.
+   * Must not be empty, nor contain a '/'.
+   *
+   * @param remote The instance that the messages are also published to, or
+   * nullptr to only publish to this host.  If not null, it must outlive this
+   * object.
+   *
+   * @param capacity The capacity of the ring buffer of each channel, in bytes,
+   * which is only used for the channels that this instance is the first to
+   * open; a message may use up to half of the capacity.
+   */
+  explicit DrakeLcmSharedMemory(std::string name_prefix = "drake_lcm",
+                                DrakeLcmInterface* remote = nullptr,
+                                int capacity = kDefaultCapacity);
+
+  ~DrakeLcmSharedMemory() override;
+
+  /**
+   * Returns the prefix of the names of the shared memory segments.
+   */
+  const std::string& get_name_prefix() const;
+
+  /**
+   * Removes the names of the shared memory segments that this instance has
+   * opened, so that the instances constructed afterwards start afresh.  (The
+   * segments themselves remain valid for as long as they are mapped.)  This
+   * is mostly useful to clean up after tests.
+   */
+  void RemoveSharedMemory();
+
+  /**
+   * @throws std::exception if @p data_size is greater than half of the
+   * capacity of the ring buffer of the channel.
+   */
+  void Publish(const std::string&, const void*, int, optional<double>) override;
+  std::shared_ptr<DrakeSubscriptionInterface> Subscribe(
+      const std::string&, HandlerFunction) override;
+  int HandleSubscriptions(int) override;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * Writes the fields of an LCM message, in the LCM wire format, into a byte
+ * buffer, so that a message can be encoded straight from the data that it is
+ * made of, without first building the message object.  The bytes are those
+ * that the `encode()` method of the message object would write.
+ *
+ * The fields must be written in the order of the message definition, after
+ * the fingerprint of the message type, e.g., for the type
+ *
+ * @code
+ * struct lcmt_example {
+ *   int64_t timestamp;
+ *   int32_t num_names;
+ *   string names[num_names];
+ *   double position[3];
+ * }
+ * @endcode
+ *
+ * @code
+ * LcmMessageWriter writer(&bytes);
+ * writer.WriteInt64(lcmt_example::getHash());
+ * writer.WriteInt64(timestamp);
+ * writer.WriteInt32(names.size());
+ * for (const std::string& name : names) writer.WriteString(name);
+ * for (int i = 0; i < 3; ++i) writer.WriteDouble(position[i]);
+ * @endcode
+ *
+ * Only the top-level message starts with a fingerprint; the nested messages
+ * are written as their fields, in place.
+ */
+class LcmMessageWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmMessageWriter)
+
+  /**
+   * Starts a message in @p bytes, whose previous contents are discarded but
+   * whose capacity is reused, so that writing messages of a steady size
+   * allocates no memory.
+   */
+  explicit LcmMessageWriter(std::vector<uint8_t>* bytes) : bytes_(bytes) {
+    DRAKE_DEMAND(bytes != nullptr);
+    bytes_->clear();
+  }
+
+  void WriteInt32(int32_t value) {
+    WriteBigEndian(static_cast<uint32_t>(value), 4);
+  }
+
+  void WriteInt64(int64_t value) {
+    WriteBigEndian(static_cast<uint64_t>(value), 8);
+  }
+
+  void WriteFloat(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteBigEndian(bits, 4);
+  }
+
+  void WriteDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteBigEndian(bits, 8);
+  }
+
+  /** Writes the length of @p value (including a null terminator), then its
+   * characters and the terminator. */
+  void WriteString(const std::string& value) {
+    DRAKE_THROW_UNLESS(value.size() < INT32_MAX);
+    WriteInt32(static_cast<int32_t>(value.size() + 1));
+    bytes_->insert(bytes_->end(), value.begin(), value.end());
+    bytes_->push_back(0);
+  }
+
+ private:
+  void WriteBigEndian(uint64_t value, int num_bytes) {
+    for (int shift = 8 * (num_bytes - 1); shift >= 0; shift -= 8) {
+      bytes_->push_back(static_cast<uint8_t>(value >> shift));
+    }
+  }
+
+  std::vector<uint8_t>* const bytes_;
+};
+
+}  // namespace lcm
+}  // namespace drake
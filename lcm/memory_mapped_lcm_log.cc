@@ -0,0 +1,301 @@
+#include "drake/lcm/memory_mapped_lcm_log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// The magic number that starts each event of an LCM log, and the size of the
+// header of each event: the magic number (4 bytes), the event number (8), the
+// timestamp (8), the length of the channel (4) and the length of the data (4),
+// all big-endian.
+constexpr uint32_t kEventMagic = 0xEDA1DA01;
+constexpr uint64_t kEventHeaderSize = 28;
+
+// The start of the sidecar index file, followed by a marker of the byte order
+// in which the index was written. (The index is only meant to be reused on the
+// machine that wrote it.)
+constexpr char kIndexMagic[8] = {'D', 'R', 'K', 'L', 'C', 'M', 'I', '1'};
+constexpr uint32_t kIndexByteOrder = 0x01020304;
+
+uint32_t ReadBigEndian32(const uint8_t* bytes) {
+  return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) |
+         (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+}
+
+uint64_t ReadBigEndian64(const uint8_t* bytes) {
+  return (uint64_t{ReadBigEndian32(bytes)} << 32) |
+         ReadBigEndian32(bytes + 4);
+}
+
+template <typename Scalar>
+void Write(std::ofstream* out, const Scalar& value) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename Scalar>
+bool Read(std::ifstream* in, Scalar* value) {
+  in->read(reinterpret_cast<char*>(value), sizeof(*value));
+  return in->good();
+}
+
+}  // namespace
+
+MemoryMappedLcmLog::MemoryMappedLcmLog(const std::string& file_name,
+                                       bool use_index_file) {
+  const int fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format(
+        "Failed to open log file {}: {}", file_name, std::strerror(errno)));
+  }
+  struct stat file_stat{};
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    throw std::runtime_error(fmt::format(
+        "Failed to stat log file {}: {}", file_name, std::strerror(errno)));
+  }
+  size_ = static_cast<uint64_t>(file_stat.st_size);
+#ifdef __APPLE__
+  const struct timespec& mtime = file_stat.st_mtimespec;
+#else
+  const struct timespec& mtime = file_stat.st_mtim;
+#endif
+  modification_time_ =
+      static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+  // An empty file cannot be mapped, and has no events anyway.
+  if (size_ > 0) {
+    void* const mapped =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error(fmt::format(
+          "Failed to map log file {}: {}", file_name, std::strerror(errno)));
+    }
+    data_ = static_cast<const uint8_t*>(mapped);
+  }
+  // The mapping remains valid after the file is closed.
+  ::close(fd);
+
+  try {
+    const std::string index_file = index_file_name(file_name);
+    index_was_loaded_ = use_index_file && LoadIndex(index_file);
+    if (!index_was_loaded_) {
+      BuildIndex();
+      if (use_index_file) {
+        SaveIndex(index_file);
+      }
+    }
+  } catch (...) {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+    throw;
+  }
+  BuildChannelEvents();
+}
+
+MemoryMappedLcmLog::~MemoryMappedLcmLog() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+}
+
+std::string MemoryMappedLcmLog::index_file_name(const std::string& file_name) {
+  return file_name + ".drakeidx";
+}
+
+MemoryMappedLcmLog::Event MemoryMappedLcmLog::get_event(int index) const {
+  DRAKE_THROW_UNLESS(index >= 0 && index < num_events());
+  const Entry& entry = entries_[index];
+  Event event;
+  event.timestamp = entry.timestamp;
+  event.channel = &channels_[entry.channel_index];
+  event.data = data_ + entry.data_offset;
+  event.data_size = static_cast<int>(entry.data_size);
+  return event;
+}
+
+int MemoryMappedLcmLog::FindEvent(double time_sec) const {
+  // The smallest timestamp whose time is at least time_sec; see
+  // DrakeLcmLog::timestamp_to_second().
+  const auto iter = std::partition_point(
+      entries_.begin(), entries_.end(), [time_sec](const Entry& entry) {
+        return static_cast<double>(entry.timestamp) / 1e6 < time_sec;
+      });
+  return static_cast<int>(iter - entries_.begin());
+}
+
+int MemoryMappedLcmLog::FindNextEvent(int index,
+                                      const std::string& channel) const {
+  const auto channel_iter =
+      std::find(channels_.begin(), channels_.end(), channel);
+  if (channel_iter == channels_.end()) {
+    return num_events();
+  }
+  const std::vector<int>& events =
+      channel_events_[channel_iter - channels_.begin()];
+  const auto iter = std::lower_bound(events.begin(), events.end(), index);
+  return iter == events.end() ? num_events() : *iter;
+}
+
+void MemoryMappedLcmLog::BuildIndex() {
+  channels_.clear();
+  entries_.clear();
+  std::unordered_map<std::string, uint32_t> channel_indices;
+  uint64_t offset = 0;
+  while (offset + kEventHeaderSize <= size_) {
+    const uint8_t* const header = data_ + offset;
+    if (ReadBigEndian32(header) != kEventMagic) {
+      if (offset == 0) {
+        throw std::runtime_error("The file is not an LCM log.");
+      }
+      // Like the LCM eventlog reader, resynchronize on the next magic number.
+      ++offset;
+      continue;
+    }
+    const int64_t timestamp =
+        static_cast<int64_t>(ReadBigEndian64(header + 12));
+    const uint64_t channel_size = ReadBigEndian32(header + 20);
+    const uint64_t data_size = ReadBigEndian32(header + 24);
+    const uint64_t channel_offset = offset + kEventHeaderSize;
+    const uint64_t data_offset = channel_offset + channel_size;
+    if (data_offset + data_size > size_) {
+      // A truncated event at the end of the log.
+      break;
+    }
+    const std::string channel(
+        reinterpret_cast<const char*>(data_ + channel_offset), channel_size);
+    const auto inserted = channel_indices.emplace(
+        channel, static_cast<uint32_t>(channels_.size()));
+    if (inserted.second) {
+      channels_.push_back(channel);
+    }
+    Entry entry;
+    entry.timestamp = timestamp;
+    entry.data_offset = data_offset;
+    entry.data_size = static_cast<uint32_t>(data_size);
+    entry.channel_index = inserted.first->second;
+    entries_.push_back(entry);
+    offset = data_offset + data_size;
+  }
+  // Logs are normally already in time order, in which case this is linear.
+  std::stable_sort(entries_.begin(), entries_.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.timestamp < b.timestamp;
+                   });
+}
+
+bool MemoryMappedLcmLog::LoadIndex(const std::string& index_file_name) {
+  std::ifstream in(index_file_name, std::ios::binary);
+  if (!in.good()) {
+    return false;
+  }
+  char magic[sizeof(kIndexMagic)];
+  uint32_t byte_order{};
+  uint64_t size{};
+  int64_t modification_time{};
+  in.read(magic, sizeof(magic));
+  if (!in.good() || std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0 ||
+      !Read(&in, &byte_order) || byte_order != kIndexByteOrder ||
+      !Read(&in, &size) || size != size_ ||
+      !Read(&in, &modification_time) ||
+      modification_time != modification_time_) {
+    return false;
+  }
+  uint32_t num_channels{};
+  if (!Read(&in, &num_channels)) {
+    return false;
+  }
+  std::vector<std::string> channels(num_channels);
+  for (std::string& channel : channels) {
+    uint32_t channel_size{};
+    if (!Read(&in, &channel_size) || channel_size > size_) {
+      return false;
+    }
+    channel.resize(channel_size);
+    in.read(&channel[0], channel_size);
+    if (!in.good()) {
+      return false;
+    }
+  }
+  uint64_t num_entries{};
+  if (!Read(&in, &num_entries) || num_entries > size_ / kEventHeaderSize) {
+    return false;
+  }
+  std::vector<Entry> entries(num_entries);
+  for (Entry& entry : entries) {
+    if (!Read(&in, &entry.timestamp) || !Read(&in, &entry.data_offset) ||
+        !Read(&in, &entry.data_size) || !Read(&in, &entry.channel_index) ||
+        entry.data_offset + entry.data_size > size_ ||
+        entry.channel_index >= num_channels) {
+      return false;
+    }
+  }
+  channels_ = std::move(channels);
+  entries_ = std::move(entries);
+  return true;
+}
+
+void MemoryMappedLcmLog::SaveIndex(const std::string& index_file_name) const {
+  // Write to a temporary file that is then renamed, so that a concurrent
+  // reader never sees a partially written index.
+  const std::string temp_file_name = index_file_name + ".tmp";
+  {
+    std::ofstream out(temp_file_name, std::ios::binary | std::ios::trunc);
+    if (!out.good()) {
+      return;
+    }
+    out.write(kIndexMagic, sizeof(kIndexMagic));
+    Write(&out, kIndexByteOrder);
+    Write(&out, size_);
+    Write(&out, modification_time_);
+    Write(&out, static_cast<uint32_t>(channels_.size()));
+    for (const std::string& channel : channels_) {
+      Write(&out, static_cast<uint32_t>(channel.size()));
+      out.write(channel.data(), channel.size());
+    }
+    Write(&out, static_cast<uint64_t>(entries_.size()));
+    for (const Entry& entry : entries_) {
+      Write(&out, entry.timestamp);
+      Write(&out, entry.data_offset);
+      Write(&out, entry.data_size);
+      Write(&out, entry.channel_index);
+    }
+    if (!out.good()) {
+      out.close();
+      std::remove(temp_file_name.c_str());
+      return;
+    }
+  }
+  if (std::rename(temp_file_name.c_str(), index_file_name.c_str()) != 0) {
+    std::remove(temp_file_name.c_str());
+  }
+}
+
+void MemoryMappedLcmLog::BuildChannelEvents() {
+  channel_events_.assign(channels_.size(), {});
+  for (int i = 0; i < num_events(); ++i) {
+    channel_events_[entries_[i].channel_index].push_back(i);
+  }
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * A read-only, random-access view of an LCM log file (in the format written by
+ * lcm-logger or DrakeLcmLog). The file is memory-mapped rather than read, and
+ * its events are indexed by time and by channel, so that:
+ *
+ * - seeking to a time is a binary search over the index (see FindEvent()),
+ * - the events of one channel can be iterated over without touching the
+ *   events of the other channels (see FindNextEvent()), and
+ * - the message bytes are never copied: get_event() returns pointers into
+ *   the mapped file.
+ *
+ * Building the index requires a pass over the whole log, so the index is
+ * saved to a sidecar file (see index_file_name()) next to the log and is
+ * loaded instead of rebuilt when the log is opened again, as long as the log
+ * has not been modified since. Failing to write the sidecar file (e.g., in a
+ * read-only directory) is not an error.
+ *
+ * The events are indexed in order of increasing timestamp; those that have the
+ * same timestamp remain in the order in which they were logged. A truncated
+ * event at the end of the log (e.g., that of a logger that was killed) is
+ * ignored.
+ *
+ * See DrakeLcmLog for playing back a log through a DrakeLcmInterface.
+ */
+class MemoryMappedLcmLog {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MemoryMappedLcmLog)
+
+  /** An event of the log. The pointed-to data remain valid for the lifetime of
+   the log.  */
+  struct Event {
+    /** The timestamp of the event in microseconds.  */
+    int64_t timestamp{};
+    /** The channel of the event.  */
+    const std::string* channel{};
+    /** The message bytes.  */
+    const void* data{};
+    /** The number of message bytes.  */
+    int data_size{};
+  };
+
+  /**
+   * Opens and indexes the log @p file_name.
+   * @param use_index_file If true, the index is loaded from the sidecar file
+   * of the log when it is up to date with the log, and is otherwise built and
+   * saved to it. If false, the index is built and the sidecar file is neither
+   * read nor written.
+   * @throws std::runtime_error if the log cannot be opened or mapped, or if it
+   * is not an LCM log.
+   */
+  explicit MemoryMappedLcmLog(const std::string& file_name,
+                              bool use_index_file = true);
+
+  ~MemoryMappedLcmLog();
+
+  /** Returns the name of the sidecar file that stores the index of the log
+   @p file_name.  */
+  static std::string index_file_name(const std::string& file_name);
+
+  /** Returns true iff the index was loaded from the sidecar file (rather than
+   built by scanning the log).  */
+  bool index_was_loaded() const { return index_was_loaded_; }
+
+  /** Returns the number of events in the log.  */
+  int num_events() const { return static_cast<int>(entries_.size()); }
+
+  /** Returns the event at @p index, in [0, num_events()).  */
+  Event get_event(int index) const;
+
+  /** Returns the distinct channels of the log, in order of first
+   appearance.  */
+  const std::vector<std::string>& channels() const { return channels_; }
+
+  /** Returns the index of the first event whose time (in seconds, see
+   DrakeLcmLog::timestamp_to_second()) is at least @p time_sec, or
+   num_events() if there is none. This takes logarithmic time.  */
+  int FindEvent(double time_sec) const;
+
+  /** Returns the index of the first event on @p channel whose index is at
+   least @p index, or num_events() if there is none (in particular, if no event
+   is on @p channel). This takes logarithmic time.  */
+  int FindNextEvent(int index, const std::string& channel) const;
+
+ private:
+  // The indexed data of an event.
+  struct Entry {
+    int64_t timestamp{};
+    // The offset of the message bytes from the start of the file.
+    uint64_t data_offset{};
+    uint32_t data_size{};
+    // The index of the channel in channels_.
+    uint32_t channel_index{};
+  };
+
+  void BuildIndex();
+  bool LoadIndex(const std::string& index_file_name);
+  void SaveIndex(const std::string& index_file_name) const;
+  void BuildChannelEvents();
+
+  // The mapped file, and the properties identifying its version (the
+  // modification time is in nanoseconds).
+  const uint8_t* data_{nullptr};
+  uint64_t size_{0};
+  int64_t modification_time_{0};
+
+  std::vector<std::string> channels_;
+  std::vector<Entry> entries_;
+  // The indices (in entries_) of the events on each channel, in increasing
+  // order.
+  std::vector<std::vector<int>> channel_events_;
+  bool index_was_loaded_{false};
+};
+
+}  // namespace lcm
+}  // namespace drake
@@ -1,6 +1,9 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -53,6 +56,39 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   }
 }
 
+// Reads the bytes of the file @p file_name.
+std::string ReadFile(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+// Checks that writing in background logs the same bytes as writing
+// synchronously.
+GTEST_TEST(LcmLogTest, LcmLogTestWriteInBackground) {
+  auto write_log = [](const std::string& file_name, bool in_background) {
+    DrakeLcmLog log(file_name, true, false, in_background);
+    drake::lcmt_drake_signal msg{};
+    msg.dim = 1;
+    msg.val.push_back(0.0);
+    msg.coord.push_back("test");
+    for (int i = 0; i < 100; ++i) {
+      msg.val[0] = i;
+      msg.timestamp = i;
+      Publish(&log, i % 2 == 0 ? "even" : "odd", msg, 0.01 * i);
+      if (i == 50) log.Flush();
+    }
+  };
+  write_log("sync.log", false);
+  write_log("background.log", true);
+  const std::string sync_bytes = ReadFile("sync.log");
+  EXPECT_FALSE(sync_bytes.empty());
+  EXPECT_EQ(ReadFile("background.log"), sync_bytes);
+
+  DrakeLcmLog r_log("background.log", false);
+  EXPECT_THROW(r_log.Flush(), std::logic_error);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -0,0 +1,166 @@
+#include "drake/lcm/drake_lcm_shared_memory.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/lcm/drake_mock_lcm.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+class DrakeLcmSharedMemoryTest : public ::testing::Test {
+ protected:
+  void TearDown() override { dut_.RemoveSharedMemory(); }
+
+  // Each test process has its own segments.
+  const std::string prefix_ = fmt::format("drake_lcm_test_{}", ::getpid());
+  DrakeLcmSharedMemory dut_{prefix_};
+};
+
+TEST_F(DrakeLcmSharedMemoryTest, PublishAndHandle) {
+  EXPECT_EQ(dut_.get_name_prefix(), prefix_);
+
+  // A second instance stands for another process of the same host.
+  DrakeLcmSharedMemory other(prefix_);
+  std::vector<Bytes> received;
+  other.Subscribe("A/B", [&received](const void* data, int size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    received.emplace_back(bytes, bytes + size);
+  });
+  int num_received_by_dut = 0;
+  dut_.Subscribe("C", [&num_received_by_dut](const void*, int) {
+    ++num_received_by_dut;
+  });
+
+  const Bytes message{1, 2, 3, 4, 5};
+  dut_.Publish("A/B", message.data(), message.size(), {});
+  EXPECT_EQ(other.HandleSubscriptions(0), 1);
+  ASSERT_EQ(received.size(), 1);
+  EXPECT_EQ(received[0], message);
+  EXPECT_EQ(other.HandleSubscriptions(0), 0);
+
+  // An empty message, on the other channel, back to the first instance.
+  other.Publish("C", nullptr, 0, {});
+  EXPECT_EQ(dut_.HandleSubscriptions(0), 1);
+  EXPECT_EQ(num_received_by_dut, 1);
+  EXPECT_EQ(other.HandleSubscriptions(0), 0);
+}
+
+TEST_F(DrakeLcmSharedMemoryTest, QueueCapacity) {
+  int num_received = 0;
+  auto subscription = dut_.Subscribe("C", [&num_received](const void*, int) {
+    ++num_received;
+  });
+  const Bytes message(10);
+  for (int i = 0; i < 3; ++i) {
+    dut_.Publish("C", message.data(), message.size(), {});
+  }
+  // The default capacity is one.
+  EXPECT_EQ(dut_.HandleSubscriptions(0), 1);
+  EXPECT_EQ(dut_.HandleSubscriptions(0), 0);
+
+  subscription->set_queue_capacity(5);
+  for (int i = 0; i < 3; ++i) {
+    dut_.Publish("C", message.data(), message.size(), {});
+  }
+  EXPECT_EQ(dut_.HandleSubscriptions(0), 3);
+  EXPECT_EQ(num_received, 4);
+}
+
+TEST_F(DrakeLcmSharedMemoryTest, Unsubscribe) {
+  int num_received = 0;
+  auto subscription = dut_.Subscribe("C", [&num_received](const void*, int) {
+    ++num_received;
+  });
+  subscription->set_unsubscribe_on_delete(true);
+  subscription.reset();
+  const Bytes message(10);
+  dut_.Publish("C", message.data(), message.size(), {});
+  EXPECT_EQ(dut_.HandleSubscriptions(0), 0);
+  EXPECT_EQ(num_received, 0);
+}
+
+// A subscriber that falls behind loses the overwritten messages, but never
+// receives a torn one.
+TEST_F(DrakeLcmSharedMemoryTest, Overrun) {
+  DrakeLcmSharedMemory small(prefix_ + "_small", nullptr, 1024);
+  std::vector<Bytes> received;
+  auto subscription = small.Subscribe("C", [&](const void* data, int size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    received.emplace_back(bytes, bytes + size);
+  });
+  subscription->set_queue_capacity(1000);
+  for (int i = 0; i < 100; ++i) {
+    const Bytes message(1 + i % 37, static_cast<uint8_t>(i));
+    small.Publish("C", message.data(), message.size(), {});
+  }
+  const int num_handled = small.HandleSubscriptions(0);
+  EXPECT_GT(num_handled, 0);
+  EXPECT_LT(num_handled, 100);
+  ASSERT_EQ(received.size(), num_handled);
+  for (int k = 0; k < num_handled; ++k) {
+    // The newest messages are kept.
+    const int i = 100 - num_handled + k;
+    EXPECT_EQ(received[k], Bytes(1 + i % 37, static_cast<uint8_t>(i)));
+  }
+
+  // The largest message uses half of the capacity.
+  const Bytes too_large(600);
+  EXPECT_THROW(small.Publish("C", too_large.data(), too_large.size(), {}),
+               std::exception);
+  small.RemoveSharedMemory();
+}
+
+TEST_F(DrakeLcmSharedMemoryTest, Timeout) {
+  dut_.Subscribe("C", [](const void*, int) {});
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(dut_.HandleSubscriptions(20), 0);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+}
+
+// A subscriber that is blocked in HandleSubscriptions() wakes up on a message.
+TEST_F(DrakeLcmSharedMemoryTest, WakeUp) {
+  int num_received = 0;
+  dut_.Subscribe("C", [&num_received](const void*, int) {
+    ++num_received;
+  });
+  std::thread publisher([this]() {
+    DrakeLcmSharedMemory other(prefix_);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const Bytes message(10);
+    other.Publish("C", message.data(), message.size(), {});
+  });
+  EXPECT_EQ(dut_.HandleSubscriptions(10000), 1);
+  EXPECT_EQ(num_received, 1);
+  publisher.join();
+}
+
+TEST_F(DrakeLcmSharedMemoryTest, Remote) {
+  DrakeMockLcm remote;
+  DrakeLcmSharedMemory dut(prefix_, &remote);
+  int num_received_remotely = 0;
+  remote.Subscribe("C", [&num_received_remotely](const void*, int) {
+    ++num_received_remotely;
+  });
+  const Bytes message(10);
+  dut.Publish("C", message.data(), message.size(), {});
+  EXPECT_EQ(remote.HandleSubscriptions(0), 1);
+  EXPECT_EQ(num_received_remotely, 1);
+  dut.RemoveSharedMemory();
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
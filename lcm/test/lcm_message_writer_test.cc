@@ -0,0 +1,53 @@
+#include "drake/lcm/lcm_message_writer.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/lcmt_drake_signal.hpp"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// The bytes written field by field are those of the encoded message.
+GTEST_TEST(LcmMessageWriterTest, MatchesEncode) {
+  const lcmt_drake_signal message{
+    2,
+    { 1.5, -2.25, },
+    { "x", "", },
+    12345,
+  };
+  std::vector<uint8_t> expected(message.getEncodedSize());
+  message.encode(expected.data(), 0, expected.size());
+
+  // The previous contents of the buffer are discarded.
+  std::vector<uint8_t> bytes(100, 0xFF);
+  LcmMessageWriter writer(&bytes);
+  writer.WriteInt64(lcmt_drake_signal::getHash());
+  writer.WriteInt32(message.dim);
+  for (const double value : message.val) writer.WriteDouble(value);
+  for (const std::string& name : message.coord) writer.WriteString(name);
+  writer.WriteInt64(message.timestamp);
+  EXPECT_EQ(bytes, expected);
+}
+
+GTEST_TEST(LcmMessageWriterTest, BigEndian) {
+  std::vector<uint8_t> bytes;
+  LcmMessageWriter writer(&bytes);
+  writer.WriteInt32(0x01020304);
+  writer.WriteInt64(-2);
+  writer.WriteFloat(1.0f);
+  writer.WriteString("ab");
+  const std::vector<uint8_t> expected{
+      1, 2, 3, 4,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+      0x3F, 0x80, 0, 0,
+      0, 0, 0, 3, 'a', 'b', 0};
+  EXPECT_EQ(bytes, expected);
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
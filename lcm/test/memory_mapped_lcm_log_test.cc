@@ -0,0 +1,151 @@
+#include "drake/lcm/memory_mapped_lcm_log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/lcm/drake_lcm_log.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// The message bytes of the i'th logged message.
+std::vector<uint8_t> MessageBytes(int i) {
+  return std::vector<uint8_t>(i + 1, static_cast<uint8_t>(i));
+}
+
+std::string EventBytes(const MemoryMappedLcmLog::Event& event) {
+  const char* const data = static_cast<const char*>(event.data);
+  return std::string(data, data + event.data_size);
+}
+
+class MemoryMappedLcmLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::remove(MemoryMappedLcmLog::index_file_name(kFileName).c_str());
+    // Messages at 0.5 s, 1 s, ..., 3 s, alternating between two channels,
+    // with two messages at 3 s.
+    DrakeLcmLog log(kFileName, true);
+    for (int i = 0; i < 7; ++i) {
+      const std::vector<uint8_t> bytes = MessageBytes(i);
+      const double time = std::min(0.5 * (i + 1), 3.0);
+      log.Publish(i % 2 == 0 ? "EVEN" : "ODD", bytes.data(), bytes.size(),
+                  time);
+    }
+  }
+
+  const std::string kFileName{"memory_mapped_lcm_log_test.log"};
+};
+
+TEST_F(MemoryMappedLcmLogTest, Index) {
+  const MemoryMappedLcmLog dut(kFileName);
+  EXPECT_FALSE(dut.index_was_loaded());
+  ASSERT_EQ(dut.num_events(), 7);
+  EXPECT_EQ(dut.channels(), std::vector<std::string>({"EVEN", "ODD"}));
+  for (int i = 0; i < 7; ++i) {
+    const MemoryMappedLcmLog::Event event = dut.get_event(i);
+    EXPECT_EQ(*event.channel, i % 2 == 0 ? "EVEN" : "ODD");
+    const std::vector<uint8_t> bytes = MessageBytes(i);
+    EXPECT_EQ(EventBytes(event), std::string(bytes.begin(), bytes.end()));
+  }
+  EXPECT_EQ(dut.get_event(0).timestamp, 500000);
+  EXPECT_THROW(dut.get_event(7), std::exception);
+
+  // Seeking by time.
+  EXPECT_EQ(dut.FindEvent(0.0), 0);
+  EXPECT_EQ(dut.FindEvent(0.5), 0);
+  EXPECT_EQ(dut.FindEvent(0.75), 1);
+  EXPECT_EQ(dut.FindEvent(3.0), 5);
+  EXPECT_EQ(dut.FindEvent(3.5), 7);
+
+  // Iterating over a channel.
+  EXPECT_EQ(dut.FindNextEvent(0, "ODD"), 1);
+  EXPECT_EQ(dut.FindNextEvent(2, "ODD"), 3);
+  EXPECT_EQ(dut.FindNextEvent(6, "ODD"), 7);
+  EXPECT_EQ(dut.FindNextEvent(6, "EVEN"), 6);
+  EXPECT_EQ(dut.FindNextEvent(0, "NONE"), 7);
+}
+
+TEST_F(MemoryMappedLcmLogTest, IndexFile) {
+  {
+    const MemoryMappedLcmLog dut(kFileName, false /* use_index_file */);
+    EXPECT_FALSE(dut.index_was_loaded());
+  }
+  // Without an index file, it is built and saved.
+  const MemoryMappedLcmLog built(kFileName);
+  EXPECT_FALSE(built.index_was_loaded());
+
+  // It is then loaded, with the same contents.
+  const MemoryMappedLcmLog loaded(kFileName);
+  EXPECT_TRUE(loaded.index_was_loaded());
+  ASSERT_EQ(loaded.num_events(), built.num_events());
+  EXPECT_EQ(loaded.channels(), built.channels());
+  for (int i = 0; i < loaded.num_events(); ++i) {
+    EXPECT_EQ(loaded.get_event(i).timestamp, built.get_event(i).timestamp);
+    EXPECT_EQ(EventBytes(loaded.get_event(i)), EventBytes(built.get_event(i)));
+  }
+  EXPECT_EQ(loaded.FindNextEvent(2, "ODD"), 3);
+
+  // A corrupt index file is ignored and rewritten.
+  {
+    std::ofstream index(MemoryMappedLcmLog::index_file_name(kFileName),
+                        std::ios::binary | std::ios::trunc);
+    index << "garbage";
+  }
+  EXPECT_FALSE(MemoryMappedLcmLog(kFileName).index_was_loaded());
+  EXPECT_TRUE(MemoryMappedLcmLog(kFileName).index_was_loaded());
+}
+
+TEST_F(MemoryMappedLcmLogTest, Playback) {
+  DrakeLcmLog dut(std::make_unique<MemoryMappedLcmLog>(kFileName));
+  EXPECT_FALSE(dut.is_write());
+  std::vector<std::string> received;
+  dut.Subscribe("ODD", [&received](const void* data, int size) {
+    const char* const bytes = static_cast<const char*>(data);
+    received.emplace_back(bytes, bytes + size);
+  });
+
+  // Skip to the messages at 2.5 s and later.
+  dut.SeekToTime(2.1);
+  EXPECT_EQ(dut.GetNextMessageTime(), 2.5);
+  while (!std::isinf(dut.GetNextMessageTime())) {
+    dut.DispatchMessageAndAdvanceLog(dut.GetNextMessageTime());
+  }
+  ASSERT_EQ(received.size(), 1);
+  const std::vector<uint8_t> bytes = MessageBytes(5);
+  EXPECT_EQ(received[0], std::string(bytes.begin(), bytes.end()));
+
+  // Seeking back.
+  dut.SeekToTime(0);
+  EXPECT_EQ(dut.GetNextMessageTime(), 0.5);
+
+  // Seeking is only supported by memory-mapped logs.
+  DrakeLcmLog sequential(kFileName, false);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      sequential.SeekToTime(0), std::logic_error,
+      "SeekToTime is only available for memory-mapped log playback.");
+}
+
+GTEST_TEST(MemoryMappedLcmLogErrorTest, Errors) {
+  EXPECT_THROW(MemoryMappedLcmLog("no_such_file.log"), std::runtime_error);
+  const std::string file_name = "not_a_log.log";
+  {
+    std::ofstream file(file_name);
+    file << "This is not an LCM log, as it does not start with the magic.";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(MemoryMappedLcmLog(file_name, false),
+                              std::runtime_error,
+                              "The file is not an LCM log.");
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
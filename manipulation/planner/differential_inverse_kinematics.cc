@@ -1,5 +1,6 @@
 #include "drake/manipulation/planner/differential_inverse_kinematics.h"
 
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -273,6 +274,300 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
                                          parameters);
 }
 
+namespace {
+// TODO(russt): This should not be hard-coded.
+constexpr double kCartesianTrackingWeight = 100;
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+int CountNonZeroGains(const DifferentialInverseKinematicsParameters& params) {
+  int count = 0;
+  for (int i = 0; i < 6; i++) {
+    if (params.get_end_effector_velocity_gain()(i) > 0) count++;
+  }
+  return count;
+}
+}  // namespace
+
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters,
+    int num_cart_constraints)
+    : parameters_(parameters), num_cart_constraints_(num_cart_constraints) {
+  const int num_positions = parameters_.get_num_positions();
+  const int num_velocities = parameters_.get_num_velocities();
+  if (num_cart_constraints_ < 0) {
+    throw std::invalid_argument(fmt::format(
+        "Number of Cartesian constraints, {}, must be non-negative.",
+        num_cart_constraints_));
+  }
+  // A bunch of the operations below assume num_positions == num_velocities.
+  // TODO(russt): Generalize this
+  if (num_positions != num_velocities) {
+    throw std::invalid_argument(fmt::format(
+        "Number of positions, {}, does not match number of velocities, {}.",
+        num_positions, num_velocities));
+  }
+
+  // The program has the same costs and constraints as the one built by
+  // DoDifferentialInverseKinematics(). Those which depend on the arguments of
+  // Solve() are added with placeholder coefficients, which are overwritten
+  // before each solve.
+  prog_ = std::make_unique<solvers::MathematicalProgram>();
+  v_next_ = prog_->NewContinuousVariables(num_velocities, "v_next");
+  alpha_ = prog_->NewContinuousVariables<1>("alpha");
+
+  const auto identity_num_positions =
+      MatrixX<double>::Identity(num_positions, num_positions);
+
+  if (num_cart_constraints_ > 0) {
+    A_direction_.resize(num_cart_constraints_, num_velocities + 1);
+    A_direction_.setZero();
+    direction_constraint_ =
+        prog_
+            ->AddLinearEqualityConstraint(
+                A_direction_, VectorX<double>::Zero(num_cart_constraints_),
+                {v_next_, alpha_})
+            .evaluator();
+    cart_cost_ =
+        prog_
+            ->AddQuadraticErrorCost(Vector1<double>(kCartesianTrackingWeight),
+                                    Vector1<double>::Zero(), alpha_)
+            .evaluator();
+
+    // All the "unconstrained" degrees of freedom share a single constraint,
+    // whose rows are the last columns of V in the svd of J = UΣV'.
+    const int num_unconstrained_dofs = num_velocities - num_cart_constraints_;
+    if (parameters_.get_unconstrained_degrees_of_freedom_velocity_limit() &&
+        num_unconstrained_dofs > 0) {
+      const double uncon_v =
+          parameters_.get_unconstrained_degrees_of_freedom_velocity_limit()
+              .value();
+      svd_ = Eigen::JacobiSVD<MatrixX<double>>(
+          num_cart_constraints_, num_velocities, Eigen::ComputeFullV);
+      A_unconstrained_dofs_.resize(num_unconstrained_dofs, num_velocities);
+      A_unconstrained_dofs_.setZero();
+      unconstrained_dofs_constraint_ =
+          prog_
+              ->AddLinearConstraint(
+                  A_unconstrained_dofs_,
+                  VectorX<double>::Constant(num_unconstrained_dofs, -uncon_v),
+                  VectorX<double>::Constant(num_unconstrained_dofs, uncon_v),
+                  v_next_)
+              .evaluator();
+    }
+  }
+
+  for (const auto& constraint :
+       parameters_.get_linear_velocity_constraints()) {
+    prog_->AddConstraint(
+        solvers::Binding<solvers::LinearConstraint>(constraint, v_next_));
+  }
+
+  // If redundant, add a small regularization term to q_nominal.
+  const double dt{parameters_.get_timestep()};
+  if (num_cart_constraints_ < num_velocities) {
+    nominal_Q_ = identity_num_positions * dt * dt;
+    nominal_b_.resize(num_positions);
+    nominal_cost_ =
+        prog_
+            ->AddQuadraticErrorCost(nominal_Q_,
+                                    VectorX<double>::Zero(num_positions),
+                                    v_next_)
+            .evaluator();
+    // QuadraticCost stores twice the Q given to AddQuadraticErrorCost().
+    nominal_Q_ *= 2;
+  }
+
+  lower_bound_.resize(num_velocities);
+  upper_bound_.resize(num_velocities);
+
+  // Add q upper and lower joint limit.
+  if (parameters_.get_joint_position_limits()) {
+    position_limits_constraint_ =
+        prog_
+            ->AddBoundingBoxConstraint(
+                VectorX<double>::Constant(num_velocities, -kInf),
+                VectorX<double>::Constant(num_velocities, kInf), v_next_)
+            .evaluator();
+  }
+
+  // Add v_next constraint.
+  if (parameters_.get_joint_velocity_limits()) {
+    prog_->AddBoundingBoxConstraint(
+        parameters_.get_joint_velocity_limits()->first,
+        parameters_.get_joint_velocity_limits()->second, v_next_);
+  }
+
+  // Add vd constraint.
+  if (parameters_.get_joint_acceleration_limits()) {
+    acceleration_limits_constraint_ =
+        prog_
+            ->AddLinearConstraint(
+                identity_num_positions,
+                VectorX<double>::Constant(num_velocities, -kInf),
+                VectorX<double>::Constant(num_velocities, kInf), v_next_)
+            .evaluator();
+  }
+
+  J_WE_W_.resize(6, num_velocities);
+  J_WE_E_scaled_.resize(num_cart_constraints_, num_velocities);
+  V_WE_E_scaled_.resize(num_cart_constraints_);
+
+  solver_.set_workspace_reuse(true);
+}
+
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters)
+    : DifferentialInverseKinematicsSolver(parameters,
+                                          CountNonZeroGains(parameters)) {}
+
+DifferentialInverseKinematicsSolver::~DifferentialInverseKinematicsSolver() =
+    default;
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Eigen::Ref<const VectorX<double>>& V,
+    const Eigen::Ref<const MatrixX<double>>& J) {
+  const int num_velocities = parameters_.get_num_velocities();
+  if (q_current.size() != parameters_.get_num_positions() ||
+      v_current.size() != num_velocities) {
+    throw std::invalid_argument(fmt::format(
+        "Sizes of q_current, {}, and v_current, {}, do not match the number "
+        "of positions, {}, and velocities, {}.",
+        q_current.size(), v_current.size(), parameters_.get_num_positions(),
+        num_velocities));
+  }
+  if (V.size() != num_cart_constraints_ ||
+      J.rows() != num_cart_constraints_ || J.cols() != num_velocities) {
+    throw std::invalid_argument(fmt::format(
+        "Sizes of V, {}, and J, {}x{}, do not match the number of Cartesian "
+        "constraints, {}, and velocities, {}.",
+        V.size(), J.rows(), J.cols(), num_cart_constraints_, num_velocities));
+  }
+
+  if (num_cart_constraints_ > 0) {
+    // Constrain the end effector motion to be in the direction of V,
+    // and penalize magnitude difference from V.
+    const double V_mag = V.norm();
+    A_direction_.leftCols(num_velocities) = J;
+    if (V_mag > 0) {
+      A_direction_.col(num_velocities) = -V / V_mag;
+    } else {
+      A_direction_.col(num_velocities).setZero();
+    }
+    direction_constraint_->UpdateCoefficients(
+        A_direction_, direction_constraint_->lower_bound());
+    cart_cost_->UpdateCoefficients(
+        Vector1<double>(2 * kCartesianTrackingWeight),
+        Vector1<double>(-2 * kCartesianTrackingWeight * V_mag),
+        kCartesianTrackingWeight * V_mag * V_mag);
+
+    if (unconstrained_dofs_constraint_) {
+      // We assume that J is full row-rank, so that the last columns of V
+      // correspond to its zero singular values; see
+      // DoDifferentialInverseKinematics().
+      svd_.compute(J, Eigen::ComputeFullV);
+      A_unconstrained_dofs_ =
+          svd_.matrixV().rightCols(A_unconstrained_dofs_.rows()).transpose();
+      unconstrained_dofs_constraint_->UpdateCoefficients(
+          A_unconstrained_dofs_, unconstrained_dofs_constraint_->lower_bound(),
+          unconstrained_dofs_constraint_->upper_bound());
+    }
+  }
+
+  const double dt{parameters_.get_timestep()};
+  if (nominal_cost_) {
+    // The error cost |dt * v_next - (q_nominal - q_current)|².
+    nominal_b_ = -2 * dt * (parameters_.get_nominal_joint_position() -
+                            q_current);
+    nominal_cost_->UpdateCoefficients(
+        nominal_Q_, nominal_b_,
+        (parameters_.get_nominal_joint_position() - q_current).squaredNorm());
+  }
+
+  if (position_limits_constraint_) {
+    lower_bound_ =
+        (parameters_.get_joint_position_limits()->first - q_current) / dt;
+    upper_bound_ =
+        (parameters_.get_joint_position_limits()->second - q_current) / dt;
+    position_limits_constraint_->set_bounds(lower_bound_, upper_bound_);
+  }
+
+  if (acceleration_limits_constraint_) {
+    lower_bound_ =
+        parameters_.get_joint_acceleration_limits()->first * dt + v_current;
+    upper_bound_ =
+        parameters_.get_joint_acceleration_limits()->second * dt + v_current;
+    acceleration_limits_constraint_->set_bounds(lower_bound_, upper_bound_);
+  }
+
+  // Solve, warm-starting from the previous solution.
+  solver_.Solve(*prog_, nullopt, nullopt, &result_);
+
+  if (!result_.is_success()) {
+    return {nullopt, DifferentialInverseKinematicsStatus::kNoSolutionFound};
+  }
+
+  if (num_cart_constraints_) {
+    VectorX<double> cost(1);
+    cart_cost_->Eval(result_.GetSolution(alpha_), &cost);
+    const double kMaxTrackingError = 5;
+    const double kMinEndEffectorVel = 1e-2;
+    if (cost(0) > kMaxTrackingError &&
+        result_.GetSolution(alpha_)[0] <= kMinEndEffectorVel) {
+      // Not tracking the desired vel norm (large tracking error) and the
+      // computed vel is small.
+      log()->info("v_next = {}", result_.GetSolution(v_next_).transpose());
+      log()->info("alpha = {}", result_.GetSolution(alpha_).transpose());
+      return {nullopt, DifferentialInverseKinematicsStatus::kStuck};
+    }
+  }
+
+  return {result_.GetSolution(v_next_),
+          DifferentialInverseKinematicsStatus::kSolutionFound};
+}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const multibody::MultibodyPlant<double>& robot,
+    const systems::Context<double>& context,
+    const Vector6<double>& V_WE_desired,
+    const multibody::Frame<double>& frame_E) {
+  if (num_cart_constraints_ != CountNonZeroGains(parameters_)) {
+    throw std::logic_error(fmt::format(
+        "Number of Cartesian constraints, {}, does not match the number of "
+        "non-zero end effector velocity gains, {}.",
+        num_cart_constraints_, CountNonZeroGains(parameters_)));
+  }
+
+  const math::RigidTransform<double> X_WE =
+      robot.CalcRelativeTransform(context, robot.world_frame(), frame_E);
+  const multibody::Frame<double>& frame_W = robot.world_frame();
+  robot.CalcJacobianSpatialVelocity(context,
+                                    multibody::JacobianWrtVariable::kV,
+                                    frame_E, Vector3<double>::Zero(),
+                                    frame_W, frame_W, &J_WE_W_);
+
+  // Same as internal::DoDifferentialInverseKinematics(), but the rows of the
+  // Jacobian are rotated to the E frame one at a time, into preallocated
+  // storage.
+  const math::RotationMatrix<double> R_EW = X_WE.rotation().transpose();
+  const multibody::SpatialVelocity<double> V_WE_E =
+      R_EW * multibody::SpatialVelocity<double>(V_WE_desired);
+  int row = 0;
+  for (int i = 0; i < 6; i++) {
+    const double gain{parameters_.get_end_effector_velocity_gain()(i)};
+    if (gain > 0) {
+      J_WE_E_scaled_.row(row).noalias() =
+          gain * R_EW.matrix().row(i % 3) * J_WE_W_.middleRows<3>(i < 3 ? 0 : 3);
+      V_WE_E_scaled_(row) = gain * V_WE_E[i];
+      row++;
+    }
+  }
+
+  return Solve(robot.GetPositions(context), robot.GetVelocities(context),
+               V_WE_E_scaled_, J_WE_E_scaled_);
+}
+
 }  // namespace planner
 }  // namespace manipulation
 }  // namespace drake
@@ -16,6 +16,7 @@
 #include "drake/multibody/math/spatial_velocity.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
 
 namespace drake {
 namespace manipulation {
@@ -332,6 +333,115 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const multibody::Frame<double>& frame_E,
     const DifferentialInverseKinematicsParameters& parameters);
 
+/**
+ * A stateful version of DoDifferentialInverseKinematics(), for repeated solves
+ * at a high rate, e.g., in the loop of a teleoperation controller.
+ *
+ * The free functions build a new MathematicalProgram and solver on every
+ * call. Instead, this class builds the program once, in the constructor, with
+ * the same formulation and the constraints and constants in `parameters`.
+ * Each call to Solve() only updates, in place, the coefficients that depend on
+ * the Jacobian, the desired velocity and the current state, and solves the
+ * program with an OsqpSolver whose workspace is kept alive across calls. OSQP
+ * is warm-started from the solution of the previous call.
+ *
+ * Since the structure of the program is fixed, the parameters are copied on
+ * construction, and the number of rows of the Jacobian (i.e., of Cartesian
+ * constraints) can't change between calls.
+ */
+class DifferentialInverseKinematicsSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DifferentialInverseKinematicsSolver)
+
+  /**
+   * Builds the program.
+   * @param parameters Collection of various problem specific constraints and
+   * constants. It is copied, so that later changes to it have no effect.
+   * @param num_cart_constraints The number of rows of the Jacobian J and the
+   * velocity V passed to Solve().
+   * @throws std::exception if `num_cart_constraints` is negative, or if the
+   * number of positions and velocities in `parameters` differ.
+   */
+  DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters,
+      int num_cart_constraints);
+
+  /**
+   * Convenience constructor to track the spatial velocity of a frame with
+   * Solve(robot, context, V_WE_desired, frame_E). The number of Cartesian
+   * constraints is the number of non-zero end effector gains in
+   * `parameters`.
+   */
+  explicit DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters);
+
+  ~DifferentialInverseKinematicsSolver();
+
+  /** Returns the parameters that the program was built with. */
+  const DifferentialInverseKinematicsParameters& get_parameters() const {
+    return parameters_;
+  }
+
+  /** Returns the number of rows of the Jacobian expected by Solve(). */
+  int num_cart_constraints() const { return num_cart_constraints_; }
+
+  /**
+   * Same as DoDifferentialInverseKinematics(q_current, v_current, V, J,
+   * parameters), with the parameters given on construction.
+   * @throws std::exception if the sizes of the arguments are not consistent
+   * with the parameters and num_cart_constraints().
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const Eigen::Ref<const VectorX<double>>& q_current,
+      const Eigen::Ref<const VectorX<double>>& v_current,
+      const Eigen::Ref<const VectorX<double>>& V,
+      const Eigen::Ref<const MatrixX<double>>& J);
+
+  /**
+   * Same as DoDifferentialInverseKinematics(robot, context, V_WE_desired,
+   * frame_E, parameters), with the parameters given on construction.
+   * @throws std::exception if num_cart_constraints() is not the number of
+   * non-zero end effector gains in the parameters.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const multibody::MultibodyPlant<double>& robot,
+      const systems::Context<double>& context,
+      const Vector6<double>& V_WE_desired,
+      const multibody::Frame<double>& frame_E);
+
+ private:
+  const DifferentialInverseKinematicsParameters parameters_;
+  const int num_cart_constraints_{};
+
+  std::unique_ptr<solvers::MathematicalProgram> prog_;
+  solvers::VectorXDecisionVariable v_next_;
+  solvers::VectorDecisionVariable<1> alpha_;
+
+  // The costs and constraints whose coefficients are updated on each call.
+  // They are null when absent from the program.
+  std::shared_ptr<solvers::LinearEqualityConstraint> direction_constraint_;
+  std::shared_ptr<solvers::QuadraticCost> cart_cost_;
+  std::shared_ptr<solvers::LinearConstraint> unconstrained_dofs_constraint_;
+  std::shared_ptr<solvers::QuadraticCost> nominal_cost_;
+  std::shared_ptr<solvers::BoundingBoxConstraint> position_limits_constraint_;
+  std::shared_ptr<solvers::LinearConstraint> acceleration_limits_constraint_;
+
+  // Preallocated storage for the updated coefficients.
+  MatrixX<double> A_direction_;
+  Eigen::JacobiSVD<MatrixX<double>> svd_;
+  MatrixX<double> A_unconstrained_dofs_;
+  VectorX<double> lower_bound_;
+  VectorX<double> upper_bound_;
+  MatrixX<double> nominal_Q_;
+  VectorX<double> nominal_b_;
+  MatrixX<double> J_WE_W_;
+  MatrixX<double> J_WE_E_scaled_;
+  VectorX<double> V_WE_E_scaled_;
+
+  solvers::OsqpSolver solver_;
+  solvers::MathematicalProgramResult result_;
+};
+
 #ifndef DRAKE_DOXYGEN_CXX
 namespace internal {
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
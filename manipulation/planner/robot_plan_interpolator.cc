@@ -144,10 +144,11 @@ void RobotPlanInterpolator::OutputState(const systems::Context<double>& context,
       output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_vec.head(plant_.num_positions()) =
-      plan.pp.value(current_plan_time);
-  output_vec.tail(plant_.num_velocities()) =
-      plan.pp_deriv.value(current_plan_time);
+  // Evaluate the plan directly into the output, without temporaries.
+  auto position = output_vec.head(plant_.num_positions());
+  plan.pp.value(current_plan_time, &position);
+  auto velocity = output_vec.tail(plant_.num_velocities());
+  plan.pp_deriv.value(current_plan_time, &velocity);
 }
 
 void RobotPlanInterpolator::OutputAccel(
@@ -161,7 +162,7 @@ void RobotPlanInterpolator::OutputAccel(
       output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_acceleration_vec = plan.pp_double_deriv.value(current_plan_time);
+  plan.pp_double_deriv.value(current_plan_time, &output_acceleration_vec);
 
   // Stop outputting accelerations at the end of the plan.
   if (current_plan_time > plan.pp_double_deriv.end_time()) {
@@ -243,6 +243,54 @@ TEST_F(DifferentialInverseKinematicsTest, SimpleTracker) {
                               MatrixCompareType::absolute));
 }
 
+// The stateful solver should give the same answers as the free functions,
+// while tracking a fixed end effector pose.
+TEST_F(DifferentialInverseKinematicsTest, StatefulSolver) {
+  DifferentialInverseKinematicsSolver dut(*params_);
+  EXPECT_EQ(dut.num_cart_constraints(), 6);
+
+  const math::RigidTransform<double> X_WE =
+      frame_E_->CalcPoseInWorld(*context_);
+  const math::RigidTransform<double> X_WE_desired =
+      math::RigidTransform<double>(Vector3d(-0.02, -0.01, -0.03)) * X_WE;
+  const double dt = params_->get_timestep();
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    const math::RigidTransform<double> X_WE_current =
+        frame_E_->CalcPoseInWorld(*context_);
+    const Vector6<double> V_WE_desired =
+        ComputePoseDiffInCommonFrame(X_WE_current.GetAsIsometry3(),
+                                     X_WE_desired.GetAsIsometry3()) / dt;
+    const DifferentialInverseKinematicsResult expected =
+        DoDifferentialInverseKinematics(*plant_, *context_, V_WE_desired,
+                                        *frame_E_, *params_);
+    const DifferentialInverseKinematicsResult result =
+        dut.Solve(*plant_, *context_, V_WE_desired, *frame_E_);
+    ASSERT_EQ(result.status, expected.status);
+    ASSERT_TRUE(result.joint_velocities != nullopt);
+    EXPECT_TRUE(CompareMatrices(result.joint_velocities.value(),
+                                expected.joint_velocities.value(), 1e-3,
+                                MatrixCompareType::absolute));
+
+    const VectorXd q = plant_->GetPositions(*context_);
+    plant_->SetPositions(context_, q + result.joint_velocities.value() * dt);
+  }
+
+  // The parameters are copied on construction.
+  params_->set_timestep(1);
+  EXPECT_EQ(dut.get_parameters().get_timestep(), dt);
+
+  // Mismatched sizes.
+  const VectorXd q = plant_->GetPositions(*context_);
+  const VectorXd v = plant_->GetVelocities(*context_);
+  EXPECT_THROW(dut.Solve(q, v, VectorXd::Zero(5), MatrixX<double>::Zero(5, 7)),
+               std::invalid_argument);
+  EXPECT_THROW(dut.Solve(VectorXd::Zero(6), v, VectorXd::Zero(6),
+                         MatrixX<double>::Zero(6, 7)),
+               std::invalid_argument);
+  EXPECT_THROW(DifferentialInverseKinematicsSolver(*params_, -1),
+               std::invalid_argument);
+}
+
 // Test various throw conditions.
 GTEST_TEST(DifferentialInverseKinematicsParametersTest, TestSetter) {
   DifferentialInverseKinematicsParameters dut(1, 1);
@@ -5,10 +5,14 @@
 #pragma once
 
 #include <algorithm>
+#include <utility>
 
 #include <Eigen/Dense>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/gradient.h"
@@ -210,5 +214,90 @@ DiscardZeroGradient(
   return transform;
 }
 
+/// Computes the Jacobian ∂f/∂x of `f` at @p x by forward-mode automatic
+/// differentiation, in chunks of (at most) `kChunkSize` derivatives.
+///
+/// Evaluating `f` once on a vector of AutoDiffXd seeded with the identity
+/// matrix carries, through every operation, a heap-allocated derivative
+/// vector as wide as @p x. Instead, this function evaluates `f` once per
+/// chunk of `kChunkSize` consecutive elements of @p x, on a vector of
+/// AutoDiffScalar whose derivatives are a fixed-size `kChunkSize` vector,
+/// seeded with the unit vectors of the elements of that chunk (and zero for
+/// the other elements). This trades ⌈x.size() / kChunkSize⌉ evaluations of
+/// the value of `f` for derivative arithmetic that needs no allocation and
+/// that Eigen vectorizes, which pays off when @p x has more than a few dozen
+/// elements. Chunks of 8 or 16 are usually a good choice.
+///
+/// @param f The function, which must be callable as
+///   `f(const VectorX<ChunkScalar>&)`, where ChunkScalar is
+///   `Eigen::AutoDiffScalar<Eigen::Matrix<double, kChunkSize, 1>>`, and
+///   return an Eigen column vector of ChunkScalar whose size does not depend
+///   on its argument. A generic lambda, or a function template of the scalar
+///   type, is the easiest way to provide it.
+/// @param x The point at which the Jacobian is computed.
+/// @param num_threads The maximum number of threads among which the chunks
+///   are divided (see StaticParallelForIndexLoop()). When it is larger than
+///   one, `f` must be safe to call concurrently.
+/// @retval jacobian The matrix of size f(x).size() x x.size() whose element
+///   (i, j) is ∂fᵢ/∂xⱼ.
+/// @throws std::exception if @p num_threads is less than one.
+///
+/// @code{cc}
+/// const Eigen::MatrixXd J = ComputeJacobianByChunks<8>(
+///     [](const auto& x) { return (x.array().sin() * x(0)).matrix().eval(); },
+///     Eigen::VectorXd::LinSpaced(100, 0.0, 1.0));
+/// @endcode
+template <int kChunkSize, typename Function>
+Eigen::MatrixXd ComputeJacobianByChunks(
+    Function&& f, const Eigen::Ref<const Eigen::VectorXd>& x,
+    int num_threads = 1) {
+  static_assert(kChunkSize > 0, "kChunkSize must be positive");
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  using ChunkDerivatives = Eigen::Matrix<double, kChunkSize, 1>;
+  using ChunkScalar = Eigen::AutoDiffScalar<ChunkDerivatives>;
+  const int num_inputs = x.size();
+  const int num_chunks = (num_inputs + kChunkSize - 1) / kChunkSize;
+
+  // Evaluates f with the derivatives seeded for chunk `chunk`, and copies the
+  // columns of that chunk into `jacobian`, which is first resized if `resize`.
+  auto evaluate_chunk = [&f, &x, num_inputs](int chunk, bool resize,
+                                             Eigen::MatrixXd* jacobian) {
+    const int first = chunk * kChunkSize;
+    const int size = std::min(kChunkSize, num_inputs - first);
+    VectorX<ChunkScalar> x_chunk(num_inputs);
+    for (int j = 0; j < num_inputs; ++j) {
+      x_chunk(j).value() = x(j);
+      x_chunk(j).derivatives().setZero();
+    }
+    for (int k = 0; k < size; ++k) {
+      x_chunk(first + k).derivatives()(k) = 1.0;
+    }
+    const VectorX<ChunkScalar> y_chunk = f(x_chunk);
+    if (resize) {
+      jacobian->resize(y_chunk.size(), num_inputs);
+    }
+    DRAKE_DEMAND(y_chunk.size() == jacobian->rows());
+    for (int i = 0; i < y_chunk.size(); ++i) {
+      jacobian->row(i).segment(first, size) =
+          y_chunk(i).derivatives().head(size).transpose();
+    }
+  };
+
+  if (num_chunks == 0) {
+    // There is nothing to seed, but f(x) still determines the number of rows.
+    const VectorX<ChunkScalar> y = f(VectorX<ChunkScalar>(0));
+    return Eigen::MatrixXd(y.size(), 0);
+  }
+  // The first chunk sizes the Jacobian, so that the others may fill in their
+  // columns concurrently.
+  Eigen::MatrixXd jacobian;
+  evaluate_chunk(0, true, &jacobian);
+  StaticParallelForIndexLoop(
+      num_threads, 1, num_chunks, [&evaluate_chunk, &jacobian](int, int chunk) {
+        evaluate_chunk(chunk, false, &jacobian);
+      });
+  return jacobian;
+}
+
 }  // namespace math
 }  // namespace drake
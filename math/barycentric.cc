@@ -17,7 +17,8 @@ template <typename T>
 BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
     : input_grid_(std::move(input_grid)),
       stride_(input_grid_.size()),
-      num_interpolants_{1} {
+      num_interpolants_{1},
+      coordinates_(input_grid_.size()) {
   DRAKE_DEMAND(input_grid_.size() > 0);
   for (int i = 0; i < get_input_size(); i++) {
     // Must define at least one mesh point per dimension.
@@ -27,6 +28,7 @@ BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
     if (input_grid_[i].size() > 1) num_interpolants_++;
 
     stride_[i] = (i == 0) ? 1 : input_grid_[i - 1].size() * stride_[i - 1];
+    coordinates_[i].assign(input_grid_[i].begin(), input_grid_[i].end());
   }
 }
 
@@ -71,86 +73,116 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
     const Eigen::Ref<const VectorX<T>>& input,
     EigenPtr<Eigen::VectorXi> mesh_indices,
     EigenPtr<VectorX<T>> weights) const {
-  DRAKE_DEMAND(input.size() == static_cast<int>(input_grid_.size()));
+  DRAKE_DEMAND(input.size() == get_input_size());
 
-  // std::pair of fractional position [0,1] and dimension index (position first,
-  // so that std::pair's default operator< works for us).
   // There is one relative position for every non-singleton input dimension.  In
   // the case of triangular meshes, there is one interpolant for every
   // non-singular dimension + one additional, so num_interpolants-1 is the size
   // we need.
   std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
-  // Bounding box on the input grid containing the sample input.
-  std::vector<bool> has_volume(get_input_size());
+  mesh_indices->resize(num_interpolants_);
+  weights->resize(num_interpolants_);
+  EvalBarycentricWeightsInPlace(input, mesh_indices->data(), weights->data(),
+                                relative_position.data());
+}
+
+template <typename T>
+void BarycentricMesh<T>::EvalBarycentricWeightsBatch(
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    EigenPtr<Eigen::MatrixXi> mesh_indices,
+    EigenPtr<MatrixX<T>> weights) const {
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(mesh_indices->rows() == num_interpolants_);
+  DRAKE_DEMAND(mesh_indices->cols() == inputs.cols());
+  DRAKE_DEMAND(weights->rows() == num_interpolants_);
+  DRAKE_DEMAND(weights->cols() == inputs.cols());
+
+  // The scratch space is shared by all of the inputs.
+  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
+  for (int j = 0; j < inputs.cols(); j++) {
+    EvalBarycentricWeightsInPlace(inputs.col(j), mesh_indices->col(j).data(),
+                                  weights->col(j).data(),
+                                  relative_position.data());
+  }
+}
 
+template <typename T>
+void BarycentricMesh<T>::EvalBarycentricWeightsInPlace(
+    const Eigen::Ref<const VectorX<T>>& input, int* mesh_indices, T* weights,
+    std::pair<T, int>* relative_position) const {
+  // The relative positions are std::pairs of fractional position [0,1] and
+  // tagged dimension index (position first, so that std::pair's default
+  // operator< works for us).  The tag of dimension i is 2 * i + 1 when the
+  // input is strictly inside the grid along that dimension (so that the
+  // bounding box has volume along it), and 2 * i otherwise.
   int current_index = 0;
 
   // Loop through input dimensions and compute the relative positions and
   // indices.  Set current_index to the "top right" corner index.
   int count = 0;
   for (int i = 0; i < get_input_size(); i++) {
-    const auto& coords = input_grid_[i];
+    const std::vector<double>& coords = coordinates_[i];
 
     // Skip over singleton dimensions.
     if (coords.size() == 1) continue;
 
-    // Tag the positions with the dimension index.
-    relative_position[count].second = i;
-
     // Find the right side of the bounding box.
     // Recall that lower_bound returns the first grid element that is NOT less
     // than the sample.
-    auto right_iter = coords.lower_bound(input[i]);
+    const auto right_iter =
+        std::lower_bound(coords.begin(), coords.end(), input[i]);
     int right_index = 0;
+    bool has_volume = false;
 
     if (right_iter == coords.end()) {
       // ... then input is off the right end of the grid;
       // move it to the right boundary.
-      has_volume[i] = false;
       right_index = coords.size() - 1;
       relative_position[count].first = T(1.);
     } else if (right_iter == coords.begin()) {
       // ... then input is at the first element or left of it;
       // move it to the left boundary.
-      has_volume[i] = false;
       right_index = 0;
       relative_position[count].first = T(1.);
     } else {
       // ... then input is inside the grid.
-      has_volume[i] = true;
-      right_index = std::distance(coords.begin(), right_iter);
-      const T& right_value = *(right_iter);
-      const T& left_value = *(std::prev(right_iter));
+      has_volume = true;
+      right_index = right_iter - coords.begin();
+      const double right_value = *right_iter;
+      const double left_value = *(right_iter - 1);
       relative_position[count].first =
           (input[i] - left_value) / (right_value - left_value);
     }
+    relative_position[count].second = 2 * i + (has_volume ? 1 : 0);
 
     current_index += stride_[i] * right_index;
     count++;
   }
   DRAKE_ASSERT(count == (num_interpolants_ - 1));
 
+  mesh_indices[0] = current_index;
+  if (count == 0) {
+    // All of the dimensions are singletons; there is a single mesh point.
+    weights[0] = T(1.);
+    return;
+  }
+
   // Sort the dimensions by their relative position.  We identify which triangle
   // of the mesh we are in by moving along the faces in order of their relative
   // position.
-  std::sort(relative_position.begin(), relative_position.end());
-
-  mesh_indices->resize(num_interpolants_);
-  weights->resize(num_interpolants_);
-  (*mesh_indices)[0] = current_index;
-  (*weights)[0] = relative_position[0].first;
+  std::sort(relative_position, relative_position + count);
 
+  weights[0] = relative_position[0].first;
   for (int i = 1; i < num_interpolants_; i++) {
-    int dim = relative_position[i - 1].second;
-    if (has_volume[dim]) {
-      current_index -= stride_[dim];
+    const int tag = relative_position[i - 1].second;
+    if (tag % 2 == 1) {
+      current_index -= stride_[tag / 2];
     }
-    (*mesh_indices)[i] = current_index;
+    mesh_indices[i] = current_index;
     if (i == (num_interpolants_ - 1)) {
-      (*weights)[i] = 1.0 - relative_position[i - 1].first;
+      weights[i] = 1.0 - relative_position[i - 1].first;
     } else {
-      (*weights)[i] =
-          relative_position[i].first - relative_position[i - 1].first;
+      weights[i] = relative_position[i].first - relative_position[i - 1].first;
     }
   }
 }
@@ -169,6 +201,31 @@ VectorX<T> BarycentricMesh<T>::Eval(
   return EvalWithMixedScalars<T>(mesh_values, input);
 }
 
+template <typename T>
+void BarycentricMesh<T>::EvalBatch(
+    const Eigen::Ref<const MatrixX<T>>& mesh_values,
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    EigenPtr<MatrixX<T>> outputs) const {
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(mesh_values.cols() == get_num_mesh_points());
+  DRAKE_DEMAND(outputs->rows() == mesh_values.rows());
+  DRAKE_DEMAND(outputs->cols() == inputs.cols());
+
+  // The scratch space is shared by all of the inputs.
+  Eigen::VectorXi mesh_indices(num_interpolants_);
+  VectorX<T> weights(num_interpolants_);
+  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
+  for (int j = 0; j < inputs.cols(); j++) {
+    EvalBarycentricWeightsInPlace(inputs.col(j), mesh_indices.data(),
+                                  weights.data(), relative_position.data());
+    auto output = outputs->col(j);
+    output = weights[0] * mesh_values.col(mesh_indices[0]);
+    for (int i = 1; i < num_interpolants_; i++) {
+      output += weights[i] * mesh_values.col(mesh_indices[i]);
+    }
+  }
+}
+
 template <typename T>
 MatrixX<T> BarycentricMesh<T>::MeshValuesFrom(
     const std::function<VectorX<T>(const Eigen::Ref<const VectorX<T>>&)>&
@@ -3,6 +3,7 @@
 #include <iterator>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -100,6 +101,23 @@ class BarycentricMesh {
                               EigenPtr<Eigen::VectorXi> mesh_indices,
                               EigenPtr<VectorX<T>> weights) const;
 
+  /// Performs EvalBarycentricWeights for many inputs at once.  The work is
+  /// done in place in the given buffers, without any memory allocation per
+  /// input, so that large batches (e.g. all of the samples of a fitted value
+  /// iteration) are evaluated efficiently.
+  ///
+  /// @param inputs is a get_input_size() by num_points matrix, with one input
+  /// per column.
+  /// @param mesh_indices is a pointer to a get_num_interpolants() by
+  /// num_points matrix whose column j is set to the mesh indices of column j
+  /// of @p inputs.
+  /// @param weights is a pointer to a get_num_interpolants() by num_points
+  /// matrix whose column j is set to the coefficients of column j of
+  /// @p inputs.
+  void EvalBarycentricWeightsBatch(const Eigen::Ref<const MatrixX<T>>& inputs,
+                                   EigenPtr<Eigen::MatrixXi> mesh_indices,
+                                   EigenPtr<MatrixX<T>> weights) const;
+
   /// Evaluates the function at the @p input values, by interpolating between
   /// the values at @p mesh_values.  Inputs that are outside the
   /// bounding box of the input_grid are interpolated as though they were
@@ -123,6 +141,19 @@ class BarycentricMesh {
   VectorX<T> Eval(const Eigen::Ref<const MatrixX<T>>& mesh_values,
                   const Eigen::Ref<const VectorX<T>>& input) const;
 
+  /// Performs Eval for many inputs at once, writing into a caller-provided
+  /// buffer without any memory allocation per input.
+  ///
+  /// @param mesh_values is a num_outputs by get_num_mesh_points() matrix, as
+  /// for Eval.
+  /// @param inputs is a get_input_size() by num_points matrix, with one input
+  /// per column.
+  /// @param outputs is a pointer to a num_outputs by num_points matrix whose
+  /// column j is set to the function evaluated at column j of @p inputs.
+  void EvalBatch(const Eigen::Ref<const MatrixX<T>>& mesh_values,
+                 const Eigen::Ref<const MatrixX<T>>& inputs,
+                 EigenPtr<MatrixX<T>> outputs) const;
+
   /// Performs Eval, but with the possibility of the values on the mesh
   /// having a different scalar type than the values defining the mesh
   /// (symbolic::Expression containing decision variables for an optimization
@@ -171,11 +202,20 @@ class BarycentricMesh {
           vector_func) const;
 
  private:
+  // Writes the mesh indices and weights of @p input to the given arrays of
+  // length num_interpolants_, using @p relative_position (of length
+  // num_interpolants_ - 1) as scratch space.
+  void EvalBarycentricWeightsInPlace(
+      const Eigen::Ref<const VectorX<T>>& input, int* mesh_indices,
+      T* weights, std::pair<T, int>* relative_position) const;
+
   MeshGrid input_grid_;      // Specifies the location of the mesh points in
                              // the input space.
   std::vector<int> stride_;  // The number of elements to skip to arrive at the
                              // next value (per input dimension)
   int num_interpolants_{1};  // The number of points used in any interpolation.
+  // The coordinates of input_grid_, stored contiguously for fast lookups.
+  std::vector<std::vector<double>> coordinates_;
 };
 
 }  // namespace math
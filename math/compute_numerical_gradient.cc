@@ -0,0 +1,142 @@
+#include "drake/math/compute_numerical_gradient.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace math {
+namespace {
+// Returns the row indices of the entries of `sparsity_pattern`, grouped by
+// column. Throws if an index is out of range.
+std::vector<std::vector<int>> GroupRowsByColumn(
+    int num_rows, int num_cols,
+    const std::vector<std::pair<int, int>>& sparsity_pattern,
+    const char* caller) {
+  std::vector<std::vector<int>> rows_of_column(num_cols);
+  for (const auto& entry : sparsity_pattern) {
+    if (entry.first < 0 || entry.first >= num_rows || entry.second < 0 ||
+        entry.second >= num_cols) {
+      throw std::runtime_error(
+          std::string(caller) + "(): the sparsity pattern has the entry (" +
+          std::to_string(entry.first) + ", " + std::to_string(entry.second) +
+          "), which is out of range.");
+    }
+    rows_of_column[entry.second].push_back(entry.first);
+  }
+  return rows_of_column;
+}
+}  // namespace
+
+std::vector<int> ComputeColumnColoring(
+    int num_cols, const std::vector<std::pair<int, int>>& sparsity_pattern) {
+  DRAKE_THROW_UNLESS(num_cols >= 0);
+  int num_rows = 0;
+  for (const auto& entry : sparsity_pattern) {
+    num_rows = std::max(num_rows, entry.first + 1);
+  }
+  const std::vector<std::vector<int>> rows_of_column = GroupRowsByColumn(
+      num_rows, num_cols, sparsity_pattern, "ComputeColumnColoring");
+  std::vector<std::vector<int>> columns_of_row(num_rows);
+  for (int j = 0; j < num_cols; ++j) {
+    for (int i : rows_of_column[j]) {
+      columns_of_row[i].push_back(j);
+    }
+  }
+
+  std::vector<int> colors(num_cols, -1);
+  // forbidden[c] == j iff color c is used by a column that shares a row with
+  // column j, so that it needs no clearing between the columns.
+  std::vector<int> forbidden;
+  for (int j = 0; j < num_cols; ++j) {
+    for (int i : rows_of_column[j]) {
+      for (int k : columns_of_row[i]) {
+        if (colors[k] >= 0) {
+          forbidden[colors[k]] = j;
+        }
+      }
+    }
+    int color = 0;
+    while (color < static_cast<int>(forbidden.size()) &&
+           forbidden[color] == j) {
+      ++color;
+    }
+    if (color == static_cast<int>(forbidden.size())) {
+      forbidden.push_back(-1);
+    }
+    colors[j] = color;
+  }
+  return colors;
+}
+
+Eigen::MatrixXd ComputeSparseNumericalGradient(
+    const std::function<void(const Eigen::VectorXd&, Eigen::VectorXd*)>&
+        calc_fun,
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const std::vector<std::pair<int, int>>& sparsity_pattern,
+    const NumericalGradientOption& option, int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const int num_cols = x.rows();
+  // f(x) is needed for its size, and for the one-sided differences.
+  const Eigen::VectorXd x0 = x;
+  Eigen::VectorXd y;
+  calc_fun(x0, &y);
+  const int num_rows = y.rows();
+  const std::vector<std::vector<int>> rows_of_column = GroupRowsByColumn(
+      num_rows, num_cols, sparsity_pattern, "ComputeSparseNumericalGradient");
+  const std::vector<int> colors =
+      ComputeColumnColoring(num_cols, sparsity_pattern);
+  const int num_colors =
+      colors.empty() ? 0 : *std::max_element(colors.begin(), colors.end()) + 1;
+  std::vector<std::vector<int>> columns_of_color(num_colors);
+  for (int j = 0; j < num_cols; ++j) {
+    columns_of_color[colors[j]].push_back(j);
+  }
+
+  const NumericalGradientMethod method = option.method();
+  const bool perturb_plus = method == NumericalGradientMethod::kForward ||
+                            method == NumericalGradientMethod::kCentral;
+  const bool perturb_minus = method == NumericalGradientMethod::kBackward ||
+                             method == NumericalGradientMethod::kCentral;
+  Eigen::MatrixXd J = Eigen::MatrixXd::Zero(num_rows, num_cols);
+  // Each thread has its own perturbed points and values, which it restores
+  // after each color. Each color writes to its own columns of J.
+  std::vector<Eigen::VectorXd> x_plus(num_threads, x0);
+  std::vector<Eigen::VectorXd> x_minus(num_threads, x0);
+  std::vector<Eigen::VectorXd> y_plus(num_threads, y);
+  std::vector<Eigen::VectorXd> y_minus(num_threads, y);
+  StaticParallelForIndexLoop(
+      num_threads, 0, num_colors, [&](int thread_num, int color) {
+        Eigen::VectorXd& xp = x_plus[thread_num];
+        Eigen::VectorXd& xm = x_minus[thread_num];
+        const std::vector<int>& columns = columns_of_color[color];
+        for (int j : columns) {
+          const double delta =
+              std::max(option.perturbation_size(),
+                       std::abs(x0(j)) * option.perturbation_size());
+          if (perturb_plus) xp(j) += delta;
+          if (perturb_minus) xm(j) -= delta;
+        }
+        if (perturb_plus) calc_fun(xp, &y_plus[thread_num]);
+        if (perturb_minus) calc_fun(xm, &y_minus[thread_num]);
+        const Eigen::VectorXd& yp = perturb_plus ? y_plus[thread_num] : y;
+        const Eigen::VectorXd& ym = perturb_minus ? y_minus[thread_num] : y;
+        for (int j : columns) {
+          // No other column of this color has an entry in the rows of j.
+          const double dx = (perturb_plus ? xp(j) : x0(j)) -
+                            (perturb_minus ? xm(j) : x0(j));
+          for (int i : rows_of_column[j]) {
+            J(i, j) = (yp(i) - ym(i)) / dx;
+          }
+          xp(j) = xm(j) = x0(j);
+        }
+      });
+  return J;
+}
+
+}  // namespace math
+}  // namespace drake
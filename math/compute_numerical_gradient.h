@@ -1,6 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 
@@ -140,5 +143,58 @@ ComputeNumericalGradient(
   }
   return J;
 }
+
+/**
+ * Partitions the columns of a sparse matrix into groups (colors) of
+ * structurally orthogonal columns, i.e. columns of the same color have no
+ * nonzero entry in a common row. This is the greedy coloring of Curtis,
+ * Powell and Reid: the columns are considered in order, and each one gets the
+ * smallest color not already used by a column that shares a row with it. For
+ * a banded matrix of bandwidth b, this yields the optimal b colors.
+ * @param num_cols The number of columns of the matrix.
+ * @param sparsity_pattern The (row, column) indices of the nonzero entries,
+ * in any order, as in solvers::EvaluatorBase::gradient_sparsity_pattern().
+ * Duplicates are allowed.
+ * @retval colors A vector of size num_cols, where colors[j] is the color of
+ * column j. The colors are 0, 1, ..., num_colors - 1.
+ * @throws std::runtime_error if an index is negative or a column index is not
+ * less than num_cols.
+ */
+std::vector<int> ComputeColumnColoring(
+    int num_cols, const std::vector<std::pair<int, int>>& sparsity_pattern);
+
+/**
+ * Compute the gradient of a function f(x) through numerical difference, like
+ * ComputeNumericalGradient(), but with a known sparsity pattern of the
+ * gradient. The columns of the gradient are colored with
+ * ComputeColumnColoring(), and the variables of the columns of each color are
+ * perturbed together, since each entry of f depends on at most one of them.
+ * This computes the gradient with one evaluation of f per color (two for
+ * the central difference), plus one for f(x) (except for the central
+ * difference), instead of one per variable: e.g., only 3 perturbations for a
+ * tridiagonal gradient of any size.
+ * @param calc_fun calc_fun(x, &y) computes the value of f(x), and stores the
+ * value in y, which it must resize if needed.
+ * @param x The point at which the numerical gradient is computed.
+ * @param sparsity_pattern The (row, column) indices of the entries of the
+ * gradient that may be nonzero. The other entries are assumed to be zero.
+ * @param option The options for computing numerical gradient.
+ * @param num_threads The maximum number of threads among which the
+ * perturbations are divided (see StaticParallelForIndexLoop()). When it is
+ * larger than one, `calc_fun` must be safe to call concurrently.
+ * @retval gradient a matrix of size y.rows() x x.rows(). gradient(i, j) is
+ * ∂f(i) / ∂x(j).
+ * @throws std::runtime_error if an index of sparsity_pattern is out of
+ * range, or if num_threads is less than one.
+ */
+Eigen::MatrixXd ComputeSparseNumericalGradient(
+    const std::function<void(const Eigen::VectorXd&, Eigen::VectorXd*)>&
+        calc_fun,
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const std::vector<std::pair<int, int>>& sparsity_pattern,
+    const NumericalGradientOption& option =
+        NumericalGradientOption{NumericalGradientMethod::kForward},
+    int num_threads = 1);
+
 }  // namespace math
 }  // namespace drake
@@ -2,6 +2,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/math/continuous_lyapunov_equation.h"
 
 namespace drake {
 namespace math {
@@ -78,5 +79,49 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
   return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
 }
 
+Eigen::MatrixXd LowRankContinuousAlgebraicRiccatiEquation(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, double tolerance,
+    int max_iterations) {
+  const Eigen::Index n = A.rows(), m = B.cols();
+  if (A.cols() != n || B.rows() != n || C.cols() != n || R.rows() != m ||
+      R.cols() != m) {
+    throw std::runtime_error(
+        "LowRankContinuousAlgebraicRiccatiEquation(): The matrices must have "
+        "compatible sizes!");
+  }
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  DRAKE_DEMAND(tolerance > 0);
+  DRAKE_DEMAND(max_iterations > 0);
+  const Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success) {
+    throw std::runtime_error("R must be positive definite");
+  }
+  const Eigen::MatrixXd L = R_cholesky.matrixL();
+  const Eigen::SparseMatrix<double> A_transpose = A.transpose();
+
+  // Each Newton step solves (A - BK)ᵀS + S(A - BK) + C'C + KᵀRK = 0, i.e.,
+  // FS + SFᵀ + WWᵀ = 0 with F = Aᵀ - KᵀBᵀ and W = [Cᵀ KᵀL].
+  Eigen::MatrixXd K = Eigen::MatrixXd::Zero(m, n);
+  Eigen::MatrixXd W(n, C.rows() + m);
+  for (int i = 0; i < max_iterations; ++i) {
+    W << C.transpose(), K.transpose() * L;
+    const Eigen::MatrixXd Z = internal::CompressLowRankFactor(
+        internal::SolveLowRankLyapunovEquationByAdi(
+            A_transpose, K.transpose(), B, W, tolerance, 500,
+            "LowRankContinuousAlgebraicRiccatiEquation"));
+    const Eigen::MatrixXd K_next =
+        R_cholesky.solve(B.transpose() * Z) * Z.transpose();
+    const double change = (K_next - K).norm();
+    K = K_next;
+    if (change <= tolerance * K.norm()) return Z;
+  }
+  throw std::runtime_error(
+      "LowRankContinuousAlgebraicRiccatiEquation(): The Newton iterations did "
+      "not converge.");
+}
+
 }  // namespace math
 }  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <Eigen/SparseCore>
 
 namespace drake {
 namespace math {
@@ -32,5 +33,35 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::LLT<Eigen::MatrixXd>& R_cholesky);
 
+/// Computes a low-rank factor Z of the stabilizing solution S ≈ ZZᵀ to the
+/// continuous-time algebraic Riccati equation:
+///
+/// @verbatim
+///  S A + A' S - S B inv(R) B' S + C' C = 0
+/// @endverbatim
+///
+/// for large sparse matrices A, for which the dense matrices of
+/// ContinuousAlgebraicRiccatiEquation() are prohibitive. C typically has far
+/// fewer rows than A, and B far fewer columns, so that S is numerically of
+/// low rank.
+///
+/// The implementation is the Newton-Kleinman iteration, starting from the
+/// gain K = 0, which requires the eigenvalues of A to have negative real
+/// parts. Each iteration solves the Lyapunov equation of the closed loop
+/// A - BK, with the low-rank ADI iteration of
+/// LowRankContinuousLyapunovEquation(), in which the low-rank term BK is
+/// handled with the Sherman-Morrison-Woodbury formula, so that A - BK is never
+/// formed. The iterations stop once the relative change of the gain
+/// K = inv(R) B' Z Z' (in the Frobenius norm) is at most @p tolerance.
+///
+/// @throws std::runtime_error if R is not positive definite, if the matrices
+/// do not have compatible sizes, or if the iterations did not converge.
+Eigen::MatrixXd LowRankContinuousAlgebraicRiccatiEquation(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& R, double tolerance = 1e-10,
+    int max_iterations = 50);
+
 }  // namespace math
 }  // namespace drake
@@ -1,9 +1,14 @@
 #include "drake/math/continuous_lyapunov_equation.h"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <limits>
 #include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/SparseLU>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/is_approx_equal_abstol.h"
@@ -19,6 +24,40 @@ namespace {
 const double kTolerance = 5 * std::numeric_limits<double>::epsilon();
 bool is_zero(double x, double eps = 1e-10) { return std::fabs(x) < eps; }
 // TODO(weiqiao.han): figure out what the tolerance ε ought to be.
+
+// The maximum number of columns of the subspaces onto which F is projected to
+// compute the ADI shifts.
+const int kMaxShiftSubspaceSize = 20;
+
+// Returns the square of the 2-norm of the tall matrix W.
+double SquaredNorm2(const Eigen::Ref<const MatrixXd>& W) {
+  if (W.cols() == 0) return 0;
+  const MatrixXd WtW = W.transpose() * W;
+  return Eigen::SelfAdjointEigenSolver<MatrixXd>(WtW, Eigen::EigenvaluesOnly)
+      .eigenvalues()
+      .maxCoeff();
+}
+
+// Returns the real ADI shifts -|μ| for the eigenvalues μ of F = Aᵀ - UVᵀ
+// projected onto the range of `basis`, which have negative real parts.
+std::vector<double> ComputeAdiShifts(
+    const Eigen::SparseMatrix<double>& A_transpose,
+    const Eigen::Ref<const MatrixXd>& U, const Eigen::Ref<const MatrixXd>& V,
+    const Eigen::Ref<const MatrixXd>& basis) {
+  std::vector<double> shifts;
+  if (basis.cols() == 0) return shifts;
+  const Eigen::ColPivHouseholderQR<MatrixXd> qr(basis);
+  const MatrixXd Q =
+      qr.householderQ() * MatrixXd::Identity(basis.rows(), qr.rank());
+  const MatrixXd F_Q = A_transpose * Q - U * (V.transpose() * Q);
+  const MatrixXd H = Q.transpose() * F_Q;
+  if (H.size() == 0) return shifts;
+  const VectorXcd mu = Eigen::EigenSolver<MatrixXd>(H, false).eigenvalues();
+  for (int i = 0; i < mu.size(); ++i) {
+    if (mu(i).real() < 0) shifts.push_back(-std::abs(mu(i)));
+  }
+  return shifts;
+}
 }  // namespace
 
 MatrixXd RealContinuousLyapunovEquation(const Eigen::Ref<const MatrixXd>& A,
@@ -227,6 +266,138 @@ MatrixXd SolveReducedRealContinuousLyapunovEquation(
   return X_bar;
 }
 
+MatrixXd SolveLowRankLyapunovEquationByAdi(
+    const Eigen::SparseMatrix<double>& A_transpose,
+    const Eigen::Ref<const MatrixXd>& U, const Eigen::Ref<const MatrixXd>& V,
+    const Eigen::Ref<const MatrixXd>& W, double tolerance, int max_iterations,
+    const char* caller) {
+  const int n = A_transpose.rows();
+  DRAKE_DEMAND(A_transpose.cols() == n && W.rows() == n);
+  DRAKE_DEMAND(U.rows() == n && V.rows() == n && U.cols() == V.cols());
+  const std::string name(caller);
+
+  MatrixXd residual = W;
+  const double initial_residual = SquaredNorm2(residual);
+  std::vector<MatrixXd> blocks;
+  if (initial_residual == 0) return MatrixXd(n, 0);
+
+  // The sparsity pattern of Aᵀ + pI is that of Aᵀ + I, for any shift p, so
+  // that it is analyzed only once.
+  Eigen::SparseMatrix<double> identity(n, n);
+  identity.setIdentity();
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> lu;
+  lu.analyzePattern(A_transpose + identity);
+  double factorized_shift = 0;
+  bool is_factorized = false;
+  // The capacitance matrix I - Vᵀ(Aᵀ + pI)⁻¹U of the Sherman-Morrison-Woodbury
+  // formula for the solutions with F + pI = Aᵀ + pI - UVᵀ.
+  MatrixXd G_inverse_U;
+  Eigen::PartialPivLU<MatrixXd> capacitance;
+
+  std::vector<double> shifts = ComputeAdiShifts(A_transpose, U, V, W);
+  int next_shift = 0;
+  int first_block_of_shifts = 0;
+  for (int k = 0; k < max_iterations; ++k) {
+    if (next_shift == static_cast<int>(shifts.size())) {
+      // Projects onto (at most kMaxShiftSubspaceSize of) the latest columns
+      // of Z, which were added with the previous shifts.
+      const int num_blocks = blocks.size() - first_block_of_shifts;
+      MatrixXd basis(n, 0);
+      if (num_blocks > 0) {
+        const int block_cols = blocks.back().cols();
+        const int cols =
+            std::min(num_blocks * block_cols, kMaxShiftSubspaceSize);
+        basis.resize(n, cols);
+        for (int j = 0; j < cols; ++j) {
+          const int b = blocks.size() - 1 - j / block_cols;
+          basis.col(j) = blocks[b].col(j % block_cols);
+        }
+      }
+      shifts = ComputeAdiShifts(A_transpose, U, V, basis);
+      next_shift = 0;
+      first_block_of_shifts = blocks.size();
+      if (shifts.empty()) {
+        throw std::runtime_error(
+            name + "(): Failed to compute the ADI shifts; the eigenvalues of "
+                   "A must have negative real parts.");
+      }
+    }
+    const double p = shifts[next_shift++];
+
+    if (!is_factorized || p != factorized_shift) {
+      lu.factorize(A_transpose + p * identity);
+      if (lu.info() != Eigen::Success) {
+        throw std::runtime_error(name + "(): A shifted A is singular.");
+      }
+      factorized_shift = p;
+      is_factorized = true;
+      if (U.cols() > 0) {
+        G_inverse_U = lu.solve(U);
+        capacitance.compute(
+            MatrixXd::Identity(U.cols(), U.cols()) -
+            V.transpose() * G_inverse_U);
+      }
+    }
+    MatrixXd V_k = lu.solve(residual);
+    if (U.cols() > 0) {
+      V_k += G_inverse_U * capacitance.solve(V.transpose() * V_k);
+    }
+    if (!V_k.allFinite()) {
+      throw std::runtime_error(name + "(): A shifted A is singular.");
+    }
+    residual -= 2 * p * V_k;
+    blocks.push_back(std::sqrt(-2 * p) * V_k);
+
+    if (SquaredNorm2(residual) <= tolerance * initial_residual) {
+      MatrixXd Z(n, blocks.size() * W.cols());
+      for (int i = 0; i < static_cast<int>(blocks.size()); ++i) {
+        Z.middleCols(i * W.cols(), W.cols()) = blocks[i];
+      }
+      return Z;
+    }
+  }
+  throw std::runtime_error(
+      name + "(): The ADI iterations did not converge; the eigenvalues of A "
+             "must have negative real parts.");
+}
+
+MatrixXd CompressLowRankFactor(const Eigen::Ref<const MatrixXd>& Z) {
+  const int n = Z.rows();
+  const int k = std::min(Z.rows(), Z.cols());
+  if (k == 0) return MatrixXd(n, 0);
+  // With Z = QR and R = UΣWᵀ, ZZᵀ = (QUΣ)(QUΣ)ᵀ, of which QU is orthonormal.
+  const Eigen::HouseholderQR<MatrixXd> qr(Z);
+  const MatrixXd R =
+      qr.matrixQR().topRows(k).triangularView<Eigen::Upper>();
+  const Eigen::JacobiSVD<MatrixXd> svd(R, Eigen::ComputeThinU);
+  const Eigen::VectorXd& sigma = svd.singularValues();
+  const double threshold =
+      std::sqrt(std::numeric_limits<double>::epsilon()) * sigma(0);
+  int rank = 0;
+  while (rank < sigma.size() && sigma(rank) > threshold) ++rank;
+  const MatrixXd Q = qr.householderQ() * MatrixXd::Identity(n, k);
+  return Q * svd.matrixU().leftCols(rank) * sigma.head(rank).asDiagonal();
+}
+
 }  // namespace internal
+
+MatrixXd LowRankContinuousLyapunovEquation(
+    const Eigen::SparseMatrix<double>& A, const Eigen::Ref<const MatrixXd>& C,
+    double tolerance, int max_iterations) {
+  if (A.rows() != A.cols() || C.cols() != A.rows()) {
+    throw std::runtime_error(
+        "LowRankContinuousLyapunovEquation(): A must be square, and C must "
+        "have as many columns as A!");
+  }
+  DRAKE_DEMAND(tolerance > 0);
+  DRAKE_DEMAND(max_iterations > 0);
+  const Eigen::SparseMatrix<double> A_transpose = A.transpose();
+  const MatrixXd none(A.rows(), 0);
+  return internal::CompressLowRankFactor(
+      internal::SolveLowRankLyapunovEquationByAdi(
+          A_transpose, none, none, C.transpose(), tolerance, max_iterations,
+          "LowRankContinuousLyapunovEquation"));
+}
+
 }  // namespace math
 }  // namespace drake
@@ -2,6 +2,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/QR>
+#include <Eigen/SparseCore>
 
 #include "drake/common/eigen_types.h"
 
@@ -56,8 +57,68 @@ Eigen::MatrixXd RealContinuousLyapunovEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::MatrixXd>& Q);
 
+/**
+ * @param A A user defined real square sparse matrix, whose eigenvalues all
+ * have negative real parts.
+ * @param C A user defined real matrix with as many columns as A, and
+ * typically far fewer rows.
+ * @param tolerance The relative tolerance on the residual (see below).
+ * @param max_iterations The maximum number of iterations.
+ *
+ * Computes a low-rank factor Z of the solution X ≈ ZZᵀ to the continuous
+ * Lyapunov equation: `AᵀX + XA + CᵀC = 0`, for large sparse matrices A, for
+ * which the O(n²) memory and O(n³) time of RealContinuousLyapunovEquation()
+ * are prohibitive. For example, the controllability Gramian P of a system
+ * (A, B), i.e. the solution of `AP + PAᵀ + BBᵀ = 0`, is approximated by
+ * ZZᵀ with Z = LowRankContinuousLyapunovEquation(Aᵀ, Bᵀ).
+ *
+ * The implementation is the low-rank alternating direction implicit (LR-ADI)
+ * iteration, in the residual-based formulation of [1], with real shifts. The
+ * shifts are computed from the eigenvalues of A projected onto the columns of
+ * Cᵀ and then onto the columns added to Z by the previous shifts [2]. Each
+ * iteration solves a shifted sparse linear system with C.rows() right-hand
+ * sides, and adds C.rows() columns to Z. The iterations stop once the norm
+ * of the residual, ‖AᵀZZᵀ + ZZᵀA + CᵀC‖₂, is at most @p tolerance times
+ * ‖CᵀC‖₂. Z is finally compressed to the columns that are numerically
+ * significant in ZZᵀ, which are orthogonal.
+ *
+ * @throws std::runtime_error if A is not square, if C does not have as many
+ * columns as A, if a shifted A is singular, or if the iterations did not
+ * converge, e.g., since A has eigenvalues that do not have negative real
+ * parts.
+ *
+ * [1] P. Benner, P. Kürschner and J. Saak, "An improved numerical method for
+ * balanced truncation for symmetric second-order systems," Math. Comput.
+ * Model. Dyn. Syst., Vol. 19, No. 6, 2013.
+ *
+ * [2] P. Benner, P. Kürschner and J. Saak, "Self-generating and efficient
+ * shift parameters in ADI methods for large Lyapunov and Sylvester
+ * equations," Electron. Trans. Numer. Anal., Vol. 43, 2014.
+ */
+Eigen::MatrixXd LowRankContinuousLyapunovEquation(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& C, double tolerance = 1e-10,
+    int max_iterations = 500);
+
 namespace internal {
 
+// Runs the LR-ADI iteration on `FX + XFᵀ + WWᵀ = 0`, where F = Aᵀ - UVᵀ (U
+// and V may have zero columns), and returns the uncompressed Z with X ≈ ZZᵀ.
+// The equations with F are solved with the Sherman-Morrison-Woodbury formula.
+// `caller` is the name of the function to mention in the exceptions.
+Eigen::MatrixXd SolveLowRankLyapunovEquationByAdi(
+    const Eigen::SparseMatrix<double>& A_transpose,
+    const Eigen::Ref<const Eigen::MatrixXd>& U,
+    const Eigen::Ref<const Eigen::MatrixXd>& V,
+    const Eigen::Ref<const Eigen::MatrixXd>& W, double tolerance,
+    int max_iterations, const char* caller);
+
+// Returns a factor Z̃ with orthogonal columns, and with Z̃Z̃ᵀ = ZZᵀ up to
+// round-off errors, which drops the directions in which ZZᵀ is numerically
+// zero.
+Eigen::MatrixXd CompressLowRankFactor(
+    const Eigen::Ref<const Eigen::MatrixXd>& Z);
+
 // Subroutines which help special cases. These cases are also called within
 // SolveReducedRealContinuousLyapunovFunction.
 
@@ -533,20 +533,13 @@ class RigidTransform {
       throw std::logic_error(
           "Error: Inner dimension for matrix multiplication is not 3.");
     }
-    // Express position vectors in terms of frame A as p_BoQ_A = R_AB * p_BoQ_B.
-    const RotationMatrix<typename Derived::Scalar> &R_AB = rotation();
-    const Eigen::Matrix<typename Derived::Scalar, 3, Derived::ColsAtCompileTime>
-        p_BoQ_A = R_AB * p_BoQ_B;
-
-    // Reserve space (on stack or heap) to store the result.
-    const int number_of_position_vectors = p_BoQ_B.cols();
+    // Express position vectors in terms of frame A as p_BoQ_A = R_AB * p_BoQ_B,
+    // directly into the result (a single matrix product, which Eigen
+    // vectorizes), then shift them all by p_AoBo_A.
     Eigen::Matrix<typename Derived::Scalar, 3, Derived::ColsAtCompileTime>
-        p_AoQ_A(3, number_of_position_vectors);
-
-    // Create each returned position vector as p_AoQi_A = p_AoBo_A + p_BoQi_A.
-    for (int i = 0;  i < number_of_position_vectors;  ++i)
-      p_AoQ_A.col(i) = translation() + p_BoQ_A.col(i);
-
+        p_AoQ_A(3, p_BoQ_B.cols());
+    p_AoQ_A.noalias() = rotation().matrix() * p_BoQ_B;
+    p_AoQ_A.colwise() += translation();
     return p_AoQ_A;
   }
 
@@ -0,0 +1,167 @@
+#include "drake/math/rigid_transform_batch.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace math {
+
+namespace {
+
+using Data = Eigen::Matrix<double, Eigen::Dynamic, 12>;
+
+// The 12 elements of the identity [I | 0], in the column-major order of the
+// columns of a batch.
+Eigen::Matrix<double, 1, 12> IdentityRow() {
+  Eigen::Matrix<double, 1, 12> row;
+  row << 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0;
+  return row;
+}
+
+// The column of a batch that holds the element (row, col) of the matrices.
+int Index(int row, int col) { return 3 * col + row; }
+
+}  // namespace
+
+RigidTransformBatch::RigidTransformBatch(int size)
+    : data_(IdentityRow().replicate(size, 1)) {
+  DRAKE_DEMAND(size >= 0);
+}
+
+RigidTransformBatch::RigidTransformBatch(
+    const std::vector<RigidTransformd>& transforms)
+    : data_(transforms.size(), 12) {
+  for (int i = 0; i < size(); ++i) {
+    set(i, transforms[i]);
+  }
+}
+
+void RigidTransformBatch::resize(int size) {
+  DRAKE_DEMAND(size >= 0);
+  const int old_size = this->size();
+  data_.conservativeResize(size, Eigen::NoChange);
+  if (size > old_size) {
+    data_.bottomRows(size - old_size) =
+        IdentityRow().replicate(size - old_size, 1);
+  }
+}
+
+RigidTransformd RigidTransformBatch::get(int i) const {
+  DRAKE_ASSERT(0 <= i && i < size());
+  Eigen::Matrix<double, 3, 4> matrix;
+  Eigen::Map<Eigen::Matrix<double, 1, 12>>(matrix.data()) = data_.row(i);
+  return RigidTransformd(RotationMatrixd(matrix.leftCols<3>()),
+                         matrix.col(3));
+}
+
+void RigidTransformBatch::set(int i, const RigidTransformd& X) {
+  DRAKE_ASSERT(0 <= i && i < size());
+  const Eigen::Matrix<double, 3, 4> matrix = X.GetAsMatrix34();
+  data_.row(i) = Eigen::Map<const Eigen::Matrix<double, 1, 12>>(matrix.data());
+}
+
+std::vector<RigidTransformd> RigidTransformBatch::ToVector() const {
+  std::vector<RigidTransformd> transforms;
+  transforms.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    transforms.push_back(get(i));
+  }
+  return transforms;
+}
+
+// Each of the kernels below computes a column of the result (one element of
+// the 3x4 matrices, for all of the transforms) as a coefficient-wise
+// expression of columns of the inputs, which Eigen evaluates in packets of as
+// many doubles as the SIMD registers hold. The result is computed into a
+// temporary so that it may alias an input.
+
+void ComposeBatch(const RigidTransformBatch& X_AB,
+                  const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC) {
+  DRAKE_DEMAND(X_AC != nullptr);
+  if (X_AB.size() != X_BC.size()) {
+    throw std::logic_error(fmt::format(
+        "ComposeBatch(): the batches have different sizes ({} and {})",
+        X_AB.size(), X_BC.size()));
+  }
+  const Data& a = X_AB.data_;
+  const Data& b = X_BC.data_;
+  Data result(a.rows(), 12);
+  // [R_AC | p_AoCo_A] = [R_AB * R_BC | R_AB * p_BoCo_B + p_AoBo_A].
+  for (int c = 0; c < 4; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      auto element = result.col(Index(r, c)).array();
+      element = a.col(Index(r, 0)).array() * b.col(Index(0, c)).array() +
+                a.col(Index(r, 1)).array() * b.col(Index(1, c)).array() +
+                a.col(Index(r, 2)).array() * b.col(Index(2, c)).array();
+      if (c == 3) element += a.col(Index(r, 3)).array();
+    }
+  }
+  X_AC->data_ = std::move(result);
+}
+
+void ComposeBatch(const RigidTransformd& X_AB,
+                  const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC) {
+  DRAKE_DEMAND(X_AC != nullptr);
+  const Eigen::Matrix<double, 3, 4> a = X_AB.GetAsMatrix34();
+  const Data& b = X_BC.data_;
+  Data result(b.rows(), 12);
+  for (int c = 0; c < 4; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      auto element = result.col(Index(r, c)).array();
+      element = a(r, 0) * b.col(Index(0, c)).array() +
+                a(r, 1) * b.col(Index(1, c)).array() +
+                a(r, 2) * b.col(Index(2, c)).array();
+      if (c == 3) element += a(r, 3);
+    }
+  }
+  X_AC->data_ = std::move(result);
+}
+
+void InvertBatch(const RigidTransformBatch& X_AB, RigidTransformBatch* X_BA) {
+  DRAKE_DEMAND(X_BA != nullptr);
+  const Data& a = X_AB.data_;
+  Data result(a.rows(), 12);
+  // [R_BA | p_BoAo_B] = [R_ABᵀ | -R_ABᵀ * p_AoBo_A].
+  for (int c = 0; c < 3; ++c) {
+    for (int r = 0; r < 3; ++r) {
+      result.col(Index(r, c)) = a.col(Index(c, r));
+    }
+  }
+  for (int r = 0; r < 3; ++r) {
+    result.col(Index(r, 3)).array() =
+        -(a.col(Index(0, r)).array() * a.col(Index(0, 3)).array() +
+          a.col(Index(1, r)).array() * a.col(Index(1, 3)).array() +
+          a.col(Index(2, r)).array() * a.col(Index(2, 3)).array());
+  }
+  X_BA->data_ = std::move(result);
+}
+
+void TransformBatch(const RigidTransformBatch& X_AB,
+                    const Eigen::Ref<const Eigen::Matrix3Xd>& p_BoQ_B,
+                    Eigen::Matrix3Xd* p_AoQ_A) {
+  DRAKE_DEMAND(p_AoQ_A != nullptr);
+  if (p_BoQ_B.cols() != X_AB.size()) {
+    throw std::logic_error(fmt::format(
+        "TransformBatch(): there are {} points for {} transforms",
+        p_BoQ_B.cols(), X_AB.size()));
+  }
+  const Data& a = X_AB.data_;
+  // The points are stored point by point, so they are transposed to be
+  // processed coordinate by coordinate.
+  const Eigen::Matrix<double, Eigen::Dynamic, 3> q = p_BoQ_B.transpose();
+  Eigen::Matrix<double, Eigen::Dynamic, 3> result(q.rows(), 3);
+  for (int r = 0; r < 3; ++r) {
+    result.col(r).array() = a.col(Index(r, 0)).array() * q.col(0).array() +
+                            a.col(Index(r, 1)).array() * q.col(1).array() +
+                            a.col(Index(r, 2)).array() * q.col(2).array() +
+                            a.col(Index(r, 3)).array();
+  }
+  *p_AoQ_A = result.transpose();
+}
+
+}  // namespace math
+}  // namespace drake
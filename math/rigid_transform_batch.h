@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace math {
+
+/// A batch of n rigid transforms `X_AB[0]`, ..., `X_AB[n-1]` of double scalar
+/// type, stored as a structure of arrays: each of the 12 elements of the 3x4
+/// matrices `[R_AB | p_AoBo_A]` is stored contiguously for all n transforms.
+/// The batched operations below (ComposeBatch(), InvertBatch() and
+/// TransformBatch()) thereby process several transforms at once in the SIMD
+/// lanes of the processor, and, unlike RigidTransform, skip the validity
+/// checks of their results (their inputs are valid transforms, and so are
+/// their results, up to round-off).
+///
+/// Use a batch to hold many poses that are computed together, e.g., the world
+/// poses of many geometries `X_WG[i] = X_WF[i] * X_FG[i]`; converting single
+/// transforms in and out of a batch with set() and get() costs about as much as
+/// composing them.
+class RigidTransformBatch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidTransformBatch)
+
+  /// Constructs an empty batch.
+  RigidTransformBatch() = default;
+
+  /// Constructs a batch of `size` identity transforms.
+  explicit RigidTransformBatch(int size);
+
+  /// Constructs the batch of the given transforms.
+  explicit RigidTransformBatch(const std::vector<RigidTransformd>& transforms);
+
+  /// Returns the number of transforms in the batch.
+  int size() const { return static_cast<int>(data_.rows()); }
+
+  /// Resizes the batch to `size` transforms. The first transforms are kept,
+  /// and the new ones are identity transforms.
+  void resize(int size);
+
+  /// Returns the i'th transform.
+  /// @pre 0 <= i < size().
+  RigidTransformd get(int i) const;
+
+  /// Sets the i'th transform to `X`.
+  /// @pre 0 <= i < size().
+  void set(int i, const RigidTransformd& X);
+
+  /// Returns the transforms of the batch.
+  std::vector<RigidTransformd> ToVector() const;
+
+  /// Returns the element (row, col) of the 3x4 matrices `[R | p]` of all of
+  /// the transforms, e.g., `element(0, 3)` is the x coordinate of every
+  /// translation.
+  /// @pre 0 <= row < 3 and 0 <= col < 4.
+  Eigen::Ref<const Eigen::VectorXd> element(int row, int col) const {
+    return data_.col(3 * col + row);
+  }
+
+ private:
+  friend void ComposeBatch(const RigidTransformBatch&,
+                           const RigidTransformBatch&, RigidTransformBatch*);
+  friend void ComposeBatch(const RigidTransformd&, const RigidTransformBatch&,
+                           RigidTransformBatch*);
+  friend void InvertBatch(const RigidTransformBatch&, RigidTransformBatch*);
+  friend void TransformBatch(const RigidTransformBatch&,
+                             const Eigen::Ref<const Eigen::Matrix3Xd>&,
+                             Eigen::Matrix3Xd*);
+
+  // One row per transform, and one column per element of the 3x4 matrices,
+  // in column-major order: the element (row, col) is in column 3 * col + row.
+  Eigen::Matrix<double, Eigen::Dynamic, 12> data_;
+};
+
+/// Composes the transforms of two batches of the same size, one by one:
+/// `X_AC[i] = X_AB[i] * X_BC[i]`. `X_AC` may be either of the inputs.
+/// @throws std::exception if the batches have different sizes.
+void ComposeBatch(const RigidTransformBatch& X_AB,
+                  const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC);
+
+/// Composes one transform with each of those of a batch:
+/// `X_AC[i] = X_AB * X_BC[i]`. `X_AC` may be `X_BC`.
+void ComposeBatch(const RigidTransformd& X_AB,
+                  const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC);
+
+/// Inverts each of the transforms of a batch: `X_BA[i] = X_AB[i]⁻¹`. `X_BA`
+/// may be `X_AB`.
+void InvertBatch(const RigidTransformBatch& X_AB, RigidTransformBatch* X_BA);
+
+/// Transforms the i'th point by the i'th transform of a batch:
+/// `p_AoQ_A.col(i) = X_AB[i] * p_BoQ_B.col(i)`. `p_AoQ_A` is resized as
+/// needed, and may be `p_BoQ_B`.
+/// @throws std::exception if the points aren't as many as the transforms.
+void TransformBatch(const RigidTransformBatch& X_AB,
+                    const Eigen::Ref<const Eigen::Matrix3Xd>& p_BoQ_B,
+                    Eigen::Matrix3Xd* p_AoQ_A);
+
+}  // namespace math
+}  // namespace drake
@@ -214,6 +214,53 @@ GTEST_TEST(AdditionalAutodiffTest, CastToAutoDiff) {
   EXPECT_TRUE(fixed_gradients.isZero(0.));
 }
 
+// A function with a dense Jacobian, of any AutoDiffScalar type.
+template <typename Derived>
+VectorX<typename Derived::Scalar> WideFunction(
+    const Eigen::MatrixBase<Derived>& x) {
+  using T = typename Derived::Scalar;
+  const int n = x.size();
+  const T sum_of_squares = x.squaredNorm();
+  VectorX<T> y(n + 1);
+  for (int i = 0; i < n; ++i) {
+    y(i) = sin(x(i)) * x((i + 1) % n) + sum_of_squares;
+  }
+  y(n) = exp(x(0) / 10);
+  return y;
+}
+
+// Tests that the Jacobian by chunks matches that of a single evaluation with
+// the full (dynamic) width of derivatives, including when the chunks do not
+// divide the inputs evenly and when the chunks are divided among threads.
+TEST_F(AutodiffTest, ComputeJacobianByChunks) {
+  const VectorXd x = VectorXd::LinSpaced(21, -1.0, 2.0);
+  const MatrixXd expected =
+      autoDiffToGradientMatrix(WideFunction(initializeAutoDiff(x)));
+  ASSERT_EQ(expected.rows(), 22);
+  ASSERT_EQ(expected.cols(), 21);
+  const auto f = [](const auto& x_chunk) { return WideFunction(x_chunk); };
+  EXPECT_TRUE(CompareMatrices(ComputeJacobianByChunks<8>(f, x), expected,
+                              1e-14, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(ComputeJacobianByChunks<1>(f, x), expected,
+                              1e-14, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(ComputeJacobianByChunks<32>(f, x), expected,
+                              1e-14, MatrixCompareType::absolute));
+  for (int num_threads : {2, 3, 8}) {
+    EXPECT_TRUE(CompareMatrices(ComputeJacobianByChunks<4>(f, x, num_threads),
+                                expected, 1e-14,
+                                MatrixCompareType::absolute));
+  }
+
+  // No inputs.
+  const MatrixXd empty = ComputeJacobianByChunks<8>(
+      [](const auto& x_chunk) { return (2 * x_chunk).eval(); },
+      VectorXd(0));
+  EXPECT_EQ(empty.rows(), 0);
+  EXPECT_EQ(empty.cols(), 0);
+
+  EXPECT_THROW(ComputeJacobianByChunks<8>(f, x, 0), std::exception);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -99,6 +99,38 @@ GTEST_TEST(BarycentricTest, EvalWeights) {
   EXPECT_TRUE(CompareMatrices(weights, Vector3d{.5, 0, .5}, 1e-8));
 }
 
+GTEST_TEST(BarycentricTest, EvalBatch) {
+  BarycentricMesh<double> bary{{{0.0, 1.0, 2.0},  // BR
+                                {2.0},            // BR
+                                {3.0, 3.5, 4.0}}};
+  const MatrixXd mesh_values = MatrixXd::Random(2, bary.get_num_mesh_points());
+
+  // Inputs on the grid, inside of it, and outside of it.
+  MatrixXd inputs(3, 5);
+  // clang-format off
+  inputs << 0., .5, 1.7, -1., 2.5,
+            2., 2., 2.,   0., 3.,
+            3., 3.2, 3.9, 5., 2.;
+  // clang-format on
+
+  Eigen::MatrixXi indices(bary.get_num_interpolants(), inputs.cols());
+  MatrixXd weights(bary.get_num_interpolants(), inputs.cols());
+  bary.EvalBarycentricWeightsBatch(inputs, &indices, &weights);
+  MatrixXd outputs(2, inputs.cols());
+  bary.EvalBatch(mesh_values, inputs, &outputs);
+
+  // The batched evaluation matches the evaluation of each input.
+  VectorXi point_indices(bary.get_num_interpolants());
+  VectorXd point_weights(bary.get_num_interpolants());
+  for (int j = 0; j < inputs.cols(); j++) {
+    bary.EvalBarycentricWeights(inputs.col(j), &point_indices, &point_weights);
+    EXPECT_TRUE(CompareMatrices(indices.col(j), point_indices));
+    EXPECT_TRUE(CompareMatrices(weights.col(j), point_weights));
+    EXPECT_TRUE(CompareMatrices(outputs.col(j),
+                                bary.Eval(mesh_values, inputs.col(j)), 1e-14));
+  }
+}
+
 GTEST_TEST(BarycentricTest, EvalTest) {
   BarycentricMesh<double> bary{{{0.0, 1.0},  // BR
                                 {0.0, 1.0}}};
@@ -1,6 +1,9 @@
 #include "drake/math/compute_numerical_gradient.h"
 
+#include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -152,6 +155,96 @@ GTEST_TEST(ComputeNumericalGradientTest, TestEvaluator) {
       CompareMatrices(J, math::autoDiffToGradientMatrix(y_autodiff), tol));
 }
 
+GTEST_TEST(ComputeColumnColoringTest, Banded) {
+  // A tridiagonal 6 x 6 pattern needs 3 colors, in a repeating sequence.
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < 6; ++i) {
+    for (int j = std::max(i - 1, 0); j <= std::min(i + 1, 5); ++j) {
+      pattern.emplace_back(i, j);
+    }
+  }
+  EXPECT_EQ(ComputeColumnColoring(6, pattern),
+            std::vector<int>({0, 1, 2, 0, 1, 2}));
+
+  // A diagonal pattern (and an empty column) needs a single color; a dense
+  // row needs one color per column.
+  EXPECT_EQ(ComputeColumnColoring(3, {{0, 0}, {1, 1}}),
+            std::vector<int>({0, 0, 0}));
+  EXPECT_EQ(ComputeColumnColoring(3, {{0, 0}, {0, 1}, {0, 2}, {0, 1}}),
+            std::vector<int>({0, 1, 2}));
+
+  EXPECT_THROW(ComputeColumnColoring(2, {{0, 2}}), std::runtime_error);
+  EXPECT_THROW(ComputeColumnColoring(2, {{-1, 0}}), std::runtime_error);
+}
+
+GTEST_TEST(ComputeSparseNumericalGradientTest, MatchesDense) {
+  // y(i) = x(i-1) * x(i) + sin(x(i+1)) has a tridiagonal gradient; y(n) =
+  // x(0)² couples only the first column.
+  const int n = 20;
+  std::function<void(const Eigen::VectorXd&, Eigen::VectorXd*)> calc_fun =
+      [n](const Eigen::VectorXd& x, Eigen::VectorXd* y) {
+        y->resize(n + 1);
+        for (int i = 0; i < n; ++i) {
+          (*y)(i) = (i > 0 ? x(i - 1) * x(i) : 0.0) +
+                    (i < n - 1 ? std::sin(x(i + 1)) : 0.0);
+        }
+        (*y)(n) = x(0) * x(0);
+      };
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < n; ++i) {
+    for (int j = std::max(i - 1, 0); j <= std::min(i + 1, n - 1); ++j) {
+      pattern.emplace_back(i, j);
+    }
+  }
+  pattern.emplace_back(n, 0);
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(n, -1.0, 2.0);
+  // The exact gradient.
+  Eigen::MatrixXd expected = Eigen::MatrixXd::Zero(n + 1, n);
+  for (int i = 0; i < n; ++i) {
+    if (i > 0) {
+      expected(i, i - 1) = x(i);
+      expected(i, i) = x(i - 1);
+    }
+    if (i < n - 1) expected(i, i + 1) = std::cos(x(i + 1));
+  }
+  expected(n, 0) = 2 * x(0);
+
+  // The evaluations are counted, in the serial case.
+  int num_evaluations = 0;
+  std::function<void(const Eigen::VectorXd&, Eigen::VectorXd*)> counted_fun =
+      [&](const Eigen::VectorXd& x_eval, Eigen::VectorXd* y) {
+        ++num_evaluations;
+        calc_fun(x_eval, y);
+      };
+  for (const auto method :
+       {NumericalGradientMethod::kForward, NumericalGradientMethod::kBackward,
+        NumericalGradientMethod::kCentral}) {
+    const NumericalGradientOption option(method);
+    num_evaluations = 0;
+    const Eigen::MatrixXd J =
+        ComputeSparseNumericalGradient(counted_fun, x, pattern, option);
+    const int num_perturbations =
+        method == NumericalGradientMethod::kCentral ? 6 : 3;
+    EXPECT_EQ(num_evaluations, 1 + num_perturbations);
+    EXPECT_TRUE(CompareMatrices(J, expected, 1E-6));
+    for (int num_threads : {2, 4}) {
+      EXPECT_TRUE(CompareMatrices(
+          ComputeSparseNumericalGradient(calc_fun, x, pattern, option,
+                                         num_threads),
+          J));
+    }
+  }
+
+  EXPECT_THROW(ComputeSparseNumericalGradient(calc_fun, x, {{n + 1, 0}}),
+               std::runtime_error);
+  EXPECT_THROW(ComputeSparseNumericalGradient(calc_fun, x, pattern,
+                                              NumericalGradientOption{
+                                                  NumericalGradientMethod::
+                                                      kForward},
+                                              0),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -1,5 +1,8 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <vector>
+
+#include <Eigen/SparseCore>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -60,6 +63,50 @@ GTEST_TEST(CARE, TestCare2) {
   SolveCAREandVerify(A1, B1, Q, R1);
 }
 
+// Tests the low-rank solution for the discretized heat equation on n points,
+// with one input and two outputs. (The matrix sign function iterations of the
+// dense solver do not converge at this size.)
+GTEST_TEST(CARE, LowRank) {
+  const int n = 100;
+  const double h = 1.0 / (n + 1);
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    triplets.emplace_back(i, i, -2 / (h * h));
+    if (i > 0) triplets.emplace_back(i, i - 1, 1 / (h * h));
+    if (i < n - 1) triplets.emplace_back(i, i + 1, 1 / (h * h));
+  }
+  Eigen::SparseMatrix<double> A(n, n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  MatrixXd B = MatrixXd::Zero(n, 1);
+  B.topRows(n / 4).setConstant(100);
+  MatrixXd C = MatrixXd::Zero(2, n);
+  C.row(0).setOnes();
+  C(1, n / 2) = 1;
+  MatrixXd R(1, 1);
+  R << 2;
+
+  const MatrixXd Z = LowRankContinuousAlgebraicRiccatiEquation(A, B, C, R);
+  EXPECT_LT(Z.cols(), n / 2);
+  const MatrixXd X = Z * Z.transpose();
+  const MatrixXd Q = C.transpose() * C;
+  const MatrixXd Y = (A.transpose() * X) + (X * A) -
+                     (X * B * R.inverse() * B.transpose() * X) + Q;
+  EXPECT_TRUE(CompareMatrices(Y, MatrixXd::Zero(n, n), 1e-8 * Q.norm(),
+                              MatrixCompareType::absolute));
+  const MatrixXd K = R.inverse() * B.transpose() * X;
+  Eigen::EigenSolver<MatrixXd> es(MatrixXd(A) - B * K);
+  for (int i = 0; i < n; i++) {
+    EXPECT_LT(es.eigenvalues()[i].real(), 0);
+  }
+
+  EXPECT_THROW(
+      LowRankContinuousAlgebraicRiccatiEquation(A, B, C, -R),
+      std::runtime_error);
+  EXPECT_THROW(
+      LowRankContinuousAlgebraicRiccatiEquation(A, B, C.leftCols(n - 1), R),
+      std::runtime_error);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -235,6 +236,62 @@ GTEST_TEST(RealContinuousLyapunovEquation, Solve10by10) {
                               MatrixCompareType::absolute));
 }
 
+// Returns the finite-difference discretization, on n points, of the
+// convection-diffusion operator u ↦ u'' - c u' on (0, 1), with u = 0 at the
+// boundaries, whose eigenvalues all have negative real parts.
+Eigen::SparseMatrix<double> MakeConvectionDiffusion(int n, double c) {
+  const double h = 1.0 / (n + 1);
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    triplets.emplace_back(i, i, -2 / (h * h));
+    if (i > 0) triplets.emplace_back(i, i - 1, 1 / (h * h) + c / (2 * h));
+    if (i < n - 1) triplets.emplace_back(i, i + 1, 1 / (h * h) - c / (2 * h));
+  }
+  Eigen::SparseMatrix<double> A(n, n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+GTEST_TEST(LowRankContinuousLyapunovEquation, CompareWithDense) {
+  const int n = 60;
+  MatrixXd C(2, n);
+  C.setZero();
+  C.row(0).head(n / 2).setOnes();
+  for (int i = 0; i < n; ++i) C(1, i) = std::sin(0.1 * i);
+  for (const double c : {0.0, 20.0}) {
+    const Eigen::SparseMatrix<double> A = MakeConvectionDiffusion(n, c);
+    const MatrixXd Q = C.transpose() * C;
+    const MatrixXd X = RealContinuousLyapunovEquation(MatrixXd(A), Q);
+    const MatrixXd Z = LowRankContinuousLyapunovEquation(A, C);
+    EXPECT_EQ(Z.rows(), n);
+    // The solution is numerically of lower rank.
+    EXPECT_LT(Z.cols(), 2 * n / 3);
+    EXPECT_TRUE(CompareMatrices(Z * Z.transpose(), X, 1e-8 * X.norm(),
+                                MatrixCompareType::absolute));
+    // The compressed columns are orthogonal.
+    const MatrixXd ZtZ = Z.transpose() * Z;
+    EXPECT_TRUE(CompareMatrices(ZtZ, MatrixXd(ZtZ.diagonal().asDiagonal()),
+                                1e-10 * ZtZ.norm(),
+                                MatrixCompareType::absolute));
+  }
+
+  // A zero right-hand side has the zero solution.
+  const MatrixXd Z =
+      LowRankContinuousLyapunovEquation(MakeConvectionDiffusion(n, 0),
+                                        MatrixXd::Zero(1, n));
+  EXPECT_EQ(Z.cols(), 0);
+}
+
+GTEST_TEST(LowRankContinuousLyapunovEquation, Exceptions) {
+  const Eigen::SparseMatrix<double> A = MakeConvectionDiffusion(5, 0);
+  EXPECT_THROW(LowRankContinuousLyapunovEquation(A, MatrixXd::Ones(1, 4)),
+               std::runtime_error);
+  // The eigenvalues of -A have positive real parts.
+  const Eigen::SparseMatrix<double> minus_A = -A;
+  EXPECT_THROW(LowRankContinuousLyapunovEquation(minus_A, MatrixXd::Ones(1, 5)),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -0,0 +1,141 @@
+#include "drake/math/rigid_transform_batch.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::Matrix3Xd;
+using Eigen::Vector3d;
+
+constexpr double kTolerance = 32 * std::numeric_limits<double>::epsilon();
+
+// Returns n arbitrary transforms, distinct from one another.
+std::vector<RigidTransformd> MakeTransforms(int n, double seed) {
+  std::vector<RigidTransformd> transforms;
+  for (int i = 0; i < n; ++i) {
+    const double t = seed + 0.37 * i;
+    transforms.emplace_back(
+        RotationMatrixd::MakeZRotation(2 * t) *
+            RotationMatrixd::MakeYRotation(-0.5 * t) *
+            RotationMatrixd::MakeXRotation(t),
+        Vector3d(std::sin(t), 1 + t, -2 * std::cos(3 * t)));
+  }
+  return transforms;
+}
+
+void ExpectNear(const std::vector<RigidTransformd>& actual,
+                const std::vector<RigidTransformd>& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (int i = 0; i < static_cast<int>(actual.size()); ++i) {
+    EXPECT_TRUE(CompareMatrices(actual[i].GetAsMatrix34(),
+                                expected[i].GetAsMatrix34(), kTolerance));
+  }
+}
+
+GTEST_TEST(RigidTransformBatchTest, Construction) {
+  const RigidTransformBatch empty;
+  EXPECT_EQ(empty.size(), 0);
+
+  const RigidTransformBatch identities(3);
+  ExpectNear(identities.ToVector(),
+             std::vector<RigidTransformd>(3, RigidTransformd::Identity()));
+
+  // The transforms are stored exactly.
+  const std::vector<RigidTransformd> transforms = MakeTransforms(5, 0.1);
+  RigidTransformBatch batch(transforms);
+  ASSERT_EQ(batch.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(CompareMatrices(batch.get(i).GetAsMatrix34(),
+                                transforms[i].GetAsMatrix34()));
+    EXPECT_EQ(batch.element(1, 3)(i), transforms[i].translation().y());
+    EXPECT_EQ(batch.element(2, 0)(i), transforms[i].rotation().matrix()(2, 0));
+  }
+
+  batch.set(2, RigidTransformd::Identity());
+  EXPECT_TRUE(batch.get(2).IsExactlyIdentity());
+
+  // Growing keeps the transforms, and adds identities.
+  batch.resize(7);
+  EXPECT_TRUE(CompareMatrices(batch.get(4).GetAsMatrix34(),
+                              transforms[4].GetAsMatrix34()));
+  EXPECT_TRUE(batch.get(6).IsExactlyIdentity());
+  batch.resize(1);
+  ASSERT_EQ(batch.size(), 1);
+  EXPECT_TRUE(CompareMatrices(batch.get(0).GetAsMatrix34(),
+                              transforms[0].GetAsMatrix34()));
+}
+
+// The batched operations match the operations of RigidTransform, including
+// for a batch size that isn't a multiple of the SIMD width.
+GTEST_TEST(RigidTransformBatchTest, Compose) {
+  const std::vector<RigidTransformd> X_AB = MakeTransforms(7, 0.1);
+  const std::vector<RigidTransformd> X_BC = MakeTransforms(7, -1.3);
+  std::vector<RigidTransformd> X_AC;
+  std::vector<RigidTransformd> X_BC0_C;
+  for (int i = 0; i < 7; ++i) {
+    X_AC.push_back(X_AB[i] * X_BC[i]);
+    X_BC0_C.push_back(X_BC[0] * X_BC[i]);
+  }
+
+  RigidTransformBatch result;
+  ComposeBatch(RigidTransformBatch(X_AB), RigidTransformBatch(X_BC), &result);
+  ExpectNear(result.ToVector(), X_AC);
+
+  // The result may alias an input.
+  RigidTransformBatch batch(X_AB);
+  ComposeBatch(batch, RigidTransformBatch(X_BC), &batch);
+  ExpectNear(batch.ToVector(), X_AC);
+
+  ComposeBatch(X_BC[0], RigidTransformBatch(X_BC), &result);
+  ExpectNear(result.ToVector(), X_BC0_C);
+  batch = RigidTransformBatch(X_BC);
+  ComposeBatch(X_BC[0], batch, &batch);
+  ExpectNear(batch.ToVector(), X_BC0_C);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ComposeBatch(RigidTransformBatch(2), RigidTransformBatch(3), &result),
+      std::logic_error, ".*different sizes \\(2 and 3\\)");
+}
+
+GTEST_TEST(RigidTransformBatchTest, Invert) {
+  const std::vector<RigidTransformd> X_AB = MakeTransforms(5, 0.7);
+  std::vector<RigidTransformd> X_BA;
+  for (const RigidTransformd& X : X_AB) X_BA.push_back(X.inverse());
+
+  RigidTransformBatch batch(X_AB);
+  InvertBatch(batch, &batch);
+  ExpectNear(batch.ToVector(), X_BA);
+}
+
+GTEST_TEST(RigidTransformBatchTest, Transform) {
+  const std::vector<RigidTransformd> X_AB = MakeTransforms(5, 0.2);
+  Matrix3Xd p_BoQ_B(3, 5);
+  p_BoQ_B << 1, 2, 3, 4, 5,
+             -1, 0, 1, 2, 0.5,
+             0.25, 7, -3, 0, 1;
+
+  Matrix3Xd p_AoQ_A;
+  TransformBatch(RigidTransformBatch(X_AB), p_BoQ_B, &p_AoQ_A);
+  ASSERT_EQ(p_AoQ_A.cols(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(CompareMatrices(p_AoQ_A.col(i), X_AB[i] * p_BoQ_B.col(i),
+                                kTolerance));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      TransformBatch(RigidTransformBatch(4), p_BoQ_B, &p_AoQ_A),
+      std::logic_error, ".*5 points for 4 transforms");
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
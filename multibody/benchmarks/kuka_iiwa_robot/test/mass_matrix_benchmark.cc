@@ -0,0 +1,90 @@
+/// @file
+/// Compares the wall time of MultibodyPlant::CalcMassMatrix() (composite rigid
+/// body algorithm) against MultibodyPlant::CalcMassMatrixViaInverseDynamics()
+/// for the KUKA iiwa arm model in this directory.
+
+#include <iostream>
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/drake_kuka_iiwa_robot.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+DEFINE_int32(iterations, 10000,
+             "Number of mass matrix evaluations per method.");
+
+namespace drake {
+namespace multibody {
+namespace benchmarks {
+namespace kuka_iiwa_robot {
+namespace {
+
+using common::test::MeasureExecutionTime;
+
+int DoMain() {
+  DRAKE_DEMAND(FLAGS_iterations > 0);
+
+  std::unique_ptr<MultibodyPlant<double>> plant =
+      MultibodyPlantTester::CreateMultibodyPlantFromTree(
+          MakeKukaIiwaModel<double>());
+  std::unique_ptr<systems::Context<double>> context =
+      plant->CreateDefaultContext();
+
+  const int nq = plant->num_positions();
+  const int nv = plant->num_velocities();
+  const VectorX<double> q = VectorX<double>::LinSpaced(nq, -1.2, 1.3);
+  MatrixX<double> M_id(nv, nv);
+  MatrixX<double> M_crba(nv, nv);
+
+  // Both methods only depend on q. We change q slightly on each iteration so
+  // that cached position kinematics are recomputed, as they would be in a
+  // control loop.
+  auto benchmark = [&](auto calc_mass_matrix, MatrixX<double>* M) {
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+      plant->SetPositions(context.get(), q * (1.0 + 1.0e-9 * (i % 2)));
+      calc_mass_matrix(*context, M);
+    }
+  };
+  const double id_time = MeasureExecutionTime(
+      benchmark,
+      [&](const systems::Context<double>& c, MatrixX<double>* M) {
+        plant->CalcMassMatrixViaInverseDynamics(c, M);
+      },
+      &M_id);
+  const double crba_time = MeasureExecutionTime(
+      benchmark,
+      [&](const systems::Context<double>& c, MatrixX<double>* M) {
+        plant->CalcMassMatrix(c, M);
+      },
+      &M_crba);
+
+  // Sanity check that both methods agree.
+  DRAKE_DEMAND((M_id - M_crba).norm() <= 1.0e-12 * M_id.norm());
+
+  const double kMicrosecondsPerSecond = 1.0e6;
+  std::cout << "nv = " << nv << ", iterations = " << FLAGS_iterations << "\n";
+  std::cout << "CalcMassMatrixViaInverseDynamics: "
+            << id_time / FLAGS_iterations * kMicrosecondsPerSecond
+            << " us/call\n";
+  std::cout << "CalcMassMatrix (CRBA):            "
+            << crba_time / FLAGS_iterations * kMicrosecondsPerSecond
+            << " us/call\n";
+  std::cout << "Speedup: " << id_time / crba_time << "x\n";
+  return 0;
+}
+
+}  // namespace
+}  // namespace kuka_iiwa_robot
+}  // namespace benchmarks
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::multibody::benchmarks::kuka_iiwa_robot::DoMain();
+}
@@ -292,6 +292,16 @@ std::unique_ptr<geometry::SurfaceMesh<T>> CalcZeroLevelSetInMeshDomain(
   std::vector<geometry::SurfaceFace> faces;
   e_m_surface->clear();
 
+  // Evaluate the level set once per vertex of the mesh, in a single batch,
+  // rather than once per tetrahedron that shares the vertex.
+  const int num_volume_vertices = mesh_M.num_vertices();
+  Matrix3X<T> p_NVs(3, num_volume_vertices);
+  for (geometry::VolumeVertexIndex v(0); v < num_volume_vertices; ++v) {
+    p_NVs.col(v) = X_NM * mesh_M.vertex(v).r_MV();
+  }
+  VectorX<T> phi_volume(num_volume_vertices);
+  phi_N.CalcValues(p_NVs, &phi_volume);
+
   // We scan each tetrahedron in the mesh and compute the zero level set with
   // IntersectTetWithLevelSet().
   std::array<Vector3<T>, 4> tet_vertices_N;
@@ -300,10 +310,10 @@ std::unique_ptr<geometry::SurfaceMesh<T>> CalcZeroLevelSetInMeshDomain(
   for (const auto& tet : mesh_M.tetrahedra()) {
     // Collect data for each vertex of the tetrahedron.
     for (int i = 0; i < 4; ++i) {
-      const auto& p_MV = mesh_M.vertex(tet.vertex(i)).r_MV();
-      tet_vertices_N[i] = X_NM * p_MV;
-      phi[i] = phi_N.value(tet_vertices_N[i]);
-      e_m[i] = e_m_volume[tet.vertex(i)];
+      const geometry::VolumeVertexIndex v = tet.vertex(i);
+      tet_vertices_N[i] = p_NVs.col(v);
+      phi[i] = phi_volume[v];
+      e_m[i] = e_m_volume[v];
     }
     // IntersectTetWithLevelSet() uses a different convention than
     // geometry::VolumeMesh to index the vertices of a tetrahedra and therefore
@@ -317,10 +327,16 @@ std::unique_ptr<geometry::SurfaceMesh<T>> CalcZeroLevelSetInMeshDomain(
                              e_m_surface);
   }
 
-  phi_gradient_N->resize(vertices_N.size());
-  for (geometry::SurfaceVertexIndex v(0); v < vertices_N.size(); ++v) {
-    const Vector3<T>& p_NV = vertices_N[v].r_MV();
-    (*phi_gradient_N)[v] = phi_N.gradient(p_NV);
+  const int num_surface_vertices = vertices_N.size();
+  Matrix3X<T> p_NSs(3, num_surface_vertices);
+  for (geometry::SurfaceVertexIndex v(0); v < num_surface_vertices; ++v) {
+    p_NSs.col(v) = vertices_N[v].r_MV();
+  }
+  Matrix3X<T> gradients_N(3, num_surface_vertices);
+  phi_N.CalcGradients(p_NSs, &gradients_N);
+  phi_gradient_N->resize(num_surface_vertices);
+  for (int v = 0; v < num_surface_vertices; ++v) {
+    (*phi_gradient_N)[v] = gradients_N.col(v);
   }
 
   return std::make_unique<geometry::SurfaceMesh<T>>(std::move(faces),
@@ -34,8 +34,8 @@ namespace internal {
 
 template <typename T>
 HydroelasticGeometry<T>::HydroelasticGeometry(
-    std::unique_ptr<HydroelasticField<T>> mesh_field, double elastic_modulus,
-    double hunt_crossley_dissipation)
+    std::shared_ptr<const HydroelasticField<T>> mesh_field,
+    double elastic_modulus, double hunt_crossley_dissipation)
     : mesh_field_(std::move(mesh_field)),
       elastic_modulus_(elastic_modulus),
       hunt_crossley_dissipation_(hunt_crossley_dissipation) {
@@ -249,10 +249,15 @@ void HydroelasticEngine<T>::ImplementGeometry(const Sphere& sphere,
   // tessellation of the sphere with a coarse mesh.
   // TODO(amcastro-tri): Make this a user setable parameter.
   const int refinement_level = 2;
-  auto sphere_field =
-      MakeSphereHydroelasticField<T>(refinement_level, sphere.get_radius());
+  // Spheres of the same radius share their field.
+  std::shared_ptr<const HydroelasticField<T>>& sphere_field =
+      model_data_.sphere_fields_[sphere.get_radius()];
+  if (sphere_field == nullptr) {
+    sphere_field =
+        MakeSphereHydroelasticField<T>(refinement_level, sphere.get_radius());
+  }
   auto model = std::make_unique<HydroelasticGeometry<T>>(
-      std::move(sphere_field), elastic_modulus, dissipation);
+      sphere_field, elastic_modulus, dissipation);
   model_data_.geometry_id_to_model_[specs.id] = std::move(model);
 }
 
@@ -267,11 +272,9 @@ void HydroelasticEngine<T>::ImplementGeometry(const HalfSpace&,
         "HydroelasticEngine. The current hydroelastic model implementation "
         "does not support soft half-spaces. Geometry ignored.");
   }
-  auto level_set = std::make_unique<LevelSetField<T>>(
-      [](const Vector3<T>& p) { return p[2]; },
-      [](const Vector3<T>&) { return Vector3<double>::UnitZ(); });
   model_data_.geometry_id_to_model_[specs.id] =
-      std::make_unique<HydroelasticGeometry<T>>(std::move(level_set));
+      std::make_unique<HydroelasticGeometry<T>>(
+          LevelSetField<T>::MakeHalfSpace());
 }
 
 // The following overrides are no-ops given that currently HydroelasticEngine
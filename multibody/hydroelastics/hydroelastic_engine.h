@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -26,15 +27,16 @@ class HydroelasticGeometry {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(HydroelasticGeometry)
 
   /// Creates a soft model from a given %HydroelasticField object, elastic
-  /// modulus and dissipation.
+  /// modulus and dissipation. The field is immutable, and may be shared by
+  /// several models of identical shapes.
   /// `elastic_modulus` must be strictly positive and have units of Pa.
   /// `hunt_crossley_dissipation` must be non-negative and have units of s/m.
   /// @throws std::exception if `elastic_modulus` is infinite or <= 0.
   /// @throws std::exception if `hunt_crossley_dissipation` is infinite and or
   /// negative.
   HydroelasticGeometry(
-      std::unique_ptr<HydroelasticField<T>> mesh_field, double elastic_modulus,
-      double hunt_crossley_dissipation);
+      std::shared_ptr<const HydroelasticField<T>> mesh_field,
+      double elastic_modulus, double hunt_crossley_dissipation);
 
   /// Constructor for a rigid model with its geometry represented by the
   /// zero-level of a level set function.
@@ -72,7 +74,7 @@ class HydroelasticGeometry {
   }
 
  private:
-  std::unique_ptr<HydroelasticField<T>> mesh_field_;
+  std::shared_ptr<const HydroelasticField<T>> mesh_field_;
   std::unique_ptr<LevelSetField<T>> level_set_;
   // Model is rigid by default.
   double elastic_modulus_{std::numeric_limits<double>::infinity()};
@@ -91,7 +93,9 @@ class HydroelasticGeometry {
 ///  - Creates the internal representation of the geometric models as
 ///    HydroelasticGeometry instances. This creation takes place on the first
 ///    context-based query.
-///  - Owns the HydroelasticGeometry instances.
+///  - Owns the HydroelasticGeometry instances. Soft geometries of identical
+///    shape share a single (immutable) HydroelasticField, so that the cost of
+///    making their meshes is only paid once per distinct shape.
 ///  - Provides API to perform hydroelastic contact specific queries.
 ///
 /// @warning
@@ -179,6 +183,9 @@ class HydroelasticEngine final : public geometry::ShapeReifier {
     std::unordered_map<geometry::GeometryId,
                        std::unique_ptr<HydroelasticGeometry<T>>>
         geometry_id_to_model_;
+    // The fields of the soft spheres made so far, keyed by radius.
+    std::map<double, std::shared_ptr<const HydroelasticField<T>>>
+        sphere_fields_;
   };
 
   // Helper method to compute the contact surface betwen a soft model S and a
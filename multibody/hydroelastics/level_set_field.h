@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cmath>
 #include <functional>
+#include <memory>
 
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
 namespace drake {
@@ -14,10 +18,20 @@ namespace internal {
 /// This class represents a level set function as the mapping
 /// `φ(p_FR): ℝ³ →  ℝ` with `p_FR` the position vector for a point R in a frame
 /// F.
+///
+/// The level sets of a half-space, a sphere, and a box (see MakeHalfSpace(),
+/// MakeSphere(), and MakeBox()) have concrete implementations, which
+/// CalcValues() and CalcGradients() evaluate over many points in a single
+/// inlined loop rather than through the type-erased `value` and `gradient`
+/// functions.
 template <typename T>
 struct LevelSetField {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LevelSetField)
 
+  /// The level sets with concrete implementations, or kGeneral for the ones
+  /// given by user-defined functions.
+  enum class Shape { kGeneral, kHalfSpace, kSphere, kBox };
+
   /// Constructs a level set field from user-defined functions for a level set
   /// and its gradient.
   /// These functions implicitly defines a frame F for the level set
@@ -29,8 +43,167 @@ struct LevelSetField {
                 std::function<Vector3<T>(const Vector3<T>&)> grad_level_set_F)
       : value(level_set_F), gradient(grad_level_set_F) {}
 
+  /// Returns the signed distance to the half-space z ≤ 0 of frame F, i.e.,
+  /// φ(p_FR) = z.
+  static std::unique_ptr<LevelSetField> MakeHalfSpace() {
+    return std::unique_ptr<LevelSetField>(
+        new LevelSetField(Shape::kHalfSpace, Vector3<double>::Zero()));
+  }
+
+  /// Returns the signed distance to the sphere of the given `radius` centered
+  /// at the origin of frame F.
+  static std::unique_ptr<LevelSetField> MakeSphere(double radius) {
+    DRAKE_DEMAND(radius > 0);
+    return std::unique_ptr<LevelSetField>(
+        new LevelSetField(Shape::kSphere, Vector3<double>::Constant(radius)));
+  }
+
+  /// Returns the signed distance to the box with the given half sizes along
+  /// the axes of frame F, centered at its origin.
+  static std::unique_ptr<LevelSetField> MakeBox(
+      const Vector3<double>& half_size) {
+    DRAKE_DEMAND((half_size.array() > 0).all());
+    return std::unique_ptr<LevelSetField>(
+        new LevelSetField(Shape::kBox, half_size));
+  }
+
+  Shape shape() const { return shape_; }
+
+  /// Evaluates the level set at the points whose positions in F are the
+  /// columns of `p_FRs`.
+  /// @pre `values` is not null and has as many entries as `p_FRs` has columns.
+  void CalcValues(const Eigen::Ref<const Matrix3X<T>>& p_FRs,
+                  EigenPtr<VectorX<T>> values) const {
+    DRAKE_DEMAND(values != nullptr);
+    DRAKE_DEMAND(values->size() == p_FRs.cols());
+    const int num_points = p_FRs.cols();
+    switch (shape_) {
+      case Shape::kHalfSpace:
+        *values = p_FRs.row(2).transpose();
+        return;
+      case Shape::kSphere:
+        for (int i = 0; i < num_points; ++i) {
+          (*values)[i] = SphereValue(p_FRs.col(i));
+        }
+        return;
+      case Shape::kBox:
+        for (int i = 0; i < num_points; ++i) {
+          (*values)[i] = BoxValue(p_FRs.col(i));
+        }
+        return;
+      case Shape::kGeneral:
+        for (int i = 0; i < num_points; ++i) {
+          (*values)[i] = value(p_FRs.col(i));
+        }
+        return;
+    }
+  }
+
+  /// Evaluates the gradient of the level set, expressed in F, at the points
+  /// whose positions in F are the columns of `p_FRs`.
+  /// @pre `gradients` is not null and has as many columns as `p_FRs`.
+  void CalcGradients(const Eigen::Ref<const Matrix3X<T>>& p_FRs,
+                     EigenPtr<Matrix3X<T>> gradients) const {
+    DRAKE_DEMAND(gradients != nullptr);
+    DRAKE_DEMAND(gradients->cols() == p_FRs.cols());
+    const int num_points = p_FRs.cols();
+    switch (shape_) {
+      case Shape::kHalfSpace:
+        gradients->colwise() = Vector3<T>::UnitZ();
+        return;
+      case Shape::kSphere:
+        for (int i = 0; i < num_points; ++i) {
+          gradients->col(i) = SphereGradient(p_FRs.col(i));
+        }
+        return;
+      case Shape::kBox:
+        for (int i = 0; i < num_points; ++i) {
+          gradients->col(i) = BoxGradient(p_FRs.col(i));
+        }
+        return;
+      case Shape::kGeneral:
+        for (int i = 0; i < num_points; ++i) {
+          gradients->col(i) = gradient(p_FRs.col(i));
+        }
+        return;
+    }
+  }
+
+  // For the concrete shapes, these call the same implementations as
+  // CalcValues() and CalcGradients().
   std::function<T(const Vector3<T>&)> value;
   std::function<Vector3<T>(const Vector3<T>&)> gradient;
+
+ private:
+  LevelSetField(Shape shape, const Vector3<double>& size)
+      : shape_(shape), size_(size) {
+    switch (shape) {
+      case Shape::kHalfSpace:
+        value = [](const Vector3<T>& p_FR) { return p_FR[2]; };
+        gradient = [](const Vector3<T>&) { return Vector3<T>::UnitZ(); };
+        break;
+      case Shape::kSphere:
+        value = [this](const Vector3<T>& p_FR) { return SphereValue(p_FR); };
+        gradient = [this](const Vector3<T>& p_FR) {
+          return SphereGradient(p_FR);
+        };
+        break;
+      case Shape::kBox:
+        value = [this](const Vector3<T>& p_FR) { return BoxValue(p_FR); };
+        gradient = [this](const Vector3<T>& p_FR) {
+          return BoxGradient(p_FR);
+        };
+        break;
+      case Shape::kGeneral:
+        DRAKE_UNREACHABLE();
+    }
+  }
+
+  // The signed distance to the sphere, and its gradient. The gradient at the
+  // center, where the distance is not differentiable, is +z.
+  template <typename Derived>
+  T SphereValue(const Eigen::MatrixBase<Derived>& p_FR) const {
+    return p_FR.norm() - size_[0];
+  }
+  template <typename Derived>
+  Vector3<T> SphereGradient(const Eigen::MatrixBase<Derived>& p_FR) const {
+    const T norm = p_FR.norm();
+    if (norm == 0) return Vector3<T>::UnitZ();
+    return p_FR / norm;
+  }
+
+  // The signed distance to the box, and its gradient: outside, the distance
+  // to the closest point of the box; inside, the negative of the distance to
+  // the closest face (the first one, on ties).
+  template <typename Derived>
+  T BoxValue(const Eigen::MatrixBase<Derived>& p_FR) const {
+    const Vector3<T> q = p_FR.cwiseAbs() - size_.template cast<T>();
+    const T max_q = q.maxCoeff();
+    if (max_q <= 0) return max_q;
+    return q.cwiseMax(T(0)).norm();
+  }
+  template <typename Derived>
+  Vector3<T> BoxGradient(const Eigen::MatrixBase<Derived>& p_FR) const {
+    const Vector3<T> q = p_FR.cwiseAbs() - size_.template cast<T>();
+    int axis;
+    const T max_q = q.maxCoeff(&axis);
+    Vector3<T> grad;
+    if (max_q <= 0) {
+      grad = Vector3<T>::Zero();
+      grad[axis] = 1;
+    } else {
+      grad = q.cwiseMax(T(0));
+      grad /= grad.norm();
+    }
+    for (int i = 0; i < 3; ++i) {
+      if (p_FR[i] < 0) grad[i] = -grad[i];
+    }
+    return grad;
+  }
+
+  Shape shape_{Shape::kGeneral};
+  // The radius of the sphere (in all entries), or the half sizes of the box.
+  Vector3<double> size_{Vector3<double>::Zero()};
 };
 
 }  // namespace internal
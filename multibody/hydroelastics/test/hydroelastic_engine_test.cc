@@ -106,6 +106,29 @@ GTEST_TEST(HydroelasticEngine, CombineSoftAndSoftMaterialProperties) {
               std::numeric_limits<double>::epsilon());
 }
 
+// Soft spheres of the same radius share their field, but not their material
+// properties.
+GTEST_TEST(HydroelasticEngine, SharesFieldsOfIdenticalSpheres) {
+  MultibodyPlant<double> plant;
+  SceneGraph<double> scene_graph;
+  plant.RegisterAsSourceForSceneGraph(&scene_graph);
+
+  GeometryId geometry_A = AddSoftBody(&plant, "SoftBodyA", 2.0, 1.0);
+  GeometryId geometry_B = AddSoftBody(&plant, "SoftBodyB", 8.0, 4.0);
+  plant.Finalize();
+
+  HydroelasticEngine<double> engine;
+  engine.MakeModels(scene_graph.model_inspector());
+
+  const HydroelasticGeometry<double>* model_A = engine.get_model(geometry_A);
+  const HydroelasticGeometry<double>* model_B = engine.get_model(geometry_B);
+  ASSERT_NE(model_A, nullptr);
+  ASSERT_NE(model_B, nullptr);
+  EXPECT_EQ(&model_A->hydroelastic_field(), &model_B->hydroelastic_field());
+  EXPECT_EQ(model_A->elastic_modulus(), 2.0);
+  EXPECT_EQ(model_B->elastic_modulus(), 8.0);
+}
+
 class SphereVsPlaneTest : public ::testing::Test {
  public:
   void SetUp() override {
@@ -0,0 +1,124 @@
+#include "drake/multibody/hydroelastics/level_set_field.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff.h"
+
+namespace drake {
+namespace multibody {
+namespace hydroelastics {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+// Points inside, outside, and on the boundary of the shapes below, including
+// the points whose closest feature of the box is a face, an edge, or a
+// vertex.
+Matrix3X<double> MakePoints() {
+  Matrix3X<double> p_FRs(3, 8);
+  p_FRs.col(0) << 0.1, -0.2, 0.3;
+  p_FRs.col(1) << 0, 0, 0;
+  p_FRs.col(2) << 3, 0.5, -0.25;
+  p_FRs.col(3) << -3, 4, 0.1;
+  p_FRs.col(4) << 2, -3, -5;
+  p_FRs.col(5) << 0, -2, 0;
+  p_FRs.col(6) << 0.5, 0.2, -0.9;
+  p_FRs.col(7) << -1.5, 1.5, 1;
+  return p_FRs;
+}
+
+// Checks that the batched evaluations of `field` match its per-point
+// functions, and that these match the given expected functions.
+template <typename ValueFunction, typename GradientFunction>
+void CheckField(const LevelSetField<double>& field,
+                ValueFunction expected_value,
+                GradientFunction expected_gradient) {
+  const Matrix3X<double> p_FRs = MakePoints();
+  VectorX<double> values(p_FRs.cols());
+  Matrix3X<double> gradients(3, p_FRs.cols());
+  field.CalcValues(p_FRs, &values);
+  field.CalcGradients(p_FRs, &gradients);
+  for (int i = 0; i < p_FRs.cols(); ++i) {
+    const Vector3d p_FR = p_FRs.col(i);
+    EXPECT_EQ(values[i], field.value(p_FR));
+    EXPECT_TRUE(CompareMatrices(gradients.col(i), field.gradient(p_FR)));
+    EXPECT_NEAR(values[i], expected_value(p_FR), 1e-15);
+    EXPECT_TRUE(
+        CompareMatrices(gradients.col(i), expected_gradient(p_FR), 1e-15));
+  }
+}
+
+GTEST_TEST(LevelSetFieldTest, HalfSpace) {
+  const auto field = LevelSetField<double>::MakeHalfSpace();
+  EXPECT_EQ(field->shape(), LevelSetField<double>::Shape::kHalfSpace);
+  CheckField(
+      *field, [](const Vector3d& p) { return p.z(); },
+      [](const Vector3d&) { return Vector3d::UnitZ(); });
+}
+
+GTEST_TEST(LevelSetFieldTest, Sphere) {
+  const auto field = LevelSetField<double>::MakeSphere(2);
+  EXPECT_EQ(field->shape(), LevelSetField<double>::Shape::kSphere);
+  CheckField(
+      *field, [](const Vector3d& p) { return p.norm() - 2; },
+      [](const Vector3d& p) {
+        return p.norm() > 0 ? Vector3d(p.normalized()) : Vector3d::UnitZ();
+      });
+}
+
+GTEST_TEST(LevelSetFieldTest, Box) {
+  const Vector3d half_size(1, 2, 1);
+  const auto field = LevelSetField<double>::MakeBox(half_size);
+  EXPECT_EQ(field->shape(), LevelSetField<double>::Shape::kBox);
+  // The distance and direction from the closest point of the box (outside),
+  // or to the closest face (inside).
+  auto expected_value = [&half_size](const Vector3d& p) {
+    const Vector3d closest = p.cwiseMax(-half_size).cwiseMin(half_size);
+    if (closest != p) return (p - closest).norm();
+    return -(half_size - p.cwiseAbs()).minCoeff();
+  };
+  auto expected_gradient = [&half_size](const Vector3d& p) {
+    const Vector3d closest = p.cwiseMax(-half_size).cwiseMin(half_size);
+    if (closest != p) return Vector3d((p - closest).normalized());
+    int axis;
+    (half_size - p.cwiseAbs()).minCoeff(&axis);
+    Vector3d grad = Vector3d::Zero();
+    grad[axis] = p[axis] < 0 ? -1 : 1;
+    return grad;
+  };
+  CheckField(*field, expected_value, expected_gradient);
+}
+
+GTEST_TEST(LevelSetFieldTest, General) {
+  const LevelSetField<double> field(
+      [](const Vector3d& p) { return p.x() * p.y(); },
+      [](const Vector3d& p) { return Vector3d(p.y(), p.x(), 0); });
+  EXPECT_EQ(field.shape(), LevelSetField<double>::Shape::kGeneral);
+  CheckField(
+      field, [](const Vector3d& p) { return p.x() * p.y(); },
+      [](const Vector3d& p) { return Vector3d(p.y(), p.x(), 0); });
+}
+
+// The concrete shapes are also available for AutoDiffXd.
+GTEST_TEST(LevelSetFieldTest, AutoDiff) {
+  const auto field = LevelSetField<AutoDiffXd>::MakeSphere(1);
+  Matrix3X<AutoDiffXd> p_FRs(3, 1);
+  p_FRs.col(0) = math::initializeAutoDiff(Vector3d(0, 3, 4));
+  VectorX<AutoDiffXd> values(1);
+  field->CalcValues(p_FRs, &values);
+  EXPECT_EQ(values[0].value(), 4);
+  // The gradient of the distance is the unit vector to the point.
+  EXPECT_TRUE(CompareMatrices(values[0].derivatives(), Vector3d(0, 0.6, 0.8),
+                              1e-15));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace hydroelastics
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,94 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_multi_start.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "drake/common/parallel_for.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+
+namespace drake {
+namespace multibody {
+std::vector<InverseKinematicsMultiStartSolution>
+SolveInverseKinematicsMultiStart(
+    const std::function<std::unique_ptr<InverseKinematics>()>& make_ik,
+    const std::vector<Eigen::VectorXd>& q_seeds,
+    const InverseKinematicsMultiStartOptions& options) {
+  DRAKE_THROW_UNLESS(options.num_threads >= 1);
+  DRAKE_THROW_UNLESS(!options.max_num_solutions ||
+                     *options.max_num_solutions >= 1);
+  const int num_seeds = static_cast<int>(q_seeds.size());
+  if (num_seeds == 0) {
+    return {};
+  }
+
+  // Each thread gets its own problem and solver.
+  std::vector<std::unique_ptr<InverseKinematics>> iks;
+  iks.push_back(make_ik());
+  DRAKE_THROW_UNLESS(iks[0] != nullptr);
+  for (const Eigen::VectorXd& q_seed : q_seeds) {
+    DRAKE_THROW_UNLESS(q_seed.size() == iks[0]->q().size());
+  }
+  const solvers::SolverId solver_id =
+      options.solver_id ? *options.solver_id
+                        : solvers::ChooseBestSolver(iks[0]->prog());
+  // MUMPS, the linear solver of IPOPT, is not thread-safe.
+  const int num_threads =
+      solver_id == solvers::IpoptSolver::id()
+          ? 1
+          : std::min(options.num_threads, num_seeds);
+  while (static_cast<int>(iks.size()) < num_threads) {
+    iks.push_back(make_ik());
+    DRAKE_THROW_UNLESS(iks.back() != nullptr);
+  }
+  std::vector<std::unique_ptr<solvers::SolverInterface>> thread_solvers;
+  for (int t = 0; t < num_threads; ++t) {
+    thread_solvers.push_back(solvers::MakeSolver(solver_id));
+  }
+
+  // Each thread appends its solutions to its own buffer, in seed order.
+  std::vector<std::vector<InverseKinematicsMultiStartSolution>>
+      thread_solutions(num_threads);
+  std::atomic<int> num_solutions{0};
+  StaticParallelForIndexLoop(
+      num_threads, 0, num_seeds, [&](int thread_num, int seed_index) {
+        if (options.max_num_solutions &&
+            num_solutions.load() >= *options.max_num_solutions) {
+          return;
+        }
+        const InverseKinematics& ik = *iks[thread_num];
+        Eigen::VectorXd initial_guess = ik.prog().initial_guess();
+        ik.prog().SetDecisionVariableValueInVector(
+            ik.q(), q_seeds[seed_index], &initial_guess);
+        solvers::MathematicalProgramResult result;
+        thread_solvers[thread_num]->Solve(ik.prog(), initial_guess,
+                                          options.solver_options, &result);
+        if (result.is_success()) {
+          thread_solutions[thread_num].push_back(
+              {seed_index, result.GetSolution(ik.q()),
+               result.get_optimal_cost()});
+          ++num_solutions;
+        }
+      });
+
+  std::vector<InverseKinematicsMultiStartSolution> solutions;
+  for (auto& solutions_t : thread_solutions) {
+    for (auto& solution : solutions_t) {
+      solutions.push_back(std::move(solution));
+    }
+  }
+  // The solutions are in seed order, so a stable sort breaks ties by seed.
+  std::stable_sort(solutions.begin(), solutions.end(),
+                   [](const InverseKinematicsMultiStartSolution& a,
+                      const InverseKinematicsMultiStartSolution& b) {
+                     return a.cost < b.cost;
+                   });
+  if (options.max_num_solutions &&
+      static_cast<int>(solutions.size()) > *options.max_num_solutions) {
+    solutions.resize(*options.max_num_solutions);
+  }
+  return solutions;
+}
+}  // namespace multibody
+}  // namespace drake
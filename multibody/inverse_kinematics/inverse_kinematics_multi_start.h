@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_optional.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/solvers/solver_id.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace multibody {
+/**
+ * Options for SolveInverseKinematicsMultiStart().
+ */
+struct InverseKinematicsMultiStartOptions {
+  /** The maximum number of threads used to solve from the seeds. Each thread
+   * solves its own copy of the inverse kinematics problem. */
+  int num_threads{1};
+
+  /** If set, solving stops early once this many seeds have been solved
+   * successfully, and only the solutions with the smallest costs are returned.
+   * Otherwise, the problem is solved from every seed. */
+  optional<int> max_num_solutions;
+
+  /** The solver to use. If not set, it is chosen with
+   * solvers::ChooseBestSolver(). */
+  optional<solvers::SolverId> solver_id;
+
+  /** The options in addition to those stored in the program. */
+  optional<solvers::SolverOptions> solver_options;
+};
+
+/**
+ * A successful solve of SolveInverseKinematicsMultiStart().
+ */
+struct InverseKinematicsMultiStartSolution {
+  /** The index of the seed that the solve started from. */
+  int seed_index{};
+  /** The generalized positions of the solution. */
+  Eigen::VectorXd q;
+  /** The optimal cost of the solution. */
+  double cost{};
+};
+
+/**
+ * Solves an inverse kinematics problem from each of the initial guesses (the
+ * seeds) in `q_seeds`, e.g., to find a feasible posture by random restarts.
+ *
+ * The constraints of an InverseKinematics problem evaluate the kinematics in
+ * the context of its plant, so a problem can't be solved concurrently from
+ * several seeds. Instead, `make_ik` is called once per thread (on the calling
+ * thread, before any solve starts), and must return a new, identical
+ * InverseKinematics problem whose plant context is not shared with the other
+ * problems. For collision related constraints, that means each problem must
+ * be constructed with the context of its own Diagram context, which must
+ * outlive this call. The seeds are statically partitioned among the threads,
+ * each solving its range of seeds in order with its own problem and solver.
+ *
+ * @param make_ik Makes a new inverse kinematics problem.
+ * @param q_seeds The initial guesses of the generalized positions. The initial
+ * guess of the other decision variables, if any, is the one stored in the
+ * program.
+ * @param options The options of the multi-start solve.
+ * @return The successful solves, in increasing order of cost (and seed index
+ * for equal costs). When `options.max_num_solutions` is set, seeds that
+ * haven't been started once that many solutions are found are skipped, hence
+ * which seeds are solved depends on the scheduling of the threads.
+ * @throws std::exception if `make_ik` returns nullptr, if the size of a seed
+ * differs from the number of generalized positions, or if
+ * `options.num_threads` or `options.max_num_solutions` are not positive.
+ * @note The solver must be safe to call concurrently on different programs.
+ * This is the case for SNOPT. IPOPT isn't (its linear solver MUMPS is not
+ * thread-safe), so when it is the solver the seeds are solved on the calling
+ * thread.
+ */
+std::vector<InverseKinematicsMultiStartSolution>
+SolveInverseKinematicsMultiStart(
+    const std::function<std::unique_ptr<InverseKinematics>()>& make_ik,
+    const std::vector<Eigen::VectorXd>& q_seeds,
+    const InverseKinematicsMultiStartOptions& options = {});
+}  // namespace multibody
+}  // namespace drake
@@ -1,10 +1,17 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <Eigen/Dense>
 
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/math/autodiff.h"
+
 #include "drake/multibody/inverse_kinematics/distance_constraint_utilities.h"
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
 
@@ -12,37 +19,137 @@ namespace drake {
 namespace multibody {
 using internal::RefFromPtrOrThrow;
 
-template <typename T, typename S>
-VectorX<S> Distances(const MultibodyPlant<T>& plant,
-                     systems::Context<T>* context,
-                     const Eigen::Ref<const VectorX<S>>& q,
-                     double influence_distance) {
-  internal::UpdateContextConfiguration(context, plant, q);
-  const auto& query_port = plant.get_geometry_query_input_port();
-  if (!query_port.HasValue(*context)) {
-    throw std::invalid_argument(
-        "MinimumDistanceConstraint: Cannot get a valid geometry::QueryObject. "
-        "Either the plant geometry_query_input_port() is not properly "
-        "connected to the SceneGraph's output port, or the plant_context_ is "
-        "incorrect. Please refer to AddMultibodyPlantSceneGraph on connecting "
-        "MultibodyPlant to SceneGraph.");
+namespace {
+// The distance between two geometries changes by at most the sum of the
+// displacements of their points. Pairs which were far enough beyond the
+// influence distance at the last full query are skipped until some body might
+// have moved far enough; see ActivePairCache.
+constexpr double kActivePairMargin = 0.05;
+
+// Computes the radius of a sphere, centered at the origin of the frame of a
+// shape, which bounds the shape. It is infinite for unbounded shapes.
+class BoundingRadiusReifier final : public geometry::ShapeReifier {
+ public:
+  double Calc(const geometry::Shape& shape) {
+    shape.Reify(this);
+    return radius_;
+  }
+
+ private:
+  void ImplementGeometry(const geometry::Sphere& sphere, void*) final {
+    radius_ = sphere.get_radius();
+  }
+  void ImplementGeometry(const geometry::Cylinder& cylinder, void*) final {
+    radius_ = std::hypot(cylinder.get_radius(), cylinder.get_length() / 2);
+  }
+  void ImplementGeometry(const geometry::HalfSpace&, void*) final {
+    radius_ = std::numeric_limits<double>::infinity();
+  }
+  void ImplementGeometry(const geometry::Box& box, void*) final {
+    radius_ = box.size().norm() / 2;
   }
-  const auto& query_object =
-      query_port.template Eval<geometry::QueryObject<T>>(*context);
-
-  const std::vector<geometry::SignedDistancePair<T>> signed_distance_pairs =
-      query_object.ComputeSignedDistancePairwiseClosestPoints(
-          influence_distance);
-  VectorX<S> distances(signed_distance_pairs.size());
-  int distance_count{0};
-  for (const auto& signed_distance_pair : signed_distance_pairs) {
-    if (signed_distance_pair.distance < influence_distance) {
-      const geometry::SceneGraphInspector<T>& inspector =
-          query_object.inspector();
-      const geometry::FrameId frame_A_id =
-          inspector.GetFrameId(signed_distance_pair.id_A);
-      const geometry::FrameId frame_B_id =
-          inspector.GetFrameId(signed_distance_pair.id_B);
+  void ImplementGeometry(const geometry::Mesh& mesh, void*) final {
+    radius_ = CalcMeshRadius(mesh.filename(), mesh.scale());
+  }
+  void ImplementGeometry(const geometry::Convex& convex, void*) final {
+    radius_ = CalcMeshRadius(convex.filename(), convex.scale());
+  }
+
+  static double CalcMeshRadius(const std::string& filename, double scale) {
+    const geometry::SurfaceMesh<double> mesh =
+        geometry::internal::ReadObjToSurfaceMesh(filename, scale);
+    double radius = 0;
+    for (geometry::SurfaceVertexIndex v(0); v < mesh.num_vertices(); ++v) {
+      radius = std::max(radius, mesh.vertex(v).r_MV().norm());
+    }
+    return radius;
+  }
+
+  double radius_{};
+};
+
+Eigen::Matrix<double, 3, 4> ExtractPoseValue(
+    const math::RigidTransform<double>& X) {
+  return X.GetAsMatrix34();
+}
+
+Eigen::Matrix<double, 3, 4> ExtractPoseValue(
+    const math::RigidTransform<AutoDiffXd>& X) {
+  return math::autoDiffToValueMatrix(X.GetAsMatrix34());
+}
+
+// Evaluates the signed distances of the geometry pairs closer than the
+// influence distance. To avoid the query over all pairs on each evaluation,
+// the pairs closer than the influence distance plus kActivePairMargin are
+// cached, together with the body poses, at each query over all pairs. At the
+// next evaluations, the displacement of each body's geometries since then is
+// bounded from the body poses, by the "swept sphere" of its geometries. While
+// the two largest displacements sum to at most the margin, the pairs which are
+// not cached remain beyond the influence distance, and only the cached pairs
+// which might be closer than the influence distance are evaluated, one at a
+// time. Otherwise, all pairs are queried again.
+//
+// Only the body poses are tracked, so the cache assumes that the poses of the
+// geometries in their frames don't change.
+template <typename T>
+class ActivePairCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ActivePairCache)
+
+  ActivePairCache(const MultibodyPlant<T>& plant,
+                  const geometry::SceneGraphInspector<T>& inspector)
+      : num_collision_candidates_(
+            inspector.GetCollisionCandidates().size()),
+        radius_(plant.num_bodies(), 0),
+        displacement_(plant.num_bodies(), 0),
+        X_WB_(plant.num_bodies()) {
+    BoundingRadiusReifier reifier;
+    std::vector<bool> is_moving(plant.num_bodies(), false);
+    for (const auto& pair : inspector.GetCollisionCandidates()) {
+      for (const geometry::GeometryId id : {pair.first(), pair.second()}) {
+        if (body_index_.count(id) > 0) continue;
+        const Body<T>* body =
+            plant.GetBodyFromFrameId(inspector.GetFrameId(id));
+        DRAKE_DEMAND(body != nullptr);
+        body_index_[id] = body->index();
+        if (body->index() == world_index()) continue;
+        is_moving[body->index()] = true;
+        radius_[body->index()] = std::max(
+            radius_[body->index()],
+            inspector.GetPoseInFrame(id).translation().norm() +
+                reifier.Calc(inspector.GetShape(id)));
+      }
+    }
+    for (BodyIndex b(0); b < plant.num_bodies(); ++b) {
+      if (is_moving[b]) moving_bodies_.push_back(b);
+    }
+  }
+
+  template <typename S>
+  VectorX<S> Distances(const MultibodyPlant<T>& plant,
+                       systems::Context<T>* context,
+                       const Eigen::Ref<const VectorX<S>>& q,
+                       double influence_distance) {
+    internal::UpdateContextConfiguration(context, plant, q);
+    const auto& query_port = plant.get_geometry_query_input_port();
+    if (!query_port.HasValue(*context)) {
+      throw std::invalid_argument(
+          "MinimumDistanceConstraint: Cannot get a valid geometry::QueryObject. "
+          "Either the plant geometry_query_input_port() is not properly "
+          "connected to the SceneGraph's output port, or the plant_context_ is "
+          "incorrect. Please refer to AddMultibodyPlantSceneGraph on "
+          "connecting MultibodyPlant to SceneGraph.");
+    }
+    const auto& query_object =
+        query_port.template Eval<geometry::QueryObject<T>>(*context);
+    const geometry::SceneGraphInspector<T>& inspector =
+        query_object.inspector();
+
+    VectorX<S> distances(num_collision_candidates_);
+    int distance_count{0};
+    auto add_distance = [&](const geometry::SignedDistancePair<T>& pair) {
+      const geometry::FrameId frame_A_id = inspector.GetFrameId(pair.id_A);
+      const geometry::FrameId frame_B_id = inspector.GetFrameId(pair.id_B);
       const Frame<T>& frameA =
           plant.GetBodyFromFrameId(frame_A_id)->body_frame();
       const Frame<T>& frameB =
@@ -52,16 +159,99 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
           // GetPoseInFrame() returns RigidTransform<double> -- we can't
           // multiply across heterogeneous scalar types; so we cast the double
           // to T.
-          inspector.GetPoseInFrame(signed_distance_pair.id_A)
-                  .template cast<T>() *
-              signed_distance_pair.p_ACa,
-          signed_distance_pair.distance, signed_distance_pair.nhat_BA_W, q,
-          &distances(distance_count++));
+          inspector.GetPoseInFrame(pair.id_A).template cast<T>() * pair.p_ACa,
+          pair.distance, pair.nhat_BA_W, q, &distances(distance_count++));
+    };
+
+    if (UpdateDisplacements(plant, *context)) {
+      for (const CachedPair& cached : pairs_) {
+        const double distance_lower_bound = cached.distance -
+                                            displacement_[cached.body_A] -
+                                            displacement_[cached.body_B];
+        if (distance_lower_bound < influence_distance) {
+          const geometry::SignedDistancePair<T> pair =
+              query_object.ComputeSignedDistancePairClosestPoints(cached.id_A,
+                                                                  cached.id_B);
+          if (pair.distance < influence_distance) {
+            add_distance(pair);
+          }
+        }
+      }
+    } else {
+      const std::vector<geometry::SignedDistancePair<T>> pairs =
+          query_object.ComputeSignedDistancePairwiseClosestPoints(
+              influence_distance + kActivePairMargin);
+      pairs_.clear();
+      for (const auto& pair : pairs) {
+        pairs_.push_back({pair.id_A, pair.id_B, body_index_.at(pair.id_A),
+                          body_index_.at(pair.id_B),
+                          ExtractDoubleOrThrow(pair.distance)});
+        if (pair.distance < influence_distance) {
+          add_distance(pair);
+        }
+      }
+      for (const BodyIndex b : moving_bodies_) {
+        X_WB_[b] = ExtractPoseValue(
+            plant.EvalBodyPoseInWorld(*context, plant.get_body(b)));
+      }
+      is_valid_ = true;
     }
+    distances.conservativeResize(distance_count);
+    return distances;
   }
-  distances.resize(distance_count);
-  return distances;
-}
+
+ private:
+  struct CachedPair {
+    geometry::GeometryId id_A;
+    geometry::GeometryId id_B;
+    BodyIndex body_A;
+    BodyIndex body_B;
+    // The signed distance at the last query over all pairs.
+    double distance{};
+  };
+
+  // Bounds the displacement of the geometries of each body since the last
+  // query over all pairs. Returns false if the cached pairs can't be used.
+  bool UpdateDisplacements(const MultibodyPlant<T>& plant,
+                           const systems::Context<T>& context) {
+    if (!is_valid_) return false;
+    double largest = 0;
+    double second_largest = 0;
+    for (const BodyIndex b : moving_bodies_) {
+      const Eigen::Matrix<double, 3, 4> X_WB = ExtractPoseValue(
+          plant.EvalBodyPoseInWorld(context, plant.get_body(b)));
+      // A point at p_BQ moves by at most |Δp_WB| + |ΔR_WB|_F |p_BQ|.
+      const double rotation_change =
+          (X_WB.leftCols<3>() - X_WB_[b].leftCols<3>()).norm();
+      double displacement = (X_WB.col(3) - X_WB_[b].col(3)).norm();
+      if (rotation_change > 0) {
+        displacement += rotation_change * radius_[b];
+      }
+      displacement_[b] = displacement;
+      if (displacement > largest) {
+        second_largest = largest;
+        largest = displacement;
+      } else if (displacement > second_largest) {
+        second_largest = displacement;
+      }
+    }
+    return largest + second_largest <= kActivePairMargin;
+  }
+
+  const int num_collision_candidates_;
+  // The bounding radius of the geometries of each body, about its origin.
+  std::vector<double> radius_;
+  // The bound on the displacement of each body's geometries.
+  std::vector<double> displacement_;
+  // The body poses at the last query over all pairs.
+  std::vector<Eigen::Matrix<double, 3, 4>> X_WB_;
+  // The bodies, other than the world, with collision candidates.
+  std::vector<BodyIndex> moving_bodies_;
+  std::unordered_map<geometry::GeometryId, BodyIndex> body_index_;
+  std::vector<CachedPair> pairs_;
+  bool is_valid_{false};
+};
+}  // namespace
 
 template <typename T>
 void MinimumDistanceConstraint::Initialize(
@@ -86,16 +276,22 @@ void MinimumDistanceConstraint::Initialize(
           .inspector()
           .GetCollisionCandidates()
           .size();
+  // The cache is shared by the AutoDiffXd and double evaluations.
+  auto cache = std::make_shared<ActivePairCache<T>>(
+      plant, query_port.template Eval<geometry::QueryObject<T>>(*plant_context)
+                 .inspector());
   minimum_value_constraint_ = std::make_unique<solvers::MinimumValueConstraint>(
       this->num_vars(), minimum_distance, influence_distance_offset,
       num_collision_candidates,
-      [&plant, plant_context](const auto& x, double influence_distance) {
-        return Distances<T, AutoDiffXd>(plant, plant_context, x,
-                                        influence_distance);
+      [&plant, plant_context, cache](const auto& x,
+                                     double influence_distance) {
+        return cache->template Distances<AutoDiffXd>(plant, plant_context, x,
+                                                     influence_distance);
       },
-      [&plant, plant_context](const auto& x, double influence_distance) {
-        return Distances<T, double>(plant, plant_context, x,
-                                    influence_distance);
+      [&plant, plant_context, cache](const auto& x,
+                                     double influence_distance) {
+        return cache->template Distances<double>(plant, plant_context, x,
+                                                 influence_distance);
       });
   this->set_bounds(minimum_value_constraint_->lower_bound(),
                    minimum_value_constraint_->upper_bound());
@@ -63,6 +63,16 @@ approximation of max(d). We require that dₘᵢₙ < d_influence. The input sca
 (dᵢ - d_influence)/(d_influence - dₘᵢₙ) ensures that at the boundary of the
 feasible set (when dᵢ == dₘᵢₙ), we evaluate the penalty function at -1, where it
 is required to have a non-zero gradient.
+
+To avoid computing the signed distance of every candidate pair on each
+evaluation, the constraint caches the pairs which were slightly beyond the
+influence distance at the last query over all pairs, together with the body
+poses. The displacement of the geometries since then is bounded from the body
+poses. As long as this bound guarantees that the other pairs are still beyond
+the influence distance, only the cached pairs which might be within the
+influence distance are evaluated (and differentiated). The results are the same
+as those of the query over all pairs, provided that the poses of the geometries
+in their frames don't change after the constraint is constructed.
 */
 class MinimumDistanceConstraint final : public solvers::Constraint {
  public:
@@ -0,0 +1,95 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_multi_start.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+class InverseKinematicsMultiStartTest : public ::testing::Test {
+ public:
+  InverseKinematicsMultiStartTest()
+      : plant_(ConstructIiwaPlant(
+            FindResourceOrThrow("drake/manipulation/models/iiwa_description/"
+                                "sdf/iiwa14_no_collision.sdf"),
+            0.01)) {
+    // Evenly spaced seeds within the joint limits.
+    const Eigen::VectorXd lower = plant_->GetPositionLowerLimits();
+    const Eigen::VectorXd upper = plant_->GetPositionUpperLimits();
+    for (int i = 0; i < 8; ++i) {
+      const double s = (i + 0.5) / 8;
+      q_seeds_.push_back((1 - s) * lower + s * upper);
+    }
+  }
+
+ protected:
+  // Reaches a point in front of the robot, while staying close to the zero
+  // posture.
+  std::unique_ptr<InverseKinematics> MakeIk() const {
+    auto ik = std::make_unique<InverseKinematics>(*plant_);
+    ik->AddPositionConstraint(
+        plant_->GetFrameByName("iiwa_link_7"), Eigen::Vector3d::Zero(),
+        plant_->world_frame(), Eigen::Vector3d(0.4, -0.1, 0.5),
+        Eigen::Vector3d(0.5, 0.1, 0.6));
+    ik->get_mutable_prog()->AddQuadraticErrorCost(
+        Eigen::MatrixXd::Identity(7, 7), Eigen::VectorXd::Zero(7), ik->q());
+    return ik;
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::vector<Eigen::VectorXd> q_seeds_;
+};
+
+TEST_F(InverseKinematicsMultiStartTest, RankedSolutions) {
+  const auto make_ik = [this]() { return MakeIk(); };
+  const std::vector<InverseKinematicsMultiStartSolution> serial =
+      SolveInverseKinematicsMultiStart(make_ik, q_seeds_);
+  ASSERT_FALSE(serial.empty());
+  for (int i = 1; i < static_cast<int>(serial.size()); ++i) {
+    EXPECT_LE(serial[i - 1].cost, serial[i].cost);
+  }
+
+  // Each seed is solved by its own problem and solver, hence the solutions
+  // don't depend on the number of threads.
+  InverseKinematicsMultiStartOptions options;
+  options.num_threads = 3;
+  const std::vector<InverseKinematicsMultiStartSolution> parallel =
+      SolveInverseKinematicsMultiStart(make_ik, q_seeds_, options);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (int i = 0; i < static_cast<int>(serial.size()); ++i) {
+    EXPECT_EQ(parallel[i].seed_index, serial[i].seed_index);
+    EXPECT_EQ(parallel[i].cost, serial[i].cost);
+    EXPECT_TRUE(CompareMatrices(parallel[i].q, serial[i].q));
+  }
+
+  // Stop at the first solution.
+  options.max_num_solutions = 1;
+  const std::vector<InverseKinematicsMultiStartSolution> first =
+      SolveInverseKinematicsMultiStart(make_ik, q_seeds_, options);
+  ASSERT_EQ(first.size(), 1);
+  EXPECT_GE(first[0].cost, serial[0].cost);
+}
+
+TEST_F(InverseKinematicsMultiStartTest, Throws) {
+  const auto make_ik = [this]() { return MakeIk(); };
+  EXPECT_TRUE(SolveInverseKinematicsMultiStart(make_ik, {}).empty());
+  EXPECT_THROW(
+      SolveInverseKinematicsMultiStart(make_ik, {Eigen::VectorXd::Zero(6)}),
+      std::exception);
+  EXPECT_THROW(SolveInverseKinematicsMultiStart(
+                   []() { return std::unique_ptr<InverseKinematics>(); },
+                   q_seeds_),
+               std::exception);
+  InverseKinematicsMultiStartOptions options;
+  options.num_threads = 0;
+  EXPECT_THROW(SolveInverseKinematicsMultiStart(make_ik, q_seeds_, options),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
 #include <limits>
+#include <vector>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/math/compute_numerical_gradient.h"
@@ -157,6 +158,51 @@ TEST_F(TwoFreeSpheresMinimumDistanceTest, QuadraticallySmoothedHingePenalty) {
   CheckConstraintEval(constraint);
 }
 
+// The pairs cached by a constraint across evaluations should give the same
+// results as a new constraint, which queries all the pairs.
+TEST_F(TwoFreeSpheresMinimumDistanceTest, CachedPairs) {
+  const double minimum_distance(0.1);
+  const MinimumDistanceConstraint constraint(plant_double_, minimum_distance,
+                                             plant_context_double_);
+  const Eigen::Quaterniond sphere1_quaternion(1, 0, 0, 0);
+  const Eigen::Quaterniond sphere2_quaternion(
+      Eigen::AngleAxisd(0.1, Eigen::Vector3d::UnitZ()));
+  const Eigen::Vector3d p_WB1(0.1, 0.2, 0.3);
+  const Eigen::Vector3d direction(1.0 / 3, 2.0 / 3, 2.0 / 3);
+  // Sphere 2 approaches sphere 1 in small steps, from beyond the influence
+  // distance to within the minimum distance, then jumps away.
+  std::vector<double> center_distances;
+  for (double d = constraint.influence_distance() + 0.5; d > 0.2; d -= 0.01) {
+    center_distances.push_back(radius1_ + radius2_ + d);
+  }
+  center_distances.push_back(radius1_ + radius2_ + 0.5);
+  center_distances.push_back(radius1_ + radius2_ + 2);
+  for (const double center_distance : center_distances) {
+    Eigen::Matrix<double, kNumPositionsForTwoFreeBodies, 1> q;
+    q << QuaternionToVectorWxyz(sphere1_quaternion), p_WB1,
+        QuaternionToVectorWxyz(sphere2_quaternion),
+        p_WB1 + direction * center_distance;
+    const MinimumDistanceConstraint constraint_expected(
+        plant_double_, minimum_distance, plant_context_double_);
+
+    Eigen::VectorXd y_double(1);
+    Eigen::VectorXd y_double_expected(1);
+    constraint.Eval(q, &y_double);
+    constraint_expected.Eval(q, &y_double_expected);
+    EXPECT_TRUE(CompareMatrices(y_double, y_double_expected, 1E-14));
+
+    const auto q_autodiff = math::initializeAutoDiff(q);
+    AutoDiffVecXd y_autodiff(1);
+    AutoDiffVecXd y_autodiff_expected(1);
+    constraint.Eval(q_autodiff, &y_autodiff);
+    constraint_expected.Eval(q_autodiff, &y_autodiff_expected);
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff),
+                                math::autoDiffToGradientMatrix(
+                                    y_autodiff_expected),
+                                1E-14));
+  }
+}
+
 GTEST_TEST(MinimumDistanceConstraintTest,
            MultibodyPlantWithouthGeometrySource) {
   auto plant = ConstructTwoFreeBodiesPlant<double>();
@@ -4,3 +4,5 @@
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::multibody::SpatialAcceleration)
+
+template class ::drake::multibody::SpatialAcceleration<float>;
@@ -791,6 +791,25 @@ TYPED_TEST(MomentumDotVelocityTest, InvariantUnderShiftOperation) {
   EXPECT_EQ(LdotV_P, HdotV_Q);
 }
 
+// Verifies that single precision spatial vectors agree with double precision
+// ones for the shift and dot product operations.
+GTEST_TEST(SpatialAlgebraFloatTest, AgreesWithDoublePrecision) {
+  const Vector3<double> w(0.1, -0.2, 0.3), v(1.5, 2.5, -0.5);
+  const Vector3<double> t(-0.4, 0.8, 1.2), f(3.0, -1.0, 2.0);
+  const Vector3<double> p_PQ(0.7, -1.1, 0.4);
+  const SpatialVelocity<double> V(w, v);
+  const SpatialForce<double> F(t, f);
+  const SpatialVelocity<float> V_float(w.cast<float>(), v.cast<float>());
+  const SpatialForce<float> F_float(t.cast<float>(), f.cast<float>());
+
+  const double kTolerance = 1.0e-5;
+  EXPECT_TRUE(V_float.Shift(p_PQ.cast<float>()).get_coeffs().cast<double>()
+                  .isApprox(V.Shift(p_PQ).get_coeffs(), kTolerance));
+  EXPECT_TRUE(F_float.Shift(p_PQ.cast<float>()).get_coeffs().cast<double>()
+                  .isApprox(F.Shift(p_PQ).get_coeffs(), kTolerance));
+  EXPECT_NEAR(V_float.dot(F_float), V.dot(F), kTolerance);
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace multibody
@@ -2,7 +2,9 @@
 
 #include <unordered_map>
 
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
 
 namespace drake {
 namespace multibody {
@@ -36,34 +38,197 @@ ManipulatorEquationConstraint::ManipulatorEquationConstraint(
       plant_{plant},
       context_{context},
       contact_pair_to_wrench_evaluator_(contact_pair_to_wrench_evaluator),
-      B_actuation_{plant_->MakeActuationMatrix()} {}
+      B_actuation_{plant_->MakeActuationMatrix()},
+      B_actuation_value_{math::autoDiffToValueMatrix(B_actuation_)} {
+  SetGradientSparsityPatternFromTopology();
+}
+
+void ManipulatorEquationConstraint::SetGradientSparsityPatternFromTopology() {
+  const auto& query_port = plant_->get_geometry_query_input_port();
+  if (!query_port.HasValue(*context_)) {
+    // Without the geometry, the bodies in contact are unknown; leave the
+    // gradient dense.
+    return;
+  }
+  const auto& inspector =
+      query_port.Eval<geometry::QueryObject<AutoDiffXd>>(*context_)
+          .inspector();
+  const internal::MultibodyTreeTopology& topology =
+      internal::GetInternalTree(*plant_).get_topology();
+  const int num_positions = plant_->num_positions();
+  const int num_velocities = plant_->num_velocities();
+  const int num_nodes = topology.get_num_body_nodes();
+
+  // is_ancestor(a, b) is true iff node a is node b or one of its ancestors.
+  std::vector<std::vector<bool>> is_ancestor(
+      num_nodes, std::vector<bool>(num_nodes, false));
+  for (internal::BodyNodeIndex node(0); node < num_nodes; ++node) {
+    for (internal::BodyNodeIndex ancestor = node; ancestor.is_valid();
+         ancestor = topology.get_body_node(ancestor).parent_body_node) {
+      is_ancestor[ancestor][node] = true;
+    }
+  }
+  std::vector<int> node_of_q(num_positions), node_of_v(num_velocities);
+  for (internal::BodyNodeIndex node(0); node < num_nodes; ++node) {
+    const internal::BodyNodeTopology& node_topology =
+        topology.get_body_node(node);
+    for (int k = 0; k < node_topology.num_mobilizer_positions; ++k) {
+      node_of_q[node_topology.mobilizer_positions_start + k] = node;
+    }
+    for (int k = 0; k < node_topology.num_mobilizer_velocities; ++k) {
+      node_of_v[node_topology.mobilizer_velocities_start_in_v + k] = node;
+    }
+  }
+  // M, C and tau_g couple the generalized coordinates of two nodes only if
+  // one node is an ancestor of the other.
+  auto coupled = [&is_ancestor](int node_a, int node_b) {
+    return is_ancestor[node_a][node_b] || is_ancestor[node_b][node_a];
+  };
+
+  auto node_of_geometry = [this, &inspector,
+                           &topology](geometry::GeometryId id) -> int {
+    const Body<AutoDiffXd>* body =
+        plant_->GetBodyFromFrameId(inspector.GetFrameId(id));
+    return topology.get_body(body->index()).body_node;
+  };
+
+  // is_nonzero(i, j) is true iff ∂yᵢ/∂xⱼ can be nonzero.
+  MatrixX<bool> is_nonzero = MatrixX<bool>::Constant(
+      num_velocities, num_vars(), false);
+  const int lambda_start_index_in_x =
+      2 * num_velocities + num_positions + plant_->num_actuated_dofs();
+  // A contact affects the rows of the generalized velocities of the nodes that
+  // are ancestors of either body in contact. These rows depend on all of q,
+  // since the contact wrench evaluator can depend on any of q.
+  for (const auto& term : contact_pair_to_wrench_evaluator_) {
+    const int node_A = node_of_geometry(term.first.first());
+    const int node_B = node_of_geometry(term.first.second());
+    for (int i = 0; i < num_velocities; ++i) {
+      if (is_ancestor[node_of_v[i]][node_A] ||
+          is_ancestor[node_of_v[i]][node_B]) {
+        is_nonzero.row(i).segment(num_velocities, num_positions).setConstant(
+            true);
+        for (int lambda_index : term.second.lambda_indices_in_all_lambda) {
+          is_nonzero(i, lambda_start_index_in_x + lambda_index) = true;
+        }
+      }
+    }
+  }
+  for (int i = 0; i < num_velocities; ++i) {
+    // vₙ and vₙ₊₁.
+    for (int j = 0; j < num_velocities; ++j) {
+      if (coupled(node_of_v[i], node_of_v[j])) {
+        is_nonzero(i, j) = true;
+        is_nonzero(i, num_velocities + num_positions + j) = true;
+      }
+    }
+    // qₙ₊₁.
+    for (int j = 0; j < num_positions; ++j) {
+      if (coupled(node_of_v[i], node_of_q[j])) {
+        is_nonzero(i, num_velocities + j) = true;
+      }
+    }
+    // uₙ₊₁.
+    for (int j = 0; j < plant_->num_actuated_dofs(); ++j) {
+      if (B_actuation_value_(i, j) != 0) {
+        is_nonzero(i, 2 * num_velocities + num_positions + j) = true;
+      }
+    }
+    // dt.
+    is_nonzero(i, num_vars() - 1) = true;
+  }
+
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < num_velocities; ++i) {
+    for (int j = 0; j < num_vars(); ++j) {
+      if (is_nonzero(i, j)) pattern.emplace_back(i, j);
+    }
+  }
+  SetGradientSparsityPattern(pattern);
+}
 
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
-  AutoDiffVecXd y_autodiff(num_constraints());
-  DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
-  *y = math::autoDiffToValueMatrix(y_autodiff);
+  const int num_positions = plant_->num_positions();
+  const int num_velocities = plant_->num_velocities();
+  const int num_actuated_dofs = plant_->num_actuated_dofs();
+  const int num_lambda = num_vars() - 2 * num_velocities - num_positions -
+                         num_actuated_dofs - 1;
+  const auto& v = x.head(num_velocities);
+  const auto& v_next =
+      x.segment(num_velocities + num_positions, num_velocities);
+  const double time_step = x(num_vars() - 1);
+  AutoDiffVecXd f;
+  MatrixX<AutoDiffXd> M_mass;
+  CalcGeneralizedForceAndMassMatrix(
+      x.segment(num_velocities, num_positions).cast<AutoDiffXd>(),
+      v_next.cast<AutoDiffXd>(),
+      x.segment(2 * num_velocities + num_positions + num_actuated_dofs,
+                num_lambda)
+          .cast<AutoDiffXd>(),
+      x.segment(2 * num_velocities + num_positions, num_actuated_dofs), &f,
+      &M_mass);
+  *y = math::autoDiffToValueMatrix(f) * time_step -
+       math::autoDiffToValueMatrix(M_mass) * (v_next - v);
 }
 
 // The format of the input to the Eval() function is a vector containing:
 // {vₙ, qₙ₊₁, vₙ₊₁, uₙ₊₁, λₙ₊₁, dt},
 // where λₙ₊₁ is a concatenation of lambdas for all contacts.
-// TODO(rcory) Combine duplicate code between ManipulatorEquationConstraint and
-//  StaticEquilibriumConstraint.
+// The plant is evaluated with derivatives with respect to z = {qₙ₊₁, vₙ₊₁,
+// λₙ₊₁} only. The gradient ∂y/∂x is then assembled from ∂y/∂z and the
+// analytical derivatives ∂y/∂vₙ = M, ∂y/∂uₙ₊₁ = B * dt and ∂y/∂dt = f, and
+// chained with the gradient of x.
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const {
-  const auto num_positions = plant_->num_positions();
-  const auto num_velocities = plant_->num_velocities();
-  const auto& v = x.head(num_velocities);
-  const auto& q_next = x.segment(num_velocities, num_positions);
-  const auto& v_next =
-      x.segment(num_velocities + num_positions, num_velocities);
+  const int num_positions = plant_->num_positions();
+  const int num_velocities = plant_->num_velocities();
+  const int num_actuated_dofs = plant_->num_actuated_dofs();
+  const int num_lambda = num_vars() - 2 * num_velocities - num_positions -
+                         num_actuated_dofs - 1;
+  const int lambda_start_index_in_x =
+      2 * num_velocities + num_positions + num_actuated_dofs;
+  const Eigen::VectorXd x_value = math::autoDiffToValueMatrix(x);
+  const auto& v = x_value.head(num_velocities);
   const auto& u_next =
-      x.segment(num_velocities + num_positions + num_velocities,
-                plant_->num_actuated_dofs());
-  const auto& time_step = x.tail<1>();
+      x_value.segment(num_velocities + num_positions + num_velocities,
+                      num_actuated_dofs);
+  const double time_step = x_value(num_vars() - 1);
+
+  // z = {qₙ₊₁, vₙ₊₁, λₙ₊₁}, with the identity as its gradient.
+  const int num_z = num_positions + num_velocities + num_lambda;
+  Eigen::VectorXd z_value(num_z);
+  z_value << x_value.segment(num_velocities, num_positions + num_velocities),
+      x_value.segment(lambda_start_index_in_x, num_lambda);
+  const AutoDiffVecXd z = math::initializeAutoDiff(z_value);
+  const AutoDiffVecXd v_next = z.segment(num_positions, num_velocities);
 
-  *y = B_actuation_ * u_next;
+  AutoDiffVecXd f;
+  MatrixX<AutoDiffXd> M_mass;
+  CalcGeneralizedForceAndMassMatrix(z.head(num_positions), v_next,
+                                    z.tail(num_lambda), u_next, &f, &M_mass);
+  const AutoDiffVecXd y_z = f * time_step - M_mass * (v_next - v);
+
+  const Eigen::MatrixXd dy_dz = math::autoDiffToGradientMatrix(y_z, num_z);
+  Eigen::MatrixXd dy_dx(num_velocities, num_vars());
+  dy_dx.leftCols(num_velocities) = math::autoDiffToValueMatrix(M_mass);
+  dy_dx.middleCols(num_velocities, num_positions + num_velocities) =
+      dy_dz.leftCols(num_positions + num_velocities);
+  dy_dx.middleCols(2 * num_velocities + num_positions, num_actuated_dofs) =
+      B_actuation_value_ * time_step;
+  dy_dx.middleCols(lambda_start_index_in_x, num_lambda) =
+      dy_dz.rightCols(num_lambda);
+  dy_dx.col(num_vars() - 1) = math::autoDiffToValueMatrix(f);
+  const Eigen::MatrixXd x_gradient = math::autoDiffToGradientMatrix(x);
+  *y = math::initializeAutoDiffGivenGradientMatrix(
+      math::autoDiffToValueMatrix(y_z), dy_dx * x_gradient);
+}
+
+void ManipulatorEquationConstraint::CalcGeneralizedForceAndMassMatrix(
+    const AutoDiffVecXd& q_next, const AutoDiffVecXd& v_next,
+    const AutoDiffVecXd& lambda_next, const Eigen::VectorXd& u_next,
+    AutoDiffVecXd* f, MatrixX<AutoDiffXd>* M) const {
+  *f = (B_actuation_value_ * u_next).cast<AutoDiffXd>();
 
   // TODO(rcory): Use UpdateContextConfiguration when it supports
   //  MultibodyPlant<AutoDiffXd> and Context<AutoDiffXd>
@@ -75,13 +240,13 @@ void ManipulatorEquationConstraint::DoEval(
                                        plant_->GetVelocities(*context_))) {
     plant_->SetVelocities(context_, v_next);
   }
-  *y += plant_->CalcGravityGeneralizedForces(*context_);  // g(q[n+1])
+  *f += plant_->CalcGravityGeneralizedForces(*context_);  // g(q[n+1])
 
   // Calc the bias term C(qₙ₊₁, vₙ₊₁)
   Eigen::Matrix<AutoDiffXd, Eigen::Dynamic, 1>
       C_bias(plant_->num_velocities(), 1);
   plant_->CalcBiasTerm(*context_, &C_bias);
-  *y -= C_bias;
+  *f -= C_bias;
 
   const auto& query_port = plant_->get_geometry_query_input_port();
   if (!query_port.HasValue(*context_)) {
@@ -97,9 +262,6 @@ void ManipulatorEquationConstraint::DoEval(
           query_object.ComputeSignedDistancePairwiseClosestPoints();
   const geometry::SceneGraphInspector<AutoDiffXd>& inspector =
       query_object.inspector();
-  const int lambda_start_index_in_x = num_velocities + num_positions +
-                                      num_velocities +
-                                      plant_->num_actuated_dofs();
   for (const auto& signed_distance_pair : signed_distance_pairs) {
     const geometry::FrameId frame_A_id =
         inspector.GetFrameId(signed_distance_pair.id_A);
@@ -147,8 +309,7 @@ void ManipulatorEquationConstraint::DoEval(
         it->second.contact_wrench_evaluator->num_lambda());
 
     for (int i = 0; i < lambda.rows(); ++i) {
-      lambda(i) = x(lambda_start_index_in_x +
-                    it->second.lambda_indices_in_all_lambda[i]);
+      lambda(i) = lambda_next(it->second.lambda_indices_in_all_lambda[i]);
     }
 
     AutoDiffVecXd F_AB_W;
@@ -160,15 +321,13 @@ void ManipulatorEquationConstraint::DoEval(
     // By definition, F_AB_W is the contact wrench applied to id_B from id_A,
     // at the contact point. By Newton's third law, the contact wrench applied
     // to id_A from id_B at the contact point is -F_AB_W.
-    *y += Jv_V_WCa.transpose() * -F_AB_W + Jv_V_WCb.transpose() * F_AB_W;
+    *f += Jv_V_WCa.transpose() * -F_AB_W + Jv_V_WCb.transpose() * F_AB_W;
   }
 
-  Eigen::Matrix<AutoDiffXd, Eigen::Dynamic, Eigen::Dynamic> M_mass(
-      plant_->num_velocities(), plant_->num_velocities());
-  plant_->CalcMassMatrixViaInverseDynamics(*context_, &M_mass);
-
-  *y = *y * time_step - M_mass * (v_next - v);
+  M->resize(plant_->num_velocities(), plant_->num_velocities());
+  plant_->CalcMassMatrixViaInverseDynamics(*context_, M);
 }
+
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const VectorX<symbolic::Variable>>&,
     VectorX<symbolic::Expression>*) const {
@@ -18,6 +18,16 @@ namespace multibody {
  * A Constraint to impose the manipulator equation:
  * 0 = (Buₙ₊₁ + ∑ᵢ (Jᵢ_WBᵀ(qₙ₊₁)ᵀ * Fᵢ_AB_W(λᵢ,ₙ₊₁))
  *     + tau_g(qₙ₊₁) - C(qₙ₊₁, Vₙ₊₁)) * dt - M(qₙ₊₁) * (Vₙ₊₁ - Vₙ)
+ *
+ * The gradient of this constraint is sparse for plants with several branches
+ * or free bodies: a generalized velocity only couples to the generalized
+ * positions and velocities of the bodies along its own branch, and to the
+ * contacts involving those bodies. This sparsity pattern is computed from the
+ * topology of the plant and the contact pairs, and reported through
+ * gradient_sparsity_pattern(). Only the derivatives with respect to qₙ₊₁,
+ * vₙ₊₁ and λₙ₊₁ are propagated through the plant with automatic
+ * differentiation; those with respect to vₙ, uₙ₊₁ and dt are computed
+ * analytically.
  */
 class ManipulatorEquationConstraint final : public solvers::Constraint {
  public:
@@ -91,12 +101,29 @@ class ManipulatorEquationConstraint final : public solvers::Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const final;
 
+  // Computes the generalized force
+  // f = Bu + tau_g(q) - C(q, v) + ∑ᵢ Jᵢ_WBᵀ(q) * Fᵢ_AB_W(λᵢ)
+  // and the mass matrix M(q), at q = q_next and v = v_next. The derivatives
+  // of f and M are those propagated from q_next, v_next and lambda; B and u do
+  // not contribute any derivative.
+  void CalcGeneralizedForceAndMassMatrix(const AutoDiffVecXd& q_next,
+                                         const AutoDiffVecXd& v_next,
+                                         const AutoDiffVecXd& lambda,
+                                         const Eigen::VectorXd& u_next,
+                                         AutoDiffVecXd* f,
+                                         MatrixX<AutoDiffXd>* M) const;
+
+  // Sets the gradient sparsity pattern from the topology of plant_ and the
+  // bodies in contact_pair_to_wrench_evaluator_.
+  void SetGradientSparsityPatternFromTopology();
+
   const MultibodyPlant<AutoDiffXd>* const plant_;
   systems::Context<AutoDiffXd>* const context_;
   const std::map<SortedPair<geometry::GeometryId>,
                  internal::GeometryPairContactWrenchEvaluatorBinding>
       contact_pair_to_wrench_evaluator_;
   const MatrixX<AutoDiffXd> B_actuation_;
+  const Eigen::MatrixXd B_actuation_value_;
 };
 
 }  // namespace multibody
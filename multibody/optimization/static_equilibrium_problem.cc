@@ -1,5 +1,7 @@
 #include "drake/multibody/optimization/static_equilibrium_problem.h"
 
+#include "drake/common/parallel_for.h"
+
 #include "drake/multibody/optimization/static_equilibrium_constraint.h"
 #include "drake/multibody/optimization/static_friction_cone_complementarity_constraint.h"
 
@@ -15,9 +17,10 @@ StaticEquilibriumProblem::StaticEquilibriumProblem(
       owned_prog_{new solvers::MathematicalProgram()},
       prog_{owned_prog_.get()},
       q_vars_{prog_->NewContinuousVariables(plant->num_positions())},
-      u_vars_{prog_->NewContinuousVariables(plant->num_actuated_dofs())} {
-  prog_->AddBoundingBoxConstraint(plant_.GetPositionLowerLimits(),
-                                  plant_.GetPositionUpperLimits(), q_vars_);
+      u_vars_{prog_->NewContinuousVariables(plant->num_actuated_dofs())},
+      q_bounds_{prog_->AddBoundingBoxConstraint(
+          plant_.GetPositionLowerLimits(), plant_.GetPositionUpperLimits(),
+          q_vars_)} {
   // Declares the contact forces as decision variables, and pair each contact
   // force decision variable with the evaluator to compute the contact wrench.
   const auto& query_port = plant_.get_geometry_query_input_port();
@@ -146,5 +149,41 @@ void StaticEquilibriumProblem::UpdateComplementarityTolerance(double tol) {
   }
 }
 
+void StaticEquilibriumProblem::UpdatePositionBounds(
+    const Eigen::Ref<const Eigen::VectorXd>& q_lower,
+    const Eigen::Ref<const Eigen::VectorXd>& q_upper) {
+  q_bounds_.evaluator()->set_bounds(q_lower, q_upper);
+}
+
+std::vector<solvers::MathematicalProgramResult> SolveStaticEquilibriumProblems(
+    const std::vector<StaticEquilibriumProblem*>& problems,
+    const std::vector<Eigen::VectorXd>& q_lower,
+    const std::vector<Eigen::VectorXd>& q_upper,
+    const std::vector<Eigen::VectorXd>& x_init,
+    const solvers::SolverInterface& solver,
+    const solvers::SolverOptions& solver_options) {
+  if (problems.empty()) {
+    throw std::logic_error(
+        "SolveStaticEquilibriumProblems: problems must not be empty.");
+  }
+  if (q_upper.size() != q_lower.size() || x_init.size() != q_lower.size()) {
+    throw std::logic_error(
+        "SolveStaticEquilibriumProblems: q_lower, q_upper and x_init must "
+        "have the same size.");
+  }
+  const int num_instances = static_cast<int>(q_lower.size());
+  std::vector<solvers::MathematicalProgramResult> results(num_instances);
+  // Each thread only updates and solves its own problem, hence it only
+  // evaluates the plant on that problem's context.
+  StaticParallelForIndexLoop(
+      static_cast<int>(problems.size()), 0, num_instances,
+      [&](int thread_num, int i) {
+        StaticEquilibriumProblem* problem = problems[thread_num];
+        problem->UpdatePositionBounds(q_lower[i], q_upper[i]);
+        solver.Solve(problem->prog(), x_init[i], solver_options, &results[i]);
+      });
+  return results;
+}
+
 }  // namespace multibody
 }  // namespace drake
@@ -11,6 +11,7 @@
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_interface.h"
 
 namespace drake {
 namespace multibody {
@@ -76,6 +77,17 @@ class StaticEquilibriumProblem {
    */
   void UpdateComplementarityTolerance(double tol);
 
+  /**
+   * Updates the bounds on the generalized position q, which are initialized to
+   * the position limits of the plant. This re-parameterizes the problem
+   * without rebuilding it; for example, the pose of a manipulated object can
+   * be fixed by setting equal lower and upper bounds on its positions.
+   * @throws std::logic_error if the bounds do not have size
+   * plant.num_positions().
+   */
+  void UpdatePositionBounds(const Eigen::Ref<const Eigen::VectorXd>& q_lower,
+                            const Eigen::Ref<const Eigen::VectorXd>& q_upper);
+
  private:
   const MultibodyPlant<AutoDiffXd>& plant_;
   systems::Context<AutoDiffXd>* context_;
@@ -83,6 +95,7 @@ class StaticEquilibriumProblem {
   solvers::MathematicalProgram* prog_;
   VectorX<symbolic::Variable> q_vars_;
   VectorX<symbolic::Variable> u_vars_;
+  solvers::Binding<solvers::BoundingBoxConstraint> q_bounds_;
 
   std::vector<std::pair<std::shared_ptr<ContactWrenchEvaluator>,
                         VectorX<symbolic::Variable>>>
@@ -92,5 +105,32 @@ class StaticEquilibriumProblem {
       internal::StaticFrictionConeComplementarityNonlinearConstraint>>
       static_friction_cone_complementarity_nonlinear_constraints_;
 };
+
+/**
+ * Solves a batch of instances of a static equilibrium problem in parallel,
+ * one instance per entry of `q_lower`, `q_upper` and `x_init`. Instance i is
+ * solved on one of `problems`, after calling UpdatePositionBounds(q_lower[i],
+ * q_upper[i]) on it, from the initial guess x_init[i]. Each thread works on its
+ * own problem, hence the number of threads is `problems.size()`.
+ * @param problems The problems to solve the instances on. They must be
+ * constructed identically, with the same additional constraints, but each on
+ * its own `Context<AutoDiffXd>`, such that they can be evaluated concurrently.
+ * @param q_lower The lower bound on q for each instance.
+ * @param q_upper The upper bound on q for each instance.
+ * @param x_init The initial guess of all decision variables for each instance.
+ * @param solver The solver. It must be safe to call concurrently (see, for
+ * instance, SnoptSolver::is_thread_safe()).
+ * @param solver_options The options passed to `solver` for every instance.
+ * @return The result of each instance.
+ * @throws std::logic_error if `problems` is empty or the number of bounds and
+ * initial guesses differ.
+ */
+std::vector<solvers::MathematicalProgramResult> SolveStaticEquilibriumProblems(
+    const std::vector<StaticEquilibriumProblem*>& problems,
+    const std::vector<Eigen::VectorXd>& q_lower,
+    const std::vector<Eigen::VectorXd>& q_upper,
+    const std::vector<Eigen::VectorXd>& x_init,
+    const solvers::SolverInterface& solver,
+    const solvers::SolverOptions& solver_options = {});
 }  // namespace multibody
 }  // namespace drake
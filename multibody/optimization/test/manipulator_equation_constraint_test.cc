@@ -414,6 +414,44 @@ TEST_F(TwoFreeSpheresTest, Eval) {
   EXPECT_TRUE(CompareMatrices(sphere0_total_wrench, lhs.head<6>(), tol));
   EXPECT_TRUE(CompareMatrices(sphere1_total_wrench, lhs.tail<6>(), tol));
 }
+
+TEST_F(TwoFreeSpheresTest, GradientSparsityPattern) {
+  const auto& plant = spheres_->plant();
+  const auto manipulator_equation_binding =
+      ManipulatorEquationConstraint::MakeBinding(
+          &plant, spheres_->get_mutable_plant_context(),
+          contact_wrench_evaluators_and_lambda_, v_vars_, q_next_vars_,
+          v_next_vars_, u_next_vars_, dt_var_);
+  const auto& pattern =
+      manipulator_equation_binding.evaluator()->gradient_sparsity_pattern();
+  ASSERT_TRUE(pattern.has_value());
+
+  // The two spheres are free bodies, hence M, C and g do not couple the
+  // velocities of one sphere with those of the other.
+  int num_v_entries = 0;
+  for (const auto& entry : pattern.value()) {
+    if (entry.second < 12) ++num_v_entries;
+  }
+  EXPECT_EQ(num_v_entries, 2 * 6 * 6);
+
+  // Every nonzero entry of the gradient must be in the sparsity pattern.
+  Eigen::VectorXd x_val(48);
+  x_val << Eigen::VectorXd::LinSpaced(12, 0.01, 0.12),
+      Eigen::Vector4d(1, 0.1, 0.2, 0.3).normalized(),
+      Eigen::Vector3d(0.1, 0.2, 0.3),
+      Eigen::Vector4d(0.9, -0.1, 0.2, 0.1).normalized(),
+      Eigen::Vector3d(0.15, 0.25, 0.2),
+      Eigen::VectorXd::LinSpaced(12, 0.02, 0.24),
+      Eigen::VectorXd::LinSpaced(9, 2, 10), 0.1;
+  AutoDiffVecXd y_autodiff;
+  manipulator_equation_binding.evaluator()->Eval(
+      math::initializeAutoDiff(x_val), &y_autodiff);
+  Eigen::MatrixXd y_gradient = math::autoDiffToGradientMatrix(y_autodiff);
+  for (const auto& entry : pattern.value()) {
+    y_gradient(entry.first, entry.second) = 0;
+  }
+  EXPECT_TRUE(CompareMatrices(y_gradient, Eigen::MatrixXd::Zero(12, 48)));
+}
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -1,5 +1,8 @@
 #include "drake/multibody/optimization/static_equilibrium_problem.h"
 
+#include <limits>
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -87,6 +90,80 @@ GTEST_TEST(StaticEquilibriumProblemTest, SphereOnGroundTest) {
   check_static_equilibrium_problem_solve(x_init);
 }
 
+// Solves a batch of sphere-on-ground instances, each with the horizontal
+// position of the sphere fixed at a different value, on two problems in
+// parallel.
+GTEST_TEST(StaticEquilibriumProblemTest, SolveBatchInParallel) {
+  const CoulombFriction<double> friction(1. /* static friction */,
+                                         0.8 /* dynamic friction */);
+  const double radius = 0.1;
+  const int kNumThreads = 2;
+  std::vector<std::unique_ptr<test::FreeSpheresAndBoxes<AutoDiffXd>>> scenes;
+  std::vector<std::unique_ptr<StaticEquilibriumProblem>> owned_problems;
+  std::vector<StaticEquilibriumProblem*> problems;
+  for (int i = 0; i < kNumThreads; ++i) {
+    scenes.push_back(std::make_unique<test::FreeSpheresAndBoxes<AutoDiffXd>>(
+        std::vector<test::SphereSpecification>{
+            test::SphereSpecification(radius, 1E3, friction)},
+        std::vector<test::BoxSpecification>{}, friction));
+    owned_problems.push_back(std::make_unique<StaticEquilibriumProblem>(
+        &(scenes[i]->plant()), scenes[i]->get_mutable_plant_context(),
+        std::set<std::pair<geometry::GeometryId, geometry::GeometryId>>{}));
+    owned_problems[i]->get_mutable_prog()->AddConstraint(
+        solvers::internal::ParseQuadraticConstraint(
+            owned_problems[i]
+                ->q_vars()
+                .head<4>()
+                .cast<symbolic::Expression>()
+                .squaredNorm(),
+            1, 1));
+    problems.push_back(owned_problems[i].get());
+  }
+
+  const StaticEquilibriumProblem& dut = *problems[0];
+  const int kNumInstances = 5;
+  std::vector<Eigen::VectorXd> q_lower, q_upper, x_init;
+  for (int i = 0; i < kNumInstances; ++i) {
+    Eigen::VectorXd lower = Eigen::VectorXd::Constant(
+        7, -std::numeric_limits<double>::infinity());
+    Eigen::VectorXd upper = -lower;
+    lower.segment<2>(4) << 0.1 * i, -0.2 * i;
+    upper.segment<2>(4) = lower.segment<2>(4);
+    q_lower.push_back(lower);
+    q_upper.push_back(upper);
+    Eigen::VectorXd x(dut.prog().num_vars());
+    x.setZero();
+    Eigen::VectorXd q_init(7);
+    q_init << 1, 0, 0, 0, 0, 0, radius + 0.1 * i;
+    dut.prog().SetDecisionVariableValueInVector(dut.q_vars(), q_init, &x);
+    x_init.push_back(x);
+  }
+
+  // Invalid sizes are rejected.
+  solvers::SnoptSolver snopt_solver;
+  EXPECT_THROW(SolveStaticEquilibriumProblems({}, q_lower, q_upper, x_init,
+                                              snopt_solver),
+               std::logic_error);
+  EXPECT_THROW(SolveStaticEquilibriumProblems(
+                   problems, q_lower, {}, x_init, snopt_solver),
+               std::logic_error);
+
+  if (snopt_solver.available() && solvers::SnoptSolver::is_thread_safe()) {
+    const std::vector<solvers::MathematicalProgramResult> results =
+        SolveStaticEquilibriumProblems(problems, q_lower, q_upper, x_init,
+                                       snopt_solver);
+    ASSERT_EQ(static_cast<int>(results.size()), kNumInstances);
+    const double tol = 2E-5;
+    for (int i = 0; i < kNumInstances; ++i) {
+      ASSERT_TRUE(results[i].is_success());
+      const Eigen::VectorXd q_sol = results[i].GetSolution(dut.q_vars());
+      EXPECT_TRUE(CompareMatrices(q_sol.segment<2>(4), q_lower[i].segment<2>(4),
+                                  tol));
+      EXPECT_NEAR(q_sol(6), radius, tol);
+    }
+  }
+}
+
 GTEST_TEST(TestStaticEquilibriumProblem, TwoSpheresWithinBin) {
   // Find the equilibrium pose for two spheres within a bin.
   const CoulombFriction<double> ground_friction(0.1 /* static friction */,
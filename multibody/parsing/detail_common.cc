@@ -1,3 +1,22 @@
 #include "drake/multibody/parsing/detail_common.h"
 
-// This is an empty file to confirm that our header parses on its own.
+#include <algorithm>
+#include <thread>
+
+#include "drake/geometry/proximity_engine.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+void PreloadConvexFiles(const std::vector<std::string>& filenames) {
+  if (filenames.size() < 2) return;
+  const int num_threads = std::min<int>(
+      filenames.size(), std::max(1u, std::thread::hardware_concurrency()));
+  geometry::internal::ProximityEngine<double>::PreloadConvexFiles(
+      filenames, num_threads);
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "drake/multibody/plant/coulomb_friction.h"
 
 namespace drake {
@@ -17,6 +20,11 @@ inline CoulombFriction<double> default_friction() {
   return CoulombFriction<double>(1.0, 1.0);
 }
 
+/// Reads the .obj files of the Convex collision geometries of a model on all
+/// of the cores, ahead of their registration (which is serial), so that
+/// registering each geometry finds its file already parsed.
+void PreloadConvexFiles(const std::vector<std::string>& filenames);
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
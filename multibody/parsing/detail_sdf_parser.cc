@@ -2,15 +2,19 @@
 
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include <sdf/sdf.hh>
 
+#include "drake/common/file_cache.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/detail_ignition.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_scene_graph.h"
@@ -356,34 +360,69 @@ void AddJointFromSpecification(
   }
 }
 
-// Helper method to load an SDF file and read the contents into an sdf::Root
-// object.
-std::string LoadSdf(
-    sdf::Root* root,
-    const std::string& file_name) {
+// A parsed SDF file, shared by all the parsers which load it while it is
+// unchanged on disk.
+struct SdfFile {
+  // Guards `root`, since reading an sdf::Element may add default elements to
+  // it.
+  std::mutex mutex;
+  sdf::Root root;
+  // The directory holding the SDF, in which to search for files referenced
+  // within the SDF file.
+  std::string root_dir;
+};
 
+// Helper method to load an SDF file and read the contents into an sdf::Root
+// object. The result is cached, so that a file is only parsed again when it
+// changes.
+std::shared_ptr<SdfFile> LoadSdf(const std::string& file_name) {
   const std::string full_path = GetFullPath(file_name);
 
-  // Load the SDF file.
-  sdf::Errors errors = root->Load(full_path);
+  return drake::internal::FileCache<SdfFile>::GetOrLoad(full_path, [&]() {
+    auto file = std::make_shared<SdfFile>();
 
-  // Check for any errors.
-  if (!errors.empty()) {
-    std::string error_accumulation("From AddModelFromSdfFile():\n");
-    for (const auto& e : errors)
-      error_accumulation += "Error: " + e.Message() + "\n";
-    throw std::runtime_error(error_accumulation);
-  }
+    // Load the SDF file.
+    sdf::Errors errors = file->root.Load(full_path);
 
-  // Uses the directory holding the SDF to be the root directory
-  // in which to search for files referenced within the SDF file.
-  std::string root_dir = ".";
-  size_t found = full_path.find_last_of("/\\");
-  if (found != std::string::npos) {
-    root_dir = full_path.substr(0, found);
-  }
+    // Check for any errors.
+    if (!errors.empty()) {
+      std::string error_accumulation("From AddModelFromSdfFile():\n");
+      for (const auto& e : errors)
+        error_accumulation += "Error: " + e.Message() + "\n";
+      throw std::runtime_error(error_accumulation);
+    }
+
+    // Uses the directory holding the SDF to be the root directory
+    // in which to search for files referenced within the SDF file.
+    file->root_dir = ".";
+    size_t found = full_path.find_last_of("/\\");
+    if (found != std::string::npos) {
+      file->root_dir = full_path.substr(0, found);
+    }
 
-  return root_dir;
+    return file;
+  });
+}
+
+// Returns the file names of the Convex collision geometries of `model`.
+std::vector<std::string> GetConvexCollisionFiles(const sdf::Model& model) {
+  std::vector<std::string> filenames;
+  for (uint64_t link_index = 0; link_index < model.LinkCount(); ++link_index) {
+    const sdf::Link& link = *model.LinkByIndex(link_index);
+    for (uint64_t collision_index = 0;
+         collision_index < link.CollisionCount(); ++collision_index) {
+      const sdf::Geometry& sdf_geometry =
+          *link.CollisionByIndex(collision_index)->Geom();
+      if (sdf_geometry.Type() != sdf::GeometryType::MESH) continue;
+      const std::unique_ptr<geometry::Shape> shape =
+          MakeShapeFromSdfGeometry(sdf_geometry);
+      if (const auto* convex =
+              dynamic_cast<const geometry::Convex*>(shape.get())) {
+        filenames.push_back(convex->filename());
+      }
+    }
+  }
+  return filenames;
 }
 
 // Helper method to add a model to a MultibodyPlant given an sdf::Model
@@ -394,6 +433,9 @@ void AddLinksFromSpecification(
     MultibodyPlant<double>* plant,
     const PackageMap& package_map,
     const std::string& root_dir) {
+  if (plant->geometry_source_is_registered()) {
+    PreloadConvexFiles(GetConvexCollisionFiles(model));
+  }
 
   // Add all the links
   for (uint64_t link_index = 0; link_index < model.LinkCount(); ++link_index) {
@@ -576,9 +618,10 @@ ModelInstanceIndex AddModelFromSdfFile(
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
-
-  std::string root_dir = LoadSdf(&root, file_name);
+  const std::shared_ptr<SdfFile> file = LoadSdf(file_name);
+  std::lock_guard<std::mutex> lock(file->mutex);
+  const sdf::Root& root = file->root;
+  const std::string& root_dir = file->root_dir;
 
   if (root.ModelCount() != 1) {
     throw std::runtime_error("File must have a single <model> element.");
@@ -606,9 +649,10 @@ std::vector<ModelInstanceIndex> AddModelsFromSdfFile(
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
-
-  std::string root_dir = LoadSdf(&root, file_name);
+  const std::shared_ptr<SdfFile> file = LoadSdf(file_name);
+  std::lock_guard<std::mutex> lock(file->mutex);
+  const sdf::Root& root = file->root;
+  const std::string& root_dir = file->root_dir;
 
   // Throw an error if there are no models or worlds.
   if (root.ModelCount() == 0 && root.WorldCount() == 0) {
@@ -1,13 +1,19 @@
 #include "drake/multibody/parsing/detail_urdf_parser.h"
 
+#include <fstream>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <tinyxml2.h>
 
+#include "drake/common/file_cache.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_tinyxml.h"
 #include "drake/multibody/parsing/detail_urdf_geometry.h"
@@ -81,6 +87,38 @@ SpatialInertia<double> ExtractSpatialInertiaAboutBoExpressedInB(
       body_mass, p_BoBcm_B, I_BBcm_B);
 }
 
+// Returns the resolved file names of the Convex collision geometries of the
+// links of the robot `node`. The files that can't be resolved are skipped, to
+// be reported by ParseBody().
+std::vector<std::string> GetConvexCollisionFiles(
+    const multibody::PackageMap& package_map, const std::string& root_dir,
+    XMLElement* node) {
+  std::vector<std::string> filenames;
+  for (XMLElement* link_node = node->FirstChildElement("link"); link_node;
+       link_node = link_node->NextSiblingElement("link")) {
+    for (XMLElement* collision_node = link_node->FirstChildElement("collision");
+         collision_node;
+         collision_node = collision_node->NextSiblingElement("collision")) {
+      const XMLElement* geometry_node =
+          collision_node->FirstChildElement("geometry");
+      const XMLElement* mesh_node =
+          geometry_node ? geometry_node->FirstChildElement("mesh") : nullptr;
+      std::string filename;
+      if (mesh_node == nullptr ||
+          !mesh_node->FirstChildElement("drake:declare_convex") ||
+          !ParseStringAttribute(mesh_node, "filename", &filename)) {
+        continue;
+      }
+      const std::string resolved_filename =
+          ResolveUri(filename, package_map, root_dir);
+      if (!resolved_filename.empty()) {
+        filenames.push_back(resolved_filename);
+      }
+    }
+  }
+  return filenames;
+}
+
 void ParseBody(const multibody::PackageMap& package_map,
                const std::string& root_dir,
                ModelInstanceIndex model_instance,
@@ -457,6 +495,10 @@ ModelInstanceIndex ParseUrdf(
   const ModelInstanceIndex model_instance =
       plant->AddModelInstance(model_name);
 
+  if (plant->geometry_source_is_registered()) {
+    PreloadConvexFiles(GetConvexCollisionFiles(package_map, root_dir, node));
+  }
+
   // Parses the model's link elements.
   for (XMLElement* link_node = node->FirstChildElement("link");
        link_node;
@@ -511,9 +553,28 @@ ModelInstanceIndex AddModelFromUrdfFile(
 
   const std::string full_path = GetFullPath(file_name);
 
-  // Opens the URDF file and feeds it into the XML parser.
+  // Opens the URDF file and feeds it into the XML parser. The contents of the
+  // file are cached, so that it is only read again when it changes. (The
+  // parsed document itself can't be shared, since it is navigated through
+  // non-const pointers.)
+  const std::shared_ptr<const std::string> contents =
+      drake::internal::FileCache<const std::string>::GetOrLoad(
+          full_path, [&full_path]() -> std::shared_ptr<const std::string> {
+            std::ifstream file(full_path, std::ios::binary);
+            if (!file) {
+              return nullptr;
+            }
+            std::ostringstream buffer;
+            buffer << file.rdbuf();
+            return std::make_shared<const std::string>(buffer.str());
+          });
   XMLDocument xml_doc;
-  xml_doc.LoadFile(full_path.c_str());
+  if (contents != nullptr) {
+    xml_doc.Parse(contents->c_str(), contents->size());
+  } else {
+    // Let the XML parser report the error.
+    xml_doc.LoadFile(full_path.c_str());
+  }
   if (xml_doc.ErrorID()) {
     throw std::runtime_error("Failed to parse XML in file " + full_path +
                              "\n" + xml_doc.ErrorName());
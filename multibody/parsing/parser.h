@@ -13,6 +13,13 @@ namespace multibody {
 
 /// Parses SDF and URDF input files into a MultibodyPlant and (optionally) a
 /// SceneGraph.
+///
+/// The parsed files (and the .obj files of Convex geometries) are cached for
+/// the lifetime of the process, and shared by all parsers, so that building
+/// many plants from the same files only reads each file once. A file is read
+/// again when its size or modification time changes. Files included by an SDF
+/// file are not checked for changes; their changes are only seen once the
+/// including file changes too.
 class Parser final {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Parser)
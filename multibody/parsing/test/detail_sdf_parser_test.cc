@@ -1,5 +1,6 @@
 #include "drake/multibody/parsing/detail_sdf_parser.h"
 
+#include <fstream>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -447,6 +448,31 @@ GTEST_TEST(SdfParser, TestUnsupportedFrames) {
 </model>)");
 }
 
+// Parsed files are cached, and reloaded when they change.
+GTEST_TEST(SdfParser, ReloadsChangedFiles) {
+  const std::string filename = temp_directory() + "/cached.sdf";
+  auto write_model = [&filename](const std::string& link_name) {
+    std::ofstream file(filename);
+    file << "<sdf version='1.6'><model name='cached'><link name='"
+         << link_name << "'/></model></sdf>\n";
+  };
+  PackageMap package_map;
+
+  write_model("a");
+  MultibodyPlant<double> plant;
+  const ModelInstanceIndex first =
+      AddModelFromSdfFile(filename, "first", package_map, &plant);
+  const ModelInstanceIndex second =
+      AddModelFromSdfFile(filename, "second", package_map, &plant);
+  EXPECT_TRUE(plant.HasBodyNamed("a", first));
+  EXPECT_TRUE(plant.HasBodyNamed("a", second));
+
+  write_model("bb");
+  const ModelInstanceIndex third =
+      AddModelFromSdfFile(filename, "third", package_map, &plant);
+  EXPECT_FALSE(plant.HasBodyNamed("a", third));
+  EXPECT_TRUE(plant.HasBodyNamed("bb", third));
+}
 
 }  // namespace
 }  // namespace internal
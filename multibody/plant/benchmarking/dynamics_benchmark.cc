@@ -0,0 +1,252 @@
+/// @file
+///
+/// Times the main dynamics computations of MultibodyPlant -- inverse dynamics,
+/// the mass matrix, a spatial velocity Jacobian and a discrete step -- for the
+/// iiwa arm, the Atlas humanoid and the Allegro hand, with T = double and
+/// T = AutoDiffXd (with derivatives with respect to the state). The arm and
+/// the hand are welded to the world; Atlas is floating.
+///
+/// Each evaluation sets the generalized positions, so that no cached
+/// configuration-dependent quantity is reused across evaluations.
+///
+/// With --json_output, the results are also written to a file, in the JSON
+/// format of Google Benchmark (one entry per model, scalar and computation,
+/// named "model/scalar/computation"), so that they can be tracked over time
+/// with the same tools.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/find_resource.h"
+#include "drake/math/autodiff.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+DEFINE_string(models, "iiwa,atlas,allegro",
+              "Comma-separated models to time, among iiwa, atlas and "
+              "allegro.");
+DEFINE_string(scalars, "double,autodiff",
+              "Comma-separated scalar types, among double and autodiff.");
+DEFINE_int32(num_evaluations, 100,
+             "Number of timed evaluations per model, scalar and computation.");
+DEFINE_int32(num_repetitions, 5,
+             "Number of repetitions of the timed evaluations; the fastest is "
+             "reported.");
+DEFINE_string(json_output, "",
+              "If not empty, the file to which the results are written, in "
+              "the JSON format of Google Benchmark.");
+
+namespace drake {
+namespace multibody {
+namespace benchmarking {
+namespace {
+
+using Eigen::VectorXd;
+using systems::Context;
+using systems::DiscreteValues;
+
+// The time of one computation on one model, with one scalar type.
+struct Result {
+  std::string name;
+  double time_us{};
+};
+
+std::vector<std::string> Split(const std::string& list) {
+  std::vector<std::string> items;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) items.push_back(item);
+  return items;
+}
+
+// Makes the named model, continuous if `time_step` is zero and discrete
+// otherwise.
+std::unique_ptr<MultibodyPlant<double>> MakePlant(const std::string& model,
+                                                  double time_step) {
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  Parser parser(plant.get());
+  if (model == "iiwa") {
+    parser.AddModelFromFile(FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_no_collision.sdf"));
+    plant->WeldFrames(plant->world_frame(),
+                      plant->GetFrameByName("iiwa_link_0"));
+  } else if (model == "atlas") {
+    parser.AddModelFromFile(FindResourceOrThrow(
+        "drake/examples/atlas/urdf/atlas_convex_hull.urdf"));
+  } else if (model == "allegro") {
+    parser.AddModelFromFile(FindResourceOrThrow(
+        "drake/manipulation/models/allegro_hand_description/sdf/"
+        "allegro_hand_description_right.sdf"));
+    plant->WeldFrames(plant->world_frame(),
+                      plant->GetFrameByName("hand_root"));
+  } else {
+    throw std::runtime_error("Unknown model: " + model);
+  }
+  plant->Finalize();
+  return plant;
+}
+
+// Sets the state of `context` to x, as values of type T. With AutoDiffXd, the
+// derivatives are with respect to x.
+template <typename T>
+void SetState(const MultibodyPlant<T>& plant, const VectorXd& x,
+              Context<T>* context) {
+  if constexpr (std::is_same<T, double>::value) {
+    plant.SetPositionsAndVelocities(context, x);
+  } else {
+    plant.SetPositionsAndVelocities(context, math::initializeAutoDiff(x));
+  }
+}
+
+// Times the computations on `plant` (continuous) and `discrete_plant`, and
+// appends their results, named after `model`, to `results`.
+template <typename T>
+void TimeDynamics(const std::string& model, const MultibodyPlant<T>& plant,
+                  const MultibodyPlant<T>& discrete_plant,
+                  std::vector<Result>* results) {
+  const std::string scalar =
+      std::is_same<T, double>::value ? "double" : "autodiff";
+  const int nv = plant.num_velocities();
+
+  // Returns the time of `calc` in microseconds, after setting the state of
+  // `context` to `x` (as an arbitrary but valid state).
+  auto time = [&](const std::string& computation, Context<T>* context,
+                  const MultibodyPlant<T>& timed_plant, auto&& calc) {
+    const VectorXd q0 =
+        math::DiscardGradient(timed_plant.GetPositions(*context));
+    VectorXd x(timed_plant.num_multibody_states());
+    x << q0, VectorXd::LinSpaced(nv, -1.0, 1.0);
+    double best = std::numeric_limits<double>::infinity();
+    for (int r = 0; r < FLAGS_num_repetitions; ++r) {
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+        SetState(timed_plant, x, context);
+        calc();
+      }
+      const std::chrono::duration<double, std::micro> elapsed =
+          std::chrono::steady_clock::now() - start;
+      best = std::min(best, elapsed.count() / FLAGS_num_evaluations);
+    }
+    results->push_back({fmt::format("{}/{}/{}", model, scalar, computation),
+                        best});
+    std::cout << fmt::format("{:>10} {:>9} {:>5} {:>36} {:>12.2f}\n", model,
+                             scalar, nv, computation, best);
+  };
+
+  auto context = plant.CreateDefaultContext();
+  if (plant.num_actuators() > 0) {
+    context->FixInputPort(plant.get_actuation_input_port().get_index(),
+                          VectorX<T>::Zero(plant.num_actuators()));
+  }
+
+  const VectorX<T> vdot = VectorX<T>::Zero(nv);
+  MultibodyForces<T> forces(plant);
+  VectorX<T> tau(nv);
+  time("CalcInverseDynamics", context.get(), plant, [&]() {
+    tau = plant.CalcInverseDynamics(*context, vdot, forces);
+  });
+
+  MatrixX<T> M(nv, nv);
+  time("CalcMassMatrixViaInverseDynamics", context.get(), plant, [&]() {
+    plant.CalcMassMatrixViaInverseDynamics(*context, &M);
+  });
+
+  // The Jacobian of the origin of the last body, the farthest from the world
+  // in these models.
+  const Frame<T>& frame_B =
+      plant.get_body(BodyIndex(plant.num_bodies() - 1)).body_frame();
+  MatrixX<T> J(6, nv);
+  time("CalcJacobianSpatialVelocity", context.get(), plant, [&]() {
+    plant.CalcJacobianSpatialVelocity(
+        *context, JacobianWrtVariable::kV, frame_B, Vector3<T>::Zero(),
+        plant.world_frame(), plant.world_frame(), &J);
+  });
+
+  auto discrete_context = discrete_plant.CreateDefaultContext();
+  if (discrete_plant.num_actuators() > 0) {
+    discrete_context->FixInputPort(
+        discrete_plant.get_actuation_input_port().get_index(),
+        VectorX<T>::Zero(discrete_plant.num_actuators()));
+  }
+  std::unique_ptr<DiscreteValues<T>> updates =
+      discrete_plant.AllocateDiscreteVariables();
+  time("CalcDiscreteVariableUpdates", discrete_context.get(), discrete_plant,
+       [&]() {
+         discrete_plant.CalcDiscreteVariableUpdates(*discrete_context,
+                                                    updates.get());
+       });
+}
+
+void WriteJson(const std::vector<Result>& results,
+               const std::string& filename) {
+  std::ofstream out(filename);
+  out << "{\n  \"context\": {\n";
+  out << fmt::format("    \"executable\": \"dynamics_benchmark\",\n");
+  out << fmt::format("    \"num_evaluations\": {},\n", FLAGS_num_evaluations);
+  out << fmt::format("    \"num_repetitions\": {}\n", FLAGS_num_repetitions);
+  out << "  },\n  \"benchmarks\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    out << fmt::format(
+        "    {{\"name\": \"{}\", \"iterations\": {}, \"real_time\": {}, "
+        "\"cpu_time\": {}, \"time_unit\": \"us\"}}{}\n",
+        results[i].name, FLAGS_num_evaluations, results[i].time_us,
+        results[i].time_us, i + 1 < results.size() ? "," : "");
+  }
+  out << "  ]\n}\n";
+  if (!out.good()) {
+    throw std::runtime_error(
+        fmt::format("Failed to write the results to {}", filename));
+  }
+}
+
+int do_main() {
+  const std::vector<std::string> scalars = Split(FLAGS_scalars);
+  auto has_scalar = [&scalars](const std::string& scalar) {
+    return std::find(scalars.begin(), scalars.end(), scalar) != scalars.end();
+  };
+  std::cout << fmt::format("{:>10} {:>9} {:>5} {:>36} {:>12}\n", "model",
+                           "scalar", "nv", "computation", "time [us]");
+  std::vector<Result> results;
+  for (const std::string& model : Split(FLAGS_models)) {
+    const auto plant = MakePlant(model, 0.0);
+    const auto discrete_plant = MakePlant(model, 1e-3);
+    if (has_scalar("double")) {
+      TimeDynamics(model, *plant, *discrete_plant, &results);
+    }
+    if (has_scalar("autodiff")) {
+      TimeDynamics(model,
+                   *systems::System<double>::ToAutoDiffXd(*plant),
+                   *systems::System<double>::ToAutoDiffXd(*discrete_plant),
+                   &results);
+    }
+  }
+  if (!FLAGS_json_output.empty()) {
+    WriteJson(results, FLAGS_json_output);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the dynamics computations of MultibodyPlant models.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::multibody::benchmarking::do_main();
+}
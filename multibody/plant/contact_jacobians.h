@@ -10,6 +10,27 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+/// Stores the non-zero columns of the contact Jacobians of a single contact
+/// pair between bodies A and B, with contact frame C (see ContactJacobians).
+/// Only the generalized velocities of the joints in the kinematic paths from
+/// the world to A and B can change the relative velocity of the contact
+/// points. For models with many independent trees (e.g. a pile of objects)
+/// these are a small fraction of the generalized velocities v.
+template <class T>
+struct ContactJacobianBlock {
+  /// The indices in v, sorted in increasing order, of the generalized
+  /// velocities whose columns of the contact Jacobians can be non-zero.
+  std::vector<int> velocity_indices;
+
+  /// Matrix of size `3 x k`, with k the size of velocity_indices, such that
+  /// `v_AcBc_C = J_AcBc_C⋅v(velocity_indices)` is the velocity of the contact
+  /// point Bc relative to Ac, expressed in C. For the i-th contact pair, the
+  /// rows of J_AcBc_C are the non-zero entries of rows `2⋅i` and `2⋅i+1` of
+  /// ContactJacobians::Jt, followed by minus the non-zero entries of row i of
+  /// ContactJacobians::Jn.
+  Matrix3X<T> J_AcBc_C;
+};
+
 /// Stores the computed contact Jacobians when a point contact model is used.
 /// At a given state of the multibody system, there will be `nc` contact pairs.
 /// For each penetration pair involving bodies A and B a contact frame C is
@@ -39,11 +60,17 @@ struct ContactJacobians {
   /// List of contact frames orientation R_WC in the world frame W for each
   /// contact pair.
   std::vector<drake::math::RotationMatrix<T>> R_WC_list;
+
+  /// Block-sparse form of `Jn` and `Jt`, with one entry per contact pair.
+  std::vector<ContactJacobianBlock<T>> blocks;
 };
 
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
 
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    struct ::drake::multibody::internal::ContactJacobianBlock)
+
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     struct ::drake::multibody::internal::ContactJacobians)
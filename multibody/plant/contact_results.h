@@ -4,7 +4,6 @@
 #include <utility>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -29,7 +28,9 @@ class ContactResults {
   ContactResults();
 
   /** Clears the set of contact information for when the old data becomes
-   invalid. */
+   invalid. The storage allocated for previous results is retained so that
+   refilling `this` at every time step does not reallocate once the number of
+   contacts settles. */
   void Clear();
 
   DRAKE_DEPRECATED("2019-10-01", "Use num_point_pair_contacts() instead.")
@@ -52,10 +53,17 @@ class ContactResults {
     point_pairs_info_.push_back(point_pair_info);
   }
 
-  /** Add a new hydroelastic contact to `this`. */
+  /** Add a new hydroelastic contact to `this`. The information cannot be
+   modified once added and therefore copies of `this` share it rather than
+   cloning it; copying %ContactResults (as done, for instance, to fill the
+   contact results output port of MultibodyPlant) does not deep copy contact
+   surfaces. If `hydroelastic_contact_info` does not own its contact surface,
+   that surface must outlive `this` and all of its copies. */
   void AddContactInfo(
       HydroelasticContactInfo<T>&& hydroelastic_contact_info) {
-    hydroelastic_contact_info_.push_back(std::move(hydroelastic_contact_info));
+    hydroelastic_contact_info_.push_back(
+        std::make_shared<const HydroelasticContactInfo<T>>(
+            std::move(hydroelastic_contact_info)));
   }
 
   DRAKE_DEPRECATED("2019-10-01", "Use point_pair_contact_info() instead.")
@@ -75,7 +83,8 @@ class ContactResults {
 
  private:
   std::vector<PointPairContactInfo<T>> point_pairs_info_;
-  std::vector<HydroelasticContactInfo<T>> hydroelastic_contact_info_;
+  std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>
+      hydroelastic_contact_info_;
 };
 
 // Workaround for https://gcc.gnu.org/bugzilla/show_bug.cgi?id=57728 which
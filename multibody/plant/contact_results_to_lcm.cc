@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "drake/lcm/lcm_message_writer.h"
 #include "drake/lcmt_contact_results_for_viz.hpp"
 
 namespace drake {
@@ -31,6 +32,9 @@ ContactResultsToLcmSystem<T>::ContactResultsToLcmSystem(
       this->DeclareAbstractInputPort(Value<ContactResults<T>>()).get_index();
   message_output_port_index_ = this->DeclareAbstractOutputPort(
       &ContactResultsToLcmSystem::CalcLcmContactOutput).get_index();
+  message_bytes_output_port_index_ = this->DeclareAbstractOutputPort(
+      "lcm_message_bytes",
+      &ContactResultsToLcmSystem::CalcLcmContactBytes).get_index();
 }
 
 template <typename T>
@@ -45,6 +49,12 @@ ContactResultsToLcmSystem<T>::get_lcm_message_output_port() const {
   return this->get_output_port(message_output_port_index_);
 }
 
+template <typename T>
+const systems::OutputPort<T>&
+ContactResultsToLcmSystem<T>::get_lcm_message_bytes_output_port() const {
+  return this->get_output_port(message_bytes_output_port_index_);
+}
+
 template <typename T>
 void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
     const Context<T>& context, lcmt_contact_results_for_viz* output) const {
@@ -119,6 +129,59 @@ void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
   }
 }
 
+template <typename T>
+void ContactResultsToLcmSystem<T>::CalcLcmContactBytes(
+    const Context<T>& context, std::vector<uint8_t>* output) const {
+  const auto& contact_results = get_contact_result_input_port().
+      template Eval<ContactResults<T>>(context);
+
+  // The fields of lcmt_contact_results_for_viz, in the order of its
+  // definition; this must match CalcLcmContactOutput().
+  lcm::LcmMessageWriter writer(output);
+  writer.WriteInt64(lcmt_contact_results_for_viz::getHash());
+  // Time in microseconds.
+  const int64_t timestamp = static_cast<int64_t>(
+      ExtractDoubleOrThrow(context.get_time()) * 1e6);
+  writer.WriteInt64(timestamp);
+
+  auto write_double3 = [&writer](const Vector3<T>& src) {
+    writer.WriteDouble(ExtractDoubleOrThrow(src(0)));
+    writer.WriteDouble(ExtractDoubleOrThrow(src(1)));
+    writer.WriteDouble(ExtractDoubleOrThrow(src(2)));
+  };
+
+  writer.WriteInt32(contact_results.num_point_pair_contacts());
+  for (int i = 0; i < contact_results.num_point_pair_contacts(); ++i) {
+    const PointPairContactInfo<T>& contact_info =
+        contact_results.point_pair_contact_info(i);
+    writer.WriteInt64(timestamp);
+    writer.WriteString(body_names_.at(contact_info.bodyA_index()));
+    writer.WriteString(body_names_.at(contact_info.bodyB_index()));
+    write_double3(contact_info.contact_point());
+    write_double3(contact_info.contact_force());
+    write_double3(contact_info.point_pair().nhat_BA_W);
+  }
+
+  writer.WriteInt32(contact_results.num_hydroelastic_contacts());
+  for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
+    const geometry::ContactSurface<T>& contact_surface =
+        contact_results.hydroelastic_contact_info(i).contact_surface();
+    writer.WriteString(
+        geometry_id_to_body_name_map_.at(contact_surface.id_M()));
+    writer.WriteString(
+        geometry_id_to_body_name_map_.at(contact_surface.id_N()));
+
+    const geometry::SurfaceMesh<T>& mesh_W = contact_surface.mesh_W();
+    writer.WriteInt32(mesh_W.num_faces());
+    for (geometry::SurfaceFaceIndex j(0); j < mesh_W.num_faces(); ++j) {
+      const auto& face = mesh_W.element(j);
+      for (int k = 0; k < 3; ++k) {
+        write_double3(mesh_W.vertex(face.vertex(k)).r_MV());
+      }
+    }
+  }
+}
+
 systems::lcm::LcmPublisherSystem* ConnectContactResultsToDrakeVisualizer(
     systems::DiagramBuilder<double>* builder,
     const MultibodyPlant<double>& multibody_plant,
@@ -140,14 +203,19 @@ systems::lcm::LcmPublisherSystem* ConnectContactResultsToDrakeVisualizer(
           multibody_plant);
   contact_to_lcm->set_name("contact_to_lcm");
 
-  auto contact_results_publisher = builder->AddSystem(
-      systems::lcm::LcmPublisherSystem::Make<lcmt_contact_results_for_viz>(
-          "CONTACT_RESULTS", lcm, 1.0 / 60 /* publish period */));
+  // The publisher receives the bytes of lcmt_contact_results_for_viz, which
+  // are encoded without building the message.
+  auto contact_results_publisher =
+      builder->template AddSystem<systems::lcm::LcmPublisherSystem>(
+          "CONTACT_RESULTS",
+          std::make_unique<systems::lcm::EncodedBytesSerializer>(), lcm,
+          1.0 / 60 /* publish period */);
   contact_results_publisher->set_name("contact_results_publisher");
 
   builder->Connect(contact_results_port,
                    contact_to_lcm->get_contact_result_input_port());
-  builder->Connect(*contact_to_lcm, *contact_results_publisher);
+  builder->Connect(contact_to_lcm->get_lcm_message_bytes_output_port(),
+                   contact_results_publisher->get_input_port());
 
   return contact_results_publisher;
 }
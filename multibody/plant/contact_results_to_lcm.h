@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -20,8 +21,12 @@ namespace drake {
 namespace multibody {
 
 /** A System that encodes ContactResults into a lcmt_contact_results_for_viz
- message. It has a single input port with type ContactResults<T> and a single
- output port with lcmt_contact_results_for_viz.
+ message. It has a single input port with type ContactResults<T> and two
+ output ports: one with the lcmt_contact_results_for_viz message, and one
+ with the same message already encoded into LCM bytes (as a
+ `std::vector<uint8_t>`), which is written directly from the contact results,
+ without the message object, for an LcmPublisherSystem with an
+ EncodedBytesSerializer.
 
  @tparam T Must be one of drake's default scalar types.
  */
@@ -46,6 +51,9 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
   const systems::InputPort<T>& get_contact_result_input_port() const;
   const systems::OutputPort<T>& get_lcm_message_output_port() const;
 
+  /** Returns the output port of the encoded message bytes. */
+  const systems::OutputPort<T>& get_lcm_message_bytes_output_port() const;
+
  private:
   // Allow different specializations to access each other's private data for
   // scalar conversion.
@@ -54,9 +62,13 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
   void CalcLcmContactOutput(const systems::Context<T>& context,
                             lcmt_contact_results_for_viz* output) const;
 
+  void CalcLcmContactBytes(const systems::Context<T>& context,
+                           std::vector<uint8_t>* output) const;
+
   // Named indices for the i/o ports.
   systems::InputPortIndex contact_result_input_port_index_;
   systems::OutputPortIndex message_output_port_index_;
+  systems::OutputPortIndex message_bytes_output_port_index_;
 
   // A mapping from geometry IDs to body indices.
   std::unordered_map<geometry::GeometryId, std::string>
@@ -0,0 +1,273 @@
+#include "drake/multibody/plant/convex_contact_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+ConvexContactSolver<T>::ConvexContactSolver(int nv) : nv_(nv) {
+  DRAKE_THROW_UNLESS(nv >= 0);
+}
+
+template <typename T>
+void ConvexContactSolver<T>::SetProblemData(
+    EigenPtr<const MatrixX<T>> M, EigenPtr<const MatrixX<T>> Jn,
+    EigenPtr<const MatrixX<T>> Jt, EigenPtr<const VectorX<T>> p_star,
+    EigenPtr<const VectorX<T>> x0, EigenPtr<const VectorX<T>> stiffness,
+    EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
+  DRAKE_THROW_UNLESS(M != nullptr && Jn != nullptr && Jt != nullptr);
+  DRAKE_THROW_UNLESS(p_star != nullptr && x0 != nullptr);
+  DRAKE_THROW_UNLESS(stiffness != nullptr && dissipation != nullptr);
+  DRAKE_THROW_UNLESS(mu != nullptr);
+  nc_ = x0->size();
+  DRAKE_THROW_UNLESS(p_star->size() == nv_);
+  DRAKE_THROW_UNLESS(M->rows() == nv_ && M->cols() == nv_);
+  DRAKE_THROW_UNLESS(Jn->rows() == nc_ && Jn->cols() == nv_);
+  DRAKE_THROW_UNLESS(Jt->rows() == 2 * nc_ && Jt->cols() == nv_);
+  DRAKE_THROW_UNLESS(stiffness->size() == nc_);
+  DRAKE_THROW_UNLESS(dissipation->size() == nc_);
+  DRAKE_THROW_UNLESS(mu->size() == nc_);
+  M_ = M;
+  Jn_ = Jn;
+  Jt_ = Jt;
+  p_star_ = p_star;
+  x0_ = x0;
+  stiffness_ = stiffness;
+  dissipation_ = dissipation;
+  mu_ = mu;
+}
+
+template <typename T>
+void ConvexContactSolver<T>::set_solver_parameters(
+    const ConvexContactSolverParameters& parameters) {
+  DRAKE_THROW_UNLESS(parameters.max_iterations >= 0);
+  DRAKE_THROW_UNLESS(parameters.abs_tolerance >= 0);
+  DRAKE_THROW_UNLESS(parameters.rel_tolerance >= 0);
+  DRAKE_THROW_UNLESS(parameters.sigma > 0);
+  DRAKE_THROW_UNLESS(parameters.near_rigid_threshold >= 0);
+  DRAKE_THROW_UNLESS(parameters.ls_max_iterations >= 0);
+  DRAKE_THROW_UNLESS(0 < parameters.ls_c && parameters.ls_c < 1);
+  DRAKE_THROW_UNLESS(0 < parameters.ls_rho && parameters.ls_rho < 1);
+  parameters_ = parameters;
+}
+
+template <typename T>
+VectorX<T> ConvexContactSolver<T>::CalcContactVelocities(
+    const VectorX<T>& v) const {
+  const VectorX<T> vn = *Jn_ * v;
+  const VectorX<T> vt = *Jt_ * v;
+  VectorX<T> vc(3 * nc_);
+  for (int i = 0; i < nc_; ++i) {
+    vc.template segment<2>(3 * i) = vt.template segment<2>(2 * i);
+    vc(3 * i + 2) = vn(i);
+  }
+  return vc;
+}
+
+template <typename T>
+VectorX<T> ConvexContactSolver<T>::CalcGeneralizedImpulse(
+    const VectorX<T>& gamma) const {
+  VectorX<T> gamma_n(nc_);
+  VectorX<T> gamma_t(2 * nc_);
+  for (int i = 0; i < nc_; ++i) {
+    gamma_t.template segment<2>(2 * i) = gamma.template segment<2>(3 * i);
+    gamma_n(i) = gamma(3 * i + 2);
+  }
+  return Jn_->transpose() * gamma_n + Jt_->transpose() * gamma_t;
+}
+
+template <typename T>
+typename ConvexContactSolver<T>::Regularization
+ConvexContactSolver<T>::CalcRegularization(double dt) const {
+  Regularization R{VectorX<T>(nc_), VectorX<T>(nc_), VectorX<T>(nc_)};
+  if (nc_ == 0) return R;
+
+  const Eigen::LDLT<MatrixX<T>> M_ldlt(*M_);
+  MatrixX<T> Jc(3, nv_);
+  for (int i = 0; i < nc_; ++i) {
+    // The approximate inverse effective mass of the contact, i.e. the mean of
+    // the diagonal of its block of the Delassus operator J M⁻¹ Jᵀ.
+    Jc.template topRows<2>() = Jt_->template middleRows<2>(2 * i);
+    Jc.row(2) = Jn_->row(i);
+    T w = (Jc * M_ldlt.solve(Jc.transpose())).trace() / 3;
+    if (w < std::numeric_limits<double>::epsilon()) {
+      w = std::numeric_limits<double>::epsilon();
+    }
+
+    const T x0 = (*x0_)(i);
+    const T tau_d = x0 > 0 ? T((*dissipation_)(i) * x0) : T(0);
+    R.Rn(i) = 1.0 / (dt * (*stiffness_)(i) * (dt + tau_d));
+    // A contact cannot be stiffer than the time step can resolve, see
+    // ConvexContactSolverParameters::near_rigid_threshold.
+    const double beta = parameters_.near_rigid_threshold;
+    const T Rn_near_rigid = beta * beta / (4 * M_PI * M_PI) * w;
+    if (R.Rn(i) < Rn_near_rigid) R.Rn(i) = Rn_near_rigid;
+    R.Rt(i) = parameters_.sigma * w;
+    R.vn_hat(i) = x0 / (dt + tau_d);
+  }
+  return R;
+}
+
+template <typename T>
+T ConvexContactSolver<T>::CalcImpulses(const Regularization& R,
+                                       const VectorX<T>& vc,
+                                       VectorX<T>* gamma,
+                                       std::vector<Matrix3<T>>* G) const {
+  gamma->resize(3 * nc_);
+  if (G != nullptr) G->resize(nc_);
+  T cost = 0;
+  for (int i = 0; i < nc_; ++i) {
+    const T& Rt = R.Rt(i);
+    const T& Rn = R.Rn(i);
+    const T mu = (*mu_)(i);
+    const Vector2<T> yt = -vc.template segment<2>(3 * i) / Rt;
+    const T yn = -(vc(3 * i + 2) - R.vn_hat(i)) / Rn;
+    const T yr = yt.norm();
+    const T mu_hat = mu * Rt / Rn;
+    const Vector3<T> R_inv(1.0 / Rt, 1.0 / Rt, 1.0 / Rn);
+
+    auto gamma_i = gamma->template segment<3>(3 * i);
+    Matrix3<T> dgamma_dy;
+    if (yr <= mu * yn) {
+      // Stiction, y is inside the friction cone.
+      gamma_i << yt, yn;
+      dgamma_dy.setIdentity();
+    } else if (mu_hat * yr <= -yn) {
+      // No contact, y is inside the polar cone.
+      gamma_i.setZero();
+      dgamma_dy.setZero();
+    } else {
+      // Sliding, y is projected onto the boundary of the friction cone.
+      const Vector2<T> t_hat = yt / yr;
+      const T gn = (yn + mu_hat * yr) / (1 + mu * mu_hat);
+      gamma_i << mu * gn * t_hat, gn;
+      Vector3<T> dgn_dy;
+      dgn_dy << mu_hat * t_hat, 1;
+      dgn_dy /= (1 + mu * mu_hat);
+      dgamma_dy.row(2) = dgn_dy.transpose();
+      dgamma_dy.template topRows<2>() = mu * t_hat * dgn_dy.transpose();
+      dgamma_dy.template topLeftCorner<2, 2>() +=
+          mu * gn * (Matrix2<T>::Identity() - t_hat * t_hat.transpose()) / yr;
+    }
+    // Since y = -R⁻¹ (vc - v̂), the Hessian of the cost is -∂γ/∂vc =
+    // ∂γ/∂y R⁻¹, which is symmetric.
+    if (G != nullptr) (*G)[i] = dgamma_dy * R_inv.asDiagonal();
+    cost += 0.5 * (Rt * gamma_i.template head<2>().squaredNorm() +
+                   Rn * gamma_i(2) * gamma_i(2));
+  }
+  return cost;
+}
+
+template <typename T>
+ConvexContactSolverResult ConvexContactSolver<T>::SolveWithGuess(
+    double dt, const VectorX<T>& v_guess) const {
+  DRAKE_THROW_UNLESS(M_ != nullptr);
+  DRAKE_THROW_UNLESS(v_guess.size() == nv_);
+  DRAKE_THROW_UNLESS(dt > 0);
+  statistics_.Reset();
+
+  const Eigen::Ref<const MatrixX<T>> M = *M_;
+  const Eigen::Ref<const VectorX<T>> p_star = *p_star_;
+  const VectorX<T> v_star = M.ldlt().solve(p_star);
+  const Regularization R = CalcRegularization(dt);
+  // Scaling of the generalized momenta, so that the convergence criterion
+  // does not depend on the units of the generalized velocities.
+  const VectorX<T> D = M.diagonal().cwiseSqrt().cwiseInverse();
+
+  // The cost ℓ(v), which also updates the impulses and their Hessian.
+  auto calc_cost = [this, &M, &v_star, &R](const VectorX<T>& v,
+                                           VectorX<T>* gamma,
+                                           std::vector<Matrix3<T>>* G) -> T {
+    const VectorX<T> dv = v - v_star;
+    return 0.5 * dv.dot(M * dv) +
+           CalcImpulses(R, CalcContactVelocities(v), gamma, G);
+  };
+
+  VectorX<T> v = v_guess;
+  VectorX<T> gamma;
+  std::vector<Matrix3<T>> G;
+  T cost = calc_cost(v, &gamma, &G);
+  VectorX<T> j;
+  MatrixX<T> Jc(3, nv_);
+  ConvexContactSolverResult result =
+      ConvexContactSolverResult::kMaxIterationsReached;
+  for (int k = 0;; ++k) {
+    // The gradient of the cost, ∇ℓ = M (v - v*) - Jᵀ γ.
+    j = CalcGeneralizedImpulse(gamma);
+    const VectorX<T> p = M * v;
+    const VectorX<T> gradient = p - p_star - j;
+    const double residual =
+        ExtractDoubleOrThrow(D.cwiseProduct(gradient).norm());
+    statistics_.residuals.push_back(residual);
+    const double scale =
+        std::max(ExtractDoubleOrThrow(D.cwiseProduct(p).norm()),
+                 ExtractDoubleOrThrow(D.cwiseProduct(j).norm()));
+    if (residual <= parameters_.abs_tolerance +
+                        parameters_.rel_tolerance * scale) {
+      result = ConvexContactSolverResult::kSuccess;
+      break;
+    }
+    if (k == parameters_.max_iterations) break;
+
+    // The Hessian of the cost, H = M + Jᵀ G J.
+    MatrixX<T> H = M;
+    for (int i = 0; i < nc_; ++i) {
+      Jc.template topRows<2>() = Jt_->template middleRows<2>(2 * i);
+      Jc.row(2) = Jn_->row(i);
+      H += Jc.transpose() * G[i] * Jc;
+    }
+    const Eigen::LDLT<MatrixX<T>> H_ldlt(H);
+    if (H_ldlt.info() != Eigen::Success) {
+      result = ConvexContactSolverResult::kLinearSolverFailed;
+      break;
+    }
+    const VectorX<T> dv = H_ldlt.solve(-gradient);
+
+    // Backtracking line search, which is guaranteed to decrease the cost
+    // since dv is a descent direction of a convex function.
+    const T dcost = gradient.dot(dv);
+    T alpha = 1.0;
+    VectorX<T> v_alpha = v + dv;
+    T cost_alpha = calc_cost(v_alpha, &gamma, &G);
+    for (int ls = 0; ls < parameters_.ls_max_iterations &&
+                     cost_alpha > cost + parameters_.ls_c * alpha * dcost;
+         ++ls) {
+      alpha *= parameters_.ls_rho;
+      v_alpha = v + alpha * dv;
+      cost_alpha = calc_cost(v_alpha, &gamma, &G);
+      ++statistics_.num_line_search_iterations;
+    }
+    v = v_alpha;
+    cost = cost_alpha;
+    ++statistics_.num_iterations;
+  }
+
+  // Store the solution, with the impulses converted to forces.
+  v_ = v;
+  tau_c_ = j / dt;
+  const VectorX<T> vc = CalcContactVelocities(v);
+  fn_.resize(nc_);
+  ft_.resize(2 * nc_);
+  vn_.resize(nc_);
+  vt_.resize(2 * nc_);
+  for (int i = 0; i < nc_; ++i) {
+    ft_.template segment<2>(2 * i) = gamma.template segment<2>(3 * i) / dt;
+    fn_(i) = gamma(3 * i + 2) / dt;
+    vt_.template segment<2>(2 * i) = vc.template segment<2>(3 * i);
+    vn_(i) = vc(3 * i + 2);
+  }
+  return result;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::ConvexContactSolver)
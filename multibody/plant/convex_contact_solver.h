@@ -0,0 +1,269 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+/// The result from ConvexContactSolver::SolveWithGuess() used to report the
+/// success or failure of the solver.
+enum class ConvexContactSolverResult {
+  /// Successful computation.
+  kSuccess = 0,
+
+  /// The maximum number of iterations was reached.
+  kMaxIterationsReached = 1,
+
+  /// The factorization of the Hessian within the Newton iteration failed.
+  kLinearSolverFailed = 2
+};
+
+/// These are the parameters controlling the iteration process of the
+/// ConvexContactSolver solver.
+struct ConvexContactSolverParameters {
+  /// The maximum number of iterations allowed for the Newton iteration.
+  int max_iterations{100};
+
+  /// Absolute and relative tolerances for the convergence of the Newton
+  /// iteration. The iteration stops when the gradient of the cost, scaled by
+  /// D = diag(M)^(-1/2), satisfies ‖D⋅∇ℓ‖ ≤ abs_tolerance + rel_tolerance⋅
+  /// max(‖D⋅M⋅v‖, ‖D⋅Jᵀ⋅γ‖), i.e. the balance of momentum is satisfied to a
+  /// fraction of the momentum of the system and of the contact impulses.
+  double abs_tolerance{1.0e-14};
+  double rel_tolerance{1.0e-6};
+
+  /// The regularization of friction, as a fraction of the (approximate)
+  /// inverse effective mass of each contact. It introduces a slip velocity
+  /// proportional to the friction force during stiction, which for the
+  /// default value is negligible in practice.
+  double sigma{1.0e-3};
+
+  /// (Advanced) Contacts stiffer than what the time step can resolve (i.e.,
+  /// whose period of oscillation is smaller than near_rigid_threshold time
+  /// steps) are regularized as if their period were exactly
+  /// near_rigid_threshold time steps, which keeps the problem well
+  /// conditioned. Zero disables this.
+  double near_rigid_threshold{1.0};
+
+  /// (Advanced) Parameters of the backtracking line search: the step is
+  /// reduced by a factor ls_rho until the cost satisfies the Armijo condition
+  /// with parameter ls_c, in at most ls_max_iterations reductions.
+  int ls_max_iterations{40};
+  double ls_c{1.0e-4};
+  double ls_rho{0.8};
+};
+
+/// Struct used to store information about the iteration process performed by
+/// ConvexContactSolver.
+struct ConvexContactSolverIterationStats {
+  /// (Internal) Used by ConvexContactSolver to reset statistics.
+  void Reset() {
+    num_iterations = 0;
+    num_line_search_iterations = 0;
+    residuals.clear();
+  }
+
+  /// The number of Newton iterations performed by the last solve.
+  int num_iterations{0};
+
+  /// The total number of line search iterations performed by the last solve.
+  int num_line_search_iterations{0};
+
+  /// (Advanced) The scaled norm of the gradient ‖D⋅∇ℓ‖ at each Newton
+  /// iteration, including the one at the solution. It has
+  /// `num_iterations + 1` entries after a successful solve.
+  std::vector<double> residuals;
+};
+
+/** %ConvexContactSolver solves the same discrete time stepping problem as
+ImplicitStribeckSolver, see @ref implicit_stribeck_class_intro "its
+documentation", but with a convex approximation of contact rather than a
+regularized Stribeck friction model.
+
+Given the generalized momentum `p* = M vˢ + δt τ` the system would have at the
+next time step without contact forces, the next step velocities are the
+unique minimizer of the convex cost <pre>
+  ℓ(v) = ½ (v - v*)ᵀ M (v - v*) + ∑ᵢ ½ γᵢᵀ Rᵢ γᵢ,   v* = M⁻¹ p*,
+</pre>
+where, for each contact point i with contact velocity `vcᵢ = [vₜᵢ, vₙᵢ]`
+(given by the rows of Jₜ and Jₙ), the contact impulse `γᵢ = P(yᵢ)` is the
+projection of `yᵢ = -Rᵢ⁻¹ (vcᵢ - v̂ᵢ)` onto the friction cone ‖γₜ‖ ≤ μγₙ, in
+the norm defined by the diagonal regularization `Rᵢ = diag(Rₜ, Rₜ, Rₙ)`
+[Castro et al., 2022]. At the minimum, `M (v - v*) = Jₙᵀ γₙ + Jₜᵀ γₜ`.
+
+The normal impulse is that of a linear spring-damper, `γₙ = δt k (x₀ - (δt +
+τ_d) vₙ)₊`, with `x₀` the penetration at the previous time step, `k` the
+stiffness, and `τ_d = d x₀` the dissipation time scale that linearizes
+ImplicitStribeckSolver's Hunt-Crossley dissipation `d` about `x₀`. Hence `Rₙ =
+1 / (δt k (δt + τ_d))` and `v̂ₙ = x₀ / (δt + τ_d)`. Friction is regularized by
+`Rₜ = σ wᵢ`, with `wᵢ` the (approximate) inverse effective mass of the
+contact, so that stiction only introduces a slip velocity of the order of σ
+times the velocity change the friction force produces, without the stiction
+tolerance of the Stribeck model.
+
+Since the cost is strongly convex and continuously differentiable, Newton's
+method with a backtracking line search on the cost converges from any initial
+guess, typically in a few iterations, even for the stacking and stiction
+scenarios that are hard for ImplicitStribeckSolver. The previous time step
+velocities, which contain the previous step's contact impulses, are a good
+initial guess.
+
+Castro, A.M., Permenter, F.N. and Han, X., 2022. An Unconstrained Convex
+  Formulation of Compliant Contact. IEEE Transactions on Robotics.
+
+@tparam T Must be one of drake's default scalar types. The solver throws for
+`T = symbolic::Expression`, whose comparisons cannot be evaluated.
+*/
+template <typename T>
+class ConvexContactSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ConvexContactSolver)
+
+  /// Instantiates a solver for a problem with `nv` generalized velocities.
+  /// @throws std::exception if nv is negative.
+  explicit ConvexContactSolver(int nv);
+
+  /// Sets the data for the problem to be solved, with the same meaning as the
+  /// data of ImplicitStribeckSolver::SetTwoWayCoupledProblemData(). In the
+  /// documented parameters below, `nv` is the number of generalized
+  /// velocities and `nc` is the number of contact points.
+  ///
+  /// @param[in] M The mass matrix of the system, of size `nv x nv`.
+  /// @param[in] Jn The normal separation velocities Jacobian, of size
+  ///   `nc x nv`.
+  /// @param[in] Jt The tangential velocities Jacobian, of size `2nc x nv`.
+  /// @param[in] p_star The generalized momentum the system would have at the
+  ///   next time step if contact forces were zero.
+  /// @param[in] x0 The signed penetration distance at the previous time step,
+  ///   positive when bodies overlap.
+  /// @param[in] stiffness The (positive) stiffness of each contact point.
+  /// @param[in] dissipation The Hunt-Crossley dissipation of each contact
+  ///   point, see the class's documentation.
+  /// @param[in] mu The friction coefficient of each contact point.
+  ///
+  /// @warning This method stores constant references to the matrices and
+  /// vectors passed as arguments. Therefore they must outlive this class and
+  /// changes to the problem data invalidate any solution performed by this
+  /// solver.
+  ///
+  /// @throws std::exception if any of the data pointers are nullptr, or if
+  /// the problem data sizes are not consistent as described above.
+  void SetProblemData(
+      EigenPtr<const MatrixX<T>> M, EigenPtr<const MatrixX<T>> Jn,
+      EigenPtr<const MatrixX<T>> Jt, EigenPtr<const VectorX<T>> p_star,
+      EigenPtr<const VectorX<T>> x0, EigenPtr<const VectorX<T>> stiffness,
+      EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
+
+  /// Given an initial guess `v_guess`, this method uses a Newton iteration
+  /// to find the minimizer of the cost in this class's documentation.
+  /// @returns kSuccess if the iteration converges. All other values of
+  /// ConvexContactSolverResult report different failure modes.
+  ///
+  /// @param[in] dt The time step used to advance the solution in time.
+  /// @param[in] v_guess The initial guess for the Newton iteration, typically
+  ///   the previous time step velocities.
+  ///
+  /// @throws std::exception if `v_guess` is not of size `nv`, or if
+  /// SetProblemData() was not called.
+  ConvexContactSolverResult SolveWithGuess(
+      double dt, const VectorX<T>& v_guess) const;
+
+  /// @name Retrieving the solution
+  /// These methods allow to retrieve the solution stored in the solver after
+  /// the last call to SolveWithGuess(). The forces are the impulses divided
+  /// by the time step, and follow the conventions of ImplicitStribeckSolver.
+  /// @{
+
+  /// Returns the vector of generalized velocities at the next time step.
+  const VectorX<T>& get_generalized_velocities() const { return v_; }
+
+  /// Returns the vector of generalized contact forces, of size `nv`.
+  const VectorX<T>& get_generalized_contact_forces() const { return tau_c_; }
+
+  /// Returns the vector of (repulsive) normal forces, of size `nc`.
+  const VectorX<T>& get_normal_forces() const { return fn_; }
+
+  /// Returns the vector of friction forces, of size `2nc`.
+  const VectorX<T>& get_friction_forces() const { return ft_; }
+
+  /// Returns the vector of normal separation velocities, of size `nc`.
+  const VectorX<T>& get_normal_velocities() const { return vn_; }
+
+  /// Returns the vector of tangential velocities, of size `2nc`.
+  const VectorX<T>& get_tangential_velocities() const { return vt_; }
+
+  /// @}
+
+  /// Returns statistics recorded during the last call to SolveWithGuess().
+  const ConvexContactSolverIterationStats& get_iteration_statistics() const {
+    return statistics_;
+  }
+
+  /// Returns the current set of parameters controlling the iteration process.
+  const ConvexContactSolverParameters& get_solver_parameters() const {
+    return parameters_;
+  }
+
+  /// Sets the parameters to be used by the solver.
+  /// @throws std::exception if the parameters are not valid.
+  void set_solver_parameters(const ConvexContactSolverParameters& parameters);
+
+ private:
+  // The regularization and the stabilization velocities of each contact, see
+  // the class's documentation.
+  struct Regularization {
+    VectorX<T> Rt;
+    VectorX<T> Rn;
+    VectorX<T> vn_hat;
+  };
+
+  // Computes the regularization of each contact for the time step `dt`.
+  Regularization CalcRegularization(double dt) const;
+
+  // Computes the impulses `gamma` (of size 3nc, ordered as [γₜ, γₙ] for each
+  // contact) for the contact velocities `vc` (ordered likewise), and returns
+  // the contact term of the cost. If `G` is not nullptr, it stores the 3x3
+  // blocks of the Hessian -∂γ/∂vc of each contact.
+  T CalcImpulses(const Regularization& R, const VectorX<T>& vc,
+                 VectorX<T>* gamma, std::vector<Matrix3<T>>* G) const;
+
+  // Returns the contact velocities J⋅v, ordered as in CalcImpulses().
+  VectorX<T> CalcContactVelocities(const VectorX<T>& v) const;
+
+  // Returns the generalized impulse Jᵀ⋅γ.
+  VectorX<T> CalcGeneralizedImpulse(const VectorX<T>& gamma) const;
+
+  int nv_{0};
+  int nc_{0};
+  ConvexContactSolverParameters parameters_;
+
+  // The problem data, see SetProblemData().
+  EigenPtr<const MatrixX<T>> M_;
+  EigenPtr<const MatrixX<T>> Jn_;
+  EigenPtr<const MatrixX<T>> Jt_;
+  EigenPtr<const VectorX<T>> p_star_;
+  EigenPtr<const VectorX<T>> x0_;
+  EigenPtr<const VectorX<T>> stiffness_;
+  EigenPtr<const VectorX<T>> dissipation_;
+  EigenPtr<const VectorX<T>> mu_;
+
+  // The solution of the last call to SolveWithGuess().
+  mutable VectorX<T> v_;
+  mutable VectorX<T> tau_c_;
+  mutable VectorX<T> fn_;
+  mutable VectorX<T> ft_;
+  mutable VectorX<T> vn_;
+  mutable VectorX<T> vt_;
+  mutable ConvexContactSolverIterationStats statistics_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::ConvexContactSolver)
@@ -6,10 +6,10 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/math/orthonormal_basis.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
-#include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 namespace drake {
 
@@ -41,33 +41,66 @@ void HydroelasticTractionCalculator<T>::
   // model) might see benefit from a higher-order quadrature.
   const GaussianTriangleQuadratureRule gaussian(2 /* order */);
 
-  // We'll be accumulating force on body A at the surface centroid C,
-  // triangle-by-triangle.
-  SpatialForce<T> F_Ac_W;
-  F_Ac_W.SetZero();
-
-  // Integrate the tractions over all triangles in the contact surface.
-  for (SurfaceFaceIndex i(0); i < data.surface.mesh_W().num_faces(); ++i) {
-    // Construct the function to be integrated over triangle i.
-    // TODO(sherm1) Pull functor creation out of the loop (not a good idea to
-    //              create a new functor for every i).
-    std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
-        [this, &data, i, dissipation,
-         mu_coulomb](const Vector3<T>& Q_barycentric) {
-          TractionAtPointData traction_output = CalcTractionAtPoint(
-              data, i, Q_barycentric, dissipation, mu_coulomb);
-          return ComputeSpatialTractionAtAcFromTractionAtAq(
-              data, traction_output.p_WQ, traction_output.traction_Aq_W);
-        };
-
-    // Compute the integral over the triangle to get a force from the
-    // tractions (force/area) at the Gauss points (shifted to C).
-    const SpatialForce<T> Fi_Ac_W =  // Force from triangle i.
-        TriangleQuadrature<SpatialForce<T>, T>::Integrate(
-            traction_Ac_W, gaussian, data.surface.mesh_W().area(i));
-
-    // Update the spatial force at body A's origin.
-    F_Ac_W += Fi_Ac_W;
+  // The quadrature points are the same for all triangles. Convert them once
+  // to the full barycentric coordinates used by the contact surface.
+  const std::vector<Vector2<double>>& quadrature_points =
+      gaussian.quadrature_points();
+  const std::vector<double>& weights = gaussian.weights();
+  DRAKE_DEMAND(quadrature_points.size() == weights.size());
+  DRAKE_DEMAND(weights.size() >= 1);
+  const int num_quadrature_points = weights.size();
+  std::vector<typename SurfaceMesh<T>::Barycentric> Q_barycentric(
+      num_quadrature_points);
+  for (int k = 0; k < num_quadrature_points; ++k) {
+    Q_barycentric[k] = typename SurfaceMesh<T>::Barycentric(
+        quadrature_points[k][0], quadrature_points[k][1],
+        1 - quadrature_points[k][0] - quadrature_points[k][1]);
+  }
+
+  // Computes the spatial force on body A at the surface centroid C from the
+  // tractions over face i, from the weighted sum of the spatial tractions
+  // (shifted to C) at the quadrature points. A polygon is integrated by its
+  // centroid alone, instead of by the quadrature points of the triangles of a
+  // fan around its centroid.
+  const bool is_triangle = data.surface.is_triangle();
+  auto integrate_face = [&](SurfaceFaceIndex i) {
+    if (!is_triangle) {
+      const TractionAtPointData traction_output =
+          CalcTractionAtCentroid(data, i, dissipation, mu_coulomb);
+      return ComputeSpatialTractionAtAcFromTractionAtAq(
+                 data, traction_output.p_WQ, traction_output.traction_Aq_W) *
+             data.surface.area(i);
+    }
+    SpatialForce<T> Ft_Ac_W_sum = SpatialForce<T>::Zero();
+    for (int k = 0; k < num_quadrature_points; ++k) {
+      const TractionAtPointData traction_output = CalcTractionAtPoint(
+          data, i, Q_barycentric[k], dissipation, mu_coulomb);
+      Ft_Ac_W_sum += ComputeSpatialTractionAtAcFromTractionAtAq(
+                         data, traction_output.p_WQ,
+                         traction_output.traction_Aq_W) *
+                     weights[k];
+    }
+    return Ft_Ac_W_sum * data.surface.area(i);
+  };
+
+  // Each thread integrates a contiguous range of faces and accumulates the
+  // spatial force on body A at the surface centroid C, face-by-face. The
+  // partial sums are then added in order, so that the result does not depend
+  // on the scheduling of the threads. Threads are only used when each of them
+  // gets enough faces to amortize its cost.
+  const int kMinFacesPerThread = 64;
+  const int num_faces = data.surface.num_faces();
+  const int num_threads =
+      std::max(1, std::min(num_threads_, num_faces / kMinFacesPerThread));
+  std::vector<SpatialForce<T>> F_Ac_W_partial(num_threads,
+                                              SpatialForce<T>::Zero());
+  StaticParallelForIndexLoop(
+      num_threads, 0, num_faces, [&](int thread_num, int i) {
+        F_Ac_W_partial[thread_num] += integrate_face(SurfaceFaceIndex(i));
+      });
+  SpatialForce<T> F_Ac_W = F_Ac_W_partial[0];
+  for (int t = 1; t < num_threads; ++t) {
+    F_Ac_W += F_Ac_W_partial[t];
   }
 
   // The spatial force on body A was accumulated at the surface centroid C. We
@@ -160,6 +193,28 @@ HydroelasticTractionCalculator<T>::CalcTractionAtPoint(
   return CalcTractionAtQHelper(data, e, nhat_W, dissipation, mu_coulomb, p_WQ);
 }
 
+// Method for computing traction at the centroid of a face (triangle or
+// polygon) of the contact surface.
+template <typename T>
+typename HydroelasticTractionCalculator<T>::TractionAtPointData
+HydroelasticTractionCalculator<T>::CalcTractionAtCentroid(
+    const Data& data,
+    SurfaceFaceIndex face_index,
+    double dissipation, double mu_coulomb) const {
+  // Compute the point of contact in the world frame.
+  const Vector3<T> p_WQ = data.surface.centroid(face_index);
+
+  const T e = data.surface.EvaluateE_MNAtCentroid(face_index);
+
+  const Vector3<T> grad_h_W =
+      data.surface.EvaluateGrad_h_MN_WAtCentroid(face_index);
+  const T norm_grad_h_W = grad_h_W.norm();
+  DRAKE_DEMAND(norm_grad_h_W > std::numeric_limits<double>::epsilon() * 10);
+  const Vector3<T> nhat_W = grad_h_W / norm_grad_h_W;
+
+  return CalcTractionAtQHelper(data, e, nhat_W, dissipation, mu_coulomb, p_WQ);
+}
+
 /*
  Helper function for computing the traction at a point, irrespective of whether
  that point is coincident with a vertex or is located at an arbitrary
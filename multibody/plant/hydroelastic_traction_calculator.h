@@ -40,7 +40,7 @@ class HydroelasticTractionCalculator {
         const geometry::ContactSurface<T>* surface_in) :
             X_WA(X_WA_in), X_WB(X_WB_in), V_WA(V_WA_in), V_WB(V_WB_in),
             surface(*surface_in),
-            p_WC(surface_in->mesh_W().centroid()) {
+            p_WC(surface_in->centroid()) {
       DRAKE_DEMAND(surface_in);
     }
 
@@ -75,8 +75,18 @@ class HydroelasticTractionCalculator {
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(HydroelasticTractionCalculator)
 
-  explicit HydroelasticTractionCalculator(double vslip_regularizer = 1e-6)
-      : vslip_regularizer_(vslip_regularizer) {}
+  /**
+   @param vslip_regularizer the regularization parameter used for friction
+          (in m/s), see regularization_scalar().
+   @param num_threads the maximum number of threads used to integrate the
+          tractions over the faces of a single contact surface, see
+          num_threads().
+   */
+  explicit HydroelasticTractionCalculator(double vslip_regularizer = 1e-6,
+                                          int num_threads = 1)
+      : vslip_regularizer_(vslip_regularizer), num_threads_(num_threads) {
+    DRAKE_DEMAND(num_threads >= 1);
+  }
 
   /**
    Gets the regularization parameter used for friction (in m/s). The closer
@@ -85,11 +95,27 @@ class HydroelasticTractionCalculator {
    */
   double regularization_scalar() const { return vslip_regularizer_; }
 
+  /**
+   Gets the maximum number of threads used to integrate the tractions over a
+   contact surface. Surfaces with too few faces to amortize the cost of
+   the threads are integrated on the calling thread. For a given number of
+   threads the results are deterministic, and they agree with those on a
+   single thread to within round-off error.
+   */
+  int num_threads() const { return num_threads_; }
+
   /**
    Applies the hydroelastic model to two geometries defined in `surface`,
    resulting in a pair of spatial forces at the origins of two body frames.
    The body frames, A and B, are those to which `surface.M_id()` and
    `surface.N_id()` are affixed, respectively.
+
+   The tractions are integrated over each triangle of a triangle mesh with a
+   second-order Gaussian quadrature, and over each polygon of a polygonal
+   mesh (see geometry::HydroelasticContactRepresentation) with a single point
+   at its centroid. The latter is exact for the force from a linear pressure
+   field, but not for the moment, whose error decreases with the size of the
+   polygons.
    @param data Relevant kinematic data.
    @param dissipation the nonnegative coefficient (in s/m) for dissipating
           energy along the direction of the surface normals.
@@ -104,6 +130,7 @@ class HydroelasticTractionCalculator {
 
   /**
    Computes reporting information from the hydroelastic model.
+   @pre The contact surface has the triangle representation.
    @param data Relevant kinematic data.
    @param dissipation the nonnegative coefficient (in s/m) for dissipating
           energy along the direction of the surface normals.
@@ -180,6 +207,11 @@ class HydroelasticTractionCalculator {
       const typename geometry::SurfaceMesh<T>::Barycentric& Q_barycentric,
       double dissipation, double mu_coulomb) const;
 
+  TractionAtPointData CalcTractionAtCentroid(
+      const Data& data,
+      geometry::SurfaceFaceIndex face_index,
+      double dissipation, double mu_coulomb) const;
+
   TractionAtPointData CalcTractionAtQHelper(
       const Data& data,
       const T& e, const Vector3<T>& nhat_W,
@@ -191,6 +223,9 @@ class HydroelasticTractionCalculator {
 
   // The parameter (in m/s) for regularizing the Coulomb friction model.
   double vslip_regularizer_{};
+
+  // The maximum number of threads used to integrate over a contact surface.
+  int num_threads_{1};
 };
 
 }  // namespace internal
@@ -3,10 +3,16 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/trace_span.h"
+#include "drake/common/unused.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 
 namespace drake {
 namespace multibody {
@@ -244,6 +250,49 @@ T DirectionChangeLimiter<T>::SolveQuadraticForTheSmallestPositiveRoot(
 
 }  // namespace internal
 
+namespace {
+
+// Solves J Δv = rhs using a sparse factorization of J. A simplicial LDLT is
+// used when J is symmetric and a sparse LU is used otherwise. Exact zeros in J
+// (the off-diagonal blocks between trees not in contact) are pruned so that
+// the fill-in of the factorization is determined by the contact coupling.
+// Returns `false` if the factorization failed.
+bool SolveWithSparseFactorization(
+    bool symmetric, const MatrixX<double>& J, const VectorX<double>& rhs,
+    Eigen::SparseMatrix<double>* J_sparse,
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>* J_ldlt,
+    Eigen::SparseLU<Eigen::SparseMatrix<double>>* J_lu,
+    VectorX<double>* Delta_v) {
+  *J_sparse = J.sparseView();
+  if (symmetric) {
+    J_ldlt->compute(*J_sparse);
+    if (J_ldlt->info() != Eigen::Success) return false;
+    *Delta_v = J_ldlt->solve(rhs);
+  } else {
+    J_lu->compute(*J_sparse);
+    if (J_lu->info() != Eigen::Success) return false;
+    *Delta_v = J_lu->solve(rhs);
+  }
+  return true;
+}
+
+// Sparse factorizations are only supported for T = double. Callers must check
+// SupportsSparseFactorization() first.
+template <typename T>
+bool SolveWithSparseFactorization(
+    bool, const MatrixX<T>&, const VectorX<T>&, Eigen::SparseMatrix<double>*,
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>*,
+    Eigen::SparseLU<Eigen::SparseMatrix<double>>*, VectorX<T>*) {
+  DRAKE_UNREACHABLE();
+}
+
+template <typename T>
+constexpr bool SupportsSparseFactorization() {
+  return std::is_same<T, double>::value;
+}
+
+}  // namespace
+
 template <typename T>
 ImplicitStribeckSolver<T>::ImplicitStribeckSolver(int nv) :
     nv_(nv),
@@ -602,6 +651,7 @@ T ImplicitStribeckSolver<T>::CalcAlpha(
 template <typename T>
 ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     double dt, const VectorX<T>& v_guess) const {
+  DRAKE_TRACE_SPAN("ImplicitStribeckSolver::SolveWithGuess");
   DRAKE_THROW_UNLESS(v_guess.size() == nv_);
 
   // Clear statistics so that we can update them with new ones for this call to
@@ -618,12 +668,32 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
     // M vˢ⁺¹ = p*.
-    v = M.ldlt().solve(p_star);
+    // M is block diagonal for models with several trees, as for instance
+    // scenes with many free bodies. The sparse factorization then costs O(nv)
+    // rather than O(nv³).
+    bool solved = false;
+    if (parameters_.use_sparse_factorization &&
+        SupportsSparseFactorization<T>()) {
+      auto& M_dense = fixed_size_workspace_.mutable_J();
+      M_dense = M;
+      solved = SolveWithSparseFactorization(
+          true /* symmetric */, M_dense, VectorX<T>(p_star),
+          &fixed_size_workspace_.mutable_J_sparse(),
+          &fixed_size_workspace_.mutable_J_sparse_ldlt(),
+          &fixed_size_workspace_.mutable_J_sparse_lu(), &v);
+    }
+    if (!solved) v = M.ldlt().solve(p_star);
     // "One iteration" with exactly "zero" vt_error.
     statistics_.Update(0.0);
     return ImplicitStribeckSolverResult::kSuccess;
   }
 
+  if constexpr (std::is_same<T, AutoDiffXd>::value) {
+    if (parameters_.use_implicit_differentiation) {
+      return SolveWithGuessImplicitDifferentiation(dt, v_guess);
+    }
+  }
+
   // Solver parameters.
   const int max_iterations = parameters_.max_iterations;
   // Tolerance used to monitor the convergence of the contact velocities in both
@@ -649,7 +719,6 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
 
   // Convenient aliases to variable size workspace variables.
   // Note: auto resolve to Eigen::Block (no copies).
-  auto vn = variable_size_workspace_.mutable_vn();
   auto vt = variable_size_workspace_.mutable_vt();
   auto ft = variable_size_workspace_.mutable_ft();
   auto Delta_vn = variable_size_workspace_.mutable_Delta_vn();
@@ -659,7 +728,6 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
   auto fn = variable_size_workspace_.mutable_fn();
-  auto x = variable_size_workspace_.mutable_x();
   auto v_slip = variable_size_workspace_.mutable_v_slip();
 
   // Initialize vt_error to an arbitrary value larger than tolerance so that the
@@ -671,21 +739,8 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   v = v_guess;
 
   for (int iter = 0; iter < max_iterations; ++iter) {
-    // Update normal and tangential velocities.
-    vn = Jn * v;
-    vt = Jt * v;
-
-    if (has_two_way_coupling()) {
-      // Update the penetration for the two-way coupling scheme.
-      const auto& x0 = problem_data_aliases_.x0();
-      x = x0 - dt * vn;
-    }
-
-    CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
-
-
-    // Update v_slip, t_hat, mus and ft as a function of vt and fn.
-    CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
+    // Update vn, vt, fn, Gn, v_slip, t_hat, mus and ft as a function of v.
+    CalcContactForces(v, dt);
 
     // After the previous iteration, we allow updating ft above to have its
     // latest value before leaving.
@@ -713,7 +768,16 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     // is probably best.
     // TODO(amcastro-tri): Consider using a matrix-free iterative method to
     // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
+    if (parameters_.use_sparse_factorization &&
+        SupportsSparseFactorization<T>()) {
+      if (!SolveWithSparseFactorization(
+              !has_two_way_coupling(), J, (-residual).eval(),
+              &fixed_size_workspace_.mutable_J_sparse(),
+              &fixed_size_workspace_.mutable_J_sparse_ldlt(),
+              &fixed_size_workspace_.mutable_J_sparse_lu(), &Delta_v)) {
+        return ImplicitStribeckSolverResult::kLinearSolverFailed;
+      }
+    } else if (has_two_way_coupling()) {
       auto& J_lu = fixed_size_workspace_.mutable_J_lu();
       J_lu.compute(J);  // Update factorization.
       Delta_v = J_lu.solve(-residual);
@@ -759,6 +823,121 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   return ImplicitStribeckSolverResult::kMaxIterationsReached;
 }
 
+template <typename T>
+void ImplicitStribeckSolver<T>::CalcContactForces(
+    const VectorX<T>& v, double dt) const {
+  // Convenient aliases to problem data.
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+
+  // Convenient aliases to variable size workspace variables.
+  auto vn = variable_size_workspace_.mutable_vn();
+  auto vt = variable_size_workspace_.mutable_vt();
+  auto ft = variable_size_workspace_.mutable_ft();
+  auto Gn = variable_size_workspace_.mutable_Gn();
+  auto mu_vt = variable_size_workspace_.mutable_mu();
+  auto t_hat = variable_size_workspace_.mutable_t_hat();
+  auto fn = variable_size_workspace_.mutable_fn();
+  auto x = variable_size_workspace_.mutable_x();
+  auto v_slip = variable_size_workspace_.mutable_v_slip();
+
+  // Update normal and tangential velocities.
+  vn = Jn * v;
+  vt = Jt * v;
+
+  if (has_two_way_coupling()) {
+    // Update the penetration for the two-way coupling scheme.
+    const auto& x0 = problem_data_aliases_.x0();
+    x = x0 - dt * vn;
+  }
+
+  CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
+
+  // Update v_slip, t_hat, mus and ft as a function of vt and fn.
+  CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
+}
+
+template <typename T>
+ImplicitStribeckSolverResult
+ImplicitStribeckSolver<T>::SolveWithGuessImplicitDifferentiation(
+    double dt, const VectorX<T>& v_guess) const {
+  if constexpr (!std::is_same<T, AutoDiffXd>::value) {
+    unused(dt, v_guess);
+    DRAKE_UNREACHABLE();
+  } else {
+    // Values of the problem data.
+    const MatrixX<double> M = math::DiscardGradient(problem_data_aliases_.M());
+    const MatrixX<double> Jn =
+        math::DiscardGradient(problem_data_aliases_.Jn());
+    const MatrixX<double> Jt =
+        math::DiscardGradient(problem_data_aliases_.Jt());
+    const VectorX<double> p_star =
+        math::DiscardGradient(problem_data_aliases_.p_star());
+    const VectorX<double> mu =
+        math::DiscardGradient(problem_data_aliases_.mu());
+    VectorX<double> fn0, x0, stiffness, dissipation;
+
+    // Solve for the values of the generalized velocities.
+    ImplicitStribeckSolver<double> solver(nv_);
+    solver.set_solver_parameters(parameters_);
+    if (has_two_way_coupling()) {
+      x0 = math::DiscardGradient(problem_data_aliases_.x0());
+      stiffness = math::DiscardGradient(problem_data_aliases_.stiffness());
+      dissipation = math::DiscardGradient(problem_data_aliases_.dissipation());
+      solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &x0,
+                                         &stiffness, &dissipation, &mu);
+    } else {
+      fn0 = math::DiscardGradient(problem_data_aliases_.fn());
+      solver.SetOneWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn0, &mu);
+    }
+    const VectorX<double> v_guess_value = math::DiscardGradient(v_guess);
+    const ImplicitStribeckSolverResult info =
+        solver.SolveWithGuess(dt, v_guess_value);
+    statistics_ = solver.get_iteration_statistics();
+    if (info != ImplicitStribeckSolverResult::kSuccess) return info;
+
+    // The workspace of the solver stores the contact forces at the solution,
+    // which we use to compute the Newton-Raphson Jacobian J = ∇ᵥR there.
+    auto& workspace = solver.variable_size_workspace_;
+    auto& dft_dvt = workspace.mutable_dft_dvt();
+    solver.CalcFrictionForcesGradient(
+        workspace.fn(), workspace.mutable_mu(), workspace.mutable_t_hat(),
+        workspace.mutable_v_slip(), &dft_dvt);
+    MatrixX<double> J(nv_, nv_);
+    solver.CalcJacobian(M, Jn, Jt, workspace.mutable_Gn(), dft_dvt,
+                        workspace.mutable_t_hat(), workspace.mutable_mu(), dt,
+                        &J);
+
+    // Derivatives of the residual with respect to the problem data, at the
+    // solution. We evaluate R(v, θ) with v as a constant so that only the
+    // dependence on θ is propagated.
+    const VectorX<double> v_value = solver.get_generalized_velocities();
+    auto& v = fixed_size_workspace_.mutable_v();
+    v = v_value.cast<T>();
+    CalcContactForces(v, dt);
+    const auto fn = variable_size_workspace_.fn();
+    const auto ft = variable_size_workspace_.ft();
+    const VectorX<T> residual =
+        problem_data_aliases_.M() * v - problem_data_aliases_.p_star() -
+        dt * problem_data_aliases_.Jn().transpose() * fn -
+        dt * problem_data_aliases_.Jt().transpose() * ft;
+    const MatrixX<double> dR_dtheta = math::autoDiffToGradientMatrix(residual);
+
+    // Implicit function theorem, R(v(θ), θ) = 0 ⇒ ∂v/∂θ = −J⁻¹ ∂R/∂θ.
+    const Eigen::PartialPivLU<MatrixX<double>> J_lu(J);
+    const MatrixX<double> dv_dtheta = J_lu.solve(-dR_dtheta);
+    math::initializeAutoDiffGivenGradientMatrix(v_value, dv_dtheta, v);
+
+    // Update the contact forces so that they carry the derivatives of v.
+    CalcContactForces(v, dt);
+    auto& tau_f = fixed_size_workspace_.mutable_tau_f();
+    auto& tau = fixed_size_workspace_.mutable_tau();
+    tau_f = problem_data_aliases_.Jt().transpose() * ft;
+    tau = tau_f + problem_data_aliases_.Jn().transpose() * fn;
+    return ImplicitStribeckSolverResult::kSuccess;
+  }
+}
+
 template <typename T>
 T ImplicitStribeckSolver<T>::ModifiedStribeck(const T& s, const T& mu) {
   DRAKE_ASSERT(s >= 0);
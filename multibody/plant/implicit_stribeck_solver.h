@@ -3,6 +3,10 @@
 #include <memory>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
@@ -228,6 +232,30 @@ struct ImplicitStribeckSolverParameters {
   /// solver. We choose a conservative number by default that we found to work
   /// well in most practical problems of interest.
   double theta_max{M_PI / 3.0};
+
+  /// (Advanced) If `true`, the Newton-Raphson Jacobian J is factorized with a
+  /// sparse factorization (a simplicial LDLT for one-way coupled problems and
+  /// a sparse LU for two-way coupled problems) instead of a dense one. For
+  /// models with many trees and few contacts J is mostly block diagonal (M is
+  /// block diagonal per tree and only trees in contact are coupled), and the
+  /// cost of the factorization then scales with the number of coupled degrees
+  /// of freedom rather than with nv³. For small or densely coupled models the
+  /// dense factorization is faster. Only supported for `T = double`; this
+  /// flag is ignored for other scalar types.
+  bool use_sparse_factorization{false};
+
+  /// (Advanced) If `true` and `T = AutoDiffXd`, SolveWithGuess() performs the
+  /// Newton-Raphson iteration on the values of the problem data only (i.e. in
+  /// double) and then obtains the derivatives of the solution with a single
+  /// linear solve by the implicit function theorem. That is, since the
+  /// residual R(v, θ) vanishes at the solution v for problem data θ, then
+  /// ∂v/∂θ = −J⁻¹ ∂R/∂θ, with J = ∇ᵥR the Newton-Raphson Jacobian at the
+  /// solution. The cost of the derivatives then no longer grows with the
+  /// number of iterations and the derivative vectors do not need to be
+  /// propagated through each of them. The derivatives agree with those
+  /// obtained by differentiating through the iteration to within the solver
+  /// tolerance. This flag is ignored for other scalar types.
+  bool use_implicit_differentiation{false};
 };
 
 /// Struct used to store information about the iteration process performed by
@@ -708,6 +736,11 @@ class ImplicitStribeckSolver {
   // Helper class for unit testing.
   friend class ImplicitStribeckSolverTester;
 
+  // Implicit differentiation for T = AutoDiffXd solves the problem with an
+  // ImplicitStribeckSolver<double> and uses its workspace.
+  template <typename U>
+  friend class ImplicitStribeckSolver;
+
   // Contains all the references that define the problem to be solved.
   // These references must remain valid at least from the time they are set with
   // SetOneWayCoupledProblemData() and until SolveWithGuess() returns.
@@ -870,6 +903,14 @@ class ImplicitStribeckSolver {
     VectorX<T>& mutable_tau() { return tau_; }
     Eigen::LDLT<MatrixX<T>>& mutable_J_ldlt() { return J_ldlt_; }
     Eigen::PartialPivLU<MatrixX<T>>& mutable_J_lu() { return J_lu_; }
+    Eigen::SparseMatrix<double>& mutable_J_sparse() { return J_sparse_; }
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>&
+    mutable_J_sparse_ldlt() {
+      return J_sparse_ldlt_;
+    }
+    Eigen::SparseLU<Eigen::SparseMatrix<double>>& mutable_J_sparse_lu() {
+      return J_sparse_lu_;
+    }
 
    private:
     // Vector of generalized velocities.
@@ -890,6 +931,12 @@ class ImplicitStribeckSolver {
     // LU Factorization of the Newton-Raphson Jacobian J. Only used for
     // two-way coupled problems with non-symmetric Jacobian.
     Eigen::PartialPivLU<MatrixX<T>> J_lu_;
+    // Sparse copy of J and its factorizations, only used when
+    // ImplicitStribeckSolverParameters::use_sparse_factorization is true
+    // (and T = double).
+    Eigen::SparseMatrix<double> J_sparse_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> J_sparse_ldlt_;
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> J_sparse_lu_;
   };
 
   // The variables in this workspace can change size with each invocation of
@@ -1054,6 +1101,19 @@ class ImplicitStribeckSolver {
     return problem_data_aliases_.has_two_way_coupling_data();
   }
 
+  // Implementation of SolveWithGuess() for T = AutoDiffXd when
+  // ImplicitStribeckSolverParameters::use_implicit_differentiation is true.
+  // It solves for the values of v with an ImplicitStribeckSolver<double> and
+  // then computes ∂v/∂θ = −J⁻¹ ∂R/∂θ, with J the Newton-Raphson Jacobian at
+  // the solution. Must not be called for other scalar types.
+  ImplicitStribeckSolverResult SolveWithGuessImplicitDifferentiation(
+      double dt, const VectorX<T>& v_guess) const;
+
+  // Updates the contact velocities, the contact forces and the quantities
+  // they depend on in variable_size_workspace_ for the generalized
+  // velocities v.
+  void CalcContactForces(const VectorX<T>& v, double dt) const;
+
   // Helper method to compute, into fn, the normal force at each contact
   // point pair according to the law:
   //   fₙ(x, vₙ) = k(vₙ)₊ x₊
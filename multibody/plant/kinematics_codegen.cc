@@ -0,0 +1,152 @@
+#include "drake/multibody/plant/kinematics_codegen.h"
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+
+using symbolic::Expression;
+
+KinematicsCodeGen::KinematicsCodeGen(const MultibodyPlant<double>& plant)
+    : plant_(plant) {
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+  symbolic_plant_ = MultibodyPlant<double>::ToSymbolic(plant);
+  context_ = symbolic_plant_->CreateDefaultContext();
+  const int nq = plant.num_positions();
+  VectorX<Expression> q(nq);
+  q_.reserve(nq);
+  for (int i = 0; i < nq; ++i) {
+    q_.emplace_back(fmt::format("q{}", i));
+    q(i) = q_.back();
+  }
+  symbolic_plant_->SetPositions(context_.get(), q);
+}
+
+KinematicsCodeGen::~KinematicsCodeGen() = default;
+
+MatrixX<Expression> KinematicsCodeGen::CalcFramePose(
+    const Frame<double>& frame_F) const {
+  const Frame<Expression>& frame_F_symbolic =
+      symbolic_plant_->get_frame(frame_F.index());
+  const math::RigidTransform<Expression> X_WF =
+      symbolic_plant_->CalcRelativeTransform(
+          *context_, symbolic_plant_->world_frame(), frame_F_symbolic);
+  MatrixX<Expression> X(3, 4);
+  X.leftCols<3>() = X_WF.rotation().matrix();
+  X.col(3) = X_WF.translation();
+  return X;
+}
+
+MatrixX<Expression> KinematicsCodeGen::CalcFrameJacobian(
+    const Frame<double>& frame_F) const {
+  const Frame<Expression>& frame_F_symbolic =
+      symbolic_plant_->get_frame(frame_F.index());
+  MatrixX<Expression> Jv_V_WF_W(6, plant_.num_velocities());
+  symbolic_plant_->CalcJacobianSpatialVelocity(
+      *context_, JacobianWrtVariable::kV, frame_F_symbolic,
+      Vector3<Expression>::Zero(), symbolic_plant_->world_frame(),
+      symbolic_plant_->world_frame(), &Jv_V_WF_W);
+  return Jv_V_WF_W;
+}
+
+MatrixX<Expression> KinematicsCodeGen::CalcMassMatrix() const {
+  const int nv = plant_.num_velocities();
+  MatrixX<Expression> M(nv, nv);
+  symbolic_plant_->CalcMassMatrix(*context_, &M);
+  return M;
+}
+
+std::string KinematicsCodeGen::GenerateFramePoseCode(
+    const std::string& function_name, const Frame<double>& frame_F) const {
+  return GenerateCode(function_name, CalcFramePose(frame_F), false);
+}
+
+std::string KinematicsCodeGen::GenerateFrameJacobianCode(
+    const std::string& function_name, const Frame<double>& frame_F,
+    bool sparse) const {
+  return GenerateCode(function_name, CalcFrameJacobian(frame_F), sparse);
+}
+
+std::string KinematicsCodeGen::GenerateMassMatrixCode(
+    const std::string& function_name, bool sparse) const {
+  return GenerateCode(function_name, CalcMassMatrix(), sparse);
+}
+
+std::string KinematicsCodeGen::GenerateCode(
+    const std::string& function_name, const MatrixX<Expression>& M,
+    bool sparse) const {
+  if (!sparse) {
+    return symbolic::CodeGen(function_name, q_, M);
+  }
+  // Only the entries that do not simplify to zero are stored.
+  std::vector<Eigen::Triplet<Expression>> triplets;
+  for (int j = 0; j < M.cols(); ++j) {
+    for (int i = 0; i < M.rows(); ++i) {
+      if (!symbolic::is_zero(M(i, j))) triplets.emplace_back(i, j, M(i, j));
+    }
+  }
+  Eigen::SparseMatrix<Expression> M_sparse(M.rows(), M.cols());
+  M_sparse.setFromTriplets(triplets.begin(), triplets.end());
+  M_sparse.makeCompressed();
+  return symbolic::CodeGen(function_name, q_, M_sparse);
+}
+
+CompiledMatrixFunction::CompiledMatrixFunction(Function function,
+                                               int num_parameters, int rows,
+                                               int cols)
+    : function_(function),
+      num_parameters_(num_parameters),
+      rows_(rows),
+      cols_(cols) {
+  DRAKE_THROW_UNLESS(function != nullptr);
+  DRAKE_THROW_UNLESS(num_parameters >= 0 && rows >= 0 && cols >= 0);
+}
+
+void CompiledMatrixFunction::Eval(const Eigen::Ref<const VectorX<double>>& p,
+                                  MatrixX<double>* m) const {
+  DRAKE_THROW_UNLESS(p.size() == num_parameters_);
+  DRAKE_THROW_UNLESS(m != nullptr);
+  m->resize(rows_, cols_);
+  // The generated code respects Eigen's default column-major storage.
+  const VectorX<double> p_contiguous = p;
+  function_(p_contiguous.data(), m->data());
+}
+
+MatrixX<double> CompiledMatrixFunction::Eval(
+    const Eigen::Ref<const VectorX<double>>& p) const {
+  MatrixX<double> m(rows_, cols_);
+  Eval(p, &m);
+  return m;
+}
+
+CompiledSparseMatrixFunction::CompiledSparseMatrixFunction(
+    Function function, int num_parameters, int rows, int cols, int non_zeros)
+    : function_(function),
+      num_parameters_(num_parameters),
+      rows_(rows),
+      cols_(cols),
+      non_zeros_(non_zeros) {
+  DRAKE_THROW_UNLESS(function != nullptr);
+  DRAKE_THROW_UNLESS(num_parameters >= 0 && rows >= 0 && cols >= 0 &&
+                     non_zeros >= 0);
+}
+
+Eigen::SparseMatrix<double> CompiledSparseMatrixFunction::Eval(
+    const Eigen::Ref<const VectorX<double>>& p) const {
+  DRAKE_THROW_UNLESS(p.size() == num_parameters_);
+  const VectorX<double> p_contiguous = p;
+  std::vector<int> outer_indices(cols_ + 1);
+  std::vector<int> inner_indices(non_zeros_);
+  std::vector<double> values(non_zeros_);
+  function_(p_contiguous.data(), outer_indices.data(), inner_indices.data(),
+            values.data());
+  const Eigen::Map<const Eigen::SparseMatrix<double>> m(
+      rows_, cols_, non_zeros_, outer_indices.data(), inner_indices.data(),
+      values.data());
+  return m;
+}
+
+}  // namespace multibody
+}  // namespace drake
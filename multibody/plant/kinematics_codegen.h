@@ -0,0 +1,179 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+namespace drake {
+namespace multibody {
+
+/// Generates straight-line C99 code for the kinematics and the mass matrix of
+/// a fixed MultibodyPlant, using symbolic::CodeGen().
+///
+/// At construction, the plant is converted to symbolic::Expression and its
+/// generalized positions are set to the variables returned by q(). The
+/// requested quantities are then computed symbolically and emitted as C
+/// functions that take the configuration q as their parameter array `p` (with
+/// `p[i]` corresponding to `q()[i]`). Please refer to the
+/// @ref codegen "Code Generation" documentation for the exact signature of the
+/// generated functions. Once compiled and linked into a program, the generated
+/// functions can be evaluated with CompiledMatrixFunction and
+/// CompiledSparseMatrixFunction.
+///
+/// This is intended for fixed models with a small number of degrees of
+/// freedom (e.g. a robot arm); the size of the symbolic expressions, and
+/// hence of the generated code, grows quickly with the depth of the tree.
+///
+/// @code
+/// MultibodyPlant<double> plant;
+/// Parser(&plant).AddModelFromFile(iiwa_path);
+/// plant.WeldFrames(plant.world_frame(), plant.GetFrameByName("iiwa_link_0"));
+/// plant.Finalize();
+/// KinematicsCodeGen codegen(plant);
+/// const Frame<double>& end_effector = plant.GetFrameByName("iiwa_link_7");
+/// const std::string code =
+///     codegen.GenerateFramePoseCode("X_WE", end_effector) +
+///     codegen.GenerateMassMatrixCode("M");
+/// @endcode
+class KinematicsCodeGen {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(KinematicsCodeGen)
+
+  /// Creates a code generator for `plant`, which must be finalized and must
+  /// support scalar conversion to symbolic::Expression. The plant must
+  /// outlive this object.
+  /// @throws std::exception if `plant` is not finalized.
+  explicit KinematicsCodeGen(const MultibodyPlant<double>& plant);
+
+  ~KinematicsCodeGen();
+
+  /// Returns the symbolic variables for the generalized positions q, in the
+  /// order used for the parameter array of all generated functions.
+  const std::vector<symbolic::Variable>& q() const { return q_; }
+
+  /// Returns the pose X_WF of `frame_F` in the world frame W, as the 3x4
+  /// matrix [R_WF p_WF].
+  MatrixX<symbolic::Expression> CalcFramePose(
+      const Frame<double>& frame_F) const;
+
+  /// Returns the spatial velocity Jacobian Jv_V_WF_W (size 6 x nv) of
+  /// `frame_F` in the world frame W, with respect to the generalized
+  /// velocities v and expressed in W. See
+  /// MultibodyPlant::CalcJacobianSpatialVelocity().
+  MatrixX<symbolic::Expression> CalcFrameJacobian(
+      const Frame<double>& frame_F) const;
+
+  /// Returns the mass matrix M(q). See MultibodyPlant::CalcMassMatrix().
+  MatrixX<symbolic::Expression> CalcMassMatrix() const;
+
+  /// Generates code for CalcFramePose(). The generated function stores the
+  /// 3x4 matrix [R_WF p_WF] in column-major order.
+  std::string GenerateFramePoseCode(const std::string& function_name,
+                                    const Frame<double>& frame_F) const;
+
+  /// Generates code for CalcFrameJacobian(). If `sparse` is `true`, the
+  /// generated function outputs the Jacobian in compressed column storage,
+  /// omitting its structurally zero entries (for instance, the columns of the
+  /// joints that are not ancestors of `frame_F`).
+  std::string GenerateFrameJacobianCode(const std::string& function_name,
+                                        const Frame<double>& frame_F,
+                                        bool sparse = false) const;
+
+  /// Generates code for CalcMassMatrix(). If `sparse` is `true`, the
+  /// generated function outputs the mass matrix in compressed column storage,
+  /// omitting its structurally zero entries (the coupling terms between
+  /// different trees).
+  std::string GenerateMassMatrixCode(const std::string& function_name,
+                                     bool sparse = false) const;
+
+ private:
+  std::string GenerateCode(const std::string& function_name,
+                           const MatrixX<symbolic::Expression>& M,
+                           bool sparse) const;
+
+  const MultibodyPlant<double>& plant_;
+  std::unique_ptr<MultibodyPlant<symbolic::Expression>> symbolic_plant_;
+  std::unique_ptr<systems::Context<symbolic::Expression>> context_;
+  std::vector<symbolic::Variable> q_;
+};
+
+/// Evaluates a dense matrix function generated by KinematicsCodeGen (or by
+/// symbolic::CodeGen()), once the generated code has been compiled and linked
+/// into the program.
+class CompiledMatrixFunction {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledMatrixFunction)
+
+  /// The signature of the generated function.
+  using Function = void (*)(const double* p, double* m);
+
+  /// Wraps `function`, whose parameter array has `num_parameters` entries and
+  /// whose result is a `rows x cols` matrix (as reported by the generated
+  /// `<function_name>_meta()`).
+  CompiledMatrixFunction(Function function, int num_parameters, int rows,
+                         int cols);
+
+  int num_parameters() const { return num_parameters_; }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+
+  /// Evaluates the function at `p` into `m`, which is resized if needed.
+  /// @throws std::exception if `p` does not have num_parameters() entries or
+  /// if `m` is nullptr.
+  void Eval(const Eigen::Ref<const VectorX<double>>& p,
+            MatrixX<double>* m) const;
+
+  /// Evaluates the function at `p`.
+  MatrixX<double> Eval(const Eigen::Ref<const VectorX<double>>& p) const;
+
+ private:
+  Function function_{};
+  int num_parameters_{};
+  int rows_{};
+  int cols_{};
+};
+
+/// Evaluates a sparse matrix function generated by KinematicsCodeGen (or by
+/// symbolic::CodeGen()), once the generated code has been compiled and linked
+/// into the program.
+class CompiledSparseMatrixFunction {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledSparseMatrixFunction)
+
+  /// The signature of the generated function.
+  using Function = void (*)(const double* p, int* outer_indices,
+                            int* inner_indices, double* values);
+
+  /// Wraps `function`, whose parameter array has `num_parameters` entries and
+  /// whose result is a `rows x cols` matrix with `non_zeros` stored entries
+  /// (as reported by the generated `<function_name>_meta()`).
+  CompiledSparseMatrixFunction(Function function, int num_parameters,
+                               int rows, int cols, int non_zeros);
+
+  int num_parameters() const { return num_parameters_; }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+  int non_zeros() const { return non_zeros_; }
+
+  /// Evaluates the function at `p`.
+  /// @throws std::exception if `p` does not have num_parameters() entries.
+  Eigen::SparseMatrix<double> Eval(
+      const Eigen::Ref<const VectorX<double>>& p) const;
+
+ private:
+  Function function_{};
+  int num_parameters_{};
+  int rows_{};
+  int cols_{};
+  int non_zeros_{};
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -2,13 +2,17 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 #include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/geometry/frame_kinematics_vector.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
@@ -547,6 +551,62 @@ void MultibodyPlant<T>::SetFreeBodyPoseInAnchoredFrame(
   SetFreeBodyPoseInWorldFrame(context, body, X_WB);
 }
 
+template <typename T>
+void MultibodyPlant<T>::LockJoint(systems::Context<T>* context,
+                                  const Joint<T>& joint) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(&get_joint(joint.index()) == &joint);
+  if (!is_discrete()) {
+    throw std::logic_error(
+        "Joint '" + joint.name() + "' cannot be locked since joint locking is "
+        "only supported for plants modeled as discrete systems.");
+  }
+  context->get_mutable_abstract_parameter(locked_joints_parameter_)
+      .template get_mutable_value<std::vector<bool>>()[joint.index()] = true;
+  GetMutableVelocities(context)
+      .segment(joint.velocity_start(), joint.num_velocities())
+      .setZero();
+}
+
+template <typename T>
+void MultibodyPlant<T>::UnlockJoint(systems::Context<T>* context,
+                                    const Joint<T>& joint) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(&get_joint(joint.index()) == &joint);
+  if (!is_joint_locked(*context, joint)) return;
+  context->get_mutable_abstract_parameter(locked_joints_parameter_)
+      .template get_mutable_value<std::vector<bool>>()[joint.index()] = false;
+}
+
+template <typename T>
+bool MultibodyPlant<T>::is_joint_locked(const systems::Context<T>& context,
+                                        const Joint<T>& joint) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(&get_joint(joint.index()) == &joint);
+  return context.get_abstract_parameter(locked_joints_parameter_)
+      .template get_value<std::vector<bool>>()[joint.index()];
+}
+
+template <typename T>
+std::vector<int> MultibodyPlant<T>::CalcLockedVelocities(
+    const systems::Context<T>& context) const {
+  const std::vector<bool>& locked =
+      context.get_abstract_parameter(locked_joints_parameter_)
+          .template get_value<std::vector<bool>>();
+  std::vector<int> locked_velocities;
+  for (JointIndex joint_index(0); joint_index < num_joints(); ++joint_index) {
+    if (!locked[joint_index]) continue;
+    const Joint<T>& joint = get_joint(joint_index);
+    for (int k = 0; k < joint.num_velocities(); ++k) {
+      locked_velocities.push_back(joint.velocity_start() + k);
+    }
+  }
+  std::sort(locked_velocities.begin(), locked_velocities.end());
+  return locked_velocities;
+}
+
 template<typename T>
 void MultibodyPlant<T>::CalcSpatialAccelerationsFromVdot(
     const systems::Context<T>& context,
@@ -571,6 +631,23 @@ void MultibodyPlant<T>::CalcSpatialAccelerationsFromVdot(
   }
 }
 
+template <typename T>
+MatrixX<T> MultibodyPlant<T>::CalcStackedFramesJacobian(
+    const systems::Context<T>& context,
+    const std::vector<const Frame<T>*>& frames) const {
+  const int num_frames = frames.size();
+  MatrixX<T> J_task(6 * num_frames, num_velocities());
+  MatrixX<T> Jv_WFi(6, num_velocities());
+  for (int i = 0; i < num_frames; ++i) {
+    DRAKE_THROW_UNLESS(frames[i] != nullptr);
+    CalcJacobianSpatialVelocity(context, JacobianWrtVariable::kV, *frames[i],
+                                Vector3<T>::Zero(), world_frame(),
+                                world_frame(), &Jv_WFi);
+    J_task.template middleRows<6>(6 * i) = Jv_WFi;
+  }
+  return J_task;
+}
+
 template<typename T>
 void MultibodyPlant<T>::CalcForceElementsContribution(
       const systems::Context<T>& context,
@@ -704,6 +781,8 @@ void MultibodyPlant<T>::FinalizePlantOnly() {
     solver_parameters.stiction_tolerance =
         stribeck_model_.stiction_tolerance();
     implicit_stribeck_solver_->set_solver_parameters(solver_parameters);
+    convex_contact_solver_ =
+        std::make_unique<ConvexContactSolver<T>>(num_velocities());
   } else {
     // We only build hydroelastics if the user requested it AND if geometry was
     // registered with a SceneGraph. Since by default bodies are rigid, we use
@@ -859,7 +938,8 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const systems::Context<T>& context,
     const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs_set,
     MatrixX<T>* Jn_ptr, MatrixX<T>* Jt_ptr,
-    std::vector<RotationMatrix<T>>* R_WC_set) const {
+    std::vector<RotationMatrix<T>>* R_WC_set,
+    std::vector<internal::ContactJacobianBlock<T>>* blocks) const {
   DRAKE_DEMAND(Jn_ptr != nullptr);
   DRAKE_DEMAND(Jt_ptr != nullptr);
 
@@ -867,20 +947,34 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
 
   // Jn is defined such that vn = Jn * v, with vn of size nc.
   auto& Jn = *Jn_ptr;
-  Jn.resize(num_contacts, num_velocities());
+  Jn.setZero(num_contacts, num_velocities());
 
   // Jt is defined such that vt = Jt * v, with vt of size 2nc.
   auto& Jt = *Jt_ptr;
-  Jt.resize(2 * num_contacts, num_velocities());
-
-  if (R_WC_set != nullptr) R_WC_set->clear();
-
-  // Quick no-op exit. Notice we did resize Jn, Jt and R_WC_set to be zero
-  // sized.
+  Jt.setZero(2 * num_contacts, num_velocities());
+
+  // The per-contact results are written by index, so that each contact can be
+  // computed independently.
+  std::vector<RotationMatrix<T>> R_WC_local;
+  std::vector<RotationMatrix<T>>& R_WC_all =
+      R_WC_set != nullptr ? *R_WC_set : R_WC_local;
+  R_WC_all.resize(num_contacts);
+  std::vector<internal::ContactJacobianBlock<T>> blocks_local;
+  std::vector<internal::ContactJacobianBlock<T>>& blocks_all =
+      blocks != nullptr ? *blocks : blocks_local;
+  blocks_all.resize(num_contacts);
+
+  // Quick no-op exit. Notice we did resize Jn, Jt, R_WC_set and blocks to be
+  // zero sized.
   if (num_contacts == 0) return;
 
+  // Cache entries are not safe to evaluate from multiple threads. Evaluate
+  // here those used per contact so that the loop below only reads them.
+  this->EvalPositionKinematics(context);
+  this->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
   const Frame<T>& frame_W = internal_tree().world_frame();
-  for (int icontact = 0; icontact < num_contacts; ++icontact) {
+  auto calc_contact_jacobians = [&](int, int icontact) {
     const auto& point_pair = point_pairs_set[icontact];
 
     const GeometryId geometryA_id = point_pair.id_A;
@@ -902,64 +996,85 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     // in the limit to rigid contact, Ac = Bc.
 
     // Geometric Jacobian for the velocity of the contact point C as moving with
-    // body A, s.t.: v_WAc = Jv_WAc * v
-    // where v is the vector of generalized velocities.
-    Matrix3X<T> Jv_WAc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyA.body_frame(),
-                                                      frame_W,
-                                                      p_WCa,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WAc);
+    // body A, s.t.: v_WAc = Jv_WAc * v(velocity_indices_A)
+    // where v is the vector of generalized velocities. Only the velocities in
+    // the kinematic path from the world to A are included.
+    const Vector3<T> p_ACa =
+        EvalBodyPoseInWorld(context, bodyA).inverse() * p_WCa;
+    std::vector<int> velocity_indices_A;
+    MatrixX<T> Jv_V_WAc;
+    internal_tree().CalcJacobianSpatialVelocityOnKinematicPath(
+        context, bodyA.body_frame(), p_ACa, frame_W, frame_W,
+        &velocity_indices_A, &Jv_V_WAc);
 
     // Geometric Jacobian for the velocity of the contact point C as moving with
-    // body B, s.t.: v_WBc = Jv_WBc * v.
-    Matrix3X<T> Jv_WBc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyB.body_frame(),
-                                                      frame_W,
-                                                      p_WCb,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WBc);
+    // body B, s.t.: v_WBc = Jv_WBc * v(velocity_indices_B).
+    const Vector3<T> p_BCb =
+        EvalBodyPoseInWorld(context, bodyB).inverse() * p_WCb;
+    std::vector<int> velocity_indices_B;
+    MatrixX<T> Jv_V_WBc;
+    internal_tree().CalcJacobianSpatialVelocityOnKinematicPath(
+        context, bodyB.body_frame(), p_BCb, frame_W, frame_W,
+        &velocity_indices_B, &Jv_V_WBc);
 
-    // Computation of the normal separation velocities Jacobian Jn:
-    //
     // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // From where the separation velocity is computed as
-    //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
-    // where the negative sign stems from the sign convention for vn and xdot.
-    // This can be written in terms of the Jacobians as
-    //   vn = -nhat_BA_Wᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jn.row(icontact) = nhat_BA_W.transpose() * (Jv_WAc - Jv_WBc);
+    //   v_AcBc_W = v_WBc - v_WAc,
+    // which only depends on the union of the velocities in both paths. Merge
+    // the two sorted lists of indices, accumulating the translational rows of
+    // the Jacobians in the corresponding columns.
+    internal::ContactJacobianBlock<T>& block = blocks_all[icontact];
+    std::vector<int>& velocity_indices = block.velocity_indices;
+    velocity_indices.clear();
+    std::set_union(velocity_indices_A.begin(), velocity_indices_A.end(),
+                   velocity_indices_B.begin(), velocity_indices_B.end(),
+                   std::back_inserter(velocity_indices));
+    const int num_block_velocities = velocity_indices.size();
+    Matrix3X<T> Jv_AcBc_W = Matrix3X<T>::Zero(3, num_block_velocities);
+    int column = 0;
+    for (int i = 0; i < static_cast<int>(velocity_indices_A.size()); ++i) {
+      while (velocity_indices[column] != velocity_indices_A[i]) ++column;
+      Jv_AcBc_W.col(column) -= Jv_V_WAc.template block<3, 1>(3, i);
+    }
+    column = 0;
+    for (int i = 0; i < static_cast<int>(velocity_indices_B.size()); ++i) {
+      while (velocity_indices[column] != velocity_indices_B[i]) ++column;
+      Jv_AcBc_W.col(column) += Jv_V_WBc.template block<3, 1>(3, i);
+    }
 
-    // Computation of the tangential velocities Jacobian Jt:
-    //
     // Compute the orientation of a contact frame C at the contact point such
     // that the z-axis Cz equals to nhat_BA_W. The tangent vectors are
     // arbitrary, with the only requirement being that they form a valid right
     // handed basis with nhat_BA.
     const RotationMatrix<T> R_WC(math::ComputeBasisFromAxis(2, nhat_BA_W));
-    if (R_WC_set != nullptr) {
-      R_WC_set->push_back(R_WC);
-    }
+    R_WC_all[icontact] = R_WC;
 
-    const Vector3<T> that1_W = R_WC.matrix().col(0);  // that1 = Cx.
-    const Vector3<T> that2_W = R_WC.matrix().col(1);  // that2 = Cy.
+    // The first two components of v_AcBc_C correspond to the tangential
+    // velocities in a plane normal to nhat_BA, and the third one to the
+    // velocity along Cz = nhat_BA.
+    block.J_AcBc_C = R_WC.matrix().transpose() * Jv_AcBc_W;
 
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // The first two components of this velocity in C corresponds to the
-    // tangential velocities in a plane normal to nhat_BA.
-    //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jt.row(2 * icontact)     = that1_W.transpose() * (Jv_WBc - Jv_WAc);
-    Jt.row(2 * icontact + 1) = that2_W.transpose() * (Jv_WBc - Jv_WAc);
-  }
+    // Computation of the normal separation velocities Jacobian Jn:
+    //
+    // The separation velocity is computed as
+    //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
+    // where the negative sign stems from the sign convention for vn and xdot.
+    // Since Cz = nhat_BA, vn is minus the z component of v_AcBc_C.
+    //
+    // Computation of the tangential velocities Jacobian Jt:
+    //   vx_AcBc_C = that1⋅v_AcBc, that1 = Cx.
+    //   vy_AcBc_C = that2⋅v_AcBc, that2 = Cy.
+    //
+    // Each contact writes to its own rows of Jn and Jt.
+    for (int k = 0; k < num_block_velocities; ++k) {
+      const int iv = velocity_indices[k];
+      Jt(2 * icontact, iv) = block.J_AcBc_C(0, k);
+      Jt(2 * icontact + 1, iv) = block.J_AcBc_C(1, k);
+      Jn(icontact, iv) = -block.J_AcBc_C(2, k);
+    }
+  };
+  StaticParallelForIndexLoop(
+      std::min(contact_num_threads_, num_contacts), 0, num_contacts,
+      calc_contact_jacobians);
 }
 
 template<typename T>
@@ -1101,14 +1216,6 @@ MultibodyPlant<T>::CalcCombinedFrictionCoefficients(
   return combined_frictions;
 }
 
-template<typename T>
-void MultibodyPlant<T>::CopyContactResultsOutput(
-    const systems::Context<T>& context,
-    ContactResults<T>* contact_results) const {
-  DRAKE_DEMAND(contact_results != nullptr);
-  *contact_results = EvalContactResults(context);
-}
-
 template <typename T>
 void MultibodyPlant<T>::CalcContactResultsContinuous(
     const systems::Context<T>& context,
@@ -1375,10 +1482,26 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
   const std::vector<ContactSurface<T>> all_surfaces =
       hydroelastics_engine_.ComputeContactSurfaces(query_object);
 
+  // With many surfaces, distribute them among the threads, each integrating
+  // its surfaces serially. Otherwise, process the surfaces one after another
+  // and distribute the triangles of each of them among the threads.
+  const int num_surfaces = all_surfaces.size();
+  const int num_surface_threads =
+      num_surfaces >= contact_num_threads_ ? contact_num_threads_ : 1;
   internal::HydroelasticTractionCalculator<T> traction_calculator(
-      stribeck_model_.stiction_tolerance());
-
-  for (const ContactSurface<T>& surface : all_surfaces) {
+      stribeck_model_.stiction_tolerance(),
+      num_surface_threads == 1 ? contact_num_threads_ : 1);
+
+  // The kinematics of the bodies are evaluated here, since cache entries are
+  // not safe to evaluate from multiple threads.
+  this->EvalPositionKinematics(context);
+  this->EvalVelocityKinematics(context);
+
+  // The spatial forces on bodies A and B for each surface.
+  std::vector<SpatialForce<T>> F_Ao_W_per_surface(num_surfaces);
+  std::vector<SpatialForce<T>> F_Bo_W_per_surface(num_surfaces);
+  auto calc_surface_forces = [&](int, int isurface) {
+    const ContactSurface<T>& surface = all_surfaces[isurface];
     const GeometryId geometryM_id = surface.id_M();
     const GeometryId geometryN_id = surface.id_N();
     const int collision_indexM =
@@ -1418,16 +1541,28 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
         geometryM_id, geometryN_id);
 
     // Integrate the hydroelastic traction field over the contact surface.
-    SpatialForce<T> F_Ao_W, F_Bo_W;
     traction_calculator.ComputeSpatialForcesAtBodyOriginsFromHydroelasticModel(
-        data, dissipation, static_friction, &F_Ao_W, &F_Bo_W);
+        data, dissipation, static_friction, &F_Ao_W_per_surface[isurface],
+        &F_Bo_W_per_surface[isurface]);
+  };
+  StaticParallelForIndexLoop(num_surface_threads, 0, num_surfaces,
+                             calc_surface_forces);
+
+  // Accumulate the forces in the order of the surfaces, so that the result
+  // does not depend on the number of threads.
+  for (int isurface = 0; isurface < num_surfaces; ++isurface) {
+    const ContactSurface<T>& surface = all_surfaces[isurface];
+    const BodyIndex bodyA_index = geometry_id_to_body_index_.at(surface.id_M());
+    const BodyIndex bodyB_index = geometry_id_to_body_index_.at(surface.id_N());
 
     if (bodyA_index != world_index()) {
-      F_BBo_W_array->at(bodyA.node_index()) += F_Ao_W;
+      const Body<T>& bodyA = internal_tree().get_body(bodyA_index);
+      F_BBo_W_array->at(bodyA.node_index()) += F_Ao_W_per_surface[isurface];
     }
 
     if (bodyB_index != world_index()) {
-      F_BBo_W_array->at(bodyB.node_index()) += F_Bo_W;
+      const Body<T>& bodyB = internal_tree().get_body(bodyB_index);
+      F_BBo_W_array->at(bodyB.node_index()) += F_Bo_W_per_surface[isurface];
     }
   }
 }
@@ -1587,7 +1722,7 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
 
 template<typename T>
 ImplicitStribeckSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
-    int num_substeps,
+    ImplicitStribeckSolver<T>* solver, int num_substeps,
     const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
     const VectorX<T>& minus_tau,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
@@ -1610,29 +1745,234 @@ ImplicitStribeckSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     VectorX<T> p_star_substep = M0 * v0_substep - dt_substep * minus_tau;
 
     // Update the data.
-    implicit_stribeck_solver_->SetTwoWayCoupledProblemData(
+    solver->SetTwoWayCoupledProblemData(
         &M0, &Jn, &Jt,
         &p_star_substep, &phi0_substep,
         &stiffness, &damping, &mu);
 
-    info = implicit_stribeck_solver_->SolveWithGuess(dt_substep,
-                                                     v0_substep);
+    info = solver->SolveWithGuess(dt_substep, v0_substep);
 
     // Break the sub-stepping loop on failure and return the info result.
     if (info != ImplicitStribeckSolverResult::kSuccess) break;
 
     // Update previous time step to new solution.
-    v0_substep = implicit_stribeck_solver_->get_generalized_velocities();
+    v0_substep = solver->get_generalized_velocities();
 
     // Update penetration distance consistently with the solver update.
-    const auto vn_substep =
-        implicit_stribeck_solver_->get_normal_velocities();
+    const auto vn_substep = solver->get_normal_velocities();
     phi0_substep = phi0_substep - dt_substep * vn_substep;
   }
 
   return info;
 }
 
+template <typename T>
+std::vector<typename MultibodyPlant<T>::ContactIsland>
+MultibodyPlant<T>::CalcContactIslands(
+    const std::vector<PenetrationAsPointPair<T>>& point_pairs) const {
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  const int nb = num_bodies();
+  const int nv = num_velocities();
+
+  // For each body that is not anchored, the outermost body of its branch that
+  // is not anchored. All bodies in a branch are coupled through the mass
+  // matrix while different branches are not. Body nodes are sorted by level
+  // and therefore a parent is always visited before its children.
+  std::vector<int> base_body(nb, -1);
+  for (internal::BodyNodeIndex node_index(1);
+       node_index < topology.get_num_body_nodes(); ++node_index) {
+    const internal::BodyNodeTopology& node =
+        topology.get_body_node(node_index);
+    if (topology.IsBodyAnchored(node.body)) continue;
+    base_body[node.body] = base_body[node.parent_body] >= 0
+                               ? base_body[node.parent_body]
+                               : static_cast<int>(node.body);
+  }
+
+  // Union-find over the base bodies, joined by the contact pairs.
+  std::vector<int> parent(nb);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int b) {
+    while (parent[b] != b) {
+      parent[b] = parent[parent[b]];
+      b = parent[b];
+    }
+    return b;
+  };
+  const int num_contacts = point_pairs.size();
+  std::vector<int> contact_root(num_contacts);
+  for (int icontact = 0; icontact < num_contacts; ++icontact) {
+    const auto& pair = point_pairs[icontact];
+    const int baseA = base_body[geometry_id_to_body_index_.at(pair.id_A)];
+    const int baseB = base_body[geometry_id_to_body_index_.at(pair.id_B)];
+    // A contact between anchored bodies belongs to no island.
+    if (baseA < 0 && baseB < 0) return {};
+    if (baseA >= 0 && baseB >= 0) {
+      parent[find_root(baseA)] = find_root(baseB);
+    }
+    contact_root[icontact] = baseA >= 0 ? baseA : baseB;
+  }
+
+  // Number the islands in order of their first generalized velocity so that
+  // the partition does not depend on the order of the contact pairs.
+  std::vector<int> root_of_velocity(nv, -1);
+  for (internal::BodyNodeIndex node_index(1);
+       node_index < topology.get_num_body_nodes(); ++node_index) {
+    const internal::BodyNodeTopology& node =
+        topology.get_body_node(node_index);
+    for (int k = 0; k < node.num_mobilizer_velocities; ++k) {
+      root_of_velocity[node.mobilizer_velocities_start_in_v + k] =
+          find_root(base_body[node.body]);
+    }
+  }
+  std::vector<int> island_of_root(nb, -1);
+  std::vector<ContactIsland> islands;
+  for (int iv = 0; iv < nv; ++iv) {
+    int& island = island_of_root[root_of_velocity[iv]];
+    if (island < 0) {
+      island = islands.size();
+      islands.emplace_back();
+    }
+    islands[island].velocities.push_back(iv);
+  }
+  if (islands.size() < 2) return {};
+  for (int icontact = 0; icontact < num_contacts; ++icontact) {
+    const int island = island_of_root[find_root(contact_root[icontact])];
+    islands[island].contacts.push_back(icontact);
+  }
+  return islands;
+}
+
+template <typename T>
+void MultibodyPlant<T>::SolveContactIslands(
+    const std::vector<ContactIsland>& islands,
+    const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
+    const VectorX<T>& minus_tau,
+    const VectorX<T>& stiffness, const VectorX<T>& damping,
+    const VectorX<T>& mu,
+    const VectorX<T>& v0, const VectorX<T>& phi0,
+    internal::ImplicitStribeckSolverResults<T>* results) const {
+  const int num_islands = islands.size();
+  const int num_contacts = phi0.size();
+  const ImplicitStribeckSolverParameters params =
+      implicit_stribeck_solver_->get_solver_parameters();
+
+  // Velocities and contacts in no island (see CalcImplicitStribeckResults())
+  // are left at zero.
+  results->v_next.setZero(num_velocities());
+  results->tau_contact.setZero(num_velocities());
+  results->fn.setZero(num_contacts);
+  results->vn.setZero(num_contacts);
+  results->ft.setZero(2 * num_contacts);
+  results->vt.setZero(2 * num_contacts);
+
+  // All velocities might be locked, leaving nothing to solve for.
+  if (num_islands == 0) return;
+
+  // Each island only writes to its own entries of the results.
+  std::vector<int> converged(num_islands, 0);
+  auto solve_island = [&](int, int island_index) {
+    const std::vector<int>& iv = islands[island_index].velocities;
+    const std::vector<int>& ic = islands[island_index].contacts;
+    const int nv_island = iv.size();
+    const int nc_island = ic.size();
+
+    // Gather the island's problem data.
+    MatrixX<T> M0_island(nv_island, nv_island);
+    MatrixX<T> Jn_island(nc_island, nv_island);
+    MatrixX<T> Jt_island(2 * nc_island, nv_island);
+    VectorX<T> minus_tau_island(nv_island);
+    VectorX<T> v0_island(nv_island);
+    for (int j = 0; j < nv_island; ++j) {
+      for (int i = 0; i < nv_island; ++i) M0_island(i, j) = M0(iv[i], iv[j]);
+      for (int k = 0; k < nc_island; ++k) {
+        Jn_island(k, j) = Jn(ic[k], iv[j]);
+        Jt_island(2 * k, j) = Jt(2 * ic[k], iv[j]);
+        Jt_island(2 * k + 1, j) = Jt(2 * ic[k] + 1, iv[j]);
+      }
+      minus_tau_island(j) = minus_tau(iv[j]);
+      v0_island(j) = v0(iv[j]);
+    }
+    VectorX<T> stiffness_island(nc_island);
+    VectorX<T> damping_island(nc_island);
+    VectorX<T> mu_island(nc_island);
+    VectorX<T> phi0_island(nc_island);
+    for (int k = 0; k < nc_island; ++k) {
+      stiffness_island(k) = stiffness(ic[k]);
+      damping_island(k) = damping(ic[k]);
+      mu_island(k) = mu(ic[k]);
+      phi0_island(k) = phi0(ic[k]);
+    }
+
+    // Scatters the island's solution. Both solvers provide the same
+    // accessors.
+    auto scatter_solution = [&](const auto& solver) {
+      const auto& v_next = solver.get_generalized_velocities();
+      const auto& tau_contact = solver.get_generalized_contact_forces();
+      for (int j = 0; j < nv_island; ++j) {
+        results->v_next(iv[j]) = v_next(j);
+        results->tau_contact(iv[j]) = tau_contact(j);
+      }
+      const auto& fn = solver.get_normal_forces();
+      const auto& vn = solver.get_normal_velocities();
+      const auto& ft = solver.get_friction_forces();
+      const auto& vt = solver.get_tangential_velocities();
+      for (int k = 0; k < nc_island; ++k) {
+        results->fn(ic[k]) = fn(k);
+        results->vn(ic[k]) = vn(k);
+        for (int d = 0; d < 2; ++d) {
+          results->ft(2 * ic[k] + d) = ft(2 * k + d);
+          results->vt(2 * ic[k] + d) = vt(2 * k + d);
+        }
+      }
+      converged[island_index] = 1;
+    };
+
+    if (discrete_contact_solver_ == DiscreteContactSolver::kConvex) {
+      const VectorX<T> p_star_island =
+          M0_island * v0_island - time_step_ * minus_tau_island;
+      ConvexContactSolver<T> solver(nv_island);
+      solver.set_solver_parameters(
+          convex_contact_solver_->get_solver_parameters());
+      solver.SetProblemData(&M0_island, &Jn_island, &Jt_island,
+                            &p_star_island, &phi0_island, &stiffness_island,
+                            &damping_island, &mu_island);
+      if (solver.SolveWithGuess(time_step_, v0_island) ==
+          ConvexContactSolverResult::kSuccess) {
+        scatter_solution(solver);
+      }
+      return;
+    }
+
+    // Same sub-stepping strategy as for the monolithic problem.
+    ImplicitStribeckSolver<T> solver(nv_island);
+    solver.set_solver_parameters(params);
+    const int kNumMaxSubTimeSteps = 20;
+    ImplicitStribeckSolverResult info{
+        ImplicitStribeckSolverResult::kMaxIterationsReached};
+    int num_substeps = 0;
+    do {
+      ++num_substeps;
+      info = SolveUsingSubStepping(
+          &solver, num_substeps, M0_island, Jn_island, Jt_island,
+          minus_tau_island, stiffness_island, damping_island, mu_island,
+          v0_island, phi0_island);
+    } while (info != ImplicitStribeckSolverResult::kSuccess &&
+             num_substeps < kNumMaxSubTimeSteps);
+    if (info == ImplicitStribeckSolverResult::kSuccess) {
+      scatter_solution(solver);
+    }
+  };
+  StaticParallelForIndexLoop(
+      std::min(contact_num_threads_, num_islands), 0, num_islands,
+      solve_island);
+
+  for (int island_converged : converged) {
+    DRAKE_DEMAND(island_converged == 1);
+  }
+}
+
 template <typename T>
 void MultibodyPlant<T>::CalcImplicitStribeckResults(
     const drake::systems::Context<T>& context0,
@@ -1653,10 +1993,8 @@ void MultibodyPlant<T>::CalcImplicitStribeckResults(
   VectorX<T> q0 = x0.topRows(nq);
   VectorX<T> v0 = x0.bottomRows(nv);
 
-  // Mass matrix and its factorization.
-  MatrixX<T> M0(nv, nv);
-  internal_tree().CalcMassMatrixViaInverseDynamics(context0, &M0);
-  auto M0_ldlt = M0.ldlt();
+  // Mass matrix.
+  const MatrixX<T>& M0 = EvalMassMatrix(context0);
 
   // Forces at the previous time step.
   MultibodyForces<T> forces0(internal_tree());
@@ -1745,8 +2083,67 @@ void MultibodyPlant<T>::CalcImplicitStribeckResults(
   // A nicely converged NR iteration should not take more than 20 iterations.
   // Otherwise we attempt a smaller time step.
   params.max_iterations = 20;
+  params.use_implicit_differentiation = use_implicit_contact_differentiation_;
   implicit_stribeck_solver_->set_solver_parameters(params);
 
+  // Independent contact islands, if requested, are solved separately.
+  std::vector<ContactIsland> islands;
+  if (use_contact_islands_) islands = CalcContactIslands(point_pairs0);
+
+  // The velocities of locked joints are zero, and therefore they are removed
+  // from the problem, as well as the islands left without velocities. Their
+  // contacts then have zero results, as if between anchored bodies.
+  const std::vector<int> locked_velocities = CalcLockedVelocities(context0);
+  if (!locked_velocities.empty()) {
+    if (islands.empty()) {
+      islands.resize(1);
+      islands[0].velocities.resize(nv);
+      std::iota(islands[0].velocities.begin(), islands[0].velocities.end(), 0);
+      islands[0].contacts.resize(num_contacts);
+      std::iota(islands[0].contacts.begin(), islands[0].contacts.end(), 0);
+    }
+    for (ContactIsland& island : islands) {
+      std::vector<int> unlocked_velocities;
+      std::set_difference(
+          island.velocities.begin(), island.velocities.end(),
+          locked_velocities.begin(), locked_velocities.end(),
+          std::back_inserter(unlocked_velocities));
+      island.velocities = std::move(unlocked_velocities);
+    }
+    islands.erase(std::remove_if(islands.begin(), islands.end(),
+                                 [](const ContactIsland& island) {
+                                   return island.velocities.empty();
+                                 }),
+                  islands.end());
+  }
+
+  if (!islands.empty() || !locked_velocities.empty()) {
+    SolveContactIslands(islands, M0, contact_jacobians.Jn,
+                        contact_jacobians.Jt, minus_tau, stiffness, damping,
+                        mu, v0, phi0, results);
+    return;
+  }
+
+  // The convex solver converges from any initial guess, hence it does not need
+  // sub-stepping. It is warm started with the previous step velocities.
+  if (discrete_contact_solver_ == DiscreteContactSolver::kConvex) {
+    const VectorX<T> p_star = M0 * v0 - time_step_ * minus_tau;
+    convex_contact_solver_->SetProblemData(
+        &M0, &contact_jacobians.Jn, &contact_jacobians.Jt, &p_star, &phi0,
+        &stiffness, &damping, &mu);
+    const ConvexContactSolverResult convex_info =
+        convex_contact_solver_->SolveWithGuess(time_step_, v0);
+    DRAKE_DEMAND(convex_info == ConvexContactSolverResult::kSuccess);
+    results->v_next = convex_contact_solver_->get_generalized_velocities();
+    results->fn = convex_contact_solver_->get_normal_forces();
+    results->ft = convex_contact_solver_->get_friction_forces();
+    results->vn = convex_contact_solver_->get_normal_velocities();
+    results->vt = convex_contact_solver_->get_tangential_velocities();
+    results->tau_contact =
+        convex_contact_solver_->get_generalized_contact_forces();
+    return;
+  }
+
   // We attempt to compute the update during the time interval dt using a
   // progressively larger number of sub-steps (i.e each using a smaller time
   // step than in the previous attempt). This loop breaks on the first
@@ -1758,7 +2155,8 @@ void MultibodyPlant<T>::CalcImplicitStribeckResults(
   int num_substeps = 0;
   do {
     ++num_substeps;
-    info = SolveUsingSubStepping(num_substeps, M0, contact_jacobians.Jn,
+    info = SolveUsingSubStepping(implicit_stribeck_solver_.get(),
+                                 num_substeps, M0, contact_jacobians.Jn,
                                  contact_jacobians.Jt, minus_tau, stiffness,
                                  damping, mu, v0, phi0);
   } while (info != ImplicitStribeckSolverResult::kSuccess &&
@@ -1796,17 +2194,9 @@ void MultibodyPlant<T>::CalcGeneralizedAccelerationsContinuous(
   DRAKE_DEMAND(vdot != nullptr);
   DRAKE_DEMAND(vdot->size() == num_velocities());
   DRAKE_DEMAND(!is_discrete());
-  const int nv = this->num_velocities();
 
-  // Allocate workspace. We might want to cache these to avoid allocations.
-  // Mass matrix.
-  MatrixX<T> M(nv, nv);
   // Forces.
   MultibodyForces<T> forces(internal_tree());
-  // Bodies' accelerations, ordered by BodyNodeIndex.
-  std::vector<SpatialAcceleration<T>> A_WB_array(internal_tree().num_bodies());
-  // Generalized accelerations.
-  VectorX<T> zero_vdot = VectorX<T>::Zero(nv);
 
   const internal::PositionKinematicsCache<T>& pc =
       EvalPositionKinematics(context);
@@ -1829,19 +2219,7 @@ void MultibodyPlant<T>::CalcGeneralizedAccelerationsContinuous(
         applied_generalized_force_input.Eval(context);
   }
 
-  internal_tree().CalcMassMatrixViaInverseDynamics(context, &M);
-
-  // WARNING: to reduce memory foot-print, we use the input applied arrays also
-  // as output arrays. This means that both the array of applied body forces and
-  // the array of applied generalized forces get overwritten on output. This is
-  // not important in this case since we don't need their values anymore.
-  // Please see the documentation for CalcInverseDynamics() for details.
-
-  // With vdot = 0, this computes:
-  //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
   std::vector<SpatialForce<T>>& F_BBo_W_array = forces.mutable_body_forces();
-  VectorX<T>& tau_array = forces.mutable_generalized_forces();
-
   if (contact_model_ == ContactModel::kPointContactOnly) {
     // Compute contact forces on each body by penalty method.
     if (num_collision_geometries() > 0) {
@@ -1859,12 +2237,38 @@ void MultibodyPlant<T>::CalcGeneralizedAccelerationsContinuous(
     DRAKE_UNREACHABLE();
   }
 
-  internal_tree().CalcInverseDynamics(
-      context, zero_vdot, F_BBo_W_array, tau_array, &A_WB_array,
-      &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
-      &tau_array);
-
-  *vdot = M.ldlt().solve(-tau_array);
+  if constexpr (!std::is_same<T, symbolic::Expression>::value) {
+    // The O(n) articulated body algorithm solves M(q)v̇ + C(q, v)v = tau_app +
+    // ∑ J_WBᵀ(q) Fapp_Bo_W for v̇ without forming M(q).
+    internal_tree().CalcArticulatedBodyForwardDynamics(context, forces, vdot);
+  } else {
+    // The factorizations of the articulated body algorithm need to branch on
+    // the values of its (hinge) inertias, which symbolic expressions do not
+    // generally allow. We therefore factorize the mass matrix instead.
+    const int nv = this->num_velocities();
+
+    // Bodies' accelerations, ordered by BodyNodeIndex.
+    std::vector<SpatialAcceleration<T>> A_WB_array(
+        internal_tree().num_bodies());
+    const VectorX<T> zero_vdot = VectorX<T>::Zero(nv);
+
+    // WARNING: to reduce memory foot-print, we use the input applied arrays
+    // also as output arrays. This means that both the array of applied body
+    // forces and the array of applied generalized forces get overwritten on
+    // output. This is not important in this case since we don't need their
+    // values anymore. Please see the documentation for CalcInverseDynamics()
+    // for details.
+
+    // With vdot = 0, this computes:
+    //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
+    VectorX<T>& tau_array = forces.mutable_generalized_forces();
+    internal_tree().CalcInverseDynamics(
+        context, zero_vdot, F_BBo_W_array, tau_array, &A_WB_array,
+        &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
+        &tau_array);
+
+    *vdot = EvalMassMatrixFactorization(context).solve(-tau_array);
+  }
 }
 
 template <typename T>
@@ -1961,6 +2365,12 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
     this->DeclarePeriodicDiscreteUpdate(time_step_);
   }
 
+  // Joints locked with LockJoint(), stored as a parameter so that locking can
+  // change between steps without touching the state.
+  locked_joints_parameter_ = systems::AbstractParameterIndex(
+      this->DeclareAbstractParameter(
+          Value<std::vector<bool>>(std::vector<bool>(num_joints(), false))));
+
   DeclareCacheEntries();
 
   // Declare per model instance actuation ports.
@@ -2054,14 +2464,14 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
             .get_index();
   }
 
-  // Contact results output port.
+  // Contact results output port. It exposes the contact results cache entry
+  // directly, rather than copying its value into a cache entry of its own.
   const auto& contact_results_cache_entry =
       this->get_cache_entry(cache_indexes_.contact_results);
-  contact_results_port_ = this->DeclareAbstractOutputPort(
-                                  "contact_results", ContactResults<T>(),
-                                  &MultibodyPlant<T>::CopyContactResultsOutput,
-                                  {contact_results_cache_entry.ticket()})
-                              .get_index();
+  contact_results_port_ =
+      this->DeclareCacheEntryOutputPort("contact_results",
+                                        contact_results_cache_entry)
+          .get_index();
 }
 
 template <typename T>
@@ -2097,7 +2507,8 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
         this->CalcNormalAndTangentContactJacobians(
             context, EvalPointPairPenetrations(context),
             &contact_jacobians_cache.Jn, &contact_jacobians_cache.Jt,
-            &contact_jacobians_cache.R_WC_list);
+            &contact_jacobians_cache.R_WC_list,
+            &contact_jacobians_cache.blocks);
       },
       // We explicitly declare the configuration dependence even though the
       // Eval() above implicitly evaluates configuration dependent cache
@@ -2106,6 +2517,89 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
   cache_indexes_.contact_jacobians =
       contact_jacobians_cache_entry.cache_index();
 
+  // Cache the poses of all frames in world, so that queries for frames other
+  // than body frames do not compose the frame offsets on each call.
+  auto& frame_poses_cache_entry = this->DeclareCacheEntry(
+      std::string("Frame poses in world X_WF(q)."),
+      [this]() {
+        return AbstractValue::Make(
+            std::vector<math::RigidTransform<T>>(num_frames()));
+      },
+      [this](const systems::ContextBase& context_base,
+             AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& X_WF_all = cache_value->get_mutable_value<
+            std::vector<math::RigidTransform<T>>>();
+        for (FrameIndex frame_index(0); frame_index < num_frames();
+             ++frame_index) {
+          const Frame<T>& frame_F = get_frame(frame_index);
+          X_WF_all[frame_index] =
+              EvalBodyPoseInWorld(context, frame_F.body()) *
+              frame_F.CalcPoseInBodyFrame(context);
+        }
+      },
+      {this->configuration_ticket()});
+  cache_indexes_.frame_poses_in_world = frame_poses_cache_entry.cache_index();
+
+  auto& frame_spatial_velocities_cache_entry = this->DeclareCacheEntry(
+      std::string("Frame spatial velocities in world V_WF(q, v)."),
+      [this]() {
+        return AbstractValue::Make(
+            std::vector<SpatialVelocity<T>>(num_frames()));
+      },
+      [this](const systems::ContextBase& context_base,
+             AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& V_WF_all =
+            cache_value->get_mutable_value<std::vector<SpatialVelocity<T>>>();
+        for (FrameIndex frame_index(0); frame_index < num_frames();
+             ++frame_index) {
+          const Frame<T>& frame_F = get_frame(frame_index);
+          const Body<T>& body_B = frame_F.body();
+          // Shift V_WB from Bo to Fo, with p_BoFo_W = p_WoFo_W - p_WoBo_W.
+          const Vector3<T> p_BoFo_W =
+              EvalFramePoseInWorld(context, frame_F).translation() -
+              EvalBodyPoseInWorld(context, body_B).translation();
+          V_WF_all[frame_index] =
+              EvalBodySpatialVelocityInWorld(context, body_B).Shift(p_BoFo_W);
+        }
+      },
+      {this->kinematics_ticket()});
+  cache_indexes_.frame_spatial_velocities_in_world =
+      frame_spatial_velocities_cache_entry.cache_index();
+
+  // Cache the mass matrix and its factorization. Both are functions of the
+  // configuration only, so that they are shared by all the computations
+  // performed at a given q.
+  auto& mass_matrix_cache_entry = this->DeclareCacheEntry(
+      std::string("Mass matrix M(q)."),
+      [this]() {
+        return AbstractValue::Make(
+            MatrixX<T>(num_velocities(), num_velocities()));
+      },
+      [this](const systems::ContextBase& context_base,
+             AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& mass_matrix_cache = cache_value->get_mutable_value<MatrixX<T>>();
+        internal_tree().CalcMassMatrix(context, &mass_matrix_cache);
+      },
+      {this->configuration_ticket()});
+  cache_indexes_.mass_matrix = mass_matrix_cache_entry.cache_index();
+
+  auto& mass_matrix_factorization_cache_entry = this->DeclareCacheEntry(
+      std::string("LDLT factorization of the mass matrix M(q)."),
+      []() { return AbstractValue::Make(Eigen::LDLT<MatrixX<T>>()); },
+      [this](const systems::ContextBase& context_base,
+             AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& mass_matrix_factorization_cache =
+            cache_value->get_mutable_value<Eigen::LDLT<MatrixX<T>>>();
+        mass_matrix_factorization_cache.compute(EvalMassMatrix(context));
+      },
+      {this->cache_entry_ticket(cache_indexes_.mass_matrix)});
+  cache_indexes_.mass_matrix_factorization =
+      mass_matrix_factorization_cache_entry.cache_index();
+
   // Cache ImplicitStribeckSolver computations.
   auto& implicit_stribeck_solver_cache_entry = this->DeclareCacheEntry(
       std::string("Implicit Stribeck solver computations."),
@@ -2141,8 +2635,8 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
       // state. This is not the correct solution given these results do depend
       // on time and (even continuous) inputs. However it does emulate the
       // discrete update of these values as if zero-order held, which is what we
-      // want.
-      {this->xd_ticket()});
+      // want. Locked joints are stored as parameters, see LockJoint().
+      {this->xd_ticket(), this->all_parameters_ticket()});
   cache_indexes_.implicit_stribeck_solver_results =
       implicit_stribeck_solver_cache_entry.cache_index();
 
@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/Dense>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_optional.h"
@@ -22,6 +24,7 @@
 #include "drake/multibody/plant/contact_jacobians.h"
 #include "drake/multibody/plant/contact_results.h"
 #include "drake/multibody/plant/coulomb_friction.h"
+#include "drake/multibody/plant/convex_contact_solver.h"
 #include "drake/multibody/plant/implicit_stribeck_solver.h"
 #include "drake/multibody/plant/implicit_stribeck_solver_results.h"
 #include "drake/multibody/topology/multibody_graph.h"
@@ -50,6 +53,16 @@ enum class ContactModel {
   kPointContactOnly
 };
 
+/// Enumeration for the solvers of the discrete contact problem of a
+/// MultibodyPlant modeled as a discrete system.
+enum class DiscreteContactSolver {
+  /// The regularized Stribeck friction model of ImplicitStribeckSolver.
+  kImplicitStribeck,
+
+  /// The convex approximation of contact of ConvexContactSolver.
+  kConvex
+};
+
 /// @cond
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
@@ -203,6 +216,9 @@ enum class ContactModel {
 ///
 /// <h3> References </h3>
 ///
+/// - [Carpentier and Mansard, 2018] Carpentier, J. and Mansard, N., 2018.
+///     Analytical derivatives of rigid body dynamics algorithms.
+///     Robotics: Science and Systems.
 /// - [Featherstone 2008] Featherstone, R., 2008.
 ///     Rigid body dynamics algorithms. Springer.
 /// - [Jain 2010] Jain, A., 2010.
@@ -249,6 +265,11 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     visual_geometries_ = other.visual_geometries_;
     collision_geometries_ = other.collision_geometries_;
     contact_model_ = other.contact_model_;
+    contact_num_threads_ = other.contact_num_threads_;
+    use_contact_islands_ = other.use_contact_islands_;
+    discrete_contact_solver_ = other.discrete_contact_solver_;
+    use_implicit_contact_differentiation_ =
+        other.use_implicit_contact_differentiation_;
     if (geometry_source_is_registered())
       DeclareSceneGraphPorts();
 
@@ -735,6 +756,26 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     Eigen::VectorBlock<VectorX<T>> v = GetMutableVelocities(context);
     internal_tree().SetVelocitiesInArray(model_instance, v_instance, &v);
   }
+
+  /// Locks `joint` in `context`, so that it behaves as a weld until unlocked
+  /// with UnlockJoint(). The velocities of `joint` are set to zero, and
+  /// remain zero (and its positions constant) through the discrete updates,
+  /// in which the velocities of the locked joints are removed from the
+  /// discrete contact problem. The cost of the solve then scales with the
+  /// number of unlocked velocities. Locking is stored in `context`, hence it
+  /// can be changed at any time without rebuilding the plant.
+  /// @throws std::exception if called pre-finalize, if `this` plant is not
+  /// modeled as a discrete system (see is_discrete()), or if `joint` does not
+  /// belong to `this` plant.
+  void LockJoint(systems::Context<T>* context, const Joint<T>& joint) const;
+
+  /// Unlocks `joint` in `context`. It is a no-op if `joint` is not locked.
+  /// See LockJoint().
+  void UnlockJoint(systems::Context<T>* context, const Joint<T>& joint) const;
+
+  /// Returns `true` if `joint` is locked in `context`. See LockJoint().
+  bool is_joint_locked(const systems::Context<T>& context,
+                       const Joint<T>& joint) const;
   /// @}
   // end multibody state accessors.
 
@@ -1397,6 +1438,60 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().CalcRelativeTransform(context, frame_F, frame_G);
   }
 
+  /// Calculates the poses `X_WF` in the world frame W of a set of frames F,
+  /// for each of a batch of configurations. This is equivalent to calling
+  /// SetPositions() followed by CalcRelativeTransform(context, world_frame(),
+  /// *frames[f]) for each configuration, but much cheaper for large batches
+  /// (as needed, for instance, by sampling-based planners): the loop over
+  /// configurations runs internally, on scratch copies of `context` that
+  /// bypass the cache invalidation machinery, and can optionally be split
+  /// among several threads.
+  /// @param[in] context
+  ///    A context for this plant, providing its parameters. Its state is not
+  ///    used (and not modified).
+  /// @param[in] q_batch
+  ///    A matrix of size num_positions() x `num_samples`, with one
+  ///    configuration q per column.
+  /// @param[in] frames
+  ///    The (non-null) frames F whose poses are computed.
+  /// @param[out] X_WF_batch
+  ///    On output, a vector of size `num_samples * frames.size()` whose entry
+  ///    `s * frames.size() + f` is the pose of `frames[f]` in the world frame
+  ///    for the configuration in column `s` of `q_batch`.
+  /// @param[in] num_threads
+  ///    The maximum number of threads used for the computation. Results do
+  ///    not depend on the number of threads.
+  /// @throws std::exception if `X_WF_batch` is nullptr, if `q_batch` does
+  /// not have num_positions() rows, if any frame is nullptr, or if
+  /// `num_threads < 1`.
+  void CalcBatchFramePosesInWorld(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const std::vector<const Frame<T>*>& frames,
+      std::vector<math::RigidTransform<T>>* X_WF_batch,
+      int num_threads = 1) const {
+    internal_tree().CalcBatchFramePosesInWorld(
+        context, q_batch, frames, X_WF_batch, num_threads);
+  }
+
+  /// Enables computing the position and velocity kinematics of wide models,
+  /// such as scenes with many free bodies, in parallel. These kinematics are
+  /// computed level by level from the world to the tips of the tree, and the
+  /// bodies within a level are independent of each other. The bodies of a
+  /// level with at least `min_parallel_level_size` bodies are split among up
+  /// to `num_threads` threads. Smaller levels, which are typical for robots,
+  /// are processed serially since their cost is far smaller than that of
+  /// spawning threads. Results do not depend on the number of threads.
+  /// By default, `num_threads` is one and kinematics are computed serially.
+  /// It can be called before or after Finalize().
+  /// @throws std::exception if `num_threads` or `min_parallel_level_size` is
+  /// less than one.
+  void set_kinematics_parallelism(
+      int num_threads, int min_parallel_level_size = 256) {
+    this->mutable_tree().set_kinematics_parallelism(num_threads,
+                                                    min_parallel_level_size);
+  }
+
   /// Calculates the rotation matrix `R_FG` relating frame F and frame G.
   /// @param[in] context
   ///    The state of the multibody system, which includes the system's
@@ -1528,6 +1623,53 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().EvalBodySpatialVelocityInWorld(context, body_B);
   }
 
+  /// Evaluate the pose `X_WF` of a frame F in the world frame W.
+  /// Unlike Frame::CalcPoseInWorld(), which composes the pose of F on each
+  /// call, the poses of all the frames of the model are computed at once and
+  /// cached in `context`. They only depend on q and on the parameters of the
+  /// model, so that all the queries performed at a given configuration are
+  /// lookups.
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] frame_F
+  ///   The frame F for which the pose is requested.
+  /// @retval X_WF
+  ///   The pose of frame F in the world frame W.
+  /// @throws std::exception if Finalize() was not called on `this` model or if
+  /// `frame_F` does not belong to this model.
+  const math::RigidTransform<T>& EvalFramePoseInWorld(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_F) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    frame_F.HasThisParentTreeOrThrow(&internal_tree());
+    return this->get_cache_entry(cache_indexes_.frame_poses_in_world)
+        .template Eval<std::vector<math::RigidTransform<T>>>(
+            context)[frame_F.index()];
+  }
+
+  /// Evaluate the spatial velocity `V_WF` of a frame F in the world frame W.
+  /// As for EvalFramePoseInWorld(), the spatial velocities of all the frames
+  /// of the model are cached in `context`, as a function of q, v and the
+  /// parameters of the model.
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] frame_F
+  ///   The frame F for which the spatial velocity is requested.
+  /// @retval V_WF
+  ///   The spatial velocity of frame F in the world frame W.
+  /// @throws std::exception if Finalize() was not called on `this` model or if
+  /// `frame_F` does not belong to this model.
+  const SpatialVelocity<T>& EvalFrameSpatialVelocityInWorld(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_F) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    frame_F.HasThisParentTreeOrThrow(&internal_tree());
+    return this
+        ->get_cache_entry(cache_indexes_.frame_spatial_velocities_in_world)
+        .template Eval<std::vector<SpatialVelocity<T>>>(
+            context)[frame_F.index()];
+  }
+
   /// Given a list of points with fixed position vectors `p_FP` in a frame
   /// F, (that is, their time derivative `DtF(p_FP)` in frame F is zero),
   /// this method computes the geometric Jacobian `Jv_WFp` defined by:
@@ -1918,6 +2060,43 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
        context, with_respect_to, frame_B, p_BoBi_B, frame_A, frame_E, Jw_ABp_E);
   }
 
+  /// Computes the non-zero columns of the spatial velocity Jacobian
+  /// `Jv_V_ABp_E` of a point P fixed to a frame B, in a frame A, with respect
+  /// to the generalized velocities v, as returned by
+  /// CalcJacobianSpatialVelocity() with JacobianWrtVariable::kV. Only the
+  /// generalized velocities of the joints in the kinematic path connecting A
+  /// and B can change the spatial velocity of B in A, and all the other columns
+  /// of `Jv_V_ABp_E` are zero. For a model with several branches (e.g. a
+  /// dual-arm robot) this path is usually much shorter than v, and the cost of
+  /// this method grows with the length of the path instead of with the number
+  /// of generalized velocities.
+  ///
+  /// @param[in] context The state of the multibody system.
+  /// @param[in] frame_B The frame on which point P is fixed (e.g., welded).
+  /// @param[in] p_BP The position of P in frame B, expressed in frame B.
+  /// @param[in] frame_A The frame that measures `V_ABp`.
+  /// @param[in] frame_E The frame in which the Jacobian is expressed.
+  /// @param[out] velocity_indices On output, the indices in v of the
+  /// generalized velocities in the kinematic path from A to B, sorted in
+  /// increasing order.
+  /// @param[out] Jv_V_ABp_E_path On output, a `6 x k` matrix, with k the size
+  /// of `velocity_indices`, such that its j-th column is the column
+  /// `velocity_indices[j]` of `Jv_V_ABp_E`.
+  /// @throws std::exception if `velocity_indices` or `Jv_V_ABp_E_path` is
+  /// nullptr.
+  void CalcJacobianSpatialVelocityOnKinematicPath(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_B,
+      const Eigen::Ref<const Vector3<T>>& p_BP,
+      const Frame<T>& frame_A,
+      const Frame<T>& frame_E,
+      std::vector<int>* velocity_indices,
+      MatrixX<T>* Jv_V_ABp_E_path) const {
+    internal_tree().CalcJacobianSpatialVelocityOnKinematicPath(
+        context, frame_B, p_BP, frame_A, frame_E, velocity_indices,
+        Jv_V_ABp_E_path);
+  }
+
   /// Returns a frame B's angular velocity Jacobian in a frame A with respect
   /// to "speeds" 𝑠, where 𝑠 is either q̇ ≜ [q̇₁ ... q̇ⱼ]ᵀ (time-derivatives of
   /// generalized positions) or v ≜ [v₁ ... vₖ]ᵀ (generalized velocities).
@@ -2125,6 +2304,57 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcBiasTerm(context, Cv);
   }
 
+  /// Computes the Jacobian `∂(C(q, v)v)/∂v` of the bias term with respect to
+  /// the generalized velocities, see CalcBiasTerm(). For fixed applied forces
+  /// it equals the partial derivative `∂tau/∂v` of the inverse dynamics, see
+  /// CalcInverseDynamics(), whose partial derivative `∂tau/∂v̇` is the mass
+  /// matrix, see CalcMassMatrix().
+  ///
+  /// This method is evaluated in T, so that gradients for `T = double` do not
+  /// require converting the model to AutoDiffXd. Since `C(q, v)v` is
+  /// quadratic in v, each column is obtained exactly (up to round-off) from
+  /// two inverse dynamics evaluations, for a total cost of O(n²) with n the
+  /// number of generalized velocities.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] Cv_v
+  ///   A valid (non-null) pointer to a squared matrix in `ℛⁿˣⁿ`. On output,
+  ///   its j-th column is `∂(C(q, v)v)/∂vⱼ`. This method aborts if Cv_v is
+  ///   nullptr or if it does not have the proper size.
+  void CalcBiasTermVelocityJacobian(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> Cv_v) const {
+    internal_tree().CalcBiasTermVelocityJacobian(context, Cv_v);
+  }
+
+  /// Computes the partial derivatives of the generalized accelerations v̇ that
+  /// solve `M(q)v̇ + C(q, v)v = tau` with respect to the generalized velocities
+  /// v and the generalized forces tau, with the applied forces tau held fixed.
+  /// These are [Carpentier and Mansard, 2018]: <pre>
+  ///   ∂v̇/∂v = -M(q)⁻¹ ∂(C(q, v)v)/∂v,   ∂v̇/∂tau = M(q)⁻¹
+  /// </pre>
+  /// They are computed in T with CalcBiasTermVelocityJacobian() and the
+  /// factorization of CalcMassMatrixLtdlFactorization().
+  ///
+  /// @note Forces that depend on v, like those of damping force elements, are
+  /// not differentiated; their contribution is `∂v̇/∂tau ∂tau/∂v`.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] vdot_v
+  ///   On output, `∂v̇/∂v`. It must be a valid (non-null) pointer to a squared
+  ///   matrix in `ℛⁿˣⁿ`.
+  /// @param[out] vdot_tau
+  ///   On output, `∂v̇/∂tau`. It must be a valid (non-null) pointer to a
+  ///   squared matrix in `ℛⁿˣⁿ`.
+  /// This method aborts if either output is nullptr or if it does not have the
+  /// proper size.
+  void CalcForwardDynamicsPartials(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> vdot_v,
+      EigenPtr<MatrixX<T>> vdot_tau) const {
+    internal_tree().CalcForwardDynamicsPartials(context, vdot_v, vdot_tau);
+  }
+
   /// Computes the generalized forces `tau_g(q)` due to gravity as a function
   /// of the generalized positions `q` stored in the input `context`.
   /// The vector of generalized forces due to gravity `tau_g(q)` is defined such
@@ -2356,11 +2586,173 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   ///
   /// @warning This is an O(n²) algorithm. Avoid the explicit computation of the
   /// mass matrix whenever possible.
+  /// @see CalcMassMatrix() for a more efficient method.
   void CalcMassMatrixViaInverseDynamics(
       const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const {
     internal_tree().CalcMassMatrixViaInverseDynamics(context, H);
   }
 
+  /// Performs the computation of the mass matrix `M(q)` of the model, where
+  /// the generalized positions q are stored in `context`. This method produces
+  /// the same result as CalcMassMatrixViaInverseDynamics() (to within
+  /// round-off), but uses the Composite Rigid Body Algorithm (CRBA), see
+  /// [Featherstone 2008, §6.2]. The CRBA computes each non-zero block of
+  /// `M(q)` directly from the composite body inertias of the model, instead of
+  /// performing a full inverse dynamics pass per column of `M(q)`. Blocks that
+  /// couple bodies in different branches of the tree are zero and are never
+  /// computed.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] M
+  ///   A valid (non-null) pointer to a squared matrix in `ℛⁿˣⁿ` with n the
+  ///   number of generalized velocities (num_velocities()) of the model.
+  ///   This method aborts if M is nullptr or if it does not have the proper
+  ///   size.
+  ///
+  /// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  ///                       algorithms. Springer.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> M) const {
+    internal_tree().CalcMassMatrix(context, M);
+  }
+
+  /// Evaluates the mass matrix `M(q)` of the model, as computed by
+  /// CalcMassMatrix(), for the generalized positions q stored in `context`.
+  /// For models with many trees, like scenes with many free bodies, its cost
+  /// is linear in the number of bodies. The result is cached in `context` and only depends
+  /// on q and on the parameters of the model. Therefore all the queries
+  /// performed on the same context at a given configuration share a single
+  /// computation of `M(q)`.
+  /// @throws std::exception if called pre-finalize. See Finalize().
+  const MatrixX<T>& EvalMassMatrix(const systems::Context<T>& context) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    return this->get_cache_entry(cache_indexes_.mass_matrix)
+        .template Eval<MatrixX<T>>(context);
+  }
+
+  /// Evaluates the LDLT factorization of the mass matrix `M(q)` returned by
+  /// EvalMassMatrix(). Like the mass matrix, this factorization is cached in
+  /// `context` and it is only recomputed when q or the parameters of the
+  /// model change. Consumers that need to solve `M(q)x = b` should prefer this
+  /// method to factorizing the mass matrix themselves.
+  /// @throws std::exception if called pre-finalize. See Finalize().
+  const Eigen::LDLT<MatrixX<T>>& EvalMassMatrixFactorization(
+      const systems::Context<T>& context) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    return this->get_cache_entry(cache_indexes_.mass_matrix_factorization)
+        .template Eval<Eigen::LDLT<MatrixX<T>>>(context);
+  }
+
+  /// Computes the factorization `M(q) = Lᵀ D L` of the mass matrix of the
+  /// model, with L a unit lower triangular matrix and D a diagonal matrix, as
+  /// described in [Featherstone 2008, §6.5]. The entries of `M(q)` coupling
+  /// generalized velocities in different branches of the tree are zero, and L
+  /// inherits this sparsity pattern without any fill-in. This method exploits
+  /// it and, for a tree of depth d, its cost is O(n d²) instead of the O(n³)
+  /// of a dense factorization, with n the number of generalized velocities.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] LTDL
+  ///   A valid (non-null) pointer to a squared matrix in `ℛⁿˣⁿ`. On output,
+  ///   its diagonal stores D and its strictly lower triangle stores the
+  ///   strictly lower triangle of L. Its strictly upper triangle is left in an
+  ///   unspecified state. This method aborts if LTDL is nullptr or if it does
+  ///   not have the proper size.
+  ///
+  /// @see SolveWithMassMatrixLtdlFactorization().
+  void CalcMassMatrixLtdlFactorization(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> LTDL) const {
+    internal_tree().CalcMassMatrixLtdlFactorization(context, LTDL);
+  }
+
+  /// Solves `M(q) x = b` given the factorization of `M(q)` computed by
+  /// CalcMassMatrixLtdlFactorization(). Its cost is O(n d), with n the number
+  /// of generalized velocities and d the depth of the tree.
+  ///
+  /// @param[in] LTDL
+  ///   The factorization computed with CalcMassMatrixLtdlFactorization().
+  /// @param[in,out] x
+  ///   On input, the right-hand side b of size n. On output, the solution x.
+  ///   This method aborts if x is nullptr or if it does not have size n.
+  void SolveWithMassMatrixLtdlFactorization(
+      const Eigen::Ref<const MatrixX<T>>& LTDL, EigenPtr<VectorX<T>> x) const {
+    internal_tree().SolveWithMassMatrixLtdlFactorization(LTDL, x);
+  }
+
+  /// Computes the inverse `Λ⁻¹ = J M⁻¹ Jᵀ` of the operational space (or task
+  /// space) inertia for the task Jacobian `J_task`, with `M` the mass matrix
+  /// of the model. Several tasks are handled by stacking the rows of their
+  /// Jacobians in `J_task`, in which case the off-diagonal blocks of `Λ⁻¹`
+  /// couple the tasks. `M` is never inverted. Instead, with `M = Lᵀ D L` its
+  /// factorization computed by CalcMassMatrixLtdlFactorization(), this method
+  /// computes `Λ⁻¹ = Z D⁻¹ Zᵀ` with `Z = J L⁻¹`. Each row of Z is obtained by
+  /// a back-substitution that follows the tree from the bodies towards the
+  /// world, with a cost of O(n d) for a tree of depth d.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] J_task
+  ///   The task Jacobian of size `m x nv`, with nv the number of generalized
+  ///   velocities. Its rows are, for instance, those of one or more spatial
+  ///   velocity Jacobians computed with CalcJacobianSpatialVelocity() and
+  ///   JacobianWrtVariable::kV.
+  /// @param[out] Lambda_inv
+  ///   On output, the `m x m` inverse of the operational space inertia. This
+  ///   method aborts if `Lambda_inv` is nullptr or if it does not have size
+  ///   `m x m`, or if `J_task` does not have nv columns.
+  void CalcOperationalSpaceInertiaInverse(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& J_task,
+      EigenPtr<MatrixX<T>> Lambda_inv) const {
+    internal_tree().CalcOperationalSpaceInertiaInverse(context, J_task,
+                                                       Lambda_inv);
+  }
+
+  /// Computes the operational space inertia `Λ = (J M⁻¹ Jᵀ)⁻¹` for the task
+  /// Jacobian `J_task` by inverting the `m x m` matrix computed with
+  /// CalcOperationalSpaceInertiaInverse(). Λ is only defined when the rows of
+  /// `J_task` are linearly independent, that is, when the stacked tasks are
+  /// neither redundant nor at a singular configuration.
+  /// Refer to CalcOperationalSpaceInertiaInverse() for details on the
+  /// arguments.
+  void CalcOperationalSpaceInertia(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& J_task,
+      EigenPtr<MatrixX<T>> Lambda) const {
+    DRAKE_DEMAND(Lambda != nullptr);
+    CalcOperationalSpaceInertiaInverse(context, J_task, Lambda);
+    *Lambda = Lambda->ldlt().solve(MatrixX<T>::Identity(J_task.rows(),
+                                                         J_task.rows()));
+  }
+
+  /// Computes the operational space inertia `Λ` of a set of task frames. The
+  /// task Jacobian stacks, in the order given by `frames`, the `6 x nv`
+  /// Jacobians `Jv_WFi` of the spatial velocity of each frame Fᵢ measured and
+  /// expressed in the world frame W, as computed by
+  /// CalcJacobianSpatialVelocity() with JacobianWrtVariable::kV. The result
+  /// has size `6k x 6k` with k the number of frames.
+  /// @see CalcOperationalSpaceInertia().
+  void CalcOperationalSpaceInertia(
+      const systems::Context<T>& context,
+      const std::vector<const Frame<T>*>& frames,
+      EigenPtr<MatrixX<T>> Lambda) const {
+    CalcOperationalSpaceInertia(context, CalcStackedFramesJacobian(
+                                             context, frames), Lambda);
+  }
+
+  /// Computes the inverse `Λ⁻¹` of the operational space inertia of a set of
+  /// task frames. See the overload of CalcOperationalSpaceInertia() on
+  /// frames for the definition of the task Jacobian.
+  void CalcOperationalSpaceInertiaInverse(
+      const systems::Context<T>& context,
+      const std::vector<const Frame<T>*>& frames,
+      EigenPtr<MatrixX<T>> Lambda_inv) const {
+    CalcOperationalSpaceInertiaInverse(
+        context, CalcStackedFramesJacobian(context, frames), Lambda_inv);
+  }
+
   // TODO(amcastro-tri): Add state accessors for free body spatial velocities.
 
   /// @}
@@ -3254,6 +3646,101 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       implicit_stribeck_solver_->set_solver_parameters(solver_parameters);
     }
   }
+
+  /// Sets the maximum number of threads used by the contact computations of
+  /// `this` plant, namely the assembly of the contact Jacobians and the
+  /// integration of the hydroelastic tractions. The hydroelastic contact
+  /// surfaces are distributed among the threads when there are enough of
+  /// them, otherwise the triangles of each surface are. The contact Jacobians
+  /// do not depend on the number of threads, while the hydroelastic forces
+  /// agree to within round-off error. This method can be called both pre- and
+  /// post-finalize. The default is one, which performs all the computations
+  /// on the calling thread.
+  /// @throws std::exception if `num_threads` is less than one.
+  void set_contact_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    contact_num_threads_ = num_threads;
+    this->ClearConvertedSystemsCache();
+  }
+
+  /// Returns the maximum number of threads used by the contact computations.
+  /// @see set_contact_num_threads().
+  int get_contact_num_threads() const { return contact_num_threads_; }
+
+  /// Enables splitting the discrete contact problem into independent contact
+  /// islands. An island is a connected component of the graph whose nodes are
+  /// the bodies that are not anchored to the world and whose edges are the
+  /// joints and the contact pairs between them. Since the mass matrix and the
+  /// contact Jacobians are block diagonal across islands, each island is
+  /// solved as a smaller discrete contact problem, which reduces the
+  /// cost of the linear algebra from a cubic on the total number of
+  /// generalized velocities to a sum of small cubics for scenes with many
+  /// separate piles of objects. The islands are distributed among up to
+  /// get_contact_num_threads() threads and their results are reassembled in
+  /// a fixed order so that they do not depend on the number of threads. Each
+  /// island converges to the solver tolerance on its own and therefore
+  /// results agree with the monolithic solve to within this tolerance.
+  /// When there is a single island, or a contact pair between two anchored
+  /// bodies, the monolithic problem is solved instead. The default is
+  /// `false`. This only affects plants modeled as discrete systems and can
+  /// be called both pre- and post-finalize.
+  void set_use_contact_islands(bool use_contact_islands) {
+    use_contact_islands_ = use_contact_islands;
+    this->ClearConvertedSystemsCache();
+  }
+
+  /// Returns `true` if the discrete contact problem is split into independent
+  /// contact islands. @see set_use_contact_islands().
+  bool get_use_contact_islands() const { return use_contact_islands_; }
+
+  /// Sets the solver of the discrete contact problem, see
+  /// DiscreteContactSolver. ConvexContactSolver minimizes a convex
+  /// approximation of the same problem as ImplicitStribeckSolver, which does
+  /// not need the stiction tolerance of the Stribeck model (see
+  /// set_stiction_tolerance()) and converges in a few Newton iterations even
+  /// for stacks of objects, therefore allowing larger time steps. It is warm
+  /// started with the velocities of the previous step, and also applies to
+  /// the contact islands (see set_use_contact_islands()). The default is
+  /// DiscreteContactSolver::kImplicitStribeck. This only affects plants
+  /// modeled as discrete systems and can be called both pre- and
+  /// post-finalize.
+  void set_discrete_contact_solver(DiscreteContactSolver solver) {
+    discrete_contact_solver_ = solver;
+    this->ClearConvertedSystemsCache();
+  }
+
+  /// Returns the solver of the discrete contact problem.
+  /// @see set_discrete_contact_solver().
+  DiscreteContactSolver get_discrete_contact_solver() const {
+    return discrete_contact_solver_;
+  }
+
+  /// Enables the differentiation of the discrete contact problem by the
+  /// implicit function theorem for `T = AutoDiffXd`. When enabled, the
+  /// ImplicitStribeckSolver iterates on the values of the problem data only
+  /// and the derivatives of the next step velocities with respect to the
+  /// state, inputs and parameters are then obtained with one linear solve
+  /// using the Newton-Raphson Jacobian at the solution, see
+  /// ImplicitStribeckSolverParameters::use_implicit_differentiation. This
+  /// makes the cost of the derivatives independent of the number of
+  /// iterations, which is considerably cheaper for gradient-based trajectory
+  /// optimization through contact. Derivatives agree with those obtained by
+  /// differentiating through the iteration to within the solver tolerance.
+  /// The default is `false`. This only affects plants on `T = AutoDiffXd`
+  /// modeled as discrete systems using
+  /// DiscreteContactSolver::kImplicitStribeck, and can be called both pre-
+  /// and post-finalize.
+  void set_use_implicit_contact_differentiation(bool use_implicit) {
+    use_implicit_contact_differentiation_ = use_implicit;
+    this->ClearConvertedSystemsCache();
+  }
+
+  /// Returns `true` if the discrete contact problem is differentiated by the
+  /// implicit function theorem.
+  /// @see set_use_implicit_contact_differentiation().
+  bool get_use_implicit_contact_differentiation() const {
+    return use_implicit_contact_differentiation_;
+  }
   /// @}
 
   /// Evaluates all point pairs of contact for a given state of the model stored
@@ -3315,9 +3802,13 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   struct CacheIndexes {
     systems::CacheIndex contact_jacobians;
     systems::CacheIndex contact_results;
+    systems::CacheIndex frame_poses_in_world;
+    systems::CacheIndex frame_spatial_velocities_in_world;
     systems::CacheIndex generalized_accelerations;
     systems::CacheIndex hydro_contact_forces;
     systems::CacheIndex implicit_stribeck_solver_results;
+    systems::CacheIndex mass_matrix;
+    systems::CacheIndex mass_matrix_factorization;
     systems::CacheIndex point_pairs;
   };
 
@@ -3441,8 +3932,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // to perform the update using a step size dt_substep = dt/num_substeps.
   // During the time span dt the problem data M, Jn, Jt and minus_tau, are
   // approximated to be constant, a first order approximation.
+  // The problem is solved with `solver`, whose number of velocities must
+  // match the size of `v0`.
   ImplicitStribeckSolverResult SolveUsingSubStepping(
-      int num_substeps,
+      ImplicitStribeckSolver<T>* solver, int num_substeps,
       const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
       const VectorX<T>& minus_tau,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
@@ -3451,13 +3944,48 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
 
   // This method uses the time stepping method described in
   // ImplicitStribeckSolver to advance the model's state stored in
-  // `context0` taking a time step of size time_step().
+  // `context0` taking a time step of size time_step(), with the contact
+  // solver selected by set_discrete_contact_solver().
   // Contact forces and velocities are computed and stored in `results`. See
   // ImplicitStribeckSolverResults for further details on the returned data.
   void CalcImplicitStribeckResults(
       const drake::systems::Context<T>& context0,
       internal::ImplicitStribeckSolverResults<T>* results) const;
 
+  // The generalized velocities and contact points of an independent contact
+  // island, both in increasing order. See set_use_contact_islands().
+  struct ContactIsland {
+    std::vector<int> velocities;
+    std::vector<int> contacts;
+  };
+
+  // Returns the indexes of the generalized velocities of the joints locked in
+  // `context`, in increasing order. See LockJoint().
+  std::vector<int> CalcLockedVelocities(
+      const systems::Context<T>& context) const;
+
+  // Partitions the generalized velocities and the contact pairs in
+  // `point_pairs` into independent contact islands, sorted by their first
+  // generalized velocity. An empty vector is returned when the problem
+  // cannot be split, i.e. when there is a single island or when a contact
+  // pair involves only anchored bodies.
+  std::vector<ContactIsland> CalcContactIslands(
+      const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs)
+      const;
+
+  // Helper to CalcImplicitStribeckResults() that solves each of the
+  // independent `islands` with its own contact solver, using up to
+  // contact_num_threads_ threads, and scatters the solutions into `results`.
+  // The problem data are those of the full problem.
+  void SolveContactIslands(
+      const std::vector<ContactIsland>& islands,
+      const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
+      const VectorX<T>& minus_tau,
+      const VectorX<T>& stiffness, const VectorX<T>& damping,
+      const VectorX<T>& mu,
+      const VectorX<T>& v0, const VectorX<T>& phi0,
+      internal::ImplicitStribeckSolverResults<T>* results) const;
+
   // Eval version of the method CalcImplicitStribeckResults().
   const internal::ImplicitStribeckSolverResults<T>& EvalImplicitStribeckResults(
       const systems::Context<T>& context) const {
@@ -3466,6 +3994,12 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         .template Eval<internal::ImplicitStribeckSolverResults<T>>(context);
   }
 
+  // Stacks the Jacobians Jv_WFi with respect to v of the spatial velocity of
+  // each of the `frames`, measured and expressed in the world frame.
+  MatrixX<T> CalcStackedFramesJacobian(
+      const systems::Context<T>& context,
+      const std::vector<const Frame<T>*>& frames) const;
+
   // Helper method to fill in the ContactResults given the current context when
   // the model is continuous.
   void CalcContactResultsContinuous(const systems::Context<T>& context,
@@ -3495,7 +4029,8 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   void CalcGeneralizedAccelerationsDiscrete(
       const drake::systems::Context<T>& context, VectorX<T>* vdot) const;
 
-  // Continuous system version of CalcGeneralizedAccelerations().
+  // Continuous system version of CalcGeneralizedAccelerations(). It uses the
+  // O(n) articulated body algorithm, except for symbolic::Expression.
   void CalcGeneralizedAccelerationsContinuous(
       const drake::systems::Context<T>& context, VectorX<T>* vdot) const;
 
@@ -3567,10 +4102,6 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   void CalcFramePoseOutput(const systems::Context<T>& context,
                            geometry::FramePoseVector<T>* poses) const;
 
-  void CopyContactResultsOutput(
-      const systems::Context<T>& context,
-      ContactResults<T>* contact_results) const;
-
   // Helper to evaluate if a GeometryId corresponds to a collision model.
   bool is_collision_geometry(geometry::GeometryId id) const {
     return geometry_id_to_collision_index_.count(id) > 0;
@@ -3661,11 +4192,20 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // R_WC_set will contain the orientation R_WC (with columns Cx, Cy, Cz) in the
   // world using the mean of the pair of witnesses for point_pairs_set[i] as the
   // contact point.
+  // If the optional argument blocks is non-null, on output its i-th entry will
+  // contain the block-sparse form of the rows of Jn and Jt for the i-th point
+  // pair, see ContactJacobianBlock.
+  //
+  // Only the generalized velocities in the kinematic paths from the world to
+  // bodies A and B contribute to the Jacobians of each point pair, and only
+  // those columns are computed. The point pairs are distributed among up to
+  // get_contact_num_threads() threads.
   void CalcNormalAndTangentContactJacobians(
       const systems::Context<T>& context,
       const std::vector<geometry::PenetrationAsPointPair<T>>& point_pairs_set,
       MatrixX<T>* Jn, MatrixX<T>* Jt,
-      std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr) const;
+      std::vector<math::RotationMatrix<T>>* R_WC_set = nullptr,
+      std::vector<internal::ContactJacobianBlock<T>>* blocks = nullptr) const;
 
   // Evaluates the contact Jacobians for the given state of the plant stored in
   // `context`.
@@ -3854,6 +4394,23 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // The model used by the plant to compute contact forces.
   ContactModel contact_model_{ContactModel::kPointContactOnly};
 
+  // The maximum number of threads used by the contact computations.
+  int contact_num_threads_{1};
+
+  // See set_use_contact_islands().
+  bool use_contact_islands_{false};
+
+  // See set_discrete_contact_solver().
+  DiscreteContactSolver discrete_contact_solver_{
+      DiscreteContactSolver::kImplicitStribeck};
+
+  // See set_use_implicit_contact_differentiation().
+  bool use_implicit_contact_differentiation_{false};
+
+  // Index of the abstract parameter storing, for each joint, whether it is
+  // locked, as a std::vector<bool>. See LockJoint().
+  systems::AbstractParameterIndex locked_joints_parameter_;
+
   // Port handles for geometry:
   systems::InputPortIndex geometry_query_port_;
   systems::OutputPortIndex geometry_pose_port_;
@@ -3905,8 +4462,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // plant is modeled as a continuous system, it is exactly zero.
   double time_step_{0};
 
-  // The solver used when the plant is modeled as a discrete system.
+  // The solvers used when the plant is modeled as a discrete system, see
+  // set_discrete_contact_solver().
   std::unique_ptr<ImplicitStribeckSolver<T>> implicit_stribeck_solver_;
+  std::unique_ptr<ConvexContactSolver<T>> convex_contact_solver_;
 
   hydroelastics::internal::HydroelasticEngine<T> hydroelastics_engine_;
 
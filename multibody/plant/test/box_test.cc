@@ -38,11 +38,17 @@ namespace {
 class SlidingBoxTest : public ::testing::Test {
  public:
   // Creates a MultibodyPlant model with the given `discrete_period`
-  // (discrete_period = 0 for a continuous model), runs a simulation to reach
-  // steady state, and verifies contact results.
+  // (discrete_period = 0 for a continuous model) and discrete `solver`, runs a
+  // simulation to reach steady state, and verifies contact results.
   void RunSimulationToSteadyStateAndVerifyContactResults(
-      double discrete_period) {
-    auto diagram = MakeBoxDiagram(discrete_period);
+      double discrete_period,
+      DiscreteContactSolver solver = DiscreteContactSolver::kImplicitStribeck) {
+    // The convex solver stops its Newton iteration at a relative tolerance of
+    // the momentum balance, rather than at machine precision.
+    const double tolerance = solver == DiscreteContactSolver::kConvex
+                                 ? kConvexSolverTolerance_
+                                 : kTolerance_;
+    auto diagram = MakeBoxDiagram(discrete_period, solver);
     const auto& plant = dynamic_cast<const MultibodyPlant<double>&>(
         diagram->GetSubsystemByName("plant"));
 
@@ -114,7 +120,7 @@ class SlidingBoxTest : public ::testing::Test {
       // contact point C.
       const Vector3<double> f_Bc_W(-applied_force_, 0.0, mass_ * g_);
       EXPECT_TRUE(CompareMatrices(point_pair_contact_info.contact_force(),
-                                  f_Bc_W * direction, kTolerance_,
+                                  f_Bc_W * direction, tolerance,
                                   MatrixCompareType::relative));
 
       // Upper limit on the x displacement computed using the maximum possible
@@ -133,14 +139,14 @@ class SlidingBoxTest : public ::testing::Test {
           -Vector3<double>::UnitZ() * direction;
       EXPECT_TRUE(CompareMatrices(
           point_pair_contact_info.point_pair().nhat_BA_W, expected_normal,
-          kTolerance_, MatrixCompareType::relative));
+          tolerance, MatrixCompareType::relative));
 
       // If we are in stiction, the slip speed should be smaller than the
       // specified stiction tolerance.
       EXPECT_LT(point_pair_contact_info.slip_speed(), stiction_tolerance_);
 
       // There should not be motion in the normal direction.
-      EXPECT_NEAR(point_pair_contact_info.separation_speed(), 0.0, kTolerance_);
+      EXPECT_NEAR(point_pair_contact_info.separation_speed(), 0.0, tolerance);
     };
 
     // Verify contact results at the end of the simulation.
@@ -154,7 +160,7 @@ class SlidingBoxTest : public ::testing::Test {
     // simulation to set the new context. Thus contact results evaluation in the
     // following test is completely independent from the simulation above
     // (besides of course the initial condition).
-    auto diagram2 = MakeBoxDiagram(discrete_period);
+    auto diagram2 = MakeBoxDiagram(discrete_period, solver);
     const auto& plant2 = dynamic_cast<const MultibodyPlant<double>&>(
         diagram2->GetSubsystemByName("plant"));
     std::unique_ptr<Context<double>> diagram_context2 =
@@ -171,8 +177,9 @@ class SlidingBoxTest : public ::testing::Test {
   }
 
   // Creates a MultibodyPlant model with the given `discrete_period`
-  // (discrete_period = 0 for a continuous model).
-  std::unique_ptr<Diagram<double>> MakeBoxDiagram(double time_step) {
+  // (discrete_period = 0 for a continuous model) and discrete `solver`.
+  std::unique_ptr<Diagram<double>> MakeBoxDiagram(
+      double time_step, DiscreteContactSolver solver) {
     DiagramBuilder<double> builder;
     const std::string full_name =
         FindResourceOrThrow("drake/multibody/plant/test/box.sdf");
@@ -190,6 +197,7 @@ class SlidingBoxTest : public ::testing::Test {
     // Set contact parameters.
     plant.set_penetration_allowance(penetration_allowance_);
     plant.set_stiction_tolerance(stiction_tolerance_);
+    plant.set_discrete_contact_solver(solver);
 
     // And build the Diagram:
     return builder.Build();
@@ -215,6 +223,7 @@ class SlidingBoxTest : public ::testing::Test {
   // a "steady state". Therefore the precision of the results in these tests
   // is dominated for "how well we reached steady state".
   const double kTolerance_{1.0e-12};
+  const double kConvexSolverTolerance_{1.0e-5};
 };
 
 TEST_F(SlidingBoxTest, ContinuousModel) {
@@ -225,6 +234,11 @@ TEST_F(SlidingBoxTest, DiscreteModel) {
   RunSimulationToSteadyStateAndVerifyContactResults(0.0);
 }
 
+TEST_F(SlidingBoxTest, DiscreteModelWithConvexSolver) {
+  RunSimulationToSteadyStateAndVerifyContactResults(
+      time_step_, DiscreteContactSolver::kConvex);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -1,5 +1,8 @@
 #include "drake/multibody/plant/contact_results_to_lcm.h"
 
+#include <cstdint>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -40,6 +43,22 @@ using systems::DiagramBuilder;
 namespace multibody {
 namespace {
 
+// Checks that the encoded message bytes output by `lcm_system` are the
+// encoding of its message output.
+void CheckEncodedBytes(const ContactResultsToLcmSystem<double>& lcm_system,
+                       const Context<double>& context) {
+  Value<lcmt_contact_results_for_viz> lcm_message_value;
+  lcm_system.get_lcm_message_output_port().Calc(context, &lcm_message_value);
+  const lcmt_contact_results_for_viz& lcm_message =
+      lcm_message_value.get_value();
+  std::vector<uint8_t> expected(lcm_message.getEncodedSize());
+  lcm_message.encode(expected.data(), 0, expected.size());
+
+  Value<std::vector<uint8_t>> bytes_value;
+  lcm_system.get_lcm_message_bytes_output_port().Calc(context, &bytes_value);
+  EXPECT_EQ(bytes_value.get_value(), expected);
+}
+
 // Confirm that an empty multibody plant produces an empty lcm message.
 GTEST_TEST(ContactResultsToLcmSystem, EmptyMultibodyPlant) {
   MultibodyPlant<double> plant;
@@ -62,6 +81,7 @@ GTEST_TEST(ContactResultsToLcmSystem, EmptyMultibodyPlant) {
   EXPECT_EQ(lcm_message.timestamp, 0);
   EXPECT_EQ(lcm_message.num_point_pair_contacts, 0);
   EXPECT_EQ(lcm_message.num_hydroelastic_contacts, 0);
+  CheckEncodedBytes(lcm_system, *lcm_context);
 }
 
 // Common case: confirm that the reported contacts map to the right lcm message.
@@ -129,6 +149,9 @@ GTEST_TEST(ContactResultsToLcmSystem, NonEmptyMultibodyPlantEmptyContact) {
   EXPECT_TRUE(CompareMatrices(Vector3<double>(info_msg.normal),
                               penetration_data.nhat_BA_W, 0,
                               MatrixCompareType::absolute));
+
+  lcm_context->SetTime(1.5);
+  CheckEncodedBytes(lcm_system, *lcm_context);
 }
 
 // Confirm that the system can be transmogrified to other supported scalars.
@@ -481,6 +504,8 @@ GTEST_TEST(ContactResultsToLcmTest, HydroelasticContactResults) {
           10 * std::numeric_limits<double>::epsilon());
     }
   }
+
+  CheckEncodedBytes(contact_results_to_lcm_system, *context);
 }
 
 }  // namespace
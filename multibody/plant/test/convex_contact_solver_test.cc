@@ -0,0 +1,152 @@
+#include "drake/multibody/plant/convex_contact_solver.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+// A point mass, with velocities v = [vx, vy, vz], resting on the ground with
+// a single contact point at the equilibrium penetration x0 = m⋅g / k, and
+// pushed horizontally by a force fx.
+class PointMassOnGround : public ::testing::Test {
+ protected:
+  void SetUpProblem(double fx, double x0) {
+    M_ = m_ * MatrixX<double>::Identity(3, 3);
+    Jn_ = MatrixX<double>(1, 3);
+    Jn_ << 0, 0, 1;
+    Jt_ = MatrixX<double>(2, 3);
+    Jt_ << 1, 0, 0,
+           0, 1, 0;
+    // The generalized momentum without contact, starting from rest.
+    p_star_ = dt_ * Vector3d(fx, 0, -m_ * g_);
+    x0_ = VectorXd::Constant(1, x0);
+    stiffness_ = VectorXd::Constant(1, k_);
+    dissipation_ = VectorXd::Zero(1);
+    mu_ = VectorXd::Constant(1, mu_value_);
+    solver_.SetProblemData(&M_, &Jn_, &Jt_, &p_star_, &x0_, &stiffness_,
+                           &dissipation_, &mu_);
+  }
+
+  const double m_{1.0};
+  const double g_{10.0};
+  const double dt_{1.0e-3};
+  const double k_{1.0e4};
+  const double mu_value_{0.5};
+  const double x_eq_{m_ * g_ / k_};
+
+  ConvexContactSolver<double> solver_{3};
+  MatrixX<double> M_;
+  MatrixX<double> Jn_;
+  MatrixX<double> Jt_;
+  VectorXd p_star_;
+  VectorXd x0_;
+  VectorXd stiffness_;
+  VectorXd dissipation_;
+  VectorXd mu_;
+};
+
+// A force within the friction cone is balanced by stiction.
+TEST_F(PointMassOnGround, Stiction) {
+  const double fx = 2.0;
+  SetUpProblem(fx, x_eq_);
+  ASSERT_EQ(solver_.SolveWithGuess(dt_, VectorXd::Zero(3)),
+            ConvexContactSolverResult::kSuccess);
+  const VectorXd& v = solver_.get_generalized_velocities();
+  EXPECT_LT(std::abs(v(0)), 1.0e-5);
+  EXPECT_NEAR(v(1), 0.0, 1.0e-14);
+  EXPECT_NEAR(solver_.get_friction_forces()(0), -fx, 1.0e-3 * fx);
+  EXPECT_NEAR(solver_.get_normal_forces()(0), m_ * g_, 1.0e-2 * m_ * g_);
+
+  // The momentum balance M⋅(v - v*) = Jᵀ⋅γ holds at the solution.
+  const VectorXd& tau_c = solver_.get_generalized_contact_forces();
+  EXPECT_TRUE(CompareMatrices(M_ * v - p_star_, dt_ * tau_c, 1.0e-10));
+  EXPECT_TRUE(CompareMatrices(
+      tau_c,
+      Jn_.transpose() * solver_.get_normal_forces() +
+          Jt_.transpose() * solver_.get_friction_forces(),
+      1.0e-12));
+  EXPECT_TRUE(CompareMatrices(solver_.get_normal_velocities(), Jn_ * v));
+  EXPECT_TRUE(CompareMatrices(solver_.get_tangential_velocities(), Jt_ * v));
+
+  // Newton's method converges in a few iterations.
+  const ConvexContactSolverIterationStats& stats =
+      solver_.get_iteration_statistics();
+  EXPECT_LT(stats.num_iterations, 10);
+  EXPECT_EQ(static_cast<int>(stats.residuals.size()),
+            stats.num_iterations + 1);
+}
+
+// A force outside the friction cone makes the mass slide, with the friction
+// force on the boundary of the cone.
+TEST_F(PointMassOnGround, Sliding) {
+  const double fx = 8.0;
+  SetUpProblem(fx, x_eq_);
+  ASSERT_EQ(solver_.SolveWithGuess(dt_, VectorXd::Zero(3)),
+            ConvexContactSolverResult::kSuccess);
+  const VectorXd& v = solver_.get_generalized_velocities();
+  EXPECT_GT(v(0), 0.0);
+  const double fn = solver_.get_normal_forces()(0);
+  EXPECT_GT(fn, 0.0);
+  EXPECT_NEAR(solver_.get_friction_forces()(0), -mu_value_ * fn, 1.0e-10);
+  EXPECT_NEAR(solver_.get_friction_forces()(1), 0.0, 1.0e-10);
+}
+
+// Without penetration and moving apart there are no contact forces.
+TEST_F(PointMassOnGround, NoContact) {
+  SetUpProblem(0.0, -0.1);
+  ASSERT_EQ(solver_.SolveWithGuess(dt_, VectorXd::Zero(3)),
+            ConvexContactSolverResult::kSuccess);
+  EXPECT_EQ(solver_.get_normal_forces()(0), 0.0);
+  EXPECT_TRUE(CompareMatrices(solver_.get_friction_forces(),
+                              VectorXd::Zero(2)));
+  EXPECT_TRUE(CompareMatrices(solver_.get_generalized_velocities(),
+                              p_star_ / m_, 1.0e-14));
+}
+
+// Warm starting with the solution requires no further iterations.
+TEST_F(PointMassOnGround, WarmStart) {
+  SetUpProblem(2.0, x_eq_);
+  ASSERT_EQ(solver_.SolveWithGuess(dt_, VectorXd::Zero(3)),
+            ConvexContactSolverResult::kSuccess);
+  EXPECT_GT(solver_.get_iteration_statistics().num_iterations, 0);
+  const VectorXd v = solver_.get_generalized_velocities();
+  ASSERT_EQ(solver_.SolveWithGuess(dt_, v),
+            ConvexContactSolverResult::kSuccess);
+  EXPECT_EQ(solver_.get_iteration_statistics().num_iterations, 0);
+  EXPECT_TRUE(CompareMatrices(solver_.get_generalized_velocities(), v));
+}
+
+TEST_F(PointMassOnGround, MaxIterations) {
+  SetUpProblem(2.0, x_eq_);
+  ConvexContactSolverParameters parameters;
+  parameters.max_iterations = 1;
+  solver_.set_solver_parameters(parameters);
+  EXPECT_EQ(solver_.SolveWithGuess(dt_, VectorXd::Constant(3, 10.0)),
+            ConvexContactSolverResult::kMaxIterationsReached);
+}
+
+TEST_F(PointMassOnGround, InvalidInput) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ConvexContactSolver<double>(-1),
+                              std::exception, ".*nv >= 0.*");
+  ConvexContactSolver<double> solver(3);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.SolveWithGuess(dt_, VectorXd::Zero(3)),
+                              std::exception, ".*M_ != nullptr.*");
+  SetUpProblem(2.0, x_eq_);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver_.SolveWithGuess(dt_, VectorXd::Zero(2)),
+                              std::exception, ".*v_guess.size\\(\\) == nv_.*");
+  ConvexContactSolverParameters parameters;
+  parameters.sigma = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(solver_.set_solver_parameters(parameters),
+                              std::exception, ".*sigma > 0.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -1,4 +1,5 @@
 #include <limits>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -73,6 +74,41 @@ TEST_F(KukaIiwaModelTests, FramesKinematics) {
       kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the cached frame kinematics agree with the frame methods that
+// compute them, and that they are updated with the state.
+TEST_F(KukaIiwaModelTests, EvalFrameKinematics) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+
+  auto verify_frame_kinematics = [&]() {
+    const std::vector<const Frame<double>*> frames{
+        frame_H_, &end_effector_link_->body_frame(), &plant_->world_frame()};
+    for (const Frame<double>* frame : frames) {
+      const RigidTransform<double>& X_WF =
+          plant_->EvalFramePoseInWorld(*context_, *frame);
+      EXPECT_TRUE(CompareMatrices(
+          X_WF.GetAsMatrix34(),
+          frame->CalcPoseInWorld(*context_).GetAsMatrix34(), kTolerance,
+          MatrixCompareType::relative));
+      const SpatialVelocity<double>& V_WF =
+          plant_->EvalFrameSpatialVelocityInWorld(*context_, *frame);
+      EXPECT_TRUE(CompareMatrices(
+          V_WF.get_coeffs(),
+          frame->CalcSpatialVelocityInWorld(*context_).get_coeffs(),
+          kTolerance, MatrixCompareType::relative));
+    }
+  };
+
+  SetArbitraryConfiguration();
+  verify_frame_kinematics();
+  // Repeated queries are served from the cache.
+  EXPECT_EQ(&plant_->EvalFramePoseInWorld(*context_, *frame_H_),
+            &plant_->EvalFramePoseInWorld(*context_, *frame_H_));
+
+  plant_->SetPositions(context_.get(),
+                       VectorX<double>::Zero(plant_->num_positions()));
+  verify_frame_kinematics();
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -5,6 +5,7 @@
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/contact_results.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/plant/hydroelastic_traction_calculator.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -824,6 +825,97 @@ GTEST_TEST(HydroelasticContactInfo, MoveConstruction) {
   EXPECT_EQ(contact_surface.get(), &moved_copy.contact_surface());
 }
 
+// Verifies that copies of ContactResults share, rather than clone, the
+// hydroelastic contact information, and that clearing the results does not
+// affect the copies.
+GTEST_TEST(HydroelasticContactInfo, SharedByContactResultsCopies) {
+  std::unique_ptr<ContactSurface<double>> contact_surface;
+  ContactResults<double> results;
+  results.AddContactInfo(CreateContactInfo(&contact_surface));
+  ASSERT_EQ(results.num_hydroelastic_contacts(), 1);
+
+  ContactResults<double> copy = results;
+  ASSERT_EQ(copy.num_hydroelastic_contacts(), 1);
+  EXPECT_EQ(&results.hydroelastic_contact_info(0),
+            &copy.hydroelastic_contact_info(0));
+  EXPECT_EQ(contact_surface.get(),
+            &copy.hydroelastic_contact_info(0).contact_surface());
+
+  results.Clear();
+  EXPECT_EQ(results.num_hydroelastic_contacts(), 0);
+  EXPECT_EQ(copy.num_hydroelastic_contacts(), 1);
+}
+
+// Verifies that integrating the tractions over a contact surface on multiple
+// threads gives the same spatial forces as on a single thread, to within
+// round-off error. The surface is a grid of triangles, large enough to be
+// distributed among the threads, with a linear pressure field.
+GTEST_TEST(HydroelasticTractionCalculator, MultithreadedIntegration) {
+  const int kNumCells = 20;
+  std::vector<SurfaceVertex<double>> vertices;
+  std::vector<double> e_MN;
+  for (int i = 0; i <= kNumCells; ++i) {
+    for (int j = 0; j <= kNumCells; ++j) {
+      const double x = static_cast<double>(i) / kNumCells - 0.5;
+      const double y = static_cast<double>(j) / kNumCells - 0.5;
+      vertices.emplace_back(Vector3<double>(x, y, 0));
+      e_MN.push_back(2.0 + x + y);
+    }
+  }
+  std::vector<SurfaceFace> faces;
+  auto vertex_index = [](int i, int j) {
+    return SurfaceVertexIndex(i * (kNumCells + 1) + j);
+  };
+  for (int i = 0; i < kNumCells; ++i) {
+    for (int j = 0; j < kNumCells; ++j) {
+      faces.emplace_back(vertex_index(i, j), vertex_index(i + 1, j),
+                         vertex_index(i + 1, j + 1));
+      faces.emplace_back(vertex_index(i + 1, j + 1), vertex_index(i, j + 1),
+                         vertex_index(i, j));
+    }
+  }
+  std::vector<Vector3<double>> h_MN_W(vertices.size(),
+                                      Vector3<double>(0, 0, -1));
+  auto mesh = std::make_unique<SurfaceMesh<double>>(std::move(faces),
+                                                    std::move(vertices));
+  SurfaceMesh<double>* mesh_pointer = mesh.get();
+  const ContactSurface<double> surface(
+      GeometryId::get_new_id(), GeometryId::get_new_id(), std::move(mesh),
+      std::make_unique<MeshFieldLinear<double, SurfaceMesh<double>>>(
+          "e_MN", std::move(e_MN), mesh_pointer),
+      std::make_unique<MeshFieldLinear<Vector3<double>, SurfaceMesh<double>>>(
+          "h_MN_W", std::move(h_MN_W), mesh_pointer));
+
+  // Body B slides and spins on top of body A, so that both the normal and the
+  // frictional tractions vary over the surface.
+  const RigidTransform<double> X_WA = RigidTransform<double>::Identity();
+  const RigidTransform<double> X_WB(Vector3<double>(0, 0, 0.5));
+  const SpatialVelocity<double> V_WA = SpatialVelocity<double>::Zero();
+  const SpatialVelocity<double> V_WB(Vector3<double>(0, 0, 1),
+                                     Vector3<double>(0.1, 0.2, -0.3));
+  const HydroelasticTractionCalculator<double>::Data data(X_WA, X_WB, V_WA,
+                                                          V_WB, &surface);
+  const double dissipation = 1.0;
+  const double mu_coulomb = 0.5;
+
+  const HydroelasticTractionCalculator<double> serial_calculator;
+  EXPECT_EQ(serial_calculator.num_threads(), 1);
+  SpatialForce<double> F_Ao_W_serial, F_Bo_W_serial;
+  serial_calculator.ComputeSpatialForcesAtBodyOriginsFromHydroelasticModel(
+      data, dissipation, mu_coulomb, &F_Ao_W_serial, &F_Bo_W_serial);
+
+  const HydroelasticTractionCalculator<double> parallel_calculator(
+      serial_calculator.regularization_scalar(), 4 /* num_threads */);
+  EXPECT_EQ(parallel_calculator.num_threads(), 4);
+  SpatialForce<double> F_Ao_W_parallel, F_Bo_W_parallel;
+  parallel_calculator.ComputeSpatialForcesAtBodyOriginsFromHydroelasticModel(
+      data, dissipation, mu_coulomb, &F_Ao_W_parallel, &F_Bo_W_parallel);
+
+  const double kTolerance = 64 * std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(F_Ao_W_parallel.IsApprox(F_Ao_W_serial, kTolerance));
+  EXPECT_TRUE(F_Bo_W_parallel.IsApprox(F_Bo_W_serial, kTolerance));
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -4,7 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/plant/test/implicit_stribeck_solver_test_util.h"
 
 namespace drake {
@@ -601,6 +604,36 @@ TEST_F(PizzaSaver, SmallAppliedMoment) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Verifies that factorizing the (symmetric) Newton-Raphson Jacobian of a
+// one-way coupled problem with a sparse LDLT yields the same solution as the
+// default dense factorization.
+TEST_F(PizzaSaver, SparseFactorization) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.5;
+  const double theta = M_PI / 5;
+  const Vector3<double> tau(0.0, 0.0, 6.0);  // Sliding, M_transition = 5.0.
+  const Vector3<double> v0 = Vector3<double>::Zero();
+  SetProblem(v0, tau, mu, theta, dt);
+
+  ImplicitStribeckSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  const VectorX<double> v_dense = solver_.get_generalized_velocities();
+  const int num_iterations_dense =
+      solver_.get_iteration_statistics().num_iterations;
+
+  parameters.use_sparse_factorization = true;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  EXPECT_TRUE(CompareMatrices(solver_.get_generalized_velocities(), v_dense,
+                              1.0e-12, MatrixCompareType::absolute));
+  EXPECT_EQ(solver_.get_iteration_statistics().num_iterations,
+            num_iterations_dense);
+}
+
 // Exactly the same problem as in PizzaSaver::SmallAppliedMoment but with an
 // applied moment Mz = 6.0 > M_transition = 5.0. In this case the pizza saver
 // transitions to sliding with a net moment of Mz - M_transition during a
@@ -746,6 +779,28 @@ TEST_F(PizzaSaver, NoContact) {
   EXPECT_EQ(solver_.get_tangential_velocities().size(), 0);
 }
 
+// Verifies that with no contact points the sparse factorization of M yields
+// the same solution as the default dense factorization.
+TEST_F(PizzaSaver, NoContactSparseFactorization) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const Vector3<double> tau(0.0, 0.0, 6.0);
+  const Vector3<double> v0(0.1, -0.2, 0.3);
+  SetNoContactProblem(v0, tau, dt);
+
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  const VectorX<double> v_dense = solver_.get_generalized_velocities();
+
+  ImplicitStribeckSolverParameters parameters;  // Default parameters.
+  parameters.use_sparse_factorization = true;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  EXPECT_TRUE(CompareMatrices(solver_.get_generalized_velocities(), v_dense,
+                              1.0e-14, MatrixCompareType::absolute));
+  EXPECT_EQ(solver_.get_iteration_statistics().num_iterations, 1);
+}
+
 // This test verifies that the implicit stribeck solver can correctly predict
 // transitions in a problem with impact. In this test the y axis is in the "up"
 // vertical direction, the x axis points to the right and the z axis comes out
@@ -987,6 +1042,88 @@ TEST_F(RollingCylinder, StictionAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Verifies that factorizing the (non-symmetric) Newton-Raphson Jacobian of a
+// two-way coupled problem with a sparse LU yields the same solution as the
+// default dense factorization.
+TEST_F(RollingCylinder, SparseFactorization) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;     // Friction coefficient.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const double h0 = 0.5;
+  const Vector3<double> v0(0.5, -sqrt(2.0 * g_ * h0), 0.0);
+  SetImpactProblem(v0, tau, mu, h0, dt);
+
+  ImplicitStribeckSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  const VectorX<double> v_dense = solver_.get_generalized_velocities();
+
+  parameters.use_sparse_factorization = true;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0),
+            ImplicitStribeckSolverResult::kSuccess);
+  EXPECT_TRUE(CompareMatrices(solver_.get_generalized_velocities(), v_dense,
+                              1.0e-12, MatrixCompareType::absolute));
+}
+
+// Verifies that the derivatives of the solution with respect to the initial
+// velocity v0 obtained by the implicit function theorem match those obtained
+// by differentiating through the Newton-Raphson iteration.
+TEST_F(RollingCylinder, ImplicitDifferentiation) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;     // Friction coefficient.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const double h0 = 0.5;
+  const Vector3<double> v0(0.5, -sqrt(2.0 * g_ * h0), 0.0);
+  SetImpactProblem(v0, tau, mu, h0, dt);
+
+  // Problem data on AutoDiffXd, with derivatives with respect to v0.
+  const VectorX<AutoDiffXd> v0_ad = math::initializeAutoDiff(v0);
+  const MatrixX<AutoDiffXd> M = M_.cast<AutoDiffXd>();
+  const MatrixX<AutoDiffXd> Jn = Jn_.cast<AutoDiffXd>();
+  const MatrixX<AutoDiffXd> Jt = Jt_.cast<AutoDiffXd>();
+  const VectorX<AutoDiffXd> p_star = M * v0_ad + dt * tau;
+  const VectorX<AutoDiffXd> x0 = x0_.cast<AutoDiffXd>();
+  const VectorX<AutoDiffXd> stiffness = stiffness_.cast<AutoDiffXd>();
+  const VectorX<AutoDiffXd> dissipation = dissipation_.cast<AutoDiffXd>();
+  const VectorX<AutoDiffXd> mu_vector = mu_vector_.cast<AutoDiffXd>();
+
+  ImplicitStribeckSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+
+  auto solve = [&](bool use_implicit_differentiation) {
+    ImplicitStribeckSolver<AutoDiffXd> solver(nv_);
+    parameters.use_implicit_differentiation = use_implicit_differentiation;
+    solver.set_solver_parameters(parameters);
+    solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &x0, &stiffness,
+                                       &dissipation, &mu_vector);
+    EXPECT_EQ(solver.SolveWithGuess(dt, v0_ad),
+              ImplicitStribeckSolverResult::kSuccess);
+    return VectorX<AutoDiffXd>(solver.get_generalized_velocities());
+  };
+  const VectorX<AutoDiffXd> v_iterated = solve(false);
+  const VectorX<AutoDiffXd> v_implicit = solve(true);
+
+  // Both solutions converge to within the solver tolerance.
+  const double v_tolerance =
+      parameters.relative_tolerance * parameters.stiction_tolerance;
+  EXPECT_TRUE(CompareMatrices(math::DiscardGradient(v_implicit),
+                              math::DiscardGradient(v_iterated), v_tolerance,
+                              MatrixCompareType::absolute));
+
+  const MatrixX<double> dv_iterated = math::autoDiffToGradientMatrix(
+      v_iterated);
+  const MatrixX<double> dv_implicit = math::autoDiffToGradientMatrix(
+      v_implicit);
+  ASSERT_EQ(dv_implicit.rows(), nv_);
+  ASSERT_EQ(dv_implicit.cols(), nv_);
+  EXPECT_TRUE(CompareMatrices(dv_implicit, dv_iterated,
+                              1.0e-10 * dv_iterated.norm(),
+                              MatrixCompareType::absolute));
+}
+
 // Same tests a RollingCylinder::StictionAfterImpact but with a smaller friction
 // coefficient of mu = 0.1 and initial horizontal velocity of vx0 = 1.0 m/s,
 // which leads to the cylinder to be sliding after impact.
@@ -0,0 +1,134 @@
+#include "drake/multibody/plant/kinematics_codegen.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/benchmarks/acrobot/make_acrobot_plant.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using benchmarks::acrobot::AcrobotParameters;
+using benchmarks::acrobot::MakeAcrobotPlant;
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+using symbolic::Environment;
+
+class KinematicsCodeGenTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    plant_ = MakeAcrobotPlant(AcrobotParameters(), true /* finalize */);
+    context_ = plant_->CreateDefaultContext();
+    codegen_ = std::make_unique<KinematicsCodeGen>(*plant_);
+    plant_->SetPositions(context_.get(), q_);
+    ASSERT_EQ(codegen_->q().size(), 2);
+    env_ = {{codegen_->q()[0], q_(0)}, {codegen_->q()[1], q_(1)}};
+  }
+
+  const Frame<double>& link2_frame() const {
+    return plant_->GetFrameByName(AcrobotParameters().link2_name());
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  std::unique_ptr<KinematicsCodeGen> codegen_;
+  const Vector2d q_{0.3, -1.2};
+  Environment env_;
+};
+
+// Verifies that the symbolic quantities evaluate to the same values the
+// double plant computes.
+TEST_F(KinematicsCodeGenTest, SymbolicQuantities) {
+  const double kTolerance = 1e-14;
+
+  const math::RigidTransformd X_WF = plant_->CalcRelativeTransform(
+      *context_, plant_->world_frame(), link2_frame());
+  const MatrixXd X_WF_codegen =
+      symbolic::Evaluate(codegen_->CalcFramePose(link2_frame()), env_);
+  EXPECT_TRUE(CompareMatrices(X_WF_codegen.leftCols<3>(),
+                              X_WF.rotation().matrix(), kTolerance));
+  EXPECT_TRUE(CompareMatrices(X_WF_codegen.col(3), X_WF.translation(),
+                              kTolerance));
+
+  MatrixXd Jv_V_WF_W(6, 2);
+  plant_->CalcJacobianSpatialVelocity(
+      *context_, JacobianWrtVariable::kV, link2_frame(),
+      Vector3<double>::Zero(), plant_->world_frame(), plant_->world_frame(),
+      &Jv_V_WF_W);
+  EXPECT_TRUE(CompareMatrices(
+      symbolic::Evaluate(codegen_->CalcFrameJacobian(link2_frame()), env_),
+      Jv_V_WF_W, kTolerance));
+
+  MatrixXd M(2, 2);
+  plant_->CalcMassMatrix(*context_, &M);
+  EXPECT_TRUE(CompareMatrices(
+      symbolic::Evaluate(codegen_->CalcMassMatrix(), env_), M, kTolerance));
+}
+
+TEST_F(KinematicsCodeGenTest, GeneratedCode) {
+  const std::string pose_code =
+      codegen_->GenerateFramePoseCode("X_WF", link2_frame());
+  EXPECT_NE(pose_code.find("void X_WF(const double* p, double* m)"),
+            std::string::npos);
+  EXPECT_NE(pose_code.find("X_WF_meta() { return {{2}, {3, 4}}; }"),
+            std::string::npos);
+
+  const std::string mass_matrix_code = codegen_->GenerateMassMatrixCode("M");
+  EXPECT_NE(mass_matrix_code.find("M_meta() { return {{2}, {2, 2}}; }"),
+            std::string::npos);
+
+  // The acrobot is planar and therefore at least some of the entries of its
+  // 6 x 2 spatial velocity Jacobian are structurally zero.
+  const std::string jacobian_code = codegen_->GenerateFrameJacobianCode(
+      "J", link2_frame(), true /* sparse */);
+  EXPECT_NE(jacobian_code.find("int* outer_indices"), std::string::npos);
+  EXPECT_NE(jacobian_code.find("J_meta() { return {{2}, {6, 2, "),
+            std::string::npos);
+  EXPECT_EQ(jacobian_code.find("J_meta() { return {{2}, {6, 2, 12, "),
+            std::string::npos);
+}
+
+// Hand-written functions with the same signatures as the code generated for
+// the matrix [p0, 0; p0 + p1, sin(p1)].
+void DenseFunction(const double* p, double* m) {
+  m[0] = p[0];
+  m[1] = p[0] + p[1];
+  m[2] = 0.0;
+  m[3] = std::sin(p[1]);
+}
+
+void SparseFunction(const double* p, int* outer_indices, int* inner_indices,
+                    double* values) {
+  outer_indices[0] = 0;
+  outer_indices[1] = 2;
+  outer_indices[2] = 3;
+  inner_indices[0] = 0;
+  inner_indices[1] = 1;
+  inner_indices[2] = 1;
+  values[0] = p[0];
+  values[1] = p[0] + p[1];
+  values[2] = std::sin(p[1]);
+}
+
+GTEST_TEST(CompiledMatrixFunctionTest, Eval) {
+  const Vector2d p(0.5, 2.0);
+  MatrixXd expected(2, 2);
+  expected << p(0), 0.0, p(0) + p(1), std::sin(p(1));
+
+  const CompiledMatrixFunction dense(&DenseFunction, 2, 2, 2);
+  EXPECT_TRUE(CompareMatrices(dense.Eval(p), expected));
+  EXPECT_THROW(dense.Eval(VectorXd::Zero(3)), std::exception);
+
+  const CompiledSparseMatrixFunction sparse(&SparseFunction, 2, 2, 2, 3);
+  const Eigen::SparseMatrix<double> m = sparse.Eval(p);
+  EXPECT_EQ(m.nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(m), expected));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -1,11 +1,14 @@
 #include "drake/multibody/plant/multibody_plant.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <set>
+#include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -97,9 +100,10 @@ class MultibodyPlantTester {
       const MultibodyPlant<double>& plant, const Context<double>& context,
       const std::vector<PenetrationAsPointPair<double>>& point_pairs,
       MatrixX<double>* Jn, MatrixX<double>* Jt,
-      std::vector<RotationMatrix<double>>* R_WC_set) {
+      std::vector<RotationMatrix<double>>* R_WC_set,
+      std::vector<internal::ContactJacobianBlock<double>>* blocks = nullptr) {
     plant.CalcNormalAndTangentContactJacobians(
-        context, point_pairs, Jn, Jt, R_WC_set);
+        context, point_pairs, Jn, Jt, R_WC_set, blocks);
   }
 };
 
@@ -1567,6 +1571,484 @@ TEST_F(SplitPendulum, MassMatrix) {
 
   // We can only expect values within the precision specified in the sdf file.
   EXPECT_NEAR(M(0, 0), Io, 1.0e-6);
+
+  // The composite rigid body algorithm must account for the welded half of
+  // the rod through the composite inertia of its parent.
+  MatrixX<double> M_crba(1, 1);
+  plant_.CalcMassMatrix(*context_, &M_crba);
+  EXPECT_NEAR(M_crba(0, 0), Io, 1.0e-6);
+}
+
+// Verifies that CalcMassMatrix() (composite rigid body algorithm) matches
+// CalcMassMatrixViaInverseDynamics() for a floating, branched model.
+GTEST_TEST(MultibodyPlantMassMatrix, AtlasRobot) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+
+  // An arbitrary (but not trivial) configuration.
+  const int nq = plant.num_positions();
+  plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -1.5, 1.5));
+  for (BodyIndex index : plant.GetFloatingBaseBodies()) {
+    plant.SetFreeBodyPose(
+        context.get(), plant.get_body(index),
+        RigidTransformd(RollPitchYaw<double>(0.3, -0.2, 1.1),
+                        Vector3d(0.1, 0.2, 0.8)));
+  }
+
+  const int nv = plant.num_velocities();
+  MatrixX<double> M_id(nv, nv);
+  plant.CalcMassMatrixViaInverseDynamics(*context, &M_id);
+  MatrixX<double> M_crba(nv, nv);
+  plant.CalcMassMatrix(*context, &M_crba);
+
+  const double kTolerance = 1.0e-12;
+  EXPECT_TRUE(CompareMatrices(M_crba, M_id, kTolerance,
+                              MatrixCompareType::relative));
+  // The CRBA fills both triangles explicitly.
+  EXPECT_TRUE(CompareMatrices(M_crba, M_crba.transpose(), 0.0,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies that the cached mass matrix and its factorization agree with
+// CalcMassMatrixViaInverseDynamics() and that they track changes in q.
+GTEST_TEST(MultibodyPlantMassMatrix, EvalMassMatrix) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  const double kTolerance = 1.0e-12;
+
+  for (double q_max : {0.5, 1.5}) {
+    plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -q_max, q_max));
+    MatrixX<double> M_expected(nv, nv);
+    plant.CalcMassMatrixViaInverseDynamics(*context, &M_expected);
+
+    const MatrixX<double>& M = plant.EvalMassMatrix(*context);
+    EXPECT_TRUE(CompareMatrices(M, M_expected, kTolerance,
+                                MatrixCompareType::relative));
+    const VectorXd b = VectorXd::LinSpaced(nv, -1.0, 1.0);
+    const VectorXd x = plant.EvalMassMatrixFactorization(*context).solve(b);
+    EXPECT_TRUE(CompareMatrices(M_expected * x, b, kTolerance,
+                                MatrixCompareType::relative));
+
+    // Changing the velocities does not affect the mass matrix.
+    plant.SetVelocities(context.get(), VectorXd::Constant(nv, q_max));
+    EXPECT_TRUE(CompareMatrices(plant.EvalMassMatrix(*context), M_expected,
+                                kTolerance, MatrixCompareType::relative));
+  }
+}
+
+// Verifies the sparse LTDL factorization of the mass matrix for a floating,
+// branched model.
+GTEST_TEST(MultibodyPlantMassMatrix, LtdlFactorization) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -1.5, 1.5));
+
+  MatrixX<double> M(nv, nv);
+  plant.CalcMassMatrix(*context, &M);
+  MatrixX<double> LTDL(nv, nv);
+  plant.CalcMassMatrixLtdlFactorization(*context, &LTDL);
+
+  // Reconstruct M = Lᵀ D L.
+  MatrixX<double> L = LTDL.triangularView<Eigen::StrictlyLower>();
+  L.diagonal().setOnes();
+  const VectorXd D = LTDL.diagonal();
+  const double kTolerance = 1.0e-12;
+  EXPECT_TRUE(CompareMatrices(L.transpose() * D.asDiagonal() * L, M,
+                              kTolerance, MatrixCompareType::relative));
+
+  // There is no fill-in: L is zero wherever M is.
+  for (int i = 0; i < nv; ++i) {
+    for (int j = 0; j < i; ++j) {
+      if (M(i, j) == 0.0) EXPECT_EQ(L(i, j), 0.0);
+    }
+  }
+
+  const VectorXd b = VectorXd::LinSpaced(nv, -1.0, 1.0);
+  VectorXd x = b;
+  plant.SolveWithMassMatrixLtdlFactorization(LTDL, &x);
+  EXPECT_TRUE(CompareMatrices(x, M.ldlt().solve(b), kTolerance,
+                              MatrixCompareType::relative));
+}
+
+// Verifies the partial derivatives of the bias term and of forward dynamics
+// against automatic differentiation for a floating, branched model.
+GTEST_TEST(MultibodyPlantMassMatrix, DynamicsPartials) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -1.5, 1.5));
+  const VectorXd v = VectorXd::LinSpaced(nv, 2.0, -3.0);
+  plant.SetVelocities(context.get(), v);
+
+  MatrixX<double> Cv_v(nv, nv);
+  plant.CalcBiasTermVelocityJacobian(*context, &Cv_v);
+
+  // Reference solution with v as the independent variable.
+  unique_ptr<MultibodyPlant<AutoDiffXd>> plant_autodiff =
+      systems::System<double>::ToAutoDiffXd(plant);
+  unique_ptr<Context<AutoDiffXd>> context_autodiff =
+      plant_autodiff->CreateDefaultContext();
+  context_autodiff->SetTimeStateAndParametersFrom(*context);
+  VectorX<AutoDiffXd> v_autodiff(nv);
+  math::initializeAutoDiff(v, v_autodiff);
+  plant_autodiff->SetVelocities(context_autodiff.get(), v_autodiff);
+  VectorX<AutoDiffXd> Cv_autodiff(nv);
+  plant_autodiff->CalcBiasTerm(*context_autodiff, &Cv_autodiff);
+
+  const double kTolerance = 1.0e-10;
+  EXPECT_TRUE(CompareMatrices(Cv_v,
+                              math::autoDiffToGradientMatrix(Cv_autodiff),
+                              kTolerance, MatrixCompareType::relative));
+
+  MatrixX<double> vdot_v(nv, nv);
+  MatrixX<double> vdot_tau(nv, nv);
+  plant.CalcForwardDynamicsPartials(*context, &vdot_v, &vdot_tau);
+  MatrixX<double> M(nv, nv);
+  plant.CalcMassMatrix(*context, &M);
+  EXPECT_TRUE(CompareMatrices(M * vdot_tau, MatrixX<double>::Identity(nv, nv),
+                              kTolerance, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(M * vdot_v, -Cv_v, kTolerance,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies the operational space inertia of a set of task frames against its
+// definition in terms of the dense mass matrix.
+GTEST_TEST(MultibodyPlantMassMatrix, OperationalSpaceInertia) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -1.5, 1.5));
+
+  const std::vector<const Frame<double>*> frames{
+      &plant.GetFrameByName("l_hand"), &plant.GetFrameByName("r_hand")};
+  MatrixX<double> J_task(12, nv);
+  MatrixX<double> Jv_WF(6, nv);
+  for (int i = 0; i < 2; ++i) {
+    plant.CalcJacobianSpatialVelocity(
+        *context, JacobianWrtVariable::kV, *frames[i], Vector3d::Zero(),
+        plant.world_frame(), plant.world_frame(), &Jv_WF);
+    J_task.middleRows<6>(6 * i) = Jv_WF;
+  }
+  MatrixX<double> M(nv, nv);
+  plant.CalcMassMatrix(*context, &M);
+  const MatrixX<double> Lambda_inv_expected =
+      J_task * M.ldlt().solve(J_task.transpose());
+
+  const double kTolerance = 1.0e-10;
+  MatrixX<double> Lambda_inv(12, 12);
+  plant.CalcOperationalSpaceInertiaInverse(*context, J_task, &Lambda_inv);
+  EXPECT_TRUE(CompareMatrices(Lambda_inv, Lambda_inv_expected, kTolerance,
+                              MatrixCompareType::relative));
+  plant.CalcOperationalSpaceInertiaInverse(*context, frames, &Lambda_inv);
+  EXPECT_TRUE(CompareMatrices(Lambda_inv, Lambda_inv_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  MatrixX<double> Lambda(12, 12);
+  plant.CalcOperationalSpaceInertia(*context, frames, &Lambda);
+  EXPECT_TRUE(CompareMatrices(Lambda * Lambda_inv_expected,
+                              MatrixX<double>::Identity(12, 12), kTolerance,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies that the Jacobian on the kinematic path between two frames holds
+// the non-zero columns of the full Jacobian.
+GTEST_TEST(MultibodyPlantJacobians, JacobianSpatialVelocityOnKinematicPath) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  plant.SetPositions(context.get(), VectorXd::LinSpaced(nq, -1.5, 1.5));
+
+  const Frame<double>& hand = plant.GetFrameByName("r_hand");
+  const Frame<double>& foot = plant.GetFrameByName("l_foot");
+  const Frame<double>& torso = plant.GetFrameByName("utorso");
+  const Frame<double>& world = plant.world_frame();
+  const Vector3d p_BP(0.1, -0.2, 0.3);
+
+  for (const Frame<double>* frame_A : {&world, &foot, &torso}) {
+    for (const Frame<double>* frame_E : {&world, &torso}) {
+      MatrixX<double> J(6, nv);
+      plant.CalcJacobianSpatialVelocity(*context, JacobianWrtVariable::kV,
+                                        hand, p_BP, *frame_A, *frame_E, &J);
+      std::vector<int> velocity_indices;
+      MatrixX<double> J_path;
+      plant.CalcJacobianSpatialVelocityOnKinematicPath(
+          *context, hand, p_BP, *frame_A, *frame_E, &velocity_indices,
+          &J_path);
+      ASSERT_EQ(J_path.cols(), static_cast<int>(velocity_indices.size()));
+      EXPECT_TRUE(std::is_sorted(velocity_indices.begin(),
+                                 velocity_indices.end()));
+
+      MatrixX<double> J_expected = MatrixX<double>::Zero(6, nv);
+      for (int k = 0; k < J_path.cols(); ++k) {
+        J_expected.col(velocity_indices[k]) = J_path.col(k);
+      }
+      EXPECT_TRUE(CompareMatrices(J, J_expected, 1.0e-12,
+                                  MatrixCompareType::absolute));
+    }
+  }
+
+  // The path from the torso to the hand does not include the legs nor the
+  // floating base.
+  std::vector<int> velocity_indices;
+  MatrixX<double> J_path;
+  plant.CalcJacobianSpatialVelocityOnKinematicPath(
+      *context, hand, p_BP, torso, world, &velocity_indices, &J_path);
+  EXPECT_LT(static_cast<int>(velocity_indices.size()), nv - 6);
+}
+
+// Verifies that the batched evaluation of frame poses agrees with setting
+// each configuration in the context and calling CalcRelativeTransform(), and
+// that its results do not depend on the number of threads.
+GTEST_TEST(MultibodyPlantTest, CalcBatchFramePosesInWorld) {
+  const std::string model_path =
+      FindResourceOrThrow("drake/examples/atlas/urdf/atlas_convex_hull.urdf");
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(model_path);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+
+  std::vector<const Frame<double>*> frames;
+  for (BodyIndex index(0); index < plant.num_bodies(); ++index)
+    frames.push_back(&plant.get_body(index).body_frame());
+  const int num_frames = frames.size();
+
+  const int nq = plant.num_positions();
+  const int num_samples = 7;
+  MatrixX<double> q_batch(nq, num_samples);
+  for (int s = 0; s < num_samples; ++s) {
+    q_batch.col(s) = VectorXd::LinSpaced(nq, -1.5 + 0.1 * s, 1.5 - 0.2 * s);
+  }
+
+  std::vector<RigidTransformd> X_WF_batch;
+  plant.CalcBatchFramePosesInWorld(*context, q_batch, frames, &X_WF_batch);
+  ASSERT_EQ(static_cast<int>(X_WF_batch.size()), num_samples * num_frames);
+
+  auto other_context = plant.CreateDefaultContext();
+  for (int s = 0; s < num_samples; ++s) {
+    plant.SetPositions(other_context.get(), q_batch.col(s));
+    for (int f = 0; f < num_frames; ++f) {
+      const RigidTransformd X_WF_expected = plant.CalcRelativeTransform(
+          *other_context, plant.world_frame(), *frames[f]);
+      EXPECT_TRUE(X_WF_batch[s * num_frames + f].IsNearlyEqualTo(
+          X_WF_expected, 1e-14));
+    }
+  }
+
+  // The state in the context is not used and is left untouched.
+  EXPECT_EQ(plant.GetPositions(*context),
+            plant.GetPositions(*plant.CreateDefaultContext()));
+
+  std::vector<RigidTransformd> X_WF_batch_threaded;
+  plant.CalcBatchFramePosesInWorld(*context, q_batch, frames,
+                                   &X_WF_batch_threaded, 3 /* threads */);
+  ASSERT_EQ(X_WF_batch_threaded.size(), X_WF_batch.size());
+  for (size_t i = 0; i < X_WF_batch.size(); ++i)
+    EXPECT_TRUE(X_WF_batch_threaded[i].IsExactlyEqualTo(X_WF_batch[i]));
+
+  EXPECT_THROW(plant.CalcBatchFramePosesInWorld(
+                   *context, q_batch.topRows(nq - 1), frames, &X_WF_batch),
+               std::exception);
+}
+
+// Verifies that computing the kinematics of a wide tree level in parallel
+// gives the same results as the serial recursion.
+GTEST_TEST(MultibodyPlantTest, KinematicsParallelism) {
+  MultibodyPlant<double> plant;
+  const int num_free_bodies = 20;
+  for (int i = 0; i < num_free_bodies; ++i) {
+    plant.AddRigidBody("free_body_" + std::to_string(i),
+                       SpatialInertia<double>::MakeFromCentralInertia(
+                           1.0, Vector3d::Zero(),
+                           RotationalInertia<double>(0.1, 0.2, 0.3)));
+  }
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  plant.SetPositions(context.get(),
+                     VectorXd::LinSpaced(plant.num_positions(), -1.0, 1.0));
+  plant.SetVelocities(context.get(),
+                      VectorXd::LinSpaced(plant.num_velocities(), 2.0, -2.0));
+
+  std::vector<RigidTransformd> X_WB_serial;
+  std::vector<SpatialVelocity<double>> V_WB_serial;
+  for (BodyIndex index(0); index < plant.num_bodies(); ++index) {
+    const Body<double>& body = plant.get_body(index);
+    X_WB_serial.push_back(plant.EvalBodyPoseInWorld(*context, body));
+    V_WB_serial.push_back(plant.EvalBodySpatialVelocityInWorld(*context, body));
+  }
+
+  plant.set_kinematics_parallelism(3 /* threads */, 4 /* min level size */);
+  auto parallel_context = plant.CreateDefaultContext();
+  parallel_context->SetTimeStateAndParametersFrom(*context);
+  for (BodyIndex index(0); index < plant.num_bodies(); ++index) {
+    const Body<double>& body = plant.get_body(index);
+    EXPECT_TRUE(plant.EvalBodyPoseInWorld(*parallel_context, body)
+                    .IsExactlyEqualTo(X_WB_serial[index]));
+    EXPECT_EQ(plant.EvalBodySpatialVelocityInWorld(*parallel_context, body)
+                  .get_coeffs(),
+              V_WB_serial[index].get_coeffs());
+  }
+
+  EXPECT_THROW(plant.set_kinematics_parallelism(0), std::exception);
+}
+
+// Verifies that solving the discrete update of two separate piles of spheres
+// on the ground as independent contact islands agrees with the monolithic
+// solve, and that the island results do not depend on the number of threads.
+GTEST_TEST(MultibodyPlantTest, ContactIslands) {
+  const double radius = 0.1;
+  // Computes the next discrete state from an initial state with two piles of
+  // two spheres each, slightly interpenetrating, and sliding on the ground.
+  auto calc_next_state = [radius](bool use_islands, int num_threads) {
+    systems::DiagramBuilder<double> builder;
+    MultibodyPlant<double>& plant =
+        AddMultibodyPlantSceneGraph(
+            &builder, std::make_unique<MultibodyPlant<double>>(
+                          1.0e-3 /* time step */)).plant;
+    plant.RegisterCollisionGeometry(
+        plant.world_body(),
+        geometry::HalfSpace::MakePose(Vector3d::UnitZ(), Vector3d::Zero()),
+        geometry::HalfSpace(), "ground", CoulombFriction<double>(0.5, 0.5));
+    std::vector<const RigidBody<double>*> spheres;
+    for (int i = 0; i < 4; ++i) {
+      spheres.push_back(&plant.AddRigidBody(
+          "sphere" + std::to_string(i),
+          SpatialInertia<double>::MakeFromCentralInertia(
+              1.0, Vector3d::Zero(), RotationalInertia<double>(
+                                         0.004, 0.004, 0.004))));
+      plant.RegisterCollisionGeometry(
+          *spheres.back(), RigidTransformd::Identity(),
+          geometry::Sphere(radius), "collision",
+          CoulombFriction<double>(0.3, 0.3));
+    }
+    plant.set_use_contact_islands(use_islands);
+    plant.set_contact_num_threads(num_threads);
+    plant.Finalize();
+
+    auto diagram = builder.Build();
+    auto diagram_context = diagram->CreateDefaultContext();
+    Context<double>& context =
+        diagram->GetMutableSubsystemContext(plant, diagram_context.get());
+    for (int i = 0; i < 4; ++i) {
+      const double x = i < 2 ? 0.0 : 1.0;
+      const double z = (i % 2 == 0 ? 0.99 : 2.97) * radius;
+      plant.SetFreeBodyPose(&context, *spheres[i],
+                            RigidTransformd(Vector3d(x, 0.1 * i, z)));
+      plant.SetFreeBodySpatialVelocity(
+          &context, *spheres[i],
+          SpatialVelocity<double>(Vector3d(0.0, 0.0, 0.5 * i),
+                                  Vector3d(0.1 * (i + 1), -0.2, 0.0)));
+    }
+    auto updates = plant.AllocateDiscreteVariables();
+    plant.CalcDiscreteVariableUpdates(context, updates.get());
+    return VectorXd(updates->get_vector().get_value());
+  };
+
+  const VectorXd x_monolithic = calc_next_state(false, 1);
+  const VectorXd x_islands = calc_next_state(true, 1);
+  // Each island converges to the solver tolerance independently.
+  EXPECT_TRUE(CompareMatrices(x_islands, x_monolithic, 1.0e-6));
+  EXPECT_EQ(calc_next_state(true, 2), x_islands);
+}
+
+// Verifies that the choice of implicit differentiation of the discrete contact
+// problem is preserved by scalar conversion.
+GTEST_TEST(MultibodyPlantTest, ImplicitContactDifferentiation) {
+  MultibodyPlant<double> plant(1.0e-3);
+  EXPECT_FALSE(plant.get_use_implicit_contact_differentiation());
+  plant.set_use_implicit_contact_differentiation(true);
+  EXPECT_TRUE(plant.get_use_implicit_contact_differentiation());
+  plant.Finalize();
+  MultibodyPlant<AutoDiffXd> plant_autodiff(plant);
+  EXPECT_TRUE(plant_autodiff.get_use_implicit_contact_differentiation());
+}
+
+// Verifies that a locked joint of a discrete plant does not move while the
+// rest of the model does, until the joint is unlocked.
+GTEST_TEST(MultibodyPlantTest, LockJoint) {
+  // Two identical pendulums pinned to the world, swinging under gravity.
+  MultibodyPlant<double> plant(1.0e-3);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          1.0, Vector3d(0.0, 0.0, -0.5),
+          RotationalInertia<double>(0.01, 0.01, 0.01));
+  std::vector<const RevoluteJoint<double>*> pins;
+  for (int i = 0; i < 2; ++i) {
+    const RigidBody<double>& link =
+        plant.AddRigidBody("link" + std::to_string(i), M_BBo_B);
+    pins.push_back(&plant.AddJoint<RevoluteJoint>(
+        "pin" + std::to_string(i), plant.world_body(), nullopt, link,
+        nullopt, Vector3d::UnitY()));
+  }
+  plant.Finalize();
+
+  auto context = plant.CreateDefaultContext();
+  for (const RevoluteJoint<double>* pin : pins) {
+    pin->set_angle(context.get(), 0.5);
+    pin->set_angular_rate(context.get(), 1.0);
+  }
+  EXPECT_FALSE(plant.is_joint_locked(*context, *pins[0]));
+  plant.LockJoint(context.get(), *pins[0]);
+  EXPECT_TRUE(plant.is_joint_locked(*context, *pins[0]));
+  EXPECT_FALSE(plant.is_joint_locked(*context, *pins[1]));
+  // Locking zeroes the joint's velocity.
+  EXPECT_EQ(pins[0]->get_angular_rate(*context), 0.0);
+
+  auto updates = plant.AllocateDiscreteVariables();
+  plant.CalcDiscreteVariableUpdates(*context, updates.get());
+  context->get_mutable_discrete_state().SetFrom(*updates);
+  EXPECT_EQ(pins[0]->get_angle(*context), 0.5);
+  EXPECT_EQ(pins[0]->get_angular_rate(*context), 0.0);
+  EXPECT_NE(pins[1]->get_angle(*context), 0.5);
+
+  plant.UnlockJoint(context.get(), *pins[0]);
+  EXPECT_FALSE(plant.is_joint_locked(*context, *pins[0]));
+  plant.CalcDiscreteVariableUpdates(*context, updates.get());
+  context->get_mutable_discrete_state().SetFrom(*updates);
+  EXPECT_NE(pins[0]->get_angular_rate(*context), 0.0);
+
+  // Joint locking is only supported for discrete models.
+  MultibodyPlant<double> continuous_plant(0.0);
+  const RigidBody<double>& link =
+      continuous_plant.AddRigidBody("link", M_BBo_B);
+  const RevoluteJoint<double>& pin = continuous_plant.AddJoint<RevoluteJoint>(
+      "pin", continuous_plant.world_body(), nullopt, link, nullopt,
+      Vector3d::UnitY());
+  continuous_plant.Finalize();
+  auto continuous_context = continuous_plant.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      continuous_plant.LockJoint(continuous_context.get(), pin),
+      std::logic_error, ".*only supported for plants modeled as discrete.*");
 }
 
 // Verifies we can parse link collision geometries and surface friction.
@@ -1965,6 +2447,55 @@ TEST_F(MultibodyPlantContactJacobianTests, NormalAndTangentJacobian) {
       D, vt_derivs, kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the block-sparse contact Jacobians contain the non-zero
+// columns of Jn and Jt, and that the results do not depend on the number of
+// threads used to compute them.
+TEST_F(MultibodyPlantContactJacobianTests, BlockSparseJacobians) {
+  MatrixX<double> N, D;
+  std::vector<RotationMatrix<double>> R_WC_set;
+  std::vector<internal::ContactJacobianBlock<double>> blocks;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, penetrations_, &N, &D, &R_WC_set, &blocks);
+
+  const int nv = plant_.num_velocities();
+  const int nc = penetrations_.size();
+  ASSERT_EQ(static_cast<int>(blocks.size()), nc);
+  MatrixX<double> N_from_blocks = MatrixX<double>::Zero(nc, nv);
+  MatrixX<double> D_from_blocks = MatrixX<double>::Zero(2 * nc, nv);
+  for (int ic = 0; ic < nc; ++ic) {
+    const std::vector<int>& velocity_indices = blocks[ic].velocity_indices;
+    EXPECT_TRUE(std::is_sorted(velocity_indices.begin(),
+                               velocity_indices.end()));
+    ASSERT_EQ(blocks[ic].J_AcBc_C.cols(),
+              static_cast<int>(velocity_indices.size()));
+    for (int k = 0; k < static_cast<int>(velocity_indices.size()); ++k) {
+      D_from_blocks(2 * ic, velocity_indices[k]) = blocks[ic].J_AcBc_C(0, k);
+      D_from_blocks(2 * ic + 1, velocity_indices[k]) =
+          blocks[ic].J_AcBc_C(1, k);
+      N_from_blocks(ic, velocity_indices[k]) = -blocks[ic].J_AcBc_C(2, k);
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(N_from_blocks, N));
+  EXPECT_TRUE(CompareMatrices(D_from_blocks, D));
+
+  EXPECT_EQ(plant_.get_contact_num_threads(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(plant_.set_contact_num_threads(0),
+                              std::exception, ".*num_threads >= 1.*");
+  plant_.set_contact_num_threads(3);
+  EXPECT_EQ(plant_.get_contact_num_threads(), 3);
+  MatrixX<double> N_threaded, D_threaded;
+  std::vector<RotationMatrix<double>> R_WC_set_threaded;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, penetrations_, &N_threaded, &D_threaded,
+      &R_WC_set_threaded);
+  EXPECT_TRUE(CompareMatrices(N_threaded, N));
+  EXPECT_TRUE(CompareMatrices(D_threaded, D));
+  ASSERT_EQ(R_WC_set_threaded.size(), R_WC_set.size());
+  for (int ic = 0; ic < nc; ++ic) {
+    EXPECT_TRUE(R_WC_set_threaded[ic].IsExactlyEqualTo(R_WC_set[ic]));
+  }
+}
+
 // Verifies that we can obtain the indexes into the state vector for each joint
 // in the model of a Kuka arm.
 // For this topologically simple model with only one branch of bodies with root
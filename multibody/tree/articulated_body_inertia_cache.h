@@ -2,8 +2,11 @@
 
 #include <vector>
 
+#include <Eigen/Dense>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 #include "drake/multibody/tree/articulated_body_inertia.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
@@ -18,9 +21,17 @@ namespace internal {
 ///
 /// Articulated body inertia cache entries include:
 ///
+/// - Articulated body inertia `P_B_W` of body B, taken about Bo and expressed
+///   in W.
 /// - Articulated body inertia `Pplus_PB_W`, which can be thought of as the
 ///   articulated body inertia of parent body P as though it were inertialess,
 ///   but taken about Bo and expressed in W.
+/// - The LDLT factorization of the articulated body hinge inertia
+///   `D_B = H_PB_Wᵀ P_B_W H_PB_W`.
+/// - The Kalman gain `g_PB_W = P_B_W H_PB_W D_B⁻¹`.
+///
+/// All of these depend only on the generalized positions q (and the model's
+/// parameters).
 ///
 /// @tparam T The mathematical type of the context, which must be a valid Eigen
 ///           scalar.
@@ -44,6 +55,21 @@ class ArticulatedBodyInertiaCache {
     Allocate();
   }
 
+  /// Articulated body inertia `P_B_W` of the articulated body formed by body B
+  /// and all of its outboard bodies, taken about Bo and expressed in W.
+  const ArticulatedBodyInertia<T>& get_P_B_W(
+      BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return P_B_W_[body_node_index];
+  }
+
+  /// Mutable version of get_P_B_W().
+  ArticulatedBodyInertia<T>& get_mutable_P_B_W(
+      BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return P_B_W_[body_node_index];
+  }
+
   /// Articulated body inertia `Pplus_PB_W`, which can be thought of as the
   /// articulated body inertia of parent body P as though it were inertialess,
   /// but taken about Bo and expressed in W.
@@ -60,20 +86,55 @@ class ArticulatedBodyInertiaCache {
     return Pplus_PB_W_[body_node_index];
   }
 
+  /// The LDLT factorization of the articulated body hinge inertia
+  /// `D_B = H_PB_Wᵀ P_B_W H_PB_W`, of size `nm x nm` with `nm` the number of
+  /// mobilities of body B's inboard mobilizer.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// The Kalman gain `g_PB_W = P_B_W H_PB_W D_B⁻¹`, of size `6 x nm` with `nm`
+  /// the number of mobilities of body B's inboard mobilizer.
+  const MatrixUpTo6<T>& get_g_PB_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
+  /// Mutable version of get_g_PB_W().
+  MatrixUpTo6<T>& get_mutable_g_PB_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
  private:
   // The type of the pools for storing articulated body inertias.
   typedef std::vector<ArticulatedBodyInertia<T>> ABI_PoolType;
 
   // Allocates resources for this articulated body cache.
   void Allocate() {
+    P_B_W_.resize(num_nodes_);
     Pplus_PB_W_.resize(num_nodes_);
+    ldlt_D_B_.resize(num_nodes_);
+    g_PB_W_.resize(num_nodes_);
   }
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
 
-  // Pools.
-  ABI_PoolType Pplus_PB_W_{};  // Indexed by BodyNodeIndex.
+  // Pools, all indexed by BodyNodeIndex.
+  ABI_PoolType P_B_W_{};
+  ABI_PoolType Pplus_PB_W_{};
+  std::vector<Eigen::LDLT<MatrixUpTo6<T>>> ldlt_D_B_{};
+  std::vector<MatrixUpTo6<T>> g_PB_W_{};
 };
 
 DRAKE_DEFINE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN_T(ArticulatedBodyInertiaCache);
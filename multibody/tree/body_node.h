@@ -321,7 +321,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Update V_FM using the operator V_FM = H_FM * vm:
     SpatialVelocity<T>& V_FM = get_mutable_V_FM(vc);
-    V_FM = get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, vm);
+    V_FM = DoCalcAcrossMobilizerSpatialVelocity(context, vm);
 
     // Compute V_PB_W = R_WF * V_FM.Shift(p_MoBo_F), Eq. (4).
     // Side note to developers: in operator form for rigid bodies this would be
@@ -502,7 +502,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Operator A_FM = H_FM * vmdot + Hdot_FM * vm
     SpatialAcceleration<T> A_FM =
-        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context, vmdot);
+        DoCalcAcrossMobilizerSpatialAcceleration(context, vmdot);
 
     // =========================================================================
     // Compose acceleration A_WP of P in W with acceleration A_PB of B in P,
@@ -843,7 +843,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
       v(imob) = 1.0;
       // Compute the imob-th column of H_FM:
       const SpatialVelocity<T> Himob_FM =
-          get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, v);
+          DoCalcAcrossMobilizerSpatialVelocity(context, v);
       v(imob) = 0.0;
       // V_PB_W = V_PFb_W + V_FMb_W + V_MB_W = V_FMb_W =
       //         = R_WF * V_FM.Shift(p_MoBo_F)
@@ -1063,6 +1063,247 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     const Matrix6<T> Pplus_PB_W_mat = P_B_W.CopyToFullMatrix6() - g_PB_W * HTxP;
     get_mutable_Pplus_PB_W(abc) = ArticulatedBodyInertia<T>(
         0.5 * (Pplus_PB_W_mat + Pplus_PB_W_mat.transpose()));
+
+    // Save the quantities needed by the force bias and acceleration passes.
+    get_mutable_P_B_W(abc) = P_B_W;
+    get_mutable_ldlt_D_B(abc) = ldlt_D_B;
+    get_mutable_g_PB_W(abc) = g_PB_W;
+  }
+
+  /// This method is used by MultibodyTree to compute the spatial acceleration
+  /// bias `Ab_WB` of this node's body B, that is, the spatial acceleration of B
+  /// in W when both the spatial acceleration `A_WP` of its parent body P and
+  /// this node's generalized accelerations `vmdot_B` are zero. It collects all
+  /// the velocity dependent terms of `A_WB` so that:
+  ///   A_WB = Φᵀ(p_PB_W) A_WP + Ab_WB + H_PB_W vmdot_B
+  /// where `Φᵀ(p_PB_W) A_WP` is the rigid shift of the angular and linear
+  /// accelerations in A_WP (without its centripetal term, which is part of
+  /// Ab_WB.) Since `Ab_WB` does not depend on the accelerations of any other
+  /// body, the nodes may be processed in any order.
+  ///
+  /// @param[in] context
+  ///   The context with the state of the MultibodyTree model.
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with `context`.
+  /// @param[in] vc
+  ///   An already updated velocity kinematics cache in sync with `context`.
+  /// @param[out] Ab_WB_array
+  ///   The spatial acceleration bias for all nodes in the model, indexed by
+  ///   BodyNodeIndex. On output, the entry for this node is updated.
+  void CalcSpatialAccelerationBias(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      std::vector<SpatialAcceleration<T>>* Ab_WB_array) const {
+    DRAKE_DEMAND(topology_.body != world_index());
+    DRAKE_DEMAND(Ab_WB_array != nullptr);
+
+    // The computation follows CalcSpatialAcceleration_BaseToTip(), with zero
+    // spatial acceleration A_WP and zero generalized accelerations.
+    const Frame<T>& frame_F = inboard_frame();
+    const Frame<T>& frame_M = outboard_frame();
+    const math::RigidTransform<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
+    const math::RigidTransform<T> X_MB =
+        frame_M.CalcPoseInBodyFrame(context).inverse();
+    const math::RotationMatrix<T>& R_WP = get_X_WP(pc).rotation();
+    const math::RotationMatrix<T> R_WF = R_WP * X_PF.rotation();
+    const math::RotationMatrix<T>& R_FM = get_X_FM(pc).rotation();
+    const Vector3<T> p_MB_F = R_FM * X_MB.translation();
+    const Vector3<T> p_PB_W = R_WP * get_X_PB(pc).translation();
+
+    // The across-mobilizer acceleration bias (e.g., Ḣ⋅v terms.)
+    const VectorX<T> zero_vmdot =
+        VectorX<T>::Zero(get_num_mobilizer_velocities());
+    const SpatialAcceleration<T> Ab_FM =
+        DoCalcAcrossMobilizerSpatialAcceleration(context, zero_vmdot);
+    const SpatialVelocity<T>& V_FM = get_V_FM(vc);
+    const SpatialAcceleration<T> Ab_PB_W =
+        R_WF * Ab_FM.Shift(p_MB_F, V_FM.rotational());
+
+    (*Ab_WB_array)[topology_.index] =
+        SpatialAcceleration<T>::Zero().ComposeWithMovingFrameAcceleration(
+            p_PB_W, get_V_WP(vc).rotational(), get_V_PB_W(vc), Ab_PB_W);
+  }
+
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// the articulated body force bias terms of the articulated body algorithm,
+  /// which depend on the state and on the applied forces.
+  ///
+  /// In terms of the articulated body inertia `P_B_W` and the articulated body
+  /// bias force `Z_Bo_W`, the spatial force on the articulated body B (formed
+  /// by B and all the bodies outboard from B) applied by its inboard mobilizer
+  /// at Bo is `F_Bo_W = P_B_W A_WB + Z_Bo_W`, where:
+  ///   Z_Bo_W = b_Bo_W - Fapplied_Bo_W + Σᵢ zplus_BCᵢ_W.Shift(p_CᵢoBo_W)
+  /// with `b_Bo_W` the dynamic bias of B and the sum over the children Cᵢ of B.
+  /// Projecting onto the mobilities of B gives the articulated body
+  /// innovations generalized force:
+  ///   e_B = tau_applied - H_PB_Wᵀ (P_B_W Ab_WB + Z_Bo_W)
+  /// in terms of which `D_B vmdot_B = e_B - g_PB_Wᵀ Φᵀ(p_PB_W) A_WP`. Finally,
+  /// the bias force felt by the parent body P, taken about Bo, is:
+  ///   zplus_PB_W = Z_Bo_W + P_B_W Ab_WB + g_PB_W e_B
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache.
+  /// @param[in] Ab_WB_array
+  ///   The spatial acceleration biases computed by
+  ///   CalcSpatialAccelerationBias(), indexed by BodyNodeIndex.
+  /// @param[in] b_Bo_W_cache
+  ///   The dynamic bias terms b_Bo_W(q, v), indexed by BodyNodeIndex.
+  /// @param[in] Fapplied_Bo_W
+  ///   Externally applied spatial force on this node's body B at Bo, expressed
+  ///   in the world frame.
+  /// @param[in] tau_applied
+  ///   Externally applied generalized force at this node's mobilizer, of size
+  ///   equal to get_num_mobilizer_velocities().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix of this node, see
+  ///   CalcArticulatedBodyInertiaCache_TipToBase().
+  /// @param[in,out] zplus_PB_W_array
+  ///   The bias forces `zplus_PB_W` for all nodes in the model, indexed by
+  ///   BodyNodeIndex. On output, the entry for this node is updated.
+  /// @param[out] e_B_array
+  ///   The innovations generalized forces for all the generalized velocities
+  ///   of the model. On output, the entries for this node's mobilizer are
+  ///   updated.
+  ///
+  /// @pre CalcArticulatedBodyForceBias_TipToBase() must have already been
+  /// called for all the child nodes of `this` node.
+  void CalcArticulatedBodyForceBias_TipToBase(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const std::vector<SpatialAcceleration<T>>& Ab_WB_array,
+      const std::vector<SpatialForce<T>>& b_Bo_W_cache,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      std::vector<SpatialForce<T>>* zplus_PB_W_array,
+      EigenPtr<VectorX<T>> e_B_array) const {
+    DRAKE_DEMAND(topology_.body != world_index());
+    DRAKE_DEMAND(zplus_PB_W_array != nullptr);
+    DRAKE_DEMAND(e_B_array != nullptr);
+    DRAKE_DEMAND(tau_applied.size() == get_num_mobilizer_velocities());
+
+    const math::RotationMatrix<T>& R_WB = get_X_WB(pc).rotation();
+    SpatialForce<T> Z_Bo_W = b_Bo_W_cache[topology_.index];
+    Z_Bo_W -= Fapplied_Bo_W;
+    for (const BodyNode<T>* child : children_) {
+      const Vector3<T>& p_BoCo_B = child->get_X_PB(pc).translation();
+      const Vector3<T> p_CoBo_W = -(R_WB * p_BoCo_B);
+      Z_Bo_W += (*zplus_PB_W_array)[child->index()].Shift(p_CoBo_W);
+    }
+
+    const ArticulatedBodyInertia<T>& P_B_W = get_P_B_W(abc);
+    const Vector6<T> P_times_Ab =
+        P_B_W * Ab_WB_array[topology_.index].get_coeffs();
+    const Vector6<T> Z_plus_P_times_Ab = Z_Bo_W.get_coeffs() + P_times_Ab;
+
+    // Innovations generalized force e_B for this node's mobilities.
+    auto e_B = e_B_array->segment(topology_.mobilizer_velocities_start_in_v,
+                                  topology_.num_mobilizer_velocities);
+    e_B = tau_applied - H_PB_W.transpose() * Z_plus_P_times_Ab;
+
+    (*zplus_PB_W_array)[topology_.index] =
+        SpatialForce<T>(Z_plus_P_times_Ab + get_g_PB_W(abc) * e_B);
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop to compute
+  /// the generalized accelerations `vmdot_B` of this node's mobilizer and the
+  /// spatial acceleration `A_WB` of its body B, the final pass of the
+  /// articulated body algorithm. With the quantities defined in
+  /// CalcArticulatedBodyForceBias_TipToBase():
+  ///   Aplus_WB = Φᵀ(p_PB_W) A_WP
+  ///   vmdot_B = D_B⁻¹ e_B - g_PB_Wᵀ Aplus_WB
+  ///   A_WB = Aplus_WB + Ab_WB + H_PB_W vmdot_B
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache.
+  /// @param[in] Ab_WB_array
+  ///   The spatial acceleration biases computed by
+  ///   CalcSpatialAccelerationBias(), indexed by BodyNodeIndex.
+  /// @param[in] e_B_array
+  ///   The innovations generalized forces computed by
+  ///   CalcArticulatedBodyForceBias_TipToBase().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix of this node, see
+  ///   CalcArticulatedBodyInertiaCache_TipToBase().
+  /// @param[in,out] A_WB_array
+  ///   The spatial accelerations of all the bodies in the model, indexed by
+  ///   BodyNodeIndex. On input the entry for the parent body P must be up to
+  ///   date (it is zero for the world). On output, the entry for this node is
+  ///   updated.
+  /// @param[out] vdot
+  ///   The generalized accelerations of the model. On output, the entries for
+  ///   this node's mobilizer are updated.
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const std::vector<SpatialAcceleration<T>>& Ab_WB_array,
+      const Eigen::Ref<const VectorX<T>>& e_B_array,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const {
+    DRAKE_DEMAND(topology_.body != world_index());
+    DRAKE_DEMAND(A_WB_array != nullptr);
+    DRAKE_DEMAND(vdot != nullptr);
+
+    const math::RotationMatrix<T>& R_WP = get_X_WP(pc).rotation();
+    const Vector3<T> p_PB_W = R_WP * get_X_PB(pc).translation();
+    const SpatialAcceleration<T> Aplus_WB =
+        get_A_WP_from_array(*A_WB_array).Shift(p_PB_W);
+
+    const int start = topology_.mobilizer_velocities_start_in_v;
+    const int nv = topology_.num_mobilizer_velocities;
+    auto vmdot = vdot->segment(start, nv);
+    vmdot = get_ldlt_D_B(abc).solve(e_B_array.segment(start, nv)) -
+            get_g_PB_W(abc).transpose() * Aplus_WB.get_coeffs();
+
+    get_mutable_A_WB_from_array(A_WB_array) = SpatialAcceleration<T>(
+        Aplus_WB.get_coeffs() + Ab_WB_array[topology_.index].get_coeffs() +
+        H_PB_W * vmdot);
+  }
+
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// the composite body inertia `Mc_B_W` of this node's body B. The composite
+  /// body inertia of B is the spatial inertia of the composite body formed by
+  /// B and all the bodies outboard from B, rigidly locked in their current
+  /// configuration. `Mc_B_W` is taken about Bo and expressed in the world
+  /// frame W.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache.
+  /// @param[in] M_B_W_all
+  ///   The spatial inertia of each body in the model, about its origin and
+  ///   expressed in the world frame, as returned by
+  ///   MultibodyTree::EvalSpatialInertiaInWorldCache(). Indexed by
+  ///   BodyNodeIndex.
+  /// @param[in,out] Mc_B_W_all
+  ///   The composite body inertias for all nodes in the model, indexed by
+  ///   BodyNodeIndex. On output, the entry for this node is updated.
+  ///
+  /// @pre CalcCompositeBodyInertia_TipToBase() must have already been called
+  /// for all the child nodes of `this` node (and, by recursive precondition,
+  /// all successor nodes in the tree.)
+  void CalcCompositeBodyInertia_TipToBase(
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<SpatialInertia<T>>& M_B_W_all,
+      std::vector<SpatialInertia<T>>* Mc_B_W_all) const {
+    DRAKE_DEMAND(Mc_B_W_all != nullptr);
+    // The composite body inertia of B is given by:
+    //   Mc_B_W = M_B_W + Σᵢ Mc_Cᵢ_W.Shift(p_CᵢoBo_W)
+    // where the sum is over all the children Cᵢ of B.
+    const math::RotationMatrix<T>& R_WB = get_X_WB(pc).rotation();
+    SpatialInertia<T> Mc_B_W = M_B_W_all[topology_.index];
+    for (const BodyNode<T>* child : children_) {
+      // p_BoCo_B is the translation of X_PB for the child node.
+      const Vector3<T>& p_BoCo_B = child->get_X_PB(pc).translation();
+      const Vector3<T> p_CoBo_W = -(R_WB * p_BoCo_B);
+      Mc_B_W += (*Mc_B_W_all)[child->index()].Shift(p_CoBo_W);
+    }
+    (*Mc_B_W_all)[topology_.index] = Mc_B_W;
   }
 
  protected:
@@ -1080,6 +1321,37 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return get_mobilizer().outboard_frame();
   }
 
+  /// @name Across-mobilizer operators
+  /// The recursions in this class obtain the across-mobilizer kinematics of
+  /// this node's mobilizer through these methods. The default implementations
+  /// dispatch through the Mobilizer interface. BodyNodeImpl overrides them to
+  /// call its concrete mobilizer type directly, see BodyNodeImpl.
+  /// @{
+
+  /// Returns `X_FM(q)`, see Mobilizer::CalcAcrossMobilizerTransform().
+  virtual math::RigidTransform<T> DoCalcAcrossMobilizerTransform(
+      const systems::Context<T>& context) const {
+    return get_mobilizer().CalcAcrossMobilizerTransform(context);
+  }
+
+  /// Returns `V_FM(q, v)`, see
+  /// Mobilizer::CalcAcrossMobilizerSpatialVelocity().
+  virtual SpatialVelocity<T> DoCalcAcrossMobilizerSpatialVelocity(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& v) const {
+    return get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, v);
+  }
+
+  /// Returns `A_FM(q, v, v̇)`, see
+  /// Mobilizer::CalcAcrossMobilizerSpatialAcceleration().
+  virtual SpatialAcceleration<T> DoCalcAcrossMobilizerSpatialAcceleration(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& vdot) const {
+    return get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context,
+                                                                  vdot);
+  }
+  /// @}
+
  private:
   // Returns the index to the parent body of the body associated with this node.
   // For the root node, corresponding to the world body, this method returns an
@@ -1247,6 +1519,44 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return abc->get_mutable_Pplus_PB_W(topology_.index);
   }
 
+  // Returns a const reference to the articulated body inertia `P_B_W` of the
+  // articulated body B, about Bo and expressed in W.
+  const ArticulatedBodyInertia<T>& get_P_B_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_P_B_W(topology_.index);
+  }
+
+  // Mutable version of get_P_B_W().
+  ArticulatedBodyInertia<T>& get_mutable_P_B_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_P_B_W(topology_.index);
+  }
+
+  // Returns a const reference to the LDLT factorization of the articulated
+  // body hinge inertia D_B of this node.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_ldlt_D_B(topology_.index);
+  }
+
+  // Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_ldlt_D_B(topology_.index);
+  }
+
+  // Returns a const reference to the Kalman gain g_PB_W of this node.
+  const MatrixUpTo6<T>& get_g_PB_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_g_PB_W(topology_.index);
+  }
+
+  // Mutable version of get_g_PB_W().
+  MatrixUpTo6<T>& get_mutable_g_PB_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_g_PB_W(topology_.index);
+  }
+
   // =========================================================================
   // Per Node Array Accessors.
   // Quantities are ordered by BodyNodeIndex unless otherwise specified.
@@ -1404,7 +1714,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
       PositionKinematicsCache<T>* pc) const {
     DRAKE_ASSERT(pc != nullptr);
     math::RigidTransform<T>& X_FM = get_mutable_X_FM(pc);
-    X_FM = get_mobilizer().CalcAcrossMobilizerTransform(context);
+    X_FM = DoCalcAcrossMobilizerTransform(context);
   }
 
   // This method computes the total force Ftot_BBo on body B that must be
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/tree/body_node.h"
 #include "drake/multibody/tree/mobilizer.h"
@@ -14,21 +15,28 @@ namespace internal {
 
 /// For internal use only of the MultibodyTree implementation.
 /// While all code that is common to any node can be placed in the BodyNode
-/// class, %BodyNodeImpl provides compile-time fixed-size BodyNode
-/// implementations so that all operations can be performed with fixed-size
-/// stack-allocated Eigen variables.
-/// In particular, most of the across mobilizer code for velocity kinematics
-/// lives in this class since the across mobilizer Jacobian matrices `H_FM(q)`
-/// (defined such that the across mobilizer spatial velocity relates to the
-/// generalized velocities v by `V_FM = H_FM(q) * v`) have a compile-time fixed
-/// size. For a more detailed discussion of the role of a BodyNode in a
+/// class, %BodyNodeImpl is templated on the concrete type of its inboard
+/// mobilizer so that the across-mobilizer operators used by the BodyNode
+/// recursions, such as the transform `X_FM(q)` and the spatial velocity
+/// `V_FM = H_FM(q) * v`, are called directly rather than through the Mobilizer
+/// virtual interface. Concrete mobilizers are `final` classes, which lets the
+/// compiler resolve (and, where their definitions are visible, inline) these
+/// calls. Concrete mobilizers create their node in their own translation unit
+/// with CreateBodyNode(), see for instance RevoluteMobilizer.
+/// Mobilizers that do not provide a concrete node use
+/// `BodyNodeImpl<T, Mobilizer>`, which dispatches through the Mobilizer
+/// interface as the BodyNode defaults do.
+/// For a more detailed discussion of the role of a BodyNode in a
 /// MultibodyTree refer to the class documentation for BodyNode.
-template <typename T, int  num_positions, int num_velocities>
-class BodyNodeImpl : public BodyNode<T> {
+///
+/// @tparam ConcreteMobilizer The class template of this node's mobilizer, for
+///   instance RevoluteMobilizer.
+template <typename T, template <typename> class ConcreteMobilizer>
+class BodyNodeImpl final : public BodyNode<T> {
  public:
-  // static constexpr int i = 42; discouraged.  See answer in:
-  // http://stackoverflow.com/questions/37259807/static-constexpr-int-vs-old-fashioned-enum-when-and-why
-  enum : int {nq = num_positions, nv = num_velocities};
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BodyNodeImpl)
+
+  using MobilizerType = ConcreteMobilizer<T>;
 
   /// Given a body and its inboard mobilizer in a MultibodyTree this constructor
   /// creates the corresponding %BodyNode. See the BodyNode class documentation
@@ -38,14 +46,35 @@ class BodyNodeImpl : public BodyNode<T> {
   ///   the owning MultibodyTree. It can be a `nullptr` only when `body` **is**
   ///   the **world** body, otherwise the parent class constructor will abort.
   /// @param[in] body The body B associated with `this` node.
-  /// @param[in] mobilizer The mobilizer associated with this `node`. It can
-  ///                      only be a `nullptr` for the **world** body.
+  /// @param[in] mobilizer The mobilizer associated with this `node`. It must
+  ///                      not be a `nullptr`.
   BodyNodeImpl(const internal::BodyNode<T>* parent_node,
-               const Body<T>* body, const Mobilizer<T>* mobilizer) :
-      BodyNode<T>(parent_node, body, mobilizer) {}
+               const Body<T>* body, const MobilizerType* mobilizer) :
+      BodyNode<T>(parent_node, body, mobilizer), mobilizer_(mobilizer) {
+    DRAKE_DEMAND(mobilizer != nullptr);
+  }
+
+ protected:
+  math::RigidTransform<T> DoCalcAcrossMobilizerTransform(
+      const systems::Context<T>& context) const final {
+    return mobilizer_->CalcAcrossMobilizerTransform(context);
+  }
+
+  SpatialVelocity<T> DoCalcAcrossMobilizerSpatialVelocity(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& v) const final {
+    return mobilizer_->CalcAcrossMobilizerSpatialVelocity(context, v);
+  }
+
+  SpatialAcceleration<T> DoCalcAcrossMobilizerSpatialAcceleration(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& vdot) const final {
+    return mobilizer_->CalcAcrossMobilizerSpatialAcceleration(context, vdot);
+  }
 
-  // TODO(amcastro-tri): Implement methods for computing velocity kinematics
-  // using fixed-size Eigen matrices.
+ private:
+  // The same object as BodyNode::get_mobilizer(), with its concrete type.
+  const MobilizerType* const mobilizer_;
 };
 
 }  // namespace internal
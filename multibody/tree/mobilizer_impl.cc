@@ -13,8 +13,8 @@ template <typename T, int  nq, int nv>
 std::unique_ptr<internal::BodyNode<T>> MobilizerImpl<T, nq, nv>::CreateBodyNode(
     const internal::BodyNode<T>* parent_node,
     const Body<T>* body, const Mobilizer<T>* mobilizer) const {
-  return std::make_unique<internal::BodyNodeImpl<T, nq, nv>>(parent_node,
-                                                             body, mobilizer);
+  return std::make_unique<internal::BodyNodeImpl<T, Mobilizer>>(
+      parent_node, body, mobilizer);
 }
 
 // Helper classes to aid the explicit instantiation with macro
@@ -125,10 +125,12 @@ class MobilizerImpl : public Mobilizer<T> {
     random_state_distribution_->template tail<kNv>() = velocity;
   }
 
-  /// For MultibodyTree internal use only.
+  /// For MultibodyTree internal use only. Creates a BodyNodeImpl that calls
+  /// the across-mobilizer operators through the Mobilizer interface. Concrete
+  /// mobilizers override it to create a node for their own type.
   std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
       const internal::BodyNode<T>* parent_node,
-      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const override;
 
  protected:
   // Handy enum to grant specific implementations compile time sizes.
@@ -1,14 +1,17 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
@@ -459,6 +462,62 @@ void MultibodyTree<T>::CalcAllBodyPosesInWorld(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcBatchFramePosesInWorld(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    const std::vector<const Frame<T>*>& frames,
+    std::vector<RigidTransform<T>>* X_WF_batch,
+    int num_threads) const {
+  DRAKE_THROW_UNLESS(X_WF_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const int num_samples = q_batch.cols();
+  const int num_frames = frames.size();
+
+  // The pose X_BF of each frame F in its body B only depends on parameters and
+  // therefore it is computed once for the entire batch.
+  std::vector<RigidTransform<T>> X_BF(num_frames);
+  std::vector<BodyNodeIndex> frame_node_index(num_frames);
+  for (int f = 0; f < num_frames; ++f) {
+    DRAKE_THROW_UNLESS(frames[f] != nullptr);
+    X_BF[f] = frames[f]->CalcPoseInBodyFrame(context);
+    frame_node_index[f] = frames[f]->body().node_index();
+  }
+
+  // Poses are stored sample-major so that the poses for a given sample are
+  // contiguous in memory.
+  X_WF_batch->resize(num_samples * num_frames);
+  if (num_samples == 0) return;
+
+  // Each thread works on its own scratch context and position kinematics.
+  // The scratch contexts are only used to store q, never to evaluate cache
+  // entries. Therefore we write q directly into their state (invalidating
+  // their caches only once, here) and bypass the plant's cache machinery
+  // entirely within the loop.
+  const int num_workers = std::min(num_threads, num_samples);
+  std::vector<std::unique_ptr<systems::Context<T>>> scratch_contexts;
+  std::vector<systems::State<T>*> scratch_states;
+  std::vector<PositionKinematicsCache<T>> scratch_pcs;
+  scratch_contexts.reserve(num_workers);
+  scratch_pcs.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    scratch_contexts.push_back(context.Clone());
+    scratch_states.push_back(&scratch_contexts.back()->get_mutable_state());
+    scratch_pcs.emplace_back(get_topology());
+  }
+
+  StaticParallelForIndexLoop(num_workers, 0, num_samples,
+      [&](int worker, int sample) {
+        PositionKinematicsCache<T>* pc = &scratch_pcs[worker];
+        get_mutable_positions(scratch_states[worker]) = q_batch.col(sample);
+        CalcPositionKinematicsCache(*scratch_contexts[worker], pc);
+        RigidTransform<T>* X_WF = X_WF_batch->data() + sample * num_frames;
+        for (int f = 0; f < num_frames; ++f)
+          X_WF[f] = pc->get_X_WB(frame_node_index[f]) * X_BF[f];
+      });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
     const systems::Context<T>& context,
@@ -474,6 +533,37 @@ void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::set_kinematics_parallelism(
+    int num_threads, int min_parallel_level_size) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  DRAKE_THROW_UNLESS(min_parallel_level_size >= 1);
+  kinematics_num_threads_ = num_threads;
+  kinematics_min_parallel_level_size_ = min_parallel_level_size;
+}
+
+template <typename T>
+template <typename NodeCalc>
+void MultibodyTree<T>::ForEachBodyNodeInLevel(
+    int level, const NodeCalc& calc_node) const {
+  const std::vector<BodyNodeIndex>& level_nodes = body_node_levels_[level];
+  const int num_nodes = level_nodes.size();
+  auto calc_node_at = [&](int i) {
+    const BodyNode<T>& node = *body_nodes_[level_nodes[i]];
+    DRAKE_ASSERT(node.get_topology().level == level);
+    DRAKE_ASSERT(node.index() == level_nodes[i]);
+    calc_node(node);
+  };
+  // Spawning threads costs far more than the per-node work of small levels.
+  if (kinematics_num_threads_ == 1 ||
+      num_nodes < kinematics_min_parallel_level_size_) {
+    for (int i = 0; i < num_nodes; ++i) calc_node_at(i);
+    return;
+  }
+  StaticParallelForIndexLoop(kinematics_num_threads_, 0, num_nodes,
+                             [&](int, int i) { calc_node_at(i); });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcPositionKinematicsCache(
     const systems::Context<T>& context,
@@ -491,15 +581,10 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == level);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
+    ForEachBodyNodeInLevel(level, [&](const BodyNode<T>& node) {
       // Update per-node kinematics.
       node.CalcPositionKinematicsCache_BaseToTip(context, pc);
-    }
+    });
   }
 }
 
@@ -519,12 +604,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
+    ForEachBodyNodeInLevel(depth, [&](const BodyNode<T>& node) {
       // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
       // number of mobilities for this node. Therefore, the return is a
       // MatrixUpTo6 since the number of columns generally changes with the
@@ -537,7 +617,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
       // Update per-node kinematics.
       node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
-    }
+    });
   }
 }
 
@@ -883,6 +963,192 @@ void MultibodyTree<T>::CalcMassMatrixViaInverseDynamics(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
+    const systems::Context<T>& context,
+    std::vector<SpatialInertia<T>>* Mc_B_W_all) const {
+  DRAKE_DEMAND(Mc_B_W_all != nullptr);
+  DRAKE_DEMAND(static_cast<int>(Mc_B_W_all->size()) == num_bodies());
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_all =
+      EvalSpatialInertiaInWorldCache(context);
+
+  // Perform tip-to-base recursion, skipping the world.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      node.CalcCompositeBodyInertia_TipToBase(pc, M_B_W_all, Mc_B_W_all);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrix(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> M) const {
+  DRAKE_DEMAND(M != nullptr);
+  DRAKE_DEMAND(M->rows() == num_velocities());
+  DRAKE_DEMAND(M->cols() == num_velocities());
+
+  // This method implements the Composite Rigid Body Algorithm (CRBA), see
+  // [Featherstone 2008, §6.2]. With Mc_B_W the composite body inertia of body
+  // B and H_PB_W the hinge matrix of B's inboard mobilizer, the diagonal block
+  // of M for B's mobilities is:
+  //   M_BB = H_PB_Wᵀ Mc_B_W H_PB_W
+  // The off-diagonal block between B and one of its ancestors A is obtained by
+  // shifting the spatial forces Fm_CBo_W = Mc_B_W H_PB_W (one per mobility of
+  // B) from Bo to Ao and projecting them onto A's hinge matrix:
+  //   M_AB = H_PA_Wᵀ Fm_CBo_W.Shift(p_BoAo_W)
+  // Blocks between bodies that are not in the same branch of the tree are
+  // zero.
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  std::vector<SpatialInertia<T>> Mc_B_W_all(num_bodies());
+  CalcCompositeBodyInertiasInWorld(context, &Mc_B_W_all);
+
+  M->setZero();
+  // Spatial forces associated with each of B's mobilities, shifted down the
+  // tree to the origin of each of B's ancestors.
+  MatrixUpTo6<T> Fm_CBo_W;
+  for (BodyNodeIndex node_index(1); node_index < num_bodies(); ++node_index) {
+    const BodyNode<T>& node = *body_nodes_[node_index];
+    const int nv_B = node.get_num_mobilizer_velocities();
+    // Nothing to do for welded bodies. Their inertia was already accounted for
+    // in their parent's composite body inertia.
+    if (nv_B == 0) continue;
+    const int start_B = node.get_topology().mobilizer_velocities_start_in_v;
+    const Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+
+    Fm_CBo_W = Mc_B_W_all[node_index].CopyToFullMatrix6() * H_PB_W;
+    M->block(start_B, start_B, nv_B, nv_B) = H_PB_W.transpose() * Fm_CBo_W;
+
+    // Walk down the tree towards the base, updating Fm_CBo_W to be the spatial
+    // forces at the origin of each ancestor, skipping the world.
+    const BodyNode<T>* child = &node;
+    BodyNodeIndex parent_index = child->get_topology().parent_body_node;
+    while (parent_index != BodyNodeIndex(0)) {
+      const BodyNode<T>& parent = *body_nodes_[parent_index];
+      const math::RotationMatrix<T>& R_WP = pc.get_X_WB(parent_index).rotation();
+      // p_PoCo_P is the translation of X_PB for the child node.
+      const Vector3<T>& p_PoCo_P = pc.get_X_PB(child->index()).translation();
+      const Vector3<T> p_CoPo_W = -(R_WP * p_PoCo_P);
+      for (int i = 0; i < nv_B; ++i) {
+        SpatialForce<T> F_CBo_W(Fm_CBo_W.col(i));
+        Fm_CBo_W.col(i) = F_CBo_W.ShiftInPlace(p_CoPo_W).get_coeffs();
+      }
+
+      const int nv_P = parent.get_num_mobilizer_velocities();
+      if (nv_P > 0) {
+        const int start_P =
+            parent.get_topology().mobilizer_velocities_start_in_v;
+        const Eigen::Map<const MatrixUpTo6<T>> H_PP_W =
+            parent.GetJacobianFromArray(H_PB_W_cache);
+        M->block(start_P, start_B, nv_P, nv_B) = H_PP_W.transpose() * Fm_CBo_W;
+        M->block(start_B, start_P, nv_B, nv_P) =
+            M->block(start_P, start_B, nv_P, nv_B).transpose();
+      }
+
+      child = &parent;
+      parent_index = child->get_topology().parent_body_node;
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixLtdlFactorization(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> LTDL) const {
+  DRAKE_DEMAND(LTDL != nullptr);
+  DRAKE_DEMAND(LTDL->rows() == num_velocities());
+  DRAKE_DEMAND(LTDL->cols() == num_velocities());
+
+  CalcMassMatrix(context, LTDL);
+
+  // This is the LTDL factorization M = Lᵀ D L of [Featherstone 2008, §6.5],
+  // with L unit lower triangular and D diagonal. Since the velocities are
+  // numbered so that λ(i) < i for the parent array λ, L has the same sparsity
+  // pattern as the lower triangle of M and there is no fill-in. Therefore the
+  // loops below only visit the entries of M that couple a velocity with its
+  // ancestors in λ, and the cost is O(n d²) for a tree of depth d instead of
+  // the O(n³) cost of a dense factorization.
+  // The strictly lower triangle of L and D overwrite the lower triangle of M.
+  const std::vector<int>& lambda = topology_.velocity_parents();
+  auto& H = *LTDL;
+  for (int k = num_velocities() - 1; k >= 0; --k) {
+    for (int i = lambda[k]; i >= 0; i = lambda[i]) {
+      const T a = H(k, i) / H(k, k);
+      for (int j = i; j >= 0; j = lambda[j]) {
+        H(i, j) -= a * H(k, j);
+      }
+      H(k, i) = a;
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::SolveWithMassMatrixLtdlFactorization(
+    const Eigen::Ref<const MatrixX<T>>& LTDL, EigenPtr<VectorX<T>> x) const {
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(LTDL.rows() == num_velocities());
+  DRAKE_DEMAND(LTDL.cols() == num_velocities());
+  DRAKE_DEMAND(x->size() == num_velocities());
+
+  // With M = Lᵀ D L we solve M x = b, with b stored in x on input, as the
+  // sequence Lᵀ y = b, D z = y and L x = z. See [Featherstone 2008, §6.5].
+  const std::vector<int>& lambda = topology_.velocity_parents();
+  const int nv = num_velocities();
+  for (int i = nv - 1; i >= 0; --i) {
+    for (int j = lambda[i]; j >= 0; j = lambda[j]) {
+      (*x)(j) -= LTDL(i, j) * (*x)(i);
+    }
+  }
+  for (int i = 0; i < nv; ++i) {
+    (*x)(i) /= LTDL(i, i);
+  }
+  for (int i = 0; i < nv; ++i) {
+    for (int j = lambda[i]; j >= 0; j = lambda[j]) {
+      (*x)(i) -= LTDL(i, j) * (*x)(j);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcOperationalSpaceInertiaInverse(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& J_task,
+    EigenPtr<MatrixX<T>> Lambda_inv) const {
+  DRAKE_DEMAND(J_task.cols() == num_velocities());
+  DRAKE_DEMAND(Lambda_inv != nullptr);
+  DRAKE_DEMAND(Lambda_inv->rows() == J_task.rows());
+  DRAKE_DEMAND(Lambda_inv->cols() == J_task.rows());
+
+  // With M = Lᵀ D L we write Λ⁻¹ = J M⁻¹ Jᵀ = Z D⁻¹ Zᵀ, with Z = J L⁻¹.
+  // Each row z of Z is found from Lᵀ zᵀ = jᵀ, with j the corresponding row of
+  // J, by back-substitution along the parent array λ. This back-substitution
+  // only propagates entries of jᵀ towards the root of the tree and therefore
+  // it preserves the sparsity of task Jacobians, which are non-zero only on
+  // the kinematic path of their frame. M is neither inverted nor factorized
+  // densely. See [Featherstone 2008, §6.5].
+  const int nv = num_velocities();
+  const int num_rows = J_task.rows();
+  MatrixX<T> LTDL(nv, nv);
+  CalcMassMatrixLtdlFactorization(context, &LTDL);
+  const std::vector<int>& lambda = topology_.velocity_parents();
+  MatrixX<T> Zt = J_task.transpose();
+  for (int r = 0; r < num_rows; ++r) {
+    auto z = Zt.col(r);
+    for (int i = nv - 1; i >= 0; --i) {
+      for (int j = lambda[i]; j >= 0; j = lambda[j]) {
+        z(j) -= LTDL(i, j) * z(i);
+      }
+    }
+  }
+  const VectorX<T> D_inv = LTDL.diagonal().cwiseInverse();
+  *Lambda_inv = Zt.transpose() * D_inv.asDiagonal() * Zt;
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -899,6 +1165,65 @@ void MultibodyTree<T>::CalcBiasTerm(
                       &A_WB_array, &F_BMo_W_array, Cv);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcBiasTermVelocityJacobian(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> Cv_v) const {
+  DRAKE_DEMAND(Cv_v != nullptr);
+  DRAKE_DEMAND(Cv_v->rows() == num_velocities());
+  DRAKE_DEMAND(Cv_v->cols() == num_velocities());
+
+  // For a fixed q, the bias term is a quadratic form in v. That is,
+  // C(q, v)v = B(v, v) with B a symmetric bilinear form. Therefore its
+  // Jacobian's j-th column is 2 B(v, eⱼ) which, with v± = v ± eⱼ, is exactly:
+  //   ∂(C(q, v)v)/∂vⱼ = (C(q, v⁺)v⁺ - C(q, v⁻)v⁻) / 2
+  // This is not a finite difference approximation; it only incurs round-off
+  // errors. Each column costs two O(n) inverse dynamics evaluations, in T.
+  const int nv = num_velocities();
+  std::unique_ptr<systems::Context<T>> scratch = context.Clone();
+  const VectorX<T> v = get_velocities(context);
+  VectorX<T> Cv_plus(nv);
+  VectorX<T> Cv_minus(nv);
+  for (int j = 0; j < nv; ++j) {
+    VectorX<T> v_perturbed = v;
+    v_perturbed(j) += 1.0;
+    get_mutable_velocities(scratch.get()) = v_perturbed;
+    CalcBiasTerm(*scratch, &Cv_plus);
+    v_perturbed(j) -= 2.0;
+    get_mutable_velocities(scratch.get()) = v_perturbed;
+    CalcBiasTerm(*scratch, &Cv_minus);
+    Cv_v->col(j) = (Cv_plus - Cv_minus) / 2.0;
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsPartials(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> vdot_v,
+    EigenPtr<MatrixX<T>> vdot_tau) const {
+  DRAKE_DEMAND(vdot_v != nullptr);
+  DRAKE_DEMAND(vdot_v->rows() == num_velocities());
+  DRAKE_DEMAND(vdot_v->cols() == num_velocities());
+  DRAKE_DEMAND(vdot_tau != nullptr);
+  DRAKE_DEMAND(vdot_tau->rows() == num_velocities());
+  DRAKE_DEMAND(vdot_tau->cols() == num_velocities());
+
+  // Differentiating M(q)v̇ + C(q, v)v = tau with q and tau fixed gives
+  // M ∂v̇/∂v = -∂(C(q, v)v)/∂v, and with q and v fixed gives M ∂v̇/∂tau = I.
+  // See [Carpentier and Mansard, 2018].
+  const int nv = num_velocities();
+  MatrixX<T> LTDL(nv, nv);
+  CalcMassMatrixLtdlFactorization(context, &LTDL);
+  CalcBiasTermVelocityJacobian(context, vdot_v);
+  VectorX<T> x(nv);
+  for (int j = 0; j < nv; ++j) {
+    x = -vdot_v->col(j);
+    SolveWithMassMatrixLtdlFactorization(LTDL, &x);
+    vdot_v->col(j) = x;
+    x = VectorX<T>::Unit(nv, j);
+    SolveWithMassMatrixLtdlFactorization(LTDL, &x);
+    vdot_tau->col(j) = x;
+  }
+}
+
 template <typename T>
 VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
     const systems::Context<T>& context) const {
@@ -1308,6 +1633,97 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcJacobianSpatialVelocityOnKinematicPath(
+    const systems::Context<T>& context,
+    const Frame<T>& frame_B,
+    const Eigen::Ref<const Vector3<T>>& p_BP,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    std::vector<int>* velocity_indices,
+    MatrixX<T>* Jv_V_ABp_E_path) const {
+  DRAKE_THROW_UNLESS(velocity_indices != nullptr);
+  DRAKE_THROW_UNLESS(Jv_V_ABp_E_path != nullptr);
+
+  Vector3<T> p_WP;
+  CalcPointsPositions(context, frame_B, p_BP, /* From frame B */
+                      world_frame(), &p_WP);  /* To world frame W */
+
+  // As in CalcJacobianSpatialVelocity(), V_ABp_W = (Jv_WBp - Jv_WAp)⋅v. The
+  // columns of the mobilities inboard of the closest common ancestor of A and
+  // B are the same in Jv_WBp and Jv_WAp, and they cancel out. Therefore only
+  // the nodes in the kinematic path between A and B contribute, with a
+  // positive sign for those inboard of B and a negative sign for those
+  // inboard of A.
+  std::vector<BodyNodeIndex> path_A;
+  topology_.GetKinematicPathToWorld(frame_A.body().node_index(), &path_A);
+  std::vector<BodyNodeIndex> path_B;
+  topology_.GetKinematicPathToWorld(frame_B.body().node_index(), &path_B);
+  size_t num_common_nodes = 0;
+  while (num_common_nodes < path_A.size() &&
+         num_common_nodes < path_B.size() &&
+         path_A[num_common_nodes] == path_B[num_common_nodes]) {
+    ++num_common_nodes;
+  }
+  std::vector<std::pair<BodyNodeIndex, double>> path_nodes;
+  for (size_t i = num_common_nodes; i < path_A.size(); ++i) {
+    path_nodes.emplace_back(path_A[i], -1.0);
+  }
+  for (size_t i = num_common_nodes; i < path_B.size(); ++i) {
+    path_nodes.emplace_back(path_B[i], 1.0);
+  }
+  // Sort by velocity index, so that velocity_indices is sorted on output.
+  std::sort(path_nodes.begin(), path_nodes.end(),
+            [this](const std::pair<BodyNodeIndex, double>& node1,
+                   const std::pair<BodyNodeIndex, double>& node2) {
+              return body_nodes_[node1.first]->get_topology()
+                         .mobilizer_velocities_start_in_v <
+                     body_nodes_[node2.first]->get_topology()
+                         .mobilizer_velocities_start_in_v;
+            });
+
+  int num_columns = 0;
+  for (const auto& path_node : path_nodes) {
+    num_columns += body_nodes_[path_node.first]->get_num_mobilizer_velocities();
+  }
+  velocity_indices->clear();
+  velocity_indices->reserve(num_columns);
+  Jv_V_ABp_E_path->resize(6, num_columns);
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+  int column = 0;
+  for (const auto& path_node : path_nodes) {
+    const BodyNode<T>& node = *body_nodes_[path_node.first];
+    const int start_in_v = node.get_topology().mobilizer_velocities_start_in_v;
+    const Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    // Position from Bo to point P, expressed in world W.
+    const Vector3<T> p_BoP_W = p_WP - pc.get_X_WB(node.index()).translation();
+    for (int i = 0; i < node.get_num_mobilizer_velocities(); ++i) {
+      // Each column of H_PB_W is the spatial velocity of Bo in P due to a
+      // unit value of one of B's mobilities. Shift it to P.
+      const SpatialVelocity<T> Hi_PBo_W(H_PB_W.col(i));
+      Jv_V_ABp_E_path->col(column) =
+          path_node.second * Hi_PBo_W.Shift(p_BoP_W).get_coeffs();
+      velocity_indices->push_back(start_in_v + i);
+      ++column;
+    }
+  }
+
+  // If the expressed-in frame E is not the world frame, we need to perform
+  // an additional operation.
+  if (frame_E.index() != world_frame().index()) {
+    const RotationMatrix<T> R_EW =
+        CalcRelativeRotationMatrix(context, frame_E, world_frame());
+    Jv_V_ABp_E_path->template topRows<3>() =
+        R_EW * Jv_V_ABp_E_path->template topRows<3>();
+    Jv_V_ABp_E_path->template bottomRows<3>() =
+        R_EW * Jv_V_ABp_E_path->template bottomRows<3>();
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianAngularVelocity(
     const systems::Context<T>& context,
@@ -1732,6 +2148,65 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcArticulatedBodyForwardDynamics(
+    const systems::Context<T>& context,
+    const MultibodyForces<T>& forces,
+    EigenPtr<VectorX<T>> vdot) const {
+  DRAKE_DEMAND(vdot != nullptr);
+  DRAKE_DEMAND(vdot->size() == num_velocities());
+  DRAKE_DEMAND(forces.CheckHasRightSizeForModel(*this));
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  const ArticulatedBodyInertiaCache<T>& abc =
+      EvalArticulatedBodyInertiaCache(context);
+  const std::vector<SpatialForce<T>>& b_Bo_W_cache =
+      EvalDynamicBiasCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+  const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array =
+      forces.body_forces();
+  const VectorX<T>& tau_applied_array = forces.generalized_forces();
+
+  // Workspace, indexed by BodyNodeIndex. The entries for the world stay zero.
+  std::vector<SpatialAcceleration<T>> Ab_WB_array(
+      num_bodies(), SpatialAcceleration<T>::Zero());
+  std::vector<SpatialForce<T>> zplus_PB_W_array(num_bodies());
+  std::vector<SpatialAcceleration<T>> A_WB_array(
+      num_bodies(), SpatialAcceleration<T>::Zero());
+  // Innovations generalized forces, indexed like v.
+  VectorX<T> e_B_array(num_velocities());
+
+  // Tip-to-base recursion for the articulated body bias forces, skipping the
+  // world.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      const int start = node.get_topology().mobilizer_velocities_start_in_v;
+      const int nv = node.get_num_mobilizer_velocities();
+
+      node.CalcSpatialAccelerationBias(context, pc, vc, &Ab_WB_array);
+      node.CalcArticulatedBodyForceBias_TipToBase(
+          pc, abc, Ab_WB_array, b_Bo_W_cache,
+          Fapplied_Bo_W_array[body_node_index],
+          tau_applied_array.segment(start, nv),
+          node.GetJacobianFromArray(H_PB_W_cache), &zplus_PB_W_array,
+          &e_B_array);
+    }
+  }
+
+  // Base-to-tip recursion for the accelerations, skipping the world.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          pc, abc, Ab_WB_array, e_B_array,
+          node.GetJacobianFromArray(H_PB_W_cache), &A_WB_array, vdot);
+    }
+  }
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
@@ -1208,6 +1208,28 @@ class MultibodyTree {
       const Frame<T>& frame_F,
       const Frame<T>& frame_G) const;
 
+  /// See MultibodyPlant method.
+  void CalcBatchFramePosesInWorld(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const std::vector<const Frame<T>*>& frames,
+      std::vector<math::RigidTransform<T>>* X_WF_batch,
+      int num_threads = 1) const;
+
+  /// See MultibodyPlant method.
+  void set_kinematics_parallelism(int num_threads, int min_parallel_level_size);
+
+  /// Returns the maximum number of threads used by the kinematics recursions.
+  /// @see set_kinematics_parallelism().
+  int get_kinematics_num_threads() const { return kinematics_num_threads_; }
+
+  /// Returns the minimum number of nodes in a tree level for the kinematics
+  /// recursions to process that level in parallel.
+  /// @see set_kinematics_parallelism().
+  int get_kinematics_min_parallel_level_size() const {
+    return kinematics_min_parallel_level_size_;
+  }
+
   /// See MultibodyPlant method.
   math::RotationMatrix<T> CalcRelativeRotationMatrix(
       const systems::Context<T>& context,
@@ -1319,6 +1341,14 @@ class MultibodyTree {
       const Frame<T>& frame_A, const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Jw_ABp_E) const;
 
+  /// See MultibodyPlant method.
+  void CalcJacobianSpatialVelocityOnKinematicPath(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
+      const Frame<T>& frame_A, const Frame<T>& frame_E,
+      std::vector<int>* velocity_indices,
+      MatrixX<T>* Jv_V_ABp_E_path) const;
+
   /// See MultibodyPlant method.
   void CalcJacobianAngularVelocity(const systems::Context<T>& context,
                                    JacobianWrtVariable with_respect_to,
@@ -1649,10 +1679,53 @@ class MultibodyTree {
   void CalcMassMatrixViaInverseDynamics(
       const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
 
+  /// See MultibodyPlant method.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> M) const;
+
+  /// See MultibodyPlant method.
+  void CalcMassMatrixLtdlFactorization(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> LTDL) const;
+
+  /// See MultibodyPlant method.
+  void SolveWithMassMatrixLtdlFactorization(
+      const Eigen::Ref<const MatrixX<T>>& LTDL,
+      EigenPtr<VectorX<T>> x) const;
+
+  /// See MultibodyPlant method.
+  void CalcOperationalSpaceInertiaInverse(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& J_task,
+      EigenPtr<MatrixX<T>> Lambda_inv) const;
+
+  /// Computes the composite body inertia `Mc_B_W` of each body B in the
+  /// model, about Bo and expressed in the world frame W. The composite body
+  /// inertia of B is the spatial inertia of B and all its outboard bodies,
+  /// rigidly locked in their current configuration.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[out] Mc_B_W_all
+  ///   On output, the composite body inertia of each body, indexed by
+  ///   BodyNodeIndex. It must be a valid (non-null) pointer to a vector of
+  ///   size num_bodies(). The entry for the world body is left unchanged.
+  void CalcCompositeBodyInertiasInWorld(
+      const systems::Context<T>& context,
+      std::vector<SpatialInertia<T>>* Mc_B_W_all) const;
+
   /// See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
 
+  /// See MultibodyPlant method.
+  void CalcBiasTermVelocityJacobian(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> Cv_v) const;
+
+  /// See MultibodyPlant method.
+  void CalcForwardDynamicsPartials(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> vdot_v,
+      EigenPtr<MatrixX<T>> vdot_tau) const;
+
   /// See MultibodyPlant method.
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
@@ -1694,6 +1767,31 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       ArticulatedBodyInertiaCache<T>* abc) const;
 
+  /// Computes the generalized accelerations `vdot` of the model for the state
+  /// stored in `context` and the given applied `forces` with the O(n)
+  /// articulated body algorithm, where n is the number of bodies. That is, it
+  /// solves the equations of motion:
+  ///   M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// for v̇ without forming the mass matrix M(q). The articulated body inertias
+  /// only depend on q and are evaluated from a cache entry in `context`, so that
+  /// they are reused by subsequent calls with the same configuration.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] forces
+  ///   The applied generalized forces `tau_app` and spatial forces `Fapp_Bo_W`
+  ///   on each body, including the force elements' contributions.
+  /// @param[out] vdot
+  ///   The generalized accelerations. It must not be nullptr and it must have
+  ///   size num_velocities().
+  ///
+  /// @throws std::exception if the articulated body hinge inertia of any body
+  /// is singular, see CalcArticulatedBodyInertiaCache().
+  void CalcArticulatedBodyForwardDynamics(
+      const systems::Context<T>& context,
+      const MultibodyForces<T>& forces,
+      EigenPtr<VectorX<T>> vdot) const;
+
   /// @}
   // Closes "Computational methods" Doxygen section.
 
@@ -1935,6 +2033,9 @@ class MultibodyTree {
     tree_clone->actuator_name_to_index_ = this->actuator_name_to_index_;
     tree_clone->instance_name_to_index_ = this->instance_name_to_index_;
     tree_clone->instance_index_to_name_ = this->instance_index_to_name_;
+    tree_clone->kinematics_num_threads_ = this->kinematics_num_threads_;
+    tree_clone->kinematics_min_parallel_level_size_ =
+        this->kinematics_min_parallel_level_size_;
 
     // All other internals templated on T are created with the following call to
     // FinalizeInternals().
@@ -2217,6 +2318,15 @@ class MultibodyTree {
     return tree_system_->EvalDynamicBiasCache(context);
   }
 
+  // Evaluates the cache entry stored in context with the articulated body
+  // inertia quantities, which depend only on q. These will be updated as
+  // needed.
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    DRAKE_ASSERT(tree_system_ != nullptr);
+    return tree_system_->EvalArticulatedBodyInertiaCache(context);
+  }
+
   // Given the state of this model in `context` and a known vector
   // of generalized accelerations `known_vdot`, this method computes the
   // spatial acceleration `A_WB` for each body as measured and expressed in the
@@ -2315,6 +2425,15 @@ class MultibodyTree {
 
   void CreateBodyNode(BodyNodeIndex body_node_index);
 
+  // Evaluates `calc_node(node)` for every node in the given `level` of the
+  // tree. Nodes within a level are independent of each other, therefore they
+  // are split among up to kinematics_num_threads_ threads when the level has
+  // at least kinematics_min_parallel_level_size_ nodes. `calc_node` must only
+  // write the entries for its own node.
+  template <typename NodeCalc>
+  void ForEachBodyNodeInLevel(int level, const NodeCalc& calc_node) const;
+
+
   void CreateModelInstances();
 
   // Helper method to create a clone of `frame` and add it to `this` tree.
@@ -2511,6 +2630,13 @@ class MultibodyTree {
   // in that level.
   std::vector<std::vector<BodyNodeIndex>> body_node_levels_;
 
+  // The maximum number of threads used to process the nodes of a level in the
+  // position and velocity kinematics recursions, and the minimum number of
+  // nodes a level must have to be processed in parallel.
+  // See set_kinematics_parallelism().
+  int kinematics_num_threads_{1};
+  int kinematics_min_parallel_level_size_{256};
+
   MultibodyTreeTopology topology_;
 
   const MultibodyTreeSystem<T>* tree_system_{};
@@ -7,6 +7,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/velocity_kinematics_cache.h"
@@ -132,7 +133,15 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
         .template Eval<std::vector<Vector6<T>>>(context);
   }
 
-  // TODO(sherm1) Add ArticulatedBodyInertiaCache.
+  /** Returns a reference to the up to date ArticulatedBodyInertiaCache in the
+  given Context, recalculating it first if necessary. It stores the quantities
+  of the articulated body algorithm that depend only on the generalized
+  positions q (and parameters), such as the articulated body inertias. */
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(cache_indexes_.articulated_body_inertia)
+        .template Eval<ArticulatedBodyInertiaCache<T>>(context);
+  }
 
  protected:
   /** @name        Alternate API for derived classes
@@ -191,6 +200,7 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   // This struct stores in one single place all indexes related to
   // MultibodyTreeSystem specific cache entries.
   struct CacheIndexes {
+    systems::CacheIndex articulated_body_inertia;
     systems::CacheIndex dynamic_bias;
     systems::CacheIndex across_node_jacobians;
     systems::CacheIndex position_kinematics;
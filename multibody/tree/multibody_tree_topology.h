@@ -455,6 +455,7 @@ class MultibodyTreeTopology {
     if (force_elements_ != other.force_elements_) return false;
     if (joint_actuators_ != other.joint_actuators_) return false;
     if (body_nodes_ != other.body_nodes_) return false;
+    if (velocity_parents_ != other.velocity_parents_) return false;
 
     return true;
   }
@@ -873,6 +874,33 @@ class MultibodyTreeTopology {
       }
     }
 
+    // The BFT ordering of the nodes guarantees that the generalized velocities
+    // of a node are numbered after those of all of its ancestors. Therefore
+    // each velocity's parent (see velocity_parents()) has a smaller index.
+    velocity_parents_.assign(num_velocities_, -1);
+    for (BodyNodeIndex node_index(1);
+         node_index < get_num_body_nodes(); ++node_index) {
+      const BodyNodeTopology& node = body_nodes_[node_index];
+      if (node.num_mobilizer_velocities == 0) continue;
+      // The last velocity of the closest ancestor that is not welded to its
+      // parent, or -1 if there is none.
+      int parent_velocity = -1;
+      for (BodyNodeIndex ancestor = node.parent_body_node;
+           ancestor > BodyNodeIndex(0) && parent_velocity < 0;
+           ancestor = body_nodes_[ancestor].parent_body_node) {
+        const BodyNodeTopology& ancestor_node = body_nodes_[ancestor];
+        if (ancestor_node.num_mobilizer_velocities > 0) {
+          parent_velocity = ancestor_node.mobilizer_velocities_start_in_v +
+                            ancestor_node.num_mobilizer_velocities - 1;
+        }
+      }
+      const int start = node.mobilizer_velocities_start_in_v;
+      velocity_parents_[start] = parent_velocity;
+      for (int i = 1; i < node.num_mobilizer_velocities; ++i) {
+        velocity_parents_[start + i] = start + i - 1;
+      }
+    }
+
     // We are done with a successful Finalize() and we mark it as so.
     // Do not add any more code after this!
     is_valid_ = true;
@@ -894,6 +922,23 @@ class MultibodyTreeTopology {
   /// Returns the total number of actuated joint dofs in the model.
   int num_actuated_dofs() const { return num_actuated_dofs_; }
 
+  /// Returns the "parent array" λ of the generalized velocities in the model,
+  /// see [Featherstone 2008, §6.5]. For the i-th generalized velocity, λ(i) is
+  /// the index of the generalized velocity that immediately precedes it in
+  /// the kinematic path to the world, or -1 if there is none. Velocities of
+  /// the same mobilizer form a chain, with the first of them parented to the
+  /// last velocity of the closest non-welded ancestor. By construction
+  /// λ(i) < i. Entries `(i, j)` of the mass matrix of the model can only be
+  /// non-zero when j is i or one of its ancestors in λ, or vice versa.
+  /// This method can only be called after Finalize().
+  ///
+  /// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  ///                       algorithms. Springer.
+  const std::vector<int>& velocity_parents() const {
+    DRAKE_DEMAND(is_valid());
+    return velocity_parents_;
+  }
+
   /// Given a node in `this` topology, specified by its BodyNodeIndex `from`,
   /// this method computes the kinematic path formed by all the nodes in the
   /// tree that connect `from` with the root (corresponding to the world).
@@ -1061,6 +1106,9 @@ class MultibodyTreeTopology {
   int num_velocities_{0};
   int num_states_{0};
   int num_actuated_dofs_{0};
+
+  // The parent of each generalized velocity, see velocity_parents().
+  std::vector<int> velocity_parents_;
 };
 
 }  // namespace internal
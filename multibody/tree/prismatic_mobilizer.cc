@@ -4,6 +4,7 @@
 #include <stdexcept>
 
 #include "drake/common/autodiff.h"
+#include "drake/multibody/tree/body_node_impl.h"
 #include "drake/multibody/tree/multibody_tree.h"
 
 namespace drake {
@@ -147,6 +148,15 @@ PrismaticMobilizer<T>::DoCloneToScalar(
   return TemplatedDoCloneToScalar(tree_clone);
 }
 
+template <typename T>
+std::unique_ptr<BodyNode<T>> PrismaticMobilizer<T>::CreateBodyNode(
+    const BodyNode<T>* parent_node,
+    const Body<T>* body, const Mobilizer<T>* mobilizer) const {
+  DRAKE_DEMAND(mobilizer == this);
+  return std::make_unique<BodyNodeImpl<T, PrismaticMobilizer>>(
+      parent_node, body, this);
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
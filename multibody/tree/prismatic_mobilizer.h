@@ -160,6 +160,12 @@ class PrismaticMobilizer final : public MobilizerImpl<T, 1, 1> {
       const Eigen::Ref<const VectorX<T>>& qdot,
       EigenPtr<VectorX<T>> v) const final;
 
+  /// For MultibodyTree internal use only. Creates a BodyNodeImpl that calls
+  /// this mobilizer's across-mobilizer operators directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
                      EigenPtr<MatrixX<T>> N) const final;
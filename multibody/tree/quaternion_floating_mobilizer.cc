@@ -5,6 +5,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/math/quaternion.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/multibody/tree/body_node_impl.h"
 #include "drake/multibody/tree/multibody_tree.h"
 
 namespace drake {
@@ -402,6 +403,15 @@ QuaternionFloatingMobilizer<T>::DoCloneToScalar(
   return TemplatedDoCloneToScalar(tree_clone);
 }
 
+template <typename T>
+std::unique_ptr<BodyNode<T>> QuaternionFloatingMobilizer<T>::CreateBodyNode(
+    const BodyNode<T>* parent_node,
+    const Body<T>* body, const Mobilizer<T>* mobilizer) const {
+  DRAKE_DEMAND(mobilizer == this);
+  return std::make_unique<BodyNodeImpl<T, QuaternionFloatingMobilizer>>(
+      parent_node, body, this);
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
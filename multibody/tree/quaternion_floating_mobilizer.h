@@ -216,6 +216,12 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
       EigenPtr<VectorX<T>> v) const override;
   /// @}
 
+  /// For MultibodyTree internal use only. Creates a BodyNodeImpl that calls
+  /// this mobilizer's across-mobilizer operators directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   /// Sets `state` to store a configuration in which M coincides with F (i.e.
   /// q_FM is the identity quaternion).
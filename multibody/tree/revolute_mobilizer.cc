@@ -3,6 +3,7 @@
 #include <memory>
 #include <stdexcept>
 
+#include "drake/multibody/tree/body_node_impl.h"
 #include "drake/multibody/tree/multibody_tree.h"
 
 namespace drake {
@@ -148,6 +149,15 @@ RevoluteMobilizer<T>::DoCloneToScalar(
   return TemplatedDoCloneToScalar(tree_clone);
 }
 
+template <typename T>
+std::unique_ptr<BodyNode<T>> RevoluteMobilizer<T>::CreateBodyNode(
+    const BodyNode<T>* parent_node,
+    const Body<T>* body, const Mobilizer<T>* mobilizer) const {
+  DRAKE_DEMAND(mobilizer == this);
+  return std::make_unique<BodyNodeImpl<T, RevoluteMobilizer>>(
+      parent_node, body, this);
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -748,6 +748,32 @@ class RotationalInertia {
   ///@}
 
  protected:
+  /// Calculates the rotational inertia that must be added to account for
+  /// shifting the rotational inertia for a unit-mass body (or composite body)
+  /// B from about-point P to about-point Q via Bcm (B's center of mass).  In
+  /// other words, returns `I_BQ_E - I_BP_E` (both are expressed-in frame E).
+  /// The result is computed in a single pass over the six moments and
+  /// products of inertia, without forming the two point-mass inertias whose
+  /// difference it is, and therefore it is not necessarily physically valid.
+  /// @param p_PBcm_E Position vector from P to Bcm, expressed-in frame E.
+  /// @param p_QBcm_E Position vector from Q to Bcm, expressed-in frame E.
+  /// @remark Negating either (or both) position vectors p_PBcm_E and p_QBcm_E
+  ///         has no affect on the result.
+  static RotationalInertia<T> ShiftUnitMassBodyToThenAwayFromCenterOfMass(
+      const Vector3<T>& p_PBcm_E, const Vector3<T>& p_QBcm_E) {
+    // Concept: Shift towards then away from the center of mass.
+    // Math: Shift away from then towards the center of mass, that is, the
+    // point-mass inertia for p_QBcm_E minus the one for p_PBcm_E.
+    const Vector3<T> d = p_QBcm_E.cwiseAbs2() - p_PBcm_E.cwiseAbs2();
+    RotationalInertia<T> shift;
+    shift.set_moments_and_products_no_validity_check(
+        d(1) + d(2), d(0) + d(2), d(0) + d(1),
+        p_PBcm_E(0) * p_PBcm_E(1) - p_QBcm_E(0) * p_QBcm_E(1),
+        p_PBcm_E(0) * p_PBcm_E(2) - p_QBcm_E(0) * p_QBcm_E(2),
+        p_PBcm_E(1) * p_PBcm_E(2) - p_QBcm_E(1) * p_QBcm_E(2));
+    return shift;
+  }
+
   /// Subtracts a rotational inertia `I_BP_E` from `this` rotational inertia.
   /// No check is done to determine if the result is physically valid.
   /// @param I_BP_E Rotational inertia of a body (or composite body) B to
@@ -850,15 +876,6 @@ class RotationalInertia {
   //         returns I_BQ_E - I_BP_E, expressed-in frame E.
   // @remark Negating either (or both) position vectors p_PBcm_E and p_QBcm_E
   //         has no affect on the result.
-  RotationalInertia<T> ShiftUnitMassBodyToThenAwayFromCenterOfMass(
-      const Vector3<T>& p_PBcm_E, const Vector3<T>& p_QBcm_E) {
-    // Concept: Shift towards then away from the center of mass.
-    // Math: Shift away from then towards the center of mass.
-    RotationalInertia shift_away(p_QBcm_E, p_QBcm_E);
-    RotationalInertia shift_towards(p_PBcm_E, p_PBcm_E);
-    return shift_away.MinusEqualsUnchecked(shift_towards);
-  }
-
   // This function returns true if arguments `i` and `j` access the lower-
   // triangular portion of the rotational matrix, otherwise false.
   static constexpr bool is_lower_triangular_order(int i, int j) {
@@ -6,6 +6,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/tree/body_node_impl.h"
 #include "drake/multibody/tree/multibody_tree.h"
 
 namespace drake {
@@ -355,6 +356,15 @@ SpaceXYZMobilizer<T>::DoCloneToScalar(
   return TemplatedDoCloneToScalar(tree_clone);
 }
 
+template <typename T>
+std::unique_ptr<BodyNode<T>> SpaceXYZMobilizer<T>::CreateBodyNode(
+    const BodyNode<T>* parent_node,
+    const Body<T>* body, const Mobilizer<T>* mobilizer) const {
+  DRAKE_DEMAND(mobilizer == this);
+  return std::make_unique<BodyNodeImpl<T, SpaceXYZMobilizer>>(
+      parent_node, body, this);
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -252,6 +252,12 @@ class SpaceXYZMobilizer final : public MobilizerImpl<T, 3, 3> {
       EigenPtr<VectorX<T>> v) const override;
 
 
+  /// For MultibodyTree internal use only. Creates a BodyNodeImpl that calls
+  /// this mobilizer's across-mobilizer operators directly.
+  std::unique_ptr<internal::BodyNode<T>> CreateBodyNode(
+      const internal::BodyNode<T>* parent_node,
+      const Body<T>* body, const Mobilizer<T>* mobilizer) const final;
+
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
                      EigenPtr<MatrixX<T>> N) const final;
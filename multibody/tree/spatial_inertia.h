@@ -323,11 +323,10 @@ class SpatialInertia {
   ///          S but now computed about about a new point Q.
   SpatialInertia& ShiftInPlace(const Vector3<T>& p_PQ_E) {
     const Vector3<T> p_QScm_E = p_PScm_E_ - p_PQ_E;
-    // The following two lines apply the parallel axis theorem (in place) so
-    // that:
+    // Apply the parallel axis theorem (in place) so that:
     //   G_SQ = G_SP + px_QScm² - px_PScm²
-    G_SP_E_.ShiftFromCenterOfMassInPlace(p_QScm_E);
-    G_SP_E_.ShiftToCenterOfMassInPlace(p_PScm_E_);
+    // with a single update of the moments and products of inertia.
+    G_SP_E_.ShiftToThenAwayFromCenterOfMassInPlace(p_PScm_E_, p_QScm_E);
     p_PScm_E_ = p_QScm_E;
     // This would only mean a bug in the implementation. The Shift operation
     // should always lead to a valid spatial inertia.
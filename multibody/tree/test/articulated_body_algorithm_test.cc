@@ -3,11 +3,14 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/tree/frame.h"
 #include "drake/multibody/tree/mobilizer_impl.h"
+#include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/space_xyz_mobilizer.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/unit_inertia.h"
@@ -18,6 +21,7 @@ namespace multibody {
 namespace internal {
 namespace {
 
+using Eigen::MatrixXd;
 using Eigen::Vector3d;
 using Eigen::VectorXd;
 using systems::Context;
@@ -363,6 +367,75 @@ GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ModifiedFeatherstoneExample) {
       P_WB_W_actual.CopyToFullMatrix6(), kEpsilon));
 }
 
+// Verifies the generalized accelerations computed by the articulated body
+// algorithm against those obtained from the mass matrix and inverse dynamics,
+// for a branched tree with non-zero velocities and applied forces.
+GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ForwardDynamics) {
+  auto tree_owned = std::make_unique<MultibodyTree<double>>();
+  auto& tree = *tree_owned;
+  const Frame<double>& world_frame = tree.world_frame();
+
+  // A box B on a SpaceXYZ mobilizer, with a cylinder C on a Featherstone
+  // mobilizer and a rod R on a revolute mobilizer as its children. A second
+  // rod S, whose center of mass is offset from its origin, hangs from C.
+  const SpatialInertia<double> M_Bcm(
+      2.4, Vector3d::Zero(), UnitInertia<double>::SolidBox(0.5, 1.2, 1.6));
+  const SpatialInertia<double> M_Ccm(
+      0.6, Vector3d::Zero(),
+      UnitInertia<double>::SolidCylinder(0.3, 0.3, Vector3d::UnitX()));
+  const SpatialInertia<double> M_Ro =
+      SpatialInertia<double>::MakeFromCentralInertia(
+          0.5, Vector3d(0, 0, -0.4),
+          RotationalInertia<double>(0.015, 0.015, 0.0005));
+  const RigidBody<double>& box = tree.AddBody<RigidBody>(M_Bcm);
+  const RigidBody<double>& cylinder = tree.AddBody<RigidBody>(M_Ccm);
+  const RigidBody<double>& rod = tree.AddBody<RigidBody>(M_Ro);
+  const RigidBody<double>& rod2 = tree.AddBody<RigidBody>(M_Ro);
+  tree.AddMobilizer<SpaceXYZMobilizer>(world_frame, box.body_frame());
+  tree.AddMobilizer<FeatherstoneMobilizer>(box.body_frame(),
+                                           cylinder.body_frame());
+  tree.AddMobilizer<RevoluteMobilizer>(box.body_frame(), rod.body_frame(),
+                                       Vector3d(0, 1, 1).normalized());
+  tree.AddMobilizer<RevoluteMobilizer>(cylinder.body_frame(),
+                                       rod2.body_frame(), Vector3d::UnitX());
+
+  MultibodyTreeSystem<double> system(std::move(tree_owned));
+  auto context = system.CreateDefaultContext();
+  const int nq = tree.num_positions();
+  const int nv = tree.num_velocities();
+  ASSERT_EQ(nv, 7);
+  tree.GetMutablePositionsAndVelocities(context.get()) <<
+      VectorXd::LinSpaced(nq, -0.9, 1.3), VectorXd::LinSpaced(nv, 1.1, -2.0);
+
+  MultibodyForces<double> forces(tree);
+  forces.mutable_generalized_forces() = VectorXd::LinSpaced(nv, -1.0, 3.0);
+  for (int i = 0; i < tree.num_bodies(); ++i) {
+    forces.mutable_body_forces()[i] = SpatialForce<double>(
+        Vector3d(0.1 * i, -0.2, 0.3), Vector3d(-0.5, 0.4 * i, 0.2));
+  }
+  // The world is not affected by the applied forces.
+  forces.mutable_body_forces()[0].SetZero();
+
+  VectorXd vdot(nv);
+  tree.CalcArticulatedBodyForwardDynamics(*context, forces, &vdot);
+
+  // M v̇ = -tau_id, where tau_id = C(q, v)v - tau_app - ∑ J_WBᵀ Fapp_Bo_W are
+  // the generalized forces that the inverse dynamics reports for v̇ = 0.
+  MatrixXd M(nv, nv);
+  tree.CalcMassMatrixViaInverseDynamics(*context, &M);
+  const VectorXd tau_id =
+      tree.CalcInverseDynamics(*context, VectorXd::Zero(nv), forces);
+  const VectorXd vdot_expected = M.ldlt().solve(-tau_id);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, 1e-12,
+                              MatrixCompareType::relative));
+
+  // The inverse dynamics for the computed accelerations requires no
+  // additional generalized forces.
+  EXPECT_TRUE(CompareMatrices(
+      tree.CalcInverseDynamics(*context, vdot, forces), VectorXd::Zero(nv),
+      1e-12, MatrixCompareType::absolute));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
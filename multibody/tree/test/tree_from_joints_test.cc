@@ -259,6 +259,12 @@ class PendulumTests : public ::testing::Test {
 
     EXPECT_TRUE(CompareMatrices(
         H, H_expected, kTolerance, MatrixCompareType::relative));
+
+    // Mass matrix computed with the composite rigid body algorithm.
+    Matrix2d M;
+    tree().CalcMassMatrix(*context_, &M);
+    EXPECT_TRUE(CompareMatrices(
+        M, H_expected, kTolerance, MatrixCompareType::relative));
   }
 
   // For the double pendulum model under test, it verifies the result returned
@@ -375,6 +375,22 @@ GTEST_TEST(UnitInertia, ShiftFromCenterOfMassInPlace) {
   EXPECT_TRUE(G3.CouldBePhysicallyValid());
 }
 
+// Tests that ShiftToThenAwayFromCenterOfMassInPlace() agrees with shifting to
+// the center of mass and then away from it.
+GTEST_TEST(UnitInertia, ShiftToThenAwayFromCenterOfMassInPlace) {
+  const Vector3<double> p_PBcm_E(0.3, -0.5, 1.2);
+  const Vector3<double> p_QBcm_E(-0.7, 0.2, 0.4);
+  const UnitInertia<double> G_BP_E =
+      UnitInertia<double>::SolidBox(1.0, 2.0, 3.0).ShiftFromCenterOfMass(
+          -p_PBcm_E);
+  const UnitInertia<double> G_BQ_E_expected =
+      G_BP_E.ShiftToCenterOfMass(p_PBcm_E).ShiftFromCenterOfMass(-p_QBcm_E);
+  UnitInertia<double> G_BQ_E = G_BP_E;
+  G_BQ_E.ShiftToThenAwayFromCenterOfMassInPlace(p_PBcm_E, p_QBcm_E);
+  EXPECT_TRUE(G_BQ_E.CopyToFullMatrix3().isApprox(
+      G_BQ_E_expected.CopyToFullMatrix3(), kEpsilon));
+}
+
 // Tests that we can correctly cast a UnitInertia<double> to a UnitInertia
 // templated on an AutoDiffScalar type.
 // The cast from a UnitInertia<double>, a constant, results in a unit inertia
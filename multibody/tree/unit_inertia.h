@@ -121,6 +121,27 @@ class UnitInertia : public RotationalInertia<T> {
     return UnitInertia<T>(RotationalInertia<T>::ReExpress(R_FE));
   }
 
+  /// For the unit inertia `G_BP_E` of a body or composite body B computed about
+  /// a point P and expressed in a frame E, this method shifts this inertia
+  /// using the parallel axis theorem to be computed about a point Q. This
+  /// operation is performed in place, modifying the original object.
+  /// The result equals that of ShiftToCenterOfMassInPlace(p_PBcm_E) followed
+  /// by ShiftFromCenterOfMassInPlace(p_QBcm_E) (to within round-off), but it
+  /// only updates the moments and products of inertia once.
+  /// @param[in] p_PBcm_E A position vector from point P to the body's centroid
+  ///                     `Bcm` expressed in frame E.
+  /// @param[in] p_QBcm_E A position vector from point Q to the body's centroid
+  ///                     `Bcm` expressed in frame E.
+  /// @returns A reference to `this` unit inertia, which has now been taken
+  ///          about point Q so can be written as `G_BQ_E`.
+  UnitInertia<T>& ShiftToThenAwayFromCenterOfMassInPlace(
+      const Vector3<T>& p_PBcm_E, const Vector3<T>& p_QBcm_E) {
+    RotationalInertia<T>::operator+=(
+        RotationalInertia<T>::ShiftUnitMassBodyToThenAwayFromCenterOfMass(
+            p_PBcm_E, p_QBcm_E));
+    return *this;
+  }
+
   /// For a central unit inertia `G_Bcm_E` computed about a body's center of
   /// mass (or centroid) `Bcm` and expressed in a frame E, this method shifts
   /// this inertia using the parallel axis theorem to be computed about a
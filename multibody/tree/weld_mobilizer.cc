@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "drake/multibody/tree/body_node_impl.h"
 #include "drake/multibody/tree/multibody_tree.h"
 
 namespace drake {
@@ -97,6 +98,15 @@ WeldMobilizer<T>::DoCloneToScalar(
   return TemplatedDoCloneToScalar(tree_clone);
 }
 
+template <typename T>
+std::unique_ptr<BodyNode<T>> WeldMobilizer<T>::CreateBodyNode(
+    const BodyNode<T>* parent_node,
+    const Body<T>* body, const Mobilizer<T>* mobilizer) const {
+  DRAKE_DEMAND(mobilizer == this);
+  return std::make_unique<BodyNodeImpl<T, WeldMobilizer>>(
+      parent_node, body, this);
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -43,25 +43,72 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
+// The rays through the pixels of every `stride`'th column and row of a depth
+// image, at unit depth: the ray of the pixel (c * stride, r * stride) is
+// (ray_x(c), ray_y(r), 1) in the camera frame.
+void CalcPixelRays(const CameraInfo& camera_info, int width, int height,
+                   int stride, Eigen::RowVectorXf* ray_x,
+                   Eigen::RowVectorXf* ray_y) {
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  ray_x->resize((width + stride - 1) / stride);
+  ray_y->resize((height + stride - 1) / stride);
+  for (int c = 0; c < ray_x->size(); ++c) {
+    (*ray_x)(c) = (c * stride - cx) * fx_inv;
+  }
+  for (int r = 0; r < ray_y->size(); ++r) {
+    (*ray_y)(r) = (r * stride - cy) * fy_inv;
+  }
+}
+
 // TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
 // cloud output? (This would require adding support for colored point clouds,
 // because current implementation assume that an RGB image will still line up).
+//
+// The `ray_x` and `ray_y` precomputed by CalcPixelRays() are used if they
+// match the size of the depth image; otherwise, the rays are computed here.
 template <PixelType pixel_type>
 void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               const int stride, const Eigen::RowVectorXf& ray_x,
+               const Eigen::RowVectorXf& ray_y, PointCloud* output) {
+  using Depth = typename ImageTraits<pixel_type>::ChannelType;
+  static_assert(ImageTraits<pixel_type>::kNumChannels == 1, "");
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
+  DRAKE_DEMAND(stride >= 1);
+  if (color_image) {
+    DRAKE_THROW_UNLESS(color_image->width() == depth_image.width() &&
+                       color_image->height() == depth_image.height());
+  }
+
+  const int width = depth_image.width();
+  const int height = depth_image.height();
+  const int out_width = (width + stride - 1) / stride;
+  const int out_height = (height + stride - 1) / stride;
+  Eigen::RowVectorXf local_ray_x;
+  Eigen::RowVectorXf local_ray_y;
+  const bool rays_match =
+      (ray_x.size() == out_width) && (ray_y.size() == out_height);
+  if (!rays_match) {
+    CalcPixelRays(camera_info, width, height, stride, &local_ray_x,
+                  &local_ray_y);
+  }
+  const Eigen::RowVectorXf& rays_x = rays_match ? ray_x : local_ray_x;
+  const Eigen::RowVectorXf& rays_y = rays_match ? ray_y : local_ray_y;
 
   // Reset the output size, if necessary.  We can leave the memory
   // uninitialized iff we are going to fill it in below.
-  if (output->size() != depth_image.size()) {
+  const int num_points = out_width * out_height;
+  if (output->size() != num_points) {
     const bool skip_initialize = (output->fields().base_fields() == kXYZs);
-    output->resize(depth_image.size(), skip_initialize);
+    output->resize(num_points, skip_initialize);
   }
   Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
   optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
@@ -69,34 +116,47 @@ void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
     output_rgb = output->mutable_rgbs();
   }
 
-  const int height = depth_image.height();
-  const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
-
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+  const Eigen::Matrix3f& R_PC = X_PC.rotation().matrix();
+  const Vector3f& p_PC = X_PC.translation();
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+
+  // Each row of the image is converted at once, with coefficient-wise
+  // expressions that Eigen vectorizes. Since the point of the pixel (u, v) is
+  // p_PC + z * R_PC * (ray_x(u), ray_y(v), 1), its i'th coordinate is
+  // p_PC(i) + z * (R_PC(i, 0) * ray_x(u) + R_PC(i, 1) * ray_y(v) + R_PC(i, 2)).
+  using DepthRow = Eigen::Map<const Eigen::Array<Depth, 1, Eigen::Dynamic>, 0,
+                              Eigen::InnerStride<>>;
+  using ColorRows = Eigen::Map<const Eigen::Matrix<uint8_t, 4, Eigen::Dynamic>,
+                               0, Eigen::OuterStride<>>;
+  for (int r = 0; r < out_height; ++r) {
+    const int v = r * stride;
+    const DepthRow depth(depth_image.at(0, v), out_width,
+                         Eigen::InnerStride<>(stride));
+    auto xyz = output_xyz.middleCols(r * out_width, out_width);
+    // The scaled depth is stored in the z row first.
+    xyz.row(2).array() = depth.template cast<float>() * scale;
+    // (The z row is transformed last, since the others are computed from it.)
+    for (int i = 0; i < 3; ++i) {
+      const float ray_y_term = R_PC(i, 1) * rays_y(r) + R_PC(i, 2);
+      xyz.row(i).array() =
+          xyz.row(2).array() * (R_PC(i, 0) * rays_x.array() + ray_y_term) +
+          p_PC(i);
+    }
+    // N.B. NaN depths propagate to all three coordinates above.
+    const auto invalid = (depth == ImageTraits<pixel_type>::kTooClose) ||
+                         (depth == ImageTraits<pixel_type>::kTooFar);
+    if (invalid.any()) {
+      for (int i = 0; i < 3; ++i) {
+        xyz.row(i).array() = invalid.select(kInf, xyz.row(i).array());
       }
     }
+    if (color_image) {
+      const ColorRows color(color_image->at(0, v), 4, out_width,
+                            Eigen::OuterStride<>(4 * stride));
+      output_rgb->middleCols(r * out_width, out_width) = color.topRows<3>();
+    }
   }
 }
 
@@ -104,11 +164,16 @@ void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
 
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, int stride)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
-      fields_(fields) {
+      fields_(fields),
+      stride_(stride) {
+  DRAKE_THROW_UNLESS(stride >= 1);
+  CalcPixelRays(camera_info, camera_info.width(), camera_info.height(),
+                stride, &ray_x_, &ray_y_);
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -141,7 +206,7 @@ void DepthImageToPointCloud::Convert(
     const optional<float>& scale, PointCloud* output) {
   DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), 1 /* stride */, {}, {}, output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -152,7 +217,7 @@ void DepthImageToPointCloud::Convert(
     const optional<float>& scale, PointCloud* output) {
   DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), 1 /* stride */, {}, {}, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -165,7 +230,7 @@ void DepthImageToPointCloud::CalcOutput32F(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, stride_, ray_x_, ray_y_, output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -178,7 +243,7 @@ void DepthImageToPointCloud::CalcOutput16U(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, stride_, ray_x_, ray_y_, output);
 }
 
 }  // namespace perception
@@ -40,6 +40,12 @@ namespace perception {
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
 /// the Point Cloud Library (PCL).
 ///
+/// The point cloud is organized like the depth image: its points are the
+/// pixels in row-major order, so that the point of the pixel (u, v) is at the
+/// index `v * width + u`.  The rays through the pixels are precomputed from
+/// the camera info when the system is constructed, and the output point cloud
+/// is resized only when the number of pixels changes.
+///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
  public:
@@ -54,11 +60,17 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] stride Only the pixels of every `stride`'th row and column of
+  ///   the depth image (starting with the first ones) are converted, which
+  ///   downsamples the point cloud.  It then has `ceil(width / stride) *
+  ///   ceil(height / stride)` points, still organized in row-major order.
+  ///   Must be positive.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      int stride = 1);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -121,6 +133,11 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  const int stride_;
+  // The rays through the pixels that are converted, at unit depth; see
+  // CalcPixelRays() in the .cc file.
+  Eigen::RowVectorXf ray_x_;
+  Eigen::RowVectorXf ray_y_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
@@ -0,0 +1,196 @@
+#include "drake/perception/icp.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+// The scene points are accumulated in blocks of this many points, whose sums
+// are then added in order, so that the result does not depend on the number
+// of threads.
+constexpr int kBlockSize = 256;
+
+// The sums over the correspondences (p, q, n) of an iteration, where p is a
+// scene point and q its model point (with its normal n), in frame M.
+struct Sums {
+  void Add(const Sums& other) {
+    count += other.count;
+    sum_squared_errors += other.sum_squared_errors;
+    max_norm_p = std::max(max_norm_p, other.max_norm_p);
+    sum_p += other.sum_p;
+    sum_q += other.sum_q;
+    sum_pq += other.sum_pq;
+    JtJ += other.JtJ;
+    Jtr += other.Jtr;
+  }
+
+  int count{0};
+  double sum_squared_errors{0};
+  double max_norm_p{0};
+  // For the point-to-point metric: the sums of p, q, and p qᵀ.
+  Vector3d sum_p{Vector3d::Zero()};
+  Vector3d sum_q{Vector3d::Zero()};
+  Matrix3d sum_pq{Matrix3d::Zero()};
+  // For the point-to-plane metric: the normal equations JᵀJ x = -Jᵀr of the
+  // errors r = n⋅(p - q) linearized in the twist x = (w, v) that moves p to
+  // p + w × p + v, for which J = (p × n, n). Only the lower triangle of JtJ
+  // is accumulated.
+  Matrix6d JtJ{Matrix6d::Zero()};
+  Vector6d Jtr{Vector6d::Zero()};
+};
+
+// Returns the closed-form transform that best aligns the points p with their
+// corresponding points q, in the least-squares sense.
+RigidTransformd CalcPointToPointUpdate(const Sums& sums) {
+  const Vector3d p_mean = sums.sum_p / sums.count;
+  const Vector3d q_mean = sums.sum_q / sums.count;
+  const Matrix3d H = sums.sum_pq - sums.count * p_mean * q_mean.transpose();
+  const Eigen::JacobiSVD<Matrix3d> svd(
+      H, Eigen::ComputeFullU | Eigen::ComputeFullV);
+  // Correct the reflection that the SVD may produce for degenerate sets.
+  Vector3d d = Vector3d::Ones();
+  if ((svd.matrixV() * svd.matrixU().transpose()).determinant() < 0) {
+    d(2) = -1;
+  }
+  const Matrix3d R =
+      svd.matrixV() * d.asDiagonal() * svd.matrixU().transpose();
+  return RigidTransformd(RotationMatrixd(R), q_mean - R * p_mean);
+}
+
+}  // namespace
+
+IcpResult EstimatePoseIcp(const PointCloud& model, const PointCloud& scene,
+                          const RigidTransformd& X_MS_initial,
+                          const IcpParams& params) {
+  const bool point_to_plane = params.metric == IcpMetric::kPointToPlane;
+  DRAKE_DEMAND(model.has_xyzs() && scene.has_xyzs());
+  DRAKE_DEMAND(!point_to_plane || model.has_normals());
+  DRAKE_THROW_UNLESS(params.max_iterations >= 1);
+  DRAKE_THROW_UNLESS(params.max_correspondence_distance > 0);
+  DRAKE_THROW_UNLESS(params.convergence_tolerance >= 0);
+  DRAKE_THROW_UNLESS(params.num_threads >= 1);
+
+  model.BuildSpatialIndex();
+  const Eigen::Ref<const Matrix3X<float>> model_xyzs = model.xyzs();
+  const Eigen::Ref<const Matrix3X<float>> scene_xyzs = scene.xyzs();
+  const float* const model_normals = model.normals_data();
+  const double max_squared_distance =
+      params.max_correspondence_distance * params.max_correspondence_distance;
+  const int min_correspondences = point_to_plane ? 6 : 3;
+
+  const int num_blocks = (scene.size() + kBlockSize - 1) / kBlockSize;
+  std::vector<Sums> block_sums(num_blocks);
+  // The scratch buffer of each thread.
+  std::vector<std::vector<int>> nearest(params.num_threads);
+
+  IcpResult result;
+  result.X_MS = X_MS_initial;
+  for (int iteration = 1; iteration <= params.max_iterations; ++iteration) {
+    const RigidTransformd& X_MS = result.X_MS;
+    auto accumulate_block = [&](int thread_num, int block) {
+      Sums& sums = block_sums[block];
+      sums = Sums();
+      const int end = std::min(scene.size(), (block + 1) * kBlockSize);
+      for (int i = block * kBlockSize; i < end; ++i) {
+        const Vector3d p_SP = scene_xyzs.col(i).cast<double>();
+        if (!p_SP.allFinite()) {
+          continue;
+        }
+        const Vector3d p = X_MS * p_SP;
+        std::vector<int>& closest = nearest[thread_num];
+        model.FindNearestNeighbors(p.cast<float>(), 1, &closest);
+        if (closest.empty()) {
+          continue;
+        }
+        const Vector3d q = model_xyzs.col(closest[0]).cast<double>();
+        const double squared_distance = (p - q).squaredNorm();
+        if (squared_distance > max_squared_distance) {
+          continue;
+        }
+        if (point_to_plane) {
+          const Vector3d n =
+              Eigen::Map<const Eigen::Vector3f>(model_normals + 3 * closest[0])
+                  .cast<double>();
+          if (!n.allFinite()) {
+            continue;
+          }
+          const double r = n.dot(p - q);
+          Vector6d J;
+          J << p.cross(n), n;
+          sums.JtJ.selfadjointView<Eigen::Lower>().rankUpdate(J);
+          sums.Jtr += J * r;
+          sums.sum_squared_errors += r * r;
+        } else {
+          sums.sum_p += p;
+          sums.sum_q += q;
+          sums.sum_pq += p * q.transpose();
+          sums.sum_squared_errors += squared_distance;
+        }
+        sums.max_norm_p = std::max(sums.max_norm_p, p.norm());
+        ++sums.count;
+      }
+    };
+    StaticParallelForIndexLoop(params.num_threads, 0, num_blocks,
+                               accumulate_block);
+    Sums total;
+    for (const Sums& sums : block_sums) {
+      total.Add(sums);
+    }
+
+    result.num_iterations = iteration;
+    result.num_correspondences = total.count;
+    result.rms_error =
+        total.count > 0 ? std::sqrt(total.sum_squared_errors / total.count)
+                        : std::numeric_limits<double>::quiet_NaN();
+    if (total.count < min_correspondences) {
+      break;
+    }
+
+    RigidTransformd X_update;
+    if (point_to_plane) {
+      const Eigen::LDLT<Matrix6d> ldlt(total.JtJ);
+      const Vector6d x = ldlt.solve(-total.Jtr);
+      if (ldlt.info() != Eigen::Success || !x.allFinite()) {
+        break;
+      }
+      const Vector3d w = x.head<3>();
+      const double angle = w.norm();
+      const RotationMatrixd R =
+          angle > 0 ? RotationMatrixd(Eigen::AngleAxisd(angle, w / angle))
+                    : RotationMatrixd();
+      X_update = RigidTransformd(R, x.tail<3>());
+    } else {
+      X_update = CalcPointToPointUpdate(total);
+    }
+    result.X_MS = X_update * result.X_MS;
+
+    const double angle =
+        Eigen::AngleAxisd(X_update.rotation().matrix()).angle();
+    const double motion =
+        X_update.translation().norm() + angle * total.max_norm_p;
+    if (motion <= params.convergence_tolerance) {
+      result.converged = true;
+      break;
+    }
+  }
+  return result;
+}
+
+}  // namespace perception
+}  // namespace drake
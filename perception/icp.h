@@ -0,0 +1,87 @@
+#pragma once
+
+#include <limits>
+
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// The error metric minimized by EstimatePoseIcp().
+enum class IcpMetric {
+  /// The sum of the squared distances between the corresponding points.
+  kPointToPoint,
+  /// The sum of the squared distances from the scene points to the tangent
+  /// planes of their corresponding model points, which converges in fewer
+  /// iterations on smooth surfaces. It requires the normals of the model.
+  kPointToPlane,
+};
+
+/// The parameters of EstimatePoseIcp().
+struct IcpParams {
+  /// The error metric that is minimized.
+  IcpMetric metric{IcpMetric::kPointToPlane};
+  /// The maximum number of iterations.
+  int max_iterations{30};
+  /// The scene points farther than this from their closest model point (once
+  /// transformed by the current estimate) have no correspondence. Must be
+  /// positive.
+  double max_correspondence_distance{std::numeric_limits<double>::infinity()};
+  /// The iterations stop once the update of the estimate moves none of the
+  /// scene points that have a correspondence by more than this distance (as
+  /// bounded by the update's translation plus its rotation angle times the
+  /// distance of the farthest of these points from the origin of M).
+  double convergence_tolerance{1e-6};
+  /// The maximum number of threads used to find the correspondences and
+  /// accumulate the error terms; the result does not depend on it.
+  int num_threads{1};
+};
+
+/// The result of EstimatePoseIcp().
+struct IcpResult {
+  /// The estimated pose of the scene frame S in the model frame M.
+  math::RigidTransformd X_MS;
+  /// The number of iterations performed.
+  int num_iterations{};
+  /// The number of correspondences of the last iteration.
+  int num_correspondences{};
+  /// The root mean square of the errors (distances to the points or to the
+  /// planes, depending on the metric) of the correspondences of the last
+  /// iteration, or NaN if there were none.
+  double rms_error{std::numeric_limits<double>::quiet_NaN()};
+  /// Whether the iterations converged within `max_iterations`.
+  bool converged{false};
+};
+
+/// Estimates the pose X_MS of the frame S of the `scene` point cloud in the
+/// frame M of the `model` point cloud by the iterative closest point (ICP)
+/// algorithm: starting from `X_MS_initial`, each iteration pairs each scene
+/// point (transformed to M by the current estimate) with its closest model
+/// point, using the model's spatial index (see @ref
+/// point_cloud_spatial_queries "Spatial Queries"), then updates the estimate
+/// to minimize the error metric of these correspondences.
+///
+/// For IcpMetric::kPointToPoint, the update is the closed-form least-squares
+/// rigid transform between the corresponding points. For
+/// IcpMetric::kPointToPlane, it is the Gauss-Newton step of the linearized
+/// point-to-plane error, which solves 6x6 normal equations.
+///
+/// The scene points whose XYZ values are not finite, and (for the
+/// point-to-plane metric) the model points whose normals are not finite, are
+/// ignored. The iterations stop early if there are fewer than three
+/// correspondences (six for the point-to-plane metric).
+///
+/// @note The model's spatial index is built by the first call if it does not
+/// already exist, so that concurrent calls with the same model require that
+/// PointCloud::BuildSpatialIndex() was called before.
+///
+/// @pre `model.has_xyzs()` and `scene.has_xyzs()` are true, and so is
+///   `model.has_normals()` for the point-to-plane metric.
+/// @throws std::exception if the parameters are not valid.
+IcpResult EstimatePoseIcp(const PointCloud& model, const PointCloud& scene,
+                          const math::RigidTransformd& X_MS_initial,
+                          const IcpParams& params = {});
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,49 @@
+#include "drake/perception/icp_pose_estimator.h"
+
+#include "drake/common/drake_throw.h"
+
+using drake::Value;
+using drake::math::RigidTransformd;
+
+namespace drake {
+namespace perception {
+
+IcpPoseEstimator::IcpPoseEstimator(const PointCloud& model,
+                                   const RigidTransformd& X_SM_initial,
+                                   const IcpParams& params)
+    : model_(model), X_SM_initial_(X_SM_initial), params_(params) {
+  DRAKE_THROW_UNLESS(model_.has_xyzs());
+  DRAKE_THROW_UNLESS(params_.metric != IcpMetric::kPointToPlane ||
+                     model_.has_normals());
+  model_.BuildSpatialIndex();
+
+  // Input port for the scene point cloud.
+  point_cloud_input_port_ =
+      this->DeclareAbstractInputPort("point_cloud", Value<PointCloud>{})
+          .get_index();
+
+  // Optional input port for the initial pose.
+  initial_pose_input_port_ =
+      this->DeclareAbstractInputPort("initial_pose", Value<RigidTransformd>{})
+          .get_index();
+
+  // Output port for the estimated pose.
+  this->DeclareAbstractOutputPort("pose", &IcpPoseEstimator::CalcPose);
+}
+
+void IcpPoseEstimator::CalcPose(const systems::Context<double>& context,
+                                RigidTransformd* X_SM) const {
+  const auto* const scene =
+      this->EvalInputValue<PointCloud>(context, point_cloud_input_port_);
+  const auto* const initial_pose_or_null =
+      this->EvalInputValue<RigidTransformd>(context, initial_pose_input_port_);
+  DRAKE_THROW_UNLESS(scene != nullptr);
+  const RigidTransformd& X_SM_initial =
+      initial_pose_or_null ? *initial_pose_or_null : X_SM_initial_;
+  const IcpResult result =
+      EstimatePoseIcp(model_, *scene, X_SM_initial.inverse(), params_);
+  *X_SM = result.X_MS.inverse();
+}
+
+}  // namespace perception
+}  // namespace drake
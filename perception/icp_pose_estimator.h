@@ -0,0 +1,83 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/icp.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// Estimates the pose of a known object from a point cloud of a scene that
+/// contains it, by EstimatePoseIcp().
+///
+/// @system{ IcpPoseEstimator,
+///          @input_port{point_cloud}
+///          @input_port{initial_pose (optional)},
+///          @output_port{pose}
+/// }
+///
+/// The `point_cloud` input is the scene, in its frame S (e.g., the output of
+/// DepthImageToPointCloud). The `pose` output is the RigidTransformd X_SM of
+/// the frame M of the object's model in S, i.e., the pose of the object as
+/// seen in the scene. The ICP iterations start from the `initial_pose` input,
+/// a RigidTransformd X_SM, if it is connected, and from the initial pose given
+/// to the constructor otherwise. To track a moving object, the `initial_pose`
+/// input can be the `pose` output delayed by a sample period (e.g., through a
+/// ZeroOrderHold).
+///
+/// @ingroup perception_systems
+class IcpPoseEstimator final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IcpPoseEstimator)
+
+  /// Constructs the estimator.
+  ///
+  /// @param[in] model The point cloud of the object, in its frame M. It must
+  ///   have XYZ values, and normals for the point-to-plane metric.
+  /// @param[in] X_SM_initial The initial pose used when the `initial_pose`
+  ///   input is not connected.
+  /// @param[in] params The parameters of the ICP iterations.
+  /// @throws std::exception if `model` lacks the fields required by
+  ///   `params.metric`.
+  IcpPoseEstimator(const PointCloud& model,
+                   const math::RigidTransformd& X_SM_initial,
+                   const IcpParams& params = {});
+
+  /// Returns the abstract valued input port that expects the PointCloud of
+  /// the scene.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return this->get_input_port(point_cloud_input_port_);
+  }
+
+  /// Returns the abstract valued input port that expects the initial pose
+  /// X_SM as a RigidTransformd. (This input port does not necessarily need to
+  /// be connected; refer to the class overview for details.)
+  const systems::InputPort<double>& initial_pose_input_port() const {
+    return this->get_input_port(initial_pose_input_port_);
+  }
+
+  /// Returns the abstract valued output port that provides the estimated pose
+  /// X_SM as a RigidTransformd.
+  const systems::OutputPort<double>& pose_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  void CalcPose(const systems::Context<double>&,
+                math::RigidTransformd*) const;
+
+  // The model, whose spatial index is built at construction so that the
+  // estimates of several contexts may be computed concurrently.
+  const PointCloud model_;
+  const math::RigidTransformd X_SM_initial_;
+  const IcpParams params_;
+
+  systems::InputPortIndex point_cloud_input_port_{};
+  systems::InputPortIndex initial_pose_input_port_{};
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -1,11 +1,16 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include <utility>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 
 using Eigen::Map;
 using Eigen::NoChange;
@@ -25,6 +30,11 @@ typedef PointCloud::D D;
 /*
  * Provides encapsulated storage for a `PointCloud`.
  *
+ * The matrices have `capacity()` columns, of which the first `size()` are in
+ * use. When the XYZ values are padded, they are stored in the first three
+ * rows of `padded_xyzs_` (whose fourth row is kept at zero) instead of in
+ * `xyzs_`.
+ *
  * This storage is not responsible for initializing default values.
  */
 class PointCloud::Storage {
@@ -42,53 +52,277 @@ class PointCloud::Storage {
   // Returns size of the storage.
   int size() const { return size_; }
 
-  // Resize to parent cloud's size.
+  // Returns the number of points that fit without reallocating.
+  int capacity() const { return capacity_; }
+
+  // Resize to parent cloud's size, growing the capacity to exactly
+  // `new_size` if needed.
   void resize(int new_size) {
+    reserve(new_size);
     size_ = new_size;
-    if (fields_.contains(pc_flags::kXYZs))
-      xyzs_.conservativeResize(NoChange, new_size);
+    CheckInvariants();
+  }
+
+  void reserve(int new_capacity) {
+    if (new_capacity <= capacity_) {
+      return;
+    }
+    const int old_capacity = capacity_;
+    capacity_ = new_capacity;
+    if (fields_.contains(pc_flags::kXYZs)) {
+      if (padded_) {
+        padded_xyzs_.conservativeResize(NoChange, capacity_);
+        padded_xyzs_.row(3).tail(capacity_ - old_capacity).setZero();
+      } else {
+        xyzs_.conservativeResize(NoChange, capacity_);
+      }
+    }
     if (fields_.contains(pc_flags::kNormals))
-      normals_.conservativeResize(NoChange, new_size);
+      normals_.conservativeResize(NoChange, capacity_);
     if (fields_.contains(pc_flags::kRGBs))
-      rgbs_.conservativeResize(NoChange, new_size);
+      rgbs_.conservativeResize(NoChange, capacity_);
     if (fields_.has_descriptor())
-      descriptors_.conservativeResize(NoChange, new_size);
+      descriptors_.conservativeResize(NoChange, capacity_);
     CheckInvariants();
   }
 
-  Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_; }
-  Eigen::Ref<Matrix3X<T>> normals() { return normals_; }
-  Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_; }
-  Eigen::Ref<MatrixX<T>> descriptors() { return descriptors_; }
+  bool padded() const { return padded_; }
+
+  void set_padded(bool padded) {
+    DRAKE_DEMAND(fields_.contains(pc_flags::kXYZs));
+    if (padded == padded_) {
+      return;
+    }
+    if (padded) {
+      padded_xyzs_.resize(NoChange, capacity_);
+      padded_xyzs_.topRows<3>() = xyzs_;
+      padded_xyzs_.row(3).setZero();
+      xyzs_.resize(NoChange, 0);
+    } else {
+      xyzs_ = padded_xyzs_.topRows<3>();
+      padded_xyzs_.resize(NoChange, 0);
+    }
+    padded_ = padded;
+    CheckInvariants();
+  }
+
+  Eigen::Ref<Matrix3X<T>> xyzs() {
+    if (padded_) {
+      return padded_xyzs_.topRows<3>().leftCols(size_);
+    }
+    return xyzs_.leftCols(size_);
+  }
+  Eigen::Ref<Matrix4X<T>> padded_xyzs() {
+    DRAKE_DEMAND(padded_);
+    return padded_xyzs_.leftCols(size_);
+  }
+  Eigen::Ref<Matrix3X<T>> normals() { return normals_.leftCols(size_); }
+  Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_.leftCols(size_); }
+  Eigen::Ref<MatrixX<T>> descriptors() {
+    return descriptors_.leftCols(size_);
+  }
+
+  T* xyzs_data() { return padded_ ? padded_xyzs_.data() : xyzs_.data(); }
+  T* normals_data() { return normals_.data(); }
+  C* rgbs_data() { return rgbs_.data(); }
+  T* descriptors_data() { return descriptors_.data(); }
 
  private:
   void CheckInvariants() const {
+    DRAKE_DEMAND(size_ <= capacity_);
     if (fields_.contains(pc_flags::kXYZs)) {
-      const int xyz_size = xyzs_.cols();
-      DRAKE_DEMAND(xyz_size == size());
+      const int xyz_capacity = padded_ ? padded_xyzs_.cols() : xyzs_.cols();
+      DRAKE_DEMAND(xyz_capacity == capacity());
     }
     if (fields_.contains(pc_flags::kNormals)) {
-      const int normals_size = normals_.cols();
-      DRAKE_DEMAND(normals_size == size());
+      const int normals_capacity = normals_.cols();
+      DRAKE_DEMAND(normals_capacity == capacity());
     }
     if (fields_.contains(pc_flags::kRGBs)) {
-      const int rgbs_size = rgbs_.cols();
-      DRAKE_DEMAND(rgbs_size == size());
+      const int rgbs_capacity = rgbs_.cols();
+      DRAKE_DEMAND(rgbs_capacity == capacity());
     }
     if (fields_.has_descriptor()) {
-      const int descriptor_size = descriptors_.cols();
-      DRAKE_DEMAND(descriptor_size == size());
+      const int descriptor_capacity = descriptors_.cols();
+      DRAKE_DEMAND(descriptor_capacity == capacity());
     }
   }
 
   const pc_flags::Fields fields_;
   int size_{};
+  int capacity_{};
+  bool padded_{false};
   Matrix3X<T> xyzs_;
+  Matrix4X<T> padded_xyzs_;
   Matrix3X<T> normals_;
   Matrix3X<C> rgbs_;
   MatrixX<T> descriptors_;
 };
 
+/*
+ * A k-d tree of the finite XYZ values of a `PointCloud`, for its spatial
+ * queries. It refers to the points by their indices, so that the XYZ values
+ * themselves are passed to the queries.
+ */
+class PointCloud::SpatialIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpatialIndex)
+
+  explicit SpatialIndex(const Eigen::Ref<const Matrix3X<T>>& xyzs) {
+    indices_.reserve(xyzs.cols());
+    for (int i = 0; i < xyzs.cols(); ++i) {
+      if (xyzs.col(i).allFinite()) {
+        indices_.push_back(i);
+      }
+    }
+    if (!indices_.empty()) {
+      nodes_.reserve(2 * indices_.size() / kLeafSize + 1);
+      Build(xyzs, 0, indices_.size());
+    }
+  }
+
+  void FindWithinRadius(const Eigen::Ref<const Matrix3X<T>>& xyzs,
+                        const Vector3<T>& query, T radius,
+                        std::vector<int>* result) const {
+    result->clear();
+    if (!nodes_.empty()) {
+      FindWithinRadius(xyzs, 0, query, radius, radius * radius, result);
+    }
+  }
+
+  // Finds the (at most) `k` nearest points that are within `max_distance`,
+  // sorted by increasing distance.
+  void FindNearest(const Eigen::Ref<const Matrix3X<T>>& xyzs,
+                   const Vector3<T>& query, int k, T max_distance,
+                   std::vector<std::pair<T, int>>* heap,
+                   std::vector<int>* result) const {
+    heap->clear();
+    result->clear();
+    if (nodes_.empty() || k <= 0) {
+      return;
+    }
+    FindNearest(xyzs, 0, query, k, max_distance * max_distance, heap);
+    std::sort_heap(heap->begin(), heap->end());
+    for (const auto& distance_and_index : *heap) {
+      result->push_back(distance_and_index.second);
+    }
+  }
+
+ private:
+  // The maximum number of points in a leaf.
+  static constexpr int kLeafSize = 16;
+
+  // The points of a node are indices_[begin, end). An inner node splits them
+  // at `split` along `axis`: the `left` child has the points whose coordinate
+  // is at most `split`, and the `right` child those whose coordinate is at
+  // least `split`. The `axis` of a leaf is -1.
+  struct Node {
+    int begin{};
+    int end{};
+    int axis{-1};
+    T split{};
+    int left{-1};
+    int right{-1};
+  };
+
+  // Builds the subtree of indices_[begin, end) and returns its node index.
+  int Build(const Eigen::Ref<const Matrix3X<T>>& xyzs, int begin, int end) {
+    const int node_index = nodes_.size();
+    nodes_.push_back(Node{begin, end});
+    if (end - begin <= kLeafSize) {
+      return node_index;
+    }
+    // Split along the axis of largest extent, at the median.
+    Vector3<T> lower = xyzs.col(indices_[begin]);
+    Vector3<T> upper = lower;
+    for (int i = begin + 1; i < end; ++i) {
+      lower = lower.cwiseMin(xyzs.col(indices_[i]));
+      upper = upper.cwiseMax(xyzs.col(indices_[i]));
+    }
+    int axis{};
+    (upper - lower).maxCoeff(&axis);
+    const int middle = begin + (end - begin) / 2;
+    std::nth_element(indices_.begin() + begin, indices_.begin() + middle,
+                     indices_.begin() + end, [&xyzs, axis](int a, int b) {
+                       return xyzs(axis, a) < xyzs(axis, b);
+                     });
+    const T split = xyzs(axis, indices_[middle]);
+    const int left = Build(xyzs, begin, middle);
+    const int right = Build(xyzs, middle, end);
+    Node& node = nodes_[node_index];
+    node.axis = axis;
+    node.split = split;
+    node.left = left;
+    node.right = right;
+    return node_index;
+  }
+
+  void FindWithinRadius(const Eigen::Ref<const Matrix3X<T>>& xyzs,
+                        int node_index, const Vector3<T>& query, T radius,
+                        T radius_squared, std::vector<int>* result) const {
+    const Node& node = nodes_[node_index];
+    if (node.axis < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        const int index = indices_[i];
+        if ((xyzs.col(index) - query).squaredNorm() <= radius_squared) {
+          result->push_back(index);
+        }
+      }
+      return;
+    }
+    const T offset = query(node.axis) - node.split;
+    if (offset <= radius) {
+      FindWithinRadius(xyzs, node.left, query, radius, radius_squared, result);
+    }
+    if (offset >= -radius) {
+      FindWithinRadius(xyzs, node.right, query, radius, radius_squared,
+                       result);
+    }
+  }
+
+  // Maintains `heap` as a max-heap of the (at most) `k` nearest points found
+  // so far, as pairs of their squared distances and indices.
+  void FindNearest(const Eigen::Ref<const Matrix3X<T>>& xyzs, int node_index,
+                   const Vector3<T>& query, int k, T max_distance_squared,
+                   std::vector<std::pair<T, int>>* heap) const {
+    const Node& node = nodes_[node_index];
+    if (node.axis < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        const int index = indices_[i];
+        const std::pair<T, int> candidate(
+            (xyzs.col(index) - query).squaredNorm(), index);
+        if (candidate.first > max_distance_squared) {
+          continue;
+        }
+        if (static_cast<int>(heap->size()) < k) {
+          heap->push_back(candidate);
+          std::push_heap(heap->begin(), heap->end());
+        } else if (candidate < heap->front()) {
+          std::pop_heap(heap->begin(), heap->end());
+          heap->back() = candidate;
+          std::push_heap(heap->begin(), heap->end());
+        }
+      }
+      return;
+    }
+    // Search the side of the query first, so that the other side can most
+    // often be pruned.
+    const T offset = query(node.axis) - node.split;
+    const int near = (offset <= 0) ? node.left : node.right;
+    const int far = (offset <= 0) ? node.right : node.left;
+    FindNearest(xyzs, near, query, k, max_distance_squared, heap);
+    const T offset_squared = offset * offset;
+    if (offset_squared <= max_distance_squared &&
+        (static_cast<int>(heap->size()) < k ||
+         offset_squared <= heap->front().first)) {
+      FindNearest(xyzs, far, query, k, max_distance_squared, heap);
+    }
+  }
+
+  std::vector<int> indices_;
+  std::vector<Node> nodes_;
+};
+
 namespace {
 
 pc_flags::Fields ResolveFields(
@@ -138,6 +372,9 @@ PointCloud::PointCloud(
 PointCloud::PointCloud(const PointCloud& other,
                        pc_flags::Fields copy_fields)
     : PointCloud(other.size(), ResolveFields(other, copy_fields)) {
+  if (has_xyzs() && other.has_xyzs()) {
+    set_xyzs_padded(other.xyzs_padded());
+  }
   SetFrom(other);
 }
 
@@ -145,6 +382,7 @@ PointCloud::PointCloud(PointCloud&& other)
     : PointCloud(0, other.fields(), true) {
   // This has zero size. Directly swap storages.
   storage_.swap(other.storage_);
+  spatial_index_.swap(other.spatial_index_);
   std::swap(size_, other.size_);
   DRAKE_DEMAND(storage_->size() == size());
 }
@@ -160,6 +398,7 @@ PointCloud& PointCloud::operator=(PointCloud&& other) {
   // Swap storages.
   size_ = other.size_;
   storage_.swap(other.storage_);
+  spatial_index_.swap(other.spatial_index_);
   DRAKE_DEMAND(storage_->size() == size());
   // Empty out the other cloud, but let it remain being a valid point cloud
   // (with non-null storage).
@@ -175,6 +414,7 @@ void PointCloud::resize(int new_size, bool skip_initialization) {
   int old_size = size();
   size_ = new_size;
   storage_->resize(new_size);
+  spatial_index_.reset();
   DRAKE_DEMAND(storage_->size() == new_size);
   if (new_size > old_size && !skip_initialization) {
     int size_diff = new_size - old_size;
@@ -227,11 +467,25 @@ void PointCloud::SetFrom(const PointCloud& other,
   }
 }
 
+void PointCloud::reserve(int new_capacity) {
+  DRAKE_DEMAND(new_capacity >= 0);
+  storage_->reserve(new_capacity);
+}
+
+int PointCloud::capacity() const {
+  return storage_->capacity();
+}
+
 void PointCloud::Expand(
     int add_size,
     bool skip_initialization) {
   DRAKE_DEMAND(add_size >= 0);
   const int new_size = size() + add_size;
+  // Grow geometrically, so that adding points one at a time takes amortized
+  // constant time.
+  if (new_size > capacity()) {
+    reserve(std::max(new_size, 2 * capacity()));
+  }
   resize(new_size, skip_initialization);
 }
 
@@ -244,9 +498,28 @@ Eigen::Ref<const Matrix3X<T>> PointCloud::xyzs() const {
 }
 Eigen::Ref<Matrix3X<T>> PointCloud::mutable_xyzs() {
   DRAKE_DEMAND(has_xyzs());
+  spatial_index_.reset();
   return storage_->xyzs();
 }
 
+bool PointCloud::xyzs_padded() const {
+  return has_xyzs() && storage_->padded();
+}
+void PointCloud::set_xyzs_padded(bool padded) {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  spatial_index_.reset();
+  storage_->set_padded(padded);
+}
+Eigen::Ref<const Matrix4X<T>> PointCloud::padded_xyzs() const {
+  DRAKE_DEMAND(xyzs_padded());
+  return storage_->padded_xyzs();
+}
+Eigen::Ref<Matrix4X<T>> PointCloud::mutable_padded_xyzs() {
+  DRAKE_DEMAND(xyzs_padded());
+  spatial_index_.reset();
+  return storage_->padded_xyzs();
+}
+
 bool PointCloud::has_normals() const {
   return fields_.contains(pc_flags::kNormals);
 }
@@ -287,6 +560,188 @@ Eigen::Ref<MatrixX<D>> PointCloud::mutable_descriptors() {
   return storage_->descriptors();
 }
 
+void PointCloud::BuildSpatialIndex() const {
+  DRAKE_DEMAND(has_xyzs());
+  if (spatial_index_ == nullptr) {
+    spatial_index_ = std::make_unique<SpatialIndex>(xyzs());
+  }
+}
+
+void PointCloud::FindPointsWithinRadius(
+    const Eigen::Ref<const Vector3<T>>& query, T radius,
+    std::vector<int>* indices) const {
+  DRAKE_DEMAND(indices != nullptr);
+  BuildSpatialIndex();
+  spatial_index_->FindWithinRadius(xyzs(), query, radius, indices);
+}
+
+void PointCloud::FindNearestNeighbors(
+    const Eigen::Ref<const Vector3<T>>& query, int num_neighbors,
+    std::vector<int>* indices) const {
+  DRAKE_DEMAND(indices != nullptr);
+  BuildSpatialIndex();
+  std::vector<std::pair<T, int>> heap;
+  heap.reserve(std::max(num_neighbors, 0));
+  spatial_index_->FindNearest(xyzs(), query, num_neighbors,
+                              std::numeric_limits<T>::infinity(), &heap,
+                              indices);
+}
+
+namespace {
+
+struct VoxelHash {
+  std::size_t operator()(const Eigen::Vector3i& voxel) const {
+    return (static_cast<std::size_t>(voxel.x()) * 73856093) ^
+           (static_cast<std::size_t>(voxel.y()) * 19349663) ^
+           (static_cast<std::size_t>(voxel.z()) * 83492791);
+  }
+};
+
+}  // namespace
+
+PointCloud PointCloud::VoxelizedDownSample(T voxel_size) const {
+  DRAKE_DEMAND(has_xyzs());
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  // Assign each point with a finite XYZ value to its voxel.
+  std::unordered_map<Eigen::Vector3i, int, VoxelHash> voxels;
+  std::vector<int> voxel_of_point(size(), -1);
+  const Eigen::Ref<const Matrix3X<T>> points = xyzs();
+  for (int i = 0; i < size(); ++i) {
+    if (!points.col(i).allFinite()) {
+      continue;
+    }
+    const Eigen::Vector3i voxel =
+        (points.col(i) / voxel_size).array().floor().cast<int>();
+    voxel_of_point[i] =
+        voxels.emplace(voxel, static_cast<int>(voxels.size())).first->second;
+  }
+
+  // Average the fields of the points in each voxel, in double precision.
+  const int num_voxels = voxels.size();
+  Eigen::VectorXd counts = Eigen::VectorXd::Zero(num_voxels);
+  Eigen::Matrix3Xd xyz_sums = Eigen::Matrix3Xd::Zero(3, num_voxels);
+  Eigen::Matrix3Xd normal_sums = Eigen::Matrix3Xd::Zero(3, num_voxels);
+  Eigen::Matrix3Xd rgb_sums = Eigen::Matrix3Xd::Zero(3, num_voxels);
+  Eigen::MatrixXd descriptor_sums;
+  if (has_descriptors()) {
+    descriptor_sums.setZero(descriptor_type().size(), num_voxels);
+  }
+  for (int i = 0; i < size(); ++i) {
+    const int voxel = voxel_of_point[i];
+    if (voxel < 0) {
+      continue;
+    }
+    counts(voxel) += 1;
+    xyz_sums.col(voxel) += points.col(i).cast<double>();
+    if (has_normals()) {
+      normal_sums.col(voxel) += normals().col(i).cast<double>();
+    }
+    if (has_rgbs()) {
+      rgb_sums.col(voxel) += rgbs().col(i).cast<double>();
+    }
+    if (has_descriptors()) {
+      descriptor_sums.col(voxel) += descriptors().col(i).cast<double>();
+    }
+  }
+
+  PointCloud result(num_voxels, fields(), true /* skip_initialize */);
+  const Eigen::RowVectorXd inverse_counts = counts.cwiseInverse().transpose();
+  result.mutable_xyzs() =
+      (xyz_sums.array().rowwise() * inverse_counts.array()).cast<T>();
+  if (has_normals()) {
+    Eigen::Ref<Matrix3X<T>> result_normals = result.mutable_normals();
+    for (int j = 0; j < num_voxels; ++j) {
+      result_normals.col(j) = normal_sums.col(j).normalized().cast<T>();
+    }
+  }
+  if (has_rgbs()) {
+    result.mutable_rgbs() = (rgb_sums.array().rowwise() *
+                             inverse_counts.array()).round().cast<C>();
+  }
+  if (has_descriptors()) {
+    result.mutable_descriptors() =
+        (descriptor_sums.array().rowwise() * inverse_counts.array())
+            .cast<D>();
+  }
+  return result;
+}
+
+void PointCloud::EstimateNormals(T radius, int num_closest,
+                                 int num_threads) {
+  DRAKE_DEMAND(has_xyzs());
+  DRAKE_DEMAND(has_normals());
+  DRAKE_THROW_UNLESS(radius > 0);
+  DRAKE_THROW_UNLESS(num_closest >= 3);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  BuildSpatialIndex();
+  const Eigen::Ref<const Matrix3X<T>> points = xyzs();
+  Eigen::Ref<Matrix3X<T>> point_normals = mutable_normals();
+  // The scratch buffers of each thread.
+  std::vector<std::vector<std::pair<T, int>>> heaps(num_threads);
+  std::vector<std::vector<int>> neighbors(num_threads);
+  auto estimate_normal = [&](int thread_num, int i) {
+    auto normal = point_normals.col(i);
+    normal.setConstant(kDefaultValue);
+    if (!points.col(i).allFinite()) {
+      return;
+    }
+    std::vector<int>& closest = neighbors[thread_num];
+    spatial_index_->FindNearest(points, points.col(i), num_closest, radius,
+                                &heaps[thread_num], &closest);
+    if (closest.size() < 3) {
+      return;
+    }
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    for (const int j : closest) {
+      mean += points.col(j).cast<double>();
+    }
+    mean /= closest.size();
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (const int j : closest) {
+      const Eigen::Vector3d offset = points.col(j).cast<double>() - mean;
+      covariance += offset * offset.transpose();
+    }
+    // The eigenvalues are sorted in increasing order.
+    const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    Eigen::Vector3d direction = solver.eigenvectors().col(0);
+    if (direction.dot(points.col(i).cast<double>()) > 0) {
+      direction = -direction;
+    }
+    normal = direction.cast<T>();
+  };
+  StaticParallelForIndexLoop(num_threads, 0, size(), estimate_normal);
+}
+
+const T* PointCloud::xyzs_data() const {
+  return has_xyzs() ? storage_->xyzs_data() : nullptr;
+}
+T* PointCloud::mutable_xyzs_data() {
+  if (!has_xyzs()) return nullptr;
+  spatial_index_.reset();
+  return storage_->xyzs_data();
+}
+int PointCloud::xyzs_stride() const {
+  return xyzs_padded() ? 4 : 3;
+}
+const T* PointCloud::normals_data() const {
+  return has_normals() ? storage_->normals_data() : nullptr;
+}
+T* PointCloud::mutable_normals_data() {
+  return has_normals() ? storage_->normals_data() : nullptr;
+}
+const C* PointCloud::rgbs_data() const {
+  return has_rgbs() ? storage_->rgbs_data() : nullptr;
+}
+C* PointCloud::mutable_rgbs_data() {
+  return has_rgbs() ? storage_->rgbs_data() : nullptr;
+}
+const D* PointCloud::descriptors_data() const {
+  return has_descriptors() ? storage_->descriptors_data() : nullptr;
+}
+D* PointCloud::mutable_descriptors_data() {
+  return has_descriptors() ? storage_->descriptors_data() : nullptr;
+}
+
 bool PointCloud::HasFields(
     pc_flags::Fields fields_in) const {
   DRAKE_DEMAND(!fields_in.contains(pc_flags::kInherit));
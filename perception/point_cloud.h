@@ -127,6 +127,9 @@ class PointCloud final {
 
   /// Conservative resize; will maintain existing data, and initialize new
   /// data to their invalid values.
+  /// Like `std::vector`, the memory is only reallocated if `new_size` exceeds
+  /// the `capacity()`, which then becomes `new_size`; shrinking the cloud
+  /// keeps its capacity.
   /// @param new_size
   ///    The new size of the value. If less than the present `size()`, then
   ///    the values will be truncated. If greater than the present `size()`,
@@ -136,6 +139,16 @@ class PointCloud final {
   ///    Do not default-initialize new values.
   void resize(int new_size, bool skip_initialize = false);
 
+  /// Returns the number of points that the cloud can hold without
+  /// reallocating its memory.
+  int capacity() const;
+
+  /// Allocates the memory for (at least) `new_capacity` points at once, so
+  /// that the cloud can then be resized up to that size without reallocating.
+  /// This does not change the size of the cloud, nor invalidate the
+  /// references to its values unless the capacity grows.
+  void reserve(int new_capacity);
+
   /// @name Geometric Descriptors - XYZs
   /// @{
 
@@ -147,6 +160,8 @@ class PointCloud final {
   Eigen::Ref<const Matrix3X<T>> xyzs() const;
 
   /// Returns mutable access to XYZ values.
+  /// This discards the spatial index (see @ref point_cloud_spatial_queries
+  /// "Spatial Queries").
   /// @pre `has_xyzs()` must be true.
   Eigen::Ref<Matrix3X<T>> mutable_xyzs();
 
@@ -160,6 +175,28 @@ class PointCloud final {
     return mutable_xyzs().col(i);
   }
 
+  /// Returns whether the XYZ values are padded (see set_xyzs_padded()).
+  bool xyzs_padded() const;
+
+  /// Sets whether the XYZ values are stored padded, as four floats per point
+  /// (x, y, z, 0), so that every point is 16-byte aligned. This is the layout
+  /// that SIMD kernels and GPU buffers typically consume, which padded_xyzs()
+  /// then provides without repacking. The other accessors are unchanged, and
+  /// the values are preserved.
+  /// @throws std::exception if `has_xyzs()` is false.
+  void set_xyzs_padded(bool padded);
+
+  /// Returns access to the padded XYZ values, as a 4 x size() matrix whose
+  /// last row is zero.
+  /// @pre `xyzs_padded()` must be true.
+  Eigen::Ref<const Matrix4X<T>> padded_xyzs() const;
+
+  /// Returns mutable access to the padded XYZ values. The last row must be
+  /// left at zero. This discards the spatial index (see
+  /// @ref point_cloud_spatial_queries "Spatial Queries").
+  /// @pre `xyzs_padded()` must be true.
+  Eigen::Ref<Matrix4X<T>> mutable_padded_xyzs();
+
   /// @}  // Geometric Descriptors - XYZs
 
   /// @name Geometric Descriptors - Normals
@@ -248,6 +285,31 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Raw Data
+  /// Pointers to the column-major storage of the fields, for the kernels that
+  /// loop over many points and would rather not pay for the checks and the
+  /// Eigen::Ref of the accessors above at each access. They are nullptr if the
+  /// cloud does not have the field, and are invalidated like the references.
+  /// The XYZ value of the point `i` starts at `xyzs_data()[i *
+  /// xyzs_stride()]`; the other fields are packed (3 values per point, or
+  /// `descriptor_type().size()` for the descriptors).
+  /// @{
+
+  const T* xyzs_data() const;
+  /// This discards the spatial index (see @ref point_cloud_spatial_queries
+  /// "Spatial Queries").
+  T* mutable_xyzs_data();
+  /// Returns 4 if `xyzs_padded()`, and 3 otherwise.
+  int xyzs_stride() const;
+  const T* normals_data() const;
+  T* mutable_normals_data();
+  const C* rgbs_data() const;
+  C* mutable_rgbs_data();
+  const D* descriptors_data() const;
+  D* mutable_descriptors_data();
+
+  /// @}
+
   /// @name Container Manipulation
   /// @{
 
@@ -267,7 +329,9 @@ class PointCloud final {
 
   // TODO(eric.cousineau): Add indexed version.
 
-  /// Adds `add_size` default-initialized points.
+  /// Adds `add_size` default-initialized points. If this exceeds the
+  /// capacity, it (at least) doubles, so that adding points one at a time
+  /// takes amortized constant time.
   /// @param add_size
   ///    Number of points to add.
   /// @param skip_initialization
@@ -276,6 +340,70 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Spatial Queries
+  /// @anchor point_cloud_spatial_queries
+  /// The spatial queries use a k-d tree of the finite XYZ values (the invalid
+  /// values are never found). It is built by the first query, in O(n log n)
+  /// time, and kept until the XYZ values may change: that is, until
+  /// mutable_xyzs() or mutable_xyz() is called, or the cloud is resized or
+  /// assigned to. (Changing the XYZ values through a reference that was
+  /// obtained before the index was built is not detected.)
+  ///
+  /// @note Since the first query modifies the cloud, the queries may only be
+  /// made concurrently from several threads after BuildSpatialIndex() has
+  /// been called.
+  /// @{
+
+  /// Builds the spatial index now, if it is not already built.
+  /// @pre `has_xyzs()` must be true.
+  void BuildSpatialIndex() const;
+
+  /// Finds the points whose XYZ values are within `radius` of `query`.
+  /// @param[out] indices The indices of the points, in no particular order.
+  ///   Its previous contents are discarded; its capacity is reused.
+  /// @pre `has_xyzs()` must be true.
+  void FindPointsWithinRadius(const Eigen::Ref<const Vector3<T>>& query,
+                              T radius, std::vector<int>* indices) const;
+
+  /// Finds the `num_neighbors` points whose XYZ values are the closest to
+  /// `query` (or all of the points, if there are fewer valid points).
+  /// @param[out] indices The indices of the points, from the closest to the
+  ///   farthest. Its previous contents are discarded; its capacity is reused.
+  /// @pre `has_xyzs()` must be true.
+  void FindNearestNeighbors(const Eigen::Ref<const Vector3<T>>& query,
+                            int num_neighbors, std::vector<int>* indices) const;
+
+  /// @}
+
+  /// @name Processing
+  /// @{
+
+  /// Returns a point cloud with the same fields that has one point per
+  /// occupied voxel of a grid with the given `voxel_size` (aligned with the
+  /// origin). Each of its points is the average of the points in the voxel:
+  /// its XYZ value, RGB color and descriptor are the averages of theirs, and
+  /// its normal is the normalized average of their normals. The points whose
+  /// XYZ values are not finite are ignored. The voxels are ordered by the
+  /// first point that they contain.
+  /// @pre `has_xyzs()` must be true.
+  /// @throws std::exception if `voxel_size` is not positive.
+  PointCloud VoxelizedDownSample(T voxel_size) const;
+
+  /// Estimates the normal of each point from the (at most) `num_closest`
+  /// points that are within `radius` of it (including itself), as the
+  /// direction of least variance of their XYZ values. The normals are
+  /// oriented towards the origin of the frame of the cloud (e.g., the camera
+  /// of a depth image). The normals of the points that have fewer than three
+  /// such neighbors, or whose XYZ values are not finite, are set to NaN.
+  /// @param num_threads The maximum number of threads to use; the result does
+  ///   not depend on it.
+  /// @pre `has_xyzs()` and `has_normals()` must be true.
+  /// @throws std::exception if `radius` is not positive, `num_closest` is
+  ///   less than three, or `num_threads` is less than one.
+  void EstimateNormals(T radius, int num_closest, int num_threads = 1);
+
+  /// @}
+
   /// @name Fields
   /// @{
 
@@ -312,12 +440,17 @@ class PointCloud final {
   // Provides PIMPL encapsulation of storage mechanism.
   class Storage;
 
+  // The k-d tree of the spatial queries.
+  class SpatialIndex;
+
   // Represents the size of the point cloud.
   int size_{};
   // Represents which fields are enabled for this point cloud.
   const pc_flags::Fields fields_{pc_flags::kXYZs};
   // Owns storage used for the point cloud.
   std::unique_ptr<Storage> storage_;
+  // The spatial index, if it was built since the XYZ values last changed.
+  mutable std::unique_ptr<SpatialIndex> spatial_index_;
 };
 
 // TODO(eric.cousineau): Consider a way of reinterpret_cast<>ing the array
@@ -470,6 +470,78 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that downsampling with a stride converts the same pixels as without
+// it, including the partial last row and column.
+GTEST_TEST(DepthImageToPointCloudStrideTest, MatchesFullResolution) {
+  constexpr int kWidth = 7;
+  constexpr int kHeight = 5;
+  constexpr int kStride = 3;
+  const CameraInfo camera(kWidth, kHeight, 10.0, 12.0, 3.2, 1.9);
+  const RigidTransformd pose(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+
+  systems::sensors::ImageDepth32F depth_image(kWidth, kHeight);
+  ImageRgba8U color_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      *depth_image.at(u, v) = 0.5f + 0.1f * u + 0.2f * v;
+      color_image.at(u, v)[0] = static_cast<uint8_t>(u);
+      color_image.at(u, v)[1] = static_cast<uint8_t>(v);
+      color_image.at(u, v)[2] = static_cast<uint8_t>(u + v);
+    }
+  }
+  // Some invalid pixels, one of which is downsampled away.
+  *depth_image.at(3, 0) = 0.0f;
+  *depth_image.at(6, 3) = kFloatInf;
+  *depth_image.at(1, 1) = kFloatNaN;
+
+  const DepthImageToPointCloud full(camera, PixelType::kDepth32F, 0.5f,
+                                    fields);
+  const DepthImageToPointCloud strided(camera, PixelType::kDepth32F, 0.5f,
+                                       fields, kStride);
+  auto full_context = full.CreateDefaultContext();
+  auto strided_context = strided.CreateDefaultContext();
+  for (auto* context : {full_context.get(), strided_context.get()}) {
+    context->FixInputPort(
+        0, Value<systems::sensors::ImageDepth32F>(depth_image));
+    context->FixInputPort(1, Value<ImageRgba8U>(color_image));
+    context->FixInputPort(2, Value<RigidTransformd>(pose));
+  }
+  const auto& full_cloud =
+      full.point_cloud_output_port().Eval<PointCloud>(*full_context);
+  const auto& strided_cloud =
+      strided.point_cloud_output_port().Eval<PointCloud>(*strided_context);
+
+  constexpr int kStridedWidth = 3;
+  constexpr int kStridedHeight = 2;
+  ASSERT_EQ(strided_cloud.size(), kStridedWidth * kStridedHeight);
+  for (int r = 0; r < kStridedHeight; ++r) {
+    for (int c = 0; c < kStridedWidth; ++c) {
+      const int i = r * kStridedWidth + c;
+      const int full_i = r * kStride * kWidth + c * kStride;
+      EXPECT_TRUE(CompareMatrices(strided_cloud.xyz(i), full_cloud.xyz(full_i),
+                                  1e-6));
+      EXPECT_EQ(strided_cloud.rgb(i), full_cloud.rgb(full_i));
+    }
+  }
+  EXPECT_TRUE(strided_cloud.xyz(1).array().isInf().all());
+  EXPECT_TRUE(strided_cloud.xyz(5).array().isInf().all());
+
+  // The reference formula, for a valid pixel.
+  const int u = 3;
+  const int v = 3;
+  const float z = 0.5f * *depth_image.at(u, v);
+  const Vector3d p_CP((u - camera.center_x()) / camera.focal_x() * z,
+                      (v - camera.center_y()) / camera.focal_y() * z, z);
+  EXPECT_TRUE(CompareMatrices(strided_cloud.xyz(4),
+                              (pose * p_CP).cast<float>().eval(), 1e-5));
+
+  EXPECT_THROW(DepthImageToPointCloud(camera, PixelType::kDepth32F, 1.0f,
+                                      fields, 0),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
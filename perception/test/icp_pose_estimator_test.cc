@@ -0,0 +1,99 @@
+#include "drake/perception/icp_pose_estimator.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+using drake::math::RigidTransformd;
+using drake::math::RollPitchYawd;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Returns the points sampled on a grid of the three faces of the corner of a
+// 1 × 0.6 × 0.4 box at the origin.
+PointCloud MakeCorner() {
+  std::vector<Vector3f> xyzs;
+  for (int i = 0; i <= 10; ++i) {
+    for (int j = 0; j <= 6; ++j) xyzs.emplace_back(0.1 * i, 0.1 * j, 0);
+    for (int k = 1; k <= 4; ++k) xyzs.emplace_back(0.1 * i, 0, 0.1 * k);
+  }
+  for (int j = 1; j <= 6; ++j) {
+    for (int k = 1; k <= 4; ++k) xyzs.emplace_back(0, 0.1 * j, 0.1 * k);
+  }
+  PointCloud cloud(xyzs.size());
+  for (int i = 0; i < cloud.size(); ++i) cloud.mutable_xyz(i) = xyzs[i];
+  return cloud;
+}
+
+class IcpPoseEstimatorTest : public ::testing::Test {
+ protected:
+  IcpPoseEstimatorTest() {
+    for (int i = 0; i < model_.size(); ++i) {
+      scene_.mutable_xyz(i) =
+          (X_SM_ * model_.xyz(i).cast<double>()).cast<float>();
+    }
+    params_.metric = IcpMetric::kPointToPoint;
+    params_.max_iterations = 100;
+  }
+
+  const PointCloud model_{MakeCorner()};
+  const RigidTransformd X_SM_{RollPitchYawd(0.05, -0.04, 0.08),
+                              Vector3d(0.02, -0.03, 0.01)};
+  PointCloud scene_{model_.size()};
+  IcpParams params_;
+};
+
+TEST_F(IcpPoseEstimatorTest, Ports) {
+  const IcpPoseEstimator dut(model_, RigidTransformd(), params_);
+  EXPECT_EQ(dut.point_cloud_input_port().get_name(), "point_cloud");
+  EXPECT_EQ(dut.initial_pose_input_port().get_name(), "initial_pose");
+  EXPECT_EQ(dut.pose_output_port().get_name(), "pose");
+}
+
+// The estimate starts from the constructor's initial pose, unless the
+// initial_pose input is connected.
+TEST_F(IcpPoseEstimatorTest, EstimatesPose) {
+  const IcpPoseEstimator dut(model_, RigidTransformd(), params_);
+  auto context = dut.CreateDefaultContext();
+  context->FixInputPort(dut.point_cloud_input_port().get_index(),
+                        Value<PointCloud>(scene_));
+  const RigidTransformd& X_SM =
+      dut.pose_output_port().Eval<RigidTransformd>(*context);
+  EXPECT_TRUE(X_SM.IsNearlyEqualTo(X_SM_, 1e-5));
+
+  // With a single iteration, the estimate depends on its initial pose.
+  IcpParams one_iteration = params_;
+  one_iteration.max_iterations = 1;
+  const IcpPoseEstimator one_step(model_, RigidTransformd(), one_iteration);
+  auto one_step_context = one_step.CreateDefaultContext();
+  one_step_context->FixInputPort(
+      one_step.point_cloud_input_port().get_index(),
+      Value<PointCloud>(scene_));
+  const RigidTransformd X_SM_guess(Vector3d(0.5, 0, 0));
+  one_step_context->FixInputPort(
+      one_step.initial_pose_input_port().get_index(),
+      Value<RigidTransformd>(X_SM_guess));
+  const IcpResult expected = EstimatePoseIcp(
+      model_, scene_, X_SM_guess.inverse(), one_iteration);
+  EXPECT_TRUE(
+      one_step.pose_output_port()
+          .Eval<RigidTransformd>(*one_step_context)
+          .IsNearlyEqualTo(expected.X_MS.inverse(), 1e-12));
+}
+
+GTEST_TEST(IcpPoseEstimatorConstructorTest, RequiresNormals) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      IcpPoseEstimator(MakeCorner(), RigidTransformd()), std::exception,
+      ".*has_normals.*");
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
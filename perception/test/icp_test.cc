@@ -0,0 +1,140 @@
+#include "drake/perception/icp.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+using drake::math::RigidTransformd;
+using drake::math::RollPitchYawd;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Returns the points (and normals) sampled on a grid of the three faces of
+// the corner of a 1 × 0.6 × 0.4 box at the origin, which determine a pose
+// uniquely.
+PointCloud MakeCorner() {
+  const double kStep = 0.05;
+  std::vector<Vector3f> xyzs;
+  std::vector<Vector3f> normals;
+  for (int i = 0; i <= 20; ++i) {
+    for (int j = 0; j <= 12; ++j) {
+      xyzs.emplace_back(i * kStep, j * kStep, 0);
+      normals.push_back(Vector3f::UnitZ());
+    }
+    for (int k = 1; k <= 8; ++k) {
+      xyzs.emplace_back(i * kStep, 0, k * kStep);
+      normals.push_back(Vector3f::UnitY());
+    }
+  }
+  for (int j = 1; j <= 12; ++j) {
+    for (int k = 1; k <= 8; ++k) {
+      xyzs.emplace_back(0, j * kStep, k * kStep);
+      normals.push_back(Vector3f::UnitX());
+    }
+  }
+  PointCloud cloud(xyzs.size(), pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < cloud.size(); ++i) {
+    cloud.mutable_xyz(i) = xyzs[i];
+    cloud.mutable_normal(i) = normals[i];
+  }
+  return cloud;
+}
+
+// Returns the `model` points transformed by X_SM, in frame S.
+PointCloud Transform(const PointCloud& model, const RigidTransformd& X_SM) {
+  PointCloud scene(model.size(), pc_flags::kXYZs);
+  for (int i = 0; i < model.size(); ++i) {
+    scene.mutable_xyz(i) = (X_SM * model.xyz(i).cast<double>()).cast<float>();
+  }
+  return scene;
+}
+
+class IcpTest : public ::testing::TestWithParam<IcpMetric> {
+ protected:
+  const PointCloud model_{MakeCorner()};
+  const RigidTransformd X_SM_{RollPitchYawd(0.05, -0.04, 0.08),
+                              Vector3d(0.02, -0.03, 0.01)};
+  const PointCloud scene_{Transform(model_, X_SM_)};
+};
+
+TEST_P(IcpTest, RecoversPose) {
+  IcpParams params;
+  params.metric = GetParam();
+  params.max_iterations = 100;
+  const IcpResult result =
+      EstimatePoseIcp(model_, scene_, RigidTransformd(), params);
+  EXPECT_TRUE(result.converged);
+  EXPECT_LT(result.num_iterations, params.max_iterations);
+  EXPECT_EQ(result.num_correspondences, scene_.size());
+  EXPECT_LT(result.rms_error, 1e-5);
+  EXPECT_TRUE(result.X_MS.IsNearlyEqualTo(X_SM_.inverse(), 1e-5));
+}
+
+// The blocks of points are summed in the same order whatever the number of
+// threads, so that the result is exactly the same.
+TEST_P(IcpTest, ThreadsDoNotChangeResult) {
+  IcpParams params;
+  params.metric = GetParam();
+  params.max_iterations = 5;
+  const IcpResult serial =
+      EstimatePoseIcp(model_, scene_, RigidTransformd(), params);
+  params.num_threads = 3;
+  const IcpResult parallel =
+      EstimatePoseIcp(model_, scene_, RigidTransformd(), params);
+  EXPECT_EQ(parallel.num_iterations, serial.num_iterations);
+  EXPECT_EQ(parallel.rms_error, serial.rms_error);
+  EXPECT_TRUE(CompareMatrices(parallel.X_MS.GetAsMatrix34(),
+                              serial.X_MS.GetAsMatrix34(), 0));
+}
+
+// Without enough correspondences, the initial estimate is returned.
+TEST_P(IcpTest, TooFewCorrespondences) {
+  IcpParams params;
+  params.metric = GetParam();
+  params.max_correspondence_distance = 1e-6;
+  const RigidTransformd X_MS_initial(Vector3d(0, 0, 1));
+  const IcpResult result =
+      EstimatePoseIcp(model_, scene_, X_MS_initial, params);
+  EXPECT_FALSE(result.converged);
+  EXPECT_EQ(result.num_iterations, 1);
+  EXPECT_EQ(result.num_correspondences, 0);
+  EXPECT_TRUE(std::isnan(result.rms_error));
+  EXPECT_TRUE(result.X_MS.IsExactlyEqualTo(X_MS_initial));
+}
+
+INSTANTIATE_TEST_CASE_P(Metrics, IcpTest,
+                        ::testing::Values(IcpMetric::kPointToPoint,
+                                          IcpMetric::kPointToPlane));
+
+GTEST_TEST(IcpParamsTest, Validation) {
+  const PointCloud model = MakeCorner();
+  IcpParams params;
+  params.max_iterations = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      EstimatePoseIcp(model, model, RigidTransformd(), params),
+      std::exception, ".*max_iterations.*");
+  params = IcpParams();
+  params.max_correspondence_distance = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      EstimatePoseIcp(model, model, RigidTransformd(), params),
+      std::exception, ".*max_correspondence_distance.*");
+  params = IcpParams();
+  params.num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      EstimatePoseIcp(model, model, RigidTransformd(), params),
+      std::exception, ".*num_threads.*");
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -1,7 +1,13 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -256,6 +262,190 @@ GTEST_TEST(PointCloudTest, Fields) {
   }
 }
 
+GTEST_TEST(PointCloudTest, Capacity) {
+  PointCloud cloud(2, pc_flags::kXYZs | pc_flags::kRGBs);
+  EXPECT_EQ(cloud.capacity(), 2);
+  cloud.mutable_xyzs() << 1, 2, 3, 4, 5, 6;
+  cloud.reserve(10);
+  EXPECT_EQ(cloud.size(), 2);
+  EXPECT_EQ(cloud.capacity(), 10);
+  const float* const data = cloud.xyzs_data();
+
+  // Resizing within the capacity does not reallocate.
+  cloud.resize(10);
+  cloud.resize(1);
+  cloud.Expand(4);
+  EXPECT_EQ(cloud.size(), 5);
+  EXPECT_EQ(cloud.capacity(), 10);
+  EXPECT_EQ(cloud.xyzs_data(), data);
+  EXPECT_TRUE(CompareMatrices(cloud.xyz(0), Eigen::Vector3f(1, 3, 5)));
+  EXPECT_TRUE(cloud.xyzs().rightCols(4).array().isNaN().all());
+
+  // Expanding beyond the capacity doubles it.
+  cloud.Expand(6);
+  EXPECT_EQ(cloud.size(), 11);
+  EXPECT_EQ(cloud.capacity(), 20);
+  EXPECT_TRUE(CompareMatrices(cloud.xyz(0), Eigen::Vector3f(1, 3, 5)));
+
+  // The raw accessors.
+  EXPECT_EQ(cloud.xyzs_stride(), 3);
+  EXPECT_EQ(cloud.xyzs_data()[2], 5);
+  EXPECT_EQ(cloud.mutable_rgbs_data(), cloud.mutable_rgbs().data());
+  EXPECT_EQ(cloud.normals_data(), nullptr);
+  EXPECT_EQ(cloud.descriptors_data(), nullptr);
+}
+
+GTEST_TEST(PointCloudTest, PaddedXyzs) {
+  PointCloud cloud(2);
+  EXPECT_FALSE(cloud.xyzs_padded());
+  cloud.mutable_xyzs() << 1, 2, 3, 4, 5, 6;
+  cloud.set_xyzs_padded(true);
+  EXPECT_TRUE(cloud.xyzs_padded());
+  EXPECT_EQ(cloud.xyzs_stride(), 4);
+  Matrix4Xf expected(4, 2);
+  expected << 1, 2, 3, 4, 5, 6, 0, 0;
+  EXPECT_TRUE(CompareMatrices(cloud.padded_xyzs(), expected));
+  EXPECT_EQ(cloud.padded_xyzs().data(), cloud.xyzs_data());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.xyzs_data()) % 16, 0);
+
+  // The other accessors see the same values, and new points are padded too.
+  cloud.mutable_xyz(1) = Eigen::Vector3f(7, 8, 9);
+  EXPECT_EQ(cloud.xyzs_data()[4], 7);
+  cloud.resize(3);
+  EXPECT_EQ(cloud.padded_xyzs()(3, 2), 0);
+  EXPECT_TRUE(cloud.xyz(2).array().isNaN().all());
+
+  // Copies keep the layout.
+  const PointCloud copy(cloud);
+  EXPECT_TRUE(copy.xyzs_padded());
+  EXPECT_TRUE(CompareMatrices(copy.xyzs(), cloud.xyzs()));
+
+  cloud.set_xyzs_padded(false);
+  EXPECT_EQ(cloud.xyzs_stride(), 3);
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), copy.xyzs()));
+
+  EXPECT_THROW(PointCloud(1, pc_flags::kRGBs).set_xyzs_padded(true),
+               std::exception);
+}
+
+// Returns a cloud of `count` pseudo-random points in the unit cube, with one
+// invalid point.
+PointCloud MakeRandomCloud(int count) {
+  PointCloud cloud(count);
+  cloud.mutable_xyzs() = Matrix3Xf::Random(3, count);
+  cloud.mutable_xyz(count / 2) = Eigen::Vector3f::Constant(
+      std::numeric_limits<float>::infinity());
+  return cloud;
+}
+
+GTEST_TEST(PointCloudTest, SpatialQueries) {
+  const PointCloud cloud = MakeRandomCloud(1000);
+  const Eigen::Vector3f query(0.1, -0.2, 0.3);
+  const Matrix3Xf& points = cloud.xyzs();
+
+  // Brute-force references.
+  std::vector<std::pair<float, int>> sorted;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (points.col(i).allFinite()) {
+      sorted.emplace_back((points.col(i) - query).squaredNorm(), i);
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  std::vector<int> indices;
+  for (const float radius : {0.f, 0.05f, 0.3f, 10.f}) {
+    cloud.FindPointsWithinRadius(query, radius, &indices);
+    std::sort(indices.begin(), indices.end());
+    std::vector<int> expected;
+    for (const auto& distance_and_index : sorted) {
+      if (distance_and_index.first <= radius * radius) {
+        expected.push_back(distance_and_index.second);
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(indices, expected);
+  }
+
+  for (const int k : {1, 7, 100, 5000}) {
+    cloud.FindNearestNeighbors(query, k, &indices);
+    ASSERT_EQ(indices.size(), std::min<size_t>(k, sorted.size()));
+    for (size_t i = 0; i < indices.size(); ++i) {
+      EXPECT_EQ(indices[i], sorted[i].second);
+    }
+  }
+
+  // The index is rebuilt after the points change.
+  PointCloud copy(cloud);
+  copy.FindNearestNeighbors(query, 1, &indices);
+  EXPECT_EQ(indices[0], sorted[0].second);
+  copy.mutable_xyz(sorted[1].second) = query;
+  copy.FindNearestNeighbors(query, 1, &indices);
+  EXPECT_EQ(indices[0], sorted[1].second);
+  copy.resize(0);
+  copy.FindNearestNeighbors(query, 1, &indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
+  PointCloud cloud(5, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs);
+  cloud.mutable_xyzs() <<
+    0.1, 0.3, 1.5, 0.2, NAN,
+    0.1, 0.3, 0.5, 0.4, 0,
+    -0.5, -0.7, 0.5, 0.1, 0;
+  cloud.mutable_normals() <<
+    1, 0, 0, 1, 0,
+    0, 1, 0, 0, 0,
+    0, 0, 1, 0, 1;
+  cloud.mutable_rgbs() <<
+    10, 20, 30, 40, 50,
+    0, 0, 0, 0, 0,
+    255, 255, 255, 254, 0;
+
+  const PointCloud result = cloud.VoxelizedDownSample(1.0);
+  EXPECT_EQ(result.fields(), cloud.fields());
+  ASSERT_EQ(result.size(), 3);
+  // The first voxel has the points 0 and 1, the second the point 2 and the
+  // third the point 3.
+  EXPECT_TRUE(CompareMatrices(result.xyz(0),
+                              Eigen::Vector3f(0.2, 0.2, -0.6), 1e-6));
+  EXPECT_TRUE(CompareMatrices(result.xyz(1), cloud.xyz(2)));
+  EXPECT_TRUE(CompareMatrices(result.xyz(2), cloud.xyz(3)));
+  EXPECT_TRUE(CompareMatrices(result.normal(0),
+                              Eigen::Vector3f(M_SQRT1_2, M_SQRT1_2, 0),
+                              1e-6));
+  EXPECT_EQ(result.rgb(0), Vector3<uint8_t>(15, 0, 255));
+  EXPECT_EQ(result.rgb(2), Vector3<uint8_t>(40, 0, 254));
+
+  EXPECT_THROW(cloud.VoxelizedDownSample(0), std::exception);
+}
+
+GTEST_TEST(PointCloudTest, EstimateNormals) {
+  // A grid on the plane z = 1 - x, seen from the origin.
+  const int n = 20;
+  PointCloud cloud(n * n + 1, pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const float x = 0.05 * i;
+      cloud.mutable_xyz(i * n + j) = Eigen::Vector3f(x, 0.05 * j, 1 - x);
+    }
+  }
+  // An isolated point.
+  cloud.mutable_xyz(n * n) = Eigen::Vector3f(10, 10, 10);
+
+  const Eigen::Vector3f expected(-M_SQRT1_2, 0, -M_SQRT1_2);
+  for (const int num_threads : {1, 3}) {
+    cloud.EstimateNormals(0.2, 10, num_threads);
+    for (int i = 0; i < n * n; ++i) {
+      EXPECT_TRUE(CompareMatrices(cloud.normal(i), expected, 1e-5));
+    }
+    EXPECT_TRUE(cloud.normal(n * n).array().isNaN().all());
+  }
+
+  EXPECT_THROW(cloud.EstimateNormals(0, 10), std::exception);
+  EXPECT_THROW(cloud.EstimateNormals(0.2, 2), std::exception);
+  EXPECT_THROW(cloud.EstimateNormals(0.2, 10, 0), std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
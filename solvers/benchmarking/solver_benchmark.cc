@@ -0,0 +1,438 @@
+/// @file
+///
+/// Times the solvers of MathematicalProgram on the same problems, read from
+/// files: QPs in the QPS format (e.g., the Maros-Meszaros set) and SDPs in the
+/// SDPA sparse format (e.g., SDPLIB; see ParseSDPA()). The problem sets
+/// themselves aren't part of Drake; by default, a small problem of each kind
+/// is solved.
+///
+/// For each problem and each of the available solvers which support it, the
+/// time spent in the solver (as reported by the solver, for those which
+/// report it) is printed apart from the total time of Solve(), so that the
+/// difference -- the time spent by the MathematicalProgram adapter to set up
+/// the problem for the solver and to read back its solution -- can be
+/// measured. The time to read the problem isn't included.
+///
+/// The optimal costs are checked against the reference objectives listed in
+/// the --reference_objectives file, if any, whose lines are the names of the
+/// problems (their file names, without extension) followed by their optimal
+/// objectives. The program fails if any solution doesn't match.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Sparse>
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_optional.h"
+#include "drake/common/find_resource.h"
+#include "drake/solvers/csdp_solver.h"
+#include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mosek_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/solvers/sdpa_free_format.h"
+#include "drake/solvers/snopt_solver.h"
+
+DEFINE_string(problems, "",
+              "Comma-separated files of the problems, in the QPS format "
+              "(extension .qps or .mps) or the SDPA sparse format (extension "
+              ".dat-s). By default, two small sample problems are solved.");
+DEFINE_string(reference_objectives, "",
+              "The file of the optimal objectives of the problems. By "
+              "default, that of the sample problems is used if they are "
+              "solved.");
+DEFINE_string(solvers, "osqp,scs,gurobi,mosek,snopt,ipopt,csdp",
+              "Comma-separated solvers to time, among osqp, scs, gurobi, "
+              "mosek, snopt, ipopt and csdp; those which aren't available or "
+              "don't support a problem are skipped.");
+DEFINE_int32(num_solves, 3,
+             "Number of solves per problem and solver; the fastest is "
+             "reported.");
+DEFINE_double(tolerance, 1e-3,
+              "The tolerance of the comparison of the optimal costs with the "
+              "reference objectives, relative to max(1, |objective|).");
+
+namespace drake {
+namespace solvers {
+namespace benchmarking {
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+std::vector<std::string> Split(const std::string& list) {
+  std::vector<std::string> items;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) items.push_back(item);
+  return items;
+}
+
+bool EndsWith(const std::string& text, const std::string& suffix) {
+  return text.size() >= suffix.size() &&
+         text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Returns the name of the problem in `file_name`: its file name, without the
+// directory and the extension.
+std::string ProblemName(const std::string& file_name) {
+  const std::string base = file_name.substr(file_name.find_last_of('/') + 1);
+  return base.substr(0, base.find('.'));
+}
+
+// Reads the QP in the QPS format (the MPS format of LPs with a QUADOBJ or a
+// QMATRIX section for the quadratic objective) from `file_name`, as the
+// program min ½xᵀQx + cᵀx + c₀ s.t. lb ≤ Ax ≤ ub, x_lb ≤ x ≤ x_ub.
+std::unique_ptr<MathematicalProgram> ReadQps(const std::string& file_name) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open the file " + file_name);
+  }
+  auto fail = [&file_name](const std::string& line) {
+    return std::runtime_error(fmt::format(
+        "The file {} is not in the (supported) QPS format, at: {}", file_name,
+        line));
+  };
+
+  std::string objective_row;
+  // The index and the type (E, L or G) of each constraint row.
+  std::map<std::string, std::pair<int, char>> rows;
+  std::map<std::string, int> columns;
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  std::vector<Eigen::Triplet<double>> Q_triplets;
+  std::vector<double> c;
+  std::vector<double> rhs;
+  std::vector<double> ranges;
+  std::vector<double> x_lb;
+  std::vector<double> x_ub;
+  double c0 = 0;
+
+  auto find_column = [&](const std::string& name, const std::string& line) {
+    const auto iter = columns.find(name);
+    if (iter == columns.end()) throw fail(line);
+    return iter->second;
+  };
+  // Sets the `values` of the rows listed in a line of the RHS or RANGES
+  // section: pairs of row names and values.
+  auto read_row_values = [&](const std::vector<std::string>& tokens,
+                             const std::string& line,
+                             std::vector<double>* values, bool is_rhs) {
+    // The name of the set of values is optional.
+    for (size_t i = tokens.size() % 2; i + 1 < tokens.size(); i += 2) {
+      const double value = std::stod(tokens[i + 1]);
+      if (tokens[i] == objective_row) {
+        if (!is_rhs) throw fail(line);
+        // The right-hand side of the objective is the opposite of its constant.
+        c0 = -value;
+        continue;
+      }
+      const auto iter = rows.find(tokens[i]);
+      if (iter == rows.end()) throw fail(line);
+      (*values)[iter->second.first] = value;
+    }
+  };
+
+  std::string section;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '*') continue;
+    std::vector<std::string> tokens;
+    {
+      std::stringstream stream(line);
+      std::string token;
+      while (stream >> token) tokens.push_back(token);
+    }
+    if (tokens.empty()) continue;
+    if (line[0] != ' ' && line[0] != '\t') {
+      section = tokens[0];
+      if (section == "ENDATA") break;
+      if (section == "RHS") {
+        rhs.assign(rows.size(), 0.0);
+      } else if (section == "RANGES") {
+        ranges.assign(rows.size(), kInf);
+      } else if (section == "BOUNDS") {
+        // Without bounds, the variables are nonnegative.
+        x_lb.assign(columns.size(), 0.0);
+        x_ub.assign(columns.size(), kInf);
+      } else if (section != "NAME" && section != "ROWS" &&
+                 section != "COLUMNS" && section != "QUADOBJ" &&
+                 section != "QMATRIX") {
+        throw fail(line);
+      }
+      continue;
+    }
+    try {
+      if (section == "ROWS") {
+        if (tokens.size() != 2) throw fail(line);
+        const char type = tokens[0][0];
+        if (type == 'N') {
+          if (objective_row.empty()) objective_row = tokens[1];
+        } else if (type == 'E' || type == 'L' || type == 'G') {
+          const int index = static_cast<int>(rows.size());
+          rows[tokens[1]] = {index, type};
+        } else {
+          throw fail(line);
+        }
+      } else if (section == "COLUMNS") {
+        if (line.find("'MARKER'") != std::string::npos) {
+          throw std::runtime_error(fmt::format(
+              "The file {} has integer variables, which aren't supported",
+              file_name));
+        }
+        if (tokens.size() != 3 && tokens.size() != 5) throw fail(line);
+        const auto inserted =
+            columns.insert({tokens[0], static_cast<int>(columns.size())});
+        const int col = inserted.first->second;
+        if (inserted.second) c.push_back(0.0);
+        for (size_t i = 1; i + 1 < tokens.size(); i += 2) {
+          const double value = std::stod(tokens[i + 1]);
+          if (tokens[i] == objective_row) {
+            c[col] = value;
+          } else {
+            const auto iter = rows.find(tokens[i]);
+            if (iter == rows.end()) throw fail(line);
+            A_triplets.emplace_back(iter->second.first, col, value);
+          }
+        }
+      } else if (section == "RHS") {
+        read_row_values(tokens, line, &rhs, true);
+      } else if (section == "RANGES") {
+        read_row_values(tokens, line, &ranges, false);
+      } else if (section == "BOUNDS") {
+        const std::string& type = tokens[0];
+        const bool has_value = type != "FR" && type != "MI" && type != "PL";
+        // The name of the set of bounds is optional.
+        const size_t num_tokens = has_value ? 3 : 2;
+        if (tokens.size() != num_tokens && tokens.size() != num_tokens + 1) {
+          throw fail(line);
+        }
+        const int col = find_column(
+            tokens[tokens.size() - (has_value ? 2 : 1)], line);
+        const double value = has_value ? std::stod(tokens.back()) : 0.0;
+        if (type == "UP") {
+          x_ub[col] = value;
+          // The historical rule of the MPS format.
+          if (value < 0 && x_lb[col] == 0) x_lb[col] = -kInf;
+        } else if (type == "LO") {
+          x_lb[col] = value;
+        } else if (type == "FX") {
+          x_lb[col] = value;
+          x_ub[col] = value;
+        } else if (type == "FR") {
+          x_lb[col] = -kInf;
+          x_ub[col] = kInf;
+        } else if (type == "MI") {
+          x_lb[col] = -kInf;
+        } else if (type == "PL") {
+          x_ub[col] = kInf;
+        } else {
+          throw fail(line);
+        }
+      } else if (section == "QUADOBJ" || section == "QMATRIX") {
+        if (tokens.size() != 3) throw fail(line);
+        const int i = find_column(tokens[0], line);
+        const int j = find_column(tokens[1], line);
+        const double value = std::stod(tokens[2]);
+        Q_triplets.emplace_back(i, j, value);
+        // QUADOBJ only has the lower triangle of Q, and QMATRIX all of it.
+        if (section == "QUADOBJ" && i != j) {
+          Q_triplets.emplace_back(j, i, value);
+        }
+      } else {
+        throw fail(line);
+      }
+    } catch (const std::invalid_argument&) {
+      // From std::stod().
+      throw fail(line);
+    }
+  }
+
+  const int num_rows = static_cast<int>(rows.size());
+  const int num_cols = static_cast<int>(columns.size());
+  rhs.resize(num_rows, 0.0);
+  ranges.resize(num_rows, kInf);
+  x_lb.resize(num_cols, 0.0);
+  x_ub.resize(num_cols, kInf);
+  Eigen::VectorXd lb(num_rows);
+  Eigen::VectorXd ub(num_rows);
+  for (const auto& row : rows) {
+    const int i = row.second.first;
+    const double r = ranges[i];
+    switch (row.second.second) {
+      case 'E':
+        lb(i) = std::isinf(r) || r >= 0 ? rhs[i] : rhs[i] + r;
+        ub(i) = std::isinf(r) ? rhs[i] : (r >= 0 ? rhs[i] + r : rhs[i]);
+        break;
+      case 'L':
+        lb(i) = std::isinf(r) ? -kInf : rhs[i] - std::abs(r);
+        ub(i) = rhs[i];
+        break;
+      default:  // 'G'
+        lb(i) = rhs[i];
+        ub(i) = std::isinf(r) ? kInf : rhs[i] + std::abs(r);
+        break;
+    }
+  }
+
+  auto prog = std::make_unique<MathematicalProgram>();
+  const VectorXDecisionVariable x = prog->NewContinuousVariables(num_cols, "x");
+  Eigen::SparseMatrix<double> Q(num_cols, num_cols);
+  Q.setFromTriplets(Q_triplets.begin(), Q_triplets.end());
+  const Eigen::Map<const Eigen::VectorXd> c_vector(c.data(), num_cols);
+  if (Q.nonZeros() > 0) {
+    prog->AddQuadraticCost(Eigen::MatrixXd(Q), c_vector, c0, x);
+  } else {
+    prog->AddLinearCost(c_vector, c0, x);
+  }
+  if (num_rows > 0) {
+    Eigen::SparseMatrix<double> A(num_rows, num_cols);
+    A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+    prog->AddLinearConstraint(A, lb, ub, x);
+  }
+  prog->AddBoundingBoxConstraint(
+      Eigen::Map<const Eigen::VectorXd>(x_lb.data(), num_cols),
+      Eigen::Map<const Eigen::VectorXd>(x_ub.data(), num_cols), x);
+  return prog;
+}
+
+std::unique_ptr<SolverInterface> MakeSolver(const std::string& name) {
+  if (name == "osqp") return std::make_unique<OsqpSolver>();
+  if (name == "scs") return std::make_unique<ScsSolver>();
+  if (name == "gurobi") return std::make_unique<GurobiSolver>();
+  if (name == "mosek") return std::make_unique<MosekSolver>();
+  if (name == "snopt") return std::make_unique<SnoptSolver>();
+  if (name == "ipopt") return std::make_unique<IpoptSolver>();
+  if (name == "csdp") return std::make_unique<CsdpSolver>();
+  throw std::runtime_error("Unknown solver: " + name);
+}
+
+// Returns the time spent in the solver itself, in seconds, for the solvers
+// which report it.
+optional<double> GetSolverTime(const std::string& name,
+                               const MathematicalProgramResult& result) {
+  if (name == "osqp") {
+    return result.get_solver_details<OsqpSolver>().run_time;
+  }
+  if (name == "scs") {
+    const auto& details = result.get_solver_details<ScsSolver>();
+    return (details.scs_setup_time + details.scs_solve_time) / 1000;
+  }
+  if (name == "gurobi") {
+    return result.get_solver_details<GurobiSolver>().optimizer_time;
+  }
+  if (name == "mosek") {
+    return result.get_solver_details<MosekSolver>().optimizer_time;
+  }
+  return nullopt;
+}
+
+std::map<std::string, double> ReadReferenceObjectives(
+    const std::string& file_name) {
+  std::map<std::string, double> objectives;
+  if (file_name.empty()) return objectives;
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open the file " + file_name);
+  }
+  std::string name;
+  double objective{};
+  while (file >> name >> objective) objectives[name] = objective;
+  return objectives;
+}
+
+int do_main() {
+  std::vector<std::string> problems = Split(FLAGS_problems);
+  std::string reference_objectives = FLAGS_reference_objectives;
+  if (problems.empty()) {
+    const std::string dir = "drake/solvers/benchmarking/problems/";
+    problems = {FindResourceOrThrow(dir + "hs21.qps"),
+                FindResourceOrThrow(dir + "sdpa_sample.dat-s")};
+    if (reference_objectives.empty()) {
+      reference_objectives =
+          FindResourceOrThrow(dir + "reference_objectives.txt");
+    }
+  }
+  const std::map<std::string, double> references =
+      ReadReferenceObjectives(reference_objectives);
+
+  std::cout << fmt::format("{:>16} {:>8} {:>14} {:>14} {:>14} {:>16} {}\n",
+                           "problem", "solver", "total [ms]", "solver [ms]",
+                           "adapter [ms]", "cost", "check");
+  int num_mismatches = 0;
+  for (const std::string& file_name : problems) {
+    const std::string name = ProblemName(file_name);
+    const std::unique_ptr<MathematicalProgram> prog =
+        EndsWith(file_name, ".dat-s") ? ParseSDPA(file_name)
+                                      : ReadQps(file_name);
+    const auto reference = references.find(name);
+    for (const std::string& solver_name : Split(FLAGS_solvers)) {
+      const std::unique_ptr<SolverInterface> solver = MakeSolver(solver_name);
+      if (!solver->available() ||
+          !solver->AreProgramAttributesSatisfied(*prog)) {
+        continue;
+      }
+      double total = kInf;
+      optional<double> solver_time;
+      MathematicalProgramResult result;
+      for (int i = 0; i < FLAGS_num_solves; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        solver->Solve(*prog, nullopt, nullopt, &result);
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < total) {
+          total = elapsed.count();
+          solver_time = GetSolverTime(solver_name, result);
+        }
+      }
+      std::string check = "-";
+      if (!result.is_success()) {
+        check = fmt::format("FAILED ({})",
+                            to_string(result.get_solution_result()));
+        ++num_mismatches;
+      } else if (reference != references.end()) {
+        const double error = std::abs(result.get_optimal_cost() -
+                                      reference->second);
+        if (error <= FLAGS_tolerance *
+                         std::max(1.0, std::abs(reference->second))) {
+          check = "ok";
+        } else {
+          check = fmt::format("MISMATCH (reference {})", reference->second);
+          ++num_mismatches;
+        }
+      }
+      std::cout << fmt::format(
+          "{:>16} {:>8} {:>14.3f} {:>14} {:>14} {:>16.8g} {}\n", name,
+          solver_name, total * 1000,
+          solver_time ? fmt::format("{:.3f}", *solver_time * 1000) : "-",
+          solver_time ? fmt::format("{:.3f}", (total - *solver_time) * 1000)
+                      : "-",
+          result.get_optimal_cost(), check);
+    }
+  }
+  return num_mismatches == 0 ? 0 : 1;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace solvers
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the solvers of MathematicalProgram on problems read from files.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::solvers::benchmarking::do_main();
+}
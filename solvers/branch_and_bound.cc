@@ -2,11 +2,15 @@
 
 #include <algorithm>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
@@ -114,12 +118,25 @@ void AddVectorOfConstraintsToProgram(
   }
 }
 
+// The programs might be solved concurrently by MixedIntegerBranchAndBound.
+// Every GurobiSolver uses the same Gurobi environment, which must not be used
+// by several threads at once, so the Gurobi solves are serialized.
+std::mutex& GurobiSolveMutex() {
+  static never_destroyed<std::mutex> mutex;
+  return mutex.access();
+}
+
 SolutionResult SolveProgramWithSolver(const MathematicalProgram& prog,
                                       const SolverId& solver_id,
                                       MathematicalProgramResult* result) {
   std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
   DRAKE_ASSERT(solver.get());
-  solver->Solve(prog, {}, {}, result);
+  std::unique_lock<std::mutex> lock(GurobiSolveMutex(), std::defer_lock);
+  if (solver_id == GurobiSolver::id()) {
+    lock.lock();
+  }
+  // The initial guess is used by the solvers that support warm starts.
+  solver->Solve(prog, prog.initial_guess(), {}, result);
   return result->get_solution_result();
 }
 }  // namespace
@@ -323,6 +340,14 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
+  // Warm-start the children from the solution of this node.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    for (auto* child : {left_child_.get(), right_child_.get()}) {
+      child->prog_->SetInitialGuessForAllVariables(prog_result_->get_x_val());
+      child->prog_->SetInitialGuess(binary_variable,
+                                    child->fixed_binary_value_);
+    }
+  }
   left_child_->solution_result_ = SolveProgramWithSolver(
       *left_child_->prog_, left_child_->solver_id_,
       left_child_->prog_result_.get());
@@ -383,20 +408,19 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes(max_num_threads_);
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    BranchAndUpdate(branching_nodes);
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes(max_num_threads_);
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -502,6 +526,69 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickBranchingNode()
   DRAKE_UNREACHABLE();
 }
 
+void MixedIntegerBranchAndBound::set_max_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  max_num_threads_ = num_threads;
+}
+
+namespace {
+// Appends the non-fathomed leaf nodes in the tree to `leaf_nodes`.
+void CollectNonFathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaf_nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaf_nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                         leaf_nodes);
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                         leaf_nodes);
+  }
+}
+}  // namespace
+
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_num_nodes) const {
+  DRAKE_DEMAND(max_num_nodes >= 1);
+  // The user defined function picks a single node.
+  if (max_num_nodes == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    MixedIntegerBranchAndBoundNode* node = PickBranchingNode();
+    if (node == nullptr) {
+      return {};
+    }
+    return {node};
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  CollectNonFathomedLeafNodesInSubTree(*this, *root_, &nodes);
+  // Order the nodes by priority, as PickMinLowerBoundNode() and
+  // PickDepthFirstNode() would pick them.
+  const int num_nodes =
+      std::min(max_num_nodes, static_cast<int>(nodes.size()));
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::partial_sort(nodes.begin(), nodes.begin() + num_nodes, nodes.end(),
+                      [](const MixedIntegerBranchAndBoundNode* a,
+                         const MixedIntegerBranchAndBoundNode* b) {
+                        return a->prog_result()->get_optimal_cost() <
+                               b->prog_result()->get_optimal_cost();
+                      });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    std::partial_sort(nodes.begin(), nodes.begin() + num_nodes, nodes.end(),
+                      [](const MixedIntegerBranchAndBoundNode* a,
+                         const MixedIntegerBranchAndBoundNode* b) {
+                        return a->remaining_binary_variables().size() <
+                               b->remaining_binary_variables().size();
+                      });
+  }
+  nodes.resize(num_nodes);
+  return nodes;
+}
+
 namespace {
 // Pick the non-fathomed leaf node in the tree with the smallest optimal cost.
 MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
@@ -683,10 +770,40 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
   best_lower_bound_ = BestLowerBoundInSubTree(*this, *root_);
+  UpdateFromChildren(*node);
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) {
+  if (nodes.size() == 1) {
+    BranchAndUpdate(nodes[0], *PickBranchingVariable(*nodes[0]));
+    return;
+  }
+  // The branching variables are picked on this thread, since the user defined
+  // function might not be thread-safe.
+  std::vector<const symbolic::Variable*> branching_variables;
+  for (const auto* node : nodes) {
+    branching_variables.push_back(PickBranchingVariable(*node));
+  }
+  // Each node only reads and writes its own program and children, so that the
+  // nodes can be branched concurrently.
+  StaticParallelForIndexLoop(
+      max_num_threads_, 0, static_cast<int>(nodes.size()),
+      [&nodes, &branching_variables](int, int i) {
+        nodes[i]->Branch(*branching_variables[i]);
+      });
+  best_lower_bound_ = BestLowerBoundInSubTree(*this, *root_);
+  for (const auto* node : nodes) {
+    UpdateFromChildren(*node);
+  }
+}
+
+void MixedIntegerBranchAndBound::UpdateFromChildren(
+    const MixedIntegerBranchAndBoundNode& node) {
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (auto& child : {node.left_child(), node.right_child()}) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -73,7 +74,8 @@ class MixedIntegerBranchAndBoundNode {
    * Branches on @p binary_variable, and creates two child nodes. In the left
    * child node, the binary variable is fixed to 0. In the right node, the
    * binary variable is fixed to 1. Solves the optimization program in each
-   * child node.
+   * child node, warm-started from the solution of this node (if the solver
+   * supports it).
    * @param binary_variable This binary variable is fixed to either 0 or 1 in
    * the child node.
    * @pre binary_variable is in remaining_binary_variables_;
@@ -562,6 +564,24 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /** Setter for the maximum number of threads used to branch on the nodes.
+   * If it is larger than one, then each step of Solve() picks up to this many
+   * un-fathomed leaf nodes, in the order of the node selection method, and
+   * branches on them concurrently (the optimization programs of their child
+   * nodes are solved in parallel). The bounds, the solutions and the callbacks
+   * are then updated on the calling thread. A user-defined node selection
+   * method picks one node per step. The default is one, namely one node is
+   * branched at a time.
+   * @note Gurobi does not allow several programs to be solved at once with the
+   * same environment, so with GurobiSolver only the construction of the child
+   * programs is done in parallel.
+   * @throws std::logic_error if num_threads is less than one.
+   */
+  void set_max_num_threads(int num_threads);
+
+  /** Getter for the maximum number of threads used to branch on the nodes. */
+  int max_num_threads() const { return max_num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -571,6 +591,13 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick at most max_num_nodes nodes to branch, in the order of the node
+   * selection method. Returns an empty vector if every leaf node is fathomed.
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -596,6 +623,21 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each of the nodes, on the variable picked by the variable
+   * selection method, and update the best lower and upper bounds. The nodes
+   * are branched concurrently, using up to max_num_threads() threads.
+   * @param nodes. The distinct nodes to be branched.
+   */
+  void BranchAndUpdate(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes);
+
+  /**
+   * Update the solutions and the best upper bound from the children of a node
+   * that was just branched, and call the callback function on them.
+   */
+  void UpdateFromChildren(const MixedIntegerBranchAndBoundNode& node);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -680,6 +722,8 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  int max_num_threads_{1};
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
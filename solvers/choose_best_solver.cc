@@ -2,6 +2,7 @@
 
 #include "drake/solvers/csdp_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/fbstab_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/linear_system_solver.h"
@@ -83,6 +84,8 @@ std::unique_ptr<SolverInterface> MakeSolver(const SolverId& id) {
     return std::make_unique<CsdpSolver>();
   } else if (id == ScsSolver::id()) {
     return std::make_unique<ScsSolver>();
+  } else if (id == FbstabSolver::id()) {
+    return std::make_unique<FbstabSolver>();
   } else {
     throw std::invalid_argument("MakeSolver: no matching solver " + id.name());
   }
@@ -0,0 +1,76 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+std::vector<std::vector<int>> ChordalExtensionMaximalCliques(
+    int num_nodes, const std::vector<std::pair<int, int>>& edges) {
+  // The neighbours of each node which hasn't been eliminated yet.
+  std::vector<std::set<int>> neighbours(num_nodes);
+  for (const auto& edge : edges) {
+    if (edge.first < 0 || edge.first >= num_nodes || edge.second < 0 ||
+        edge.second >= num_nodes) {
+      throw std::runtime_error(
+          "ChordalExtensionMaximalCliques(): the edge refers to a node out of "
+          "range.");
+    }
+    if (edge.first != edge.second) {
+      neighbours[edge.first].insert(edge.second);
+      neighbours[edge.second].insert(edge.first);
+    }
+  }
+  std::vector<bool> eliminated(num_nodes, false);
+  // The clique formed by each eliminated node and its remaining neighbours, in
+  // the elimination order. Each maximal clique of the chordal extension is one
+  // of them.
+  std::vector<std::vector<int>> candidates;
+  candidates.reserve(num_nodes);
+  for (int step = 0; step < num_nodes; ++step) {
+    int node = -1;
+    for (int i = 0; i < num_nodes; ++i) {
+      if (!eliminated[i] &&
+          (node < 0 || neighbours[i].size() < neighbours[node].size())) {
+        node = i;
+      }
+    }
+    std::vector<int> clique(neighbours[node].begin(), neighbours[node].end());
+    // Adds the fill-in edges between the remaining neighbours of `node`, and
+    // removes `node` from the graph.
+    for (int neighbour : clique) {
+      neighbours[neighbour].erase(node);
+      for (int other : clique) {
+        if (other != neighbour) {
+          neighbours[neighbour].insert(other);
+        }
+      }
+    }
+    clique.insert(std::upper_bound(clique.begin(), clique.end(), node), node);
+    candidates.push_back(std::move(clique));
+    eliminated[node] = true;
+  }
+  // A candidate which is contained in another one isn't maximal. Since the
+  // candidate of a node contains the nodes eliminated after it only, it can
+  // only be contained in the candidate of a node eliminated before it.
+  std::vector<std::vector<int>> cliques;
+  for (int i = 0; i < num_nodes; ++i) {
+    bool is_maximal = true;
+    for (int j = 0; j < i && is_maximal; ++j) {
+      if (candidates[j].size() > candidates[i].size() &&
+          std::includes(candidates[j].begin(), candidates[j].end(),
+                        candidates[i].begin(), candidates[i].end())) {
+        is_maximal = false;
+      }
+    }
+    if (is_maximal) {
+      cliques.push_back(candidates[i]);
+    }
+  }
+  return cliques;
+}
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
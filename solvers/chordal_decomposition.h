@@ -0,0 +1,32 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/**
+ * Computes the maximal cliques of a chordal extension of the undirected graph
+ * with nodes 0, 1, ..., num_nodes - 1 and the given edges. The chordal
+ * extension is obtained by eliminating the nodes in a greedy minimum degree
+ * order, and connecting the remaining neighbours of each eliminated node
+ * (the fill-in edges).
+ *
+ * A positive semidefinite matrix whose sparsity pattern is this chordal graph
+ * can be written as the sum of positive semidefinite matrices, each nonzero
+ * only on the rows and columns of one clique, see "Chordal Graphs and
+ * Semidefinite Optimization" by L. Vandenberghe and M. Andersen, 2015.
+ *
+ * @param num_nodes The number of nodes in the graph.
+ * @param edges The edges (i, j) of the graph, with 0 <= i, j < num_nodes. The
+ * self loops and the repeated edges are ignored.
+ * @return The maximal cliques, each as its nodes in increasing order. Every
+ * node and every edge belongs to at least one clique.
+ * @throws std::runtime_error if an edge refers to a node out of range.
+ */
+std::vector<std::vector<int>> ChordalExtensionMaximalCliques(
+    int num_nodes, const std::vector<std::pair<int, int>>& edges);
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
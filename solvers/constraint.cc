@@ -4,6 +4,7 @@
 #include <limits>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/symbolic_extraction.h"
@@ -122,6 +123,13 @@ void RotatedLorentzConeConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void QuadraticConstraint::DoEvalHessianOfLagrangian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    Eigen::MatrixXd* hessian) const {
+  *hessian = lambda(0) * Q_;
+}
+
 template <typename DerivedX, typename ScalarY>
 void LinearConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                      VectorX<ScalarY>* y) const {
@@ -145,6 +153,12 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LinearConstraint::DoEvalHessianOfLagrangian(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>&, Eigen::MatrixXd* hessian) const {
+  hessian->setZero(x.rows(), x.rows());
+}
+
 template <typename DerivedX, typename ScalarY>
 void BoundingBoxConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                           VectorX<ScalarY>* y) const {
@@ -315,54 +329,53 @@ ExpressionConstraint::ExpressionConstraint(
 
   derivatives_ = symbolic::Jacobian(expressions_, vars_);
 
-  // Setup the environment.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_.insert(vars_[i], 0.0);
-  }
+  // Compile the expressions and their derivatives.
+  const std::vector<symbolic::Variable> vars(vars_.data(),
+                                             vars_.data() + vars_.size());
+  value_evaluator_ = symbolic::ExpressionEvaluator(vars, expressions_);
+  VectorX<symbolic::Expression> values_and_derivatives(
+      expressions_.size() + derivatives_.size());
+  values_and_derivatives << expressions_,
+      Eigen::Map<const VectorX<symbolic::Expression>>(derivatives_.data(),
+                                                      derivatives_.size());
+  gradient_evaluator_ =
+      symbolic::ExpressionEvaluator(vars, values_and_derivatives);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
-  }
-
   // Evaluate into the output, y.
   y->resize(num_constraints());
-  for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i] = expressions_[i].Evaluate(environment_);
-  }
+  value_evaluator_.Evaluate(x, y);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
+  // Evaluate the values and the derivatives with respect to x.
+  Eigen::VectorXd x_value(x.size());
+  for (int k = 0; k < x.size(); k++) {
+    x_value[k] = x(k).value();
   }
+  Eigen::VectorXd results(gradient_evaluator_.num_expressions());
+  gradient_evaluator_.Evaluate(x_value, &results);
+  const Eigen::Map<const Eigen::MatrixXd> dydx(
+      results.data() + num_constraints(), num_constraints(), x.size());
 
   // Evaluate value and derivatives into the output, y.
   // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
   y->resize(num_constraints());
-  Eigen::VectorXd dyidx(x.size());
+  const int num_derivatives = x.size() > 0 ? x(0).derivatives().size() : 0;
+  Eigen::MatrixXd dxdz(x.size(), num_derivatives);
+  for (int k = 0; k < x.size(); k++) {
+    dxdz.row(k) = x(k).derivatives();
+  }
   for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i].value() = expressions_[i].Evaluate(environment_);
-    for (int k = 0; k < x.size(); k++) {
-      dyidx[k] = derivatives_(i, k).Evaluate(environment_);
-    }
-
-    (*y)[i].derivatives().resize(x(0).derivatives().size());
-    for (int j = 0; j < x(0).derivatives().size(); j++) {
-      (*y)[i].derivatives()[j] = 0.0;
-      for (int k = 0; k < x.size(); k++) {
-        (*y)[i].derivatives()[j] += dyidx[k] * x(k).derivatives()[j];
-      }
-    }
+    (*y)[i].value() = results[i];
+    (*y)[i].derivatives() = (dydx.row(i) * dxdz).transpose();
   }
 }
 
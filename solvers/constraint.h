@@ -214,6 +214,8 @@ class QuadraticConstraint : public Constraint {
         b_(b) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_has_analytic_hessian();
+    SetHessianSparsityPatternFromMatrix(Q_);
   }
 
   ~QuadraticConstraint() override {}
@@ -244,6 +246,7 @@ class QuadraticConstraint : public Constraint {
 
     Q_ = (new_Q + new_Q.transpose()) / 2;
     b_ = new_b;
+    SetHessianSparsityPatternFromMatrix(Q_);
   }
 
  private:
@@ -260,6 +263,11 @@ class QuadraticConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalHessianOfLagrangian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      Eigen::MatrixXd* hessian) const override;
+
   Eigen::MatrixXd Q_;
   Eigen::VectorXd b_;
 };
@@ -504,16 +512,41 @@ class LinearConstraint : public Constraint {
   LinearConstraint(const Eigen::MatrixBase<DerivedA>& a,
                    const Eigen::MatrixBase<DerivedLB>& lb,
                    const Eigen::MatrixBase<DerivedUB>& ub)
-      : Constraint(a.rows(), a.cols(), lb, ub), A_(a) {
+      : Constraint(a.rows(), a.cols(), lb, ub),
+        A_(a),
+        A_sparse_(A_.sparseView()) {
     DRAKE_ASSERT(a.rows() == lb.rows());
+    // The Hessian is zero.
+    set_has_analytic_hessian();
+    SetHessianSparsityPattern({});
+  }
+
+  /**
+   * Constructs the constraint lb <= A*x <= ub from a sparse A, which is stored
+   * as is (without its explicit zeros), so that the solvers reading
+   * GetSparseMatrix() don't need to convert a dense matrix.
+   */
+  LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+      : Constraint(A.rows(), A.cols(), lb, ub), A_(A), A_sparse_(A) {
+    DRAKE_ASSERT(A.rows() == lb.rows());
+    A_sparse_.prune(0.0);
+    A_sparse_.makeCompressed();
+    set_has_analytic_hessian();
+    SetHessianSparsityPattern({});
   }
 
   ~LinearConstraint() override {}
 
-  virtual Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return A_.sparseView();
+  /**
+   * Returns the linear term A as a sparse matrix (without its zero entries).
+   * It is stored along with the dense A(), and updated by
+   * UpdateCoefficients(), so that solvers can assemble their sparse constraint
+   * matrices without converting each constraint.
+   */
+  virtual const Eigen::SparseMatrix<double>& GetSparseMatrix() const {
+    return A_sparse_;
   }
   virtual const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& A()
       const {
@@ -544,6 +577,7 @@ class LinearConstraint : public Constraint {
     }
 
     A_ = new_A;
+    A_sparse_ = A_.sparseView();
     set_num_outputs(A_.rows());
     set_bounds(new_lb, new_ub);
   }
@@ -562,12 +596,20 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalHessianOfLagrangian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      Eigen::MatrixXd* hessian) const override;
+
   Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
 
  private:
   template <typename DerivedX, typename ScalarY>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                      VectorX<ScalarY>* y) const;
+
+  // The nonzero entries of A_, kept in sync with A_.
+  Eigen::SparseMatrix<double> A_sparse_;
 };
 
 /**
@@ -582,6 +624,13 @@ class LinearEqualityConstraint : public LinearConstraint {
                            const Eigen::MatrixBase<DerivedB>& beq)
       : LinearConstraint(Aeq, beq, beq) {}
 
+  /**
+   * Constructs the constraint Aeq*x = beq from a sparse Aeq.
+   */
+  LinearEqualityConstraint(const Eigen::SparseMatrix<double>& Aeq,
+                           const Eigen::Ref<const Eigen::VectorXd>& beq)
+      : LinearConstraint(Aeq, beq, beq) {}
+
   LinearEqualityConstraint(const Eigen::Ref<const Eigen::RowVectorXd>& a,
                            double beq)
       : LinearEqualityConstraint(a, Vector1d(beq)) {}
@@ -916,8 +965,10 @@ class ExpressionConstraint : public Constraint {
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
 
-  // Only for caching, does not carrying hidden state.
-  mutable symbolic::Environment environment_;
+  // The compiled expressions, of the variables vars_. The second one also
+  // evaluates the (column-major) derivatives_, after the expressions.
+  symbolic::ExpressionEvaluator value_evaluator_;
+  symbolic::ExpressionEvaluator gradient_evaluator_;
 };
 
 /**
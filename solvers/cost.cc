@@ -30,6 +30,12 @@ void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
   DoEvalGeneric(x, y);
 }
 
+void LinearCost::DoEvalHessianOfLagrangian(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>&, Eigen::MatrixXd* hessian) const {
+  hessian->setZero(x.rows(), x.rows());
+}
+
 template <typename DerivedX, typename U>
 void QuadraticCost::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                   VectorX<U>* y) const {
@@ -54,6 +60,13 @@ void QuadraticCost::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void QuadraticCost::DoEvalHessianOfLagrangian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    Eigen::MatrixXd* hessian) const {
+  *hessian = lambda(0) * Q_;
+}
+
 shared_ptr<QuadraticCost> MakeQuadraticErrorCost(
     const Eigen::Ref<const MatrixXd>& Q,
     const Eigen::Ref<const VectorXd>& x_desired) {
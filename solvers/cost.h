@@ -45,14 +45,20 @@ class LinearCost : public Cost {
    */
   // NOLINTNEXTLINE(runtime/explicit) This conversion is desirable.
   LinearCost(const Eigen::Ref<const Eigen::VectorXd>& a, double b = 0.)
-      : Cost(a.rows()), a_(a), b_(b) {}
+      : Cost(a.rows()), a_(a), a_sparse_(a_.sparseView()), b_(b) {
+    // The Hessian is zero.
+    set_has_analytic_hessian();
+    SetHessianSparsityPattern({});
+  }
 
   ~LinearCost() override {}
 
-  Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return a_.sparseView();
+  /**
+   * Returns the linear term a as a sparse (column) matrix, without its zero
+   * entries. It is stored along with a(), and updated by UpdateCoefficients().
+   */
+  const Eigen::SparseMatrix<double>& GetSparseMatrix() const {
+    return a_sparse_;
   }
 
   const Eigen::VectorXd& a() const { return a_; }
@@ -73,6 +79,7 @@ class LinearCost : public Cost {
     }
 
     a_ = new_a;
+    a_sparse_ = a_.sparseView();
     b_ = new_b;
   }
 
@@ -86,11 +93,18 @@ class LinearCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalHessianOfLagrangian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      Eigen::MatrixXd* hessian) const override;
+
  private:
   template <typename DerivedX, typename U>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x, VectorX<U>* y) const;
 
   Eigen::VectorXd a_;
+  // The nonzero entries of a_, kept in sync with a_.
+  Eigen::SparseMatrix<double> a_sparse_;
   double b_{};
 };
 
@@ -113,6 +127,8 @@ class QuadraticCost : public Cost {
       : Cost(Q.rows()), Q_((Q + Q.transpose()) / 2), b_(b), c_(c) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_has_analytic_hessian();
+    SetHessianSparsityPatternFromMatrix(Q_);
   }
 
   ~QuadraticCost() override {}
@@ -147,6 +163,7 @@ class QuadraticCost : public Cost {
     Q_ = (new_Q + new_Q.transpose()) / 2;
     b_ = new_b;
     c_ = new_c;
+    SetHessianSparsityPatternFromMatrix(Q_);
   }
 
  private:
@@ -162,6 +179,11 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalHessianOfLagrangian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      Eigen::MatrixXd* hessian) const override;
+
   Eigen::MatrixXd Q_;
   Eigen::VectorXd b_;
   double c_{};
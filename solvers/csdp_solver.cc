@@ -262,13 +262,6 @@ void SolveProgramThroughTwoSlackVariablesApproach(
           -it.value());
     }
   }
-  std::vector<Eigen::SparseMatrix<double>> A_hat;
-  A_hat.reserve(sdpa_free_format.A().size());
-  for (int i = 0; i < static_cast<int>(sdpa_free_format.A().size()); ++i) {
-    A_hat.emplace_back(num_X_hat_rows, num_X_hat_rows);
-    A_hat.back().setFromTriplets(A_hat_triplets[i].begin(),
-                                 A_hat_triplets[i].end());
-  }
   // Add the entry in Ĉ that multiplies with sᵢ
   std::vector<Eigen::Triplet<double>> C_hat_triplets =
       sdpa_free_format.C_triplets();
@@ -283,16 +276,15 @@ void SolveProgramThroughTwoSlackVariablesApproach(
                                     sdpa_free_format.num_free_variables() + i,
                                 -it.value());
   }
-  Eigen::SparseMatrix<double> C_hat(num_X_hat_rows, num_X_hat_rows);
-  C_hat.setFromTriplets(C_hat_triplets.begin(), C_hat_triplets.end());
 
   // Now try to call CSDP to solve this problem.
   csdp::blockmatrix C_csdp;
   double* rhs_csdp{nullptr};
   csdp::constraintmatrix* constraints_csdp{nullptr};
-  ConvertSparseMatrixFormatToCsdpProblemData(X_hat_blocks, C_hat, A_hat,
-                                              sdpa_free_format.g(), &C_csdp,
-                                              &rhs_csdp, &constraints_csdp);
+  ConvertTripletsToCsdpProblemData(X_hat_blocks, num_X_hat_rows,
+                                   C_hat_triplets, A_hat_triplets,
+                                   sdpa_free_format.g(), &C_csdp, &rhs_csdp,
+                                   &constraints_csdp);
   struct csdp::blockmatrix X_csdp, Z;
   double* y{nullptr};
   csdp::initsoln(num_X_hat_rows, sdpa_free_format.g().rows(), C_csdp, rhs_csdp,
@@ -1,5 +1,7 @@
 #include "drake/solvers/csdp_solver_internal.h"
 
+#include "drake/math/eigen_sparse_triplet.h"
+
 namespace drake {
 namespace solvers {
 namespace internal {
@@ -59,24 +61,31 @@ void ConvertSparseMatrixFormatToCsdpProblemData(
     const std::vector<Eigen::SparseMatrix<double>> A,
     const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
     csdp::constraintmatrix** constraints) {
-  const int num_X_rows = C.rows();
   DRAKE_ASSERT(C.cols() == C.rows());
-  DRAKE_ASSERT(static_cast<int>(A.size()) == rhs.rows());
+  std::vector<std::vector<Eigen::Triplet<double>>> A_triplets;
+  A_triplets.reserve(A.size());
+  for (const auto& Ai : A) {
+    A_triplets.push_back(math::SparseMatrixToTriplets(Ai));
+  }
+  ConvertTripletsToCsdpProblemData(X_blocks, C.rows(),
+                                   math::SparseMatrixToTriplets(C), A_triplets,
+                                   rhs, C_csdp, rhs_csdp, constraints);
+}
+
+void ConvertTripletsToCsdpProblemData(
+    const std::vector<BlockInX>& X_blocks, int num_X_rows,
+    const std::vector<Eigen::Triplet<double>>& C_triplets,
+    const std::vector<std::vector<Eigen::Triplet<double>>>& A_triplets,
+    const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
+    csdp::constraintmatrix** constraints) {
+  DRAKE_ASSERT(static_cast<int>(A_triplets.size()) == rhs.rows());
 
   // Maps the row index in X to the block index. Both the row index and the
   // block index are 0-indexed.
-  std::vector<int> X_row_to_block_index(num_X_rows);
-  std::vector<int> block_start_rows(static_cast<int>(X_blocks.size()));
-  int row_count = 0;
-  for (int block_index = 0; block_index < static_cast<int>(X_blocks.size());
-       ++block_index) {
-    block_start_rows[block_index] = row_count;
-    for (int row = row_count; row < row_count + X_blocks[block_index].num_rows;
-         ++row) {
-      X_row_to_block_index[row] = block_index;
-    }
-    row_count += static_cast<int>(X_blocks[block_index].num_rows);
-  }
+  std::vector<int> X_row_to_block_index;
+  std::vector<int> block_start_rows;
+  ComputeBlockStartRows(X_blocks, &block_start_rows, &X_row_to_block_index);
+  DRAKE_DEMAND(static_cast<int>(X_row_to_block_index.size()) == num_X_rows);
 
   C_csdp->nblocks = static_cast<int>(X_blocks.size());
   // We need to add 1 here because CSDP uses Fortran 1-indexed, so the
@@ -91,41 +100,35 @@ void ConvertSparseMatrixFormatToCsdpProblemData(
         X_block.block_type == BlockType::kMatrix ? csdp::MATRIX : csdp::DIAG;
     C_block.blocksize = X_block.num_rows;
     if (X_block.block_type == BlockType::kMatrix) {
+      // CSDP's data.mat is an array of size num_rows x num_rows. First fill in
+      // the block with 0, the non-zero entries are added from C_triplets
+      // below.
       C_block.data.mat = static_cast<double*>(
-          // CSDP's data.mat is an array of size num_rows x num_rows.
-          malloc(X_block.num_rows * X_block.num_rows * sizeof(double)));
-      for (int j = 0; j < X_block.num_rows; ++j) {
-        // First fill in this column with 0, and then we will go through the
-        // non-zero entries (stored inside C) to set the value of the
-        // corresponding entries in C_csdp.
-        for (int i = 0; i < X_block.num_rows; ++i) {
-          C_block.data.mat[CsdpMatrixIndex(i, j, X_block.num_rows)] = 0;
-        }
-        for (Eigen::SparseMatrix<double>::InnerIterator it(
-                 C, block_start_rows[block_index] + j);
-             it; ++it) {
-          C_block.data.mat[CsdpMatrixIndex(
-              it.row() - block_start_rows[block_index], j, X_block.num_rows)] =
-              it.value();
-        }
-      }
+          calloc(X_block.num_rows * X_block.num_rows, sizeof(double)));
     } else if (X_block.block_type == BlockType::kDiagonal) {
       // CSDP uses Fortran 1-index array, so the 0'th entry is wasted.
       C_block.data.vec =
-          static_cast<double*>(malloc((X_block.num_rows + 1) * sizeof(double)));
-      for (int j = 0; j < X_block.num_rows; ++j) {
-        C_block.data.vec[j + 1] = 0.0;
-        for (Eigen::SparseMatrix<double>::InnerIterator it(
-                 C, block_start_rows[block_index] + j);
-             it; ++it) {
-          DRAKE_ASSERT(it.row() == it.col());
-          C_block.data.vec[j + 1] = it.value();
-        }
-      }
+          static_cast<double*>(calloc(X_block.num_rows + 1, sizeof(double)));
     } else {
       throw std::runtime_error(
-          "ConvertSparseMatrixFormatToCsdpProblemData() only supports MATRIX "
-          "or DIAG blocks.");
+          "ConvertTripletsToCsdpProblemData() only supports MATRIX or DIAG "
+          "blocks.");
+    }
+  }
+  // C_triplets contains both the upper and the lower triangular part of C, and
+  // the duplicate triplets are summed up.
+  for (const auto& triplet : C_triplets) {
+    const int block_index = X_row_to_block_index[triplet.col()];
+    DRAKE_ASSERT(X_row_to_block_index[triplet.row()] == block_index);
+    const int row = triplet.row() - block_start_rows[block_index];
+    const int col = triplet.col() - block_start_rows[block_index];
+    csdp::blockrec& C_block = C_csdp->blocks[block_index + 1];
+    if (C_block.blockcategory == csdp::MATRIX) {
+      C_block.data.mat[CsdpMatrixIndex(row, col, C_block.blocksize)] +=
+          triplet.value();
+    } else {
+      DRAKE_ASSERT(row == col);
+      C_block.data.vec[col + 1] += triplet.value();
     }
   }
 
@@ -139,65 +142,59 @@ void ConvertSparseMatrixFormatToCsdpProblemData(
 
   // Copy constraints.
   *constraints = static_cast<struct csdp::constraintmatrix*>(
-      malloc((static_cast<int>(A.size()) + 1) *
+      malloc((static_cast<int>(A_triplets.size()) + 1) *
              sizeof(struct csdp::constraintmatrix)));
-  for (int constraint_index = 0; constraint_index < static_cast<int>(A.size());
+  for (int constraint_index = 0;
+       constraint_index < static_cast<int>(A_triplets.size());
        ++constraint_index) {
     (*constraints)[constraint_index + 1].blocks = nullptr;
-    // Start from the last block in the block-diagonal matrix
-    // A[constraint_index], we add each block in the reverse order.
-    for (int block_index = static_cast<int>(X_blocks.size() - 1);
-         block_index >= 0; --block_index) {
-      std::vector<Eigen::Triplet<double>> A_block_triplets;
-      // CSDP only stores the non-zero entries in the upper-triangular part of
-      // each block. Also the row and column indices in A_block_triplets are
-      // the indices within THIS block, not the indices in the whole matrix
-      // A[constraint_index].
-      A_block_triplets.reserve((X_blocks[block_index].num_rows + 1) *
-                               X_blocks[block_index].num_rows / 2);
-      for (int col_index = block_start_rows[block_index];
-           col_index <
-           block_start_rows[block_index] + X_blocks[block_index].num_rows;
-           ++col_index) {
-        for (Eigen::SparseMatrix<double>::InnerIterator it(A[constraint_index],
-                                                           col_index);
-             it; ++it) {
-          if (it.row() > it.col()) {
-            break;
-          }
-          A_block_triplets.emplace_back(
-              it.row() - block_start_rows[block_index] + 1,
-              it.col() - block_start_rows[block_index] + 1, it.value());
-        }
+    // CSDP only stores the non-zero entries in the upper-triangular part of
+    // each block. The entries are sorted by the block index, so each block
+    // is a contiguous range of the entries.
+    const std::vector<EntryInXBlock> entries =
+        ConvertTripletsToUpperTriangularBlockEntries(
+            A_triplets[constraint_index], block_start_rows,
+            X_row_to_block_index);
+    // Start from the last block in A[constraint_index], we add each block in
+    // the reverse order, so that the linked list is in the increasing order
+    // of the block index.
+    int block_end = static_cast<int>(entries.size());
+    while (block_end > 0) {
+      const int block_index = entries[block_end - 1].block_index;
+      int block_begin = block_end - 1;
+      while (block_begin > 0 &&
+             entries[block_begin - 1].block_index == block_index) {
+        --block_begin;
       }
-      if (!A_block_triplets.empty()) {
-        struct csdp::sparseblock* blockptr =
-            static_cast<struct csdp::sparseblock*>(
-                malloc(sizeof(struct csdp::sparseblock)));
-        // CSDP uses Fortran 1-indexed array.
-        blockptr->blocknum = block_index + 1;
-        blockptr->blocksize = X_blocks[block_index].num_rows;
-        // CSDP uses Fortran 1-indexed array.
-        blockptr->constraintnum = constraint_index + 1;
-        blockptr->next = nullptr;
-        blockptr->nextbyblock = nullptr;
-        blockptr->entries = static_cast<double*>(malloc(
-            (static_cast<int>(A_block_triplets.size()) + 1) * sizeof(double)));
-        blockptr->iindices = static_cast<int*>(malloc(
-            (static_cast<int>(A_block_triplets.size()) + 1) * sizeof(int)));
-        blockptr->jindices = static_cast<int*>(malloc(
-            (1 + static_cast<int>(A_block_triplets.size())) * sizeof(int)));
-        blockptr->numentries = static_cast<int>(A_block_triplets.size());
-        for (int i = 0; i < blockptr->numentries; ++i) {
-          blockptr->iindices[i + 1] = A_block_triplets[i].row();
-          blockptr->jindices[i + 1] = A_block_triplets[i].col();
-          blockptr->entries[i + 1] = A_block_triplets[i].value();
-        }
-        // Insert this block into the linked list of
-        // constraints[constraint_index + 1] blocks.
-        blockptr->next = (*constraints)[constraint_index + 1].blocks;
-        (*constraints)[constraint_index + 1].blocks = blockptr;
+      const int num_block_entries = block_end - block_begin;
+      struct csdp::sparseblock* blockptr =
+          static_cast<struct csdp::sparseblock*>(
+              malloc(sizeof(struct csdp::sparseblock)));
+      // CSDP uses Fortran 1-indexed array.
+      blockptr->blocknum = block_index + 1;
+      blockptr->blocksize = X_blocks[block_index].num_rows;
+      // CSDP uses Fortran 1-indexed array.
+      blockptr->constraintnum = constraint_index + 1;
+      blockptr->next = nullptr;
+      blockptr->nextbyblock = nullptr;
+      blockptr->entries = static_cast<double*>(
+          malloc((num_block_entries + 1) * sizeof(double)));
+      blockptr->iindices =
+          static_cast<int*>(malloc((num_block_entries + 1) * sizeof(int)));
+      blockptr->jindices =
+          static_cast<int*>(malloc((num_block_entries + 1) * sizeof(int)));
+      blockptr->numentries = num_block_entries;
+      for (int i = 0; i < num_block_entries; ++i) {
+        const EntryInXBlock& entry = entries[block_begin + i];
+        blockptr->iindices[i + 1] = entry.row_index_in_block + 1;
+        blockptr->jindices[i + 1] = entry.column_index_in_block + 1;
+        blockptr->entries[i + 1] = entry.value;
       }
+      // Insert this block into the linked list of
+      // constraints[constraint_index + 1] blocks.
+      blockptr->next = (*constraints)[constraint_index + 1].blocks;
+      (*constraints)[constraint_index + 1].blocks = blockptr;
+      block_end = block_begin;
     }
   }
 }
@@ -206,22 +203,10 @@ void GenerateCsdpProblemDataWithoutFreeVariables(
     const SdpaFreeFormat& sdpa_free_format, csdp::blockmatrix* C_csdp,
     double** rhs_csdp, csdp::constraintmatrix** constraints) {
   if (sdpa_free_format.num_free_variables() == 0) {
-    Eigen::SparseMatrix<double> C(sdpa_free_format.num_X_rows(),
-                                  sdpa_free_format.num_X_rows());
-    C.setFromTriplets(sdpa_free_format.C_triplets().begin(),
-                      sdpa_free_format.C_triplets().end());
-    std::vector<Eigen::SparseMatrix<double>> A;
-    A.reserve(sdpa_free_format.A_triplets().size());
-    for (int i = 0; i < static_cast<int>(sdpa_free_format.A_triplets().size());
-         ++i) {
-      A.emplace_back(sdpa_free_format.num_X_rows(),
-                     sdpa_free_format.num_X_rows());
-      A.back().setFromTriplets(sdpa_free_format.A_triplets()[i].begin(),
-                               sdpa_free_format.A_triplets()[i].end());
-    }
-    ConvertSparseMatrixFormatToCsdpProblemData(sdpa_free_format.X_blocks(), C,
-                                               A, sdpa_free_format.g(), C_csdp,
-                                               rhs_csdp, constraints);
+    ConvertTripletsToCsdpProblemData(
+        sdpa_free_format.X_blocks(), sdpa_free_format.num_X_rows(),
+        sdpa_free_format.C_triplets(), sdpa_free_format.A_triplets(),
+        sdpa_free_format.g(), C_csdp, rhs_csdp, constraints);
   } else {
     throw std::runtime_error(
         "GenerateCsdpProblemDataWithoutFreeVariables(): the formulation has "
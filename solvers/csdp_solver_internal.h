@@ -64,6 +64,20 @@ void ConvertSparseMatrixFormatToCsdpProblemData(
     const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
     csdp::constraintmatrix** constraints);
 
+/**
+ * Same as ConvertSparseMatrixFormatToCsdpProblemData(), but C and Ai are given
+ * as triplets (with both the upper and the lower triangular part, the
+ * duplicate triplets are summed up). Each Aᵢ is converted to CSDP's sparse
+ * blocks in time linear in its number of triplets (up to sorting), without
+ * constructing any matrix of the size of X.
+ */
+void ConvertTripletsToCsdpProblemData(
+    const std::vector<BlockInX>& X_blocks, int num_X_rows,
+    const std::vector<Eigen::Triplet<double>>& C_triplets,
+    const std::vector<std::vector<Eigen::Triplet<double>>>& A_triplets,
+    const Eigen::VectorXd& rhs, csdp::blockmatrix* C_csdp, double** rhs_csdp,
+    csdp::constraintmatrix** constraints);
+
 /**
  * Converts to a CSDP problem data if `sdpa_free_format` has no free variables.
  * @throw a runtime error if sdpa_free_format has free variables.
@@ -1,5 +1,8 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <set>
 
 using std::make_shared;
@@ -34,6 +37,31 @@ void CheckGradientSparsityPattern(
     nonzero_entries.insert(it, nonzero_entry);
   }
 }
+
+// Check that each entry of hessian_sparsity_pattern is in the lower triangle of
+// a num_vars x num_vars matrix, and that there are no repeated entries.
+void CheckHessianSparsityPattern(
+    const std::vector<std::pair<int, int>>& hessian_sparsity_pattern,
+    int num_vars) {
+  std::set<std::pair<int, int>> nonzero_entries;
+  for (const auto& nonzero_entry : hessian_sparsity_pattern) {
+    if (nonzero_entry.second < 0 ||
+        (num_vars != Eigen::Dynamic && nonzero_entry.first >= num_vars)) {
+      throw std::invalid_argument(
+          "EvaluatorBase::SetHessianSparsityPattern(): index out of range.");
+    }
+    if (nonzero_entry.first < nonzero_entry.second) {
+      throw std::invalid_argument(
+          "EvaluatorBase::SetHessianSparsityPattern(): entry not in the lower "
+          "triangle.");
+    }
+    if (!nonzero_entries.insert(nonzero_entry).second) {
+      throw std::invalid_argument(
+          "EvaluatorBase::SetHessianSparsityPattern(): was given entries with "
+          "repeated values.");
+    }
+  }
+}
 }  // namespace
 
 void EvaluatorBase::SetGradientSparsityPattern(
@@ -45,6 +73,66 @@ void EvaluatorBase::SetGradientSparsityPattern(
   gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
 }
 
+void EvaluatorBase::SetHessianSparsityPattern(
+    const std::vector<std::pair<int, int>>& hessian_sparsity_pattern) {
+  if (kDrakeAssertIsArmed) {
+    CheckHessianSparsityPattern(hessian_sparsity_pattern, num_vars());
+  }
+  hessian_sparsity_pattern_.emplace(hessian_sparsity_pattern);
+}
+
+void EvaluatorBase::SetHessianSparsityPatternFromMatrix(
+    const Eigen::MatrixXd& hessian) {
+  std::vector<std::pair<int, int>> hessian_sparsity_pattern;
+  for (int j = 0; j < hessian.cols(); ++j) {
+    for (int i = j; i < hessian.rows(); ++i) {
+      if (hessian(i, j) != 0) hessian_sparsity_pattern.emplace_back(i, j);
+    }
+  }
+  hessian_sparsity_pattern_.emplace(std::move(hessian_sparsity_pattern));
+}
+
+void EvaluatorBase::DoEvalHessianOfLagrangian(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    Eigen::MatrixXd* hessian) const {
+  const int n = x.rows();
+  hessian->setZero(n, n);
+  if ((lambda.array() == 0).all()) return;
+
+  // The gradient of λᵀy at x_eval.
+  auto gradient = [this, &lambda, n](const Eigen::VectorXd& x_eval) {
+    AutoDiffVecXd y(num_outputs());
+    DoEval(math::initializeAutoDiff(x_eval), &y);
+    Eigen::VectorXd result = Eigen::VectorXd::Zero(n);
+    for (int i = 0; i < y.rows(); ++i) {
+      if (lambda(i) != 0 && y(i).derivatives().size() > 0) {
+        result += lambda(i) * y(i).derivatives();
+      }
+    }
+    return result;
+  };
+
+  // The step of the central differences, which balances their truncation
+  // error with the rounding error of the gradients.
+  const double kRelativeStep =
+      std::cbrt(std::numeric_limits<double>::epsilon());
+  Eigen::VectorXd x_plus = x;
+  Eigen::VectorXd x_minus = x;
+  for (int j = 0; j < n; ++j) {
+    const double h = kRelativeStep * std::max(1.0, std::abs(x(j)));
+    x_plus(j) = x(j) + h;
+    x_minus(j) = x(j) - h;
+    hessian->col(j) =
+        (gradient(x_plus) - gradient(x_minus)) / (x_plus(j) - x_minus(j));
+    x_plus(j) = x(j);
+    x_minus(j) = x(j);
+  }
+  // The differences are symmetric only up to their errors.
+  const Eigen::MatrixXd symmetric = (*hessian + hessian->transpose()) / 2;
+  *hessian = symmetric;
+}
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                  Eigen::VectorXd* y) const {
   double_evaluation_point_temp_.clear();
@@ -99,6 +99,10 @@ class EvaluatorBase {
    * y value in Eval, w.r.t x in Eval) . gradient_sparsity_pattern contains
    * *all* the pairs of (row_index, col_index) for which the corresponding
    * entries could have non-zero value in the gradient matrix ∂y/∂x.
+   * Nonlinear solvers (SNOPT and IPOPT) pass only these entries to the solver
+   * as the structure of the constraint Jacobian, which for large, sparse
+   * problems (e.g., trajectory optimization) is much smaller than the dense
+   * block of each constraint.
    */
   void SetGradientSparsityPattern(
       const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
@@ -116,6 +120,56 @@ class EvaluatorBase {
     return gradient_sparsity_pattern_;
   }
 
+  /**
+   * Evaluates the Hessian of the Lagrangian of the expression, namely the
+   * second derivative H = ∑ᵢ λᵢ ∂²yᵢ/∂x² of λᵀy(x) for the given multipliers λ
+   * (one per output). Nonlinear solvers (IPOPT) use it to take Newton steps
+   * rather than approximating the curvature of the problem from its gradients.
+   * Evaluators with an analytic Hessian (see has_analytic_hessian()) compute it
+   * directly; for the others, it is computed by central differences of the
+   * AutoDiffXd gradient of λᵀy.
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[in] lambda A `num_outputs` x 1 vector of multipliers.
+   * @param[out] hessian The symmetric `num_vars` x `num_vars` matrix H.
+   */
+  void EvalHessianOfLagrangian(const Eigen::Ref<const Eigen::VectorXd>& x,
+                               const Eigen::Ref<const Eigen::VectorXd>& lambda,
+                               Eigen::MatrixXd* hessian) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DRAKE_ASSERT(lambda.rows() == num_outputs_);
+    DRAKE_DEMAND(hessian != nullptr);
+    DoEvalHessianOfLagrangian(x, lambda, hessian);
+  }
+
+  /**
+   * Returns true if EvalHessianOfLagrangian() computes the Hessian
+   * analytically, rather than by differentiating the gradient numerically.
+   */
+  bool has_analytic_hessian() const { return has_analytic_hessian_; }
+
+  /**
+   * Set the sparsity pattern of the Hessian of the Lagrangian (see
+   * EvalHessianOfLagrangian()). hessian_sparsity_pattern contains *all* the
+   * pairs of (row_index, col_index), with row_index ≥ col_index, for which the
+   * corresponding entries of the lower triangle of the (symmetric) Hessian
+   * could have non-zero value, for any multipliers. Nonlinear solvers (IPOPT)
+   * pass only these entries to the solver as the structure of the Hessian.
+   */
+  void SetHessianSparsityPattern(
+      const std::vector<std::pair<int, int>>& hessian_sparsity_pattern);
+
+  /**
+   * Returns the vector of (row_index, col_index), with row_index ≥ col_index,
+   * that contains all the entries of the lower triangle of the Hessian of the
+   * Lagrangian whose value could be non-zero.
+   * @retval hessian_sparsity_pattern If nullopt, then we regard all entries of
+   * the Hessian as potentially non-zero.
+   */
+  const optional<std::vector<std::pair<int, int>>>& hessian_sparsity_pattern()
+      const {
+    return hessian_sparsity_pattern_;
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -161,6 +215,32 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements the evaluation of the Hessian of the Lagrangian. The default
+   * implementation differentiates the gradient of λᵀy, evaluated with
+   * AutoDiffXd, by central differences. Derived classes which override it with
+   * an analytic Hessian should call set_has_analytic_hessian().
+   * @param x Input vector.
+   * @param lambda Multipliers, one per output.
+   * @param hessian The Hessian of the Lagrangian.
+   * @pre x must be of size `num_vars` x 1, and lambda of size `num_outputs` x
+   * 1.
+   * @post hessian will be of size `num_vars` x `num_vars`.
+   */
+  virtual void DoEvalHessianOfLagrangian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      Eigen::MatrixXd* hessian) const;
+
+  // Declares that DoEvalHessianOfLagrangian() computes the Hessian
+  // analytically.
+  void set_has_analytic_hessian() { has_analytic_hessian_ = true; }
+
+  // Sets the Hessian sparsity pattern to the non-zero entries of the lower
+  // triangle of the symmetric matrix `hessian`, which is the (constant)
+  // Hessian of a quadratic expression.
+  void SetHessianSparsityPatternFromMatrix(const Eigen::MatrixXd& hessian);
+
   // Setter for the number of outputs.
   // This method is only meant to be called, if the sub-class structure permits
   // to change the number of outputs. One example is LinearConstraint in
@@ -180,6 +260,10 @@ class EvaluatorBase {
   // false, the gradient matrix is regarded as non-sparse, i.e., every entry of
   // the gradient matrix can be non-zero.
   optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  // The entries of the lower triangle of the Hessian of the Lagrangian that
+  // can be non-zero, or nullopt if all of them can be.
+  optional<std::vector<std::pair<int, int>>> hessian_sparsity_pattern_;
+  bool has_analytic_hessian_{false};
 };
 
 /**
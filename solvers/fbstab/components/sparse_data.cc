@@ -0,0 +1,39 @@
+#include "drake/solvers/fbstab/components/sparse_data.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using VectorXd = Eigen::VectorXd;
+
+SparseData::SparseData(const SparseMatrixd* H, const VectorXd* f,
+                       const SparseMatrixd* A, const VectorXd* b)
+    : H_{H}, f_{f}, A_{A}, b_{b} {
+  if (H == nullptr || f == nullptr || A == nullptr || b == nullptr) {
+    throw std::runtime_error(
+        "Inputs to SparseData::SparseData cannot be null.");
+  }
+  if (H->rows() != H->cols() || H->rows() != f->size()) {
+    throw std::runtime_error(
+        "In SparseData::SparseData: H must be square and the same size as f.");
+  }
+  if (A->cols() != H->rows() || A->rows() != b->size()) {
+    throw std::runtime_error(
+        "In SparseData::SparseData: Sizing of data defining Az <= b is "
+        "inconsistent.");
+  }
+
+  nz_ = f->size();
+  nv_ = b->size();
+}
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
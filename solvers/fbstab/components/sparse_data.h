@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+/**
+ * Represents data for quadratic programing problems of the following type (1):
+ *
+ * min.    1/2  z'Hz + f'z
+ * s.t.         Az <= b
+ *
+ * where H is symmetric and positive semidefinite, and H and A are sparse.
+ * This is the data of (1) in dense_data.h, stored in compressed column
+ * (Eigen::SparseMatrix) format.
+ */
+class SparseData {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseData)
+  /**
+   * Stores the problem data and performs input validation.
+   * This class assumes that the pointers to the data remain valid.
+   *
+   * @param[in] H Hessian matrix
+   * @param[in] f Linear term
+   * @param[in] A Constraint matrix
+   * @param[in] b Constraint vector
+   *
+   * Throws a runtime exception if any of the inputs are null or if
+   * the sizes of the inputs are inconsistent.
+   */
+  SparseData(const Eigen::SparseMatrix<double>* H, const Eigen::VectorXd* f,
+             const Eigen::SparseMatrix<double>* A, const Eigen::VectorXd* b);
+
+  /** Read only accessor for the H matrix. */
+  const Eigen::SparseMatrix<double>& H() const { return *H_; }
+
+  /** Read only accessor for the f vector. */
+  const Eigen::VectorXd& f() const { return *f_; }
+
+  /** Read only accessor for the A matrix. */
+  const Eigen::SparseMatrix<double>& A() const { return *A_; }
+
+  /** Read only accessor for the b vector. */
+  const Eigen::VectorXd& b() const { return *b_; }
+
+  /**
+   * @return number of decision variables (i.e., dimension of z)
+   */
+  int num_variables() const { return nz_; }
+  /**
+   * @return number of inequality constraints
+   */
+  int num_constraints() const { return nv_; }
+
+ private:
+  int nz_ = 0;  // Number of decision variables.
+  int nv_ = 0;  // Number of constraints.
+
+  const Eigen::SparseMatrix<double>* const H_{nullptr};
+  const Eigen::VectorXd* const f_{nullptr};
+  const Eigen::SparseMatrix<double>* const A_{nullptr};
+  const Eigen::VectorXd* const b_{nullptr};
+
+  friend class SparseVariable;
+  friend class SparseResidual;
+  friend class SparseLinearSolver;
+  friend class SparseFeasibility;
+};
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
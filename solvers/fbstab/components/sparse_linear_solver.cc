@@ -0,0 +1,174 @@
+#include "drake/solvers/fbstab/components/sparse_linear_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+SparseLinearSolver::SparseLinearSolver(int nz, int nv) {
+  if (nz <= 0 || nv <= 0) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::SparseLinearSolver: inputs must be positive.");
+  }
+  nz_ = nz;
+  nv_ = nv;
+
+  K_.resize(nz_, nz_);
+  identity_.resize(nz_, nz_);
+  identity_.setIdentity();
+  r1_.resize(nz_);
+  r2_.resize(nv_);
+  Gamma_.resize(nv_);
+  mus_.resize(nv_);
+  gamma_.resize(nv_);
+}
+
+void SparseLinearSolver::SetAlpha(double alpha) { alpha_ = alpha; }
+
+bool SparseLinearSolver::Initialize(const SparseVariable& x,
+                                    const SparseVariable& xbar, double sigma) {
+  const SparseData* const data = x.data();
+  if (xbar.data() != data) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Factor: x and xbar have mismatched problem "
+        "data.");
+  }
+  if (xbar.nz_ != x.nz_ || xbar.nv_ != x.nv_) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Factor: inputs must be the same size");
+  }
+  if (xbar.nz_ != nz_ || xbar.nv_ != nv_) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Factor: inputs must match object size.");
+  }
+  if (sigma <= 0) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Factor: sigma must be positive.");
+  }
+  const Eigen::SparseMatrix<double>& H = data->H();
+  const Eigen::SparseMatrix<double>& A = data->A();
+
+  Eigen::Vector2d pfb_gradient;
+  for (int i = 0; i < nv_; i++) {
+    const double ys = x.y()(i) + sigma * (x.v()(i) - xbar.v()(i));
+    pfb_gradient = PFBGradient(ys, x.v()(i));
+    gamma_(i) = pfb_gradient(0);
+    mus_(i) = pfb_gradient(1) + sigma * pfb_gradient(0);
+    Gamma_(i) = gamma_(i) / mus_(i);
+  }
+
+  // K = H + sigma*I + A'*diag(Gamma)*A. The sparse products keep the
+  // structural nonzeros, hence the sparsity pattern of K only depends on the
+  // patterns of H and A.
+  K_ = A.transpose() * Gamma_.asDiagonal() * A;
+  K_ += H;
+  K_ += sigma * identity_;
+  K_.makeCompressed();
+
+  // Factor K = LDL'. The fill-reducing ordering is only computed again if
+  // the sparsity pattern of K changed.
+  if (!IsPatternAnalyzed()) {
+    ldlt_.analyzePattern(K_);
+    analyzed_outer_index_ =
+        Eigen::Map<const Eigen::VectorXi>(K_.outerIndexPtr(), nz_ + 1);
+    analyzed_inner_index_ =
+        Eigen::Map<const Eigen::VectorXi>(K_.innerIndexPtr(), K_.nonZeros());
+  }
+  ldlt_.factorize(K_);
+
+  return ldlt_.info() == Eigen::Success;
+}
+
+bool SparseLinearSolver::Solve(const SparseResidual& r,
+                               SparseVariable* x) const {
+  if (x == nullptr) {
+    throw std::runtime_error("In SparseLinearSolver::Solve: x cannot be null.");
+  }
+  if (r.nz_ != x->nz_ || r.nv_ != x->nv_) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Solve residual and variable objects must be "
+        "the same size");
+  }
+  if (x->nz_ != nz_ || x->nv_ != nv_) {
+    throw std::runtime_error(
+        "In SparseLinearSolver::Factor: inputs must match object size.");
+  }
+  const SparseData* const data = x->data();
+  const Eigen::SparseMatrix<double>& A = data->A();
+  const Eigen::VectorXd& b = data->b();
+
+  // This method solves the system:
+  // LDL'z = rz - A'*diag(1/mus)*rv
+  // diag(mus) v = rv + diag(gamma)*A*z
+  // Where LDL' = K has been precomputed by the factor routine.
+  // See (28) and (29) in https://arxiv.org/pdf/1901.04046.pdf
+
+  // Compute rz - A'*(rv./mus) and store it in r1_.
+  r2_ = r.v_.cwiseQuotient(mus_);
+  r1_.noalias() = r.z_ - A.transpose() * r2_;
+
+  // Solve LDL'*z = rz - A'*(rv./mus)
+  // where LDL' = H + sigma*I + A'*Gamma*A.
+  x->z() = ldlt_.solve(r1_);
+  if (ldlt_.info() != Eigen::Success) {
+    return false;
+  }
+
+  // Compute v = diag(1/mus) * (rv + diag(gamma)*A*z)
+  r2_.noalias() = A * x->z();
+  r2_ = gamma_.cwiseProduct(r2_);
+  r2_ += r.v_;
+
+  // v = r2./mus
+  x->v() = r2_.cwiseQuotient(mus_);
+
+  // y = b - Az
+  x->y() = b;
+  x->y().noalias() -= A * x->z();
+
+  return true;
+}
+
+bool SparseLinearSolver::IsPatternAnalyzed() const {
+  return analyzed_outer_index_.size() == K_.outerSize() + 1 &&
+         analyzed_inner_index_.size() == K_.nonZeros() &&
+         std::equal(K_.outerIndexPtr(), K_.outerIndexPtr() + K_.outerSize() + 1,
+                    analyzed_outer_index_.data()) &&
+         std::equal(K_.innerIndexPtr(), K_.innerIndexPtr() + K_.nonZeros(),
+                    analyzed_inner_index_.data());
+}
+
+Eigen::Vector2d SparseLinearSolver::PFBGradient(double a, double b) const {
+  const double r = sqrt(a * a + b * b);
+  const double d = 1.0 / sqrt(2.0);
+
+  Eigen::Vector2d v;
+  if (r < zero_tolerance_) {
+    v(0) = alpha_ * (1.0 - d);
+    v(1) = alpha_ * (1.0 - d);
+
+  } else if ((a > 0) && (b > 0)) {
+    v(0) = alpha_ * (1.0 - a / r) + (1.0 - alpha_) * b;
+    v(1) = alpha_ * (1.0 - b / r) + (1.0 - alpha_) * a;
+
+  } else {
+    v(0) = alpha_ * (1.0 - a / r);
+    v(1) = alpha_ * (1.0 - b / r);
+  }
+
+  return v;
+}
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+// Forward declaration of testing class to enable a friend declaration.
+namespace test {
+class SparseComponentUnitTests;
+}  // namespace test
+
+/**
+ * A class for computing the search directions used by the FBstab QP Solver
+ * for sparse QPs. It solves systems of linear equations of the form
+ *
+ *      [Hs   A'] dz = rz  <==>  V*dx = r
+ *      [-CA  D ] dv   rv
+ *
+ * using the same Schur complement approach as DenseLinearSolver, see (28) and
+ * (29) of https://arxiv.org/pdf/1901.04046.pdf, but the reduced matrix
+ *
+ *      K = Hs + A'*diag(Gamma)*A
+ *
+ * is stored in sparse format and factored with a sparse LDL' factorization.
+ * The fill-reducing ordering (i.e., the symbolic analysis) of K is only
+ * computed again when the sparsity pattern of K changes, e.g., when a QP with
+ * a different structure is solved, so that each Newton step only costs a
+ * numerical factorization.
+ *
+ * This class allocates its own workspace memory and splits step computation
+ * into solve and factor steps to allow for solving with multiple
+ * right hand sides.
+ *
+ * This class has mutable fields and is thus not thread safe.
+ *
+ * Usage:
+ * @code
+ * SparseLinearSolver solver(2,2);
+ * solver.Initialize(x,xbar,sigma);
+ * solver.Solve(r,&dx);
+ * @endcode
+ */
+class SparseLinearSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseLinearSolver)
+  /**
+   * Allocates workspace memory.
+   * @param [nz] Number of decision variables.
+   * @param [nv] Number of inequality constraints.
+   */
+  SparseLinearSolver(int nz, int nv);
+
+  /**
+   * Computes the matrix K = H + sigma*I + A'*diag(Gamma(x,xbar,sigma))*A,
+   * factors it with a sparse LDL' factorization and stores the factorization
+   * internally.
+   *
+   * The matrix V is computed as described in
+   * Algorithm 4 of https://arxiv.org/pdf/1901.04046.pdf.
+   *
+   * @param[in]  x       Inner loop iterate
+   * @param[in]  xbar    Outer loop iterate
+   * @param[in]  sigma   Regularization strength
+   * @return             true if factorization succeeds false otherwise.
+   *
+   * Throws a runtime_error if x and xbar aren't the correct size,
+   * sigma is negative or the problem data isn't linked.
+   */
+  bool Initialize(const SparseVariable& x, const SparseVariable& xbar,
+                  double sigma);
+
+  /**
+   * Solves the system V*x = r and stores the result in x.
+   * This method assumes that the Initialize routine was run to
+   * compute then factor the matrix V.
+   *
+   * @param[in]   r   The right hand side vector
+   * @param[out]  x   Overwritten with the solution
+   * @return true if successful, false otherwise
+   *
+   * Throws a runtime_error if x and r aren't the correct sizes,
+   * if x is null or if the problem data isn't linked.
+   */
+  bool Solve(const SparseResidual& r, SparseVariable* x) const;
+
+  /**
+   * Sets the alpha parameter defined in (19)
+   * of https://arxiv.org/pdf/1901.04046.pdf.
+   */
+  void SetAlpha(double alpha);
+
+ private:
+  friend class test::SparseComponentUnitTests;
+  int nz_ = 0;  // number of decision variables
+  int nv_ = 0;  // number of inequality constraints
+
+  double alpha_ = 0.95;  // See (19) in https://arxiv.org/pdf/1901.04046.pdf.
+  const double zero_tolerance_ = 1e-13;
+
+  // workspace variables
+  Eigen::SparseMatrix<double> identity_;
+  Eigen::SparseMatrix<double> K_;
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt_;
+  // Sparsity pattern of the matrix K_ analyzed by ldlt_, if any.
+  Eigen::VectorXi analyzed_outer_index_;
+  Eigen::VectorXi analyzed_inner_index_;
+  mutable Eigen::VectorXd r1_;
+  mutable Eigen::VectorXd r2_;
+  Eigen::VectorXd Gamma_;
+  Eigen::VectorXd mus_;
+  Eigen::VectorXd gamma_;
+
+  // Returns true if ldlt_ analyzed a matrix with the same sparsity pattern
+  // as K_.
+  bool IsPatternAnalyzed() const;
+
+  // Computes the gradient of the penalized fischer-burmeister (PFB)
+  // function, (19) in https://arxiv.org/pdf/1901.04046.pdf.
+  // See section 3.3.
+  Eigen::Vector2d PFBGradient(double a, double b) const;
+};
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,110 @@
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+
+#include <cmath>
+#include <iostream>
+
+#include <Eigen/Dense>
+
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+SparseResidual::SparseResidual(int nz, int nv) {
+  nz_ = nz;
+  nv_ = nv;
+  z_.resize(nz_);
+  v_.resize(nv_);
+}
+
+void SparseResidual::Negate() {
+  z_ *= -1.0;
+  v_ *= -1.0;
+}
+
+void SparseResidual::NaturalResidual(const SparseVariable& x) {
+  const SparseData* const data = x.data();
+  // rz = H*z + f + A'*v
+  // Calls are arranged to avoid creating temporaries.
+  z_.noalias() = data->H() * x.z();
+  z_.noalias() += data->f();
+  z_.noalias() += data->A().transpose() * x.v();
+
+  // rv = min(y,v)
+  v_.noalias() = x.y().cwiseMin(x.v());
+
+  znorm_ = z_.norm();
+  vnorm_ = v_.norm();
+}
+
+void SparseResidual::PenalizedNaturalResidual(const SparseVariable& x) {
+  NaturalResidual(x);
+  for (int i = 0; i < nv_; i++) {
+    v_(i) = alpha_ * v()(i) +
+            (1.0 - alpha_) * max(0.0, x.y()(i)) * max(0.0, x.v()(i));
+  }
+  znorm_ = z_.norm();
+  vnorm_ = v_.norm();
+}
+
+void SparseResidual::InnerResidual(const SparseVariable& x,
+                                   const SparseVariable& xbar, double sigma) {
+  const SparseData* const data = x.data();
+  if (xbar.data() != data) {
+    throw std::runtime_error(
+        "In SparseResidual::InnerResidual: x and xbar have mismatched problem "
+        "data.");
+  }
+  if (x.num_variables() != xbar.num_variables() ||
+      x.num_constraints() != xbar.num_constraints()) {
+    throw std::runtime_error("Size mismatch in SparseResidual::InnerResidual.");
+  }
+  if (sigma <= 0) {
+    throw std::runtime_error(
+        "In SparseResidual::InnerResidual: sigma must be positive.");
+  }
+  // rz = Hz + f + A'v + sigma(z - zbar)
+  // Calls are arranged so as to avoid creating temporaries.
+  z_.noalias() = data->H() * x.z();
+  z_.noalias() += data->f();
+  z_.noalias() += data->A().transpose() * x.v();
+  z_.noalias() += sigma * (x.z() - xbar.z());
+
+  // v_ = phi(ys,v), ys = y + sigma(x.v - xbar.v)
+  for (int i = 0; i < nv_; i++) {
+    const double ys = x.y()(i) + sigma * (x.v()(i) - xbar.v()(i));
+    v_(i) = pfb(ys, x.v()(i), alpha_);
+  }
+
+  znorm_ = z_.norm();
+  vnorm_ = v_.norm();
+}
+
+void SparseResidual::Fill(double a) {
+  z_.setConstant(a);
+  v_.setConstant(a);
+}
+
+double SparseResidual::Norm() const {
+  return sqrt(znorm_ * znorm_ + vnorm_ * vnorm_);
+}
+
+double SparseResidual::Merit() const {
+  const double temp = Norm();
+  return 0.5 * temp * temp;
+}
+
+double SparseResidual::max(double a, double b) { return a > b ? a : b; }
+
+double SparseResidual::min(double a, double b) { return a < b ? a : b; }
+
+double SparseResidual::pfb(double a, double b, double alpha) {
+  const double fb = a + b - sqrt(a * a + b * b);
+  return alpha * fb + (1.0 - alpha) * max(0, a) * max(0, b);  // NOLINT
+}
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
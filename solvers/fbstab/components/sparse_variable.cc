@@ -0,0 +1,119 @@
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include "drake/solvers/fbstab/components/sparse_data.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+using VectorXd = Eigen::VectorXd;
+
+SparseVariable::SparseVariable(int nz, int nv) {
+  if (nz <= 0 || nv <= 0) {
+    throw std::runtime_error(
+        "Inputs nz and nv to SparseVariable::SparseVariable must be positive.");
+  }
+  nz_ = nz;
+  nv_ = nv;
+
+  z_storage_ = std::make_unique<VectorXd>(nz_);
+  v_storage_ = std::make_unique<VectorXd>(nv_);
+  y_storage_ = std::make_unique<VectorXd>(nv_);
+
+  z_ = z_storage_.get();
+  v_ = v_storage_.get();
+  y_ = y_storage_.get();
+}
+
+SparseVariable::SparseVariable(VectorXd* z, VectorXd* v, VectorXd* y) {
+  if (z == nullptr || v == nullptr || y == nullptr) {
+    throw std::runtime_error(
+        "SparseVariable::SparseVariable requires non-null pointers.");
+  }
+  if (y->size() != v->size()) {
+    throw std::runtime_error(
+        "In SparseVariable::SparseVariable: v and y input size mismatch");
+  }
+  nz_ = z->size();
+  nv_ = v->size();
+
+  if (nz_ == 0 || nv_ == 0) {
+    throw std::runtime_error(
+        "Inputs to SparseVariable::SparseVariable must have nonzero sizes.");
+  }
+  z_ = z;
+  v_ = v;
+  y_ = y;
+}
+
+void SparseVariable::Fill(double a) {
+  if (data_ == nullptr) {
+    throw std::runtime_error(
+        "Cannot call SparseVariable::Fill unless data is linked.");
+  }
+  z_->setConstant(a);
+  v_->setConstant(a);
+
+  // Compute y = b - A*z
+  if (a == 0.0) {
+    *y_ = data_->b();
+  } else {
+    InitializeConstraintMargin();
+  }
+}
+
+void SparseVariable::InitializeConstraintMargin() {
+  if (data_ == nullptr) {
+    throw std::runtime_error(
+        "Cannot call SparseVariable::InitializeConstraintMargin unless data is "
+        "linked.");
+  }
+  y_->noalias() = data_->b() - data_->A() * (*z_);
+}
+
+void SparseVariable::axpy(double a, const SparseVariable& x) {
+  if (data_ == nullptr) {
+    throw std::runtime_error(
+        "Cannot call SparseVariable::axpy unless data is linked.");
+  }
+  (*z_) += a * x.z();
+  (*v_) += a * x.v();
+  (*y_) += a * (x.y() - data_->b());
+}
+
+void SparseVariable::Copy(const SparseVariable& x) {
+  if (nz_ != x.nz_ || nv_ != x.nv_) {
+    throw std::runtime_error("Sizes not equal in SparseVariable::Copy");
+  }
+  (*z_) = x.z();
+  (*v_) = x.v();
+  (*y_) = x.y();
+  data_ = x.data_;
+}
+
+const SparseData* SparseVariable::data() const {
+  if (data_ == nullptr) {
+    throw std::runtime_error(
+        "In SparseData::data: pointer to data requested before being "
+        "assigned.");
+  }
+
+  return data_;
+}
+void SparseVariable::ProjectDuals() { *v_ = v_->cwiseMax(0); }
+
+double SparseVariable::Norm() const {
+  double t1 = z_->norm();
+  double t2 = v_->norm();
+  return sqrt(t1 * t1 + t2 * t2);
+}
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
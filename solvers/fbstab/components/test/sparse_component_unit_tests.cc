@@ -0,0 +1,34 @@
+/**
+ * @file Runs unit tests for the Sparse components. See
+ * sparse_component_unit_tests.h for documentation.
+ */
+#include "drake/solvers/fbstab/components/test/sparse_component_unit_tests.h"
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+namespace test {
+namespace {
+
+GTEST_TEST(FBstabSparse, SparseVariableAndResidual) {
+  SparseComponentUnitTests test;
+  test.SparseVariableAndResidualTests();
+}
+
+GTEST_TEST(FBstabSparse, SparseLinearSolver) {
+  SparseComponentUnitTests test;
+  test.LinearSolverResidual();
+}
+
+GTEST_TEST(FBstabSparse, InfeasibilityDetection) {
+  SparseComponentUnitTests test;
+  test.InfeasibilityDetection();
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cmath>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <gtest/gtest.h>
+
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_feasibility.h"
+#include "drake/solvers/fbstab/components/sparse_linear_solver.h"
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+namespace test {
+
+using MatrixXd = Eigen::MatrixXd;
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using VectorXd = Eigen::VectorXd;
+
+/**
+ * This class implements unit tests for the following classes
+ * SparseData
+ * SparseVariable
+ * SparseResidual
+ * SparseFeasibility
+ * SparseLinearSolver
+ *
+ * It uses the same problem data as DenseComponentUnitTests, stored in sparse
+ * format.
+ */
+class SparseComponentUnitTests {
+ public:
+  SparseComponentUnitTests() {
+    MatrixXd H(2, 2);
+    MatrixXd A(2, 2);
+    f_.resize(2);
+    b_.resize(2);
+    n_ = f_.size();
+    q_ = b_.size();
+
+    H << 3, 1, 1, 1;
+    A << -1, 0, 0, 1;
+    f_ << 1, 6;
+    b_ << 0, -1;
+
+    H_ = H.sparseView();
+    A_ = A.sparseView();
+  }
+
+  /**
+   * Checks the computation of the constraint margin y = b - A*z
+   * and of the residuals against the values of the dense tests.
+   */
+  void SparseVariableAndResidualTests() {
+    SparseData data(&H_, &f_, &A_, &b_);
+
+    SparseVariable x(n_, q_);
+    x.LinkData(&data);
+    x.z() << 1, 5;
+    x.v() << 0.4, 2;
+    x.InitializeConstraintMargin();
+
+    SparseVariable y(n_, q_);
+    y.LinkData(&data);
+    y.z() << -5, 6;
+    y.v() << -9, 1;
+    y.InitializeConstraintMargin();
+
+    VectorXd margin_expected = b_ - A_ * x.z();
+    for (int i = 0; i < q_; i++) {
+      EXPECT_DOUBLE_EQ(x.y()(i), margin_expected(i));
+    }
+
+    SparseResidual r(n_, q_);
+    r.InnerResidual(x, y, 0.5);
+    VectorXd rz_expected(n_);
+    rz_expected << 11.6, 13.5;
+    VectorXd rv_expected(q_);
+    rv_expected << 0.480683041678573, -8.88473245759182;
+    for (int i = 0; i < n_; i++) {
+      EXPECT_NEAR(r.z()(i), rz_expected(i), 1e-14);
+    }
+    for (int i = 0; i < q_; i++) {
+      EXPECT_NEAR(r.v()(i), rv_expected(i), 1e-14);
+    }
+
+    r.NaturalResidual(x);
+    rz_expected << 8.6, 14.0;
+    rv_expected << 0.4, -6;
+    for (int i = 0; i < n_; i++) {
+      EXPECT_NEAR(r.z()(i), rz_expected(i), 1e-14);
+    }
+    for (int i = 0; i < q_; i++) {
+      EXPECT_NEAR(r.v()(i), rv_expected(i), 1e-14);
+    }
+  }
+
+  // Verifies that the outputs of the Solve and
+  // Initialize methods do indeed solve the system
+  //
+  //      [ Hs   A']  dz  =  rz
+  //      [-C*A  D ]  dv     rv
+  //
+  // where Hs = H + sigma*I, and
+  // C = diag(gamma), D = diag(mus)
+  // are diagonal weighting matrices computed from the derivatives
+  // of the Penalized Fischer-Burmeister Function.
+  void LinearSolverResidual() {
+    SparseData data(&H_, &f_, &A_, &b_);
+
+    SparseVariable x(n_, q_);
+    x.LinkData(&data);
+    x.z() << 1, 5;
+    x.v() << 0.4, 2;
+    x.InitializeConstraintMargin();
+
+    SparseVariable y(n_, q_);
+    y.LinkData(&data);
+    y.z() << -5, 6;
+    y.v() << -9, 1;
+    y.InitializeConstraintMargin();
+
+    SparseResidual r(n_, q_);
+    r.Fill(1.0);
+
+    SparseLinearSolver solver(n_, q_);
+
+    for (double sigma : {0.5, 0.1}) {
+      ASSERT_TRUE(solver.Initialize(x, y, sigma));
+      SparseVariable dx(n_, q_);
+      dx.LinkData(&data);
+      ASSERT_TRUE(solver.Solve(r, &dx));
+
+      // The sparsity pattern of K doesn't change with sigma, hence it is only
+      // analyzed once.
+      EXPECT_TRUE(solver.IsPatternAnalyzed());
+
+      // Construct the linear system
+      // using the same diagonal matrices as were used in the solver.
+      MatrixXd Hs = MatrixXd(H_) + sigma * MatrixXd::Identity(n_, n_);
+      MatrixXd C = solver.gamma_.asDiagonal();
+      MatrixXd D = solver.mus_.asDiagonal();
+      MatrixXd A = MatrixXd(A_);
+
+      MatrixXd K(n_ + q_, n_ + q_);
+      K << Hs, A.transpose(), -C * A, D;
+
+      VectorXd dxv(n_ + q_);
+      dxv << dx.z(), dx.v();
+
+      VectorXd rhs(n_ + q_);
+      rhs << r.z(), r.v();
+
+      VectorXd residual = K * dxv - rhs;
+      EXPECT_NEAR(residual.norm(), 0, 1e-12);
+    }
+  }
+
+  /**
+   * Checks that the infeasibility checker class identifies the certificates
+   * of primal and dual infeasibility of the dense tests.
+   */
+  void InfeasibilityDetection() {
+    MatrixXd H(2, 2);
+    MatrixXd A(5, 2);
+    VectorXd f(2);
+    VectorXd b(5);
+
+    H << 1, 0, 0, 0;
+    A << 1, 1, 1, 0, 0, 1, -1, 0, 0, -1;
+    f << 1, -1;
+    b << 0, 3, 3, -1, -1;
+
+    const SparseMatrixd H_sparse = H.sparseView();
+    const SparseMatrixd A_sparse = A.sparseView();
+    int n = f.size();
+    int q = b.size();
+
+    SparseData data(&H_sparse, &f, &A_sparse, &b);
+
+    SparseVariable dx(n, q);
+    dx.LinkData(&data);
+
+    // The vector v = [1 0 0 1 1] is a certificate of primal infeasibility.
+    dx.Fill(0);
+    dx.v() << 1, 0, 0, 1, 1;
+    dx.InitializeConstraintMargin();
+
+    SparseFeasibility feas(n, q);
+    feas.ComputeFeasibility(dx, 1e-8);
+    EXPECT_TRUE(feas.IsDualFeasible());
+    EXPECT_FALSE(feas.IsPrimalFeasible());
+
+    // With these constraints, the direction z = [0 1] is a direction of
+    // unbounded descent.
+    MatrixXd A_unbounded(4, 2);
+    VectorXd b_unbounded(4);
+    A_unbounded << 0, 0, 1, 0, -1, 0, 0, -1;
+    b_unbounded << 0, 3, -1, -1;
+    const SparseMatrixd A_unbounded_sparse = A_unbounded.sparseView();
+    SparseData unbounded_data(&H_sparse, &f, &A_unbounded_sparse,
+                              &b_unbounded);
+
+    SparseVariable dz(n, 4);
+    dz.LinkData(&unbounded_data);
+    dz.Fill(0);
+    dz.z() << 0, 1;
+
+    SparseFeasibility unbounded_feas(n, 4);
+    unbounded_feas.ComputeFeasibility(dz, 1e-8);
+    EXPECT_FALSE(unbounded_feas.IsDualFeasible());
+    EXPECT_TRUE(unbounded_feas.IsPrimalFeasible());
+  }
+
+ private:
+  SparseMatrixd H_;
+  SparseMatrixd A_;
+  VectorXd f_;
+  VectorXd b_;
+
+  int n_ = 0;
+  int q_ = 0;
+};
+
+}  // namespace test
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -65,6 +65,9 @@ SolverOut FBstabMpc::Solve(const QPData& qp, const QPVariable* x,
   }
 
   if (!use_initial_guess) {
+    // Filling the variable also initializes its constraint margin, which
+    // needs the data.
+    x0.LinkData(&data);
     x0.Fill(0.0);
   }
 
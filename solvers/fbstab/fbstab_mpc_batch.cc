@@ -0,0 +1,76 @@
+#include "drake/solvers/fbstab/fbstab_mpc_batch.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+FBstabMpcBatch::FBstabMpcBatch(int num_instances, int N, int nx, int nu,
+                               int nc, int num_threads) {
+  if (num_instances < 1 || num_threads < 1) {
+    throw std::runtime_error(
+        "In FBstabMpcBatch::FBstabMpcBatch: the number of instances and "
+        "threads must be positive.");
+  }
+
+  // The FBstabMpc constructor checks the problem sizes.
+  const int num_solvers = std::min(num_threads, num_instances);
+  for (int t = 0; t < num_solvers; t++) {
+    solvers_.push_back(std::make_unique<FBstabMpc>(N, nx, nu, nc));
+  }
+
+  const int nz = (nx + nu) * (N + 1);
+  const int nl = nx * (N + 1);
+  const int nv = nc * (N + 1);
+  z_.assign(num_instances, Eigen::VectorXd::Zero(nz));
+  l_.assign(num_instances, Eigen::VectorXd::Zero(nl));
+  v_.assign(num_instances, Eigen::VectorXd::Zero(nv));
+  y_.assign(num_instances, Eigen::VectorXd::Zero(nv));
+}
+
+std::vector<SolverOut> FBstabMpcBatch::Solve(
+    const std::vector<FBstabMpc::QPData>& qps, bool use_initial_guess) {
+  if (static_cast<int>(qps.size()) != num_instances()) {
+    throw std::runtime_error(
+        "In FBstabMpcBatch::Solve: mismatch between *this and the number of "
+        "instances.");
+  }
+
+  std::vector<SolverOut> outputs(num_instances());
+  const int num_threads = static_cast<int>(solvers_.size());
+  StaticParallelForIndexLoop(
+      num_threads, 0, num_instances(), [&](int thread_num, int i) {
+        const FBstabMpc::QPVariable x = mutable_variable(i);
+        outputs[i] = solvers_[thread_num]->Solve(qps[i], &x, use_initial_guess);
+      });
+  return outputs;
+}
+
+FBstabMpc::QPVariable FBstabMpcBatch::mutable_variable(int i) {
+  return {&z_.at(i), &l_.at(i), &v_.at(i), &y_.at(i)};
+}
+
+void FBstabMpcBatch::UpdateOption(const char* option, double value) {
+  for (auto& solver : solvers_) solver->UpdateOption(option, value);
+}
+void FBstabMpcBatch::UpdateOption(const char* option, int value) {
+  for (auto& solver : solvers_) solver->UpdateOption(option, value);
+}
+void FBstabMpcBatch::UpdateOption(const char* option, bool value) {
+  for (auto& solver : solvers_) solver->UpdateOption(option, value);
+}
+void FBstabMpcBatch::SetDisplayLevel(FBstabAlgoMpc::Display level) {
+  for (auto& solver : solvers_) solver->SetDisplayLevel(level);
+}
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/fbstab/fbstab_mpc.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+/**
+ * FBstabMpcBatch solves a batch of instances of the model predictive control
+ * problem (1) of FBstabMpc that have the same size (N,nx,nu,nc), e.g., the
+ * perturbed scenarios of a scenario-based MPC, which are solved again at each
+ * control tick.
+ *
+ * The instances are statically partitioned among (at most) num_threads
+ * threads. Each thread owns the workspace of one FBstabMpc solver, which it
+ * reuses for all the instances it solves, so the memory needed does not grow
+ * with the number of instances beyond their solutions.
+ *
+ * The solution of each instance is stored in the batch and is, by default,
+ * the initial guess of the same instance at the next call to Solve() (warm
+ * starting).
+ */
+class FBstabMpcBatch {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FBstabMpcBatch);
+
+  /**
+   * Allocates the workspaces and the solutions needed when solving
+   * num_instances instances of (1).
+   *
+   * @param[in] num_instances number of instances in the batch
+   * @param[in] N Horizon length
+   * @param[in] nx number of states
+   * @param[in] nu number of control input
+   * @param[in] nc number of constraints per timestep
+   * @param[in] num_threads maximum number of threads used to solve the batch
+   *
+   * Throws a runtime_error if any inputs are nonpositive.
+   */
+  FBstabMpcBatch(int num_instances, int N, int nx, int nu, int nc,
+                 int num_threads = 1);
+
+  /**
+   * Solves each instance of the batch.
+   *
+   * @param[in] qps problem data of each instance, which must remain valid
+   * during the call
+   * @param[in] use_initial_guess if true, each instance is initialized at its
+   * stored solution (that is, its solution from the previous call, or its
+   * initial guess set through mutable_variable()); otherwise it is
+   * initialized at the origin
+   * @return Summary of the optimizer output of each instance, see
+   * fbstab_algorithm.h.
+   *
+   * Throws a runtime_error if the number of instances or their dimensions
+   * don't match *this.
+   */
+  std::vector<SolverOut> Solve(const std::vector<FBstabMpc::QPData>& qps,
+                               bool use_initial_guess = true);
+
+  /** Returns the number of instances in the batch. */
+  int num_instances() const { return static_cast<int>(z_.size()); }
+
+  /** Returns the decision variables of instance i. */
+  const Eigen::VectorXd& z(int i) const { return z_.at(i); }
+  /** Returns the equality duals/costates of instance i. */
+  const Eigen::VectorXd& l(int i) const { return l_.at(i); }
+  /** Returns the inequality duals of instance i. */
+  const Eigen::VectorXd& v(int i) const { return v_.at(i); }
+  /** Returns the constraint margin of instance i. */
+  const Eigen::VectorXd& y(int i) const { return y_.at(i); }
+
+  /**
+   * Returns the storage of the solution of instance i, e.g., to set its
+   * initial guess. The pointers are valid for the lifetime of *this.
+   */
+  FBstabMpc::QPVariable mutable_variable(int i);
+
+  /**
+   * Allows for setting of solver options for all the instances, see
+   * fbstab_algorithm.h for a list.
+   * @param option Option name
+   * @param value  New value
+   */
+  void UpdateOption(const char* option, double value);
+  void UpdateOption(const char* option, int value);
+  void UpdateOption(const char* option, bool value);
+
+  /**
+   * Controls the verbosity of the algorithm,
+   * see fbstab_algorithm.h for details.
+   * @param level new display level
+   */
+  void SetDisplayLevel(FBstabAlgoMpc::Display level);
+
+ private:
+  // One solver (i.e., workspace) per thread.
+  std::vector<std::unique_ptr<FBstabMpc>> solvers_;
+
+  // The solution of each instance.
+  std::vector<Eigen::VectorXd> z_;
+  std::vector<Eigen::VectorXd> l_;
+  std::vector<Eigen::VectorXd> v_;
+  std::vector<Eigen::VectorXd> y_;
+};
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
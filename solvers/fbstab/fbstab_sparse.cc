@@ -0,0 +1,87 @@
+#include "drake/solvers/fbstab/fbstab_sparse.h"
+
+#include <memory>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_feasibility.h"
+#include "drake/solvers/fbstab/components/sparse_linear_solver.h"
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+#include "drake/solvers/fbstab/fbstab_algorithm.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+FBstabSparse::FBstabSparse(int num_variables, int num_constraints) {
+  if (num_variables <= 0 || num_constraints <= 0) {
+    throw std::runtime_error(
+        "In FBstabSparse::FBstabSparse: Inputs must be positive.");
+  }
+  nz_ = num_variables;
+  nv_ = num_constraints;
+
+  x1_ = std::make_unique<SparseVariable>(nz_, nv_);
+  x2_ = std::make_unique<SparseVariable>(nz_, nv_);
+  x3_ = std::make_unique<SparseVariable>(nz_, nv_);
+  x4_ = std::make_unique<SparseVariable>(nz_, nv_);
+
+  r1_ = std::make_unique<SparseResidual>(nz_, nv_);
+  r2_ = std::make_unique<SparseResidual>(nz_, nv_);
+
+  linear_solver_ = std::make_unique<SparseLinearSolver>(nz_, nv_);
+  feasibility_checker_ = std::make_unique<SparseFeasibility>(nz_, nv_);
+
+  algorithm_ = std::make_unique<FBstabAlgoSparse>(
+      x1_.get(), x2_.get(), x3_.get(), x4_.get(), r1_.get(), r2_.get(),
+      linear_solver_.get(), feasibility_checker_.get());
+}
+
+SolverOut FBstabSparse::Solve(const QPData& qp, const QPVariable* x,
+                              bool use_initial_guess) {
+  SparseData data(qp.H, qp.f, qp.A, qp.b);
+  SparseVariable x0(x->z, x->v, x->y);
+
+  if (nz_ != data.num_variables() || nv_ != data.num_constraints()) {
+    throw std::runtime_error(
+        "In FBstabSparse::Solve: mismatch between *this and data "
+        "dimensions.");
+  }
+  if (nz_ != x0.num_variables() || nv_ != x0.num_constraints()) {
+    throw std::runtime_error(
+        "In FBstabSparse::Solve: mismatch between *this and initial guess "
+        "dimensions.");
+  }
+  if (!use_initial_guess) {
+    x0.LinkData(&data);
+    x0.Fill(0.0);
+  }
+
+  return algorithm_->Solve(&data, &x0);
+}
+
+void FBstabSparse::UpdateOption(const char* option, int value) {
+  algorithm_->UpdateOption(option, value);
+}
+void FBstabSparse::UpdateOption(const char* option, double value) {
+  algorithm_->UpdateOption(option, value);
+}
+void FBstabSparse::UpdateOption(const char* option, bool value) {
+  algorithm_->UpdateOption(option, value);
+}
+
+void FBstabSparse::SetDisplayLevel(FBstabAlgoSparse::Display level) {
+  algorithm_->set_display_level(level);
+}
+
+// Explicit instantiation.
+template class FBstabAlgorithm<SparseVariable, SparseResidual, SparseData,
+                               SparseLinearSolver, SparseFeasibility>;
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <memory>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/fbstab/components/sparse_data.h"
+#include "drake/solvers/fbstab/components/sparse_feasibility.h"
+#include "drake/solvers/fbstab/components/sparse_linear_solver.h"
+#include "drake/solvers/fbstab/components/sparse_residual.h"
+#include "drake/solvers/fbstab/components/sparse_variable.h"
+#include "drake/solvers/fbstab/fbstab_algorithm.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+
+/** Convenience type for the templated sparse version of the algorithm. */
+using FBstabAlgoSparse =
+    FBstabAlgorithm<SparseVariable, SparseResidual, SparseData,
+                    SparseLinearSolver, SparseFeasibility>;
+
+/**
+ * FBstabSparse implements the Proximally Stabilized Semismooth Algorithm
+ * for solving convex quadratic programs of the following form (1):
+ *
+ *     min.    1/2  z'Hz + f'z
+ *     s.t.         Az <= b
+ *
+ * where H is symmetric and positive semidefinite and its dual
+ *
+ *     min.   1/2  z'Hz + b'v
+ *     s.t.   Hz + f + A'v = 0
+ *            v >= 0.
+ *
+ * Or equivalently for solving its KKT system
+ *
+ *     Hz + f + A' v = 0
+ *     Az <= b, v >= 0
+ *     (b - Az)' v = 0
+ *
+ * where v is a dual variable.
+ *
+ * The algorithm is described in https://arxiv.org/pdf/1901.04046.pdf.
+ * Aside from convexity there are no assumptions made about the problem.
+ * This method can detect unboundedness/infeasibility and accepts
+ * arbitrary initial guesses.
+ *
+ * The problem is of size (nz,nv) where:
+ * - nz > 0 is the number of decision variables
+ * - nv > 0 is the number of inequality constraints
+ *
+ * FBstabSparse solves the same problems as FBstabDense but H and A are sparse
+ * matrices, and the Newton systems are solved with a sparse LDL'
+ * factorization instead of a dense Cholesky factorization, see
+ * sparse_linear_solver.h. It is meant for QPs with many variables and sparse
+ * Hessians and constraints, e.g., those built by MathematicalProgram.
+ *
+ * Usage example:
+ * @code
+ * SparseMatrix<double> H(2,2);
+ * SparseMatrix<double> A(1,2);
+ * VectorXd f(2);
+ * VectorXd b(1);
+ *
+ * H.insert(0,0) = 1;
+ * A.insert(0,0) = 1;
+ * f << 1,-1;
+ * b << 0;
+ *
+ * FBstabSparse::QPData data = {&H, &A, &f, &b};
+ *
+ * VectorXd x0 = VectorXd::Zero(2);
+ * VectorXd v0 = VectorXd::Zero(1);
+ * VectorXd y0 = VectorXd::Zero(1);
+ *
+ * FBstabSparse::QPVariable x = {&x0, &v0, &y0};
+ *
+ * FBstabSparse solver(2,1);
+ * solver.Solve(data,x); // x is used as an initial guess then overwritten
+ * @endcode
+ */
+class FBstabSparse {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FBstabSparse);
+  /** Structure to hold the problem data. */
+  struct QPData {
+    /// nz x nz real positive semidefinite sparse Hessian matrix.
+    const Eigen::SparseMatrix<double>* H = nullptr;
+    /// nv x nz real sparse constraint Jacobian.
+    const Eigen::SparseMatrix<double>* A = nullptr;
+    /// nz real linear cost.
+    const Eigen::VectorXd* f = nullptr;
+    /// nv real constraint rhs.
+    const Eigen::VectorXd* b = nullptr;
+  };
+
+  /**
+   * Structure to hold the initial guess.
+   * The vectors pointed to by z, v, and y WILL BE OVERWRITTEN
+   * with the solution.
+   */
+  struct QPVariable {
+    /// Decision variables in \reals^nz.
+    Eigen::VectorXd* z = nullptr;
+    /// Inequality duals in \reals^nv.
+    Eigen::VectorXd* v = nullptr;
+    /// Constraint margin, i.e., y = b-Az, in \reals^nv.
+    Eigen::VectorXd* y = nullptr;
+  };
+  /**
+   * Allocates needed workspace given the dimensions of the QPs to
+   * be solved. Throws a runtime_error if any inputs are non-positive.
+   *
+   * @param[in] num_variables
+   * @param[in] num_constraints
+   */
+  FBstabSparse(int num_variables, int num_constraints);
+
+  /**
+   * Solves an instance of (1)
+   *
+   * @param[in]   qp  problem data
+   *
+   * @param[in,out] x   initial guess, overwritten with the solution
+   *
+   * @param[in] use_initial_guess if false the solver is initialized at the
+   * origin.
+   *
+   * @return Summary of the optimizer output, see fbstab_algorithm.h.
+   */
+  SolverOut Solve(const QPData& qp, const QPVariable* x,
+                  bool use_initial_guess = true);
+
+  /**
+   * Allows for setting of solver options. See fbstab_algorithm.h for
+   * a list of adjustable options.
+   * @param[in] option Option name
+   * @param[in] value  New value
+   */
+  void UpdateOption(const char* option, double value);
+  void UpdateOption(const char* option, int value);
+  void UpdateOption(const char* option, bool value);
+
+  /**
+   * Controls the verbosity of the algorithm.
+   * See fbstab_algorithm.h for details.
+   * @param[in] level new display level
+   */
+  void SetDisplayLevel(FBstabAlgoSparse::Display level);
+
+ private:
+  int nz_ = 0;
+  int nv_ = 0;
+
+  std::unique_ptr<FBstabAlgoSparse> algorithm_;
+  std::unique_ptr<SparseVariable> x1_;
+  std::unique_ptr<SparseVariable> x2_;
+  std::unique_ptr<SparseVariable> x3_;
+  std::unique_ptr<SparseVariable> x4_;
+  std::unique_ptr<SparseResidual> r1_;
+  std::unique_ptr<SparseResidual> r2_;
+  std::unique_ptr<SparseLinearSolver> linear_solver_;
+  std::unique_ptr<SparseFeasibility> feasibility_checker_;
+};
+
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,104 @@
+#include "drake/solvers/fbstab/fbstab_mpc_batch.h"
+
+#include <vector>
+
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include "drake/solvers/fbstab/fbstab_mpc.h"
+#include "drake/solvers/fbstab/test/ocp_generator.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+namespace test {
+
+using VectorXd = Eigen::VectorXd;
+
+// Solves a batch of double integrator problems with perturbed initial states.
+class FBstabMpcBatchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ocp_.DoubleIntegrator(10);
+    const FBstabMpc::QPData data = ocp_.GetFBstabInput();
+    for (int i = 0; i < kNumInstances; i++) {
+      x0s_.push_back(*data.x0 +
+                     0.05 * (i + 1) * VectorXd::Ones(data.x0->size()));
+    }
+    for (int i = 0; i < kNumInstances; i++) {
+      qps_.push_back(data);
+      qps_.back().x0 = &x0s_[i];
+    }
+    size_ = ocp_.ProblemSize();
+  }
+
+  static constexpr int kNumInstances = 5;
+  OcpGenerator ocp_;
+  std::vector<VectorXd> x0s_;
+  std::vector<FBstabMpc::QPData> qps_;
+  Eigen::Vector4d size_;
+};
+
+TEST_F(FBstabMpcBatchTest, SameAsSingleSolves) {
+  FBstabMpcBatch batch(kNumInstances, size_(0), size_(1), size_(2), size_(3),
+                       2 /* num_threads */);
+  batch.UpdateOption("abs_tol", 1e-6);
+  batch.SetDisplayLevel(FBstabAlgoMpc::Display::OFF);
+  const std::vector<SolverOut> outs = batch.Solve(qps_);
+  ASSERT_EQ(static_cast<int>(outs.size()), kNumInstances);
+
+  FBstabMpc solver(size_(0), size_(1), size_(2), size_(3));
+  solver.UpdateOption("abs_tol", 1e-6);
+  solver.SetDisplayLevel(FBstabAlgoMpc::Display::OFF);
+  for (int i = 0; i < kNumInstances; i++) {
+    ASSERT_EQ(outs[i].eflag, ExitFlag::SUCCESS);
+    ASSERT_LE(outs[i].residual, 1e-6);
+
+    VectorXd z = VectorXd::Zero(ocp_.nz());
+    VectorXd l = VectorXd::Zero(ocp_.nl());
+    VectorXd v = VectorXd::Zero(ocp_.nv());
+    VectorXd y = VectorXd::Zero(ocp_.nv());
+    FBstabMpc::QPVariable x = {&z, &l, &v, &y};
+    const SolverOut out = solver.Solve(qps_[i], &x);
+    EXPECT_EQ(outs[i].newton_iters, out.newton_iters);
+    EXPECT_EQ(batch.z(i), z);
+    EXPECT_EQ(batch.l(i), l);
+    EXPECT_EQ(batch.v(i), v);
+    EXPECT_EQ(batch.y(i), y);
+  }
+}
+
+TEST_F(FBstabMpcBatchTest, WarmStart) {
+  FBstabMpcBatch batch(kNumInstances, size_(0), size_(1), size_(2), size_(3),
+                       3 /* num_threads */);
+  batch.SetDisplayLevel(FBstabAlgoMpc::Display::OFF);
+  const std::vector<SolverOut> cold = batch.Solve(qps_);
+
+  // Solving the same instances again starts from their solutions.
+  const std::vector<SolverOut> warm = batch.Solve(qps_);
+  for (int i = 0; i < kNumInstances; i++) {
+    ASSERT_EQ(warm[i].eflag, ExitFlag::SUCCESS);
+    EXPECT_LT(warm[i].newton_iters, cold[i].newton_iters);
+  }
+
+  // Unless the initial guess isn't used.
+  const std::vector<SolverOut> again = batch.Solve(qps_, false);
+  for (int i = 0; i < kNumInstances; i++) {
+    EXPECT_EQ(again[i].newton_iters, cold[i].newton_iters);
+  }
+}
+
+TEST_F(FBstabMpcBatchTest, Throws) {
+  EXPECT_THROW(FBstabMpcBatch(0, 1, 1, 1, 1), std::runtime_error);
+  EXPECT_THROW(FBstabMpcBatch(1, 1, 1, 1, 1, 0), std::runtime_error);
+  EXPECT_THROW(FBstabMpcBatch(1, 0, 1, 1, 1), std::runtime_error);
+
+  FBstabMpcBatch batch(kNumInstances + 1, size_(0), size_(1), size_(2),
+                       size_(3));
+  EXPECT_THROW(batch.Solve(qps_), std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,280 @@
+/**
+ * @file Unit tests for FBstabSparse
+ * which is designed to solve QPs of the form:
+ *
+ * min  0.5 z'Hz + f'z
+ * s.t. Az <= b
+ *
+ * where H and A are sparse.
+ */
+#include <cmath>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <gtest/gtest.h>
+
+#include "drake/solvers/fbstab/fbstab_dense.h"
+#include "drake/solvers/fbstab/fbstab_sparse.h"
+
+namespace drake {
+namespace solvers {
+namespace fbstab {
+namespace test {
+
+using MatrixXd = Eigen::MatrixXd;
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using VectorXd = Eigen::VectorXd;
+
+/**
+ * Tests FBstab with
+ *
+ * H = [3 1]  f = [10]
+ *     [1 1]      [5 ]
+ *
+ * A = [-1 0] b = [0]
+ *     [0  1]     [0]
+ *
+ * This QP can be solved analytically
+ * and has the unique primal(z) - dual(v) solution
+ * z = [0 -5],  v = [5 0]
+ */
+GTEST_TEST(FBstabSparse, FeasibleQP) {
+  MatrixXd H(2, 2);
+  MatrixXd A(2, 2);
+  VectorXd f(2);
+  VectorXd b(2);
+
+  H << 3, 1, 1, 1;
+  f << 10, 5;
+  A << -1, 0, 0, 1;
+  b << 0, 0;
+
+  const SparseMatrixd H_sparse = H.sparseView();
+  const SparseMatrixd A_sparse = A.sparseView();
+
+  int n = f.size();
+  int q = b.size();
+
+  FBstabSparse::QPData data;
+  data.H = &H_sparse;
+  data.f = &f;
+  data.A = &A_sparse;
+  data.b = &b;
+
+  VectorXd z0 = Eigen::VectorXd::Zero(n);
+  VectorXd v0 = Eigen::VectorXd::Zero(q);
+  VectorXd y0 = Eigen::VectorXd::Zero(q);
+
+  FBstabSparse::QPVariable x0;
+  x0.z = &z0;
+  x0.v = &v0;
+  x0.y = &y0;
+
+  FBstabSparse solver(n, q);
+  solver.UpdateOption("abs_tol", 1e-8);
+  solver.SetDisplayLevel(FBstabAlgoSparse::Display::OFF);
+  SolverOut out = solver.Solve(data, &x0);
+
+  ASSERT_EQ(out.eflag, ExitFlag::SUCCESS);
+
+  VectorXd zopt(2);
+  VectorXd vopt(2);
+  zopt << 0, -5;
+  vopt << 5, 0;
+  for (int i = 0; i < n; i++) {
+    EXPECT_NEAR(z0(i), zopt(i), 1e-8);
+  }
+
+  for (int i = 0; i < q; i++) {
+    EXPECT_NEAR(v0(i), vopt(i), 1e-8);
+  }
+
+  // The solver is initialized at the origin when asked to.
+  z0.setConstant(100);
+  out = solver.Solve(data, &x0, false);
+  ASSERT_EQ(out.eflag, ExitFlag::SUCCESS);
+  for (int i = 0; i < n; i++) {
+    EXPECT_NEAR(z0(i), zopt(i), 1e-8);
+  }
+}
+
+/**
+ * Tests FBstab with
+ *
+ * H = [1 0]  f = [1 ]
+ *     [0 0]      [-1]
+ *
+ * A = [1  1] b = [0 ]
+ *     [1  0]     [3 ]
+ *     [0  1]     [3 ]
+ *     [-1 0]     [-1]
+ *     [0 -1]     [-1]
+ *
+ * This QP is infeasible, i.e.,
+ * there is no z satisfying Az <= b
+ */
+GTEST_TEST(FBstabSparse, InfeasibleQP) {
+  MatrixXd H(2, 2);
+  MatrixXd A(5, 2);
+  VectorXd f(2);
+  VectorXd b(5);
+
+  H << 1, 0, 0, 0;
+  f << 1, -1;
+
+  A << 1, 1, 1, 0, 0, 1, -1, 0, 0, -1;
+
+  b << 0, 3, 3, -1, -1;
+
+  const SparseMatrixd H_sparse = H.sparseView();
+  const SparseMatrixd A_sparse = A.sparseView();
+
+  int n = f.size();
+  int q = b.size();
+
+  FBstabSparse::QPData data;
+  data.H = &H_sparse;
+  data.f = &f;
+  data.A = &A_sparse;
+  data.b = &b;
+
+  VectorXd z0 = Eigen::VectorXd::Zero(n);
+  VectorXd v0 = Eigen::VectorXd::Zero(q);
+  VectorXd y0 = Eigen::VectorXd::Zero(q);
+
+  FBstabSparse::QPVariable x0;
+  x0.z = &z0;
+  x0.v = &v0;
+  x0.y = &y0;
+
+  FBstabSparse solver(n, q);
+  solver.UpdateOption("abs_tol", 1e-8);
+  solver.SetDisplayLevel(FBstabAlgoSparse::Display::OFF);
+  SolverOut out = solver.Solve(data, &x0);
+
+  ASSERT_EQ(out.eflag, ExitFlag::PRIMAL_INFEASIBLE);
+}
+
+/**
+ * Tests FBstab with
+ *
+ * H = [1 0]  f = [1 ]
+ *     [0 0]      [-1]
+ *
+ * A = [0  0] b = [0 ]
+ *     [1  0]     [3 ]
+ *     [-1 0]     [-1]
+ *     [0 -1]     [-1]
+ *
+ * This QP is unbounded below, i.e.,
+ * its optimal value is -infinity
+ */
+GTEST_TEST(FBstabSparse, UnboundedQP) {
+  MatrixXd H(2, 2);
+  MatrixXd A(4, 2);
+  VectorXd f(2);
+  VectorXd b(4);
+
+  H << 1, 0, 0, 0;
+  f << 1, -1;
+
+  A << 0, 0, 1, 0, -1, 0, 0, -1;
+
+  b << 0, 3, -1, -1;
+
+  const SparseMatrixd H_sparse = H.sparseView();
+  const SparseMatrixd A_sparse = A.sparseView();
+
+  int n = f.size();
+  int q = b.size();
+
+  FBstabSparse::QPData data;
+  data.H = &H_sparse;
+  data.f = &f;
+  data.A = &A_sparse;
+  data.b = &b;
+
+  VectorXd z0 = Eigen::VectorXd::Zero(n);
+  VectorXd v0 = Eigen::VectorXd::Zero(q);
+  VectorXd y0 = Eigen::VectorXd::Zero(q);
+
+  FBstabSparse::QPVariable x0;
+  x0.z = &z0;
+  x0.v = &v0;
+  x0.y = &y0;
+
+  FBstabSparse solver(n, q);
+  solver.UpdateOption("abs_tol", 1e-8);
+  solver.SetDisplayLevel(FBstabAlgoSparse::Display::OFF);
+  SolverOut out = solver.Solve(data, &x0);
+
+  ASSERT_EQ(out.eflag, ExitFlag::DUAL_INFEASIBLE);
+}
+
+/**
+ * Tests FBstabSparse against FBstabDense on a larger QP with a banded
+ * Hessian
+ *
+ * H = tridiag(-1, 4, -1), f = (-1, 1, -1, 1, ...)
+ *
+ * and box constraints -0.1 <= z <= 0.1 on every variable.
+ */
+GTEST_TEST(FBstabSparse, MatchesDense) {
+  const int n = 50;
+  const int q = 2 * n;
+
+  MatrixXd H = MatrixXd::Zero(n, n);
+  VectorXd f(n);
+  for (int i = 0; i < n; i++) {
+    H(i, i) = 4;
+    if (i > 0) {
+      H(i, i - 1) = -1;
+      H(i - 1, i) = -1;
+    }
+    f(i) = (i % 2 == 0) ? -1 : 1;
+  }
+  MatrixXd A(q, n);
+  A << MatrixXd::Identity(n, n), -MatrixXd::Identity(n, n);
+  const VectorXd b = VectorXd::Constant(q, 0.1);
+
+  const SparseMatrixd H_sparse = H.sparseView();
+  const SparseMatrixd A_sparse = A.sparseView();
+
+  VectorXd z_dense = VectorXd::Zero(n);
+  VectorXd v_dense = VectorXd::Zero(q);
+  VectorXd y_dense = VectorXd::Zero(q);
+  FBstabDense dense_solver(n, q);
+  dense_solver.UpdateOption("abs_tol", 1e-8);
+  dense_solver.SetDisplayLevel(FBstabAlgoDense::Display::OFF);
+  const FBstabDense::QPData dense_data = {&H, &A, &f, &b};
+  const FBstabDense::QPVariable dense_x = {&z_dense, &v_dense, &y_dense};
+  ASSERT_EQ(dense_solver.Solve(dense_data, &dense_x).eflag, ExitFlag::SUCCESS);
+
+  VectorXd z_sparse = VectorXd::Zero(n);
+  VectorXd v_sparse = VectorXd::Zero(q);
+  VectorXd y_sparse = VectorXd::Zero(q);
+  FBstabSparse sparse_solver(n, q);
+  sparse_solver.UpdateOption("abs_tol", 1e-8);
+  sparse_solver.SetDisplayLevel(FBstabAlgoSparse::Display::OFF);
+  const FBstabSparse::QPData sparse_data = {&H_sparse, &A_sparse, &f, &b};
+  const FBstabSparse::QPVariable sparse_x = {&z_sparse, &v_sparse, &y_sparse};
+  ASSERT_EQ(sparse_solver.Solve(sparse_data, &sparse_x).eflag,
+            ExitFlag::SUCCESS);
+
+  for (int i = 0; i < n; i++) {
+    EXPECT_NEAR(z_sparse(i), z_dense(i), 1e-6);
+  }
+  for (int i = 0; i < q; i++) {
+    EXPECT_NEAR(v_sparse(i), v_dense(i), 1e-6);
+  }
+
+  // Check satisfaction of KKT conditions.
+  VectorXd r1 = H * z_sparse + f + A.transpose() * v_sparse;
+  VectorXd r2 = y_sparse.cwiseMin(v_sparse);
+  ASSERT_NEAR(r1.norm() + r2.norm(), 0, 1e-6);
+}
+
+}  // namespace test
+}  // namespace fbstab
+}  // namespace solvers
+}  // namespace drake
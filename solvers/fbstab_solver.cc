@@ -0,0 +1,238 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/math/eigen_sparse_triplet.h"
+#include "drake/solvers/fbstab/fbstab_sparse.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+// Adds the quadratic costs ½xᵀQx + bᵀx + c to the Hessian H, the linear cost
+// f and constant_cost_term. H is made symmetric, i.e., ½(Q + Qᵀ) is added.
+void ParseQuadraticCosts(const MathematicalProgram& prog,
+                         std::vector<Eigen::Triplet<double>>* H_triplets,
+                         Eigen::VectorXd* f, double* constant_cost_term) {
+  for (const auto& quadratic_cost : prog.quadratic_costs()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(quadratic_cost.variables());
+    const std::vector<Eigen::Triplet<double>> Qi_triplets =
+        math::SparseMatrixToTriplets(quadratic_cost.evaluator()->Q());
+    H_triplets->reserve(H_triplets->size() + 2 * Qi_triplets.size());
+    for (const auto& Qi_triplet : Qi_triplets) {
+      const int row = x_indices[Qi_triplet.row()];
+      const int col = x_indices[Qi_triplet.col()];
+      H_triplets->emplace_back(row, col, 0.5 * Qi_triplet.value());
+      H_triplets->emplace_back(col, row, 0.5 * Qi_triplet.value());
+    }
+    for (int i = 0; i < static_cast<int>(x_indices.size()); ++i) {
+      (*f)(x_indices[i]) += quadratic_cost.evaluator()->b()(i);
+    }
+    *constant_cost_term += quadratic_cost.evaluator()->c();
+  }
+}
+
+void ParseLinearCosts(const MathematicalProgram& prog, Eigen::VectorXd* f,
+                      double* constant_cost_term) {
+  for (const auto& linear_cost : prog.linear_costs()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(linear_cost.variables());
+    for (int i = 0; i < static_cast<int>(x_indices.size()); ++i) {
+      (*f)(x_indices[i]) += linear_cost.evaluator()->a()(i);
+    }
+    *constant_cost_term += linear_cost.evaluator()->b();
+  }
+}
+
+// Appends the rows of `A_sparse` with the bounds lb ≤ A_sparse * x ≤ ub to
+// A and b of FBstab's Ax ≤ b, as rows aᵀx ≤ ub and -aᵀx ≤ -lb for the finite
+// bounds.
+void AppendLinearInequalities(const Eigen::SparseMatrix<double>& A_sparse,
+                              const Eigen::VectorXd& lb,
+                              const Eigen::VectorXd& ub,
+                              const std::vector<int>& x_indices,
+                              std::vector<Eigen::Triplet<double>>* A_triplets,
+                              std::vector<double>* b) {
+  // The row of FBstab's A for the upper (resp. lower) bound of each row of
+  // A_sparse, or -1 if the bound is infinite.
+  std::vector<int> upper_bound_row(lb.size(), -1);
+  std::vector<int> lower_bound_row(lb.size(), -1);
+  for (int i = 0; i < lb.size(); ++i) {
+    if (!std::isinf(ub(i))) {
+      upper_bound_row[i] = static_cast<int>(b->size());
+      b->push_back(ub(i));
+    }
+    if (!std::isinf(lb(i))) {
+      lower_bound_row[i] = static_cast<int>(b->size());
+      b->push_back(-lb(i));
+    }
+  }
+  for (int k = 0; k < A_sparse.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A_sparse, k); it;
+         ++it) {
+      const int col = x_indices[it.col()];
+      if (upper_bound_row[it.row()] >= 0) {
+        A_triplets->emplace_back(upper_bound_row[it.row()], col, it.value());
+      }
+      if (lower_bound_row[it.row()] >= 0) {
+        A_triplets->emplace_back(lower_bound_row[it.row()], col, -it.value());
+      }
+    }
+  }
+}
+
+void ParseAllLinearConstraints(const MathematicalProgram& prog,
+                               std::vector<Eigen::Triplet<double>>* A_triplets,
+                               std::vector<double>* b) {
+  for (const auto& constraint : prog.linear_constraints()) {
+    AppendLinearInequalities(
+        constraint.evaluator()->GetSparseMatrix(),
+        constraint.evaluator()->lower_bound(),
+        constraint.evaluator()->upper_bound(),
+        prog.FindDecisionVariableIndices(constraint.variables()), A_triplets,
+        b);
+  }
+  for (const auto& constraint : prog.linear_equality_constraints()) {
+    AppendLinearInequalities(
+        constraint.evaluator()->GetSparseMatrix(),
+        constraint.evaluator()->lower_bound(),
+        constraint.evaluator()->upper_bound(),
+        prog.FindDecisionVariableIndices(constraint.variables()), A_triplets,
+        b);
+  }
+  for (const auto& constraint : prog.bounding_box_constraints()) {
+    const int num_vars = constraint.variables().rows();
+    Eigen::SparseMatrix<double> identity(num_vars, num_vars);
+    identity.setIdentity();
+    AppendLinearInequalities(
+        identity, constraint.evaluator()->lower_bound(),
+        constraint.evaluator()->upper_bound(),
+        prog.FindDecisionVariableIndices(constraint.variables()), A_triplets,
+        b);
+  }
+}
+
+SolutionResult ConvertExitFlag(fbstab::ExitFlag exit_flag) {
+  switch (exit_flag) {
+    case fbstab::ExitFlag::SUCCESS:
+      return SolutionResult::kSolutionFound;
+    case fbstab::ExitFlag::PRIMAL_INFEASIBLE:
+    case fbstab::ExitFlag::PRIMAL_DUAL_INFEASIBLE:
+      return SolutionResult::kInfeasibleConstraints;
+    case fbstab::ExitFlag::DUAL_INFEASIBLE:
+      return SolutionResult::kDualInfeasible;
+    case fbstab::ExitFlag::MAXITERATIONS:
+      return SolutionResult::kIterationLimit;
+    case fbstab::ExitFlag::DIVERGENCE:
+      return SolutionResult::kUnknownError;
+  }
+  DRAKE_UNREACHABLE();
+}
+}  // namespace
+
+FbstabSolver::FbstabSolver()
+    : SolverBase(&id, &is_available, &ProgramAttributesSatisfied) {}
+
+FbstabSolver::~FbstabSolver() = default;
+
+SolverId FbstabSolver::id() {
+  static const never_destroyed<SolverId> singleton{"FBstab"};
+  return singleton.access();
+}
+
+bool FbstabSolver::is_available() { return true; }
+
+bool FbstabSolver::ProgramAttributesSatisfied(const MathematicalProgram& prog) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kLinearCost, ProgramAttribute::kQuadraticCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  return AreRequiredAttributesSupported(prog.required_capabilities(),
+                                        solver_capabilities.access()) &&
+         prog.required_capabilities().count(ProgramAttribute::kQuadraticCost) >
+             0;
+}
+
+void FbstabSolver::DoSolve(const MathematicalProgram& prog,
+                           const Eigen::VectorXd& initial_guess,
+                           const SolverOptions& merged_options,
+                           MathematicalProgramResult* result) const {
+  FbstabSolverDetails& solver_details =
+      result->SetSolverDetailsType<FbstabSolverDetails>();
+
+  // FBstab solves the convex quadratic program
+  // min ½zᵀHz + fᵀz
+  // s.t Az ≤ b
+  const int nz = prog.num_vars();
+  std::vector<Eigen::Triplet<double>> H_triplets;
+  Eigen::VectorXd f = Eigen::VectorXd::Zero(nz);
+  double constant_cost_term{0};
+  ParseQuadraticCosts(prog, &H_triplets, &f, &constant_cost_term);
+  ParseLinearCosts(prog, &f, &constant_cost_term);
+  Eigen::SparseMatrix<double> H(nz, nz);
+  H.setFromTriplets(H_triplets.begin(), H_triplets.end());
+
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  std::vector<double> b_values;
+  ParseAllLinearConstraints(prog, &A_triplets, &b_values);
+  // FBstab needs at least one constraint, hence an unconstrained program gets
+  // the trivial constraint 0ᵀz ≤ 1.
+  if (b_values.empty()) {
+    b_values.push_back(1);
+  }
+  const int nv = static_cast<int>(b_values.size());
+  Eigen::SparseMatrix<double> A(nv, nz);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  const Eigen::VectorXd b =
+      Eigen::Map<const Eigen::VectorXd>(b_values.data(), nv);
+
+  // Start from the initial guess, if one is given for all the variables.
+  Eigen::VectorXd z = initial_guess;
+  if (z.array().isNaN().any()) {
+    z.setZero();
+  }
+  Eigen::VectorXd v = Eigen::VectorXd::Zero(nv);
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(nv);
+
+  fbstab::FBstabSparse solver(nz, nv);
+  solver.SetDisplayLevel(fbstab::FBstabAlgoSparse::Display::OFF);
+  for (const auto& it : merged_options.GetOptionsDouble(id())) {
+    solver.UpdateOption(it.first.c_str(), it.second);
+  }
+  for (const auto& it : merged_options.GetOptionsInt(id())) {
+    solver.UpdateOption(it.first.c_str(), it.second);
+  }
+
+  const fbstab::FBstabSparse::QPData data = {&H, &A, &f, &b};
+  const fbstab::FBstabSparse::QPVariable x = {&z, &v, &y};
+  // The margin y = b - Az is computed by FBstab from z.
+  const fbstab::SolverOut out = solver.Solve(data, &x);
+
+  solver_details.exit_flag = static_cast<int>(out.eflag);
+  solver_details.residual = out.residual;
+  solver_details.newton_iters = out.newton_iters;
+  solver_details.prox_iters = out.prox_iters;
+  solver_details.solve_time = out.solve_time;
+
+  const SolutionResult solution_result = ConvertExitFlag(out.eflag);
+  if (solution_result == SolutionResult::kSolutionFound) {
+    result->set_x_val(z);
+    result->set_optimal_cost(0.5 * z.dot(H * z) + f.dot(z) +
+                             constant_cost_term);
+  } else if (solution_result == SolutionResult::kInfeasibleConstraints) {
+    result->set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+  }
+  result->set_solution_result(solution_result);
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * The FBstab solver details after calling Solve() function. The user can call
+ * MathematicalProgramResult::get_solver_details<FbstabSolver>() to obtain the
+ * details.
+ */
+struct FbstabSolverDetails {
+  /// Exit flag of FBstab, i.e., the value of fbstab::ExitFlag. Please refer to
+  /// solvers/fbstab/fbstab_algorithm.h
+  int exit_flag{};
+  /// Norm of the residual of the KKT conditions at termination.
+  double residual{};
+  /// Number of Newton iterations taken.
+  int newton_iters{};
+  /// Number of proximal (outer) iterations taken.
+  int prox_iters{};
+  /// Time taken by FBstab (seconds).
+  double solve_time{};
+};
+
+/**
+ * Solves convex quadratic programs with FBstab, see
+ * solvers/fbstab/fbstab_sparse.h. The costs, constraints and bounds of the
+ * program are assembled into the sparse problem data of FBstabSparse, whose
+ * Newton steps are computed with a sparse LDLᵀ factorization. Each linear
+ * (equality) constraint and bounding box constraint row l ≤ aᵀx ≤ u is passed
+ * to FBstab as the inequalities aᵀx ≤ u and -aᵀx ≤ -l, for the finite bounds
+ * only.
+ *
+ * The options of FBstab (see solvers/fbstab/fbstab_algorithm.h) can be set
+ * through SolverOptions, e.g., "abs_tol" as a double option and
+ * "max_newton_iters" as an int option. If the initial guess is set for all the
+ * decision variables, it is used as FBstab's initial guess of the primal
+ * variables.
+ */
+class FbstabSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FbstabSolver)
+
+  /// Type of details stored in MathematicalProgramResult.
+  using Details = FbstabSolverDetails;
+
+  FbstabSolver();
+  ~FbstabSolver() final;
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+};
+}  // namespace solvers
+}  // namespace drake
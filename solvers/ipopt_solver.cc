@@ -3,8 +3,10 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <IpIpoptApplication.hpp>
@@ -12,6 +14,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
@@ -44,7 +47,11 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern().has_value()) {
+    *num_grad = c.gradient_sparsity_pattern().value().size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -59,6 +66,9 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// described in
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
+/// When @p c declares a gradient sparsity pattern, only its entries are
+/// described; otherwise every entry of the dense gradient is.
+///
 /// @return the number of row/column pairs filled in.
 size_t GetGradientMatrix(
     const MathematicalProgram& prog, const Constraint& c,
@@ -67,6 +77,18 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  const optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      iRow[grad_index] = constraint_idx + nonzero_entry.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(nonzero_entry.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -123,6 +145,18 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   size_t grad_idx = 0;
 
   DRAKE_ASSERT(ty.rows() == c.num_constraints());
+  const optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      grad[grad_idx++] =
+          ty(nonzero_entry.first).derivatives().size() > 0
+              ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
+              : 0.0;
+    }
+    return grad_idx;
+  }
+
   for (int i = 0; i < ty.rows(); i++) {
     if (ty(i).derivatives().size() > 0) {
       for (int j = 0; j < variables.rows(); j++) {
@@ -169,10 +203,45 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init,
+                  MathematicalProgramResult* result, int num_threads,
+                  bool exact_hessian)
+      : problem_(&problem),
+        x_init_{x_init},
+        result_(result),
+        num_threads_(num_threads),
+        exact_hessian_(exact_hessian),
+        costs_(problem.GetAllCosts()) {
+    // The constraints are stored in the same order as in
+    // EvaluateConstraints() of the serial implementation, so that each one
+    // writes to its own range of the result and gradient arrays.
+    Index result_offset = 0;
+    Index grad_offset = 0;
+    auto add_constraints = [this, &result_offset, &grad_offset](
+                               const auto& bindings) {
+      for (const auto& binding : bindings) {
+        constraints_.push_back({binding.evaluator().get(),
+                                &binding.variables(), result_offset,
+                                grad_offset});
+        Index num_grad = 0;
+        result_offset += GetNumGradients(*binding.evaluator(),
+                                         binding.variables().rows(),
+                                         &num_grad);
+        grad_offset += num_grad;
+      }
+    };
+    add_constraints(problem.generic_constraints());
+    add_constraints(problem.lorentz_cone_constraints());
+    add_constraints(problem.rotated_lorentz_cone_constraints());
+    add_constraints(problem.linear_constraints());
+    add_constraints(problem.linear_equality_constraints());
+    cost_values_.resize(costs_.size());
+    cost_gradients_.resize(costs_.size());
+    if (exact_hessian_) {
+      InitializeHessianStructure();
+    }
+  }
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -215,7 +284,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
 
     constraint_cache_.reset(new ResultCache(n, m, nnz_jac_g));
 
-    nnz_h_lag = 0;
+    nnz_h_lag = hessian_rows_.size();
     index_style = C_STYLE;
     return true;
   }
@@ -388,6 +457,68 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     return true;
   }
 
+  // Only called when exact_hessian_ is true, i.e. when IPOPT's
+  // "hessian_approximation" option is "exact". The Hessian of each binding is
+  // evaluated with num_threads_ threads, and then summed up in the order of
+  // the bindings.
+  virtual bool eval_h(Index n, const Number* x, bool new_x, Number obj_factor,
+                      Index m, const Number* lambda, bool new_lambda,
+                      Index nele_hess, Index* iRow, Index* jCol,
+                      Number* values) {
+    unused(new_x, m, new_lambda);
+    if (!exact_hessian_) {
+      return false;
+    }
+    DRAKE_ASSERT(nele_hess == static_cast<Index>(hessian_rows_.size()));
+
+    if (values == nullptr) {
+      std::copy(hessian_rows_.begin(), hessian_rows_.end(), iRow);
+      std::copy(hessian_cols_.begin(), hessian_cols_.end(), jCol);
+      return true;
+    }
+
+    const Eigen::VectorXd xvec = MakeEigenVector(n, x);
+    StaticParallelForIndexLoop(
+        num_threads_, 0, static_cast<int>(hessian_contributions_.size()),
+        [this, &xvec, obj_factor, lambda](int, int index) {
+          HessianContribution& h = hessian_contributions_[index];
+          const int num_outputs = h.evaluator->num_outputs();
+          Eigen::VectorXd this_lambda(num_outputs);
+          if (h.lambda_offset < 0) {
+            this_lambda(0) = obj_factor;
+          } else {
+            for (int i = 0; i < num_outputs; ++i) {
+              this_lambda(i) = lambda[h.lambda_offset + i];
+            }
+          }
+          // Skips the bindings whose multipliers are all zero (e.g., the
+          // inactive inequality constraints).
+          if ((this_lambda.array() == 0).all()) {
+            h.hessian.resize(0, 0);
+            return;
+          }
+          const int num_vars = h.variables->rows();
+          Eigen::VectorXd this_x(num_vars);
+          for (int i = 0; i < num_vars; ++i) {
+            this_x(i) =
+                xvec(problem_->FindDecisionVariableIndex((*h.variables)(i)));
+          }
+          h.evaluator->EvalHessianOfLagrangian(this_x, this_lambda,
+                                               &h.hessian);
+        });
+
+    std::fill(values, values + nele_hess, 0.0);
+    for (const HessianContribution& h : hessian_contributions_) {
+      if (h.hessian.size() == 0) {
+        continue;
+      }
+      for (const HessianEntry& entry : h.entries) {
+        values[entry.index] += entry.scale * h.hessian(entry.row, entry.col);
+      }
+    }
+    return true;
+  }
+
   virtual void finalize_solution(SolverReturn status, Index n, const Number* x,
                                  const Number* z_L, const Number* z_U, Index m,
                                  const Number* g, const Number* lambda,
@@ -449,39 +580,47 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   }
 
  private:
+  // The bindings are evaluated with num_threads_ threads, each writing to its
+  // own entries of cost_values_ and cost_gradients_ (for the costs) or to its
+  // own range of the cached result and gradients (for the constraints). The
+  // costs are then summed up in the order of the bindings, so that the result
+  // doesn't depend on the number of threads.
   void EvaluateCosts(Index n, const Number* x) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
-    Eigen::VectorXd this_x;
-
     memcpy(cost_cache_->x.data(), x, n * sizeof(Number));
     cost_cache_->result[0] = 0;
     cost_cache_->grad.assign(n, 0);
 
-    for (auto const& binding : problem_->GetAllCosts()) {
-      int num_v_variables = binding.GetNumElements();
-      this_x.resize(num_v_variables);
-      for (int i = 0; i < num_v_variables; ++i) {
-        this_x(i) =
-            xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
-      }
-
-      binding.evaluator()->Eval(math::initializeAutoDiff(this_x), &ty);
-
-      cost_cache_->result[0] += ty(0).value();
-
-      if (ty(0).derivatives().size() > 0) {
-        for (int j = 0; j < num_v_variables; ++j) {
-          const size_t vj_index =
-              problem_->FindDecisionVariableIndex(binding.variables()(j));
-          cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
-        }
+    StaticParallelForIndexLoop(
+        num_threads_, 0, static_cast<int>(costs_.size()),
+        [this, &xvec](int, int cost_index) {
+          const Binding<Cost>& binding = costs_[cost_index];
+          const int num_v_variables = binding.GetNumElements();
+          Eigen::VectorXd this_x(num_v_variables);
+          for (int i = 0; i < num_v_variables; ++i) {
+            this_x(i) = xvec(
+                problem_->FindDecisionVariableIndex(binding.variables()(i)));
+          }
+          AutoDiffVecXd ty(1);
+          binding.evaluator()->Eval(math::initializeAutoDiff(this_x), &ty);
+          cost_values_[cost_index] = ty(0).value();
+          cost_gradients_[cost_index] = ty(0).derivatives();
+        });
+
+    for (int cost_index = 0; cost_index < static_cast<int>(costs_.size());
+         ++cost_index) {
+      const Binding<Cost>& binding = costs_[cost_index];
+      cost_cache_->result[0] += cost_values_[cost_index];
+      // We do not need to add code for a gradient of zero size, since
+      // cost_cache_->grad would be unchanged.
+      for (int j = 0; j < cost_gradients_[cost_index].size(); ++j) {
+        const size_t vj_index =
+            problem_->FindDecisionVariableIndex(binding.variables()(j));
+        cost_cache_->grad[vj_index] += cost_gradients_[cost_index](j);
       }
-      // We do not need to add code for ty(0).derivatives().size() == 0, since
-      // cost_cache_->grad would be unchanged if the derivative has zero size.
     }
   }
 
@@ -492,38 +631,112 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = constraint_cache_->grad.data();
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+    StaticParallelForIndexLoop(
+        num_threads_, 0, static_cast<int>(constraints_.size()),
+        [this, &xvec, result, grad](int, int constraint_index) {
+          const ConstraintInCache& c = constraints_[constraint_index];
+          EvaluateConstraint(*problem_, xvec, *c.evaluator, *c.variables,
+                             result + c.result_offset, grad + c.grad_offset);
+        });
+  }
+
+  // Computes the sparsity structure of the Hessian of the Lagrangian, as the
+  // union of the lower-triangular entries declared by each binding (or all
+  // of them, for the bindings without a declared pattern).
+  void InitializeHessianStructure() {
+    std::map<std::pair<Index, Index>, Index> entry_indices;
+    auto add_contribution = [this, &entry_indices](
+                                const EvaluatorBase* evaluator,
+                                const VectorXDecisionVariable* variables,
+                                Index lambda_offset) {
+      HessianContribution h{evaluator, variables, lambda_offset, {}, {}};
+      std::vector<std::pair<int, int>> local_entries;
+      if (evaluator->hessian_sparsity_pattern().has_value()) {
+        local_entries = evaluator->hessian_sparsity_pattern().value();
+      } else {
+        for (int j = 0; j < variables->rows(); ++j) {
+          for (int i = j; i < variables->rows(); ++i) {
+            local_entries.emplace_back(i, j);
+          }
+        }
+      }
+      for (const auto& local : local_entries) {
+        Index row = problem_->FindDecisionVariableIndex(
+            (*variables)(local.first));
+        Index col = problem_->FindDecisionVariableIndex(
+            (*variables)(local.second));
+        if (row < col) {
+          std::swap(row, col);
+        }
+        auto it = entry_indices.find({row, col});
+        if (it == entry_indices.end()) {
+          it = entry_indices.emplace(std::make_pair(row, col),
+                                     hessian_rows_.size()).first;
+          hessian_rows_.push_back(row);
+          hessian_cols_.push_back(col);
+        }
+        // An off-diagonal entry of the binding's Hessian on a diagonal
+        // entry of the program's Hessian (i.e., a variable repeated in the
+        // binding) also accounts for its symmetric entry.
+        const double scale =
+            (row == col && local.first != local.second) ? 2 : 1;
+        h.entries.push_back({local.first, local.second, it->second, scale});
+      }
+      hessian_contributions_.push_back(std::move(h));
+    };
+    for (const auto& binding : costs_) {
+      add_contribution(binding.evaluator().get(), &binding.variables(), -1);
     }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+    for (const ConstraintInCache& c : constraints_) {
+      add_contribution(c.evaluator, c.variables, c.result_offset);
     }
   }
 
+  // A constraint, with the offsets of its values and gradients in
+  // constraint_cache_.
+  struct ConstraintInCache {
+    const Constraint* evaluator;
+    const VectorXDecisionVariable* variables;
+    Index result_offset;
+    Index grad_offset;
+  };
+
+  // An entry of a binding's Hessian, and the index of the entry of the
+  // program's Hessian it is added to (with the given scale).
+  struct HessianEntry {
+    int row;
+    int col;
+    Index index;
+    double scale;
+  };
+
+  // The Hessian of the Lagrangian of a cost (lambda_offset < 0, weighted by
+  // IPOPT's obj_factor) or a constraint (with its multipliers starting at
+  // lambda_offset), and its latest value.
+  struct HessianContribution {
+    const EvaluatorBase* evaluator;
+    const VectorXDecisionVariable* variables;
+    Index lambda_offset;
+    std::vector<HessianEntry> entries;
+    Eigen::MatrixXd hessian;
+  };
+
   const MathematicalProgram* const problem_;
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
   MathematicalProgramResult* const result_;
+  const int num_threads_;
+  const bool exact_hessian_;
+  const std::vector<Binding<Cost>> costs_;
+  std::vector<ConstraintInCache> constraints_;
+  std::vector<HessianContribution> hessian_contributions_;
+  // The lower-triangular entries of the Hessian of the Lagrangian.
+  std::vector<Index> hessian_rows_;
+  std::vector<Index> hessian_cols_;
+  // The value and the gradient of each cost in costs_.
+  std::vector<double> cost_values_;
+  std::vector<Eigen::VectorXd> cost_gradients_;
 };
 
 template <typename T>
@@ -544,7 +757,25 @@ void SetIpoptOptionsHelper(const std::string& key, const T& default_val,
   }
 }
 
-void SetIpoptOptions(const MathematicalProgram& prog,
+// Returns true if all the costs and the constraints that IPOPT evaluates
+// (i.e., all but the bounding boxes) provide an analytic Hessian.
+bool HasAnalyticHessians(const MathematicalProgram& prog) {
+  auto all_analytic = [](const auto& bindings) {
+    return std::all_of(bindings.begin(), bindings.end(),
+                       [](const auto& binding) {
+                         return binding.evaluator()->has_analytic_hessian();
+                       });
+  };
+  return all_analytic(prog.GetAllCosts()) &&
+         all_analytic(prog.generic_constraints()) &&
+         all_analytic(prog.lorentz_cone_constraints()) &&
+         all_analytic(prog.rotated_lorentz_cone_constraints()) &&
+         all_analytic(prog.linear_constraints()) &&
+         all_analytic(prog.linear_equality_constraints());
+}
+
+// Returns true if IPOPT is set to use the exact Hessian of the Lagrangian.
+bool SetIpoptOptions(const MathematicalProgram& prog,
                      const optional<SolverOptions>& user_solver_options,
                      Ipopt::IpoptApplication* app) {
   SolverOptions merged_solver_options = user_solver_options.has_value()
@@ -561,8 +792,13 @@ void SetIpoptOptions(const MathematicalProgram& prog,
   SetIpoptOptionsHelper<double>("acceptable_tol", tol, &merged_solver_options);
   SetIpoptOptionsHelper<double>("acceptable_constr_viol_tol", tol,
                                 &merged_solver_options);
-  SetIpoptOptionsHelper<std::string>("hessian_approximation", "limited-memory",
-                                     &merged_solver_options);
+  // The exact Hessian is used by default only when it is known analytically;
+  // the user can still request it for the other programs, in which case it
+  // is approximated by EvaluatorBase::EvalHessianOfLagrangian().
+  SetIpoptOptionsHelper<std::string>(
+      "hessian_approximation",
+      HasAnalyticHessians(prog) ? "exact" : "limited-memory",
+      &merged_solver_options);
   // Note: 0<= print_level <= 12, with higher numbers more verbose.  4 is very
   // useful for debugging.
   SetIpoptOptionsHelper<int>("print_level", 2, &merged_solver_options);
@@ -585,6 +821,7 @@ void SetIpoptOptions(const MathematicalProgram& prog,
   for (const auto& it : ipopt_options_str) {
     app->Options()->SetStringValue(it.first, it.second);
   }
+  return ipopt_options_str.at("hessian_approximation") == "exact";
 }
 
 }  // namespace
@@ -657,7 +894,7 @@ void IpoptSolver::DoSolve(
   Ipopt::SmartPtr<Ipopt::IpoptApplication> app = IpoptApplicationFactory();
   app->RethrowNonIpoptException(true);
 
-  SetIpoptOptions(prog, merged_options, &(*app));
+  const bool exact_hessian = SetIpoptOptions(prog, merged_options, &(*app));
 
   Ipopt::ApplicationReturnStatus status = app->Initialize();
   if (status != Ipopt::Solve_Succeeded) {
@@ -666,7 +903,8 @@ void IpoptSolver::DoSolve(
   }
 
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess, result, num_threads_,
+                          exact_hessian);
   status = app->OptimizeTNLP(nlp);
 }
 
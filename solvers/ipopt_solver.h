@@ -6,6 +6,7 @@
 #include <Eigen/Core>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/solvers/solver_base.h"
 
 namespace drake {
@@ -40,6 +41,17 @@ struct IpoptSolverDetails {
   const char* ConvertStatusToString() const;
 };
 
+/**
+ * Solves a MathematicalProgram with IPOPT.
+ *
+ * When every cost and constraint has an analytic Hessian (see
+ * EvaluatorBase::has_analytic_hessian(), e.g. the linear and quadratic ones),
+ * IPOPT's "hessian_approximation" option defaults to "exact", and IPOPT is
+ * given the sparse Hessian of the Lagrangian. Otherwise it defaults to
+ * "limited-memory" (a quasi-Newton approximation); setting it to "exact"
+ * evaluates the other Hessians with
+ * EvaluatorBase::EvalHessianOfLagrangian()'s numerical fallback.
+ */
 class IpoptSolver final : public SolverBase {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IpoptSolver)
@@ -60,9 +72,30 @@ class IpoptSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets the number of threads used to evaluate the costs and constraints in
+  /// IPOPT's callbacks. The bindings are partitioned among the threads, and
+  /// the results are scattered into IPOPT's arrays in the same order as the
+  /// serial evaluation, so the solution doesn't depend on the number of
+  /// threads. This speeds up programs with many independent bindings (e.g.,
+  /// direct collocation), but requires every cost and constraint evaluator
+  /// to be safe to evaluate concurrently.
+  ///
+  /// Defaults to 1, i.e. evaluating the bindings on IPOPT's thread.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_threads_ = num_threads;
+  }
+
+  /// Returns the number of threads used to evaluate the costs and
+  /// constraints. @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  int num_threads_{1};
 };
 
 }  // namespace solvers
@@ -10,6 +10,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -17,8 +18,10 @@
 #include <fmt/ostream.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic.h"
 #include "drake/math/matrix_util.h"
+#include "drake/solvers/chordal_decomposition.h"
 #include "drake/solvers/sos_basis_generator.h"
 #include "drake/solvers/symbolic_extraction.h"
 
@@ -674,6 +677,14 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
   return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
 }
 
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
+}
+
 Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearEqualityConstraint>& binding) {
   DRAKE_ASSERT(binding.evaluator()->A().cols() ==
@@ -708,6 +719,14 @@ MathematicalProgram::AddLinearEqualityConstraint(
   return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
 }
 
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
+}
+
 Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
     const Binding<BoundingBoxConstraint>& binding) {
   CheckBinding(binding);
@@ -1132,6 +1151,55 @@ MathematicalProgram::AddSosConstraint(const symbolic::Expression& e) {
       symbolic::Polynomial{e, symbolic::Variables{indeterminates_}});
 }
 
+pair<MatrixX<Expression>, VectorX<symbolic::Monomial>>
+MathematicalProgram::AddSparseSosConstraint(const symbolic::Polynomial& p,
+                                            int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const VectorX<symbolic::Monomial> m = ConstructMonomialBasis(p, num_threads);
+  const int n = m.size();
+  // The monomials which the products mᵢmⱼ of correlated monomials can equal.
+  std::unordered_set<symbolic::Monomial> products;
+  for (const auto& term : p.monomial_to_coefficient_map()) {
+    products.insert(term.first);
+  }
+  for (int i = 0; i < n; ++i) {
+    products.insert(m(i) * m(i));
+  }
+  // Each thread appends the edges (i, j) of its rows i to its own buffer.
+  vector<vector<pair<int, int>>> thread_edges(num_threads);
+  StaticParallelForIndexLoop(num_threads, 0, n, [&](int thread_num, int i) {
+    for (int j = i + 1; j < n; ++j) {
+      if (products.count(m(i) * m(j)) > 0) {
+        thread_edges[thread_num].emplace_back(i, j);
+      }
+    }
+  });
+  vector<pair<int, int>> edges;
+  for (const auto& buffer : thread_edges) {
+    edges.insert(edges.end(), buffer.begin(), buffer.end());
+  }
+
+  MatrixX<Expression> Q = MatrixX<Expression>::Zero(n, n);
+  symbolic::Polynomial sos_poly{};
+  for (const vector<int>& clique :
+       internal::ChordalExtensionMaximalCliques(n, edges)) {
+    const int clique_size = static_cast<int>(clique.size());
+    VectorX<symbolic::Monomial> clique_basis(clique_size);
+    for (int k = 0; k < clique_size; ++k) {
+      clique_basis(k) = m(clique[k]);
+    }
+    const auto clique_pair = NewSosPolynomial(clique_basis);
+    sos_poly += clique_pair.first;
+    for (int k = 0; k < clique_size; ++k) {
+      for (int l = 0; l < clique_size; ++l) {
+        Q(clique[k], clique[l]) += clique_pair.second(k, l);
+      }
+    }
+  }
+  AddEqualityConstraintBetweenPolynomials(sos_poly, p);
+  return std::make_pair(Q, m);
+}
+
 void MathematicalProgram::AddEqualityConstraintBetweenPolynomials(
     const symbolic::Polynomial& p1, const symbolic::Polynomial& p2) {
   const symbolic::Polynomial poly_diff = p1 - p2;
@@ -1177,6 +1177,21 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds the linear constraints lb <= A * vars <= ub with a sparse A. No
+   * symbolic expression is constructed, and A is stored in the constraint
+   * without being densified for GetSparseMatrix(), hence this is the fast way
+   * to add the large, sparse blocks of a structured program, e.g., with `vars`
+   * being a contiguous segment of the decision variables.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1456,6 +1471,18 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds the linear equality constraints Aeq * vars = beq with a sparse Aeq,
+   * without constructing any symbolic expression. See
+   * AddLinearConstraint(const Eigen::SparseMatrix<double>&, ...).
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
@@ -2205,6 +2232,34 @@ class MathematicalProgram {
   std::pair<MatrixXDecisionVariable, VectorX<symbolic::Monomial>>
   AddSosConstraint(const symbolic::Expression& e);
 
+  /**
+   * Adds constraints that a given polynomial @p p is a sums-of-squares (SOS)
+   * with a sparse Gram matrix. This is an opt-in alternative to
+   * AddSosConstraint(p) for large polynomials, whose single dense Gram matrix
+   * is expensive to factor for the solvers.
+   *
+   * The monomial basis m is selected from the sparsity of @p p, as in
+   * AddSosConstraint(p). The monomials mᵢ and mⱼ are correlated if mᵢmⱼ
+   * appears in @p p or is the square of a monomial in m. A positive
+   * semidefinite matrix Qₖ is added for each maximal clique Cₖ of a chordal
+   * extension of this correlation graph, and @p p is constrained to be
+   * ∑ₖ m(Cₖ)ᵀQₖm(Cₖ). Since the Gram matrix is restricted to this sparsity
+   * pattern, the constraint is sufficient (but not necessary) for @p p to be
+   * SOS, and it can be infeasible when AddSosConstraint(p) isn't.
+   *
+   * @param num_threads The maximum number of threads used to compute the
+   * monomial basis and the correlation graph. The program doesn't depend on
+   * num_threads.
+   * @return A pair expressing:
+   *  - The full-size Gram matrix Q = ∑ₖ Pₖᵀ Qₖ Pₖ, where Pₖ selects the
+   *    monomials of Cₖ, as expressions of the decision variables. Its value
+   *    in a solution is MathematicalProgramResult::GetSolution(Q).
+   *  - The monomial basis m.
+   * @throws std::exception if num_threads is less than one.
+   */
+  std::pair<MatrixX<symbolic::Expression>, VectorX<symbolic::Monomial>>
+  AddSparseSosConstraint(const symbolic::Polynomial& p, int num_threads = 1);
+
   /**
    * Constraining that two polynomials are the same (i.e., they have the same
    * coefficients for each monomial). This function is often used in
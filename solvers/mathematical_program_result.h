@@ -122,6 +122,20 @@ class MathematicalProgramResult final {
   /** Sets the solver ID. */
   void set_solver_id(const SolverId& solver_id) { solver_id_ = solver_id; }
 
+  /**
+   * Gets the wall clock time (in seconds) spent by each solver on the program.
+   * Solve() records the time of the solver it chose, and SolveInParallel()
+   * records the time of every solver in the portfolio that was run.
+   */
+  const std::unordered_map<SolverId, double>& get_solver_times() const {
+    return solver_times_;
+  }
+
+  /** Sets the wall clock time (in seconds) spent by the solver `solver_id`. */
+  void set_solver_time(const SolverId& solver_id, double time) {
+    solver_times_[solver_id] = time;
+  }
+
   /** Gets the solver details for the `Solver` that solved the program. Throws
    * an error if the solver_details has not been set. */
   template <typename Solver>
@@ -316,6 +330,7 @@ class MathematicalProgramResult final {
   double optimal_cost_{};
   SolverId solver_id_;
   copyable_unique_ptr<AbstractValue> solver_details_;
+  std::unordered_map<SolverId, double> solver_times_{};
   // Some solvers (like Gurobi, Cplex, etc) can store a pool of (suboptimal)
   // solutions for mixed integer programming model.
   // suboptimal_objectives_[i] is the objective value computed with the
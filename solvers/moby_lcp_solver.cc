@@ -4,6 +4,7 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -563,6 +564,12 @@ void MobyLCPSolver<T>::FinishLemkeSolution(const MatrixType& M,
     (*z)(*iiter) = x(idx);
   }
 
+  // record the z variables in the basis
+  for (const unsigned i : bas_) {
+    if (static_cast<int>(i) < q.size()) basis_.push_back(i);
+  }
+  std::sort(basis_.begin(), basis_.end());
+
   // TODO(sammy-tri) Is there a more efficient way to resize and
   // preserve the data?
   z->conservativeResize(q.size());
@@ -584,12 +591,33 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
                                      const VectorX<T>& q, VectorX<T>* z,
                                      const T& piv_tol,
                                      const T& zero_tol) const {
-  using std::max;
+  return SolveLcpLemkeFromBasis(M, q, nullptr, z, piv_tol, zero_tol);
+}
 
-  // Variables that will be reused multiple times, thus hopefully allowing
-  // Eigen to keep from freeing/reallocating memory repeatedly.
-  VectorX<T> result, dj, dl, x, xj, Be, u, z0;
-  MatrixX<T> Bl, t1, t2;
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
+                                     const VectorX<T>& q,
+                                     const std::vector<int>& initial_basis,
+                                     VectorX<T>* z, const T& piv_tol,
+                                     const T& zero_tol) const {
+  if (SolveLcpLemkeFromBasis(M, q, &initial_basis, z, piv_tol, zero_tol))
+    return true;
+
+  // Pivoting from the initial basis failed, so start over from the standard
+  // initial basis.
+  if (initial_basis.empty())
+    return false;
+  Log() << "-- restarting without warmstarting" << std::endl;
+  return SolveLcpLemkeFromBasis(M, q, nullptr, z, piv_tol, zero_tol);
+}
+
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemkeFromBasis(
+    const MatrixX<T>& M, const VectorX<T>& q,
+    const std::vector<int>* initial_basis, VectorX<T>* z, const T& piv_tol,
+    const T& zero_tol) const {
+  using std::abs;
+  using std::max;
 
   if (log_enabled_) {
     Log() << "MobyLCPSolver::SolveLcpLemke() entered" << std::endl;
@@ -605,6 +633,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
   // update the pivots
   pivots_ = 0;
+  basis_.clear();
 
   // look for immediate exit
   if (n == 0) {
@@ -623,15 +652,6 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     return true;
   }
 
-  // Lemke's algorithm doesn't seem to like warmstarting
-  //
-  // TODO(sammy-tri) this is not present in the sparse solver, and it
-  // causes subtle dead code below.
-  z->fill(0);
-
-  // copy z to z0
-  z0 = *z;
-
   ClearIndexVectors();
 
   // initialize variables
@@ -648,55 +668,64 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   std::vector<unsigned>::iterator iiter;
 
   // determine initial basis
-  if (z0.size() != n) {
-    // setup the nonbasic indices
-    for (unsigned i = 0; i < n; i++) nonbas_.push_back(i);
-  } else {
-    for (unsigned i = 0; i < n; i++) {
-      if (z0[i] > 0) {
-        bas_.push_back(i);
-      } else {
-        nonbas_.push_back(i);
-      }
+  if (initial_basis != nullptr) {
+    for (const int i : *initial_basis) {
+      if (i < 0 || i >= static_cast<int>(n))
+        throw std::logic_error("Basis index out of range.");
+      bas_.push_back(i);
     }
+    std::sort(bas_.begin(), bas_.end());
+    if (std::adjacent_find(bas_.begin(), bas_.end()) != bas_.end())
+      throw std::logic_error("Basis has duplicate indices.");
   }
+  // setup the nonbasic indices
+  std::set_difference(all_.begin(), all_.end(), bas_.begin(), bas_.end(),
+                      std::back_inserter(nonbas_));
 
   // determine initial values
   if (!bas_.empty()) {
     Log() << "-- initial basis not empty (warmstarting)" << std::endl;
 
     // start from good initial basis
-    Bl.resize(n, n);
-    Bl.setIdentity();
-    Bl *= -1;
+    Bl_.resize(n, n);
+    Bl_.setIdentity();
+    Bl_ *= -1;
 
     // select columns of M corresponding to z vars in the basis
-    selectSubMat(M, all_, bas_, &t1);
+    selectSubMat(M, all_, bas_, &t1_);
 
     // select columns of I corresponding to z vars not in the basis
-    selectSubMat(Bl, all_, nonbas_, &t2);
+    selectSubMat(Bl_, all_, nonbas_, &t2_);
 
     // setup the basis matrix
-    Bl.resize(n, t1.cols() + t2.cols());
-    Bl.block(0, 0, t1.rows(), t1.cols()) = t1;
-    Bl.block(0, t1.cols(), t2.rows(), t2.cols()) = t2;
+    Bl_.resize(n, t1_.cols() + t2_.cols());
+    Bl_.block(0, 0, t1_.rows(), t1_.cols()) = t1_;
+    Bl_.block(0, t1_.cols(), t2_.rows(), t2_.cols()) = t2_;
 
     // Solve B*x = -q.
-    x = LinearSolve(Bl, q);
+    x_ = -LinearSolve(Bl_, q);
+
+    // A (numerically) singular basis matrix gives no starting point.
+    for (int i = 0; i < x_.size(); ++i) {
+      if (!(abs(x_[i]) < std::numeric_limits<double>::infinity())) {
+        Log() << "-- singular initial basis" << std::endl;
+        return false;
+      }
+    }
   } else {
     Log() << "-- using basis of -1 (no warmstarting)" << std::endl;
 
     // use standard initial basis
-    Bl.resize(n, n);
-    Bl.setIdentity();
-    Bl *= -1;
-    x = q;
+    Bl_.resize(n, n);
+    Bl_.setIdentity();
+    Bl_ *= -1;
+    x_ = q;
   }
 
   // check whether initial basis provides a solution
-  if (x.minCoeff() >= 0.0) {
+  if (x_.minCoeff() >= 0.0) {
     Log() << " -- initial basis provides a solution!" << std::endl;
-    FinishLemkeSolution(M, q, x, z);
+    FinishLemkeSolution(M, q, x_, z);
     Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
     return true;
   }
@@ -708,7 +737,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
   // determine initial leaving variable
   Eigen::Index min_x;
-  const T min_x_val = x.topRows(n).minCoeff(&min_x);
+  const T min_x_val = x_.topRows(n).minCoeff(&min_x);
   const T tval = -min_x_val;
   for (size_t i = 0; i < nonbas_.size(); i++) {
     bas_.push_back(nonbas_[i] + n);
@@ -717,23 +746,23 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   iiter = bas_.begin();
   std::advance(iiter, lvindex);
   leaving = *iiter;
-  Log() << " -- x: " << x << std::endl;
+  Log() << " -- x: " << x_ << std::endl;
   Log() << " -- first pivot: leaving index=" << lvindex
         << "  entering index=" << entering << " minimum value: " << tval
         << std::endl;
 
   // pivot in the artificial variable
   *iiter = t;  // replace w var with _z0 in basic indices
-  u.resize(n);
+  u_.resize(n);
   for (unsigned i = 0; i < n; i++) {
-    u[i] = (x[i] < 0) ? 1 : 0;
+    u_[i] = (x_[i] < 0) ? 1 : 0;
   }
-  Be = (Bl * u) * -1;
-  u *= tval;
-  x += u;
-  x[lvindex] = tval;
-  Bl.col(lvindex) = Be;
-  Log() << "  new q: " << x << std::endl;
+  Be_ = (Bl_ * u_) * -1;
+  u_ *= tval;
+  x_ += u_;
+  x_[lvindex] = tval;
+  Bl_.col(lvindex) = Be_;
+  Log() << "  new q: " << x_ << std::endl;
 
   // main iterations begin here
   for (pivots_ = 0; pivots_ < max_iter; pivots_++) {
@@ -749,27 +778,27 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     // check whether done; if not, get new entering variable
     if (leaving == t) {
       Log() << "-- solved LCP successfully!" << std::endl;
-      FinishLemkeSolution(M, q, x, z);
+      FinishLemkeSolution(M, q, x_, z);
       Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
       return true;
     } else if (leaving < n) {
       entering = n + leaving;
-      Be.resize(n);
-      Be.fill(0);
-      Be[leaving] = -1;
+      Be_.resize(n);
+      Be_.fill(0);
+      Be_[leaving] = -1;
     } else {
       entering = leaving - n;
-      Be = M.col(entering);
+      Be_ = M.col(entering);
     }
-    dl = Be;
+    dl_ = Be_;
 
     // See comments above on the possibility of this solve failing.
-    dl = LinearSolve(Bl, dl.eval());
+    dl_ = LinearSolve(Bl_, dl_.eval());
 
     // ** find new leaving variable
     j_.clear();
-    for (unsigned i = 0; i < dl.size(); i++) {
-      if (dl[i] > mod_piv_tol) {
+    for (unsigned i = 0; i < dl_.size(); i++) {
+      if (dl_[i] > mod_piv_tol) {
         j_.push_back(i);
       }
     }
@@ -787,20 +816,20 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     if (log_enabled_) {
       std::ostringstream j;
       for (unsigned i = 0; i < j_.size(); i++) j << " " << j_[i];
-      Log() << "d: " << dl << std::endl;
+      Log() << "d: " << dl_ << std::endl;
       Log() << "j (before min ratio):" << j.str() << std::endl;
     }
 
     // select elements j from x and d
-    selectSubVec(x, j_, &xj);
-    selectSubVec(dl, j_, &dj);
+    selectSubVec(x_, j_, &xj_);
+    selectSubVec(dl_, j_, &dj_);
 
     // compute minimal ratios x(j) + EPS_DOUBLE ./ d(j), d > 0
-    result.resize(xj.size());
-    result.fill(mod_zero_tol);
-    result = xj.eval().array() + result.array();
-    result = result.eval().array() / dj.array();
-    const T theta = result.minCoeff();
+    result_.resize(xj_.size());
+    result_.fill(mod_zero_tol);
+    result_ = xj_.eval().array() + result_.array();
+    result_ = result_.eval().array() / dj_.array();
+    const T theta = result_.minCoeff();
 
     // NOTE: lexicographic ordering is not used here to prevent
     // cycling (see [Cottle 1992], pp. 340-342). Cycling is indirectly prevented
@@ -812,12 +841,12 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
     // find indices of minimal ratios, d> 0
     //   divide _x(j) ./ d(j) -- remove elements above the minimum ratio
-    for (int i = 0; i < result.size(); i++) {
-      result(i) = xj(i) / dj(i);
+    for (int i = 0; i < result_.size(); i++) {
+      result_(i) = xj_(i) / dj_(i);
     }
 
     for (iiter = j_.begin(), idx = 0; iiter != j_.end();) {
-      if (result[idx++] <= theta) {
+      if (result_[idx++] <= theta) {
         iiter++;
       } else {
         iiter = j_.erase(iiter);
@@ -862,11 +891,11 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     leaving = *iiter;
 
     // ** perform pivot
-    const T ratio = x[lvindex] / dl[lvindex];
-    dl *= ratio;
-    x -= dl;
-    x[lvindex] = ratio;
-    Bl.col(lvindex) = Be;
+    const T ratio = x_[lvindex] / dl_[lvindex];
+    dl_ *= ratio;
+    x_ -= dl_;
+    x_[lvindex] = ratio;
+    Bl_.col(lvindex) = Be_;
     *iiter = entering;
     Log() << " -- pivoting: leaving index=" << lvindex
           << "  entering index=" << entering << std::endl;
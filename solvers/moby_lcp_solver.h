@@ -198,12 +198,8 @@ class MobyLCPSolver final : public SolverBase {
   /// success/failure.
   /// @param[in] M the LCP matrix.
   /// @param[in] q the LCP vector.
-  /// @param[in,out] z the solution to the LCP on return (if the solver
-  ///                succeeds). If the length of z is equal to the length of q,
-  ///                the solver will attempt to use z's value as a starting
-  ///                solution. **This warmstarting is generally not
-  ///                recommended**: it has a predisposition to lead to a failing
-  ///                pivoting sequence. If the solver fails (returns `false`),
+  /// @param[out] z the solution to the LCP on return (if the solver
+  ///                succeeds). If the solver fails (returns `false`),
   ///                `z` will be set to the zero vector.
   /// @param[in] zero_tol The tolerance for testing against zero. If the
   ///            tolerance is negative (default) the solver will determine a
@@ -228,6 +224,21 @@ class MobyLCPSolver final : public SolverBase {
                      VectorX<T>* z, const T& piv_tol = T(-1),
                      const T& zero_tol = T(-1)) const;
 
+  /// Lemke's Algorithm, as in the SolveLcpLemke() above, but warmstarted from
+  /// @p initial_basis: the indices i of the z variables that are assumed to be
+  /// basic (i.e., zᵢ ≥ 0 and wᵢ = 0) in the solution, such as get_basis()
+  /// after the solution of a nearby LCP (e.g., that of the previous time
+  /// step). If this basis gives the solution, no pivoting is needed; otherwise
+  /// pivoting starts from it and, if that fails, starts over from the
+  /// standard initial basis (as in the SolveLcpLemke() above).
+  /// @throws std::logic_error if M is not square, if the dimensions of M do
+  ///         not match the length of q, or if @p initial_basis has an index
+  ///         that is out of range or repeated.
+  bool SolveLcpLemke(const MatrixX<T>& M, const VectorX<T>& q,
+                     const std::vector<int>& initial_basis, VectorX<T>* z,
+                     const T& piv_tol = T(-1),
+                     const T& zero_tol = T(-1)) const;
+
   /// Lemke's Algorithm for solving LCPs in the matrix class E, which contains
   /// all strictly semimonotone matrices, all P-matrices, and all strictly
   /// copositive matrices. Lemke's Algorithm is described in [Cottle 1992],
@@ -248,12 +259,8 @@ class MobyLCPSolver final : public SolverBase {
   /// Algorithm. See SolveLcpFastRegularized() for a description of all
   /// calling parameters other than @p z, which apply equally well to this
   /// function.
-  /// @param[in,out] z the solution to the LCP on return (if the solver
-  ///                succeeds). If the length of z is equal to the length of q,
-  ///                the solver will attempt to use z's value as a starting
-  ///                solution. **This warmstarting is generally not
-  ///                recommended**: it has a predisposition to lead to a failing
-  ///                pivoting sequence.
+  /// @param[out] z the solution to the LCP on return (if the solver
+  ///                succeeds).
   ///
   /// @sa SolveLcpFastRegularized()
   /// @sa SolveLcpLemke()
@@ -273,6 +280,12 @@ class MobyLCPSolver final : public SolverBase {
   /// zero.
   void reset_num_pivots() { pivots_ = 0; }
 
+  /// Returns the indices, in increasing order, of the z variables in the
+  /// basis of the solution found by the last call of SolveLcpLemke(), which
+  /// can warmstart the solution of a nearby LCP. It is empty if that call
+  /// failed or found the trivial solution z = 0.
+  const std::vector<int>& get_basis() const { return basis_; }
+
   /// @name Static versions of the instance methods with similar names.
   //@{
   static SolverId id();
@@ -287,6 +300,12 @@ class MobyLCPSolver final : public SolverBase {
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
 
+  // Implements SolveLcpLemke(), starting from `initial_basis` (if non-null).
+  bool SolveLcpLemkeFromBasis(const MatrixX<T>& M, const VectorX<T>& q,
+                              const std::vector<int>* initial_basis,
+                              VectorX<T>* z, const T& piv_tol,
+                              const T& zero_tol) const;
+
   void ClearIndexVectors() const;
 
   template <typename MatrixType, typename Scalar>
@@ -307,6 +326,12 @@ class MobyLCPSolver final : public SolverBase {
   // semantic const'ness of the class under its methods.
   // Vectors which correspond to indices into other data.
   mutable std::vector<unsigned> all_, tlist_, bas_, nonbas_, j_;
+  // The workspace of SolveLcpLemke(), which keeps its memory between calls.
+  mutable VectorX<T> result_, dj_, dl_, x_, xj_, Be_, u_;
+  mutable MatrixX<T> Bl_, t1_, t2_;
+
+  // The basis of the last solution found by SolveLcpLemke().
+  mutable std::vector<int> basis_;
 };
 
 }  // end namespace solvers
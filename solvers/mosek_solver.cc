@@ -369,13 +369,13 @@ MSKrescodee AddLinearConstraintsFromBindings(
   MSKrescodee rescode{MSK_RES_OK};
   for (const auto& binding : constraint_list) {
     const auto& constraint = binding.evaluator();
-    const Eigen::MatrixXd& A = constraint->A();
+    const Eigen::SparseMatrix<double>& A = constraint->GetSparseMatrix();
     const Eigen::VectorXd& lb = constraint->lower_bound();
     const Eigen::VectorXd& ub = constraint->upper_bound();
     Eigen::SparseMatrix<double> B_zero(A.rows(), 0);
     B_zero.setZero();
     rescode = AddLinearConstraintToMosek(
-        prog, A.sparseView(), B_zero, lb, ub, binding.variables(), {},
+        prog, A, B_zero, lb, ub, binding.variables(), {},
         bound_type, decision_variable_index_to_mosek_matrix_variable,
         decision_variable_index_to_mosek_nonmatrix_variable,
         matrix_variable_entry_to_selection_matrix_id, *task);
@@ -7,6 +7,15 @@
 namespace drake {
 namespace solvers {
 
+class OsqpSolver::Workspace {};
+
+// The constructor and destructor are defined here, where Workspace is a
+// complete type.
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &ProgramAttributesSatisfied) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return false; }
 
 void OsqpSolver::DoSolve(
@@ -1,5 +1,6 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
 #include <vector>
 
 #include <osqp.h>
@@ -96,7 +97,8 @@ void ParseLinearConstraints(const MathematicalProgram& prog,
     const std::vector<int> x_indices =
         prog.FindDecisionVariableIndices(constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        math::SparseMatrixToTriplets(
+            constraint.evaluator()->GetSparseMatrix());
     // Append constraint.A to osqp A.
     for (const auto& Ai_triplet : Ai_triplets) {
       A_triplets->emplace_back(*num_A_rows + Ai_triplet.row(),
@@ -221,8 +223,96 @@ void SetOsqpSolverSettings(const SolverOptions& solver_options,
   SetOsqpSolverSettingWithDefaultValue(options_int, "polish",
                                        &(settings->polish), 1);
 }
+
+// Returns true if the compressed matrices `a` and `b` have the same size and
+// the same non-zero entries.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& a,
+                             const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
 }  // namespace
 
+class OsqpSolver::Workspace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace(OSQPWorkspace* work, const Eigen::SparseMatrix<c_float>& P,
+            const Eigen::SparseMatrix<c_float>& A, const SolverOptions& options)
+      : work_(work), P_(P), A_(A), options_(options) {
+    DRAKE_DEMAND(work != nullptr);
+  }
+
+  ~Workspace() { osqp_cleanup(work_); }
+
+  // Returns true if this workspace was set up for a program with the same
+  // sparsity pattern of P and A and with the same options, so that it can be
+  // updated with the new values instead of being set up again.
+  bool CanBeUpdatedTo(const Eigen::SparseMatrix<c_float>& P,
+                      const Eigen::SparseMatrix<c_float>& A,
+                      const SolverOptions& options) const {
+    return options == options_ && HaveSameSparsityPattern(P, P_) &&
+           HaveSameSparsityPattern(A, A_);
+  }
+
+  // Passes the new values to OSQP, and returns the error code of OSQP. P and
+  // A are only passed if their values changed, since OSQP factorizes the KKT
+  // matrix again when they do; when only q, l and u change the cached
+  // factorization is reused.
+  // @pre CanBeUpdatedTo(P, A, options_) is true.
+  c_int Update(const Eigen::SparseMatrix<c_float>& P,
+               const Eigen::SparseMatrix<c_float>& A, c_float* q, c_float* l,
+               c_float* u) {
+    const bool P_changed = !HaveSameValues(P, P_);
+    const bool A_changed = !HaveSameValues(A, A_);
+    c_int err = 0;
+    if (P_changed && A_changed) {
+      err = osqp_update_P_A(work_, P.valuePtr(), OSQP_NULL, P.nonZeros(),
+                            A.valuePtr(), OSQP_NULL, A.nonZeros());
+    } else if (P_changed) {
+      err = osqp_update_P(work_, P.valuePtr(), OSQP_NULL, P.nonZeros());
+    } else if (A_changed) {
+      err = osqp_update_A(work_, A.valuePtr(), OSQP_NULL, A.nonZeros());
+    }
+    if (P_changed) {
+      P_ = P;
+    }
+    if (A_changed) {
+      A_ = A;
+    }
+    return err || osqp_update_lin_cost(work_, q) ||
+           osqp_update_bounds(work_, l, u);
+  }
+
+  OSQPWorkspace* work() const { return work_; }
+
+ private:
+  // Returns true if the matrices `a` and `b`, with the same sparsity pattern,
+  // have the same non-zero values.
+  static bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                             const Eigen::SparseMatrix<c_float>& b) {
+    return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(),
+                      b.valuePtr());
+  }
+
+  OSQPWorkspace* const work_;
+  // The P and A matrices that OSQP currently holds.
+  Eigen::SparseMatrix<c_float> P_;
+  Eigen::SparseMatrix<c_float> A_;
+  const SolverOptions options_;
+};
+
+// The constructor and destructor are defined here, where Workspace is a
+// complete type.
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &ProgramAttributesSatisfied) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::DoSolve(
@@ -233,9 +323,6 @@ void OsqpSolver::DoSolve(
   OsqpSolverDetails& solver_details =
       result->SetSolverDetailsType<OsqpSolverDetails>();
 
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
-
   // OSQP solves a convex quadratic programming problem
   // min 0.5 xᵀPx + qᵀx
   // s.t l ≤ Ax ≤ u
@@ -254,38 +341,72 @@ void OsqpSolver::DoSolve(
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
+  // If any step fails, it will set the solution_result and skip other steps.
+  optional<SolutionResult> solution_result;
 
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  OSQPWorkspace* work = nullptr;
+  if (workspace_ != nullptr && workspace_reuse_ &&
+      workspace_->CanBeUpdatedTo(P_sparse, A_sparse, merged_options)) {
+    // Only pass the new values to the existing workspace. OSQP then warm
+    // starts from the solution of the previous call.
+    work = workspace_->work();
+    const c_int osqp_update_err =
+        workspace_->Update(P_sparse, A_sparse, q.data(), l.data(), u.data());
+    if (osqp_update_err != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+  } else {
+    workspace_.reset();
 
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+    // Now pass the constraint and cost to osqp data.
+    OSQPData* data = nullptr;
 
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+    // Populate data.
+    data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
 
-  SetOsqpSolverSettings(merged_options, settings);
+    data->n = prog.num_vars();
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_sparse);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
 
-  // If any step fails, it will set the solution_result and skip other steps.
-  optional<SolutionResult> solution_result;
+    // Define Solver settings as default.
+    // Problem settings
+    OSQPSettings* settings =
+        static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    osqp_set_default_settings(settings);
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
+    SetOsqpSolverSettings(merged_options, settings);
+
+    // Setup workspace. osqp_setup() copies data and settings into the
+    // workspace, hence we can free them right after.
     const c_int osqp_setup_err = osqp_setup(&work, data, settings);
     if (osqp_setup_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
+    } else if (workspace_reuse_) {
+      workspace_ = std::make_unique<Workspace>(work, P_sparse, A_sparse,
+                                               merged_options);
     }
+
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+    c_free(settings);
+  }
+
+  // Warm start from the initial guess, if one is given for all the variables.
+  if (!solution_result && !initial_guess.array().isNaN().any()) {
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1> x0 =
+        initial_guess.cast<c_float>();
+    osqp_warm_start_x(work, x0.data());
   }
 
   // Solve problem.
@@ -343,18 +464,13 @@ void OsqpSolver::DoSolve(
   }
   result->set_solution_result(solution_result.value());
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Clean workspace, unless it is kept for the next call. A workspace that
+  // failed to be updated or solved is not reused.
+  if (workspace_ == nullptr) {
+    osqp_cleanup(work);
+  } else if (solution_result == SolutionResult::kInvalidInput) {
+    workspace_.reset();
+  }
 }
 
 }  // namespace solvers
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -50,9 +52,38 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// (Advanced) Enables or disables the reuse of the OSQP workspace across
+  /// calls to Solve(). This is intended for solving the same program many
+  /// times with new data (e.g., in model predictive control). When enabled,
+  /// the workspace set up by a call to Solve() is kept alive, and if the next
+  /// program has the same sparsity pattern of P and A (see OSQP's problem
+  /// statement) and the same solver options, only the new costs, constraint
+  /// coefficients and bounds are passed to OSQP instead of setting up (and
+  /// factorizing) the problem from scratch. If the values of P and A are also
+  /// unchanged (e.g., only the linear cost and the bounds change), the cached
+  /// factorization of the KKT matrix is reused as well. The primal and dual
+  /// solutions of the previous call are then used as warm start, unless a
+  /// complete initial guess is given. Otherwise, the workspace is set up
+  /// again.
+  ///
+  /// Disabled by default. Note that when enabled, Solve() modifies the state
+  /// of this solver and hence must not be called concurrently on the same
+  /// instance.
+  void set_workspace_reuse(bool enabled) { workspace_reuse_ = enabled; }
+
+  /// Returns true if the workspace reuse is enabled.
+  /// @see set_workspace_reuse().
+  bool workspace_reuse() const { return workspace_reuse_; }
+
  private:
+  // The OSQP workspace kept alive between calls to Solve().
+  class Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  bool workspace_reuse_{false};
+  mutable std::unique_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
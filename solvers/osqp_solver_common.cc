@@ -11,11 +11,6 @@
 namespace drake {
 namespace solvers {
 
-OsqpSolver::OsqpSolver()
-    : SolverBase(&id, &is_available, &ProgramAttributesSatisfied) {}
-
-OsqpSolver::~OsqpSolver() = default;
-
 SolverId OsqpSolver::id() {
   static const never_destroyed<SolverId> singleton{"OSQP"};
   return singleton.access();
@@ -1,16 +1,21 @@
 #include "drake/solvers/sdpa_free_format.h"
 
 #include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <limits>
+#include <memory>
+#include <sstream>
 #include <stdexcept>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/Sparse>
 #include <Eigen/SparseQR>
+#include <fmt/format.h>
 
 #include "drake/common/text_logging.h"
 
@@ -20,6 +25,59 @@ namespace internal {
 
 const double kInf = std::numeric_limits<double>::infinity();
 
+void ComputeBlockStartRows(const std::vector<BlockInX>& X_blocks,
+                           std::vector<int>* block_start_rows,
+                           std::vector<int>* X_row_to_block_index) {
+  block_start_rows->resize(X_blocks.size());
+  X_row_to_block_index->clear();
+  for (int i = 0; i < static_cast<int>(X_blocks.size()); ++i) {
+    (*block_start_rows)[i] = static_cast<int>(X_row_to_block_index->size());
+    X_row_to_block_index->insert(X_row_to_block_index->end(),
+                                 X_blocks[i].num_rows, i);
+  }
+}
+
+std::vector<EntryInXBlock> ConvertTripletsToUpperTriangularBlockEntries(
+    const std::vector<Eigen::Triplet<double>>& triplets,
+    const std::vector<int>& block_start_rows,
+    const std::vector<int>& X_row_to_block_index) {
+  std::vector<EntryInXBlock> entries;
+  entries.reserve(triplets.size());
+  for (const auto& triplet : triplets) {
+    if (triplet.row() <= triplet.col()) {
+      const int block_index = X_row_to_block_index[triplet.col()];
+      DRAKE_ASSERT(X_row_to_block_index[triplet.row()] == block_index);
+      entries.emplace_back(block_index,
+                           triplet.row() - block_start_rows[block_index],
+                           triplet.col() - block_start_rows[block_index],
+                           triplet.value());
+    }
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const EntryInXBlock& a, const EntryInXBlock& b) {
+              return std::tie(a.block_index, a.column_index_in_block,
+                              a.row_index_in_block) <
+                     std::tie(b.block_index, b.column_index_in_block,
+                              b.row_index_in_block);
+            });
+  // Sums up the duplicate entries.
+  int num_entries = 0;
+  for (int i = 0; i < static_cast<int>(entries.size()); ++i) {
+    if (num_entries > 0 &&
+        entries[num_entries - 1].block_index == entries[i].block_index &&
+        entries[num_entries - 1].row_index_in_block ==
+            entries[i].row_index_in_block &&
+        entries[num_entries - 1].column_index_in_block ==
+            entries[i].column_index_in_block) {
+      entries[num_entries - 1].value += entries[i].value;
+    } else {
+      entries[num_entries++] = entries[i];
+    }
+  }
+  entries.erase(entries.begin() + num_entries, entries.end());
+  return entries;
+}
+
 SdpaFreeFormat::~SdpaFreeFormat() {}
 
 void SdpaFreeFormat::DeclareXforPositiveSemidefiniteConstraints(
@@ -614,11 +672,6 @@ void SdpaFreeFormat::AddRotatedLorentzConeConstraints(
 }
 
 void SdpaFreeFormat::Finalize() {
-  A_.reserve(A_triplets_.size());
-  for (int i = 0; i < static_cast<int>(A_triplets_.size()); ++i) {
-    A_.emplace_back(num_X_rows_, num_X_rows_);
-    A_.back().setFromTriplets(A_triplets_[i].begin(), A_triplets_[i].end());
-  }
   B_.resize(static_cast<int>(A_triplets_.size()), num_free_variables_);
   B_.setFromTriplets(B_triplets_.begin(), B_triplets_.end());
   C_.resize(num_X_rows_, num_X_rows_);
@@ -627,6 +680,18 @@ void SdpaFreeFormat::Finalize() {
   d_.setFromTriplets(d_triplets_.begin(), d_triplets_.end());
 }
 
+const std::vector<Eigen::SparseMatrix<double>>& SdpaFreeFormat::A() const {
+  if (!is_A_constructed_) {
+    A_.reserve(A_triplets_.size());
+    for (int i = 0; i < static_cast<int>(A_triplets_.size()); ++i) {
+      A_.emplace_back(num_X_rows_, num_X_rows_);
+      A_.back().setFromTriplets(A_triplets_[i].begin(), A_triplets_[i].end());
+    }
+    is_A_constructed_ = true;
+  }
+  return A_;
+}
+
 SdpaFreeFormat::SdpaFreeFormat(const MathematicalProgram& prog) {
   ProgramAttributes solver_capabilities(std::initializer_list<ProgramAttribute>{
       ProgramAttribute::kLinearCost, ProgramAttribute::kLinearConstraint,
@@ -706,61 +771,34 @@ bool GenerateSDPA(const MathematicalProgram& prog,
     g_stream << std::setprecision(20);
     g_stream << sdpa_free_format.g().transpose() << "\n";
     sdpa_file << g_stream.str();
-    // block_start_rows[i] records the starting row index of the i'th block in
-    // X. row_to_block_indices[i] records the index of the block that X(i, i)
-    // belongs to.
-    std::vector<int> block_start_rows(sdpa_free_format.A().size());
-    std::vector<int> row_to_block_indices(sdpa_free_format.num_X_rows());
-    int X_row_count = 0;
-    for (int i = 0; i < static_cast<int>(sdpa_free_format.X_blocks().size());
-         ++i) {
-      block_start_rows[i] = X_row_count;
-      for (int j = X_row_count;
-           j < X_row_count + sdpa_free_format.X_blocks()[i].num_rows; ++j) {
-        row_to_block_indices[j] = i;
-      }
-      X_row_count += sdpa_free_format.X_blocks()[i].num_rows;
-    }
-    // The non-zero entries in C
-    for (int i = 0; i < sdpa_free_format.num_X_rows(); ++i) {
-      for (Eigen::SparseMatrix<double>::InnerIterator it(sdpa_free_format.C(),
-                                                         i);
-           it; ++it) {
-        if (it.row() <= it.col()) {
-          const int block_start_row = block_start_rows[row_to_block_indices[i]];
-          sdpa_file << 0 /* 0 for cost matrix C */ << " "
-                    << row_to_block_indices[i] +
-                           1 /* block number, starts from 1 */
-                    << " "
-                    << it.row() - block_start_row +
-                           1 /* block row index, starts from 1*/
-                    << " "
-                    << i - block_start_row +
-                           1 /* block column index, starts from 1*/
-                    << " " << std::setprecision(20) << it.value() << "\n";
-        }
-      }
-    }
-    // The remaining lines are for A
-    for (int i = 0; i < static_cast<int>(sdpa_free_format.A().size()); ++i) {
-      for (int j = 0; j < sdpa_free_format.num_X_rows(); ++j) {
-        for (Eigen::SparseMatrix<double>::InnerIterator it(
-                 sdpa_free_format.A()[i], j);
-             it; ++it) {
-          if (it.row() <= it.col()) {
-            const int block_start_row =
-                block_start_rows[row_to_block_indices[j]];
-            sdpa_file << i + 1 /* constraint number, starts from 1 */ << " "
-                      << row_to_block_indices[j] +
-                             1 /* block number, starts from 1 */
-                      << " " << it.row() - block_start_row + 1 << " "
-                      << j - block_start_row + 1 << std::setprecision(20) << " "
-                      << it.value() << "\n";
-          }
-        }
+    // The entries are streamed from the triplets of C and each Aᵢ, without
+    // constructing any matrix of the size of X.
+    std::vector<int> block_start_rows;
+    std::vector<int> X_row_to_block_index;
+    internal::ComputeBlockStartRows(sdpa_free_format.X_blocks(),
+                                    &block_start_rows, &X_row_to_block_index);
+    auto write_entries = [&sdpa_file, &block_start_rows, &X_row_to_block_index](
+                             int matrix_number,
+                             const std::vector<Eigen::Triplet<double>>&
+                                 triplets) {
+      for (const auto& entry :
+           internal::ConvertTripletsToUpperTriangularBlockEntries(
+               triplets, block_start_rows, X_row_to_block_index)) {
+        // The block number, and the row and column indices in the block
+        // start from 1 in SDPA format.
+        sdpa_file << matrix_number << " " << entry.block_index + 1 << " "
+                  << entry.row_index_in_block + 1 << " "
+                  << entry.column_index_in_block + 1 << " "
+                  << std::setprecision(20) << entry.value << "\n";
       }
+    };
+    // The non-zero entries in C, the matrix number 0 is for C.
+    write_entries(0, sdpa_free_format.C_triplets());
+    // The remaining lines are for A, the constraint number starts from 1.
+    for (int i = 0; i < static_cast<int>(sdpa_free_format.A_triplets().size());
+         ++i) {
+      write_entries(i + 1, sdpa_free_format.A_triplets()[i]);
     }
-
   } else {
     std::cout << "GenerateSDPA(): Cannot open the file " << file_name
               << ".dat-s\n";
@@ -769,5 +807,116 @@ bool GenerateSDPA(const MathematicalProgram& prog,
   sdpa_file.close();
   return true;
 }
+
+std::unique_ptr<MathematicalProgram> ParseSDPA(const std::string& file_name) {
+  std::ifstream sdpa_file(file_name);
+  if (!sdpa_file.is_open()) {
+    throw std::runtime_error(
+        fmt::format("ParseSDPA(): cannot open the file {}", file_name));
+  }
+  // The comment lines (starting with " or *) are skipped, as is the text that
+  // follows an '=' (e.g., "2 = mDIM"). The numbers may also be separated by
+  // commas, braces and parentheses.
+  std::stringstream numbers;
+  std::string line;
+  while (std::getline(sdpa_file, line)) {
+    if (!line.empty() && (line[0] == '"' || line[0] == '*')) continue;
+    line = line.substr(0, line.find('='));
+    std::replace_if(line.begin(), line.end(), [](char c) {
+      return c == ',' || c == '{' || c == '}' || c == '(' || c == ')';
+    }, ' ');
+    numbers << line << "\n";
+  }
+  auto fail = [&file_name](const std::string& what) {
+    return std::runtime_error(fmt::format(
+        "ParseSDPA(): the file {} is not in the SDPA sparse format: {}",
+        file_name, what));
+  };
+
+  int num_constraints{};
+  int num_blocks{};
+  if (!(numbers >> num_constraints >> num_blocks) || num_constraints < 0 ||
+      num_blocks <= 0) {
+    throw fail("invalid numbers of constraints or of blocks");
+  }
+  // A negative size stands for a diagonal block.
+  std::vector<int> block_sizes(num_blocks);
+  for (int& size : block_sizes) {
+    if (!(numbers >> size) || size == 0) throw fail("invalid block sizes");
+  }
+  Eigen::VectorXd g(num_constraints);
+  for (int i = 0; i < num_constraints; ++i) {
+    if (!(numbers >> g(i))) throw fail("missing entries of the objective");
+  }
+
+  // The blocks of C (matrix 0) and of each Aᵢ.
+  std::vector<std::vector<Eigen::MatrixXd>> blocks(num_blocks);
+  for (int b = 0; b < num_blocks; ++b) {
+    const int size = std::abs(block_sizes[b]);
+    blocks[b].assign(
+        num_constraints + 1,
+        block_sizes[b] > 0 ? Eigen::MatrixXd::Zero(size, size)
+                           : Eigen::MatrixXd::Zero(size, 1));
+  }
+  int matrix{};
+  int block{};
+  int row{};
+  int col{};
+  double value{};
+  while (numbers >> matrix) {
+    if (!(numbers >> block >> row >> col >> value)) {
+      throw fail("incomplete entry");
+    }
+    if (matrix < 0 || matrix > num_constraints || block < 1 ||
+        block > num_blocks) {
+      throw fail(fmt::format("invalid entry {} {} {} {}", matrix, block, row,
+                             col));
+    }
+    const int size = std::abs(block_sizes[block - 1]);
+    const bool diagonal = block_sizes[block - 1] < 0;
+    if (row < 1 || row > size || col < 1 || col > size ||
+        (diagonal && row != col)) {
+      throw fail(fmt::format("invalid entry {} {} {} {}", matrix, block, row,
+                             col));
+    }
+    Eigen::MatrixXd& entries = blocks[block - 1][matrix];
+    if (diagonal) {
+      entries(row - 1, 0) = value;
+    } else {
+      entries(row - 1, col - 1) = value;
+      entries(col - 1, row - 1) = value;
+    }
+  }
+  if (!numbers.eof()) throw fail("unexpected text");
+
+  auto prog = std::make_unique<MathematicalProgram>();
+  const VectorXDecisionVariable y =
+      prog->NewContinuousVariables(num_constraints, "y");
+  prog->AddLinearCost(g, y);
+  for (int b = 0; b < num_blocks; ++b) {
+    if (block_sizes[b] > 0) {
+      // F₀ + ∑ᵢ yᵢFᵢ ≽ 0, with F₀ = -C and Fᵢ = Aᵢ.
+      std::vector<Eigen::Ref<const Eigen::MatrixXd>> F;
+      const Eigen::MatrixXd F0 = -blocks[b][0];
+      F.emplace_back(F0);
+      for (int i = 1; i <= num_constraints; ++i) {
+        F.emplace_back(blocks[b][i]);
+      }
+      prog->AddLinearMatrixInequalityConstraint(F, y);
+    } else {
+      // Each diagonal entry is a linear inequality ∑ᵢ yᵢaᵢ ≥ c.
+      Eigen::MatrixXd A(-block_sizes[b], num_constraints);
+      for (int i = 1; i <= num_constraints; ++i) {
+        A.col(i - 1) = blocks[b][i];
+      }
+      prog->AddLinearConstraint(
+          A, blocks[b][0].col(0),
+          Eigen::VectorXd::Constant(-block_sizes[b],
+                                    std::numeric_limits<double>::infinity()),
+          y);
+    }
+  }
+  return prog;
+}
 }  // namespace solvers
 }  // namespace drake
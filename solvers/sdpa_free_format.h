@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -49,6 +50,49 @@ struct BlockInX {
   int num_rows;
 };
 
+/**
+ * A nonzero entry in the upper triangular part of one block of the
+ * block-diagonal matrix X (or of a matrix with the same blocks as X, such as C
+ * or Aᵢ). All indices are 0-indexed.
+ */
+struct EntryInXBlock {
+  EntryInXBlock(int block_index_in, int row_index_in_block_in,
+                int column_index_in_block_in, double value_in)
+      : block_index{block_index_in},
+        row_index_in_block{row_index_in_block_in},
+        column_index_in_block{column_index_in_block_in},
+        value{value_in} {}
+  int block_index;
+  int row_index_in_block;
+  int column_index_in_block;
+  double value;
+};
+
+/**
+ * Computes the starting row of each block in X, and the index of the block
+ * that each row of X belongs to.
+ * @param X_blocks The blocks of X.
+ * @param[out] block_start_rows block_start_rows[i] is the starting row of the
+ * i'th block in X.
+ * @param[out] X_row_to_block_index X_row_to_block_index[j] is the index of the
+ * block containing the j'th row of X.
+ */
+void ComputeBlockStartRows(const std::vector<BlockInX>& X_blocks,
+                           std::vector<int>* block_start_rows,
+                           std::vector<int>* X_row_to_block_index);
+
+/**
+ * Converts the triplets of a symmetric matrix with the same blocks as X into
+ * the entries in the upper triangular part of each block. The duplicate
+ * triplets are summed up, and the entries are sorted by block index, then by
+ * column index, then by row index. This only takes time and memory in the
+ * number of triplets, and doesn't construct any matrix of the size of X.
+ */
+std::vector<EntryInXBlock> ConvertTripletsToUpperTriangularBlockEntries(
+    const std::vector<Eigen::Triplet<double>>& triplets,
+    const std::vector<int>& block_start_rows,
+    const std::vector<int>& X_row_to_block_index);
+
 /**
  * Refer to @ref map_decision_variable_to_sdpa
  * When the decision variable either (or both) finite lower or upper bound (with
@@ -149,7 +193,12 @@ class SdpaFreeFormat {
     return d_triplets_;
   }
 
-  const std::vector<Eigen::SparseMatrix<double>>& A() const { return A_; }
+  /**
+   * Returns the matrices Aᵢ. They are constructed from A_triplets() on the
+   * first call, since each sparse matrix of the size of X takes memory in the
+   * number of rows of X. Prefer A_triplets() for large programs.
+   */
+  const std::vector<Eigen::SparseMatrix<double>>& A() const;
 
   const Eigen::SparseMatrix<double>& B() const { return B_; }
 
@@ -289,7 +338,9 @@ class SdpaFreeFormat {
   int num_free_variables_{0};
   double constant_min_cost_term_{0.0};
 
-  std::vector<Eigen::SparseMatrix<double>> A_;
+  // Constructed from A_triplets_ on the first call to A().
+  mutable std::vector<Eigen::SparseMatrix<double>> A_;
+  mutable bool is_A_constructed_{false};
   Eigen::SparseMatrix<double> C_;
   Eigen::SparseMatrix<double> B_;
   Eigen::SparseMatrix<double> d_;
@@ -322,5 +373,21 @@ class SdpaFreeFormat {
  */
 bool GenerateSDPA(const MathematicalProgram& prog,
                   const std::string& file_name);
+
+/**
+ * Reads the SDP in the SDPA sparse format (the format written by
+ * GenerateSDPA(), and that of problem sets such as SDPLIB) from the file named
+ * @p file_name, including its extension (usually ".dat-s"), as the program
+ *
+ *     min gᵀy
+ *     s.t ∑ᵢ yᵢAᵢ - C ≽ 0
+ * in the notation of GenerateSDPA(), so that its optimal cost is the optimal
+ * objective reported for the problem by the SDPA solvers (and by SDPLIB).
+ * Each matrix block of the inequality is a LinearMatrixInequalityConstraint,
+ * and each diagonal block a LinearConstraint.
+ * @throws std::runtime_error if the file cannot be read, or is not in the
+ * SDPA sparse format.
+ */
+std::unique_ptr<MathematicalProgram> ParseSDPA(const std::string& file_name);
 }  // namespace solvers
 }  // namespace drake
@@ -16,6 +16,7 @@
 // NOLINTNEXTLINE(build/include)
 #include "snopt.h"
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
@@ -236,12 +237,16 @@ class SnoptUserFunInfo {
   // Pointers to the parameters ('prog' and 'nonlinear_cost_gradient_indices')
   // are retained internally, so the supplied objects must have lifetimes longer
   // than the SnoptUserFuncInfo object.
-  explicit SnoptUserFunInfo(const MathematicalProgram* prog)
+  SnoptUserFunInfo(const MathematicalProgram* prog, int num_threads)
       : this_pointer_as_int_array_(MakeThisAsInts()),
-        prog_(*prog) {}
+        prog_(*prog),
+        num_threads_(num_threads) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  // The number of threads used to evaluate the costs and constraints.
+  int num_threads() const { return num_threads_; }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -291,6 +296,7 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  const int num_threads_;
   std::set<int> nonlinear_cost_gradient_indices_;
 };
 
@@ -374,19 +380,42 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
  * @param xvec the value of the decision variables.
+ * @param num_threads The number of threads evaluating the bindings. Each
+ * binding writes to its own range of F and G, so the result doesn't depend on
+ * the number of threads.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
-  Eigen::VectorXd this_x;
-  for (const auto& binding : constraint_list) {
+    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec,
+    int num_threads) {
+  // The starting index of each binding in F and G.
+  const int num_bindings = static_cast<int>(constraint_list.size());
+  std::vector<size_t> constraint_starts(num_bindings);
+  std::vector<size_t> grad_starts(num_bindings);
+  for (int k = 0; k < num_bindings; ++k) {
+    const auto& binding = constraint_list[k];
+    constraint_starts[k] = *constraint_index;
+    grad_starts[k] = *grad_index;
+    const int num_constraints =
+        SingleNonlinearConstraintSize(*binding.evaluator());
+    *constraint_index += num_constraints;
+    const optional<std::vector<std::pair<int, int>>>&
+        gradient_sparsity_pattern =
+            binding.evaluator()->gradient_sparsity_pattern();
+    *grad_index += gradient_sparsity_pattern.has_value()
+                       ? gradient_sparsity_pattern->size()
+                       : num_constraints * binding.GetNumElements();
+  }
+
+  StaticParallelForIndexLoop(num_threads, 0, num_bindings, [&](int, int k) {
+    const auto& binding = constraint_list[k];
     const auto& c = binding.evaluator();
     int num_constraints = SingleNonlinearConstraintSize(*c);
 
     const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
+    Eigen::VectorXd this_x(num_variables);
     for (int i = 0; i < num_variables; ++i) {
       this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
     }
@@ -395,16 +424,18 @@ void EvaluateNonlinearConstraints(
     ty.resize(num_constraints);
     EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
 
+    size_t this_constraint_index = constraint_starts[k];
     for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
+      F[this_constraint_index++] = ty(i).value();
     }
 
+    size_t this_grad_index = grad_starts[k];
     const optional<std::vector<std::pair<int, int>>>&
         gradient_sparsity_pattern =
             binding.evaluator()->gradient_sparsity_pattern();
     if (gradient_sparsity_pattern.has_value()) {
       for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
+        G[this_grad_index++] =
             ty(nonzero_entry.first).derivatives().size() > 0
                 ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
                 : 0.0;
@@ -413,16 +444,16 @@ void EvaluateNonlinearConstraints(
       for (int i = 0; i < num_constraints; i++) {
         if (ty(i).derivatives().size() > 0) {
           for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
+            G[this_grad_index++] = ty(i).derivatives()(j);
           }
         } else {
           for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
+            G[this_grad_index++] = 0.0;
           }
         }
       }
     }
-  }
+  });
 }
 
 // Find the variables with non-zero gradient in @p costs, and add the indices of
@@ -459,33 +490,44 @@ std::set<int> GetAllNonlinearCostNonzeroGradientIndices(
 /*
  * Evaluates all the nonlinear costs, adds the value of the costs to
  * @p total_cost, and also adds the gradients to @p nonlinear_cost_gradients.
+ * The costs are evaluated with @p num_threads threads, and then summed up in
+ * the order of @p nonlinear_costs, so the result doesn't depend on the number
+ * of threads.
  */
 template <typename C>
 void EvaluateAndAddNonlinearCosts(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& nonlinear_costs, const Eigen::VectorXd& x,
-    double* total_cost, std::vector<double>* nonlinear_cost_gradients) {
-  for (const auto& binding : nonlinear_costs) {
-    const auto& obj = binding.evaluator();
+    int num_threads, double* total_cost,
+    std::vector<double>* nonlinear_cost_gradients) {
+  const int num_bindings = static_cast<int>(nonlinear_costs.size());
+  std::vector<AutoDiffXd> costs(num_bindings);
+  // binding_var_indices[k][i] is the index of the i'th variable of the k'th
+  // binding in prog's decision variables.
+  std::vector<std::vector<int>> binding_var_indices(num_bindings);
+  StaticParallelForIndexLoop(num_threads, 0, num_bindings, [&](int, int k) {
+    const auto& binding = nonlinear_costs[k];
     const int num_variables = binding.GetNumElements();
 
     Eigen::VectorXd this_x(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
+    binding_var_indices[k].resize(num_variables);
     for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
+      binding_var_indices[k][i] =
           prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = x(binding_var_indices[i]);
+      this_x(i) = x(binding_var_indices[k][i]);
     }
     AutoDiffVecXd ty(1);
-    obj->Eval(math::initializeAutoDiff(this_x), &ty);
+    binding.evaluator()->Eval(math::initializeAutoDiff(this_x), &ty);
+    costs[k] = ty(0);
+  });
 
-    *total_cost += ty(0).value();
-    if (ty(0).derivatives().size() > 0) {
-      for (int i = 0; i < num_variables; ++i) {
-        (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-            ty(0).derivatives()(i);
+  for (int k = 0; k < num_bindings; ++k) {
+    *total_cost += costs[k].value();
+    if (costs[k].derivatives().size() > 0) {
+      for (int i = 0; i < static_cast<int>(binding_var_indices[k].size());
+           ++i) {
+        (*nonlinear_cost_gradients)[binding_var_indices[k][i]] +=
+            costs[k].derivatives()(i);
       }
     }
   }
@@ -497,15 +539,15 @@ void EvaluateAndAddNonlinearCosts(
 // will store the nonzero gradient of the cost.
 void EvaluateAllNonlinearCosts(
     const MathematicalProgram& prog, const Eigen::VectorXd& xvec,
-    const std::set<int>& nonlinear_cost_gradient_indices, double F[],
-    double G[], size_t* grad_index) {
+    const std::set<int>& nonlinear_cost_gradient_indices, int num_threads,
+    double F[], double G[], size_t* grad_index) {
   std::vector<double> cost_gradients(prog.num_vars(), 0);
   // Quadratic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec,
+                               num_threads, &(F[0]), &cost_gradients);
   // Generic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, num_threads,
+                               &(F[0]), &cost_gradients);
 
   for (const int cost_gradient_index : nonlinear_cost_gradient_indices) {
     G[*grad_index] = cost_gradients[cost_gradient_index];
@@ -532,25 +574,25 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   current_problem.EvalVisualizationCallbacks(xvec);
 
   EvaluateAllNonlinearCosts(current_problem, xvec,
-                            info.nonlinear_cost_gradient_indices(), F, G,
-                            &grad_index);
+                            info.nonlinear_cost_gradient_indices(),
+                            info.num_threads(), F, G, &grad_index);
 
   // The constraint index starts at 1 because the cost is the
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+  EvaluateNonlinearConstraints(
+      current_problem, current_problem.generic_constraints(), F, G,
+      &constraint_index, &grad_index, xvec, info.num_threads());
+  EvaluateNonlinearConstraints(
+      current_problem, current_problem.lorentz_cone_constraints(), F, G,
+      &constraint_index, &grad_index, xvec, info.num_threads());
   EvaluateNonlinearConstraints(
       current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
+      &constraint_index, &grad_index, xvec, info.num_threads());
   EvaluateNonlinearConstraints(
       current_problem, current_problem.linear_complementarity_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      G, &constraint_index, &grad_index, xvec, info.num_threads());
 }
 
 /*
@@ -767,11 +809,11 @@ void SolveWithGivenOptions(
     const std::unordered_map<std::string, std::string>& snopt_options_string,
     const std::unordered_map<std::string, int>& snopt_options_int,
     const std::unordered_map<std::string, double>& snopt_options_double,
-    int* snopt_status, double* objective, EigenPtr<Eigen::VectorXd> x_val,
-    SnoptSolverDetails* solver_details) {
+    int num_threads, int* snopt_status, double* objective,
+    EigenPtr<Eigen::VectorXd> x_val, SnoptSolverDetails* solver_details) {
   DRAKE_ASSERT(x_val->rows() == prog.num_vars());
 
-  SnoptUserFunInfo user_info(&prog);
+  SnoptUserFunInfo user_info(&prog, num_threads);
   WorkspaceStorage storage(&user_info);
 
   std::string print_file_name;
@@ -1075,9 +1117,9 @@ void SnoptSolver::DoSolve(
   }
 
   SolveWithGivenOptions(prog, initial_guess, merged_options.GetOptionsStr(id()),
-                        int_options,
-                        merged_options.GetOptionsDouble(id()), &snopt_status,
-                        &objective, &x_val, &solver_details);
+                        int_options, merged_options.GetOptionsDouble(id()),
+                        num_threads_, &snopt_status, &objective, &x_val,
+                        &solver_details);
 
   // Populate our results structure.
   const SolutionResult solution_result =
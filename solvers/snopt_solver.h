@@ -3,6 +3,7 @@
 #include <string>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/solvers/solver_base.h"
 
 namespace drake {
@@ -62,9 +63,30 @@ class SnoptSolver final : public SolverBase  {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets the number of threads used to evaluate the nonlinear costs and
+  /// constraints in SNOPT's user function. The bindings are partitioned among
+  /// the threads, and the results are scattered into SNOPT's arrays in the
+  /// same order as the serial evaluation, so the solution doesn't depend on
+  /// the number of threads. This speeds up programs with many independent
+  /// bindings (e.g., direct collocation), but requires every cost and
+  /// constraint evaluator to be safe to evaluate concurrently.
+  ///
+  /// Defaults to 1, i.e. evaluating the bindings on SNOPT's thread.
+  /// @throws std::exception if `num_threads` is less than 1.
+  void set_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_threads_ = num_threads;
+  }
+
+  /// Returns the number of threads used to evaluate the nonlinear costs and
+  /// constraints. @see set_num_threads().
+  int num_threads() const { return num_threads_; }
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  int num_threads_{1};
 };
 
 }  // namespace solvers
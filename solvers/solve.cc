@@ -1,6 +1,13 @@
 #include "drake/solvers/solve.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 #include "drake/common/nice_type_name.h"
 #include "drake/solvers/choose_best_solver.h"
@@ -14,7 +21,107 @@ MathematicalProgramResult Solve(const MathematicalProgram& prog,
   const SolverId solver_id = ChooseBestSolver(prog);
   std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
   MathematicalProgramResult result{};
+  const auto start_time = std::chrono::steady_clock::now();
   solver->Solve(prog, initial_guess, solver_options, &result);
+  result.set_solver_time(
+      solver_id, std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - start_time)
+                     .count());
+  return result;
+}
+
+MathematicalProgramResult SolveInParallel(
+    const MathematicalProgram& prog, const std::vector<SolverId>& solver_ids,
+    const optional<Eigen::VectorXd>& initial_guess,
+    const optional<SolverOptions>& solver_options, int num_threads) {
+  if (num_threads < 1) {
+    throw std::invalid_argument(
+        "SolveInParallel(): num_threads should be at least 1.");
+  }
+  // The solvers in the portfolio which can solve prog.
+  std::vector<std::unique_ptr<SolverInterface>> solvers;
+  for (const auto& solver_id : solver_ids) {
+    std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
+    if (solver->available() && solver->AreProgramAttributesSatisfied(prog)) {
+      solvers.push_back(std::move(solver));
+    }
+  }
+  if (solvers.empty()) {
+    throw std::invalid_argument(
+        "SolveInParallel(): none of the solvers can solve the program.");
+  }
+  const int num_solvers = static_cast<int>(solvers.size());
+  // Each solver works on its own clone of prog.
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  progs.reserve(num_solvers);
+  for (int i = 0; i < num_solvers; ++i) {
+    progs.push_back(prog.Clone());
+  }
+
+  std::vector<MathematicalProgramResult> results(num_solvers);
+  std::vector<double> solver_times(num_solvers, -1);
+  std::vector<std::exception_ptr> exceptions(num_solvers);
+  // The index of the first solver to succeed, or -1 if none has succeeded
+  // yet. Guarded by `mutex`.
+  int first_success = -1;
+  std::mutex mutex;
+  // The index of the next solver to start.
+  std::atomic<int> next_solver{0};
+  std::atomic<bool> cancelled{false};
+  auto run_solvers = [&]() {
+    for (int i = next_solver++; i < num_solvers && !cancelled;
+         i = next_solver++) {
+      const auto start_time = std::chrono::steady_clock::now();
+      try {
+        solvers[i]->Solve(*progs[i], initial_guess, solver_options,
+                          &results[i]);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+      solver_times[i] = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start_time)
+                            .count();
+      if (!exceptions[i] && results[i].is_success()) {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (first_success < 0) {
+          first_success = i;
+        }
+        cancelled = true;
+      }
+    }
+  };
+  const int num_workers = std::min(num_threads, num_solvers);
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (int i = 0; i < num_workers - 1; ++i) {
+    workers.emplace_back(run_solvers);
+  }
+  run_solvers();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  int returned_solver = first_success;
+  if (returned_solver < 0) {
+    for (int i = 0; i < num_solvers && returned_solver < 0; ++i) {
+      if (solver_times[i] >= 0 && !exceptions[i]) {
+        returned_solver = i;
+      }
+    }
+    if (returned_solver < 0) {
+      std::rethrow_exception(exceptions[0]);
+    }
+  }
+  MathematicalProgramResult result = std::move(results[returned_solver]);
+  for (int i = 0; i < num_solvers; ++i) {
+    if (solver_times[i] >= 0) {
+      result.set_solver_time(solvers[i]->solver_id(), solver_times[i]);
+      if (i != returned_solver && !exceptions[i] && results[i].is_success()) {
+        result.AddSuboptimalSolution(results[i].get_optimal_cost(),
+                                     results[i].get_x_val());
+      }
+    }
+  }
   return result;
 }
 
@@ -33,6 +33,41 @@ MathematicalProgramResult Solve(
 
 MathematicalProgramResult Solve(const MathematicalProgram& prog);
 
+/**
+ * Solves an optimization program with a portfolio of solvers in parallel. For
+ * hard nonconvex programs the fastest solver often varies by instance, so
+ * several solvers are run on their own clone of @p prog, and the result of the
+ * first solver to succeed is returned.
+ *
+ * The solvers are started in the order of @p solver_ids, with at most
+ * @p num_threads of them running at any time. The solvers are cancelled
+ * cooperatively: once a solver succeeds, the solvers that haven't started are
+ * skipped. Since a SolverInterface can't be interrupted in the middle of
+ * Solve(), the solvers which are already running finish before this function
+ * returns; their successful solutions are added to the solution pool of the
+ * returned result (see @ref solution_pools "solution pools").
+ *
+ * @param prog Contains the formulation of the program, and possibly solver
+ * options.
+ * @param solver_ids The solvers in the portfolio. The solvers which are not
+ * available, or can't solve @p prog, are ignored.
+ * @param initial_guess The initial guess for the decision variables.
+ * @param solver_options The options in addition to those stored in @p prog.
+ * @param num_threads The maximum number of solvers running at the same time.
+ * @return The result of the first solver to succeed. If no solver succeeds,
+ * the result of the first solver in @p solver_ids that was run. In either
+ * case, MathematicalProgramResult::get_solver_times() contains the wall clock
+ * time of every solver that was run.
+ * @throws std::invalid_argument if no solver in @p solver_ids can solve
+ * @p prog, or if @p num_threads is less than one.
+ * @throws std::exception thrown by a solver, if every solver that was run
+ * threw.
+ */
+MathematicalProgramResult SolveInParallel(
+    const MathematicalProgram& prog, const std::vector<SolverId>& solver_ids,
+    const optional<Eigen::VectorXd>& initial_guess,
+    const optional<SolverOptions>& solver_options, int num_threads);
+
 /** Some solvers (e.g. SNOPT) provide a "best-effort solution" even when they
  * determine that a problem is infeasible.  This method will return the
  * descriptions corresponding to the constraints for which `CheckSatisfied`
@@ -7,6 +7,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/trace_span.h"
 
 namespace drake {
 namespace solvers {
@@ -34,6 +35,7 @@ void SolverBase::Solve(const MathematicalProgram& prog,
                        const optional<Eigen::VectorXd>& initial_guess,
                        const optional<SolverOptions>& solver_options,
                        MathematicalProgramResult* result) const {
+  DRAKE_TRACE_SPAN("SolverBase::Solve");
   *result = {};
   if (!available()) {
     throw std::invalid_argument(fmt::format(
@@ -1,9 +1,13 @@
 #include "drake/solvers/sos_basis_generator.h"
 
+#include <unordered_set>
 #include <vector>
 
 #include <Eigen/Core>
 
+#include "drake/common/drake_throw.h"
+#include "drake/common/hash.h"
+#include "drake/common/parallel_for.h"
 #include "drake/solvers/integer_inequality_solver.h"
 namespace drake {
 namespace solvers {
@@ -71,29 +75,37 @@ ExponentList PairwiseSums(const ExponentList& exponents) {
   return sums;
 }
 
-// Returns true if the first num_rows of A contains B.
-bool ContainsExponent(const ExponentList& A, int num_rows, const Exponent& B) {
-  DRAKE_ASSERT(B.rows() == 1 && B.cols() == A.cols());
-  DRAKE_ASSERT((num_rows >= 0) && (num_rows <= A.rows()));
-  for (int i = 0; i < num_rows; i++) {
-    if (A.row(i) == B) {
-      return true;
+// Hashes an exponent, for the sets of exponents.
+struct ExponentHash {
+  size_t operator()(const Exponent& exponent) const noexcept {
+    DefaultHasher hasher;
+    for (int i = 0; i < exponent.size(); ++i) {
+      hash_append(hasher, exponent(i));
     }
+    return static_cast<size_t>(hasher);
   }
-  return false;
-}
+};
+
+using ExponentSet = std::unordered_set<Exponent, ExponentHash>;
 
 /* Intersection(A, B) removes duplicate rows from B and any row that doesn't also
  * appear in A.  For example, given A = [1, 0; 0, 1; 1, 1] and B = [1, 0; 1, 1;
- * 1, 1;], it overwrites B with [1, 0; 1, 1]. */
+ * 1, 1;], it overwrites B with [1, 0; 1, 1]. This takes time linear in the
+ * numbers of rows of A and B. */
 
 void Intersection(const ExponentList& A, ExponentList* B) {
   DRAKE_ASSERT(A.cols() == B->cols());
+  ExponentSet rows_of_A;
+  rows_of_A.reserve(A.rows());
+  for (int i = 0; i < A.rows(); i++) {
+    rows_of_A.insert(A.row(i));
+  }
+  ExponentSet kept_rows;
   int index = 0;
   for (int i = 0; i < B->rows(); i++) {
-    if ((ContainsExponent(A, A.rows(), B->row(i))) &&
-        !(ContainsExponent(*B, index, B->row(i)))) {
-      B->row(index++) = B->row(i);
+    const Exponent row = B->row(i);
+    if (rows_of_A.count(row) > 0 && kept_rows.insert(row).second) {
+      B->row(index++) = row;
     }
   }
   B->conservativeResize(index, Eigen::NoChange);
@@ -204,12 +216,16 @@ ExponentList EnumerateInitialSet(const ExponentList& exponents_of_p) {
 //  This function removes an element alpha from "basis" if a randomly generated
 //  hyperplane separates 2*alpha from the Newton polytope of the polynomial p.
 //  Note that this function is actually deterministic since the seed for
-//  the random number generator is set to predetermined constants.
+//  the random number generator is set to predetermined constants. The
+//  elements of the basis are checked with up to num_threads threads, and the
+//  result doesn't depend on num_threads.
 void RemoveWithRandomSeparatingHyperplanes(const ExponentList& exponents_of_p,
+                                           int num_threads,
                                            ExponentList* basis) {
   // Declare this outside the main loop to avoid repeated dynamic memory
-  // allocation.
-  Eigen::MatrixXi dot_products;
+  // allocation. The flags are char rather than bool, since the elements of
+  // std::vector<bool> can't be written concurrently.
+  std::vector<char> keep_monomial;
   int random_seed = 0;
 
   while (1) {
@@ -220,18 +236,20 @@ void RemoveWithRandomSeparatingHyperplanes(const ExponentList& exponents_of_p,
 
     // Remove monomials that the hyperplanes separate from the
     // Newton polytope.
-    dot_products = (*basis) * H.normal_vectors.transpose();
+    keep_monomial.assign(current_basis_size, 1);
+    StaticParallelForIndexLoop(
+        num_threads, 0, current_basis_size, [&](int, int i) {
+          for (int j = 0; j < H.normal_vectors.rows(); j++) {
+            const int dot_product = basis->row(i).dot(H.normal_vectors.row(j));
+            if (dot_product > H.max_dot_product(j) ||
+                dot_product < H.min_dot_product(j)) {
+              keep_monomial[i] = 0;
+              break;
+            }
+          }
+        });
     for (int i = 0; i < current_basis_size; i++) {
-      bool keep_monomial = true;
-      for (int j = 0; j < dot_products.cols(); j++) {
-        if (dot_products(i, j) > H.max_dot_product(j) ||
-            dot_products(i, j) < H.min_dot_product(j)) {
-          keep_monomial = false;
-          break;
-        }
-      }
-
-      if (keep_monomial) {
+      if (keep_monomial[i]) {
         basis->row(next_basis_size++) = basis->row(i);
       }
     }
@@ -250,16 +268,20 @@ void RemoveWithRandomSeparatingHyperplanes(const ExponentList& exponents_of_p,
   return;
 }
 
-ExponentList ConstructMonomialBasis(const ExponentList& exponents_of_p) {
+ExponentList ConstructMonomialBasis(const ExponentList& exponents_of_p,
+                                    int num_threads) {
   auto basis_exponents = EnumerateInitialSet(exponents_of_p);
-  RemoveWithRandomSeparatingHyperplanes(exponents_of_p, &basis_exponents);
+  RemoveWithRandomSeparatingHyperplanes(exponents_of_p, num_threads,
+                                        &basis_exponents);
   RemoveDiagonallyInconsistentExponents(exponents_of_p, &basis_exponents);
   return basis_exponents;
 }
 
 }  // namespace
 
-MonomialVector ConstructMonomialBasis(const drake::symbolic::Polynomial& p) {
+MonomialVector ConstructMonomialBasis(const drake::symbolic::Polynomial& p,
+                                      int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
   const Variables indeterminates{p.indeterminates()};
   drake::VectorX<Variable> vars(indeterminates.size());
   int cnt = 0;
@@ -268,7 +290,8 @@ MonomialVector ConstructMonomialBasis(const drake::symbolic::Polynomial& p) {
   }
 
   auto polynomial_exponents = GetPolynomialExponents(p);
-  auto basis_exponents = ConstructMonomialBasis(polynomial_exponents);
+  auto basis_exponents =
+      ConstructMonomialBasis(polynomial_exponents, num_threads);
   auto monomial_basis = ExponentsToMonomials(basis_exponents, vars);
   return monomial_basis;
 }
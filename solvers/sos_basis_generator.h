@@ -17,9 +17,13 @@ namespace solvers {
   * e.g., Chapter 3 of Semidefinite Optimization and Convex Algebraic Geometry
   * by G. Blekherman, P. Parrilo, R. Thomas.
   * @param p A polynomial
+  * @param num_threads The maximum number of threads used to prune the
+  * candidate monomials with the separating hyperplanes of the Newton polytope
+  * of p. The result doesn't depend on num_threads.
   * @return A vector whose entries are the elements of M
+  * @throws std::exception if num_threads is less than one.
 */
 drake::VectorX<symbolic::Monomial> ConstructMonomialBasis(
-    const drake::symbolic::Polynomial& p);
+    const drake::symbolic::Polynomial& p, int num_threads = 1);
 }  // namespace solvers
 }  // namespace drake
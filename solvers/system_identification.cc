@@ -6,6 +6,7 @@
 #include <list>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 
@@ -473,6 +474,170 @@ SystemIdentification<T>::ClassifyVars(
   return std::make_tuple(all_vars, parameter_vars, active_vars);
 }
 
+StreamingLumpedParameterEstimator::StreamingLumpedParameterEstimator(
+    const VectorXTrigPoly& polys, const std::vector<VarType>& active_vars,
+    double forgetting_factor)
+    : active_vars_(active_vars), forgetting_factor_(forgetting_factor) {
+  DRAKE_THROW_UNLESS(forgetting_factor > 0 && forgetting_factor <= 1);
+  const int num_active = active_vars.size();
+
+  // The indices of the values of the active variables, and of their sines and
+  // cosines, in the vector of values of AddSamples().
+  std::map<VarType, int> value_indices;
+  for (int i = 0; i < num_active; ++i) {
+    DRAKE_THROW_UNLESS(value_indices.emplace(active_vars[i], i).second);
+  }
+  for (int i = 0; i < polys.rows(); ++i) {
+    for (const auto& k_v_pair : polys[i].sin_cos_map()) {
+      const auto active = value_indices.find(k_v_pair.first);
+      if (active == value_indices.end() || active->second >= num_active ||
+          value_indices.count(k_v_pair.second.s)) {
+        continue;
+      }
+      const int index = num_active + 2 * sin_cos_vars_.size();
+      sin_cos_vars_.push_back(active->second);
+      value_indices[k_v_pair.second.s] = index;
+      value_indices[k_v_pair.second.c] = index + 1;
+    }
+  }
+
+  // Every other variable is a parameter.
+  std::set<VarType> parameters;
+  for (int i = 0; i < polys.rows(); ++i) {
+    for (const VarType& var : polys[i].poly().GetVariables()) {
+      if (!value_indices.count(var)) {
+        parameters.insert(var);
+      }
+    }
+  }
+  if (parameters.empty()) {
+    throw std::runtime_error(
+        "StreamingLumpedParameterEstimator: There are no parameters.");
+  }
+  parameter_vars_.assign(parameters.begin(), parameters.end());
+  std::map<VarType, int> parameter_indices;
+  for (int j = 0; j < static_cast<int>(parameter_vars_.size()); ++j) {
+    parameter_indices[parameter_vars_[j]] = j;
+  }
+
+  monomials_.resize(polys.rows());
+  for (int i = 0; i < polys.rows(); ++i) {
+    for (const auto& monomial : polys[i].poly().GetMonomials()) {
+      CompiledMonomial compiled;
+      compiled.coefficient = monomial.coefficient;
+      for (const auto& term : monomial.terms) {
+        const auto parameter = parameter_indices.find(term.var);
+        if (parameter == parameter_indices.end()) {
+          compiled.factors.emplace_back(value_indices.at(term.var),
+                                        term.power);
+        } else if (compiled.parameter == -1 && term.power == 1) {
+          compiled.parameter = parameter->second;
+        } else {
+          throw std::runtime_error(
+              "StreamingLumpedParameterEstimator: The polynomials must be "
+              "linear in the parameters.");
+        }
+      }
+      monomials_[i].push_back(compiled);
+    }
+  }
+  Reset();
+}
+
+void StreamingLumpedParameterEstimator::AddSamples(
+    const Eigen::Ref<const Eigen::MatrixXd>& active_var_values) {
+  const int num_active = active_vars_.size();
+  DRAKE_THROW_UNLESS(active_var_values.rows() == num_active);
+  const int num_new = active_var_values.cols();
+  if (num_new == 0) return;
+  const int num_params = parameter_vars_.size();
+  const int num_polys = monomials_.size();
+  const double lambda = forgetting_factor_;
+
+  // Stacks the rows [φᵢᵀ bᵢ] of the new samples, weighted by the square root
+  // of their forgetting factors, below the (likewise discounted) factor R.
+  Eigen::MatrixXd stacked =
+      Eigen::MatrixXd::Zero(num_params + 1 + num_new * num_polys,
+                            num_params + 1);
+  stacked.topRows(num_params + 1) = std::pow(lambda, 0.5 * num_new) * R_;
+  Eigen::VectorXd values(num_active + 2 * sin_cos_vars_.size());
+  double new_weight = 0;
+  for (int k = 0; k < num_new; ++k) {
+    values.head(num_active) = active_var_values.col(k);
+    for (int j = 0; j < static_cast<int>(sin_cos_vars_.size()); ++j) {
+      const double x = values(sin_cos_vars_[j]);
+      values(num_active + 2 * j) = std::sin(x);
+      values(num_active + 2 * j + 1) = std::cos(x);
+    }
+    const double weight = std::pow(lambda, num_new - 1 - k);
+    new_weight += num_polys * weight;
+    for (int i = 0; i < num_polys; ++i) {
+      auto row = stacked.row(num_params + 1 + k * num_polys + i);
+      for (const CompiledMonomial& monomial : monomials_[i]) {
+        double term = monomial.coefficient;
+        for (const auto& factor : monomial.factors) {
+          term *= pow(values(factor.first), factor.second);
+        }
+        if (monomial.parameter >= 0) {
+          row(monomial.parameter) += term;
+        } else {
+          row(num_params) -= term;
+        }
+      }
+      row *= std::sqrt(weight);
+    }
+  }
+
+  const Eigen::HouseholderQR<Eigen::MatrixXd> qr(stacked);
+  R_ = qr.matrixQR().topRows(num_params + 1).triangularView<Eigen::Upper>();
+  weight_ = std::pow(lambda, num_new) * weight_ + new_weight;
+  num_samples_ += num_new;
+}
+
+bool StreamingLumpedParameterEstimator::is_identifiable() const {
+  // Without pivoting, the diagonal elements of R are the distances of each
+  // column of Φ to the span of the previous ones.
+  const int num_params = parameter_vars_.size();
+  const Eigen::VectorXd diagonal =
+      R_.diagonal().head(num_params).cwiseAbs();
+  return diagonal.minCoeff() > 1e-10 * diagonal.maxCoeff();
+}
+
+Eigen::VectorXd StreamingLumpedParameterEstimator::GetEstimates() const {
+  if (!is_identifiable()) {
+    throw std::runtime_error(
+        "StreamingLumpedParameterEstimator::GetEstimates(): The samples do not "
+        "determine the parameters.");
+  }
+  const int num_params = parameter_vars_.size();
+  return R_.topLeftCorner(num_params, num_params)
+      .triangularView<Eigen::Upper>()
+      .solve(R_.col(num_params).head(num_params));
+}
+
+StreamingLumpedParameterEstimator::PartialEvalType
+StreamingLumpedParameterEstimator::GetEstimatesMap() const {
+  const Eigen::VectorXd estimates = GetEstimates();
+  PartialEvalType result;
+  for (int j = 0; j < estimates.size(); ++j) {
+    result[parameter_vars_[j]] = estimates(j);
+  }
+  return result;
+}
+
+double StreamingLumpedParameterEstimator::rms_error() const {
+  if (weight_ == 0) return 0;
+  const int num_params = parameter_vars_.size();
+  return std::abs(R_(num_params, num_params)) / std::sqrt(weight_);
+}
+
+void StreamingLumpedParameterEstimator::Reset() {
+  const int num_params = parameter_vars_.size();
+  R_ = Eigen::MatrixXd::Zero(num_params + 1, num_params + 1);
+  weight_ = 0;
+  num_samples_ = 0;
+}
+
 }  // namespace solvers
 }  // namespace drake
 
@@ -8,6 +8,8 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/Core>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/trig_poly.h"
@@ -220,5 +222,115 @@ class SystemIdentification {
                         const std::vector<Polynomiald>& polys,
                         const std::vector<PartialEvalType>& active_var_values);
 };
+
+/// Estimates lumped parameters online, from a stream of samples.
+/**
+ * Whereas SystemIdentification::EstimateParameters() builds and solves a
+ * MathematicalProgram over all of the samples at once, this class keeps the
+ * least-squares estimate up to date as batches of samples arrive, at a cost
+ * per sample that does not depend on the number of samples so far, and
+ * without any symbolic computations once it is constructed.
+ *
+ * The polynomials, typically the SystemIdentificationResult::lumped_polys of
+ * a first (offline) identification, must be linear in their parameters,
+ * i.e., in their variables that are not active: each sample of the active
+ * variables then gives one linear equation in the parameters per polynomial,
+ * P[i](θ, x) = φᵢ(x)ᵀθ - bᵢ(x) = 0. The polynomials are compiled, in the
+ * constructor, into the monomials of the active variables (and of their sines
+ * and cosines, per the TrigPoly sin/cos maps) that form φᵢ and bᵢ.
+ *
+ * The estimate minimizes the sum of the squared residuals of these equations,
+ * in which the residuals of each sample are weighted by λᵏ, where λ is the
+ * forgetting factor and k the number of samples that were added after it.
+ * Rather than the covariance matrix of the recursive least-squares filter,
+ * this class updates the triangular factor R of the weighted regression
+ * matrix, by a QR decomposition of R stacked over the rows of each new batch,
+ * which is numerically more robust.
+ */
+class StreamingLumpedParameterEstimator {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(StreamingLumpedParameterEstimator)
+
+  typedef SystemIdentification<double>::VarType VarType;
+  typedef SystemIdentification<double>::PartialEvalType PartialEvalType;
+
+  /** Compiles @p polys, whose variables that are not in @p active_vars (nor
+   * the sines and cosines of active variables) are the parameters to
+   * estimate, and @p forgetting_factor, in (0, 1], is λ (see above).
+   *
+   * @throws std::runtime_error if a polynomial is not linear in the
+   * parameters, or if there are no parameters.
+   */
+  StreamingLumpedParameterEstimator(const VectorXTrigPoly& polys,
+                                    const std::vector<VarType>& active_vars,
+                                    double forgetting_factor = 1.0);
+
+  /// Returns the parameters, in the order of GetEstimates().
+  const std::vector<VarType>& parameter_vars() const {
+    return parameter_vars_;
+  }
+
+  /// Returns the active variables, in the order of the rows of the samples.
+  const std::vector<VarType>& active_vars() const { return active_vars_; }
+
+  /// Returns the number of samples that were added since construction or the
+  /// last Reset().
+  int num_samples() const { return num_samples_; }
+
+  /** Adds the samples that are the columns of @p active_var_values, whose
+   * rows are the values of active_vars() (e.g., of the state, input and
+   * output variables), in the order in which they were measured.
+   */
+  void AddSamples(const Eigen::Ref<const Eigen::MatrixXd>& active_var_values);
+
+  /// Returns true iff the samples so far determine the parameters uniquely.
+  bool is_identifiable() const;
+
+  /** Returns the current estimates of the parameters, in the order of
+   * parameter_vars().
+   *
+   * @throws std::runtime_error if !is_identifiable().
+   */
+  Eigen::VectorXd GetEstimates() const;
+
+  /// Same as GetEstimates(), but as a map suitable for
+  /// Polynomial::EvaluatePartial.
+  PartialEvalType GetEstimatesMap() const;
+
+  /// Returns the weighted root-mean-square residual of the current estimates
+  /// over the samples so far.
+  double rms_error() const;
+
+  /// Forgets all of the samples.
+  void Reset();
+
+ private:
+  // The monomial coefficient * Π values[factors[i].first]^factors[i].second,
+  // of the values of the active variables and of their sines and cosines, in
+  // the equation of the parameter of index `parameter` (or in its constant
+  // term, when `parameter` is -1).
+  struct CompiledMonomial {
+    double coefficient{};
+    std::vector<std::pair<int, int>> factors;
+    int parameter{-1};
+  };
+
+  std::vector<VarType> active_vars_;
+  std::vector<VarType> parameter_vars_;
+  // The active variables (by index) of which the sines and cosines are
+  // variables of the polynomials, whose values follow those of the active
+  // variables (sine, then cosine).
+  std::vector<int> sin_cos_vars_;
+  // The monomials of each polynomial.
+  std::vector<std::vector<CompiledMonomial>> monomials_;
+  double forgetting_factor_{};
+  int num_samples_{};
+  // The upper triangular factor of the weighted [Φ b], with the residual of
+  // the estimate in its bottom-right element.
+  Eigen::MatrixXd R_;
+  // The weighted number of residuals.
+  double weight_{};
+};
+
 }  // namespace solvers
 }  // namespace drake
@@ -27,6 +27,11 @@ class MixedIntegerBranchAndBoundTester {
     return bnb_->PickBranchingNode();
   }
 
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const {
+    return bnb_->PickBranchingNodes(max_num_nodes);
+  }
+
   const symbolic::Variable* PickBranchingVariable(
       const MixedIntegerBranchAndBoundNode& node) const {
     return bnb_->PickBranchingVariable(node);
@@ -335,6 +340,30 @@ GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch1) {
   EXPECT_THROW(root->Branch(x(3)), std::runtime_error);
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranchWarmStart) {
+  // The programs of the child nodes are warm-started from the solution of the
+  // parent node, with the branching variable set to its fixed value.
+  auto prog = ConstructMathematicalProgram2();
+
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> root;
+  std::tie(root, std::ignore) =
+      MixedIntegerBranchAndBoundNode::ConstructRootNode(*prog,
+                                                        GurobiSolver::id());
+  VectorDecisionVariable<5> x = root->prog()->decision_variables();
+  ASSERT_EQ(root->solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(root->prog()->GetInitialGuess(x).array().isNaN().all());
+
+  root->Branch(x(2));
+  Eigen::Matrix<double, 5, 1> guess_l = root->prog_result()->GetSolution(x);
+  Eigen::Matrix<double, 5, 1> guess_r = guess_l;
+  guess_l(2) = 0;
+  guess_r(2) = 1;
+  EXPECT_TRUE(CompareMatrices(root->left_child()->prog()->GetInitialGuess(x),
+                              guess_l));
+  EXPECT_TRUE(CompareMatrices(root->right_child()->prog()->GetInitialGuess(x),
+                              guess_r));
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch2) {
   // Test branching on the root node for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -680,6 +709,41 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingNode2) {
   EXPECT_EQ(dut.PickBranchingNode(), dut.bnb()->root()->right_child());
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingNodes) {
+  // Test choosing several nodes at once.
+  auto prog = ConstructMathematicalProgram2();
+
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id());
+  VectorDecisionVariable<5> x = dut.bnb()->root()->prog()->decision_variables();
+
+  using Nodes = std::vector<MixedIntegerBranchAndBoundNode*>;
+  // There is only one root node.
+  EXPECT_EQ(dut.PickBranchingNodes(4), Nodes({dut.mutable_root()}));
+
+  // The left node has optimal cost -4.9, the right node has optimal cost -47.0
+  // / 30. Neither of them is fathomed.
+  dut.mutable_root()->Branch(x(4));
+  auto* left = dut.mutable_root()->mutable_left_child();
+  auto* right = dut.mutable_root()->mutable_right_child();
+  dut.bnb()->SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kMinLowerBound);
+  EXPECT_EQ(dut.PickBranchingNodes(1), Nodes({left}));
+  EXPECT_EQ(dut.PickBranchingNodes(2), Nodes({left, right}));
+  EXPECT_EQ(dut.PickBranchingNodes(3), Nodes({left, right}));
+
+  // The right node is deeper after branching on it.
+  right->Branch(x(0));
+  dut.bnb()->SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kDepthFirst);
+  Nodes nodes = dut.PickBranchingNodes(3);
+  ASSERT_FALSE(nodes.empty());
+  EXPECT_EQ(nodes.back(), left);
+  for (const auto* node : nodes) {
+    EXPECT_TRUE(node->IsLeaf());
+    EXPECT_FALSE(dut.bnb()->IsLeafNodeFathomed(*node));
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingVariable1) {
   // Test picking branching variable for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -983,6 +1047,43 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+      EXPECT_EQ(bnb.max_num_threads(), 1);
+      bnb.set_max_num_threads(4);
+      EXPECT_EQ(bnb.max_num_threads(), 4);
+      bnb.SetNodeSelectionMethod(pick_node);
+      bnb.SetVariableSelectionMethod(pick_variable);
+      int num_visited_nodes = 1;
+      bnb.SetUserDefinedNodeCallbackFunction(
+          [&num_visited_nodes](const MixedIntegerBranchAndBoundNode&,
+                               MixedIntegerBranchAndBound*) {
+            ++num_visited_nodes;
+          });
+
+      const SolutionResult solution_result = bnb.Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                  MatrixCompareType::absolute));
+      // The callback is called on every child node.
+      EXPECT_GT(num_visited_nodes, 1);
+      EXPECT_EQ(num_visited_nodes % 2, 1);
+    }
+  }
+
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_THROW(bnb.set_max_num_threads(0), std::logic_error);
+}
+
 void CheckAllIntegralSolution(
     const MixedIntegerBranchAndBound& bnb,
     const Eigen::Ref<const VectorXDecisionVariable>& x,
@@ -5,6 +5,7 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/solvers/csdp_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/fbstab_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/linear_system_solver.h"
@@ -171,6 +172,7 @@ TEST_F(ChooseBestSolverTest, MakeSolver) {
   CheckMakeSolver(*ipopt_solver_);
   CheckMakeSolver(*nlopt_solver_);
   CheckMakeSolver(*scs_solver_);
+  CheckMakeSolver(FbstabSolver());
   DRAKE_EXPECT_THROWS_MESSAGE(MakeSolver(SolverId("foo")),
                               std::invalid_argument,
                               "MakeSolver: no matching solver foo");
@@ -0,0 +1,74 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+using Cliques = std::vector<std::vector<int>>;
+
+// Checks that each edge belongs to a clique.
+void CheckEdgesCovered(const std::vector<std::pair<int, int>>& edges,
+                       const Cliques& cliques) {
+  for (const auto& edge : edges) {
+    EXPECT_TRUE(std::any_of(
+        cliques.begin(), cliques.end(), [&edge](const std::vector<int>& c) {
+          return std::binary_search(c.begin(), c.end(), edge.first) &&
+                 std::binary_search(c.begin(), c.end(), edge.second);
+        }));
+  }
+}
+
+GTEST_TEST(ChordalDecompositionTest, Path) {
+  // The path 0 - 1 - 2 - 3 is chordal, its maximal cliques are its edges.
+  const std::vector<std::pair<int, int>> edges{{0, 1}, {1, 2}, {2, 3}};
+  Cliques cliques = ChordalExtensionMaximalCliques(4, edges);
+  std::sort(cliques.begin(), cliques.end());
+  EXPECT_EQ(cliques, Cliques({{0, 1}, {1, 2}, {2, 3}}));
+}
+
+GTEST_TEST(ChordalDecompositionTest, IsolatedNodes) {
+  // The isolated nodes form cliques of size one, and the repeated edges and
+  // self loops are ignored.
+  const std::vector<std::pair<int, int>> edges{{0, 2}, {2, 0}, {1, 1}};
+  Cliques cliques = ChordalExtensionMaximalCliques(4, edges);
+  std::sort(cliques.begin(), cliques.end());
+  EXPECT_EQ(cliques, Cliques({{0, 2}, {1}, {3}}));
+}
+
+GTEST_TEST(ChordalDecompositionTest, Cycle) {
+  // The cycle 0 - 1 - 2 - 3 - 4 - 0 isn't chordal. Its chordal extension has
+  // two fill-in edges, hence three triangles.
+  const std::vector<std::pair<int, int>> edges{
+      {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}};
+  const Cliques cliques = ChordalExtensionMaximalCliques(5, edges);
+  EXPECT_EQ(cliques.size(), 3u);
+  for (const auto& clique : cliques) {
+    EXPECT_EQ(clique.size(), 3u);
+    EXPECT_TRUE(std::is_sorted(clique.begin(), clique.end()));
+  }
+  CheckEdgesCovered(edges, cliques);
+}
+
+GTEST_TEST(ChordalDecompositionTest, Complete) {
+  std::vector<std::pair<int, int>> edges;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = i + 1; j < 4; ++j) {
+      edges.emplace_back(i, j);
+    }
+  }
+  EXPECT_EQ(ChordalExtensionMaximalCliques(4, edges), Cliques({{0, 1, 2, 3}}));
+}
+
+GTEST_TEST(ChordalDecompositionTest, InvalidEdge) {
+  EXPECT_THROW(ChordalExtensionMaximalCliques(2, {{0, 2}}),
+               std::runtime_error);
+}
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
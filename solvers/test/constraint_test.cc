@@ -48,6 +48,9 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), b));
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), b));
   EXPECT_TRUE(CompareMatrices(constraint.A(), A));
+  // The sparse matrix only stores the nonzero entries.
+  EXPECT_EQ(constraint.GetSparseMatrix().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(constraint.GetSparseMatrix()), A));
   EXPECT_EQ(constraint.num_constraints(), 2);
 
   // Test Eval/CheckSatisfied using Expression.
@@ -74,8 +77,63 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), b3));
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), b3));
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
+  EXPECT_EQ(constraint.GetSparseMatrix().nonZeros(), 6);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(constraint.GetSparseMatrix()), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+
+GTEST_TEST(testConstraint, testLinearConstraintSparse) {
+  // A sparse A is stored without its explicit zeros.
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.insert(0, 0) = 1;
+  A.insert(0, 2) = 0;
+  A.insert(1, 1) = -2;
+  const Eigen::Vector2d lb(-1, -2);
+  const Eigen::Vector2d ub(1, 2);
+  LinearConstraint constraint(A, lb, ub);
+  EXPECT_EQ(constraint.num_constraints(), 2);
+  EXPECT_EQ(constraint.num_vars(), 3);
+  EXPECT_EQ(constraint.GetSparseMatrix().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), lb));
+  EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), ub));
+
+  LinearEqualityConstraint equality_constraint(A, lb);
+  EXPECT_EQ(equality_constraint.GetSparseMatrix().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(equality_constraint.A(), MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(equality_constraint.upper_bound(), lb));
+}
+
+GTEST_TEST(testConstraint, testHessianOfLagrangian) {
+  // The Hessian of a linear constraint (and of the derived ones) is zero,
+  // with no non-zero entries.
+  Eigen::Matrix<double, 2, 3> A;
+  // clang-format off
+  A << 1, 2, 3,
+       4, 5, 6;
+  // clang-format on
+  LinearEqualityConstraint linear_constraint(A, Eigen::Vector2d(1, 2));
+  EXPECT_TRUE(linear_constraint.has_analytic_hessian());
+  EXPECT_TRUE(linear_constraint.hessian_sparsity_pattern()->empty());
+  MatrixXd hessian;
+  linear_constraint.EvalHessianOfLagrangian(
+      Eigen::Vector3d(1, 2, 3), Eigen::Vector2d(-1, 2), &hessian);
+  EXPECT_TRUE(CompareMatrices(hessian, Eigen::Matrix3d::Zero()));
+
+  // The Hessian of a quadratic constraint is its scaled (symmetrized) Q.
+  Eigen::Matrix2d Q;
+  // clang-format off
+  Q << 2, 1,
+       0, 0;
+  // clang-format on
+  QuadraticConstraint quadratic_constraint(Q, Eigen::Vector2d(1, 2), 0, 1);
+  EXPECT_TRUE(quadratic_constraint.has_analytic_hessian());
+  EXPECT_EQ(quadratic_constraint.hessian_sparsity_pattern()->size(), 2);
+  quadratic_constraint.EvalHessianOfLagrangian(Eigen::Vector2d(1, 2),
+                                               Vector1d(-3), &hessian);
+  EXPECT_TRUE(CompareMatrices(hessian, -1.5 * (Q + Q.transpose())));
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
@@ -127,6 +127,15 @@ GTEST_TEST(testCost, testLinearCost) {
   cost->UpdateCoefficients(a, b);
   cost->Eval(x0, &y);
   EXPECT_NEAR(y(0), obj_expected + b, tol);
+
+  // The sparse linear term only stores the nonzero entries, and is updated
+  // along with the dense one.
+  EXPECT_EQ(cost->GetSparseMatrix().nonZeros(), 2);
+  cost->UpdateCoefficients(Eigen::Vector2d(0, 3), b);
+  EXPECT_EQ(cost->GetSparseMatrix().nonZeros(), 1);
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(cost->GetSparseMatrix()),
+                              Eigen::Vector2d(0, 3)));
+  cost->UpdateCoefficients(a, b);
   EXPECT_THROW(cost->UpdateCoefficients(Eigen::Vector3d::Ones(), b),
                runtime_error);
 
@@ -194,6 +203,38 @@ GTEST_TEST(testCost, testQuadraticCost) {
   EXPECT_NEAR(y(0), obj_expected + c, tol);
 }
 
+GTEST_TEST(testCost, testHessianOfLagrangian) {
+  // The Hessian of a linear cost is zero, with no non-zero entries.
+  LinearCost linear_cost(Eigen::Vector2d(1, 2));
+  EXPECT_TRUE(linear_cost.has_analytic_hessian());
+  EXPECT_TRUE(linear_cost.hessian_sparsity_pattern()->empty());
+  Eigen::MatrixXd hessian;
+  linear_cost.EvalHessianOfLagrangian(Eigen::Vector2d(3, 4), Vector1d(2),
+                                      &hessian);
+  EXPECT_TRUE(CompareMatrices(hessian, Eigen::Matrix2d::Zero()));
+
+  // The Hessian of a quadratic cost is its scaled (symmetrized) Q.
+  Eigen::Matrix3d Q;
+  // clang-format off
+  Q << 1, 2, 0,
+       0, 4, 0,
+       0, 0, 0;
+  // clang-format on
+  QuadraticCost quadratic_cost(Q, Eigen::Vector3d::Ones());
+  EXPECT_TRUE(quadratic_cost.has_analytic_hessian());
+  EXPECT_EQ(*quadratic_cost.hessian_sparsity_pattern(),
+            (vector<std::pair<int, int>>{{0, 0}, {1, 0}, {1, 1}}));
+  quadratic_cost.EvalHessianOfLagrangian(Eigen::Vector3d(1, 2, 3),
+                                         Vector1d(2), &hessian);
+  EXPECT_TRUE(CompareMatrices(hessian, Q + Q.transpose()));
+
+  // The sparsity pattern follows the updates of Q.
+  quadratic_cost.UpdateCoefficients(Eigen::Matrix3d::Identity(),
+                                    Eigen::Vector3d::Ones());
+  EXPECT_EQ(*quadratic_cost.hessian_sparsity_pattern(),
+            (vector<std::pair<int, int>>{{0, 0}, {1, 1}, {2, 2}}));
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
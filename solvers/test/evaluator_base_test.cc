@@ -234,6 +234,82 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
   }
 }
 
+// y = [x₀²x₁, sin(x₁)x₂], whose Hessian isn't known analytically.
+class NonlinearEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(NonlinearEvaluator)
+  NonlinearEvaluator() : EvaluatorBase(2, 3) {}
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    DoEvalGeneric(x.cast<symbolic::Expression>(), y);
+  }
+
+ private:
+  template <typename DerivedX, typename ScalarY>
+  void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
+                     VectorX<ScalarY>* y) const {
+    using std::sin;
+    y->resize(2);
+    (*y)(0) = x(0) * x(0) * x(1);
+    (*y)(1) = sin(x(1)) * x(2);
+  }
+};
+
+GTEST_TEST(EvaluatorBaseTest, EvalHessianOfLagrangian) {
+  NonlinearEvaluator evaluator;
+  EXPECT_FALSE(evaluator.has_analytic_hessian());
+  EXPECT_FALSE(evaluator.hessian_sparsity_pattern().has_value());
+  const Eigen::Vector3d x(0.5, -1.2, 2);
+  const Vector2d lambda(3, -0.5);
+  MatrixXd hessian;
+  evaluator.EvalHessianOfLagrangian(x, lambda, &hessian);
+  Eigen::Matrix3d hessian_expected;
+  // clang-format off
+  hessian_expected <<
+      2 * lambda(0) * x(1),  2 * lambda(0) * x(0),  0,
+      2 * lambda(0) * x(0), -lambda(1) * std::sin(x(1)) * x(2),
+          lambda(1) * std::cos(x(1)),
+      0,  lambda(1) * std::cos(x(1)),  0;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(hessian, hessian_expected, 1E-8));
+  EXPECT_TRUE(CompareMatrices(hessian, hessian.transpose(), 0));
+
+  // The Hessian vanishes with the multipliers.
+  evaluator.EvalHessianOfLagrangian(x, Vector2d::Zero(), &hessian);
+  EXPECT_TRUE(CompareMatrices(hessian, Eigen::Matrix3d::Zero(), 0));
+}
+
+GTEST_TEST(EvaluatorBaseTest, SetHessianSparsityPattern) {
+  NonlinearEvaluator evaluator;
+  evaluator.SetHessianSparsityPattern({{0, 0}, {1, 0}, {2, 1}, {1, 1}});
+  ASSERT_TRUE(evaluator.hessian_sparsity_pattern().has_value());
+  EXPECT_EQ(evaluator.hessian_sparsity_pattern()->size(), 4);
+
+  if (kDrakeAssertIsArmed) {
+    // index out of range.
+    EXPECT_THROW(evaluator.SetHessianSparsityPattern({{3, 0}}),
+                 std::invalid_argument);
+    // upper triangle.
+    EXPECT_THROW(evaluator.SetHessianSparsityPattern({{0, 1}}),
+                 std::invalid_argument);
+    // repeated entries.
+    EXPECT_THROW(evaluator.SetHessianSparsityPattern({{1, 0}, {1, 0}}),
+                 std::invalid_argument);
+  }
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
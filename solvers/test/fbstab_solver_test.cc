@@ -0,0 +1,103 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+GTEST_TEST(FbstabSolverTest, TestUnconstrainedQP) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddQuadraticCost(x(0) * x(0));
+  prog.AddQuadraticCost((x(1) + x(2) - 2) * (x(1) + x(2) - 2));
+  prog.AddLinearCost(4 * x(0) + 5);
+  // The cost is (x₀ + 2)² + (x₁ + x₂-2)² + 1
+
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.available());
+  const auto result = solver.Solve(prog, {}, {});
+  EXPECT_TRUE(result.is_success());
+  const double tol = 1E-6;
+  EXPECT_NEAR(result.GetSolution(x(0)), -2, tol);
+  EXPECT_NEAR(result.GetSolution(x(1)) + result.GetSolution(x(2)), 2, tol);
+  EXPECT_NEAR(result.get_optimal_cost(), 1, tol);
+}
+
+GTEST_TEST(FbstabSolverTest, TestConstrainedQP) {
+  // min x₀² + x₁² + x₂² - 2x₁
+  // s.t x₀ + x₁ = 1
+  //     x₂ ≥ 0.5
+  //     0 ≤ x₁ ≤ 0.2
+  // The solution is x = (0.8, 0.2, 0.5).
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(2) * x(2) - 2 * x(1));
+  prog.AddLinearEqualityConstraint(x(0) + x(1) == 1);
+  prog.AddLinearConstraint(x(2) >= 0.5);
+  prog.AddBoundingBoxConstraint(0, 0.2, x(1));
+
+  FbstabSolver solver;
+  SolverOptions options;
+  options.SetOption(FbstabSolver::id(), "abs_tol", 1E-8);
+  const auto result = solver.Solve(prog, {}, options);
+  EXPECT_TRUE(result.is_success());
+  const double tol = 1E-6;
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                              Eigen::Vector3d(0.8, 0.2, 0.5), tol));
+  EXPECT_NEAR(result.get_optimal_cost(), 0.64 + 0.04 + 0.25 - 0.4, tol);
+
+  const FbstabSolverDetails& details =
+      result.get_solver_details<FbstabSolver>();
+  EXPECT_EQ(details.exit_flag, 0);
+  EXPECT_GT(details.newton_iters, 0);
+
+  // An initial guess is accepted.
+  const auto warm_result =
+      solver.Solve(prog, Eigen::Vector3d(0.8, 0.2, 0.5), options);
+  EXPECT_TRUE(warm_result.is_success());
+  EXPECT_TRUE(CompareMatrices(warm_result.GetSolution(x),
+                              Eigen::Vector3d(0.8, 0.2, 0.5), tol));
+}
+
+GTEST_TEST(FbstabSolverTest, TestInfeasible) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+  prog.AddLinearConstraint(x(0) + x(1) >= 2);
+  prog.AddLinearConstraint(x(0) + x(1) <= 1);
+
+  FbstabSolver solver;
+  const auto result = solver.Solve(prog, {}, {});
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+  EXPECT_EQ(result.get_optimal_cost(),
+            MathematicalProgram::kGlobalInfeasibleCost);
+}
+
+GTEST_TEST(FbstabSolverTest, TestUnbounded) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1));
+
+  FbstabSolver solver;
+  const auto result = solver.Solve(prog, {}, {});
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kDualInfeasible);
+}
+
+GTEST_TEST(FbstabSolverTest, ProgramAttributes) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddLinearCost(x(0));
+  // A linear program is left to LP solvers.
+  EXPECT_FALSE(FbstabSolver::ProgramAttributesSatisfied(prog));
+  prog.AddQuadraticCost(x(1) * x(1));
+  EXPECT_TRUE(FbstabSolver::ProgramAttributesSatisfied(prog));
+  prog.AddLorentzConeConstraint(x.cast<symbolic::Expression>());
+  EXPECT_FALSE(FbstabSolver::ProgramAttributesSatisfied(prog));
+}
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
@@ -1,7 +1,12 @@
 #include "drake/solvers/ipopt_solver.h"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -152,6 +157,88 @@ GTEST_TEST(IpoptSolverTest, AcceptableResult) {
     }
   }
 }
+
+GTEST_TEST(IpoptSolverTest, ParallelBindingEvaluation) {
+  // A program with many independent bindings, min ∑ᵢ (xᵢ - i)² s.t |xᵢ| ≤ 2,
+  // whose solution is xᵢ = min(i, 2).
+  const int num_vars = 20;
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(num_vars, "x");
+  Eigen::VectorXd x_expected(num_vars);
+  for (int i = 0; i < num_vars; ++i) {
+    prog.AddQuadraticCost((x(i) - i) * (x(i) - i));
+    prog.AddLorentzConeConstraint(Eigen::Vector2d(0, 1),
+                                  Eigen::Vector2d(2, 0), x.segment<1>(i));
+    x_expected(i) = std::min(i, 2);
+  }
+  IpoptSolver solver;
+  EXPECT_EQ(solver.num_threads(), 1);
+  if (solver.available()) {
+    const Eigen::VectorXd x_init = Eigen::VectorXd::Constant(num_vars, 0.5);
+    const auto serial_result = solver.Solve(prog, x_init, {});
+    ASSERT_TRUE(serial_result.is_success());
+    EXPECT_TRUE(
+        CompareMatrices(serial_result.GetSolution(x), x_expected, 1E-5));
+
+    // The bindings are evaluated in parallel, and the results are scattered
+    // in the same order, hence the solution is exactly the same.
+    solver.set_num_threads(4);
+    EXPECT_EQ(solver.num_threads(), 4);
+    const auto parallel_result = solver.Solve(prog, x_init, {});
+    ASSERT_TRUE(parallel_result.is_success());
+    EXPECT_TRUE(CompareMatrices(parallel_result.GetSolution(x),
+                                serial_result.GetSolution(x), 0));
+    EXPECT_EQ(parallel_result.get_optimal_cost(),
+              serial_result.get_optimal_cost());
+  }
+  EXPECT_THROW(solver.set_num_threads(0), std::exception);
+}
+
+GTEST_TEST(IpoptSolverTest, ExactHessian) {
+  // min (x₀ - 1)² + (x₁ - 2)² + x₀x₁ s.t. x₀² + x₁² ≤ 1, x₀ + x₁ ≥ 0.5, whose
+  // costs and constraints all have analytic Hessians, hence IPOPT uses the
+  // exact Hessian by default.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost((x(0) - 1) * (x(0) - 1) + (x(1) - 2) * (x(1) - 2) +
+                        x(0) * x(1));
+  prog.AddConstraint(std::make_shared<QuadraticConstraint>(
+                         2 * Eigen::Matrix2d::Identity(),
+                         Eigen::Vector2d::Zero(),
+                         -std::numeric_limits<double>::infinity(), 1),
+                     x);
+  prog.AddLinearConstraint(x(0) + x(1) >= 0.5);
+  IpoptSolver solver;
+  if (solver.available()) {
+    const Eigen::Vector2d x_init(0.1, 0.2);
+    const auto exact_result = solver.Solve(prog, x_init, {});
+    ASSERT_TRUE(exact_result.is_success());
+
+    SolverOptions options;
+    options.SetOption(IpoptSolver::id(), "hessian_approximation",
+                      "limited-memory");
+    const auto approximate_result = solver.Solve(prog, x_init, options);
+    ASSERT_TRUE(approximate_result.is_success());
+    EXPECT_TRUE(CompareMatrices(exact_result.GetSolution(x),
+                                approximate_result.GetSolution(x), 1E-6));
+
+    // The exact Hessian can also be requested for the evaluators without an
+    // analytic one (here the Lorentz cone), with the same solution.
+    prog.AddLorentzConeConstraint(Eigen::Vector2d(0, 1),
+                                  Eigen::Vector2d(0.9, 0), x.segment<1>(0));
+    options.SetOption(IpoptSolver::id(), "hessian_approximation", "exact");
+    const auto fallback_result = solver.Solve(prog, x_init, options);
+    ASSERT_TRUE(fallback_result.is_success());
+    options.SetOption(IpoptSolver::id(), "hessian_approximation",
+                      "limited-memory");
+    const auto fallback_approximate_result =
+        solver.Solve(prog, x_init, options);
+    ASSERT_TRUE(fallback_approximate_result.is_success());
+    EXPECT_TRUE(CompareMatrices(fallback_result.GetSolution(x),
+                                fallback_approximate_result.GetSolution(x),
+                                1E-6));
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -825,6 +825,35 @@ GTEST_TEST(TestMathematicalProgram, AddLinearCostSymbolic) {
   CheckAddedSymbolicLinearCost(&prog, x(1) * x(1) + x(0) - x(1) * x(1));
 }
 
+GTEST_TEST(TestMathematicalProgram, AddLinearConstraintSparse) {
+  // Adds sparse blocks of constraints on contiguous segments of x.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(6, "x");
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.insert(0, 0) = 1;
+  A.insert(0, 2) = -1;
+  A.insert(1, 1) = 2;
+  const Eigen::Vector2d lb(-1, 0);
+  const Eigen::Vector2d ub(1, 3);
+  const auto binding = prog.AddLinearConstraint(A, lb, ub, x.head<3>());
+  EXPECT_EQ(prog.linear_constraints().size(), 1u);
+  EXPECT_EQ(binding.variables(), VectorXDecisionVariable(x.head<3>()));
+  EXPECT_EQ(binding.evaluator()->GetSparseMatrix().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->A(), Eigen::MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->lower_bound(), lb));
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->upper_bound(), ub));
+
+  const auto equality_binding =
+      prog.AddLinearEqualityConstraint(A, ub, x.tail<3>());
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1u);
+  EXPECT_EQ(equality_binding.variables(),
+            VectorXDecisionVariable(x.tail<3>()));
+  EXPECT_TRUE(
+      CompareMatrices(equality_binding.evaluator()->A(), Eigen::MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(equality_binding.evaluator()->lower_bound(), ub));
+  EXPECT_TRUE(CompareMatrices(equality_binding.evaluator()->upper_bound(), ub));
+}
+
 GTEST_TEST(TestMathematicalProgram, AddLinearConstraintSymbolic1) {
   // Add linear constraint: -10 <= 3 - 5*x0 + 10*x2 - 7*y1 <= 10
   MathematicalProgram prog;
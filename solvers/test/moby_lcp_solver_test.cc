@@ -376,6 +376,53 @@ GTEST_TEST(testMobyLCP, testFailure) {
   // not to fail.
 }
 
+// Verifies that Lemke's Algorithm reports its basis, and that warmstarting
+// from the basis of a nearby LCP needs no pivots.
+GTEST_TEST(testMobyLCP, testWarmstartLemke) {
+  Eigen::Matrix3d M;
+  // clang-format off
+  M << 2, 1, 0,
+       1, 2, 1,
+       0, 1, 2;
+  // clang-format on
+  const Eigen::Vector3d q(-1, 1, -1);
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+  LinearComplementarityConstraint constraint(M, q);
+
+  Eigen::VectorXd z;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z));
+  EXPECT_TRUE(constraint.CheckSatisfied(z, epsilon));
+  EXPECT_GT(l.get_num_pivots(), 0);
+  EXPECT_EQ(l.get_basis(), std::vector<int>({0, 2}));
+
+  // The basis stays the same for a slightly different q.
+  const Eigen::Vector3d q_nearby(-1.1, 1, -0.9);
+  LinearComplementarityConstraint constraint_nearby(M, q_nearby);
+  Eigen::VectorXd z_cold, z_warm;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_nearby, &z_cold));
+  const std::vector<int> basis = l.get_basis();
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_nearby, basis, &z_warm));
+  EXPECT_EQ(l.get_num_pivots(), 0);
+  EXPECT_EQ(l.get_basis(), basis);
+  EXPECT_TRUE(CompareMatrices(z_warm, z_cold, epsilon,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(constraint_nearby.CheckSatisfied(z_warm, epsilon));
+
+  // A wrong basis still leads to the solution.
+  ASSERT_TRUE(l.SolveLcpLemke(M, q_nearby, {1}, &z_warm));
+  EXPECT_TRUE(CompareMatrices(z_warm, z_cold, epsilon,
+                              MatrixCompareType::absolute));
+
+  // Invalid bases.
+  EXPECT_THROW(l.SolveLcpLemke(M, q, {3}, &z), std::logic_error);
+  EXPECT_THROW(l.SolveLcpLemke(M, q, {0, 0}, &z), std::logic_error);
+
+  // The trivial solution has an empty basis.
+  ASSERT_TRUE(l.SolveLcpLemke(M, Eigen::Vector3d::Ones(), {0, 2}, &z));
+  EXPECT_TRUE(l.get_basis().empty());
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
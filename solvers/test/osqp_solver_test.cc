@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -139,6 +141,55 @@ GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
     EXPECT_NE(result.get_solver_details<OsqpSolver>().status_val, OSQP_SOLVED);
   }
 }
+
+GTEST_TEST(OsqpSolverTest, WorkspaceReuse) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto quadratic_cost =
+      prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(0) * x(1));
+  auto linear_cost = prog.AddLinearCost(x(0) - x(1));
+  auto constraint = prog.AddLinearConstraint(x(0) + 2 * x(1) >= 1);
+
+  OsqpSolver fresh_solver;
+  OsqpSolver reusing_solver;
+  EXPECT_FALSE(reusing_solver.workspace_reuse());
+  reusing_solver.set_workspace_reuse(true);
+  EXPECT_TRUE(reusing_solver.workspace_reuse());
+  if (fresh_solver.available()) {
+    const double tol = 1E-6;
+    auto check_same_solution = [&]() {
+      const auto expected = fresh_solver.Solve(prog, {}, {});
+      const auto result = reusing_solver.Solve(prog, {}, {});
+      ASSERT_TRUE(expected.is_success());
+      ASSERT_TRUE(result.is_success());
+      EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                  expected.GetSolution(x), tol));
+      EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), tol);
+    };
+    check_same_solution();
+
+    // Only the values change: the workspace is updated.
+    linear_cost.evaluator()->UpdateCoefficients(Eigen::Vector2d(2, 1));
+    constraint.evaluator()->UpdateLowerBound(Vector1d(2));
+    check_same_solution();
+
+    // Update the constraint coefficients, keeping their sparsity pattern.
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(3, 1), Vector1d(1),
+        Vector1d(std::numeric_limits<double>::infinity()));
+    check_same_solution();
+
+    // Update the Hessian values, keeping their sparsity pattern.
+    quadratic_cost.evaluator()->UpdateCoefficients(
+        (Eigen::Matrix2d() << 4, 1, 1, 2).finished(), Eigen::Vector2d(1, 0));
+    check_same_solution();
+
+    // A new constraint changes the sparsity pattern of A: the workspace is
+    // set up again.
+    prog.AddLinearConstraint(x(0) - x(1) <= 0.5);
+    check_same_solution();
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -2,13 +2,17 @@
 
 #include <fstream>
 #include <limits>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <spruce.hh>
 
 #include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/solvers/test/csdp_test_examples.h"
 
 namespace drake {
@@ -697,6 +701,39 @@ TEST_F(TrivialSOCP3, TestSdpaFreeFormatConstructor) {
   EXPECT_TRUE(CompareMatrices(dut.g(), g_expected));
 }
 
+GTEST_TEST(ConvertTripletsToUpperTriangularBlockEntriesTest, Test) {
+  // X has a 2 x 2 matrix block, a 3 x 3 diagonal block and a 2 x 2 matrix
+  // block.
+  const std::vector<BlockInX> X_blocks{{BlockType::kMatrix, 2},
+                                       {BlockType::kDiagonal, 3},
+                                       {BlockType::kMatrix, 2}};
+  std::vector<int> block_start_rows;
+  std::vector<int> X_row_to_block_index;
+  ComputeBlockStartRows(X_blocks, &block_start_rows, &X_row_to_block_index);
+  EXPECT_EQ(block_start_rows, std::vector<int>({0, 2, 5}));
+  EXPECT_EQ(X_row_to_block_index, std::vector<int>({0, 0, 1, 1, 1, 2, 2}));
+
+  // The triplets are unsorted, contain both triangular parts and duplicates.
+  const std::vector<Eigen::Triplet<double>> triplets{
+      {6, 5, 1.}, {5, 6, 1.}, {3, 3, 2.}, {0, 1, 3.}, {1, 0, 3.},
+      {1, 1, 4.}, {0, 1, 1.}, {1, 0, 1.}, {5, 5, 5.}, {0, 0, 6.}};
+  const std::vector<EntryInXBlock> entries =
+      ConvertTripletsToUpperTriangularBlockEntries(triplets, block_start_rows,
+                                                   X_row_to_block_index);
+  const std::vector<EntryInXBlock> entries_expected{
+      {0, 0, 0, 6.}, {0, 0, 1, 4.}, {0, 1, 1, 4.},
+      {1, 1, 1, 2.}, {2, 0, 0, 5.}, {2, 0, 1, 1.}};
+  ASSERT_EQ(entries.size(), entries_expected.size());
+  for (int i = 0; i < static_cast<int>(entries.size()); ++i) {
+    EXPECT_EQ(entries[i].block_index, entries_expected[i].block_index);
+    EXPECT_EQ(entries[i].row_index_in_block,
+              entries_expected[i].row_index_in_block);
+    EXPECT_EQ(entries[i].column_index_in_block,
+              entries_expected[i].column_index_in_block);
+    EXPECT_EQ(entries[i].value, entries_expected[i].value);
+  }
+}
+
 }  // namespace internal
 GTEST_TEST(SdpaFreeFormatTest, GenerateSDPA1) {
   // This is the sample program from http://plato.asu.edu/ftp/sdpa_format.txt
@@ -751,6 +788,57 @@ GTEST_TEST(SdpaFreeFormatTest, GenerateSDPA1) {
   infile.close();
 }
 
+GTEST_TEST(SdpaFreeFormatTest, ParseSDPA) {
+  // The sample program from http://plato.asu.edu/ftp/sdpa_format.txt, as
+  // written by GenerateSDPA() in GenerateSDPA1 (with a comment, and with the
+  // decorations allowed by the format).
+  const std::string file_name = temp_directory() + "/parse.dat-s";
+  {
+    std::ofstream out(file_name);
+    out << "\"The sample program\"\n"
+        << "2 = mDIM\n2 = nBLOCK\n{2, -2}\n{10, 20}\n"
+        << "0 1 1 1 3\n0 1 2 2 4\n0 2 1 1 1\n0 2 2 2 2\n"
+        << "1 2 1 1 1\n1 2 2 2 1\n2 1 1 1 5\n2 1 1 2 2\n2 1 2 2 6\n"
+        << "2 2 2 2 1\n";
+  }
+  const std::unique_ptr<MathematicalProgram> prog = ParseSDPA(file_name);
+  ASSERT_EQ(prog->num_vars(), 2);
+  ASSERT_EQ(prog->linear_costs().size(), 1);
+  EXPECT_TRUE(CompareMatrices(prog->linear_costs()[0].evaluator()->a(),
+                              Eigen::Vector2d(10, 20)));
+
+  // The matrix block: y₂[5 2; 2 6] - diag(3, 4) ≽ 0.
+  ASSERT_EQ(prog->linear_matrix_inequality_constraints().size(), 1);
+  const std::vector<Eigen::MatrixXd>& F =
+      prog->linear_matrix_inequality_constraints()[0].evaluator()->F();
+  ASSERT_EQ(F.size(), 3);
+  EXPECT_TRUE(CompareMatrices(F[0], -Eigen::Vector2d(3, 4).asDiagonal()
+                                         .toDenseMatrix()));
+  EXPECT_TRUE(CompareMatrices(F[1], Eigen::Matrix2d::Zero()));
+  EXPECT_TRUE(CompareMatrices(F[2], (Eigen::Matrix2d() << 5, 2, 2, 6)
+                                        .finished()));
+
+  // The diagonal block: y₁ ≥ 1 and y₁ + y₂ ≥ 2.
+  ASSERT_EQ(prog->linear_constraints().size(), 1);
+  const auto& linear = *prog->linear_constraints()[0].evaluator();
+  EXPECT_TRUE(CompareMatrices(linear.A(),
+                              (Eigen::Matrix2d() << 1, 0, 1, 1).finished()));
+  EXPECT_TRUE(CompareMatrices(linear.lower_bound(), Eigen::Vector2d(1, 2)));
+  EXPECT_TRUE(CompareMatrices(
+      linear.upper_bound(), Eigen::Vector2d::Constant(
+                                std::numeric_limits<double>::infinity())));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(ParseSDPA(temp_directory() + "/missing.dat-s"),
+                              std::runtime_error,
+                              "ParseSDPA\\(\\): cannot open the file .*");
+  {
+    std::ofstream out(file_name);
+    out << "2\n1\n2\n10 20\n3 1 1 1 1\n";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(ParseSDPA(file_name), std::runtime_error,
+                              ".* invalid entry 3 1 1 1");
+}
+
 GTEST_TEST(SdpaFreeFormatTest, GenerateInvalidSDPA) {
   // Test the program that cannot be formulated in SDPA format.
   MathematicalProgram prog1;
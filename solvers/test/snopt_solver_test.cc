@@ -1,5 +1,6 @@
 #include "drake/solvers/snopt_solver.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <regex>
@@ -384,6 +385,42 @@ GTEST_TEST(SnoptTest, AutoDiffOnlyCost) {
   }
 }
 
+GTEST_TEST(SnoptTest, ParallelBindingEvaluation) {
+  // A program with many independent bindings, min ∑ᵢ (xᵢ - i)² s.t |xᵢ| ≤ 2,
+  // whose solution is xᵢ = min(i, 2).
+  const int num_vars = 20;
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(num_vars, "x");
+  Eigen::VectorXd x_expected(num_vars);
+  for (int i = 0; i < num_vars; ++i) {
+    prog.AddQuadraticCost((x(i) - i) * (x(i) - i));
+    prog.AddLorentzConeConstraint(Eigen::Vector2d(0, 1),
+                                  Eigen::Vector2d(2, 0), x.segment<1>(i));
+    x_expected(i) = std::min(i, 2);
+  }
+  SnoptSolver solver;
+  EXPECT_EQ(solver.num_threads(), 1);
+  if (solver.available()) {
+    const Eigen::VectorXd x_init = Eigen::VectorXd::Constant(num_vars, 0.5);
+    const auto serial_result = solver.Solve(prog, x_init, {});
+    ASSERT_TRUE(serial_result.is_success());
+    EXPECT_TRUE(
+        CompareMatrices(serial_result.GetSolution(x), x_expected, 1E-5));
+
+    // The bindings are evaluated in parallel, and the results are scattered
+    // in the same order, hence the solution is exactly the same.
+    solver.set_num_threads(4);
+    EXPECT_EQ(solver.num_threads(), 4);
+    const auto parallel_result = solver.Solve(prog, x_init, {});
+    ASSERT_TRUE(parallel_result.is_success());
+    EXPECT_TRUE(CompareMatrices(parallel_result.GetSolution(x),
+                                serial_result.GetSolution(x), 0));
+    EXPECT_EQ(parallel_result.get_optimal_cost(),
+              serial_result.get_optimal_cost());
+  }
+  EXPECT_THROW(solver.set_num_threads(0), std::exception);
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
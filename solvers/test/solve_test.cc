@@ -6,6 +6,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/linear_system_solver.h"
 #include "drake/solvers/snopt_solver.h"
@@ -86,5 +87,54 @@ GTEST_TEST(SolveTest, GetInfeasibleConstraints) {
   }
 }
 
+GTEST_TEST(SolveTest, SolveInParallel) {
+  // Both LinearSystemSolver and EqualityConstrainedQPSolver can solve this
+  // program.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddLinearEqualityConstraint(Eigen::Matrix2d::Identity(),
+                                   Eigen::Vector2d(1, 2), x);
+  const std::vector<SolverId> solver_ids{LinearSystemSolver::id(),
+                                         EqualityConstrainedQPSolver::id()};
+
+  // With a single thread, the second solver is skipped once the first one
+  // succeeds.
+  MathematicalProgramResult result =
+      SolveInParallel(prog, solver_ids, {}, {}, 1);
+  EXPECT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_id(), LinearSystemSolver::id());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), Eigen::Vector2d(1, 2),
+                              1E-12));
+  EXPECT_EQ(result.get_solver_times().size(), 1);
+  EXPECT_GE(result.get_solver_times().at(LinearSystemSolver::id()), 0);
+  EXPECT_EQ(result.num_suboptimal_solution(), 0);
+
+  // With two threads, the second solver may also run, in which case its
+  // solution is added to the solution pool.
+  result = SolveInParallel(prog, solver_ids, {}, {}, 2);
+  EXPECT_TRUE(result.is_success());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), Eigen::Vector2d(1, 2),
+                              1E-12));
+  EXPECT_GE(result.get_solver_times().size(), 1);
+  EXPECT_EQ(result.num_suboptimal_solution(),
+            static_cast<int>(result.get_solver_times().size()) - 1);
+  for (int i = 0; i < result.num_suboptimal_solution(); ++i) {
+    EXPECT_TRUE(CompareMatrices(result.GetSuboptimalSolution(x, i),
+                                Eigen::Vector2d(1, 2), 1E-10));
+  }
+
+  // LinearSystemSolver can't handle the cost, so it is ignored.
+  prog.AddQuadraticCost(x(0) * x(0));
+  result = SolveInParallel(prog, solver_ids, {}, {}, 2);
+  EXPECT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_id(), EqualityConstrainedQPSolver::id());
+  EXPECT_EQ(result.get_solver_times().size(), 1);
+
+  EXPECT_THROW(SolveInParallel(prog, {LinearSystemSolver::id()}, {}, {}, 1),
+               std::invalid_argument);
+  EXPECT_THROW(SolveInParallel(prog, solver_ids, {}, {}, 0),
+               std::invalid_argument);
+}
+
 }  // namespace solvers
 }  // namespace drake
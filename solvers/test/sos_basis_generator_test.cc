@@ -89,6 +89,19 @@ TEST_F(SosBasisGeneratorTest, Singleton) {
   EXPECT_EQ(basis_ref, GetMonomialBasis(poly));
 }
 
+TEST_F(SosBasisGeneratorTest, MultipleThreads) {
+  // The basis doesn't depend on the number of threads used to compute it.
+  const symbolic::Polynomial poly{
+      pow(x_(0), 8) + pow(x_(1), 6) * pow(x_(2), 2) + x_(0) * x_(1) * x_(2) +
+      pow(x_(2), 10) + pow(x_(0) * x_(1), 4) + 1};
+  const drake::VectorX<Monomial> basis = ConstructMonomialBasis(poly);
+  EXPECT_GT(basis.size(), 0);
+  for (int num_threads : {2, 4}) {
+    EXPECT_EQ(ConstructMonomialBasis(poly, num_threads), basis);
+  }
+  EXPECT_THROW(ConstructMonomialBasis(poly, 0), std::exception);
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -71,7 +71,17 @@ class SosConstraintTest : public ::testing::Test {
       const MatrixXDecisionVariable& Q,
       const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
       const symbolic::Expression& sos_poly_expected, const double eps = 1e-07) {
-    const Eigen::MatrixXd Q_val = result_.GetSolution(Q);
+    CheckPositiveDefiniteMatrix(result_.GetSolution(Q), monomial_basis,
+                                sos_poly_expected, eps);
+  }
+
+  // Checks the value Q_val of the Gram matrix has all eigen values as
+  // approximately non-negatives.
+  // Precondition: result_ = Solve(prog_) has been called.
+  void CheckPositiveDefiniteMatrix(
+      const Eigen::MatrixXd& Q_val,
+      const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+      const symbolic::Expression& sos_poly_expected, const double eps = 1e-07) {
     Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Q_val);
     EXPECT_TRUE((es.eigenvalues().array() >= -eps).all());
     // Compute mᵀ * Q * m;
@@ -277,6 +287,40 @@ TEST_F(SosConstraintTest, AddSosConstraintMultivariate2) {
   CheckPositiveDefiniteMatrix(Q, m, e);
 }
 
+// Finds the global minimum of the separable polynomial f(x₀, x₁, x₂) =
+// ∑ᵢ xᵢ⁴ - 2xᵢ² + 1, which is 0 at xᵢ = ±1, with a sparse Gram matrix.
+TEST_F(SosConstraintTest, AddSparseSosConstraint) {
+  const auto& c = c_(0);
+  prog_.AddCost(-c);
+  symbolic::Expression e = -c;
+  for (int i = 0; i < 3; ++i) {
+    e += pow(x_(i), 4) - 2 * pow(x_(i), 2) + 1;
+  }
+  const symbolic::Polynomial p{e, symbolic::Variables(x_)};
+  MatrixX<symbolic::Expression> Q;
+  VectorX<symbolic::Monomial> m;
+  std::tie(Q, m) = prog_.AddSparseSosConstraint(p, 2 /* num_threads */);
+  ASSERT_EQ(Q.rows(), m.size());
+  ASSERT_EQ(Q.cols(), m.size());
+  // The Gram matrix is split into smaller blocks, hence it has zero entries.
+  int num_zero_entries = 0;
+  for (int i = 0; i < Q.rows(); ++i) {
+    for (int j = 0; j < Q.cols(); ++j) {
+      if (is_zero(Q(i, j))) {
+        ++num_zero_entries;
+      }
+    }
+  }
+  EXPECT_GT(num_zero_entries, 0);
+
+  result_ = Solve(prog_);
+  ASSERT_TRUE(result_.is_success());
+  EXPECT_NEAR(result_.GetSolution(c), 0, 1E-4);
+  const Eigen::MatrixXd Q_val = result_.GetSolution(Q).unaryExpr(
+      [](const symbolic::Expression& q) { return q.Evaluate(); });
+  CheckPositiveDefiniteMatrix(Q_val, m, e, 1E-6);
+}
+
 TEST_F(SosConstraintTest, SynthesizeLyapunovFunction) {
   // Find the Lyapunov function V(x) for system:
   //
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/polynomial.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/trig_poly.h"
 
 namespace drake {
@@ -467,6 +468,109 @@ GTEST_TEST(SystemIdentificationTest, PendulaIdentification) {
 
 ///@}
 
+// Identifies the lumped parameters of a pendulum, m*l*l and m*g*l, from
+// streamed samples of (theta, theta_ddot, tau).
+class StreamingIdentificationTest : public ::testing::Test {
+ protected:
+  StreamingIdentificationTest()
+      : theta_(Polynomiald("th"), Polynomiald("s"), Polynomiald("c")),
+        theta_ddot_(Polynomiald("th..")),
+        tau_(Polynomiald("tau")),
+        mll_(Polynomiald("mll")),
+        mgl_(Polynomiald("mgl")) {
+    polys_.resize(1);
+    polys_ << mll_ * theta_ddot_ + mgl_ * sin(theta_) - tau_;
+    active_vars_ = {theta_.poly().GetSimpleVariable(),
+                    theta_ddot_.poly().GetSimpleVariable(),
+                    tau_.poly().GetSimpleVariable()};
+  }
+
+  // Returns `num_samples` samples of the pendulum with the parameters `mll`
+  // and `mgl`, as the columns of a matrix.
+  Eigen::MatrixXd MakeSamples(int num_samples, double mll, double mgl) {
+    Eigen::MatrixXd samples(3, num_samples);
+    for (int k = 0; k < num_samples; ++k) {
+      const double theta = 3 * std::sin(0.7 * sample_index_);
+      const double theta_ddot = std::cos(1.3 * sample_index_);
+      samples.col(k) << theta, theta_ddot,
+          mll * theta_ddot + mgl * std::sin(theta);
+      ++sample_index_;
+    }
+    return samples;
+  }
+
+  const TrigPolyd theta_;
+  const TrigPolyd theta_ddot_;
+  const TrigPolyd tau_;
+  const TrigPolyd mll_;
+  const TrigPolyd mgl_;
+  VectorXTrigPoly polys_;
+  std::vector<Polynomiald::VarType> active_vars_;
+  int sample_index_{0};
+};
+
+TEST_F(StreamingIdentificationTest, Estimates) {
+  StreamingLumpedParameterEstimator estimator(polys_, active_vars_);
+  const std::vector<Polynomiald::VarType> expected_parameters = {
+      mgl_.poly().GetSimpleVariable(), mll_.poly().GetSimpleVariable()};
+  EXPECT_EQ(estimator.parameter_vars(), expected_parameters);
+
+  // One sample is not enough for two parameters.
+  estimator.AddSamples(MakeSamples(1, 2.0, 19.6));
+  EXPECT_FALSE(estimator.is_identifiable());
+  EXPECT_THROW(estimator.GetEstimates(), std::runtime_error);
+
+  for (int i = 0; i < 10; ++i) {
+    estimator.AddSamples(MakeSamples(i, 2.0, 19.6));
+  }
+  EXPECT_EQ(estimator.num_samples(), 46);
+  EXPECT_TRUE(estimator.is_identifiable());
+  EXPECT_TRUE(CompareMatrices(estimator.GetEstimates(),
+                              Eigen::Vector2d(19.6, 2.0), 1e-10));
+  EXPECT_NEAR(estimator.rms_error(), 0, 1e-10);
+  SID::PartialEvalType estimates = estimator.GetEstimatesMap();
+  EXPECT_NEAR(estimates[mll_.poly().GetSimpleVariable()], 2.0, 1e-10);
+
+  estimator.Reset();
+  EXPECT_EQ(estimator.num_samples(), 0);
+  EXPECT_FALSE(estimator.is_identifiable());
+}
+
+// With forgetting, the estimates track the parameters when they change.
+TEST_F(StreamingIdentificationTest, Forgetting) {
+  StreamingLumpedParameterEstimator forgetful(polys_, active_vars_, 0.9);
+  StreamingLumpedParameterEstimator not_forgetful(polys_, active_vars_);
+  const Eigen::MatrixXd before = MakeSamples(100, 2.0, 19.6);
+  forgetful.AddSamples(before);
+  not_forgetful.AddSamples(before);
+  for (int i = 0; i < 20; ++i) {
+    const Eigen::MatrixXd after = MakeSamples(10, 3.0, 29.4);
+    forgetful.AddSamples(after);
+    not_forgetful.AddSamples(after);
+  }
+  EXPECT_TRUE(CompareMatrices(forgetful.GetEstimates(),
+                              Eigen::Vector2d(29.4, 3.0), 1e-6));
+  EXPECT_GT((not_forgetful.GetEstimates() - Eigen::Vector2d(29.4, 3.0))
+                .norm(), 0.1);
+  EXPECT_GT(not_forgetful.rms_error(), forgetful.rms_error());
+}
+
+TEST_F(StreamingIdentificationTest, Exceptions) {
+  // Not linear in the parameters.
+  VectorXTrigPoly nonlinear(1);
+  nonlinear << mll_ * mgl_ * theta_ddot_ - tau_;
+  EXPECT_THROW(StreamingLumpedParameterEstimator(nonlinear, active_vars_),
+               std::runtime_error);
+  // No parameters.
+  VectorXTrigPoly no_parameters(1);
+  no_parameters << theta_ddot_ - tau_;
+  EXPECT_THROW(StreamingLumpedParameterEstimator(no_parameters, active_vars_),
+               std::runtime_error);
+  StreamingLumpedParameterEstimator estimator(polys_, active_vars_);
+  EXPECT_THROW(estimator.AddSamples(Eigen::MatrixXd::Zero(2, 1)),
+               std::exception);
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
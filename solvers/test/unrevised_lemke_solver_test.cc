@@ -343,6 +343,50 @@ GTEST_TEST(TestUnrevisedLemke, WarmStarting) {
   EXPECT_EQ(num_pivots, 1);
 }
 
+// Checks that the basis of a solution can warmstart another solver.
+GTEST_TEST(TestUnrevisedLemke, WarmStartingFromBasis) {
+  MatrixX<double> M(3, 3);
+  // clang-format off
+  M <<
+      1, 2, 0,
+      0, 1, 2,
+      2, 0, 1;
+  // clang-format on
+
+  Eigen::Matrix<double, 3, 1> q;
+  q << -1, -1, -1;
+
+  int num_pivots;
+  Eigen::VectorXd expected_z(3);
+  expected_z << 1.0/3, 1.0/3, 1.0/3;
+  Eigen::VectorXd z;
+  UnrevisedLemkeSolver<double> lcp;
+  ASSERT_TRUE(lcp.SolveLcpLemke(M, q, &z, &num_pivots));
+  EXPECT_EQ(lcp.get_basis(), std::vector<int>({0, 1, 2}));
+
+  // Warmstart another solver with the basis: exactly one pivot is required.
+  UnrevisedLemkeSolver<double> other_lcp;
+  q *= 2;
+  expected_z *= 2;
+  ASSERT_TRUE(other_lcp.SolveLcpLemke(M, q, lcp.get_basis(), &z, &num_pivots));
+  EXPECT_TRUE(CompareMatrices(z, expected_z, epsilon,
+                              MatrixCompareType::absolute));
+  EXPECT_EQ(num_pivots, 1);
+  EXPECT_EQ(other_lcp.get_basis(), lcp.get_basis());
+
+  // A wrong basis still leads to the solution, with more pivots.
+  ASSERT_TRUE(other_lcp.SolveLcpLemke(M, q, {1}, &z, &num_pivots));
+  EXPECT_TRUE(CompareMatrices(z, expected_z, epsilon,
+                              MatrixCompareType::absolute));
+  EXPECT_GT(num_pivots, 1);
+
+  // Invalid bases.
+  EXPECT_THROW(other_lcp.SolveLcpLemke(M, q, {-1}, &z, &num_pivots),
+               std::logic_error);
+  EXPECT_THROW(other_lcp.SolveLcpLemke(M, q, {2, 2}, &z, &num_pivots),
+               std::logic_error);
+}
+
 // Checks that an LCP with a trivial solution is solvable without any pivots.
 GTEST_TEST(TestUnrevisedLemke, Trivial) {
   MatrixX<double> M = MatrixX<double>::Identity(3, 3);
@@ -556,18 +556,29 @@ bool UnrevisedLemkeSolver<T>::ConstructLemkeSolution(
   // Compute the solution by pivoting the artificial variable, which was just
   // identified as the blocking variable, from the set of dependent variables
   // to the set of independent variables.
-  VectorX<T> q_prime(n);
-  if (!LemkePivot(M, q, artificial_index, zero_tol, nullptr, &q_prime))
+  q_prime_.resize(n);
+  if (!LemkePivot(M, q, artificial_index, zero_tol, nullptr, &q_prime_))
     return false;
 
   z->setZero(n);
   for (int i = 0; i < static_cast<int>(dep_variables_.size()); ++i) {
     if (dep_variables_[i].is_z())
-      (*z)[dep_variables_[i].index()] = q_prime[i];
+      (*z)[dep_variables_[i].index()] = q_prime_[i];
   }
   return true;
 }
 
+// Records the z variables among the dependent variables as the basis.
+template <class T>
+void UnrevisedLemkeSolver<T>::RecordBasis() const {
+  basis_.clear();
+  for (const LCPVariable& v : dep_variables_) {
+    if (v.is_z())
+      basis_.push_back(v.index());
+  }
+  std::sort(basis_.begin(), basis_.end());
+}
+
 // Computes the blocking index using the minimum ratio test. Returns `true`
 // if successful, `false` if not (due to, e.g., the driving variable being
 // "unblocked" or a cycle being detected). If `false`, `blocking_index` will
@@ -601,7 +612,7 @@ bool UnrevisedLemkeSolver<T>::FindBlockingIndex(
   // Determine all variables within the zero tolerance of the minimum ratio,
   // while simultaneously looking for the presence of the artificial variable
   // among the (possible multiple) minima.
-  std::vector<int> blocking_indices;
+  blocking_indices_.clear();
   for (int i = 0; i < n; ++i) {
     if (matrix_col[i] < -zero_tol) {
       DRAKE_SPDLOG_DEBUG(log(), "Ratio for index {}: {}", i, ratios[i]);
@@ -612,24 +623,24 @@ bool UnrevisedLemkeSolver<T>::FindBlockingIndex(
           *blocking_index = i;
           return true;
         }
-        blocking_indices.push_back(i);
+        blocking_indices_.push_back(i);
       }
     }
   }
 
   // If there are multiple blocking variables, replace the blocking index with
   // the cycling selection.
-  if (blocking_indices.size() > 1) {
+  if (blocking_indices_.size() > 1) {
     auto& index = selections_[indep_variables_];
 
     // Verify that we have not run out of indices to select, which means that
     // cycling would be occurring, in spite of cycling prevention.
-    if (index >= static_cast<int>(blocking_indices.size())) {
+    if (index >= static_cast<int>(blocking_indices_.size())) {
       DRAKE_SPDLOG_DEBUG(log(), "Cycling detected- indicating failure.");
       *blocking_index = -1;
       return false;
     }
-    *blocking_index = blocking_indices[index];
+    *blocking_index = blocking_indices_[index];
     ++index;
   }
 
@@ -656,13 +667,51 @@ bool UnrevisedLemkeSolver<T>::IsSolution(
           abs(dot) < 10 * n * mod_zero_tol);
 }
 
-// Note: maintainers should read Section 4.4 - 4.4.5 of [Cottle 1992] to
-// understand Lemke's Algorithm (and this function).
 template <typename T>
 bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
                                      const VectorX<T>& q, VectorX<T>* z,
                                      int* num_pivots,
                                      const T& zero_tol) const {
+  return SolveLcpLemkeFromBasis(M, q, nullptr, z, num_pivots, zero_tol);
+}
+
+template <typename T>
+bool UnrevisedLemkeSolver<T>::SolveLcpLemke(
+    const MatrixX<T>& M, const VectorX<T>& q,
+    const std::vector<int>& initial_basis, VectorX<T>* z, int* num_pivots,
+    const T& zero_tol) const {
+  return SolveLcpLemkeFromBasis(M, q, &initial_basis, z, num_pivots, zero_tol);
+}
+
+// Sets the independent and dependent variables to those of the solution in
+// which the z variables of `basis` are dependent (and their complements are
+// independent), with the artificial variable independent.
+template <typename T>
+void UnrevisedLemkeSolver<T>::SetBasis(const std::vector<int>& basis,
+                                       int n) const {
+  indep_variables_.resize(n + 1);
+  dep_variables_.resize(n);
+  for (int i = 0; i < n; ++i) {
+    dep_variables_[i] = LCPVariable(false, i);
+    indep_variables_[i] = LCPVariable(true, i);
+  }
+  indep_variables_[n] = LCPVariable(true, n);
+  for (const int i : basis) {
+    if (i < 0 || i >= n)
+      throw std::logic_error("Basis index out of range.");
+    if (dep_variables_[i].is_z())
+      throw std::logic_error("Basis has duplicate indices.");
+    std::swap(dep_variables_[i], indep_variables_[i]);
+  }
+}
+
+// Note: maintainers should read Section 4.4 - 4.4.5 of [Cottle 1992] to
+// understand Lemke's Algorithm (and this function).
+template <typename T>
+bool UnrevisedLemkeSolver<T>::SolveLcpLemkeFromBasis(
+    const MatrixX<T>& M, const VectorX<T>& q,
+    const std::vector<int>* initial_basis, VectorX<T>* z, int* num_pivots,
+    const T& zero_tol) const {
   using std::max;
   using std::abs;
   DRAKE_DEMAND(num_pivots);
@@ -679,6 +728,7 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
   // Update the pivots.
   *num_pivots = 0;
+  basis_.clear();
 
   // Look for immediate exit.
   if (n == 0) {
@@ -713,6 +763,10 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   // Clear the cycling selections.
   selections_.clear();
 
+  // Use the given basis in place of the last solution.
+  if (initial_basis != nullptr)
+    SetBasis(*initial_basis, n);
+
   // If 'n' is identical to the size of the last problem solved, try using the
   // indices from the last problem solved.
   if (static_cast<size_t>(n) == dep_variables_.size()) {
@@ -732,6 +786,7 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
           // If z truly is the solution, return now, indicating only one pivot
           // (in the solution construction) was performed.
           ++(*num_pivots);
+          RecordBasis();
           return true;
         }
       } else {
@@ -789,7 +844,8 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
       to_string(dep_variables_));
 
   // Pivot up to the maximum number of times.
-  VectorX<T> q_prime(n), M_prime_col(n);
+  q_prime_.resize(n);
+  M_prime_col_.resize(n);
   while (++(*num_pivots) < max_pivots) {
     DRAKE_SPDLOG_DEBUG(log(), "New driving variable {}{}",
                        ((indep_variables_[driving_index].is_z()) ? "z" : "w"),
@@ -797,16 +853,16 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
     // Compute the permuted q and driving column of the permuted M matrix.
     if (!LemkePivot(
-        M, q, driving_index, mod_zero_tol, &M_prime_col, &q_prime)) {
+        M, q, driving_index, mod_zero_tol, &M_prime_col_, &q_prime_)) {
       DRAKE_SPDLOG_DEBUG(log(), "Linear system solve failed.");
       z->setZero(n);
       return false;
     }
 
     // Find the blocking variable.
+    ratios_ = -(q_prime_.array() / M_prime_col_.array()).matrix();
     if (!FindBlockingIndex(
-        mod_zero_tol, M_prime_col,
-        -(q_prime.array() / M_prime_col.array()).matrix(), &blocking_index)) {
+        mod_zero_tol, M_prime_col_, ratios_, &blocking_index)) {
       z->setZero(n);
       return false;
     }
@@ -824,8 +880,10 @@ bool UnrevisedLemkeSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
       // Compute the permuted q, and convert it into a solution.
       if (ConstructLemkeSolution(M, q, driving_index, mod_zero_tol, z)) {
-        if (IsSolution(M, q, *z))
+        if (IsSolution(M, q, *z)) {
+          RecordBasis();
           return true;
+        }
 
         DRAKE_SPDLOG_DEBUG(log(),
             "Solution not computed to requested tolerance");
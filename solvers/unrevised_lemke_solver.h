@@ -89,6 +89,27 @@ class UnrevisedLemkeSolver final : public SolverBase {
                      VectorX<T>* z, int* num_pivots,
                      const T& zero_tol = T(-1)) const;
 
+  /// Lemke's Algorithm, as in the SolveLcpLemke() above, but warmstarted from
+  /// @p initial_basis instead of the basis from the last solution:
+  /// @p initial_basis holds the indices i of the z variables that are assumed
+  /// to be basic (i.e., zᵢ ≥ 0 and wᵢ = 0) in the solution, such as
+  /// get_basis() after the solution of a nearby LCP (e.g., that of the
+  /// previous time step, possibly by another solver object). If this basis
+  /// does not give the solution, the solver pivots from the standard initial
+  /// basis.
+  /// @throws std::logic_error if M is not square, if the dimensions of M do
+  ///         not match the length of q, or if @p initial_basis has an index
+  ///         that is out of range or repeated.
+  bool SolveLcpLemke(const MatrixX<T>& M, const VectorX<T>& q,
+                     const std::vector<int>& initial_basis, VectorX<T>* z,
+                     int* num_pivots, const T& zero_tol = T(-1)) const;
+
+  /// Returns the indices, in increasing order, of the z variables in the
+  /// basis of the solution found by the last call of SolveLcpLemke(), which
+  /// can warmstart the solution of a nearby LCP. It is empty if that call
+  /// failed or found the trivial solution z = 0.
+  const std::vector<int>& get_basis() const { return basis_; }
+
   /// @name Static versions of the instance methods with similar names.
   //@{
   static SolverId id();
@@ -172,6 +193,13 @@ class UnrevisedLemkeSolver final : public SolverBase {
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
 
+  bool SolveLcpLemkeFromBasis(const MatrixX<T>& M, const VectorX<T>& q,
+                              const std::vector<int>* initial_basis,
+                              VectorX<T>* z, int* num_pivots,
+                              const T& zero_tol) const;
+  void SetBasis(const std::vector<int>& basis, int n) const;
+  void RecordBasis() const;
+
   static void SelectSubMatrixWithCovering(
       const MatrixX<T>& in,
       const std::vector<int>& rows,
@@ -268,7 +296,9 @@ class UnrevisedLemkeSolver final : public SolverBase {
   mutable MatrixX<T> M_alpha_beta_, M_alpha_bar_beta_;
   mutable VectorX<T> q_alpha_, q_alpha_bar_, q_prime_beta_prime_,
       q_prime_alpha_bar_prime_, e_, M_prime_driving_beta_prime_,
-      M_prime_driving_alpha_bar_prime_, g_alpha_, g_alpha_bar_;
+      M_prime_driving_alpha_bar_prime_, g_alpha_, g_alpha_bar_, q_prime_,
+      M_prime_col_, ratios_;
+  mutable std::vector<int> blocking_indices_;
 
   // The index sets for the Lemke Algorithm and is a member variable to
   // permit warmstarting. Changing the index set between invocations of the LCP
@@ -280,6 +310,9 @@ class UnrevisedLemkeSolver final : public SolverBase {
   // variables to permit warmstarting. Changing these sets between invocations
   // of the LCP solver will not change the resulting computation.
   mutable std::vector<LCPVariable> indep_variables_, dep_variables_;
+
+  // The basis of the last solution found by SolveLcpLemke().
+  mutable std::vector<int> basis_;
 };
 
 }  // end namespace solvers
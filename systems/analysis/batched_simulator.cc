@@ -0,0 +1,149 @@
+#include "drake/systems/analysis/batched_simulator.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+std::vector<std::unique_ptr<Simulator<double>>> MakeSimulators(
+    const System<double>& system, int num_copies) {
+  DRAKE_THROW_UNLESS(num_copies >= 1);
+  std::vector<std::unique_ptr<Simulator<double>>> simulators;
+  simulators.reserve(num_copies);
+  for (int i = 0; i < num_copies; ++i) {
+    simulators.push_back(std::make_unique<Simulator<double>>(system));
+  }
+  return simulators;
+}
+
+std::vector<std::unique_ptr<Simulator<double>>> ForkSimulators(
+    const Simulator<double>& root, int num_copies) {
+  DRAKE_THROW_UNLESS(num_copies >= 1);
+  std::vector<std::unique_ptr<Simulator<double>>> simulators;
+  simulators.reserve(num_copies);
+  for (int i = 0; i < num_copies; ++i) {
+    simulators.push_back(root.Fork());
+  }
+  return simulators;
+}
+
+}  // namespace
+
+BatchedSimulator::BatchedSimulator(const System<double>& system,
+                                   int num_copies, int num_parallel_executions)
+    : BatchedSimulator(MakeSimulators(system, num_copies),
+                       num_parallel_executions) {}
+
+BatchedSimulator::BatchedSimulator(const Simulator<double>& root,
+                                   int num_copies, int num_parallel_executions)
+    : BatchedSimulator(ForkSimulators(root, num_copies),
+                       num_parallel_executions) {}
+
+BatchedSimulator::BatchedSimulator(
+    std::vector<std::unique_ptr<Simulator<double>>> simulators,
+    int num_parallel_executions)
+    : simulators_(std::move(simulators)),
+      num_parallel_executions_(num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions >= 1);
+}
+
+const Simulator<double>& BatchedSimulator::get_simulator(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < num_copies());
+  return *simulators_[i];
+}
+
+Simulator<double>& BatchedSimulator::get_mutable_simulator(int i) {
+  DRAKE_THROW_UNLESS(i >= 0 && i < num_copies());
+  return *simulators_[i];
+}
+
+void BatchedSimulator::ForEachCopy(
+    const std::function<void(int)>& body) const {
+  StaticParallelForIndexLoop(num_parallel_executions_, 0, num_copies(),
+                             [&body](int, int i) { body(i); });
+}
+
+void BatchedSimulator::Initialize() {
+  ForEachCopy([this](int i) { simulators_[i]->Initialize(); });
+}
+
+void BatchedSimulator::FixInputs(
+    const InputPort<double>& port,
+    const Eigen::Ref<const Eigen::MatrixXd>& values) {
+  DRAKE_THROW_UNLESS(values.rows() == port.size());
+  DRAKE_THROW_UNLESS(values.cols() == num_copies());
+  for (int i = 0; i < num_copies(); ++i) {
+    port.FixValue(&simulators_[i]->get_mutable_context(),
+                  Eigen::VectorXd(values.col(i)));
+  }
+}
+
+void BatchedSimulator::AdvanceBy(double duration) {
+  DRAKE_THROW_UNLESS(duration >= 0);
+  ForEachCopy([this, duration](int i) {
+    Simulator<double>& simulator = *simulators_[i];
+    simulator.AdvanceTo(simulator.get_context().get_time() + duration);
+  });
+}
+
+Eigen::MatrixXd BatchedSimulator::EvalOutputs(
+    const OutputPort<double>& port) const {
+  Eigen::MatrixXd outputs(port.size(), num_copies());
+  ForEachCopy([this, &port, &outputs](int i) {
+    outputs.col(i) = port.Eval(simulators_[i]->get_context());
+  });
+  return outputs;
+}
+
+int BatchedSimulator::num_states() const {
+  const Context<double>& context = simulators_[0]->get_context();
+  int size = context.num_continuous_states();
+  for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+    size += context.get_discrete_state(g).size();
+  }
+  return size;
+}
+
+Eigen::MatrixXd BatchedSimulator::GetStates() const {
+  Eigen::MatrixXd states(num_states(), num_copies());
+  ForEachCopy([this, &states](int i) {
+    const Context<double>& context = simulators_[i]->get_context();
+    const int num_continuous = context.num_continuous_states();
+    states.col(i).head(num_continuous) =
+        context.get_continuous_state_vector().CopyToVector();
+    int start = num_continuous;
+    for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+      const BasicVector<double>& group = context.get_discrete_state(g);
+      states.col(i).segment(start, group.size()) = group.get_value();
+      start += group.size();
+    }
+  });
+  return states;
+}
+
+void BatchedSimulator::SetStates(
+    const Eigen::Ref<const Eigen::MatrixXd>& states) {
+  DRAKE_THROW_UNLESS(states.rows() == num_states());
+  DRAKE_THROW_UNLESS(states.cols() == num_copies());
+  ForEachCopy([this, &states](int i) {
+    Context<double>& context = simulators_[i]->get_mutable_context();
+    const int num_continuous = context.num_continuous_states();
+    context.get_mutable_continuous_state_vector().SetFromVector(
+        states.col(i).head(num_continuous));
+    int start = num_continuous;
+    for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+      BasicVector<double>& group = context.get_mutable_discrete_state(g);
+      group.SetFromVector(states.col(i).segment(start, group.size()));
+      start += group.size();
+    }
+  });
+}
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/input_port.h"
+#include "drake/systems/framework/output_port.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+/**
+ * Simulates N copies of one System side by side (e.g., the environments of a
+ * reinforcement learning algorithm), as N Simulators that share the System,
+ * and hence its topology (for a MultibodyPlant, its MultibodyTree), but each
+ * have their own Context. The copies are advanced together, on up to
+ * `num_parallel_executions` threads, and their inputs, outputs and states
+ * are exchanged as matrices with one column per copy, so that a batch of
+ * actions goes in, and a batch of observations and rewards (which are output
+ * ports of the System) comes out, as contiguous arrays.
+ *
+ * @code
+ *   BatchedSimulator batch(diagram, 1024, 8);
+ *   batch.Initialize();
+ *   for (int k = 0; k < num_steps; ++k) {
+ *     batch.FixInputs(diagram.get_input_port(0), actions);  // nu x 1024
+ *     batch.AdvanceBy(0.01);
+ *     observations = batch.EvalOutputs(diagram.get_output_port(0));
+ *     rewards = batch.EvalOutputs(diagram.get_output_port(1));  // 1 x 1024
+ *   }
+ * @endcode
+ *
+ * When `num_parallel_executions` is greater than one, the System's
+ * computations must be safe to perform concurrently on different Contexts.
+ *
+ * @ingroup analysis
+ */
+class BatchedSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchedSimulator)
+
+  /**
+   * Creates @p num_copies simulators of @p system, each with a default
+   * Context. The @p system must outlive this object.
+   * @throws std::exception if @p num_copies or @p num_parallel_executions is
+   * less than one.
+   */
+  BatchedSimulator(const System<double>& system, int num_copies,
+                   int num_parallel_executions = 1);
+
+  /**
+   * Creates @p num_copies forks of @p root (see Simulator::Fork()), which
+   * continue from its current trajectory value with its integrator settings.
+   * The System of @p root must outlive this object.
+   * @throws std::exception if @p num_copies or @p num_parallel_executions is
+   * less than one, or for the reasons listed in Simulator::Fork().
+   */
+  BatchedSimulator(const Simulator<double>& root, int num_copies,
+                   int num_parallel_executions = 1);
+
+  /// Returns the number N of copies.
+  int num_copies() const { return static_cast<int>(simulators_.size()); }
+
+  /// Returns the System that is simulated.
+  const System<double>& get_system() const {
+    return simulators_[0]->get_system();
+  }
+
+  /// Returns the simulator of copy @p i.
+  const Simulator<double>& get_simulator(int i) const;
+
+  /// Returns the simulator of copy @p i, e.g., to configure its integrator.
+  Simulator<double>& get_mutable_simulator(int i);
+
+  /// Returns the Context of copy @p i.
+  const Context<double>& get_context(int i) const {
+    return get_simulator(i).get_context();
+  }
+
+  /// Returns the Context of copy @p i.
+  Context<double>& get_mutable_context(int i) {
+    return get_mutable_simulator(i).get_mutable_context();
+  }
+
+  /// Initializes all of the copies (see Simulator::Initialize()).
+  void Initialize();
+
+  /**
+   * Fixes the value of the vector-valued input @p port of each copy i to the
+   * column i of @p values, which has as many rows as the port has elements.
+   */
+  void FixInputs(const InputPort<double>& port,
+                 const Eigen::Ref<const Eigen::MatrixXd>& values);
+
+  /**
+   * Advances each copy by @p duration from its own current time (see
+   * Simulator::AdvanceTo()).
+   * @throws std::exception if a copy throws, after all copies have advanced
+   * or failed; the exception of the lowest-numbered failing copy is rethrown.
+   */
+  void AdvanceBy(double duration);
+
+  /**
+   * Evaluates the vector-valued output @p port of every copy, into the
+   * columns of a matrix with as many rows as the port has elements.
+   */
+  Eigen::MatrixXd EvalOutputs(const OutputPort<double>& port) const;
+
+  /**
+   * Returns the states of the copies, as the columns of a matrix. Each column
+   * stacks the continuous state and then each group of discrete state (the
+   * abstract state is not included).
+   */
+  Eigen::MatrixXd GetStates() const;
+
+  /**
+   * Sets the states of the copies to the columns of @p states, as stacked by
+   * GetStates(), e.g., to reset some of the copies.
+   * @throws std::exception if @p states has the wrong size.
+   */
+  void SetStates(const Eigen::Ref<const Eigen::MatrixXd>& states);
+
+ private:
+  BatchedSimulator(std::vector<std::unique_ptr<Simulator<double>>> simulators,
+                   int num_parallel_executions);
+
+  // Evaluates `body(i)` for each copy i, on up to num_parallel_executions_
+  // threads.
+  void ForEachCopy(const std::function<void(int)>& body) const;
+
+  // Returns the number of elements of the states of GetStates().
+  int num_states() const;
+
+  std::vector<std::unique_ptr<Simulator<double>>> simulators_;
+  int num_parallel_executions_{};
+};
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
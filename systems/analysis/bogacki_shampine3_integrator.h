@@ -61,6 +61,11 @@ class BogackiShampine3Integrator final : public IntegratorBase<T> {
   int get_error_estimate_order() const override { return 3; }
 
  private:
+  std::unique_ptr<IntegratorBase<T>> DoClone(
+      Context<T>* context) const override {
+    return std::make_unique<BogackiShampine3Integrator<T>>(this->get_system(),
+        context);
+  }
   void DoInitialize() override;
   bool DoStep(const T& h) override;
 
@@ -0,0 +1,77 @@
+#include "drake/systems/analysis/branch_simulation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+std::vector<double> SimulateBranches(const Simulator<double>& root,
+                                     const BranchFunction& simulate_branch,
+                                     int num_branches,
+                                     int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions >= 1);
+
+  std::vector<double> outputs(std::max(num_branches, 0));
+  const int num_threads =
+      std::min(num_parallel_executions, static_cast<int>(outputs.size()));
+  if (num_threads <= 1) {
+    for (int i = 0; i < static_cast<int>(outputs.size()); ++i) {
+      outputs[i] = simulate_branch(i, root.Fork().get());
+    }
+    return outputs;
+  }
+
+  // Each worker repeatedly claims the next unclaimed branch; every branch
+  // writes only to its own slot in `outputs` and `errors`. Forking only reads
+  // the root, but is serialized anyway since the root's Context is not
+  // documented to be safe for concurrent reads.
+  std::mutex fork_mutex;
+  std::atomic<int> next_branch{0};
+  std::atomic<bool> failed{false};
+  std::vector<std::exception_ptr> errors(outputs.size());
+  auto worker = [&]() {
+    while (!failed) {
+      const int i = next_branch++;
+      if (i >= static_cast<int>(outputs.size())) {
+        return;
+      }
+      try {
+        std::unique_ptr<Simulator<double>> fork;
+        {
+          std::lock_guard<std::mutex> lock(fork_mutex);
+          fork = root.Fork();
+        }
+        outputs[i] = simulate_branch(i, fork.get());
+      } catch (...) {
+        errors[i] = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return outputs;
+}
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+/**
+ * Defines one branch of a branching simulation. It is given the index of the
+ * branch and a fork of the root Simulator (see Simulator::Fork()), which it
+ * may modify (e.g., by fixing different input values) and advance, and
+ * returns the value of interest for that branch.
+ */
+typedef std::function<double(int branch, Simulator<double>* simulator)>
+    BranchFunction;
+
+/**
+ * Runs @p num_branches simulations that all continue from the current
+ * trajectory value of @p root, without re-running its initialization.
+ *
+ * In pseudo-code, this algorithm implements:
+ * @code
+ *   for i=0:num_branches-1
+ *     outputs(i) = simulate_branch(i, root.Fork())
+ *   return outputs
+ * @endcode
+ *
+ * @p root itself is not modified, so it may be advanced further and branched
+ * again (e.g., for rollout-based planning).
+ *
+ * @param num_parallel_executions Number of worker threads used to run the
+ * branches.  When this is greater than one, @p simulate_branch must be safe to
+ * call concurrently, and so must the System's computations.  The default of
+ * one runs every branch on the calling thread.
+ *
+ * @returns the outputs of @p simulate_branch, in branch order.
+ *
+ * @throws std::exception if @p num_parallel_executions is less than one, or
+ * for the reasons listed in Simulator::Fork().  If any branch throws, the
+ * remaining branches are abandoned and the exception from the lowest-numbered
+ * failing branch is rethrown.
+ *
+ * @ingroup analysis
+ */
+std::vector<double> SimulateBranches(const Simulator<double>& root,
+                                     const BranchFunction& simulate_branch,
+                                     int num_branches,
+                                     int num_parallel_executions = 1);
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -48,6 +48,11 @@ class ExplicitEulerIntegrator final : public IntegratorBase<T> {
   int get_error_estimate_order() const override { return 0; }
 
  private:
+  std::unique_ptr<IntegratorBase<T>> DoClone(
+      Context<T>* context) const override {
+    return std::make_unique<ExplicitEulerIntegrator<T>>(
+        this->get_system(), this->get_maximum_step_size(), context);
+  }
   bool DoStep(const T& dt) override;
 };
 
@@ -12,7 +12,6 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/extract_double.h"
-#include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/systems/analysis/stepwise_dense_output.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/vector_base.h"
@@ -84,9 +83,13 @@ ExtractDoublesOrThrow(const std::vector<MatrixX<S>>& input_vector) {
 /// of the integration scheme being used for up to 3rd order schemes (see
 /// [Hairer, 1993]).
 ///
-/// From a performance standpoint, memory footprint and evaluation overhead
-/// (i.e. the computational cost of an evaluation) increase linearly and
-/// logarithmically with the amount of steps taken, respectively.
+/// From a performance standpoint, the cubic polynomial coefficients of all
+/// steps are stored contiguously, so the memory footprint increases linearly
+/// with the amount of steps taken, unless a maximum time span is set (see
+/// set_maximum_time_span()). Evaluation overhead (i.e. the computational cost
+/// of an evaluation) is constant for successive evaluations in increasing
+/// time order and increases logarithmically with the amount of steps taken
+/// otherwise.
 ///
 /// - [Engquist, 2105] B. Engquist. Encyclopedia of Applied and Computational
 ///                    Mathematics, p. 339, Springer, 2015.
@@ -108,10 +111,6 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
   /// This step definition allows for intermediate time, state and state
   /// derivative triplets (e.g. the integrator internal stages) to improve
   /// interpolation.
-  ///
-  /// @note The use of column matrices instead of plain vectors helps reduce
-  ///       HermitianDenseOutput construction overhead, as this type of dense
-  ///       output leverages a PiecewisePolynomial instance that takes matrices.
   class IntegrationStep {
    public:
     DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(IntegrationStep)
@@ -272,36 +271,83 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
       throw std::logic_error("No updates to consolidate.");
     }
     for (const IntegrationStep& step : raw_steps_) {
-      continuous_trajectory_.ConcatenateInTime(
-          trajectories::PiecewisePolynomial<double>::Cubic(
-              internal::ExtractDoublesOrThrow(step.get_times()),
-              internal::ExtractDoublesOrThrow(step.get_states()),
-              internal::ExtractDoublesOrThrow(step.get_state_derivatives())));
+      AppendSegments(step);
     }
-    start_time_ = continuous_trajectory_.start_time();
-    end_time_ = continuous_trajectory_.end_time();
+    EvictSegmentsOutsideTimeSpan();
+    start_time_ = breaks_[first_segment_];
+    end_time_ = breaks_.back();
     last_consolidated_step_ = std::move(raw_steps_.back());
     raw_steps_.clear();
   }
 
+  using StepwiseDenseOutput<T>::Evaluate;
+
+  /// Evaluates the output at each of the given @p times, in any order.
+  /// This is cheaper than evaluating each time one by one, in particular
+  /// for times in increasing order.
+  ///
+  /// @param times The times to evaluate the output at.
+  /// @returns The output values, one per column, in the order of @p times.
+  /// @throws std::logic_error if the output is empty.
+  /// @throws std::runtime_error if any of the given @p times is out of the
+  ///                            output's [start_time(), end_time()] domain.
+  MatrixX<T> Evaluate(const std::vector<T>& times) const {
+    this->ThrowIfOutputIsEmpty(__func__);
+    MatrixX<T> values(size_, static_cast<int>(times.size()));
+    for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+      this->ThrowIfTimeIsInvalid(__func__, times[i]);
+      values.col(i) = DoEvaluate(times[i]);
+    }
+    return values;
+  }
+
+  /// Sets the maximum time span covered by this output, i.e. the length of
+  /// the sliding window of the most recent integration steps that are kept.
+  /// Upon consolidation, the steps which end earlier than end_time() - @p
+  /// time_span are evicted, so that start_time() moves forward and the
+  /// memory footprint remains bounded over long integrations. The last
+  /// consolidated step is always kept. By default, the time span is infinite
+  /// and no step is ever evicted.
+  ///
+  /// @param time_span The maximum time span of the output.
+  /// @throws std::runtime_error if @p time_span is not positive.
+  void set_maximum_time_span(const T& time_span) {
+    const double time_span_value = ExtractDoubleOrThrow(time_span);
+    if (!(time_span_value > 0.)) {
+      throw std::runtime_error("Maximum time span must be positive.");
+    }
+    maximum_time_span_ = time_span_value;
+  }
+
  protected:
   VectorX<T> DoEvaluate(const T& t) const override {
-    const MatrixX<double> matrix_value =
-        continuous_trajectory_.value(ExtractDoubleOrThrow(t));
-    return matrix_value.col(0).cast<T>();
+    const double t_value = ExtractDoubleOrThrow(t);
+    const int segment = FindSegment(t_value);
+    const double s = t_value - breaks_[segment];
+    const Eigen::Map<const MatrixX<double>> coefficients(
+        &coefficients_[4 * size_ * segment], size_, 4);
+    // Evaluates the cubic polynomial with Horner's method.
+    const VectorX<double> value =
+        ((coefficients.col(3) * s + coefficients.col(2)) * s +
+         coefficients.col(1)) * s + coefficients.col(0);
+    return value.cast<T>();
   }
 
   T DoEvaluateNth(const T& t, const int n) const override {
-    return continuous_trajectory_.scalarValue(
-        ExtractDoubleOrThrow(t), n, 0);
+    const double t_value = ExtractDoubleOrThrow(t);
+    const int segment = FindSegment(t_value);
+    const double s = t_value - breaks_[segment];
+    const double* coefficients = &coefficients_[4 * size_ * segment + n];
+    return ((coefficients[3 * size_] * s + coefficients[2 * size_]) * s +
+            coefficients[size_]) * s + coefficients[0];
   }
 
   bool do_is_empty() const override {
-    return continuous_trajectory_.empty();
+    return num_segments() == 0;
   }
 
   int do_size() const override {
-    return continuous_trajectory_.rows();
+    return size_;
   }
 
   const T& do_end_time() const override { return end_time_; }
@@ -320,7 +366,7 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
     }
     if (!raw_steps_.empty()) {
       EnsureOutputConsistencyOrThrow(step, raw_steps_.back());
-    } else if (!continuous_trajectory_.empty()) {
+    } else if (num_segments() > 0) {
       EnsureOutputConsistencyOrThrow(step, last_consolidated_step_);
     }
   }
@@ -372,31 +418,120 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
     }
   }
 
-  // TODO(hidmic): Remove redundant time-keeping member fields when
-  // PiecewisePolynomial supports return by-reference of its time extents.
-  // It currently returns them by-value, double type only, and thus the
-  // need for this storage in order to meet DenseOutput::start_time()
-  // and DenseOutput::end_time() API.
+  // Returns the number of cubic segments in the output.
+  int num_segments() const {
+    return breaks_.empty() ?
+        0 : static_cast<int>(breaks_.size()) - 1 - first_segment_;
+  }
+
+  // Appends the Hermite cubic segments between each consecutive pair of
+  // time, state and state derivative triplets in the given @p step.
+  void AppendSegments(const IntegrationStep& step) {
+    const std::vector<double> times =
+        internal::ExtractDoublesOrThrow(step.get_times());
+    // Aligns the step start time with the end of the output, as the
+    // misalignment (if any) is negligible.
+    const double time_offset =
+        breaks_.empty() ? 0. : breaks_.back() - times.front();
+    if (breaks_.empty()) {
+      size_ = step.size();
+      breaks_.push_back(times.front());
+    }
+    const std::vector<MatrixX<double>> states =
+        internal::ExtractDoublesOrThrow(step.get_states());
+    const std::vector<MatrixX<double>> state_derivatives =
+        internal::ExtractDoublesOrThrow(step.get_state_derivatives());
+    coefficients_.reserve(coefficients_.size() +
+                          4 * size_ * (times.size() - 1));
+    for (int i = 0; i + 1 < static_cast<int>(times.size()); ++i) {
+      const double h = times[i + 1] - times[i];
+      const VectorX<double> slope = (states[i + 1] - states[i]) / h;
+      const MatrixX<double>& d0 = state_derivatives[i];
+      const MatrixX<double>& d1 = state_derivatives[i + 1];
+      // Coefficients of x(t) = a₀ + a₁ s + a₂ s² + a₃ s³, with s = t - tᵢ,
+      // stored contiguously as the columns of a size_ x 4 matrix.
+      const size_t offset = coefficients_.size();
+      coefficients_.resize(offset + 4 * size_);
+      Eigen::Map<MatrixX<double>> coefficients(
+          &coefficients_[offset], size_, 4);
+      coefficients.col(0) = states[i];
+      coefficients.col(1) = d0;
+      coefficients.col(2) = (3. * slope - 2. * d0 - d1) / h;
+      coefficients.col(3) = (d0 + d1 - 2. * slope) / (h * h);
+      breaks_.push_back(times[i + 1] + time_offset);
+    }
+  }
+
+  // Evicts the segments which end before the maximum time span, keeping at
+  // least one segment. The evicted segments storage is only released once
+  // it takes up most of the storage, so that eviction has an amortized
+  // constant cost per segment.
+  void EvictSegmentsOutsideTimeSpan() {
+    const double earliest_time = breaks_.back() - maximum_time_span_;
+    while (num_segments() > 1 && breaks_[first_segment_ + 1] < earliest_time) {
+      ++first_segment_;
+    }
+    if (first_segment_ > num_segments()) {
+      breaks_.erase(breaks_.begin(), breaks_.begin() + first_segment_);
+      coefficients_.erase(coefficients_.begin(),
+                          coefficients_.begin() + 4 * size_ * first_segment_);
+      first_segment_ = 0;
+    }
+    last_segment_ = first_segment_;
+  }
+
+  // Finds the segment whose time interval contains the given time @p t,
+  // trying the last segment found and the one after it before resorting to
+  // a binary search. Successive queries in increasing time order are thus
+  // constant time.
+  // @pre @p t is within the output's domain.
+  int FindSegment(double t) const {
+    const auto contains = [this, t](int segment) {
+      return breaks_[segment] <= t && t <= breaks_[segment + 1];
+    };
+    if (!contains(last_segment_)) {
+      const int last = static_cast<int>(breaks_.size()) - 2;
+      if (last_segment_ < last && contains(last_segment_ + 1)) {
+        ++last_segment_;
+      } else {
+        const auto it = std::upper_bound(
+            breaks_.begin() + first_segment_ + 1, breaks_.end() - 1, t);
+        last_segment_ = static_cast<int>(it - breaks_.begin()) - 1;
+      }
+    }
+    return last_segment_;
+  }
 
   // The smallest time at which the output is defined.
   T start_time_{};
   // The largest time at which the output is defined.
   T end_time_{};
 
-  // The last integration step consolidated into `continuous_trajectory_`,
-  // useful to validate the next integration steps.
+  // The last integration step consolidated into the output, useful to
+  // validate the next integration steps.
   // @see EnsureOutputConsistencyOrThrow
   IntegrationStep last_consolidated_step_{};
 
   // The integration steps taken but not consolidated yet (via Consolidate()).
   std::vector<IntegrationStep> raw_steps_{};
 
-  // TODO(hidmic): When PiecewisePolynomial supports scalar types other than
-  // doubles, pass in the template parameter T to it too and remove all scalar
-  // type conversions.
-
-  // The underlying PiecewisePolynomial continuous trajectory.
-  trajectories::PiecewisePolynomial<double> continuous_trajectory_{};
+  // TODO(hidmic): When scalar types other than doubles are supported by the
+  // interpolation, store them as T and remove all scalar type conversions.
+
+  // The output state dimension.
+  int size_{0};
+  // The times delimiting the cubic segments, in increasing order. The
+  // segments before `first_segment_` have been evicted.
+  std::vector<double> breaks_{};
+  // The cubic polynomial coefficients of all segments, contiguously. Those of
+  // the i-th segment are the 4 * size_ values starting at 4 * size_ * i.
+  std::vector<double> coefficients_{};
+  // The index of the first segment that hasn't been evicted.
+  int first_segment_{0};
+  // The maximum time span of the output.
+  double maximum_time_span_{std::numeric_limits<double>::infinity()};
+  // The index of the last segment found, as a hint for the next lookup.
+  mutable int last_segment_{0};
 };
 
 }  // namespace systems
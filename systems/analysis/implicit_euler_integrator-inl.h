@@ -38,6 +38,13 @@ void ImplicitEulerIntegrator<T>::DoInitialize() {
   // Allocate storage for changes to state variables during Newton-Raphson.
   dx_state_ = this->get_system().AllocateTimeDerivatives();
 
+  // Size the working vectors once, so that steps don't allocate them.
+  const int n = this->get_context().num_continuous_states();
+  for (VectorX<T>* vec : {&err_est_vec_, &xt0_, &xdot_, &xtplus_ie_,
+                          &xtplus_tr_, &dx0_, &goutput_}) {
+    vec->resize(n);
+  }
+
   const double kDefaultAccuracy = 1e-1;  // Good for this particular integrator.
   const double kLoosestAccuracy = 5e-1;  // Loosest accuracy is quite loose.
 
@@ -111,7 +118,9 @@ ComputeAndFactorImplicitTrapezoidIterationMatrix(
 // @param t0 the time at the left end of the integration interval.
 // @param h the integration step size (> 0) to attempt.
 // @param xt0 the continuous state at t0.
-// @param g the particular implicit function to compute the root of.
+// @param g the particular implicit function to compute the root of, which
+//        writes its value at the state in the context to its (pre-sized)
+//        argument.
 // @param [in, out] the starting guess for x(t0+h); the value for x(t0+h) on
 //        return.
 // @param trial the attempt for this approach (1-4). StepAbstract() uses more
@@ -124,7 +133,7 @@ ComputeAndFactorImplicitTrapezoidIterationMatrix(
 //                calls MaybeFreshenMatrices()) in a unit test).
 template <class T>
 bool ImplicitEulerIntegrator<T>::StepAbstract(const T& t0, const T& h,
-    const VectorX<T>& xt0, const std::function<VectorX<T>()>& g,
+    const VectorX<T>& xt0, const std::function<void(VectorX<T>*)>& g,
     const std::function<void(const MatrixX<T>&, const T&,
         typename ImplicitIntegrator<T>::IterationMatrix*)>&
         compute_and_factor_iteration_matrix,
@@ -148,7 +157,8 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& t0, const T& h,
 
   // Evaluate the residual error using:
   // g(x(t0+h)) = x(t0+h) - x(t0) - h f(t0+h,x(t0+h)).
-  VectorX<T> goutput = g();
+  goutput_.resize(xt0.size());
+  g(&goutput_);
 
   // Initialize the "last" state update norm; this will be used to detect
   // convergence.
@@ -169,7 +179,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& t0, const T& h,
     // Compute the state update using the equation A*x = -g(), where A is the
     // iteration matrix.
     // TODO(edrumwri): Allow caller to provide their own solver.
-    VectorX<T> dx = iteration_matrix_.Solve(-goutput);
+    VectorX<T> dx = iteration_matrix_.Solve(-goutput_);
 
     // Get the infinity norm of the weighted update vector.
     dx_state_->get_mutable_vector().SetFromVector(dx);
@@ -212,6 +222,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& t0, const T& h,
       if (eta * dx_norm < k_dot_tol) {
         SPDLOG_DEBUG(drake::log(), "Newton-Raphson converged; η = {}, h = {}",
                      eta, h);
+        this->NoteNewtonRaphsonConvergenceRate(theta);
         return true;
       }
     }
@@ -220,7 +231,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& t0, const T& h,
     last_dx_norm = dx_norm;
 
     // Update the state in the context and compute g(xⁱ⁺¹).
-    goutput = g();
+    g(&goutput_);
   }
 
   SPDLOG_DEBUG(drake::log(), "StepAbstract() convergence failed");
@@ -257,19 +268,34 @@ bool ImplicitEulerIntegrator<T>::StepImplicitEuler(const T& t0, const T& h,
 
   // Set g for the implicit Euler method.
   Context<T>* context = this->get_mutable_context();
-  std::function<VectorX<T>()> g =
-      [&xt0, h, context, this]() {
-        return (context->get_continuous_state().CopyToVector() - xt0 -
-            h * this->EvalTimeDerivatives(*context).CopyToVector()).eval();
+  std::function<void(VectorX<T>*)> g =
+      [&xt0, h, context, this](VectorX<T>* goutput) {
+        context->get_continuous_state().get_vector().CopyToPreSizedVector(
+            goutput);
+        *goutput -= xt0;
+        this->EvalTimeDerivatives(*context).get_vector().ScaleAndAddToVector(
+            -h, goutput);
       };
 
   // Use the current state as the candidate value for the next state.
   // [Hairer 1996] validates this choice (p. 120).
   *xtplus = xt0;
 
+  // Form the iteration matrix sparsely when the System provides the Jacobian.
+  auto compute_and_factor_iteration_matrix = [this](const MatrixX<T>& J,
+      const T& dt,
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+    if (this->use_sparse_iteration_matrix()) {
+      iteration_matrix->SetAndFactorIterationMatrix(
+          this->CalcSparseIterationMatrix(-dt));
+    } else {
+      ComputeAndFactorImplicitEulerIterationMatrix(J, dt, iteration_matrix);
+    }
+  };
+
   // Attempt the step.
   return StepAbstract(
-      t0, h, xt0, g, ComputeAndFactorImplicitEulerIterationMatrix, &*xtplus);
+      t0, h, xt0, g, compute_and_factor_iteration_matrix, &*xtplus);
 }
 
 // Steps forward by a single step of `h` using the implicit trapezoid
@@ -295,11 +321,16 @@ bool ImplicitEulerIntegrator<T>::StepImplicitTrapezoid(const T& t0, const T& h,
   // Define g(x(t+h)) ≡ x(t0+h) - x(t0) - h/2 (f(t0,x(t0)) + f(t0+h,x(t0+h)) and
   // evaluate it at the current x(t+h).
   Context<T>* context = this->get_mutable_context();
-  std::function<VectorX<T>()> g =
-      [&xt0, h, &dx0, context, this]() {
-        return (context->get_continuous_state().CopyToVector() - xt0 - h/2 *
-            (dx0 + this->EvalTimeDerivatives(
-                *context).CopyToVector().eval())).eval();
+  // The derivatives at x(t0+h) are copied into xdot_, which is free here.
+  std::function<void(VectorX<T>*)> g =
+      [&xt0, h, &dx0, context, this](VectorX<T>* goutput) {
+        this->EvalTimeDerivatives(*context).get_vector().CopyToPreSizedVector(
+            &xdot_);
+        xdot_ += dx0;
+        context->get_continuous_state().get_vector().CopyToPreSizedVector(
+            goutput);
+        *goutput -= xt0;
+        *goutput -= h / 2 * xdot_;
       };
 
   // Store statistics before calling StepAbstract(). The difference between
@@ -314,9 +345,22 @@ bool ImplicitEulerIntegrator<T>::StepImplicitTrapezoid(const T& t0, const T& h,
       this->get_num_derivative_evaluations_for_jacobian();
   int stored_num_nr_iterations = this->get_num_newton_raphson_iterations();
 
+  // Form the iteration matrix sparsely when the System provides the Jacobian.
+  auto compute_and_factor_iteration_matrix = [this](const MatrixX<T>& J,
+      const T& dt,
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+    if (this->use_sparse_iteration_matrix()) {
+      iteration_matrix->SetAndFactorIterationMatrix(
+          this->CalcSparseIterationMatrix(-dt / 2.0));
+    } else {
+      ComputeAndFactorImplicitTrapezoidIterationMatrix(
+          J, dt, iteration_matrix);
+    }
+  };
+
   // Attempt to step.
   bool success = StepAbstract(
-      t0, h, xt0, g, ComputeAndFactorImplicitTrapezoidIterationMatrix, xtplus);
+      t0, h, xt0, g, compute_and_factor_iteration_matrix, xtplus);
 
   // Move statistics to implicit trapezoid-specific.
   num_err_est_jacobian_reforms_ +=
@@ -354,8 +398,9 @@ bool ImplicitEulerIntegrator<T>::AttemptStepPaired(const T& t0, const T& h,
   // is calculated at this point (early on in the integration process) in order
   // to reuse the derivative evaluation, via the cache, from the last
   // integration step (if possible).
-  const VectorX<T> dx0 = this->EvalTimeDerivatives(
-      this->get_context()).CopyToVector();
+  dx0_.resize(xt0.size());
+  this->EvalTimeDerivatives(this->get_context()).get_vector()
+      .CopyToPreSizedVector(&dx0_);
 
   // Do the Euler step.
   if (!StepImplicitEuler(t0, h, xt0, xtplus_ie)) {
@@ -380,7 +425,7 @@ bool ImplicitEulerIntegrator<T>::AttemptStepPaired(const T& t0, const T& h,
 
   // Attempt to compute the implicit trapezoid solution.
   *xtplus_itr = *xtplus_ie;
-  if (StepImplicitTrapezoid(t0, h, xt0, dx0, xtplus_itr)) {
+  if (StepImplicitTrapezoid(t0, h, xt0, dx0_, xtplus_itr)) {
     // Reset the state to that computed by implicit Euler.
     // TODO(edrumwri): Explore using the implicit trapezoid method solution
     //                 instead as *the* solution, rather than the implicit
@@ -407,9 +452,14 @@ bool ImplicitEulerIntegrator<T>::DoImplicitIntegratorStep(const T& h) {
   const T t0 = context->get_time();
   SPDLOG_DEBUG(drake::log(), "IE DoStep(h={}) t={}", h, t0);
 
-  xt0_ = context->get_continuous_state().CopyToVector();
-  xtplus_ie_.resize(xt0_.size());
-  xtplus_tr_.resize(xt0_.size());
+  // These resizes are no-ops unless the system has changed size since
+  // DoInitialize().
+  const int n = context->num_continuous_states();
+  xt0_.resize(n);
+  xdot_.resize(n);
+  xtplus_ie_.resize(n);
+  xtplus_tr_.resize(n);
+  context->get_continuous_state().get_vector().CopyToPreSizedVector(&xt0_);
 
   // If the requested h is less than the minimum step size, we'll advance time
   // using an explicit Euler step.
@@ -429,7 +479,8 @@ bool ImplicitEulerIntegrator<T>::DoImplicitIntegratorStep(const T& h) {
     // integrator.
 
     // Compute the Euler step.
-    xdot_ = this->EvalTimeDerivatives(*context).CopyToVector();
+    this->EvalTimeDerivatives(*context).get_vector().CopyToPreSizedVector(
+        &xdot_);
     xtplus_ie_ = xt0_ + h * xdot_;
 
     // Compute the RK2 step.
@@ -440,7 +491,8 @@ bool ImplicitEulerIntegrator<T>::DoImplicitIntegratorStep(const T& h) {
     }
 
     const int evals_after_rk2 = rk2_->get_num_derivative_evaluations();
-    xtplus_tr_ = context->get_continuous_state().CopyToVector();
+    context->get_continuous_state().get_vector().CopyToPreSizedVector(
+        &xtplus_tr_);
 
     // Update the error estimation ODE counts.
     num_err_est_function_evaluations_ += (evals_after_rk2 - evals_before_rk2);
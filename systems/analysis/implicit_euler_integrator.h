@@ -131,7 +131,7 @@ class ImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   bool AttemptStepPaired(const T& t0, const T& h, const VectorX<T>& xt0,
       VectorX<T>* xtplus_euler, VectorX<T>* xtplus_trap);
   bool StepAbstract(const T& t0, const T& h, const VectorX<T>& xt0,
-      const std::function<VectorX<T>()>& g,
+      const std::function<void(VectorX<T>*)>& g,
       const std::function<void(const MatrixX<T>&, const T&,
           typename ImplicitIntegrator<T>::IterationMatrix*)>&
           compute_and_factor_iteration_matrix,
@@ -156,9 +156,13 @@ class ImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The continuous state update vector used during Newton-Raphson.
   std::unique_ptr<ContinuousState<T>> dx_state_;
 
-  // Variables to avoid heap allocations.
+  // Variables to avoid heap allocations; they are sized in DoInitialize().
   VectorX<T> xt0_, xdot_, xtplus_ie_, xtplus_tr_;
 
+  // The time derivatives at the start of a step, and the output of the
+  // residual function of StepAbstract(); also sized in DoInitialize().
+  VectorX<T> dx0_, goutput_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include <memory>
 #include <utility>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
@@ -51,7 +54,16 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     kCentralDifference,
 
     /// Automatic differentiation.
-    kAutomatic
+    kAutomatic,
+
+    /// Jacobian supplied by the System itself through
+    /// System::CalcTimeDerivativesJacobian(). No time derivative evaluations
+    /// are spent forming the Jacobian, and the iteration matrix is formed and
+    /// factored as a sparse matrix (using sparse LU when `T` is `double`).
+    /// Selecting this scheme for a System that does not provide a Jacobian
+    /// (see System::HasTimeDerivativesJacobian()) causes the integrator to
+    /// throw std::logic_error when it first needs a Jacobian.
+    kSystemProvided
   };
 
   /// @name Methods for getting and setting the Jacobian scheme.
@@ -71,6 +83,10 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   /// computational effort for approximately three digits greater accuracy: the
   /// total error in the central-difference approximation is close to ε^(2/3),
   /// from 2n forward dynamics calls. See [Nocedal 2004, pp. 167-169].
+  /// Systems that can form their Jacobian analytically (and, typically,
+  /// sparsely) should prefer kSystemProvided, which avoids differencing
+  /// altogether and lets the integrator exploit the sparsity when factoring
+  /// the iteration matrix.
   ///
   /// - [Nocedal 2004] J. Nocedal and S. Wright. Numerical Optimization.
   ///                  Springer, 2004.
@@ -92,13 +108,90 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   /// @sa set_reuse()
   bool get_reuse() const { return reuse_; }
 
+  /// @name Methods for tuning the reuse policy.
+  ///
+  /// When reuse is activated (see set_reuse()), a Jacobian matrix and an
+  /// iteration matrix factorization are by default only recomputed once the
+  /// Newton-Raphson process fails to converge with them. Like CVODE's linear
+  /// solver setup heuristics (see [Hindmarsh 2005]), the policies below
+  /// recompute them proactively instead, trading their cost for fewer
+  /// Newton-Raphson iterations and convergence failures. By default, all of
+  /// them are disabled.
+  ///
+  /// - [Hindmarsh 2005] A. Hindmarsh et al. SUNDIALS: Suite of Nonlinear and
+  ///                    Differential/Algebraic Equation Solvers. ACM
+  ///                    Transactions on Mathematical Software, 31 (3):
+  ///                    363-396, 2005.
+  /// @{
+
+  /// Sets the maximum number of successful steps a Jacobian matrix can be
+  /// reused for, after which it is recomputed (CVODE uses 50).
+  /// @throws std::logic_error if @p max_steps is not positive.
+  void set_max_steps_between_jacobian_evaluations(int max_steps) {
+    if (max_steps <= 0) {
+      throw std::logic_error("The maximum number of steps between Jacobian "
+                             "evaluations must be positive.");
+    }
+    max_steps_between_jacobian_evaluations_ = max_steps;
+  }
+
+  /// Gets the maximum number of successful steps a Jacobian matrix can be
+  /// reused for.
+  /// @sa set_max_steps_between_jacobian_evaluations()
+  int get_max_steps_between_jacobian_evaluations() const {
+    return max_steps_between_jacobian_evaluations_;
+  }
+
+  /// Sets the largest relative change |h / hₚ - 1| of the step size h from
+  /// the step size hₚ the iteration matrix was formed with, beyond which the
+  /// iteration matrix is reformed and refactored (CVODE uses 0.3).
+  /// @throws std::logic_error if @p tolerance is negative.
+  void set_iteration_matrix_step_size_change_tolerance(double tolerance) {
+    if (tolerance < 0) {
+      throw std::logic_error("The iteration matrix step size change "
+                             "tolerance must be non-negative.");
+    }
+    iteration_matrix_step_size_change_tolerance_ = tolerance;
+  }
+
+  /// Gets the largest relative change of the step size an iteration matrix
+  /// can be reused for.
+  /// @sa set_iteration_matrix_step_size_change_tolerance()
+  double get_iteration_matrix_step_size_change_tolerance() const {
+    return iteration_matrix_step_size_change_tolerance_;
+  }
+
+  /// Sets the Newton-Raphson convergence rate θ (the ratio of the norms of
+  /// successive state updates, in (0, 1] upon convergence) beyond which the
+  /// Jacobian matrix is considered stale, and is recomputed at the start of
+  /// the next step. Slow convergence is an indication that the Jacobian
+  /// matrix no longer approximates the dynamics well.
+  /// @throws std::logic_error if @p rate is not positive.
+  void set_stale_jacobian_convergence_rate(double rate) {
+    if (rate <= 0) {
+      throw std::logic_error("The stale Jacobian convergence rate must be "
+                             "positive.");
+    }
+    stale_jacobian_convergence_rate_ = rate;
+  }
+
+  /// Gets the Newton-Raphson convergence rate beyond which the Jacobian matrix
+  /// is considered stale.
+  /// @sa set_stale_jacobian_convergence_rate()
+  double get_stale_jacobian_convergence_rate() const {
+    return stale_jacobian_convergence_rate_;
+  }
+  /// @}
+
   /// Sets the Jacobian computation scheme. This function can be safely called
   /// at any time (i.e., the integrator need not be re-initialized afterward).
   /// @note Discards any already-computed Jacobian matrices if the scheme
   ///       changes.
   void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
-    if (jacobian_scheme_ != scheme)
+    if (jacobian_scheme_ != scheme) {
       J_.resize(0, 0);
+      J_sparse_.resize(0, 0);
+    }
     jacobian_scheme_ = scheme;
   }
 
@@ -129,6 +222,20 @@ class ImplicitIntegrator : public IntegratorBase<T> {
         num_jacobian_evaluations_;
   }
 
+  /// Gets the wall clock time (in seconds) spent computing Jacobian matrices
+  /// since the last call to ResetStatistics(). This includes the time spent
+  /// during error estimation processes.
+  double get_jacobian_computation_time() const {
+    return jacobian_computation_time_;
+  }
+
+  /// Gets the largest number of Newton-Raphson iterations taken within a
+  /// single step (including those of failed attempts and error estimation)
+  /// since the last call to ResetStatistics().
+  int64_t get_largest_num_newton_raphson_iterations_in_step() const {
+    return largest_num_newton_raphson_iterations_in_step_;
+  }
+
   /// @name Cumulative statistics functions.
   /// The functions return statistics specific to the implicit integration
   /// process.
@@ -205,20 +312,48 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   class IterationMatrix {
    public:
     void SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix);
+
+    /// Sets and factors a sparse iteration matrix. Subsequent calls to Solve()
+    /// use this factorization until the next call to either overload of
+    /// SetAndFactorIterationMatrix().
+    void SetAndFactorIterationMatrix(
+        const Eigen::SparseMatrix<T>& iteration_matrix);
+
     VectorX<T> Solve(const VectorX<T>& b) const;
 
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Returns the step size the iteration matrix was formed with, as noted by
+    /// ImplicitIntegrator::MaybeFreshenMatrices().
+    const T& step_size() const { return step_size_; }
+
+    /// Notes the step size the iteration matrix was formed with.
+    void set_step_size(const T& h) { step_size_ = h; }
+
    private:
     bool matrix_factored_{false};
 
+    // The step size the iteration matrix was formed with.
+    T step_size_{0};
+
+    // Whether the last factored iteration matrix was sparse (and hence stored
+    // in sparse_LU_).
+    bool sparse_{false};
+
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
     // comes naturally as dt << 1. Keeping this data in the class definition
     // serves to minimize heap allocations and deallocations.
     Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+    // Sparse LU factorization, used for `double` when the iteration matrix is
+    // formed from a System-provided sparse Jacobian. The COLAMD ordering
+    // limits fill-in for the block-structured matrices typical of mechanical
+    // systems.
+    Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>
+        sparse_LU_;
+
     // The only factorization supported by automatic differentiation in Eigen is
     // currently QR. When ImplicitIntegrator is templated on type AutoDiffXd,
     // this will be the factorization that is used.
@@ -239,6 +374,12 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   ///    `trial` parameter below. In this model, DoImplicitIntegratorStep()
   ///    returns failure if the NR iterations reach a fourth trial.
   ///
+  /// In the first trial, the Jacobian matrix and the iteration matrix may
+  /// also be recomputed up front as per the reuse policy (see
+  /// set_max_steps_between_jacobian_evaluations(),
+  /// set_iteration_matrix_step_size_change_tolerance() and
+  /// set_stale_jacobian_convergence_rate()).
+  ///
   /// Note that the sophisticated logic above only applies when the Jacobian
   /// reuse is activated (default, see get_reuse()).
   ///
@@ -295,6 +436,16 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     return true;
   }
 
+  /// Notes the Newton-Raphson convergence rate θ upon convergence, so that the
+  /// Jacobian matrix is recomputed at the start of the next step if θ exceeds
+  /// get_stale_jacobian_convergence_rate(). Derived classes should call this
+  /// method once their Newton-Raphson process converges.
+  void NoteNewtonRaphsonConvergenceRate(const T& theta) {
+    if (theta > stale_jacobian_convergence_rate_) {
+      jacobian_is_stale_ = true;
+    }
+  }
+
   /// Resets any statistics particular to a specific implicit integrator. The
   /// default implementation of this function does nothing. If your integrator
   /// collects its own statistics, you should re-implement this method and
@@ -319,6 +470,27 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   virtual int64_t do_get_num_error_estimator_iteration_matrix_factorizations()
       const = 0;
   MatrixX<T>& get_mutable_jacobian() { return J_; }
+
+  /// Returns `true` if the Jacobian is supplied by the System (see
+  /// JacobianComputationScheme::kSystemProvided), in which case derived
+  /// classes should form and factor their iteration matrices sparsely, using
+  /// get_sparse_jacobian().
+  bool use_sparse_iteration_matrix() const {
+    return jacobian_scheme_ == JacobianComputationScheme::kSystemProvided;
+  }
+
+  /// Gets the sparse Jacobian matrix last computed by CalcJacobian(). This
+  /// matrix is only meaningful when use_sparse_iteration_matrix() is `true`;
+  /// it always agrees with get_mutable_jacobian() in that case.
+  const Eigen::SparseMatrix<T>& get_sparse_jacobian() const {
+    return J_sparse_;
+  }
+
+  /// Computes the sparse matrix I + scale * J, where J is the sparse Jacobian
+  /// returned by get_sparse_jacobian(). With `scale = -h`, this is the
+  /// iteration matrix of implicit Euler.
+  Eigen::SparseMatrix<T> CalcSparseIterationMatrix(const T& scale) const;
+
   void DoResetStatistics() override;
   const MatrixX<T>& CalcJacobian(const T& tf, const VectorX<T>& xtplus);
   void ComputeForwardDiffJacobian(const System<T>&, const T& t,
@@ -333,13 +505,18 @@ class ImplicitIntegrator : public IntegratorBase<T> {
 
  private:
   bool DoStep(const T& h) final {
+    const int64_t num_nr_iterations = get_num_newton_raphson_iterations();
     bool result = DoImplicitIntegratorStep(h);
     // If the implicit step is successful (result is true), we need a new
     // Jacobian (fresh is false). Otherwise, a failed step (result is false)
     // means we can keep the Jacobian (fresh is true). Therefore fresh =
     // !result, always.
     jacobian_is_fresh_ = !result;
+    if (result) ++num_steps_since_jacobian_evaluation_;
 
+    largest_num_newton_raphson_iterations_in_step_ = std::max(
+        largest_num_newton_raphson_iterations_in_step_,
+        get_num_newton_raphson_iterations() - num_nr_iterations);
     return result;
   }
 
@@ -351,6 +528,10 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // The last Jacobian matrix provided by the System; only used with
+  // JacobianComputationScheme::kSystemProvided.
+  Eigen::SparseMatrix<T> J_sparse_;
+
   // Whether the Jacobian matrix is fresh.
   bool jacobian_is_fresh_{false};
 
@@ -358,10 +539,28 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // will not be reused.
   bool reuse_{true};
 
+  // Whether the Jacobian matrix is to be recomputed at the start of the next
+  // step, as per the reuse policy.
+  bool jacobian_is_stale_{false};
+
+  // The number of successful steps taken since the Jacobian matrix was last
+  // computed.
+  int num_steps_since_jacobian_evaluation_{0};
+
+  // Reuse policy settings.
+  int max_steps_between_jacobian_evaluations_{
+      std::numeric_limits<int>::max()};
+  double iteration_matrix_step_size_change_tolerance_{
+      std::numeric_limits<double>::infinity()};
+  double stale_jacobian_convergence_rate_{
+      std::numeric_limits<double>::infinity()};
+
   // Various combined statistics.
   int64_t num_iter_factorizations_{0};
   int64_t num_jacobian_evaluations_{0};
   int64_t num_jacobian_function_evaluations_{0};
+  int64_t largest_num_newton_raphson_iterations_in_step_{0};
+  double jacobian_computation_time_{0};
 };
 
 template <class T>
@@ -369,6 +568,8 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
   num_iter_factorizations_ = 0;
   num_jacobian_function_evaluations_ = 0;
   num_jacobian_evaluations_ = 0;
+  largest_num_newton_raphson_iterations_in_step_ = 0;
+  jacobian_computation_time_ = 0;
   DoResetImplicitIntegratorStatistics();
 }
 
@@ -494,7 +695,10 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
     //              partition, and ideally modify only the one changed element.
     // Compute f' and set the relevant column of the Jacobian matrix.
     context->SetTimeAndContinuousState(t, xt_prime);
-    J->col(i) = (this->EvalTimeDerivatives(*context).CopyToVector() - f) / dxi;
+    auto J_col = J->col(i);
+    this->EvalTimeDerivatives(*context).get_vector().CopyToPreSizedVector(
+        &J_col);
+    J_col = (J_col - f) / dxi;
 
     // Reset xt' to xt.
     xt_prime(i) = xt(i);
@@ -562,20 +766,21 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
     // Compute f(x+dx).
+    // It is computed directly into the Jacobian column.
     context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_plus = this->EvalTimeDerivatives(*context).CopyToVector();
+    auto J_col = J->col(i);
+    this->EvalTimeDerivatives(*context).get_vector().CopyToPreSizedVector(
+        &J_col);
 
     // Update xt' again, minimizing the effect of roundoff error.
     xt_prime(i) = xt(i) - dxi;
     const T dxi_minus = xt(i) - xt_prime(i);
 
-    // Compute f(x-dx).
+    // Compute f(x-dx), and set the Jacobian column.
     context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_minus = this->EvalTimeDerivatives(
-        *context).CopyToVector();
-
-    // Set the Jacobian column.
-    J->col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
+    this->EvalTimeDerivatives(*context).get_vector().ScaleAndAddToVector(
+        -1, &J_col);
+    J_col /= dxi_plus + dxi_minus;
 
     // Reset xt' to xt.
     xt_prime(i) = xt(i);
@@ -589,6 +794,17 @@ template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
   LU_.compute(iteration_matrix);
+  sparse_ = false;
+  matrix_factored_ = true;
+}
+
+// Factors a sparse matrix (the iteration matrix) using sparse LU
+// factorization.
+template <class T>
+void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
+    const Eigen::SparseMatrix<T>& iteration_matrix) {
+  sparse_LU_.compute(iteration_matrix);
+  sparse_ = true;
   matrix_factored_ = true;
 }
 
@@ -605,12 +821,27 @@ inline void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
   matrix_factored_ = true;
 }
 
+// Factors a sparse matrix (the iteration matrix). Eigen's sparse LU
+// factorization is not AutoDiff-able, so the matrix is densified and factored
+// using the same QR factorization as above.
+// Note: must be declared inline because it's specialized and located in the
+// header file (to avoid multiple definition errors).
+template <>
+inline void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
+    SetAndFactorIterationMatrix(
+        const Eigen::SparseMatrix<AutoDiffXd>& iteration_matrix) {
+  QR_.compute(MatrixX<AutoDiffXd>(iteration_matrix));
+  matrix_factored_ = true;
+}
+
 // Solves a linear system Ax = b for x using the iteration matrix (A)
-// factored using LU decomposition.
+// factored using (dense or sparse) LU decomposition.
 // @sa Factor()
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_)
+    return sparse_LU_.solve(b);
   return LU_.solve(b);
 }
 
@@ -649,6 +880,9 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Update the time and state.
   context->SetTimeAndContinuousState(t, x);
   num_jacobian_evaluations_++;
+  num_steps_since_jacobian_evaluation_ = 0;
+  jacobian_is_stale_ = false;
+  const auto start_time = std::chrono::steady_clock::now();
 
   // Get the current number of ODE evaluations.
   int64_t current_ODE_evals = this->get_num_derivative_evaluations();
@@ -656,7 +890,6 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Get a the system.
   const System<T>& system = this->get_system();
 
-  // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
   [this, context, &system, &t, &x]() {
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
@@ -670,6 +903,11 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
       case JacobianComputationScheme::kAutomatic:
         ComputeAutoDiffJacobian(system, t, x, *context, &J_);
         break;
+
+      case JacobianComputationScheme::kSystemProvided:
+        system.CalcTimeDerivativesJacobian(*context, &J_sparse_);
+        J_ = MatrixX<T>(J_sparse_);
+        break;
     }
   }();
 
@@ -677,6 +915,8 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // evaluations.
   num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
       - current_ODE_evals;
+  jacobian_computation_time_ += std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start_time).count();
 
   // Reset the time and state.
   context->SetTimeAndContinuousState(t_current, x_current);
@@ -684,6 +924,15 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   return J_;
 }
 
+template <class T>
+Eigen::SparseMatrix<T> ImplicitIntegrator<T>::CalcSparseIterationMatrix(
+    const T& scale) const {
+  const int n = J_sparse_.rows();
+  Eigen::SparseMatrix<T> identity(n, n);
+  identity.setIdentity();
+  return scale * J_sparse_ + identity;
+}
+
 template <class T>
 bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
     const T& t, const VectorX<T>& xt, const T& h, int trial,
@@ -691,36 +940,59 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
         typename ImplicitIntegrator<T>::IterationMatrix*)>&
         compute_and_factor_iteration_matrix,
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  using std::abs;
+
+  // Forms and factors the iteration matrix, noting the step size it is formed
+  // with.
+  const auto factor_iteration_matrix = [&](const MatrixX<T>& J) {
+    ++num_iter_factorizations_;
+    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    iteration_matrix->set_step_size(h);
+  };
+
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    factor_iteration_matrix(J);
     return true;  // Indicate success.
   }
 
   // Reuse is activated, Jacobian is fully sized, and Jacobian is not "bad".
   // If the iteration matrix has not been set and factored, do only that.
   if (!iteration_matrix->matrix_factored()) {
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    factor_iteration_matrix(J);
     return true;  // Indicate success.
   }
 
   switch (trial) {
-    case 1:
-      // For the first trial, we do nothing: this will cause the Newton-Raphson
-      // process to use the last computed (and already factored) iteration
-      // matrix.
+    case 1: {
+      // For the first trial, the reuse policy may call for a fresh Jacobian
+      // matrix, or for a fresh iteration matrix if the step size changed too
+      // much since it was formed.
+      if (jacobian_is_stale_ || num_steps_since_jacobian_evaluation_ >=
+                                    max_steps_between_jacobian_evaluations_) {
+        J = CalcJacobian(t, xt);
+        factor_iteration_matrix(J);
+        return true;
+      }
+      const T& h_factored = iteration_matrix->step_size();
+      if (abs(h - h_factored) >
+          iteration_matrix_step_size_change_tolerance_ * abs(h_factored)) {
+        factor_iteration_matrix(J);
+        return true;
+      }
+
+      // Otherwise, we do nothing: this will cause the Newton-Raphson process
+      // to use the last computed (and already factored) iteration matrix.
       return true;  // Indicate success.
+    }
 
     case 2: {
       // For the second trial, we perform the (likely) next least expensive
       // operation, re-constructing and factoring the iteration matrix.
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      factor_iteration_matrix(J);
       return true;
     }
 
@@ -733,8 +1005,7 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
 
       // Reform the Jacobian matrix and refactor the iteration matrix.
       J = CalcJacobian(t, xt);
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      factor_iteration_matrix(J);
       return true;
 
       case 4: {
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/systems/analysis/initial_value_problem.h"
 #include "drake/systems/analysis/runge_kutta3_integrator-inl.h"
 #include "drake/systems/framework/basic_vector.h"
@@ -135,6 +136,10 @@ InitialValueProblem<T>::InitialValueProblem(
   // Instantiates an explicit RK3 integrator by default.
   integrator_ = std::make_unique<RungeKutta3Integrator<T>>(
       *system_, context_.get());
+  integrator_factory_ = [](const System<T>& system) {
+    return std::unique_ptr<IntegratorBase<T>>(
+        std::make_unique<RungeKutta3Integrator<T>>(system));
+  };
 
   // Sets step size and accuracy defaults.
   integrator_->request_initial_step_size_target(
@@ -172,6 +177,68 @@ VectorX<T> InitialValueProblem<T>::Solve(
   return state_vector.get_value();
 }
 
+template <typename T>
+MatrixX<T> InitialValueProblem<T>::EnsembleSolve(
+    const T& tf, const MatrixX<T>& x0s, const SpecifiedValues& values,
+    int num_threads) const {
+  if (values.x0.has_value()) {
+    throw std::logic_error("IVP ensemble initial states are given by x0s,"
+                           " values.x0 must not be given.");
+  }
+  if (num_threads < 1) {
+    throw std::logic_error("IVP ensemble must be solved with at least"
+                           " one thread.");
+  }
+  // Gets all values to solve with, either given or default, while
+  // checking that all preconditions hold.
+  const SpecifiedValues safe_values = SanitizeValuesOrThrow(tf, values);
+  if (x0s.rows() != safe_values.x0.value().size()) {
+    throw std::logic_error("IVP ensemble initial state vectors x0s are"
+                           " of the wrong dimension.");
+  }
+
+  // Each thread lazily allocates its own integration context and
+  // integrator, which are then reused for all its ensemble members.
+  std::vector<std::unique_ptr<Context<T>>> contexts(num_threads);
+  std::vector<std::unique_ptr<IntegratorBase<T>>> integrators(num_threads);
+  MatrixX<T> xfs(x0s.rows(), x0s.cols());
+  StaticParallelForIndexLoop(
+      num_threads, 0, x0s.cols(), [&](int thread_num, int member) {
+        std::unique_ptr<Context<T>>& context = contexts[thread_num];
+        std::unique_ptr<IntegratorBase<T>>& integrator =
+            integrators[thread_num];
+        if (context == nullptr) {
+          context = system_->CreateDefaultContext();
+          context->get_mutable_numeric_parameter(0).set_value(
+              safe_values.k.value());
+          integrator = integrator_factory_(*system_);
+          integrator->reset_context(context.get());
+        }
+        context->SetTime(safe_values.t0.value());
+        // This cast is safe because the ContinuousState<T> of a
+        // LeafSystem<T> is flat i.e. it is just a BasicVector<T>, and the
+        // implementation deals with LeafSystem<T> instances only by design.
+        BasicVector<T>& state_vector = dynamic_cast<BasicVector<T>&>(
+            context->get_mutable_continuous_state_vector());
+        state_vector.set_value(x0s.col(member));
+
+        // Resets the integrator internal state, and sets the same step size
+        // and accuracy settings as the internal integrator's.
+        integrator->Reset();
+        integrator->set_maximum_step_size(
+            integrator_->get_maximum_step_size());
+        if (integrator->supports_error_estimation()) {
+          integrator->request_initial_step_size_target(
+              integrator_->get_initial_step_size_target());
+          integrator->set_target_accuracy(integrator_->get_target_accuracy());
+        }
+        integrator->Initialize();
+        integrator->IntegrateWithMultipleStepsToTime(tf);
+        xfs.col(member) = state_vector.get_value();
+      });
+  return xfs;
+}
+
 template <typename T>
 void InitialValueProblem<T>::ResetCachedState(
     const SpecifiedValues& values) const {
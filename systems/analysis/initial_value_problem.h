@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -176,6 +177,44 @@ class InitialValueProblem {
   std::unique_ptr<DenseOutput<T>> DenseSolve(
       const T& tf, const SpecifiedValues& values = {}) const;
 
+  /// Solves the IVP for time @p tf for each initial state vector in the
+  /// columns of @p x0s, i.e. an ensemble of IVPs sharing the initial time t₀
+  /// and parameter vector 𝐤 present in @p values (falling back to the ones
+  /// given on construction if not given). This is intended for e.g.
+  /// reachability analysis or uncertainty propagation, where the same ODE is
+  /// solved for many initial conditions.
+  ///
+  /// The ensemble members are distributed over (at most) @p num_threads
+  /// threads. Each thread integrates its members one after the other, with
+  /// its own integration context and its own instance of the integrator type
+  /// in use (see reset_integrator()), configured with the same step size and
+  /// accuracy settings as the internal integrator. Each member thus adapts its
+  /// own step size, and the solution of each member doesn't depend on the
+  /// number of threads. The internal integration context is left untouched,
+  /// so this does not invalidate the cached solution used by Solve().
+  ///
+  /// @param tf The IVPs will be solved for this time.
+  /// @param x0s The initial state vectors 𝐱₀ of the ensemble, one per column.
+  /// @param values IVP initial time and parameters. Its initial state vector
+  ///               must not be given, as it is given by @p x0s instead.
+  /// @param num_threads The maximum number of threads used.
+  /// @returns The IVP solutions 𝐱(@p tf; 𝐤), one per column of @p x0s.
+  /// @pre Given @p tf must be larger than or equal to the specified initial
+  ///      time t₀ (either given or default).
+  /// @pre The number of rows of @p x0s must match the dimension of the
+  ///      default initial state vector given on construction.
+  /// @pre If given, the dimension of the parameter vector @p values.k
+  ///      must match that of the parameter vector in the default specified
+  ///      values given on construction.
+  /// @pre @p values.x0 is not given.
+  /// @pre @p num_threads is positive.
+  /// @throws std::logic_error if any of the preconditions is not met.
+  /// @warning The ODE function must be safe to call concurrently when
+  ///          @p num_threads is larger than one.
+  MatrixX<T> EnsembleSolve(const T& tf, const MatrixX<T>& x0s,
+                           const SpecifiedValues& values = {},
+                           int num_threads = 1) const;
+
   /// Resets the internal integrator instance by in-place
   /// construction of the given integrator type.
   ///
@@ -194,6 +233,12 @@ class InitialValueProblem {
   ///          InitialValueProblem::get_mutable_integrator().
   template <typename Integrator, typename... Args>
   Integrator* reset_integrator(Args&&... args) {
+    // Keeps copies of the arguments, so that EnsembleSolve() can construct
+    // more integrators of the same type.
+    integrator_factory_ = [args...](const System<T>& system) {
+      return std::unique_ptr<IntegratorBase<T>>(
+          std::make_unique<Integrator>(system, args...));
+    };
     integrator_ = std::make_unique<Integrator>(
         *system_, std::forward<Args>(args)...);
     integrator_->reset_context(context_.get());
@@ -260,6 +305,10 @@ class InitialValueProblem {
   std::unique_ptr<System<T>> system_;
   // Numerical integrator used for IVP ODE solving.
   std::unique_ptr<IntegratorBase<T>> integrator_;
+  // Constructs a new integrator of the same type as integrator_, for the
+  // given system.
+  std::function<std::unique_ptr<IntegratorBase<T>>(const System<T>&)>
+      integrator_factory_;
 };
 
 }  // namespace systems
@@ -8,7 +8,9 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_nodiscard.h"
+#include "drake/common/nice_type_name.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace_span.h"
 #include "drake/systems/analysis/dense_output.h"
 #include "drake/systems/analysis/hermitian_dense_output.h"
 #include "drake/systems/analysis/stepwise_dense_output.h"
@@ -518,6 +520,37 @@ class IntegratorBase {
     initialization_done_ = true;
   }
 
+  /**
+   * Creates an integrator of the same type for the same System, which
+   * integrates `context`. The clone has the same settings (accuracy, step size
+   * limits, weighting and fixed step mode) and continues from this
+   * integrator's step size history, so that its first step is as large as the
+   * next step of this integrator would be rather than a conservative initial
+   * guess. The clone is initialized if this integrator is. Statistics and
+   * dense output are not copied.
+   * @throws std::logic_error if the integrator does not support cloning.
+   */
+  std::unique_ptr<IntegratorBase<T>> Clone(Context<T>* context) const {
+    std::unique_ptr<IntegratorBase<T>> clone = DoClone(context);
+    if (clone == nullptr) {
+      throw std::logic_error(NiceTypeName::Get(*this) +
+                             " does not support Clone()");
+    }
+    clone->target_accuracy_ = target_accuracy_;
+    clone->accuracy_in_use_ = accuracy_in_use_;
+    clone->max_step_size_ = max_step_size_;
+    clone->req_min_step_size_ = req_min_step_size_;
+    clone->req_initial_step_size_ = req_initial_step_size_;
+    clone->fixed_step_mode_ = fixed_step_mode_;
+    clone->min_step_exceeded_throws_ = min_step_exceeded_throws_;
+    clone->qbar_weight_ = qbar_weight_;
+    clone->z_weight_ = z_weight_;
+    clone->prev_step_size_ = prev_step_size_;
+    clone->ideal_next_step_size_ = ideal_next_step_size_;
+    if (is_initialized()) clone->Initialize();
+    return clone;
+  }
+
   /**
    * Request that the first attempted integration step have a particular size.
    * If no request is made, the integrator will estimate a suitable size
@@ -1384,6 +1417,16 @@ class IntegratorBase {
    */
   virtual void DoReset() {}
 
+  /**
+   * Derived classes can override this method to support Clone(), by returning
+   * a new integrator of their own type for the same System and `context`.
+   * Settings common to all integrators are copied by Clone(). This default
+   * method returns null.
+   */
+  virtual std::unique_ptr<IntegratorBase<T>> DoClone(Context<T>*) const {
+    return nullptr;
+  }
+
   // TODO(hidmic): Make pure virtual and override on each subclass, as
   // the 'optimal' dense output scheme is only known by the specific
   // integration scheme being implemented.
@@ -1622,11 +1665,11 @@ class IntegratorBase {
   // generalized coordinates to generalized velocities, multiplied by the
   // change in the generalized coordinates (used in state change norm
   // calculations).
-  mutable std::unique_ptr<VectorBase<T>> pinvN_dq_change_;
+  mutable std::unique_ptr<BasicVector<T>> pinvN_dq_change_;
 
   // Vectors used in state change norm calculations.
   mutable VectorX<T> unweighted_substate_change_;
-  mutable std::unique_ptr<VectorBase<T>> weighted_q_change_;
+  mutable std::unique_ptr<BasicVector<T>> weighted_q_change_;
 
   // Variable for indicating when an integrator has been initialized.
   bool initialization_done_{false};
@@ -1645,6 +1688,7 @@ class IntegratorBase {
 
 template <class T>
 bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& dt_max) {
+  DRAKE_TRACE_SPAN("IntegratorBase::StepOnceErrorControlledAtMost");
   using std::isnan;
   using std::min;
 
@@ -1660,7 +1704,8 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& dt_max) {
   const T current_time = context.get_time();
   VectorBase<T>& xc =
       get_mutable_context()->get_mutable_continuous_state_vector();
-  xc0_save_ = xc.CopyToVector();
+  xc0_save_.resize(xc.size());
+  xc.CopyToPreSizedVector(&xc0_save_);
 
   // Set the step size to attempt.
   T step_size_to_attempt = get_ideal_next_step_size();
@@ -1804,24 +1849,30 @@ T IntegratorBase<T>::CalcStateChangeNorm(
   //                 (i.e., modify the System to provide this value).
   const double characteristic_time = 1.0;
 
+  // The substate changes are copied into preallocated temporaries, so that
+  // steady-state integration steps don't allocate.
+
   // Computes the infinity norm of the weighted velocity variables.
-  unweighted_substate_change_ = dgv.CopyToVector();
+  unweighted_substate_change_.resize(dgv.size());
+  dgv.CopyToPreSizedVector(&unweighted_substate_change_);
   T v_nrm = qbar_v_weight.cwiseProduct(unweighted_substate_change_).
       template lpNorm<Eigen::Infinity>() * characteristic_time;
 
   // Compute the infinity norm of the weighted auxiliary variables.
-  unweighted_substate_change_ = dgz.CopyToVector();
+  unweighted_substate_change_.resize(dgz.size());
+  dgz.CopyToPreSizedVector(&unweighted_substate_change_);
   T z_nrm = (z_weight.cwiseProduct(unweighted_substate_change_))
                 .template lpNorm<Eigen::Infinity>();
 
   // Compute N * Wq * dq = N * Wꝗ * N+ * dq.
-  unweighted_substate_change_ = dgq.CopyToVector();
+  unweighted_substate_change_.resize(dgq.size());
+  dgq.CopyToPreSizedVector(&unweighted_substate_change_);
   system.MapQDotToVelocity(context, unweighted_substate_change_,
                            pinvN_dq_change_.get());
-  system.MapVelocityToQDot(
-      context, qbar_v_weight.cwiseProduct(pinvN_dq_change_->CopyToVector()),
-      weighted_q_change_.get());
-  T q_nrm = weighted_q_change_->CopyToVector().
+  pinvN_dq_change_->get_mutable_value().array() *= qbar_v_weight.array();
+  system.MapVelocityToQDot(context, pinvN_dq_change_->get_value(),
+                           weighted_q_change_.get());
+  T q_nrm = weighted_q_change_->get_value().
       template lpNorm<Eigen::Infinity>();
   SPDLOG_DEBUG(drake::log(), "dq norm: {}, dv norm: {}, dz norm: {}",
                q_nrm, v_nrm, z_nrm);
@@ -1939,6 +1990,7 @@ template <class T>
 typename IntegratorBase<T>::StepResult
     IntegratorBase<T>::IntegrateNoFurtherThanTime(
         const T& publish_time, const T& update_time, const T& boundary_time) {
+  DRAKE_TRACE_SPAN("IntegratorBase::IntegrateNoFurtherThanTime");
   if (!IntegratorBase<T>::is_initialized())
     throw std::logic_error("Integrator not initialized.");
 
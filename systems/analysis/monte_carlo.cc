@@ -1,5 +1,12 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "drake/common/drake_throw.h"
+
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -22,7 +29,10 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
 
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions >= 1);
+
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -30,16 +40,63 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     generator = owned_generator.get();
   }
 
+  // Draw the per-sample seeds up front (in sample order), so that the
+  // results are independent of the order in which the samples are run.
+  std::vector<RandomGenerator::result_type> seeds(std::max(num_samples, 0));
+  for (auto& seed : seeds) {
+    seed = (*generator)();
+  }
+
+  std::vector<double> outputs(seeds.size());
+  const int num_threads =
+      std::min(num_parallel_executions, static_cast<int>(seeds.size()));
+  if (num_threads <= 1) {
+    for (int i = 0; i < static_cast<int>(seeds.size()); ++i) {
+      RandomGenerator sample_generator(seeds[i]);
+      outputs[i] = RandomSimulation(make_simulator, output, final_time,
+                                    &sample_generator);
+    }
+  } else {
+    // Each worker repeatedly claims the next unclaimed sample; every sample
+    // writes only to its own slot in `outputs` and `errors`.
+    std::atomic<int> next_sample{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::exception_ptr> errors(seeds.size());
+    auto worker = [&]() {
+      while (!failed) {
+        const int i = next_sample++;
+        if (i >= static_cast<int>(seeds.size())) {
+          return;
+        }
+        try {
+          RandomGenerator sample_generator(seeds[i]);
+          outputs[i] = RandomSimulation(make_simulator, output, final_time,
+                                        &sample_generator);
+        } catch (...) {
+          errors[i] = std::current_exception();
+          failed = true;
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
   std::vector<RandomSimulationResult> data;
-  data.reserve(num_samples);
-
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
-  for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+  data.reserve(seeds.size());
+  for (int i = 0; i < static_cast<int>(seeds.size()); ++i) {
+    data.emplace_back(RandomGenerator(seeds[i]), outputs[i]);
   }
 
   return data;
@@ -119,12 +119,19 @@ struct RandomSimulationResult {
  * In pseudo-code, this algorithm implements:
  * @code
  *   for i=1:num_samples
- *     const generator_snapshot = deepcopy(generator)
- *     output = RandomSimulation(..., generator)
+ *     sample_generator = RandomGenerator(generator())
+ *     const generator_snapshot = deepcopy(sample_generator)
+ *     output = RandomSimulation(..., sample_generator)
  *     data(i) = std::pair(generator_snapshot, output)
  *   return data
  * @endcode
  *
+ * Each sample is given its own RandomGenerator, seeded by a value drawn from
+ * @p generator.  The seeds are drawn in sample order before any simulation
+ * is run, so the results do not depend on how the samples are scheduled; in
+ * particular, the results are identical (bit for bit) for any value of @p
+ * num_parallel_executions.
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -138,16 +145,28 @@ struct RandomSimulationResult {
  * future call to MonteCarloSimulation, you should make repeated uses of the
  * same RandomGenerator object.
  *
- * @returns a list of RandomSimulationResult's.
+ * @param num_parallel_executions Number of worker threads used to run the
+ * simulations.  Each worker obtains its own Simulator from @p make_simulator
+ * for every sample it runs, so when this is greater than one both @p
+ * make_simulator and @p output must be safe to call concurrently (e.g., they
+ * must not share mutable state without synchronization).  The default of one
+ * runs every sample on the calling thread.  Use, e.g.,
+ * std::thread::hardware_concurrency() to use all available cores.
+ *
+ * @returns a list of RandomSimulationResult's, in sample order.
+ *
+ * @throws std::exception if @p num_parallel_executions is less than one.  If
+ * any simulation throws, the remaining simulations are abandoned and the
+ * exception from the lowest-numbered failing sample is rethrown.
  *
  * @ingroup analysis
  */
 // TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
+// number of simulators, number of samples per simulator, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = 1);
 
 }  // namespace analysis
 }  // namespace systems
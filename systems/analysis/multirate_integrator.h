@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/framework/diagram.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * A second-order, explicit multirate integrator for Diagrams whose continuous
+ * state evolves on two time scales. The continuous state is partitioned per
+ * subsystem into a fast partition (that of the given fast subsystems) and a
+ * slow partition (that of all other subsystems). Each (macro) step of size H
+ * advances the slow partition with a single step of the explicit trapezoidal
+ * (Heun) rule, and the fast partition with m explicit trapezoidal substeps of
+ * size H / m. While the fast partition is being advanced, the slow state (and
+ * hence, the slow subsystems outputs feeding the fast subsystems input ports)
+ * is linearly interpolated from its derivative at the start of the step.
+ *
+ * The time derivatives of the slow subsystems are thus evaluated twice per
+ * step, instead of 2m times for a single rate explicit trapezoidal integrator
+ * with step size H / m. This pays off for Diagrams coupling stiff, fast
+ * subsystems (e.g. an electrical motor model) with costly, slow ones (e.g.
+ * vehicle dynamics). With a single substep, this integrator is equivalent to
+ * RungeKutta2Integrator.
+ *
+ * This integrator takes fixed steps and does not support error estimation.
+ * The fast subsystems must be direct subsystems of the Diagram being
+ * integrated.
+ * @tparam T A double or autodiff type.
+ */
+template <class T>
+class MultirateIntegrator final : public IntegratorBase<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultirateIntegrator)
+
+  ~MultirateIntegrator() override = default;
+
+  /**
+   * Constructs a fixed-step multirate integrator for a given diagram using
+   * the given context for initial conditions.
+   * @param system A reference to the diagram to be simulated.
+   * @param max_step_size The maximum (fixed) step size of the slow partition;
+   *                      the integrator will not take larger step sizes than
+   *                      this.
+   * @param fast_subsystems The subsystems of @p system whose continuous state
+   *                        makes up the fast partition.
+   * @param num_fast_substeps The number of substeps the fast partition takes
+   *                          per step.
+   * @param context Pointer to the context (nullptr is ok, but the caller
+   *                must set a non-null context before Initialize()-ing the
+   *                integrator).
+   * @throws std::logic_error if @p system is not a Diagram, if any of the
+   *         @p fast_subsystems is not a direct subsystem of it, or if
+   *         @p num_fast_substeps is not positive.
+   * @sa Initialize()
+   */
+  MultirateIntegrator(const System<T>& system, const T& max_step_size,
+                      const std::vector<const System<T>*>& fast_subsystems,
+                      int num_fast_substeps, Context<T>* context = nullptr)
+      : IntegratorBase<T>(system, context),
+        diagram_(dynamic_cast<const Diagram<T>*>(&system)),
+        num_fast_substeps_(num_fast_substeps) {
+    if (diagram_ == nullptr) {
+      throw std::logic_error("MultirateIntegrator requires a Diagram.");
+    }
+    if (num_fast_substeps_ < 1) {
+      throw std::logic_error("MultirateIntegrator requires a positive number "
+                             "of fast substeps.");
+    }
+    const std::vector<const System<T>*> subsystems = diagram_->GetSystems();
+    for (const System<T>* fast_subsystem : fast_subsystems) {
+      if (std::find(subsystems.begin(), subsystems.end(), fast_subsystem) ==
+          subsystems.end()) {
+        throw std::logic_error("MultirateIntegrator fast subsystems must be "
+                               "direct subsystems of the Diagram.");
+      }
+    }
+    for (const System<T>* subsystem : subsystems) {
+      if (subsystem->num_continuous_states() == 0) continue;
+      const bool is_fast =
+          std::find(fast_subsystems.begin(), fast_subsystems.end(),
+                    subsystem) != fast_subsystems.end();
+      Partition& partition = is_fast ? fast_ : slow_;
+      partition.subsystems.push_back(subsystem);
+      partition.derivatives.push_back(subsystem->AllocateTimeDerivatives());
+      partition.size += subsystem->num_continuous_states();
+    }
+    IntegratorBase<T>::set_maximum_step_size(max_step_size);
+  }
+
+  /**
+   * The multirate integrator does not support error estimation.
+   */
+  bool supports_error_estimation() const override { return false; }
+
+  /// Integrator does not provide an error estimate.
+  int get_error_estimate_order() const override { return 0; }
+
+  /// Gets the number of substeps the fast partition takes per step.
+  int get_num_fast_substeps() const { return num_fast_substeps_; }
+
+  /// Gets the number of evaluations of the time derivatives of the fast
+  /// subsystems since the last call to ResetStatistics().
+  int64_t get_num_fast_derivative_evaluations() const {
+    return fast_.num_evaluations;
+  }
+
+  /// Gets the number of evaluations of the time derivatives of the slow
+  /// subsystems since the last call to ResetStatistics().
+  int64_t get_num_slow_derivative_evaluations() const {
+    return slow_.num_evaluations;
+  }
+
+ private:
+  // The subsystems whose continuous state makes up a partition, with
+  // pre-allocated temporaries for their time derivatives.
+  struct Partition {
+    std::vector<const System<T>*> subsystems;
+    std::vector<std::unique_ptr<ContinuousState<T>>> derivatives;
+    // The partition continuous state dimension.
+    int size{0};
+    // The number of time derivative evaluations of the partition.
+    int64_t num_evaluations{0};
+  };
+
+  void DoResetStatistics() override {
+    fast_.num_evaluations = 0;
+    slow_.num_evaluations = 0;
+  }
+
+  bool DoStep(const T& h) override;
+
+  // Gets the continuous state of the given @p partition.
+  VectorX<T> GetState(const Partition& partition,
+                      const Context<T>& context) const;
+
+  // Sets the continuous state of the given @p partition.
+  void SetState(const Partition& partition, const VectorX<T>& x,
+                Context<T>* context) const;
+
+  // Evaluates the time derivatives of the continuous state of the given
+  // @p partition.
+  VectorX<T> CalcDerivatives(Partition* partition,
+                             const Context<T>& context) const;
+
+  const Diagram<T>* const diagram_;
+  const int num_fast_substeps_;
+  Partition fast_;
+  Partition slow_;
+};
+
+template <class T>
+VectorX<T> MultirateIntegrator<T>::GetState(const Partition& partition,
+                                            const Context<T>& context) const {
+  VectorX<T> x(partition.size);
+  int offset = 0;
+  for (const System<T>* subsystem : partition.subsystems) {
+    const VectorBase<T>& xc = diagram_->GetSubsystemContext(*subsystem, context)
+                                  .get_continuous_state_vector();
+    x.segment(offset, xc.size()) = xc.CopyToVector();
+    offset += xc.size();
+  }
+  return x;
+}
+
+template <class T>
+void MultirateIntegrator<T>::SetState(const Partition& partition,
+                                      const VectorX<T>& x,
+                                      Context<T>* context) const {
+  int offset = 0;
+  for (const System<T>* subsystem : partition.subsystems) {
+    VectorBase<T>& xc =
+        diagram_->GetMutableSubsystemContext(*subsystem, context)
+            .get_mutable_continuous_state_vector();
+    xc.SetFromVector(x.segment(offset, xc.size()));
+    offset += xc.size();
+  }
+}
+
+template <class T>
+VectorX<T> MultirateIntegrator<T>::CalcDerivatives(
+    Partition* partition, const Context<T>& context) const {
+  VectorX<T> xcdot(partition->size);
+  int offset = 0;
+  for (size_t i = 0; i < partition->subsystems.size(); ++i) {
+    const System<T>& subsystem = *partition->subsystems[i];
+    ContinuousState<T>& derivatives = *partition->derivatives[i];
+    subsystem.CalcTimeDerivatives(
+        diagram_->GetSubsystemContext(subsystem, context), &derivatives);
+    xcdot.segment(offset, derivatives.size()) =
+        derivatives.get_vector().CopyToVector();
+    offset += derivatives.size();
+  }
+  ++partition->num_evaluations;
+  return xcdot;
+}
+
+/**
+ * Integrates the diagram forward in time from the current time t₀ to
+ * t₁ = t₀ + H, where H is determined by IntegratorBase::Step(). Denoting
+ * the slow and fast partitions of the continuous state by xₛ and x_f, and
+ * their time derivatives by fₛ and f_f:
+ * <pre>
+ *   kₛ₀ = fₛ(t₀, xₛ₀, x_f₀)
+ *   x̃ₛ(t) = xₛ₀ + (t - t₀) kₛ₀
+ *   x_f₁ = m explicit trapezoidal substeps of size H / m of
+ *          dx_f/dt = f_f(t, x̃ₛ(t), x_f)
+ *   kₛ₁ = fₛ(t₁, x̃ₛ(t₁), x_f₁)
+ *   xₛ₁ = xₛ₀ + H (kₛ₀ + kₛ₁) / 2
+ * </pre>
+ */
+template <class T>
+bool MultirateIntegrator<T>::DoStep(const T& h) {
+  Context<T>* const context = IntegratorBase<T>::get_mutable_context();
+  const T t0 = context->get_time();
+
+  // Evaluate the slow derivatives at the start of the step, which drive the
+  // slow state interpolation while the fast state is advanced.
+  const VectorX<T> xs0 = GetState(slow_, *context);
+  const VectorX<T> ks0 = CalcDerivatives(&slow_, *context);
+
+  // Advance the fast state with explicit trapezoidal substeps.
+  const T h_fast = h / num_fast_substeps_;
+  VectorX<T> xf = GetState(fast_, *context);
+  for (int i = 0; i < num_fast_substeps_; ++i) {
+    const T t = t0 + i * h_fast;
+    context->SetTime(t);
+    SetState(slow_, xs0 + (t - t0) * ks0, context);
+    SetState(fast_, xf, context);
+    const VectorX<T> kf0 = CalcDerivatives(&fast_, *context);
+
+    context->SetTime(t + h_fast);
+    SetState(slow_, xs0 + (t + h_fast - t0) * ks0, context);
+    SetState(fast_, xf + h_fast * kf0, context);
+    const VectorX<T> kf1 = CalcDerivatives(&fast_, *context);
+    xf += h_fast / 2 * (kf0 + kf1);
+  }
+
+  // Correct the slow state with the slow derivatives at the end of the step.
+  context->SetTime(t0 + h);
+  SetState(slow_, xs0 + h * ks0, context);
+  SetState(fast_, xf, context);
+  const VectorX<T> ks1 = CalcDerivatives(&slow_, *context);
+  SetState(slow_, xs0 + h / 2 * (ks0 + ks1), context);
+
+  // The multirate integrator always succeeds at taking the step.
+  return true;
+}
+
+}  // namespace systems
+}  // namespace drake
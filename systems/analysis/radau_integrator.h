@@ -140,6 +140,8 @@ class RadauIntegrator final : public ImplicitIntegrator<T> {
       const VectorX<T>& dx0, const VectorX<T>& xtplus_radau,
       VectorX<T>* xtplus);
   static MatrixX<T> CalcTensorProduct(const MatrixX<T>& A, const MatrixX<T>& B);
+  static Eigen::SparseMatrix<T> CalcSparseRadauIterationMatrix(
+      const Eigen::SparseMatrix<T>& J, const T& h, const MatrixX<double>& A);
   static void ComputeImplicitTrapezoidIterationMatrix(const MatrixX<T>& J,
       const T& h,
       typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix);
@@ -477,7 +479,13 @@ bool RadauIntegrator<T, num_stages>::StepRadau(const T& t0, const T& h,
   // Set the iteration matrix construction method.
   auto construct_iteration_matrix = [this](const MatrixX<T>& J, const T& dt,
       typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
-    ComputeRadauIterationMatrix(J, dt, this->A_, iteration_matrix);
+    if (this->use_sparse_iteration_matrix()) {
+      iteration_matrix->SetAndFactorIterationMatrix(
+          CalcSparseRadauIterationMatrix(
+              this->get_sparse_jacobian(), dt, this->A_));
+    } else {
+      ComputeRadauIterationMatrix(J, dt, this->A_, iteration_matrix);
+    }
   };
 
   // Calculate Jacobian and iteration matrices (and factorizations), as needed.
@@ -539,7 +547,12 @@ bool RadauIntegrator<T, num_stages>::StepRadau(const T& t0, const T& h,
     // Check for convergence.
     ConvergenceStatus status =
         CheckConvergence(iter, *xtplus, dx, dx_norm, last_dx_norm);
-    if (status == ConvergenceStatus::kConverged) return true;  // We win.
+    if (status == ConvergenceStatus::kConverged) {
+      if (iter > 1) {
+        this->NoteNewtonRaphsonConvergenceRate(dx_norm / last_dx_norm);
+      }
+      return true;  // We win.
+    }
     if (status == ConvergenceStatus::kDiverged) break;  // Try something else.
     DRAKE_DEMAND(status == ConvergenceStatus::kNotConverged);
 
@@ -664,8 +677,17 @@ bool RadauIntegrator<T, num_stages>::StepImplicitTrapezoidDetail(
   // Note that this method computes the Jacobian matrix around (tf, *xtplus),
   // where *xtplus is the solution computed by the Radau method, whereas the
   // Radau3 method computes it around (t0, xt0).
+  auto construct_iteration_matrix = [this](const MatrixX<T>& J, const T& dt,
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+    if (this->use_sparse_iteration_matrix()) {
+      iteration_matrix->SetAndFactorIterationMatrix(
+          this->CalcSparseIterationMatrix(-dt / 2.0));
+    } else {
+      ComputeImplicitTrapezoidIterationMatrix(J, dt, iteration_matrix);
+    }
+  };
   if (!this->MaybeFreshenMatrices(t0, *xtplus, h, trial,
-      ComputeImplicitTrapezoidIterationMatrix,
+      construct_iteration_matrix,
       &iteration_matrix_implicit_trapezoid_)) {
     return false;
   }
@@ -691,7 +713,12 @@ bool RadauIntegrator<T, num_stages>::StepImplicitTrapezoidDetail(
     // Check for convergence.
     ConvergenceStatus status =
         CheckConvergence(iter, *xtplus, dx, dx_norm, last_dx_norm);
-    if (status == ConvergenceStatus::kConverged) return true;  // We win.
+    if (status == ConvergenceStatus::kConverged) {
+      if (iter > 1) {
+        this->NoteNewtonRaphsonConvergenceRate(dx_norm / last_dx_norm);
+      }
+      return true;  // We win.
+    }
     if (status == ConvergenceStatus::kDiverged) break;  // Try something else.
     DRAKE_DEMAND(status == ConvergenceStatus::kNotConverged);
 
@@ -923,6 +950,38 @@ void RadauIntegrator<T, num_stages>::ComputeRadauIterationMatrix(
       CalcTensorProduct(A * -h, J) + MatrixX<T>::Identity(n , n));
 }
 
+// Sparse counterpart of ComputeRadauIterationMatrix(): computes I - h A ⊗ J
+// directly from the nonzeros of J, so that the (num_stages * n)-dimensional
+// iteration matrix is never formed densely.
+template <typename T, int num_stages>
+Eigen::SparseMatrix<T>
+RadauIntegrator<T, num_stages>::CalcSparseRadauIterationMatrix(
+    const Eigen::SparseMatrix<T>& J, const T& h, const MatrixX<double>& A) {
+  const int n = J.rows();
+  std::vector<Eigen::Triplet<T>> triplets;
+  triplets.reserve(num_stages * num_stages * J.nonZeros() + num_stages * n);
+  for (int i = 0; i < num_stages; ++i) {
+    for (int j = 0; j < num_stages; ++j) {
+      if (A(i, j) == 0.0) continue;
+      const T scale = -h * A(i, j);
+      for (int k = 0; k < J.outerSize(); ++k) {
+        for (typename Eigen::SparseMatrix<T>::InnerIterator it(J, k); it;
+             ++it) {
+          triplets.emplace_back(i * n + it.row(), j * n + it.col(),
+                                scale * it.value());
+        }
+      }
+    }
+  }
+  for (int i = 0; i < num_stages * n; ++i)
+    triplets.emplace_back(i, i, T(1));
+
+  // Duplicate entries (the diagonal) are summed.
+  Eigen::SparseMatrix<T> iteration_matrix(num_stages * n, num_stages * n);
+  iteration_matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return iteration_matrix;
+}
+
 // Computes the tensor product between two matrices. Given
 // A = | a11 ... a1m |
 //     | ...     ... |
@@ -45,6 +45,11 @@ class RungeKutta2Integrator final : public IntegratorBase<T> {
   int get_error_estimate_order() const override { return 0; }
 
  private:
+  std::unique_ptr<IntegratorBase<T>> DoClone(
+      Context<T>* context) const override {
+    return std::make_unique<RungeKutta2Integrator<T>>(
+        this->get_system(), this->get_maximum_step_size(), context);
+  }
   bool DoStep(const T& h) override;
 
   // A pre-allocated temporary for use by integration.
@@ -0,0 +1,6 @@
+#include "drake/systems/analysis/runge_kutta5_integrator.h"
+
+#include "drake/common/autodiff.h"
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::RungeKutta5Integrator)
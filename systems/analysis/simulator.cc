@@ -1,17 +1,263 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <thread>
+#include <utility>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/extract_double.h"
 
 namespace drake {
 namespace systems {
+namespace internal {
+
+// Runs the publishes queued by a Simulator on a worker thread, one at a time
+// and in the order in which they were queued. The first exception thrown by a
+// publish is kept, and the publishes queued after it are discarded, until it
+// is rethrown on the simulation thread by Push() or Flush().
+class AsyncPublisher {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncPublisher)
+
+  explicit AsyncPublisher(int max_queue_size)
+      : max_queue_size_(max_queue_size), thread_([this]() { Run(); }) {}
+
+  // Completes all pending publishes, then joins the thread.
+  ~AsyncPublisher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    has_work_.notify_all();
+    thread_.join();
+  }
+
+  int max_queue_size() const { return max_queue_size_; }
+
+  // Queues `publish`, waiting for room if the queue is full.
+  void Push(std::function<void()> publish) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    has_room_.wait(lock, [this]() {
+      return static_cast<int>(queue_.size()) < max_queue_size_ ||
+             error_ != nullptr;
+    });
+    RethrowIfFailed();
+    queue_.push_back(std::move(publish));
+    lock.unlock();
+    has_work_.notify_one();
+  }
+
+  // Blocks until the queue is empty and no publish is in progress.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+    RethrowIfFailed();
+  }
+
+ private:
+  // Rethrows and forgets the kept exception, if any. The mutex must be held.
+  void RethrowIfFailed() {
+    if (error_ == nullptr) return;
+    std::exception_ptr error = std::move(error_);
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      has_work_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;  // Stopping, and nothing left to publish.
+      std::function<void()> publish = std::move(queue_.front());
+      queue_.pop_front();
+      busy_ = true;
+      lock.unlock();
+      has_room_.notify_one();
+      std::exception_ptr error;
+      try {
+        publish();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      busy_ = false;
+      if (error != nullptr && error_ == nullptr) {
+        error_ = std::move(error);
+        queue_.clear();
+        has_room_.notify_all();
+      }
+      if (queue_.empty()) idle_.notify_all();
+    }
+  }
+
+  const int max_queue_size_;
+  std::mutex mutex_;
+  std::condition_variable has_work_;
+  std::condition_variable has_room_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> queue_;
+  bool busy_{false};
+  bool stopping_{false};
+  std::exception_ptr error_;
+  // Declared last so that the thread starts once the members above exist.
+  std::thread thread_;
+};
+
+}  // namespace internal
 
 template <typename T>
-void Simulator<T>::PauseIfTooFast() const {
+Simulator<T>::~Simulator() {
+  if (async_publisher_ == nullptr) return;
+  try {
+    async_publisher_->Flush();
+  } catch (const std::exception& e) {
+    drake::log()->error("Simulator: an asynchronous publish failed: {}",
+                        e.what());
+  }
+}
+
+template <typename T>
+void Simulator<T>::set_publish_asynchronously(bool publish_asynchronously,
+                                              int max_queue_size) {
+  if (max_queue_size <= 0) {
+    throw std::logic_error(
+        "Simulator: the asynchronous publish queue size must be positive");
+  }
+  FinishPendingPublishes();
+  async_publisher_.reset();
+  if (publish_asynchronously) {
+    async_publisher_ =
+        std::make_shared<internal::AsyncPublisher>(max_queue_size);
+  }
+}
+
+template <typename T>
+void Simulator<T>::FinishPendingPublishes() {
+  if (async_publisher_ != nullptr) async_publisher_->Flush();
+}
+
+// Processes Publish events.
+template <typename T>
+void Simulator<T>::HandlePublish(
+    const EventCollection<PublishEvent<T>>& events) {
+  if (!events.HasEvents()) return;
+  ++num_publishes_;
+  // The data of witness-triggered events refers to this simulator's context
+  // and temporaries; they are published synchronously, after the pending
+  // publishes so that the order of the publishes is preserved.
+  if (async_publisher_ == nullptr ||
+      (time_or_witness_triggered_ & kWitnessTriggered)) {
+    FinishPendingPublishes();
+    system_.Publish(*context_, events);
+    return;
+  }
+  // The events collection is reused by the next step, hence it is copied
+  // along with the snapshot of the context.
+  std::shared_ptr<const Context<T>> snapshot = context_->Clone();
+  std::shared_ptr<CompositeEventCollection<T>> snapshot_events =
+      system_.AllocateCompositeEventCollection();
+  snapshot_events->get_mutable_publish_events().SetFrom(events);
+  const System<T>& system = system_;
+  async_publisher_->Push([&system, snapshot, snapshot_events]() {
+    system.Publish(*snapshot, snapshot_events->get_publish_events());
+  });
+}
+
+template <typename T>
+void Simulator<T>::HandleForcedPublish() {
+  ++num_publishes_;
+  if (async_publisher_ == nullptr) {
+    system_.Publish(*context_);
+    return;
+  }
+  std::shared_ptr<const Context<T>> snapshot = context_->Clone();
+  const System<T>& system = system_;
+  async_publisher_->Push([&system, snapshot]() { system.Publish(*snapshot); });
+}
+
+template <typename T>
+T Simulator<T>::FindNextTimedUpdateTime(const T& publish_time,
+                                        const T& boundary_time) {
+  using std::min;
+  if (interpolation_events_ == nullptr) {
+    interpolation_events_ = system_.AllocateCompositeEventCollection();
+  }
+  const T t0 = context_->get_time();
+
+  // IntegratorBase::IntegrateNoFurtherThanTime() may stretch the maximum step
+  // size to reach an event, but no further.
+  const T horizon =
+      min(boundary_time, t0 + integrator_->get_maximum_step_size() *
+                                  integrator_->get_stretch_factor());
+  T update_time = std::numeric_limits<double>::infinity();
+  T time = publish_time;
+  while (time <= horizon) {
+    context_->SetTime(time);
+    time = system_.CalcNextUpdateTime(*context_, interpolation_events_.get());
+    if (interpolation_events_->HasDiscreteUpdateEvents() ||
+        interpolation_events_->HasUnrestrictedUpdateEvents()) {
+      update_time = time;
+      break;
+    }
+  }
+  context_->SetTime(t0);
+
+  // The derivatives are evaluated last, so that the integrator finds them
+  // cached.
+  interpolation_t0_ = t0;
+  interpolation_x0_ = context_->get_continuous_state().CopyToVector();
+  interpolation_xdot0_ = system_.EvalTimeDerivatives(*context_).CopyToVector();
+  return update_time;
+}
+
+template <typename T>
+void Simulator<T>::HandleInterpolatedPublishes(const T& publish_time) {
+  const T tf = context_->get_time();
+  if (publish_time > tf) return;
+
+  const T& t0 = interpolation_t0_;
+  const T h = tf - t0;
+  xf_ = context_->get_continuous_state().CopyToVector();
+  xdotf_ = system_.EvalTimeDerivatives(*context_).CopyToVector();
+  const VectorX<T>& x0 = interpolation_x0_;
+  const VectorX<T>& xdot0 = interpolation_xdot0_;
+
+  T time = publish_time;
+  while (time <= tf && !timed_events_->HasDiscreteUpdateEvents() &&
+         !timed_events_->HasUnrestrictedUpdateEvents()) {
+    // The cubic Hermite interpolant of the step, as in HermitianDenseOutput.
+    if (time == tf) {
+      xc_ = xf_;
+    } else {
+      const T s = (time - t0) / h;
+      const T s2 = s * s;
+      const T s3 = s2 * s;
+      xc_ = (2.0 * s3 - 3.0 * s2 + 1.0) * x0 +
+            ((s3 - 2.0 * s2 + s) * h) * xdot0 + (3.0 * s2 - 2.0 * s3) * xf_ +
+            ((s3 - s2) * h) * xdotf_;
+    }
+    context_->SetTime(time);
+    context_->get_mutable_continuous_state().SetFromVector(xc_);
+    HandlePublish(timed_events_->get_publish_events());
+    time = system_.CalcNextUpdateTime(*context_, timed_events_.get());
+  }
+
+  context_->SetTime(tf);
+  context_->get_mutable_continuous_state().SetFromVector(xf_);
+}
+
+template <typename T>
+void Simulator<T>::PauseIfTooFast() {
   if (target_realtime_rate_ <= 0) return;  // Run at full speed.
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
   const double simtime_passed = simtime_now - initial_simtime_;
@@ -19,8 +265,15 @@ void Simulator<T>::PauseIfTooFast() const {
       initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
   // TODO(sherm1): Could add some slop to now() and not sleep if
   // we are already close enough. But what is a reasonable value?
-  if (desired_realtime > Clock::now())
+  const TimePoint realtime_now = Clock::now();
+  if (desired_realtime > realtime_now) {
     std::this_thread::sleep_until(desired_realtime);
+  } else if (desired_realtime < realtime_now) {
+    const double overrun = Duration(realtime_now - desired_realtime).count();
+    ++num_realtime_overruns_;
+    max_realtime_overrun_ = std::max(max_realtime_overrun_, overrun);
+    if (realtime_overrun_callback_) realtime_overrun_callback_(overrun);
+  }
 }
 
 template <typename T>
@@ -39,11 +292,52 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  num_realtime_overruns_ = 0;
+  max_realtime_overrun_ = 0.;
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
   initial_realtime_ = Clock::now();
 }
 
+template <typename T>
+std::unique_ptr<Simulator<T>> Simulator<T>::Fork() const {
+  DRAKE_THROW_UNLESS(context_ != nullptr);
+  // The data of witness-triggered events refers to this simulator's context.
+  if (initialization_done_ &&
+      (time_or_witness_triggered_ & kWitnessTriggered)) {
+    throw std::logic_error(
+        "Simulator::Fork(): cannot fork while a witness-triggered event is "
+        "pending; call AdvancePendingEvents() first");
+  }
+  auto fork = std::make_unique<Simulator<T>>(system_, context_->Clone());
+  fork->integrator_ = integrator_->Clone(fork->context_.get());
+  fork->target_realtime_rate_ = target_realtime_rate_;
+  fork->publish_every_time_step_ = publish_every_time_step_;
+  fork->publish_at_initialization_ = publish_at_initialization_;
+  fork->interpolate_timed_publishes_ = interpolate_timed_publishes_;
+  if (async_publisher_ != nullptr) {
+    fork->async_publisher_ = std::make_shared<internal::AsyncPublisher>(
+        async_publisher_->max_queue_size());
+  }
+  fork->realtime_overrun_callback_ = realtime_overrun_callback_;
+  if (initialization_done_) {
+    auto copy_events = [this](const CompositeEventCollection<T>& events) {
+      auto result = system_.AllocateCompositeEventCollection();
+      result->SetFrom(events);
+      return result;
+    };
+    fork->per_step_events_ = copy_events(*per_step_events_);
+    fork->timed_events_ = copy_events(*timed_events_);
+    fork->witnessed_events_ = copy_events(*witnessed_events_);
+    fork->merged_events_ = system_.AllocateCompositeEventCollection();
+    fork->time_or_witness_triggered_ = time_or_witness_triggered_;
+    fork->next_timed_event_time_ = next_timed_event_time_;
+    fork->ResetStatistics();
+    fork->initialization_done_ = true;
+  }
+  return fork;
+}
+
 template class Simulator<double>;
 template class Simulator<AutoDiffXd>;
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <tuple>
@@ -16,15 +17,23 @@
 #include "drake/common/drake_optional.h"
 #include "drake/common/extract_double.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/trace_span.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
+#include "drake/systems/framework/system_profiler.h"
 #include "drake/systems/framework/witness_function.h"
 
 namespace drake {
 namespace systems {
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+class AsyncPublisher;
+}  // namespace internal
+#endif
+
 /** @ingroup simulation
 A class for advancing the state of hybrid dynamic systems, represented by
 `System<T>` objects, forward in time. Starting with an initial Context for a
@@ -224,6 +233,10 @@ class Simulator {
   Simulator(std::unique_ptr<const System<T>> system,
             std::unique_ptr<Context<T>> context = nullptr);
 
+  /// Completes any pending asynchronous publishes before destruction. See
+  /// set_publish_asynchronously().
+  ~Simulator();
+
   // TODO(sherm1) Make Initialize() attempt to satisfy constraints.
   // TODO(sherm1) Add a ReInitialize() or Resume() method that is called
   //              automatically by AdvanceTo() if the Context has changed.
@@ -309,8 +322,6 @@ class Simulator {
   void StepTo(const T& boundary_time) { AdvanceTo(boundary_time); }
 #endif
 
-  // TODO(sherm1): Provide options for issuing a warning or aborting the
-  // simulation if the desired rate cannot be achieved.
   /// Slow the simulation down to *approximately* synchronize with real time
   /// when it would otherwise run too fast. Normally the %Simulator takes steps
   /// as quickly as it can. You can request that it slow down to synchronize
@@ -324,6 +335,10 @@ class Simulator {
   /// other uses you should consider whether approximate real time is adequate
   /// for your purposes.
   ///
+  /// Steps that end later in real time than the target rate calls for are
+  /// counted as overruns; see get_num_realtime_overruns() and
+  /// set_realtime_overrun_callback().
+  ///
   /// @note If the full-speed simulation is already slower than real time you
   /// can't speed it up with this call! Instead consider requesting less
   /// integration accuracy, using a faster integration method or fixed time
@@ -366,6 +381,28 @@ class Simulator {
   /// @see set_target_realtime_rate()
   double get_actual_realtime_rate() const;
 
+  /// Gets the number of steps since the last Initialize() or ResetStatistics()
+  /// call that ended later in real time than the target realtime rate called
+  /// for, so that the %Simulator could not pause before the next step. Always
+  /// zero if no target realtime rate is set.
+  /// @see set_target_realtime_rate()
+  int64_t get_num_realtime_overruns() const { return num_realtime_overruns_; }
+
+  /// Gets the largest amount of real time (in seconds) by which a step ended
+  /// late since the last Initialize() or ResetStatistics() call, or zero if
+  /// there were no overruns.
+  /// @see get_num_realtime_overruns()
+  double get_max_realtime_overrun() const { return max_realtime_overrun_; }
+
+  /// Sets a function to be called, with the amount of real time (in seconds)
+  /// by which the step ended late, whenever a step overruns the target
+  /// realtime rate. It is called from AdvanceTo() at the end of the step, so
+  /// it should return quickly. Pass nullptr (the default) to stop.
+  /// @see get_num_realtime_overruns()
+  void set_realtime_overrun_callback(std::function<void(double)> callback) {
+    realtime_overrun_callback_ = std::move(callback);
+  }
+
   /// Sets whether the simulation should trigger a forced-Publish event on the
   /// System under simulation at the end of every trajectory-advancing step.
   /// Specifically, that means the System::Publish() event dispatcher will be
@@ -396,6 +433,75 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// Sets whether timed events that only publish (e.g. the periodic publish
+  /// events of a SignalLogger or of a visualizer) are handled on the
+  /// interpolant of the continuous state rather than by ending an integration
+  /// step at each of their times. When enabled, the steps are sized by the
+  /// integrator's accuracy and by the other events only, and the publish
+  /// events that occur within a step are dispatched after the step, in order,
+  /// with the time and continuous state of the Context set to their values on
+  /// the cubic Hermite interpolant of the step (the one of
+  /// HermitianDenseOutput). Timed events that also update the state are
+  /// still handled exactly at their times.
+  ///
+  /// The discrete and abstract states seen by the interpolated publishes are
+  /// those of the step, and the continuous state is only accurate to the
+  /// order of the interpolant. Use this for publishers that tolerate that,
+  /// such as loggers and visualizers of smooth systems. This has no effect on
+  /// Systems without continuous state. The default is false.
+  void set_interpolate_timed_publishes(bool interpolate) {
+    interpolate_timed_publishes_ = interpolate;
+  }
+
+  /// Returns true if the set_interpolate_timed_publishes() option has been
+  /// enabled. By default, returns false.
+  bool get_interpolate_timed_publishes() const {
+    return interpolate_timed_publishes_;
+  }
+
+  /// Sets whether publish events (including the forced publishes of
+  /// set_publish_every_time_step() and set_publish_at_initialization()) are
+  /// dispatched to a background thread so that simulation keeps stepping
+  /// while slow publishers (e.g. LCM publishers, ImageWriter or
+  /// visualizers) complete their I/O. Each publish is handed a snapshot (a
+  /// clone) of the Context at the time it was triggered, and publishes are
+  /// dispatched one at a time in the order in which they were triggered, so
+  /// the publishes of each subsystem are seen in the same order as when
+  /// publishing synchronously. At most `max_queue_size` publishes are
+  /// pending; once the queue is full, the simulation waits for room rather
+  /// than dropping publishes. Publish events triggered by witness functions
+  /// are always dispatched on the calling thread, after all pending
+  /// publishes, since their event data refers to the %Simulator's internal
+  /// state.
+  ///
+  /// The publish event handlers then run concurrently with the computations
+  /// of the System on the %Simulator's Context, and must therefore only read
+  /// from the Context they are given and be safe to call concurrently with
+  /// those computations. Since publishes may still be in progress when
+  /// AdvanceTo() returns, call FinishPendingPublishes() before inspecting the
+  /// results of a publisher, e.g. the data recorded by a SignalLogger. An
+  /// exception thrown by a publish event handler is rethrown on the calling
+  /// thread by the next publish or by FinishPendingPublishes(), and
+  /// subsequent asynchronous publishes are discarded until then.
+  ///
+  /// Completes the pending publishes before changing the option. The default
+  /// is to publish synchronously.
+  /// @throws std::logic_error if `max_queue_size` is not positive.
+  void set_publish_asynchronously(bool publish_asynchronously,
+                                  int max_queue_size = 2);
+
+  /// Returns true if the set_publish_asynchronously() option has been
+  /// enabled. By default, returns false.
+  bool get_publish_asynchronously() const {
+    return async_publisher_ != nullptr;
+  }
+
+  /// Blocks until all pending asynchronous publishes have completed. It is a
+  /// no-op when publishing synchronously. See set_publish_asynchronously().
+  /// @throws the first exception thrown by an asynchronous publish event
+  ///         handler since the last call, if any.
+  void FinishPendingPublishes();
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -442,6 +548,25 @@ class Simulator {
     return std::move(context_);
   }
 
+  /// Creates a new %Simulator that continues from the current trajectory
+  /// value of this one, for branching simulations (e.g., rollouts of
+  /// different inputs from a common state). The fork owns a clone of the
+  /// Context and an integrator of the same type, with the same settings and
+  /// step size history (see IntegratorBase::Clone()). If this %Simulator has
+  /// been initialized, so is the fork, with the same pending events, so that
+  /// advancing the fork does not repeat initialization events and advances
+  /// exactly as this %Simulator would. The realtime rate and publishing
+  /// options are copied; the system profiler and statistics are not.
+  ///
+  /// The fork refers to the same System as this %Simulator (even if this
+  /// %Simulator owns it), which must outlive the fork. Forks are independent
+  /// of each other and of this %Simulator, and may be advanced concurrently
+  /// on different threads provided that the System itself is thread-safe.
+  /// @throws std::logic_error if the integrator does not support
+  ///         IntegratorBase::Clone(), or if a witness-triggered event is
+  ///         pending (call AdvancePendingEvents() first).
+  std::unique_ptr<Simulator<T>> Fork() const;
+
   /// Forget accumulated statistics. Statistics are reset to the values they
   /// have post construction or immediately after `Initialize()`.
   void ResetStatistics();
@@ -464,6 +589,20 @@ class Simulator {
   int64_t get_num_unrestricted_updates() const {
     return num_unrestricted_updates_; }
 
+  /// (Debugging) Sets the profiler that times the computations of each
+  /// subsystem (time derivatives, updates, publishes, and output ports) while
+  /// this %Simulator runs Initialize() and AdvanceTo(). The profiler is not
+  /// owned and must outlive its use by this %Simulator; it may be shared
+  /// among Simulators that don't run concurrently. Pass nullptr (the default)
+  /// to stop profiling.
+  /// @see SystemProfiler
+  void set_system_profiler(SystemProfiler* profiler) {
+    system_profiler_ = profiler;
+  }
+
+  /// Returns the profiler set by set_system_profiler(), or nullptr.
+  SystemProfiler* get_system_profiler() const { return system_profiler_; }
+
   /// Gets a reference to the integrator used to advance the continuous aspects
   /// of the system.
   const IntegratorBase<T>& get_integrator() const { return *integrator_.get(); }
@@ -559,6 +698,23 @@ class Simulator {
 
   void HandlePublish(const EventCollection<PublishEvent<T>>& events);
 
+  // Performs the forced publish of set_publish_every_time_step() and
+  // set_publish_at_initialization().
+  void HandleForcedPublish();
+
+  // For set_interpolate_timed_publishes(), returns the time of the first timed
+  // event that updates the state at or after `publish_time`, the time of the
+  // next publish-only timed event, searching no further than the longest step
+  // that the integrator may take before `boundary_time`. Returns infinity if
+  // there is none. Saves the start of the step for the interpolant.
+  T FindNextTimedUpdateTime(const T& publish_time, const T& boundary_time);
+
+  // For set_interpolate_timed_publishes(), handles the publish-only timed
+  // events from the events in timed_events_, at `publish_time`, up to the
+  // current time. On return, timed_events_ holds the events at the first time
+  // that was not handled.
+  void HandleInterpolatedPublishes(const T& publish_time);
+
   TimeOrWitnessTriggered IntegrateContinuousState(
       const T& next_publish_dt,
       const T& next_update_dt,
@@ -569,7 +725,7 @@ class Simulator {
   // Private methods related to witness functions.
   void IsolateWitnessTriggers(
       const std::vector<const WitnessFunction<T>*>& witnesses,
-      const VectorX<T>& w0,
+      const VectorX<T>& w0, const VectorX<T>& wf,
       const T& t0, const VectorX<T>& x0, const T& tf,
       std::vector<const WitnessFunction<T>*>* triggered_witnesses);
   void PopulateEventDataForTriggeredWitness(
@@ -580,9 +736,9 @@ class Simulator {
     const VectorX<T>& w0,
     const VectorX<T>& wf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses);
-  VectorX<T> EvaluateWitnessFunctions(
+  void EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const;
+    const Context<T>& context, VectorX<T>* weval) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
   // The steady_clock is immune to system clock changes so increases
@@ -592,8 +748,9 @@ class Simulator {
   using TimePoint = std::chrono::time_point<Clock, Duration>;
 
   // If the simulated time in the context is ahead of real time, pause long
-  // enough to let real time catch up (approximately).
-  void PauseIfTooFast() const;
+  // enough to let real time catch up (approximately); if it is behind, record
+  // the overrun.
+  void PauseIfTooFast();
 
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
@@ -619,7 +776,14 @@ class Simulator {
 
   // Temporaries used for witness function isolation.
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
-  VectorX<T> w0_, wf_;
+  VectorX<T> w0_, wf_, wc_;
+
+  // Temporary used to save the continuous state at the start of a step.
+  VectorX<T> x0_;
+
+  // Temporaries for the cubic Hermite interpolant of the continuous state
+  // over a step, used for witness function isolation.
+  VectorX<T> xf_, xdot0_, xdotf_, xc_;
 
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{0.};
@@ -628,6 +792,24 @@ class Simulator {
 
   bool publish_at_initialization_{false};
 
+  bool interpolate_timed_publishes_{false};
+
+  // For set_interpolate_timed_publishes(), the events probed by
+  // FindNextTimedUpdateTime(), and the time, continuous state and its time
+  // derivatives at the start of the step.
+  std::unique_ptr<CompositeEventCollection<T>> interpolation_events_;
+  T interpolation_t0_{std::numeric_limits<double>::quiet_NaN()};
+  VectorX<T> interpolation_x0_, interpolation_xdot0_;
+
+  // Dispatches publishes to a background thread; null when publishing
+  // synchronously. See set_publish_asynchronously(). A shared_ptr (never
+  // shared) since, unlike unique_ptr, its deleter does not need
+  // AsyncPublisher to be complete in the constructors defined in this header.
+  std::shared_ptr<internal::AsyncPublisher> async_publisher_;
+
+  // Not owned; may be null.
+  SystemProfiler* system_profiler_{nullptr};
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
@@ -644,6 +826,14 @@ class Simulator {
   // The number of integration steps since the last statistics reset.
   int64_t num_steps_taken_{0};
 
+  // The number of steps that overran the target realtime rate, and the
+  // largest overrun (in seconds), since the last statistics reset.
+  int64_t num_realtime_overruns_{0};
+  double max_realtime_overrun_{0.};
+
+  // Called on every realtime overrun; may be null.
+  std::function<void(double)> realtime_overrun_callback_;
+
   // Set by Initialize() and reset by various traumas.
   bool initialization_done_{false};
 
@@ -667,6 +857,11 @@ class Simulator {
   // AdvanceTo(). This collection is constructed within Initialize().
   std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
 
+  // The per-step, timed and witnessed events to be handled at the start of the
+  // next step. This collection is constructed within Initialize() and reused
+  // so that steady-state steps don't allocate.
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+
   // Indicates when a timed or witnessed event needs to be handled on the next
   // call to AdvanceTo().
   TimeOrWitnessTriggered time_or_witness_triggered_{
@@ -791,6 +986,8 @@ T GetPreviousNormalizedValue(const T& value) {
 
 template <typename T>
 void Simulator<T>::Initialize() {
+  const internal::ScopedSystemProfilerActivation profiling(system_profiler_);
+
   // TODO(sherm1) Modify Context to satisfy constraints.
   // TODO(sherm1) Invoke System's initial conditions computation.
 
@@ -842,6 +1039,9 @@ void Simulator<T>::Initialize() {
   // Allocate the witness function collection.
   witnessed_events_ = system_.AllocateCompositeEventCollection();
 
+  // Allocate the collection of the events to be handled at each step.
+  merged_events_ = system_.AllocateCompositeEventCollection();
+
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
   // events to precede any per-step or timed events in the merged collection.
@@ -854,10 +1054,7 @@ void Simulator<T>::Initialize() {
 
   // TODO(siyuan): transfer publish entirely to individual systems.
   // Do a force-publish before the simulation starts.
-  if (publish_at_initialization_) {
-    system_.Publish(*context_);
-    ++num_publishes_;
-  }
+  if (publish_at_initialization_) HandleForcedPublish();
 
   // Initialize runtime variables.
   initialization_done_ = true;
@@ -896,24 +1093,17 @@ void Simulator<T>::HandleDiscreteUpdate(
   }
 }
 
-// Processes Publish events.
-template <typename T>
-void Simulator<T>::HandlePublish(
-    const EventCollection<PublishEvent<T>>& events) {
-  if (events.HasEvents()) {
-    system_.Publish(*context_, events);
-    ++num_publishes_;
-  }
-}
-
 template <typename T>
 void Simulator<T>::AdvanceTo(const T& boundary_time) {
+  DRAKE_TRACE_SPAN("Simulator::AdvanceTo");
+  const internal::ScopedSystemProfilerActivation profiling(system_profiler_);
   if (!initialization_done_) Initialize();
 
   DRAKE_THROW_UNLESS(boundary_time >= context_->get_time());
 
-  // Integrate until desired interval has completed.
-  auto merged_events = system_.AllocateCompositeEventCollection();
+  // Integrate until desired interval has completed. The event collections
+  // were allocated by Initialize() and are reused at every step.
+  CompositeEventCollection<T>* const merged_events = merged_events_.get();
   DRAKE_DEMAND(timed_events_ != nullptr);
   DRAKE_DEMAND(witnessed_events_ != nullptr);
   DRAKE_DEMAND(merged_events != nullptr);
@@ -963,6 +1153,18 @@ void Simulator<T>::AdvanceTo(const T& boundary_time) {
       next_publish_time = next_timed_event_time_;
     }
 
+    // Publish-only timed events do not limit the step when they are handled
+    // on the interpolant; the step then stops at the next timed update only.
+    const bool interpolate_publishes =
+        interpolate_timed_publishes_ && next_publish_time < next_update_time &&
+        context_->num_continuous_states() > 0;
+    const T interpolated_publish_time = next_publish_time;
+    if (interpolate_publishes) {
+      next_update_time =
+          FindNextTimedUpdateTime(interpolated_publish_time, boundary_time);
+      next_publish_time = std::numeric_limits<double>::infinity();
+    }
+
     // Integrate the continuous state forward in time.
     time_or_witness_triggered_ = IntegrateContinuousState(
         next_publish_time,
@@ -971,6 +1173,13 @@ void Simulator<T>::AdvanceTo(const T& boundary_time) {
         boundary_time,
         witnessed_events_.get());
 
+    // Handle the publish-only timed events within the step, after which
+    // timed_events_ holds the events of the next update if the step reached
+    // it.
+    if (interpolate_publishes) {
+      HandleInterpolatedPublishes(interpolated_publish_time);
+    }
+
     // Update the number of simulation steps taken.
     ++num_steps_taken_;
 
@@ -993,10 +1202,7 @@ void Simulator<T>::AdvanceTo(const T& boundary_time) {
 
     // TODO(siyuan): transfer per step publish entirely to individual systems.
     // Allow System a chance to produce some output.
-    if (get_publish_every_time_step()) {
-      system_.Publish(*context_);
-      ++num_publishes_;
-    }
+    if (get_publish_every_time_step()) HandleForcedPublish();
 
     // Break out of the loop after timed and witnessed events are merged in
     // to the event collection and after any publishes.
@@ -1081,16 +1287,15 @@ optional<T> Simulator<T>::GetCurrentWitnessTimeIsolation() const {
 template <class T>
 void Simulator<T>::IsolateWitnessTriggers(
     const std::vector<const WitnessFunction<T>*>& witnesses,
-    const VectorX<T>& w0,
+    const VectorX<T>& w0, const VectorX<T>& wf,
     const T& t0, const VectorX<T>& x0, const T& tf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses) {
 
   // Verify that the vector of triggered witnesses is non-null.
   DRAKE_DEMAND(triggered_witnesses);
 
-  // TODO(edrumwri): Speed this process using interpolation between states,
-  // more powerful root finding methods, and/or introducing the concept of
-  // a dead band.
+  // TODO(edrumwri): Speed this process using more powerful root finding
+  // methods and/or introducing the concept of a dead band.
 
   // Will need to alter the context repeatedly.
   Context<T>& context = get_mutable_context();
@@ -1104,7 +1309,7 @@ void Simulator<T>::IsolateWitnessTriggers(
     return;
 
   // Mini function for integrating the system forward in time from t0.
-  std::function<void(const T&)> integrate_forward =
+  const auto integrate_forward =
       [&t0, &x0, &context, this](const T& t_des) {
     const T inf = std::numeric_limits<double>::infinity();
     context.SetTime(t0);
@@ -1113,67 +1318,134 @@ void Simulator<T>::IsolateWitnessTriggers(
       integrator_->IntegrateNoFurtherThanTime(inf, inf, t_des);
   };
 
+  // Rather than integrating from t0 for every candidate time, the candidates
+  // are first searched for on the cubic Hermite interpolant of the state over
+  // [t0, tf], which needs only the time derivatives at both ends of the step.
+  // The context is at tf on entry.
+  const VectorBase<T>& xc = context.get_continuous_state().get_vector();
+  xf_.resize(xc.size());
+  xdot0_.resize(xc.size());
+  xdotf_.resize(xc.size());
+  if (xc.size() > 0) {
+    xc.CopyToPreSizedVector(&xf_);
+    get_system().EvalTimeDerivatives(context).get_vector()
+        .CopyToPreSizedVector(&xdotf_);
+    context.SetTime(t0);
+    context.get_mutable_continuous_state().SetFromVector(x0);
+    get_system().EvalTimeDerivatives(context).get_vector()
+        .CopyToPreSizedVector(&xdot0_);
+  }
+
+  // Mini function for setting the context to the interpolated state at t.
+  const auto interpolate = [&t0, &x0, &tf, &context, this](const T& t) {
+    const T h = tf - t0;
+    const T s = (t - t0) / h;
+    const T s2 = s * s;
+    const T s3 = s2 * s;
+    xc_ = (2.0 * s3 - 3.0 * s2 + 1.0) * x0 +
+          ((s3 - 2.0 * s2 + s) * h) * xdot0_ + (3.0 * s2 - 2.0 * s3) * xf_ +
+          ((s3 - s2) * h) * xdotf_;
+    context.SetTime(t);
+    context.get_mutable_continuous_state().SetFromVector(xc_);
+  };
+
   // Starting from c = (t0 + tf)/2, look for a witness function triggering
   // over the interval [t0, tc]. Assuming a witness does trigger, c will
   // continue moving leftward as a witness function triggers until the length of
   // the time interval is small. If a witness fails to trigger as c moves
   // leftward, we return, indicating that no witnesses triggered over [t0, c].
+  // On the interpolant, only the witnesses that triggered over [t0, tf] are
+  // evaluated; returns whether a witness triggered, with the context at the
+  // last c.
   SPDLOG_DEBUG(drake::log(),
       "Isolating witness functions using isolation window of {} over [{}, {}]",
       witness_iso_len.value(), t0, tf);
-  VectorX<T> wc(witnesses.size());
-  T a = t0;
-  T b = tf;
-  do {
-    // Compute the midpoint and evaluate the witness functions at it.
-    T c = (a + b) / 2;
-    SPDLOG_DEBUG(drake::log(), "Integrating forward to time {}", c);
-    integrate_forward(c);
-
-    // See whether any witness functions trigger.
-    bool trigger = false;
-    for (size_t i = 0; i < witnesses.size(); ++i) {
-      wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
-      if (witnesses[i]->should_trigger(w0[i], wc[i]))
-        trigger = true;
-    }
+  VectorX<T>& wc = wc_;
+  wc.resize(witnesses.size());
+  bool use_interpolant = true;
+  const auto bisect = [&]() {
+    T a = t0;
+    T b = tf;
+    do {
+      // Compute the midpoint and evaluate the witness functions at it.
+      T c = (a + b) / 2;
+      if (use_interpolant) {
+        SPDLOG_DEBUG(drake::log(), "Interpolating to time {}", c);
+        interpolate(c);
+      } else {
+        SPDLOG_DEBUG(drake::log(), "Integrating forward to time {}", c);
+        integrate_forward(c);
+      }
 
-    // If no witness function triggered, we can continue integrating forward.
-    if (!trigger) {
-      // NOTE: Since we're always checking that the sign changes over [t0,c],
-      // it's also feasible to replace the two lines below with "a = c" without
-      // violating Simulator's contract to only integrate once over the interval
-      // [a, c], for some c <= b before per-step events are handled (i.e., it's
-      // unacceptable to take two steps of (c - a)/2 without processing per-step
-      // events first). That change would avoid handling unnecessary per-step
-      // events- we know no other events are to be handled between t0 and tf-
-      // but the current logic appears easier to follow.
-      SPDLOG_DEBUG(drake::log(), "No witness functions triggered up to {}", c);
-      triggered_witnesses->clear();
-      return;  // Time is c.
-    } else {
-      b = c;
-    }
-  } while (b - a > witness_iso_len.value());
+      // See whether any witness functions trigger.
+      bool trigger = false;
+      for (size_t i = 0; i < witnesses.size(); ++i) {
+        if (use_interpolant && !witnesses[i]->should_trigger(w0[i], wf[i]))
+          continue;
+        wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
+        if (witnesses[i]->should_trigger(w0[i], wc[i]))
+          trigger = true;
+      }
+
+      // If no witness function triggered, we can continue integrating forward.
+      if (!trigger) {
+        // NOTE: Since we're always checking that the sign changes over [t0,c],
+        // it's also feasible to replace the two lines below with "a = c"
+        // without violating Simulator's contract to only integrate once over
+        // the interval [a, c], for some c <= b before per-step events are
+        // handled (i.e., it's unacceptable to take two steps of (c - a)/2
+        // without processing per-step events first). That change would avoid
+        // handling unnecessary per-step events- we know no other events are to
+        // be handled between t0 and tf- but the current logic appears easier
+        // to follow.
+        SPDLOG_DEBUG(drake::log(), "No witness functions triggered up to {}",
+                     c);
+        return false;  // Time is c.
+      } else {
+        b = c;
+      }
+    } while (b - a > witness_iso_len.value());
+    return true;
+  };
+  bool trigger = bisect();
+
+  // Integrate once to the time found on the interpolant, and check the result
+  // against all of the witness functions there. Should the interpolant have
+  // been wrong about whether a witness triggers, search again integrating
+  // forward to every candidate time.
+  const T tc = context.get_time();
+  integrate_forward(tc);
+  bool integrated_trigger = false;
+  for (size_t i = 0; i < witnesses.size(); ++i) {
+    wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
+    if (witnesses[i]->should_trigger(w0[i], wc[i]))
+      integrated_trigger = true;
+  }
+  if (integrated_trigger != trigger) {
+    use_interpolant = false;
+    trigger = bisect();
+  }
 
   // Determine the set of triggered witnesses.
   triggered_witnesses->clear();
+  if (!trigger)
+    return;
   for (size_t i = 0; i < witnesses.size(); ++i) {
     if (witnesses[i]->should_trigger(w0[i], wc[i]))
       triggered_witnesses->push_back(witnesses[i]);
   }
 }
 
-// Evaluates the given vector of witness functions.
+// Evaluates the given vector of witness functions into `weval`, which is
+// resized only if its size differs.
 template <class T>
-VectorX<T> Simulator<T>::EvaluateWitnessFunctions(
+void Simulator<T>::EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const {
+    const Context<T>& context, VectorX<T>* weval) const {
   const System<T>& system = get_system();
-  VectorX<T> weval(witness_functions.size());
+  weval->resize(witness_functions.size());
   for (size_t i = 0; i < witness_functions.size(); ++i)
-    weval[i] = system.CalcWitnessValue(context, *witness_functions[i]);
-  return weval;
+    (*weval)[i] = system.CalcWitnessValue(context, *witness_functions[i]);
 }
 
 // Determines whether at least one of a collection of witness functions
@@ -1260,14 +1532,17 @@ Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state().get_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(&x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
   const auto& witness_functions = *witness_functions_;
 
   // Evaluate the witness functions.
-  w0_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -1278,7 +1553,7 @@ Simulator<T>::IntegrateContinuousState(
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &wf_);
 
   // Triggering requires isolating the witness function time.
   if (DidWitnessTrigger(witness_functions, w0_, wf_, &triggered_witnesses_)) {
@@ -1287,7 +1562,7 @@ Simulator<T>::IntegrateContinuousState(
     // events are only relevant iff at least one witness function is
     // successfully isolated (see IsolateWitnessTriggers() for details).
     IsolateWitnessTriggers(
-        witness_functions, w0_, t0, x0, tf, &triggered_witnesses_);
+        witness_functions, w0_, wf_, t0, x0, tf, &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
@@ -0,0 +1,87 @@
+#include "drake/systems/analysis/batched_simulator.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+using Eigen::MatrixXd;
+
+// Each copy integrates its own constant input.
+void CheckCopies(int num_parallel_executions) {
+  const Integrator<double> integrator(2);
+  BatchedSimulator batch(integrator, 5, num_parallel_executions);
+  EXPECT_EQ(batch.num_copies(), 5);
+  EXPECT_EQ(&batch.get_system(), &integrator);
+  batch.Initialize();
+
+  MatrixXd inputs(2, 5);
+  inputs.row(0) = Eigen::RowVectorXd::LinSpaced(5, 0.0, 4.0);
+  inputs.row(1).setConstant(-1.0);
+  batch.FixInputs(integrator.get_input_port(), inputs);
+  batch.AdvanceBy(0.5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(batch.get_context(i).get_time(), 0.5);
+  }
+  EXPECT_TRUE(CompareMatrices(batch.GetStates(), 0.5 * inputs, 1e-14));
+  EXPECT_TRUE(CompareMatrices(batch.EvalOutputs(integrator.get_output_port()),
+                              0.5 * inputs, 1e-14));
+
+  // Resetting some of the copies.
+  MatrixXd states = batch.GetStates();
+  states.col(3).setZero();
+  batch.SetStates(states);
+  batch.AdvanceBy(0.5);
+  MatrixXd expected = inputs;
+  expected.col(3) *= 0.5;
+  EXPECT_TRUE(CompareMatrices(batch.GetStates(), expected, 1e-14));
+}
+
+GTEST_TEST(BatchedSimulatorTest, Serial) {
+  CheckCopies(1);
+}
+
+GTEST_TEST(BatchedSimulatorTest, Parallel) {
+  CheckCopies(3);
+}
+
+// The copies continue from the root's trajectory value.
+GTEST_TEST(BatchedSimulatorTest, Forks) {
+  const Integrator<double> integrator(1);
+  Simulator<double> root(integrator);
+  integrator.get_input_port().FixValue(&root.get_mutable_context(),
+                                       Vector1d(1.0));
+  root.AdvanceTo(1.0);
+  BatchedSimulator batch(root, 3, 2);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(batch.get_context(i).get_time(), 1.0);
+  }
+  batch.FixInputs(integrator.get_input_port(),
+                  Eigen::RowVector3d(1.0, 2.0, 3.0));
+  batch.AdvanceBy(1.0);
+  EXPECT_TRUE(CompareMatrices(batch.GetStates(),
+                              Eigen::RowVector3d(2.0, 3.0, 4.0), 1e-14));
+  EXPECT_EQ(root.get_context().get_time(), 1.0);
+}
+
+GTEST_TEST(BatchedSimulatorTest, Errors) {
+  const Integrator<double> integrator(2);
+  EXPECT_THROW(BatchedSimulator(integrator, 0), std::exception);
+  EXPECT_THROW(BatchedSimulator(integrator, 2, 0), std::exception);
+  BatchedSimulator batch(integrator, 2);
+  EXPECT_THROW(batch.get_context(2), std::exception);
+  EXPECT_THROW(batch.FixInputs(integrator.get_input_port(), MatrixXd(2, 3)),
+               std::exception);
+  EXPECT_THROW(batch.SetStates(MatrixXd(1, 2)), std::exception);
+  EXPECT_THROW(batch.AdvanceBy(-1.0), std::exception);
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
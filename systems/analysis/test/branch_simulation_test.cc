@@ -0,0 +1,68 @@
+#include "drake/systems/analysis/branch_simulation.h"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+// Each branch integrates a different constant input from the state reached
+// by the root simulation.
+void CheckBranches(int num_parallel_executions) {
+  const Integrator<double> integrator(1);
+  Simulator<double> root(integrator);
+  integrator.get_input_port().FixValue(&root.get_mutable_context(),
+                                       Vector1d(1.0));
+  root.AdvanceTo(1.0);
+
+  const std::vector<double> outputs = SimulateBranches(
+      root,
+      [&integrator](int branch, Simulator<double>* simulator) {
+        integrator.get_input_port().FixValue(&simulator->get_mutable_context(),
+                                             Vector1d(branch));
+        simulator->AdvanceTo(2.0);
+        return simulator->get_context().get_continuous_state()[0];
+      },
+      5, num_parallel_executions);
+  ASSERT_EQ(outputs.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_NEAR(outputs[i], 1.0 + i, 1e-12);
+  }
+
+  // The root is left where it was.
+  EXPECT_EQ(root.get_context().get_time(), 1.0);
+  EXPECT_NEAR(root.get_context().get_continuous_state()[0], 1.0, 1e-12);
+}
+
+GTEST_TEST(SimulateBranchesTest, Serial) {
+  CheckBranches(1);
+}
+
+GTEST_TEST(SimulateBranchesTest, Parallel) {
+  CheckBranches(3);
+}
+
+GTEST_TEST(SimulateBranchesTest, Errors) {
+  const Integrator<double> integrator(1);
+  Simulator<double> root(integrator);
+  integrator.get_input_port().FixValue(&root.get_mutable_context(),
+                                       Vector1d(1.0));
+  const BranchFunction failing = [](int branch, Simulator<double>*) -> double {
+    if (branch >= 2) throw std::runtime_error("branch failed");
+    return 0;
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(SimulateBranches(root, failing, 4, 2),
+                              std::runtime_error, "branch failed");
+  EXPECT_THROW(SimulateBranches(root, failing, 4, 0), std::exception);
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
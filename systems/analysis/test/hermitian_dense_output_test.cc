@@ -334,6 +334,75 @@ TYPED_TEST(HermitianDenseOutputTest, CorrectEvaluation) {
   }
 }
 
+// Checks that HermitianDenseOutput batched evaluation matches evaluation
+// one time at a time, regardless of the time order.
+TYPED_TEST(HermitianDenseOutputTest, BatchedEvaluation) {
+  HermitianDenseOutput<TypeParam> dense_output;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dense_output.Evaluate(std::vector<TypeParam>{this->kInitialTime}),
+      std::logic_error, this->kEmptyOutputErrorMessage);
+  typename HermitianDenseOutput<TypeParam>::IntegrationStep step(
+      this->kInitialTime, this->kInitialState, this->kInitialStateDerivative);
+  step.Extend(this->kMidTime, this->kMidState, this->kMidStateDerivative);
+  step.Extend(this->kFinalTime, this->kFinalState,
+              this->kFinalStateDerivative);
+  dense_output.Update(step);
+  dense_output.Consolidate();
+
+  const std::vector<TypeParam> times{
+    this->kFinalTime, this->kInitialTime, 0.3, this->kMidTime, 0.7, 0.2};
+  const MatrixX<TypeParam> values = dense_output.Evaluate(times);
+  ASSERT_EQ(values.rows(), dense_output.size());
+  ASSERT_EQ(values.cols(), static_cast<int>(times.size()));
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    EXPECT_TRUE(CompareMatrices(values.col(i),
+                                dense_output.Evaluate(times[i])));
+    for (int n = 0; n < dense_output.size(); ++n) {
+      EXPECT_EQ(dense_output.EvaluateNth(times[i], n), values(n, i));
+    }
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dense_output.Evaluate(std::vector<TypeParam>{
+          this->kMidTime, this->kInvalidTime}),
+      std::runtime_error, this->kInvalidTimeErrorMessage);
+}
+
+// Checks that HermitianDenseOutput evicts the steps out of its maximum
+// time span.
+TYPED_TEST(HermitianDenseOutputTest, MaximumTimeSpan) {
+  HermitianDenseOutput<TypeParam> dense_output;
+  EXPECT_THROW(dense_output.set_maximum_time_span(0.), std::runtime_error);
+  dense_output.set_maximum_time_span(2.5 * this->kTimeStep);
+
+  // Consolidates steps of the solution x(t) = t² one by one.
+  const int kNumSteps = 20;
+  for (int i = 0; i < kNumSteps; ++i) {
+    const double t0 = i * this->kTimeStep;
+    const double t1 = (i + 1) * this->kTimeStep;
+    typename HermitianDenseOutput<TypeParam>::IntegrationStep step(
+        t0, MatrixX<TypeParam>::Constant(1, 1, t0 * t0),
+        MatrixX<TypeParam>::Constant(1, 1, 2. * t0));
+    step.Extend(t1, MatrixX<TypeParam>::Constant(1, 1, t1 * t1),
+                MatrixX<TypeParam>::Constant(1, 1, 2. * t1));
+    dense_output.Update(step);
+    dense_output.Consolidate();
+
+    // Only the steps overlapping the time span are kept.
+    const double expected_start_time =
+        std::max(0., t1 - 3. * this->kTimeStep);
+    EXPECT_NEAR(ExtractDoubleOrThrow(dense_output.start_time()),
+                expected_start_time, 1e-12);
+    EXPECT_EQ(dense_output.end_time(), t1);
+    // The cubic interpolation of a quadratic solution is exact.
+    const TypeParam t = 0.5 * (dense_output.start_time() + t1);
+    EXPECT_NEAR(ExtractDoubleOrThrow(dense_output.EvaluateNth(t, 0)),
+                ExtractDoubleOrThrow(t * t), 1e-12);
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dense_output.Evaluate(TypeParam(this->kInitialTime)),
+      std::runtime_error, this->kInvalidTimeErrorMessage);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
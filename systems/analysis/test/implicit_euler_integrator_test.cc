@@ -88,6 +88,68 @@ GTEST_TEST(ImplicitEulerIntegratorTest, Robertson) {
   EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
 }
 
+// Tests the implicit integrator on Robertson's problem using the analytic,
+// sparse Jacobian provided by the system. The solution must be as accurate as
+// with numerical differentiation, yet no derivative evaluations may be spent
+// forming Jacobian matrices.
+GTEST_TEST(ImplicitEulerIntegratorTest, RobertsonSystemProvidedJacobian) {
+  auto robertson = std::make_unique<analysis::test::RobertsonSystem<double>>();
+  std::unique_ptr<Context<double>> context = robertson->CreateDefaultContext();
+  ASSERT_TRUE(robertson->HasTimeDerivativesJacobian());
+
+  const double t_final = robertson->get_end_time();
+  const double tol = 5e-5;
+
+  // Create the integrator, configured as in the Robertson test above.
+  ImplicitEulerIntegrator<double> integrator(*robertson, context.get());
+  integrator.set_maximum_step_size(10000000.0);
+  integrator.set_throw_on_minimum_step_size_violation(false);
+  integrator.set_target_accuracy(tol);
+  integrator.request_initial_step_size_target(1e-4);
+  integrator.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::kSystemProvided);
+
+  // Integrate the system
+  integrator.Initialize();
+  integrator.IntegrateWithMultipleStepsToTime(t_final);
+
+  // Verify the solution.
+  const VectorBase<double>& state = context->get_continuous_state().
+      get_vector();
+  const Eigen::Vector3d sol = robertson->GetSolution(t_final);
+  EXPECT_NEAR(state.GetAtIndex(0), sol(0), tol);
+  EXPECT_NEAR(state.GetAtIndex(1), sol(1), tol);
+  EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
+
+  // Verify that Jacobians were formed without any derivative evaluations.
+  EXPECT_GT(integrator.get_num_jacobian_evaluations(), 0);
+  EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(), 0);
+  EXPECT_EQ(
+      integrator.get_num_error_estimator_derivative_evaluations_for_jacobian(),
+      0);
+}
+
+// Verifies that selecting the system-provided Jacobian scheme for a system
+// that does not provide one throws.
+GTEST_TEST(ImplicitEulerIntegratorTest, SystemProvidedJacobianUnsupported) {
+  StationarySystem stationary;
+  std::unique_ptr<Context<double>> context = stationary.CreateDefaultContext();
+  EXPECT_FALSE(stationary.HasTimeDerivativesJacobian());
+
+  ImplicitEulerIntegrator<double> integrator(stationary, context.get());
+  integrator.set_maximum_step_size(1e-3);
+  integrator.set_fixed_step_mode(true);
+  integrator.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::kSystemProvided);
+  integrator.Initialize();
+  bool result{};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      result = integrator.IntegrateWithSingleFixedStepToTime(1e-3),
+      std::logic_error,
+      ".*does not provide a Jacobian of its time derivatives.*");
+  unused(result);
+}
+
 GTEST_TEST(ImplicitEulerIntegratorTest, FixedStepThrowsOnMultiStep) {
   auto robertson = std::make_unique<analysis::test::RobertsonSystem<double>>();
   std::unique_ptr<Context<double>> context = robertson->CreateDefaultContext();
@@ -418,6 +480,69 @@ TEST_P(ImplicitIntegratorTest, DoubleSpringMassDamper) {
   CheckGeneralStatsValidity(&integrator);
 }
 
+// Checks that the reuse policy settings are honored, and that they do not
+// affect the solution.
+TEST_P(ImplicitIntegratorTest, ReusePolicy) {
+  ImplicitEulerIntegrator<double> integrator(*stiff_double_system_,
+                                             dspring_context_.get());
+  integrator.set_reuse(GetParam());
+
+  // Verify defaults, and that invalid settings are rejected.
+  EXPECT_EQ(integrator.get_max_steps_between_jacobian_evaluations(),
+            std::numeric_limits<int>::max());
+  EXPECT_EQ(integrator.get_iteration_matrix_step_size_change_tolerance(),
+            std::numeric_limits<double>::infinity());
+  EXPECT_EQ(integrator.get_stale_jacobian_convergence_rate(),
+            std::numeric_limits<double>::infinity());
+  EXPECT_THROW(integrator.set_max_steps_between_jacobian_evaluations(0),
+               std::logic_error);
+  EXPECT_THROW(integrator.set_iteration_matrix_step_size_change_tolerance(-1),
+               std::logic_error);
+  EXPECT_THROW(integrator.set_stale_jacobian_convergence_rate(0),
+               std::logic_error);
+
+  // Recompute the Jacobian on every step and refactor the iteration matrix on
+  // every step size change.
+  integrator.set_max_steps_between_jacobian_evaluations(1);
+  EXPECT_EQ(integrator.get_max_steps_between_jacobian_evaluations(), 1);
+  integrator.set_iteration_matrix_step_size_change_tolerance(0.3);
+  EXPECT_EQ(integrator.get_iteration_matrix_step_size_change_tolerance(), 0.3);
+  integrator.set_stale_jacobian_convergence_rate(0.5);
+  EXPECT_EQ(integrator.get_stale_jacobian_convergence_rate(), 0.5);
+
+  integrator.set_maximum_step_size(large_dt_);
+  integrator.request_initial_step_size_target(large_dt_);
+  integrator.set_target_accuracy(1e-5);
+  integrator.Initialize();
+
+  const double t_final = 1.0;
+  std::unique_ptr<State<double>> state_copy = dspring_context_->CloneState();
+  stiff_double_system_->GetSolution(
+      *dspring_context_, t_final, &state_copy->get_mutable_continuous_state());
+  integrator.IntegrateWithMultipleStepsToTime(t_final);
+
+  const VectorX<double> nsol = dspring_context_->get_continuous_state().
+      get_generalized_position().CopyToVector();
+  const VectorX<double> sol = state_copy->get_continuous_state().
+      get_generalized_position().CopyToVector();
+  const double sol_tol = 2e-2;
+  for (int i = 0; i < nsol.size(); ++i)
+    EXPECT_NEAR(sol(i), nsol(i), sol_tol);
+
+  // A Jacobian is computed at least once per step.
+  EXPECT_GE(integrator.get_num_jacobian_evaluations(),
+            integrator.get_num_steps_taken());
+  EXPECT_GT(integrator.get_jacobian_computation_time(), 0.0);
+  EXPECT_GT(integrator.get_largest_num_newton_raphson_iterations_in_step(), 0);
+  EXPECT_LE(integrator.get_largest_num_newton_raphson_iterations_in_step(),
+            integrator.get_num_newton_raphson_iterations());
+  CheckGeneralStatsValidity(&integrator);
+
+  integrator.ResetStatistics();
+  EXPECT_EQ(integrator.get_jacobian_computation_time(), 0.0);
+  EXPECT_EQ(integrator.get_largest_num_newton_raphson_iterations_in_step(), 0);
+}
+
 // Integrate the mass-spring-damping system using huge stiffness and damping.
 // This equation should be stiff.
 TEST_P(ImplicitIntegratorTest, SpringMassDamperStiff) {
@@ -229,6 +229,70 @@ GTEST_TEST(InitialValueProblemTest, ComputationPreconditionsValidation) {
   }
 }
 
+// Checks that ensemble IVP solutions match those solved one by one.
+GTEST_TEST(InitialValueProblemTest, EnsembleSolution) {
+  // The initial time t₀, for IVP definition.
+  const double kDefaultInitialTime = 0.0;
+  // The initial state 𝐱₀, for IVP definition.
+  const VectorX<double> kDefaultInitialState = VectorX<double>::Zero(2);
+  // The default parameters 𝐤₀, for IVP definition.
+  const VectorX<double> kDefaultParameters = VectorX<double>::Ones(1);
+  // All specified values by default, for IVP definition.
+  const InitialValueProblem<double>::SpecifiedValues kDefaultValues(
+      kDefaultInitialTime, kDefaultInitialState, kDefaultParameters);
+
+  // Instantiates a generic IVP for test purposes only,
+  // using a generic ODE d𝐱/dt = -k₁ * 𝐱 + [1, t]ᵀ.
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        return -k[0] * x + (VectorX<double>(2) << 1., t).finished();
+      }, kDefaultValues);
+
+  const int kEnsembleSize = 10;
+  const MatrixX<double> x0s = MatrixX<double>::Random(2, kEnsembleSize);
+  InitialValueProblem<double>::SpecifiedValues values;
+  values.k = 2. * kDefaultParameters;
+  const double kTotalTime = 1.0;
+
+  const MatrixX<double> xfs = ivp.EnsembleSolve(kTotalTime, x0s, values);
+  ASSERT_EQ(xfs.rows(), x0s.rows());
+  ASSERT_EQ(xfs.cols(), kEnsembleSize);
+  for (int i = 0; i < kEnsembleSize; ++i) {
+    InitialValueProblem<double>::SpecifiedValues member_values = values;
+    member_values.x0 = x0s.col(i);
+    EXPECT_TRUE(CompareMatrices(xfs.col(i),
+                                ivp.Solve(kTotalTime, member_values), 1e-14));
+  }
+  // The solution doesn't depend on the number of threads.
+  EXPECT_TRUE(CompareMatrices(
+      ivp.EnsembleSolve(kTotalTime, x0s, values, 3), xfs));
+
+  // The ensemble is solved with the integrator type in use.
+  const double kIntegrationStepSize = 1e-3;
+  ivp.reset_integrator<RungeKutta2Integrator<double>>(kIntegrationStepSize);
+  const MatrixX<double> rk2_xfs = ivp.EnsembleSolve(kTotalTime, x0s, values);
+  for (int i = 0; i < kEnsembleSize; ++i) {
+    InitialValueProblem<double>::SpecifiedValues member_values = values;
+    member_values.x0 = x0s.col(i);
+    EXPECT_TRUE(CompareMatrices(rk2_xfs.col(i),
+                                ivp.Solve(kTotalTime, member_values), 1e-14));
+  }
+  EXPECT_TRUE(CompareMatrices(
+      ivp.EnsembleSolve(kTotalTime, x0s, values, 4), rk2_xfs));
+
+  // Invalid ensembles are rejected.
+  EXPECT_THROW(ivp.EnsembleSolve(kTotalTime, MatrixX<double>::Zero(3, 2)),
+               std::logic_error);
+  EXPECT_THROW(ivp.EnsembleSolve(kTotalTime, x0s, values, 0),
+               std::logic_error);
+  InitialValueProblem<double>::SpecifiedValues invalid_values;
+  invalid_values.x0 = kDefaultInitialState;
+  EXPECT_THROW(ivp.EnsembleSolve(kTotalTime, x0s, invalid_values),
+               std::logic_error);
+  EXPECT_THROW(ivp.EnsembleSolve(-kTotalTime, x0s), std::logic_error);
+}
+
 // Parameterized fixture for testing accuracy of IVP solutions.
 class InitialValueProblemAccuracyTest
     : public ::testing::TestWithParam<double> {
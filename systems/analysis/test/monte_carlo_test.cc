@@ -1,6 +1,8 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <stdexcept>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
@@ -169,6 +171,58 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Confirm that running the samples on multiple threads produces exactly the
+// same results, in the same order, as the serial version.
+GTEST_TEST(MonteCarloSimulationTest, ParallelMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 25;
+
+  RandomGenerator serial_generator;
+  const auto serial = MonteCarloSimulation(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      &serial_generator);
+
+  for (int num_threads : {2, 4, 100}) {
+    RandomGenerator parallel_generator;
+    const auto parallel = MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        &parallel_generator, num_threads);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(parallel[i].output, serial[i].output);
+      RandomGenerator serial_snapshot(serial[i].generator_snapshot);
+      RandomGenerator parallel_snapshot(parallel[i].generator_snapshot);
+      EXPECT_EQ(parallel_snapshot(), serial_snapshot());
+    }
+    // The input generator is advanced identically, too.
+    RandomGenerator serial_copy(serial_generator);
+    EXPECT_EQ(parallel_generator(), serial_copy());
+  }
+}
+
+GTEST_TEST(MonteCarloSimulationTest, ParallelErrors) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const ScalarSystemFunction bad_output = [](const System<double>&,
+                                             const Context<double>&) {
+    throw std::runtime_error("bad output");
+    return 0.0;
+  };
+  const double final_time = 0.1;
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, bad_output, final_time,
+                                    10, nullptr, 3),
+               std::runtime_error);
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput,
+                                    final_time, 10, nullptr, 0),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
@@ -0,0 +1,128 @@
+#include "drake/systems/analysis/multirate_integrator.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/plants/spring_mass_system/spring_mass_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A fixture with a diagram of two independent spring-mass systems, a stiff
+// (fast) one and a soft (slow) one.
+class MultirateIntegratorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    fast_ = builder.AddSystem<SpringMassSystem<double>>(kFastSpring, kMass);
+    slow_ = builder.AddSystem<SpringMassSystem<double>>(kSlowSpring, kMass);
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+    SetInitialConditions(context_.get());
+  }
+
+  void SetInitialConditions(Context<double>* context) const {
+    context->SetTime(0.);
+    for (const SpringMassSystem<double>* spring : {fast_, slow_}) {
+      Context<double>& subcontext =
+          diagram_->GetMutableSubsystemContext(*spring, context);
+      spring->set_position(&subcontext, kInitialPosition);
+      spring->set_velocity(&subcontext, 0.);
+    }
+  }
+
+  double GetPosition(const SpringMassSystem<double>& spring,
+                     const Context<double>& context) const {
+    return spring.get_position(diagram_->GetSubsystemContext(spring, context));
+  }
+
+  const double kFastSpring{1e4};  // N/m
+  const double kSlowSpring{1.};    // N/m
+  const double kMass{1.};          // kg
+  const double kInitialPosition{0.1};
+
+  SpringMassSystem<double>* fast_{};
+  SpringMassSystem<double>* slow_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(MultirateIntegratorTest, InvalidArguments) {
+  const double kStep = 1e-2;
+  EXPECT_THROW(MultirateIntegrator<double>(*fast_, kStep, {}, 1),
+               std::logic_error);
+  EXPECT_THROW(MultirateIntegrator<double>(*diagram_, kStep, {fast_}, 0),
+               std::logic_error);
+  const SpringMassSystem<double> other(kSlowSpring, kMass);
+  EXPECT_THROW(MultirateIntegrator<double>(*diagram_, kStep, {&other}, 1),
+               std::logic_error);
+
+  MultirateIntegrator<double> integrator(*diagram_, kStep, {fast_}, 10,
+                                         context_.get());
+  EXPECT_FALSE(integrator.supports_error_estimation());
+  EXPECT_EQ(integrator.get_num_fast_substeps(), 10);
+  EXPECT_THROW(integrator.set_target_accuracy(1.0), std::logic_error);
+}
+
+// With a single substep, the multirate integrator matches RK2.
+TEST_F(MultirateIntegratorTest, SingleSubstepMatchesRK2) {
+  const double kStep = 1e-4;
+  const double kFinalTime = 0.1;
+  MultirateIntegrator<double> multirate(*diagram_, kStep, {fast_}, 1,
+                                        context_.get());
+  multirate.Initialize();
+  multirate.IntegrateWithMultipleStepsToTime(kFinalTime);
+
+  std::unique_ptr<Context<double>> rk2_context =
+      diagram_->CreateDefaultContext();
+  SetInitialConditions(rk2_context.get());
+  RungeKutta2Integrator<double> rk2(*diagram_, kStep, rk2_context.get());
+  rk2.Initialize();
+  rk2.IntegrateWithMultipleStepsToTime(kFinalTime);
+
+  EXPECT_TRUE(CompareMatrices(
+      context_->get_continuous_state_vector().CopyToVector(),
+      rk2_context->get_continuous_state_vector().CopyToVector(), 1e-12));
+}
+
+// The slow subsystem is evaluated far less often than the fast one, while
+// both are integrated accurately.
+TEST_F(MultirateIntegratorTest, Accuracy) {
+  const double kStep = 1e-2;
+  const int kNumSubsteps = 100;
+  const double kFinalTime = 1.0;
+  MultirateIntegrator<double> integrator(*diagram_, kStep, {fast_},
+                                         kNumSubsteps, context_.get());
+  integrator.Initialize();
+  integrator.IntegrateWithMultipleStepsToTime(kFinalTime);
+
+  // The solution of each (undamped) spring-mass system is x₀ cos(ωt), with
+  // ω = √(k / m).
+  const double kTolerance = 1e-2 * kInitialPosition;
+  const double omega_fast = std::sqrt(kFastSpring / kMass);
+  const double omega_slow = std::sqrt(kSlowSpring / kMass);
+  EXPECT_NEAR(GetPosition(*fast_, *context_),
+              kInitialPosition * std::cos(omega_fast * kFinalTime),
+              kTolerance);
+  EXPECT_NEAR(GetPosition(*slow_, *context_),
+              kInitialPosition * std::cos(omega_slow * kFinalTime),
+              kTolerance);
+
+  const int64_t num_steps = integrator.get_num_steps_taken();
+  EXPECT_EQ(integrator.get_num_slow_derivative_evaluations(), 2 * num_steps);
+  EXPECT_EQ(integrator.get_num_fast_derivative_evaluations(),
+            2 * kNumSubsteps * num_steps);
+
+  integrator.ResetStatistics();
+  EXPECT_EQ(integrator.get_num_slow_derivative_evaluations(), 0);
+  EXPECT_EQ(integrator.get_num_fast_derivative_evaluations(), 0);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
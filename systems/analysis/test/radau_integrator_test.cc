@@ -64,6 +64,48 @@ GTEST_TEST(RadauIntegratorTest, Reuse) {
   EXPECT_EQ(euler.get_num_jacobian_evaluations(), 1);
 }
 
+// Verifies that integrating with the sparse Jacobian provided by the system
+// (and, hence, a sparse factorization of the 2n x 2n Radau iteration matrix)
+// yields the same result as integrating with a central-difference Jacobian,
+// without spending any derivative evaluations on the Jacobian.
+GTEST_TEST(RadauIntegratorTest, SystemProvidedJacobian) {
+  analysis::test::RobertsonSystem<double> robertson;
+  std::unique_ptr<Context<double>> context_dense =
+      robertson.CreateDefaultContext();
+  std::unique_ptr<Context<double>> context_sparse =
+      robertson.CreateDefaultContext();
+
+  RadauIntegrator<double> radau_dense(robertson, context_dense.get());
+  RadauIntegrator<double> radau_sparse(robertson, context_sparse.get());
+  radau_dense.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::
+          kCentralDifference);
+  radau_sparse.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::kSystemProvided);
+
+  // Take a few small fixed steps, for which both integrators are known to
+  // converge (see the Reuse test above).
+  const double h = 1e-6;
+  for (RadauIntegrator<double>* radau : {&radau_dense, &radau_sparse}) {
+    radau->set_maximum_step_size(h);
+    radau->set_fixed_step_mode(true);
+    radau->Initialize();
+    for (int i = 1; i <= 10; ++i)
+      ASSERT_TRUE(radau->IntegrateWithSingleFixedStepToTime(i * h));
+  }
+
+  const VectorX<double> x_dense =
+      context_dense->get_continuous_state().get_vector().CopyToVector();
+  const VectorX<double> x_sparse =
+      context_sparse->get_continuous_state().get_vector().CopyToVector();
+  for (int i = 0; i < x_dense.size(); ++i)
+    EXPECT_NEAR(x_dense[i], x_sparse[i], 1e-10);
+
+  EXPECT_GT(radau_sparse.get_num_jacobian_evaluations(), 0);
+  EXPECT_EQ(radau_sparse.get_num_derivative_evaluations_for_jacobian(), 0);
+  EXPECT_GT(radau_dense.get_num_derivative_evaluations_for_jacobian(), 0);
+}
+
 // Tests the implicit integrator on a stationary system problem, which
 // stresses numerical differentiation (since the state does not change).
 GTEST_TEST(RadauIntegratorTest, Stationary) {
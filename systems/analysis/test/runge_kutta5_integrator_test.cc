@@ -0,0 +1,126 @@
+#include "drake/systems/analysis/runge_kutta5_integrator.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/test_utilities/cubic_scalar_system.h"
+#include "drake/systems/analysis/test_utilities/explicit_error_controlled_integrator_test.h"
+#include "drake/systems/analysis/test_utilities/my_spring_mass_system.h"
+#include "drake/systems/analysis/test_utilities/quintic_scalar_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis_test {
+
+typedef ::testing::Types<RungeKutta5Integrator<double>> Types;
+INSTANTIATE_TYPED_TEST_CASE_P(My, ExplicitErrorControlledIntegratorTest, Types);
+INSTANTIATE_TYPED_TEST_CASE_P(My, PleidesTest, Types);
+
+// Tests accuracy for integrating the quintic system (with the state at time t
+// corresponding to f(t) ≡ t⁵ + 2t⁴ + 3t³ + 4t² + 5t + C) over t ∈ [0, 1].
+// RK5 is a fifth order integrator, meaning that it uses the Taylor Series
+// expansion:
+// f(t+h) ≈ f(t) + hf'(t) + ½h²f''(t) + ... + 1/120 h⁵f⁽⁵⁾(t) + O(h⁶)
+// The formula above indicates that the approximation error will be zero if
+// f⁽⁶⁾(t) = 0, which is true for the quintic equation.
+GTEST_TEST(RK5IntegratorErrorEstimatorTest, QuinticTest) {
+  QuinticScalarSystem quintic;
+  auto quintic_context = quintic.CreateDefaultContext();
+  const double C = quintic.Evaluate(0);
+  quintic_context->SetTime(0.0);
+  quintic_context->get_mutable_continuous_state_vector()[0] = C;
+
+  RungeKutta5Integrator<double> rk5(quintic, quintic_context.get());
+  const double t_final = 1.0;
+  rk5.set_maximum_step_size(t_final);
+  rk5.set_fixed_step_mode(true);
+  rk5.Initialize();
+  ASSERT_TRUE(rk5.IntegrateWithSingleFixedStepToTime(t_final));
+
+  // Check for near-exact 5th-order results. The measure of accuracy is a
+  // tolerance that scales with expected answer at t_final.
+  const double expected_answer = quintic.Evaluate(t_final);
+  const double allowable_5th_order_error = expected_answer *
+      std::numeric_limits<double>::epsilon();
+  const double actual_answer =
+      quintic_context->get_continuous_state_vector()[0];
+  EXPECT_NEAR(actual_answer, expected_answer, allowable_5th_order_error);
+}
+
+// Tests accuracy for integrating the cubic system (with the state at time t
+// corresponding to f(t) ≡ t³ + t² + 12t + C, where C is the initial state) over
+// t ∈ [0, 1]. The error estimate from RK5 is fourth order accurate, meaning
+// that the approximation error will be zero if f⁽⁵⁾(t) = 0, which is true for
+// the cubic equation. We check that the error estimate is perfect for this
+// function.
+GTEST_TEST(RK5IntegratorErrorEstimatorTest, CubicTest) {
+  CubicScalarSystem cubic;
+  auto cubic_context = cubic.CreateDefaultContext();
+  const double C = cubic.Evaluate(0);
+  cubic_context->SetTime(0.0);
+  cubic_context->get_mutable_continuous_state_vector()[0] = C;
+
+  RungeKutta5Integrator<double> rk5(cubic, cubic_context.get());
+  const double t_final = 1.0;
+  rk5.set_maximum_step_size(t_final);
+  rk5.set_fixed_step_mode(true);
+  rk5.Initialize();
+  ASSERT_TRUE(rk5.IntegrateWithSingleFixedStepToTime(t_final));
+
+  // Per the description in IntegratorBase::get_error_estimate_order(), this
+  // should return "5", in accordance with the order of the polynomial in the
+  // Big-Oh term.
+  ASSERT_EQ(rk5.get_error_estimate_order(), 5);
+
+  const double err_est =
+      rk5.get_error_estimate()->get_vector().GetAtIndex(0);
+
+  // Note the very tight tolerance used, which will likely not hold for
+  // arbitrary values of C, t_final, or polynomial coefficients.
+  EXPECT_NEAR(err_est, 0.0, 10 * std::numeric_limits<double>::epsilon());
+}
+
+// Checks that, for a smooth system and a tight accuracy, RK5 takes fewer
+// derivative evaluations than RK3 for the same requested accuracy.
+GTEST_TEST(RK5IntegratorTest, FewerDerivativeEvaluationsThanRK3) {
+  const double kSpring = 300.0;  // N/m
+  const double kMass = 2.0;      // kg
+  const double kInitialPosition = 0.1;
+  const double kInitialVelocity = 0.01;
+  const double kFinalTime = 1.0;
+  const double kAccuracy = 1e-8;
+  MySpringMassSystem<double> spring_mass(kSpring, kMass, 0.);
+  const double omega = std::sqrt(kSpring / kMass);
+  const double c1 = kInitialPosition;
+  const double c2 = kInitialVelocity / omega;
+  const double expected_position =
+      c1 * std::cos(omega * kFinalTime) + c2 * std::sin(omega * kFinalTime);
+
+  auto integrate = [&](IntegratorBase<double>* integrator,
+                       Context<double>* context) {
+    context->SetTime(0.);
+    spring_mass.set_position(context, kInitialPosition);
+    spring_mass.set_velocity(context, kInitialVelocity);
+    integrator->set_maximum_step_size(0.1);
+    integrator->set_target_accuracy(kAccuracy);
+    integrator->Initialize();
+    integrator->IntegrateWithMultipleStepsToTime(kFinalTime);
+    return integrator->get_num_derivative_evaluations();
+  };
+
+  auto rk5_context = spring_mass.CreateDefaultContext();
+  RungeKutta5Integrator<double> rk5(spring_mass, rk5_context.get());
+  auto rk3_context = spring_mass.CreateDefaultContext();
+  RungeKutta3Integrator<double> rk3(spring_mass, rk3_context.get());
+  EXPECT_LT(integrate(&rk5, rk5_context.get()),
+            integrate(&rk3, rk3_context.get()));
+  // The global error is looser than the requested local accuracy.
+  EXPECT_NEAR(spring_mass.get_position(*rk5_context), expected_position,
+              1000 * kAccuracy);
+}
+
+}  // namespace analysis_test
+}  // namespace systems
+}  // namespace drake
@@ -1,9 +1,13 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <chrono>
 #include <cmath>
 #include <complex>
 #include <functional>
 #include <map>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -12,6 +16,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/explicit_euler_integrator.h"
 #include "drake/systems/analysis/implicit_euler_integrator.h"
@@ -460,6 +465,71 @@ GTEST_TEST(SimulatorTest, FixedStepIncreasingIsolationAccuracy) {
   }
 }
 
+// A point starting at rest at the origin under unit acceleration, whose witness
+// function triggers as its position crosses 1/2 (at time 1).
+class ConstantAccelerationSystem : public LeafSystem<double> {
+ public:
+  ConstantAccelerationSystem() {
+    DeclareContinuousState(1 /* num_q */, 1 /* num_v */, 0 /* num_z */);
+    witness_ = this->MakeWitnessFunction(
+        "position witness", WitnessFunctionDirection::kCrossesZero,
+        &ConstantAccelerationSystem::CalcPositionWitness,
+        &ConstantAccelerationSystem::Publish);
+  }
+
+  double publish_time() const { return publish_time_; }
+  double publish_position() const { return publish_position_; }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    (*derivatives)[0] = context.get_continuous_state()[1];
+    (*derivatives)[1] = 1.0;
+  }
+
+  void DoGetWitnessFunctions(
+      const Context<double>&,
+      std::vector<const WitnessFunction<double>*>* w) const override {
+    w->push_back(witness_.get());
+  }
+
+  double CalcPositionWitness(const Context<double>& context) const {
+    return context.get_continuous_state()[0] - 0.5;
+  }
+
+  void Publish(const Context<double>& context,
+               const PublishEvent<double>&) const {
+    publish_time_ = context.get_time();
+    publish_position_ = context.get_continuous_state()[0];
+  }
+
+  std::unique_ptr<WitnessFunction<double>> witness_;
+  mutable double publish_time_{0};
+  mutable double publish_position_{0};
+};
+
+// Tests that a witness function of the continuous state is isolated, and that
+// the state at the isolated time is the integrated one rather than the
+// interpolated one used while searching for it.
+GTEST_TEST(SimulatorTest, StateWitnessIsolation) {
+  ConstantAccelerationSystem system;
+  const double dt = 0.3;
+  Simulator<double> simulator(system);
+  InitFixedStepIntegratorForWitnessTesting(&simulator, dt);
+  simulator.get_mutable_context().SetAccuracy(1e-6);
+  simulator.AdvanceTo(1.5);
+
+  const optional<double> iso_len = simulator.GetCurrentWitnessTimeIsolation();
+  ASSERT_TRUE(iso_len);
+  EXPECT_GE(system.publish_time(), 1.0);
+  EXPECT_LE(system.publish_time(), 1.0 + *iso_len);
+
+  // RK2 integrates the quadratic trajectory exactly.
+  const double t = system.publish_time();
+  EXPECT_NEAR(system.publish_position(), t * t / 2, 1e-12);
+}
+
 // Tests ability of simulation to identify the witness function triggering
 // over an interval *where both witness functions change sign from the beginning
 // to the end of the interval.
@@ -860,6 +930,36 @@ GTEST_TEST(SimulatorTest, MiscAPI) {
   simulator.Initialize();
 }
 
+// Tests that the profiler is active while the simulator runs, and only then.
+GTEST_TEST(SimulatorTest, SystemProfiler) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  spring_mass.set_name("spring_mass");
+  Simulator<double> simulator(spring_mass);
+  EXPECT_EQ(simulator.get_system_profiler(), nullptr);
+
+  SystemProfiler profiler;
+  simulator.set_system_profiler(&profiler);
+  EXPECT_EQ(simulator.get_system_profiler(), &profiler);
+  simulator.AdvanceTo(1.);
+  EXPECT_EQ(SystemProfiler::active(), nullptr);
+
+  bool found_derivatives = false;
+  for (const SystemProfiler::Entry& entry : profiler.GetEntries()) {
+    if (entry.name == "::spring_mass" &&
+        entry.category == SystemProfilingCategory::kTimeDerivatives) {
+      EXPECT_GT(entry.num_calls, 0);
+      found_derivatives = true;
+    }
+  }
+  EXPECT_TRUE(found_derivatives);
+
+  // Profiling stops when the profiler is unset.
+  profiler.Reset();
+  simulator.set_system_profiler(nullptr);
+  simulator.AdvanceTo(2.);
+  EXPECT_TRUE(profiler.GetEntries().empty());
+}
+
 GTEST_TEST(SimulatorTest, ContextAccess) {
   analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
   Simulator<double> simulator(spring_mass);  // Use default Context.
@@ -1001,6 +1101,42 @@ GTEST_TEST(SimulatorTest, RealtimeRate) {
   EXPECT_TRUE(simulator.get_actual_realtime_rate() <= 5.1);
 }
 
+// Tests that steps ending later in real time than the target realtime rate
+// calls for are counted and reported as overruns.
+GTEST_TEST(SimulatorTest, RealtimeOverruns) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);
+  int num_callbacks = 0;
+  double last_overrun = 0;
+  simulator.set_realtime_overrun_callback([&](double overrun) {
+    ++num_callbacks;
+    last_overrun = overrun;
+  });
+
+  // Without a target rate, nothing is an overrun.
+  simulator.Initialize();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  simulator.AdvanceTo(0.001);
+  EXPECT_EQ(simulator.get_num_realtime_overruns(), 0);
+  EXPECT_EQ(num_callbacks, 0);
+
+  // Falling behind real time before the first step makes it overrun.
+  simulator.set_target_realtime_rate(1.);
+  simulator.get_mutable_integrator().set_maximum_step_size(0.001);
+  simulator.get_mutable_context().SetTime(0.);
+  simulator.Initialize();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  simulator.AdvanceTo(0.001);
+  EXPECT_GE(simulator.get_num_realtime_overruns(), 1);
+  EXPECT_GE(simulator.get_max_realtime_overrun(), 0.04);
+  EXPECT_EQ(num_callbacks, simulator.get_num_realtime_overruns());
+  EXPECT_GT(last_overrun, 0.);
+
+  simulator.ResetStatistics();
+  EXPECT_EQ(simulator.get_num_realtime_overruns(), 0);
+  EXPECT_EQ(simulator.get_max_realtime_overrun(), 0.);
+}
+
 // Tests that if publishing every timestep is disabled and publish on
 // initialization is enabled, publish only happens on initialization.
 GTEST_TEST(SimulatorTest, DisablePublishEveryTimestep) {
@@ -2282,6 +2418,216 @@ GTEST_TEST(SimulatorTest, EvalDerivativesCounter) {
   EXPECT_EQ(simulator.get_integrator().get_num_derivative_evaluations(), 24);
 }
 
+// A system with one continuous state, one discrete state updated periodically
+// and a periodic publish event, used to check that the steady-state steps of
+// the simulator don't allocate.
+class ContinuousAndPeriodicSystem : public LeafSystem<double> {
+ public:
+  ContinuousAndPeriodicSystem() {
+    DeclareContinuousState(1);
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(
+        0.01, 0.0, &ContinuousAndPeriodicSystem::Update);
+    DeclarePeriodicPublishEvent(
+        0.02, 0.0, &ContinuousAndPeriodicSystem::Publish);
+  }
+
+  int num_publishes() const { return num_publishes_; }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    (*derivatives)[0] = -context.get_continuous_state()[0];
+  }
+
+  void Update(const Context<double>& context,
+              DiscreteValues<double>* discrete_state) const {
+    (*discrete_state)[0] = context.get_continuous_state()[0];
+  }
+
+  void Publish(const Context<double>&) const { ++num_publishes_; }
+
+  mutable int num_publishes_{0};
+};
+
+// Once the simulator has been initialized and has taken a few steps, taking
+// more steps with a fixed step integrator doesn't allocate any heap memory.
+GTEST_TEST(SimulatorTest, SteadyStateStepsDoNotAllocate) {
+  ContinuousAndPeriodicSystem system;
+  Simulator<double> simulator(system);
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(
+      system, 0.005, &simulator.get_mutable_context());
+  simulator.get_mutable_context().get_mutable_continuous_state()[0] = 1.0;
+  simulator.Initialize();
+  simulator.AdvanceTo(0.1);
+  const int num_publishes = system.num_publishes();
+  {
+    test::LimitMalloc guard;
+    simulator.AdvanceTo(0.2);
+  }
+  // The periodic events were handled while the guard was active.
+  EXPECT_GE(system.num_publishes(), num_publishes + 4);
+  EXPECT_NE(simulator.get_context().get_discrete_state(0)[0], 0.0);
+}
+
+// A fork continues exactly as the original would, from the same pending
+// events and step size history, without repeating initialization.
+GTEST_TEST(SimulatorTest, Fork) {
+  ContinuousAndPeriodicSystem system;
+  Simulator<double> simulator(system);
+  simulator.get_mutable_context().get_mutable_continuous_state()[0] = 1.0;
+  simulator.Initialize();
+  simulator.AdvanceTo(0.105);
+
+  const std::unique_ptr<Simulator<double>> fork = simulator.Fork();
+  EXPECT_NE(&fork->get_context(), &simulator.get_context());
+  EXPECT_EQ(fork->get_context().get_time(), 0.105);
+  EXPECT_TRUE(is_dynamic_castable<RungeKutta3Integrator<double>>(
+      &fork->get_integrator()));
+  EXPECT_EQ(fork->get_integrator().get_target_accuracy(),
+            simulator.get_integrator().get_target_accuracy());
+  EXPECT_EQ(fork->get_integrator().get_ideal_next_step_size(),
+            simulator.get_integrator().get_ideal_next_step_size());
+  EXPECT_EQ(fork->get_num_steps_taken(), 0);
+
+  simulator.ResetStatistics();
+  simulator.AdvanceTo(0.3);
+  fork->AdvanceTo(0.3);
+  EXPECT_EQ(fork->get_context().get_continuous_state()[0],
+            simulator.get_context().get_continuous_state()[0]);
+  EXPECT_EQ(fork->get_context().get_discrete_state(0)[0],
+            simulator.get_context().get_discrete_state(0)[0]);
+  EXPECT_EQ(fork->get_num_steps_taken(), simulator.get_num_steps_taken());
+  EXPECT_EQ(fork->get_num_discrete_updates(),
+            simulator.get_num_discrete_updates());
+
+  // Changing the fork leaves the original alone.
+  fork->get_mutable_context().get_mutable_continuous_state()[0] = 5.0;
+  EXPECT_NE(simulator.get_context().get_continuous_state()[0], 5.0);
+
+  // Integrators that cannot be cloned cannot be forked.
+  simulator.reset_integrator<ImplicitEulerIntegrator<double>>(
+      system, &simulator.get_mutable_context());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator.Fork(), std::logic_error,
+      ".*ImplicitEulerIntegrator<double> does not support Clone\\(\\)");
+}
+
+class FailingPublisher : public LeafSystem<double> {
+ public:
+  FailingPublisher() {
+    DeclarePeriodicPublishEvent(0.01, 0.0, &FailingPublisher::Publish);
+  }
+
+ private:
+  void Publish(const Context<double>&) const {
+    throw std::runtime_error("publish failed");
+  }
+};
+
+// Publishing asynchronously records the same samples as publishing
+// synchronously, and rethrows the failures of the publish event handlers on
+// the simulation thread.
+GTEST_TEST(SimulatorTest, PublishAsynchronously) {
+  auto calc_log = [](bool publish_asynchronously) {
+    DiagramBuilder<double> builder;
+    auto example = builder.AddSystem<ExampleDiscreteSystem>();
+    auto logger = LogOutput(example->GetOutputPort("Sn"), &builder);
+    logger->set_publish_period(ExampleDiscreteSystem::kPeriod);
+    auto diagram = builder.Build();
+    Simulator<double> simulator(*diagram);
+    simulator.set_publish_asynchronously(publish_asynchronously,
+                                         1 /* max_queue_size */);
+    EXPECT_EQ(simulator.get_publish_asynchronously(), publish_asynchronously);
+    simulator.set_publish_every_time_step(true);
+    simulator.AdvanceTo(10 * ExampleDiscreteSystem::kPeriod);
+    simulator.FinishPendingPublishes();
+    return Eigen::MatrixXd(logger->data());
+  };
+  const Eigen::MatrixXd log = calc_log(false);
+  EXPECT_GT(log.cols(), 10);
+  EXPECT_EQ(calc_log(true), log);
+
+  FailingPublisher publisher;
+  Simulator<double> simulator(publisher);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator.set_publish_asynchronously(true, 0), std::logic_error,
+      ".*queue size must be positive.*");
+  simulator.set_publish_asynchronously(true);
+  // The failure is reported by a later publish or when finishing them.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      {
+        simulator.AdvanceTo(0.1);
+        simulator.FinishPendingPublishes();
+      },
+      std::runtime_error, "publish failed");
+  // Once reported, the failure is forgotten.
+  EXPECT_NO_THROW(simulator.FinishPendingPublishes());
+}
+
+// A system with dynamics xdot = -x that records its state with a periodic
+// publish event.
+class DecayRecorder : public LeafSystem<double> {
+ public:
+  static constexpr double kPublishPeriod = 1e-3;
+
+  DecayRecorder() {
+    DeclareContinuousState(1);
+    DeclarePeriodicPublishEvent(kPublishPeriod, 0.0, &DecayRecorder::Record);
+  }
+
+  const std::vector<std::pair<double, double>>& samples() const {
+    return samples_;
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    (*derivatives)[0] = -context.get_continuous_state()[0];
+  }
+
+  void Record(const Context<double>& context) const {
+    samples_.emplace_back(context.get_time(),
+                          context.get_continuous_state()[0]);
+  }
+
+  mutable std::vector<std::pair<double, double>> samples_;
+};
+
+// Interpolated timed publishes see the same times and nearly the same states
+// as exact ones, while the steps are no longer limited by the publish period.
+GTEST_TEST(SimulatorTest, InterpolateTimedPublishes) {
+  const double kFinalTime = 0.5;
+  auto simulate = [&](bool interpolate, int* num_steps) {
+    DecayRecorder system;
+    Simulator<double> simulator(system);
+    simulator.reset_integrator<RungeKutta3Integrator<double>>(
+        system, &simulator.get_mutable_context());
+    simulator.get_mutable_integrator().set_maximum_step_size(0.05);
+    simulator.get_mutable_integrator().set_target_accuracy(1e-8);
+    simulator.set_interpolate_timed_publishes(interpolate);
+    EXPECT_EQ(simulator.get_interpolate_timed_publishes(), interpolate);
+    simulator.get_mutable_context().get_mutable_continuous_state()[0] = 1.0;
+    simulator.AdvanceTo(kFinalTime);
+    *num_steps = simulator.get_num_steps_taken();
+    return system.samples();
+  };
+
+  int num_exact_steps{};
+  int num_interpolated_steps{};
+  const auto exact = simulate(false, &num_exact_steps);
+  const auto interpolated = simulate(true, &num_interpolated_steps);
+  EXPECT_GE(num_exact_steps, kFinalTime / DecayRecorder::kPublishPeriod);
+  EXPECT_LT(10 * num_interpolated_steps, num_exact_steps);
+  ASSERT_EQ(interpolated.size(), exact.size());
+  for (size_t i = 0; i < exact.size(); ++i) {
+    EXPECT_EQ(interpolated[i].first, exact[i].first);
+    EXPECT_NEAR(interpolated[i].second, std::exp(-exact[i].first), 1e-6);
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include "drake/systems/framework/leaf_system.h"
 
@@ -43,6 +44,28 @@ class RobertsonSystem : public LeafSystem<T> {
     deriv->get_mutable_vector().SetAtIndex(2, y3_prime);
   }
 
+  /// The Robertson system provides its (analytic) time derivatives Jacobian.
+  bool DoHasTimeDerivativesJacobian() const override { return true; }
+
+  void DoCalcTimeDerivativesJacobian(
+      const Context<T>& context, Eigen::SparseMatrix<T>* J) const override {
+    // Get state.
+    const T& y2 = context.get_continuous_state_vector().GetAtIndex(1);
+    const T& y3 = context.get_continuous_state_vector().GetAtIndex(2);
+
+    // Set the partial derivatives of the time derivatives with respect to the
+    // state; ∂y₃'/∂y₁ and ∂y₃'/∂y₃ are structurally zero.
+    std::vector<Eigen::Triplet<T>> triplets;
+    triplets.emplace_back(0, 0, -0.04);
+    triplets.emplace_back(0, 1, 1e4 * y3);
+    triplets.emplace_back(0, 2, 1e4 * y2);
+    triplets.emplace_back(1, 0, 0.04);
+    triplets.emplace_back(1, 1, -1e4 * y3 - 6e7 * y2);
+    triplets.emplace_back(1, 2, -1e4 * y2);
+    triplets.emplace_back(2, 1, 6e7 * y2);
+    J->setFromTriplets(triplets.begin(), triplets.end());
+  }
+
   /// Sets the initial conditions for the Robertson system.
   void SetDefaultState(
       const Context<T>& context, State<T>* state) const override {
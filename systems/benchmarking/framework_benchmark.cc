@@ -0,0 +1,229 @@
+/// @file
+///
+/// Times the overhead of the Systems framework itself, on synthetic diagrams
+/// of trivial systems (so that the computations of the systems are
+/// negligible) of increasing sizes. Each diagram has an Integrator at its
+/// root, whose output goes through
+///  - "chain": a chain of Gain systems,
+///  - "fanout": Gain systems in parallel, each with an exported output, or
+///  - "nested": Gain systems in series, each (but the innermost) in a diagram
+///    of its own within the diagram of the previous one.
+///
+/// For each diagram, the following are timed:
+///  - Eval: the evaluation of the exported outputs after a change of the
+///    state of the integrator (the invalidation and the recomputation of the
+///    whole diagram),
+///  - Invalidate: the change of the state alone, after the outputs have been
+///    evaluated (the propagation of DependencyTracker::NoteValueChange()),
+///  - CreateDefaultContext and Context::Clone(),
+///  - System::ToAutoDiffXd().
+///
+/// Then the Simulator is timed with diagrams of as many systems which only
+/// have periodic discrete updates, of a few different periods, for which it
+/// mostly dispatches events.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+
+DEFINE_string(sizes, "1,10,100,1000",
+              "Comma-separated numbers of systems of the diagrams.");
+DEFINE_int32(num_evaluations, 1000,
+             "Number of timed evaluations per diagram and operation.");
+DEFINE_double(simulated_time, 1.0,
+              "The time simulated by the event dispatch benchmark.");
+
+namespace drake {
+namespace systems {
+namespace benchmarking {
+namespace {
+
+// The size of the vectors of the systems.
+constexpr int kSize = 3;
+
+std::vector<int> ParseSizes(const std::string& list) {
+  std::vector<int> sizes;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) sizes.push_back(std::stoi(item));
+  return sizes;
+}
+
+std::unique_ptr<Diagram<double>> MakeChain(int size) {
+  DiagramBuilder<double> builder;
+  const auto* integrator = builder.AddSystem<Integrator<double>>(kSize);
+  builder.ExportInput(integrator->get_input_port());
+  const OutputPort<double>* output = &integrator->get_output_port();
+  for (int i = 0; i < size; ++i) {
+    const auto* gain = builder.AddSystem<Gain<double>>(1.0, kSize);
+    builder.Connect(*output, gain->get_input_port());
+    output = &gain->get_output_port();
+  }
+  builder.ExportOutput(*output);
+  return builder.Build();
+}
+
+std::unique_ptr<Diagram<double>> MakeFanOut(int size) {
+  DiagramBuilder<double> builder;
+  const auto* integrator = builder.AddSystem<Integrator<double>>(kSize);
+  builder.ExportInput(integrator->get_input_port());
+  for (int i = 0; i < size; ++i) {
+    const auto* gain = builder.AddSystem<Gain<double>>(1.0, kSize);
+    builder.Connect(integrator->get_output_port(), gain->get_input_port());
+    builder.ExportOutput(gain->get_output_port());
+  }
+  return builder.Build();
+}
+
+// Makes a diagram of a Gain in series with a diagram of `depth - 1` levels
+// (or of a single Gain, at the last level).
+std::unique_ptr<Diagram<double>> MakeNestedLevel(int depth) {
+  DiagramBuilder<double> builder;
+  const auto* gain = builder.AddSystem<Gain<double>>(1.0, kSize);
+  builder.ExportInput(gain->get_input_port());
+  if (depth > 1) {
+    const auto* inner = builder.AddSystem(MakeNestedLevel(depth - 1));
+    builder.Connect(gain->get_output_port(), inner->get_input_port(0));
+    builder.ExportOutput(inner->get_output_port(0));
+  } else {
+    builder.ExportOutput(gain->get_output_port());
+  }
+  return builder.Build();
+}
+
+std::unique_ptr<Diagram<double>> MakeNested(int size) {
+  DiagramBuilder<double> builder;
+  const auto* integrator = builder.AddSystem<Integrator<double>>(kSize);
+  builder.ExportInput(integrator->get_input_port());
+  const auto* nested = builder.AddSystem(MakeNestedLevel(size));
+  builder.Connect(integrator->get_output_port(), nested->get_input_port(0));
+  builder.ExportOutput(nested->get_output_port(0));
+  return builder.Build();
+}
+
+// A system whose only computation is a periodic discrete update.
+class Ticker final : public LeafSystem<double> {
+ public:
+  explicit Ticker(double period) {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(period, 0.0, &Ticker::Tick);
+  }
+
+ private:
+  void Tick(const Context<double>& context,
+            DiscreteValues<double>* updates) const {
+    (*updates)[0] = context.get_discrete_state(0)[0] + 1;
+  }
+};
+
+// Returns the average time of `num_evaluations` evaluations of `operation` in
+// microseconds. `prepare` is called (untimed) before each evaluation.
+template <typename Prepare, typename Operation>
+double Time(int num_evaluations, Prepare prepare, Operation operation) {
+  std::chrono::duration<double, std::micro> elapsed{};
+  for (int i = 0; i < num_evaluations; ++i) {
+    prepare();
+    const auto start = std::chrono::steady_clock::now();
+    operation();
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  return elapsed.count() / num_evaluations;
+}
+
+void Print(const std::string& diagram, int size, const std::string& operation,
+           double time_us) {
+  std::cout << fmt::format("{:>8} {:>6} {:>20} {:>14.3f}\n", diagram, size,
+                           operation, time_us);
+}
+
+void TimeDiagram(const std::string& name, int size,
+                 const Diagram<double>& diagram) {
+  auto context = diagram.CreateDefaultContext();
+  context->FixInputPort(0, Eigen::VectorXd::Zero(kSize));
+  auto eval_outputs = [&]() {
+    for (int i = 0; i < diagram.num_output_ports(); ++i) {
+      diagram.get_output_port(i).Eval(*context);
+    }
+  };
+  auto change_state = [&]() {
+    context->get_mutable_continuous_state_vector()[0] += 1;
+  };
+  auto nothing = []() {};
+
+  const int n = FLAGS_num_evaluations;
+  Print(name, size, "Eval", Time(n, change_state, eval_outputs));
+  Print(name, size, "Invalidate", Time(n, eval_outputs, change_state));
+  Print(name, size, "CreateDefaultContext", Time(n, nothing, [&]() {
+          diagram.CreateDefaultContext();
+        }));
+  Print(name, size, "Context::Clone", Time(n, nothing, [&]() {
+          context->Clone();
+        }));
+  // The conversion is much slower than the other operations.
+  Print(name, size, "ToAutoDiffXd", Time(std::max(1, n / 100), nothing, [&]() {
+          diagram.ToAutoDiffXd();
+        }));
+}
+
+// Prints the time of the simulation of `size` Ticker systems, per discrete
+// update event.
+void TimeEventDispatch(int size) {
+  DiagramBuilder<double> builder;
+  const double periods[] = {0.001, 0.002, 0.005, 0.01};
+  for (int i = 0; i < size; ++i) {
+    builder.AddSystem<Ticker>(periods[i % 4]);
+  }
+  const auto diagram = builder.Build();
+  Simulator<double> simulator(*diagram);
+  simulator.Initialize();
+  const auto start = std::chrono::steady_clock::now();
+  simulator.AdvanceTo(FLAGS_simulated_time);
+  const std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+  int64_t num_events = 0;
+  for (int i = 0; i < size; ++i) {
+    num_events +=
+        static_cast<int64_t>(FLAGS_simulated_time / periods[i % 4]);
+  }
+  Print("events", size, "AdvanceTo per event",
+        elapsed.count() / std::max<int64_t>(1, num_events));
+}
+
+int do_main() {
+  std::cout << fmt::format("{:>8} {:>6} {:>20} {:>14}\n", "diagram", "size",
+                           "operation", "time [us]");
+  for (int size : ParseSizes(FLAGS_sizes)) {
+    TimeDiagram("chain", size, *MakeChain(size));
+    TimeDiagram("fanout", size, *MakeFanOut(size));
+    TimeDiagram("nested", size, *MakeNested(size));
+    TimeEventDispatch(size);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace systems
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the overhead of the Systems framework on synthetic diagrams.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::systems::benchmarking::do_main();
+}
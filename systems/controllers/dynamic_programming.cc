@@ -1,9 +1,14 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/wrap_to.h"
 #include "drake/solvers/mathematical_program.h"
@@ -63,94 +68,168 @@ FittedValueIteration(
     DRAKE_DEMAND(b.high <= *(state_grid[b.state_index].rbegin()));
   }
 
-  // The transition probabilities are represented as a sparse matrix,
-  // where Tind[input](:,state) is a list of non-zero indexes into the
-  // state_mesh, and T[input](:,state) is the associated list of coefficients.
+  DRAKE_DEMAND(options.num_threads >= 1);
+  DRAKE_DEMAND(options.num_threads == 1 ||
+               options.simulator_factory != nullptr);
+
+  // The transition probabilities are represented as sparse matrices, where
+  // T[input](state, next) is the barycentric weight of mesh point `next` in
+  // the state reached by taking action input from mesh point `state`.
   // cost[input](j) is the cost of taking action input from state mesh index j.
+  // Tind[input](:,state) and Tw[input](:,state) are the non-zero indexes and
+  // coefficients of T[input] row state, as computed (in parallel) from the
+  // simulations.
+  std::vector<Eigen::SparseMatrix<double, Eigen::RowMajor>> T(num_inputs);
+  std::vector<Eigen::VectorXd> cost(num_inputs);
   std::vector<Eigen::MatrixXi> Tind(num_inputs);
-  std::vector<Eigen::MatrixXd> T(num_inputs);
-  std::vector<Eigen::RowVectorXd> cost(num_inputs);
-
-  drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
+  std::vector<Eigen::MatrixXd> Tw(num_inputs);
   for (int input = 0; input < num_inputs; input++) {
     Tind[input].resize(num_state_indices, num_states);
-    T[input].resize(num_state_indices, num_states);
+    Tw[input].resize(num_state_indices, num_states);
     cost[input].resize(num_states);
+  }
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    context.FixInputPort(0, input_vec);
+  drake::log()->info("Computing transition and cost matrices.");
 
-    for (int state = 0; state < num_states; state++) {
-      context.SetTime(0.0);
-      sim_state.SetFromVector(state_mesh.get_mesh_point(state));
+  // The per-thread simulation workspace. Thread 0 (the calling thread) uses
+  // the given simulator.
+  struct Workspace {
+    std::unique_ptr<Simulator<double>> owned_simulator;
+    Simulator<double>* simulator{nullptr};
+    int input{-1};
+    Eigen::VectorXd input_vec;
+    Eigen::VectorXd state_vec;
+    Eigen::VectorXi Tind_tmp;
+    Eigen::VectorXd T_tmp;
+  };
+  std::vector<Workspace> workspaces(options.num_threads);
+
+  StaticParallelForIndexLoop(
+      options.num_threads, 0, num_inputs * num_states,
+      [&](int thread_num, int index) {
+        Workspace& workspace = workspaces[thread_num];
+        if (workspace.simulator == nullptr) {
+          if (thread_num == 0) {
+            workspace.simulator = simulator;
+          } else {
+            workspace.owned_simulator = options.simulator_factory();
+            DRAKE_DEMAND(workspace.owned_simulator != nullptr);
+            workspace.simulator = workspace.owned_simulator.get();
+          }
+          workspace.input_vec.resize(input_mesh.get_input_size());
+          workspace.state_vec.resize(state_mesh.get_input_size());
+          workspace.Tind_tmp.resize(num_state_indices);
+          workspace.T_tmp.resize(num_state_indices);
+        }
+        Context<double>& sim_context =
+            workspace.simulator->get_mutable_context();
+        auto& sim_state = sim_context.get_mutable_continuous_state_vector();
+
+        const int input = index / num_states;
+        const int state = index % num_states;
+        if (input != workspace.input) {
+          input_mesh.get_mesh_point(input, &workspace.input_vec);
+          sim_context.FixInputPort(0, workspace.input_vec);
+          workspace.input = input;
+        }
 
-      cost[input](state) = timestep * cost_function(context);
+        sim_context.SetTime(0.0);
+        sim_state.SetFromVector(state_mesh.get_mesh_point(state));
 
-      simulator->AdvanceTo(timestep);
-      state_vec = sim_state.CopyToVector();
+        cost[input](state) = timestep * cost_function(sim_context);
 
-      for (const auto& b : options.periodic_boundary_conditions) {
-        state_vec[b.state_index] =
-            math::wrap_to(state_vec[b.state_index], b.low, b.high);
-      }
+        workspace.simulator->AdvanceTo(timestep);
+        workspace.state_vec = sim_state.CopyToVector();
 
-      state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
-      Tind[input].col(state) = Tind_tmp;
-      T[input].col(state) = T_tmp;
-    }
-  }
+        for (const auto& b : options.periodic_boundary_conditions) {
+          workspace.state_vec[b.state_index] = math::wrap_to(
+              workspace.state_vec[b.state_index], b.low, b.high);
+        }
+
+        state_mesh.EvalBarycentricWeights(
+            workspace.state_vec, &workspace.Tind_tmp, &workspace.T_tmp);
+        Tind[input].col(state) = workspace.Tind_tmp;
+        Tw[input].col(state) = workspace.T_tmp;
+      });
+  workspaces.clear();
+
+  StaticParallelForIndexLoop(
+      options.num_threads, 0, num_inputs, [&](int, int input) {
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(num_states * num_state_indices);
+        for (int state = 0; state < num_states; state++) {
+          for (int index = 0; index < num_state_indices; index++) {
+            triplets.emplace_back(state, Tind[input](index, state),
+                                  Tw[input](index, state));
+          }
+        }
+        T[input].resize(num_states, num_states);
+        T[input].setFromTriplets(triplets.begin(), triplets.end());
+        Tind[input].resize(0, 0);
+        Tw[input].resize(0, 0);
+      });
   drake::log()->info("Done computing transition and cost matrices.");
 
-  // Perform value iteration loop.
-  Eigen::RowVectorXd J = Eigen::RowVectorXd::Zero(num_states);
-  Eigen::RowVectorXd Jnext(num_states);
+  // Perform value iteration loop. Each update is split into contiguous blocks
+  // of states, one per thread.
+  Eigen::VectorXd J = Eigen::VectorXd::Zero(num_states);
+  Eigen::VectorXd Jnext(num_states);
+  Eigen::VectorXi best_input(num_states);
   Eigen::MatrixXd Pi(input_mesh.get_input_size(), num_states);
+  const int num_blocks = std::min(options.num_threads, num_states);
+  const auto calc_policy = [&]() {
+    for (int state = 0; state < num_states; state++) {
+      Pi.col(state) = input_mesh.get_mesh_point(best_input(state));
+    }
+  };
 
   drake::log()->info("Running value iteration.");
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
-        }
-      }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
+    StaticParallelForIndexLoop(
+        num_blocks, 0, num_blocks, [&](int, int block) {
+          const int begin =
+              static_cast<int>(static_cast<int64_t>(num_states) * block /
+                               num_blocks);
+          const int size =
+              static_cast<int>(static_cast<int64_t>(num_states) *
+                               (block + 1) / num_blocks) - begin;
+          auto Jnext_block = Jnext.segment(begin, size);
+          auto best_input_block = best_input.segment(begin, size);
+          Jnext_block.setConstant(std::numeric_limits<double>::infinity());
+          best_input_block.setZero();
+          Eigen::VectorXd Q(size);
+          for (int input = 0; input < num_inputs; input++) {
+            // Q(x,u) = g(x,u) + γ J(f(x,u)).
+            Q = cost[input].segment(begin, size);
+            Q.noalias() += options.discount_factor *
+                           (T[input].middleRows(begin, size) * J);
+            // Cost-to-go: J = minᵤ Q(x,u).
+            // Policy:  π(x) = argminᵤ Q(x,u).
+            for (int i = 0; i < size; i++) {
+              if (Q(i) < Jnext_block(i)) {
+                Jnext_block(i) = Q(i);
+                best_input_block(i) = input;
+              }
+            }
+          }
+        });
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
     J = Jnext;
     iteration++;
     if (options.visualization_callback) {
-      options.visualization_callback(iteration, state_mesh, J, Pi);
+      calc_policy();
+      options.visualization_callback(iteration, state_mesh, J.transpose(), Pi);
     }
   }
   drake::log()->info("Value iteration converged to requested tolerance.");
 
   // Create the policy.
+  calc_policy();
   auto policy = std::make_unique<BarycentricMeshSystem<double>>(state_mesh, Pi);
 
-  return std::make_pair(std::move(policy), J);
+  return std::make_pair(std::move(policy), Eigen::RowVectorXd(J.transpose()));
 }
 
 Eigen::VectorXd LinearProgrammingApproximateDynamicProgramming(
@@ -50,6 +50,23 @@ struct DynamicProgrammingOptions {
       int iteration, const math::BarycentricMesh<double>& state_mesh,
       const Eigen::RowVectorXd& cost_to_go, const Eigen::MatrixXd& policy)>
       visualization_callback{nullptr};
+
+  /// The maximum number of threads used by FittedValueIteration, both to
+  /// simulate the one-step dynamics from every pair of state and input mesh
+  /// points and to perform the value iteration updates. When greater than
+  /// one, the cost function must be safe to call concurrently (on distinct
+  /// Contexts).
+  /// @see simulator_factory
+  int num_threads{1};
+
+  /// Since each thread needs its own Simulator (and Context), the threads
+  /// other than the calling one simulate with Simulators made by this
+  /// factory, which must be callable when `num_threads` is greater than one.
+  /// Each call must return a new Simulator configured like the one passed to
+  /// FittedValueIteration, i.e. for the same System, with a Context holding
+  /// the same parameters, and with the same integrator settings.
+  std::function<std::unique_ptr<Simulator<double>>()> simulator_factory{
+      nullptr};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
@@ -25,8 +25,26 @@ InverseDynamics<T>::InverseDynamics(const MultibodyPlant<T>* plant,
                                     &InverseDynamics<T>::CalcOutputForce)
           .get_index();
 
-  // Make context with default parameters.
-  multibody_plant_context_ = plant->CreateDefaultContext();
+  // The plant context, with default parameters, is cached and only depends
+  // on the estimated state.
+  plant_context_cache_index_ =
+      this->DeclareCacheEntry(
+              "plant_context", *plant->CreateDefaultContext(),
+              &InverseDynamics<T>::SetMultibodyContext,
+              {this->input_port_ticket(get_input_port_estimated_state()
+                                           .get_index())})
+          .cache_index();
+
+  // So is the contribution of the force elements, which the gravity
+  // compensation mode does not use.
+  if (!this->is_pure_gravity_compensation()) {
+    external_forces_cache_index_ =
+        this->DeclareCacheEntry(
+                "external_forces", multibody::MultibodyForces<T>(*plant),
+                &InverseDynamics<T>::CalcMultibodyForces,
+                {this->cache_entry_ticket(plant_context_cache_index_)})
+            .cache_index();
+  }
 
   // Doesn't declare desired acceleration input port if we are only doing
   // gravity compensation.
@@ -40,37 +58,49 @@ template <typename T>
 InverseDynamics<T>::~InverseDynamics() = default;
 
 template <typename T>
-void InverseDynamics<T>::CalcOutputForce(const Context<T>& context,
-                                          BasicVector<T>* output) const {
-  // State input.
-  VectorX<T> x = get_input_port_estimated_state().Eval(context);
-
-  // Desired acceleration input.
-  VectorX<T> desired_vd = VectorX<T>::Zero(v_dim_);
+void InverseDynamics<T>::SetMultibodyContext(const Context<T>& context,
+                                             Context<T>* plant_context) const {
+  const VectorX<T>& x = get_input_port_estimated_state().Eval(context);
 
-  if (!this->is_pure_gravity_compensation()) {
-    // Only eval acceleration input port when we are not in pure gravity
-    // compensation mode.
-    desired_vd = get_input_port_desired_acceleration().Eval(context);
+  if (this->is_pure_gravity_compensation()) {
+    // Velocities are zero in pure gravity compensation.
+    multibody_plant_->SetPositions(plant_context, x.head(q_dim_));
+    multibody_plant_->SetVelocities(plant_context,
+                                    VectorX<T>::Zero(v_dim_));
   } else {
-    // Sets velocity to zero in pure gravity compensation.
-    x.tail(v_dim_).setZero();
+    multibody_plant_->SetPositionsAndVelocities(plant_context, x);
   }
+}
+
+template <typename T>
+void InverseDynamics<T>::CalcMultibodyForces(
+    const Context<T>& context, multibody::MultibodyForces<T>* forces) const {
+  const auto& plant_context =
+      this->get_cache_entry(plant_context_cache_index_)
+          .template Eval<Context<T>>(context);
+  multibody_plant_->CalcForceElementsContribution(plant_context, forces);
+}
 
-  auto& plant = *multibody_plant_;
-  // Set the position and velocity in the context.
-  plant.SetPositionsAndVelocities(multibody_plant_context_.get(), x);
+template <typename T>
+void InverseDynamics<T>::CalcOutputForce(const Context<T>& context,
+                                          BasicVector<T>* output) const {
+  const auto& plant = *multibody_plant_;
+  const auto& plant_context =
+      this->get_cache_entry(plant_context_cache_index_)
+          .template Eval<Context<T>>(context);
 
   if (this->is_pure_gravity_compensation()) {
     output->get_mutable_value() =
-        -plant.CalcGravityGeneralizedForces(*multibody_plant_context_);
+        -plant.CalcGravityGeneralizedForces(plant_context);
   } else {
     // Compute inverse dynamics.
-    multibody::MultibodyForces<T> external_forces(plant);
-    plant.CalcForceElementsContribution(
-        *multibody_plant_context_, &external_forces);
-    output->get_mutable_value() = plant.CalcInverseDynamics(
-        *multibody_plant_context_, desired_vd, external_forces);
+    const auto& external_forces =
+        this->get_cache_entry(external_forces_cache_index_)
+            .template Eval<multibody::MultibodyForces<T>>(context);
+    const VectorX<T>& desired_vd =
+        get_input_port_desired_acceleration().Eval(context);
+    output->get_mutable_value() =
+        plant.CalcInverseDynamics(plant_context, desired_vd, external_forces);
   }
 }
 
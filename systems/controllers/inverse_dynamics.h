@@ -24,6 +24,13 @@ namespace controllers {
  * acceleration and uses this class to compute generalized forces. This class
  * should be used directly if desired acceleration is computed differently.
  *
+ * The context of the plant model is held in the cache of this system's
+ * Context and only depends on the estimated state, so that the kinematics and
+ * the force elements of the model are computed once per estimated state
+ * rather than on every evaluation of the output, e.g., as the desired
+ * acceleration changes. It also makes evaluations on different Contexts safe
+ * to perform concurrently.
+ *
  * @tparam T The vector element type, which must be a valid Eigen scalar.
  * @see Constructors for descriptions of how (and which) forces are incorporated
  *      into the inverse dynamics computation.
@@ -109,14 +116,24 @@ class InverseDynamics : public LeafSystem<T> {
   void CalcOutputForce(const Context<T>& context,
                        BasicVector<T>* force) const;
 
+  // Calculator for the plant context cache entry: sets the generalized
+  // positions and velocities of multibody_plant_ from the estimated state.
+  void SetMultibodyContext(const Context<T>& context,
+                           Context<T>* plant_context) const;
+
+  // Calculator for the force elements contribution cache entry.
+  void CalcMultibodyForces(const Context<T>& context,
+                           multibody::MultibodyForces<T>* forces) const;
+
   const multibody::MultibodyPlant<T>* multibody_plant_{nullptr};
 
   // Mode dictates whether to do inverse dynamics or just gravity compensation.
   const InverseDynamicsMode mode_;
 
-  // This context is used solely for setting generalized positions and
-  // velocities in multibody_plant_.
-  std::unique_ptr<Context<T>> multibody_plant_context_;
+  // The context of multibody_plant_, and the contribution of its force
+  // elements, cached as functions of the estimated state.
+  CacheIndex plant_context_cache_index_;
+  CacheIndex external_forces_cache_index_;
 
   int input_port_index_state_{0};
   int input_port_index_desired_acceleration_{0};
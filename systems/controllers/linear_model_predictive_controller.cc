@@ -4,15 +4,66 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using solvers::VectorXDecisionVariable;
-using trajectory_optimization::DirectTranscription;
+namespace {
+
+// Condenses the QP
+//
+//   min ∑ᵢ xᵢᵀQxᵢ + uᵢᵀRuᵢ, i = 0, ..., num_steps - 1
+//   s.t. xᵢ₊₁ = Axᵢ + Buᵢ
+//
+// into a QP on the inputs U = [u₀; ...; u_{num_steps-1}] alone, by
+// substituting xᵢ = Aⁱx₀ + ∑ⱼ₍ⱼ₌₀..ᵢ₋₁₎ Aⁱ⁻¹⁻ʲBuⱼ, i.e. X = Sₓx₀ + SᵤU. The
+// condensed QP is then min UᵀHU + 2x₀ᵀFᵀU, with H = SᵤᵀQ̄Sᵤ + R̄ and
+// F = SᵤᵀQ̄Sₓ, and its solution is U = -H⁻¹Fx₀. Returns the gain mapping x₀
+// to u₀.
+Eigen::MatrixXd CalcCondensedQpFeedbackGain(const Eigen::MatrixXd& A,
+                                            const Eigen::MatrixXd& B,
+                                            const Eigen::MatrixXd& Q,
+                                            const Eigen::MatrixXd& R,
+                                            int num_steps) {
+  const int num_states = B.rows();
+  const int num_inputs = B.cols();
+
+  // Sₓ and Sᵤ, computed block row by block row.
+  Eigen::MatrixXd Sx(num_steps * num_states, num_states);
+  Eigen::MatrixXd Su =
+      Eigen::MatrixXd::Zero(num_steps * num_states, num_steps * num_inputs);
+  Sx.topRows(num_states).setIdentity();
+  for (int i = 1; i < num_steps; i++) {
+    Sx.middleRows(i * num_states, num_states) =
+        A * Sx.middleRows((i - 1) * num_states, num_states);
+    Su.block(i * num_states, 0, num_states, i * num_inputs) =
+        A * Su.block((i - 1) * num_states, 0, num_states, i * num_inputs);
+    Su.block(i * num_states, (i - 1) * num_inputs, num_states, num_inputs) =
+        B;
+  }
+  Eigen::MatrixXd QSx(Sx.rows(), Sx.cols());
+  Eigen::MatrixXd QSu(Su.rows(), Su.cols());
+  for (int i = 0; i < num_steps; i++) {
+    QSx.middleRows(i * num_states, num_states) =
+        Q * Sx.middleRows(i * num_states, num_states);
+    QSu.middleRows(i * num_states, num_states) =
+        Q * Su.middleRows(i * num_states, num_states);
+  }
+
+  Eigen::MatrixXd H = Su.transpose() * QSu;
+  for (int i = 0; i < num_steps; i++) {
+    H.block(i * num_inputs, i * num_inputs, num_inputs, num_inputs) += R;
+  }
+  const Eigen::MatrixXd F = Su.transpose() * QSx;
+
+  // H is positive definite since R is.
+  const Eigen::LLT<Eigen::MatrixXd> H_cholesky(H);
+  DRAKE_DEMAND(H_cholesky.info() == Eigen::Success);
+  return -H_cholesky.solve(F).topRows(num_inputs);
+}
+
+}  // namespace
 
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
@@ -67,6 +118,14 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+
+    // The running cost is applied to all but the last sample time, with the
+    // dynamics linking consecutive sample times (as in DirectTranscription).
+    const int kNumSampleTimes =
+        static_cast<int>(time_horizon_ / time_period_ + 0.5);
+    DRAKE_DEMAND(kNumSampleTimes > 1);
+    feedback_gain_ = CalcCondensedQpFeedbackGain(
+        linear_model_->A(), linear_model_->B(), Q_, R_, kNumSampleTimes - 1);
   }
 }
 
@@ -77,7 +136,7 @@ void LinearModelPredictiveController<T>::CalcControl(
       get_state_port().Eval(context);
 
   const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+      SolveQp(*base_context_, current_state);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
@@ -87,30 +146,14 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
+VectorX<T> LinearModelPredictiveController<T>::SolveQp(
     const Context<T>& base_context, const VectorX<T>& current_state) const {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
-
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
-
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
-
   const VectorX<T> state_ref =
       base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
-
-  const auto result = Solve(prog);
-  DRAKE_DEMAND(result.is_success());
 
-  return prog.GetInputSamples(result).col(0);
+  return feedback_gain_ * (current_state - state_ref);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -23,9 +23,12 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// Since the present formulation has no inequality constraints, the QP is
+/// condensed (the states are eliminated using the dynamics) and factored once
+/// at construction.  Its solution is then linear in the current state, so that
+/// each control update only costs a matrix-vector product.
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 ///
@@ -78,10 +81,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Solves the condensed QP for the current control input, relative to the
+  // reference input.
+  VectorX<T> SolveQp(const Context<T>& base_context,
+                     const VectorX<T>& current_state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -101,6 +104,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The first input of the solution of the condensed QP as a linear function
+  // of the initial state error, of size (num_inputs x num_states).
+  Eigen::MatrixXd feedback_gain_;
 };
 
 }  // namespace controllers
@@ -1,15 +1,93 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
+#include <complex>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/common/parallel_for.h"
 #include "drake/math/continuous_algebraic_riccati_equation.h"
+#include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/math/discrete_algebraic_riccati_equation.h"
+#include "drake/math/discrete_lyapunov_equation.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
+namespace {
+
+// Returns true iff all the eigenvalues of the closed-loop dynamics matrix
+// A_cl lie in the open left half-plane (continuous time) or in the open unit
+// disk (discrete time).
+bool IsStable(const Eigen::MatrixXd& A_cl, bool discrete_time) {
+  const Eigen::VectorXcd eigenvalues = A_cl.eigenvalues();
+  for (int i = 0; i < eigenvalues.size(); ++i) {
+    if (discrete_time ? std::abs(eigenvalues(i)) >= 1.0
+                      : eigenvalues(i).real() >= 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Solves the (continuous or discrete time) LQR problem by Newton-Kleinman
+// iterations started from the gain K0: each iteration evaluates the
+// cost-to-go S of the current gain by solving a Lyapunov equation, then
+// improves the gain from S. Returns nullopt if K0 does not stabilize (A, B)
+// or if the iterations do not converge.
+optional<LinearQuadraticRegulatorResult> NewtonKleinman(
+    const Eigen::MatrixXd& A, const Eigen::MatrixXd& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& N, bool discrete_time,
+    const Eigen::MatrixXd& K0,
+    const BatchLinearQuadraticRegulatorOptions& options) {
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+  if (!IsStable(A - B * K0, discrete_time)) return nullopt;
+
+  LinearQuadraticRegulatorResult ret;
+  ret.K = K0;
+  for (int i = 0; i < options.max_newton_kleinman_iterations; ++i) {
+    // The cost-to-go of u = -Kx is x'Sx, where S solves the Lyapunov equation
+    // of the closed loop dynamics with the running cost x'(Q + K'RK)x.
+    const Eigen::MatrixXd A_cl = A - B * ret.K;
+    Eigen::MatrixXd Q_cl = Q + ret.K.transpose() * R * ret.K;
+    if (N.rows() != 0) {
+      Q_cl -= N * ret.K + ret.K.transpose() * N.transpose();
+    }
+    Q_cl = (Q_cl + Q_cl.transpose()) / 2;
+    Eigen::MatrixXd S;
+    try {
+      S = discrete_time ? math::RealDiscreteLyapunovEquation(A_cl, Q_cl)
+                        : math::RealContinuousLyapunovEquation(A_cl, Q_cl);
+    } catch (const std::runtime_error&) {
+      return nullopt;
+    }
+    const bool converged =
+        i > 0 && (S - ret.S).norm() <=
+                     options.newton_kleinman_tolerance * S.norm();
+    ret.S = std::move(S);
+    if (discrete_time) {
+      Eigen::MatrixXd tmp = B.transpose() * ret.S * B + R;
+      ret.K = tmp.llt().solve(B.transpose() * ret.S * A);
+    } else if (N.rows() != 0) {
+      ret.K = R_cholesky.solve(B.transpose() * ret.S + N.transpose());
+    } else {
+      ret.K = R_cholesky.solve(B.transpose() * ret.S);
+    }
+    if (converged) return ret;
+  }
+  return nullopt;
+}
+
+}  // namespace
+
 LinearQuadraticRegulatorResult LinearQuadraticRegulator(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::MatrixXd>& B,
@@ -142,6 +220,71 @@ std::unique_ptr<systems::AffineSystem<double>> LinearQuadraticRegulator(
       linear_system->time_period());
 }
 
+std::vector<LinearQuadraticRegulatorResult> BatchLinearQuadraticRegulator(
+    const System<double>& system,
+    const std::vector<const Context<double>*>& contexts,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& N,
+    int input_port_index,
+    const BatchLinearQuadraticRegulatorOptions& options) {
+  if (options.num_threads < 1) {
+    throw std::logic_error(
+        "BatchLinearQuadraticRegulator requires a positive number of "
+        "threads.");
+  }
+  if (options.max_newton_kleinman_iterations < 1) {
+    throw std::logic_error(
+        "BatchLinearQuadraticRegulator requires a positive maximum number of "
+        "Newton-Kleinman iterations.");
+  }
+
+  // The scalar conversion is shared by all the linearizations, which only
+  // read the converted system.
+  const std::unique_ptr<System<AutoDiffXd>> autodiff_system =
+      System<double>::ToAutoDiffXd(system);
+
+  const int num_points = static_cast<int>(contexts.size());
+  std::vector<LinearQuadraticRegulatorResult> results(num_points);
+  // The operating point last solved by each thread, whose gain warm starts
+  // the next one since the blocks of operating points are contiguous.
+  std::vector<int> last_solved(options.num_threads, -1);
+  StaticParallelForIndexLoop(
+      options.num_threads, 0, num_points, [&](int thread_num, int i) {
+        const Context<double>& context = *contexts[i];
+        DRAKE_DEMAND(context.num_total_states() > 0);
+        // Use specified input and no outputs (the output dynamics are
+        // irrelevant for LQR design).
+        const std::unique_ptr<LinearSystem<double>> linear_system =
+            internal::LinearizeWithAutoDiffSystem(
+                system, *autodiff_system, context,
+                InputPortIndex{input_port_index},
+                OutputPortSelection::kNoOutput, 1e-6);
+        const bool discrete_time = linear_system->time_period() != 0.0;
+
+        // DiscreteTimeLinearQuadraticRegulator does not support N yet.
+        DRAKE_DEMAND(!discrete_time || N.rows() == 0);
+
+        optional<LinearQuadraticRegulatorResult> result;
+        if (options.warm_start && i > 0 && last_solved[thread_num] == i - 1) {
+          result = NewtonKleinman(linear_system->A(), linear_system->B(), Q,
+                                  R, N, discrete_time, results[i - 1].K,
+                                  options);
+        }
+        if (!result) {
+          result = discrete_time
+                       ? DiscreteTimeLinearQuadraticRegulator(
+                             linear_system->A(), linear_system->B(), Q, R)
+                       : LinearQuadraticRegulator(linear_system->A(),
+                                                  linear_system->B(), Q, R,
+                                                  N);
+        }
+        results[i] = std::move(*result);
+        last_solved[thread_num] = i;
+      });
+  return results;
+}
+
 }  // namespace controllers
 }  // namespace systems
 }  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/systems/primitives/linear_system.h"
 
@@ -139,6 +140,72 @@ std::unique_ptr<AffineSystem<double>> LinearQuadraticRegulator(
         Eigen::Matrix<double, 0, 0>::Zero(),
     int input_port_index = 0);
 
+/// Options for BatchLinearQuadraticRegulator().
+struct BatchLinearQuadraticRegulatorOptions {
+  /// The maximum number of threads used to linearize the system and solve the
+  /// Riccati equations. The operating points are split into contiguous blocks,
+  /// one per thread.
+  int num_threads{1};
+
+  /// If true, the Riccati equation at each operating point is solved by
+  /// Newton-Kleinman iterations (Hewer's algorithm in discrete time) started
+  /// from the gain of the previous operating point in the same block, instead
+  /// of by the Schur method. This pays off when consecutive operating points
+  /// are close, since few iterations are then needed. The Schur method is
+  /// still used for the first operating point of each block, and whenever the
+  /// previous gain does not stabilize the linearization or the iterations do
+  /// not converge.
+  bool warm_start{false};
+
+  /// The maximum number of Newton-Kleinman iterations per operating point.
+  int max_newton_kleinman_iterations{20};
+
+  /// The iterations stop once the cost-to-go matrix S changes by no more than
+  /// this tolerance relative to its norm.
+  double newton_kleinman_tolerance{1e-10};
+};
+
+/// Linearizes the System around each of the specified Contexts and computes
+/// the optimal time-invariant linear quadratic regulator (LQR) at each of
+/// these operating points, e.g. to build a gain-scheduled controller. The
+/// LQR problem solved at each operating point is the one documented for the
+/// LinearQuadraticRegulator() overload taking a Context; the system is
+/// converted to AutoDiffXd once for all the linearizations.
+///
+/// @param system The System to be controlled.
+/// @param contexts The operating points, which must be equilibrium points of
+/// the system. They must be distinct objects if `options.num_threads` is
+/// greater than one, since they are evaluated concurrently.
+/// @param Q A symmetric positive semi-definite cost matrix of size num_states x
+/// num_states.
+/// @param R A symmetric positive definite cost matrix of size num_inputs x
+/// num_inputs.
+/// @param N A cost matrix of size num_states x num_inputs.  If the matrix is
+/// zero-sized, N will be treated as a num_states x num_inputs zero matrix.
+/// @param input_port_index The index of the input port to linearize around.
+/// @param options The parallelism and warm start options.
+/// @returns The optimal feedback gain K and quadratic cost term S at each
+/// operating point, in the order of @p contexts. The optimal feedback control
+/// around the operating point (x0, u0) is u = u0 - K(x-x0). When warm starts
+/// are enabled, the results agree with those of the Schur method to within
+/// the Newton-Kleinman tolerance, regardless of the number of threads.
+///
+/// @throws std::runtime_error if R is not positive definite.
+/// @throws std::logic_error if `options.num_threads` or
+/// `options.max_newton_kleinman_iterations` is not positive.
+/// @ingroup control_systems
+/// @see LinearQuadraticRegulator()
+///
+std::vector<LinearQuadraticRegulatorResult> BatchLinearQuadraticRegulator(
+    const System<double>& system,
+    const std::vector<const Context<double>*>& contexts,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& N =
+        Eigen::Matrix<double, 0, 0>::Zero(),
+    int input_port_index = 0,
+    const BatchLinearQuadraticRegulatorOptions& options = {});
+
 }  // namespace controllers
 }  // namespace systems
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
 #include <cmath>
+#include <memory>
 
 #include <gtest/gtest.h>
 
@@ -198,6 +199,56 @@ GTEST_TEST(FittedValueIteration, DoubleIntegrator) {
   }
 }
 
+// The multi-threaded computation produces the same result as the serial one.
+GTEST_TEST(FittedValueIteration, MultipleThreads) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  LinearSystem<double> sys(A, B, Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d::Zero());
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.get_input_port().Eval(context)[0];
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -2.; x <= 2.; x += .25) {
+    state_grid[0].insert(x);
+    state_grid[1].insert(x);
+  }
+  math::BarycentricMesh<double>::MeshGrid input_grid(1);
+  for (double u = -4.; u <= 4.; u += 1.) {
+    input_grid[0].insert(u);
+  }
+  const double timestep = .05;
+
+  Simulator<double> serial_simulator(sys);
+  DynamicProgrammingOptions options;
+  options.discount_factor = .95;
+  std::unique_ptr<BarycentricMeshSystem<double>> serial_policy;
+  Eigen::RowVectorXd serial_cost_to_go;
+  std::tie(serial_policy, serial_cost_to_go) =
+      FittedValueIteration(&serial_simulator, cost_function, state_grid,
+                           input_grid, timestep, options);
+
+  Simulator<double> parallel_simulator(sys);
+  options.num_threads = 3;
+  options.simulator_factory = [&sys]() {
+    return std::make_unique<Simulator<double>>(sys);
+  };
+  std::unique_ptr<BarycentricMeshSystem<double>> parallel_policy;
+  Eigen::RowVectorXd parallel_cost_to_go;
+  std::tie(parallel_policy, parallel_cost_to_go) =
+      FittedValueIteration(&parallel_simulator, cost_function, state_grid,
+                           input_grid, timestep, options);
+
+  EXPECT_TRUE(CompareMatrices(parallel_cost_to_go, serial_cost_to_go, 1e-12));
+  EXPECT_TRUE(CompareMatrices(parallel_policy->get_output_values(),
+                              serial_policy->get_output_values()));
+}
+
 // Minimum-time problem for the single integrator (which has a trivial solution,
 // that can be achieved exactly on a mesh when timestep=1).
 // ẋ = u,  u ∈ {-1,0,1}.
@@ -212,6 +212,11 @@ TEST_F(InverseDynamicsTest, InverseDynamicsTest) {
   EXPECT_TRUE(GravityModeled(q));
 
   CheckTorque(q, v, vd_d);
+
+  // The cached plant context follows the estimated state, and is reused as
+  // only the desired acceleration changes.
+  CheckTorque(-q, v, vd_d);
+  CheckTorque(-q, v, 2 * vd_d);
 }
 
 }  // namespace
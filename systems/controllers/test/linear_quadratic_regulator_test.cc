@@ -1,8 +1,13 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/examples/pendulum/pendulum_plant.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
@@ -196,6 +201,87 @@ GTEST_TEST(TestLQR, DiscreteDoubleIntegrator) {
   TestLQRAffineSystemAgainstKnownSolution(tol, sys, K, Q, R);
 }
 
+// Gain scheduling over the equilibria of a pendulum, which all have distinct
+// linearizations.
+GTEST_TEST(TestLQR, BatchPendulum) {
+  examples::pendulum::PendulumPlant<double> pendulum;
+  std::vector<std::unique_ptr<Context<double>>> owned_contexts;
+  std::vector<const Context<double>*> contexts;
+  for (int i = 0; i < 20; ++i) {
+    const double theta = M_PI - 0.05 * i;
+    auto context = pendulum.CreateDefaultContext();
+    const auto& params = pendulum.get_parameters(*context);
+    pendulum.get_mutable_state(context.get()).set_theta(theta);
+    pendulum.get_mutable_state(context.get()).set_thetadot(0);
+    pendulum.get_input_port().FixValue(
+        context.get(),
+        examples::pendulum::PendulumInput<double>{}.with_tau(
+            params.mass() * params.gravity() * params.length() *
+            std::sin(theta)));
+    contexts.push_back(context.get());
+    owned_contexts.push_back(std::move(context));
+  }
+  const Eigen::Matrix2d Q = Eigen::Vector2d(10, 1).asDiagonal();
+  const Vector1d R = Vector1d::Identity();
+  const Eigen::Vector2d N(0.1, 0);
+
+  for (const bool warm_start : {false, true}) {
+    for (const int num_threads : {1, 3}) {
+      BatchLinearQuadraticRegulatorOptions options;
+      options.warm_start = warm_start;
+      options.num_threads = num_threads;
+      const std::vector<LinearQuadraticRegulatorResult> results =
+          BatchLinearQuadraticRegulator(pendulum, contexts, Q, R, N, 0,
+                                        options);
+      ASSERT_EQ(results.size(), contexts.size());
+      for (size_t i = 0; i < contexts.size(); ++i) {
+        const std::unique_ptr<AffineSystem<double>> lqr =
+            LinearQuadraticRegulator(pendulum, *contexts[i], Q, R, N);
+        EXPECT_TRUE(CompareMatrices(results[i].K, -lqr->D(), 1e-8));
+        const std::unique_ptr<LinearSystem<double>> linear_system =
+            Linearize(pendulum, *contexts[i]);
+        const LinearQuadraticRegulatorResult expected =
+            LinearQuadraticRegulator(linear_system->A(), linear_system->B(),
+                                     Q, R, N);
+        EXPECT_TRUE(CompareMatrices(results[i].S, expected.S, 1e-8));
+      }
+    }
+  }
+
+  BatchLinearQuadraticRegulatorOptions bad_options;
+  bad_options.num_threads = 0;
+  EXPECT_THROW(BatchLinearQuadraticRegulator(pendulum, contexts, Q, R, N, 0,
+                                             bad_options),
+               std::logic_error);
+}
+
+GTEST_TEST(TestLQR, BatchDiscreteDoubleIntegrator) {
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, 1, 0, 1;
+  B << 0, 1;
+  const LinearSystem<double> sys(A, B, Eigen::Matrix<double, 0, 2>::Zero(),
+                                 Eigen::Matrix<double, 0, 1>::Zero(), 0.1);
+  auto context = sys.CreateDefaultContext();
+  context->FixInputPort(0, Vector1d::Zero());
+  const std::vector<const Context<double>*> contexts(4, context.get());
+
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R = Vector1d::Identity();
+  const LinearQuadraticRegulatorResult expected =
+      DiscreteTimeLinearQuadraticRegulator(A, B, Q, R);
+
+  BatchLinearQuadraticRegulatorOptions options;
+  options.warm_start = true;
+  for (const LinearQuadraticRegulatorResult& result :
+       BatchLinearQuadraticRegulator(sys, contexts, Q, R,
+                                     Eigen::Matrix<double, 0, 0>::Zero(), 0,
+                                     options)) {
+    EXPECT_TRUE(CompareMatrices(result.K, expected.K, 1e-10));
+    EXPECT_TRUE(CompareMatrices(result.S, expected.S, 1e-10));
+  }
+}
+
 }  // namespace
 }  // namespace controllers
 }  // namespace systems
@@ -253,6 +253,46 @@ TEST_F(ZMPPlannerTest, TestOptimalControl) {
   }
 }
 
+// Replanning reuses the time invariant terms of the previous plan when the
+// parameters are the same, and must give the same plan as a new planner.
+TEST_F(ZMPPlannerTest, TestReplan) {
+  std::vector<Eigen::Vector2d> footsteps = {
+      Eigen::Vector2d(0, 0), Eigen::Vector2d(0.5, 0.1),
+      Eigen::Vector2d(1, -0.1), Eigen::Vector2d(1.5, 0)};
+  std::vector<PiecewisePolynomial<double>> zmp_trajs =
+      GenerateDesiredZMPTrajs(footsteps, 0.5, 1);
+  const Eigen::Vector4d x0(0.1, -0.05, 0.1, 0.1);
+
+  struct Parameters {
+    double height;
+    Eigen::Matrix2d Qy;
+  };
+  const std::vector<Parameters> parameters = {
+      {1, Eigen::Matrix2d::Identity()},
+      {1, Eigen::Matrix2d::Identity()},
+      {0.8, Eigen::Matrix2d::Identity()},
+      {0.8, 2 * Eigen::Matrix2d::Identity()}};
+
+  ZMPPlanner replanner;
+  for (const Parameters& param : parameters) {
+    for (const auto& zmp_d : zmp_trajs) {
+      replanner.Plan(zmp_d, x0, param.height, 9.81, param.Qy);
+      ZMPPlanner planner;
+      planner.Plan(zmp_d, x0, param.height, 9.81, param.Qy);
+
+      EXPECT_TRUE(CompareMatrices(replanner.get_Vxx(), planner.get_Vxx()));
+      EXPECT_TRUE(CompareMatrices(replanner.get_D(), planner.get_D()));
+      for (double t = zmp_d.start_time(); t <= zmp_d.end_time(); t += 0.1) {
+        EXPECT_TRUE(CompareMatrices(replanner.get_nominal_com(t),
+                                    planner.get_nominal_com(t)));
+        EXPECT_TRUE(CompareMatrices(replanner.get_Vx(t), planner.get_Vx(t)));
+        EXPECT_TRUE(CompareMatrices(replanner.ComputeOptimalCoMdd(t, x0),
+                                    planner.ComputeOptimalCoMdd(t, x0)));
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace controllers
 }  // namespace systems
@@ -1,5 +1,6 @@
 #include "drake/systems/controllers/zmp_planner.h"
 
+#include <limits>
 #include <vector>
 
 #include <unsupported/Eigen/MatrixFunctions>
@@ -40,27 +41,11 @@ bool ZMPPlanner::CheckStationaryEndPoint(
   return true;
 }
 
-void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
-                      const Eigen::Vector4d& x0, double height, double gravity,
-                      const Eigen::Matrix2d& Qy, const Eigen::Matrix2d& R) {
-  // Warn the caller if the last point is not stationary. The math is still
-  // correct, and this is an allowable (but dangerous) use case.
-  // If the user use the policy / nominal trajectory past the end point, the
-  // system diverges exponentially fast.
-  if (!CheckStationaryEndPoint(zmp_d)) {
-    drake::log()->warn("ZMPPlanner: The desired zmp trajectory does not end "
-        "in a stationary condition.");
-  }
-
-  int n_segments = zmp_d.get_number_of_segments();
-  int zmp_d_degree = zmp_d.getSegmentPolynomialDegree(0);
-  DRAKE_DEMAND(zmp_d_degree >= 0);
-  DRAKE_DEMAND(zmp_d.rows() == 2 && zmp_d.cols() == 1);
-  DRAKE_DEMAND(height > 0);
-  DRAKE_DEMAND(gravity > 0);
-
-  zmp_d_ = zmp_d;
-
+void ZMPPlanner::UpdateTimeInvariantTerms(double height, double gravity,
+                                          const Eigen::Matrix2d& Qy,
+                                          const Eigen::Matrix2d& R) {
+  // Nothing is reused until the update completes.
+  height_ = std::numeric_limits<double>::quiet_NaN();
   Qy_ = Qy;
   R_ = R;
 
@@ -85,19 +70,82 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
   S1_ = lqr_result.S;
   K_ = -lqr_result.K;
 
-  // Computes the time varying linear and constant term in the value function
-  // and linear policy. Also known as the backward pass.
+  // The terms of the backward pass that don't depend on the desired ZMP.
   Eigen::Matrix<double, 2, 4> NB = (N.transpose() + B_.transpose() * S1_);
   // Eq. 23, 24 in [1].
   Eigen::Matrix<double, 4, 4> A2 =
       NB.transpose() * R1i * B_.transpose() - A_.transpose();
   Eigen::Matrix<double, 4, 2> B2 =
       2 * (C_.transpose() - NB.transpose() * R1i * D_) * Qy_;
-  Eigen::Matrix<double, 4, 4> A2i = A2.inverse();
 
   NB_ = NB;
   A2_ = A2;
   B2_ = B2;
+  A2i_ = A2.inverse();
+
+  // The terms of the forward pass that don't depend on the desired ZMP.
+  // Eq. 35, 36 in [1].
+  Az_.block<4, 4>(0, 0) = A_ + B_ * K_;
+  Az_.block<4, 4>(0, 4) = -0.5 * B_ * R1i * B_.transpose();
+  Az_.block<4, 4>(4, 0).setZero();
+  Az_.block<4, 4>(4, 4) = A2;
+  Azi_ = Az_.inverse();
+  Bz_.block<4, 2>(0, 0) = B_ * R1i * D_ * Qy_;
+  Bz_.block<4, 2>(4, 0) = B2;
+
+  segment_exponentials_.clear();
+  height_ = height;
+  gravity_ = gravity;
+}
+
+const ZMPPlanner::SegmentExponentials& ZMPPlanner::GetSegmentExponentials(
+    double dt) {
+  auto iter = segment_exponentials_.find(dt);
+  if (iter == segment_exponentials_.end()) {
+    // The durations of the segments usually come from a few step timings;
+    // start afresh if they don't.
+    if (segment_exponentials_.size() >= kMaxNumSegmentExponentials) {
+      segment_exponentials_.clear();
+    }
+    SegmentExponentials exponentials;
+    const Eigen::Matrix4d A2exp = (A2_ * dt).exp();
+    exponentials.A2exp_inverse = A2exp.inverse();
+    exponentials.Az_exp = (Az_ * dt).exp();
+    iter = segment_exponentials_.emplace(dt, exponentials).first;
+  }
+  return iter->second;
+}
+
+void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
+                      const Eigen::Vector4d& x0, double height, double gravity,
+                      const Eigen::Matrix2d& Qy, const Eigen::Matrix2d& R) {
+  // Warn the caller if the last point is not stationary. The math is still
+  // correct, and this is an allowable (but dangerous) use case.
+  // If the user use the policy / nominal trajectory past the end point, the
+  // system diverges exponentially fast.
+  if (!CheckStationaryEndPoint(zmp_d)) {
+    drake::log()->warn("ZMPPlanner: The desired zmp trajectory does not end "
+        "in a stationary condition.");
+  }
+
+  int n_segments = zmp_d.get_number_of_segments();
+  int zmp_d_degree = zmp_d.getSegmentPolynomialDegree(0);
+  DRAKE_DEMAND(zmp_d_degree >= 0);
+  DRAKE_DEMAND(zmp_d.rows() == 2 && zmp_d.cols() == 1);
+  DRAKE_DEMAND(height > 0);
+  DRAKE_DEMAND(gravity > 0);
+
+  zmp_d_ = zmp_d;
+
+  // The time invariant part of the solution only depends on the parameters of
+  // the LIPM and the cost, so it is reused by the replans that keep them.
+  if (!(height == height_ && gravity == gravity_ && Qy == Qy_ && R == R_)) {
+    UpdateTimeInvariantTerms(height, gravity, Qy, R);
+  }
+  const Eigen::Matrix<double, 2, 2>& R1i = R1i_;
+  const Eigen::Matrix<double, 4, 4>& A2 = A2_;
+  const Eigen::Matrix<double, 4, 2>& B2 = B2_;
+  const Eigen::Matrix<double, 4, 4>& A2i = A2i_;
 
   // Last desired ZMP.
   Eigen::Vector2d zmp_tf = zmp_d.value(zmp_d.end_time());
@@ -148,13 +196,11 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
     }
 
     double dt = zmp_d.duration(t);
-    Eigen::Matrix4d A2exp = A2 * dt;
-    A2exp = A2exp.exp();
     for (int i = 0; i < zmp_d_degree + 1; i++)
       delta_time_vec[i] = std::pow(dt, i);
     tmp4 = tmp4 - beta[t] * delta_time_vec;
 
-    alpha.col(t) = A2exp.inverse() * tmp4;
+    alpha.col(t) = GetSegmentExponentials(dt).A2exp_inverse * tmp4;
 
     beta_poly[t].resize(4, 1);
     for (int n = 0; n < 4; n++) {
@@ -178,16 +224,9 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
                                                    A2, alpha, gamma_traj);
 
   // Computes the nominal CoM trajectory. Also known as the forward pass.
-  // Eq. 35, 36 in [1].
-  Eigen::Matrix<double, 8, 8> Az, Azi;
-  Eigen::Matrix<double, 8, 2> Bz;
-  Az.block<4, 4>(0, 0) = A_ + B_ * K_;
-  Az.block<4, 4>(0, 4) = -0.5 * B_ * R1i * B_.transpose();
-  Az.block<4, 4>(4, 0).setZero();
-  Az.block<4, 4>(4, 4) = A2;
-  Azi = Az.inverse();
-  Bz.block<4, 2>(0, 0) = B_ * R1i * D_ * Qy_;
-  Bz.block<4, 2>(4, 0) = B2;
+  const Eigen::Matrix<double, 8, 8>& Az = Az_;
+  const Eigen::Matrix<double, 8, 8>& Azi = Azi_;
+  const Eigen::Matrix<double, 8, 2>& Bz = Bz_;
 
   Eigen::MatrixXd a(8, n_segments);
   a.bottomRows<4>() = alpha;
@@ -197,7 +236,6 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
   std::vector<Eigen::MatrixXd> b(n_segments,
                                  Eigen::MatrixXd(4, zmp_d_degree + 1));
   Eigen::Matrix<double, 8, 1> tmp81;
-  Eigen::Matrix<double, 8, 8> Az_exp;
   Eigen::Matrix<double, 4, 8> I48;
   I48.block<4, 4>(0, 0).setIdentity();
   I48.block<4, 4>(0, 4).setZero();
@@ -220,11 +258,10 @@ void ZMPPlanner::Plan(const PiecewisePolynomial<double>& zmp_d,
 
     a.block<4, 1>(0, t) = x - b[t].col(0);
 
-    Az_exp = Az * dt;
-    Az_exp = Az_exp.exp();
     for (int i = 0; i < zmp_d_degree + 1; i++)
       delta_time_vec[i] = std::pow(dt, i);
-    x = I48 * Az_exp * a.col(t) + b[t] * delta_time_vec;
+    x = I48 * GetSegmentExponentials(dt).Az_exp * a.col(t) +
+        b[t] * delta_time_vec;
 
     b[t].block<2, 1>(0, 0) += zmp_tf;  // Map CoM position back to world frame.
 
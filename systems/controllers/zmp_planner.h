@@ -1,5 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <limits>
+#include <map>
+#include <utility>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/exponential_plus_piecewise_polynomial.h"
@@ -282,6 +287,30 @@ class ZMPPlanner {
   bool CheckStationaryEndPoint(
       const trajectories::PiecewisePolynomial<double>& zmp_d) const;
 
+  // Computes the terms of the solution that only depend on the parameters of
+  // the LIPM and of the cost (i.e., not on the desired ZMP trajectory).
+  void UpdateTimeInvariantTerms(double height, double gravity,
+                                const Eigen::Matrix2d& Qy,
+                                const Eigen::Matrix2d& R);
+
+  // The matrix exponentials of the backward and forward passes for a segment
+  // of duration dt.
+  struct SegmentExponentials {
+    // exp(A2 * dt)^-1.
+    Eigen::Matrix<double, 4, 4> A2exp_inverse;
+    // exp(Az * dt).
+    Eigen::Matrix<double, 8, 8> Az_exp;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  };
+
+  // Returns the exponentials for a segment of duration dt, computing them
+  // only the first time that dt is seen since UpdateTimeInvariantTerms().
+  const SegmentExponentials& GetSegmentExponentials(double dt);
+
+  // The maximum number of segment durations whose exponentials are kept.
+  static constexpr size_t kMaxNumSegmentExponentials = 64;
+
   // Used to test whether the last point of the desired ZMP trajectory is
   // stationary or not in CheckStationaryEndPoint. This number is currently
   // arbitrarily chosen.
@@ -328,6 +357,22 @@ class ZMPPlanner {
   Eigen::Matrix<double, 2, 4> K_;
   trajectories::ExponentialPlusPiecewisePolynomial<double> k2_;
 
+  // The parameters of the last call to UpdateTimeInvariantTerms().
+  double height_{std::numeric_limits<double>::quiet_NaN()};
+  double gravity_{std::numeric_limits<double>::quiet_NaN()};
+
+  // The time invariant terms of the backward pass (A2^-1) and of the forward
+  // pass.
+  Eigen::Matrix<double, 4, 4> A2i_;
+  Eigen::Matrix<double, 8, 8> Az_;
+  Eigen::Matrix<double, 8, 8> Azi_;
+  Eigen::Matrix<double, 8, 2> Bz_;
+
+  std::map<double, SegmentExponentials, std::less<double>,
+           Eigen::aligned_allocator<
+               std::pair<const double, SegmentExponentials>>>
+      segment_exponentials_;
+
   bool planned_{false};
 };
 
@@ -0,0 +1,165 @@
+#include "drake/systems/estimators/batched_kalman_filter.h"
+
+#include "drake/common/default_scalars.h"
+
+namespace drake {
+namespace systems {
+namespace estimators {
+
+template <typename T>
+BatchedKalmanFilter<T>::BatchedKalmanFilter(
+    const LinearSystem<double>& system, int num_filters,
+    const Eigen::Ref<const Eigen::MatrixXd>& W,
+    const Eigen::Ref<const Eigen::MatrixXd>& V,
+    const Eigen::Ref<const Eigen::MatrixXd>& P0)
+    : BatchedKalmanFilter(system, num_filters, W, V, P0, Eigen::MatrixXd()) {}
+
+template <typename T>
+BatchedKalmanFilter<T>::BatchedKalmanFilter(
+    const LinearSystem<double>& system, int num_filters,
+    const Eigen::Ref<const Eigen::MatrixXd>& observer_gain)
+    : BatchedKalmanFilter(system, num_filters, Eigen::MatrixXd(),
+                          Eigen::MatrixXd(), Eigen::MatrixXd(),
+                          observer_gain) {
+  DRAKE_THROW_UNLESS(observer_gain.rows() == A_.rows());
+  DRAKE_THROW_UNLESS(observer_gain.cols() == C_.rows());
+}
+
+template <typename T>
+BatchedKalmanFilter<T>::BatchedKalmanFilter(
+    const LinearSystem<double>& system, int num_filters,
+    const Eigen::Ref<const Eigen::MatrixXd>& W,
+    const Eigen::Ref<const Eigen::MatrixXd>& V,
+    const Eigen::Ref<const Eigen::MatrixXd>& P0,
+    const Eigen::Ref<const Eigen::MatrixXd>& observer_gain)
+    : num_filters_(num_filters),
+      A_(system.A().cast<T>()),
+      B_(system.B().cast<T>()),
+      C_(system.C().cast<T>()),
+      D_(system.D().cast<T>()),
+      W_(W.cast<T>()),
+      V_(V.cast<T>()),
+      L_(observer_gain.cast<T>()) {
+  DRAKE_THROW_UNLESS(system.time_period() > 0.0);
+  DRAKE_THROW_UNLESS(num_filters > 0);
+  const int num_states = A_.rows();
+  const int num_outputs = C_.rows();
+  DRAKE_THROW_UNLESS(num_states > 0);
+  DRAKE_THROW_UNLESS(num_outputs > 0);
+
+  this->DeclareDiscreteState(num_states * num_filters);
+  if (is_time_varying()) {
+    DRAKE_THROW_UNLESS(W.rows() == num_states && W.cols() == num_states);
+    DRAKE_THROW_UNLESS(V.rows() == num_outputs && V.cols() == num_outputs);
+    DRAKE_THROW_UNLESS(P0.rows() == num_states && P0.cols() == num_states);
+    this->DeclareDiscreteState(Eigen::Map<const Eigen::VectorXd>(
+        P0.eval().data(), P0.size()).template cast<T>());
+  }
+  this->DeclarePeriodicDiscreteUpdateEvent(
+      system.time_period(), 0.0, &BatchedKalmanFilter::UpdateEstimates);
+
+  this->DeclareInputPort("y", kVectorValued, num_outputs * num_filters);
+  if (B_.cols() > 0) {
+    this->DeclareInputPort("u", kVectorValued, B_.cols() * num_filters);
+  }
+  this->DeclareVectorOutputPort("x_hat",
+                                BasicVector<T>(num_states * num_filters),
+                                &BatchedKalmanFilter::CalcEstimatedStates,
+                                {this->xd_ticket()});
+}
+
+template <typename T>
+MatrixX<T> BatchedKalmanFilter<T>::GetEstimates(
+    const Context<T>& context) const {
+  DRAKE_ASSERT_VOID(this->CheckValidContext(context));
+  return Eigen::Map<const MatrixX<T>>(
+      context.get_discrete_state(0).get_value().data(), A_.rows(),
+      num_filters_);
+}
+
+template <typename T>
+void BatchedKalmanFilter<T>::SetEstimates(
+    Context<T>* context, const Eigen::Ref<const MatrixX<T>>& X_hat) const {
+  DRAKE_DEMAND(context != nullptr);
+  DRAKE_ASSERT_VOID(this->CheckValidContext(*context));
+  DRAKE_THROW_UNLESS(X_hat.rows() == A_.rows());
+  DRAKE_THROW_UNLESS(X_hat.cols() == num_filters_);
+  Eigen::Map<MatrixX<T>>(
+      context->get_mutable_discrete_state(0).get_mutable_value().data(),
+      A_.rows(), num_filters_) = X_hat;
+}
+
+template <typename T>
+MatrixX<T> BatchedKalmanFilter<T>::GetCovariance(
+    const Context<T>& context) const {
+  DRAKE_DEMAND(is_time_varying());
+  DRAKE_ASSERT_VOID(this->CheckValidContext(context));
+  return Eigen::Map<const MatrixX<T>>(
+      context.get_discrete_state(1).get_value().data(), A_.rows(),
+      A_.rows());
+}
+
+template <typename T>
+void BatchedKalmanFilter<T>::CalcEstimatedStates(
+    const Context<T>& context, BasicVector<T>* output) const {
+  output->SetFromVector(context.get_discrete_state(0).get_value());
+}
+
+template <typename T>
+void BatchedKalmanFilter<T>::UpdateEstimates(
+    const Context<T>& context, DiscreteValues<T>* updates) const {
+  const int num_states = A_.rows();
+  const int num_outputs = C_.rows();
+  const int num_inputs = B_.cols();
+
+  // The stacked vectors, viewed as matrices with one column per filter.
+  const Eigen::Map<const MatrixX<T>> X_hat(
+      context.get_discrete_state(0).get_value().data(), num_states,
+      num_filters_);
+  const auto y = get_measurement_input_port().Eval(context);
+  const Eigen::Map<const MatrixX<T>> Y(y.data(), num_outputs, num_filters_);
+
+  // The innovations and the predictions, for all of the filters at once.
+  MatrixX<T> innovations = Y - C_ * X_hat;
+  MatrixX<T> X_hat_next = A_ * X_hat;
+  if (num_inputs > 0) {
+    const auto u = get_control_input_port().Eval(context);
+    const Eigen::Map<const MatrixX<T>> U(u.data(), num_inputs, num_filters_);
+    innovations.noalias() -= D_ * U;
+    X_hat_next.noalias() += B_ * U;
+  }
+
+  Eigen::Map<MatrixX<T>> X_hat_out(
+      updates->get_mutable_vector(0).get_mutable_value().data(), num_states,
+      num_filters_);
+  if (!is_time_varying()) {
+    X_hat_out = X_hat_next + L_ * innovations;
+    return;
+  }
+
+  // The gain and the covariance are the same for all of the filters, so they
+  // are computed only once.
+  const Eigen::Map<const MatrixX<T>> P(
+      context.get_discrete_state(1).get_value().data(), num_states,
+      num_states);
+  const MatrixX<T> PCt = P * C_.transpose();
+  const MatrixX<T> S = C_ * PCt + V_;
+  // K = PCᵀS⁻¹, computed as (S⁻¹CP)ᵀ since S and P are symmetric.
+  const MatrixX<T> K = S.llt().solve(PCt.transpose()).transpose();
+  const MatrixX<T> L = A_ * K;
+  X_hat_out = X_hat_next + L * innovations;
+
+  Eigen::Map<MatrixX<T>> P_out(
+      updates->get_mutable_vector(1).get_mutable_value().data(), num_states,
+      num_states);
+  const MatrixX<T> P_next = (A_ - L * C_) * P * A_.transpose() + W_;
+  // Symmetrizes, against the accumulation of round-off errors.
+  P_out = (P_next + P_next.transpose()) / 2;
+}
+
+}  // namespace estimators
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::estimators::BatchedKalmanFilter)
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace estimators {
+
+/// A bank of N identical state observers for N copies of a discrete-time
+/// linear system,
+///   @f[ x_i[k+1] = Ax_i[k] + Bu_i[k] + w_i[k], @f]
+///   @f[ y_i[k] = Cx_i[k] + Du_i[k] + v_i[k], @f]
+/// as a single LeafSystem. Each observer has the form
+///   @f[ \hat{x}_i[k+1] = A\hat{x}_i[k] + Bu_i[k]
+///                        + L[k](y_i[k] - C\hat{x}_i[k] - Du_i[k]), @f]
+/// where @f$\hat{x}_i[k]@f$ is the estimate of @f$x_i[k]@f$ given the
+/// measurements up to time k - 1.
+///
+/// The gain L[k] is either a constant (a Luenberger observer, e.g. with a
+/// steady-state Kalman filter gain) or the gain of the (time-varying) Kalman
+/// filter, in which case the state covariance matrix P[k] is propagated along
+/// with the estimates:
+///   @f[ L[k] = AP[k]C^T(CP[k]C^T + V)^{-1}, @f]
+///   @f[ P[k+1] = (A - L[k]C)P[k]A^T + W. @f]
+/// Since the copies share their model and their noise covariances, they share
+/// P[k] and L[k] too: the gain is computed once per update for all of the
+/// filters, and the N estimates, stored as the columns of one n-by-N matrix,
+/// are updated with a few matrix products. This is much cheaper than N
+/// separate observer systems, each with its own context.
+///
+/// The input and output vectors stack the vectors of the N copies: the
+/// measurement input port has N * num_outputs elements, of which y_i is the
+/// i-th segment; the control input port (only if the system has inputs) has
+/// N * num_inputs elements, and the estimated state output port has
+/// N * num_states elements. The estimates are the first discrete state group,
+/// and the covariance matrix (for the Kalman filter only) is the second one,
+/// both in column-major order. The initial estimates are zero.
+///
+/// @tparam T The vector element type, which must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+///
+/// @ingroup estimator_systems
+template <typename T>
+class BatchedKalmanFilter final : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchedKalmanFilter)
+
+  /// Constructs a bank of time-varying Kalman filters.
+  ///
+  /// @param system The discrete-time model of each copy, which is only used
+  /// during construction.
+  /// @param num_filters The number N of filters.
+  /// @param W The process noise covariance matrix, E[ww'], of size
+  /// num_states x num_states.
+  /// @param V The measurement noise covariance matrix, E[vv'], of size
+  /// num_outputs x num_outputs.
+  /// @param P0 The initial state covariance matrix, of size num_states x
+  /// num_states.
+  ///
+  /// @throws std::exception if @p system is not discrete-time, if
+  /// @p num_filters is not positive, or if the matrices have the wrong sizes.
+  BatchedKalmanFilter(const LinearSystem<double>& system, int num_filters,
+                      const Eigen::Ref<const Eigen::MatrixXd>& W,
+                      const Eigen::Ref<const Eigen::MatrixXd>& V,
+                      const Eigen::Ref<const Eigen::MatrixXd>& P0);
+
+  /// Constructs a bank of Luenberger observers with the constant gain
+  /// @p observer_gain, of size num_states x num_outputs.
+  ///
+  /// @throws std::exception if @p system is not discrete-time, if
+  /// @p num_filters is not positive, or if the gain has the wrong size.
+  BatchedKalmanFilter(const LinearSystem<double>& system, int num_filters,
+                      const Eigen::Ref<const Eigen::MatrixXd>& observer_gain);
+
+  /// Returns the number N of filters.
+  int num_filters() const { return num_filters_; }
+
+  /// Returns true iff the gain is that of the time-varying Kalman filter.
+  bool is_time_varying() const { return L_.size() == 0; }
+
+  /// Returns the input port of the N stacked measurements.
+  const InputPort<T>& get_measurement_input_port() const {
+    return this->get_input_port(0);
+  }
+
+  /// Returns the input port of the N stacked controls.
+  /// @pre The system has inputs.
+  const InputPort<T>& get_control_input_port() const {
+    DRAKE_DEMAND(B_.cols() > 0);
+    return this->get_input_port(1);
+  }
+
+  /// Returns the output port of the N stacked estimated states.
+  const OutputPort<T>& get_estimated_state_output_port() const {
+    return this->get_output_port(0);
+  }
+
+  /// Returns the estimates in @p context, as the columns of a
+  /// num_states x N matrix.
+  MatrixX<T> GetEstimates(const Context<T>& context) const;
+
+  /// Sets the estimates in @p context to the columns of @p X_hat, of size
+  /// num_states x N.
+  void SetEstimates(Context<T>* context,
+                    const Eigen::Ref<const MatrixX<T>>& X_hat) const;
+
+  /// Returns the state covariance matrix in @p context.
+  /// @pre is_time_varying().
+  MatrixX<T> GetCovariance(const Context<T>& context) const;
+
+ private:
+  BatchedKalmanFilter(const LinearSystem<double>& system, int num_filters,
+                      const Eigen::Ref<const Eigen::MatrixXd>& W,
+                      const Eigen::Ref<const Eigen::MatrixXd>& V,
+                      const Eigen::Ref<const Eigen::MatrixXd>& P0,
+                      const Eigen::Ref<const Eigen::MatrixXd>& observer_gain);
+
+  void CalcEstimatedStates(const Context<T>& context,
+                           BasicVector<T>* output) const;
+
+  void UpdateEstimates(const Context<T>& context,
+                       DiscreteValues<T>* updates) const;
+
+  const int num_filters_;
+  // The matrices are stored as T, since Eigen can't multiply mixed-scalar
+  // matrices.
+  const MatrixX<T> A_;
+  const MatrixX<T> B_;
+  const MatrixX<T> C_;
+  const MatrixX<T> D_;
+  // The noise covariances, for the Kalman filter only.
+  const MatrixX<T> W_;
+  const MatrixX<T> V_;
+  // The constant gain, for the Luenberger observer only.
+  const MatrixX<T> L_;
+};
+
+}  // namespace estimators
+}  // namespace systems
+}  // namespace drake
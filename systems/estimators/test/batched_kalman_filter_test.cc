@@ -0,0 +1,168 @@
+#include "drake/systems/estimators/batched_kalman_filter.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/discrete_algebraic_riccati_equation.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace estimators {
+namespace {
+
+using Eigen::Matrix2d;
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+constexpr int kNumFilters = 3;
+
+class BatchedKalmanFilterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // clang-format off
+    A_ << 1.0, 0.1,
+          0.0, 0.9;
+    // clang-format on
+    B_ << 0.0, 0.1;
+    C_ << 1.0, 0.0;
+    D_ << 0.5;
+    system_ = std::make_unique<LinearSystem<double>>(A_, B_, C_, D_, 0.1);
+    W_ = 0.01 * Matrix2d::Identity();
+    V_ << 0.1;
+    // clang-format off
+    X_hat_ << 1.0, -2.0, 0.5,
+              0.3,  0.0, 4.0;
+    // clang-format on
+    y_ << 0.7, -1.5, 2.0;
+    u_ << 1.0, 0.0, -3.0;
+  }
+
+  // Updates the estimates of `filter` once, from X_hat_ and the covariance in
+  // `context`, and returns the updated discrete state.
+  std::unique_ptr<DiscreteValues<double>> Update(
+      const BatchedKalmanFilter<double>& filter, Context<double>* context) {
+    filter.SetEstimates(context, X_hat_);
+    filter.get_measurement_input_port().FixValue(context, y_);
+    filter.get_control_input_port().FixValue(context, u_);
+    auto updates = filter.AllocateDiscreteVariables();
+    filter.CalcDiscreteVariableUpdates(*context, updates.get());
+    return updates;
+  }
+
+  Matrix2d A_;
+  Vector2d B_;
+  Eigen::RowVector2d C_;
+  Vector1d D_;
+  std::unique_ptr<LinearSystem<double>> system_;
+  Matrix2d W_;
+  Vector1d V_;
+  Eigen::Matrix<double, 2, kNumFilters> X_hat_;
+  Eigen::Matrix<double, kNumFilters, 1> y_;
+  Eigen::Matrix<double, kNumFilters, 1> u_;
+};
+
+TEST_F(BatchedKalmanFilterTest, Ports) {
+  const BatchedKalmanFilter<double> filter(*system_, kNumFilters, W_, V_,
+                                           Matrix2d::Identity());
+  EXPECT_EQ(filter.num_filters(), kNumFilters);
+  EXPECT_TRUE(filter.is_time_varying());
+  EXPECT_EQ(filter.get_measurement_input_port().size(), kNumFilters);
+  EXPECT_EQ(filter.get_control_input_port().size(), kNumFilters);
+  EXPECT_EQ(filter.get_estimated_state_output_port().size(), 2 * kNumFilters);
+  EXPECT_FALSE(filter.HasAnyDirectFeedthrough());
+
+  auto context = filter.CreateDefaultContext();
+  filter.SetEstimates(context.get(), X_hat_);
+  EXPECT_TRUE(CompareMatrices(filter.GetEstimates(*context), X_hat_));
+  const VectorXd x_hat =
+      filter.get_estimated_state_output_port().Eval(*context);
+  EXPECT_TRUE(CompareMatrices(
+      x_hat, Eigen::Map<const VectorXd>(X_hat_.data(), X_hat_.size())));
+}
+
+TEST_F(BatchedKalmanFilterTest, ContinuousTimeSystemThrows) {
+  const LinearSystem<double> continuous(A_, B_, C_, D_);
+  EXPECT_THROW(BatchedKalmanFilter<double>(continuous, kNumFilters, W_, V_,
+                                           Matrix2d::Identity()),
+               std::exception);
+  EXPECT_THROW(BatchedKalmanFilter<double>(*system_, 0, W_, V_,
+                                           Matrix2d::Identity()),
+               std::exception);
+  EXPECT_THROW(BatchedKalmanFilter<double>(*system_, kNumFilters,
+                                           MatrixXd::Ones(2, 2)),
+               std::exception);
+}
+
+// Checks one update of the Kalman filters against the textbook equations,
+// filter by filter.
+TEST_F(BatchedKalmanFilterTest, TimeVaryingUpdate) {
+  Matrix2d P;
+  // clang-format off
+  P << 2.0, 0.5,
+       0.5, 1.0;
+  // clang-format on
+  const BatchedKalmanFilter<double> filter(*system_, kNumFilters, W_, V_, P);
+  auto context = filter.CreateDefaultContext();
+  EXPECT_TRUE(CompareMatrices(filter.GetCovariance(*context), P));
+  const auto updates = Update(filter, context.get());
+
+  const Vector2d K = P * C_.transpose() / (C_ * P * C_.transpose() + V_)(0);
+  const Vector2d L = A_ * K;
+  for (int i = 0; i < kNumFilters; ++i) {
+    const Vector2d x_hat = X_hat_.col(i);
+    const Vector2d expected = A_ * x_hat + B_ * u_(i) +
+                              L * (y_(i) - C_.dot(x_hat) - D_(0) * u_(i));
+    EXPECT_TRUE(CompareMatrices(
+        updates->get_vector(0).get_value().segment<2>(2 * i), expected,
+        1e-14));
+  }
+  const Matrix2d P_next = A_ * (P - K * C_ * P) * A_.transpose() + W_;
+  EXPECT_TRUE(CompareMatrices(
+      Eigen::Map<const Matrix2d>(updates->get_vector(1).get_value().data()),
+      P_next, 1e-14));
+}
+
+// Checks that the covariance converges to the solution of the discrete
+// algebraic Riccati equation.
+TEST_F(BatchedKalmanFilterTest, SteadyStateCovariance) {
+  const BatchedKalmanFilter<double> filter(*system_, kNumFilters, W_, V_,
+                                           Matrix2d::Identity());
+  auto context = filter.CreateDefaultContext();
+  filter.get_measurement_input_port().FixValue(context.get(), y_);
+  filter.get_control_input_port().FixValue(context.get(), u_);
+  auto updates = filter.AllocateDiscreteVariables();
+  for (int k = 0; k < 1000; ++k) {
+    filter.CalcDiscreteVariableUpdates(*context, updates.get());
+    context->get_mutable_discrete_state().SetFrom(*updates);
+  }
+  const MatrixXd P = math::DiscreteAlgebraicRiccatiEquation(
+      A_.transpose(), C_.transpose(), W_, V_);
+  EXPECT_TRUE(CompareMatrices(filter.GetCovariance(*context), P, 1e-10));
+}
+
+// Checks one update of the observers with a constant gain.
+TEST_F(BatchedKalmanFilterTest, LuenbergerUpdate) {
+  const Vector2d L(0.4, 0.2);
+  const BatchedKalmanFilter<double> filter(*system_, kNumFilters, L);
+  EXPECT_FALSE(filter.is_time_varying());
+  auto context = filter.CreateDefaultContext();
+  const auto updates = Update(filter, context.get());
+  for (int i = 0; i < kNumFilters; ++i) {
+    const Vector2d x_hat = X_hat_.col(i);
+    const Vector2d expected = A_ * x_hat + B_ * u_(i) +
+                              L * (y_(i) - C_.dot(x_hat) - D_(0) * u_(i));
+    EXPECT_TRUE(CompareMatrices(
+        updates->get_vector(0).get_value().segment<2>(2 * i), expected,
+        1e-14));
+  }
+}
+
+}  // namespace
+}  // namespace estimators
+}  // namespace systems
+}  // namespace drake
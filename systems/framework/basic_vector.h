@@ -97,8 +97,20 @@ class BasicVector : public VectorBase<T> {
     set_value(value);
   }
 
+  /// Replaces the entire vector with the contents of @p value, which is
+  /// copied directly into the contiguous storage of this vector.
+  void SetFrom(const VectorBase<T>& value) final {
+    value.CopyToPreSizedVector(&values_);
+  }
+
   VectorX<T> CopyToVector() const final { return values_; }
 
+  void CopyToPreSizedVector(EigenPtr<VectorX<T>> vec) const final {
+    DRAKE_THROW_UNLESS(vec != nullptr);
+    DRAKE_THROW_UNLESS(vec->rows() == size());
+    *vec = values_;
+  }
+
   void ScaleAndAddToVector(const T& scale,
                            EigenPtr<VectorX<T>> vec) const final {
     DRAKE_THROW_UNLESS(vec != nullptr);
@@ -132,6 +144,12 @@ class BasicVector : public VectorBase<T> {
     return values_[index];
   }
 
+  int DoGetNumContiguousSegments() const final { return 1; }
+
+  std::pair<const T*, int> DoGetContiguousSegment(int) const final {
+    return {values_.data(), size()};
+  }
+
   /// Returns a new BasicVector containing a copy of the entire vector.
   /// Caller must take ownership, and may rely on the NVI wrapper to initialize
   /// the clone elementwise.
@@ -24,7 +24,8 @@ void CacheEntryValue::ThrowIfBadCacheEntryValue(
   if (owning_subcontext && owning_subcontext_ != owning_subcontext) {
     throw std::logic_error(FormatName(__func__) + "wrong owning subcontext.");
   }
-  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0) {
+  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled |
+                  kProfilingIsEnabled)) != 0) {
     throw std::logic_error(FormatName(__func__) +
                            "flags value is out of range.");
   }
@@ -125,6 +126,21 @@ void Cache::SetAllEntriesOutOfDate() {
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::EnableProfiling() {
+  for (auto& entry : store_)
+    if (entry) entry->enable_profiling();
+}
+
+void Cache::DisableProfiling() {
+  for (auto& entry : store_)
+    if (entry) entry->disable_profiling();
+}
+
+void Cache::ResetProfilingStatistics() {
+  for (auto& entry : store_)
+    if (entry) entry->reset_profiling_statistics();
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -5,6 +5,7 @@ Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
@@ -334,7 +335,19 @@ class CacheEntryValue {
   is frozen. */
   bool needs_recomputation() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    return flags_ != kReadyToUse;
+    return (flags_ & (kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0;
+  }
+
+  /** (Advanced) Returns `true` if the stored value can be returned by Eval()
+  with no further work: it is up to date, caching is enabled for this entry,
+  and profiling is disabled. This is the _very_ fast inline check that Eval()
+  performs; if it fails, Eval() takes a slower path that recomputes the value
+  if needs_recomputation() and records statistics if is_profiling_enabled().
+  Don't call this if there is no value here; use has_value() if you aren't
+  sure. */
+  bool is_ready_to_use() const {
+    DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
+    return flags_ == kReadyToUse;
   }
 
   /** (Advanced) Marks the cache entry value as up to date with respect to
@@ -451,6 +464,69 @@ class CacheEntryValue {
   }
   //@}
 
+  /** @name                  Profiling utilities
+  These are used to find out which cache entries are recomputed too often or
+  are expensive to compute. Usually profiling is enabled for a whole Context
+  using ContextBase::EnableCacheProfiling(), which also provides a report of
+  the statistics. While profiling is enabled, every Eval() of the
+  corresponding entry is counted either as a hit (the stored value was
+  returned) or as an evaluation (Calc() was invoked), the wall clock time
+  spent in Calc() is accumulated, and every invalidation of an up-to-date value
+  is attributed to the prerequisite whose change caused it. Profiling does not
+  affect the values computed, but it does make Eval() somewhat slower. */
+  //@{
+
+  /** (Debugging) Enables profiling for this cache entry value. The statistics
+  gathered so far are retained; see reset_profiling_statistics(). */
+  void enable_profiling() {
+    flags_ |= kProfilingIsEnabled;
+  }
+
+  /** (Debugging) Disables profiling for this cache entry value. The statistics
+  gathered so far are retained. */
+  void disable_profiling() {
+    flags_ &= ~kProfilingIsEnabled;
+  }
+
+  /** Returns `true` if profiling is enabled for this cache entry value. */
+  bool is_profiling_enabled() const {
+    return (flags_ & kProfilingIsEnabled) != 0;
+  }
+
+  /** Returns the number of profiled Eval() calls that returned the stored
+  value without recomputing it. */
+  int64_t num_hits() const { return profile_.num_hits; }
+
+  /** Returns the number of profiled Eval() calls that invoked Calc(). */
+  int64_t num_evaluations() const { return profile_.num_evaluations; }
+
+  /** Returns the number of times a prerequisite change invalidated this value
+  while it was up to date (and profiling was enabled). Invalidations of a value
+  that was already out of date are not counted since they cannot cause
+  additional recomputation. */
+  int64_t num_invalidations() const { return profile_.num_invalidations; }
+
+  /** Returns the cumulative wall clock time, in seconds, spent in the profiled
+  evaluations of this value. This includes the time spent evaluating any
+  out-of-date prerequisites from within Calc(). */
+  double cumulative_calc_time() const { return profile_.calc_time; }
+
+  /** Returns the number of times each prerequisite invalidated this value (as
+  counted in num_invalidations()), keyed by the prerequisite's ticket. The
+  prerequisites' DependencyTracker objects are in the same subcontext as this
+  %CacheEntryValue. */
+  const std::map<DependencyTicket, int64_t>&
+  invalidations_by_prerequisite() const {
+    return profile_.invalidations_by_prerequisite;
+  }
+
+  /** (Debugging) Zeroes all the profiling statistics of this cache entry value.
+  This has no effect on whether profiling is enabled. */
+  void reset_profiling_statistics() {
+    profile_ = ProfilingStatistics{};
+  }
+  //@}
+
 #ifndef DRAKE_DOXYGEN_CXX
   // (Internal use only) Returns a mutable reference to an unused cache entry
   // value object, which has no valid CacheIndex or DependencyTicket and has a
@@ -465,6 +541,21 @@ class CacheEntryValue {
     static never_destroyed<CacheEntryValue> dummy;
     return dummy.access();
   }
+
+  // (Internal use only) These record profiling events; they should be invoked
+  // only if is_profiling_enabled(). An invalidation is recorded only if the
+  // value is currently up to date, so this must be called _before_ marking the
+  // value out of date.
+  void record_hit() { ++profile_.num_hits; }
+  void record_evaluation(double calc_time) {
+    ++profile_.num_evaluations;
+    profile_.calc_time += calc_time;
+  }
+  void record_invalidation(DependencyTicket prerequisite) {
+    if ((flags_ & kValueIsOutOfDate) != 0) return;
+    ++profile_.num_invalidations;
+    ++profile_.invalidations_by_prerequisite[prerequisite];
+  }
 #endif
 
  private:
@@ -598,12 +689,23 @@ class CacheEntryValue {
   }
 
   // The sense of these flag bits is chosen so that Eval() can check in a single
-  // instruction whether it must recalculate. Only if flags==0 (kReadyToUse) can
-  // we reuse the existing value. See needs_recomputation() above.
+  // instruction whether it must do anything besides returning the existing
+  // value. Only if flags==0 (kReadyToUse) can we reuse the existing value
+  // without further ado. See is_ready_to_use() above.
   enum Flags : int {
-    kReadyToUse           = 0b00,
-    kValueIsOutOfDate     = 0b01,
-    kCacheEntryIsDisabled = 0b10
+    kReadyToUse           = 0b000,
+    kValueIsOutOfDate     = 0b001,
+    kCacheEntryIsDisabled = 0b010,
+    kProfilingIsEnabled   = 0b100
+  };
+
+  // Statistics gathered while profiling is enabled.
+  struct ProfilingStatistics {
+    int64_t num_hits{0};
+    int64_t num_evaluations{0};
+    int64_t num_invalidations{0};
+    double calc_time{0.0};
+    std::map<DependencyTicket, int64_t> invalidations_by_prerequisite;
   };
 
   // The index for this CacheEntryValue within its containing subcontext.
@@ -628,6 +730,9 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Performance statistics. These do not change behavior at all.
+  ProfilingStatistics profile_;
 };
 
 //==============================================================================
@@ -732,6 +837,20 @@ class Cache {
   normal caching behavior resumes. */
   void SetAllEntriesOutOfDate();
 
+  /** (Debugging) Enables profiling for all entries in this %Cache.
+  @see ContextBase::EnableCacheProfiling() for the user-facing API */
+  void EnableProfiling();
+
+  /** (Debugging) Disables profiling for all entries in this %Cache. The
+  statistics gathered so far are retained.
+  @see ContextBase::DisableCacheProfiling() for the user-facing API */
+  void DisableProfiling();
+
+  /** (Debugging) Zeroes the profiling statistics of all entries in this
+  %Cache.
+  @see ContextBase::ResetCacheProfilingStatistics() for the user-facing API */
+  void ResetProfilingStatistics();
+
   /** (Advanced) Sets the "is frozen" flag. Cache entry values should check this
   before permitting mutable access to values.
   @see ContextBase::FreezeCache() for the user-facing API */
@@ -1,11 +1,13 @@
 #include "drake/systems/framework/cache_entry.h"
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <typeinfo>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/systems/framework/system_profiler.h"
 
 namespace drake {
 namespace systems {
@@ -49,9 +51,30 @@ void CacheEntry::Calc(const ContextBase& context,
   DRAKE_ASSERT_VOID(owning_system_->ThrowIfContextNotCompatible(context));
   DRAKE_ASSERT_VOID(CheckValidAbstractValue(*value));
 
+  internal::SystemProfilerScope profile(
+      *owning_system_, SystemProfilingCategory::kCacheEntry, &description_);
   calc_function_(context, value);
 }
 
+void CacheEntry::UpdateValueWithProfiling(
+    const ContextBase& context, CacheEntryValue* cache_value) const {
+  if (!cache_value->needs_recomputation()) {
+    // A frozen cache may be read by several threads at once, so its hits go
+    // unrecorded rather than racing on the counter.
+    if (!context.is_cache_frozen()) cache_value->record_hit();
+    return;
+  }
+  AbstractValue& value = cache_value->GetMutableAbstractValueOrThrow();
+  const auto start = std::chrono::steady_clock::now();
+  // If Calc() throws a recoverable exception, the cache remains out of date and
+  // the failed evaluation is not recorded.
+  Calc(context, &value);
+  const std::chrono::duration<double> calc_time =
+      std::chrono::steady_clock::now() - start;
+  cache_value->mark_up_to_date();
+  cache_value->record_evaluation(calc_time.count());
+}
+
 // See OutputPort::CheckValidOutputType; treat both methods similarly.
 void CacheEntry::CheckValidAbstractValue(const AbstractValue& proposed) const {
   // TODO(sherm1) Consider whether we can depend on there already being an
@@ -160,7 +160,7 @@ class CacheEntry {
   // called *a lot*.
   const AbstractValue& EvalAbstract(const ContextBase& context) const {
     const CacheEntryValue& cache_value = get_cache_entry_value(context);
-    if (cache_value.needs_recomputation()) UpdateValue(context);
+    if (!cache_value.is_ready_to_use()) UpdateValue(context);
     return cache_value.get_abstract_value();
   }
 
@@ -271,19 +271,29 @@ class CacheEntry {
   DependencyTicket ticket() const { return ticket_; }
 
  private:
-  // Unconditionally update the cache value, which has already been determined
-  // to be in need of recomputation (either because it is out of date or
-  // because caching was disabled).
+  // Update the cache value, which has already been determined to be in need
+  // of recomputation (either because it is out of date or because caching was
+  // disabled) or of profiling bookkeeping.
   void UpdateValue(const ContextBase& context) const {
     // We can get a mutable cache entry value from a const context.
     CacheEntryValue& mutable_cache_value =
         get_mutable_cache_entry_value(context);
+    if (mutable_cache_value.is_profiling_enabled()) {
+      UpdateValueWithProfiling(context, &mutable_cache_value);
+      return;
+    }
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
     Calc(context, &value);
     mutable_cache_value.mark_up_to_date();
   }
 
+  // Same as UpdateValue() but records a hit if the value did not need to be
+  // recomputed, and otherwise the time spent in Calc(). Not inline since
+  // profiling is rarely enabled.
+  void UpdateValueWithProfiling(const ContextBase& context,
+                                CacheEntryValue* cache_value) const;
+
   // The value was unexpectedly out of date. Issue a helpful message.
   void ThrowOutOfDate(const char* api) const {
     throw std::logic_error(FormatName(api) + "value out of date.");
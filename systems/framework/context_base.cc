@@ -1,13 +1,51 @@
 #include "drake/systems/framework/context_base.h"
 
 #include <string>
+#include <tuple>
 #include <typeinfo>
 
+#include <fmt/format.h>
+
 #include "drake/common/unused.h"
 
 namespace drake {
 namespace systems {
 
+namespace {
+
+// Quotes a CSV field if it contains any character that requires it.
+std::string CsvField(const std::string& field) {
+  if (field.find_first_of(",\"\n") == std::string::npos) return field;
+  std::string quoted = "\"";
+  for (char c : field) {
+    if (c == '"') quoted += '"';
+    quoted += c;
+  }
+  return quoted + "\"";
+}
+
+// Returns a JSON string literal for `text`.
+std::string JsonString(const std::string& text) {
+  std::string quoted = "\"";
+  for (char c : text) {
+    switch (c) {
+      case '"': quoted += "\\\""; break;
+      case '\\': quoted += "\\\\"; break;
+      case '\n': quoted += "\\n"; break;
+      case '\t': quoted += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          quoted += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          quoted += c;
+        }
+    }
+  }
+  return quoted + "\"";
+}
+
+}  // namespace
+
 std::unique_ptr<ContextBase> ContextBase::Clone() const {
   std::unique_ptr<ContextBase> clone_ptr(CloneWithoutPointers(*this));
   ContextBase& clone = *clone_ptr;
@@ -31,6 +69,140 @@ std::string ContextBase::GetSystemPathname() const {
          GetSystemName();
 }
 
+void ContextBase::FlattenInvalidation() const {
+  std::vector<const ContextBase*> contexts;
+  CollectContexts(*this, &contexts);
+  for (const ContextBase* context : contexts) {
+    const DependencyGraph& graph = context->get_dependency_graph();
+    for (DependencyTicket ticket(0); ticket < graph.trackers_size(); ++ticket) {
+      if (graph.has_tracker(ticket))
+        graph.get_tracker(ticket).FlattenInvalidation();
+    }
+  }
+}
+
+void ContextBase::UnflattenInvalidation() const {
+  std::vector<const ContextBase*> contexts;
+  CollectContexts(*this, &contexts);
+  for (const ContextBase* context : contexts) {
+    const DependencyGraph& graph = context->get_dependency_graph();
+    for (DependencyTicket ticket(0); ticket < graph.trackers_size(); ++ticket) {
+      if (graph.has_tracker(ticket))
+        graph.get_tracker(ticket).DiscardFlattenedInvalidation();
+    }
+  }
+}
+
+std::string ContextBase::GetCacheProfilingReport(
+    CacheProfilingReportFormat format) const {
+  struct Edge {
+    std::string prerequisite;
+    std::string entry;
+    int64_t count{};
+  };
+  std::vector<const ContextBase*> contexts;
+  CollectContexts(*this, &contexts);
+  std::vector<const CacheEntryValue*> entries;
+  std::vector<Edge> edges;
+  for (const ContextBase* context : contexts) {
+    const Cache& cache = context->get_cache();
+    for (CacheIndex i(0); i < cache.cache_size(); ++i) {
+      if (!cache.has_cache_entry_value(i)) continue;
+      const CacheEntryValue& value = cache.get_cache_entry_value(i);
+      if (value.num_hits() == 0 && value.num_evaluations() == 0 &&
+          value.num_invalidations() == 0) {
+        continue;
+      }
+      entries.push_back(&value);
+      for (const auto& ticket_and_count :
+           value.invalidations_by_prerequisite()) {
+        edges.push_back(Edge{
+            context->get_tracker(ticket_and_count.first).GetPathDescription(),
+            value.GetPathDescription(), ticket_and_count.second});
+      }
+    }
+  }
+  // Most expensive entries first, most invalidating edges first; ties are
+  // broken so that the order is repeatable.
+  std::sort(entries.begin(), entries.end(),
+            [](const CacheEntryValue* a, const CacheEntryValue* b) {
+              return std::make_tuple(-a->cumulative_calc_time(),
+                                     -a->num_evaluations(),
+                                     a->GetPathDescription()) <
+                     std::make_tuple(-b->cumulative_calc_time(),
+                                     -b->num_evaluations(),
+                                     b->GetPathDescription());
+            });
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::tie(b.count, a.entry, a.prerequisite) <
+           std::tie(a.count, b.entry, b.prerequisite);
+  });
+
+  std::string report;
+  switch (format) {
+    case CacheProfilingReportFormat::kText: {
+      report += "Cache entries by cumulative calc time:\n";
+      report += fmt::format("{:>14} {:>12} {:>12} {:>14}  {}\n",
+                            "calc time (s)", "evaluations", "hits",
+                            "invalidations", "cache entry");
+      for (const CacheEntryValue* value : entries) {
+        report += fmt::format("{:>14.6f} {:>12} {:>12} {:>14}  {}\n",
+                              value->cumulative_calc_time(),
+                              value->num_evaluations(), value->num_hits(),
+                              value->num_invalidations(),
+                              value->GetPathDescription());
+      }
+      report += "Dependency edges by number of invalidations:\n";
+      report += fmt::format("{:>14}  {}\n", "invalidations",
+                            "prerequisite -> cache entry");
+      for (const Edge& edge : edges) {
+        report += fmt::format("{:>14}  {} -> {}\n", edge.count,
+                              edge.prerequisite, edge.entry);
+      }
+      break;
+    }
+    case CacheProfilingReportFormat::kCsv: {
+      report += "kind,cache_entry,prerequisite,calc_time,evaluations,hits,"
+                "invalidations\n";
+      for (const CacheEntryValue* value : entries) {
+        report += fmt::format("entry,{},,{},{},{},{}\n",
+                              CsvField(value->GetPathDescription()),
+                              value->cumulative_calc_time(),
+                              value->num_evaluations(), value->num_hits(),
+                              value->num_invalidations());
+      }
+      for (const Edge& edge : edges) {
+        report += fmt::format("edge,{},{},,,,{}\n", CsvField(edge.entry),
+                              CsvField(edge.prerequisite), edge.count);
+      }
+      break;
+    }
+    case CacheProfilingReportFormat::kJson: {
+      report += "{\"entries\": [";
+      for (size_t i = 0; i < entries.size(); ++i) {
+        const CacheEntryValue& value = *entries[i];
+        report += fmt::format(
+            "{}\n  {{\"cache_entry\": {}, \"calc_time\": {}, "
+            "\"evaluations\": {}, \"hits\": {}, \"invalidations\": {}}}",
+            i == 0 ? "" : ",", JsonString(value.GetPathDescription()),
+            value.cumulative_calc_time(), value.num_evaluations(),
+            value.num_hits(), value.num_invalidations());
+      }
+      report += "],\n\"edges\": [";
+      for (size_t i = 0; i < edges.size(); ++i) {
+        report += fmt::format(
+            "{}\n  {{\"prerequisite\": {}, \"cache_entry\": {}, "
+            "\"invalidations\": {}}}",
+            i == 0 ? "" : ",", JsonString(edges[i].prerequisite),
+            JsonString(edges[i].entry), edges[i].count);
+      }
+      report += "]}\n";
+      break;
+    }
+  }
+  return report;
+}
+
 FixedInputPortValue& ContextBase::FixInputPort(
     int index, std::unique_ptr<AbstractValue> value) {
   std::unique_ptr<FixedInputPortValue> fixed =
@@ -25,6 +25,14 @@ class SystemBaseContextBaseAttorney;
 }  // namespace internal
 #endif
 
+/** The formats of the report produced by
+ContextBase::GetCacheProfilingReport(). */
+enum class CacheProfilingReportFormat {
+  kText,  ///< Aligned columns meant to be read by a human.
+  kCsv,   ///< Comma-separated values, one row per cache entry or edge.
+  kJson,  ///< A JSON object with arrays of cache entries and edges.
+};
+
 /** Provides non-templatized Context functionality shared by the templatized
 derived classes. That includes caching, dependency tracking, and management
 of local values for fixed input ports.
@@ -95,7 +103,15 @@ class ContextBase : public internal::ContextMessageInterface {
   causes an exception to be throw. This is applied recursively to this
   %Context and all its subcontexts, but _not_ to its parent or siblings so
   it is most useful when called on the root %Context. If the cache was already
-  frozen this method does nothing but waste a little time. */
+  frozen this method does nothing but waste a little time.
+
+  A frozen %Context may be read by several threads at once: while the cache is
+  frozen and the %Context is not modified, `Eval()` of an up-to-date cache entry
+  or output port, and of an input port, only reads the %Context (cache
+  profiling statistics are not updated), and `Eval()` of an out-of-date entry
+  throws rather than computing it. Use
+  SystemBase::FreezeCacheForConcurrentEvaluation() to bring every cache entry
+  up to date before freezing. Nothing else about a %Context is thread safe. */
   void FreezeCache() const {
     PropagateCachingChange(*this, &Cache::freeze_cache);
   }
@@ -108,6 +124,68 @@ class ContextBase : public internal::ContextMessageInterface {
     PropagateCachingChange(*this, &Cache::unfreeze_cache);
   }
 
+  /** (Advanced) Flattens the dependency trackers of this %Context and all its
+  subcontexts (and, with them, those downstream in other subcontexts): each
+  precomputes the list of the cache entries downstream of it, so that a value
+  change (e.g., setting q) marks them out of date in a single linear sweep
+  instead of notifying the trackers in between recursively. This is most
+  useful when called on the root %Context once it has been allocated and its
+  input ports fixed. The results are identical either way, except that the
+  statistics of the trackers in between are no longer updated (see
+  DependencyTracker::FlattenInvalidation()). A change to the dependency graph
+  afterwards, e.g., fixing an input port that wasn't, reverts the affected
+  trackers to recursive notification. Cloning a %Context does not preserve the
+  flattening. */
+  void FlattenInvalidation() const;
+
+  /** (Advanced) Reverts the dependency trackers of this %Context and all its
+  subcontexts (and those upstream of them) to recursive notification, and
+  releases their flattened lists. See FlattenInvalidation(). */
+  void UnflattenInvalidation() const;
+
+  /** (Debugging) Enables cache profiling recursively for this context and all
+  its subcontexts. While profiling is enabled, each cache entry value counts
+  its hits, evaluations, and invalidations, accumulates the time spent
+  computing it, and attributes each invalidation to the DependencyTracker
+  edge (prerequisite) that caused it. Results are unaffected but `Eval()`
+  becomes somewhat slower. Statistics gathered earlier are retained; use
+  ResetCacheProfilingStatistics() to start afresh.
+  @see GetCacheProfilingReport() */
+  void EnableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::EnableProfiling);
+  }
+
+  /** (Debugging) Disables cache profiling recursively for this context and all
+  its subcontexts. The statistics gathered so far are retained. */
+  void DisableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::DisableProfiling);
+  }
+
+  /** (Debugging) Zeroes the cache profiling statistics recursively for this
+  context and all its subcontexts, but does not change whether profiling is
+  enabled. */
+  void ResetCacheProfilingStatistics() const {
+    PropagateCachingChange(*this, &Cache::ResetProfilingStatistics);
+  }
+
+  /** (Debugging) Returns a report of the cache profiling statistics of this
+  context and all its subcontexts, as gathered while profiling was enabled
+  (see EnableCacheProfiling()). The report lists
+  - every cache entry that was evaluated or invalidated, sorted by decreasing
+    cumulative computation time, with its numbers of evaluations (cache
+    misses), hits, and invalidations; and
+  - every dependency edge, from a prerequisite DependencyTracker to a cache
+    entry, that invalidated an up-to-date value, sorted by decreasing number of
+    such invalidations. These are the edges that caused the most
+    recomputation.
+
+  Cache entries are identified by their path descriptions (see
+  CacheEntryValue::GetPathDescription()) and prerequisites by those of their
+  trackers. Times are in seconds. */
+  std::string GetCacheProfilingReport(
+      CacheProfilingReportFormat format =
+          CacheProfilingReportFormat::kText) const;
+
   /** (Advanced) Reports whether this %Context's cache is currently frozen.
   This checks only locally; it is possible that parent, child, or sibling
   subcontext caches are in a different state than this one. */
@@ -501,6 +579,17 @@ class ContextBase : public internal::ContextMessageInterface {
     context.DoPropagateCachingChange(caching_change);
   }
 
+  /** (Internal use only) Appends `context` and, if it is a DiagramContext, all
+  of its subcontexts (recursively) to `contexts`, in depth-first order. */
+  // Structuring this as a static method allows DiagramContext to invoke this
+  // protected method on its children.
+  static void CollectContexts(const ContextBase& context,
+                              std::vector<const ContextBase*>* contexts) {
+    DRAKE_DEMAND(contexts != nullptr);
+    contexts->push_back(&context);
+    context.DoPropagateCollectContexts(contexts);
+  }
+
   /** (Internal use only) Applies the given bulk-change notification method
   to the given `context`, and propagates the notification to subcontexts if this
   is a DiagramContext. */
@@ -569,6 +658,14 @@ class ContextBase : public internal::ContextMessageInterface {
     unused(caching_change);
   }
 
+  /** DiagramContext must implement this to invoke CollectContexts() on each of
+  its subcontexts. The default implementation does nothing which is fine for a
+  LeafContext. */
+  virtual void DoPropagateCollectContexts(
+      std::vector<const ContextBase*>* contexts) const {
+    unused(contexts);
+  }
+
   /** DiagramContext must implement this to invoke PropagateBulkChange()
   on its subcontexts, passing along the indicated method that specifies the
   particular bulk change (e.g. whole state, all parameters, all discrete state
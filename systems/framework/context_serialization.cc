@@ -0,0 +1,330 @@
+#include "drake/systems/framework/context_serialization.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/systems/framework/basic_vector.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The first word of a snapshot: "DRKCTX" and the format version.
+constexpr char kMagic[8] = {'D', 'R', 'K', 'C', 'T', 'X', 0, 1};
+
+// The tags of the supported abstract value types.
+enum class AbstractTag : int64_t {
+  kDouble = 1,
+  kInt = 2,
+  kBool = 3,
+  kString = 4,
+  kVectorXd = 5,
+  kBasicVector = 6,
+};
+
+// Appends 8-byte words to a snapshot.
+class Writer {
+ public:
+  explicit Writer(std::vector<uint8_t>* out) : out_(out) {}
+
+  void WriteBytes(const void* data, size_t size) {
+    const size_t start = out_->size();
+    // Pads to a whole number of words with zeros.
+    out_->resize(start + (size + 7) / 8 * 8, 0);
+    if (size > 0) std::memcpy(out_->data() + start, data, size);
+  }
+
+  void WriteInt(int64_t value) { WriteBytes(&value, sizeof(value)); }
+
+  void WriteDouble(double value) { WriteBytes(&value, sizeof(value)); }
+
+  void WriteVector(const Eigen::Ref<const Eigen::VectorXd>& values) {
+    WriteInt(values.size());
+    WriteBytes(values.data(), values.size() * sizeof(double));
+  }
+
+  void WriteAbstractValue(const AbstractValue& value) {
+    if (const double* d = value.maybe_get_value<double>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kDouble));
+      WriteDouble(*d);
+    } else if (const int* i = value.maybe_get_value<int>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kInt));
+      WriteInt(*i);
+    } else if (const bool* b = value.maybe_get_value<bool>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kBool));
+      WriteInt(*b ? 1 : 0);
+    } else if (const std::string* s = value.maybe_get_value<std::string>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kString));
+      WriteInt(static_cast<int64_t>(s->size()));
+      WriteBytes(s->data(), s->size());
+    } else if (const Eigen::VectorXd* v =
+                   value.maybe_get_value<Eigen::VectorXd>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kVectorXd));
+      WriteVector(*v);
+    } else if (const BasicVector<double>* bv =
+                   value.maybe_get_value<BasicVector<double>>()) {
+      WriteInt(static_cast<int64_t>(AbstractTag::kBasicVector));
+      WriteVector(bv->get_value());
+    } else {
+      throw std::logic_error(fmt::format(
+          "SerializeContext(): abstract values of type {} are not supported",
+          value.GetNiceTypeName()));
+    }
+  }
+
+ private:
+  std::vector<uint8_t>* const out_;
+};
+
+// Reads the 8-byte words of a snapshot, checking its bounds.
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  // Returns a pointer to the next `size` bytes, and skips them along with
+  // their padding.
+  const uint8_t* ReadBytes(size_t size) {
+    const size_t padded = (size + 7) / 8 * 8;
+    if (padded > size_ - offset_) {
+      throw std::runtime_error("DeserializeContext(): truncated snapshot");
+    }
+    const uint8_t* const result = data_ + offset_;
+    offset_ += padded;
+    return result;
+  }
+
+  int64_t ReadInt() {
+    int64_t value;
+    std::memcpy(&value, ReadBytes(sizeof(value)), sizeof(value));
+    return value;
+  }
+
+  double ReadDouble() {
+    double value;
+    std::memcpy(&value, ReadBytes(sizeof(value)), sizeof(value));
+    return value;
+  }
+
+  // Returns a view of the next vector, in place, after checking that it has
+  // `expected_size` elements.
+  Eigen::Map<const Eigen::VectorXd> ReadVector(int64_t expected_size,
+                                               const char* what) {
+    const int64_t size = ReadInt();
+    if (size != expected_size) {
+      throw std::runtime_error(fmt::format(
+          "DeserializeContext(): the snapshot has {} {} but the context has "
+          "{}", size, what, expected_size));
+    }
+    const uint8_t* const bytes = ReadBytes(size * sizeof(double));
+    return Eigen::Map<const Eigen::VectorXd>(
+        reinterpret_cast<const double*>(bytes), size);
+  }
+
+  // Checks the next value, a count, against `expected`.
+  void ReadCount(int64_t expected, const char* what) {
+    const int64_t count = ReadInt();
+    if (count != expected) {
+      throw std::runtime_error(fmt::format(
+          "DeserializeContext(): the snapshot has {} {} but the context has "
+          "{}", count, what, expected));
+    }
+  }
+
+  void ReadAbstractValue(AbstractValue* value) {
+    const AbstractTag tag = static_cast<AbstractTag>(ReadInt());
+    switch (tag) {
+      case AbstractTag::kDouble:
+        value->get_mutable_value<double>() = ReadDouble();
+        return;
+      case AbstractTag::kInt:
+        value->get_mutable_value<int>() = static_cast<int>(ReadInt());
+        return;
+      case AbstractTag::kBool:
+        value->get_mutable_value<bool>() = ReadInt() != 0;
+        return;
+      case AbstractTag::kString: {
+        std::string& s = value->get_mutable_value<std::string>();
+        const int64_t size = ReadInt();
+        if (size < 0) break;
+        const uint8_t* const bytes = ReadBytes(size);
+        s.assign(reinterpret_cast<const char*>(bytes), size);
+        return;
+      }
+      case AbstractTag::kVectorXd: {
+        Eigen::VectorXd& v = value->get_mutable_value<Eigen::VectorXd>();
+        const int64_t size = ReadInt();
+        if (size < 0) break;
+        const uint8_t* const bytes = ReadBytes(size * sizeof(double));
+        v = Eigen::Map<const Eigen::VectorXd>(
+            reinterpret_cast<const double*>(bytes), size);
+        return;
+      }
+      case AbstractTag::kBasicVector: {
+        BasicVector<double>& v =
+            value->get_mutable_value<BasicVector<double>>();
+        v.SetFromVector(ReadVector(v.size(), "vector elements"));
+        return;
+      }
+    }
+    throw std::runtime_error(
+        "DeserializeContext(): corrupted abstract value in snapshot");
+  }
+
+  bool at_end() const { return offset_ == size_; }
+
+ private:
+  const uint8_t* const data_;
+  const size_t size_;
+  size_t offset_{0};
+};
+
+}  // namespace
+
+std::vector<uint8_t> SerializeContext(const Context<double>& context) {
+  std::vector<uint8_t> snapshot;
+  Writer writer(&snapshot);
+  writer.WriteBytes(kMagic, sizeof(kMagic));
+  writer.WriteDouble(context.get_time());
+  // NaN stands for no accuracy.
+  writer.WriteDouble(context.get_accuracy().value_or(
+      std::numeric_limits<double>::quiet_NaN()));
+
+  writer.WriteVector(context.get_continuous_state_vector().CopyToVector());
+
+  writer.WriteInt(context.num_discrete_state_groups());
+  for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+    writer.WriteVector(context.get_discrete_state(i).get_value());
+  }
+
+  writer.WriteInt(context.num_abstract_states());
+  for (int i = 0; i < context.num_abstract_states(); ++i) {
+    writer.WriteAbstractValue(context.get_abstract_state().get_value(i));
+  }
+
+  writer.WriteInt(context.num_numeric_parameter_groups());
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    writer.WriteVector(context.get_numeric_parameter(i).get_value());
+  }
+
+  writer.WriteInt(context.num_abstract_parameters());
+  for (int i = 0; i < context.num_abstract_parameters(); ++i) {
+    writer.WriteAbstractValue(context.get_abstract_parameter(i));
+  }
+  return snapshot;
+}
+
+void DeserializeContext(const uint8_t* data, size_t size,
+                        Context<double>* context) {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(data != nullptr || size == 0);
+  DRAKE_THROW_UNLESS(reinterpret_cast<uintptr_t>(data) % 8 == 0);
+  Reader reader(data, size);
+  if (size < sizeof(kMagic) ||
+      std::memcmp(reader.ReadBytes(sizeof(kMagic)), kMagic, sizeof(kMagic)) !=
+          0) {
+    throw std::runtime_error(
+        "DeserializeContext(): not a context snapshot (or of another version)");
+  }
+  const double time = reader.ReadDouble();
+  const double accuracy = reader.ReadDouble();
+
+  const auto xc = reader.ReadVector(context->num_continuous_states(),
+                                    "continuous state variables");
+
+  reader.ReadCount(context->num_discrete_state_groups(),
+                   "discrete state groups");
+  for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+    BasicVector<double>& xd = context->get_mutable_discrete_state(i);
+    xd.SetFromVector(reader.ReadVector(xd.size(), "discrete state variables"));
+  }
+
+  reader.ReadCount(context->num_abstract_states(), "abstract states");
+  for (int i = 0; i < context->num_abstract_states(); ++i) {
+    reader.ReadAbstractValue(
+        &context->get_mutable_abstract_state().get_mutable_value(i));
+  }
+
+  reader.ReadCount(context->num_numeric_parameter_groups(),
+                   "numeric parameter groups");
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    BasicVector<double>& p = context->get_mutable_numeric_parameter(i);
+    p.SetFromVector(reader.ReadVector(p.size(), "numeric parameters"));
+  }
+
+  reader.ReadCount(context->num_abstract_parameters(), "abstract parameters");
+  for (int i = 0; i < context->num_abstract_parameters(); ++i) {
+    reader.ReadAbstractValue(&context->get_mutable_abstract_parameter(i));
+  }
+
+  if (!reader.at_end()) {
+    throw std::runtime_error(
+        "DeserializeContext(): unexpected data at the end of the snapshot");
+  }
+
+  context->SetTimeAndContinuousState(time, xc);
+  context->SetAccuracy(std::isnan(accuracy) ? nullopt
+                                            : optional<double>(accuracy));
+}
+
+void DeserializeContext(const std::vector<uint8_t>& snapshot,
+                        Context<double>* context) {
+  DeserializeContext(snapshot.data(), snapshot.size(), context);
+}
+
+void SaveContextSnapshot(const Context<double>& context,
+                         const std::string& filename) {
+  const std::vector<uint8_t> snapshot = SerializeContext(context);
+  std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+  if (!out.good()) {
+    throw std::runtime_error(
+        fmt::format("Failed to write context snapshot {}", filename));
+  }
+}
+
+void LoadContextSnapshot(const std::string& filename,
+                         Context<double>* context) {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format("Failed to open context snapshot {}: {}",
+                                         filename, std::strerror(errno)));
+  }
+  struct stat file_stat{};
+  if (::fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    ::close(fd);
+    throw std::runtime_error(
+        fmt::format("Failed to read context snapshot {}", filename));
+  }
+  const size_t size = static_cast<size_t>(file_stat.st_size);
+  void* const mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the file is closed.
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error(fmt::format("Failed to map context snapshot {}: {}",
+                                         filename, std::strerror(errno)));
+  }
+  try {
+    DeserializeContext(static_cast<const uint8_t*>(mapped), size, context);
+  } catch (...) {
+    ::munmap(mapped, size);
+    throw;
+  }
+  ::munmap(mapped, size);
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,62 @@
+#pragma once
+
+/** @file
+Provides a compact binary serialization of the time, accuracy, state and
+parameters of a Context, for checkpointing and restoring simulations. */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** Serializes the time, accuracy, continuous state, discrete state, abstract
+state, numeric parameters and abstract parameters of `context` (which may be
+a DiagramContext) into a compact binary snapshot. Input port values and cached
+computations are not part of the snapshot.
+
+The snapshot is a flat sequence of 8-byte words in the native byte order, so
+that it can be memory mapped and read in place (see DeserializeContext()): a
+header, then each vector as its size followed by its elements. It can only be
+restored into a context of the same System (or an identically built one).
+
+Abstract values are supported for the types `double`, `int`, `bool`,
+`std::string`, `Eigen::VectorXd` and `BasicVector<double>`.
+@throws std::exception if `context` has an abstract state or parameter of any
+other type. */
+std::vector<uint8_t> SerializeContext(const Context<double>& context);
+
+/** Restores into `context` the time, accuracy, state and parameters stored in
+the `size` bytes of `data` by SerializeContext(). `data` must be 8-byte
+aligned, as is the memory returned by `new`, `malloc()` or `mmap()`.
+@throws std::exception if the snapshot is truncated or corrupted, or if its
+layout (the numbers and sizes of the state and parameter groups, and the
+types of the abstract values) does not match that of `context`. In that case
+`context` may be partially modified. */
+void DeserializeContext(const uint8_t* data, size_t size,
+                        Context<double>* context);
+
+/** Overload of DeserializeContext() for a snapshot held in a vector. */
+void DeserializeContext(const std::vector<uint8_t>& snapshot,
+                        Context<double>* context);
+
+/** Writes the snapshot of `context` made by SerializeContext() to the file
+named `filename`, replacing it if it exists.
+@throws std::exception if the file cannot be written. */
+void SaveContextSnapshot(const Context<double>& context,
+                         const std::string& filename);
+
+/** Restores into `context` the snapshot saved in the file named `filename` by
+SaveContextSnapshot(). The file is memory mapped rather than read into a
+buffer.
+@throws std::exception if the file cannot be read, or for the reasons listed
+in DeserializeContext(). */
+void LoadContextSnapshot(const std::string& filename,
+                         Context<double>* context);
+
+}  // namespace systems
+}  // namespace drake
@@ -220,6 +220,17 @@ class ContinuousState {
         scalar_conversion::ValueConverter<T, U>{}));
   }
 
+  /// Copies the values from `other` into `this`. Since no scalar conversion
+  /// is needed, the values are copied vector to vector (e.g., leaf by leaf
+  /// for a Diagram's state), without any intermediate copy.
+  void SetFrom(const ContinuousState<T>& other) {
+    DRAKE_THROW_UNLESS(size() == other.size());
+    DRAKE_THROW_UNLESS(num_q() == other.num_q());
+    DRAKE_THROW_UNLESS(num_v() == other.num_v());
+    DRAKE_THROW_UNLESS(num_z() == other.num_z());
+    this->get_mutable_vector().SetFrom(other.get_vector());
+  }
+
   /// Sets the entire continuous state vector from an Eigen expression.
   void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) {
     DRAKE_ASSERT(value.size() == state_->size());
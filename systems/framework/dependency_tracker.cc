@@ -1,6 +1,8 @@
 #include "drake/systems/framework/dependency_tracker.h"
 
 #include <algorithm>
+#include <unordered_set>
+#include <utility>
 
 #include "drake/common/unused.h"
 
@@ -33,9 +35,81 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
+  if (is_flattened_) {
+    DRAKE_SPDLOG_DEBUG(log(), "... {} flattened cache entry invalidations.",
+                       flattened_invalidations_.size());
+    for (const FlattenedInvalidation& invalidation : flattened_invalidations_) {
+      CacheEntryValue& cache_value = *invalidation.cache_value;
+      if (cache_value.is_profiling_enabled())
+        cache_value.record_invalidation(invalidation.prerequisite);
+      cache_value.mark_out_of_date();
+    }
+    return;
+  }
   NotifySubscribers(change_event, 0);
 }
 
+// Visits the downstream trackers depth first, in the order of
+// NotifySubscribers(), so that each cache entry value is attributed to the same
+// prerequisite as by the recursive sweep. Then flattens the downstream trackers
+// that aren't yet, to maintain the invariant that
+// DiscardFlattenedInvalidation() relies on.
+void DependencyTracker::FlattenInvalidation() const {
+  if (is_flattened_) return;
+  DRAKE_SPDLOG_DEBUG(log(), "Tracker '{}' flattening its invalidations",
+                     GetPathDescription());
+  flattened_invalidations_.clear();
+  std::unordered_set<const DependencyTracker*> visited{this};
+  std::vector<const DependencyTracker*> downstream;
+  // Each tracker on the stack, with the index of its next subscriber.
+  std::vector<std::pair<const DependencyTracker*, int>> stack{{this, 0}};
+  while (!stack.empty()) {
+    const DependencyTracker* tracker = stack.back().first;
+    const int i = stack.back().second++;
+    if (i == tracker->num_subscribers()) {
+      stack.pop_back();
+      continue;
+    }
+    const DependencyTracker* subscriber = tracker->subscribers_[i];
+    DRAKE_ASSERT(subscriber != nullptr);
+    if (!visited.insert(subscriber).second) continue;
+    if (subscriber->has_associated_cache_entry_) {
+      flattened_invalidations_.push_back(
+          {subscriber->cache_value_, tracker->ticket()});
+    }
+    downstream.push_back(subscriber);
+    stack.emplace_back(subscriber, 0);
+  }
+  is_flattened_ = true;
+  for (const DependencyTracker* tracker : downstream) {
+    tracker->FlattenInvalidation();
+  }
+}
+
+// Since every tracker downstream of a flattened tracker is flattened, nothing
+// upstream of a tracker that isn't flattened is flattened either, and the walk
+// stops there.
+void DependencyTracker::DiscardFlattenedInvalidation() const {
+  if (!is_flattened_) return;
+  DRAKE_SPDLOG_DEBUG(log(), "Tracker '{}' discarding flattened invalidations",
+                     GetPathDescription());
+  std::vector<const DependencyTracker*> stack{this};
+  is_flattened_ = false;
+  while (!stack.empty()) {
+    const DependencyTracker* tracker = stack.back();
+    stack.pop_back();
+    tracker->flattened_invalidations_.clear();
+    tracker->flattened_invalidations_.shrink_to_fit();
+    for (const DependencyTracker* prerequisite : tracker->prerequisites_) {
+      DRAKE_ASSERT(prerequisite != nullptr);
+      if (prerequisite->is_flattened_) {
+        prerequisite->is_flattened_ = false;
+        stack.push_back(prerequisite);
+      }
+    }
+  }
+}
+
 // A prerequisite says it has changed. Short circuit if we've already heard
 // about this change event. Otherwise, invalidate the associated cache entry and
 // then pass on the bad news to our subscribers. Update statistics.
@@ -60,7 +134,10 @@ void DependencyTracker::NotePrerequisiteChange(
     return;
   }
   last_change_event_ = change_event;
-  // Invalidate associated cache entry value if any.
+  // Invalidate associated cache entry value if any. The dummy cache entry value
+  // never has profiling enabled.
+  if (cache_value_->is_profiling_enabled())
+    cache_value_->record_invalidation(prerequisite.ticket());
   cache_value_->mark_out_of_date();
   // Follow up with downstream subscribers.
   NotifySubscribers(change_event, depth);
@@ -99,6 +176,8 @@ void DependencyTracker::SubscribeToPrerequisite(
   prerequisites_.push_back(prerequisite);
 
   prerequisite->AddDownstreamSubscriber(*this);
+  // The prerequisite and everything upstream now reach our subgraph too.
+  prerequisite->DiscardFlattenedInvalidation();
 }
 
 void DependencyTracker::AddDownstreamSubscriber(
@@ -143,6 +222,7 @@ void DependencyTracker::UnsubscribeFromPrerequisite(
   Remove<const DependencyTracker*>(prerequisite, &prerequisites_);
 
   prerequisite->RemoveDownstreamSubscriber(*this);
+  prerequisite->DiscardFlattenedInvalidation();
 }
 
 void DependencyTracker::RemoveDownstreamSubscriber(
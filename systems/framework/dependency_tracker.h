@@ -130,6 +130,18 @@ nodes. */
 // CacheEntryValue here, make it available for all non-cache DependencyTrackers
 // to "invalidate", and require that the definition of the cache invalidation
 // method is visible here rather than use an abstract interface to it.
+//
+// On large Contexts, the recursive sweep is dominated by pointer chasing
+// through trackers that have no cache entry or that were already notified. A
+// tracker may instead be "flattened" (see FlattenInvalidation()): it then
+// keeps the list of every cache entry value downstream of it, in the order
+// the recursive sweep would reach them, and NoteValueChange() is a linear
+// sweep over that list. To keep the lists correct, every tracker downstream of
+// a flattened tracker is flattened too, and changing a subscription discards
+// the lists of every tracker upstream of the changed edge, which then return
+// to recursive sweeps. That invariant lets the discarding stop at the first
+// tracker that is not flattened, so that the subscriptions made while
+// allocating a Context cost nothing extra.
 
 class DependencyTracker {
  public:
@@ -162,6 +174,8 @@ class DependencyTracker {
     DRAKE_DEMAND(!has_associated_cache_entry_);
     cache_value_ = cache_value;
     has_associated_cache_entry_ = true;
+    // The flattened lists upstream must now include the cache entry value.
+    DiscardFlattenedInvalidation();
   }
 
   /** (Internal use only) Returns a pointer to the CacheEntryValue if this
@@ -190,9 +204,47 @@ class DependencyTracker {
   sweep. So it is unusual for NoteValueChange() to be called on a cache entry's
   dependency tracker. But if it is called, that is likely to mean the cache
   entry was just given a new value, and is therefore _valid_; invalidating it
-  now would be an error. */
+  now would be an error.
+
+  If this tracker is flattened (see FlattenInvalidation()), the downstream
+  cache entry values are marked out of date directly, without notifying the
+  trackers in between; their change events and statistics are not updated. */
   void NoteValueChange(int64_t change_event) const;
 
+  /** @name                   Flattened invalidation
+  These methods replace the recursive notification of the subscribers by a
+  precomputed list of the downstream cache entry values. They are normally
+  invoked through ContextBase::FlattenInvalidation(). */
+  //@{
+
+  /** (Advanced) Precomputes the list of the cache entry values downstream of
+  this tracker, which NoteValueChange() then marks out of date in a single
+  linear sweep. The trackers downstream of this one are flattened too. The
+  results are identical to those of the recursive sweep, including the cache
+  profiling statistics. The list is discarded, and this tracker returns to
+  recursive sweeps, if a subscription downstream of this tracker changes; it
+  is not preserved by cloning the Context. The list costs memory proportional
+  to the number of downstream cache entries, so flattening every tracker of a
+  Context is quadratic in the worst case. */
+  void FlattenInvalidation() const;
+
+  /** (Advanced) Discards the flattened invalidation lists of this tracker and
+  of all the trackers upstream of it (whose lists include this tracker's
+  downstream cache entries). They return to recursive sweeps. Does nothing if
+  this tracker is not flattened. */
+  void DiscardFlattenedInvalidation() const;
+
+  /** Returns `true` if this tracker is flattened; see FlattenInvalidation().
+  */
+  bool is_invalidation_flattened() const { return is_flattened_; }
+
+  /** Returns the number of cache entry values in the flattened invalidation
+  list of this tracker, or zero if it is not flattened. */
+  int num_flattened_invalidations() const {
+    return static_cast<int>(flattened_invalidations_.size());
+  }
+  //@}
+
   /** @name              Prerequisites and subscribers
   These methods deal with dependencies associated with this tracker. */
   //@{
@@ -409,6 +461,18 @@ class DependencyTracker {
   // greater than zero, so this will never match.
   mutable int64_t last_change_event_{-1};
 
+  // The flattened invalidation list (see FlattenInvalidation()): each cache
+  // entry value downstream of this tracker, with the ticket of the
+  // prerequisite through which the recursive sweep reaches it first (for
+  // profiling). Like last_change_event_, it only speeds up the sweeps without
+  // changing their results; hence mutable is OK.
+  struct FlattenedInvalidation {
+    CacheEntryValue* cache_value{};
+    DependencyTicket prerequisite;
+  };
+  mutable std::vector<FlattenedInvalidation> flattened_invalidations_;
+  mutable bool is_flattened_{false};
+
   // Runtime statistics. Does not change behavior at all.
   mutable int64_t num_value_change_notifications_received_{0};
   mutable int64_t num_prerequisite_notifications_received_{0};
@@ -8,12 +8,16 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/diagram_context.h"
@@ -312,14 +316,41 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     DRAKE_DEMAND(num_subsystems() == n);
 
     // Evaluate the derivatives of each constituent system.
-    for (SubsystemIndex i(0); i < n; ++i) {
+    const auto all = [](SubsystemIndex) { return true; };
+    CalcSubsystems(*diagram_context, all, [&](SubsystemIndex i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       ContinuousState<T>& subderivatives =
           diagram_derivatives->get_mutable_substate(i);
       registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
-    }
+    });
   }
 
+  /// (Advanced) Sets the maximum number of threads used to evaluate the
+  /// subsystems of this Diagram in CalcTimeDerivatives() and
+  /// CalcDiscreteVariableUpdates(). The default is one, in which case the
+  /// subsystems are evaluated in sequence on the calling thread.
+  ///
+  /// When greater than one, the input ports of the participating subsystems
+  /// are first evaluated in sequence, which brings the values of all the
+  /// upstream output ports up to date. The subsystems, which then only read
+  /// those values and otherwise only touch their own subcontexts, are then
+  /// evaluated concurrently. This pays off for Diagrams made of many
+  /// independent and expensive subsystems (e.g., a fleet of vehicles). The
+  /// subsystems must be safe to evaluate concurrently on distinct contexts,
+  /// which holds unless they mutate state shared among them.
+  ///
+  /// This setting only applies to this Diagram (not to its subdiagrams) and
+  /// is not preserved by scalar conversion.
+  /// @throws std::exception if `num_threads` is less than one.
+  void set_max_num_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    max_num_threads_ = num_threads;
+  }
+
+  /// Returns the maximum number of threads used to evaluate the subsystems.
+  /// @see set_max_num_threads().
+  int max_num_threads() const { return max_num_threads_; }
+
   /// Retrieves a reference to the subsystem with name @p name returned by
   /// get_name().
   /// @throws std::logic_error if a match cannot be found.
@@ -917,27 +948,30 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
     *time = std::numeric_limits<double>::infinity();
 
-    // Iterate over the subsystems, and harvest the most imminent updates.
-    std::vector<T> times(num_subsystems());
+    // Iterate over the subsystems, and harvest the most imminent updates. The
+    // event collections of the subsystems whose next update time is bigger
+    // than *time are cleared as we go, without storing the times (which would
+    // allocate at every step): when a new earliest time is found, the
+    // collections of the earlier subsystems starting at `first_at_time`, which
+    // are the ones that were at the previous earliest time, are cleared.
+    SubsystemIndex first_at_time(0);
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       CompositeEventCollection<T>& subinfo =
           info->get_mutable_subevent_collection(i);
       const T sub_time =
           registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-      times[i] = sub_time;
 
       if (sub_time < *time) {
         *time = sub_time;
+        for (SubsystemIndex j = first_at_time; j < i; ++j) {
+          info->get_mutable_subevent_collection(j).Clear();
+        }
+        first_at_time = i;
+      } else if (sub_time > *time) {
+        subinfo.Clear();
       }
     }
-
-    // For all the subsystems whose next update time is bigger than *time,
-    // clear their event collections.
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-      if (times[i] > *time)
-        info->get_mutable_subevent_collection(i).Clear();
-    }
   }
 
  private:
@@ -1023,51 +1057,52 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     return context;
   }
 
+  // Brings the cache entries of each subsystem, and then those of this
+  // Diagram, up to date.
+  void DoEvalAllCacheEntries(const ContextBase& context_base) const final {
+    auto& diagram_context =
+        dynamic_cast<const DiagramContext<T>&>(context_base);
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      SystemBase::EvalAllCacheEntries(*registered_systems_[i],
+                                      diagram_context.GetSubsystemContext(i));
+    }
+    SystemBase::DoEvalAllCacheEntries(context_base);
+  }
+
   // Evaluates the value of the specified subsystem input
   // port in the given context. The port has already been determined _not_ to
   // be a fixed port, so it must be connected either
   // - to the output port of a peer subsystem, or
   // - to an input port of this Diagram,
   // - or not connected at all in which case we return null.
+  // The source of the port was resolved once by BuildInputPortSources().
   const AbstractValue* EvalConnectedSubsystemInputPort(
       const ContextBase& context_base,
       const InputPortBase& input_port_base) const final {
     auto& diagram_context =
         dynamic_cast<const DiagramContext<T>&>(context_base);
-    auto& system =
-        dynamic_cast<const System<T>&>(input_port_base.get_system_base());
-    const InputPortLocator id{&system, input_port_base.get_index()};
-
-    // Find if this input port is exported (connected to an input port of this
-    // containing diagram).
-    // TODO(sherm1) Fix this. Shouldn't have to search.
-    const auto external_it =
-        std::find(input_port_ids_.begin(), input_port_ids_.end(), id);
-    const bool is_exported = (external_it != input_port_ids_.end());
-
-    // Find if this input port is connected to an output port.
-    // TODO(sherm1) Fix this. Shouldn't have to search.
-    const auto upstream_it = connection_map_.find(id);
-    const bool is_connected = (upstream_it != connection_map_.end());
-
-    if (!(is_exported || is_connected))
+    const auto source_it = input_port_sources_.find(&input_port_base);
+    if (source_it == input_port_sources_.end())
       return nullptr;
+    const InputPortSource& source = source_it->second;
 
-    DRAKE_DEMAND(is_exported ^ is_connected);
-
-    if (is_exported) {
+    if (source.exported_index.is_valid()) {
       // The upstream source is an input to this whole Diagram; evaluate that
       // input port and use the result as the value for this one.
-      const InputPortIndex i(external_it - input_port_ids_.begin());
-      return this->EvalAbstractInput(diagram_context, i);
+      return this->EvalAbstractInput(diagram_context, source.exported_index);
     }
 
     // The upstream source is an output port of one of this Diagram's child
-    // subsystems; evaluate it.
+    // subsystems. Rather than evaluating it, and through it each of the
+    // exported ports that forward to the port that actually computes the
+    // value, go straight down to that port's subcontext and evaluate it.
     // TODO(david-german-tri): Add online algebraic loop detection here.
-    DRAKE_ASSERT(is_connected);
-    const OutputPortLocator& prerequisite = upstream_it->second;
-    return &this->EvalSubsystemOutputPort(diagram_context, prerequisite);
+    const Context<T>* subcontext = &diagram_context;
+    for (SubsystemIndex i : source.subcontext_path) {
+      subcontext = &static_cast<const DiagramContext<T>&>(*subcontext)
+                        .GetSubsystemContext(i);
+    }
+    return &source.output_port->template Eval<AbstractValue>(*subcontext);
   }
 
   std::string GetParentPathname() const final {
@@ -1175,19 +1210,19 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
             events);
 
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const auto has_events = [&diagram_events](SubsystemIndex i) {
+      return diagram_events.get_subevent_collection(i).HasEvents();
+    };
+    CalcSubsystems(*diagram_context, has_events, [&](SubsystemIndex i) {
       const EventCollection<DiscreteUpdateEvent<T>>& subevents =
           diagram_events.get_subevent_collection(i);
+      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+      DiscreteValues<T>& subdiscrete =
+          diagram_discrete->get_mutable_subdiscrete(i);
 
-      if (subevents.HasEvents()) {
-        const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-        DiscreteValues<T>& subdiscrete =
-            diagram_discrete->get_mutable_subdiscrete(i);
-
-        registered_systems_[i]->CalcDiscreteVariableUpdates(
-            subcontext, subevents, &subdiscrete);
-      }
-    }
+      registered_systems_[i]->CalcDiscreteVariableUpdates(
+          subcontext, subevents, &subdiscrete);
+    });
   }
 
   void DoApplyDiscreteVariableUpdate(
@@ -1490,6 +1525,8 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
       SystemBase::set_parent_service(registered_systems_[i].get(), this);
     }
 
+    BuildInputPortSources();
+
     // Generate constraints for the diagram from the constraints on the
     // subsystems.
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
@@ -1548,6 +1585,39 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
             &System<T>::AllocateForcedUnrestrictedUpdateEventCollection));
   }
 
+  // Resolves the source of every input port of the subsystems that is either
+  // exported or connected, for EvalConnectedSubsystemInputPort(). An output
+  // port that is the source of a connection is followed through the
+  // DiagramOutputPorts that export it, down to the port that computes it.
+  void BuildInputPortSources() {
+    for (InputPortIndex i(0); i < static_cast<int>(input_port_ids_.size());
+         ++i) {
+      const InputPortLocator& id = input_port_ids_[i];
+      InputPortSource& source =
+          input_port_sources_[&id.first->get_input_port(id.second)];
+      source.exported_index = i;
+    }
+    for (const auto& connection : connection_map_) {
+      const InputPortLocator& dest = connection.first;
+      const OutputPortLocator& src = connection.second;
+      InputPortSource& source =
+          input_port_sources_[&dest.first->get_input_port(dest.second)];
+      // A port can't be both exported and connected.
+      DRAKE_DEMAND(!source.exported_index.is_valid());
+      source.subcontext_path.push_back(GetSystemIndexOrAbort(src.first));
+      const OutputPort<T>* port = &src.first->get_output_port(src.second);
+      while (auto diagram_port =
+                 dynamic_cast<const DiagramOutputPort<T>*>(port)) {
+        const optional<SubsystemIndex> child =
+            diagram_port->GetPrerequisite().child_subsystem;
+        DRAKE_DEMAND(child.has_value());
+        source.subcontext_path.push_back(*child);
+        port = &diagram_port->get_source_output_port();
+      }
+      source.output_port = port;
+    }
+  }
+
   // Exposes the given port as an input of the Diagram.
   void ExportInput(const InputPortLocator& port, std::string name) {
     const System<T>* const sys = port.first;
@@ -1658,6 +1728,41 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     return static_cast<int>(registered_systems_.size());
   }
 
+  // Calls `calc` for each subsystem for which `participates` returns true,
+  // concurrently when max_num_threads_ is greater than one. See
+  // set_max_num_threads(). The sequential case does not allocate.
+  template <typename Participates, typename Calc>
+  void CalcSubsystems(const DiagramContext<T>& context,
+                      const Participates& participates,
+                      const Calc& calc) const {
+    if (max_num_threads_ == 1) {
+      for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+        if (participates(i)) calc(i);
+      }
+      return;
+    }
+    std::vector<SubsystemIndex> subsystems;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (participates(i)) subsystems.push_back(i);
+    }
+    if (subsystems.size() < 2) {
+      for (SubsystemIndex i : subsystems) calc(i);
+      return;
+    }
+    // Bring the values of the input ports up to date, so that the concurrent
+    // evaluations only read the (shared) upstream cache entries.
+    for (SubsystemIndex i : subsystems) {
+      const System<T>& subsystem = *registered_systems_[i];
+      const Context<T>& subcontext = context.GetSubsystemContext(i);
+      for (int port = 0; port < subsystem.num_input_ports(); ++port) {
+        subsystem.EvalAbstractInput(subcontext, port);
+      }
+    }
+    StaticParallelForIndexLoop(
+        max_num_threads_, 0, static_cast<int>(subsystems.size()),
+        [&](int, int k) { calc(subsystems[k]); });
+  }
+
   // A map from the input ports of constituent systems, to the output ports of
   // the systems from which they get their values.
   std::map<InputPortLocator, OutputPortLocator> connection_map_;
@@ -1666,6 +1771,9 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // they were registered. Index by SubsystemIndex.
   internal::OwnedSystems<T> registered_systems_;
 
+  // See set_max_num_threads().
+  int max_num_threads_{1};
+
   // Map to quickly satisfy "What is the subsystem index of the child system?"
   std::map<const System<T>*, SubsystemIndex> system_index_map_;
 
@@ -1674,6 +1782,22 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // Where the value of an input port of a subsystem comes from: either an
+  // input port of this Diagram that it is exported to, or the output port
+  // that ultimately computes the value of the output port it is connected to,
+  // whose context is reached from this Diagram's context through the
+  // subcontexts of the subsystems in `subcontext_path`.
+  struct InputPortSource {
+    InputPortIndex exported_index;
+    const OutputPort<T>* output_port{};
+    std::vector<SubsystemIndex> subcontext_path;
+  };
+
+  // The sources of the subsystem input ports that are either exported or
+  // connected; see BuildInputPortSources().
+  std::unordered_map<const InputPortBase*, InputPortSource>
+      input_port_sources_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -495,6 +495,15 @@ class DiagramContext final : public Context<T> {
     }
   }
 
+  // Recursively collects the subcontexts.
+  void DoPropagateCollectContexts(
+      std::vector<const ContextBase*>* contexts) const final {
+    for (auto& subcontext : contexts_) {
+      DRAKE_ASSERT(subcontext != nullptr);
+      ContextBase::CollectContexts(*subcontext, contexts);
+    }
+  }
+
   // For this method `this` is the source being copied into `clone`.
   void DoPropagateBuildTrackerPointerMap(
       const ContextBase& clone,
@@ -319,6 +319,19 @@ class Event {
     DoAddToComposite(trigger_type_, &*events);
   }
 
+  /**
+   * Adds a pointer to `this` event, rather than a clone of it, to the event
+   * collection `events`. This avoids any heap allocation, but `this` event must
+   * outlive all uses of `events` and of the collections that `events` is
+   * merged into (see LeafEventCollection::add_unowned_event()). Must not have
+   * an unknown trigger type.
+   */
+  void AddUnownedToComposite(CompositeEventCollection<T>* events) const {
+    DRAKE_DEMAND(events != nullptr);
+    DRAKE_DEMAND(trigger_type_ != TriggerType::kUnknown);
+    DoAddUnownedToComposite(&*events);
+  }
+
  protected:
   Event(const Event& other) : trigger_type_(other.trigger_type_) {
     if (other.event_data_ != nullptr)
@@ -338,6 +351,13 @@ class Event {
   virtual void DoAddToComposite(TriggerType trigger_type,
                                 CompositeEventCollection<T>* events) const = 0;
 
+  /**
+   * Derived classes must implement this to add a pointer to this Event to the
+   * event collection.
+   */
+  virtual void DoAddUnownedToComposite(
+      CompositeEventCollection<T>* events) const = 0;
+
   /**
    * Derived classes must implement this method to clone themselves. Any
    * Event-specific data is cloned using the Clone() method. Data specific
@@ -423,6 +443,11 @@ class PublishEvent final : public Event<T> {
     events->add_publish_event(std::move(event));
   }
 
+  void DoAddUnownedToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_unowned_publish_event(this);
+  }
+
   // Clones PublishEvent-specific data.
   DRAKE_NODISCARD PublishEvent<T>* DoClone() const final {
     return new PublishEvent(*this);
@@ -503,6 +528,11 @@ class DiscreteUpdateEvent final : public Event<T> {
     events->add_discrete_update_event(std::move(event));
   }
 
+  void DoAddUnownedToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_unowned_discrete_update_event(this);
+  }
+
   // Clones DiscreteUpdateEvent-specific data.
   DRAKE_NODISCARD DiscreteUpdateEvent<T>* DoClone() const final {
     return new DiscreteUpdateEvent(this->get_trigger_type(), callback_);
@@ -582,6 +612,11 @@ class UnrestrictedUpdateEvent final : public Event<T> {
     events->add_unrestricted_update_event(std::move(event));
   }
 
+  void DoAddUnownedToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_unowned_unrestricted_update_event(this);
+  }
+
   // Clones event data specific to UnrestrictedUpdateEvent.
   UnrestrictedUpdateEvent<T>* DoClone() const final {
     return new UnrestrictedUpdateEvent(*this);
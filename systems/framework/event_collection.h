@@ -324,6 +324,23 @@ class LeafEventCollection final : public EventCollection<EventType> {
     DRAKE_DEMAND(event != nullptr);
     owned_events_.push_back(std::move(event));
     events_.push_back(owned_events_.back().get());
+    is_owned_.push_back(true);
+  }
+
+  /**
+   * Adds a pointer to @p event, which is not owned by this collection, to the
+   * existing collection. Unlike add_event() this does not require a heap
+   * allocated event; once this collection has grown to its working size,
+   * clearing and refilling it with unowned events does not allocate. Unowned
+   * events are merged into other collections by pointer as well (see
+   * DoMerge()), so @p event must outlive all uses of this collection and of the
+   * collections it is merged into. Typically @p event is owned by the System
+   * that declared it. Aborts if event is null.
+   */
+  void add_unowned_event(const EventType* event) {
+    DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event);
+    is_owned_.push_back(false);
   }
 
   /**
@@ -337,11 +354,14 @@ class LeafEventCollection final : public EventCollection<EventType> {
   void Clear() override {
     owned_events_.clear();
     events_.clear();
+    is_owned_.clear();
   }
 
  protected:
   /**
-   * All events in @p other_collection are concatanated to this. Aborts if
+   * All events in @p other_collection are concatanated to this. Events owned by
+   * @p other_collection are cloned, while its unowned events (see
+   * add_unowned_event()) are added as unowned events here. Aborts if
    * @p other_collection is null.
    *
    * Here is an example. Suppose this collection stores the following events:
@@ -365,8 +385,13 @@ class LeafEventCollection final : public EventCollection<EventType> {
         dynamic_cast<const LeafEventCollection<EventType>&>(other_collection);
 
     const std::vector<const EventType*>& other_events = other.get_events();
-    for (const EventType* other_event : other_events) {
-      this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+    for (size_t i = 0; i < other_events.size(); ++i) {
+      if (other.is_owned_[i]) {
+        this->add_event(
+            static_pointer_cast<EventType>(other_events[i]->Clone()));
+      } else {
+        this->add_unowned_event(other_events[i]);
+      }
     }
   }
 
@@ -374,9 +399,12 @@ class LeafEventCollection final : public EventCollection<EventType> {
   // Owned event unique pointers.
   std::vector<std::unique_ptr<EventType>> owned_events_;
 
-  // Points to the corresponding unique pointers. This is primarily used for
-  // get_events().
+  // Points to the corresponding unique pointers or to the unowned events. This
+  // is primarily used for get_events().
   std::vector<const EventType*> events_;
+
+  // Whether each element of events_ is owned (i.e., is in owned_events_).
+  std::vector<bool> is_owned_;
 };
 
 /**
@@ -484,6 +512,48 @@ class CompositeEventCollection {
     events.add_event(std::move(event));
   }
 
+  /**
+   * Assuming the internal publish event collection is an instance of
+   * LeafEventCollection, adds a pointer to the publish event @p event (which
+   * is not owned) to it. See LeafEventCollection::add_unowned_event() for the
+   * lifetime requirements.
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_unowned_publish_event(const PublishEvent<T>* event) {
+    auto& events = dynamic_cast<LeafEventCollection<PublishEvent<T>>&>(
+        this->get_mutable_publish_events());
+    events.add_unowned_event(event);
+  }
+
+  /**
+   * Assuming the internal discrete update event collection is an instance of
+   * LeafEventCollection, adds a pointer to the discrete update event @p event
+   * (which is not owned) to it. See LeafEventCollection::add_unowned_event()
+   * for the lifetime requirements.
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_unowned_discrete_update_event(
+      const DiscreteUpdateEvent<T>* event) {
+    auto& events = dynamic_cast<LeafEventCollection<DiscreteUpdateEvent<T>>&>(
+        this->get_mutable_discrete_update_events());
+    events.add_unowned_event(event);
+  }
+
+  /**
+   * Assuming the internal unrestricted update event collection is an instance
+   * of LeafEventCollection, adds a pointer to the unrestricted update event
+   * @p event (which is not owned) to it. See
+   * LeafEventCollection::add_unowned_event() for the lifetime requirements.
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_unowned_unrestricted_update_event(
+      const UnrestrictedUpdateEvent<T>* event) {
+    auto& events =
+        dynamic_cast<LeafEventCollection<UnrestrictedUpdateEvent<T>>&>(
+            this->get_mutable_unrestricted_update_events());
+    events.add_unowned_event(event);
+  }
+
   /**
    * Merges the contained homogeneous event collections (e.g.,
    * EventCollection<PublishEvent<T>>, EventCollection<DiscreteUpdateEvent<T>>,
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_nodiscard.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/basic_vector.h"
+
+namespace drake {
+namespace systems {
+
+/// A BasicVector whose size N is known at compile time. It may be used
+/// wherever a BasicVector may (e.g., as the model vector of a vector-valued
+/// port or of the state of a LeafSystem, which then holds %FixedBasicVector
+/// values), and its get_fixed_value() and get_mutable_fixed_value() views have
+/// the size N in their type, so that Eigen unrolls the small kernels computed
+/// on them instead of looping over a run-time size.
+///
+/// The elements are stored in the single allocation that BasicVector makes
+/// when the vector is constructed (i.e., when a Context is allocated), not per
+/// computation.
+///
+/// @tparam T The vector element type, which must be a valid Eigen scalar.
+/// @tparam N The size of the vector, which must be positive.
+template <typename T, int N>
+class FixedBasicVector : public BasicVector<T> {
+ public:
+  static_assert(N > 0, "The size of a FixedBasicVector must be positive.");
+
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FixedBasicVector)
+
+  /// The Eigen type of the value of the vector.
+  using FixedVector = Eigen::Matrix<T, N, 1>;
+
+  /// Initializes with the drake::dummy_value<T>, which is NaN when
+  /// T = double.
+  FixedBasicVector() : BasicVector<T>(N) {}
+
+  /// Initializes with the given `value`.
+  explicit FixedBasicVector(const FixedVector& value)
+      : BasicVector<T>(VectorX<T>(value)) {}
+
+  /// Returns the entire vector as a const Eigen vector of size N.
+  Eigen::Map<const FixedVector> get_fixed_value() const {
+    return Eigen::Map<const FixedVector>(this->values().data());
+  }
+
+  /// Returns the entire vector as a mutable Eigen vector of size N.
+  Eigen::Map<FixedVector> get_mutable_fixed_value() {
+    return Eigen::Map<FixedVector>(this->values().data());
+  }
+
+  /// Shadows the base class Clone() method to change the return type.
+  std::unique_ptr<FixedBasicVector<T, N>> Clone() const {
+    return std::unique_ptr<FixedBasicVector<T, N>>(
+        new FixedBasicVector<T, N>(get_fixed_value()));
+  }
+
+ protected:
+  DRAKE_NODISCARD FixedBasicVector<T, N>* DoClone() const override {
+    return new FixedBasicVector<T, N>();
+  }
+};
+
+}  // namespace systems
+}  // namespace drake
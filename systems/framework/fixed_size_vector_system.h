@@ -0,0 +1,151 @@
+#pragma once
+
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/dummy_value.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/unused.h"
+#include "drake/systems/framework/vector_system.h"
+
+namespace drake {
+namespace systems {
+
+/// A VectorSystem whose input, state and output sizes are known at compile
+/// time. Its subclasses override the DoCalcFixedVector*() methods below, whose
+/// arguments have those sizes in their types, instead of the
+/// DoCalcVector*() methods of VectorSystem (which are `final` here), so that
+/// Eigen unrolls their kernels for small systems rather than looping over the
+/// run-time sizes.
+///
+/// As for VectorSystem, a size of zero means that there is no such port (or
+/// state). A subclass with a non-zero `kStateSize` must declare either a
+/// continuous or a discrete state of that size, e.g., with a
+/// FixedBasicVector<T, kStateSize> model vector.
+///
+/// @tparam T The vector element type, which must be a valid Eigen scalar.
+/// @tparam kInputSize The size of the input port.
+/// @tparam kStateSize The size of the state.
+/// @tparam kOutputSize The size of the output port.
+template <typename T, int kInputSize, int kStateSize, int kOutputSize>
+class FixedSizeVectorSystem : public VectorSystem<T> {
+ public:
+  static_assert(kInputSize >= 0 && kStateSize >= 0 && kOutputSize >= 0,
+                "The sizes of a FixedSizeVectorSystem can't be negative.");
+
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FixedSizeVectorSystem)
+
+  using InputVector = Eigen::Matrix<T, kInputSize, 1>;
+  using StateVector = Eigen::Matrix<T, kStateSize, 1>;
+  using OutputVector = Eigen::Matrix<T, kOutputSize, 1>;
+
+  ~FixedSizeVectorSystem() override = default;
+
+ protected:
+  /// Creates a system with ports of the given sizes; see the matching
+  /// constructor of VectorSystem. When the output isn't direct feedthrough,
+  /// the DoCalcFixedVectorOutput() `input` holds drake::dummy_value<T> (NaN
+  /// when T = double) rather than the input.
+  explicit FixedSizeVectorSystem(optional<bool> direct_feedthrough = nullopt)
+      : FixedSizeVectorSystem(SystemScalarConverter{}, direct_feedthrough) {}
+
+  /// Creates a system with ports of the given sizes, and the scalar-type
+  /// conversion support of `converter`; see the matching constructor of
+  /// VectorSystem.
+  explicit FixedSizeVectorSystem(SystemScalarConverter converter,
+                                 optional<bool> direct_feedthrough = nullopt)
+      : VectorSystem<T>(std::move(converter), kInputSize, kOutputSize,
+                        direct_feedthrough) {}
+
+  /// The fixed-size counterpart of VectorSystem::DoCalcVectorOutput().
+  /// By default, this function does nothing if the @p output is empty,
+  /// and throws an exception otherwise.
+  virtual void DoCalcFixedVectorOutput(
+      const Context<T>& context, const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<OutputVector>* output) const {
+    unused(context, input, state, output);
+    DRAKE_THROW_UNLESS(kOutputSize == 0);
+  }
+
+  /// The fixed-size counterpart of VectorSystem::DoCalcVectorTimeDerivatives().
+  /// By default, this function does nothing if the @p derivatives are empty,
+  /// and throws an exception otherwise.
+  virtual void DoCalcFixedVectorTimeDerivatives(
+      const Context<T>& context, const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<StateVector>* derivatives) const {
+    unused(context, input, state, derivatives);
+    DRAKE_THROW_UNLESS(kStateSize == 0);
+  }
+
+  /// The fixed-size counterpart of
+  /// VectorSystem::DoCalcVectorDiscreteVariableUpdates().
+  /// By default, this function does nothing if the @p next_state is
+  /// empty, and throws an exception otherwise.
+  virtual void DoCalcFixedVectorDiscreteVariableUpdates(
+      const Context<T>& context, const Eigen::Map<const InputVector>& input,
+      const Eigen::Map<const StateVector>& state,
+      Eigen::Map<StateVector>* next_state) const {
+    unused(context, input, state, next_state);
+    DRAKE_THROW_UNLESS(kStateSize == 0);
+  }
+
+ private:
+  void DoCalcVectorOutput(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* output) const final {
+    Eigen::Map<OutputVector> fixed_output(output->data());
+    DoCalcFixedVectorOutput(context, MapInput(input), MapState(state),
+                            &fixed_output);
+  }
+
+  void DoCalcVectorTimeDerivatives(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* derivatives) const final {
+    DRAKE_THROW_UNLESS(derivatives->size() == kStateSize);
+    Eigen::Map<StateVector> fixed_derivatives(derivatives->data());
+    DoCalcFixedVectorTimeDerivatives(context, MapInput(input), MapState(state),
+                                     &fixed_derivatives);
+  }
+
+  void DoCalcVectorDiscreteVariableUpdates(
+      const Context<T>& context,
+      const Eigen::VectorBlock<const VectorX<T>>& input,
+      const Eigen::VectorBlock<const VectorX<T>>& state,
+      Eigen::VectorBlock<VectorX<T>>* next_state) const final {
+    DRAKE_THROW_UNLESS(next_state->size() == kStateSize);
+    Eigen::Map<StateVector> fixed_next_state(next_state->data());
+    DoCalcFixedVectorDiscreteVariableUpdates(
+        context, MapInput(input), MapState(state), &fixed_next_state);
+  }
+
+  // The input is empty when the output isn't direct feedthrough, in which case
+  // it is replaced by dummy values.
+  static Eigen::Map<const InputVector> MapInput(
+      const Eigen::VectorBlock<const VectorX<T>>& input) {
+    if (input.size() == kInputSize) {
+      return Eigen::Map<const InputVector>(input.data());
+    }
+    DRAKE_DEMAND(input.size() == 0);
+    static const never_destroyed<InputVector> dummy(
+        InputVector::Constant(dummy_value<T>::get()));
+    return Eigen::Map<const InputVector>(dummy.access().data());
+  }
+
+  static Eigen::Map<const StateVector> MapState(
+      const Eigen::VectorBlock<const VectorX<T>>& state) {
+    DRAKE_THROW_UNLESS(state.size() == kStateSize);
+    return Eigen::Map<const StateVector>(state.data());
+  }
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -24,6 +24,12 @@ namespace systems {
 entry in the same LeafSystem as the port. This is intended for internal use in
 implementing the DeclareOutputPort() variants in LeafSystem.
 
+Eval() returns a reference to the cache entry's value, which is allocated once
+per Context and then recomputed in place; it is never copied. The cache entry
+is usually declared along with the port, but may be an existing cache entry of
+the system (see LeafSystem::DeclareCacheEntryOutputPort()), in which case the
+port exposes the entry's value without the copy a calculator would make.
+
 @tparam T The vector element type, which must be a valid Eigen scalar.
 
 Instantiated templates for the following kinds of T's are provided:
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
@@ -425,26 +426,38 @@ class LeafSystem : public System<T> {
       return;
     }
 
-    // Find the minimum next sample time across all registered events, and
-    // the set of registered events that will occur at that time.
-    std::vector<const Event<T>*> next_events;
-    for (const auto& event_pair : periodic_events_) {
-      const PeriodicEventData& event_data = event_pair.first;
-      const Event<T>* const event = event_pair.second.get();
+    // Find the minimum next sample time across the distinct timings of the
+    // registered events, noting in `at_min_time` which of the first 64 of
+    // those timings are due then.
+    uint64_t at_min_time = 0;
+    for (int i = 0; i < static_cast<int>(periodic_event_timings_.size());
+         ++i) {
       const T t = leaf_system_internal::GetNextSampleTime(
-          event_data, context.get_time());
+          periodic_event_timings_[i], context.get_time());
       if (t < min_time) {
         min_time = t;
-        next_events = {event};
-      } else if (t == min_time) {
-        next_events.push_back(event);
+        at_min_time = 0;
+      }
+      if (t == min_time) {
+        if (i < 64) at_min_time |= uint64_t{1} << i;
       }
     }
 
-    // Write out the events that fire at min_time.
+    // Write out the events that fire at min_time, in the order they were
+    // declared. These refer to the events owned by this System (rather than
+    // cloning them) so that the Simulator's steady-state steps don't allocate.
     *time = min_time;
-    for (const Event<T>* event : next_events) {
-      event->AddToComposite(events);
+    for (int i = 0; i < static_cast<int>(periodic_events_.size()); ++i) {
+      const int timing = periodic_event_timing_indices_[i];
+      bool fires = false;
+      if (timing < 64) {
+        fires = ((at_min_time >> timing) & 1) != 0;
+      } else {
+        const T t = leaf_system_internal::GetNextSampleTime(
+            periodic_event_timings_[timing], context.get_time());
+        if (t == min_time) fires = true;
+      }
+      if (fires) periodic_events_[i].second->AddUnownedToComposite(events);
     }
   }
 
@@ -897,6 +910,16 @@ class LeafSystem : public System<T> {
     event_copy->set_trigger_type(TriggerType::kPeriodic);
     periodic_events_.emplace_back(
         std::make_pair(periodic_data, std::move(event_copy)));
+    const auto timing_it = std::find_if(
+        periodic_event_timings_.begin(), periodic_event_timings_.end(),
+        [&periodic_data](const PeriodicEventData& timing) {
+          return timing.period_sec() == periodic_data.period_sec() &&
+                 timing.offset_sec() == periodic_data.offset_sec();
+        });
+    periodic_event_timing_indices_.push_back(
+        timing_it - periodic_event_timings_.begin());
+    if (timing_it == periodic_event_timings_.end())
+      periodic_event_timings_.push_back(periodic_data);
   }
 
   /// (To be deprecated) Declares a periodic publish event that invokes the
@@ -1659,6 +1682,14 @@ class LeafSystem : public System<T> {
   /// a given Context to produce the output port's value, which is placed in
   /// an object of the type returned by the allocator.
   ///
+  /// The allocator is invoked once per Context (and by AllocateOutput()); the
+  /// calculator is then given the same object each time the port's value is
+  /// recomputed, still holding the previous value. Calculators should update
+  /// that object in place, reusing its storage, rather than replacing it with
+  /// a newly constructed one. When a port's value is already available in a
+  /// cache entry of the system, DeclareCacheEntryOutputPort() exposes it
+  /// without copying it.
+  ///
   /// Although the allocator and calculator functions ultimately satisfy generic
   /// function signatures defined in LeafOutputPort, we provide a variety
   /// of `DeclareVectorOutputPort()` and `DeclareAbstractOutputPort()`
@@ -1946,6 +1977,23 @@ class LeafSystem : public System<T> {
         std::move(calc_function), std::move(prerequisites_of_calc));
     return port;
   }
+
+  /// Declares an abstract-valued output port whose value is the value of the
+  /// given cache entry of this system. Evaluating the port evaluates the cache
+  /// entry and returns a reference to its value, so that a large value (e.g.,
+  /// one that is also used in this system's own computations) is exposed
+  /// without being copied into a separate output port cache entry. The port's
+  /// allocator and calculator are those of the cache entry.
+  /// @pre `cache_entry` was declared by this system.
+  const OutputPort<T>& DeclareCacheEntryOutputPort(
+      variant<std::string, UseDefaultName> name,
+      const CacheEntry& cache_entry) {
+    DRAKE_DEMAND(cache_entry.cache_index() < this->num_cache_entries() &&
+                 &this->get_cache_entry(cache_entry.cache_index()) ==
+                     &cache_entry);
+    return CreateLeafOutputPortForCacheEntry(
+        NextOutputPortName(std::move(name)), nullopt /* size */, cache_entry);
+  }
   //@}
 
   // =========================================================================
@@ -2662,6 +2710,16 @@ class LeafSystem : public System<T> {
         "output port " + std::to_string(oport_index) + "(" + name + ") cache",
         std::move(allocator), std::move(calculator),
         std::move(calc_prerequisites));
+    return CreateLeafOutputPortForCacheEntry(std::move(name), fixed_size,
+                                             cache_entry);
+  }
+
+  // Creates a new LeafOutputPort in this LeafSystem whose value is that of
+  // the given cache entry of this system, and returns a reference to it.
+  LeafOutputPort<T>& CreateLeafOutputPortForCacheEntry(
+      std::string name, const optional<int>& fixed_size,
+      const CacheEntry& cache_entry) {
+    const OutputPortIndex oport_index(this->num_output_ports());
 
     // Create and install the port. Note that it has a separate ticket from
     // the cache entry; the port's tracker will be subscribed to the cache
@@ -2752,6 +2810,12 @@ class LeafSystem : public System<T> {
                         std::unique_ptr<Event<T>>>>
       periodic_events_;
 
+  // The distinct (period, offset) pairs of periodic_events_, so that the next
+  // sample time is computed once per timing rather than once per event, and
+  // for each element of periodic_events_ the index of its timing here.
+  std::vector<PeriodicEventData> periodic_event_timings_;
+  std::vector<int> periodic_event_timing_indices_;
+
   // Update or Publish events registered on this system for every simulator
   // major time step.
   LeafCompositeEventCollection<T> per_step_events_;
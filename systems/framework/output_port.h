@@ -160,7 +160,12 @@ class OutputPort : public OutputPortBase {
   type must be exactly the same as the type returned by this port's allocator.
   If Drake assertions are enabled (typically only in Debug builds), validates
   that the given `value` has exactly the same concrete type as is returned by
-  the Allocate() method. */
+  the Allocate() method.
+
+  The given `value` is updated in place and may still hold the result of a
+  previous computation; see DoCalc(). Calling Calc() repeatedly with the same
+  `value` object is the allocation-free way to obtain a port's value in a
+  loop when Eval() cannot be used. */
   void Calc(const Context<T>& context, AbstractValue* value) const {
     DRAKE_DEMAND(value != nullptr);
     DRAKE_ASSERT_VOID(get_system_base().ThrowIfContextNotCompatible(context));
@@ -216,7 +221,15 @@ class OutputPort : public OutputPortBase {
                  the System whose output port this is.
   @param value   A pointer that has already be validated as non-null and
                  pointing to an object of the right type to hold a value of
-                 this output port. */
+                 this output port.
+
+  The `value` object is reused from one computation to the next (for cached
+  ports it is the cache entry's value, allocated once when the Context is
+  created) and may hold a previously computed value. Implementations should
+  overwrite it in place, e.g., resizing its containers (which then keep their
+  capacity) rather than assigning a newly constructed object, so that a port
+  of a large type (e.g. a PoseBundle or an Image) does no heap allocation once
+  its size has settled. */
   virtual void DoCalc(const Context<T>& context,
                       AbstractValue* value) const = 0;
 
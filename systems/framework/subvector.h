@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -37,6 +40,19 @@ class Subvector : public VectorBase<T> {
     if (first_element_ + num_elements_ > vector_->size()) {
       throw std::out_of_range("Subvector out of bounds.");
     }
+    // This is contiguous when the vector is; its segments are those of the
+    // vector, clipped to the elements of this subvector.
+    const int num_segments = vector_->num_contiguous_segments();
+    is_contiguous_ = num_segments >= 0;
+    for (int j = 0, start = 0; j < num_segments; ++j) {
+      const int size = vector_->GetContiguousSegment(j).size();
+      const int begin = std::max(start, first_element_);
+      const int end = std::min(start + size, first_element_ + num_elements_);
+      if (begin < end) {
+        segment_table_.push_back({j, begin - start, end - begin});
+      }
+      start += size;
+    }
   }
 
   /// Constructs an empty subvector.
@@ -57,10 +73,33 @@ class Subvector : public VectorBase<T> {
     return (*vector_)[first_element_ + index];
   }
 
+  int DoGetNumContiguousSegments() const override {
+    return is_contiguous_ ? static_cast<int>(segment_table_.size()) : -1;
+  }
+
+  std::pair<const T*, int> DoGetContiguousSegment(int i) const override {
+    const SegmentEntry& entry = segment_table_[i];
+    const auto segment = vector_->GetContiguousSegment(entry.segment);
+    return {segment.data() + entry.offset, entry.size};
+  }
+
  private:
+  // A piece of the contiguous segment at index `segment` of vector_, which
+  // starts `offset` elements into it.
+  struct SegmentEntry {
+    int segment;
+    int offset;
+    int size;
+  };
+
   VectorBase<T>* vector_{nullptr};
   int first_element_{0};
   int num_elements_{0};
+
+  // Whether vector_ is contiguous, in which case these are the contiguous
+  // segments of this subvector, in order.
+  bool is_contiguous_{false};
+  std::vector<SegmentEntry> segment_table_;
 };
 
 }  // namespace systems
@@ -10,6 +10,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/framework/vector_base.h"
 
 namespace drake {
@@ -35,12 +36,85 @@ class Supervector : public VectorBase<T> {
       sum += vec->size();
       lookup_table_.push_back(sum);
     }
+    // This is contiguous when each subvector is; its segments are theirs.
+    for (int i = 0; i < num_subvectors(); ++i) {
+      const int num_segments = vectors_[i]->num_contiguous_segments();
+      if (num_segments < 0) {
+        segment_table_.clear();
+        is_contiguous_ = false;
+        break;
+      }
+      for (int j = 0; j < num_segments; ++j) {
+        segment_table_.emplace_back(i, j);
+      }
+    }
   }
 
   int size() const override {
     return lookup_table_.empty() ? 0 : lookup_table_.back();
   }
 
+  // The bulk operations below are performed subvector by subvector, so that
+  // they reduce to contiguous copies when the subvectors are contiguous (e.g.,
+  // the BasicVectors at the leaves of a Diagram's continuous state), rather
+  // than looking up each element.
+
+  /// Replaces the entire vector with the contents of @p value. When @p value
+  /// is a %Supervector with the same partition, each subvector is set from the
+  /// corresponding subvector of @p value.
+  void SetFrom(const VectorBase<T>& value) override {
+    DRAKE_THROW_UNLESS(value.size() == size());
+    const auto* other = dynamic_cast<const Supervector<T>*>(&value);
+    if (other == nullptr || other->lookup_table_ != lookup_table_) {
+      VectorBase<T>::SetFrom(value);
+      return;
+    }
+    for (int i = 0; i < num_subvectors(); ++i) {
+      vectors_[i]->SetFrom(*other->vectors_[i]);
+    }
+  }
+
+  void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) override {
+    DRAKE_THROW_UNLESS(value.rows() == size());
+    for (int i = 0; i < num_subvectors(); ++i) {
+      vectors_[i]->SetFromVector(
+          value.segment(subvector_start(i), vectors_[i]->size()));
+    }
+  }
+
+  void SetZero() override {
+    for (VectorBase<T>* vec : vectors_) {
+      vec->SetZero();
+    }
+  }
+
+  VectorX<T> CopyToVector() const override {
+    VectorX<T> vec(size());
+    CopyToPreSizedVector(&vec);
+    return vec;
+  }
+
+  void CopyToPreSizedVector(EigenPtr<VectorX<T>> vec) const override {
+    DRAKE_THROW_UNLESS(vec != nullptr);
+    DRAKE_THROW_UNLESS(vec->rows() == size());
+    for (int i = 0; i < num_subvectors(); ++i) {
+      auto segment = vec->segment(subvector_start(i), vectors_[i]->size());
+      vectors_[i]->CopyToPreSizedVector(&segment);
+    }
+  }
+
+  void ScaleAndAddToVector(const T& scale,
+                           EigenPtr<VectorX<T>> vec) const override {
+    DRAKE_THROW_UNLESS(vec != nullptr);
+    if (vec->rows() != size()) {
+      throw std::out_of_range("Addends must be the same size.");
+    }
+    for (int i = 0; i < num_subvectors(); ++i) {
+      auto segment = vec->segment(subvector_start(i), vectors_[i]->size());
+      vectors_[i]->ScaleAndAddToVector(scale, &segment);
+    }
+  }
+
  protected:
   const T& DoGetAtIndex(int index) const override {
     const auto target = GetSubvectorAndOffset(index);
@@ -52,6 +126,17 @@ class Supervector : public VectorBase<T> {
     return (*target.first)[target.second];
   }
 
+  int DoGetNumContiguousSegments() const override {
+    return is_contiguous_ ? static_cast<int>(segment_table_.size()) : -1;
+  }
+
+  std::pair<const T*, int> DoGetContiguousSegment(int i) const override {
+    const std::pair<int, int>& entry = segment_table_[i];
+    const auto segment =
+        vectors_[entry.first]->GetContiguousSegment(entry.second);
+    return {segment.data(), static_cast<int>(segment.size())};
+  }
+
  private:
   // Given an index into the supervector, returns the subvector that
   // contains that index, and its offset within the subvector. This operation
@@ -87,6 +172,14 @@ class Supervector : public VectorBase<T> {
     return std::make_pair(subvector, index - start_of_subvector);
   }
 
+  int num_subvectors() const { return static_cast<int>(vectors_.size()); }
+
+  // Returns the index in the supervector of the first element of the
+  // subvector at index @p subvector_id.
+  int subvector_start(int subvector_id) const {
+    return subvector_id == 0 ? 0 : lookup_table_[subvector_id - 1];
+  }
+
   // An ordered list of all the constituent vectors in this supervector.
   std::vector<VectorBase<T>*> vectors_;
 
@@ -95,6 +188,12 @@ class Supervector : public VectorBase<T> {
   // For example, if the sizes of the constituent vectors are [1, 3, 5],
   // the lookup table is [1, 4, 9].
   std::vector<int> lookup_table_;
+
+  // Whether every subvector is contiguous, in which case the entry at index N
+  // of segment_table_ is the (subvector, segment within the subvector) pair
+  // of the Nth contiguous segment of this supervector.
+  bool is_contiguous_{true};
+  std::vector<std::pair<int, int>> segment_table_;
 };
 
 }  // namespace systems
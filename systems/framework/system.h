@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -32,6 +34,7 @@
 #include "drake/systems/framework/system_base.h"
 #include "drake/systems/framework/system_constraint.h"
 #include "drake/systems/framework/system_output.h"
+#include "drake/systems/framework/system_profiler.h"
 #include "drake/systems/framework/system_scalar_converter.h"
 #include "drake/systems/framework/witness_function.h"
 
@@ -320,6 +323,8 @@ class System : public SystemBase {
   void Publish(const Context<T>& context,
                const EventCollection<PublishEvent<T>>& events) const {
     DRAKE_ASSERT_VOID(CheckValidContext(context));
+    internal::SystemProfilerScope profile(*this,
+                                          SystemProfilingCategory::kPublish);
     DispatchPublishHandler(context, events);
   }
 
@@ -660,6 +665,7 @@ class System : public SystemBase {
               constraint.description())));
     }
     external_constraints_.emplace_back(std::move(constraint));
+    ClearConvertedSystemsCache();
     return SystemConstraintIndex(constraints_.size() - 1);
   }
 
@@ -693,9 +699,48 @@ class System : public SystemBase {
                            ContinuousState<T>* derivatives) const {
     DRAKE_DEMAND(derivatives != nullptr);
     DRAKE_ASSERT_VOID(CheckValidContext(context));
+    internal::SystemProfilerScope profile(
+        *this, SystemProfilingCategory::kTimeDerivatives);
     DoCalcTimeDerivatives(context, derivatives);
   }
 
+  /// Returns `true` if this %System is able to compute the Jacobian of its
+  /// time derivatives with respect to its continuous state via
+  /// CalcTimeDerivativesJacobian(). This is `false` unless a concrete %System
+  /// overrides DoHasTimeDerivativesJacobian().
+  bool HasTimeDerivativesJacobian() const {
+    return DoHasTimeDerivativesJacobian();
+  }
+
+  /// Calculates the Jacobian `J = ∂xcdot/∂xc` of the time derivatives `xcdot`
+  /// of the continuous state `xc` with respect to `xc`, evaluated at the time,
+  /// state, parameters and inputs in `context`. The Jacobian is returned as a
+  /// sparse matrix, so that systems whose continuous states are largely
+  /// decoupled (e.g., systems formed by many independent bodies) can describe
+  /// it efficiently. Implicit integrators can use this Jacobian (see
+  /// ImplicitIntegrator::JacobianComputationScheme::kSystemProvided) instead
+  /// of approximating it with n or 2n derivative evaluations.
+  ///
+  /// @param context The Context whose contents will be used to evaluate the
+  ///                Jacobian.
+  /// @param[out] J  On return, the `n x n` Jacobian matrix, where `n` is the
+  ///                number of continuous states in `context`.
+  /// @throws std::logic_error if HasTimeDerivativesJacobian() is `false`.
+  void CalcTimeDerivativesJacobian(const Context<T>& context,
+                                   Eigen::SparseMatrix<T>* J) const {
+    DRAKE_DEMAND(J != nullptr);
+    DRAKE_ASSERT_VOID(CheckValidContext(context));
+    if (!HasTimeDerivativesJacobian()) {
+      throw std::logic_error(fmt::format(
+          "System '{}' of type {} does not provide a Jacobian of its time "
+          "derivatives", get_name(), NiceTypeName::Get(*this)));
+    }
+    const int n = context.num_continuous_states();
+    J->resize(n, n);
+    DoCalcTimeDerivativesJacobian(context, J);
+    DRAKE_DEMAND(J->rows() == n && J->cols() == n);
+  }
+
   /// This method is the public entry point for dispatching all discrete
   /// variable update event handlers. Using all the discrete update handlers in
   /// @p events, the method calculates the update `xd(n+1)` to discrete
@@ -707,6 +752,8 @@ class System : public SystemBase {
       const EventCollection<DiscreteUpdateEvent<T>>& events,
       DiscreteValues<T>* discrete_state) const {
     DRAKE_ASSERT_VOID(CheckValidContext(context));
+    internal::SystemProfilerScope profile(
+        *this, SystemProfilingCategory::kDiscreteUpdate);
 
     DispatchDiscreteVariableUpdateHandler(context, events, discrete_state);
   }
@@ -762,7 +809,11 @@ class System : public SystemBase {
     const int discrete_state_dim = state->get_discrete_state().num_groups();
     const int abstract_state_dim = state->get_abstract_state().size();
 
-    DispatchUnrestrictedUpdateHandler(context, events, state);
+    {
+      internal::SystemProfilerScope profile(
+          *this, SystemProfilingCategory::kUnrestrictedUpdate);
+      DispatchUnrestrictedUpdateHandler(context, events, state);
+    }
 
     if (continuous_state_dim != state->get_continuous_state().size() ||
         discrete_state_dim != state->get_discrete_state().num_groups() ||
@@ -1444,6 +1495,24 @@ class System : public SystemBase {
     }
     return result;
   }
+
+  /// Returns a copy of this System converted exactly like ToAutoDiffXd(),
+  /// which is created by the first call and shared by the later ones, until
+  /// this System changes (see ClearConvertedSystemsCache()). This avoids
+  /// rebuilding the converted system (for a Diagram, all of its subsystems)
+  /// for callers, such as optimizers, that use it many times. Since the copy
+  /// is shared, it is const; each caller creates its own Context for it.
+  /// The result is never nullptr.
+  /// @throws std::exception if this System does not support autodiff
+  ///
+  /// @note This method lazily writes to this (const) System, so it must not
+  /// be called concurrently on the same System.
+  std::shared_ptr<const System<AutoDiffXd>> GetConvertedAutoDiffXd() const {
+    if (!converted_autodiff_) {
+      converted_autodiff_ = ToAutoDiffXd();
+    }
+    return converted_autodiff_;
+  }
   //@}
 
   //----------------------------------------------------------------------------
@@ -1506,6 +1575,17 @@ class System : public SystemBase {
     }
     return result;
   }
+
+  /// Returns a copy of this System converted exactly like ToSymbolic(), which
+  /// is shared like that of GetConvertedAutoDiffXd().
+  /// @throws std::exception if this System does not support symbolic
+  std::shared_ptr<const System<symbolic::Expression>> GetConvertedSymbolic()
+      const {
+    if (!converted_symbolic_) {
+      converted_symbolic_ = ToSymbolic();
+    }
+    return converted_symbolic_;
+  }
   //@}
 
   //----------------------------------------------------------------------------
@@ -1564,6 +1644,17 @@ class System : public SystemBase {
   const SystemScalarConverter& get_system_scalar_converter() const {
     return system_scalar_converter_;
   }
+
+  /// Forgets the converted systems shared by GetConvertedAutoDiffXd() and
+  /// GetConvertedSymbolic(), so that the next calls convert this System
+  /// again. AddExternalConstraint() calls this; so must the subclasses'
+  /// methods that modify a System after its construction in a way that the
+  /// scalar conversion copies. The shared systems that were already returned
+  /// remain valid.
+  void ClearConvertedSystemsCache() {
+    converted_autodiff_.reset();
+    converted_symbolic_.reset();
+  }
   //@}
 
   /// Gets the witness functions active for the given state.
@@ -1898,6 +1989,27 @@ class System : public SystemBase {
     DRAKE_DEMAND(derivatives->size() == 0);
   }
 
+  /// Override this method to return `true` if your concrete %System overrides
+  /// DoCalcTimeDerivativesJacobian(). The default implementation returns
+  /// `false`.
+  virtual bool DoHasTimeDerivativesJacobian() const { return false; }
+
+  /// Override this method (along with DoHasTimeDerivativesJacobian()) if your
+  /// concrete %System can compute the Jacobian of its time derivatives with
+  /// respect to its continuous state analytically. The `J` argument is
+  /// non-null and has already been resized to `n x n` (and emptied), where `n`
+  /// is the number of continuous states; only the structurally non-zero
+  /// entries need be set. This method is called only from the public
+  /// non-virtual CalcTimeDerivativesJacobian().
+  ///
+  /// The default implementation aborts, since it must not be called unless
+  /// DoHasTimeDerivativesJacobian() is overridden to return `true`.
+  virtual void DoCalcTimeDerivativesJacobian(const Context<T>& context,
+                                             Eigen::SparseMatrix<T>* J) const {
+    unused(context, J);
+    DRAKE_UNREACHABLE();
+  }
+
   /// Computes the next time at which this System must perform a discrete
   /// action.
   ///
@@ -2381,6 +2493,12 @@ class System : public SystemBase {
   // Functions to convert this system to use alternative scalar types.
   SystemScalarConverter system_scalar_converter_;
 
+  // The converted systems shared by GetConvertedAutoDiffXd() and
+  // GetConvertedSymbolic(), or nullptr until they are first requested.
+  mutable std::shared_ptr<const System<AutoDiffXd>> converted_autodiff_;
+  mutable std::shared_ptr<const System<symbolic::Expression>>
+      converted_symbolic_;
+
   CacheIndex time_derivatives_cache_index_;
   CacheIndex potential_energy_cache_index_;
   CacheIndex kinetic_energy_cache_index_;
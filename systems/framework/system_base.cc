@@ -1,5 +1,7 @@
 #include "drake/systems/framework/system_base.h"
 
+#include <exception>
+
 #include <fmt/format.h>
 
 #include "drake/systems/framework/fixed_input_port_value.h"
@@ -52,6 +54,25 @@ const CacheEntry& SystemBase::DeclareCacheEntryWithKnownTicket(
   return new_entry;
 }
 
+void SystemBase::FreezeCacheForConcurrentEvaluation(
+    const ContextBase& context) const {
+  DRAKE_ASSERT_VOID(ThrowIfContextNotCompatible(context));
+  // All of the values are computed before any subcontext is frozen, since the
+  // computation of one may evaluate those of other subcontexts.
+  DoEvalAllCacheEntries(context);
+  context.FreezeCache();
+}
+
+void SystemBase::DoEvalAllCacheEntries(const ContextBase& context) const {
+  for (const auto& entry : cache_entries_) {
+    try {
+      entry->EvalAbstract(context);
+    } catch (const std::exception&) {
+      // The entry stays out of date; see FreezeCacheForConcurrentEvaluation().
+    }
+  }
+}
+
 void SystemBase::InitializeContextBase(ContextBase* context_ptr) const {
   DRAKE_DEMAND(context_ptr != nullptr);
   ContextBase& context = *context_ptr;
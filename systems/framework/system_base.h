@@ -244,6 +244,18 @@ class SystemBase : public internal::SystemMessageInterface {
     return *cache_entries_[index];
   }
 
+  /** (Advanced) Prepares the given `context` to be read by several threads at
+  once. Every cache entry of this System, and of its subsystems if it is a
+  Diagram, is brought up to date in `context`, and then the cache of `context`
+  and of its subcontexts is frozen; see ContextBase::FreezeCache() for what a
+  frozen cache guarantees to concurrent readers. A cache entry whose Calc()
+  throws (for instance, because it needs an unconnected input port) is left out
+  of date, and evaluating it throws for as long as the cache remains frozen.
+  Call ContextBase::UnfreezeCache() before modifying `context` again.
+  @pre `context` is compatible with this System and caching is not disabled in
+       it. */
+  void FreezeCacheForConcurrentEvaluation(const ContextBase& context) const;
+
   // TODO(sherm1) Consider whether to make DeclareCacheEntry methods protected.
   //============================================================================
   /** @name                    Declare cache entries
@@ -1044,6 +1056,19 @@ class SystemBase : public internal::SystemMessageInterface {
   builds. */
   virtual void DoCheckValidContext(const ContextBase&) const = 0;
 
+  /** Brings every cache entry of this System up to date in `context`, leaving
+  out of date those whose Calc() throws. A Diagram overrides this to do the
+  same for each of its subsystems, in their subcontexts; use
+  EvalAllCacheEntries() to invoke it on another System.
+  @see FreezeCacheForConcurrentEvaluation() */
+  virtual void DoEvalAllCacheEntries(const ContextBase& context) const;
+
+  /** Invokes DoEvalAllCacheEntries() on the given `system`. */
+  static void EvalAllCacheEntries(const SystemBase& system,
+                                  const ContextBase& context) {
+    system.DoEvalAllCacheEntries(context);
+  }
+
  private:
   void CreateSourceTrackers(ContextBase*) const;
 
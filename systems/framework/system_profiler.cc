@@ -0,0 +1,191 @@
+#include "drake/systems/framework/system_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+std::atomic<SystemProfiler*>& active_profiler() {
+  static std::atomic<SystemProfiler*> profiler{nullptr};
+  return profiler;
+}
+
+const char* CategoryName(SystemProfilingCategory category) {
+  switch (category) {
+    case SystemProfilingCategory::kTimeDerivatives: return "derivatives";
+    case SystemProfilingCategory::kDiscreteUpdate: return "discrete update";
+    case SystemProfilingCategory::kUnrestrictedUpdate:
+      return "unrestricted update";
+    case SystemProfilingCategory::kPublish: return "publish";
+    case SystemProfilingCategory::kCacheEntry: return "cache entry";
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// Returns a JSON string literal for `text`.
+std::string JsonString(const std::string& text) {
+  std::string quoted = "\"";
+  for (char c : text) {
+    switch (c) {
+      case '"': quoted += "\\\""; break;
+      case '\\': quoted += "\\\\"; break;
+      case '\n': quoted += "\\n"; break;
+      case '\t': quoted += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          quoted += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          quoted += c;
+        }
+    }
+  }
+  return quoted + "\"";
+}
+
+}  // namespace
+
+SystemProfiler::SystemProfiler() : epoch_(Clock::now()) {}
+
+SystemProfiler::~SystemProfiler() {
+  // Deactivate this profiler if it is still active, so that computations
+  // don't record into a destroyed profiler.
+  SystemProfiler* expected = this;
+  active_profiler().compare_exchange_strong(expected, nullptr);
+}
+
+SystemProfiler* SystemProfiler::active() {
+  return active_profiler().load(std::memory_order_acquire);
+}
+
+void SystemProfiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  epoch_ = Clock::now();
+  entry_indices_.clear();
+  entries_.clear();
+  trace_events_.clear();
+  thread_indices_.clear();
+}
+
+void SystemProfiler::Record(const internal::SystemMessageInterface& system,
+                            SystemProfilingCategory category,
+                            const std::string* detail,
+                            Clock::time_point start, Clock::time_point end) {
+  const Clock::duration duration = end - start;
+  const double seconds = std::chrono::duration<double>(duration).count();
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto found = entry_indices_.emplace(
+      std::make_tuple(&system, category, detail),
+      static_cast<int>(entries_.size()));
+  const int entry_index = found.first->second;
+  if (found.second) {
+    // The pathname is only generated the first time the system is seen.
+    Entry entry;
+    entry.name = system.GetSystemPathname();
+    if (detail != nullptr) entry.name += ":" + *detail;
+    entry.category = category;
+    entries_.push_back(std::move(entry));
+  }
+  Entry& entry = entries_[entry_index];
+  ++entry.num_calls;
+  entry.total_time += seconds;
+  entry.max_time = std::max(entry.max_time, seconds);
+  if (record_trace_events_) {
+    const int thread_index =
+        thread_indices_
+            .emplace(std::this_thread::get_id(),
+                     static_cast<int>(thread_indices_.size()))
+            .first->second;
+    trace_events_.push_back(
+        TraceEvent{entry_index, thread_index, start, duration});
+  }
+}
+
+std::vector<SystemProfiler::Entry> SystemProfiler::GetEntries() const {
+  std::vector<Entry> entries;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries = entries_;
+  }
+  // Ties are broken so that the order is repeatable.
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) {
+              return std::make_tuple(-a.total_time, a.name, a.category) <
+                     std::make_tuple(-b.total_time, b.name, b.category);
+            });
+  return entries;
+}
+
+std::string SystemProfiler::GetReport(
+    SystemProfilingReportFormat format) const {
+  std::string report;
+  switch (format) {
+    case SystemProfilingReportFormat::kText: {
+      report += "Systems by cumulative wall-clock time:\n";
+      report += fmt::format("{:>14} {:>12} {:>14}  {:<20} {}\n",
+                            "total time (s)", "calls", "max time (s)",
+                            "category", "system");
+      for (const Entry& entry : GetEntries()) {
+        report += fmt::format("{:>14.6f} {:>12} {:>14.6f}  {:<20} {}\n",
+                              entry.total_time, entry.num_calls,
+                              entry.max_time, CategoryName(entry.category),
+                              entry.name);
+      }
+      break;
+    }
+    case SystemProfilingReportFormat::kChromeTrace: {
+      std::lock_guard<std::mutex> lock(mutex_);
+      report += "{\"traceEvents\": [";
+      for (size_t i = 0; i < trace_events_.size(); ++i) {
+        const TraceEvent& event = trace_events_[i];
+        const Entry& entry = entries_[event.entry_index];
+        using Microseconds = std::chrono::duration<double, std::micro>;
+        report += fmt::format(
+            "{}\n  {{\"name\": {}, \"cat\": {}, \"ph\": \"X\", "
+            "\"ts\": {}, \"dur\": {}, \"pid\": 0, \"tid\": {}}}",
+            i == 0 ? "" : ",", JsonString(entry.name),
+            JsonString(CategoryName(entry.category)),
+            Microseconds(event.start - epoch_).count(),
+            Microseconds(event.duration).count(), event.thread_index);
+      }
+      report += "],\n\"displayTimeUnit\": \"ms\"}\n";
+      break;
+    }
+  }
+  return report;
+}
+
+namespace internal {
+
+ScopedSystemProfilerActivation::ScopedSystemProfilerActivation(
+    SystemProfiler* profiler) {
+  if (profiler == nullptr) return;
+  SystemProfiler* expected = nullptr;
+  if (active_profiler().compare_exchange_strong(expected, profiler)) {
+    activated_ = profiler;
+  } else if (expected != profiler) {
+    throw std::logic_error(
+        "Cannot activate a SystemProfiler while another one is active.");
+  }
+}
+
+ScopedSystemProfilerActivation::~ScopedSystemProfilerActivation() {
+  if (activated_ != nullptr) {
+    active_profiler().store(nullptr);
+  }
+}
+
+}  // namespace internal
+
+}  // namespace systems
+}  // namespace drake
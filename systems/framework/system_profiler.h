@@ -0,0 +1,196 @@
+#pragma once
+
+/** @file
+Declares SystemProfiler, which attributes the wall-clock time spent in System
+computations to the systems performing them. */
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/framework_common.h"
+
+namespace drake {
+namespace systems {
+
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+class ScopedSystemProfilerActivation;
+class SystemProfilerScope;
+}  // namespace internal
+#endif
+
+/** The kinds of System computations timed by a SystemProfiler. */
+enum class SystemProfilingCategory {
+  kTimeDerivatives,     ///< System::CalcTimeDerivatives().
+  kDiscreteUpdate,      ///< System::CalcDiscreteVariableUpdates().
+  kUnrestrictedUpdate,  ///< System::CalcUnrestrictedUpdate().
+  kPublish,             ///< System::Publish().
+  kCacheEntry,          ///< CacheEntry::Calc(), including output ports.
+};
+
+/** The formats of the report produced by SystemProfiler::GetReport(). */
+enum class SystemProfilingReportFormat {
+  kText,         ///< Aligned columns meant to be read by a human.
+  kChromeTrace,  ///< Trace Event JSON, as loaded by `chrome://tracing`.
+};
+
+/** (Debugging) Measures the wall-clock time spent in the computations of each
+System, to find out which ones hold back a slow simulation. While a profiler
+is active (see Simulator::set_system_profiler()), every call to the System
+methods CalcTimeDerivatives(), CalcDiscreteVariableUpdates(),
+CalcUnrestrictedUpdate(), and Publish() is timed, as is every CacheEntry
+Calc() (which covers the computation of output ports, whether through
+OutputPort::Calc() or OutputPort::Eval()). Calls are aggregated per system
+pathname (see SystemBase::GetSystemPathname()), category, and cache entry.
+
+Times are inclusive: those of a Diagram include those of its subsystems, and
+those of a cache entry include those of the cache entries it evaluates.
+Computations made while no profiler is active are unaffected beyond a single
+atomic load.
+
+At most one profiler may be active at a time in a process. The profiler may
+be activated from one thread and record computations from several threads,
+as happens for a Diagram with Diagram::set_max_num_threads() greater than
+one. */
+class SystemProfiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SystemProfiler)
+
+  /** The aggregated timings of one kind of computation of one system. */
+  struct Entry {
+    /** The system pathname, followed by the cache entry description for
+    SystemProfilingCategory::kCacheEntry. */
+    std::string name;
+    SystemProfilingCategory category{};
+    int64_t num_calls{0};
+    /** The cumulative wall-clock time in seconds. */
+    double total_time{0};
+    /** The longest single call in seconds. */
+    double max_time{0};
+  };
+
+  SystemProfiler();
+  ~SystemProfiler();
+
+  /** Sets whether each individual call is recorded (besides being
+  aggregated), as needed by SystemProfilingReportFormat::kChromeTrace. This
+  is off by default since the memory used then grows with the number of
+  calls. */
+  void set_record_trace_events(bool record) { record_trace_events_ = record; }
+
+  /** Returns true if individual calls are recorded. */
+  bool get_record_trace_events() const { return record_trace_events_; }
+
+  /** Forgets all timings recorded so far. */
+  void Reset();
+
+  /** Returns the aggregated timings, sorted by decreasing total time. */
+  std::vector<Entry> GetEntries() const;
+
+  /** Returns a report of the timings recorded so far. The text format lists
+  the aggregated timings of GetEntries(). The Chrome trace format lists the
+  individual calls on a timeline (one row per thread), and is empty unless
+  set_record_trace_events() was enabled. Times are in seconds in the text
+  format and in microseconds in the Chrome trace format. */
+  std::string GetReport(
+      SystemProfilingReportFormat format =
+          SystemProfilingReportFormat::kText) const;
+
+  /** Returns the profiler currently active in this process, if any. */
+  static SystemProfiler* active();
+
+ private:
+  friend class internal::ScopedSystemProfilerActivation;
+  friend class internal::SystemProfilerScope;
+
+  using Clock = std::chrono::steady_clock;
+
+  struct TraceEvent {
+    int entry_index{};
+    int thread_index{};
+    Clock::time_point start;
+    Clock::duration duration{};
+  };
+
+  // Records a call to the computation of the given category of the given
+  // system, optionally specialized by the given (persistent) detail string.
+  void Record(const internal::SystemMessageInterface& system,
+              SystemProfilingCategory category, const std::string* detail,
+              Clock::time_point start, Clock::time_point end);
+
+  bool record_trace_events_{false};
+
+  mutable std::mutex mutex_;
+  Clock::time_point epoch_;
+  // The index of the entry for each (system, category, detail).
+  std::map<std::tuple<const internal::SystemMessageInterface*,
+                      SystemProfilingCategory, const std::string*>,
+           int>
+      entry_indices_;
+  std::vector<Entry> entries_;
+  std::vector<TraceEvent> trace_events_;
+  std::map<std::thread::id, int> thread_indices_;
+};
+
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+
+// Makes the given profiler, if not null, the active one for the lifetime of
+// this object. Activating the profiler that is already active does nothing.
+// Throws std::logic_error if another profiler is already active.
+class ScopedSystemProfilerActivation {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedSystemProfilerActivation)
+
+  explicit ScopedSystemProfilerActivation(SystemProfiler* profiler);
+  ~ScopedSystemProfilerActivation();
+
+ private:
+  SystemProfiler* activated_{nullptr};
+};
+
+// Times the computation spanning the lifetime of this object with the active
+// profiler, if any.
+class SystemProfilerScope {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SystemProfilerScope)
+
+  SystemProfilerScope(const SystemMessageInterface& system,
+                      SystemProfilingCategory category,
+                      const std::string* detail = nullptr)
+      : profiler_(SystemProfiler::active()) {
+    if (profiler_ != nullptr) {
+      system_ = &system;
+      category_ = category;
+      detail_ = detail;
+      start_ = SystemProfiler::Clock::now();
+    }
+  }
+
+  ~SystemProfilerScope() {
+    if (profiler_ != nullptr) {
+      profiler_->Record(*system_, category_, detail_, start_,
+                        SystemProfiler::Clock::now());
+    }
+  }
+
+ private:
+  SystemProfiler* const profiler_;
+  const SystemMessageInterface* system_{nullptr};
+  SystemProfilingCategory category_{};
+  const std::string* detail_{nullptr};
+  SystemProfiler::Clock::time_point start_;
+};
+
+}  // namespace internal
+#endif
+
+}  // namespace systems
+}  // namespace drake
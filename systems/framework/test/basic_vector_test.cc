@@ -1,6 +1,7 @@
 #include "drake/systems/framework/basic_vector.h"
 
 #include <cmath>
+#include <memory>
 #include <sstream>
 
 #include <Eigen/Dense>
@@ -10,6 +11,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/framework/fixed_basic_vector.h"
 #include "drake/systems/framework/test_utilities/my_vector.h"
 
 namespace drake {
@@ -238,6 +240,26 @@ GTEST_TEST(BasicVectorTest, ValuesAccess) {
   EXPECT_EQ(const_dut.values()[0], 33.0);
 }
 
+// Tests the fixed-size views of a FixedBasicVector, and that it keeps its type
+// when cloned through BasicVector.
+GTEST_TEST(BasicVectorTest, FixedBasicVector) {
+  FixedBasicVector<double, 3> vec;
+  EXPECT_EQ(vec.size(), 3);
+  EXPECT_TRUE(std::isnan(vec[0]));
+
+  vec.get_mutable_fixed_value() = Eigen::Vector3d(1, 2, 3);
+  EXPECT_EQ(vec.get_value(), Eigen::Vector3d(1, 2, 3));
+  vec.get_mutable_value()[1] = 5;
+  EXPECT_EQ(vec.get_fixed_value(), Eigen::Vector3d(1, 5, 3));
+
+  const BasicVector<double>& basic = vec;
+  std::unique_ptr<BasicVector<double>> clone = basic.Clone();
+  auto* fixed_clone = dynamic_cast<FixedBasicVector<double, 3>*>(clone.get());
+  ASSERT_NE(fixed_clone, nullptr);
+  EXPECT_EQ(fixed_clone->get_fixed_value(), Eigen::Vector3d(1, 5, 3));
+  EXPECT_EQ(vec.Clone()->get_fixed_value(), Eigen::Vector3d(1, 5, 3));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -12,8 +12,12 @@
 // The Context side tests are provided in cache_test.cc; we are testing the
 // System side here.
 
+#include <atomic>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -752,6 +756,135 @@ TEST_F(CacheEntryTest, Copy) {
   EXPECT_FALSE(vector_entry().is_out_of_date(clone_context));
 }
 
+// Profiling should count hits, evaluations, and invalidations, and attribute
+// each invalidation to the prerequisite that caused it. See the diagram above
+// for the expected dependencies.
+TEST_F(CacheEntryTest, ProfilingWorks) {
+  const CacheEntryValue& value0 = entry0().get_cache_entry_value(context_);
+  const CacheEntryValue& value1 = entry1().get_cache_entry_value(context_);
+  EXPECT_FALSE(value1.is_profiling_enabled());
+  context_.EnableCacheProfiling();
+  EXPECT_TRUE(value0.is_profiling_enabled());
+  EXPECT_TRUE(value1.is_profiling_enabled());
+  EXPECT_FALSE(value1.is_ready_to_use());
+  EXPECT_FALSE(value1.needs_recomputation());
+
+  // Everything starts out up to date so this is a hit.
+  EXPECT_EQ(entry1().Eval<int>(context_), 1);
+  EXPECT_EQ(value1.num_hits(), 1);
+  EXPECT_EQ(value1.num_evaluations(), 0);
+
+  // A time change invalidates entry0 through all_sources, and entry1 through
+  // entry0.
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(1001);
+  EXPECT_EQ(value0.num_invalidations(), 1);
+  EXPECT_EQ(value0.invalidations_by_prerequisite().at(
+                system_.all_sources_ticket()), 1);
+  EXPECT_EQ(value1.num_invalidations(), 1);
+  EXPECT_EQ(value1.invalidations_by_prerequisite().at(entry0().ticket()), 1);
+
+  // Only entry1 is recomputed; its Calc() doesn't evaluate entry0.
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);
+  EXPECT_EQ(value1.num_evaluations(), 1);
+  EXPECT_EQ(value1.num_hits(), 1);
+  EXPECT_GE(value1.cumulative_calc_time(), 0.0);
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);
+  EXPECT_EQ(value1.num_hits(), 2);
+
+  // entry0 is already out of date so this doesn't count as an invalidation of
+  // entry0, but it does invalidate the recomputed entry1 again.
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(1002);
+  EXPECT_EQ(value0.num_invalidations(), 1);
+  EXPECT_EQ(value1.num_invalidations(), 2);
+
+  // The entry0->entry1 edge caused the most invalidations.
+  const std::string entry1_path = value1.GetPathDescription();
+  const std::string entry0_tracker_path =
+      context_.get_tracker(entry0().ticket()).GetPathDescription();
+  const std::string csv =
+      context_.GetCacheProfilingReport(CacheProfilingReportFormat::kCsv);
+  EXPECT_EQ(csv.find("kind,cache_entry,prerequisite,"), 0);
+  const std::string edge_row =
+      "\nedge," + entry1_path + "," + entry0_tracker_path + ",,,,2\n";
+  EXPECT_NE(csv.find(edge_row), std::string::npos);
+  EXPECT_EQ(csv.find("\nedge,"), csv.find(edge_row));
+  EXPECT_NE(csv.find("\nentry," + entry1_path + ",,"), std::string::npos);
+
+  const std::string text = context_.GetCacheProfilingReport();
+  EXPECT_NE(text.find(entry0_tracker_path + " -> " + entry1_path),
+            std::string::npos);
+  const std::string json =
+      context_.GetCacheProfilingReport(CacheProfilingReportFormat::kJson);
+  EXPECT_EQ(json.find("{\"entries\": ["), 0);
+  EXPECT_NE(json.find("\"prerequisite\": \"" + entry0_tracker_path + "\""),
+            std::string::npos);
+
+  // Disabling retains the statistics but stops gathering them.
+  context_.DisableCacheProfiling();
+  EXPECT_FALSE(value1.is_profiling_enabled());
+  entry1().Eval<int>(context_);
+  entry1().Eval<int>(context_);
+  EXPECT_EQ(value1.num_evaluations(), 1);
+  EXPECT_EQ(value1.num_hits(), 2);
+
+  context_.ResetCacheProfilingStatistics();
+  EXPECT_EQ(value1.num_evaluations(), 0);
+  EXPECT_EQ(value1.num_hits(), 0);
+  EXPECT_EQ(value1.num_invalidations(), 0);
+  EXPECT_TRUE(value1.invalidations_by_prerequisite().empty());
+  EXPECT_EQ(context_.GetCacheProfilingReport().find(entry1_path),
+            std::string::npos);
+}
+
+// A frozen Context may be read by several threads at once. Preparing it for
+// that brings every cache entry up to date first.
+TEST_F(CacheEntryTest, ConcurrentEvaluationOfFrozenContext) {
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(1001);
+  context_.get_tracker(system_.xc_ticket()).NoteValueChange(1002);
+  EXPECT_TRUE(entry1().is_out_of_date(context_));
+  EXPECT_TRUE(vector_entry().is_out_of_date(context_));
+
+  system_.FreezeCacheForConcurrentEvaluation(context_);
+  EXPECT_TRUE(context_.is_cache_frozen());
+  for (CacheIndex i(0); i < system_.num_cache_entries(); ++i) {
+    EXPECT_FALSE(system_.get_cache_entry(i).is_out_of_date(context_));
+  }
+
+  // Profiling hits aren't counted while the cache is frozen, so that reading
+  // it doesn't write anything.
+  context_.EnableCacheProfiling();
+  std::vector<std::thread> threads;
+  std::atomic<int> num_mismatches{0};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([this, &num_mismatches]() {
+      for (int i = 0; i < 1000; ++i) {
+        if (entry0().Eval<int>(context_) != 99 ||
+            entry1().Eval<int>(context_) != 98 ||
+            entry5().Eval<int>(context_) != 11 ||
+            string_entry().Eval<string>(context_) != "calculated_result" ||
+            vector_entry().Eval<MyVector3d>(context_).get_value() !=
+                Vector3d(3., 2., 1.)) {
+          ++num_mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(num_mismatches, 0);
+  EXPECT_EQ(entry1().get_cache_entry_value(context_).num_hits(), 0);
+  context_.DisableCacheProfiling();
+
+  // An entry that went out of date can't be computed until the cache is
+  // unfrozen.
+  context_.UnfreezeCache();
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(1003);
+  context_.FreezeCache();
+  DRAKE_EXPECT_THROWS_MESSAGE(entry1().Eval<int>(context_), std::logic_error,
+                              ".*entry1.*cache is frozen.*");
+  context_.UnfreezeCache();
+  EXPECT_EQ(entry1().Eval<int>(context_), 98);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
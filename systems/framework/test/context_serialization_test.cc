@@ -0,0 +1,174 @@
+#include "drake/systems/framework/context_serialization.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+// A system with every kind of state and parameter.
+class StatefulSystem : public LeafSystem<double> {
+ public:
+  explicit StatefulSystem(int num_discrete) {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(num_discrete);
+    DeclareDiscreteState(1);
+    DeclareAbstractState(AbstractValue::Make<int>(1));
+    DeclareAbstractState(AbstractValue::Make<std::string>("initial"));
+    DeclareAbstractState(AbstractValue::Make<VectorXd>(VectorXd::Zero(2)));
+    DeclareNumericParameter(BasicVector<double>(Vector3d(1, 2, 3)));
+    DeclareAbstractParameter(Value<double>(0.5));
+    DeclareAbstractParameter(Value<bool>(false));
+  }
+};
+
+// A system whose abstract state cannot be serialized.
+class UnsupportedSystem : public LeafSystem<double> {
+ public:
+  UnsupportedSystem() {
+    DeclareAbstractState(AbstractValue::Make<std::vector<int>>({1, 2}));
+  }
+};
+
+std::unique_ptr<Diagram<double>> MakeDiagram(int num_discrete = 3) {
+  DiagramBuilder<double> builder;
+  builder.AddSystem<StatefulSystem>(num_discrete);
+  builder.AddSystem<StatefulSystem>(num_discrete);
+  return builder.Build();
+}
+
+// Changes every value in the context of a diagram made by MakeDiagram().
+void Modify(const Diagram<double>& diagram, Context<double>* context) {
+  context->SetTime(1.25);
+  context->SetAccuracy(1e-4);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Vector2d(4, 5).replicate(2, 1));
+  for (int i = 0; i < 2; ++i) {
+    const System<double>& system = *diagram.GetSystems()[i];
+    Context<double>& subcontext =
+        diagram.GetMutableSubsystemContext(system, context);
+    subcontext.get_mutable_discrete_state(0).SetFromVector(
+        Vector3d(6, 7, 8) * (i + 1));
+    subcontext.get_mutable_discrete_state(1)[0] = 9;
+    subcontext.get_mutable_abstract_state<int>(0) = 10 + i;
+    subcontext.get_mutable_abstract_state<std::string>(1) = "modified";
+    subcontext.get_mutable_abstract_state<VectorXd>(2) = Vector3d(11, 12, 13);
+    subcontext.get_mutable_numeric_parameter(0).SetFromVector(
+        Vector3d(14, 15, 16));
+    subcontext.get_mutable_abstract_parameter(0).get_mutable_value<double>() =
+        17;
+    subcontext.get_mutable_abstract_parameter(1).get_mutable_value<bool>() =
+        true;
+  }
+}
+
+void ExpectModified(const Diagram<double>& diagram,
+                    const Context<double>& context) {
+  EXPECT_EQ(context.get_time(), 1.25);
+  EXPECT_EQ(context.get_accuracy(), optional<double>(1e-4));
+  EXPECT_TRUE(CompareMatrices(
+      context.get_continuous_state_vector().CopyToVector(),
+      Eigen::Vector4d(4, 5, 4, 5)));
+  for (int i = 0; i < 2; ++i) {
+    const System<double>& system = *diagram.GetSystems()[i];
+    const Context<double>& subcontext =
+        diagram.GetSubsystemContext(system, context);
+    EXPECT_TRUE(CompareMatrices(subcontext.get_discrete_state(0).get_value(),
+                                Vector3d(6, 7, 8) * (i + 1)));
+    EXPECT_EQ(subcontext.get_discrete_state(1)[0], 9);
+    EXPECT_EQ(subcontext.get_abstract_state<int>(0), 10 + i);
+    EXPECT_EQ(subcontext.get_abstract_state<std::string>(1), "modified");
+    EXPECT_TRUE(CompareMatrices(subcontext.get_abstract_state<VectorXd>(2),
+                                Vector3d(11, 12, 13)));
+    EXPECT_TRUE(CompareMatrices(subcontext.get_numeric_parameter(0).get_value(),
+                                Vector3d(14, 15, 16)));
+    EXPECT_EQ(subcontext.get_abstract_parameter(0).get_value<double>(), 17);
+    EXPECT_TRUE(subcontext.get_abstract_parameter(1).get_value<bool>());
+  }
+}
+
+GTEST_TEST(ContextSerializationTest, RoundTrip) {
+  const auto diagram = MakeDiagram();
+  auto context = diagram->CreateDefaultContext();
+  Modify(*diagram, context.get());
+  const std::vector<uint8_t> snapshot = SerializeContext(*context);
+  EXPECT_EQ(snapshot.size() % 8, 0);
+
+  auto restored = diagram->CreateDefaultContext();
+  DeserializeContext(snapshot, restored.get());
+  ExpectModified(*diagram, *restored);
+
+  // A context without accuracy restores as such.
+  auto fresh = diagram->CreateDefaultContext();
+  DeserializeContext(SerializeContext(*fresh), restored.get());
+  EXPECT_FALSE(restored->get_accuracy());
+  EXPECT_EQ(restored->get_time(), 0);
+}
+
+GTEST_TEST(ContextSerializationTest, SaveAndLoad) {
+  const auto diagram = MakeDiagram();
+  auto context = diagram->CreateDefaultContext();
+  Modify(*diagram, context.get());
+  const std::string filename = temp_directory() + "/context.snapshot";
+  SaveContextSnapshot(*context, filename);
+
+  auto restored = diagram->CreateDefaultContext();
+  LoadContextSnapshot(filename, restored.get());
+  ExpectModified(*diagram, *restored);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadContextSnapshot(temp_directory() + "/missing", restored.get()),
+      std::runtime_error, "Failed to open context snapshot.*");
+}
+
+GTEST_TEST(ContextSerializationTest, Mismatch) {
+  const auto diagram = MakeDiagram();
+  const std::vector<uint8_t> snapshot =
+      SerializeContext(*diagram->CreateDefaultContext());
+
+  const auto other = MakeDiagram(4);
+  auto other_context = other->CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      DeserializeContext(snapshot, other_context.get()), std::runtime_error,
+      "DeserializeContext\\(\\): the snapshot has 3 discrete state variables "
+      "but the context has 4");
+
+  auto context = diagram->CreateDefaultContext();
+  std::vector<uint8_t> truncated(snapshot.begin(), snapshot.end() - 8);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      DeserializeContext(truncated, context.get()), std::runtime_error,
+      "DeserializeContext\\(\\): truncated snapshot");
+
+  std::vector<uint8_t> corrupted = snapshot;
+  corrupted[0] = 'X';
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      DeserializeContext(corrupted, context.get()), std::runtime_error,
+      "DeserializeContext\\(\\): not a context snapshot.*");
+}
+
+GTEST_TEST(ContextSerializationTest, UnsupportedAbstractValue) {
+  const UnsupportedSystem system;
+  auto context = system.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SerializeContext(*context), std::logic_error,
+      "SerializeContext\\(\\): abstract values of type std::vector<int.*> are "
+      "not supported");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
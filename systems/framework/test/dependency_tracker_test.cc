@@ -432,6 +432,81 @@ TEST_F(HandBuiltDependencies, Notify) {
   ExpectAllStatsMatch();
 }
 
+// Check that flattened trackers invalidate the same cache entries as the
+// recursive sweep, attributed to the same prerequisites, and that changing a
+// subscription reverts the affected trackers to recursive sweeps.
+TEST_F(HandBuiltDependencies, FlattenedInvalidation) {
+  context_.FlattenInvalidation();
+  for (const DependencyTracker* tracker :
+       {time_tracker_, upstream1_, upstream2_, middle1_, downstream1_,
+        downstream2_, entry0_tracker_}) {
+    EXPECT_TRUE(tracker->is_invalidation_flattened()) << tracker->description();
+  }
+  // entry0 is the only cache entry downstream of upstream1; depth first, the
+  // recursive sweep reaches it through middle1 -> downstream2 before middle1
+  // -> entry0. downstream1 has no cache entry downstream.
+  EXPECT_EQ(upstream1_->num_flattened_invalidations(), 1);
+  EXPECT_EQ(middle1_->num_flattened_invalidations(), 1);
+  EXPECT_EQ(downstream1_->num_flattened_invalidations(), 0);
+
+  context_.EnableCacheProfiling();
+  entry0_->set_value(1125);
+  upstream1_->NoteValueChange(1LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  EXPECT_EQ(entry0_->num_invalidations(), 1);
+  EXPECT_EQ(
+      entry0_->invalidations_by_prerequisite().at(downstream2_->ticket()), 1);
+  // Only the initiating tracker is notified.
+  up1_stats_.value_change++;
+  ExpectAllStatsMatch();
+
+  // A repeated change event is still ignored.
+  entry0_->mark_up_to_date();
+  upstream1_->NoteValueChange(1LL);
+  up1_stats_.value_change++;
+  up1_stats_.ignored++;
+  ExpectAllStatsMatch();
+  EXPECT_FALSE(entry0_->is_out_of_date());
+
+  // A new subscriber of downstream1 reverts downstream1 and everything
+  // upstream of it, but not middle1's other subscribers.
+  DependencyGraph& graph = context_.get_mutable_dependency_graph();
+  DependencyTracker& extra = graph.CreateNewDependencyTracker("extra");
+  extra.SubscribeToPrerequisite(downstream1_);
+  for (const DependencyTracker* tracker :
+       {upstream1_, upstream2_, middle1_, downstream1_}) {
+    EXPECT_FALSE(tracker->is_invalidation_flattened())
+        << tracker->description();
+    EXPECT_EQ(tracker->num_flattened_invalidations(), 0);
+  }
+  EXPECT_TRUE(downstream2_->is_invalidation_flattened());
+  EXPECT_TRUE(time_tracker_->is_invalidation_flattened());
+
+  upstream2_->NoteValueChange(2LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  up2_stats_.value_change++;
+  up2_stats_.sent++;  // mid1
+  mid1_stats_.prereq_change++;
+  mid1_stats_.sent += 3;  // down1, down2, entry0
+  down1_stats_.prereq_change++;
+  down1_stats_.sent++;  // extra
+  down2_stats_.prereq_change++;
+  down2_stats_.sent++;  // entry0
+  entry0_stats_.prereq_change += 2;
+  entry0_stats_.ignored++;
+  ExpectAllStatsMatch();
+
+  // Clones aren't flattened.
+  auto clone_context = context_.Clone();
+  EXPECT_FALSE(clone_context->get_dependency_graph()
+                   .get_tracker(downstream2_->ticket())
+                   .is_invalidation_flattened());
+
+  context_.UnflattenInvalidation();
+  EXPECT_FALSE(downstream2_->is_invalidation_flattened());
+  EXPECT_FALSE(time_tracker_->is_invalidation_flattened());
+}
+
 // Clone the dependency graph and make sure the clone works like the
 // original did, but on the new entities!
 TEST_F(HandBuiltDependencies, Clone) {
@@ -1029,6 +1029,66 @@ TEST_F(DiagramTest, DiscreteValuesOfStatelessSystemAreEmpty) {
       diagram_->GetSubsystemDiscreteValues(*adder0(), *updates).num_groups());
 }
 
+// Tests that evaluating the subsystems concurrently gives the same time
+// derivatives and discrete updates as evaluating them in sequence. Each of the
+// independent chains k has an integrator with ẋ = (k + 1) x, whose gained
+// output is also sampled by a zero-order hold.
+GTEST_TEST(DiagramParallelTest, CalcSubsystemsConcurrently) {
+  const int kNumChains = 8;
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < kNumChains; ++k) {
+    auto integrator = builder.AddSystem<Integrator<double>>(1);
+    auto gain = builder.AddSystem<Gain<double>>(k + 1.0, 1);
+    auto hold = builder.AddSystem<ZeroOrderHold<double>>(0.1, 1);
+    builder.Connect(integrator->get_output_port(), gain->get_input_port());
+    builder.Connect(gain->get_output_port(), integrator->get_input_port());
+    builder.Connect(gain->get_output_port(), hold->get_input_port());
+  }
+  auto diagram = builder.Build();
+  EXPECT_EQ(diagram->max_num_threads(), 1);
+  EXPECT_THROW(diagram->set_max_num_threads(0), std::exception);
+
+  auto context = diagram->CreateDefaultContext();
+  const int num_states = context->num_continuous_states();
+  ASSERT_EQ(num_states, kNumChains);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Eigen::VectorXd::LinSpaced(num_states, 1.0, 2.0));
+
+  auto events = diagram->AllocateCompositeEventCollection();
+  diagram->CalcNextUpdateTime(*context, events.get());
+  context->SetTime(0.1);
+
+  auto serial_derivatives = diagram->AllocateTimeDerivatives();
+  auto serial_updates = diagram->AllocateDiscreteVariables();
+  diagram->CalcTimeDerivatives(*context, serial_derivatives.get());
+  diagram->CalcDiscreteVariableUpdates(
+      *context, events->get_discrete_update_events(), serial_updates.get());
+
+  diagram->set_max_num_threads(3);
+  EXPECT_EQ(diagram->max_num_threads(), 3);
+  // Start from out-of-date caches, so that the upstream outputs are evaluated
+  // before the concurrent evaluations.
+  auto parallel_context = diagram->CreateDefaultContext();
+  parallel_context->SetTimeStateAndParametersFrom(*context);
+  auto parallel_derivatives = diagram->AllocateTimeDerivatives();
+  auto parallel_updates = diagram->AllocateDiscreteVariables();
+  diagram->CalcTimeDerivatives(*parallel_context, parallel_derivatives.get());
+  diagram->CalcDiscreteVariableUpdates(*parallel_context,
+                                       events->get_discrete_update_events(),
+                                       parallel_updates.get());
+
+  EXPECT_EQ(parallel_derivatives->CopyToVector(),
+            serial_derivatives->CopyToVector());
+  ASSERT_EQ(parallel_updates->num_groups(), kNumChains);
+  for (int k = 0; k < kNumChains; ++k) {
+    const double x = context->get_continuous_state_vector()[k];
+    EXPECT_EQ(serial_derivatives->get_vector()[k], (k + 1) * x);
+    EXPECT_EQ(parallel_updates->get_vector(k).CopyToVector(),
+              serial_updates->get_vector(k).CopyToVector());
+    EXPECT_EQ(parallel_updates->get_vector(k)[0], (k + 1) * x);
+  }
+}
+
 class DiagramOfDiagramsTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -1229,6 +1289,38 @@ GTEST_TEST(DiagramSubclassTest, TwelvePlusSevenIsNineteen) {
   EXPECT_EQ(19.0, output_vector->get_value().x());
 }
 
+// An input port connected to an output port that is exported through two
+// levels of Diagrams gets its value (and its invalidations) straight from the
+// leaf output port that computes it.
+GTEST_TEST(DiagramSubclassTest, ConnectionThroughNestedExports) {
+  DiagramBuilder<double> middle_builder;
+  auto plus_seven = middle_builder.AddSystem<AddConstantDiagram>(7.0);
+  middle_builder.ExportInput(plus_seven->get_input_port(0));
+  middle_builder.ExportOutput(plus_seven->get_output_port(0));
+
+  DiagramBuilder<double> builder;
+  auto middle = builder.AddSystem(middle_builder.Build());
+  auto gain = builder.AddSystem<Gain>(2.0 /* k */, 1 /* size */);
+  builder.Connect(middle->get_output_port(0), gain->get_input_port());
+  builder.ExportInput(middle->get_input_port(0));
+  builder.ExportOutput(gain->get_output_port());
+  auto diagram = builder.Build();
+
+  auto context = diagram->CreateDefaultContext();
+  diagram->get_input_port(0).FixValue(context.get(), Vector1d(12.0));
+  EXPECT_EQ(diagram->get_output_port(0).Eval(*context)[0], 38.0);
+  diagram->get_input_port(0).FixValue(context.get(), Vector1d(1.0));
+  EXPECT_EQ(diagram->get_output_port(0).Eval(*context)[0], 16.0);
+
+  // An unconnected subsystem input port is still reported as such.
+  DiagramBuilder<double> open_builder;
+  auto open_gain = open_builder.AddSystem<Gain>(2.0 /* k */, 1 /* size */);
+  auto open_diagram = open_builder.Build();
+  auto open_context = open_diagram->CreateDefaultContext();
+  EXPECT_FALSE(open_gain->get_input_port().HasValue(
+      open_diagram->GetSubsystemContext(*open_gain, *open_context)));
+}
+
 // PublishingSystem has an input port for a single double. It publishes that
 // double to a function provided in the constructor.
 class PublishingSystem : public LeafSystem<double> {
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <gmock/gmock.h>
@@ -665,6 +666,26 @@ TEST_F(LeafSystemTest, UpdateAndPublish) {
   }
 }
 
+// Tests that events sharing a timing all fire together, whether or not that
+// timing is among the first 64 distinct ones declared.
+TEST_F(LeafSystemTest, ManyDistinctTimings) {
+  for (int i = 1; i <= 70; ++i) {
+    system_.AddPeriodicUpdate(100.0, i);
+  }
+  system_.AddPeriodicUpdate(100.0, 3.0);
+  system_.AddPeriodicUpdate(100.0, 70.0);
+
+  context_.SetTime(2.5);
+  double time = system_.CalcNextUpdateTime(context_, event_info_.get());
+  EXPECT_EQ(3.0, time);
+  EXPECT_EQ(leaf_info_->get_discrete_update_events().get_events().size(), 2);
+
+  context_.SetTime(69.5);
+  time = system_.CalcNextUpdateTime(context_, event_info_.get());
+  EXPECT_EQ(70.0, time);
+  EXPECT_EQ(leaf_info_->get_discrete_update_events().get_events().size(), 2);
+}
+
 // Tests that if the integrator has stopped on the k-th sample, and the current
 // time for that sample is slightly less than k * period due to floating point
 // rounding, the next sample time is (k + 1) * period.
@@ -1539,6 +1560,81 @@ GTEST_TEST(NonModelLeafSystemTest, NonModelPortsOutput) {
   EXPECT_EQ(dut.calc_POD_calls(), 2);  // Should have been cached.
 }
 
+// A system whose output port exposes one of its cache entries.
+class CacheEntryOutputSystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CacheEntryOutputSystem);
+
+  CacheEntryOutputSystem() {
+    this->DeclareDiscreteState(1);
+    const CacheEntry& entry = this->DeclareCacheEntry(
+        "squares", &CacheEntryOutputSystem::CalcSquares,
+        {this->discrete_state_ticket(DiscreteStateIndex(0))});
+    this->DeclareCacheEntryOutputPort("squares", entry);
+  }
+
+  int calc_squares_calls() const { return count_calc_squares_; }
+
+  void DeclareForeignPort(const CacheEntry& entry) {
+    this->DeclareCacheEntryOutputPort("foreign", entry);
+  }
+
+ private:
+  void CalcSquares(const Context<double>& context,
+                   std::vector<double>* squares) const {
+    ++count_calc_squares_;
+    const int n = static_cast<int>(context.get_discrete_state(0)[0]);
+    squares->resize(n);
+    for (int i = 0; i < n; ++i) (*squares)[i] = i * i;
+  }
+
+  mutable int count_calc_squares_{0};
+};
+
+// Tests that an output port declared for a cache entry evaluates to the cache
+// entry's value itself, and that Calc() updates a value in place.
+GTEST_TEST(CacheEntryOutputTest, EvalReturnsCacheEntryValue) {
+  CacheEntryOutputSystem dut;
+  auto context = dut.CreateDefaultContext();
+  context->EnableCaching();
+  context->get_mutable_discrete_state(0)[0] = 4;
+
+  ASSERT_EQ(dut.num_output_ports(), 1);
+  const OutputPort<double>& port = dut.get_output_port(0);
+  EXPECT_EQ(port.get_name(), "squares");
+  EXPECT_EQ(port.get_data_type(), kAbstractValued);
+
+  const CacheEntry& entry = dut.get_cache_entry(CacheIndex(0));
+  const std::vector<double>& squares = port.Eval<std::vector<double>>(*context);
+  EXPECT_EQ(&squares, &entry.Eval<std::vector<double>>(*context));
+  EXPECT_EQ(squares, std::vector<double>({0, 1, 4, 9}));
+  EXPECT_EQ(dut.calc_squares_calls(), 1);
+
+  // Changing the state invalidates the port's value, which is recomputed in
+  // the same object.
+  context->get_mutable_discrete_state(0)[0] = 2;
+  EXPECT_EQ(&port.Eval<std::vector<double>>(*context), &squares);
+  EXPECT_EQ(squares, std::vector<double>({0, 1}));
+  EXPECT_EQ(dut.calc_squares_calls(), 2);
+
+  // Calc() into a separately allocated value reuses that value's storage.
+  std::unique_ptr<AbstractValue> value = port.Allocate();
+  port.Calc(*context, value.get());
+  const std::vector<double>& calc_squares =
+      value->get_value<std::vector<double>>();
+  const double* const data = calc_squares.data();
+  context->get_mutable_discrete_state(0)[0] = 1;
+  port.Calc(*context, value.get());
+  EXPECT_EQ(calc_squares, std::vector<double>({0}));
+  EXPECT_EQ(calc_squares.data(), data);
+
+  // A cache entry of another system can't be exposed.
+  CacheEntryOutputSystem other;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.DeclareForeignPort(other.get_cache_entry(CacheIndex(0))),
+      std::exception, ".*condition.*failed.*");
+}
+
 // Tests that zero-sized vectors can be declared and used.
 GTEST_TEST(ZeroSizeSystemTest, AcceptanceTest) {
   TestSystem<double> dut;
@@ -2014,6 +2110,44 @@ GTEST_TEST(LeafSystemScalarConverterTest, SymbolicNo) {
   EXPECT_EQ(dut.ToSymbolicMaybe(), nullptr);
 }
 
+// The converted systems are shared until the system changes.
+GTEST_TEST(LeafSystemScalarConverterTest, ConvertedSystemsCache) {
+  SymbolicSparsitySystem<double> dut;
+  dut.set_name("special_name");
+
+  const std::shared_ptr<const System<AutoDiffXd>> autodiff =
+      dut.GetConvertedAutoDiffXd();
+  ASSERT_NE(autodiff, nullptr);
+  EXPECT_EQ(autodiff->get_name(), "special_name");
+  EXPECT_EQ(dut.GetConvertedAutoDiffXd(), autodiff);
+  const std::shared_ptr<const System<symbolic::Expression>> symbolic =
+      dut.GetConvertedSymbolic();
+  ASSERT_NE(symbolic, nullptr);
+  EXPECT_EQ(dut.GetConvertedSymbolic(), symbolic);
+
+  // An external constraint is copied by the conversion, so it clears the
+  // cache; the systems that were returned remain valid.
+  dut.AddExternalConstraint(ExternalSystemConstraint::MakeForAllScalars(
+      "t = 0", SystemConstraintBounds::Equality(1),
+      [](const auto&, const auto& context, auto* value) {
+        value->resize(1);
+        (*value)[0] = context.get_time();
+      }));
+  const std::shared_ptr<const System<AutoDiffXd>> new_autodiff =
+      dut.GetConvertedAutoDiffXd();
+  EXPECT_NE(new_autodiff, autodiff);
+  EXPECT_EQ(new_autodiff->num_constraints(), 1);
+  EXPECT_EQ(autodiff->num_constraints(), 0);
+  EXPECT_NE(dut.GetConvertedSymbolic(), symbolic);
+
+  dut.ClearConvertedSystemsCache();
+  EXPECT_NE(dut.GetConvertedAutoDiffXd(), new_autodiff);
+
+  TestSystem<double> no_conversion;
+  EXPECT_THROW(no_conversion.GetConvertedAutoDiffXd(), std::exception);
+  EXPECT_THROW(no_conversion.GetConvertedSymbolic(), std::exception);
+}
+
 GTEST_TEST(GraphvizTest, Attributes) {
   DefaultFeedthroughSystem system;
   // Check that the ID is the memory address.
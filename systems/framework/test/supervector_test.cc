@@ -1,11 +1,13 @@
 #include "drake/systems/framework/supervector.h"
 
 #include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
 
 #include "drake/systems/framework/basic_vector.h"
+#include "drake/systems/framework/subvector.h"
 #include "drake/systems/framework/vector_base.h"
 
 namespace drake {
@@ -70,6 +72,143 @@ TEST_F(SupervectorTest, OutOfRange) {
   EXPECT_THROW(supervector_->GetAtIndex(10), std::out_of_range);
 }
 
+// Tests the bulk operations, which are performed subvector by subvector.
+TEST_F(SupervectorTest, BulkOperations) {
+  Eigen::VectorXd expected(kLength);
+  expected << 0, 1, 2, 3, 4, 5, 6, 7, 8;
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  Eigen::VectorXd pre_sized = Eigen::VectorXd::Zero(kLength);
+  supervector_->CopyToPreSizedVector(&pre_sized);
+  EXPECT_EQ(pre_sized, expected);
+  Eigen::VectorXd wrong_size(kLength - 1);
+  EXPECT_THROW(supervector_->CopyToPreSizedVector(&wrong_size),
+               std::exception);
+
+  supervector_->ScaleAndAddToVector(2, &pre_sized);
+  EXPECT_EQ(pre_sized, 3 * expected);
+
+  supervector_->SetFromVector(2 * expected);
+  EXPECT_EQ(supervector_->CopyToVector(), 2 * expected);
+  EXPECT_EQ(vec2_->GetAtIndex(1), 10);
+  EXPECT_THROW(supervector_->SetFromVector(wrong_size), std::exception);
+
+  supervector_->SetZero();
+  EXPECT_EQ(supervector_->CopyToVector(), Eigen::VectorXd::Zero(kLength));
+}
+
+// Tests SetFrom() from a Supervector with the same partition (subvector by
+// subvector), with a different partition, and from a BasicVector.
+TEST_F(SupervectorTest, SetFrom) {
+  auto other1 = BasicVector<double>::Make({10, 11, 12, 13});
+  auto other2 = BasicVector<double>::Make({14, 15});
+  auto other3 = BasicVector<double>::Make({});
+  auto other4 = BasicVector<double>::Make({16, 17, 18});
+  const Supervector<double> same_partition(std::vector<VectorBase<double>*>{
+      other1.get(), other2.get(), other3.get(), other4.get()});
+  supervector_->SetFrom(same_partition);
+  EXPECT_EQ(supervector_->CopyToVector(), same_partition.CopyToVector());
+  EXPECT_EQ(vec4_->GetAtIndex(2), 18);
+
+  const Supervector<double> other_partition(std::vector<VectorBase<double>*>{
+      other4.get(), other1.get(), other2.get()});
+  supervector_->SetFrom(other_partition);
+  EXPECT_EQ(supervector_->CopyToVector(), other_partition.CopyToVector());
+
+  BasicVector<double> basic(kLength);
+  basic.SetFrom(same_partition);
+  EXPECT_EQ(basic.CopyToVector(), same_partition.CopyToVector());
+  supervector_->SetFrom(basic);
+  EXPECT_EQ(supervector_->CopyToVector(), basic.CopyToVector());
+
+  EXPECT_THROW(supervector_->SetFrom(*other1), std::exception);
+}
+
+// A vector whose elements are not contiguous in memory: each one is stored in
+// its own allocation.
+class ScatteredVector : public VectorBase<double> {
+ public:
+  explicit ScatteredVector(int size) {
+    for (int i = 0; i < size; ++i) {
+      elements_.push_back(std::make_unique<double>(0));
+    }
+  }
+  int size() const override { return static_cast<int>(elements_.size()); }
+
+ protected:
+  const double& DoGetAtIndex(int index) const override {
+    return *elements_.at(index);
+  }
+  double& DoGetAtIndex(int index) override { return *elements_.at(index); }
+
+ private:
+  std::vector<std::unique_ptr<double>> elements_;
+};
+
+// The contiguous segments of a Supervector are those of its subvectors.
+TEST_F(SupervectorTest, ContiguousSegments) {
+  ASSERT_TRUE(supervector_->is_contiguous());
+  ASSERT_EQ(supervector_->num_contiguous_segments(), 4);
+  EXPECT_EQ(supervector_->GetContiguousSegment(0).data(), &(*vec1_)[0]);
+  EXPECT_EQ(supervector_->GetContiguousSegment(1).size(), 2);
+  EXPECT_EQ(supervector_->GetContiguousSegment(2).size(), 0);
+  EXPECT_EQ(supervector_->GetContiguousSegment(3).data(), &(*vec4_)[0]);
+  supervector_->GetMutableContiguousSegment(1)[1] = 42;
+  EXPECT_EQ((*vec2_)[1], 42);
+
+  // A Subvector clips the segments of its vector.
+  const Subvector<double> subvector(supervector_.get(), 3, 4);
+  ASSERT_EQ(subvector.num_contiguous_segments(), 3);
+  EXPECT_EQ(subvector.GetContiguousSegment(0).data(), &(*vec1_)[3]);
+  EXPECT_EQ(subvector.GetContiguousSegment(0).size(), 1);
+  EXPECT_EQ(subvector.GetContiguousSegment(1).size(), 2);
+  EXPECT_EQ(subvector.GetContiguousSegment(2).data(), &(*vec4_)[0]);
+  EXPECT_EQ(subvector.GetContiguousSegment(2).size(), 1);
+
+  // A vector that isn't contiguous makes its supervectors non-contiguous.
+  ScatteredVector scattered(2);
+  const Supervector<double> mixed(
+      std::vector<VectorBase<double>*>{vec1_.get(), &scattered});
+  EXPECT_FALSE(scattered.is_contiguous());
+  EXPECT_FALSE(mixed.is_contiguous());
+  EXPECT_EQ(mixed.num_contiguous_segments(), -1);
+}
+
+// The bulk operations give the same results whether they are performed on
+// contiguous segments that are split differently in the operands, or element
+// by element.
+TEST_F(SupervectorTest, PlusEqScaledAcrossPartitions) {
+  auto other1 = BasicVector<double>::Make({1, 1});
+  auto other2 = BasicVector<double>::Make({2, 2, 2, 2, 2});
+  auto other3 = BasicVector<double>::Make({3, 3});
+  Supervector<double> other_partition(std::vector<VectorBase<double>*>{
+      other1.get(), other2.get(), other3.get()});
+  ScatteredVector scattered(kLength);
+  scattered.SetFromVector(Eigen::VectorXd::Constant(kLength, 1));
+
+  Eigen::VectorXd expected(kLength);
+  expected << 0, 1, 2, 3, 4, 5, 6, 7, 8;
+  Eigen::VectorXd other(kLength);
+  other << 1, 1, 2, 2, 2, 2, 2, 3, 3;
+  expected += 2 * other + 0.5 * Eigen::VectorXd::Ones(kLength);
+  supervector_->PlusEqScaled({{2, other_partition}, {0.5, scattered}});
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  // A Subvector (without any bulk operations of its own) over a supervector.
+  Subvector<double> subvector(supervector_.get(), 1, 7);
+  subvector.PlusEqScaled(-1, Subvector<double>(&other_partition, 2, 7));
+  expected.segment(1, 7) -= other.segment(2, 7);
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  subvector.SetFrom(Subvector<double>(&other_partition, 0, 7));
+  expected.segment(1, 7) = other.head(7);
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+
+  subvector.SetZero();
+  expected.segment(1, 7).setZero();
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+}
+
 TEST_F(SupervectorTest, Empty) {
   Supervector<double> supervector(std::vector<VectorBase<double>*>{});
   EXPECT_EQ(0, supervector.size());
@@ -0,0 +1,142 @@
+#include "drake/systems/framework/system_profiler.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+class SystemProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    auto source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+    source->set_name("source");
+    auto integrator = builder.AddSystem<Integrator<double>>(1);
+    integrator->set_name("integrator");
+    builder.Connect(*source, *integrator);
+    diagram_ = builder.Build();
+    diagram_->set_name("diagram");
+    context_ = diagram_->CreateDefaultContext();
+    derivatives_ = diagram_->AllocateTimeDerivatives();
+  }
+
+  // Returns the entry with the given name and category, or nullptr.
+  static const SystemProfiler::Entry* FindEntry(
+      const std::vector<SystemProfiler::Entry>& entries,
+      const std::string& name, SystemProfilingCategory category) {
+    for (const SystemProfiler::Entry& entry : entries) {
+      if (entry.name == name && entry.category == category) return &entry;
+    }
+    return nullptr;
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<ContinuousState<double>> derivatives_;
+  SystemProfiler profiler_;
+};
+
+// Nothing is recorded unless the profiler is active.
+TEST_F(SystemProfilerTest, Inactive) {
+  EXPECT_EQ(SystemProfiler::active(), nullptr);
+  diagram_->CalcTimeDerivatives(*context_, derivatives_.get());
+  EXPECT_TRUE(profiler_.GetEntries().empty());
+}
+
+// The computations of each subsystem are aggregated under its pathname.
+TEST_F(SystemProfilerTest, Aggregation) {
+  {
+    internal::ScopedSystemProfilerActivation activation(&profiler_);
+    EXPECT_EQ(SystemProfiler::active(), &profiler_);
+    for (int i = 0; i < 3; ++i) {
+      diagram_->CalcTimeDerivatives(*context_, derivatives_.get());
+    }
+  }
+  EXPECT_EQ(SystemProfiler::active(), nullptr);
+
+  const std::vector<SystemProfiler::Entry> entries = profiler_.GetEntries();
+  const SystemProfiler::Entry* const diagram = FindEntry(
+      entries, "::diagram", SystemProfilingCategory::kTimeDerivatives);
+  const SystemProfiler::Entry* const integrator =
+      FindEntry(entries, "::diagram::integrator",
+                SystemProfilingCategory::kTimeDerivatives);
+  ASSERT_NE(diagram, nullptr);
+  ASSERT_NE(integrator, nullptr);
+  EXPECT_EQ(diagram->num_calls, 3);
+  EXPECT_EQ(integrator->num_calls, 3);
+  // Times are inclusive.
+  EXPECT_GE(diagram->total_time, integrator->total_time);
+  EXPECT_GE(integrator->total_time, integrator->max_time);
+  for (size_t i = 1; i < entries.size(); ++i) {
+    EXPECT_GE(entries[i - 1].total_time, entries[i].total_time);
+  }
+
+  // The source output port is computed once since its value is cached.
+  bool found_source = false;
+  for (const SystemProfiler::Entry& entry : entries) {
+    if (entry.name.find("::diagram::source:") == 0) {
+      EXPECT_EQ(entry.category, SystemProfilingCategory::kCacheEntry);
+      EXPECT_EQ(entry.num_calls, 1);
+      found_source = true;
+    }
+  }
+  EXPECT_TRUE(found_source);
+
+  const std::string report = profiler_.GetReport();
+  EXPECT_NE(report.find("::diagram::integrator"), std::string::npos);
+  EXPECT_NE(report.find("derivatives"), std::string::npos);
+
+  profiler_.Reset();
+  EXPECT_TRUE(profiler_.GetEntries().empty());
+}
+
+TEST_F(SystemProfilerTest, ChromeTrace) {
+  const std::string empty_trace =
+      profiler_.GetReport(SystemProfilingReportFormat::kChromeTrace);
+  EXPECT_EQ(empty_trace,
+            "{\"traceEvents\": [],\n\"displayTimeUnit\": \"ms\"}\n");
+
+  EXPECT_FALSE(profiler_.get_record_trace_events());
+  profiler_.set_record_trace_events(true);
+  {
+    internal::ScopedSystemProfilerActivation activation(&profiler_);
+    diagram_->CalcTimeDerivatives(*context_, derivatives_.get());
+  }
+  const std::string trace =
+      profiler_.GetReport(SystemProfilingReportFormat::kChromeTrace);
+  EXPECT_NE(trace.find("{\"name\": \"::diagram\", \"cat\": \"derivatives\", "
+                       "\"ph\": \"X\""),
+            std::string::npos);
+  EXPECT_NE(trace.find("\"::diagram::integrator\""), std::string::npos);
+}
+
+TEST_F(SystemProfilerTest, Activation) {
+  internal::ScopedSystemProfilerActivation activation(&profiler_);
+  // Activating the active profiler again, or no profiler, does nothing.
+  {
+    internal::ScopedSystemProfilerActivation nested(&profiler_);
+    internal::ScopedSystemProfilerActivation none(nullptr);
+  }
+  EXPECT_EQ(SystemProfiler::active(), &profiler_);
+
+  SystemProfiler other;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      internal::ScopedSystemProfilerActivation{&other}, std::logic_error,
+      "Cannot activate a SystemProfiler while another one is active.");
+  EXPECT_EQ(SystemProfiler::active(), &profiler_);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/systems/framework/vector_system.h"
 
+#include <cmath>
 #include <stdexcept>
 #include <vector>
 
@@ -7,6 +8,8 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/fixed_basic_vector.h"
+#include "drake/systems/framework/fixed_size_vector_system.h"
 #include "drake/systems/framework/test_utilities/scalar_conversion.h"
 #include "drake/systems/primitives/integrator.h"
 
@@ -601,6 +604,105 @@ TEST_F(VectorSystemTest, MissingMethodsDiscreteTimeSystemTest) {
       ".*Output.*'output->size.. == 0.*failed.*");
 }
 
+// A first-order low-pass filter xdot = u - x, y = x + u, of two channels,
+// whose state is declared with a FixedBasicVector model.
+class FixedSizeFilter : public FixedSizeVectorSystem<double, 2, 2, 2> {
+ public:
+  explicit FixedSizeFilter(bool discrete) {
+    const Eigen::Vector2d zero = Eigen::Vector2d::Zero();
+    if (discrete) {
+      this->DeclarePeriodicDiscreteUpdate(0.5);
+      this->DeclareDiscreteState(FixedBasicVector<double, 2>(zero));
+    } else {
+      this->DeclareContinuousState(FixedBasicVector<double, 2>(zero));
+    }
+  }
+
+ private:
+  void DoCalcFixedVectorOutput(
+      const Context<double>&, const Eigen::Map<const Eigen::Vector2d>& input,
+      const Eigen::Map<const Eigen::Vector2d>& state,
+      Eigen::Map<Eigen::Vector2d>* output) const override {
+    *output = state + input;
+  }
+
+  void DoCalcFixedVectorTimeDerivatives(
+      const Context<double>&, const Eigen::Map<const Eigen::Vector2d>& input,
+      const Eigen::Map<const Eigen::Vector2d>& state,
+      Eigen::Map<Eigen::Vector2d>* derivatives) const override {
+    *derivatives = input - state;
+  }
+
+  void DoCalcFixedVectorDiscreteVariableUpdates(
+      const Context<double>&, const Eigen::Map<const Eigen::Vector2d>& input,
+      const Eigen::Map<const Eigen::Vector2d>& state,
+      Eigen::Map<Eigen::Vector2d>* next_state) const override {
+    *next_state = state + 0.5 * (input - state);
+  }
+};
+
+TEST_F(VectorSystemTest, FixedSizeContinuous) {
+  const FixedSizeFilter dut(false);
+  auto context = dut.CreateDefaultContext();
+  dut.get_input_port().FixValue(context.get(), Eigen::Vector2d(1.0, 2.0));
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Eigen::Vector2d(3.0, 5.0));
+
+  // The state is held in the type of its model vector.
+  const auto& state = dynamic_cast<const FixedBasicVector<double, 2>&>(
+      context->get_continuous_state_vector());
+  EXPECT_EQ(state.get_fixed_value(), Eigen::Vector2d(3.0, 5.0));
+
+  EXPECT_EQ(dut.get_output_port().Eval(*context), Eigen::Vector2d(4.0, 7.0));
+  auto derivatives = dut.AllocateTimeDerivatives();
+  dut.CalcTimeDerivatives(*context, derivatives.get());
+  EXPECT_EQ(derivatives->CopyToVector(), Eigen::Vector2d(-2.0, -3.0));
+}
+
+TEST_F(VectorSystemTest, FixedSizeDiscrete) {
+  const FixedSizeFilter dut(true);
+  auto context = dut.CreateDefaultContext();
+  dut.get_input_port().FixValue(context.get(), Eigen::Vector2d(1.0, 2.0));
+  context->get_mutable_discrete_state(0).SetFromVector(
+      Eigen::Vector2d(3.0, 6.0));
+
+  EXPECT_EQ(dut.get_output_port().Eval(*context), Eigen::Vector2d(4.0, 8.0));
+  auto updates = dut.AllocateDiscreteVariables();
+  dut.CalcDiscreteVariableUpdates(*context, updates.get());
+  EXPECT_EQ(updates->get_vector(0).get_value(), Eigen::Vector2d(2.0, 4.0));
+}
+
+// The input of a system that isn't direct feedthrough is never evaluated.
+class FixedSizeNoFeedthroughSystem
+    : public FixedSizeVectorSystem<double, 1, 1, 1> {
+ public:
+  FixedSizeNoFeedthroughSystem()
+      : FixedSizeVectorSystem<double, 1, 1, 1>(false) {
+    this->DeclareContinuousState(1);
+  }
+
+ private:
+  void DoCalcFixedVectorOutput(
+      const Context<double>&, const Eigen::Map<const Vector1d>& input,
+      const Eigen::Map<const Vector1d>& state,
+      Eigen::Map<Vector1d>* output) const override {
+    EXPECT_TRUE(std::isnan(input[0]));
+    *output = state;
+  }
+};
+
+TEST_F(VectorSystemTest, FixedSizeNoFeedthrough) {
+  const FixedSizeNoFeedthroughSystem dut;
+  auto context = dut.CreateDefaultContext();
+  EXPECT_EQ(dut.get_output_port().Eval(*context)[0], 0.0);
+
+  // The default time derivatives throw, since there is a state.
+  auto derivatives = dut.AllocateTimeDerivatives();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.CalcTimeDerivatives(*context, derivatives.get()), std::exception,
+      ".*kStateSize == 0.*failed.*");
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -8,6 +8,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_throw.h"
@@ -16,6 +17,16 @@
 namespace drake {
 namespace systems {
 
+template <typename T>
+class VectorBase;
+
+#if !defined(DRAKE_DOXYGEN_CXX)
+namespace internal {
+template <typename T, typename Func>
+void ForEachContiguousPiece(VectorBase<T>*, const VectorBase<T>&, Func);
+}  // namespace internal
+#endif
+
 /// VectorBase is an abstract base class that real-valued signals
 /// between Systems and real-valued System state vectors must implement.
 /// Classes that inherit from VectorBase will typically provide names
@@ -79,6 +90,11 @@ class VectorBase {
   /// value and allocates no memory.
   virtual void SetFrom(const VectorBase<T>& value) {
     DRAKE_THROW_UNLESS(value.size() == size());
+    if (is_contiguous() && value.is_contiguous()) {
+      internal::ForEachContiguousPiece(
+          this, value, [](auto&& dst, const auto& src) { dst = src; });
+      return;
+    }
     for (int i = 0; i < value.size(); ++i) {
       (*this)[i] = value[i];
     }
@@ -91,12 +107,26 @@ class VectorBase {
   /// value and allocates no memory.
   virtual void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) {
     DRAKE_THROW_UNLESS(value.rows() == size());
+    if (is_contiguous()) {
+      for (int i = 0, start = 0; i < num_contiguous_segments(); ++i) {
+        auto segment = GetMutableContiguousSegment(i);
+        segment = value.segment(start, segment.size());
+        start += segment.size();
+      }
+      return;
+    }
     for (int i = 0; i < value.rows(); ++i) {
       (*this)[i] = value[i];
     }
   }
 
   virtual void SetZero() {
+    if (is_contiguous()) {
+      for (int i = 0; i < num_contiguous_segments(); ++i) {
+        GetMutableContiguousSegment(i).setZero();
+      }
+      return;
+    }
     const int sz = size();
     for (int i = 0; i < sz; ++i) {
       (*this)[i] = T(0.0);
@@ -123,6 +153,14 @@ class VectorBase {
   virtual void CopyToPreSizedVector(EigenPtr<VectorX<T>> vec) const {
     DRAKE_THROW_UNLESS(vec != nullptr);
     DRAKE_THROW_UNLESS(vec->rows() == size());
+    if (is_contiguous()) {
+      for (int i = 0, start = 0; i < num_contiguous_segments(); ++i) {
+        const auto segment = GetContiguousSegment(i);
+        vec->segment(start, segment.size()) = segment;
+        start += segment.size();
+      }
+      return;
+    }
     for (int i = 0; i < size(); ++i) {
       (*vec)[i] = (*this)[i];
     }
@@ -141,6 +179,14 @@ class VectorBase {
     if (vec->rows() != size()) {
       throw std::out_of_range("Addends must be the same size.");
     }
+    if (is_contiguous()) {
+      for (int i = 0, start = 0; i < num_contiguous_segments(); ++i) {
+        const auto segment = GetContiguousSegment(i);
+        vec->segment(start, segment.size()) += scale * segment;
+        start += segment.size();
+      }
+      return;
+    }
     for (int i = 0; i < size(); ++i) {
       (*vec)[i] += scale * (*this)[i];
     }
@@ -176,6 +222,37 @@ class VectorBase {
     return PlusEqScaled(T(-1), rhs);
   }
 
+  /// (Advanced.) Returns the number of segments of consecutive elements of
+  /// this vector that are also consecutive in memory, which together hold the
+  /// whole vector in order (see GetContiguousSegment()), or -1 if the elements
+  /// of this vector can only be accessed one by one. When a vector (and, for
+  /// operations between vectors, the other vector) has segments, the bulk
+  /// operations of %VectorBase operate on them as Eigen blocks, rather than
+  /// element by element.
+  int num_contiguous_segments() const { return DoGetNumContiguousSegments(); }
+
+  /// (Advanced.) Returns whether the elements of this vector are held in
+  /// contiguous segments; see num_contiguous_segments().
+  bool is_contiguous() const { return num_contiguous_segments() >= 0; }
+
+  /// (Advanced.) Returns the `i`th contiguous segment of this vector; see
+  /// num_contiguous_segments().
+  /// @pre 0 <= `i` < num_contiguous_segments()
+  Eigen::Map<const VectorX<T>> GetContiguousSegment(int i) const {
+    const std::pair<const T*, int> segment = DoGetContiguousSegment(i);
+    return Eigen::Map<const VectorX<T>>(segment.first, segment.second);
+  }
+
+  /// (Advanced.) Returns the `i`th contiguous segment of this vector, for
+  /// mutation; see num_contiguous_segments().
+  /// @pre 0 <= `i` < num_contiguous_segments()
+  Eigen::Map<VectorX<T>> GetMutableContiguousSegment(int i) {
+    const std::pair<const T*, int> segment = DoGetContiguousSegment(i);
+    // The const_cast is sound, since this vector is mutable.
+    return Eigen::Map<VectorX<T>>(const_cast<T*>(segment.first),
+                                  segment.second);
+  }
+
   /// Get the bounds for the elements.
   /// If lower and upper are both empty size vectors, then there are no bounds.
   /// Otherwise, the bounds are (*lower)(i) <= GetAtIndex(i) <= (*upper)(i)
@@ -211,8 +288,19 @@ class VectorBase {
   virtual void DoPlusEqScaled(const std::initializer_list<
                               std::pair<T, const VectorBase<T>&>>& rhs_scale) {
     const int sz = size();
+    bool all_contiguous = is_contiguous();
     for (const auto& operand : rhs_scale) {
       DRAKE_THROW_UNLESS(operand.second.size() == sz);
+      all_contiguous = all_contiguous && operand.second.is_contiguous();
+    }
+    if (all_contiguous) {
+      for (const auto& operand : rhs_scale) {
+        const T& scale = operand.first;
+        internal::ForEachContiguousPiece(
+            this, operand.second,
+            [&scale](auto&& dst, const auto& src) { dst += scale * src; });
+      }
+      return;
     }
     for (int i = 0; i < sz; ++i) {
       T value(0);
@@ -222,8 +310,62 @@ class VectorBase {
       (*this)[i] += value;
     }
   }
+
+  /// Implementations whose elements are held in contiguous segments of memory
+  /// should override this method to return the number of segments (see
+  /// num_contiguous_segments()), and override DoGetContiguousSegment(). The
+  /// segments must not change over the lifetime of the vector. The default
+  /// implementation returns -1, i.e., the elements are not contiguous.
+  virtual int DoGetNumContiguousSegments() const { return -1; }
+
+  /// Returns the pointer to the first element and the number of elements of
+  /// the given contiguous segment, whose index is within the number returned by
+  /// DoGetNumContiguousSegments(). Implementations must override this method
+  /// when they override DoGetNumContiguousSegments().
+  virtual std::pair<const T*, int> DoGetContiguousSegment(int) const {
+    DRAKE_UNREACHABLE();
+  }
 };
 
+#if !defined(DRAKE_DOXYGEN_CXX)
+namespace internal {
+
+// Calls `func(dst_piece, src_piece)` on the successive pieces of `dst` and
+// `src` (of the same size, and both contiguous) that lie within a single
+// contiguous segment of each of them.
+template <typename T, typename Func>
+void ForEachContiguousPiece(VectorBase<T>* dst, const VectorBase<T>& src,
+                            Func func) {
+  DRAKE_ASSERT(dst->size() == src.size());
+  const int num_dst_segments = dst->num_contiguous_segments();
+  const int num_src_segments = src.num_contiguous_segments();
+  int dst_index = 0;
+  int src_index = 0;
+  int dst_offset = 0;
+  int src_offset = 0;
+  while (dst_index < num_dst_segments && src_index < num_src_segments) {
+    auto dst_segment = dst->GetMutableContiguousSegment(dst_index);
+    const auto src_segment = src.GetContiguousSegment(src_index);
+    const int n = std::min(dst_segment.size() - dst_offset,
+                           src_segment.size() - src_offset);
+    func(dst_segment.segment(dst_offset, n),
+         src_segment.segment(src_offset, n));
+    dst_offset += n;
+    src_offset += n;
+    if (dst_offset == dst_segment.size()) {
+      ++dst_index;
+      dst_offset = 0;
+    }
+    if (src_offset == src_segment.size()) {
+      ++src_index;
+      src_offset = 0;
+    }
+  }
+}
+
+}  // namespace internal
+#endif
+
 // Allows a VectorBase<T> to be streamed into a string. This is useful for
 // debugging purposes.
 template <typename T>
@@ -120,13 +120,14 @@ EventStatus LcmPublisherSystem::PublishInputAsLcmMessage(
   SPDLOG_TRACE(drake::log(), "Publishing LCM {} message", channel_);
   DRAKE_ASSERT(serializer_ != nullptr);
 
-  // Converts the input into LCM message bytes.
+  // Converts the input into LCM message bytes, directly into the reusable
+  // buffer.
   const AbstractValue& input = get_input_port().Eval<AbstractValue>(context);
-  std::vector<uint8_t> message_bytes;
-  serializer_->Serialize(input, &message_bytes);
+  std::lock_guard<std::mutex> lock(message_bytes_mutex_);
+  serializer_->Serialize(input, &message_bytes_);
 
   // Publishes onto the specified LCM channel.
-  lcm_->Publish(channel_, message_bytes.data(), message_bytes.size(),
+  lcm_->Publish(channel_, message_bytes_.data(), message_bytes_.size(),
                 context.get_time());
 
   return EventStatus::Succeeded();
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -258,6 +260,13 @@ class LcmPublisherSystem : public LeafSystem<double> {
 
   // TODO(edrumwri) Remove this when set_publish_period() is removed.
   bool disable_internal_per_step_publish_events_{false};
+
+  // The buffer into which the messages are serialized. It is reused by every
+  // publication, so that publishing large messages (e.g., images) at a high
+  // rate does not allocate once the buffer has grown to the message size.
+  // The mutex makes publishing on distinct contexts safe to do concurrently.
+  mutable std::mutex message_bytes_mutex_;
+  mutable std::vector<uint8_t> message_bytes_;
 };
 
 }  // namespace lcm
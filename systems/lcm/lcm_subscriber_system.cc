@@ -1,5 +1,7 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <utility>
@@ -21,6 +23,90 @@ constexpr int kStateIndexMessageCount = 1;
 constexpr int kMagic = 6832;  // An arbitrary value.
 }  // namespace
 
+// A single-producer/single-consumer ring buffer of decoded messages. The
+// producer is the receive thread (via HandleMessage()), which decodes each
+// message directly into a free slot; the consumer is the thread that
+// processes the update events of this system, which pops the most recent
+// message. Neither side locks: the slots [tail_, head_) hold the messages
+// that are ready to be consumed and only the producer advances head_, while
+// only the consumer advances tail_.
+class LcmSubscriberSystem::ReceiveBuffer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ReceiveBuffer)
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Slot {
+    std::unique_ptr<AbstractValue> value;
+    Clock::time_point decoded_time;
+  };
+
+  ReceiveBuffer(const SerializerInterface& serializer, int capacity)
+      : slots_(capacity) {
+    DRAKE_THROW_UNLESS(capacity > 0);
+    for (Slot& slot : slots_) {
+      slot.value = serializer.CreateDefaultValue();
+    }
+  }
+
+  // (Producer only.) Decodes the message into a free slot and makes it
+  // available to the consumer. If there is no free slot, drops the message
+  // and returns false.
+  bool Push(const SerializerInterface& serializer, const void* buffer,
+            int size) {
+    const int64_t head = head_.load(std::memory_order_relaxed);
+    const int64_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail == capacity()) {
+      num_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    Slot& slot = slots_[head % capacity()];
+    serializer.Deserialize(buffer, size, slot.value.get());
+    slot.decoded_time = Clock::now();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // (Consumer only.) If any message is available, calls `consume` with the
+  // slot of the most recent one, releases all the available slots (the older
+  // messages are counted as dropped) and returns true.
+  template <typename Consume>
+  bool PopLatest(Consume&& consume) {
+    const int64_t tail = tail_.load(std::memory_order_relaxed);
+    const int64_t head = head_.load(std::memory_order_acquire);
+    if (head == tail) {
+      return false;
+    }
+    consume(slots_[(head - 1) % capacity()]);
+    num_dropped_.fetch_add(head - tail - 1, std::memory_order_relaxed);
+    tail_.store(head, std::memory_order_release);
+    return true;
+  }
+
+  // (Consumer only.) Returns the slot of the most recent message that has not
+  // been popped yet, or null if there is none.
+  const Slot* PeekLatest() const {
+    const int64_t tail = tail_.load(std::memory_order_relaxed);
+    const int64_t head = head_.load(std::memory_order_acquire);
+    return head == tail ? nullptr : &slots_[(head - 1) % capacity()];
+  }
+
+  // The number of messages that were pushed.
+  int64_t num_pushed() const { return head_.load(std::memory_order_acquire); }
+
+  int64_t num_dropped() const {
+    return num_dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  int64_t capacity() const { return static_cast<int64_t>(slots_.size()); }
+
+  std::vector<Slot> slots_;
+  std::atomic<int64_t> head_{0};
+  std::atomic<int64_t> tail_{0};
+  std::atomic<int64_t> num_dropped_{0};
+};
+
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel,
     std::unique_ptr<SerializerInterface> serializer,
@@ -30,7 +116,34 @@ LcmSubscriberSystem::LcmSubscriberSystem(
       magic_number_{kMagic} {
   DRAKE_DEMAND(serializer_ != nullptr);
   DRAKE_DEMAND(lcm);
+  Initialize(lcm);
+}
 
+LcmSubscriberSystem::LcmSubscriberSystem(
+    const std::string& channel,
+    std::unique_ptr<SerializerInterface> serializer,
+    drake::lcm::DrakeLcmInterface* lcm,
+    const LcmReceiveThreadParams& params)
+    : channel_(channel),
+      serializer_(std::move(serializer)),
+      magic_number_{kMagic} {
+  DRAKE_DEMAND(serializer_ != nullptr);
+  DRAKE_DEMAND(lcm);
+  DRAKE_THROW_UNLESS(params.handle_subscriptions_timeout_millis > 0);
+  receive_buffer_ =
+      std::make_unique<ReceiveBuffer>(*serializer_, params.buffer_capacity);
+  Initialize(lcm);
+
+  // Everything is set up; start pumping the LCM.
+  const int timeout_millis = params.handle_subscriptions_timeout_millis;
+  receive_thread_ = std::thread([this, lcm, timeout_millis]() {
+    while (!stop_receive_thread_.load()) {
+      lcm->HandleSubscriptions(timeout_millis);
+    }
+  });
+}
+
+void LcmSubscriberSystem::Initialize(drake::lcm::DrakeLcmInterface* lcm) {
   subscription_ = lcm->Subscribe(
       channel_, [this](const void* buffer, int size) {
         this->HandleMessage(buffer, size);
@@ -69,6 +182,11 @@ LcmSubscriberSystem::LcmSubscriberSystem(
 }
 
 LcmSubscriberSystem::~LcmSubscriberSystem() {
+  // Stop receiving before anything the handler uses is destroyed.
+  if (receive_thread_.joinable()) {
+    stop_receive_thread_ = true;
+    receive_thread_.join();
+  }
   // Violate our class invariant, to help catch use-after-free.
   magic_number_ = 0;
 }
@@ -78,6 +196,23 @@ LcmSubscriberSystem::~LcmSubscriberSystem() {
 systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
+  if (has_receive_thread()) {
+    // Read the count first, so that it never includes a message that is not
+    // popped now.
+    const int64_t count = receive_buffer_->num_pushed();
+    receive_buffer_->PopLatest([this, &abstract_state](
+                                   const ReceiveBuffer::Slot& slot) {
+      abstract_state.get_mutable_value(kStateIndexMessage)
+          .SetFrom(*slot.value);
+      const double latency = std::chrono::duration<double>(
+          ReceiveBuffer::Clock::now() - slot.decoded_time).count();
+      last_message_latency_ = latency;
+      max_message_latency_ = std::max(max_message_latency_.load(), latency);
+    });
+    abstract_state.get_mutable_value(kStateIndexMessageCount)
+        .get_mutable_value<int>() = static_cast<int>(count);
+    return systems::EventStatus::Succeeded();
+  }
   std::lock_guard<std::mutex> lock(received_message_mutex_);
   if (!received_message_.empty()) {
     serializer_->Deserialize(
@@ -107,10 +242,7 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
 
   // Do nothing unless we have a new message.
   const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
+  const int received_message_count = GetInternalMessageCount();
   if (last_message_count == received_message_count) {
     return;
   }
@@ -156,6 +288,16 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   SPDLOG_TRACE(drake::log(), "Receiving LCM {} message", channel_);
   DRAKE_DEMAND(magic_number_ == kMagic);
 
+  if (has_receive_thread()) {
+    if (receive_buffer_->Push(*serializer_, buffer, size)) {
+      // Only waiters (see WaitForMessage()) use the mutex. Locking it between
+      // the push and the notification ensures that they don't miss it.
+      { std::lock_guard<std::mutex> lock(received_message_mutex_); }
+      received_message_condition_variable_.notify_all();
+    }
+    return;
+  }
+
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
   std::lock_guard<std::mutex> lock(received_message_mutex_);
@@ -181,8 +323,13 @@ int LcmSubscriberSystem::WaitForMessage(
 
   // Predicate to handle spurious wakeup -- in other words, we can stop if we
   // detect a message has *actually* been received.
+  auto current_count = [this]() {
+    return has_receive_thread()
+        ? static_cast<int>(receive_buffer_->num_pushed())
+        : received_message_count_;
+  };
   auto message_received = [&]() {
-    return received_message_count_ > old_message_count;
+    return current_count() > old_message_count;
   };
   if (timeout <= 0) {
     // No timeout.
@@ -203,23 +350,49 @@ int LcmSubscriberSystem::WaitForMessage(
     DRAKE_ASSERT(TimePoint::max() - duration > Clock::now());
     if (!received_message_condition_variable_.wait_for(lock, duration,
                                                        message_received)) {
-      return received_message_count_;
+      return current_count();
     }
   }
 
   if (message) {
+    if (has_receive_thread()) {
+      // The message that was waited for may have been popped already, in which
+      // case it is in no slot anymore.
+      const ReceiveBuffer::Slot* slot = receive_buffer_->PeekLatest();
+      DRAKE_THROW_UNLESS(slot != nullptr);
+      message->SetFrom(*slot->value);
+    } else {
       serializer_->Deserialize(
           received_message_.data(), received_message_.size(), message);
+    }
   }
 
-  return received_message_count_;
+  return current_count();
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
+  if (has_receive_thread()) {
+    return static_cast<int>(receive_buffer_->num_pushed());
+  }
   std::unique_lock<std::mutex> lock(received_message_mutex_);
   return received_message_count_;
 }
 
+int64_t LcmSubscriberSystem::get_num_dropped_messages() const {
+  DRAKE_THROW_UNLESS(has_receive_thread());
+  return receive_buffer_->num_dropped();
+}
+
+double LcmSubscriberSystem::get_last_message_latency() const {
+  DRAKE_THROW_UNLESS(has_receive_thread());
+  return last_message_latency_;
+}
+
+double LcmSubscriberSystem::get_max_message_latency() const {
+  DRAKE_THROW_UNLESS(has_receive_thread());
+  return max_message_latency_;
+}
+
 }  // namespace lcm
 }  // namespace systems
 }  // namespace drake
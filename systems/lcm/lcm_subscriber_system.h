@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
@@ -18,6 +21,23 @@ namespace drake {
 namespace systems {
 namespace lcm {
 
+/**
+ * The parameters of the threaded receive mode of LcmSubscriberSystem; see
+ * LcmSubscriberSystem::MakeWithReceiveThread().
+ */
+struct LcmReceiveThreadParams {
+  /** The number of decoded messages that can be waiting to be stored in the
+  State. Must be positive. When the buffer is full, newly received messages
+  are dropped, so this should exceed the number of messages that can arrive
+  between two consecutive simulation steps. */
+  int buffer_capacity{4};
+
+  /** The timeout of each call to DrakeLcmInterface::HandleSubscriptions()
+  made by the receive thread; this bounds the time it takes to stop the
+  thread. Must be positive. */
+  int handle_subscriptions_timeout_millis{10};
+};
+
 /**
  * Receives LCM messages from a given channel and outputs them to a
  * System<double>'s port. This class stores the most recently processed LCM
@@ -37,6 +57,25 @@ namespace lcm {
  * then see drake::systems::lcm::LcmLogPlaybackSystem for a helper to advance
  * the log cursor in concert with the simulation.
  *
+ * <h3>Threaded receive mode</h3>
+ *
+ * By default, messages are only received when the DrakeLcmInterface is pumped
+ * (see DrakeLcmInterface::HandleSubscriptions()), and a received message is
+ * copied under a mutex shared with the simulation thread, and decoded there.
+ * For high-rate or large messages, a subscriber made by
+ * MakeWithReceiveThread() instead owns a background thread that pumps the
+ * DrakeLcmInterface and decodes each message, on that thread, into a
+ * preallocated slot of a single-producer/single-consumer ring buffer. The
+ * update event pops the most recent message from the ring buffer without
+ * locking, and statistics about the dropped messages and the latency are
+ * available (see get_num_dropped_messages() and get_last_message_latency()).
+ *
+ * Because the receive thread calls HandleSubscriptions(), the
+ * DrakeLcmInterface given to a threaded subscriber must not be pumped by
+ * anything else (including LcmInterfaceSystem or another threaded subscriber)
+ * and should have no other subscriptions that expect to be handled on the
+ * simulation thread.
+ *
  * @ingroup message_passing
  */
 class LcmSubscriberSystem : public LeafSystem<double> {
@@ -60,6 +99,29 @@ class LcmSubscriberSystem : public LeafSystem<double> {
         channel, std::make_unique<Serializer<LcmMessage>>(), lcm);
   }
 
+  /**
+   * Factory method that returns a subscriber System that provides
+   * Value<LcmMessage> message objects on its sole abstract-valued output port,
+   * and that receives and decodes the messages on its own thread. See the
+   * class documentation for the threaded receive mode.
+   *
+   * @tparam LcmMessage message type to deserialize, e.g., lcmt_drake_signal.
+   *
+   * @param[in] channel The LCM channel on which to subscribe.
+   *
+   * @param lcm A non-null pointer to the LCM subsystem to subscribe on. It is
+   * pumped by the receive thread, and must outlive the returned system.
+   *
+   * @param params The parameters of the receive thread.
+   */
+  template <typename LcmMessage>
+  static std::unique_ptr<LcmSubscriberSystem> MakeWithReceiveThread(
+      const std::string& channel, drake::lcm::DrakeLcmInterface* lcm,
+      const LcmReceiveThreadParams& params = {}) {
+    return std::make_unique<LcmSubscriberSystem>(
+        channel, std::make_unique<Serializer<LcmMessage>>(), lcm, params);
+  }
+
   /**
    * Constructor that returns a subscriber System that provides message objects
    * on its sole abstract-valued output port.  The type of the message object is
@@ -76,6 +138,27 @@ class LcmSubscriberSystem : public LeafSystem<double> {
                       std::unique_ptr<SerializerInterface> serializer,
                       drake::lcm::DrakeLcmInterface* lcm);
 
+  /**
+   * Constructor that returns a subscriber System in the threaded receive mode
+   * (see the class documentation), which provides message objects on its sole
+   * abstract-valued output port.  The type of the message object is
+   * determined by the @p serializer.
+   *
+   * @param[in] channel The LCM channel on which to subscribe.
+   *
+   * @param[in] serializer The serializer that converts between byte vectors
+   * and LCM message objects.
+   *
+   * @param lcm A non-null pointer to the LCM subsystem to subscribe on. It is
+   * pumped by the receive thread, and must outlive this system.
+   *
+   * @param params The parameters of the receive thread.
+   */
+  LcmSubscriberSystem(const std::string& channel,
+                      std::unique_ptr<SerializerInterface> serializer,
+                      drake::lcm::DrakeLcmInterface* lcm,
+                      const LcmReceiveThreadParams& params);
+
   ~LcmSubscriberSystem() override;
 
   /// Returns the default name for a system that subscribes to @p channel.
@@ -109,6 +192,11 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    * this will be less than or equal to old_message_count.
    *
    * @pre If `message` is specified, this system must be abstract-valued.
+   *
+   * In the threaded receive mode, `message` is copied from the ring buffer, so
+   * it must only be requested from the thread that processes the update
+   * events of this system, and throws if the received message was already
+   * stored in a State.
    */
   int WaitForMessage(int old_message_count, AbstractValue* message = nullptr,
                      double timeout = -1.) const;
@@ -124,7 +212,43 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    */
   int GetMessageCount(const Context<double>& context) const;
 
+  /// Returns true iff this system was made in the threaded receive mode.
+  bool has_receive_thread() const { return receive_buffer_ != nullptr; }
+
+  /**
+   * (Threaded receive mode only.) Returns the number of received messages that
+   * were never stored in a State, either because the ring buffer was full or
+   * because a more recent message was received before they were popped. This
+   * may be called from any thread.
+   * @throws std::exception if this system is not in the threaded receive mode.
+   */
+  int64_t get_num_dropped_messages() const;
+
+  /**
+   * (Threaded receive mode only.) Returns the time in seconds between the
+   * moment the most recently stored message was decoded by the receive thread
+   * and the moment it was stored in a State, or zero if no message has been
+   * stored yet. See also get_max_message_latency(). This may be called from
+   * any thread.
+   * @throws std::exception if this system is not in the threaded receive mode.
+   */
+  double get_last_message_latency() const;
+
+  /**
+   * (Threaded receive mode only.) Returns the largest of the latencies (see
+   * get_last_message_latency()) of the stored messages.
+   * @throws std::exception if this system is not in the threaded receive mode.
+   */
+  double get_max_message_latency() const;
+
  private:
+  // The ring buffer of decoded messages used in the threaded receive mode.
+  class ReceiveBuffer;
+
+  // Subscribes and declares the ports, the state and the events; shared by the
+  // constructors.
+  void Initialize(drake::lcm::DrakeLcmInterface* lcm);
+
   // Callback entry point from LCM into this class.
   void HandleMessage(const void*, int);
 
@@ -164,6 +288,16 @@ class LcmSubscriberSystem : public LeafSystem<double> {
 
   // A little hint to help catch use-after-free.
   int magic_number_{};
+
+  // The ring buffer and the thread that fills it; null (resp. not joinable)
+  // unless this system is in the threaded receive mode.
+  std::unique_ptr<ReceiveBuffer> receive_buffer_;
+  std::thread receive_thread_;
+  std::atomic<bool> stop_receive_thread_{false};
+
+  // The latency statistics of the threaded receive mode, in seconds.
+  mutable std::atomic<double> last_message_latency_{0.0};
+  mutable std::atomic<double> max_message_latency_{0.0};
 };
 
 }  // namespace lcm
@@ -6,6 +6,31 @@ namespace lcm {
 
 SerializerInterface::~SerializerInterface() {}
 
+EncodedBytesSerializer::~EncodedBytesSerializer() {}
+
+std::unique_ptr<AbstractValue> EncodedBytesSerializer::CreateDefaultValue()
+    const {
+  return std::make_unique<Value<std::vector<uint8_t>>>();
+}
+
+void EncodedBytesSerializer::Deserialize(
+    const void* message_bytes, int message_length,
+    AbstractValue* abstract_value) const {
+  DRAKE_DEMAND(abstract_value != nullptr);
+  DRAKE_THROW_UNLESS(message_length >= 0);
+  const uint8_t* const bytes = static_cast<const uint8_t*>(message_bytes);
+  abstract_value->get_mutable_value<std::vector<uint8_t>>().assign(
+      bytes, bytes + message_length);
+}
+
+void EncodedBytesSerializer::Serialize(
+    const AbstractValue& abstract_value,
+    std::vector<uint8_t>* message_bytes) const {
+  DRAKE_DEMAND(message_bytes != nullptr);
+  // Assignment reuses the capacity of the buffer.
+  *message_bytes = abstract_value.get_value<std::vector<uint8_t>>();
+}
+
 }  // namespace lcm
 }  // namespace systems
 }  // namespace drake
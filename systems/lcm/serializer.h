@@ -78,17 +78,56 @@ class Serializer : public SerializerInterface {
     DRAKE_THROW_UNLESS(consumed == message_length);
   }
 
+  /**
+   * Reuses the capacity of @p message_bytes, so that a caller that passes the
+   * same buffer for every message allocates no memory once the size of the
+   * messages settles.  The capacity also serves as a guess of the encoded
+   * size: the message is first encoded into it directly, and the size is
+   * only computed (which traverses the whole message) when it does not fit.
+   */
   void Serialize(const AbstractValue& abstract_value,
                  std::vector<uint8_t>* message_bytes) const override {
     DRAKE_DEMAND(message_bytes != nullptr);
     const LcmMessage& message = abstract_value.get_value<LcmMessage>();
-    const int message_length = message.getEncodedSize();
-    message_bytes->resize(message_length);
-    int consumed = message.encode(message_bytes->data(), 0, message_length);
-    DRAKE_THROW_UNLESS(consumed == message_length);
+    message_bytes->resize(message_bytes->capacity());
+    int consumed = message.encode(message_bytes->data(), 0,
+                                  static_cast<int>(message_bytes->size()));
+    if (consumed < 0) {
+      const int message_length = message.getEncodedSize();
+      message_bytes->resize(message_length);
+      consumed = message.encode(message_bytes->data(), 0, message_length);
+      DRAKE_THROW_UNLESS(consumed == message_length);
+    }
+    message_bytes->resize(consumed);
   }
 };
 
+/**
+ * %EncodedBytesSerializer passes through LCM messages that are already
+ * encoded, as drake::Value<std::vector<uint8_t>> objects.  It is meant for
+ * the systems that encode their messages directly from their inputs (see
+ * drake::lcm::LcmMessageWriter), without building the message object, e.g.,
+ * on the "lcm_message_bytes" output ports of
+ * multibody::ContactResultsToLcmSystem and
+ * rendering::PoseBundleToDrawMessage.
+ */
+class EncodedBytesSerializer final : public SerializerInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(EncodedBytesSerializer)
+
+  EncodedBytesSerializer() {}
+  ~EncodedBytesSerializer() override;
+
+  std::unique_ptr<AbstractValue> CreateDefaultValue() const override;
+
+  void Deserialize(
+      const void* message_bytes, int message_length,
+      AbstractValue* abstract_value) const override;
+
+  void Serialize(const AbstractValue& abstract_value,
+                 std::vector<uint8_t>* message_bytes) const override;
+};
+
 }  // namespace lcm
 }  // namespace systems
 }  // namespace drake
@@ -1,10 +1,13 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
 #include <array>
+#include <chrono>
 #include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
+#include "drake/lcm/drake_lcm.h"
 #include "drake/lcm/drake_mock_lcm.h"
 #include "drake/lcm/lcmt_drake_signal_utils.h"
 #include "drake/lcmt_drake_signal.hpp"
@@ -170,6 +173,100 @@ GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
   EXPECT_GE(second_timeout_count.get(), old_count + 1);
 }
 
+// Waits (up to a generous timeout) until `predicate` holds.
+template <typename Predicate>
+bool WaitUntil(Predicate predicate) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+// Tests the threaded receive mode, in which the receive thread of the dut
+// pumps the LCM.
+GTEST_TEST(LcmSubscriberSystemTest, ThreadedReceiveTest) {
+  drake::lcm::DrakeLcm lcm("memq://");
+  const std::string channel_name = "channel_name";
+
+  auto dut = LcmSubscriberSystem::MakeWithReceiveThread<lcmt_drake_signal>(
+      channel_name, &lcm);
+  EXPECT_TRUE(dut->has_receive_thread());
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+  SampleData sample_data;
+  Publish(&lcm, channel_name, sample_data.value);
+  EXPECT_GE(dut->WaitForMessage(0, nullptr, 10.0), 1);
+
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*context), 1);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), sample_data.value));
+  EXPECT_EQ(dut->get_num_dropped_messages(), 0);
+  EXPECT_GE(dut->get_last_message_latency(), 0.0);
+  EXPECT_GE(dut->get_max_message_latency(),
+            dut->get_last_message_latency());
+
+  // Without a new message, the state is unchanged.
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*context), 1);
+}
+
+// Tests that the messages that don't fit in the ring buffer, or that are
+// superseded before being stored, are counted as dropped.
+GTEST_TEST(LcmSubscriberSystemTest, ThreadedReceiveDropTest) {
+  drake::lcm::DrakeLcm lcm("memq://");
+  const std::string channel_name = "channel_name";
+
+  LcmReceiveThreadParams params;
+  params.buffer_capacity = 2;
+  auto dut = LcmSubscriberSystem::MakeWithReceiveThread<lcmt_drake_signal>(
+      channel_name, &lcm, params);
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+  // Four messages are sent before any is popped: the first two fill the
+  // buffer and the others are dropped.
+  SampleData sample_data;
+  for (int i = 0; i < 4; ++i) {
+    sample_data.value.timestamp = i;
+    Publish(&lcm, channel_name, sample_data.value);
+  }
+  ASSERT_TRUE(WaitUntil([&dut]() {
+    return dut->get_num_dropped_messages() == 2;
+  }));
+  EXPECT_EQ(dut->GetInternalMessageCount(), 2);
+
+  // The most recent message in the buffer is stored; the first one is
+  // superseded.
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(output->get_data(0)->get_value<lcmt_drake_signal>().timestamp, 1);
+  EXPECT_EQ(dut->get_num_dropped_messages(), 3);
+
+  // There is room again.
+  sample_data.value.timestamp = 4;
+  Publish(&lcm, channel_name, sample_data.value);
+  ASSERT_TRUE(WaitUntil([&dut]() {
+    return dut->GetInternalMessageCount() == 3;
+  }));
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(output->get_data(0)->get_value<lcmt_drake_signal>().timestamp, 4);
+  EXPECT_EQ(dut->GetMessageCount(*context), 3);
+  EXPECT_EQ(dut->get_num_dropped_messages(), 3);
+}
+
+// The statistics are only available in the threaded receive mode.
+GTEST_TEST(LcmSubscriberSystemTest, NoReceiveThreadTest) {
+  drake::lcm::DrakeMockLcm lcm;
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>("channel", &lcm);
+  EXPECT_FALSE(dut->has_receive_thread());
+  EXPECT_THROW(dut->get_num_dropped_messages(), std::exception);
+  EXPECT_THROW(dut->get_last_message_latency(), std::exception);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace systems
@@ -47,6 +47,34 @@ GTEST_TEST(SerializerTest, BasicTest) {
       abstract_value->get_value<lcmt_drake_signal>(), sample_data));
 }
 
+// The same buffer serves messages that grow and shrink.
+GTEST_TEST(SerializerTest, ReusedBuffer) {
+  const Serializer<lcmt_drake_signal> dut;
+  lcmt_drake_signal message{};
+  std::vector<uint8_t> message_bytes;
+  for (const int dim : {3, 1, 5, 0}) {
+    message.dim = dim;
+    message.val.assign(dim, 1.0);
+    message.coord.assign(dim, "coordinate");
+    dut.Serialize(Value<lcmt_drake_signal>(message), &message_bytes);
+    std::vector<uint8_t> expected(message.getEncodedSize());
+    message.encode(expected.data(), 0, expected.size());
+    EXPECT_EQ(message_bytes, expected);
+  }
+}
+
+GTEST_TEST(SerializerTest, EncodedBytes) {
+  const EncodedBytesSerializer dut;
+  auto abstract_value = dut.CreateDefaultValue();
+  EXPECT_TRUE(abstract_value->get_value<std::vector<uint8_t>>().empty());
+
+  const std::vector<uint8_t> bytes{1, 2, 3};
+  dut.Deserialize(bytes.data(), bytes.size(), abstract_value.get());
+  std::vector<uint8_t> message_bytes{4, 5, 6, 7};
+  dut.Serialize(*abstract_value, &message_bytes);
+  EXPECT_EQ(message_bytes, bytes);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace systems
@@ -236,17 +236,19 @@ unique_ptr<AffineSystem<T>> AffineSystem<T>::MakeAffineSystem(
 template <typename T>
 void AffineSystem<T>::CalcOutputY(const Context<T>& context,
                                   BasicVector<T>* output_vector) const {
-  const VectorX<T>& x = (this->time_period() == 0.)
+  // The products are evaluated directly into the output, without temporaries.
+  const auto x = (this->time_period() == 0.)
       ? dynamic_cast<const BasicVector<T>&>(
           context.get_continuous_state_vector()).get_value()
       : context.get_discrete_state().get_vector().get_value();
 
   auto y = output_vector->get_mutable_value();
-  y = C_ * x + y0_;
+  y = y0_.template cast<T>();
+  y.noalias() += C_ * x;
 
   if (this->num_inputs()) {
     const auto& u = this->get_input_port().Eval(context);
-    y += D_ * u;
+    y.noalias() += D_ * u;
   }
 }
 
@@ -259,14 +261,16 @@ void AffineSystem<T>::DoCalcTimeDerivatives(
       dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
           .get_value();
 
-  VectorX<T> xdot = A_ * x + f0_;
+  auto xdot = dynamic_cast<BasicVector<T>&>(derivatives->get_mutable_vector())
+                  .get_mutable_value();
+  xdot = f0_.template cast<T>();
+  xdot.noalias() += A_ * x;
 
   if (this->num_inputs() > 0) {
     const auto& u = this->get_input_port().Eval(context);
 
-    xdot += B_ * u;
+    xdot.noalias() += B_ * u;
   }
-  derivatives->SetFromVector(xdot);
 }
 
 template <typename T>
@@ -278,14 +282,15 @@ void AffineSystem<T>::DoCalcDiscreteVariableUpdates(
 
   const auto& x = context.get_discrete_state(0).get_value();
 
-  VectorX<T> xnext = A_ * x + f0_;
+  auto xnext = updates->get_mutable_vector().get_mutable_value();
+  xnext = f0_.template cast<T>();
+  xnext.noalias() += A_ * x;
 
   if (this->num_inputs() > 0) {
     const auto& u = this->get_input_port().Eval(context);
 
-    xnext += B_ * u;
+    xnext.noalias() += B_ * u;
   }
-  updates->get_mutable_vector().SetFromVector(xnext);
 }
 
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
 
 namespace drake {
 namespace systems {
@@ -28,6 +29,10 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
                                   &DiscreteTimeDelay::CopyDelayedVector,
                                   {this->xd_ticket()});
     this->DeclareDiscreteState(vector_size_ * delay_buffer_size_);
+    // This state keeps track of the index of the oldest value in the buffer,
+    // so that an update overwrites only that value instead of shifting the
+    // whole buffer.
+    this->DeclareDiscreteState(1);
     this->DeclarePeriodicDiscreteUpdateEvent(
         update_sec_, 0., &DiscreteTimeDelay::SaveInputVectorToBuffer);
   } else {
@@ -60,31 +65,37 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(const DiscreteTimeDelay<U>& other)
           other.is_abstract() ? other.abstract_model_value_->Clone()
                               : nullptr) {}
 
+template <typename T>
+int DiscreteTimeDelay<T>::GetOldestVectorIndex(
+    const DiscreteValues<T>& discrete_state) const {
+  DRAKE_ASSERT(!is_abstract());
+  return static_cast<int>(
+      ExtractDoubleOrThrow(discrete_state.get_vector(1).GetAtIndex(0)));
+}
+
 template <typename T>
 void DiscreteTimeDelay<T>::CopyDelayedVector(
     const Context<T>& context, BasicVector<T>* output) const {
   DRAKE_ASSERT(!is_abstract());
+  const int oldest_index = GetOldestVectorIndex(context.get_discrete_state());
   const BasicVector<T>& state_value = context.get_discrete_state(0);
-  output->SetFromVector(state_value.get_value().head(vector_size_));
+  output->SetFromVector(state_value.get_value().segment(
+      oldest_index * vector_size_, vector_size_));
 }
 
 template <typename T>
 void DiscreteTimeDelay<T>::SaveInputVectorToBuffer(
     const Context<T>& context, DiscreteValues<T>* discrete_state) const {
   DRAKE_ASSERT(!is_abstract());
-  // Copies the current state of the delay buffer from the context to the
-  // discrete state, sliding the buffer forward one step, dropping the oldest
-  // value and adding the value on the input port to the end of the buffer.
-  // TODO(mpetersen94): consider revising to avoid possibly expensive buffer
-  // copy operation.
+  // The discrete state already holds a copy of the delay buffer of the
+  // context: overwrites the oldest value with the value on the input port, and
+  // advances the index of the oldest value.
   const auto& input = get_input_port().Eval(context);
-  Eigen::VectorBlock<VectorX<T>> updated_state_value =
-      discrete_state->get_mutable_vector(0).get_mutable_value();
-  Eigen::VectorBlock<const VectorX<T>> old_state_value =
-      context.get_discrete_state(0).get_value();
-  updated_state_value.head((delay_buffer_size_ - 1) * vector_size_) =
-      old_state_value.tail((delay_buffer_size_ - 1) * vector_size_);
-  updated_state_value.tail(vector_size_) = input;
+  const int oldest_index = GetOldestVectorIndex(context.get_discrete_state());
+  discrete_state->get_mutable_vector(0).get_mutable_value().segment(
+      oldest_index * vector_size_, vector_size_) = input;
+  discrete_state->get_mutable_vector(1).SetAtIndex(
+      0, T((oldest_index + 1) % delay_buffer_size_));
 }
 
 template <typename T>
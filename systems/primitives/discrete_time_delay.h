@@ -24,15 +24,22 @@ namespace systems {
 /// Let t,z ∈ ℕ be the number of delay time steps and the input vector size.
 /// For abstract-valued %DiscreteTimeDelay, z is 1.
 /// The state x ∈ ℝ⁽ᵗ⁺¹⁾ᶻ is partitioned into t+1 blocks x[0] x[1] ... x[t],
-/// each of size z. The input and output are u,y ∈ ℝᶻ.
+/// each of size z, which form a ring buffer along with the index i ∈ ℕ of its
+/// oldest block. The input and output are u,y ∈ ℝᶻ.
 /// The discrete state space dynamics of %DiscreteTimeDelay is:
 /// ```
-///   xₙ₊₁ = xₙ[1] xₙ[2] ... xₙ[t] uₙ  // update
-///   yₙ = xₙ[0]                       // output
-///   x₀ = xᵢₙᵢₜ                       // initialize
+///   xₙ₊₁[iₙ] = uₙ, iₙ₊₁ = (iₙ + 1) mod (t+1)  // update
+///   yₙ = xₙ[iₙ]                               // output
+///   x₀ = xᵢₙᵢₜ, i₀ = 0                        // initialize
 /// ```
 /// where xᵢₙᵢₜ = 0 for vector-valued %DiscreteTimeDelay and xᵢₙᵢₜ is a
-/// given value for abstract-valued %DiscreteTimeDelay.
+/// given value for abstract-valued %DiscreteTimeDelay. The other blocks of
+/// x are unchanged by an update, so that an update only copies the input
+/// (regardless of the number of delay time steps).
+///
+/// For vector-valued %DiscreteTimeDelay, x is the first discrete state
+/// group and i is the second one. For abstract-valued %DiscreteTimeDelay,
+/// each block of x is an abstract state, and i is the last one.
 ///
 /// See @ref discrete_systems "Discrete Systems" for general information about
 /// discrete systems in Drake, including how they interact with continuous
@@ -79,8 +86,8 @@ class DiscreteTimeDelay final : public LeafSystem<T> {
   }
 
   /// (Advanced) Manually samples the input port and updates the state of the
-  /// block, sliding the delay buffer forward and placing the sampled input at
-  /// the end. This emulates an update event and is mostly useful for testing.
+  /// block, overwriting the oldest value of the delay buffer with the sampled
+  /// input. This emulates an update event and is mostly useful for testing.
   void SaveInputToBuffer(Context<T>* context) const {
     if (is_abstract()) {
       SaveInputAbstractValueToBuffer(*context, &context->get_mutable_state());
@@ -97,6 +104,9 @@ class DiscreteTimeDelay final : public LeafSystem<T> {
   DiscreteTimeDelay(double update_sec, int delay_timesteps, int vector_size,
                     std::unique_ptr<const AbstractValue> model_value);
 
+  // Returns the index of the oldest value in the vector-valued delay buffer.
+  int GetOldestVectorIndex(const DiscreteValues<T>& discrete_state) const;
+
   // Sets the output port value to the properly delayed vector value.
   void CopyDelayedVector(const Context<T>& context,
                          BasicVector<T>* output) const;
@@ -90,7 +90,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     variant<InputPortSelection, InputPortIndex> input_port_index,
     variant<OutputPortSelection, OutputPortIndex> output_port_index,
-    optional<double> equilibrium_check_tolerance = nullopt) {
+    optional<double> equilibrium_check_tolerance = nullopt,
+    const System<AutoDiffXd>* autodiff_system = nullptr) {
   DRAKE_ASSERT_VOID(system.CheckValidContext(context));
 
   const bool has_only_discrete_states_contained_in_one_group =
@@ -107,9 +108,13 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     time_period = periodic_data->period_sec();
   }
 
-  // Create an autodiff version of the system.
-  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
-      drake::systems::System<double>::ToAutoDiffXd(system);
+  // Create an autodiff version of the system, unless one was provided.
+  std::unique_ptr<System<AutoDiffXd>> owned_autodiff_system;
+  if (autodiff_system == nullptr) {
+    owned_autodiff_system =
+        drake::systems::System<double>::ToAutoDiffXd(system);
+    autodiff_system = owned_autodiff_system.get();
+  }
 
   // Initialize autodiff.
   std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
@@ -258,6 +263,27 @@ std::unique_ptr<LinearSystem<double>> Linearize(
                                                 affine->time_period());
 }
 
+namespace internal {
+
+std::unique_ptr<LinearSystem<double>> LinearizeWithAutoDiffSystem(
+    const System<double>& system, const System<AutoDiffXd>& autodiff_system,
+    const Context<double>& context,
+    variant<InputPortSelection, InputPortIndex> input_port_index,
+    variant<OutputPortSelection, OutputPortIndex> output_port_index,
+    double equilibrium_check_tolerance) {
+  std::unique_ptr<AffineSystem<double>> affine =
+      DoFirstOrderTaylorApproximation(
+          system, context, std::move(input_port_index),
+          std::move(output_port_index), equilibrium_check_tolerance,
+          &autodiff_system);
+
+  return std::make_unique<LinearSystem<double>>(affine->A(), affine->B(),
+                                                affine->C(), affine->D(),
+                                                affine->time_period());
+}
+
+}  // namespace internal
+
 std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     variant<InputPortSelection, InputPortIndex> input_port_index,
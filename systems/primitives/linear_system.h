@@ -251,6 +251,21 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     variant<OutputPortSelection, OutputPortIndex> output_port_index =
         OutputPortSelection::kUseFirstOutputIfItExists);
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+// Same as Linearize(), but differentiates with the given `autodiff_system`,
+// which must be the result of System::ToAutoDiffXd() on `system`. This spares
+// the scalar conversion when linearizing the same system many times, possibly
+// from several threads with distinct contexts.
+std::unique_ptr<LinearSystem<double>> LinearizeWithAutoDiffSystem(
+    const System<double>& system, const System<AutoDiffXd>& autodiff_system,
+    const Context<double>& context,
+    variant<InputPortSelection, InputPortIndex> input_port_index,
+    variant<OutputPortSelection, OutputPortIndex> output_port_index,
+    double equilibrium_check_tolerance);
+}  // namespace internal
+#endif
+
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
 /// @ingroup control_systems
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys);
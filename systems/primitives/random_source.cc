@@ -1,7 +1,6 @@
 #include "drake/systems/primitives/random_source.h"
 
 #include <atomic>
-#include <random>
 
 #include "drake/common/never_destroyed.h"
 
@@ -11,27 +10,6 @@ namespace {
 
 using Seed = RandomSource::Seed;
 
-// Stores exactly one of the three supported distribution objects.  Note that
-// the distribution objects hold computational state; they are not just pure
-// mathematical functions.
-using DistributionVariant = variant<
-    std::uniform_real_distribution<double>,
-    std::normal_distribution<double>,
-    std::exponential_distribution<double>>;
-
-// Creates a distribution object from the distribution enumeration.
-DistributionVariant MakeDistributionVariant(RandomDistribution which) {
-  switch (which) {
-    case RandomDistribution::kUniform:
-      return std::uniform_real_distribution<double>();
-    case RandomDistribution::kGaussian:
-      return std::normal_distribution<double>();
-    case RandomDistribution::kExponential:
-      return std::exponential_distribution<double>();
-  }
-  DRAKE_UNREACHABLE();
-}
-
 // Generates real-valued (i.e., `double`) samples from some distribution.  This
 // serves as the abstract state of a RandomSource, which encompasses all of the
 // source's state *except* for the currently-sampled output values which are
@@ -42,24 +20,30 @@ class SampleGenerator {
 
   SampleGenerator() = default;
   SampleGenerator(Seed seed, RandomDistribution which)
-      : seed_(seed), generator_(seed),
-        distribution_(MakeDistributionVariant(which)) {}
+      : seed_(seed), generator_(seed), distribution_(which) {}
 
   Seed seed() const { return seed_; }
 
-  double GenerateNext() {
-    switch (distribution_.index()) {
-      case 0: return get<0>(distribution_)(generator_);
-      case 1: return get<1>(distribution_)(generator_);
-      case 2: return get<2>(distribution_)(generator_);
+  // Overwrites all of `samples` with the next samples.
+  void GenerateNext(Eigen::Ref<Eigen::VectorXd> samples) {
+    switch (distribution_) {
+      case RandomDistribution::kUniform:
+        generator_.FillUniform(samples);
+        return;
+      case RandomDistribution::kGaussian:
+        generator_.FillGaussian(samples);
+        return;
+      case RandomDistribution::kExponential:
+        generator_.FillExponential(samples);
+        return;
     }
     DRAKE_UNREACHABLE();
   }
 
  private:
   Seed seed_{RandomGenerator::default_seed};
-  RandomGenerator generator_;
-  DistributionVariant distribution_;
+  CounterBasedRandomGenerator generator_{RandomGenerator::default_seed};
+  RandomDistribution distribution_{RandomDistribution::kUniform};
 };
 
 // Returns a monotonically increasing integer on each call.
@@ -123,10 +107,8 @@ void RandomSource::SetSeed(
 void RandomSource::UpdateSamples(
     const Context<double>&, State<double>* state) const {
   auto& source = state->template get_mutable_abstract_state<SampleGenerator>(0);
-  auto& samples = state->get_mutable_discrete_state(0);
-  for (int i = 0; i < samples.size(); ++i) {
-    samples[i] = source.GenerateNext();
-  }
+  auto samples = state->get_mutable_discrete_state(0).get_mutable_value();
+  source.GenerateNext(samples);
 }
 
 int AddRandomInputs(double sampling_interval_sec,
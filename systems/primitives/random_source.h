@@ -51,6 +51,9 @@ namespace systems {
 /// valid `seed` parameter; that context should not be used until its values
 /// are populated via another Context.
 ///
+/// @note The samples are drawn with a CounterBasedRandomGenerator seeded with
+/// the `seed` parameter, the whole output vector at once.
+///
 /// @note This system is only defined for the double scalar type.
 ///
 /// @note The exact distribution results may vary across multiple platforms or
@@ -1,7 +1,16 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
 
 namespace drake {
 namespace systems {
@@ -16,25 +25,139 @@ SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
 }
 
 template <typename T>
-void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
-    ++num_samples_;
-
-  // If num_samples exceeds the current allocation, then do a conservative
-  // resize (ouch!).
-  // TODO(russt): change to allocating on a std::vector here and moving into a
-  // single block of contiguous memory on the (first) data access, to avoid the
-  // O(n^2) complexity.
-  if (num_samples_ > sample_times_.size()) {
-    sample_times_.conservativeResize(sample_times_.size() +
-        batch_allocation_size_);
-    data_.conservativeResize(data_.rows(),
-                             data_.cols() + batch_allocation_size_);
+void SignalLog<T>::set_ring_buffer_mode(int capacity) {
+  DRAKE_THROW_UNLESS(mode_ == Mode::kGrowing);
+  DRAKE_THROW_UNLESS(num_samples_ == 0);
+  DRAKE_THROW_UNLESS(capacity > 0);
+  sample_times_.resize(capacity);
+  data_.resize(data_.rows(), capacity);
+  mode_ = Mode::kRingBuffer;
+}
+
+template <typename T>
+void SignalLog<T>::set_streaming_mode(int chunk_size, ChunkHandler handler) {
+  DRAKE_THROW_UNLESS(mode_ == Mode::kGrowing);
+  DRAKE_THROW_UNLESS(num_samples_ == 0);
+  DRAKE_THROW_UNLESS(chunk_size > 0);
+  DRAKE_THROW_UNLESS(handler != nullptr);
+  sample_times_.resize(chunk_size);
+  data_.resize(data_.rows(), chunk_size);
+  chunk_handler_ = std::move(handler);
+  mode_ = Mode::kStreaming;
+}
+
+template <typename T>
+typename SignalLog<T>::ChunkHandler SignalLog<T>::MakeBinaryFileChunkHandler(
+    const std::string& file_name) {
+  // The handler must be copyable, hence the shared stream.
+  auto out = std::make_shared<std::ofstream>(
+      file_name, std::ios::binary | std::ios::trunc);
+  if (!out->good()) {
+    throw std::runtime_error("Failed to open " + file_name);
+  }
+  return [out](const Eigen::Ref<const VectorX<T>>& sample_times,
+               const Eigen::Ref<const MatrixX<T>>& data) {
+    auto write = [&out](double value) {
+      out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    const int64_t num_samples = sample_times.size();
+    out->write(reinterpret_cast<const char*>(&num_samples),
+               sizeof(num_samples));
+    for (int64_t i = 0; i < num_samples; ++i) {
+      write(ExtractDoubleOrThrow(sample_times(i)));
+    }
+    for (int64_t j = 0; j < data.cols(); ++j) {
+      if constexpr (std::is_same<T, double>::value) {
+        out->write(reinterpret_cast<const char*>(data.col(j).data()),
+                   data.rows() * sizeof(double));
+      } else {
+        for (int64_t i = 0; i < data.rows(); ++i) {
+          write(ExtractDoubleOrThrow(data(i, j)));
+        }
+      }
+    }
+    out->flush();
+    if (!out->good()) {
+      throw std::runtime_error("SignalLog: failed to write a chunk.");
+    }
+  };
+}
+
+template <typename T>
+void SignalLog<T>::Flush() {
+  DRAKE_THROW_UNLESS(mode_ == Mode::kStreaming);
+  if (num_samples_ == 0) return;
+  chunk_handler_(sample_times_.head(num_samples_),
+                 data_.leftCols(num_samples_));
+  num_discarded_samples_ += num_samples_;
+  num_samples_ = 0;
+}
+
+template <typename T>
+void SignalLog<T>::AddData(T time,
+                           const Eigen::Ref<const VectorX<T>>& sample) {
+  // A sample whose time precedes that of the last sample replaces it.
+  if (num_samples_ == 0 ||
+      time >= sample_times_(column(num_samples_ - 1))) {
+    switch (mode_) {
+      case Mode::kGrowing: {
+        ++num_samples_;
+        // If num_samples exceeds the current allocation, then do a
+        // conservative resize (ouch!).
+        // TODO(russt): change to allocating on a std::vector here and moving
+        // into a single block of contiguous memory on the (first) data
+        // access, to avoid the O(n^2) complexity.
+        if (num_samples_ > sample_times_.size()) {
+          sample_times_.conservativeResize(sample_times_.size() +
+              batch_allocation_size_);
+          data_.conservativeResize(data_.rows(),
+                                   data_.cols() + batch_allocation_size_);
+        }
+        break;
+      }
+      case Mode::kRingBuffer: {
+        if (num_samples_ < sample_times_.size()) {
+          ++num_samples_;
+        } else {
+          // Overwrite the oldest sample.
+          first_sample_ = column(1);
+          ++num_discarded_samples_;
+        }
+        break;
+      }
+      case Mode::kStreaming: {
+        // The log is flushed as soon as it is full, below.
+        ++num_samples_;
+        break;
+      }
+    }
   }
 
   // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  const int64_t col = column(num_samples_ - 1);
+  sample_times_(col) = time;
+  data_.col(col) = sample;
+
+  if (mode_ == Mode::kStreaming && num_samples_ == sample_times_.size()) {
+    Flush();
+  }
+}
+
+template <typename T>
+void SignalLog<T>::MakeContiguous() const {
+  if (first_sample_ == 0) return;
+  // The oldest sample is only moved from the first column once the ring
+  // buffer is full.
+  DRAKE_DEMAND(num_samples_ == sample_times_.size());
+  T* const times = sample_times_.data();
+  std::rotate(times, times + first_sample_, times + num_samples_);
+  // The columns of data_ are contiguous, so that rotating its coefficients by
+  // whole columns rotates the columns.
+  T* const values = data_.data();
+  const int64_t rows = data_.rows();
+  std::rotate(values, values + first_sample_ * rows,
+              values + num_samples_ * rows);
+  first_sample_ = 0;
 }
 
 }  // namespace systems
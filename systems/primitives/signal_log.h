@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <string>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
@@ -12,6 +15,16 @@ namespace systems {
  primarily intended to support the Drake System primitive SignalLogger, but can
  be used independently.
 
+ By default, the log keeps every sample, growing its storage as needed. For
+ long-running processes, in which that would exhaust the memory, two other
+ storage modes keep the memory constant, with no reallocation when adding
+ samples:
+ - In the ring buffer mode (see set_ring_buffer_mode()), only the most recent
+   samples are kept.
+ - In the streaming mode (see set_streaming_mode()), the samples are handed
+   to a user-supplied handler in chunks of a fixed number of samples (e.g., to
+   be written to a file, see MakeBinaryFileChunkHandler()) and then discarded.
+
  @tparam T The vector element type, which must be a valid Eigen scalar.
  */
 template <typename T>
@@ -19,6 +32,13 @@ class SignalLog {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SignalLog)
 
+  /** The handler of the chunks of samples of the streaming mode. It is given
+   the sample times and the data of the chunk, in the same format as
+   sample_times() and data().  */
+  using ChunkHandler =
+      std::function<void(const Eigen::Ref<const VectorX<T>>& sample_times,
+                         const Eigen::Ref<const MatrixX<T>>& data)>;
+
   /** Constructs the signal log.
    @param input_size                Dimension of the per-time step data set.
    @param batch_allocation_size     Storage is (re)allocated in blocks of size
@@ -26,25 +46,68 @@ class SignalLog {
   */
   explicit SignalLog(int input_size, int batch_allocation_size = 1000);
 
-  /** Returns the number of samples taken since construction or last reset(). */
+  /** Switches to the ring buffer mode, in which only the most recent
+   `capacity` samples are kept: once the log is full, adding a sample discards
+   the oldest one. The storage is allocated once, here.
+   @throws std::exception if samples were already added, if the storage mode
+   was already set, or if `capacity` is not positive.  */
+  void set_ring_buffer_mode(int capacity);
+
+  /** Switches to the streaming mode, in which every time `chunk_size` samples
+   have been added, `handler` is called with them and they are discarded from
+   the log. Call Flush() to hand the remaining samples to the handler (e.g., at
+   the end of a simulation). The storage is allocated once, here.
+   @throws std::exception if samples were already added, if the storage mode
+   was already set, if `chunk_size` is not positive, or if `handler` is
+   empty.  */
+  void set_streaming_mode(int chunk_size, ChunkHandler handler);
+
+  /** Returns a ChunkHandler for the streaming mode that appends the chunks to
+   the binary file `file_name`, which is created (or truncated) when this is
+   called. Each chunk is written as its number of samples (a 64-bit integer)
+   followed by its sample times and its data in column-major order (i.e., the
+   data of each sample are contiguous), all as doubles in the native byte
+   order.
+   @throws std::exception if the file cannot be opened, or when writing a chunk
+   if a value cannot be converted to double (see ExtractDoubleOrThrow()).  */
+  static ChunkHandler MakeBinaryFileChunkHandler(const std::string& file_name);
+
+  /** (Streaming mode only.) Hands the samples that are in the log to the
+   handler, and discards them. Does nothing if the log is empty.
+   @throws std::exception if the log is not in the streaming mode.  */
+  void Flush();
+
+  /** Returns the number of samples taken since construction or last reset(),
+   minus the number of discarded samples (see num_discarded_samples()). */
   int num_samples() const { return num_samples_; }
 
+  /** Returns the number of samples that were discarded since construction or
+   last reset(): the oldest samples overwritten in the ring buffer mode, or the
+   samples handed to the handler in the streaming mode. This is always zero in
+   the default mode.  */
+  int64_t num_discarded_samples() const { return num_discarded_samples_; }
+
   /** Accesses the logged time stamps. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
+    MakeContiguous();
     return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
   }
 
   /** Accesses the logged data. */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
+    MakeContiguous();
     return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
   }
 
-  /** Clears the logged data. */
+  /** Clears the logged data. The storage mode is not changed, and in the
+   streaming mode the samples in the log are not handed to the handler. */
   void reset() {
     // Resetting num_samples_ is sufficient to have all future writes and
     // reads re-initialized to the beginning of the data.
     num_samples_ = 0;
+    first_sample_ = 0;
+    num_discarded_samples_ = 0;
   }
 
   /** Adds a `sample` to the data set with the associated `time` value.
@@ -52,16 +115,33 @@ class SignalLog {
    @param time      The time value for this sample.
    @param sample    A vector of data of the declared size for this log.
    */
-  void AddData(T time, VectorX<T> sample);
+  void AddData(T time, const Eigen::Ref<const VectorX<T>>& sample);
 
   /** Reports the size of the log's input vector. */
   int64_t get_input_size() const { return data_.rows(); }
 
  private:
+  enum class Mode { kGrowing, kRingBuffer, kStreaming };
+
+  // Returns the column of the i'th (oldest first) sample in the storage.
+  int64_t column(int64_t i) const {
+    const int64_t col = first_sample_ + i;
+    return col < sample_times_.size() ? col : col - sample_times_.size();
+  }
+
+  // In the ring buffer mode, rotates the storage so that the samples start at
+  // the first column.
+  void MakeContiguous() const;
+
   const int batch_allocation_size_{1000};
+  Mode mode_{Mode::kGrowing};
+  ChunkHandler chunk_handler_;
 
   // Use mutable variables to hold the logged data.
   mutable int64_t num_samples_{0};
+  // The column of the oldest sample (only nonzero in the ring buffer mode).
+  mutable int64_t first_sample_{0};
+  int64_t num_discarded_samples_{0};
   mutable VectorX<T> sample_times_;
   mutable MatrixX<T> data_;
 };
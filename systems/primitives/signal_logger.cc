@@ -24,6 +24,9 @@ template <typename T>
 template <typename U>
 SignalLogger<T>::SignalLogger(const SignalLogger<U>& other)
     : SignalLogger<T>(other.get_input_port().size()) {
+  if (other.ring_buffer_capacity_ > 0) {
+    this->set_ring_buffer_mode(other.ring_buffer_capacity_);
+  }
   switch (static_cast<LoggingMode>(other.logging_mode_)) {
     case kPeriodic: {
       const auto& events = other.GetPeriodicEvents();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -93,9 +94,43 @@ class SignalLogger final : public LeafSystem<T> {
   /// @throws std::logic_error if set_publish_period() has been called.
   void set_forced_publish_only();
 
-  /// Returns the number of samples taken since construction or last reset().
+  /// Keeps only the most recent `capacity` samples, in constant memory. See
+  /// SignalLog::set_ring_buffer_mode(). This setting is preserved by scalar
+  /// conversion.
+  /// @throws std::exception if samples were already logged, or if a storage
+  ///   mode was already set.
+  void set_ring_buffer_mode(int capacity) {
+    log_.set_ring_buffer_mode(capacity);
+    ring_buffer_capacity_ = capacity;
+  }
+
+  /// Hands the samples to `handler` in chunks of `chunk_size` samples, which
+  /// are then discarded, in constant memory. See
+  /// SignalLog::set_streaming_mode() and
+  /// SignalLog::MakeBinaryFileChunkHandler(). Unlike the other settings, this
+  /// one is not preserved by scalar conversion.
+  /// @throws std::exception if samples were already logged, or if a storage
+  ///   mode was already set.
+  void set_streaming_mode(int chunk_size,
+                          typename SignalLog<T>::ChunkHandler handler) {
+    log_.set_streaming_mode(chunk_size, std::move(handler));
+  }
+
+  /// (Streaming mode only.) Hands the remaining samples to the handler. See
+  /// SignalLog::Flush().
+  void Flush() { log_.Flush(); }
+
+  /// Returns the number of samples taken since construction or last reset(),
+  /// minus the number of those discarded by the ring buffer or streaming
+  /// modes.
   int num_samples() const { return log_.num_samples(); }
 
+  /// Returns the number of samples discarded by the ring buffer or streaming
+  /// modes. See SignalLog::num_discarded_samples().
+  int64_t num_discarded_samples() const {
+    return log_.num_discarded_samples();
+  }
+
   /// Provides access to the sample times of the logged data. Time is taken
   /// from the Context when the log entry is added.
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
@@ -132,6 +167,9 @@ class SignalLogger final : public LeafSystem<T> {
 
   LoggingMode logging_mode_{kPerStep};
 
+  // The capacity given to set_ring_buffer_mode(), if called.
+  int ring_buffer_capacity_{0};
+
   mutable SignalLog<T> log_;  // TODO(sherm1) Not thread safe :(
 };
 
@@ -0,0 +1,153 @@
+#include "drake/systems/primitives/sparse_affine_system.h"
+
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/systems/framework/basic_vector.h"
+
+namespace drake {
+namespace systems {
+
+// Our public constructor declares that our most specific subclass is
+// SparseAffineSystem, and then delegates to our protected constructor.
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : SparseAffineSystem<T>(SystemTypeTag<systems::SparseAffineSystem>{}, A,
+                            B, f0, C, D, y0, time_period) {}
+
+// Our protected constructor does all of the real work -- everything else
+// delegates to here.
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    SystemScalarConverter converter, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : TimeVaryingAffineSystem<T>(std::move(converter), f0.size(), D.cols(),
+                                 D.rows(), time_period),
+      A_(A),
+      B_(B),
+      f0_(f0),
+      C_(C),
+      D_(D),
+      y0_(y0) {
+  DRAKE_DEMAND(this->num_states() == A.rows());
+  DRAKE_DEMAND(this->num_states() == A.cols());
+  DRAKE_DEMAND(this->num_states() == B.rows());
+  DRAKE_DEMAND(this->num_states() == C.cols());
+  DRAKE_DEMAND(this->num_inputs() == B.cols());
+  DRAKE_DEMAND(this->num_inputs() == D.cols());
+  DRAKE_DEMAND(this->num_outputs() == C.rows());
+  DRAKE_DEMAND(this->num_outputs() == D.rows());
+  DRAKE_DEMAND(this->num_outputs() == y0.size());
+}
+
+// Our copy constructor delegates to the public constructor; this used only by
+// SystemScalarConverter as known to our public constructor, not by subclasses.
+template <typename T>
+template <typename U>
+SparseAffineSystem<T>::SparseAffineSystem(const SparseAffineSystem<U>& other)
+    : SparseAffineSystem(other.A(), other.B(), other.f0(), other.C(),
+                         other.D(), other.y0(), other.time_period()) {}
+
+template <typename T>
+void SparseAffineSystem<T>::CalcOutputY(const Context<T>& context,
+                                        BasicVector<T>* output_vector) const {
+  // The products are evaluated directly into the output, without temporaries.
+  const auto x = (this->time_period() == 0.)
+      ? dynamic_cast<const BasicVector<T>&>(
+          context.get_continuous_state_vector()).get_value()
+      : context.get_discrete_state().get_vector().get_value();
+
+  auto y = output_vector->get_mutable_value();
+  y = y0_.template cast<T>();
+  y.noalias() += C_ * x;
+
+  if (this->num_inputs()) {
+    const auto& u = this->get_input_port().Eval(context);
+    y.noalias() += D_ * u;
+  }
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcTimeDerivatives(
+    const Context<T>& context, ContinuousState<T>* derivatives) const {
+  if (this->num_states() == 0 || this->time_period() > 0.0) return;
+
+  const auto& x =
+      dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
+          .get_value();
+
+  auto xdot = dynamic_cast<BasicVector<T>&>(derivatives->get_mutable_vector())
+                  .get_mutable_value();
+  xdot = f0_.template cast<T>();
+  xdot.noalias() += A_ * x;
+
+  if (this->num_inputs() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    xdot.noalias() += B_ * u;
+  }
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcDiscreteVariableUpdates(
+    const drake::systems::Context<T>& context,
+    const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
+    drake::systems::DiscreteValues<T>* updates) const {
+  if (this->num_states() == 0 || this->time_period() == 0.0) return;
+
+  const auto& x = context.get_discrete_state(0).get_value();
+
+  auto xnext = updates->get_mutable_vector().get_mutable_value();
+  xnext = f0_.template cast<T>();
+  xnext.noalias() += A_ * x;
+
+  if (this->num_inputs() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    xnext.noalias() += B_ * u;
+  }
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcTimeDerivativesJacobian(
+    const Context<T>&, Eigen::SparseMatrix<T>* J) const {
+  *J = A_.template cast<T>();
+}
+
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    double time_period)
+    : SparseLinearSystem<T>(SystemTypeTag<systems::SparseLinearSystem>{}, A,
+                            B, C, D, time_period) {}
+
+template <typename T>
+template <typename U>
+SparseLinearSystem<T>::SparseLinearSystem(const SparseLinearSystem<U>& other)
+    : SparseLinearSystem<T>(other.A(), other.B(), other.C(), other.D(),
+                            other.time_period()) {}
+
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(
+    SystemScalarConverter converter, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B, const Eigen::SparseMatrix<double>& C,
+    const Eigen::SparseMatrix<double>& D, double time_period)
+    : SparseAffineSystem<T>(std::move(converter), A, B,
+                            Eigen::VectorXd::Zero(A.rows()), C, D,
+                            Eigen::VectorXd::Zero(C.rows()), time_period) {}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseAffineSystem)
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseLinearSystem)
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/primitives/affine_system.h"
+
+namespace drake {
+namespace systems {
+
+/// A discrete OR continuous affine system (with constant coefficients), whose
+/// coefficient matrices are sparse.
+///
+/// @system{SparseAffineSystem,
+///   @input_port{u(t)},
+///   @output_port{y(t)}
+/// }
+///
+/// This is the same system as AffineSystem:
+///   @f[ x(t+h) = A x(t) + B u(t) + f_0 \quad \text{or} \quad
+///       \dot{x} = A x + B u + f_0, @f]
+///   @f[ y = C x + D u + y_0, @f]
+/// but the coefficient matrices are stored as `Eigen::SparseMatrix<double>`,
+/// so that the dynamics and the outputs are evaluated with sparse products.
+/// This suits systems with many states and sparse dynamics, e.g., discretized
+/// partial differential equations.
+///
+/// A continuous-time %SparseAffineSystem also provides the (sparse) Jacobian
+/// of its time derivatives, A, through System::CalcTimeDerivativesJacobian(),
+/// which implicit integrators can use instead of finite differences (see
+/// ImplicitIntegrator::JacobianComputationScheme::kSystemProvided).
+///
+/// @note The dense coefficient getters of TimeVaryingAffineSystem (e.g.,
+/// `A(t)`) are implemented, but materialize dense matrices; prefer the sparse
+/// getters (e.g., `A()`).
+///
+/// @tparam T The scalar element type, which must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+/// - symbolic::Expression
+///
+/// They are already available to link against in the containing library.
+/// No other values for T are currently supported.
+///
+/// @ingroup primitive_systems
+///
+/// @see AffineSystem
+/// @see SparseLinearSystem
+template <typename T>
+class SparseAffineSystem : public TimeVaryingAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseAffineSystem)
+
+  /// Constructs a sparse affine system with a fixed set of coefficient
+  /// matrices `A`, `B`,`C`, and `D` as well as fixed initial velocity offset
+  /// `f0` and output offset `y0`, whose dimensions must be as for
+  /// AffineSystem.
+  ///
+  /// @param time_period Defines the period of the discrete time system; use
+  ///  time_period=0.0 to denote a continuous time system.  @default 0.0
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  SparseAffineSystem(const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::Ref<const Eigen::VectorXd>& f0,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     const Eigen::Ref<const Eigen::VectorXd>& y0,
+                     double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseAffineSystem(const SparseAffineSystem<U>&);
+
+  /// @name Helper getter methods.
+  /// @{
+  const Eigen::SparseMatrix<double>& A() const { return A_; }
+  const Eigen::SparseMatrix<double>& B() const { return B_; }
+  const Eigen::VectorXd& f0() const { return f0_; }
+  const Eigen::SparseMatrix<double>& C() const { return C_; }
+  const Eigen::SparseMatrix<double>& D() const { return D_; }
+  const Eigen::VectorXd& y0() const { return y0_; }
+  /// @}
+
+  /// @name Implementations of TimeVaryingAffineSystem<T>'s pure virtual
+  /// methods.
+  /// @{
+  MatrixX<T> A(const T&) const final { return ToDense(A_); }
+  MatrixX<T> B(const T&) const final { return ToDense(B_); }
+  VectorX<T> f0(const T&) const final { return VectorX<T>(f0_); }
+  MatrixX<T> C(const T&) const final { return ToDense(C_); }
+  MatrixX<T> D(const T&) const final { return ToDense(D_); }
+  VectorX<T> y0(const T&) const final { return VectorX<T>(y0_); }
+  /// @}
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseAffineSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::Ref<const Eigen::VectorXd>& f0,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     const Eigen::Ref<const Eigen::VectorXd>& y0,
+                     double time_period);
+
+ private:
+  static MatrixX<T> ToDense(const Eigen::SparseMatrix<double>& M) {
+    return Eigen::MatrixXd(M).template cast<T>();
+  }
+
+  void CalcOutputY(const Context<T>& context,
+                   BasicVector<T>* output_vector) const final;
+
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final;
+
+  void DoCalcDiscreteVariableUpdates(
+      const drake::systems::Context<T>& context,
+      const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>& events,
+      drake::systems::DiscreteValues<T>* updates) const final;
+
+  bool DoHasTimeDerivativesJacobian() const final {
+    return this->time_period() == 0.0;
+  }
+
+  void DoCalcTimeDerivativesJacobian(const Context<T>& context,
+                                     Eigen::SparseMatrix<T>* J) const final;
+
+  const Eigen::SparseMatrix<double> A_;
+  const Eigen::SparseMatrix<double> B_;
+  const Eigen::VectorXd f0_;
+  const Eigen::SparseMatrix<double> C_;
+  const Eigen::SparseMatrix<double> D_;
+  const Eigen::VectorXd y0_;
+};
+
+/// A discrete OR continuous linear system (with constant coefficients), whose
+/// coefficient matrices are sparse: a SparseAffineSystem with f₀ = 0 and
+/// y₀ = 0.
+///
+/// @system{SparseLinearSystem,
+///   @input_port{u(t)},
+///   @output_port{y(t)}
+/// }
+///
+/// @tparam T The scalar element type, which must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+/// - symbolic::Expression
+///
+/// They are already available to link against in the containing library.
+/// No other values for T are currently supported.
+///
+/// @ingroup primitive_systems
+///
+/// @see LinearSystem
+/// @see SparseAffineSystem
+template <typename T>
+class SparseLinearSystem : public SparseAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseLinearSystem)
+
+  /// Constructs a %SparseLinearSystem with a fixed set of coefficient
+  /// matrices `A`, `B`,`C`, and `D`, whose dimensions must be as for
+  /// LinearSystem.
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  SparseLinearSystem(const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseLinearSystem(const SparseLinearSystem<U>&);
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseLinearSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     double time_period);
+};
+
+}  // namespace systems
+}  // namespace drake
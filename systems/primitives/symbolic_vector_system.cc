@@ -1,20 +1,76 @@
 #include "drake/systems/primitives/symbolic_vector_system.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "drake/common/drake_optional.h"
+#include "drake/common/extract_double.h"
 #include "drake/math/autodiff_gradient.h"
 
 namespace drake {
 namespace systems {
 
 using Eigen::Ref;
-using symbolic::Environment;
 using symbolic::Expression;
 using symbolic::Jacobian;
+using symbolic::is_zero;
 using symbolic::Variable;
 using symbolic::Variables;
 
+namespace {
+
+// Returns an evaluator of `expr`, followed by the column-major `jacobian`.
+symbolic::ExpressionEvaluator CompileWithJacobian(
+    const std::vector<Variable>& vars, const VectorX<Expression>& expr,
+    const MatrixX<Expression>& jacobian) {
+  VectorX<Expression> all(expr.size() + jacobian.size());
+  all << expr, Eigen::Map<const VectorX<Expression>>(jacobian.data(),
+                                                      jacobian.size());
+  return symbolic::ExpressionEvaluator(vars, all);
+}
+
+// Compiles the dynamics and output, and their Jacobians, of the variables
+// `vars_vec`, of which the first `num_states` are the state variables.
+std::shared_ptr<const internal::SymbolicVectorSystemKernels> Compile(
+    const VectorX<Variable>& vars_vec, int num_states,
+    const VectorX<Expression>& dynamics, const VectorX<Expression>& output) {
+  auto kernels = std::make_shared<internal::SymbolicVectorSystemKernels>();
+  const std::vector<Variable> vars(vars_vec.data(),
+                                   vars_vec.data() + vars_vec.size());
+  const MatrixX<Expression> dynamics_jacobian =
+      dynamics.size() > 0 && vars_vec.size() > 0
+          ? Jacobian(dynamics, vars_vec)
+                          : MatrixX<Expression>(0, vars.size());
+  const MatrixX<Expression> output_jacobian =
+      output.size() > 0 && vars_vec.size() > 0
+          ? Jacobian(output, vars_vec)
+                        : MatrixX<Expression>(0, vars.size());
+  kernels->dynamics = symbolic::ExpressionEvaluator(vars, dynamics);
+  kernels->output = symbolic::ExpressionEvaluator(vars, output);
+  kernels->dynamics_and_jacobian =
+      CompileWithJacobian(vars, dynamics, dynamics_jacobian);
+  kernels->output_and_jacobian =
+      CompileWithJacobian(vars, output, output_jacobian);
+
+  std::vector<Expression> state_jacobian;
+  for (int j = 0; j < num_states; ++j) {
+    for (int i = 0; i < dynamics_jacobian.rows(); ++i) {
+      const Expression& entry = dynamics_jacobian(i, j);
+      if (!is_zero(entry)) {
+        state_jacobian.push_back(entry);
+        kernels->state_jacobian_rows.push_back(i);
+        kernels->state_jacobian_cols.push_back(j);
+      }
+    }
+  }
+  kernels->state_jacobian = symbolic::ExpressionEvaluator(
+      vars, Eigen::Map<const VectorX<Expression>>(state_jacobian.data(),
+                                                  state_jacobian.size()));
+  return kernels;
+}
+
+}  // namespace
+
 template <typename T>
 SymbolicVectorSystem<T>::SymbolicVectorSystem(
     const optional<Variable>& time, const Ref<const VectorX<Variable>>& state,
@@ -22,6 +78,17 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
     const Ref<const VectorX<Variable>>& parameter,
     const Ref<const VectorX<Expression>>& dynamics,
     const Ref<const VectorX<Expression>>& output, double time_period)
+    : SymbolicVectorSystem<T>(time, state, input, parameter, dynamics, output,
+                              time_period, nullptr) {}
+
+template <typename T>
+SymbolicVectorSystem<T>::SymbolicVectorSystem(
+    const optional<Variable>& time, const Ref<const VectorX<Variable>>& state,
+    const Ref<const VectorX<Variable>>& input,
+    const Ref<const VectorX<Variable>>& parameter,
+    const Ref<const VectorX<Expression>>& dynamics,
+    const Ref<const VectorX<Expression>>& output, double time_period,
+    std::shared_ptr<const internal::SymbolicVectorSystemKernels> kernels)
     : LeafSystem<T>(SystemTypeTag<systems::SymbolicVectorSystem>{}),
       time_var_(time),
       state_vars_(state),
@@ -70,19 +137,42 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
                                   &SymbolicVectorSystem<T>::CalcOutput);
   }
 
-  // Initialize Jacobian matrices iff T == AutoDiffXd.
-  if (std::is_same<T, AutoDiffXd>::value) {
-    if (dynamics_.size() > 0) {
-      dynamics_jacobian_ = Jacobian(dynamics_, vars_vec);
+  // Compile the dynamics and output, and their Jacobians, once for all of the
+  // scalar conversions of this system, to evaluate them without walking the
+  // expression trees.
+  kernels_ = kernels != nullptr
+                 ? std::move(kernels)
+                 : Compile(vars_vec, state_vars_.size(), dynamics_, output_);
+}
+
+template <typename T>
+void SymbolicVectorSystem<T>::CopyValuesFromContext(
+    const Context<T>& context, Eigen::VectorXd* values) const {
+  values->resize(state_vars_.size() + input_vars_.size() +
+                 parameter_vars_.size() + (time_var_ ? 1 : 0));
+  int index = 0;
+  if (state_vars_.size() > 0) {
+    const VectorBase<T>& state = (time_period_ > 0.0)
+                                     ? context.get_discrete_state_vector()
+                                     : context.get_continuous_state_vector();
+    for (int i = 0; i < state_vars_.size(); i++) {
+      (*values)[index++] = ExtractDoubleOrThrow(state[i]);
     }
-    if (output_.size() > 0) {
-      output_jacobian_ = Jacobian(output_, vars_vec);
+  }
+  if (input_vars_.size() > 0) {
+    const auto& input = get_input_port().Eval(context);
+    for (int i = 0; i < input_vars_.size(); i++) {
+      (*values)[index++] = ExtractDoubleOrThrow(input[i]);
     }
   }
-
-  // Allocate a symbolic::Environment once to be cloned/reused below.
-  for (const auto& v : all_vars) {
-    env_.insert(v, 0.0);
+  if (parameter_vars_.size() > 0) {
+    const auto& parameter = context.get_numeric_parameter(0);
+    for (int i = 0; i < parameter_vars_.size(); i++) {
+      (*values)[index++] = ExtractDoubleOrThrow(parameter[i]);
+    }
+  }
+  if (time_var_) {
+    (*values)[index++] = ExtractDoubleOrThrow(context.get_time());
   }
 }
 
@@ -122,21 +212,24 @@ void SymbolicVectorSystem<T>::PopulateFromContext(const Context<T>& context,
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<double>* out) const {
-  unused(jacobian);
-  Environment env = env_;
-  PopulateFromContext(context, &env);
-  for (int i = 0; i < out->size(); i++) {
-    out->SetAtIndex(i, expr[i].Evaluate(env));
-  }
+  unused(expr, values_and_jacobian);
+  Eigen::VectorXd vars;
+  CopyValuesFromContext(context, &vars);
+  Eigen::VectorXd results(out->size());
+  values.Evaluate(vars, &results);
+  out->SetFromVector(results);
 }
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<AutoDiffXd>* pout) const {
+  unused(expr, values);
   VectorBase<AutoDiffXd>& out = *pout;
 
   const BasicVector<AutoDiffXd> empty(0);
@@ -172,44 +265,43 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
         num_gradients, static_cast<int>(parameter[0].derivatives().size()));
   }
 
-  Eigen::MatrixXd dvars(jacobian.cols(), num_gradients);
-  Environment env = env_;
+  const int num_vars = values_and_jacobian.num_variables();
+  Eigen::MatrixXd dvars(num_vars, num_gradients);
   if (time_var_) {
-    env[*time_var_] = time.value();
     dvars.bottomRows<1>() = time.derivatives();
   }
   size_t dvars_row_idx = 0;
   for (int i = 0; i < state_vars_.size(); i++) {
-    env[state_vars_[i]] = state[i].value();
     dvars.row(dvars_row_idx++) = state[i].derivatives();
   }
   for (int i = 0; i < input_vars_.size(); i++) {
-    env[input_vars_[i]] = input[i].value();
     dvars.row(dvars_row_idx++) = input[i].derivatives();
   }
   for (int i = 0; i < parameter_vars_.size(); i++) {
-    env[parameter_vars_[i]] = parameter[i].value();
     dvars.row(dvars_row_idx++) = parameter[i].derivatives();
   }
 
-  // Now actually compute the output values and derivatives.
-  Eigen::RowVectorXd dout_dvars(jacobian.cols());
+  // Now actually compute the output values and derivatives, the latter from
+  // the (column-major) Jacobian that follows the values in the results.
+  Eigen::VectorXd vars;
+  CopyValuesFromContext(context, &vars);
+  Eigen::VectorXd results(values_and_jacobian.num_expressions());
+  values_and_jacobian.Evaluate(vars, &results);
+  const Eigen::Map<const Eigen::MatrixXd> dout_dvars(
+      results.data() + out.size(), out.size(), num_vars);
   for (int i = 0; i < out.size(); i++) {
-    out[i].value() = expr[i].Evaluate(env);
-
-    for (int j = 0; j < jacobian.cols(); j++) {
-      dout_dvars(j) = jacobian(i, j).Evaluate(env);
-    }
-    out[i].derivatives() = dout_dvars * dvars;
+    out[i].value() = results[i];
+    out[i].derivatives() = dout_dvars.row(i) * dvars;
   }
 }
 
 template <>
 void SymbolicVectorSystem<Expression>::EvaluateWithContext(
     const Context<Expression>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<Expression>* out) const {
-  unused(jacobian);
+  unused(values, values_and_jacobian);
   symbolic::Substitution s;
   PopulateFromContext(context, &s);
   for (int i = 0; i < out->size(); i++) {
@@ -221,7 +313,8 @@ template <typename T>
 void SymbolicVectorSystem<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* output_vector) const {
   DRAKE_DEMAND(output_.size() > 0);
-  EvaluateWithContext(context, output_, output_jacobian_, output_vector);
+  EvaluateWithContext(context, output_, kernels_->output,
+                      kernels_->output_and_jacobian, output_vector);
 }
 
 template <typename T>
@@ -229,10 +322,37 @@ void SymbolicVectorSystem<T>::DoCalcTimeDerivatives(
     const Context<T>& context, ContinuousState<T>* derivatives) const {
   DRAKE_DEMAND(time_period_ == 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, kernels_->dynamics,
+                      kernels_->dynamics_and_jacobian,
                       &derivatives->get_mutable_vector());
 }
 
+template <typename T>
+bool SymbolicVectorSystem<T>::DoHasTimeDerivativesJacobian() const {
+  // The Jacobian is only provided as values, whose own derivatives (for
+  // T == AutoDiffXd) would need the second derivatives of the dynamics.
+  return std::is_same<T, double>::value && time_period_ == 0.0 &&
+         state_vars_.size() > 0;
+}
+
+template <typename T>
+void SymbolicVectorSystem<T>::DoCalcTimeDerivativesJacobian(
+    const Context<T>& context, Eigen::SparseMatrix<T>* J) const {
+  const symbolic::ExpressionEvaluator& state_jacobian =
+      kernels_->state_jacobian;
+  Eigen::VectorXd vars;
+  CopyValuesFromContext(context, &vars);
+  Eigen::VectorXd entries(state_jacobian.num_expressions());
+  state_jacobian.Evaluate(vars, &entries);
+  std::vector<Eigen::Triplet<T>> triplets;
+  triplets.reserve(entries.size());
+  for (int k = 0; k < entries.size(); ++k) {
+    triplets.emplace_back(kernels_->state_jacobian_rows[k],
+                          kernels_->state_jacobian_cols[k], T(entries[k]));
+  }
+  J->setFromTriplets(triplets.begin(), triplets.end());
+}
+
 template <typename T>
 void SymbolicVectorSystem<T>::DoCalcDiscreteVariableUpdates(
     const drake::systems::Context<T>& context,
@@ -241,7 +361,8 @@ void SymbolicVectorSystem<T>::DoCalcDiscreteVariableUpdates(
   unused(events);
   DRAKE_DEMAND(time_period_ > 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, kernels_->dynamics,
+                      kernels_->dynamics_and_jacobian,
                       &updates->get_mutable_vector());
 }
 
@@ -15,6 +15,28 @@
 namespace drake {
 namespace systems {
 
+namespace internal {
+// The compiled dynamics and output of a SymbolicVectorSystem, whose variables
+// are its state, input, parameter and time variables, in this order. They do
+// not depend on the scalar type, so the scalar conversions of a system share
+// them.
+struct SymbolicVectorSystemKernels {
+  // The dynamics and the output.
+  symbolic::ExpressionEvaluator dynamics;
+  symbolic::ExpressionEvaluator output;
+  // The same, followed by their (column-major) Jacobians with respect to all
+  // of the variables.
+  symbolic::ExpressionEvaluator dynamics_and_jacobian;
+  symbolic::ExpressionEvaluator output_and_jacobian;
+  // The structurally non-zero entries of the Jacobian of the dynamics with
+  // respect to the state, whose row and column indices are given by
+  // state_jacobian_rows and state_jacobian_cols.
+  symbolic::ExpressionEvaluator state_jacobian;
+  std::vector<int> state_jacobian_rows;
+  std::vector<int> state_jacobian_cols;
+};
+}  // namespace internal
+
 /// A LeafSystem that is defined by vectors of symbolic::Expression
 /// representing the dynamics and output.  The resulting system has only zero
 /// or one vector input ports, zero or one vector of continuous or discrete
@@ -129,7 +151,7 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
       : SymbolicVectorSystem<T>(other.time_var_, other.state_vars_,
                                 other.input_vars_, other.parameter_vars_,
                                 other.dynamics_, other.output_,
-                                other.time_period_) {}
+                                other.time_period_, other.kernels_) {}
 
   ~SymbolicVectorSystem() override = default;
 
@@ -158,14 +180,34 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   /// @}
 
  private:
+  // Constructs the system with the compiled `kernels` of an identical system,
+  // or compiles them if `kernels` is null.
+  SymbolicVectorSystem(
+      const optional<symbolic::Variable>& time,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& state,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& input,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& parameter,
+      const Eigen::Ref<const VectorX<symbolic::Expression>>& dynamics,
+      const Eigen::Ref<const VectorX<symbolic::Expression>>& output,
+      double time_period,
+      std::shared_ptr<const internal::SymbolicVectorSystemKernels> kernels);
+
   template <typename Container>
   void PopulateFromContext(const Context<T>& context, Container* penv) const;
 
-  // Evaluate context to a vector.
-  void EvaluateWithContext(const Context<T>& context,
-                           const VectorX<symbolic::Expression>& expr,
-                           const MatrixX<symbolic::Expression>& jacobian,
-                           VectorBase<T>* out) const;
+  // Copies the values of the variables in `context` into `values`, in the
+  // order of the variables of the kernels.
+  void CopyValuesFromContext(const Context<T>& context,
+                             Eigen::VectorXd* values) const;
+
+  // Evaluate context to a vector. For T == double, `values` evaluates
+  // `expr`; for T == AutoDiffXd, `values_and_jacobian` evaluates `expr`
+  // followed by its Jacobian.
+  void EvaluateWithContext(
+      const Context<T>& context, const VectorX<symbolic::Expression>& expr,
+      const symbolic::ExpressionEvaluator& values,
+      const symbolic::ExpressionEvaluator& values_and_jacobian,
+      VectorBase<T>* out) const;
 
   void CalcOutput(const Context<T>& context,
                   BasicVector<T>* output_vector) const;
@@ -173,6 +215,11 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   void DoCalcTimeDerivatives(const Context<T>& context,
                              ContinuousState<T>* derivatives) const final;
 
+  bool DoHasTimeDerivativesJacobian() const final;
+
+  void DoCalcTimeDerivativesJacobian(const Context<T>& context,
+                                     Eigen::SparseMatrix<T>* J) const final;
+
   void DoCalcDiscreteVariableUpdates(
       const drake::systems::Context<T>& context,
       const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>& events,
@@ -185,12 +232,9 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   const VectorX<symbolic::Expression> dynamics_{};
   const VectorX<symbolic::Expression> output_{};
 
-  symbolic::Environment env_{};
   const double time_period_{0.0};
 
-  // Storage for Jacobians (empty unless T == AutoDiffXd).
-  MatrixX<symbolic::Expression> dynamics_jacobian_{};
-  MatrixX<symbolic::Expression> output_jacobian_{};
+  std::shared_ptr<const internal::SymbolicVectorSystemKernels> kernels_;
 
   template <typename U>
   friend class SymbolicVectorSystem;
@@ -354,21 +398,24 @@ class SymbolicVectorSystemBuilder {
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<double>* out) const;
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<AutoDiffXd>* out) const;
 
 template <>
 void SymbolicVectorSystem<symbolic::Expression>::EvaluateWithContext(
     const Context<symbolic::Expression>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::ExpressionEvaluator& values,
+    const symbolic::ExpressionEvaluator& values_and_jacobian,
     VectorBase<symbolic::Expression>* out) const;
 #endif
 
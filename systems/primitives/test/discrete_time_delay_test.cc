@@ -59,6 +59,18 @@ Eigen::VectorXd ConcatenateAbstractBufferToVector(Context<double>* context) {
   return value;
 }
 
+Eigen::VectorXd ConcatenateVectorBufferToVector(Context<double>* context) {
+  const Eigen::VectorXd buffer = context->get_discrete_state(0).CopyToVector();
+  const int oldest_index =
+      static_cast<int>(context->get_discrete_state(1).GetAtIndex(0));
+  Eigen::VectorXd value(kLength * (kBuffer + 1));
+  for (int ii = 0; ii < kBuffer + 1; ii++) {
+    value.segment(ii * kLength, kLength) = buffer.segment(
+        ((oldest_index + ii) % (kBuffer + 1)) * kLength, kLength);
+  }
+  return value;
+}
+
 class DiscreteTimeDelayTest : public ::testing::TestWithParam<bool> {
  protected:
   DiscreteTimeDelayTest() : is_abstract_(GetParam()) {}
@@ -149,8 +161,7 @@ TEST_P(DiscreteTimeDelayTest, Update) {
   Eigen::VectorXd value;
   // Check that the state has been updated to the input.
   if (!is_abstract_) {
-    const BasicVector<double>& xd = context_->get_discrete_state(0);
-    value = xd.CopyToVector();
+    value = ConcatenateVectorBufferToVector(context_.get());
   } else {
     value = ConcatenateAbstractBufferToVector(context_.get());
   }
@@ -325,18 +336,24 @@ TEST_F(SymbolicDiscreteTimeDelayTest, Output) {
   EXPECT_EQ("x0", out[0].to_string());
 }
 
-// Tests that SaveInputVectorToBuffer updates the state (i.e. slides the buffer
-// forward, adding the input value to the end of the buffer).
+// Tests that SaveInputVectorToBuffer updates the state (i.e. overwrites the
+// oldest entry of the buffer with the input value, and advances the index of
+// the oldest entry).
 TEST_F(SymbolicDiscreteTimeDelayTest, Update) {
   const auto& xd = context_->get_discrete_state(0);
   for (int ii = 0; ii < (kBuffer + 1); ii++) {
     EXPECT_EQ("x" + std::to_string(ii), xd[ii].to_string());
   }
   delay_->SaveInputToBuffer(context_.get());
-  for (int ii = 0; ii < kBuffer; ii++) {
-    EXPECT_EQ("x" + std::to_string(ii + 1), xd[ii].to_string());
+  EXPECT_EQ("u0", xd[0].to_string());
+  for (int ii = 1; ii < (kBuffer + 1); ii++) {
+    EXPECT_EQ("x" + std::to_string(ii), xd[ii].to_string());
   }
-  EXPECT_EQ("u0", xd[kBuffer].to_string());
+  EXPECT_EQ("1", context_->get_discrete_state(1)[0].to_string());
+
+  // The next oldest entry is outputted.
+  const auto& out = delay_->get_output_port().Eval(*context_);
+  EXPECT_EQ("x1", out[0].to_string());
 }
 
 }  // namespace
@@ -1,13 +1,18 @@
 #include "drake/systems/primitives/signal_logger.h"
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/test_utilities/scalar_conversion.h"
@@ -165,6 +170,124 @@ GTEST_TEST(TestSignalLogger, DiagramToAutoDiff) {
   EXPECT_TRUE(is_autodiffxd_convertible(*diagram));
 }
 
+// The ring buffer mode keeps the most recent samples, in order, without
+// allocating.
+GTEST_TEST(TestSignalLog, RingBufferMode) {
+  SignalLog<double> log(2);
+  log.set_ring_buffer_mode(3);
+  EXPECT_THROW(log.set_ring_buffer_mode(3), std::exception);
+  const Eigen::Vector2d sample(1.0, 2.0);
+  {
+    drake::test::LimitMalloc guard;
+    for (int i = 0; i < 5; ++i) {
+      const Eigen::Vector2d value = sample * i;
+      log.AddData(i, value);
+    }
+  }
+  EXPECT_EQ(log.num_samples(), 3);
+  EXPECT_EQ(log.num_discarded_samples(), 2);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), Eigen::Vector3d(2, 3, 4)));
+  Eigen::Matrix<double, 2, 3> expected_data;
+  expected_data << 2, 3, 4,
+                   4, 6, 8;
+  EXPECT_TRUE(CompareMatrices(log.data(), expected_data));
+
+  // Adding after an access continues from the most recent sample, and a
+  // sample that goes back in time replaces the last one.
+  log.AddData(5, sample * 5);
+  log.AddData(4.5, sample * 4.5);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(),
+                              Eigen::Vector3d(3, 4, 4.5)));
+
+  log.reset();
+  EXPECT_EQ(log.num_samples(), 0);
+  EXPECT_EQ(log.num_discarded_samples(), 0);
+  log.AddData(7, sample);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), Vector1d(7)));
+}
+
+// The streaming mode hands out chunks of samples.
+GTEST_TEST(TestSignalLog, StreamingMode) {
+  SignalLog<double> log(1);
+  EXPECT_THROW(log.Flush(), std::exception);
+  std::vector<Eigen::VectorXd> chunk_times;
+  std::vector<Eigen::MatrixXd> chunk_data;
+  log.set_streaming_mode(
+      2, [&](const Eigen::Ref<const Eigen::VectorXd>& sample_times,
+             const Eigen::Ref<const Eigen::MatrixXd>& data) {
+        chunk_times.push_back(sample_times);
+        chunk_data.push_back(data);
+      });
+  EXPECT_THROW(log.set_ring_buffer_mode(2), std::exception);
+  for (int i = 0; i < 5; ++i) {
+    log.AddData(i, Vector1d(10 * i));
+  }
+  ASSERT_EQ(chunk_times.size(), 2);
+  EXPECT_TRUE(CompareMatrices(chunk_times[1], Eigen::Vector2d(2, 3)));
+  EXPECT_TRUE(CompareMatrices(chunk_data[1], Eigen::RowVector2d(20, 30)));
+  EXPECT_EQ(log.num_samples(), 1);
+  EXPECT_EQ(log.num_discarded_samples(), 4);
+
+  log.Flush();
+  ASSERT_EQ(chunk_times.size(), 3);
+  EXPECT_TRUE(CompareMatrices(chunk_times[2], Vector1d(4)));
+  EXPECT_EQ(log.num_samples(), 0);
+  log.Flush();
+  EXPECT_EQ(chunk_times.size(), 3);
+}
+
+GTEST_TEST(TestSignalLog, BinaryFileChunkHandler) {
+  const std::string file_name = "signal_log_test.bin";
+  {
+    SignalLog<double> log(2);
+    log.set_streaming_mode(
+        2, SignalLog<double>::MakeBinaryFileChunkHandler(file_name));
+    for (int i = 0; i < 3; ++i) {
+      log.AddData(i, Eigen::Vector2d(i, -i));
+    }
+    log.Flush();
+  }
+  std::ifstream in(file_name, std::ios::binary);
+  std::vector<double> values;
+  for (int chunk_size : {2, 1}) {
+    int64_t num_samples{};
+    in.read(reinterpret_cast<char*>(&num_samples), sizeof(num_samples));
+    EXPECT_EQ(num_samples, chunk_size);
+    for (int i = 0; i < 3 * chunk_size; ++i) {
+      double value{};
+      in.read(reinterpret_cast<char*>(&value), sizeof(value));
+      values.push_back(value);
+    }
+  }
+  ASSERT_TRUE(in.good());
+  // The times, then the data of each sample, of each chunk.
+  EXPECT_EQ(values, std::vector<double>({0, 1, 0, 0, 1, -1, 2, 2, -2}));
+  std::remove(file_name.c_str());
+}
+
+// The logger forwards to the modes of its log.
+GTEST_TEST(TestSignalLogger, RingBufferMode) {
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(2.0);
+  auto logger = LogOutput(source->get_output_port(), &builder);
+  logger->set_ring_buffer_mode(4);
+  logger->set_publish_period(0.1);
+  auto diagram = builder.Build();
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(1.0);
+  EXPECT_EQ(logger->num_samples(), 4);
+  EXPECT_EQ(logger->num_discarded_samples(), 7);
+  EXPECT_NEAR(logger->sample_times()(3), 1.0, 1e-12);
+
+  // The ring buffer mode is preserved by scalar conversion, so that it cannot
+  // be set again.
+  std::unique_ptr<System<AutoDiffXd>> converted = logger->ToAutoDiffXd();
+  auto* const converted_logger =
+      dynamic_cast<SignalLogger<AutoDiffXd>*>(converted.get());
+  ASSERT_NE(converted_logger, nullptr);
+  EXPECT_THROW(converted_logger->set_ring_buffer_mode(2), std::exception);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
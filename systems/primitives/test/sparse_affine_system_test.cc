@@ -0,0 +1,135 @@
+#include "drake/systems/primitives/sparse_affine_system.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/framework/test_utilities/scalar_conversion.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::SparseMatrix;
+using Eigen::VectorXd;
+
+constexpr int kNumStates = 5;
+
+// Compares SparseAffineSystem with AffineSystem on a tridiagonal system (as
+// from a discretized heat equation) with two inputs and two outputs.
+class SparseAffineSystemTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    A_ = MatrixXd::Zero(kNumStates, kNumStates);
+    for (int i = 0; i < kNumStates; ++i) {
+      A_(i, i) = -2.0;
+      if (i > 0) A_(i, i - 1) = 1.0;
+      if (i + 1 < kNumStates) A_(i, i + 1) = 1.0;
+    }
+    B_ = MatrixXd::Zero(kNumStates, 2);
+    B_(0, 0) = 1.0;
+    B_(kNumStates - 1, 1) = 3.0;
+    f0_ = VectorXd::LinSpaced(kNumStates, 0.5, -0.5);
+    C_ = MatrixXd::Zero(2, kNumStates);
+    C_(0, 1) = 1.0;
+    C_(1, 3) = -2.0;
+    D_ = MatrixXd::Zero(2, 2);
+    D_(1, 0) = 0.25;
+    y0_ = VectorXd::Constant(2, 4.0);
+    x_ = VectorXd::LinSpaced(kNumStates, 1.0, 2.0);
+    u_ = VectorXd::LinSpaced(2, -1.0, 1.0);
+  }
+
+  std::unique_ptr<SparseAffineSystem<double>> MakeSparse(
+      double time_period) const {
+    return std::make_unique<SparseAffineSystem<double>>(
+        A_.sparseView(), B_.sparseView(), f0_, C_.sparseView(),
+        D_.sparseView(), y0_, time_period);
+  }
+
+  MatrixXd A_, B_, C_, D_;
+  VectorXd f0_, y0_, x_, u_;
+};
+
+TEST_F(SparseAffineSystemTest, Construction) {
+  const auto dut = MakeSparse(0.0);
+  EXPECT_EQ(dut->num_states(), kNumStates);
+  EXPECT_EQ(dut->num_inputs(), 2);
+  EXPECT_EQ(dut->num_outputs(), 2);
+  EXPECT_EQ(dut->A().nonZeros(), 3 * kNumStates - 2);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(dut->A()), A_));
+  EXPECT_TRUE(CompareMatrices(dut->f0(), f0_));
+
+  // The dense getters of TimeVaryingAffineSystem.
+  const double t = 3.5;
+  EXPECT_TRUE(CompareMatrices(dut->A(t), A_));
+  EXPECT_TRUE(CompareMatrices(dut->B(t), B_));
+  EXPECT_TRUE(CompareMatrices(dut->C(t), C_));
+  EXPECT_TRUE(CompareMatrices(dut->D(t), D_));
+  EXPECT_TRUE(CompareMatrices(dut->y0(t), y0_));
+}
+
+TEST_F(SparseAffineSystemTest, Continuous) {
+  const auto dut = MakeSparse(0.0);
+  auto context = dut->CreateDefaultContext();
+  context->SetContinuousState(x_);
+  dut->get_input_port().FixValue(context.get(), u_);
+
+  const VectorXd xdot = dut->EvalTimeDerivatives(*context).CopyToVector();
+  EXPECT_TRUE(CompareMatrices(xdot, A_ * x_ + B_ * u_ + f0_, 1e-14));
+  const VectorXd y = dut->get_output_port().Eval(*context);
+  EXPECT_TRUE(CompareMatrices(y, C_ * x_ + D_ * u_ + y0_, 1e-14));
+
+  ASSERT_TRUE(dut->HasTimeDerivativesJacobian());
+  SparseMatrix<double> J;
+  dut->CalcTimeDerivativesJacobian(*context, &J);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(J), A_));
+}
+
+TEST_F(SparseAffineSystemTest, Discrete) {
+  const auto dut = MakeSparse(0.1);
+  auto context = dut->CreateDefaultContext();
+  context->get_mutable_discrete_state(0).SetFromVector(x_);
+  dut->get_input_port().FixValue(context.get(), u_);
+
+  auto updates = dut->AllocateDiscreteVariables();
+  dut->CalcDiscreteVariableUpdates(*context, updates.get());
+  EXPECT_TRUE(CompareMatrices(updates->get_vector(0).CopyToVector(),
+                              A_ * x_ + B_ * u_ + f0_, 1e-14));
+  const VectorXd y = dut->get_output_port().Eval(*context);
+  EXPECT_TRUE(CompareMatrices(y, C_ * x_ + D_ * u_ + y0_, 1e-14));
+  EXPECT_FALSE(dut->HasTimeDerivativesJacobian());
+}
+
+TEST_F(SparseAffineSystemTest, Linear) {
+  const SparseLinearSystem<double> dut(A_.sparseView(), B_.sparseView(),
+                                       C_.sparseView(), D_.sparseView());
+  auto context = dut.CreateDefaultContext();
+  context->SetContinuousState(x_);
+  dut.get_input_port().FixValue(context.get(), u_);
+  const VectorXd xdot = dut.EvalTimeDerivatives(*context).CopyToVector();
+  EXPECT_TRUE(CompareMatrices(xdot, A_ * x_ + B_ * u_, 1e-14));
+  const VectorXd y = dut.get_output_port().Eval(*context);
+  EXPECT_TRUE(CompareMatrices(y, C_ * x_ + D_ * u_, 1e-14));
+}
+
+TEST_F(SparseAffineSystemTest, ToAutoDiff) {
+  EXPECT_TRUE(is_autodiffxd_convertible(
+      *MakeSparse(0.0), [&](const auto& converted) {
+        EXPECT_TRUE(CompareMatrices(MatrixXd(converted.A()), A_));
+        EXPECT_TRUE(CompareMatrices(converted.y0(), y0_));
+      }));
+  const SparseLinearSystem<double> linear(A_.sparseView(), B_.sparseView(),
+                                          C_.sparseView(), D_.sparseView());
+  EXPECT_TRUE(is_autodiffxd_convertible(linear));
+}
+
+TEST_F(SparseAffineSystemTest, ToSymbolic) {
+  EXPECT_TRUE(is_symbolic_convertible(*MakeSparse(0.1)));
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
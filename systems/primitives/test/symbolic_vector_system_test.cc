@@ -251,6 +251,36 @@ TEST_F(SymbolicVectorSystemTest, ContinuousStateOnly) {
                               Vector1d{-xval + xval * xval * xval}));
 }
 
+TEST_F(SymbolicVectorSystemTest, TimeDerivativesJacobian) {
+  // xdot = [x1 * u0; -x0 + x1^3 + p0 * t]
+  SymbolicVectorSystem<double> system(
+      t_, x_, u_, p_,
+      Vector2<Expression>{x_[1] * u_[0], -x_[0] + pow(x_[1], 3) + p_[0] * t_});
+  EXPECT_TRUE(system.HasTimeDerivativesJacobian());
+
+  auto context = system.CreateDefaultContext();
+  context->SetTime(0.5);
+  context->SetContinuousState(Vector2d{0.3, -1.2});
+  context->get_mutable_numeric_parameter(0).SetFromVector(Vector2d{2.0, 0.0});
+  system.get_input_port().FixValue(context.get(), Vector2d{1.5, 4.0});
+  Eigen::SparseMatrix<double> J;
+  system.CalcTimeDerivativesJacobian(*context, &J);
+  // The zero entry is not stored.
+  EXPECT_EQ(J.nonZeros(), 3);
+  Eigen::Matrix2d J_expected;
+  // clang-format off
+  J_expected << 0.0, 1.5,
+               -1.0, 3 * 1.2 * 1.2;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(J), J_expected, 1e-14));
+
+  // Discrete-time systems have no time derivatives.
+  const SymbolicVectorSystem<double> discrete(
+      {}, x_, Vector0<Variable>{}, Vector2<Expression>{x_[1], x_[0]},
+      Vector0<Expression>{}, 0.1);
+  EXPECT_FALSE(discrete.HasTimeDerivativesJacobian());
+}
+
 TEST_F(SymbolicVectorSystemTest, DiscreteStateOnly) {
   // xnext = -x + x^3
   const Variable& x{x_[0]};
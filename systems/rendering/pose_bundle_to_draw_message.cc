@@ -1,5 +1,9 @@
 #include "drake/systems/rendering/pose_bundle_to_draw_message.h"
 
+#include <cmath>
+
+#include "drake/common/drake_throw.h"
+#include "drake/lcm/lcm_message_writer.h"
 #include "drake/lcmt_viewer_draw.hpp"
 #include "drake/systems/rendering/pose_bundle.h"
 
@@ -7,15 +11,79 @@ namespace drake {
 namespace systems {
 namespace rendering {
 
+namespace {
+
+// Returns the column [p; q] of the position p and the quaternion q = (w, x, y,
+// z) of the pose X.
+Eigen::Matrix<double, 7, 1> PoseColumn(const Eigen::Isometry3d& X) {
+  const Eigen::Quaternion<double> q(X.linear());
+  Eigen::Matrix<double, 7, 1> column;
+  column << X.translation(), q.w(), q.x(), q.y(), q.z();
+  return column;
+}
+
+}  // namespace
+
 PoseBundleToDrawMessage::PoseBundleToDrawMessage() {
   this->DeclareAbstractInputPort(
       kUseDefaultName, Value<PoseBundle<double>>());
   this->DeclareAbstractOutputPort(
       &PoseBundleToDrawMessage::CalcViewerDrawMessage);
+  this->DeclareAbstractOutputPort(
+      "lcm_message_bytes", &PoseBundleToDrawMessage::CalcViewerDrawBytes);
+}
+
+PoseBundleToDrawMessage::PoseBundleToDrawMessage(
+    double publish_period, const PoseDeltaParams& delta_params)
+    : delta_mode_(true),
+      delta_params_(delta_params),
+      cos_half_angle_tolerance_(std::cos(delta_params.angle_tolerance / 2)) {
+  DRAKE_THROW_UNLESS(publish_period > 0);
+  DRAKE_THROW_UNLESS(delta_params.position_tolerance >= 0);
+  DRAKE_THROW_UNLESS(delta_params.angle_tolerance >= 0);
+  DRAKE_THROW_UNLESS(delta_params.keyframe_interval > 0);
+  this->DeclareAbstractInputPort(
+      kUseDefaultName, Value<PoseBundle<double>>());
+  this->DeclareAbstractOutputPort(
+      &PoseBundleToDrawMessage::CalcViewerDrawMessage);
+  this->DeclareAbstractOutputPort(
+      "lcm_message_bytes", &PoseBundleToDrawMessage::CalcViewerDrawBytes);
+  this->DeclareAbstractState(AbstractValue::Make(SentPoses{}));
+  this->DeclarePeriodicUnrestrictedUpdateEvent(
+      publish_period, 0.0, &PoseBundleToDrawMessage::UpdateSentPoses);
 }
 
 PoseBundleToDrawMessage::~PoseBundleToDrawMessage() {}
 
+bool PoseBundleToDrawMessage::IsKeyframe(const SentPoses& sent,
+                                         int num_links) const {
+  return sent.num_since_keyframe == 0 || sent.poses.cols() != num_links;
+}
+
+bool PoseBundleToDrawMessage::HasMoved(const Eigen::Isometry3d& X_WL,
+                                       const SentPoses& sent, int link) const {
+  const Eigen::Matrix<double, 7, 1> current = PoseColumn(X_WL);
+  const auto last = sent.poses.col(link);
+  if ((current.head<3>() - last.head<3>()).norm() >
+      delta_params_.position_tolerance) {
+    return true;
+  }
+  // q and -q are the same orientation; the angle θ between them satisfies
+  // |q₁⋅q₂| = cos(θ / 2).
+  return std::abs(current.tail<4>().dot(last.tail<4>())) <
+         cos_half_angle_tolerance_;
+}
+
+const PoseBundleToDrawMessage::SentPoses*
+PoseBundleToDrawMessage::GetSentPosesIfDelta(const Context<double>& context,
+                                             int num_links) const {
+  // In delta mode, only the links that moved (or all of them, at keyframes)
+  // are sent.
+  if (!delta_mode_) return nullptr;
+  const SentPoses& sent = context.get_abstract_state<SentPoses>(0);
+  return IsKeyframe(sent, num_links) ? nullptr : &sent;
+}
+
 void PoseBundleToDrawMessage::CalcViewerDrawMessage(
     const Context<double>& context, lcmt_viewer_draw* output) const {
   const PoseBundle<double>& poses =
@@ -25,31 +93,114 @@ void PoseBundleToDrawMessage::CalcViewerDrawMessage(
 
   const int n = poses.get_num_poses();
 
+  const SentPoses* sent = GetSentPosesIfDelta(context, n);
+  const bool send_all = sent == nullptr;
+  int num_links = n;
+  if (!send_all) {
+    num_links = 0;
+    for (int i = 0; i < n; ++i) {
+      if (HasMoved(poses.get_pose(i), *sent, i)) ++num_links;
+    }
+  }
+
   message.timestamp = static_cast<int64_t>(context.get_time() * 1000.0);
-  message.num_links = n;
-  message.link_name.resize(n);
-  message.robot_num.resize(n);
-  message.position.resize(n);
-  message.quaternion.resize(n);
+  message.num_links = num_links;
+  message.link_name.resize(num_links);
+  message.robot_num.resize(num_links);
+  message.position.resize(num_links);
+  message.quaternion.resize(num_links);
 
+  int k = 0;
   for (int i = 0; i < n; ++i) {
-    message.robot_num[i] = poses.get_model_instance_id(i);
+    if (!send_all && !HasMoved(poses.get_pose(i), *sent, i)) continue;
+
+    message.robot_num[k] = poses.get_model_instance_id(i);
 
-    message.link_name[i] = poses.get_name(i);
+    message.link_name[k] = poses.get_name(i);
 
     Eigen::Translation<double, 3> t(poses.get_pose(i).translation());
-    message.position[i].resize(3);
-    message.position[i][0] = t.x();
-    message.position[i][1] = t.y();
-    message.position[i][2] = t.z();
+    message.position[k].resize(3);
+    message.position[k][0] = t.x();
+    message.position[k][1] = t.y();
+    message.position[k][2] = t.z();
 
     Eigen::Quaternion<double> q(poses.get_pose(i).linear());
-    message.quaternion[i].resize(4);
-    message.quaternion[i][0] = q.w();
-    message.quaternion[i][1] = q.x();
-    message.quaternion[i][2] = q.y();
-    message.quaternion[i][3] = q.z();
+    message.quaternion[k].resize(4);
+    message.quaternion[k][0] = q.w();
+    message.quaternion[k][1] = q.x();
+    message.quaternion[k][2] = q.y();
+    message.quaternion[k][3] = q.z();
+    ++k;
+  }
+}
+
+void PoseBundleToDrawMessage::CalcViewerDrawBytes(
+    const Context<double>& context, std::vector<uint8_t>* output) const {
+  const PoseBundle<double>& poses =
+      this->get_input_port(0).Eval<PoseBundle<double>>(context);
+  const int n = poses.get_num_poses();
+
+  // The links are those of CalcViewerDrawMessage().
+  const SentPoses* sent = GetSentPosesIfDelta(context, n);
+  auto is_sent = [&poses, sent, this](int i) {
+    return sent == nullptr || HasMoved(poses.get_pose(i), *sent, i);
+  };
+  int num_links = n;
+  if (sent != nullptr) {
+    num_links = 0;
+    for (int i = 0; i < n; ++i) {
+      if (is_sent(i)) ++num_links;
+    }
+  }
+
+  // The fields of lcmt_viewer_draw, in the order of its definition, each of
+  // the arrays over the links sent.
+  lcm::LcmMessageWriter writer(output);
+  writer.WriteInt64(lcmt_viewer_draw::getHash());
+  writer.WriteInt64(static_cast<int64_t>(context.get_time() * 1000.0));
+  writer.WriteInt32(num_links);
+  for (int i = 0; i < n; ++i) {
+    if (is_sent(i)) writer.WriteString(poses.get_name(i));
+  }
+  for (int i = 0; i < n; ++i) {
+    if (is_sent(i)) writer.WriteInt32(poses.get_model_instance_id(i));
+  }
+  for (int i = 0; i < n; ++i) {
+    if (!is_sent(i)) continue;
+    const Eigen::Vector3d p = poses.get_pose(i).translation();
+    writer.WriteFloat(p.x());
+    writer.WriteFloat(p.y());
+    writer.WriteFloat(p.z());
+  }
+  for (int i = 0; i < n; ++i) {
+    if (!is_sent(i)) continue;
+    const Eigen::Quaternion<double> q(poses.get_pose(i).linear());
+    writer.WriteFloat(q.w());
+    writer.WriteFloat(q.x());
+    writer.WriteFloat(q.y());
+    writer.WriteFloat(q.z());
+  }
+}
+
+void PoseBundleToDrawMessage::UpdateSentPoses(const Context<double>& context,
+                                              State<double>* state) const {
+  const PoseBundle<double>& poses =
+      this->get_input_port(0).Eval<PoseBundle<double>>(context);
+  const int n = poses.get_num_poses();
+
+  // The update sees the same context as the publication of the message at
+  // this time, so it repeats the decisions of CalcViewerDrawMessage().
+  SentPoses& sent = state->get_mutable_abstract_state<SentPoses>(0);
+  const bool send_all = IsKeyframe(sent, n);
+  if (sent.poses.cols() != n) sent.poses.resize(7, n);
+  for (int i = 0; i < n; ++i) {
+    if (send_all || HasMoved(poses.get_pose(i), sent, i)) {
+      sent.poses.col(i) = PoseColumn(poses.get_pose(i));
+    }
   }
+  sent.num_since_keyframe =
+      ((send_all ? 0 : sent.num_since_keyframe) + 1) %
+      delta_params_.keyframe_interval;
 }
 
 }  // namespace rendering
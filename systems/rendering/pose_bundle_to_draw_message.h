@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -12,24 +14,105 @@ namespace drake {
 namespace systems {
 namespace rendering {
 
+/// The parameters of the delta mode of PoseBundleToDrawMessage.
+struct PoseDeltaParams {
+  /// A link is resent once its position has moved by more than this distance
+  /// (in meters) from the position last sent.
+  double position_tolerance{1e-4};
+
+  /// A link is resent once its orientation has turned by more than this angle
+  /// (in radians) from the orientation last sent.
+  double angle_tolerance{1e-3};
+
+  /// Every `keyframe_interval`-th message (starting with the first) is a
+  /// keyframe that contains every link. Must be positive.
+  int keyframe_interval{60};
+};
+
 /// PoseBundleToDrawMessage converts a PoseBundle on its single abstract-valued
 /// input port to a Drake Visualizer Interface LCM draw message,
 /// lcmt_viewer_draw, on its single abstract-valued output port.
 ///
-/// The draw message will contain one link for each pose in the PoseBundle. The
-/// name of the link will be the name of the corresponding pose. The robot_num
-/// will be the corresponding model instance ID.
+/// By default, the draw message will contain one link for each pose in the
+/// PoseBundle. The name of the link will be the name of the corresponding
+/// pose. The robot_num will be the corresponding model instance ID.
+///
+/// In delta mode, the draw message only contains the links whose poses have
+/// changed beyond a tolerance since they were last sent, plus periodic
+/// keyframes with every link; drake_visualizer keeps drawing the links that
+/// are omitted at their last received poses. The poses last sent are kept in
+/// an abstract state, which a periodic update event brings up to date at the
+/// publishing period; the draw message must therefore be published exactly at
+/// that period (as LcmPublisherSystem does with the same period).
+///
+/// The output message is reused from one evaluation to the next, so once the
+/// number of links settles no memory is allocated per message.
+///
+/// A second output port has the same message already encoded into LCM bytes
+/// (as a `std::vector<uint8_t>`), which is written directly from the poses,
+/// without the message object, for an LcmPublisherSystem with an
+/// EncodedBytesSerializer.
 class PoseBundleToDrawMessage : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PoseBundleToDrawMessage)
 
+  /// Constructs a stateless converter that sends every link in every message.
   PoseBundleToDrawMessage();
+
+  /// Constructs a converter in delta mode, for messages published every
+  /// `publish_period` seconds.
+  /// @throws std::exception if `publish_period` or
+  ///   `delta_params.keyframe_interval` is not positive, or a tolerance is
+  ///   negative.
+  PoseBundleToDrawMessage(double publish_period,
+                          const PoseDeltaParams& delta_params);
+
   ~PoseBundleToDrawMessage() override;
 
+  /// Returns the output port of the encoded message bytes.
+  const OutputPort<double>& get_lcm_message_bytes_output_port() const {
+    return this->get_output_port(1);
+  }
+
  private:
+  // The poses of the links as last sent, as the columns [p; q] of the position
+  // p and the quaternion q = (w, x, y, z), along with the number of messages
+  // sent since the last keyframe.
+  struct SentPoses {
+    Eigen::Matrix<double, 7, Eigen::Dynamic> poses;
+    int num_since_keyframe{0};
+  };
+
+  // Returns true if the next message is a keyframe, given the poses last sent
+  // and the current number of links.
+  bool IsKeyframe(const SentPoses& sent, int num_links) const;
+
+  // Returns true if the given link, now at X_WL, has moved beyond the
+  // tolerances since it was last sent.
+  bool HasMoved(const Eigen::Isometry3d& X_WL, const SentPoses& sent,
+                int link) const;
+
+  // Returns the poses last sent, if the draw message at the time of `context`
+  // only sends the links that moved, or else nullptr.
+  const SentPoses* GetSentPosesIfDelta(const Context<double>& context,
+                                       int num_links) const;
+
   // Copies the input poses into the draw message.
   void CalcViewerDrawMessage(const Context<double>& context,
                              lcmt_viewer_draw* output) const;
+
+  // Encodes the draw message into LCM bytes, without the message object.
+  void CalcViewerDrawBytes(const Context<double>& context,
+                           std::vector<uint8_t>* output) const;
+
+  // Records the poses that the draw message sends at the current time.
+  void UpdateSentPoses(const Context<double>& context,
+                       State<double>* state) const;
+
+  const bool delta_mode_{false};
+  const PoseDeltaParams delta_params_;
+  // cos(angle_tolerance / 2), to compare to the dot product of quaternions.
+  const double cos_half_angle_tolerance_{1};
 };
 
 }  // namespace rendering
@@ -1,5 +1,9 @@
 #include "drake/systems/rendering/pose_bundle_to_draw_message.h"
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/lcmt_viewer_draw.hpp"
@@ -10,6 +14,15 @@ namespace systems {
 namespace rendering {
 namespace {
 
+// Checks that the encoded message bytes in `output` are the encoding of the
+// message in `output`.
+void CheckEncodedBytes(const SystemOutput<double>& output) {
+  const auto& message = output.get_data(0)->get_value<lcmt_viewer_draw>();
+  std::vector<uint8_t> expected(message.getEncodedSize());
+  message.encode(expected.data(), 0, expected.size());
+  EXPECT_EQ(output.get_data(1)->get_value<std::vector<uint8_t>>(), expected);
+}
+
 GTEST_TEST(PoseBundleToDrawMessageTest, Conversion) {
   PoseBundle<double> bundle(2);
   Eigen::Isometry3d foo_pose = Eigen::Isometry3d::Identity();
@@ -57,6 +70,8 @@ GTEST_TEST(PoseBundleToDrawMessageTest, Conversion) {
   EXPECT_NEAR(std::sin(roll / 2), message.quaternion[1][1], 1.0e-6);  // x
   EXPECT_EQ(0, message.quaternion[0][2]);  // y
   EXPECT_EQ(0, message.quaternion[0][3]);  // z
+
+  CheckEncodedBytes(*output);
 }
 
 // Tests that PoseBundleToDrawMessageTest allocates no state variables.
@@ -66,6 +81,83 @@ GTEST_TEST(PoseBundleToDrawMessageTest, Stateless) {
   EXPECT_TRUE(context->is_stateless());
 }
 
+// Steps the delta-mode converter through a sequence of messages: only the
+// links that moved beyond the tolerances are sent, except at keyframes.
+GTEST_TEST(PoseBundleToDrawMessageTest, DeltaMode) {
+  PoseDeltaParams params;
+  params.position_tolerance = 0.01;
+  params.angle_tolerance = 0.1;
+  params.keyframe_interval = 3;
+  const double kPeriod = 0.1;
+  PoseBundleToDrawMessage converter(kPeriod, params);
+  auto context = converter.CreateDefaultContext();
+  auto output = converter.AllocateOutput();
+  auto events = converter.AllocateCompositeEventCollection();
+  auto state = context->CloneState();
+
+  PoseBundle<double> bundle(3);
+  for (int i = 0; i < 3; ++i) {
+    bundle.set_name(i, "link" + std::to_string(i));
+    bundle.set_pose(i, Eigen::Isometry3d::Identity());
+  }
+
+  // Computes the message for the given poses at the given time, then applies
+  // the update that records what it sent; returns the names of the links in
+  // the message.
+  auto send = [&](double time) {
+    context->SetTime(time);
+    context->FixInputPort(0, AbstractValue::Make(bundle));
+    converter.CalcOutput(*context, output.get());
+    const auto& message = output->get_data(0)->get_value<lcmt_viewer_draw>();
+    EXPECT_EQ(message.num_links, static_cast<int>(message.link_name.size()));
+    std::vector<std::string> names = message.link_name;
+    CheckEncodedBytes(*output);
+
+    converter.CalcNextUpdateTime(*context, events.get());
+    converter.CalcUnrestrictedUpdate(
+        *context, events->get_unrestricted_update_events(), state.get());
+    context->get_mutable_state().SetFrom(*state);
+    return names;
+  };
+  using Names = std::vector<std::string>;
+
+  // The first message is a keyframe.
+  EXPECT_EQ(send(0), Names({"link0", "link1", "link2"}));
+  // Nothing moved.
+  EXPECT_EQ(send(0.1), Names());
+
+  // link1 moves by less than the tolerance, link2 by more.
+  Eigen::Isometry3d X = Eigen::Isometry3d::Identity();
+  X.translation() << 0.005, 0, 0;
+  bundle.set_pose(1, X);
+  X.translation() << 0.02, 0, 0;
+  bundle.set_pose(2, X);
+  EXPECT_EQ(send(0.2), Names({"link2"}));
+  // Keyframe: the third message.
+  EXPECT_EQ(send(0.3), Names({"link0", "link1", "link2"}));
+
+  // link0 turns by more than the angle tolerance.
+  X = Eigen::AngleAxisd(0.2, Eigen::Vector3d::UnitZ());
+  bundle.set_pose(0, X);
+  EXPECT_EQ(send(0.4), Names({"link0"}));
+  // Small motions accumulate relative to the pose last sent.
+  X = Eigen::Isometry3d::Identity();
+  X.translation() << 0.016, 0, 0;
+  bundle.set_pose(1, X);
+  EXPECT_EQ(send(0.5), Names({"link1"}));
+  EXPECT_EQ(send(0.6), Names({"link0", "link1", "link2"}));
+  EXPECT_EQ(send(0.7), Names());
+
+  // A change in the number of links forces a keyframe.
+  bundle = PoseBundle<double>(1);
+  bundle.set_name(0, "link0");
+  EXPECT_EQ(send(0.8), Names({"link0"}));
+
+  EXPECT_THROW(PoseBundleToDrawMessage(0, params), std::exception);
+  params.keyframe_interval = 0;
+  EXPECT_THROW(PoseBundleToDrawMessage(kPeriod, params), std::exception);
+}
+
 }  // namespace
 }  // namespace rendering
 }  // namespace systems
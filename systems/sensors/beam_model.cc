@@ -74,30 +74,35 @@ void BeamModel<T>::CalcOutput(const systems::Context<T>& context,
 
   auto measurement = output->get_mutable_value();
 
+  // The event thresholds and the distribution parameters are the same for
+  // every beam, so they are read once per scan rather than once per beam.
+  const T uniform_threshold = params->probability_uniform();
+  const T miss_threshold = uniform_threshold + params->probability_miss();
+  const T short_threshold = miss_threshold + params->probability_short();
+  const T lambda_short = params->lambda_short();
+  const T sigma_hit = params->sigma_hit();
+
   // Loop through depth inputs and compute a noisy measurement based on the
   // mixture model.
   for (int i = 0; i < static_cast<int>(depth.size()); i++) {
-    if (w_event[i] <= params->probability_uniform()) {
+    if (w_event[i] <= uniform_threshold) {
       // Then "uniform".
       measurement[i] = max_range_ * w_uniform[i];
-    } else if (w_event[i] <=
-               params->probability_uniform() + params->probability_miss()) {
+    } else if (w_event[i] <= miss_threshold) {
       // Then "miss".
       measurement[i] = max_range_;
-    } else if (w_event[i] <= params->probability_uniform() +
-                                 params->probability_miss() +
-                                 params->probability_short() &&
-        (w_short[i] / params->lambda_short()) <= depth[i]) {
+    } else if (w_event[i] <= short_threshold &&
+        (w_short[i] / lambda_short) <= depth[i]) {
       // Then "short".
       // Note: Returns that would have been greater than depth[i] are instead
       // evaluated as "hit".
-      measurement[i] = w_short[i] / params->lambda_short();
+      measurement[i] = w_short[i] / lambda_short;
     } else {
       // Then "hit".
       // Note: The tails of the Gaussian distribution are truncated to return
       // a value in [0, max_range_].  (Both) tails of the distribution are
       // treated as missed returns, so return max_range_.
-      measurement[i] = depth[i] + params->sigma_hit() * w_hit[i];
+      measurement[i] = depth[i] + sigma_hit * w_hit[i];
       if (measurement[i] < 0.0 || measurement[i] > max_range_) {
         measurement[i] = max_range_;
       }
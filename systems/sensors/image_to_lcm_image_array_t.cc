@@ -8,6 +8,7 @@
 #include "robotlocomotion/image_array_t.hpp"
 #include "robotlocomotion/image_t.hpp"
 
+#include "drake/common/parallel_for.h"
 #include "drake/systems/sensors/lcm_image_traits.h"
 
 using std::string;
@@ -26,20 +27,22 @@ void Compress(const Image<kPixelType>& image, image_t* msg) {
   msg->compression_method = image_t::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
+  // Compress directly into the message, whose data is first grown to an upper
+  // bound of the compressed size and then shrunk to the actual size. Since
+  // shrinking a std::vector keeps its capacity, the message data is not
+  // reallocated when the same output value is computed again.
+  uLongf buf_size = compressBound(source_size);
+  msg->data.resize(buf_size);
 
   auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
+      msg->data.data(), &buf_size,
+      reinterpret_cast<const Bytef*>(image.at(0, 0)), source_size,
+      Z_BEST_SPEED);
 
   DRAKE_DEMAND(compress_status == Z_OK);
 
   msg->data.resize(buf_size);
   msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
 }
 
 template <PixelType kPixelType>
@@ -179,24 +182,35 @@ const OutputPort<double>& ImageToLcmImageArrayT::image_array_t_msg_output_port()
   return System<double>::get_output_port(image_array_t_msg_output_port_index_);
 }
 
+void ImageToLcmImageArrayT::set_max_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  max_num_threads_ = num_threads;
+}
+
 void ImageToLcmImageArrayT::CalcImageArray(
     const systems::Context<double>& context, image_array_t* msg) const {
   msg->header.utime = static_cast<int64_t>(context.get_time() * kSecToMillisec);
   msg->header.frame_name.clear();
-  msg->num_images = 0;
-  msg->images.clear();
-
-  for (int i = 0; i < num_input_ports(); i++) {
-    const auto& image_value = this->get_input_port(i).
-        template Eval<AbstractValue>(context);
-
-    image_t image_msg;
-    PackImageToLcmImageT(image_value, input_port_pixel_type_[i],
-                         msg->header.utime, this->get_input_port(i).get_name(),
-                         &image_msg, do_compress_);
-    msg->images.push_back(image_msg);
-    msg->num_images++;
+  const int num_images = num_input_ports();
+  msg->num_images = num_images;
+  // The images are packed in place, reusing the data of the images of the
+  // previously computed message.
+  msg->images.resize(num_images);
+
+  // The input ports are evaluated on this thread; packing (and compressing)
+  // only reads the images and writes to distinct messages.
+  std::vector<const AbstractValue*> image_values(num_images);
+  for (int i = 0; i < num_images; i++) {
+    image_values[i] =
+        &this->get_input_port(i).template Eval<AbstractValue>(context);
   }
+  StaticParallelForIndexLoop(
+      max_num_threads_, 0, num_images, [&](int, int i) {
+        PackImageToLcmImageT(*image_values[i], input_port_pixel_type_[i],
+                             msg->header.utime,
+                             this->get_input_port(i).get_name(),
+                             &msg->images[i], do_compress_);
+      });
 }
 
 }  // namespace sensors
@@ -66,6 +66,19 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
         name, Value<Image<kPixelType>>());
   }
 
+  /// Sets the maximum number of threads used to pack (and compress, which
+  /// dominates the cost) the images into the output message, one image per
+  /// thread. The default is one, i.e., the images are packed in sequence on
+  /// the calling thread. With several large images and compression enabled,
+  /// using one thread per image bounds the time spent computing the output by
+  /// the time spent on the largest image rather than on all of them.
+  /// @throws std::exception if `num_threads` is less than one.
+  void set_max_num_threads(int num_threads);
+
+  /// Returns the maximum number of threads used to pack the images.
+  /// @see set_max_num_threads().
+  int max_num_threads() const { return max_num_threads_; }
+
  private:
   void CalcImageArray(const systems::Context<double>& context,
                       robotlocomotion::image_array_t* msg) const;
@@ -77,6 +90,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  int max_num_threads_{1};
 };
 
 }  // namespace sensors
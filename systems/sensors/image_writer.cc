@@ -2,8 +2,14 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,9 +25,13 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+// The zlib compression level vtkPNGWriter uses by default.
+constexpr int kDefaultPngCompressionLevel = 5;
+
 template <PixelType kPixelType>
 void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+                      const std::string& file_path,
+                      int png_compression_level = kDefaultPngCompressionLevel) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
@@ -33,17 +43,20 @@ void SaveToFileHelper(const Image<kPixelType>& image,
   // NOTE: This excludes *many* of the defined `PixelType` values.
   switch (kPixelType) {
     case PixelType::kRgba8U:
-      vtk_image->AllocateScalars(VTK_UNSIGNED_CHAR, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+    case PixelType::kLabel16I: {
+      vtk_image->AllocateScalars(kPixelType == PixelType::kRgba8U
+                                     ? VTK_UNSIGNED_CHAR
+                                     : VTK_UNSIGNED_SHORT,
+                                 num_channels);
+      auto png_writer = vtkSmartPointer<vtkPNGWriter>::New();
+      png_writer->SetCompressionLevel(png_compression_level);
+      writer = png_writer;
       break;
+    }
     case PixelType::kDepth32F:
       vtk_image->AllocateScalars(VTK_FLOAT, num_channels);
       writer = vtkSmartPointer<vtkTIFFWriter>::New();
       break;
-    case PixelType::kLabel16I:
-      vtk_image->AllocateScalars(VTK_UNSIGNED_SHORT, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
-      break;
     default:
       throw std::logic_error(
           "Unsupported image type; cannot be written to file");
@@ -81,6 +94,136 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
+// A bounded queue of image writes, executed by a pool of threads.
+class ImageWriter::AsyncWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncWriter)
+
+  AsyncWriter(int num_threads, int max_queue_size, BackpressurePolicy policy)
+      : max_queue_size_(max_queue_size), policy_(policy) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() { Run(); });
+    }
+  }
+
+  // Completes all pending writes, then joins the threads.
+  ~AsyncWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    has_work_.notify_all();
+    for (auto& thread : threads_) thread.join();
+  }
+
+  // Queues `write`, or handles it according to the policy if the queue is
+  // full.
+  void Push(std::function<void()> write) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+      if (policy_ == BackpressurePolicy::kDrop) {
+        ++statistics_.num_dropped;
+        return;
+      }
+      has_room_.wait(lock, [this]() {
+        return static_cast<int>(queue_.size()) < max_queue_size_;
+      });
+    }
+    queue_.push_back(std::move(write));
+    statistics_.max_queue_depth = std::max(
+        statistics_.max_queue_depth, static_cast<int>(queue_.size()));
+    lock.unlock();
+    has_work_.notify_one();
+  }
+
+  // Blocks until the queue is empty and no write is in progress.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && num_busy_ == 0; });
+  }
+
+  WriteStatistics statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      has_work_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;  // Stopping, and nothing left to write.
+      std::function<void()> write = std::move(queue_.front());
+      queue_.pop_front();
+      ++num_busy_;
+      lock.unlock();
+      has_room_.notify_one();
+      write();
+      lock.lock();
+      --num_busy_;
+      ++statistics_.num_written;
+      if (queue_.empty() && num_busy_ == 0) idle_.notify_all();
+    }
+  }
+
+  const int max_queue_size_;
+  const BackpressurePolicy policy_;
+  mutable std::mutex mutex_;
+  std::condition_variable has_work_;
+  std::condition_variable has_room_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> queue_;
+  int num_busy_{0};
+  bool stopping_{false};
+  WriteStatistics statistics_;
+  std::vector<std::thread> threads_;
+};
+
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::SetAsynchronousWrites(int num_threads, int max_queue_size,
+                                        BackpressurePolicy policy) {
+  if (num_threads < 0) {
+    throw std::logic_error(
+        "ImageWriter: the number of writer threads cannot be negative");
+  }
+  if (max_queue_size <= 0) {
+    throw std::logic_error("ImageWriter: the queue size must be positive");
+  }
+  // Complete the pending writes and keep the statistics of the current writer.
+  Flush();
+  statistics_ = get_write_statistics();
+  async_writer_.reset();
+  if (num_threads > 0) {
+    async_writer_ =
+        std::make_unique<AsyncWriter>(num_threads, max_queue_size, policy);
+  }
+}
+
+void ImageWriter::Flush() const {
+  if (async_writer_ != nullptr) async_writer_->Flush();
+}
+
+ImageWriter::WriteStatistics ImageWriter::get_write_statistics() const {
+  WriteStatistics result = statistics_;
+  if (async_writer_ != nullptr) {
+    const WriteStatistics async = async_writer_->statistics();
+    result.num_written += async.num_written;
+    result.num_dropped += async.num_dropped;
+    result.max_queue_depth =
+        std::max(result.max_queue_depth, async.max_queue_depth);
+  }
+  return result;
+}
+
+void ImageWriter::set_png_compression_level(int level) {
+  if (level < 0 || level > 9) {
+    throw std::logic_error(
+        "ImageWriter: the png compression level must be in [0, 9]");
+  }
+  png_compression_level_ = level;
+}
+
 ImageWriter::ImageWriter() {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
@@ -162,9 +305,20 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name = MakeFileName(data.format, data.pixel_type,
+                                       context.get_time(), port.get_name(),
+                                       data.count++);
+  if (async_writer_ == nullptr) {
+    SaveToFileHelper(image, file_name, png_compression_level_);
+    ++statistics_.num_written;
+    return;
+  }
+  // The image must be copied: the port's value can change as soon as Publish()
+  // returns. The copy is then owned by the queued write.
+  async_writer_->Push([image_copy = image, file_name = std::move(file_name),
+                       level = png_compression_level_]() {
+    SaveToFileHelper(image_copy, file_name, level);
+  });
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
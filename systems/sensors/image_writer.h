@@ -6,6 +6,8 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -77,7 +79,16 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ <h3>Asynchronous writes</h3>
+
+ By default, images are encoded and written to disk inside Publish(), on the
+ thread advancing the simulation. When writing many or large images, the
+ simulation can instead hand the images off to a pool of background writer
+ threads; see SetAsynchronousWrites(). Publish() then only copies the image
+ and its file name into a bounded queue. All pending images are written by
+ Flush() and when the %ImageWriter is destroyed.  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
@@ -85,6 +96,57 @@ class ImageWriter : public LeafSystem<double> {
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Waits for all pending asynchronous writes before destruction.  */
+  ~ImageWriter() override;
+
+  /** The behavior of Publish() when the queue of pending asynchronous writes
+   is full.  */
+  enum class BackpressurePolicy {
+    /** Publish() waits until a pending image has been written.  */
+    kBlock,
+    /** Publish() discards the image; it is counted as dropped. The port's
+     `count` is incremented nonetheless, so that the file names of the written
+     images reveal the dropped ones.  */
+    kDrop,
+  };
+
+  /** Statistics of the images handled by this %ImageWriter.  */
+  struct WriteStatistics {
+    /** The number of images written to disk.  */
+    int64_t num_written{0};
+    /** The number of images discarded by BackpressurePolicy::kDrop.  */
+    int64_t num_dropped{0};
+    /** The largest number of images that were pending in the queue at once.  */
+    int max_queue_depth{0};
+  };
+
+  /** Configures the writing of images on `num_threads` background threads.
+   Images published while `max_queue_size` images are already pending are
+   handled according to `policy`. Passing `num_threads = 0` restores
+   synchronous writes (the default). Any pending images are written before the
+   configuration changes.
+   @throws std::logic_error if `num_threads` is negative or `max_queue_size` is
+                            not positive.  */
+  void SetAsynchronousWrites(
+      int num_threads, int max_queue_size,
+      BackpressurePolicy policy = BackpressurePolicy::kBlock);
+
+  /** Blocks until all pending asynchronous writes have completed. It is a
+   no-op for synchronous writes.  */
+  void Flush() const;
+
+  /** Returns the statistics of the images handled so far.  */
+  WriteStatistics get_write_statistics() const;
+
+  /** Sets the zlib compression level of the .png images written by this
+   %ImageWriter, from 0 (no compression, fastest) to 9 (smallest files,
+   slowest). The default is 5.
+   @throws std::logic_error if `level` is not in [0, 9].  */
+  void set_png_compression_level(int level);
+
+  /** Returns the zlib compression level of .png images.  */
+  int png_compression_level() const { return png_compression_level_; }
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -249,6 +311,16 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  int png_compression_level_{5};
+
+  // The queue and threads of asynchronous writes; null for synchronous writes.
+  class AsyncWriter;
+  std::unique_ptr<AsyncWriter> async_writer_;
+
+  // Statistics of synchronous writes, and of previous asynchronous writers.
+  // NOTE: This is mutable for the same reason as ImagePortInfo::count.
+  mutable WriteStatistics statistics_;
 };
 
 }  // namespace sensors
@@ -1,12 +1,13 @@
 #include "drake/systems/sensors/rgbd_sensor.h"
 
-#include <algorithm>
+#include <future>
 #include <limits>
 #include <string>
 #include <utility>
 
 #include <Eigen/Dense>
 
+#include "drake/common/drake_throw.h"
 #include "drake/geometry/render/camera_properties.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -26,6 +27,7 @@ using geometry::FrameId;
 using geometry::QueryObject;
 using geometry::render::CameraProperties;
 using geometry::render::DepthCameraProperties;
+using geometry::render::RenderEngine;
 using geometry::SceneGraph;
 using math::RigidTransformd;
 using std::move;
@@ -123,9 +125,9 @@ void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
-  ImageDepth32F depth32(depth_image->width(), depth_image->height());
-  CalcDepthImage32F(context, &depth32);
-  ConvertDepth32FTo16U(depth32, depth_image);
+  const QueryObject<double>& query_object = get_query_object(context);
+  query_object.RenderDepthImage(depth_properties_, parent_frame_id_,
+                                X_PB_ * X_BD_, depth_image);
 }
 
 void RgbdSensor::CalcLabelImage(const Context<double>& context,
@@ -156,12 +158,10 @@ void RgbdSensor::CalcX_WB(
 void RgbdSensor::ConvertDepth32FTo16U(const ImageDepth32F& d32,
                                       ImageDepth16U* d16) {
   // Convert to mm and 16bits.
-  const float kDepth16UOverflowDistance =
-      std::numeric_limits<uint16_t>::max() / 1000.;
   for (int w = 0; w < d16->width(); w++) {
     for (int h = 0; h < d16->height(); h++) {
-      const double dist = std::min(d32.at(w, h)[0], kDepth16UOverflowDistance);
-      d16->at(w, h)[0] = static_cast<uint16_t>(dist * 1000);
+      d16->at(w, h)[0] =
+          geometry::render::internal::ConvertDepth32FTo16U(d32.at(w, h)[0]);
     }
   }
 }
@@ -236,6 +236,176 @@ RgbdSensorDiscrete::RgbdSensorDiscrete(std::unique_ptr<RgbdSensor> camera,
   builder.BuildInto(this);
 }
 
+RgbdSensorAsync::RgbdSensorAsync(
+    FrameId parent_id, const RigidTransformd& X_PB, double period,
+    double output_delay, const CameraProperties& color_properties,
+    const DepthCameraProperties& depth_properties,
+    const RgbdSensor::CameraPoses& camera_poses, bool render_label_image)
+    : parent_frame_id_(parent_id),
+      X_PB_(X_PB),
+      period_(period),
+      output_delay_(output_delay),
+      color_properties_(color_properties),
+      depth_properties_(depth_properties),
+      X_BC_(camera_poses.X_BC),
+      X_BD_(camera_poses.X_BD),
+      render_label_image_(render_label_image) {
+  DRAKE_THROW_UNLESS(output_delay > 0 && output_delay <= period);
+
+  query_object_input_port_ = &this->DeclareAbstractInputPort(
+      "geometry_query", Value<geometry::QueryObject<double>>{});
+
+  // The outputs only depend on the output frame, in the abstract state.
+  color_image_port_ = &this->DeclareAbstractOutputPort(
+      "color_image",
+      ImageRgba8U(color_properties.width, color_properties.height),
+      &RgbdSensorAsync::CalcColorImage, {this->xa_ticket()});
+  depth_image_32F_port_ = &this->DeclareAbstractOutputPort(
+      "depth_image_32f",
+      ImageDepth32F(depth_properties.width, depth_properties.height),
+      &RgbdSensorAsync::CalcDepthImage32F, {this->xa_ticket()});
+  depth_image_16U_port_ = &this->DeclareAbstractOutputPort(
+      "depth_image_16u",
+      ImageDepth16U(depth_properties.width, depth_properties.height),
+      &RgbdSensorAsync::CalcDepthImage16U, {this->xa_ticket()});
+  label_image_port_ = &this->DeclareAbstractOutputPort(
+      "label_image",
+      ImageLabel16I(color_properties.width, color_properties.height),
+      &RgbdSensorAsync::CalcLabelImage, {this->xa_ticket()});
+
+  this->DeclareAbstractState(AbstractValue::Make(Buffers{}));
+  if (output_delay == period) {
+    // The capture of a frame and the output of the previous one happen at the
+    // same time, in that order.
+    this->DeclarePeriodicUnrestrictedUpdateEvent(
+        period, 0., &RgbdSensorAsync::OutputAndCaptureFrame);
+  } else {
+    this->DeclarePeriodicUnrestrictedUpdateEvent(
+        period, 0., &RgbdSensorAsync::CaptureFrame);
+    this->DeclarePeriodicUnrestrictedUpdateEvent(
+        period, output_delay, &RgbdSensorAsync::OutputFrame);
+  }
+}
+
+double RgbdSensorAsync::GetOutputFrameTime(
+    const Context<double>& context) const {
+  const Frame* frame = get_completed_frame(context);
+  return frame ? frame->time : -1;
+}
+
+void RgbdSensorAsync::CaptureFrame(const Context<double>& context,
+                                   State<double>* state) const {
+  const QueryObject<double>& query_object =
+      query_object_input_port().Eval<QueryObject<double>>(context);
+  RigidTransformd X_WB = X_PB_;
+  if (parent_frame_id_ != SceneGraph<double>::world_frame_id()) {
+    X_WB = query_object.X_WF(parent_frame_id_) * X_PB_;
+  }
+
+  // The worker only uses copies, so that the system and the context can change
+  // (or be destroyed) while it runs.
+  const std::shared_ptr<RenderEngine> color_engine =
+      query_object.CloneRenderEngine(color_properties_.renderer_name);
+  std::shared_ptr<RenderEngine> depth_engine = color_engine;
+  if (depth_properties_.renderer_name != color_properties_.renderer_name) {
+    depth_engine =
+        query_object.CloneRenderEngine(depth_properties_.renderer_name);
+  }
+  auto render = [color_engine, depth_engine, time = context.get_time(),
+                 X_WC = X_WB * X_BC_, X_WD = X_WB * X_BD_,
+                 color_properties = color_properties_,
+                 depth_properties = depth_properties_,
+                 render_label_image = render_label_image_]() {
+    auto frame = std::make_shared<Frame>();
+    frame->time = time;
+    frame->color.resize(color_properties.width, color_properties.height);
+    frame->label.resize(color_properties.width, color_properties.height);
+    frame->depth32.resize(depth_properties.width, depth_properties.height);
+    frame->depth16.resize(depth_properties.width, depth_properties.height);
+    ImageLabel16I* const label = render_label_image ? &frame->label : nullptr;
+    // A single engine renders all of the images at once.
+    if (depth_engine == color_engine) {
+      color_engine->RenderImages(color_properties, X_WC, depth_properties,
+                                 X_WD, &frame->color, &frame->depth32, label);
+    } else {
+      color_engine->RenderImages(color_properties, X_WC, depth_properties,
+                                 X_WD, &frame->color, nullptr, label);
+      depth_engine->RenderImages(color_properties, X_WC, depth_properties,
+                                 X_WD, nullptr, &frame->depth32, nullptr);
+    }
+    RgbdSensor::ConvertDepth32FTo16U(frame->depth32, &frame->depth16);
+    return std::shared_ptr<const Frame>(std::move(frame));
+  };
+
+  Buffers& buffers = state->get_mutable_abstract_state<Buffers>(0);
+  buffers.pending = std::async(std::launch::async, std::move(render)).share();
+}
+
+void RgbdSensorAsync::OutputFrame(const Context<double>&,
+                                  State<double>* state) const {
+  Buffers& buffers = state->get_mutable_abstract_state<Buffers>(0);
+  if (buffers.pending.valid()) {
+    // Rethrows the exception of the worker, if any.
+    buffers.completed = buffers.pending.get();
+    buffers.pending = {};
+  }
+}
+
+void RgbdSensorAsync::OutputAndCaptureFrame(const Context<double>& context,
+                                            State<double>* state) const {
+  OutputFrame(context, state);
+  CaptureFrame(context, state);
+}
+
+const RgbdSensorAsync::Frame* RgbdSensorAsync::get_completed_frame(
+    const Context<double>& context) const {
+  return context.get_abstract_state<Buffers>(0).completed.get();
+}
+
+void RgbdSensorAsync::CalcColorImage(const Context<double>& context,
+                                     ImageRgba8U* color_image) const {
+  const Frame* frame = get_completed_frame(context);
+  if (frame) {
+    *color_image = frame->color;
+  } else {
+    *color_image = ImageRgba8U(color_properties_.width,
+                               color_properties_.height);
+  }
+}
+
+void RgbdSensorAsync::CalcDepthImage32F(const Context<double>& context,
+                                        ImageDepth32F* depth_image) const {
+  const Frame* frame = get_completed_frame(context);
+  if (frame) {
+    *depth_image = frame->depth32;
+  } else {
+    *depth_image = ImageDepth32F(depth_properties_.width,
+                                 depth_properties_.height);
+  }
+}
+
+void RgbdSensorAsync::CalcDepthImage16U(const Context<double>& context,
+                                        ImageDepth16U* depth_image) const {
+  const Frame* frame = get_completed_frame(context);
+  if (frame) {
+    *depth_image = frame->depth16;
+  } else {
+    *depth_image = ImageDepth16U(depth_properties_.width,
+                                 depth_properties_.height);
+  }
+}
+
+void RgbdSensorAsync::CalcLabelImage(const Context<double>& context,
+                                     ImageLabel16I* label_image) const {
+  const Frame* frame = get_completed_frame(context);
+  if (frame) {
+    *label_image = frame->label;
+  } else {
+    *label_image = ImageLabel16I(color_properties_.width,
+                                 color_properties_.height);
+  }
+}
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
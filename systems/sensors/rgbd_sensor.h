@@ -1,5 +1,6 @@
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,6 +13,7 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/render/camera_properties.h"
+#include "drake/geometry/render/render_engine.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/roll_pitch_yaw.h"
 #include "drake/systems/framework/diagram.h"
@@ -191,6 +193,7 @@ class RgbdSensor final : public LeafSystem<double> {
 
  private:
   friend class RgbdSensorTester;
+  friend class RgbdSensorAsync;
 
   // The calculator methods for the four output ports.
   void CalcColorImage(const Context<double>& context,
@@ -317,6 +320,162 @@ class RgbdSensorDiscrete final : public systems::Diagram<double> {
   int X_WB_output_port_{-1};
 };
 
+/**
+ An RGB-D sensor that renders its images asynchronously, so that the
+ simulation can advance while the images of a frame are being rendered.
+
+ @system{%RgbdSensorAsync,
+    @input_port{geometry_query},
+    @output_port{color_image}
+    @output_port{depth_image_32f}
+    @output_port{depth_image_16u}
+    @output_port{label_image}
+ }
+
+ The sensor captures a frame every `period` seconds, starting at time zero.
+ When the capture event fires, the sensor takes copies of the render engines
+ with the current poses of the geometries (see
+ geometry::QueryObject::CloneRenderEngine()) and starts rendering the frame's
+ images from them on a worker thread. The frame captured at time t is output
+ from time t + `output_delay` on, until the next frame is output; it is
+ waited for, if need be, at that time. Before the first frame is output, the
+ images are filled with zeros. Because the captured geometry and the output
+ times only depend on the capture time, the output is deterministic; it does
+ not depend on how long the rendering takes.
+
+ The state of the sensor holds two frame buffers: the frame being rendered,
+ and the last completed frame that is being output.
+
+ The cameras, their poses and the image formats are those of RgbdSensor.
+
+ @warning The render engines must support rendering into a clone on another
+ thread while the original is in use. The clones of RenderEngineVtk share their
+ geometry with the original, so that at most one of them may render at a time;
+ with it, nothing else (e.g., another camera) may render from the same
+ geometry::SceneGraph while a frame is in flight.
+
+ @ingroup sensor_systems  */
+class RgbdSensorAsync final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RgbdSensorAsync)
+
+  /** Constructs an %RgbdSensorAsync.
+
+   @param parent_id         The identifier of the parent frame `P`, as for
+                            RgbdSensor.
+   @param X_PB              The pose of the sensor body `B` in `P`.
+   @param period            The period of the frame captures (sec).
+   @param output_delay      The delay between the capture and the output of a
+                            frame (sec).
+   @param color_properties  Defines the color (and label) cameras' intrinsics
+                            and renderer.
+   @param depth_properties  Defines the depth camera's intrinsics and renderer.
+   @param camera_poses      The poses of the color (C) and depth camera (D)
+                            frames with respect to the sensor base (B).
+   @param render_label_image  If false, the label image is not rendered, and
+                              the label image output stays filled with zeros.
+   @throws std::exception unless 0 < `output_delay` <= `period`.  */
+  RgbdSensorAsync(
+      geometry::FrameId parent_id, const math::RigidTransformd& X_PB,
+      double period, double output_delay,
+      const geometry::render::CameraProperties& color_properties,
+      const geometry::render::DepthCameraProperties& depth_properties,
+      const RgbdSensor::CameraPoses& camera_poses = {},
+      bool render_label_image = true);
+
+  /** Returns the capture period (sec).  */
+  double period() const { return period_; }
+
+  /** Returns the delay between the capture and the output of a frame (sec).  */
+  double output_delay() const { return output_delay_; }
+
+  /** @see RgbdSensor::query_object_input_port().  */
+  const InputPort<double>& query_object_input_port() const {
+    return *query_object_input_port_;
+  }
+
+  /** @see RgbdSensor::color_image_output_port().  */
+  const OutputPort<double>& color_image_output_port() const {
+    return *color_image_port_;
+  }
+
+  /** @see RgbdSensor::depth_image_32F_output_port().  */
+  const OutputPort<double>& depth_image_32F_output_port() const {
+    return *depth_image_32F_port_;
+  }
+
+  /** @see RgbdSensor::depth_image_16U_output_port().  */
+  const OutputPort<double>& depth_image_16U_output_port() const {
+    return *depth_image_16U_port_;
+  }
+
+  /** @see RgbdSensor::label_image_output_port().  */
+  const OutputPort<double>& label_image_output_port() const {
+    return *label_image_port_;
+  }
+
+  /** Returns the capture time of the frame that is output in the given
+   `context`, or a negative value if no frame has been output yet.  */
+  double GetOutputFrameTime(const Context<double>& context) const;
+
+ private:
+  // The images of a frame.
+  struct Frame {
+    double time{};
+    ImageRgba8U color;
+    ImageDepth32F depth32;
+    ImageDepth16U depth16;
+    ImageLabel16I label;
+  };
+
+  // The abstract state: the frame being rendered (if any) and the last
+  // completed frame (if any).
+  struct Buffers {
+    std::shared_future<std::shared_ptr<const Frame>> pending;
+    std::shared_ptr<const Frame> completed;
+  };
+
+  // Starts rendering a frame at the context's time.
+  void CaptureFrame(const Context<double>& context, State<double>* state) const;
+
+  // Waits for the frame being rendered and makes it the output frame.
+  void OutputFrame(const Context<double>& context, State<double>* state) const;
+
+  // The handler of the single periodic event of the case output_delay ==
+  // period, which outputs a frame and captures the next one.
+  void OutputAndCaptureFrame(const Context<double>& context,
+                             State<double>* state) const;
+
+  // Returns the output frame of the context, if any.
+  const Frame* get_completed_frame(const Context<double>& context) const;
+
+  // The calculator methods for the output ports.
+  void CalcColorImage(const Context<double>& context,
+                      ImageRgba8U* color_image) const;
+  void CalcDepthImage32F(const Context<double>& context,
+                         ImageDepth32F* depth_image) const;
+  void CalcDepthImage16U(const Context<double>& context,
+                         ImageDepth16U* depth_image) const;
+  void CalcLabelImage(const Context<double>& context,
+                      ImageLabel16I* label_image) const;
+
+  const InputPort<double>* query_object_input_port_{};
+  const OutputPort<double>* color_image_port_{};
+  const OutputPort<double>* depth_image_32F_port_{};
+  const OutputPort<double>* depth_image_16U_port_{};
+  const OutputPort<double>* label_image_port_{};
+
+  const geometry::FrameId parent_frame_id_;
+  const math::RigidTransformd X_PB_;
+  const double period_{};
+  const double output_delay_{};
+  const geometry::render::CameraProperties color_properties_;
+  const geometry::render::DepthCameraProperties depth_properties_;
+  const math::RigidTransformd X_BC_;
+  const math::RigidTransformd X_BD_;
+  const bool render_label_image_{};
+};
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
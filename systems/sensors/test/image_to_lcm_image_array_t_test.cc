@@ -118,6 +118,26 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
       &dut_uncompressed, color_image, depth_image, label_image);
   Verify(dut_uncompressed, image_array_t_uncompressed,
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
+
+  // Packing the images concurrently produces the same message.
+  ImageToLcmImageArrayT dut_threaded(
+      kColorFrameName, kDepthFrameName, kLabelFrameName, true);
+  EXPECT_EQ(dut_threaded.max_num_threads(), 1);
+  dut_threaded.set_max_num_threads(3);
+  EXPECT_EQ(dut_threaded.max_num_threads(), 3);
+  EXPECT_THROW(dut_threaded.set_max_num_threads(0), std::exception);
+  auto image_array_t_threaded = SetUpInputAndOutput(
+      &dut_threaded, color_image, depth_image, label_image);
+  Verify(dut_threaded, image_array_t_threaded,
+         image_t::COMPRESSION_METHOD_ZLIB);
+  ASSERT_EQ(image_array_t_threaded.images.size(),
+            image_array_t_compressed.images.size());
+  for (size_t i = 0; i < image_array_t_threaded.images.size(); ++i) {
+    EXPECT_EQ(image_array_t_threaded.images[i].data,
+              image_array_t_compressed.images[i].data);
+    EXPECT_EQ(image_array_t_threaded.images[i].header.frame_name,
+              image_array_t_compressed.images[i].header.frame_name);
+  }
 }
 
 }  // namespace
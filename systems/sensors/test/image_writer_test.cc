@@ -5,6 +5,7 @@
 #include <fstream>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <spruce.hh>
@@ -659,6 +660,68 @@ TEST_F(ImageWriterTest, WritesDepthImage) {
   TestWritingImageOnPort<PixelType::kDepth32F>();
 }
 
+// Confirms that images handed off to background threads are all written once
+// the writer is flushed, and that the configuration is validated.
+TEST_F(ImageWriterTest, AsynchronousWrites) {
+  ImageWriter writer;
+  ImageWriterTester tester(writer);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetAsynchronousWrites(-1, 4),
+                              std::logic_error, ".*cannot be negative");
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetAsynchronousWrites(2, 0),
+                              std::logic_error, ".*must be positive");
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.set_png_compression_level(10),
+                              std::logic_error, ".*compression level.*");
+  writer.set_png_compression_level(1);
+  EXPECT_EQ(writer.png_compression_level(), 1);
+
+  const double period = 1 / 10.0;
+  const std::string port_name = "async_port";
+  spruce::path path(temp_dir());
+  path.append("async_{time_usec}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      port_name, path.getStr(), period, 0.0);
+  const ImageRgba8U image = test_image<PixelType::kRgba8U>();
+  auto events = writer.AllocateCompositeEventCollection();
+  auto context = writer.AllocateContext();
+  context->FixInputPort(port.get_index(),
+                        AbstractValue::Make<ImageRgba8U>(image));
+  context->SetTime(0.);
+  writer.CalcNextUpdateTime(*context, events.get());
+
+  writer.SetAsynchronousWrites(2, 4);
+  const int kNumImages = 10;
+  std::vector<std::string> expected_names;
+  for (int i = 0; i < kNumImages; ++i) {
+    context->SetTime(i * period);
+    expected_names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U,
+        context->get_time(), port_name, tester.port_count(port.get_index())));
+    add_file_for_cleanup(expected_names.back());
+    writer.Publish(*context, events->get_publish_events());
+  }
+  writer.Flush();
+
+  const ImageWriter::WriteStatistics statistics =
+      writer.get_write_statistics();
+  EXPECT_EQ(statistics.num_written, kNumImages);
+  EXPECT_EQ(statistics.num_dropped, 0);
+  EXPECT_GE(statistics.max_queue_depth, 1);
+  EXPECT_LE(statistics.max_queue_depth, 4);
+  for (const std::string& name : expected_names) {
+    EXPECT_TRUE(MatchesFileOnDisk(name, image));
+  }
+
+  // Returning to synchronous writes keeps the statistics.
+  writer.SetAsynchronousWrites(0, 1);
+  context->SetTime(kNumImages * period);
+  add_file_for_cleanup(tester.MakeFileName(
+      tester.port_format(port.get_index()), PixelType::kRgba8U,
+      context->get_time(), port_name, tester.port_count(port.get_index())));
+  writer.Publish(*context, events->get_publish_events());
+  EXPECT_EQ(writer.get_write_statistics().num_written, kNumImages + 1);
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
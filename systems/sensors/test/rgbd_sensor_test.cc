@@ -11,6 +11,7 @@
 #include "drake/geometry/render/camera_properties.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/geometry/test_utilities/dummy_render_engine.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/zero_order_hold.h"
@@ -285,11 +286,11 @@ TEST_F(RgbdSensorTest, ConstructCameraWithNonTrivialOffsets) {
   EXPECT_TRUE(CompareMatrices(sensor.X_BD().matrix(), X_BD.matrix()));
 }
 
-// We don't explicitly test any of the image outputs. Most of the image outputs
-// simple wrap the corresponding QueryObject call; the only calculations they
-// do is to produce the X_PC matrix (which is implicitly tested in the
-// construction tests above). The *one* exception is the 16U depth image which
-// converts 32F to 16U. In this case, we test the conversion method directly.
+// We don't explicitly test any of the image outputs. They simply wrap the
+// corresponding QueryObject call; the only calculations they do is to produce
+// the X_PC matrix (which is implicitly tested in the construction tests above).
+// The conversion from 32F to 16U depth images is still used by
+// RgbdSensorAsync, which renders both; we test the conversion method directly.
 TEST_F(RgbdSensorTest, DepthImage32FTo16U) {
   // The largest uint16_t value (unitless). Period.
   const uint16_t kMax16 = std::numeric_limits<uint16_t>::max();
@@ -393,6 +394,86 @@ GTEST_TEST(RgbdSensorDiscrete, ImageHold) {
   //  the expected sub-system ports.
 }
 
+// Tests the ports of the asynchronous sensor, and the validation of its
+// timing parameters.
+GTEST_TEST(RgbdSensorAsync, Construction) {
+  const CameraProperties color_properties(640, 480, M_PI / 4, "render");
+  const DepthCameraProperties depth_properties(320, 240, M_PI / 6, "render",
+                                               0.1, 10);
+  const RgbdSensorAsync sensor(SceneGraph<double>::world_frame_id(),
+                               RigidTransformd::Identity(), 0.1, 0.05,
+                               color_properties, depth_properties);
+  EXPECT_EQ(sensor.period(), 0.1);
+  EXPECT_EQ(sensor.output_delay(), 0.05);
+  EXPECT_EQ(sensor.query_object_input_port().get_name(), "geometry_query");
+  EXPECT_EQ(sensor.color_image_output_port().get_name(), "color_image");
+  EXPECT_EQ(sensor.depth_image_32F_output_port().get_name(), "depth_image_32f");
+  EXPECT_EQ(sensor.depth_image_16U_output_port().get_name(), "depth_image_16u");
+  EXPECT_EQ(sensor.label_image_output_port().get_name(), "label_image");
+
+  // Before the first frame, the images have the sizes of the cameras.
+  auto context = sensor.CreateDefaultContext();
+  EXPECT_EQ(sensor.GetOutputFrameTime(*context), -1);
+  const auto& color =
+      sensor.color_image_output_port().Eval<ImageRgba8U>(*context);
+  EXPECT_EQ(color.width(), 640);
+  EXPECT_EQ(color.height(), 480);
+  const auto& depth =
+      sensor.depth_image_32F_output_port().Eval<ImageDepth32F>(*context);
+  EXPECT_EQ(depth.width(), 320);
+  EXPECT_EQ(depth.height(), 240);
+
+  for (const double output_delay : {0., 0.2}) {
+    EXPECT_THROW(RgbdSensorAsync(SceneGraph<double>::world_frame_id(),
+                                 RigidTransformd::Identity(), 0.1,
+                                 output_delay, color_properties,
+                                 depth_properties),
+                 std::exception);
+  }
+}
+
+// Tests that each frame is output after the given delay, and held until the
+// next one is output.
+GTEST_TEST(RgbdSensorAsync, FrameTiming) {
+  const double kPeriod = 0.1;
+  for (const double output_delay : {0.05, kPeriod}) {
+    SCOPED_TRACE(output_delay);
+    DiagramBuilder<double> builder;
+    auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+    scene_graph->AddRenderer("render", make_unique<DummyRenderEngine>());
+    const DepthCameraProperties properties(32, 24, M_PI / 4, "render", 0.1,
+                                           10);
+    auto* sensor = builder.AddSystem<RgbdSensorAsync>(
+        SceneGraph<double>::world_frame_id(), RigidTransformd::Identity(),
+        kPeriod, output_delay, properties, properties);
+    builder.Connect(scene_graph->get_query_output_port(),
+                    sensor->query_object_input_port());
+    auto diagram = builder.Build();
+
+    Simulator<double> simulator(*diagram);
+    const Context<double>& sensor_context =
+        diagram->GetSubsystemContext(*sensor, simulator.get_context());
+    // The capture time of the output frame at a time between the events.
+    auto output_frame_time = [&](double time) {
+      simulator.AdvanceTo(time);
+      return sensor->GetOutputFrameTime(sensor_context);
+    };
+    EXPECT_EQ(output_frame_time(0.01), -1);
+    EXPECT_EQ(output_frame_time(output_delay - 0.01), -1);
+    EXPECT_EQ(output_frame_time(output_delay + 0.01), 0);
+    EXPECT_EQ(output_frame_time(kPeriod + output_delay - 0.01), 0);
+    EXPECT_NEAR(output_frame_time(kPeriod + output_delay + 0.01), kPeriod,
+                1e-14);
+    EXPECT_NEAR(output_frame_time(5 * kPeriod + output_delay + 0.01),
+                5 * kPeriod, 1e-14);
+
+    const auto& label =
+        sensor->label_image_output_port().Eval<ImageLabel16I>(sensor_context);
+    EXPECT_EQ(label.width(), 32);
+    EXPECT_EQ(label.height(), 24);
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
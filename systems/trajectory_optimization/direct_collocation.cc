@@ -1,12 +1,15 @@
 #include "drake/systems/trajectory_optimization/direct_collocation.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/solvers/solve.h"
 
 namespace drake {
 namespace systems {
@@ -18,6 +21,134 @@ using solvers::MathematicalProgram;
 using solvers::VectorXDecisionVariable;
 using trajectories::PiecewisePolynomial;
 
+namespace {
+
+// Implements the collocation constraints of all the N-1 segments of a
+// trajectory as a single constraint, bound to the variables {h, x, u} of
+// DirectCollocation. The segments are distributed over up to `num_threads`
+// threads, and each thread evaluates its segments through its own
+// DirectCollocationConstraint (hence with its own context).
+class ParallelDirectCollocationConstraint final : public Constraint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParallelDirectCollocationConstraint)
+
+  ParallelDirectCollocationConstraint(
+      const System<double>& system, const Context<double>& context,
+      int num_states, int num_inputs, int num_time_samples, int num_threads,
+      variant<InputPortSelection, InputPortIndex> input_port_index,
+      bool assume_non_continuous_states_are_fixed)
+      : Constraint(num_states * (num_time_samples - 1),
+                   (num_time_samples - 1) + num_time_samples * num_states +
+                       num_time_samples * num_inputs,
+                   Eigen::VectorXd::Zero(num_states * (num_time_samples - 1)),
+                   Eigen::VectorXd::Zero(num_states * (num_time_samples - 1))),
+        num_states_(num_states),
+        num_threads_(std::min(num_threads, num_time_samples - 1)) {
+    DRAKE_DEMAND(num_threads_ >= 1);
+    for (int i = 0; i < num_threads_; ++i) {
+      segment_constraints_.push_back(
+          std::make_unique<DirectCollocationConstraint>(
+              system, context, input_port_index,
+              assume_non_continuous_states_are_fixed));
+    }
+
+    // Each segment i depends on {h(i), x(i), x(i+1), u(i), u(i+1)}, in the
+    // order expected by DirectCollocationConstraint.
+    const int num_segments = num_time_samples - 1;
+    std::vector<std::pair<int, int>> gradient_sparsity_pattern;
+    segment_indices_.resize(num_segments);
+    for (int i = 0; i < num_segments; ++i) {
+      std::vector<int>& indices = segment_indices_[i];
+      indices.push_back(i);
+      for (int j = 0; j < 2 * num_states; ++j) {
+        indices.push_back(num_segments + i * num_states + j);
+      }
+      for (int j = 0; j < 2 * num_inputs; ++j) {
+        indices.push_back(num_segments + num_time_samples * num_states +
+                          i * num_inputs + j);
+      }
+      for (int row = i * num_states; row < (i + 1) * num_states; ++row) {
+        for (int index : indices) {
+          gradient_sparsity_pattern.emplace_back(row, index);
+        }
+      }
+    }
+    SetGradientSparsityPattern(gradient_sparsity_pattern);
+  }
+
+ private:
+  int num_segments() const { return static_cast<int>(segment_indices_.size()); }
+
+  Eigen::VectorXd SegmentValues(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                int segment) const {
+    const std::vector<int>& indices = segment_indices_[segment];
+    Eigen::VectorXd x_segment(indices.size());
+    for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+      x_segment(j) = x(indices[j]);
+    }
+    return x_segment;
+  }
+
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const final {
+    y->resize(num_constraints());
+    StaticParallelForIndexLoop(
+        num_threads_, 0, num_segments(), [&](int thread_num, int i) {
+          Eigen::VectorXd y_segment;
+          segment_constraints_[thread_num]->Eval(SegmentValues(x, i),
+                                                 &y_segment);
+          y->segment(i * num_states_, num_states_) = y_segment;
+        });
+  }
+
+  // Each segment is differentiated with respect to its own variables only,
+  // and the chain rule then gives the gradient with respect to the
+  // derivatives of x.
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const final {
+    const Eigen::VectorXd x_value = math::autoDiffToValueMatrix(x);
+    const Eigen::MatrixXd x_gradient = math::autoDiffToGradientMatrix(x);
+    Eigen::VectorXd y_value(num_constraints());
+    Eigen::MatrixXd y_gradient =
+        Eigen::MatrixXd::Zero(num_constraints(), x_gradient.cols());
+    StaticParallelForIndexLoop(
+        num_threads_, 0, num_segments(), [&](int thread_num, int i) {
+          const std::vector<int>& indices = segment_indices_[i];
+          AutoDiffVecXd y_segment;
+          segment_constraints_[thread_num]->Eval(
+              math::initializeAutoDiff(SegmentValues(x_value, i)),
+              &y_segment);
+          y_value.segment(i * num_states_, num_states_) =
+              math::autoDiffToValueMatrix(y_segment);
+          const Eigen::MatrixXd dy_segment =
+              math::autoDiffToGradientMatrix(y_segment, indices.size());
+          auto y_gradient_segment =
+              y_gradient.middleRows(i * num_states_, num_states_);
+          for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+            y_gradient_segment +=
+                dy_segment.col(j) * x_gradient.row(indices[j]);
+          }
+        });
+    *y = math::initializeAutoDiffGivenGradientMatrix(y_value, y_gradient);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+              VectorX<symbolic::Expression>*) const final {
+    throw std::logic_error(
+        "DirectCollocationConstraint does not support symbolic evaluation.");
+  }
+
+  const int num_states_;
+  const int num_threads_;
+  // The constraint used by each thread.
+  std::vector<std::unique_ptr<DirectCollocationConstraint>>
+      segment_constraints_;
+  // The indices in {h, x, u} of the variables of each segment.
+  std::vector<std::vector<int>> segment_indices_;
+};
+
+}  // namespace
+
 DirectCollocationConstraint::DirectCollocationConstraint(
     const System<double>& system, const Context<double>& context,
     variant<InputPortSelection, InputPortIndex> input_port_index,
@@ -152,7 +283,7 @@ DirectCollocation::DirectCollocation(
     const System<double>* system, const Context<double>& context,
     int num_time_samples, double minimum_timestep, double maximum_timestep,
     variant<InputPortSelection, InputPortIndex> input_port_index,
-    bool assume_non_continuous_states_are_fixed)
+    bool assume_non_continuous_states_are_fixed, int num_threads)
     : MultipleShooting(
           system->get_input_port_selection(input_port_index)
               ? system->get_input_port_selection(input_port_index)->size()
@@ -173,6 +304,17 @@ DirectCollocation::DirectCollocation(
         input_port_->get_index(), system_->AllocateInputVector(*input_port_));
   }
 
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  if (num_threads > 1) {
+    // Add the dynamic constraints of all the segments as a single constraint.
+    AddConstraint(std::make_shared<ParallelDirectCollocationConstraint>(
+                      *system, context, num_states(), num_inputs(), N(),
+                      num_threads, input_port_index,
+                      assume_non_continuous_states_are_fixed),
+                  {h_vars(), x_vars(), u_vars()});
+    return;
+  }
+
   // Add the dynamic constraints.
   auto constraint = std::make_shared<DirectCollocationConstraint>(
       *system, context, input_port_index,
@@ -240,6 +382,102 @@ PiecewisePolynomial<double> DirectCollocation::ReconstructStateTrajectory(
   return PiecewisePolynomial<double>::Cubic(times_vec, states, derivatives);
 }
 
+Eigen::VectorXd DirectCollocation::EstimateCollocationErrors(
+    const solvers::MathematicalProgramResult& result) const {
+  const PiecewisePolynomial<double> state_trajectory =
+      ReconstructStateTrajectory(result);
+  const PiecewisePolynomial<double> state_derivative_trajectory =
+      state_trajectory.derivative();
+  PiecewisePolynomial<double> input_trajectory;
+  if (input_port_) {
+    input_trajectory = ReconstructInputTrajectory(result);
+  }
+  const Eigen::VectorXd times = GetSampleTimes(result);
+
+  Eigen::VectorXd errors = Eigen::VectorXd::Zero(N() - 1);
+  for (int i = 0; i < N() - 1; i++) {
+    const double h = times(i + 1) - times(i);
+    if (h <= 0) continue;
+    for (const double fraction : {0.25, 0.75}) {
+      const double t = times(i) + fraction * h;
+      if (input_port_) {
+        input_port_value_->GetMutableVectorData<double>()->SetFromVector(
+            input_trajectory.value(t));
+      }
+      context_->get_mutable_continuous_state().SetFromVector(
+          state_trajectory.value(t));
+      system_->CalcTimeDerivatives(*context_, continuous_state_.get());
+      const Eigen::VectorXd defect = state_derivative_trajectory.value(t) -
+                                     continuous_state_->CopyToVector();
+      errors(i) = std::max(errors(i), h * defect.lpNorm<Eigen::Infinity>());
+    }
+  }
+  return errors;
+}
+
+DirectCollocationMeshRefinementResult SolveDirectCollocationWithMeshRefinement(
+    const std::function<std::unique_ptr<DirectCollocation>(int)>&
+        make_program,
+    int num_time_samples,
+    const DirectCollocationMeshRefinementOptions& options) {
+  DRAKE_THROW_UNLESS(options.tolerance > 0);
+  DRAKE_THROW_UNLESS(options.max_refinements >= 0);
+
+  DirectCollocationMeshRefinementResult refined;
+  refined.program = make_program(num_time_samples);
+  DRAKE_THROW_UNLESS(refined.program != nullptr);
+  refined.result = solvers::Solve(*refined.program);
+
+  for (int refinement = 0; refinement < options.max_refinements &&
+                           refined.result.is_success();
+       ++refinement) {
+    const DirectCollocation& program = *refined.program;
+    const Eigen::VectorXd errors =
+        program.EstimateCollocationErrors(refined.result);
+    if ((errors.array() <= options.tolerance).all()) break;
+
+    // Split the segments whose error exceeds the tolerance at their midpoint.
+    const Eigen::VectorXd times = program.GetSampleTimes(refined.result);
+    std::vector<double> refined_times{times(0)};
+    for (int i = 0; i < errors.size(); i++) {
+      if (errors(i) > options.tolerance) {
+        refined_times.push_back(0.5 * (times(i) + times(i + 1)));
+      }
+      refined_times.push_back(times(i + 1));
+    }
+
+    // Warm start from the previous solution at the refined knots.
+    const PiecewisePolynomial<double> state_trajectory =
+        program.ReconstructStateTrajectory(refined.result);
+    const bool has_inputs = program.input(0).size() > 0;
+    PiecewisePolynomial<double> input_trajectory;
+    if (has_inputs) {
+      input_trajectory = program.ReconstructInputTrajectory(refined.result);
+    }
+    const int num_refined_samples = refined_times.size();
+    std::unique_ptr<DirectCollocation> next_program =
+        make_program(num_refined_samples);
+    DRAKE_THROW_UNLESS(next_program != nullptr);
+    for (int i = 0; i < num_refined_samples; i++) {
+      if (i < num_refined_samples - 1) {
+        next_program->SetInitialGuess(
+            next_program->timestep(i),
+            Vector1d(refined_times[i + 1] - refined_times[i]));
+      }
+      next_program->SetInitialGuess(next_program->state(i),
+                                    state_trajectory.value(refined_times[i]));
+      if (has_inputs) {
+        next_program->SetInitialGuess(
+            next_program->input(i), input_trajectory.value(refined_times[i]));
+      }
+    }
+
+    refined.program = std::move(next_program);
+    refined.result = solvers::Solve(*refined.program);
+  }
+  return refined;
+}
+
 }  // namespace trajectory_optimization
 }  // namespace systems
 }  // namespace drake
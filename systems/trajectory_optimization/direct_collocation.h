@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "drake/common/drake_copyable.h"
@@ -50,13 +51,21 @@ class DirectCollocation : public MultipleShooting {
   /// have some additional book-keeping variables in their state. Only use this
   /// if you are sure that the dynamics of the additional state variables
   /// cannot impact the dynamics of the continuous states. @default false.
+  /// @param num_threads If greater than one, the collocation constraints of
+  /// all the N-1 segments are added as a single constraint, which evaluates
+  /// the segments (and their gradients) in parallel within each call from the
+  /// solver, using up to this many threads. Each thread evaluates the dynamics
+  /// through its own copy of the system and @p context. If one, a
+  /// DirectCollocationConstraint is bound to each segment instead, and the
+  /// segments are evaluated serially by the solver. @default 1.
   DirectCollocation(const System<double>* system,
                     const Context<double>& context, int num_time_samples,
                     double minimum_timestep, double maximum_timestep,
                     variant<InputPortSelection, InputPortIndex>
                         input_port_index =
                     InputPortSelection::kUseFirstInputIfItExists,
-                    bool assume_non_continuous_states_are_fixed = false);
+                    bool assume_non_continuous_states_are_fixed = false,
+                    int num_threads = 1);
 
   // NOTE: The fixed timestep constructor, which would avoid adding h as
   // decision variables, has been removed since it complicates the API and code.
@@ -73,6 +82,15 @@ class DirectCollocation : public MultipleShooting {
   trajectories::PiecewisePolynomial<double> ReconstructStateTrajectory(
       const solvers::MathematicalProgramResult& result) const override;
 
+  /// Returns an estimate of the error of the state trajectory of @p result
+  /// (see ReconstructStateTrajectory()) on each of its N-1 segments. The
+  /// dynamics are only enforced at the knots and at the midpoint of each
+  /// segment; the estimate for a segment of duration h is h times the largest
+  /// violation of the dynamics by the cubic interpolant (in any state) at a
+  /// quarter and at three quarters of the segment.
+  Eigen::VectorXd EstimateCollocationErrors(
+      const solvers::MathematicalProgramResult& result) const;
+
  private:
   // Implements a running cost at all timesteps using trapezoidal integration.
   void DoAddRunningCost(const symbolic::Expression& e) override;
@@ -140,6 +158,47 @@ class DirectCollocationConstraint : public solvers::Constraint {
   const int num_inputs_{0};
 };
 
+/// Options for SolveDirectCollocationWithMeshRefinement().
+struct DirectCollocationMeshRefinementOptions {
+  /// The segments whose estimated error (see
+  /// DirectCollocation::EstimateCollocationErrors()) exceeds this tolerance
+  /// are refined.
+  double tolerance{1e-6};
+  /// The maximum number of times the problem is refined and solved again.
+  int max_refinements{5};
+};
+
+/// The result of SolveDirectCollocationWithMeshRefinement().
+struct DirectCollocationMeshRefinementResult {
+  /// The problem that was solved last, with the refined knots.
+  std::unique_ptr<DirectCollocation> program;
+  /// The result of solving `program`.
+  solvers::MathematicalProgramResult result;
+};
+
+/// Solves a DirectCollocation problem on a mesh of knots that is refined only
+/// where it is needed, rather than on a uniformly fine mesh.
+///
+/// The problem is first solved with @p num_time_samples knots. Then, as long
+/// as the solve succeeds and the estimated error of some segment exceeds the
+/// tolerance (see DirectCollocation::EstimateCollocationErrors()), a knot is
+/// inserted at the midpoint of each such segment, and the problem with the
+/// new knots is solved again. This solve is warm started with the timesteps,
+/// states and inputs of the previous solution interpolated at the new knots.
+///
+/// @param make_program Makes the problem with the given number of knots,
+/// including its costs and constraints. Its timestep bounds must admit the
+/// refined timesteps, which halve those of the refined segments.
+/// @param num_time_samples The number of knots of the first solve.
+/// @param options The refinement options.
+/// @throws std::exception if @p make_program returns null, or if @p options
+/// are invalid.
+DirectCollocationMeshRefinementResult SolveDirectCollocationWithMeshRefinement(
+    const std::function<std::unique_ptr<DirectCollocation>(
+        int num_time_samples)>& make_program,
+    int num_time_samples,
+    const DirectCollocationMeshRefinementOptions& options = {});
+
 // Note: The order of arguments is a compromise between GSG and the desire to
 // match the AddConstraint interfaces in MathematicalProgram.
 /// Helper method to add a DirectCollocationConstraint to the @p prog,
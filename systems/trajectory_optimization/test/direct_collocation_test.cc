@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/examples/rimless_wheel/rimless_wheel.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/benchmarks/pendulum/make_pendulum_plant.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/snopt_solver.h"
@@ -117,6 +119,82 @@ GTEST_TEST(DirectCollocationTest, TestCollocationConstraint) {
   }
 }
 
+// Checks that evaluating all the collocation constraints in parallel, as a
+// single constraint, gives the same values and gradients as the constraints
+// bound to each segment.
+GTEST_TEST(DirectCollocationTest, ParallelCollocationConstraint) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+
+  const int kNumSampleTimes = 6;
+  const int kNumThreads = 3;
+  const double kTimeStep = .1;
+  DirectCollocation serial_prog(system.get(), *context, kNumSampleTimes,
+                                kTimeStep, 2 * kTimeStep);
+  DirectCollocation parallel_prog(
+      system.get(), *context, kNumSampleTimes, kTimeStep, 2 * kTimeStep,
+      InputPortSelection::kUseFirstInputIfItExists,
+      false /* assume_non_continuous_states_are_fixed */, kNumThreads);
+  ASSERT_EQ(serial_prog.num_vars(), parallel_prog.num_vars());
+  ASSERT_EQ(serial_prog.generic_constraints().size(), kNumSampleTimes - 1);
+  ASSERT_EQ(parallel_prog.generic_constraints().size(), 1);
+
+  // The timesteps need to be positive.
+  const Eigen::VectorXd guess =
+      Eigen::VectorXd::LinSpaced(serial_prog.num_vars(), 0.1, 2.0);
+  serial_prog.SetInitialGuessForAllVariables(guess);
+  parallel_prog.SetInitialGuessForAllVariables(guess);
+
+  const auto& parallel_binding = parallel_prog.generic_constraints()[0];
+  const VectorX<symbolic::Variable>& parallel_vars =
+      parallel_binding.variables();
+  AutoDiffVecXd parallel_y;
+  parallel_binding.evaluator()->Eval(
+      math::initializeAutoDiff(
+          parallel_prog.GetInitialGuess(parallel_vars)),
+      &parallel_y);
+  EXPECT_TRUE(CompareMatrices(
+      math::autoDiffToValueMatrix(parallel_y),
+      parallel_prog.EvalBindingAtInitialGuess(parallel_binding), 1e-12));
+  const Eigen::MatrixXd parallel_gradient =
+      math::autoDiffToGradientMatrix(parallel_y);
+
+  // Returns the index in parallel_vars of the variable with the same index as
+  // `serial_var` in serial_prog.
+  auto parallel_index = [&](const symbolic::Variable& serial_var) {
+    const symbolic::Variable& var = parallel_prog.decision_variable(
+        serial_prog.FindDecisionVariableIndex(serial_var));
+    for (int k = 0; k < parallel_vars.size(); ++k) {
+      if (parallel_vars(k).equal_to(var)) return k;
+    }
+    return -1;
+  };
+
+  const int num_states = system->num_continuous_states();
+  Eigen::MatrixXd expected_gradient =
+      Eigen::MatrixXd::Zero(parallel_y.size(), parallel_vars.size());
+  for (int i = 0; i < kNumSampleTimes - 1; ++i) {
+    const auto& binding = serial_prog.generic_constraints()[i];
+    AutoDiffVecXd y;
+    binding.evaluator()->Eval(
+        math::initializeAutoDiff(
+            serial_prog.GetInitialGuess(binding.variables())),
+        &y);
+    EXPECT_TRUE(CompareMatrices(
+        math::autoDiffToValueMatrix(parallel_y)
+            .segment(i * num_states, num_states),
+        math::autoDiffToValueMatrix(y), 1e-12));
+    const Eigen::MatrixXd gradient = math::autoDiffToGradientMatrix(y);
+    for (int k = 0; k < binding.variables().size(); ++k) {
+      const int index = parallel_index(binding.variables()(k));
+      ASSERT_GE(index, 0);
+      expected_gradient.block(i * num_states, index, num_states, 1) +=
+          gradient.col(k);
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(parallel_gradient, expected_gradient, 1e-12));
+}
+
 // Checks the collocation constraint value against the interpolation used
 // in the reconstructed trajectories.  This confirms that the reconstruction
 // is using the same interpolation algorithms as the actual optimization.
@@ -286,6 +364,48 @@ GTEST_TEST(DirectCollocationTest, NoInputs) {
   EXPECT_EQ(state_trajectory.get_number_of_segments(), kNumSampleTimes - 1);
 }
 
+// Tests that the mesh refinement inserts knots until the estimated errors are
+// within tolerance, and that the refined solution is accurate.
+GTEST_TEST(DirectCollocationTest, MeshRefinement) {
+  // xdot = -x.
+  systems::LinearSystem<double> plant(
+      Vector1d(-1.0),                        // A
+      Eigen::Matrix<double, 1, 0>::Zero(),   // B
+      Eigen::Matrix<double, 0, 1>::Zero(),   // C
+      Eigen::Matrix<double, 0, 0>::Zero());  // D
+  auto context = plant.CreateDefaultContext();
+
+  const double x0 = 2.0;
+  const double kDuration = 4.0;
+  auto make_program = [&](int num_time_samples) {
+    auto prog = std::make_unique<DirectCollocation>(
+        &plant, *context, num_time_samples, 0.01, kDuration);
+    prog->AddLinearConstraint(prog->initial_state() == Vector1d(x0));
+    prog->AddDurationBounds(kDuration, kDuration);
+    return prog;
+  };
+
+  const int kNumSampleTimes{3};
+  DirectCollocationMeshRefinementOptions options;
+  options.tolerance = 1e-4;
+  options.max_refinements = 10;
+  const DirectCollocationMeshRefinementResult refined =
+      SolveDirectCollocationWithMeshRefinement(make_program, kNumSampleTimes,
+                                               options);
+  ASSERT_TRUE(refined.result.is_success());
+  const Eigen::VectorXd errors =
+      refined.program->EstimateCollocationErrors(refined.result);
+  EXPECT_GT(errors.size(), kNumSampleTimes - 1);
+  EXPECT_LE(errors.maxCoeff(), options.tolerance);
+  EXPECT_NEAR(refined.result.GetSolution(refined.program->final_state())(0),
+              x0 * std::exp(-kDuration), 1e-3);
+
+  options.tolerance = 0;
+  EXPECT_THROW(SolveDirectCollocationWithMeshRefinement(
+                   make_program, kNumSampleTimes, options),
+               std::exception);
+}
+
 GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   const auto double_integrator = MakeDoubleIntegrator();
   auto context = double_integrator->CreateDefaultContext();
@@ -67,6 +67,7 @@
     "//geometry/proximity",
     "//geometry/query_results",
     "//geometry/render",
+    "//geometry/render/gl",
     "//geometry/render/shaders",
     "//lcm",
     "//manipulation/kuka_iiwa",
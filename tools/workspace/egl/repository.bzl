@@ -0,0 +1,18 @@
+# -*- mode: python -*-
+
+load(
+    "@drake//tools/workspace:pkg_config.bzl",
+    "pkg_config_repository",
+)
+
+def egl_repository(
+        name,
+        licenses = ["notice"],  # SGI-B-2.0
+        modname = "egl",
+        **kwargs):
+    pkg_config_repository(
+        name = name,
+        licenses = licenses,
+        modname = modname,
+        **kwargs
+    )
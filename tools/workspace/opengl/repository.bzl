@@ -0,0 +1,18 @@
+# -*- mode: python -*-
+
+load(
+    "@drake//tools/workspace:pkg_config.bzl",
+    "pkg_config_repository",
+)
+
+def opengl_repository(
+        name,
+        licenses = ["notice"],  # SGI-B-2.0
+        modname = "gl",
+        **kwargs):
+    pkg_config_repository(
+        name = name,
+        licenses = licenses,
+        modname = modname,
+        **kwargs
+    )